@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2013-2014 Wind River Systems, Inc.
  * Copyright (c) 2020-2022 Qualcomm Innovation Center, Inc.
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -67,6 +68,54 @@ int arch_dcache_flush_and_invd_range(void *start_addr, size_t size)
 	return 0;
 }
 
+#ifdef CONFIG_ARCH_HAS_DCACHE_RANGES
+
+#ifndef __SCB_DCACHE_LINE_SIZE
+#define __SCB_DCACHE_LINE_SIZE 32U
+#endif
+
+/* One maintenance operation per line, with the barriers once for the list */
+static void dcache_ranges_op(volatile uint32_t *reg, const struct sys_cache_range *ranges,
+			     size_t count)
+{
+	__DSB();
+
+	for (size_t i = 0; i < count; i++) {
+		uintptr_t end = (uintptr_t)ranges[i].addr + ranges[i].size;
+		uintptr_t addr = ROUND_DOWN((uintptr_t)ranges[i].addr, __SCB_DCACHE_LINE_SIZE);
+
+		for (; addr < end; addr += __SCB_DCACHE_LINE_SIZE) {
+			*reg = addr;
+		}
+	}
+
+	__DSB();
+	__ISB();
+}
+
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	dcache_ranges_op(&SCB->DCCMVAC, ranges, count);
+
+	return 0;
+}
+
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	dcache_ranges_op(&SCB->DCIMVAC, ranges, count);
+
+	return 0;
+}
+
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t count)
+{
+	dcache_ranges_op(&SCB->DCCIMVAC, ranges, count);
+
+	return 0;
+}
+
+#endif /* CONFIG_ARCH_HAS_DCACHE_RANGES */
+
 void arch_icache_enable(void)
 {
 	SCB_EnableICache();
@@ -233,6 +233,7 @@ endif()
 
 if(CONFIG_INPUT)
   zephyr_iterable_section(NAME input_callback KVMA RAM_REGION GROUP RODATA_REGION)
+  zephyr_iterable_section(NAME input_batch_callback KVMA RAM_REGION GROUP RODATA_REGION)
 endif()
 
 if(CONFIG_USBD_MSC_CLASS)
@@ -99,6 +99,24 @@ struct adc_emul_data {
 	struct k_sem sem;
 	/** Mutex used to control access to channels config and ref voltages */
 	struct k_mutex cfg_mtx;
+#ifdef CONFIG_ADC_STREAM
+	/** Timer pacing the frames of a stream */
+	struct k_timer stream_timer;
+	/** Work sampling a frame of a stream */
+	struct k_work stream_work;
+	/** Callback for the filled halves of the stream buffer, NULL if stopped */
+	adc_stream_callback_t stream_cb;
+	/** User data of @a stream_cb */
+	void *stream_user_data;
+	/** Stream buffer, two blocks */
+	int16_t *stream_buf;
+	/** Position of the next sample in the stream buffer */
+	size_t stream_pos;
+	/** Number of samples in a block */
+	size_t stream_block;
+	/** Mask with channels sampled by the stream */
+	uint32_t stream_channels;
+#endif
 
 	/** Stack for acquisition thread */
 	K_KERNEL_STACK_MEMBER(stack,
@@ -579,6 +597,122 @@ static void adc_emul_acquisition_thread(void *p1, void *p2, void *p3)
 	}
 }
 
+#ifdef CONFIG_ADC_STREAM
+static void adc_emul_stream_timer(struct k_timer *timer)
+{
+	struct adc_emul_data *data = CONTAINER_OF(timer, struct adc_emul_data,
+						  stream_timer);
+
+	k_work_submit(&data->stream_work);
+}
+
+/**
+ * @brief Sample one frame of a stream, and hand over the block once full
+ *
+ * Runs from the system work queue, as the input values are obtained under
+ * the configuration mutex.
+ *
+ * @param work Stream work of the ADC emulator
+ */
+static void adc_emul_stream_sample(struct k_work *work)
+{
+	struct adc_emul_data *data = CONTAINER_OF(work, struct adc_emul_data,
+						  stream_work);
+	uint32_t channels;
+	int err = 0;
+
+	k_mutex_lock(&data->cfg_mtx, K_FOREVER);
+
+	/* Stopped while the work was pending */
+	if (data->stream_cb == NULL) {
+		goto out;
+	}
+
+	channels = data->stream_channels;
+
+	while (channels) {
+		adc_emul_res_t result = 0;
+		unsigned int chan = find_lsb_set(channels) - 1;
+
+		err = adc_emul_get_chan_value(data, chan, &result);
+		if (err) {
+			data->stream_cb(data->dev, NULL, err,
+					data->stream_user_data);
+			goto out;
+		}
+
+		data->stream_buf[data->stream_pos++] = result;
+		WRITE_BIT(channels, chan, 0);
+	}
+
+	if (data->stream_pos % data->stream_block == 0) {
+		const int16_t *block = &data->stream_buf[data->stream_pos -
+							 data->stream_block];
+
+		if (data->stream_pos == 2 * data->stream_block) {
+			data->stream_pos = 0;
+		}
+
+		data->stream_cb(data->dev, block, 0, data->stream_user_data);
+	}
+
+out:
+	k_mutex_unlock(&data->cfg_mtx);
+}
+
+static int adc_emul_stream_start(const struct device *dev,
+				 const struct adc_stream_cfg *cfg,
+				 int16_t *buf, adc_stream_callback_t cb,
+				 void *user_data)
+{
+	const struct adc_emul_config *config = dev->config;
+	struct adc_emul_data *data = dev->data;
+
+	/* Back to back frames are left to adc_read() */
+	if (cfg->interval_us == 0 || cfg->trigger != 0) {
+		return -ENOTSUP;
+	}
+
+	if (cfg->resolution > ADC_EMUL_MAX_RESOLUTION ||
+	    cfg->resolution == 0 || cfg->channels == 0 ||
+	    find_msb_set(cfg->channels) > config->num_channels) {
+		return -EINVAL;
+	}
+
+	adc_context_lock(&data->ctx, false, NULL);
+
+	k_mutex_lock(&data->cfg_mtx, K_FOREVER);
+	data->res_mask = BIT_MASK(cfg->resolution);
+	data->stream_buf = buf;
+	data->stream_pos = 0;
+	data->stream_block = cfg->frames * POPCOUNT(cfg->channels);
+	data->stream_channels = cfg->channels;
+	data->stream_user_data = user_data;
+	data->stream_cb = cb;
+	k_mutex_unlock(&data->cfg_mtx);
+
+	k_timer_start(&data->stream_timer, K_USEC(cfg->interval_us),
+		      K_USEC(cfg->interval_us));
+
+	return 0;
+}
+
+static int adc_emul_stream_stop(const struct device *dev)
+{
+	struct adc_emul_data *data = dev->data;
+
+	k_timer_stop(&data->stream_timer);
+
+	k_mutex_lock(&data->cfg_mtx, K_FOREVER);
+	data->stream_cb = NULL;
+	k_mutex_unlock(&data->cfg_mtx);
+
+	adc_context_release(&data->ctx, 0);
+
+	return 0;
+}
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief Function called on init for each ADC emulator device. It setups all
  *        channels to return constant 0 mV and create acquisition thread.
@@ -597,6 +731,10 @@ static int adc_emul_init(const struct device *dev)
 
 	k_sem_init(&data->sem, 0, 1);
 	k_mutex_init(&data->cfg_mtx);
+#ifdef CONFIG_ADC_STREAM
+	k_timer_init(&data->stream_timer, adc_emul_stream_timer, NULL);
+	k_work_init(&data->stream_work, adc_emul_stream_sample);
+#endif
 
 	for (chan = 0; chan < config->num_channels; chan++) {
 		struct adc_emul_chan_cfg *chan_cfg = &data->chan_cfg[chan];
@@ -626,6 +764,9 @@ static int adc_emul_init(const struct device *dev)
 		.ref_internal = DT_INST_PROP(_num, ref_internal_mv),	\
 		IF_ENABLED(CONFIG_ADC_ASYNC,				\
 			(.read_async = adc_emul_read_async,))		\
+		IF_ENABLED(CONFIG_ADC_STREAM,				\
+			(.stream_start = adc_emul_stream_start,		\
+			 .stream_stop = adc_emul_stream_stop,))		\
 	};								\
 									\
 	static struct adc_emul_chan_cfg					\
@@ -162,6 +162,12 @@ typedef uint32_t adc_data_size_t;
 typedef uint16_t adc_data_size_t;
 #endif
 
+/* Streams are captured by DMA, in the 16-bit samples of the stream API */
+#if defined(CONFIG_ADC_STREAM) && defined(CONFIG_ADC_STM32_DMA) && \
+	!defined(CONFIG_SOC_SERIES_STM32N6X)
+#define ADC_STM32_STREAM
+#endif
+
 struct adc_stm32_data {
 	struct adc_context ctx;
 	const struct device *dev;
@@ -178,6 +184,13 @@ struct adc_stm32_data {
 	volatile int dma_error;
 	struct stream dma;
 #endif
+
+#ifdef ADC_STM32_STREAM
+	adc_stream_callback_t stream_cb;
+	void *stream_user_data;
+	int16_t *stream_buf;
+	size_t stream_block;
+#endif
 };
 
 struct adc_stm32_cfg {
@@ -196,10 +209,13 @@ struct adc_stm32_cfg {
 };
 
 #ifdef CONFIG_ADC_STM32_DMA
-static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
+static void adc_stm32_enable_dma_support(ADC_TypeDef *adc, bool circular)
 {
-	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers */
+	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers,
+	 * or to unlimited mode for a circular transfer
+	 */
 #if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
+	ARG_UNUSED(circular);
 	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_UNLIMITED);
 #elif defined(CONFIG_SOC_SERIES_STM32H7X) || \
 	defined(CONFIG_SOC_SERIES_STM32N6X) || \
@@ -208,15 +224,17 @@ static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
 	/* H72x ADC3 and U5 ADC4 are different from the rest, but this call works also for them,
 	 * so no need to call their specific function
 	 */
-	LL_ADC_REG_SetDataTransferMode(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDataTransferMode(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED :
+						       LL_ADC_REG_DMA_TRANSFER_LIMITED);
 #else
 	/* Default mechanism for other MCUs */
-	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDMATransfer(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED :
+						  LL_ADC_REG_DMA_TRANSFER_LIMITED);
 #endif
 }
 
 static int adc_stm32_dma_start(const struct device *dev,
-			       void *buffer, size_t channel_count)
+			       void *buffer, size_t size, bool circular)
 {
 	const struct adc_stm32_cfg *config = dev->config;
 	ADC_TypeDef *adc = config->base;
@@ -229,16 +247,19 @@ static int adc_stm32_dma_start(const struct device *dev,
 	blk_cfg = &dma->dma_blk_cfg;
 
 	/* prepare the block */
-	blk_cfg->block_size = channel_count * sizeof(adc_data_size_t);
+	blk_cfg->block_size = size;
 
 	/* Source and destination */
 	blk_cfg->source_address = (uint32_t)LL_ADC_DMA_GetRegAddr(adc, LL_ADC_DMA_REG_REGULAR_DATA);
 	blk_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-	blk_cfg->source_reload_en = 0;
+	/* A circular transfer reloads both addresses, and reports each half
+	 * of the buffer
+	 */
+	blk_cfg->source_reload_en = circular;
 
 	blk_cfg->dest_address = (uint32_t)buffer;
 	blk_cfg->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
-	blk_cfg->dest_reload_en = 0;
+	blk_cfg->dest_reload_en = circular;
 
 	/* Manually set the FIFO threshold to 1/4 because the
 	 * dmamux DTS entry does not contain fifo threshold
@@ -256,7 +277,7 @@ static int adc_stm32_dma_start(const struct device *dev,
 		return ret;
 	}
 
-	adc_stm32_enable_dma_support(adc);
+	adc_stm32_enable_dma_support(adc, circular);
 
 	data->dma_error = 0;
 	ret = dma_start(data->dma.dma_dev, data->dma.channel);
@@ -745,6 +766,25 @@ static int adc_stm32_oversampling(const struct device *dev, uint8_t ratio)
 }
 #endif /* CONFIG_SOC_SERIES_STM32xxx */
 
+#ifdef ADC_STM32_STREAM
+static void adc_stm32_stream_dma_done(struct adc_stm32_data *data, int status)
+{
+	const int16_t *block = data->stream_buf;
+
+	if (status < 0) {
+		data->stream_cb(data->dev, NULL, status, data->stream_user_data);
+		return;
+	}
+
+	/* Half transfer for the first block, transfer complete for the second */
+	if (status == DMA_STATUS_COMPLETE) {
+		block += data->stream_block;
+	}
+
+	data->stream_cb(data->dev, block, 0, data->stream_user_data);
+}
+#endif /* ADC_STM32_STREAM */
+
 #ifdef CONFIG_ADC_STM32_DMA
 static void dma_callback(const struct device *dev, void *user_data,
 			 uint32_t channel, int status)
@@ -766,6 +806,12 @@ static void dma_callback(const struct device *dev, void *user_data,
 				"increase prescaler value or increase sampling times.");
 		}
 #endif /* !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
+#ifdef ADC_STM32_STREAM
+		if (data->stream_cb != NULL) {
+			adc_stm32_stream_dma_done(data, status);
+			return;
+		}
+#endif /* ADC_STM32_STREAM */
 		if (status >= 0) {
 			data->samples_count = data->channel_count;
 			data->buffer += data->channel_count;
@@ -1064,7 +1110,8 @@ static void adc_context_start_sampling(struct adc_context *ctx)
 	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
 	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
 #endif
-	adc_stm32_dma_start(dev, data->buffer, data->channel_count);
+	adc_stm32_dma_start(dev, data->buffer, data->channel_count * sizeof(adc_data_size_t),
+			    false);
 #endif
 	adc_stm32_start_conversion(dev);
 }
@@ -1177,6 +1224,170 @@ static int adc_stm32_read_async(const struct device *dev,
 }
 #endif
 
+#ifdef ADC_STM32_STREAM
+static int adc_stm32_stream_setup(const struct device *dev, const struct adc_stream_cfg *cfg,
+				  int16_t *buf, adc_stream_callback_t cb, void *user_data)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = config->base;
+	const struct adc_sequence sequence = {
+		.channels = cfg->channels,
+		.resolution = cfg->resolution,
+		.oversampling = cfg->oversampling,
+	};
+	size_t size;
+	int err;
+
+	data->channels = cfg->channels;
+	data->channel_count = POPCOUNT(cfg->channels);
+
+	if (data->channel_count == 0) {
+		LOG_ERR("No channels selected");
+		return -EINVAL;
+	}
+
+#if ANY_ADC_SEQUENCER_TYPE_IS(FULLY_CONFIGURABLE)
+	if (data->channel_count > ARRAY_SIZE(table_seq_len)) {
+		LOG_ERR("Too many channels for sequencer. Max: %d", ARRAY_SIZE(table_seq_len));
+		return -EINVAL;
+	}
+#endif /* ANY_ADC_SEQUENCER_TYPE_IS(FULLY_CONFIGURABLE) */
+
+	err = set_resolution(dev, &sequence);
+	if (err < 0) {
+		return err;
+	}
+
+	err = set_sequencer(dev);
+	if (err < 0) {
+		return err;
+	}
+
+	/* Both blocks of the double buffer */
+	size = 2 * cfg->frames * data->channel_count * sizeof(adc_data_size_t);
+
+	if (!stm32_buf_in_nocache((uintptr_t)buf, size)) {
+		LOG_ERR("Supplied buffer is not in a non-cacheable region.");
+		return -EINVAL;
+	}
+
+#ifdef HAS_OVERSAMPLING
+	err = adc_stm32_oversampling(dev, cfg->oversampling);
+	if (err) {
+		return err;
+	}
+#else
+	if (cfg->oversampling) {
+		LOG_ERR("Oversampling not supported");
+		return -ENOTSUP;
+	}
+#endif /* HAS_OVERSAMPLING */
+
+	adc_stm32_enable(adc);
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
+	LL_ADC_ClearFlag_OVR(adc);
+#endif /* !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
+
+	/* A trigger starts each sequence, otherwise the ADC converts back to back */
+	if (cfg->trigger != 0U) {
+		LL_ADC_REG_SetTriggerSource(adc, cfg->trigger);
+	} else {
+		LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_CONTINUOUS);
+	}
+
+	data->stream_buf = buf;
+	data->stream_block = cfg->frames * data->channel_count;
+	data->stream_user_data = user_data;
+	data->stream_cb = cb;
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
+	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
+#endif
+	err = adc_stm32_dma_start(dev, buf, size, true);
+	if (err) {
+		data->stream_cb = NULL;
+		LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_SINGLE);
+		LL_ADC_REG_SetTriggerSource(adc, LL_ADC_REG_TRIG_SOFTWARE);
+		return err;
+	}
+
+	adc_stm32_start_conversion(dev);
+
+	return 0;
+}
+
+static int adc_stm32_stream_start(const struct device *dev, const struct adc_stream_cfg *cfg,
+				  int16_t *buf, adc_stream_callback_t cb, void *user_data)
+{
+	struct adc_stm32_data *data = dev->data;
+	int err;
+
+	/* Without a trigger, conversions can only run back to back */
+	if (cfg->interval_us != 0U && cfg->trigger == 0U) {
+		return -ENOTSUP;
+	}
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) || DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	/* Conversions are only started by software on these series */
+	if (cfg->trigger != 0U) {
+		return -ENOTSUP;
+	}
+#endif
+
+	adc_context_lock(&data->ctx, false, NULL);
+	pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+
+	err = adc_stm32_stream_setup(dev, cfg, buf, cb, user_data);
+	if (err < 0) {
+		pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+		if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+			pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+		}
+		adc_context_release(&data->ctx, err);
+	}
+
+	return err;
+}
+
+static int adc_stm32_stream_stop(const struct device *dev)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = config->base;
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) && \
+	!DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	if (LL_ADC_REG_IsConversionOngoing(adc)) {
+		LL_ADC_REG_StopConversion(adc);
+		while (LL_ADC_REG_IsConversionOngoing(adc)) {
+		}
+	}
+#endif
+
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_SINGLE);
+	LL_ADC_REG_SetTriggerSource(adc, LL_ADC_REG_TRIG_SOFTWARE);
+
+	dma_stop(data->dma.dma_dev, data->dma.channel);
+	data->stream_cb = NULL;
+
+	adc_context_on_complete(&data->ctx, 0);
+
+	pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+	adc_context_release(&data->ctx, 0);
+
+	return 0;
+}
+#endif /* ADC_STM32_STREAM */
+
 static int adc_stm32_sampling_time_check(const struct device *dev, uint16_t acq_time)
 {
 	const struct adc_stm32_cfg *config =
@@ -1723,6 +1934,10 @@ static DEVICE_API(adc, api_stm32_driver_api) = {
 	.read = adc_stm32_read,
 #ifdef CONFIG_ADC_ASYNC
 	.read_async = adc_stm32_read_async,
+#endif
+#ifdef ADC_STM32_STREAM
+	.stream_start = adc_stm32_stream_start,
+	.stream_stop = adc_stm32_stream_stop,
 #endif
 	.ref_internal = STM32_ADC_VREF_MV, /* VREF is usually connected to VDD */
 };
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/rtio/work.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(adc_stream, CONFIG_ADC_LOG_LEVEL);
+
+static uint32_t adc_stream_block_size(const struct adc_stream_cfg *cfg)
+{
+	return ADC_STREAM_BLOCK_SIZE(cfg->channels, cfg->frames);
+}
+
+static void adc_stream_header_fill(const struct adc_stream_cfg *cfg, uint8_t *buf,
+				   uint64_t timestamp, uint32_t dropped)
+{
+	struct adc_stream_header *hdr = (struct adc_stream_header *)buf;
+
+	*hdr = (struct adc_stream_header){
+		.timestamp = timestamp,
+		.channels = cfg->channels,
+		.interval_us = cfg->interval_us,
+		.dropped = dropped,
+		.frames = cfg->frames,
+		.resolution = cfg->resolution,
+	};
+}
+
+static void adc_stream_read_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	const struct adc_stream_cfg *cfg = &data->cfg;
+	const uint32_t size = adc_stream_block_size(cfg);
+	const struct adc_sequence_options options = {
+		.interval_us = cfg->interval_us,
+		.extra_samplings = cfg->frames - 1,
+	};
+	struct adc_sequence sequence = {
+		.options = &options,
+		.channels = cfg->channels,
+		.buffer_size = size - sizeof(struct adc_stream_header),
+		.resolution = cfg->resolution,
+		.oversampling = cfg->oversampling,
+	};
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	/* The hardware trigger is only known to the native implementations */
+	if (cfg->trigger != 0U) {
+		ret = -ENOTSUP;
+	} else {
+		ret = rtio_sqe_rx_buf(iodev_sqe, size, size, &buf, &buf_len);
+	}
+
+	if (ret == 0) {
+		sequence.buffer = buf + sizeof(struct adc_stream_header);
+		ret = adc_read(data->dev, &sequence);
+	}
+
+	if (ret < 0) {
+		LOG_DBG("%s read failed: %d", data->dev->name, ret);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	adc_stream_header_fill(cfg, buf, k_ticks_to_ns_floor64(k_uptime_ticks()), 0);
+	rtio_iodev_sqe_ok(iodev_sqe, size);
+}
+
+static void adc_stream_default_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		LOG_ERR("RTIO work item allocation failed for %s. Consider to increase "
+			"CONFIG_RTIO_WORKQ_POOL_ITEMS.", data->dev->name);
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, adc_stream_read_sync);
+}
+
+/* Hands every pending request to the work queue, or fails it with status */
+static void adc_stream_flush(const struct adc_iodev_data *data, int status)
+{
+	struct adc_stream_state *state = data->state;
+	struct mpsc_node *node;
+	k_spinlock_key_t key;
+
+	for (;;) {
+		key = k_spin_lock(&state->lock);
+		node = mpsc_pop(&state->sqe_q);
+		k_spin_unlock(&state->lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		if (status == 0) {
+			adc_stream_default_submit(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+		} else {
+			rtio_iodev_sqe_err(CONTAINER_OF(node, struct rtio_iodev_sqe, q), status);
+		}
+	}
+}
+
+/* Stops the capture, the pending requests complete with status */
+static int adc_stream_halt(const struct adc_iodev_data *data, int status)
+{
+	const struct adc_driver_api *api = data->dev->api;
+	struct adc_stream_state *state = data->state;
+	k_spinlock_key_t key;
+	bool running;
+	int ret = -EALREADY;
+
+	key = k_spin_lock(&state->lock);
+	running = state->running;
+	state->running = false;
+	k_spin_unlock(&state->lock, key);
+
+	if (running) {
+		ret = api->stream_stop(data->dev);
+	}
+
+	adc_stream_flush(data, status);
+
+	return ret;
+}
+
+static void adc_stream_block_done(const struct device *dev, const int16_t *samples, int status,
+				  void *user_data)
+{
+	const struct adc_iodev_data *data = user_data;
+	const struct adc_stream_cfg *cfg = &data->cfg;
+	const uint32_t size = adc_stream_block_size(cfg);
+	struct adc_stream_state *state = data->state;
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct mpsc_node *node;
+	k_spinlock_key_t key;
+	uint32_t dropped = 0;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	if (status < 0) {
+		LOG_ERR("%s stream failed: %d", dev->name, status);
+		adc_stream_halt(data, status);
+		return;
+	}
+
+	key = k_spin_lock(&state->lock);
+	node = mpsc_pop(&state->sqe_q);
+	if (node == NULL) {
+		state->dropped++;
+	} else {
+		dropped = state->dropped;
+		state->dropped = 0;
+	}
+	k_spin_unlock(&state->lock, key);
+
+	if (node == NULL) {
+		return;
+	}
+
+	/* Completing outside of the lock, a multishot request is resubmitted */
+	iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, size, size, &buf, &buf_len);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	adc_stream_header_fill(cfg, buf, k_ticks_to_ns_floor64(k_uptime_ticks()), dropped);
+	memcpy(buf + sizeof(struct adc_stream_header), samples,
+	       size - sizeof(struct adc_stream_header));
+
+	rtio_iodev_sqe_ok(iodev_sqe, size);
+}
+
+static void adc_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	const struct adc_driver_api *api = data->dev->api;
+	struct adc_stream_state *state = data->state;
+	k_spinlock_key_t key;
+	bool start;
+	int ret;
+
+	if (iodev_sqe->sqe.op != RTIO_OP_RX) {
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	if (api->stream_start == NULL || state->fallback) {
+		adc_stream_default_submit(iodev_sqe);
+		return;
+	}
+
+	key = k_spin_lock(&state->lock);
+	mpsc_push(&state->sqe_q, &iodev_sqe->q);
+	start = !state->running;
+	state->running = true;
+	if (start) {
+		state->dropped = 0;
+	}
+	k_spin_unlock(&state->lock, key);
+
+	if (!start) {
+		return;
+	}
+
+	ret = api->stream_start(data->dev, &data->cfg, data->buf, adc_stream_block_done,
+				(void *)data);
+	if (ret == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&state->lock);
+	state->running = false;
+	state->fallback = (ret == -ENOTSUP);
+	k_spin_unlock(&state->lock, key);
+
+	if (state->fallback) {
+		LOG_DBG("%s cannot stream natively, using adc_read()", data->dev->name);
+		ret = 0;
+	}
+
+	adc_stream_flush(data, ret);
+}
+
+const struct rtio_iodev_api adc_iodev_api = {
+	.submit = adc_iodev_submit,
+};
+
+int adc_stream_stop(const struct rtio_iodev *iodev)
+{
+	const struct adc_iodev_data *data = iodev->data;
+
+	return adc_stream_halt(data, -ECANCELED);
+}
+
+int adc_stream_decode(const uint8_t *buf, uint32_t buf_len, uint8_t channel_id, int32_t *values,
+		      uint16_t max_values)
+{
+	const struct adc_stream_header *hdr = (const struct adc_stream_header *)buf;
+	const int16_t *samples = (const int16_t *)(hdr + 1);
+	uint8_t channel_count;
+	uint8_t index;
+	uint16_t n;
+
+	if (buf_len < sizeof(*hdr) ||
+	    buf_len < ADC_STREAM_BLOCK_SIZE(hdr->channels, hdr->frames) ||
+	    channel_id >= 32 || (hdr->channels & BIT(channel_id)) == 0U) {
+		return -EINVAL;
+	}
+
+	/* Samples are interleaved in ascending channel order */
+	channel_count = POPCOUNT(hdr->channels);
+	index = POPCOUNT(hdr->channels & BIT_MASK(channel_id));
+	n = MIN(hdr->frames, max_values);
+
+	for (uint16_t i = 0; i < n; i++) {
+		values[i] = samples[i * channel_count + index];
+	}
+
+	return n;
+}
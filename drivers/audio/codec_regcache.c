@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/logging/log.h>
+
+#include "codec_regcache.h"
+
+LOG_MODULE_REGISTER(audio_codec_regcache, CONFIG_AUDIO_CODEC_LOG_LEVEL);
+
+#define REGCACHE_VALID    BIT(0)
+#define REGCACHE_DIRTY    BIT(1)
+#define REGCACHE_FLUSHING BIT(2)
+
+/* Size of the buffers used to flush the deferred writes */
+#define REGCACHE_XFER_BYTES 64
+#define REGCACHE_XFER_MSGS  8
+
+struct regcache_xfer {
+	uint8_t buf[REGCACHE_XFER_BYTES];
+	struct i2c_msg msgs[REGCACHE_XFER_MSGS];
+	size_t used;
+	uint8_t num_msgs;
+};
+
+static size_t regcache_encode(uint8_t *buf, uint16_t val, uint8_t bytes)
+{
+	if (bytes == 2) {
+		buf[0] = val >> 8;
+		buf[1] = val & 0xff;
+	} else {
+		buf[0] = val & 0xff;
+	}
+
+	return bytes;
+}
+
+static bool regcache_is_volatile(const struct codec_regcache *cache, uint16_t reg)
+{
+	return cache->config->is_volatile != NULL && cache->config->is_volatile(reg);
+}
+
+static struct codec_regcache_entry *regcache_find(struct codec_regcache *cache, uint16_t reg)
+{
+	for (uint16_t i = 0; i < cache->count; i++) {
+		if (cache->entries[i].reg == reg) {
+			return &cache->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct codec_regcache_entry *regcache_alloc(struct codec_regcache *cache, uint16_t reg)
+{
+	struct codec_regcache_entry *entry = regcache_find(cache, reg);
+
+	if (entry != NULL || cache->count == cache->size) {
+		return entry;
+	}
+
+	entry = &cache->entries[cache->count++];
+	entry->reg = reg;
+	entry->flags = 0;
+
+	return entry;
+}
+
+static int regcache_bus_read(struct codec_regcache *cache, uint16_t reg, uint16_t *val)
+{
+	const struct codec_regcache_config *config = cache->config;
+	uint8_t addr[2];
+	uint8_t data[2];
+	int ret;
+
+	regcache_encode(addr, reg, config->reg_bytes);
+
+	ret = i2c_write_read_dt(cache->i2c, addr, config->reg_bytes, data, config->val_bytes);
+	if (ret < 0) {
+		LOG_ERR("Failed to read register %#x (%d)", reg, ret);
+		return ret;
+	}
+
+	*val = config->val_bytes == 2 ? ((data[0] << 8) | data[1]) : data[0];
+
+	return 0;
+}
+
+static int regcache_bus_write(struct codec_regcache *cache, uint16_t reg, uint16_t val)
+{
+	const struct codec_regcache_config *config = cache->config;
+	uint8_t data[4];
+	size_t len;
+	int ret;
+
+	len = regcache_encode(data, reg, config->reg_bytes);
+	len += regcache_encode(&data[len], val, config->val_bytes);
+
+	ret = i2c_write_dt(cache->i2c, data, len);
+	if (ret < 0) {
+		LOG_ERR("Failed to write register %#x (%d)", reg, ret);
+	}
+
+	return ret;
+}
+
+static int regcache_xfer_flush(struct codec_regcache *cache, struct regcache_xfer *xfer)
+{
+	int ret = 0;
+
+	if (xfer->num_msgs == 0) {
+		return 0;
+	}
+
+	xfer->msgs[xfer->num_msgs - 1].flags |= I2C_MSG_STOP;
+
+	ret = i2c_transfer_dt(cache->i2c, xfer->msgs, xfer->num_msgs);
+	if (ret < 0) {
+		LOG_ERR("Failed to write registers (%d)", ret);
+	}
+
+	for (uint16_t i = 0; i < cache->count; i++) {
+		struct codec_regcache_entry *entry = &cache->entries[i];
+
+		if (entry->flags & REGCACHE_FLUSHING) {
+			entry->flags &= ~REGCACHE_FLUSHING;
+			if (ret == 0) {
+				entry->flags &= ~REGCACHE_DIRTY;
+			}
+		}
+	}
+
+	xfer->used = 0;
+	xfer->num_msgs = 0;
+
+	return ret;
+}
+
+/* Oldest deferred write not yet part of a transfer */
+static struct codec_regcache_entry *regcache_next_dirty(struct codec_regcache *cache)
+{
+	struct codec_regcache_entry *next = NULL;
+
+	for (uint16_t i = 0; i < cache->count; i++) {
+		struct codec_regcache_entry *entry = &cache->entries[i];
+
+		if ((entry->flags & (REGCACHE_DIRTY | REGCACHE_FLUSHING)) != REGCACHE_DIRTY) {
+			continue;
+		}
+
+		if (next == NULL || entry->seq < next->seq) {
+			next = entry;
+		}
+	}
+
+	return next;
+}
+
+static bool regcache_burst_next(struct codec_regcache *cache,
+				struct codec_regcache_entry **entry)
+{
+	struct codec_regcache_entry *next = regcache_find(cache, (*entry)->reg + 1);
+
+	if (next == NULL ||
+	    (next->flags & (REGCACHE_DIRTY | REGCACHE_FLUSHING)) != REGCACHE_DIRTY ||
+	    next->seq != (*entry)->seq + 1) {
+		return false;
+	}
+
+	*entry = next;
+
+	return true;
+}
+
+int codec_regcache_sync(struct codec_regcache *cache)
+{
+	const struct codec_regcache_config *config = cache->config;
+	const size_t entry_len = config->reg_bytes + config->val_bytes;
+	struct regcache_xfer xfer = {0};
+	struct codec_regcache_entry *entry;
+	int ret;
+
+	while ((entry = regcache_next_dirty(cache)) != NULL) {
+		struct i2c_msg *msg;
+
+		if (xfer.num_msgs == REGCACHE_XFER_MSGS ||
+		    xfer.used + entry_len > sizeof(xfer.buf)) {
+			ret = regcache_xfer_flush(cache, &xfer);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		msg = &xfer.msgs[xfer.num_msgs];
+		msg->buf = &xfer.buf[xfer.used];
+		msg->flags = I2C_MSG_WRITE | (xfer.num_msgs > 0 ? I2C_MSG_RESTART : 0);
+
+		xfer.used += regcache_encode(&xfer.buf[xfer.used], entry->reg, config->reg_bytes);
+		do {
+			xfer.used += regcache_encode(&xfer.buf[xfer.used], entry->val,
+						     config->val_bytes);
+			entry->flags |= REGCACHE_FLUSHING;
+		} while (config->burst && xfer.used + config->val_bytes <= sizeof(xfer.buf) &&
+			 regcache_burst_next(cache, &entry));
+
+		msg->len = &xfer.buf[xfer.used] - msg->buf;
+		xfer.num_msgs++;
+
+		if (!IS_ENABLED(CONFIG_AUDIO_CODEC_REGCACHE_COMBINED)) {
+			ret = regcache_xfer_flush(cache, &xfer);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	}
+
+	ret = regcache_xfer_flush(cache, &xfer);
+	if (ret < 0) {
+		return ret;
+	}
+
+	cache->seq = 0;
+	cache->deferred = false;
+
+	return 0;
+}
+
+void codec_regcache_init(struct codec_regcache *cache, const struct i2c_dt_spec *i2c,
+			 const struct codec_regcache_config *config,
+			 struct codec_regcache_entry *entries, uint16_t size)
+{
+	cache->i2c = i2c;
+	cache->config = config;
+	cache->entries = entries;
+	cache->size = size;
+	cache->count = 0;
+	cache->seq = 0;
+	cache->deferred = false;
+}
+
+int codec_regcache_read(struct codec_regcache *cache, uint16_t reg, uint16_t *val)
+{
+	struct codec_regcache_entry *entry = NULL;
+	bool deferred = cache->deferred;
+	int ret;
+
+	if (!regcache_is_volatile(cache, reg)) {
+		entry = regcache_alloc(cache, reg);
+	}
+
+	if (entry != NULL && (entry->flags & REGCACHE_VALID)) {
+		*val = entry->val;
+		return 0;
+	}
+
+	if (entry == NULL) {
+		/* Bus access, keep it ordered with the pending writes */
+		ret = codec_regcache_sync(cache);
+		if (ret < 0) {
+			return ret;
+		}
+
+		cache->deferred = deferred;
+	}
+
+	ret = regcache_bus_read(cache, reg, val);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (entry != NULL) {
+		entry->val = *val;
+		entry->flags |= REGCACHE_VALID;
+	}
+
+	return 0;
+}
+
+int codec_regcache_write(struct codec_regcache *cache, uint16_t reg, uint16_t val)
+{
+	struct codec_regcache_entry *entry = NULL;
+	bool deferred = cache->deferred;
+	int ret;
+
+	if (!regcache_is_volatile(cache, reg)) {
+		entry = regcache_alloc(cache, reg);
+	}
+
+	if (entry == NULL) {
+		ret = codec_regcache_sync(cache);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = regcache_bus_write(cache, reg, val);
+		cache->deferred = deferred;
+
+		return ret;
+	}
+
+	if ((entry->flags & REGCACHE_VALID) && entry->val == val) {
+		return 0;
+	}
+
+	if (!deferred) {
+		ret = regcache_bus_write(cache, reg, val);
+		if (ret < 0) {
+			entry->flags &= ~REGCACHE_VALID;
+			return ret;
+		}
+
+		entry->val = val;
+		entry->flags |= REGCACHE_VALID;
+
+		return 0;
+	}
+
+	if ((entry->flags & REGCACHE_DIRTY) && entry->seq != cache->seq) {
+		/* Rewritten after other registers, keep the write order */
+		ret = codec_regcache_sync(cache);
+		if (ret < 0) {
+			return ret;
+		}
+
+		cache->deferred = true;
+	}
+
+	if (!(entry->flags & REGCACHE_DIRTY) || entry->seq != cache->seq) {
+		entry->seq = ++cache->seq;
+	}
+
+	entry->val = val;
+	entry->flags |= REGCACHE_VALID | REGCACHE_DIRTY;
+
+	return 0;
+}
+
+int codec_regcache_update(struct codec_regcache *cache, uint16_t reg, uint16_t mask,
+			  uint16_t val)
+{
+	uint16_t old;
+	int ret;
+
+	ret = codec_regcache_read(cache, reg, &old);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return codec_regcache_write(cache, reg, (old & ~mask) | (val & mask));
+}
+
+void codec_regcache_defer(struct codec_regcache *cache)
+{
+	cache->deferred = true;
+}
+
+void codec_regcache_invalidate(struct codec_regcache *cache)
+{
+	cache->count = 0;
+	cache->seq = 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_AUDIO_CODEC_REGCACHE_H_
+#define ZEPHYR_DRIVERS_AUDIO_CODEC_REGCACHE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/drivers/i2c.h>
+
+/*
+ * Register cache shared by the I2C codec drivers.
+ *
+ * Reads are served from the cache once a register has been read or written,
+ * so read-modify-write cycles and volume changes do not read back from the
+ * codec, and writes of an unchanged value are skipped. Between
+ * codec_regcache_defer() and codec_regcache_sync(), writes only mark the
+ * cached registers dirty; they are then flushed in program order, merging
+ * consecutive registers into bursts when the codec supports address
+ * auto-increment and, with CONFIG_AUDIO_CODEC_REGCACHE_COMBINED, sending all
+ * of them in a single I2C transfer.
+ *
+ * Accesses to volatile registers, and to registers that do not fit in the
+ * cache, always go to the bus after flushing the pending writes, so that they
+ * can be used as ordering points, for instance to start a power sequence.
+ *
+ * The cache is not locked, callers serialize accesses as for the bus itself.
+ */
+
+/** @brief Cached register, storage provided by the driver */
+struct codec_regcache_entry {
+	uint16_t reg;
+	uint16_t val;
+	uint16_t seq;
+	uint8_t flags;
+};
+
+/** @brief Register map description */
+struct codec_regcache_config {
+	/** Register address width in bytes, 1 or 2, sent MSB first */
+	uint8_t reg_bytes;
+	/** Register value width in bytes, 1 or 2, sent MSB first */
+	uint8_t val_bytes;
+	/** Consecutive registers can be written in a single burst */
+	bool burst;
+	/** Optional, returns true for registers that must not be cached */
+	bool (*is_volatile)(uint16_t reg);
+};
+
+struct codec_regcache {
+	const struct i2c_dt_spec *i2c;
+	const struct codec_regcache_config *config;
+	struct codec_regcache_entry *entries;
+	uint16_t size;
+	uint16_t count;
+	uint16_t seq;
+	bool deferred;
+};
+
+/**
+ * @brief Initialize an empty register cache
+ *
+ * @param cache Register cache.
+ * @param i2c Bus of the codec.
+ * @param config Register map description.
+ * @param entries Storage for the cached registers.
+ * @param size Number of elements in @p entries.
+ */
+void codec_regcache_init(struct codec_regcache *cache, const struct i2c_dt_spec *i2c,
+			 const struct codec_regcache_config *config,
+			 struct codec_regcache_entry *entries, uint16_t size);
+
+/**
+ * @brief Read a register, from the cache when possible
+ *
+ * @retval 0 on success.
+ * @retval -errno on bus error.
+ */
+int codec_regcache_read(struct codec_regcache *cache, uint16_t reg, uint16_t *val);
+
+/**
+ * @brief Write a register
+ *
+ * The write is skipped if the cached value is already @p val, and only
+ * recorded in the cache while writes are deferred.
+ *
+ * @retval 0 on success.
+ * @retval -errno on bus error.
+ */
+int codec_regcache_write(struct codec_regcache *cache, uint16_t reg, uint16_t val);
+
+/**
+ * @brief Update the bits of a register selected by @p mask
+ *
+ * @retval 0 on success.
+ * @retval -errno on bus error.
+ */
+int codec_regcache_update(struct codec_regcache *cache, uint16_t reg, uint16_t mask,
+			  uint16_t val);
+
+/**
+ * @brief Defer the register writes until codec_regcache_sync()
+ *
+ * @param cache Register cache.
+ */
+void codec_regcache_defer(struct codec_regcache *cache);
+
+/**
+ * @brief Flush the deferred register writes and stop deferring
+ *
+ * @retval 0 on success.
+ * @retval -errno on bus error, the writes not done are kept pending.
+ */
+int codec_regcache_sync(struct codec_regcache *cache);
+
+/**
+ * @brief Drop the cached values, for instance after a codec reset
+ *
+ * Pending writes are discarded.
+ *
+ * @param cache Register cache.
+ */
+void codec_regcache_invalidate(struct codec_regcache *cache);
+
+#endif /* ZEPHYR_DRIVERS_AUDIO_CODEC_REGCACHE_H_ */
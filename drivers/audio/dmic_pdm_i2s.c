@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Digital microphones whose raw PDM bit streams are captured by an I2S
+ * controller, decimated to PCM in software. The controller delivers one
+ * 8-bit word per microphone and frame, so that a frame holds the next 8 bits
+ * of every microphone, for instance with one data line per microphone pair
+ * on a multi-lane controller. This allows more microphones than the PDM
+ * peripherals of the SoC provide.
+ */
+
+#define DT_DRV_COMPAT zephyr_dmic_pdm_i2s
+
+#include <zephyr/audio/dmic.h>
+#include <zephyr/audio/pdm_decim.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(dmic_pdm_i2s, CONFIG_AUDIO_DMIC_LOG_LEVEL);
+
+struct dmic_pdm_i2s_config {
+	const struct device *i2s;
+	struct k_mem_slab *pdm_slab;
+	uint16_t decimation;
+};
+
+struct dmic_pdm_i2s_data {
+	enum dmic_state state;
+	struct audio_pdm_decim decim;
+	struct k_mem_slab *pcm_slab;
+	size_t pcm_frames;
+};
+
+static int dmic_pdm_i2s_configure(const struct device *dev, struct dmic_cfg *cfg)
+{
+	const struct dmic_pdm_i2s_config *config = dev->config;
+	struct dmic_pdm_i2s_data *data = dev->data;
+	struct pcm_stream_cfg *stream = &cfg->streams[0];
+	struct pdm_chan_cfg *channel = &cfg->channel;
+	struct i2s_config i2s_cfg = {0};
+	uint32_t pdm_clk;
+	size_t pdm_size;
+	int ret;
+
+	if (data->state == DMIC_STATE_ACTIVE) {
+		LOG_ERR("Cannot configure while active");
+		return -EBUSY;
+	}
+
+	if (channel->req_num_streams != 1 || stream->pcm_width != 16) {
+		LOG_ERR("Only one stream of 16-bit samples is supported");
+		return -EINVAL;
+	}
+
+	if (channel->req_num_chan == 0 ||
+	    stream->block_size % (channel->req_num_chan * sizeof(int16_t)) != 0) {
+		LOG_ERR("Block size must hold whole frames");
+		return -EINVAL;
+	}
+
+	pdm_clk = stream->pcm_rate * config->decimation;
+	if (pdm_clk < cfg->io.min_pdm_clk_freq || pdm_clk > cfg->io.max_pdm_clk_freq) {
+		LOG_ERR("PDM clock %u Hz out of range", pdm_clk);
+		return -EINVAL;
+	}
+
+	ret = audio_pdm_decim_init(&data->decim, channel->req_num_chan, config->decimation);
+	if (ret < 0) {
+		LOG_ERR("Unsupported number of channels %u", channel->req_num_chan);
+		return ret;
+	}
+
+	data->pcm_slab = stream->mem_slab;
+	data->pcm_frames = stream->block_size / (channel->req_num_chan * sizeof(int16_t));
+
+	pdm_size = AUDIO_PDM_DECIM_RAW_SIZE(data->pcm_frames, channel->req_num_chan,
+					    config->decimation);
+	if (pdm_size > config->pdm_slab->info.block_size) {
+		LOG_ERR("PDM block of %zu bytes does not fit in %zu", pdm_size,
+			config->pdm_slab->info.block_size);
+		return -EINVAL;
+	}
+
+	i2s_cfg.word_size = 8;
+	i2s_cfg.channels = channel->req_num_chan;
+	i2s_cfg.format = I2S_FMT_DATA_FORMAT_LEFT_JUSTIFIED;
+	i2s_cfg.options = I2S_OPT_FRAME_CLK_MASTER | I2S_OPT_BIT_CLK_MASTER;
+	i2s_cfg.frame_clk_freq = pdm_clk / 8;
+	i2s_cfg.block_size = pdm_size;
+	i2s_cfg.mem_slab = config->pdm_slab;
+	i2s_cfg.timeout = 2000;
+
+	ret = i2s_configure(config->i2s, I2S_DIR_RX, &i2s_cfg);
+	if (ret < 0) {
+		LOG_ERR("I2S device configuration error (%d)", ret);
+		return ret;
+	}
+
+	channel->act_num_chan = channel->req_num_chan;
+	channel->act_num_streams = 1;
+	channel->act_chan_map_lo = channel->req_chan_map_lo;
+	channel->act_chan_map_hi = channel->req_chan_map_hi;
+
+	data->state = DMIC_STATE_CONFIGURED;
+
+	return 0;
+}
+
+static int dmic_pdm_i2s_trigger(const struct device *dev, enum dmic_trigger cmd)
+{
+	const struct dmic_pdm_i2s_config *config = dev->config;
+	struct dmic_pdm_i2s_data *data = dev->data;
+	enum i2s_trigger_cmd i2s_cmd;
+	enum dmic_state state;
+	int ret;
+
+	switch (cmd) {
+	case DMIC_TRIGGER_START:
+	case DMIC_TRIGGER_RELEASE:
+		if (data->state != DMIC_STATE_CONFIGURED && data->state != DMIC_STATE_PAUSED) {
+			return data->state == DMIC_STATE_ACTIVE ? 0 : -EIO;
+		}
+		audio_pdm_decim_reset(&data->decim);
+		i2s_cmd = I2S_TRIGGER_START;
+		state = DMIC_STATE_ACTIVE;
+		break;
+	case DMIC_TRIGGER_STOP:
+	case DMIC_TRIGGER_PAUSE:
+		if (data->state != DMIC_STATE_ACTIVE) {
+			return 0;
+		}
+		i2s_cmd = I2S_TRIGGER_STOP;
+		state = cmd == DMIC_TRIGGER_PAUSE ? DMIC_STATE_PAUSED : DMIC_STATE_CONFIGURED;
+		break;
+	case DMIC_TRIGGER_RESET:
+		i2s_cmd = I2S_TRIGGER_DROP;
+		state = DMIC_STATE_INITIALIZED;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	ret = i2s_trigger(config->i2s, I2S_DIR_RX, i2s_cmd);
+	if (ret < 0 && cmd != DMIC_TRIGGER_RESET) {
+		LOG_ERR("trigger failed with %d error", ret);
+		return ret;
+	}
+
+	data->state = state;
+
+	return 0;
+}
+
+static int dmic_pdm_i2s_read(const struct device *dev, uint8_t stream, void **buffer,
+			     size_t *size, int32_t timeout)
+{
+	const struct dmic_pdm_i2s_config *config = dev->config;
+	struct dmic_pdm_i2s_data *data = dev->data;
+	void *pdm_block;
+	void *pcm_block;
+	size_t pdm_size;
+	int ret;
+
+	ARG_UNUSED(stream);
+
+	if (data->state != DMIC_STATE_ACTIVE) {
+		return -EIO;
+	}
+
+	ret = i2s_read(config->i2s, &pdm_block, &pdm_size);
+	if (ret < 0) {
+		LOG_ERR("read failed (%d)", ret);
+		return ret;
+	}
+
+	ret = k_mem_slab_alloc(data->pcm_slab, &pcm_block, SYS_TIMEOUT_MS(timeout));
+	if (ret < 0) {
+		k_mem_slab_free(config->pdm_slab, pdm_block);
+		return ret;
+	}
+
+	ret = audio_pdm_decim_process(&data->decim, pdm_block, pdm_size, pcm_block,
+				      data->pcm_frames);
+	k_mem_slab_free(config->pdm_slab, pdm_block);
+
+	if (ret < 0) {
+		k_mem_slab_free(data->pcm_slab, pcm_block);
+		return ret;
+	}
+
+	*buffer = pcm_block;
+	*size = ret * data->decim.channels * sizeof(int16_t);
+
+	return 0;
+}
+
+static const struct _dmic_ops dmic_pdm_i2s_api = {
+	.configure = dmic_pdm_i2s_configure,
+	.trigger = dmic_pdm_i2s_trigger,
+	.read = dmic_pdm_i2s_read,
+};
+
+static int dmic_pdm_i2s_init(const struct device *dev)
+{
+	const struct dmic_pdm_i2s_config *config = dev->config;
+	struct dmic_pdm_i2s_data *data = dev->data;
+
+	if (!device_is_ready(config->i2s)) {
+		return -ENODEV;
+	}
+
+	data->state = DMIC_STATE_INITIALIZED;
+
+	return 0;
+}
+
+#define DMIC_PDM_I2S_DEFINE(n)                                                                     \
+	K_MEM_SLAB_DEFINE_STATIC(dmic_pdm_i2s_slab_##n, CONFIG_AUDIO_DMIC_PDM_I2S_BLOCK_SIZE,      \
+				 CONFIG_AUDIO_DMIC_PDM_I2S_BLOCK_COUNT, 4);                        \
+                                                                                                   \
+	static const struct dmic_pdm_i2s_config dmic_pdm_i2s_config_##n = {                        \
+		.i2s = DEVICE_DT_GET(DT_INST_BUS(n)),                                              \
+		.pdm_slab = &dmic_pdm_i2s_slab_##n,                                                \
+		.decimation = DT_INST_PROP(n, decimation),                                         \
+	};                                                                                         \
+                                                                                                   \
+	static struct dmic_pdm_i2s_data dmic_pdm_i2s_data_##n;                                     \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(n, dmic_pdm_i2s_init, NULL, &dmic_pdm_i2s_data_##n,                  \
+			      &dmic_pdm_i2s_config_##n, POST_KERNEL,                               \
+			      CONFIG_AUDIO_DMIC_INIT_PRIORITY, &dmic_pdm_i2s_api);
+
+DT_INST_FOREACH_STATUS_OKAY(DMIC_PDM_I2S_DEFINE)
@@ -11,6 +11,7 @@
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
 #include "max98091.h"
+#include "codec_regcache.h"
 
 LOG_MODULE_REGISTER(maxim_max98091);
 
@@ -21,30 +22,65 @@ struct max98091_config {
 	uint32_t mclk_freq;
 };
 
+#define MAX98091_REGCACHE_SIZE 32
+
+struct max98091_data {
+	struct codec_regcache cache;
+	struct codec_regcache_entry entries[MAX98091_REGCACHE_SIZE];
+};
+
+static bool max98091_is_volatile(uint16_t reg)
+{
+	switch (reg) {
+	case M98091_REG_SOFTWARE_RESET:
+	case M98091_REG_DEVICE_STATUS:
+	case M98091_REG_JACK_STATUS:
+	case M98091_REG_INTERRUPT_S:
+	case M98091_REG_DEVICE_SHUTDOWN:
+	case M98091_REG_REVISION_ID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static const struct codec_regcache_config max98091_regcache_config = {
+	.reg_bytes = 1,
+	.val_bytes = 1,
+	.burst = true,
+	.is_volatile = max98091_is_volatile,
+};
+
 static void max98091_write_reg(const struct device *dev, uint8_t reg, uint8_t val)
 {
-	const struct max98091_config *const dev_cfg = dev->config;
+	struct max98091_data *data = dev->data;
 
-	i2c_reg_write_byte_dt(&dev_cfg->i2c, reg, val);
+	codec_regcache_write(&data->cache, reg, val);
 }
 
 static void max98091_read_reg(const struct device *dev, uint8_t reg, uint8_t *val)
 {
-	const struct max98091_config *const dev_cfg = dev->config;
+	struct max98091_data *data = dev->data;
+	uint16_t value;
 
-	i2c_reg_read_byte_dt(&dev_cfg->i2c, reg, val);
+	if (codec_regcache_read(&data->cache, reg, &value) == 0) {
+		*val = value;
+	}
 }
 
 static void max98091_update_reg(const struct device *dev, uint8_t reg, uint8_t mask, uint8_t val)
 {
-	const struct max98091_config *const dev_cfg = dev->config;
+	struct max98091_data *data = dev->data;
 
-	i2c_reg_update_byte_dt(&dev_cfg->i2c, reg, mask, val);
+	codec_regcache_update(&data->cache, reg, mask, val);
 }
 
 static void max98091_soft_reset(const struct device *dev)
 {
+	struct max98091_data *data = dev->data;
+
 	max98091_write_reg(dev, M98091_REG_SOFTWARE_RESET, 0x01);
+	codec_regcache_invalidate(&data->cache);
 	k_msleep(20);
 }
 
@@ -175,12 +211,21 @@ static int max98091_set_volume_or_mute(const struct device *dev, audio_channel_t
 		max98091_update_reg(dev, M98091_REG_RIGHT_HP_VOLUME, hp_mask, value);
 		return 0;
 
-	case AUDIO_CHANNEL_ALL:
+	case AUDIO_CHANNEL_ALL: {
+		struct max98091_data *data = dev->data;
+		bool deferred = data->cache.deferred;
+
+		/* Change all the channels in a single transfer */
+		codec_regcache_defer(&data->cache);
 		max98091_update_reg(dev, M98091_REG_LEFT_SPK_VOLUME, spk_mask, value);
 		max98091_update_reg(dev, M98091_REG_RIGHT_SPK_VOLUME, spk_mask, value);
 		max98091_update_reg(dev, M98091_REG_LEFT_HP_VOLUME, hp_mask, value);
 		max98091_update_reg(dev, M98091_REG_RIGHT_HP_VOLUME, hp_mask, value);
+		if (!deferred) {
+			return codec_regcache_sync(&data->cache);
+		}
 		return 0;
+	}
 
 	default:
 		return -EINVAL;
@@ -243,6 +288,8 @@ static int max98091_set_property(const struct device *dev, audio_property_t prop
 static int max98091_configure(const struct device *dev, struct audio_codec_cfg *cfg)
 {
 	const struct max98091_config *const dev_cfg = dev->config;
+	struct max98091_data *data = dev->data;
+	int ret;
 
 	if (cfg->dai_type >= AUDIO_DAI_TYPE_INVALID) {
 		LOG_ERR("dai_type not supported");
@@ -258,6 +305,9 @@ static int max98091_configure(const struct device *dev, struct audio_codec_cfg *
 	/* Put the audio codec into shutdown mode */
 	max98091_write_reg(dev, M98091_REG_DEVICE_SHUTDOWN, 0x00);
 
+	/* Program the configuration in as few transfers as possible */
+	codec_regcache_defer(&data->cache);
+
 	max98091_write_reg(dev, M98091_REG_DAC_CONTROL, 0x00);
 
 	max98091_write_reg(dev, M98091_REG_TDM_CONTROL, 0x00);
@@ -283,6 +333,12 @@ static int max98091_configure(const struct device *dev, struct audio_codec_cfg *
 		break;
 	}
 
+	ret = codec_regcache_sync(&data->cache);
+	if (ret < 0) {
+		LOG_ERR("Failed to configure codec: %d", ret);
+		return ret;
+	}
+
 	/* Bring the audio codec out of shutdown mode */
 	max98091_write_reg(dev, M98091_REG_DEVICE_SHUTDOWN, M98091_SHDNN_MASK);
 
@@ -299,13 +355,17 @@ static const struct audio_codec_api max98091_api = {
 static int max98091_init(const struct device *dev)
 {
 	const struct max98091_config *cfg_tan = dev->config;
-	uint8_t device_id;
+	struct max98091_data *data = dev->data;
+	uint8_t device_id = 0;
 
 	if (!i2c_is_ready_dt(&cfg_tan->i2c)) {
 		LOG_ERR("I2C bus not ready");
 		return -ENODEV;
 	}
 
+	codec_regcache_init(&data->cache, &cfg_tan->i2c, &max98091_regcache_config,
+			    data->entries, ARRAY_SIZE(data->entries));
+
 	max98091_read_reg(dev, M98091_REG_REVISION_ID, &device_id);
 	if (device_id >= M98091_REVA && (device_id <= M98091_REVA + 0x0f)) {
 		LOG_INF("MAX98091 Device ID: 0x%02X", device_id);
@@ -320,7 +380,9 @@ static int max98091_init(const struct device *dev)
 	static const struct max98091_config max98091_config_##inst = {			\
 		.i2c = I2C_DT_SPEC_INST_GET(inst),					\
 		.mclk_freq = DT_INST_PROP(inst, mclk_frequency)};			\
-	DEVICE_DT_INST_DEFINE(inst, max98091_init, NULL, NULL, &max98091_config_##inst, \
+	static struct max98091_data max98091_data_##inst;				\
+	DEVICE_DT_INST_DEFINE(inst, max98091_init, NULL, &max98091_data_##inst,	\
+			      &max98091_config_##inst,					\
 			      POST_KERNEL, CONFIG_AUDIO_CODEC_INIT_PRIORITY, &max98091_api);
 
 DT_INST_FOREACH_STATUS_OKAY(MAX98091_INIT)
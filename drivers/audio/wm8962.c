@@ -16,6 +16,7 @@
 LOG_MODULE_REGISTER(wolfson_wm8962, CONFIG_AUDIO_CODEC_LOG_LEVEL);
 
 #include "wm8962.h"
+#include "codec_regcache.h"
 
 #define DT_DRV_COMPAT wolfson_wm8962
 
@@ -28,6 +29,35 @@ struct wm8962_driver_config {
 
 #define DEV_CFG(dev) ((const struct wm8962_driver_config *const)dev->config)
 
+#define WM8962_REGCACHE_SIZE 48
+
+struct wm8962_driver_data {
+	struct codec_regcache cache;
+	struct codec_regcache_entry entries[WM8962_REGCACHE_SIZE];
+};
+
+#define DEV_DATA(dev) ((struct wm8962_driver_data *)dev->data)
+
+static bool wm8962_is_volatile(uint16_t reg)
+{
+	switch (reg) {
+	case WM8962_REG_RESET:
+	case WM8962_REG_WRITE_SEQ_CTRL_1:
+	case WM8962_REG_WRITE_SEQ_CTRL_2:
+	case WM8962_REG_WRITE_SEQ_CTRL_3:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static const struct codec_regcache_config wm8962_regcache_config = {
+	.reg_bytes = 2,
+	.val_bytes = 2,
+	.burst = false,
+	.is_volatile = wm8962_is_volatile,
+};
+
 static void wm8962_write_reg(const struct device *dev, uint16_t reg, uint16_t val);
 static void wm8962_read_reg(const struct device *dev, uint16_t reg, uint16_t *val);
 static void wm8962_update_reg(const struct device *dev, uint16_t reg, uint16_t mask, uint16_t val);
@@ -79,6 +109,9 @@ static int wm8962_start_sequence(const struct device *dev, wm8962_sequence_id_t
 		delayUs -= 1000U;
 	}
 
+	/* The sequencer updates the power and volume registers */
+	codec_regcache_invalidate(&DEV_DATA(dev)->cache);
+
 	return (sequenceStat & 1U) == 0U ? 0 : -EBUSY;
 }
 
@@ -499,6 +532,12 @@ static int wm8962_configure(const struct device *dev, struct audio_codec_cfg *cf
 		return 0;
 	}
 
+	/*
+	 * Program the configuration in as few transfers as possible, the
+	 * power sequences flush the pending writes before being started.
+	 */
+	codec_regcache_defer(&DEV_DATA(dev)->cache);
+
 	/* disable internal osc/FLL2/FLL3/FLL*/
 	wm8962_write_reg(dev, WM8962_REG_PLL2, 0);
 	wm8962_update_reg(dev, WM8962_REG_FLL_CTRL_1, 1U, 0U);
@@ -566,7 +605,7 @@ static int wm8962_configure(const struct device *dev, struct audio_codec_cfg *cf
 		break;
 	}
 
-	return 0;
+	return codec_regcache_sync(&DEV_DATA(dev)->cache);
 }
 
 static void wm8962_start_output(const struct device *dev)
@@ -617,18 +656,9 @@ static int wm8962_apply_properties(const struct device *dev)
 
 static void wm8962_write_reg(const struct device *dev, uint16_t reg, uint16_t val)
 {
-	const struct wm8962_driver_config *const dev_cfg = DEV_CFG(dev);
-	uint8_t data[4];
 	int ret;
 
-	/* data is reversed */
-	data[0] = (reg >> 8) & 0xff;
-	data[1] = reg & 0xff;
-	data[2] = (val >> 8) & 0xff;
-	data[3] = val & 0xff;
-
-	ret = i2c_write(dev_cfg->i2c.bus, data, 4, dev_cfg->i2c.addr);
-
+	ret = codec_regcache_write(&DEV_DATA(dev)->cache, reg, val);
 	if (ret != 0) {
 		LOG_ERR("i2c write to codec error %d", ret);
 	}
@@ -638,37 +668,26 @@ static void wm8962_write_reg(const struct device *dev, uint16_t reg, uint16_t va
 
 static void wm8962_read_reg(const struct device *dev, uint16_t reg, uint16_t *val)
 {
-	const struct wm8962_driver_config *const dev_cfg = DEV_CFG(dev);
-	uint16_t value;
-	int ret;
-
-	reg = WM8962_SWAP_UINT16_BYTE_SEQUENCE(reg);
-
-	ret = i2c_write_read(dev_cfg->i2c.bus, dev_cfg->i2c.addr, &reg, sizeof(reg), &value,
-			     sizeof(value));
-	if (ret == 0) {
-		*val = (value >> 8) & 0xff;
-		*val += ((value & 0xff) << 8);
-		/* update cache*/
-		LOG_DBG("REG:%#02x VAL:%#02x", WM8962_SWAP_UINT16_BYTE_SEQUENCE(reg), *val);
+	if (codec_regcache_read(&DEV_DATA(dev)->cache, reg, val) == 0) {
+		LOG_DBG("REG:%#02x VAL:%#02x", reg, *val);
 	}
 }
 
 static void wm8962_update_reg(const struct device *dev, uint16_t reg, uint16_t mask, uint16_t val)
 {
-	uint16_t reg_val = 0;
-	uint16_t new_value = 0;
-
-	wm8962_read_reg(dev, reg, &reg_val);
-	LOG_DBG("read %#x = %x", reg, reg_val);
-	new_value = (reg_val & ~mask) | (val & mask);
-	LOG_DBG("write %#x = %x", reg, new_value);
-	wm8962_write_reg(dev, reg, new_value);
+	int ret;
+
+	/* Read-modify-write on the cached value, no readback from the codec */
+	ret = codec_regcache_update(&DEV_DATA(dev)->cache, reg, mask, val);
+	if (ret != 0) {
+		LOG_ERR("i2c update of codec register error %d", ret);
+	}
 }
 
 static void wm8962_soft_reset(const struct device *dev)
 {
 	wm8962_write_reg(dev, WM8962_REG_RESET, 0x6243U);
+	codec_regcache_invalidate(&DEV_DATA(dev)->cache);
 }
 
 static void wm8962_configure_output(const struct device *dev)
@@ -715,14 +734,32 @@ static const struct audio_codec_api wm8962_driver_api = {.configure = wm8962_con
 							 .route_input = wm8962_route_input,
 							 .route_output = wm8962_route_output};
 
+static int wm8962_init(const struct device *dev)
+{
+	const struct wm8962_driver_config *const dev_cfg = DEV_CFG(dev);
+	struct wm8962_driver_data *data = DEV_DATA(dev);
+
+	if (!i2c_is_ready_dt(&dev_cfg->i2c)) {
+		LOG_ERR("I2C bus not ready");
+		return -ENODEV;
+	}
+
+	codec_regcache_init(&data->cache, &dev_cfg->i2c, &wm8962_regcache_config,
+			    data->entries, ARRAY_SIZE(data->entries));
+
+	return 0;
+}
+
 #define wm8962_INIT(n)                                                                             \
 	static const struct wm8962_driver_config wm8962_device_config_##n = {                      \
 		.i2c = I2C_DT_SPEC_INST_GET(n),                                                    \
 		.clock_source = DT_INST_PROP_OR(n, clk_source, 0),                                 \
 		.mclk_dev = DEVICE_DT_GET(DT_INST_CLOCKS_CTLR_BY_NAME(n, mclk)),                   \
 		.mclk_name = (clock_control_subsys_t)DT_INST_CLOCKS_CELL_BY_NAME(n, mclk, name)};  \
+	static struct wm8962_driver_data wm8962_device_data_##n;                                   \
                                                                                                    \
-	DEVICE_DT_INST_DEFINE(n, NULL, NULL, NULL, &wm8962_device_config_##n, POST_KERNEL,         \
+	DEVICE_DT_INST_DEFINE(n, wm8962_init, NULL, &wm8962_device_data_##n,                       \
+			      &wm8962_device_config_##n, POST_KERNEL,                              \
 			      CONFIG_AUDIO_CODEC_INIT_PRIORITY, &wm8962_driver_api);
 
 DT_INST_FOREACH_STATUS_OKAY(wm8962_INIT)
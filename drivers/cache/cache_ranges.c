@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/cache.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Extend the ranges to whole lines, sort them, and merge the ones that
+ * overlap or touch, so that each line is operated on once. The lists are
+ * short, an insertion sort is enough. Returns the number of merged ranges.
+ */
+static size_t ranges_merge(struct sys_cache_range *ranges, size_t count, size_t *total)
+{
+	size_t line = MAX(sys_cache_data_line_size_get(), 1);
+	size_t merged = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		uintptr_t start = ROUND_DOWN((uintptr_t)ranges[i].addr, line);
+		uintptr_t end = ROUND_UP((uintptr_t)ranges[i].addr + ranges[i].size, line);
+		size_t j = merged;
+
+		if (ranges[i].size == 0) {
+			continue;
+		}
+
+		for (; j > 0 && (uintptr_t)ranges[j - 1].addr > start; j--) {
+			ranges[j] = ranges[j - 1];
+		}
+		ranges[j].addr = (void *)start;
+		ranges[j].size = end - start;
+		merged++;
+	}
+
+	*total = 0;
+	if (merged == 0) {
+		return 0;
+	}
+
+	count = merged;
+	merged = 0;
+	for (size_t i = 1; i < count; i++) {
+		struct sys_cache_range *last = &ranges[merged];
+		uintptr_t last_end = (uintptr_t)last->addr + last->size;
+		uintptr_t end = (uintptr_t)ranges[i].addr + ranges[i].size;
+
+		if ((uintptr_t)ranges[i].addr <= last_end) {
+			last->size = MAX(last_end, end) - (uintptr_t)last->addr;
+		} else {
+			*total += last->size;
+			ranges[++merged] = ranges[i];
+		}
+	}
+	*total += ranges[merged].size;
+
+	return merged + 1;
+}
+
+#if !defined(CONFIG_ARCH_CACHE) || !defined(CONFIG_ARCH_HAS_DCACHE_RANGES)
+static int ranges_each(struct sys_cache_range *ranges, size_t count, int op)
+{
+	for (size_t i = 0; i < count; i++) {
+		int ret;
+
+		if (op == Z_CACHE_RANGES_FLUSH) {
+			ret = z_impl_sys_cache_data_flush_range(ranges[i].addr, ranges[i].size);
+		} else if (op == Z_CACHE_RANGES_INVD) {
+			ret = z_impl_sys_cache_data_invd_range(ranges[i].addr, ranges[i].size);
+		} else {
+			ret = z_impl_sys_cache_data_flush_and_invd_range(ranges[i].addr,
+									 ranges[i].size);
+		}
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif
+
+int z_cache_data_ranges(struct sys_cache_range *ranges, size_t count, int op)
+{
+	size_t total;
+
+	count = ranges_merge(ranges, count, &total);
+	if (count == 0) {
+		return 0;
+	}
+
+	if (CONFIG_DCACHE_RANGES_ALL_THRESHOLD > 0 &&
+	    total >= CONFIG_DCACHE_RANGES_ALL_THRESHOLD) {
+		/* Never invalidate the whole d-cache, the dirty lines outside of the ranges
+		 * would be lost.
+		 */
+		return op == Z_CACHE_RANGES_FLUSH ? sys_cache_data_flush_all()
+						  : sys_cache_data_flush_and_invd_all();
+	}
+
+#if defined(CONFIG_ARCH_CACHE) && defined(CONFIG_ARCH_HAS_DCACHE_RANGES)
+	if (op == Z_CACHE_RANGES_FLUSH) {
+		return arch_dcache_flush_ranges(ranges, count);
+	} else if (op == Z_CACHE_RANGES_INVD) {
+		return arch_dcache_invd_ranges(ranges, count);
+	}
+
+	return arch_dcache_flush_and_invd_ranges(ranges, count);
+#else
+	return ranges_each(ranges, count, op);
+#endif
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/rx_dispatch.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(can_rx_dispatch, CONFIG_CAN_LOG_LEVEL);
+
+static bool dispatch_overlap(const struct can_filter *a, const struct can_filter *b)
+{
+	return ((a->id ^ b->id) & a->mask & b->mask) == 0U;
+}
+
+static uint32_t dispatch_merged_mask(const struct can_filter *a, const struct can_filter *b)
+{
+	return a->mask & b->mask & ~(a->id ^ b->id);
+}
+
+/*
+ * Pick the next pair of groups to merge: any overlapping pair, otherwise the
+ * pair losing the fewest mask bits. Returns true if the pair overlaps.
+ */
+static bool dispatch_pick_merge(const struct can_filter *groups, size_t n, size_t *a, size_t *b)
+{
+	uint32_t best = UINT32_MAX;
+
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = i + 1; j < n; j++) {
+			uint32_t mask;
+			uint32_t cost;
+
+			if (dispatch_overlap(&groups[i], &groups[j])) {
+				*a = i;
+				*b = j;
+				return true;
+			}
+
+			mask = dispatch_merged_mask(&groups[i], &groups[j]);
+			cost = POPCOUNT(groups[i].mask) + POPCOUNT(groups[j].mask) -
+			       2U * POPCOUNT(mask);
+			if (cost < best) {
+				best = cost;
+				*a = i;
+				*b = j;
+			}
+		}
+	}
+
+	return false;
+}
+
+static void dispatch_reassign(int16_t *assign, int16_t from, int16_t to)
+{
+	for (size_t i = 0; i < CONFIG_CAN_RX_DISPATCH_MAX_FILTERS; i++) {
+		if (assign[i] == from) {
+			assign[i] = to;
+		}
+	}
+}
+
+/*
+ * Merge the application filters with the given CAN ID type into disjoint
+ * groups, stored at groups[0]. The groups are numbered from base in assign.
+ * Returns the number of groups, more than limit if they cannot fit.
+ */
+static size_t dispatch_compile(const struct can_rx_dispatch *dispatch, uint8_t ide,
+			       size_t limit, struct can_filter *groups, int16_t *assign,
+			       size_t base)
+{
+	size_t n = 0;
+	size_t a = 0;
+	size_t b = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(dispatch->filters); i++) {
+		const struct can_rx_dispatch_filter *filter = &dispatch->filters[i];
+
+		if (!filter->in_use || (filter->filter.flags & CAN_FILTER_IDE) != ide) {
+			continue;
+		}
+
+		groups[n] = filter->filter;
+		groups[n].id &= groups[n].mask;
+		assign[i] = base + n;
+		n++;
+	}
+
+	while (n > 1) {
+		bool overlap = dispatch_pick_merge(groups, n, &a, &b);
+
+		if (!overlap && n <= limit) {
+			break;
+		}
+
+		groups[a].mask = dispatch_merged_mask(&groups[a], &groups[b]);
+		groups[a].id &= groups[a].mask;
+		dispatch_reassign(assign, base + b, base + a);
+
+		n--;
+		if (b != n) {
+			groups[b] = groups[n];
+			dispatch_reassign(assign, base + n, base + b);
+		}
+	}
+
+	return n;
+}
+
+static void dispatch_rx(const struct device *dev, struct can_frame *frame, void *user_data)
+{
+	struct can_rx_dispatch_group *group = user_data;
+	struct can_rx_dispatch *dispatch = group->dispatch;
+	int16_t index = group - dispatch->groups;
+	k_spinlock_key_t key = k_spin_lock(&dispatch->lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(dispatch->filters); i++) {
+		struct can_rx_dispatch_filter *filter = &dispatch->filters[i];
+
+		if (filter->in_use && filter->group == index &&
+		    can_frame_matches_filter(frame, &filter->filter)) {
+			filter->callback(dev, frame, filter->user_data);
+		}
+	}
+
+	k_spin_unlock(&dispatch->lock, key);
+}
+
+static void dispatch_release(struct can_rx_dispatch *dispatch)
+{
+	k_spinlock_key_t key;
+
+	for (size_t i = 0; i < dispatch->num_groups; i++) {
+		if (dispatch->groups[i].filter_id >= 0) {
+			can_remove_rx_filter(dispatch->dev, dispatch->groups[i].filter_id);
+		}
+	}
+
+	key = k_spin_lock(&dispatch->lock);
+	dispatch->num_groups = 0U;
+	for (size_t i = 0; i < ARRAY_SIZE(dispatch->filters); i++) {
+		dispatch->filters[i].group = -1;
+	}
+	k_spin_unlock(&dispatch->lock, key);
+}
+
+static int dispatch_install(struct can_rx_dispatch *dispatch, const struct can_filter *groups,
+			    size_t n, const int16_t *assign, uint8_t *failed_ide)
+{
+	k_spinlock_key_t key = k_spin_lock(&dispatch->lock);
+	int ret;
+
+	for (size_t i = 0; i < n; i++) {
+		dispatch->groups[i].dispatch = dispatch;
+		dispatch->groups[i].filter = groups[i];
+		dispatch->groups[i].filter_id = -1;
+	}
+	dispatch->num_groups = n;
+
+	for (size_t i = 0; i < ARRAY_SIZE(dispatch->filters); i++) {
+		dispatch->filters[i].group = assign[i];
+	}
+	k_spin_unlock(&dispatch->lock, key);
+
+	for (size_t i = 0; i < n; i++) {
+		ret = can_add_rx_filter(dispatch->dev, dispatch_rx, &dispatch->groups[i],
+					&groups[i]);
+		if (ret < 0) {
+			*failed_ide = groups[i].flags & CAN_FILTER_IDE;
+			dispatch_release(dispatch);
+			return ret;
+		}
+
+		dispatch->groups[i].filter_id = ret;
+	}
+
+	return 0;
+}
+
+void can_rx_dispatch_init(struct can_rx_dispatch *dispatch, const struct device *dev)
+{
+	memset(dispatch, 0, sizeof(*dispatch));
+	dispatch->dev = dev;
+}
+
+int can_rx_dispatch_add(struct can_rx_dispatch *dispatch, can_rx_callback_t callback,
+			void *user_data, const struct can_filter *filter)
+{
+	k_spinlock_key_t key;
+	uint32_t id_mask;
+
+	CHECKIF(callback == NULL || filter == NULL) {
+		return -EINVAL;
+	}
+
+	if ((filter->flags & CAN_FILTER_IDE) != 0U) {
+		id_mask = CAN_EXT_ID_MASK;
+	} else {
+		id_mask = CAN_STD_ID_MASK;
+	}
+
+	CHECKIF(((filter->id & ~(id_mask)) != 0U) || ((filter->mask & ~(id_mask)) != 0U)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&dispatch->lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(dispatch->filters); i++) {
+		struct can_rx_dispatch_filter *entry = &dispatch->filters[i];
+
+		if (entry->in_use) {
+			continue;
+		}
+
+		entry->filter = *filter;
+		entry->callback = callback;
+		entry->user_data = user_data;
+		entry->group = -1;
+		entry->in_use = true;
+
+		k_spin_unlock(&dispatch->lock, key);
+
+		return i;
+	}
+
+	k_spin_unlock(&dispatch->lock, key);
+
+	return -ENOSPC;
+}
+
+void can_rx_dispatch_remove(struct can_rx_dispatch *dispatch, int filter_id)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF(filter_id < 0 || filter_id >= ARRAY_SIZE(dispatch->filters)) {
+		return;
+	}
+
+	key = k_spin_lock(&dispatch->lock);
+	dispatch->filters[filter_id].in_use = false;
+	k_spin_unlock(&dispatch->lock, key);
+}
+
+int can_rx_dispatch_apply(struct can_rx_dispatch *dispatch)
+{
+	struct can_filter groups[CONFIG_CAN_RX_DISPATCH_MAX_FILTERS];
+	int16_t assign[CONFIG_CAN_RX_DISPATCH_MAX_FILTERS];
+	size_t limit[2];
+	size_t count[2];
+	uint8_t failed_ide;
+	int ret;
+
+	for (int i = 0; i < ARRAY_SIZE(limit); i++) {
+		ret = can_get_max_filters(dispatch->dev, i != 0);
+		if (ret < 0) {
+			return ret;
+		}
+
+		limit[i] = MIN(ret, CONFIG_CAN_RX_DISPATCH_MAX_GROUPS);
+	}
+
+	dispatch_release(dispatch);
+
+	while (true) {
+		for (size_t i = 0; i < ARRAY_SIZE(assign); i++) {
+			assign[i] = -1;
+		}
+
+		count[0] = dispatch_compile(dispatch, 0U, limit[0], groups, assign, 0U);
+		count[1] = dispatch_compile(dispatch, CAN_FILTER_IDE, limit[1], &groups[count[0]],
+					    assign, count[0]);
+		if (count[0] > limit[0] || count[1] > limit[1]) {
+			LOG_ERR("Not enough CAN controller filters");
+			return -ENOSPC;
+		}
+
+		if (count[0] + count[1] > CONFIG_CAN_RX_DISPATCH_MAX_GROUPS) {
+			if (count[0] > count[1]) {
+				limit[0] = count[0] - 1U;
+			} else {
+				limit[1] = count[1] - 1U;
+			}
+			continue;
+		}
+
+		ret = dispatch_install(dispatch, groups, count[0] + count[1], assign, &failed_ide);
+		if (ret == -ENOSPC) {
+			/* Filters shared with other users of the controller */
+			if (failed_ide != 0U) {
+				limit[1] = count[1] - 1U;
+			} else {
+				limit[0] = count[0] - 1U;
+			}
+			continue;
+		}
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		LOG_DBG("%zu standard and %zu extended CAN controller filters", count[0],
+			count[1]);
+
+		return count[0] + count[1];
+	}
+}
+
+void can_rx_batch_init(struct can_rx_batch *batch, struct can_frame *frames, size_t size,
+		       size_t watermark)
+{
+	memset(batch, 0, sizeof(*batch));
+	batch->frames = frames;
+	batch->size = size;
+	batch->watermark = CLAMP(watermark, 1U, size);
+	k_sem_init(&batch->sem, 0, 1);
+}
+
+void can_rx_batch_put(const struct device *dev, struct can_frame *frame, void *user_data)
+{
+	struct can_rx_batch *batch = user_data;
+	k_spinlock_key_t key;
+	bool wake;
+
+	ARG_UNUSED(dev);
+
+	key = k_spin_lock(&batch->lock);
+
+	if (batch->count == batch->size) {
+		batch->overruns++;
+		k_spin_unlock(&batch->lock, key);
+		return;
+	}
+
+	batch->frames[(batch->head + batch->count) % batch->size] = *frame;
+	batch->count++;
+	wake = batch->count == batch->watermark;
+
+	k_spin_unlock(&batch->lock, key);
+
+	if (wake) {
+		k_sem_give(&batch->sem);
+	}
+}
+
+int can_rx_batch_get(struct can_rx_batch *batch, struct can_frame *frames, size_t max,
+		     k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	size_t n;
+
+	key = k_spin_lock(&batch->lock);
+	n = batch->count;
+	k_spin_unlock(&batch->lock, key);
+
+	/* Also consumes a wake-up left by frames already read */
+	(void)k_sem_take(&batch->sem, n < batch->watermark ? timeout : K_NO_WAIT);
+
+	key = k_spin_lock(&batch->lock);
+
+	n = MIN(max, batch->count);
+	for (size_t i = 0; i < n; i++) {
+		frames[i] = batch->frames[batch->head];
+		batch->head = (batch->head + 1U) % batch->size;
+	}
+	batch->count -= n;
+
+	k_spin_unlock(&batch->lock, key);
+
+	return n > 0U ? n : -EAGAIN;
+}
@@ -602,10 +602,10 @@ static int sai_trigger_stop(const struct device *dev,
 
 	LOG_DBG("stop on direction %d", dir);
 
-	if (old_state == DAI_STATE_PAUSED) {
-		/* if SAI was previously paused then all that's
-		 * left to do is disable the DMA requests and
-		 * the data line.
+	if (old_state == DAI_STATE_PAUSED || old_state == DAI_STATE_PRE_RUNNING) {
+		/* if SAI was previously paused, or only prepared
+		 * by PRE_START, then all that's left to do is
+		 * disable the DMA requests and the data line.
 		 */
 		goto out_dmareq_disable;
 	}
@@ -695,13 +695,90 @@ static void sai_tx_rx_sw_reset(struct sai_data *data,
 	}
 }
 
+/* everything needed to start the given direction except for
+ * enabling the transmitter/receiver.
+ */
+static int sai_tx_rx_prepare(const struct device *dev, enum dai_dir dir)
+{
+	struct sai_data *data;
+	const struct sai_config *cfg;
+	int ret, i;
+
+	data = dev->data;
+	cfg = dev->config;
+
+	ret = pm_device_runtime_get(dev);
+	if (ret < 0) {
+		LOG_ERR("failed to get() SAI device: %d", ret);
+		return ret;
+	}
+
+	sai_tx_rx_sw_reset(data, cfg, dir);
+
+	irq_enable(cfg->irq);
+
+	/* enable error interrupt */
+	SAI_TX_RX_ENABLE_DISABLE_IRQ(dir, data->regmap,
+				     kSAI_FIFOErrorInterruptEnable, true);
+
+	/* avoid initial underrun by writing a frame's worth of 0s */
+	if (dir == DAI_DIR_TX) {
+		for (i = 0; i < data->cfg.channels; i++) {
+			SAI_WriteData(UINT_TO_I2S(data->regmap), cfg->tx_dline, 0x0);
+		}
+	}
+
+	/* TODO: for now, only DMA mode is supported */
+	SAI_TX_RX_DMA_ENABLE_DISABLE(dir, data->regmap, true);
+
+	return 0;
+}
+
+/* PRE_START prepares the given direction, with the DMA requests
+ * enabled, such that a subsequent START only has to enable the
+ * transmitter/receiver. This allows several SAIs to be prepared
+ * and then started back to back, with interrupts locked, so that
+ * they are aligned. Instances clocked by another one should be
+ * started before their clock provider.
+ */
+static int sai_trigger_pre_start(const struct device *dev,
+				 enum dai_dir dir)
+{
+	struct sai_data *data;
+	int ret;
+
+	data = dev->data;
+
+	if (dir != DAI_DIR_RX && dir != DAI_DIR_TX) {
+		LOG_ERR("invalid direction: %d", dir);
+		return -EINVAL;
+	}
+
+	if (sai_get_state(dir, data) == DAI_STATE_PAUSED) {
+		/* resuming from PAUSED only requires a START */
+		return 0;
+	}
+
+	/* attempt to change state */
+	ret = sai_update_state(dir, data, DAI_STATE_PRE_RUNNING);
+	if (ret < 0) {
+		LOG_ERR("failed to transition to PRE_RUNNING from %d. Reason: %d",
+			sai_get_state(dir, data), ret);
+		return ret;
+	}
+
+	LOG_DBG("pre-start on direction %d", dir);
+
+	return sai_tx_rx_prepare(dev, dir);
+}
+
 static int sai_trigger_start(const struct device *dev,
 			     enum dai_dir dir)
 {
 	struct sai_data *data;
 	const struct sai_config *cfg;
 	uint32_t old_state;
-	int ret, i;
+	int ret;
 
 	data = dev->data;
 	cfg = dev->config;
@@ -721,41 +798,22 @@ static int sai_trigger_start(const struct device *dev,
 		return ret;
 	}
 
-	if (old_state == DAI_STATE_PAUSED) {
-		/* if the SAI has been paused then there's no
-		 * point in issuing a software reset. As such,
-		 * skip this part and go directly to the TX/RX
-		 * enablement.
+	if (old_state == DAI_STATE_PAUSED || old_state == DAI_STATE_PRE_RUNNING) {
+		/* if the SAI has been paused, or already prepared
+		 * by PRE_START, then there's no point in issuing a
+		 * software reset. As such, skip this part and go
+		 * directly to the TX/RX enablement.
 		 */
 		goto out_enable_dline;
 	}
 
 	LOG_DBG("start on direction %d", dir);
 
-	ret = pm_device_runtime_get(dev);
+	ret = sai_tx_rx_prepare(dev, dir);
 	if (ret < 0) {
-		LOG_ERR("failed to get() SAI device: %d", ret);
 		return ret;
 	}
 
-	sai_tx_rx_sw_reset(data, cfg, dir);
-
-	irq_enable(cfg->irq);
-
-	/* enable error interrupt */
-	SAI_TX_RX_ENABLE_DISABLE_IRQ(dir, data->regmap,
-				     kSAI_FIFOErrorInterruptEnable, true);
-
-	/* avoid initial underrun by writing a frame's worth of 0s */
-	if (dir == DAI_DIR_TX) {
-		for (i = 0; i < data->cfg.channels; i++) {
-			SAI_WriteData(UINT_TO_I2S(data->regmap), cfg->tx_dline, 0x0);
-		}
-	}
-
-	/* TODO: for now, only DMA mode is supported */
-	SAI_TX_RX_DMA_ENABLE_DISABLE(dir, data->regmap, true);
-
 out_enable_dline:
 	/* enable TX/RX data line. This translates to TX_DLINE0/RX_DLINE0
 	 * being enabled.
@@ -786,10 +844,11 @@ static int sai_trigger(const struct device *dev,
 	case DAI_TRIGGER_STOP:
 		return sai_trigger_stop(dev, dir);
 	case DAI_TRIGGER_PRE_START:
+		return sai_trigger_pre_start(dev, dir);
 	case DAI_TRIGGER_COPY:
-		/* COPY and PRE_START don't require the SAI
+		/* COPY doesn't require the SAI
 		 * driver to do anything at the moment so
-		 * mark them as successful via a NULL return
+		 * mark it as successful via a NULL return
 		 *
 		 * note: although the rest of the unhandled
 		 * trigger commands may be valid, return
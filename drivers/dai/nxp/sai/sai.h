@@ -455,8 +455,15 @@ static int sai_update_state(enum dai_dir dir,
 			return -EPERM;
 		}
 		break;
+	case DAI_STATE_PRE_RUNNING:
+		if (old_state != DAI_STATE_STOPPING &&
+		    old_state != DAI_STATE_READY) {
+			return -EPERM;
+		}
+		break;
 	case DAI_STATE_RUNNING:
 		if (old_state != DAI_STATE_PAUSED &&
+		    old_state != DAI_STATE_PRE_RUNNING &&
 		    old_state != DAI_STATE_STOPPING &&
 		    old_state != DAI_STATE_READY) {
 			return -EPERM;
@@ -469,14 +476,14 @@ static int sai_update_state(enum dai_dir dir,
 		break;
 	case DAI_STATE_STOPPING:
 		if (old_state != DAI_STATE_READY &&
+		    old_state != DAI_STATE_PRE_RUNNING &&
 		    old_state != DAI_STATE_RUNNING &&
 		    old_state != DAI_STATE_PAUSED) {
 			return -EPERM;
 		}
 		break;
 	case DAI_STATE_ERROR:
-	case DAI_STATE_PRE_RUNNING:
-		/* these states are not used so transitioning to them
+		/* this state is not used so transitioning to it
 		 * is considered invalid.
 		 */
 	default:
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/display.h>
+
+static K_KERNEL_STACK_DEFINE(display_async_stack, CONFIG_DISPLAY_ASYNC_STACK_SIZE);
+static struct k_work_q display_async_q;
+
+static void display_async_handler(struct k_work *work)
+{
+	struct display_async_op *op = CONTAINER_OF(work, struct display_async_op, work);
+	int rc;
+
+	rc = display_write_regions(op->dev, op->regions, op->count);
+
+	op->cb(op->dev, op, rc);
+}
+
+static int display_async_submit(const struct device *dev, const struct display_region *regions,
+				size_t count, struct display_async_op *op, display_async_cb_t cb)
+{
+	if (k_work_busy_get(&op->work) != 0) {
+		return -EBUSY;
+	}
+
+	k_work_init(&op->work, display_async_handler);
+	op->dev = dev;
+	op->regions = regions;
+	op->count = count;
+	op->cb = cb;
+
+	(void)k_work_submit_to_queue(&display_async_q, &op->work);
+
+	return 0;
+}
+
+int display_write_async(const struct device *dev, const uint16_t x, const uint16_t y,
+			const struct display_buffer_descriptor *desc, const void *buf,
+			struct display_async_op *op, display_async_cb_t cb)
+{
+	if (k_work_busy_get(&op->work) != 0) {
+		return -EBUSY;
+	}
+
+	op->region.x = x;
+	op->region.y = y;
+	op->region.desc = *desc;
+	op->region.buf = buf;
+
+	return display_async_submit(dev, &op->region, 1, op, cb);
+}
+
+int display_write_regions_async(const struct device *dev, const struct display_region *regions,
+				size_t count, struct display_async_op *op, display_async_cb_t cb)
+{
+	return display_async_submit(dev, regions, count, op, cb);
+}
+
+static int display_async_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "display_async",
+	};
+
+	k_work_queue_start(&display_async_q, display_async_stack,
+			   K_KERNEL_STACK_SIZEOF(display_async_stack),
+			   CONFIG_DISPLAY_ASYNC_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(display_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -17,6 +17,7 @@
 #include <zephyr/devicetree.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/dma/dma_desc_pool.h>
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/sys/barrier.h>
 
@@ -49,7 +50,7 @@ struct dma_mcux_edma_config {
 	uint32_t channel_gap[2];
 #endif
 	void (*irq_config_func)(const struct device *dev);
-	edma_tcd_t (*tcdpool)[CONFIG_DMA_TCD_QUEUE_SIZE];
+	const struct dma_desc_pool *tcd_pool;
 };
 
 
@@ -100,6 +101,19 @@ struct dma_mcux_channel_transfer_edma_settings {
 	volatile uint8_t write_idx;
 	/* How many TCDs in TCD pool is emtpy(can be used to write transfer parameters) */
 	volatile uint8_t empty_tcds;
+	/* Next TCD expected to complete */
+	volatile uint8_t read_idx;
+	/* Major loop interrupt only at the end of each half of the ring, see
+	 * dma_mcux_edma_tcd_irq()
+	 */
+	bool irq_coalesced;
+	/* Data units moved per minor loop, more than one for planar destinations */
+	uint16_t minor_loop_units;
+	/* Loop SG mode chain left as configured, dma_start() can run it again */
+	bool prepared;
+	/* TCDs loaded by the configuration of the prepared chain */
+	uint8_t prepared_tcds;
+	uint32_t slot;
 };
 
 
@@ -110,6 +124,8 @@ struct call_back {
 	void *user_data;
 	dma_callback_t dma_callback;
 	struct dma_mcux_channel_transfer_edma_settings transfer_settings;
+	/* CONFIG_DMA_TCD_QUEUE_SIZE TCDs from the controller's pool, for SG modes */
+	edma_tcd_t *tcds;
 	bool busy;
 };
 
@@ -148,6 +164,7 @@ struct dma_mcux_edma_data {
 #define EDMA_TCD_DLAST_SGA(tcd, flag) ((tcd)->DLAST_SGA)
 #if defined(CONFIG_DMA_MCUX_EDMA_V3)
 #define DMA_CSR_DREQ                  DMA_TCD_CSR_DREQ
+#define DMA_CSR_INTMAJOR              DMA_TCD_CSR_INTMAJOR
 #define EDMA_HW_TCD_CH_ACTIVE_MASK    (DMA_CH_CSR_ACTIVE_MASK)
 #else
 #define EDMA_HW_TCD_CH_ACTIVE_MASK    (DMA_CSR_ACTIVE_MASK)
@@ -216,6 +233,52 @@ static bool data_size_valid(const size_t data_size)
 		);
 }
 
+/*
+ * In loop SG mode without per block callbacks (complete_callback_en = 0), only the last TCD of
+ * each half of the ring raises the major loop interrupt, so that one half is reloaded while the
+ * other one is transferred. The last TCD loaded raises it too, so that a chain which is not
+ * reloaded in time still reports its end.
+ */
+static bool dma_mcux_edma_tcd_irq(const struct call_back *data, uint8_t idx, bool last)
+{
+	if (!data->transfer_settings.irq_coalesced || last) {
+		return true;
+	}
+
+	return idx == (CONFIG_DMA_TCD_QUEUE_SIZE / 2U) - 1U ||
+	       idx == CONFIG_DMA_TCD_QUEUE_SIZE - 1U;
+}
+
+static void dma_mcux_edma_tcd_set_irq(const struct device *dev, edma_tcd_t *tcd, bool enable)
+{
+	if (enable) {
+		EDMA_TCD_CSR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) |= DMA_CSR_INTMAJOR(1U);
+	} else {
+		EDMA_TCD_CSR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) &= ~DMA_CSR_INTMAJOR(1U);
+	}
+}
+
+/* Report every TCD completed up to the one which raised the interrupt, in order */
+static void dma_mcux_edma_coalesced_callback(struct call_back *data, uint32_t channel)
+{
+	bool irq;
+
+	do {
+		edma_tcd_t *tcd = &data->tcds[data->transfer_settings.read_idx];
+
+		irq = (EDMA_TCD_CSR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(data->dev))) &
+		       DMA_CSR_INTMAJOR(1U)) != 0U;
+
+		data->transfer_settings.read_idx =
+			(data->transfer_settings.read_idx + 1) % CONFIG_DMA_TCD_QUEUE_SIZE;
+		data->transfer_settings.empty_tcds++;
+
+		/* The callback may reload TCDs past the ones walked here, or stop the channel */
+		data->dma_callback(data->dev, data->user_data, channel, DMA_STATUS_COMPLETE);
+	} while (!irq && data->busy &&
+		 data->transfer_settings.empty_tcds < CONFIG_DMA_TCD_QUEUE_SIZE);
+}
+
 static void nxp_edma_callback(edma_handle_t *handle, void *param, bool transferDone,
 			      uint32_t tcds)
 {
@@ -223,7 +286,16 @@ static void nxp_edma_callback(edma_handle_t *handle, void *param, bool transferD
 	struct call_back *data = (struct call_back *)param;
 	uint32_t channel = dma_mcux_edma_remove_channel_gap(data->dev, handle->channel);
 
+	if (data->transfer_settings.cyclic && data->transfer_settings.irq_coalesced) {
+		/*In loop mode, DMA is always busy*/
+		data->busy = 1;
+		dma_mcux_edma_coalesced_callback(data, channel);
+		return;
+	}
+
 	if (data->transfer_settings.cyclic) {
+		data->transfer_settings.read_idx =
+			(data->transfer_settings.read_idx + 1) % CONFIG_DMA_TCD_QUEUE_SIZE;
 		data->transfer_settings.empty_tcds++;
 		/*In loop mode, DMA is always busy*/
 		data->busy = 1;
@@ -343,6 +415,7 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	dmamux_channel = DEV_DMAMUX_CHANNEL(dev, channel);
 #endif
 	data->transfer_settings.valid = false;
+	data->transfer_settings.prepared = false;
 
 	switch (config->channel_direction) {
 	case MEMORY_TO_MEMORY:
@@ -377,6 +450,40 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 			LOG_ERR("please config DMA_TCD_QUEUE_SIZE as %d", config->block_count);
 			return -EINVAL;
 		}
+
+		/* Kept until the channel is released */
+		if (data->tcds == NULL) {
+			data->tcds = dma_desc_pool_alloc(DEV_CFG(dev)->tcd_pool,
+							 CONFIG_DMA_TCD_QUEUE_SIZE);
+			if (data->tcds == NULL) {
+				LOG_ERR("no TCDs left for channel %d, increase "
+					"DMA_MCUX_EDMA_TCD_POOL_CHANNELS", channel);
+				return -ENOMEM;
+			}
+		}
+	}
+
+	/* A planar destination spreads each minor loop over dest_scatter_count
+	 * planes, dest_scatter_interval bytes apart, using the minor loop offset to
+	 * step back to the first plane. Only the loop SG mode keeps that geometry
+	 * across reloads.
+	 */
+	if (block_config->dest_scatter_count > 1U) {
+		uint32_t minor_loop_bytes = config->dest_data_size * block_config->dest_scatter_count;
+
+		if (!config->cyclic ||
+		    !(block_config->source_gather_en || block_config->dest_scatter_en)) {
+			LOG_ERR("planar destination requires loop SG mode");
+			return -ENOTSUP;
+		}
+
+		if (config->source_burst_length != minor_loop_bytes ||
+		    (block_config->block_size % minor_loop_bytes) != 0U) {
+			LOG_ERR("planar burst %d does not match %d units of %d bytes",
+				config->source_burst_length, block_config->dest_scatter_count,
+				config->dest_data_size);
+			return -EINVAL;
+		}
 	}
 
 	data->transfer_settings.source_data_size = config->source_data_size;
@@ -387,6 +494,8 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	data->transfer_settings.transfer_type = transfer_type;
 	data->transfer_settings.valid = true;
 	data->transfer_settings.cyclic = config->cyclic;
+	data->transfer_settings.irq_coalesced = config->cyclic && !config->complete_callback_en;
+	data->transfer_settings.minor_loop_units = MAX(block_config->dest_scatter_count, 1U);
 
 	/* Lock and page in the channel configuration */
 	key = irq_lock();
@@ -428,15 +537,15 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	EDMA_EnableChannelInterrupts(DEV_BASE(dev), hw_channel, kEDMA_ErrorInterruptEnable);
 
 	/* Initialize all TCD pool as 0*/
-	for (int i = 0; i < CONFIG_DMA_TCD_QUEUE_SIZE; i++) {
-		memset(&DEV_CFG(dev)->tcdpool[channel][i], 0,
-		       sizeof(DEV_CFG(dev)->tcdpool[channel][i]));
+	if (data->tcds != NULL) {
+		memset(data->tcds, 0, CONFIG_DMA_TCD_QUEUE_SIZE * sizeof(data->tcds[0]));
 	}
 
 	if (block_config->source_gather_en || block_config->dest_scatter_en) {
 		if (config->cyclic) {
 			/* Loop SG mode */
 			data->transfer_settings.write_idx = 0;
+			data->transfer_settings.read_idx = 0;
 			data->transfer_settings.empty_tcds = CONFIG_DMA_TCD_QUEUE_SIZE;
 
 			EDMA_PrepareTransfer(
@@ -445,31 +554,55 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 				config->dest_data_size, config->source_burst_length,
 				block_config->block_size, transfer_type);
 
+			edma_minor_offset_config_t minor_offset = {
+				.enableSrcMinorOffset = false,
+				.enableDestMinorOffset = true,
+				.minorOffset = config->dest_data_size -
+					       block_config->dest_scatter_count *
+					       block_config->dest_scatter_interval,
+			};
+
+			if (data->transfer_settings.minor_loop_units > 1U) {
+				data->transferConfig.destOffset =
+					(int16_t)block_config->dest_scatter_interval;
+			}
+
 			/* Init all TCDs with the para in transfer config and link them. */
 			for (int i = 0; i < CONFIG_DMA_TCD_QUEUE_SIZE; i++) {
 #if defined(CONFIG_DMA_MCUX_EDMA_V5)
 				EDMA_TcdSetTransferConfigExt(DEV_BASE(dev),
-					&DEV_CFG(dev)->tcdpool[channel][i], &data->transferConfig,
-					&DEV_CFG(dev)->tcdpool[channel][(i + 1) %
+					&data->tcds[i], &data->transferConfig,
+					&data->tcds[(i + 1) %
 						CONFIG_DMA_TCD_QUEUE_SIZE]);
 				/* Enable Major loop interrupt.*/
-				EDMA_TcdEnableInterruptsExt(DEV_BASE(dev),
-						&DEV_CFG(dev)->tcdpool[channel][i],
-						kEDMA_MajorInterruptEnable);
+				if (!data->transfer_settings.irq_coalesced) {
+					EDMA_TcdEnableInterruptsExt(DEV_BASE(dev),
+							&data->tcds[i],
+							kEDMA_MajorInterruptEnable);
+				}
+				if (data->transfer_settings.minor_loop_units > 1U) {
+					EDMA_TcdSetMinorOffsetConfigExt(DEV_BASE(dev),
+						&data->tcds[i], &minor_offset);
+				}
 #else
-				EDMA_TcdSetTransferConfig(&DEV_CFG(dev)->tcdpool[channel][i],
+				EDMA_TcdSetTransferConfig(&data->tcds[i],
 						&data->transferConfig,
-						&DEV_CFG(dev)->tcdpool[channel][(i + 1) %
+						&data->tcds[(i + 1) %
 						CONFIG_DMA_TCD_QUEUE_SIZE]);
-				EDMA_TcdEnableInterrupts(&DEV_CFG(dev)->tcdpool[channel][i],
-						kEDMA_MajorInterruptEnable);
+				if (!data->transfer_settings.irq_coalesced) {
+					EDMA_TcdEnableInterrupts(&data->tcds[i],
+							kEDMA_MajorInterruptEnable);
+				}
+				if (data->transfer_settings.minor_loop_units > 1U) {
+					EDMA_TcdSetMinorOffsetConfig(&data->tcds[i],
+								     &minor_offset);
+				}
 #endif
 			}
 
 			/* Load valid transfer parameters */
 			while (block_config != NULL && data->transfer_settings.empty_tcds > 0) {
-				tcd = &(DEV_CFG(dev)->tcdpool[channel]
-							     [data->transfer_settings.write_idx]);
+				tcd = &data->tcds[data->transfer_settings.write_idx];
 
 #if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
 				EDMA_TCD_SADDR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) =
@@ -488,9 +621,11 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 					block_config->dest_address;
 #endif
 				EDMA_TCD_BITER(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) =
-					block_config->block_size / config->source_data_size;
+					block_config->block_size / config->source_data_size /
+					data->transfer_settings.minor_loop_units;
 				EDMA_TCD_CITER(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) =
-					block_config->block_size / config->source_data_size;
+					block_config->block_size / config->source_data_size /
+					data->transfer_settings.minor_loop_units;
 				/*Enable auto stop for last transfer.*/
 				if (block_config->next_block == NULL) {
 					EDMA_TCD_CSR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) |=
@@ -500,6 +635,13 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 						~DMA_CSR_DREQ(1U);
 				}
 
+				if (data->transfer_settings.irq_coalesced) {
+					dma_mcux_edma_tcd_set_irq(dev, tcd,
+						dma_mcux_edma_tcd_irq(data,
+							data->transfer_settings.write_idx,
+							block_config->next_block == NULL));
+				}
+
 				data->transfer_settings.write_idx =
 					(data->transfer_settings.write_idx + 1) %
 					CONFIG_DMA_TCD_QUEUE_SIZE;
@@ -514,11 +656,16 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 			}
 			/* Push the 1st TCD into HW */
 			EDMA_InstallTCD(p_handle->base, hw_channel,
-					&DEV_CFG(dev)->tcdpool[channel][0]);
+					&data->tcds[0]);
+
+			data->transfer_settings.prepared_tcds =
+				CONFIG_DMA_TCD_QUEUE_SIZE - data->transfer_settings.empty_tcds;
+			data->transfer_settings.slot = slot;
+			data->transfer_settings.prepared = (ret == 0);
 
 		} else {
 			/* Dynamic Scatter Gather mode */
-			EDMA_InstallTCDMemory(p_handle, DEV_CFG(dev)->tcdpool[channel],
+			EDMA_InstallTCDMemory(p_handle, data->tcds,
 					      CONFIG_DMA_TCD_QUEUE_SIZE);
 
 			while (block_config != NULL) {
@@ -585,12 +732,38 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	return ret;
 }
 
+/* Load the loop SG chain left by the last configuration into the channel again */
+static void dma_mcux_edma_restart_chain(const struct device *dev, uint32_t channel)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+	uint32_t hw_channel = dma_mcux_edma_add_channel_gap(dev, channel);
+
+	data->transfer_settings.write_idx =
+		data->transfer_settings.prepared_tcds % CONFIG_DMA_TCD_QUEUE_SIZE;
+	data->transfer_settings.read_idx = 0;
+	data->transfer_settings.empty_tcds =
+		CONFIG_DMA_TCD_QUEUE_SIZE - data->transfer_settings.prepared_tcds;
+	data->transfer_settings.valid = true;
+
+#if defined(FSL_FEATURE_EDMA_HAS_CHANNEL_MUX) && FSL_FEATURE_EDMA_HAS_CHANNEL_MUX
+	EDMA_SetChannelMux(DEV_BASE(dev), hw_channel, 0);
+	EDMA_SetChannelMux(DEV_BASE(dev), hw_channel, data->transfer_settings.slot);
+#endif
+	EDMA_EnableChannelInterrupts(DEV_BASE(dev), hw_channel, kEDMA_ErrorInterruptEnable);
+	EDMA_InstallTCD(DEV_BASE(dev), hw_channel, &data->tcds[0]);
+}
+
 static int dma_mcux_edma_start(const struct device *dev, uint32_t channel)
 {
 	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
 
 	LOG_DBG("START TRANSFER");
 
+	/* Prepare once, start many times: a stopped loop SG chain needs no new configuration */
+	if (!data->busy && data->transfer_settings.prepared && !data->transfer_settings.valid) {
+		dma_mcux_edma_restart_chain(dev, channel);
+	}
+
 #if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
 	uint8_t dmamux_idx = DEV_DMAMUX_IDX(dev, channel);
 	uint8_t dmamux_channel = DEV_DMAMUX_CHANNEL(dev, channel);
@@ -658,7 +831,8 @@ static void dma_mcux_edma_update_hw_tcd(const struct device *dev, uint32_t chann
 	EDMA_HW_TCD_DADDR(dev, channel) = dst;
 	EDMA_HW_TCD_BITER(dev, channel) = size;
 	EDMA_HW_TCD_CITER(dev, channel) = size;
-	EDMA_HW_TCD_CSR(dev, channel) |= DMA_CSR_DREQ(1U);
+	/* The TCD loaded when the chain ended may have its interrupt disabled */
+	EDMA_HW_TCD_CSR(dev, channel) |= DMA_CSR_DREQ(1U) | DMA_CSR_INTMAJOR(1U);
 }
 
 static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
@@ -687,8 +861,12 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 			goto cleanup;
 		}
 
+		/* The chain no longer matches the configuration */
+		data->transfer_settings.prepared = false;
+
 		/* Convert size into major loop count */
-		size = size / data->transfer_settings.dest_data_size;
+		size = size / data->transfer_settings.dest_data_size /
+		       data->transfer_settings.minor_loop_units;
 
 		/* Previous TCD index in circular list */
 		pre_idx = data->transfer_settings.write_idx - 1;
@@ -697,8 +875,8 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 		}
 
 		/* Configure a TCD for the transfer */
-		tcd = &(DEV_CFG(dev)->tcdpool[channel][data->transfer_settings.write_idx]);
-		pre_tcd = &(DEV_CFG(dev)->tcdpool[channel][pre_idx]);
+		tcd = &data->tcds[data->transfer_settings.write_idx];
+		pre_tcd = &data->tcds[pre_idx];
 
 #if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
 		EDMA_TCD_SADDR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) =
@@ -713,6 +891,8 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 		EDMA_TCD_CITER(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) = size;
 		/* Enable automatically stop */
 		EDMA_TCD_CSR(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev))) |= DMA_CSR_DREQ(1U);
+		/* The last TCD loaded always raises the interrupt */
+		dma_mcux_edma_tcd_set_irq(dev, tcd, true);
 		sw_id = EDMA_TCD_DLAST_SGA(tcd, EDMA_TCD_TYPE((void *)DEV_BASE(dev)));
 
 		/* Block the peripheral's hardware request trigger to prevent
@@ -750,10 +930,15 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 			if (data->transfer_settings.empty_tcds == CONFIG_DMA_TCD_QUEUE_SIZE - 1 ||
 			    hw_id == (uint32_t)tcd) {
 				/* DMA is running on last transfer. HW has loaded the last one,
-				 * we need ensure it's DREQ is cleared.
+				 * we need ensure it's DREQ is cleared. Its interrupt is left
+				 * enabled, as in the copy loaded by HW.
 				 */
 				EDMA_EnableAutoStopRequest(DEV_BASE(dev), channel, false);
 				LOG_DBG("Last transfer.");
+			} else {
+				/* No longer the last TCD */
+				dma_mcux_edma_tcd_set_irq(dev, pre_tcd,
+							  dma_mcux_edma_tcd_irq(data, pre_idx, false));
 			}
 			LOG_DBG("Manu stop");
 		}
@@ -809,24 +994,46 @@ cleanup:
 	return ret;
 }
 
+/* Loop SG mode TCDs completed by HW but not reported by a callback yet */
+static uint8_t dma_mcux_edma_tcds_done(const struct device *dev, uint32_t channel)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+	uint32_t next = (EDMA_GetNextTCDAddress(DEV_EDMA_HANDLE(dev, channel)) -
+			 (uint32_t)data->tcds) / sizeof(edma_tcd_t);
+	uint8_t cur = (next + CONFIG_DMA_TCD_QUEUE_SIZE - 1U) % CONFIG_DMA_TCD_QUEUE_SIZE;
+	uint8_t done = (cur + CONFIG_DMA_TCD_QUEUE_SIZE - data->transfer_settings.read_idx) %
+		       CONFIG_DMA_TCD_QUEUE_SIZE;
+
+	return MIN(done, CONFIG_DMA_TCD_QUEUE_SIZE - data->transfer_settings.empty_tcds);
+}
+
 static int dma_mcux_edma_get_status(const struct device *dev, uint32_t channel,
 				    struct dma_status *status)
 {
 	uint32_t hw_channel = dma_mcux_edma_add_channel_gap(dev, channel);
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
 
-	if (DEV_CHANNEL_DATA(dev, channel)->busy) {
+	if (data->busy) {
 		status->busy = true;
 		/* pending_length is in bytes.  Multiply remaining major loop
 		 * count by NBYTES for each minor loop
 		 */
 		status->pending_length =
 			EDMA_GetRemainingMajorLoopCount(DEV_BASE(dev), hw_channel) *
-			DEV_CHANNEL_DATA(dev, channel)->transfer_settings.source_data_size;
+			data->transfer_settings.source_data_size;
 	} else {
 		status->busy = false;
 		status->pending_length = 0;
 	}
-	status->dir = DEV_CHANNEL_DATA(dev, channel)->transfer_settings.direction;
+
+	/* Free TCDs in loop SG mode, with the completed ones whose interrupt is still to come */
+	if (data->busy && data->transfer_settings.cyclic && data->tcds != NULL) {
+		status->free = data->transfer_settings.empty_tcds +
+			       dma_mcux_edma_tcds_done(dev, channel);
+	} else {
+		status->free = 0;
+	}
+	status->dir = data->transfer_settings.direction;
 
 #if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
 	uint8_t dmamux_idx = DEV_DMAMUX_IDX(dev, channel);
@@ -863,6 +1070,19 @@ static int dma_mcux_edma_get_status(const struct device *dev, uint32_t channel,
 	return 0;
 }
 
+static void dma_mcux_edma_release_channel(const struct device *dev, uint32_t channel)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+
+	dma_mcux_edma_stop(dev, channel);
+	data->transfer_settings.prepared = false;
+
+	if (data->tcds != NULL) {
+		dma_desc_pool_free(DEV_CFG(dev)->tcd_pool, data->tcds, CONFIG_DMA_TCD_QUEUE_SIZE);
+		data->tcds = NULL;
+	}
+}
+
 static bool dma_mcux_edma_channel_filter(const struct device *dev,
 					 int channel_id, void *param)
 {
@@ -885,6 +1105,7 @@ static DEVICE_API(dma, dma_mcux_edma_api) = {
 	.resume = dma_mcux_edma_resume,
 	.get_status = dma_mcux_edma_get_status,
 	.chan_filter = dma_mcux_edma_channel_filter,
+	.chan_release = dma_mcux_edma_release_channel,
 };
 
 static int dma_mcux_edma_init(const struct device *dev)
@@ -1012,14 +1233,21 @@ static int dma_mcux_edma_init(const struct device *dev)
 #define DMA_TCD_ALIGN_SIZE	32
 #endif
 
+/* Channels which can use SG modes at the same time */
+#define DMA_TCD_POOL_CHANNELS(n)						\
+	((CONFIG_DMA_MCUX_EDMA_TCD_POOL_CHANNELS != 0) ?			\
+	 MIN(CONFIG_DMA_MCUX_EDMA_TCD_POOL_CHANNELS, DT_INST_PROP(n, dma_channels)) : \
+	 DT_INST_PROP(n, dma_channels))
+
 /*
  * define the dma
  */
 #define DMA_INIT(n)								\
 	DMAMUX_BASE_INIT_DEFINE(n)						\
 	static void dma_imx_config_func_##n(const struct device *dev);		\
-	static __aligned(DMA_TCD_ALIGN_SIZE) EDMA_TCDPOOL_CACHE_ATTR edma_tcd_t	\
-	dma_tcdpool##n[DT_INST_PROP(n, dma_channels)][CONFIG_DMA_TCD_QUEUE_SIZE];\
+	DMA_DESC_POOL_DEFINE(dma_tcdpool##n, edma_tcd_t,			\
+			     DMA_TCD_POOL_CHANNELS(n) * CONFIG_DMA_TCD_QUEUE_SIZE, \
+			     DMA_TCD_ALIGN_SIZE, EDMA_TCDPOOL_CACHE_ATTR);	\
 	static const struct dma_mcux_edma_config dma_config_##n = {		\
 		.base = (DMAx_Type *)DT_INST_REG_ADDR(n),			\
 		DMAMUX_BASE_INIT(n)						\
@@ -1029,7 +1257,7 @@ static int dma_mcux_edma_init(const struct device *dev)
 		.irq_config_func = dma_imx_config_func_##n,			\
 		.dmamux_reg_offset = DT_INST_PROP(n, dmamux_reg_offset),	\
 		DMA_MCUX_EDMA_CHANNEL_GAP(n)					\
-		.tcdpool = dma_tcdpool##n,					\
+		.tcd_pool = &dma_tcdpool##n,					\
 	};									\
 										\
 	static struct call_back							\
@@ -381,19 +381,30 @@ static int eth_nxp_enet_rx(const struct device *dev)
 		goto flush;
 	}
 
-	k_mutex_lock(&data->rx_frame_buf_mutex, K_FOREVER);
-	status = ENET_ReadFrame(data->base, &data->enet_handle,
-				data->rx_frame_buf, frame_length, RING_ID, &ts);
-	k_mutex_unlock(&data->rx_frame_buf_mutex);
-
-	if (status) {
-		LOG_ERR("ENET_ReadFrame failed: %d", (int)status);
-		goto error;
-	}
+	if (pkt->buffer->frags == NULL && net_buf_tailroom(pkt->buffer) >= frame_length) {
+		/* The frame fits in one buffer, read it there without bouncing */
+		status = ENET_ReadFrame(data->base, &data->enet_handle,
+					net_buf_add(pkt->buffer, frame_length),
+					frame_length, RING_ID, &ts);
+		if (status) {
+			LOG_ERR("ENET_ReadFrame failed: %d", (int)status);
+			goto error;
+		}
+	} else {
+		k_mutex_lock(&data->rx_frame_buf_mutex, K_FOREVER);
+		status = ENET_ReadFrame(data->base, &data->enet_handle,
+					data->rx_frame_buf, frame_length, RING_ID, &ts);
+		k_mutex_unlock(&data->rx_frame_buf_mutex);
+
+		if (status) {
+			LOG_ERR("ENET_ReadFrame failed: %d", (int)status);
+			goto error;
+		}
 
-	if (net_pkt_write(pkt, data->rx_frame_buf, frame_length)) {
-		LOG_ERR("Unable to write frame into the packet");
-		goto error;
+		if (net_pkt_write(pkt, data->rx_frame_buf, frame_length)) {
+			LOG_ERR("Unable to write frame into the packet");
+			goto error;
+		}
 	}
 
 #if defined(CONFIG_PTP_CLOCK_NXP_ENET)
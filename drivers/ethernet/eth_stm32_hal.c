@@ -27,6 +27,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <ethernet/eth_stats.h>
 #include <soc.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/cache.h>
 #include <zephyr/drivers/clock_control.h>
 #include <zephyr/drivers/clock_control/stm32_clock_control.h>
 #include <zephyr/drivers/pinctrl.h>
@@ -127,18 +128,22 @@ static ETH_DMADescTypeDef dma_rx_desc_tab[ETH_RXBUFNB] __eth_stm32_desc;
 static ETH_DMADescTypeDef dma_tx_desc_tab[ETH_TXBUFNB] __eth_stm32_desc;
 #endif
 
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 static uint8_t dma_rx_buffer[ETH_RXBUFNB][ETH_STM32_RX_BUF_SIZE] __eth_stm32_buf;
+#endif
 static uint8_t dma_tx_buffer[ETH_TXBUFNB][ETH_STM32_TX_BUF_SIZE] __eth_stm32_buf;
 
 #if defined(CONFIG_ETH_STM32_HAL_API_V2)
 
 BUILD_ASSERT(ETH_STM32_RX_BUF_SIZE % 4 == 0, "Rx buffer size must be a multiple of 4");
 
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 struct eth_stm32_rx_buffer_header {
 	struct eth_stm32_rx_buffer_header *next;
 	uint16_t size;
 	bool used;
 };
+#endif
 
 struct eth_stm32_tx_buffer_header {
 	ETH_BufferTypeDef tx_buff;
@@ -151,10 +156,79 @@ struct eth_stm32_tx_context {
 	bool used;
 };
 
-static struct eth_stm32_rx_buffer_header dma_rx_buffer_header[ETH_RXBUFNB];
 static struct eth_stm32_tx_buffer_header dma_tx_buffer_header[ETH_TXBUFNB];
 static struct eth_stm32_tx_context dma_tx_context[ETH_TX_DESC_CNT];
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+
+BUILD_ASSERT(CONFIG_NET_BUF_DATA_SIZE >= ETH_STM32_RX_BUF_SIZE,
+	     "Network buffers must hold a whole Rx DMA buffer");
+BUILD_ASSERT(CONFIG_NET_BUF_DATA_SIZE % 4 == 0, "Network buffer size must be a multiple of 4");
+
+/* Network buffers owned by the DMA, the HAL only knows their data pointer */
+static struct net_buf *dma_rx_net_buf[ETH_RXBUFNB];
+
+/* called by HAL_ETH_ReadData() to refill the descriptors it has consumed */
+void HAL_ETH_RxAllocateCallback(uint8_t **buf)
+{
+	for (size_t i = 0; i < ETH_RXBUFNB; ++i) {
+		struct net_buf *nb;
+
+		if (dma_rx_net_buf[i] != NULL) {
+			continue;
+		}
+
+		/* Without a buffer the descriptor stays with the CPU, the HAL
+		 * tries again on its next read and the MAC drops frames meanwhile
+		 */
+		nb = net_pkt_get_reserve_rx_data(ETH_STM32_RX_BUF_SIZE, K_NO_WAIT);
+		if (nb == NULL) {
+			break;
+		}
+
+		/* No dirty line may be written back over the DMA data */
+		sys_cache_data_invd_range(nb->data, ETH_STM32_RX_BUF_SIZE);
+
+		dma_rx_net_buf[i] = nb;
+		*buf = nb->data;
+		return;
+	}
+	*buf = NULL;
+}
+
+/* called by HAL_ETH_ReadData() */
+void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length)
+{
+	struct net_buf *nb = NULL;
+
+	for (size_t i = 0; i < ETH_RXBUFNB; ++i) {
+		if (dma_rx_net_buf[i] != NULL && dma_rx_net_buf[i]->data == buff) {
+			nb = dma_rx_net_buf[i];
+			dma_rx_net_buf[i] = NULL;
+			break;
+		}
+	}
+
+	__ASSERT_NO_MSG(nb != NULL);
+
+	sys_cache_data_invd_range(buff, Length);
+	net_buf_add(nb, Length);
+
+	if (!*pStart) {
+		/* first fragment of the frame */
+		*pStart = nb;
+	} else {
+		__ASSERT_NO_MSG(*pEnd != NULL);
+		((struct net_buf *)*pEnd)->frags = nb;
+	}
+
+	*pEnd = nb;
+}
+
+#else /* !CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
+
+static struct eth_stm32_rx_buffer_header dma_rx_buffer_header[ETH_RXBUFNB];
+
 void HAL_ETH_RxAllocateCallback(uint8_t **buf)
 {
 	for (size_t i = 0; i < ETH_RXBUFNB; ++i) {
@@ -197,6 +271,8 @@ void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t
 	}
 }
 
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
+
 /* Called by HAL_ETH_ReleaseTxPacket */
 void HAL_ETH_TxFreeCallback(uint32_t *buff)
 {
@@ -517,11 +593,14 @@ static struct net_pkt *eth_rx(const struct device *dev)
 	struct eth_stm32_hal_dev_data *dev_data = dev->data;
 	ETH_HandleTypeDef *heth = &dev_data->heth;
 	struct net_pkt *pkt;
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	void *appbuf = NULL;
+#elif defined(CONFIG_ETH_STM32_HAL_API_V2)
 	size_t total_len = 0;
-#if defined(CONFIG_ETH_STM32_HAL_API_V2)
 	void *appbuf = NULL;
 	struct eth_stm32_rx_buffer_header *rx_header;
 #else
+	size_t total_len = 0;
 	__IO ETH_DMADescTypeDef *dma_rx_desc;
 	uint8_t *dma_buffer;
 	HAL_StatusTypeDef hal_ret = HAL_OK;
@@ -534,7 +613,12 @@ static struct net_pkt *eth_rx(const struct device *dev)
 	timestamp.nanosecond = UINT32_MAX;
 #endif /* CONFIG_PTP_CLOCK_STM32_HAL */
 
-#if defined(CONFIG_ETH_STM32_HAL_API_V2)
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	if (HAL_ETH_ReadData(heth, &appbuf) != HAL_OK) {
+		/* no frame available */
+		return NULL;
+	}
+#elif defined(CONFIG_ETH_STM32_HAL_API_V2)
 	if (HAL_ETH_ReadData(heth, &appbuf) != HAL_OK) {
 		/* no frame available */
 		return NULL;
@@ -563,6 +647,19 @@ static struct net_pkt *eth_rx(const struct device *dev)
 	}
 #endif /* CONFIG_PTP_CLOCK_STM32_HAL */
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	/* The DMA buffers become the packet data, their replacements were
+	 * already posted by HAL_ETH_ReadData()
+	 */
+	pkt = net_pkt_rx_alloc_on_iface(get_iface(dev_data), K_MSEC(100));
+	if (!pkt) {
+		LOG_ERR("Failed to obtain RX packet");
+		net_buf_unref(appbuf);
+		goto out;
+	}
+
+	net_pkt_append_buffer(pkt, appbuf);
+#else
 	pkt = net_pkt_rx_alloc_with_buffer(get_iface(dev_data),
 					   total_len, AF_UNSPEC, 0, K_MSEC(100));
 	if (!pkt) {
@@ -626,6 +723,7 @@ release_desc:
 	if (!pkt) {
 		goto out;
 	}
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 
 #if defined(CONFIG_PTP_CLOCK_STM32_HAL)
 	pkt->timestamp.second = timestamp.second;
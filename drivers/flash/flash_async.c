@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/drivers/flash.h>
+
+static K_KERNEL_STACK_DEFINE(flash_async_stack, CONFIG_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q flash_async_q;
+
+static void flash_async_handler(struct k_work *work)
+{
+	struct flash_async_op *op = CONTAINER_OF(work, struct flash_async_op, work);
+	const struct device *dev = op->dev;
+	flash_async_cb_t cb = op->cb;
+	int rc;
+
+	/* Erase operations carry no data */
+	if (op->data != NULL) {
+		rc = flash_write(dev, op->offset, op->data, op->size);
+	} else {
+		rc = flash_erase(dev, op->offset, op->size);
+	}
+
+	/* Idle before the callback, which or whoever it wakes up may queue the
+	 * operation again while the work item is still running
+	 */
+	atomic_clear(&op->busy);
+
+	cb(dev, op, rc);
+}
+
+static int flash_async_submit(const struct device *dev, off_t offset, const void *data,
+			      size_t size, struct flash_async_op *op, flash_async_cb_t cb)
+{
+	if (!atomic_cas(&op->busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	/* Not initialized again while the handler may still be running */
+	if (op->work.handler == NULL) {
+		k_work_init(&op->work, flash_async_handler);
+	}
+
+	op->dev = dev;
+	op->offset = offset;
+	op->data = data;
+	op->size = size;
+	op->cb = cb;
+
+	(void)k_work_submit_to_queue(&flash_async_q, &op->work);
+
+	return 0;
+}
+
+int flash_write_async(const struct device *dev, off_t offset, const void *data, size_t len,
+		      struct flash_async_op *op, flash_async_cb_t cb)
+{
+	if (data == NULL) {
+		return -EINVAL;
+	}
+
+	return flash_async_submit(dev, offset, data, len, op, cb);
+}
+
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_op *op, flash_async_cb_t cb)
+{
+	return flash_async_submit(dev, offset, NULL, size, op, cb);
+}
+
+static int flash_async_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "flash_async",
+	};
+
+	k_work_queue_start(&flash_async_q, flash_async_stack,
+			   K_KERNEL_STACK_SIZEOF(flash_async_stack),
+			   CONFIG_FLASH_ASYNC_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(flash_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -157,12 +157,33 @@ struct spi_nor_config {
 	bool use_fast_read: 1;
 };
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+/* Read performed by the erasing thread on behalf of a reader */
+struct spi_nor_read_req {
+	off_t addr;
+	void *dest;
+	size_t size;
+	int ret;
+	struct k_sem done;
+};
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 /**
  * struct spi_nor_data - Structure for defining the SPI NOR access
  * @sem: The semaphore to access to the flash
  */
 struct spi_nor_data {
 	struct k_sem sem;
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* Serializes readers handing their read to the erasing thread */
+	struct k_mutex rd_mutex;
+	/* Protects erasing and rd_req */
+	struct k_spinlock rd_lock;
+	/* Read handed to the erasing thread */
+	struct spi_nor_read_req *rd_req;
+	/* Set while an erase holds the device */
+	bool erasing;
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
 #if ANY_INST_HAS_DPD
 	/* Low 32-bits of uptime counter at which device last entered
 	 * deep power-down.
@@ -858,25 +879,15 @@ static int mxicy_configure(const struct device *dev, const uint8_t *jedec_id)
 
 #endif /* ANY_INST_HAS_MXICY_MX25R_POWER_MODE */
 
-static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
-			size_t size)
+/* @note The device must be externally acquired before invoking this
+ * function.
+ */
+static int spi_nor_read_locked(const struct device *dev, off_t addr, void *dest,
+			       size_t size)
 {
 	const struct spi_nor_config *cfg = dev->config;
-	const size_t flash_size = dev_flash_size(dev);
 	int ret;
 
-	/* should be between 0 and flash size */
-	if ((addr < 0) || ((addr + size) > flash_size)) {
-		return -EINVAL;
-	}
-
-	/* Ensure flash is powered before read */
-	if (pm_device_runtime_get(dev) < 0) {
-		return -EIO;
-	}
-
-	acquire_device(dev);
-
 	if (IS_ENABLED(ANY_INST_USE_4B_ADDR_OPCODES) && cfg->use_4b_addr_opcodes) {
 		if (addr > SPI_NOR_3B_ADDR_MAX) {
 			if (IS_ENABLED(ANY_INST_USE_FAST_READ) && cfg->use_fast_read) {
@@ -904,6 +915,179 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 		}
 	}
 
+	return ret;
+}
+
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+/*
+ * Hands a read to the thread erasing the device, if there is one. Returns
+ * -EAGAIN if no erase is in progress and the read has to be done directly.
+ */
+static int spi_nor_read_during_erase(const struct device *dev, off_t addr, void *dest,
+				     size_t size)
+{
+	struct spi_nor_data *data = dev->data;
+	struct spi_nor_read_req req = {
+		.addr = addr,
+		.dest = dest,
+		.size = size,
+	};
+	k_spinlock_key_t key;
+
+	k_sem_init(&req.done, 0, 1);
+	k_mutex_lock(&data->rd_mutex, K_FOREVER);
+
+	key = k_spin_lock(&data->rd_lock);
+	if (!data->erasing) {
+		k_spin_unlock(&data->rd_lock, key);
+		k_mutex_unlock(&data->rd_mutex);
+		return -EAGAIN;
+	}
+	data->rd_req = &req;
+	k_spin_unlock(&data->rd_lock, key);
+
+	k_sem_take(&req.done, K_FOREVER);
+	k_mutex_unlock(&data->rd_mutex);
+
+	return req.ret;
+}
+
+/*
+ * Performs a read handed over by another thread, suspending the erase in
+ * progress around it if requested.
+ *
+ * @note The device must be externally acquired before invoking this
+ * function.
+ */
+static int spi_nor_serve_read(const struct device *dev, bool suspend)
+{
+	struct spi_nor_data *data = dev->data;
+	struct spi_nor_read_req *req;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	key = k_spin_lock(&data->rd_lock);
+	req = data->rd_req;
+	data->rd_req = NULL;
+	k_spin_unlock(&data->rd_lock, key);
+
+	if (req == NULL) {
+		return 0;
+	}
+
+	if (suspend) {
+		ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_PES);
+		if (ret == 0) {
+			/* Device reports ready once the erase is suspended */
+			ret = spi_nor_wait_until_ready(dev, K_NO_WAIT);
+		}
+	}
+
+	req->ret = (ret == 0) ? spi_nor_read_locked(dev, req->addr, req->dest, req->size) : ret;
+	k_sem_give(&req->done);
+
+	if (suspend) {
+		ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_PER);
+	}
+
+	return ret;
+}
+
+static void spi_nor_erase_begin(const struct device *dev)
+{
+	struct spi_nor_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->rd_lock);
+
+	data->erasing = true;
+	k_spin_unlock(&data->rd_lock, key);
+}
+
+/* @note The device must be externally acquired before invoking this
+ * function.
+ */
+static void spi_nor_erase_end(const struct device *dev)
+{
+	struct spi_nor_data *data = dev->data;
+	k_spinlock_key_t key;
+
+	/* Serve a read handed over after the last poll, the device is idle */
+	(void)spi_nor_serve_read(dev, false);
+
+	key = k_spin_lock(&data->rd_lock);
+	data->erasing = false;
+	k_spin_unlock(&data->rd_lock, key);
+
+	/* A reader may have posted between the two steps above */
+	(void)spi_nor_serve_read(dev, false);
+}
+
+/* Waits for an erase to complete, serving reads from other threads meanwhile */
+static int spi_nor_wait_erase(const struct device *dev)
+{
+	int ret;
+
+	while (true) {
+		ret = spi_nor_rdsr(dev);
+		if ((ret < 0) || !(ret & SPI_NOR_WIP_BIT)) {
+			break;
+		}
+
+		ret = spi_nor_serve_read(dev, true);
+		if (ret < 0) {
+			return ret;
+		}
+
+		k_sleep(WAIT_READY_ERASE);
+	}
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Check the flag status register for errors where present */
+	return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+}
+#else
+static inline void spi_nor_erase_begin(const struct device *dev)
+{
+}
+
+static inline void spi_nor_erase_end(const struct device *dev)
+{
+}
+
+static inline int spi_nor_wait_erase(const struct device *dev)
+{
+	return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
+static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
+			size_t size)
+{
+	const size_t flash_size = dev_flash_size(dev);
+	int ret;
+
+	/* should be between 0 and flash size */
+	if ((addr < 0) || ((addr + size) > flash_size)) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	ret = spi_nor_read_during_erase(dev, addr, dest, size);
+	if (ret != -EAGAIN) {
+		return ret;
+	}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
+	/* Ensure flash is powered before read */
+	if (pm_device_runtime_get(dev) < 0) {
+		return -EIO;
+	}
+
+	acquire_device(dev);
+
+	ret = spi_nor_read_locked(dev, addr, dest, size);
+
 	release_device(dev);
 
 	/* Release flash power requirement */
@@ -1053,6 +1237,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 	}
 
 	acquire_device(dev);
+	spi_nor_erase_begin(dev);
 	ret = spi_nor_write_protection_set(dev, false);
 
 	while ((size > 0) && (ret == 0)) {
@@ -1102,7 +1287,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 			break;
 		}
 
-		ret = spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+		ret = spi_nor_wait_erase(dev);
 	}
 
 	int ret2 = spi_nor_write_protection_set(dev, true);
@@ -1111,6 +1296,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 		ret = ret2;
 	}
 
+	spi_nor_erase_end(dev);
 	release_device(dev);
 
 	/* Release flash power requirement */
@@ -1713,6 +1899,9 @@ static int spi_nor_init(const struct device *dev)
 		struct spi_nor_data *const driver_data = dev->data;
 
 		k_sem_init(&driver_data->sem, 1, K_SEM_MAX_LIMIT);
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+		k_mutex_init(&driver_data->rd_mutex);
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
 	}
 
 #if ANY_INST_HAS_WP_GPIOS
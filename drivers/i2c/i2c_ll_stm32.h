@@ -139,7 +139,7 @@ struct i2c_stm32_data {
 };
 
 #ifdef CONFIG_I2C_RTIO
-bool i2c_stm32_start(const struct device *dev);
+void i2c_stm32_start(const struct device *dev);
 int i2c_stm32_msg_start(const struct device *dev, uint8_t flags,
 			uint8_t *buf, size_t buf_len, uint16_t i2c_addr);
 #else /* CONFIG_I2C_RTIO */
@@ -91,7 +91,7 @@ int i2c_stm32_runtime_configure(const struct device *dev, uint32_t config)
 	return ret;
 }
 
-bool i2c_stm32_start(const struct device *dev)
+static bool i2c_stm32_start_sqe(const struct device *dev)
 {
 	struct i2c_stm32_data *data = dev->data;
 	struct i2c_rtio *ctx = data->ctx;
@@ -129,6 +129,16 @@ bool i2c_stm32_start(const struct device *dev)
 	}
 }
 
+void i2c_stm32_start(const struct device *dev)
+{
+	/*
+	 * Submissions completed without a transfer, such as a configuration, are followed
+	 * by the next one right away so a chain of submissions does not stall.
+	 */
+	while (i2c_stm32_start_sqe(dev)) {
+	}
+}
+
 static int i2c_stm32_configure(const struct device *dev,
 				uint32_t dev_config_raw)
 {
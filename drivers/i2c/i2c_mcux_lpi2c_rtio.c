@@ -136,7 +136,8 @@ static uint32_t mcux_lpi2c_convert_flags(int msg_flags)
 }
 
 static bool mcux_lpi2c_msg_start(const struct device *dev, uint8_t flags,
-				 uint8_t *buf, size_t buf_len, uint16_t i2c_addr)
+				 uint8_t *buf, size_t buf_len, uint16_t i2c_addr,
+				 uint32_t subaddress, size_t subaddress_size)
 {
 	struct mcux_lpi2c_data *data = dev->data;
 	struct i2c_rtio *ctx = data->ctx;
@@ -161,8 +162,8 @@ static bool mcux_lpi2c_msg_start(const struct device *dev, uint8_t flags,
 	transfer->slaveAddress = i2c_addr;
 	transfer->direction = (flags & I2C_MSG_READ)
 		? kLPI2C_Read : kLPI2C_Write;
-	transfer->subaddress = 0;
-	transfer->subaddressSize = 0;
+	transfer->subaddress = subaddress;
+	transfer->subaddressSize = subaddress_size;
 	transfer->data = buf;
 	transfer->dataSize = buf_len;
 
@@ -183,7 +184,66 @@ static bool mcux_lpi2c_msg_start(const struct device *dev, uint8_t flags,
 
 static void mcux_lpi2c_complete(const struct device *dev, int status);
 
-static bool mcux_lpi2c_start(const struct device *dev)
+/* Register address write of up to 4 bytes followed by a read of the same device */
+static bool mcux_lpi2c_is_reg_read(struct i2c_rtio *ctx)
+{
+	const struct rtio_sqe *sqe = &ctx->txn_curr->sqe;
+	const struct rtio_iodev_sqe *next = rtio_txn_next(ctx->txn_curr);
+	size_t len;
+
+	if (sqe->op == RTIO_OP_TINY_TX) {
+		len = sqe->tiny_tx.buf_len;
+	} else if (sqe->op == RTIO_OP_TX) {
+		len = sqe->tx.buf_len;
+	} else {
+		return false;
+	}
+
+	if ((len == 0) || (len > sizeof(uint32_t)) ||
+	    (sqe->iodev_flags & (RTIO_IODEV_I2C_STOP | RTIO_IODEV_I2C_10_BITS)) ||
+	    (ctx->txn_curr != ctx->txn_head && !(sqe->iodev_flags & RTIO_IODEV_I2C_RESTART))) {
+		return false;
+	}
+
+	return (next != NULL) && (next->sqe.op == RTIO_OP_RX) && (next->sqe.iodev == sqe->iodev) &&
+	       (next->sqe.rx.buf_len > 0) && (next->sqe.iodev_flags & RTIO_IODEV_I2C_RESTART);
+}
+
+/* Do the register address write and the read as a single transfer, with the register
+ * address sent as subaddress, to save the setup and interrupt of a second transfer.
+ */
+static bool mcux_lpi2c_reg_read_start(const struct device *dev)
+{
+	struct mcux_lpi2c_data *data = dev->data;
+	struct i2c_rtio *ctx = data->ctx;
+	struct rtio_sqe *sqe = &ctx->txn_curr->sqe;
+	struct i2c_dt_spec *dt_spec = sqe->iodev->data;
+	const uint8_t *reg;
+	size_t reg_len;
+	uint32_t subaddress = 0;
+
+	if (sqe->op == RTIO_OP_TINY_TX) {
+		reg = sqe->tiny_tx.buf;
+		reg_len = sqe->tiny_tx.buf_len;
+	} else {
+		reg = sqe->tx.buf;
+		reg_len = sqe->tx.buf_len;
+	}
+
+	/* Subaddress is sent most significant byte first */
+	for (size_t i = 0; i < reg_len; i++) {
+		subaddress = (subaddress << 8) | reg[i];
+	}
+
+	/* The write completes along with the read */
+	ctx->txn_curr = rtio_txn_next(ctx->txn_curr);
+	sqe = &ctx->txn_curr->sqe;
+
+	return mcux_lpi2c_msg_start(dev, I2C_MSG_READ | sqe->iodev_flags, sqe->rx.buf,
+				    sqe->rx.buf_len, dt_spec->addr, subaddress, reg_len);
+}
+
+static bool mcux_lpi2c_start_sqe(const struct device *dev)
 {
 	struct mcux_lpi2c_data *data = dev->data;
 	struct i2c_rtio *ctx = data->ctx;
@@ -192,18 +252,22 @@ static bool mcux_lpi2c_start(const struct device *dev)
 
 	int res = 0;
 
+	if (mcux_lpi2c_is_reg_read(ctx)) {
+		return mcux_lpi2c_reg_read_start(dev);
+	}
+
 	switch (sqe->op) {
 	case RTIO_OP_RX:
 		return mcux_lpi2c_msg_start(dev, I2C_MSG_READ | sqe->iodev_flags,
-					    sqe->rx.buf, sqe->rx.buf_len, dt_spec->addr);
+					    sqe->rx.buf, sqe->rx.buf_len, dt_spec->addr, 0, 0);
 	case RTIO_OP_TINY_TX:
 		return mcux_lpi2c_msg_start(dev, I2C_MSG_WRITE | sqe->iodev_flags,
 					    (uint8_t *)sqe->tiny_tx.buf, sqe->tiny_tx.buf_len,
-					    dt_spec->addr);
+					    dt_spec->addr, 0, 0);
 	case RTIO_OP_TX:
 		return mcux_lpi2c_msg_start(dev, I2C_MSG_WRITE | sqe->iodev_flags,
 					    (uint8_t *)sqe->tx.buf, sqe->tx.buf_len,
-					    dt_spec->addr);
+					    dt_spec->addr, 0, 0);
 	case RTIO_OP_I2C_CONFIGURE:
 		res = mcux_lpi2c_do_configure(dev, sqe->i2c_config);
 		return i2c_rtio_complete(data->ctx, res);
@@ -213,6 +277,15 @@ static bool mcux_lpi2c_start(const struct device *dev)
 	}
 }
 
+static void mcux_lpi2c_start(const struct device *dev)
+{
+	/* Submissions completed without a transfer, such as a configuration, are followed
+	 * by the next one right away so a chain of submissions does not stall.
+	 */
+	while (mcux_lpi2c_start_sqe(dev)) {
+	}
+}
+
 static void mcux_lpi2c_complete(const struct device *dev, status_t status)
 {
 	const struct mcux_lpi2c_config *config = dev->config;
@@ -93,6 +93,41 @@ struct rtio_sqe *i2c_rtio_copy_reg_burst_read(struct rtio *r, struct rtio_iodev
 	return sqe;
 }
 
+struct rtio_sqe *i2c_rtio_copy_reg_burst_reads(struct rtio *r, const struct i2c_rtio_burst *bursts,
+					       size_t num_bursts, void *userdata)
+{
+	__ASSERT(num_bursts > 0, "Expecting at least one burst to copy");
+
+	struct rtio_sqe *sqe = NULL;
+
+	for (size_t i = 0; i < num_bursts; i++) {
+		/* Only the last read of the chain generates a completion */
+		if (sqe != NULL) {
+			sqe->flags |= RTIO_SQE_CHAINED | RTIO_SQE_NO_RESPONSE;
+		}
+
+		sqe = rtio_sqe_acquire(r);
+		if (sqe == NULL) {
+			rtio_sqe_drop_all(r);
+			return NULL;
+		}
+		rtio_sqe_prep_tiny_write(sqe, bursts[i].iodev, RTIO_PRIO_NORM,
+					 &bursts[i].start_addr, 1, userdata);
+		sqe->flags |= RTIO_SQE_TRANSACTION | RTIO_SQE_NO_RESPONSE;
+
+		sqe = rtio_sqe_acquire(r);
+		if (sqe == NULL) {
+			rtio_sqe_drop_all(r);
+			return NULL;
+		}
+		rtio_sqe_prep_read(sqe, bursts[i].iodev, RTIO_PRIO_NORM, bursts[i].buf,
+				   bursts[i].num_bytes, userdata);
+		sqe->iodev_flags |= RTIO_IODEV_I2C_STOP | RTIO_IODEV_I2C_RESTART;
+	}
+
+	return sqe;
+}
+
 void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 {
 	k_sem_init(&ctx->lock, 1, 1);
@@ -141,8 +176,9 @@ static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 
 bool i2c_rtio_complete(struct i2c_rtio *ctx, int status)
 {
-	/* On error bail */
+	/* On error bail, reporting it even for a submission that has no response */
 	if (status < 0) {
+		ctx->txn_head->sqe.flags &= ~RTIO_SQE_NO_RESPONSE;
 		rtio_iodev_sqe_err(ctx->txn_head, status);
 		return i2c_rtio_next(ctx, true);
 	}
@@ -156,6 +192,7 @@ bool i2c_rtio_complete(struct i2c_rtio *ctx, int status)
 	rtio_iodev_sqe_ok(ctx->txn_head, status);
 	return i2c_rtio_next(ctx, true);
 }
+
 bool i2c_rtio_submit(struct i2c_rtio *ctx, struct rtio_iodev_sqe *iodev_sqe)
 {
 	mpsc_push(&ctx->io_q, &iodev_sqe->q);
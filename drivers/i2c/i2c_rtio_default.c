@@ -130,6 +130,8 @@ void i2c_iodev_submit_work_handler(struct rtio_iodev_sqe *txn_first)
 	}
 
 	if (rc != 0) {
+		/* Report the failure even for a submission that has no response */
+		txn_first->sqe.flags &= ~RTIO_SQE_NO_RESPONSE;
 		rtio_iodev_sqe_err(txn_first, rc);
 	} else {
 		rtio_iodev_sqe_ok(txn_first, 0);
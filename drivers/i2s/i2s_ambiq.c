@@ -248,6 +248,11 @@ static int i2s_ambiq_configure(const struct device *dev, enum i2s_dir dir,
 		return -EINVAL;
 	}
 
+	if (i2s_config_in->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	if (i2s_config_in->options & I2S_OPT_LOOPBACK) {
 		data->i2s_hal_cfg.eXfer = AM_HAL_I2S_XFER_RXTX;
 		data->i2s_hal_cfg.eMode = AM_HAL_I2S_IO_MODE_MASTER;
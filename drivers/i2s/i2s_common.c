@@ -7,6 +7,7 @@
 #include <zephyr/kernel.h>
 #include <string.h>
 #include <zephyr/drivers/i2s.h>
+#include <zephyr/sys/dma_memcpy.h>
 
 int z_impl_i2s_buf_read(const struct device *dev, void *buf, size_t *size)
 {
@@ -20,7 +21,7 @@ int z_impl_i2s_buf_read(const struct device *dev, void *buf, size_t *size)
 
 		rx_cfg = i2s_config_get((const struct device *)dev, I2S_DIR_RX);
 
-		memcpy(buf, mem_block, *size);
+		sys_dma_memcpy(buf, mem_block, *size, SYS_DMA_MEMCPY_TIMEOUT_DEFAULT);
 		k_mem_slab_free(rx_cfg->mem_slab, mem_block);
 	}
 
@@ -47,7 +48,7 @@ int z_impl_i2s_buf_write(const struct device *dev, void *buf, size_t size)
 		return -ENOMEM;
 	}
 
-	memcpy(mem_block, (void *)buf, size);
+	sys_dma_memcpy(mem_block, buf, size, SYS_DMA_MEMCPY_TIMEOUT_DEFAULT);
 
 	ret = i2s_write((const struct device *)dev, mem_block, size);
 	if (ret != 0) {
@@ -56,3 +57,146 @@ int z_impl_i2s_buf_write(const struct device *dev, void *buf, size_t size)
 
 	return ret;
 }
+
+int z_impl_i2s_buf_claim(const struct device *dev, enum i2s_dir dir,
+			 void **mem_block, size_t *size)
+{
+	const struct i2s_config *tx_cfg;
+	int ret;
+
+	if (dir == I2S_DIR_RX) {
+		return i2s_read((const struct device *)dev, mem_block, size);
+	}
+
+	if (dir != I2S_DIR_TX) {
+		return -EINVAL;
+	}
+
+	tx_cfg = i2s_config_get((const struct device *)dev, I2S_DIR_TX);
+	if (!tx_cfg || !tx_cfg->mem_slab) {
+		return -EIO;
+	}
+
+	ret = k_mem_slab_alloc(tx_cfg->mem_slab, mem_block,
+			       SYS_TIMEOUT_MS(tx_cfg->timeout));
+	if (ret < 0) {
+		return -ENOMEM;
+	}
+
+	*size = tx_cfg->block_size;
+
+	return 0;
+}
+
+int z_impl_i2s_buf_release(const struct device *dev, enum i2s_dir dir,
+			   void *mem_block, size_t size)
+{
+	const struct i2s_config *cfg;
+	int ret;
+
+	if (dir != I2S_DIR_RX && dir != I2S_DIR_TX) {
+		return -EINVAL;
+	}
+
+	cfg = i2s_config_get((const struct device *)dev, dir);
+	if (!cfg || !cfg->mem_slab) {
+		return -EIO;
+	}
+
+	if (dir == I2S_DIR_RX || size == 0) {
+		k_mem_slab_free(cfg->mem_slab, mem_block);
+		return 0;
+	}
+
+	if (size > cfg->block_size) {
+		k_mem_slab_free(cfg->mem_slab, mem_block);
+		return -EINVAL;
+	}
+
+	ret = i2s_write((const struct device *)dev, mem_block, size);
+	if (ret != 0) {
+		k_mem_slab_free(cfg->mem_slab, mem_block);
+	}
+
+	return ret;
+}
+
+int i2s_trigger_group(const struct i2s_group_member *members, size_t count,
+		      enum i2s_trigger_cmd cmd)
+{
+	const struct i2s_driver_api *api;
+	unsigned int key;
+	size_t armed;
+	int ret = 0;
+
+	if (cmd != I2S_TRIGGER_START) {
+		for (size_t i = 0; i < count; i++) {
+			ret = i2s_trigger(members[i].dev, members[i].dir, cmd);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		return 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		api = members[i].dev->api;
+		if (api->group_arm == NULL || api->group_start == NULL) {
+			return -ENOSYS;
+		}
+	}
+
+	for (armed = 0; armed < count; armed++) {
+		api = members[armed].dev->api;
+		ret = api->group_arm(members[armed].dev, members[armed].dir);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (ret < 0) {
+		while (armed-- > 0) {
+			(void)i2s_trigger(members[armed].dev, members[armed].dir,
+					  I2S_TRIGGER_DROP);
+		}
+
+		return ret;
+	}
+
+	key = irq_lock();
+	for (size_t i = 0; i < count; i++) {
+		int err;
+
+		api = members[i].dev->api;
+		err = api->group_start(members[i].dev, members[i].dir);
+		if (err < 0 && ret == 0) {
+			ret = err;
+		}
+	}
+	irq_unlock(key);
+
+	return ret;
+}
+
+static i2s_xrun_callback_t xrun_cb;
+static void *xrun_user_data;
+
+void i2s_xrun_callback_set(i2s_xrun_callback_t cb, void *user_data)
+{
+	unsigned int key = irq_lock();
+
+	xrun_cb = cb;
+	xrun_user_data = user_data;
+
+	irq_unlock(key);
+}
+
+void i2s_xrun_notify(const struct device *dev, enum i2s_dir dir, bool recovered)
+{
+	i2s_xrun_callback_t cb = xrun_cb;
+
+	if (cb != NULL) {
+		cb(dev, dir, recovered, xrun_user_data);
+	}
+}
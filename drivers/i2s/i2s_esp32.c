@@ -950,6 +950,11 @@ static int i2s_esp32_configure_dir(const struct device *dev, enum i2s_dir dir,
 		return -EINVAL;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	if (i2s_cfg->options & I2S_OPT_PINGPONG) {
 		LOG_ERR("Unsupported option: I2S_OPT_PINGPONG");
 		return -EINVAL;
@@ -113,6 +113,138 @@ static inline int z_vrfy_i2s_buf_write(const struct device *dev,
 }
 #include <zephyr/syscalls/i2s_buf_write_mrsh.c>
 
+/* Blocks lent to user mode threads, which only these threads can release */
+struct i2s_claimed_block {
+	const struct device *dev;
+	const struct k_thread *owner;
+	void *block;
+	enum i2s_dir dir;
+};
+
+static struct i2s_claimed_block i2s_claimed[CONFIG_I2S_USERSPACE_CLAIMED_BLOCKS];
+static struct k_spinlock i2s_claimed_lock;
+
+static int i2s_claimed_add(const struct device *dev, enum i2s_dir dir, void *block)
+{
+	k_spinlock_key_t key = k_spin_lock(&i2s_claimed_lock);
+	int ret = -ENOMEM;
+
+	for (size_t i = 0; i < ARRAY_SIZE(i2s_claimed); i++) {
+		if (i2s_claimed[i].block == NULL) {
+			i2s_claimed[i].dev = dev;
+			i2s_claimed[i].owner = k_current_get();
+			i2s_claimed[i].block = block;
+			i2s_claimed[i].dir = dir;
+			ret = 0;
+			break;
+		}
+	}
+
+	k_spin_unlock(&i2s_claimed_lock, key);
+
+	return ret;
+}
+
+/* Forget a block claimed by the calling thread, false if it has not claimed it */
+static bool i2s_claimed_remove(const struct device *dev, enum i2s_dir dir, void *block)
+{
+	k_spinlock_key_t key = k_spin_lock(&i2s_claimed_lock);
+	bool found = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(i2s_claimed); i++) {
+		if (i2s_claimed[i].block == block && i2s_claimed[i].dev == dev &&
+		    i2s_claimed[i].dir == dir && i2s_claimed[i].owner == k_current_get()) {
+			i2s_claimed[i].block = NULL;
+			found = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&i2s_claimed_lock, key);
+
+	return found;
+}
+
+static inline int z_vrfy_i2s_buf_claim(const struct device *dev,
+				       enum i2s_dir dir,
+				       void **mem_block, size_t *size)
+{
+	const struct i2s_config *cfg;
+	void *block;
+	size_t data_size;
+	int ret;
+
+	if (dir == I2S_DIR_RX) {
+		K_OOPS(K_SYSCALL_DRIVER_I2S(dev, read));
+	} else if (dir == I2S_DIR_TX) {
+		K_OOPS(K_SYSCALL_DRIVER_I2S(dev, write));
+	} else {
+		return -EINVAL;
+	}
+
+	ret = z_impl_i2s_buf_claim((const struct device *)dev, dir, &block,
+				   &data_size);
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* Presumed to be configured otherwise the claim would have failed. */
+	cfg = i2s_config_get((const struct device *)dev, dir);
+
+	/* The block is only lent to threads which can access it directly */
+	if (K_SYSCALL_MEMORY_WRITE(block, cfg->mem_slab->info.block_size)) {
+		k_mem_slab_free(cfg->mem_slab, block);
+		return -EPERM;
+	}
+
+	if (i2s_claimed_add(dev, dir, block) != 0) {
+		k_mem_slab_free(cfg->mem_slab, block);
+		return -ENOMEM;
+	}
+
+	if (k_usermode_to_copy((void *)mem_block, &block, sizeof(block)) ||
+	    k_usermode_to_copy((void *)size, &data_size, sizeof(data_size))) {
+		(void)i2s_claimed_remove(dev, dir, block);
+		k_mem_slab_free(cfg->mem_slab, block);
+		K_OOPS(-EFAULT);
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/i2s_buf_claim_mrsh.c>
+
+static inline int z_vrfy_i2s_buf_release(const struct device *dev,
+					 enum i2s_dir dir,
+					 void *mem_block, size_t size)
+{
+	const struct i2s_config *cfg;
+
+	if (dir == I2S_DIR_RX) {
+		K_OOPS(K_SYSCALL_DRIVER_I2S(dev, read));
+	} else if (dir == I2S_DIR_TX) {
+		K_OOPS(K_SYSCALL_DRIVER_I2S(dev, write));
+	} else {
+		return -EINVAL;
+	}
+
+	cfg = i2s_config_get((const struct device *)dev, dir);
+	if (!cfg || !cfg->mem_slab) {
+		return -EIO;
+	}
+
+	/*
+	 * Never let user mode hand arbitrary pointers to the slab allocator,
+	 * nor blocks it does not hold, such as blocks queued to the driver.
+	 */
+	if (!i2s_claimed_remove(dev, dir, mem_block)) {
+		return -EINVAL;
+	}
+
+	return z_impl_i2s_buf_release((const struct device *)dev, dir,
+				      mem_block, size);
+}
+#include <zephyr/syscalls/i2s_buf_release_mrsh.c>
+
 static inline int z_vrfy_i2s_trigger(const struct device *dev,
 				     enum i2s_dir dir,
 				     enum i2s_trigger_cmd cmd)
@@ -122,3 +254,41 @@ static inline int z_vrfy_i2s_trigger(const struct device *dev,
 	return z_impl_i2s_trigger((const struct device *)dev, dir, cmd);
 }
 #include <zephyr/syscalls/i2s_trigger_mrsh.c>
+
+static inline int z_vrfy_i2s_get_position(const struct device *dev,
+					  enum i2s_dir dir,
+					  struct i2s_position *pos)
+{
+	struct i2s_position position;
+	int ret;
+
+	K_OOPS(K_SYSCALL_OBJ(dev, K_OBJ_DRIVER_I2S));
+
+	ret = z_impl_i2s_get_position((const struct device *)dev, dir,
+				      &position);
+	if (ret == 0) {
+		K_OOPS(k_usermode_to_copy((void *)pos, &position,
+					  sizeof(position)));
+	}
+
+	return ret;
+}
+#include <zephyr/syscalls/i2s_get_position_mrsh.c>
+
+static inline int z_vrfy_i2s_get_stats(const struct device *dev,
+				       enum i2s_dir dir,
+				       struct i2s_stats *stats)
+{
+	struct i2s_stats copy;
+	int ret;
+
+	K_OOPS(K_SYSCALL_OBJ(dev, K_OBJ_DRIVER_I2S));
+
+	ret = z_impl_i2s_get_stats((const struct device *)dev, dir, &copy);
+	if (ret == 0) {
+		K_OOPS(k_usermode_to_copy((void *)stats, &copy, sizeof(copy)));
+	}
+
+	return ret;
+}
+#include <zephyr/syscalls/i2s_get_stats_mrsh.c>
@@ -348,6 +348,11 @@ static int i2s_litex_configure(const struct device *dev, enum i2s_dir dir,
 		return -EINVAL;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	if (i2s_cfg->options & I2S_OPT_BIT_CLK_GATED) {
 		LOG_ERR("invalid operating mode");
 		return -EINVAL;
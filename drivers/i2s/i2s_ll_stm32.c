@@ -200,6 +200,11 @@ static int i2s_stm32_configure(const struct device *dev, enum i2s_dir dir,
 		return 0;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	memcpy(&stream->cfg, i2s_cfg, sizeof(struct i2s_config));
 
 	/* conditions to enable master clock output */
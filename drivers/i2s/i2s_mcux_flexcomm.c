@@ -94,6 +94,11 @@ static int i2s_mcux_flexcomm_cfg_convert(uint32_t base_frequency,
 		return -EINVAL;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	/* Set master/slave configuration */
 	switch (i2s_cfg->options & (I2S_OPT_BIT_CLK_SLAVE |
 				    I2S_OPT_FRAME_CLK_SLAVE)) {
@@ -32,7 +32,7 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(dev_i2s_mcux, CONFIG_I2S_LOG_LEVEL);
 
-#define NUM_DMA_BLOCKS_RX_PREP 3
+#define NUM_DMA_BLOCKS_RX_PREP CONFIG_I2S_MCUX_SAI_RX_DMA_BLOCKS
 #if defined(CONFIG_DMA_MCUX_EDMA)
 BUILD_ASSERT(NUM_DMA_BLOCKS_RX_PREP >= 3,
 	     "eDMA avoids TCD coherency issue if NUM_DMA_BLOCKS_RX_PREP >= 3");
@@ -42,6 +42,15 @@ BUILD_ASSERT(NUM_DMA_BLOCKS_RX_PREP >= 3,
 BUILD_ASSERT(MAX_TX_DMA_BLOCKS > NUM_DMA_BLOCKS_RX_PREP,
 	     "NUM_DMA_BLOCKS_RX_PREP must be < CONFIG_DMA_TCD_QUEUE_SIZE");
 
+#if defined(CONFIG_I2S_MCUX_SAI_DMA_IRQ_COALESCE)
+#define I2S_TX_DMA_CALLBACK_PER_BLOCK 0
+/* RX keeps NUM_DMA_BLOCKS_RX_PREP blocks loaded, which must be more than half of the ring */
+#define I2S_RX_DMA_CALLBACK_PER_BLOCK (NUM_DMA_BLOCKS_RX_PREP <= CONFIG_DMA_TCD_QUEUE_SIZE / 2)
+#else
+#define I2S_TX_DMA_CALLBACK_PER_BLOCK 1
+#define I2S_RX_DMA_CALLBACK_PER_BLOCK 1
+#endif
+
 #define SAI_WORD_SIZE_BITS_MIN 8
 #define SAI_WORD_SIZE_BITS_MAX 32
 
@@ -54,6 +63,19 @@ BUILD_ASSERT(MAX_TX_DMA_BLOCKS > NUM_DMA_BLOCKS_RX_PREP,
  * Transfer Control Descriptors (TCDs) in list, and manages the tcdpool.
  * Calling dma_reload() adds new DMA block to DMA channel already configured,
  * into the DMA driver's circular list of blocks.
+ *
+ * When a stream is started, all blocks available at that time are handed to
+ * the DMA driver in a single dma_config() call as a chain of dma_block_config
+ * descriptors, rather than configuring the first block and reloading the
+ * remaining ones one at a time. Blocks queued while the stream runs (TX
+ * writes, RX buffers replacing completed ones) are added to the ring with one
+ * dma_reload() call each.
+ *
+ * With CONFIG_I2S_MCUX_SAI_DMA_IRQ_COALESCE, per block callbacks are disabled
+ * and the eDMA raises its interrupt only at the end of each half of its TCD
+ * ring, and at the last block loaded. The callback then runs for every block completed since the previous
+ * interrupt from that single interrupt, and the blocks reloaded there refill
+ * the half of the ring just transferred while the other half plays.
 
  * This indicates the Tx/Rx stream.
  *
@@ -77,9 +99,12 @@ struct stream {
 	void (*irq_call_back)(void);
 	struct i2s_config cfg;
 	struct dma_config dma_cfg;
-	struct dma_block_config dma_block;
+	struct dma_block_config dma_block[MAX_TX_DMA_BLOCKS];
 	uint8_t free_tx_dma_blocks;
 	bool last_block;
+	/* frames of the DMA blocks completed since the stream was started */
+	uint64_t frames;
+	struct i2s_stats stats;
 	struct k_msgq in_queue;
 	struct k_msgq out_queue;
 };
@@ -118,6 +143,23 @@ struct i2s_dev_data {
 	void *rx_out_msgs[CONFIG_I2S_RX_BLOCK_COUNT];
 };
 
+static uint32_t i2s_stream_frame_bytes(const struct stream *strm)
+{
+	return strm->cfg.channels * (strm->cfg.word_size / 8U);
+}
+
+static bool i2s_stream_xrun_recovery(const struct stream *strm)
+{
+	return (strm->cfg.options & (I2S_OPT_XRUN_SILENCE | I2S_OPT_XRUN_REPEAT)) != 0;
+}
+
+static void i2s_stream_slack_update(struct stream *strm, uint32_t blocks)
+{
+	uint32_t slack = blocks * (strm->cfg.block_size / i2s_stream_frame_bytes(strm));
+
+	strm->stats.min_slack_frames = MIN(strm->stats.min_slack_frames, slack);
+}
+
 static void i2s_purge_stream_buffers(struct stream *strm, struct k_mem_slab *mem_slab, bool in_drop,
 				     bool out_drop)
 {
@@ -264,9 +306,38 @@ static void i2s_dma_tx_callback(const struct device *dma_dev, void *arg, uint32_
 
 	ret = k_msgq_get(&strm->out_queue, &buffer, K_NO_WAIT);
 	if (ret == 0) {
-		/* transmission complete. free the buffer */
-		k_mem_slab_free(strm->cfg.mem_slab, buffer);
 		(strm->free_tx_dma_blocks)++;
+		strm->frames += strm->cfg.block_size / i2s_stream_frame_bytes(strm);
+
+		if (strm->state == I2S_STATE_RUNNING && !strm->last_block &&
+		    strm->free_tx_dma_blocks == MAX_TX_DMA_BLOCKS &&
+		    k_msgq_num_used_get(&strm->in_queue) == 0) {
+			/* Underrun, this was the last block queued */
+			strm->stats.xruns++;
+			strm->stats.min_slack_frames = 0;
+
+			if (i2s_stream_xrun_recovery(strm)) {
+				/* Send the block again, or silence, and carry on */
+				if (!(strm->cfg.options & I2S_OPT_XRUN_REPEAT)) {
+					memset(buffer, 0, strm->cfg.block_size);
+				}
+
+				(void)k_msgq_put(&strm->in_queue, &buffer, K_NO_WAIT);
+				buffer = NULL;
+				strm->stats.xruns_recovered++;
+			}
+
+			i2s_xrun_notify(dev, I2S_DIR_TX, buffer == NULL);
+		} else {
+			i2s_stream_slack_update(strm, k_msgq_num_used_get(&strm->in_queue) +
+							      MAX_TX_DMA_BLOCKS -
+							      strm->free_tx_dma_blocks);
+		}
+
+		/* transmission complete. free the buffer */
+		if (buffer != NULL) {
+			k_mem_slab_free(strm->cfg.mem_slab, buffer);
+		}
 	} else {
 		LOG_ERR("no buf in out_queue for channel %u", channel);
 	}
@@ -371,6 +442,8 @@ static void i2s_dma_rx_callback(const struct device *dma_dev, void *arg, uint32_
 		goto error;
 	}
 
+	strm->frames += strm->cfg.block_size / i2s_stream_frame_bytes(strm);
+
 	if (strm->state == I2S_STATE_STOPPING) {
 		i2s_rx_stream_disable(dev, true, false);
 		/* Received a STOP/DRAIN trigger */
@@ -380,11 +453,24 @@ static void i2s_dma_rx_callback(const struct device *dma_dev, void *arg, uint32_
 
 	/* Now the only possible case is the running state */
 
+	i2s_stream_slack_update(strm, k_mem_slab_num_free_get(strm->cfg.mem_slab));
+
 	/* allocate new buffer for next audio frame */
 	ret = k_mem_slab_alloc(strm->cfg.mem_slab, &buffer, K_NO_WAIT);
 	if (ret != 0) {
-		LOG_ERR("buffer alloc from slab %p err %d", strm->cfg.mem_slab, ret);
-		goto error;
+		/* Overrun, drop the oldest block not read yet and reuse it */
+		strm->stats.xruns++;
+		if (i2s_stream_xrun_recovery(strm)) {
+			ret = k_msgq_get(&strm->out_queue, &buffer, K_NO_WAIT);
+		}
+
+		i2s_xrun_notify(dev, I2S_DIR_RX, ret == 0);
+		if (ret != 0) {
+			LOG_ERR("buffer alloc from slab %p err %d", strm->cfg.mem_slab, ret);
+			goto error;
+		}
+
+		strm->stats.xruns_recovered++;
 	}
 
 	uint32_t data_path = strm->start_channel;
@@ -490,6 +576,18 @@ static int i2s_mcux_config(const struct device *dev, enum i2s_dir dir,
 		goto invalid_config;
 	}
 
+	if ((i2s_cfg->options & I2S_OPT_PLANAR) == I2S_OPT_PLANAR) {
+		/* Each DMA request moves a whole frame out of the FIFO and spreads
+		 * its words over the channel planes, so a frame must fit the FIFO.
+		 */
+		if (dir != I2S_DIR_RX || num_words > FSL_FEATURE_SAI_FIFO_COUNTn(base) ||
+		    (i2s_cfg->block_size % (num_words * word_size_bytes)) != 0U) {
+			LOG_ERR("Planar mode not supported");
+			ret = -ENOTSUP;
+			goto invalid_config;
+		}
+	}
+
 	memset(&config, 0, sizeof(config));
 
 	enable_mclk_direction(dev, dev_cfg->mclk_output);
@@ -607,6 +705,8 @@ static int i2s_mcux_config(const struct device *dev, enum i2s_dir dir,
 
 	if (dir == I2S_DIR_TX) {
 		memcpy(&dev_data->tx.cfg, i2s_cfg, sizeof(struct i2s_config));
+		memset(&dev_data->tx.stats, 0, sizeof(dev_data->tx.stats));
+		dev_data->tx.stats.min_slack_frames = UINT32_MAX;
 		LOG_DBG("tx slab free_list = 0x%x", (uint32_t)i2s_cfg->mem_slab->free_list);
 		LOG_DBG("tx slab num_blocks = %d", (uint32_t)i2s_cfg->mem_slab->info.num_blocks);
 		LOG_DBG("tx slab block_size = %d", (uint32_t)i2s_cfg->mem_slab->info.block_size);
@@ -629,10 +729,17 @@ static int i2s_mcux_config(const struct device *dev, enum i2s_dir dir,
 		dev_data->tx.dma_cfg.user_data = (void *)dev;
 		dev_data->tx.state = I2S_STATE_READY;
 	} else {
-		/* For RX, DMA reads from FIFO whenever data present */
-		config.fifo.fifoWatermark = 0;
+		if ((i2s_cfg->options & I2S_OPT_PLANAR) == I2S_OPT_PLANAR) {
+			/* For planar RX, DMA reads from FIFO once a full frame is present */
+			config.fifo.fifoWatermark = num_words - 1U;
+		} else {
+			/* For RX, DMA reads from FIFO whenever data present */
+			config.fifo.fifoWatermark = 0;
+		}
 
 		memcpy(&dev_data->rx.cfg, i2s_cfg, sizeof(struct i2s_config));
+		memset(&dev_data->rx.stats, 0, sizeof(dev_data->rx.stats));
+		dev_data->rx.stats.min_slack_frames = UINT32_MAX;
 		LOG_DBG("rx slab free_list = 0x%x", (uint32_t)i2s_cfg->mem_slab->free_list);
 		LOG_DBG("rx slab num_blocks = %d", (uint32_t)i2s_cfg->mem_slab->info.num_blocks);
 		LOG_DBG("rx slab block_size = %d", (uint32_t)i2s_cfg->mem_slab->info.block_size);
@@ -647,8 +754,13 @@ static int i2s_mcux_config(const struct device *dev, enum i2s_dir dir,
 		/*set up dma settings*/
 		dev_data->rx.dma_cfg.source_data_size = word_size_bytes;
 		dev_data->rx.dma_cfg.dest_data_size = word_size_bytes;
-		dev_data->rx.dma_cfg.source_burst_length = word_size_bytes;
-		dev_data->rx.dma_cfg.dest_burst_length = word_size_bytes;
+		if ((i2s_cfg->options & I2S_OPT_PLANAR) == I2S_OPT_PLANAR) {
+			dev_data->rx.dma_cfg.source_burst_length = word_size_bytes * num_words;
+			dev_data->rx.dma_cfg.dest_burst_length = word_size_bytes * num_words;
+		} else {
+			dev_data->rx.dma_cfg.source_burst_length = word_size_bytes;
+			dev_data->rx.dma_cfg.dest_burst_length = word_size_bytes;
+		}
 		dev_data->rx.dma_cfg.user_data = (void *)dev;
 		dev_data->rx.state = I2S_STATE_READY;
 	}
@@ -675,7 +787,7 @@ const struct i2s_config *i2s_mcux_config_get(const struct device *dev, enum i2s_
 	return &dev_data->tx.cfg;
 }
 
-static int i2s_tx_stream_start(const struct device *dev)
+static int i2s_tx_stream_start(const struct device *dev, bool enable)
 {
 	int ret = 0;
 	void *buffer;
@@ -684,51 +796,54 @@ static int i2s_tx_stream_start(const struct device *dev)
 	const struct device *dev_dma = dev_data->dev_dma;
 	const struct i2s_mcux_config *dev_cfg = dev->config;
 	I2S_Type *base = (I2S_Type *)dev_cfg->base;
-
-	/* retrieve buffer from input queue */
-	ret = k_msgq_get(&strm->in_queue, &buffer, K_NO_WAIT);
-	if (ret != 0) {
-		LOG_ERR("No buffer in input queue to start");
-		return -EIO;
-	}
+	uint32_t data_path = strm->start_channel;
+	uint32_t num_blocks = 0;
 
 	LOG_DBG("tx stream start");
 
 	/* Driver keeps track of how many DMA blocks can be loaded to the DMA */
 	strm->free_tx_dma_blocks = MAX_TX_DMA_BLOCKS;
+	strm->frames = 0;
 
-	/* Configure the DMA with the first TX block */
-	struct dma_block_config *blk_cfg = &strm->dma_block;
-
-	memset(blk_cfg, 0, sizeof(struct dma_block_config));
+	/* Chain every queued TX block, up to the DMA descriptor limit */
+	while (num_blocks < MAX_TX_DMA_BLOCKS &&
+	       k_msgq_get(&strm->in_queue, &buffer, K_NO_WAIT) == 0) {
+		struct dma_block_config *blk_cfg = &strm->dma_block[num_blocks];
 
-	uint32_t data_path = strm->start_channel;
+		memset(blk_cfg, 0, sizeof(struct dma_block_config));
 
-	blk_cfg->dest_address = (uint32_t)&base->TDR[data_path];
-	blk_cfg->source_address = (uint32_t)buffer;
-	blk_cfg->block_size = strm->cfg.block_size;
-	blk_cfg->dest_scatter_en = 1;
+		blk_cfg->dest_address = (uint32_t)&base->TDR[data_path];
+		blk_cfg->source_address = (uint32_t)buffer;
+		blk_cfg->block_size = strm->cfg.block_size;
+		blk_cfg->dest_scatter_en = 1;
 
-	strm->dma_cfg.block_count = 1;
+		if (num_blocks > 0) {
+			strm->dma_block[num_blocks - 1].next_block = blk_cfg;
+		}
 
-	strm->dma_cfg.head_block = &strm->dma_block;
-	strm->dma_cfg.user_data = (void *)dev;
+		/* put buffer in output queue */
+		ret = k_msgq_put(&strm->out_queue, &buffer, K_NO_WAIT);
+		if (ret != 0) {
+			LOG_ERR("failed to put buffer in output queue");
+			return ret;
+		}
 
-	(strm->free_tx_dma_blocks)--;
-	dma_config(dev_dma, strm->dma_channel, &strm->dma_cfg);
+		num_blocks++;
+	}
 
-	/* put buffer in output queue */
-	ret = k_msgq_put(&strm->out_queue, &buffer, K_NO_WAIT);
-	if (ret != 0) {
-		LOG_ERR("failed to put buffer in output queue");
-		return ret;
+	if (num_blocks == 0) {
+		LOG_ERR("No buffer in input queue to start");
+		return -EIO;
 	}
 
-	uint8_t blocks_queued;
+	strm->dma_cfg.block_count = num_blocks;
+	strm->dma_cfg.head_block = &strm->dma_block[0];
+	strm->dma_cfg.user_data = (void *)dev;
 
-	ret = i2s_tx_reload_multiple_dma_blocks(dev, &blocks_queued);
-	if (ret) {
-		LOG_ERR("i2s_tx_reload_multiple_dma_blocks() failed (%d)", ret);
+	strm->free_tx_dma_blocks -= num_blocks;
+	ret = dma_config(dev_dma, strm->dma_channel, &strm->dma_cfg);
+	if (ret < 0) {
+		LOG_ERR("dma_config failed (%d)", ret);
 		return ret;
 	}
 
@@ -745,12 +860,14 @@ static int i2s_tx_stream_start(const struct device *dev)
 	base->TCR3 |= I2S_TCR3_TCE(1UL << strm->start_channel);
 
 	/* Enable SAI Tx clock */
-	SAI_TxEnable(base, true);
+	if (enable) {
+		SAI_TxEnable(base, true);
+	}
 
 	return 0;
 }
 
-static int i2s_rx_stream_start(const struct device *dev)
+static int i2s_rx_stream_start(const struct device *dev, bool enable)
 {
 	int ret = 0;
 	void *buffer;
@@ -771,41 +888,13 @@ static int i2s_rx_stream_start(const struct device *dev)
 		return -EINVAL;
 	}
 
-	/* allocate 1st receive buffer from SLAB */
-	ret = k_mem_slab_alloc(strm->cfg.mem_slab, &buffer, K_NO_WAIT);
-	if (ret != 0) {
-		LOG_DBG("buffer alloc from mem_slab failed (%d)", ret);
-		return ret;
-	}
-
-	/* Configure DMA block */
-	struct dma_block_config *blk_cfg = &strm->dma_block;
-
-	memset(blk_cfg, 0, sizeof(struct dma_block_config));
+	strm->frames = 0;
 
 	uint32_t data_path = strm->start_channel;
 
-	blk_cfg->dest_address = (uint32_t)buffer;
-	blk_cfg->source_address = (uint32_t)&base->RDR[data_path];
-	blk_cfg->block_size = strm->cfg.block_size;
-
-	blk_cfg->source_gather_en = 1;
-
-	strm->dma_cfg.block_count = 1;
-	strm->dma_cfg.head_block = &strm->dma_block;
-	strm->dma_cfg.user_data = (void *)dev;
-
-	dma_config(dev_dma, strm->dma_channel, &strm->dma_cfg);
-
-	/* put buffer in input queue */
-	ret = k_msgq_put(&strm->in_queue, &buffer, K_NO_WAIT);
-	if (ret != 0) {
-		LOG_ERR("failed to put buffer in input queue, ret1 %d", ret);
-		return ret;
-	}
-
-	/* prep DMA for each of remaining (NUM_DMA_BLOCKS_RX_PREP-1) buffers */
-	for (int i = 0; i < NUM_DMA_BLOCKS_RX_PREP - 1; i++) {
+	/* Chain NUM_DMA_BLOCKS_RX_PREP receive buffers in one DMA configuration */
+	for (int i = 0; i < NUM_DMA_BLOCKS_RX_PREP; i++) {
+		struct dma_block_config *blk_cfg = &strm->dma_block[i];
 
 		/* allocate receive buffer from SLAB */
 		ret = k_mem_slab_alloc(strm->cfg.mem_slab, &buffer, K_NO_WAIT);
@@ -814,21 +903,42 @@ static int i2s_rx_stream_start(const struct device *dev)
 			return ret;
 		}
 
-		ret = dma_reload(dev_dma, strm->dma_channel, (uint32_t)&base->RDR[data_path],
-				 (uint32_t)buffer, blk_cfg->block_size);
-		if (ret != 0) {
-			LOG_ERR("dma_reload() failed with error 0x%x", ret);
-			return ret;
+		memset(blk_cfg, 0, sizeof(struct dma_block_config));
+
+		blk_cfg->dest_address = (uint32_t)buffer;
+		blk_cfg->source_address = (uint32_t)&base->RDR[data_path];
+		blk_cfg->block_size = strm->cfg.block_size;
+		blk_cfg->source_gather_en = 1;
+
+		if ((strm->cfg.options & I2S_OPT_PLANAR) == I2S_OPT_PLANAR) {
+			/* One plane of block_size / channels bytes per channel */
+			blk_cfg->dest_scatter_count = strm->cfg.channels;
+			blk_cfg->dest_scatter_interval =
+				strm->cfg.block_size / strm->cfg.channels;
+		}
+
+		if (i > 0) {
+			strm->dma_block[i - 1].next_block = blk_cfg;
 		}
 
 		/* put buffer in input queue */
 		ret = k_msgq_put(&strm->in_queue, &buffer, K_NO_WAIT);
 		if (ret != 0) {
-			LOG_ERR("failed to put buffer in input queue, ret2 %d", ret);
+			LOG_ERR("failed to put buffer in input queue (%d)", ret);
 			return ret;
 		}
 	}
 
+	strm->dma_cfg.block_count = NUM_DMA_BLOCKS_RX_PREP;
+	strm->dma_cfg.head_block = &strm->dma_block[0];
+	strm->dma_cfg.user_data = (void *)dev;
+
+	ret = dma_config(dev_dma, strm->dma_channel, &strm->dma_cfg);
+	if (ret < 0) {
+		LOG_ERR("dma_config failed (%d)", ret);
+		return ret;
+	}
+
 	LOG_DBG("Starting DMA Ch%u", strm->dma_channel);
 	ret = dma_start(dev_dma, strm->dma_channel);
 	if (ret < 0) {
@@ -843,7 +953,38 @@ static int i2s_rx_stream_start(const struct device *dev)
 	base->RCR3 |= I2S_RCR3_RCE(1UL << strm->start_channel);
 
 	/* Enable SAI Rx clock */
-	SAI_RxEnable(base, true);
+	if (enable) {
+		SAI_RxEnable(base, true);
+	}
+
+	return 0;
+}
+
+/* Called with interrupts locked */
+static int i2s_mcux_stream_start(const struct device *dev, enum i2s_dir dir, bool enable)
+{
+	struct i2s_dev_data *dev_data = dev->data;
+	struct stream *strm = (dir == I2S_DIR_TX) ? &dev_data->tx : &dev_data->rx;
+	int ret;
+
+	if (strm->state != I2S_STATE_READY) {
+		LOG_ERR("START trigger: invalid state %u", strm->state);
+		return -EIO;
+	}
+
+	if (dir == I2S_DIR_TX) {
+		ret = i2s_tx_stream_start(dev, enable);
+	} else {
+		ret = i2s_rx_stream_start(dev, enable);
+	}
+
+	if (ret < 0) {
+		LOG_DBG("START trigger failed %d", ret);
+		return -EIO;
+	}
+
+	strm->state = I2S_STATE_RUNNING;
+	strm->last_block = false;
 
 	return 0;
 }
@@ -864,26 +1005,7 @@ static int i2s_mcux_trigger(const struct device *dev, enum i2s_dir dir, enum i2s
 	key = irq_lock();
 	switch (cmd) {
 	case I2S_TRIGGER_START:
-		if (strm->state != I2S_STATE_READY) {
-			LOG_ERR("START trigger: invalid state %u", strm->state);
-			ret = -EIO;
-			break;
-		}
-
-		if (dir == I2S_DIR_TX) {
-			ret = i2s_tx_stream_start(dev);
-		} else {
-			ret = i2s_rx_stream_start(dev);
-		}
-
-		if (ret < 0) {
-			LOG_DBG("START trigger failed %d", ret);
-			ret = -EIO;
-			break;
-		}
-
-		strm->state = I2S_STATE_RUNNING;
-		strm->last_block = false;
+		ret = i2s_mcux_stream_start(dev, dir, true);
 		break;
 
 	case I2S_TRIGGER_DROP:
@@ -1012,6 +1134,113 @@ static int i2s_mcux_write(const struct device *dev, void *mem_block, size_t size
 	return ret;
 }
 
+static int i2s_mcux_group_arm(const struct device *dev, enum i2s_dir dir)
+{
+	struct i2s_dev_data *dev_data = dev->data;
+	struct stream *strm;
+	unsigned int key;
+	bool clk_slave;
+	int ret;
+
+	if (dir == I2S_DIR_BOTH) {
+		return -ENOSYS;
+	}
+
+	strm = (dir == I2S_DIR_TX) ? &dev_data->tx : &dev_data->rx;
+
+	/* A stream clocked by another device is enabled right away so that it
+	 * starts on the first frame of its clock master.
+	 */
+	clk_slave = (strm->cfg.options & (I2S_OPT_FRAME_CLK_SLAVE | I2S_OPT_BIT_CLK_SLAVE)) != 0;
+
+	key = irq_lock();
+	ret = i2s_mcux_stream_start(dev, dir, clk_slave);
+	irq_unlock(key);
+
+	return ret;
+}
+
+static int i2s_mcux_group_start(const struct device *dev, enum i2s_dir dir)
+{
+	const struct i2s_mcux_config *dev_cfg = dev->config;
+	I2S_Type *base = (I2S_Type *)dev_cfg->base;
+
+	if (dir == I2S_DIR_TX) {
+		SAI_TxEnable(base, true);
+	} else {
+		SAI_RxEnable(base, true);
+	}
+
+	return 0;
+}
+
+static int i2s_mcux_get_stats(const struct device *dev, enum i2s_dir dir,
+			      struct i2s_stats *stats)
+{
+	struct i2s_dev_data *dev_data = dev->data;
+	struct stream *strm;
+	unsigned int key;
+
+	if (dir == I2S_DIR_BOTH) {
+		return -EINVAL;
+	}
+
+	strm = (dir == I2S_DIR_TX) ? &dev_data->tx : &dev_data->rx;
+
+	key = irq_lock();
+	*stats = strm->stats;
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int i2s_mcux_get_position(const struct device *dev, enum i2s_dir dir,
+				 struct i2s_position *pos)
+{
+	struct i2s_dev_data *dev_data = dev->data;
+	struct dma_status status = {0};
+	struct stream *strm;
+	unsigned int key;
+	uint32_t in_flight;
+	uint32_t done;
+
+	if (dir == I2S_DIR_BOTH) {
+		return -EINVAL;
+	}
+
+	strm = (dir == I2S_DIR_TX) ? &dev_data->tx : &dev_data->rx;
+
+	if (strm->state == I2S_STATE_NOT_READY) {
+		return -EIO;
+	}
+
+	key = irq_lock();
+
+	pos->frames = strm->frames;
+	pos->cycles = k_cycle_get_32();
+
+	/* Add the progress of the DMA within the block in flight */
+	if ((strm->state == I2S_STATE_RUNNING || strm->state == I2S_STATE_STOPPING) &&
+	    dma_get_status(dev_data->dev_dma, strm->dma_channel, &status) == 0 &&
+	    status.busy && status.pending_length <= strm->cfg.block_size) {
+		done = strm->cfg.block_size - status.pending_length;
+		pos->frames += done / i2s_stream_frame_bytes(strm);
+
+		/* Blocks completed whose coalesced interrupt has not come yet */
+		in_flight = (dir == I2S_DIR_TX) ?
+			    MAX_TX_DMA_BLOCKS - strm->free_tx_dma_blocks :
+			    k_msgq_num_used_get(&strm->in_queue);
+		if (status.free > CONFIG_DMA_TCD_QUEUE_SIZE - in_flight) {
+			done = status.free - (CONFIG_DMA_TCD_QUEUE_SIZE - in_flight);
+			pos->frames += done * (strm->cfg.block_size / i2s_stream_frame_bytes(strm));
+		}
+	}
+
+	irq_unlock(key);
+
+	return 0;
+}
+
 static void sai_driver_irq(const struct device *dev)
 {
 	const struct i2s_mcux_config *dev_cfg = dev->config;
@@ -1170,6 +1399,10 @@ static DEVICE_API(i2s, i2s_mcux_driver_api) = {
 	.write = i2s_mcux_write,
 	.config_get = i2s_mcux_config_get,
 	.trigger = i2s_mcux_trigger,
+	.get_position = i2s_mcux_get_position,
+	.group_arm = i2s_mcux_group_arm,
+	.group_start = i2s_mcux_group_start,
+	.get_stats = i2s_mcux_get_stats,
 };
 
 #define I2S_MCUX_INIT(i2s_id)                                                                      \
@@ -1213,10 +1446,11 @@ static DEVICE_API(i2s, i2s_mcux_driver_api) = {
 						.source_burst_length = CONFIG_I2S_EDMA_BURST_SIZE, \
 						.dest_burst_length = CONFIG_I2S_EDMA_BURST_SIZE,   \
 						.dma_callback = i2s_dma_tx_callback,               \
-						.complete_callback_en = 1,                         \
+						.complete_callback_en =                            \
+							I2S_TX_DMA_CALLBACK_PER_BLOCK,             \
 						.error_callback_dis = 1,                           \
 						.block_count = 1,                                  \
-						.head_block = &i2s_##i2s_id##_data.tx.dma_block,   \
+						.head_block = &i2s_##i2s_id##_data.tx.dma_block[0],\
 						.channel_direction = MEMORY_TO_PERIPHERAL,         \
 						.dma_slot = DT_INST_DMAS_CELL_BY_NAME(i2s_id, tx,  \
 										      source),     \
@@ -1231,10 +1465,11 @@ static DEVICE_API(i2s, i2s_mcux_driver_api) = {
 						.source_burst_length = CONFIG_I2S_EDMA_BURST_SIZE, \
 						.dest_burst_length = CONFIG_I2S_EDMA_BURST_SIZE,   \
 						.dma_callback = i2s_dma_rx_callback,               \
-						.complete_callback_en = 1,                         \
+						.complete_callback_en =                            \
+							I2S_RX_DMA_CALLBACK_PER_BLOCK,             \
 						.error_callback_dis = 1,                           \
 						.block_count = 1,                                  \
-						.head_block = &i2s_##i2s_id##_data.rx.dma_block,   \
+						.head_block = &i2s_##i2s_id##_data.rx.dma_block[0],\
 						.channel_direction = PERIPHERAL_TO_MEMORY,         \
 						.dma_slot = DT_INST_DMAS_CELL_BY_NAME(i2s_id, rx,  \
 										      source),     \
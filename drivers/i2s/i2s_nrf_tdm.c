@@ -118,6 +118,9 @@ struct tdm_drv_data {
 	bool stop;       /* stop after the current (TX or RX) block */
 	bool discard_rx; /* discard further RX blocks */
 	volatile bool next_tx_buffer_needed;
+	uint64_t frames;         /* frames of the blocks completed since start */
+	uint32_t frames_cycles;  /* cycle counter when the last block completed */
+	uint32_t frame_bytes;
 	bool tx_configured: 1;
 	bool rx_configured: 1;
 	bool request_clock: 1;
@@ -585,6 +588,11 @@ static int tdm_nrf_configure(const struct device *dev, enum i2s_dir dir,
 		LOG_ERR("Unsupported options: 0x%02x", tdm_cfg->options);
 		return -EINVAL;
 	}
+	if (tdm_cfg->options & I2S_OPT_PLANAR) {
+		/* EasyDMA only transfers contiguous buffers */
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
 	if (dir == I2S_DIR_TX || dir == I2S_DIR_BOTH) {
 		nrfx_cfg.channels = FIELD_PREP(NRFX_TDM_TX_CHANNELS_MASK, chan_mask);
 		drv_data->tx.cfg = *tdm_cfg;
@@ -808,8 +816,16 @@ static int trigger_start(const struct device *dev)
 						   ? &drv_data->tx.nrfx_cfg
 						   : &drv_data->rx.nrfx_cfg;
 
+	const struct i2s_config *cfg = (drv_data->active_dir == I2S_DIR_TX)
+					       ? &drv_data->tx.cfg
+					       : &drv_data->rx.cfg;
+
 	tdm_init(drv_data, nrfx_cfg, drv_cfg->data_handler);
 
+	drv_data->frames = 0;
+	drv_data->frames_cycles = k_cycle_get_32();
+	/* 24-bit samples are held in 32-bit words */
+	drv_data->frame_bytes = cfg->channels * (cfg->word_size == 24 ? 4U : cfg->word_size / 8U);
 	drv_data->state = I2S_STATE_RUNNING;
 
 	nrf_tdm_sck_configure(drv_cfg->p_reg,
@@ -972,6 +988,13 @@ static void data_handler(const struct device *dev, const tdm_buffers_t *released
 
 	if (released != NULL) {
 		buf.size = released->buffer_size * sizeof(uint32_t);
+
+		/* Buffers released while running have been fully transferred */
+		if ((status & NRFX_TDM_STATUS_NEXT_BUFFERS_NEEDED) &&
+		    (released->p_rx_buffer != NULL || released->p_tx_buffer != NULL)) {
+			drv_data->frames += buf.size / drv_data->frame_bytes;
+			drv_data->frames_cycles = k_cycle_get_32();
+		}
 	}
 
 	if (status & NRFX_TDM_STATUS_TRANSFER_STOPPED) {
@@ -1106,6 +1129,35 @@ static void data_handler(const struct device *dev, const tdm_buffers_t *released
 	}
 }
 
+static int tdm_nrf_get_position(const struct device *dev, enum i2s_dir dir,
+				struct i2s_position *pos)
+{
+	struct tdm_drv_data *drv_data = dev->data;
+	unsigned int key;
+
+	if (dir == I2S_DIR_RX) {
+		if (!drv_data->rx_configured) {
+			return -EIO;
+		}
+	} else if (dir == I2S_DIR_TX) {
+		if (!drv_data->tx_configured) {
+			return -EIO;
+		}
+	} else {
+		return -EINVAL;
+	}
+
+	/* EasyDMA progress within a block cannot be read back, so the
+	 * position is the one at the last block boundary.
+	 */
+	key = irq_lock();
+	pos->frames = drv_data->frames;
+	pos->cycles = drv_data->frames_cycles;
+	irq_unlock(key);
+
+	return 0;
+}
+
 static void clock_manager_init(const struct device *dev)
 {
 #if CONFIG_CLOCK_CONTROL_NRF && NRF_CLOCK_HAS_HFCLKAUDIO
@@ -1141,6 +1193,7 @@ static DEVICE_API(i2s, tdm_nrf_drv_api) = {
 	.read = tdm_nrf_read,
 	.write = tdm_nrf_write,
 	.trigger = tdm_nrf_trigger,
+	.get_position = tdm_nrf_get_position,
 };
 
 #define TDM(idx)             DT_NODELABEL(tdm##idx)
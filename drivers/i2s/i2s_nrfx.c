@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/drivers/i2s.h>
 #include <zephyr/drivers/clock_control/nrf_clock_control.h>
 #include <zephyr/drivers/pinctrl.h>
@@ -33,6 +34,12 @@ struct i2s_nrfx_drv_data {
 	struct k_msgq tx_queue;
 	struct stream_cfg rx;
 	struct k_msgq rx_queue;
+#ifdef CONFIG_I2S_RTIO
+	/* Serializes RX block delivery to pending requests or the RX queue */
+	struct k_spinlock rx_lock;
+	/* RX iodev requests waiting for a block */
+	struct mpsc rx_sqe_q;
+#endif
 	const nrfx_i2s_t *p_i2s;
 	const uint32_t *last_tx_buffer;
 	enum i2s_state state;
@@ -255,6 +262,82 @@ static bool supply_next_buffers(struct i2s_nrfx_drv_data *drv_data,
 	return true;
 }
 
+#ifdef CONFIG_I2S_RTIO
+static void rx_sqe_complete(struct i2s_nrfx_drv_data *drv_data,
+			    struct rtio_iodev_sqe *iodev_sqe, const struct i2s_buf *buf)
+{
+	uint8_t *rx_buf;
+	uint32_t rx_len;
+	int ret;
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, buf->size, buf->size, &rx_buf, &rx_len);
+	if (ret == 0) {
+		memcpy(rx_buf, buf->mem_block, buf->size);
+	}
+
+	free_rx_buffer(drv_data, buf->mem_block);
+
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, buf->size);
+	}
+}
+
+/* Hands a received block to the oldest pending request, or queues it */
+static int rx_block_deliver(struct i2s_nrfx_drv_data *drv_data, struct i2s_buf *buf)
+{
+	struct mpsc_node *node;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	key = k_spin_lock(&drv_data->rx_lock);
+	node = mpsc_pop(&drv_data->rx_sqe_q);
+	if (node == NULL) {
+		ret = k_msgq_put(&drv_data->rx_queue, buf, K_NO_WAIT);
+	}
+	k_spin_unlock(&drv_data->rx_lock, key);
+
+	/* Completing outside of the lock, a multishot request is resubmitted */
+	if (node != NULL) {
+		rx_sqe_complete(drv_data, CONTAINER_OF(node, struct rtio_iodev_sqe, q), buf);
+	}
+
+	return ret;
+}
+
+static void i2s_nrfx_iodev_submit(const struct device *dev, enum i2s_dir dir,
+				  struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct i2s_nrfx_drv_data *drv_data = dev->data;
+	struct i2s_buf buf;
+	k_spinlock_key_t key;
+	int ret;
+
+	/* Only reception is done natively, from the I2S interrupt */
+	if (dir != I2S_DIR_RX || iodev_sqe->sqe.op != RTIO_OP_RX) {
+		i2s_rtio_iodev_default_submit(dev, dir, iodev_sqe);
+		return;
+	}
+
+	key = k_spin_lock(&drv_data->rx_lock);
+	ret = k_msgq_get(&drv_data->rx_queue, &buf, K_NO_WAIT);
+	if (ret != 0) {
+		mpsc_push(&drv_data->rx_sqe_q, &iodev_sqe->q);
+	}
+	k_spin_unlock(&drv_data->rx_lock, key);
+
+	if (ret == 0) {
+		rx_sqe_complete(drv_data, iodev_sqe, &buf);
+	}
+}
+#else
+static inline int rx_block_deliver(struct i2s_nrfx_drv_data *drv_data, struct i2s_buf *buf)
+{
+	return k_msgq_put(&drv_data->rx_queue, buf, K_NO_WAIT);
+}
+#endif /* CONFIG_I2S_RTIO */
+
 static void data_handler(const struct device *dev,
 			 const nrfx_i2s_buffers_t *released, uint32_t status)
 {
@@ -312,9 +395,7 @@ static void data_handler(const struct device *dev,
 				.mem_block = released->p_rx_buffer,
 				.size = released->buffer_size * sizeof(uint32_t)
 			};
-			int ret = k_msgq_put(&drv_data->rx_queue,
-					     &buf,
-					     K_NO_WAIT);
+			int ret = rx_block_deliver(drv_data, &buf);
 			if (ret < 0) {
 				LOG_ERR("No room in RX queue");
 				drv_data->state = I2S_STATE_ERROR;
@@ -541,6 +622,11 @@ static int i2s_nrfx_configure(const struct device *dev, enum i2s_dir dir,
 		return -EINVAL;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	if (dir == I2S_DIR_TX || dir == I2S_DIR_BOTH) {
 		drv_data->tx.cfg = *i2s_cfg;
 		drv_data->tx.nrfx_cfg = nrfx_cfg;
@@ -921,6 +1007,9 @@ static DEVICE_API(i2s, i2s_nrf_drv_api) = {
 	.read = i2s_nrfx_read,
 	.write = i2s_nrfx_write,
 	.trigger = i2s_nrfx_trigger,
+#ifdef CONFIG_I2S_RTIO
+	.iodev_submit = i2s_nrfx_iodev_submit,
+#endif
 };
 
 #define I2S(idx) DT_NODELABEL(i2s##idx)
@@ -969,6 +1058,8 @@ static DEVICE_API(i2s, i2s_nrf_drv_api) = {
 		k_msgq_init(&i2s_nrfx_data##idx.rx_queue,		     \
 			    (char *)rx_msgs##idx, sizeof(struct i2s_buf),    \
 			    ARRAY_SIZE(rx_msgs##idx));			     \
+		IF_ENABLED(CONFIG_I2S_RTIO,				     \
+			(mpsc_init(&i2s_nrfx_data##idx.rx_sqe_q);))	     \
 		init_clock_manager(dev);				     \
 		return 0;						     \
 	}								     \
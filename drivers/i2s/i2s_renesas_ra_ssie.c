@@ -732,6 +732,11 @@ static int i2s_renesas_ra_ssie_configure(const struct device *dev, enum i2s_dir
 		return -EINVAL;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 #ifdef CONFIG_I2S_RENESAS_RA_SSIE_DTC
 	new_fsp_cfg.p_transfer_tx = NULL;
 	new_fsp_cfg.p_transfer_rx = NULL;
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(i2s_rtio, CONFIG_I2S_LOG_LEVEL);
+
+static void i2s_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct i2s_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	const struct i2s_driver_api *api = data->dev->api;
+
+	if (api->iodev_submit != NULL) {
+		api->iodev_submit(data->dev, data->dir, iodev_sqe);
+	} else {
+		i2s_rtio_iodev_default_submit(data->dev, data->dir, iodev_sqe);
+	}
+}
+
+const struct rtio_iodev_api i2s_iodev_api = {
+	.submit = i2s_iodev_submit,
+};
+
+static int i2s_rtio_read(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct i2s_config *cfg = i2s_config_get(dev, I2S_DIR_RX);
+	void *mem_block;
+	uint8_t *buf;
+	uint32_t buf_len;
+	size_t size;
+	int ret;
+
+	if (cfg == NULL) {
+		return -EIO;
+	}
+
+	ret = i2s_read(dev, &mem_block, &size);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, size, size, &buf, &buf_len);
+	if (ret == 0) {
+		memcpy(buf, mem_block, size);
+		ret = size;
+	}
+
+	k_mem_slab_free(cfg->mem_slab, mem_block);
+
+	return ret;
+}
+
+static int i2s_rtio_write(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+
+	switch (sqe->op) {
+	case RTIO_OP_TX:
+		return i2s_buf_write(dev, (void *)sqe->tx.buf, sqe->tx.buf_len);
+	case RTIO_OP_TINY_TX:
+		return i2s_buf_write(dev, (void *)sqe->tiny_tx.buf, sqe->tiny_tx.buf_len);
+	default:
+		return -EINVAL;
+	}
+}
+
+static void i2s_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct i2s_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	int ret;
+
+	if (data->dir == I2S_DIR_RX && iodev_sqe->sqe.op == RTIO_OP_RX) {
+		ret = i2s_rtio_read(data->dev, iodev_sqe);
+	} else if (data->dir == I2S_DIR_TX) {
+		ret = i2s_rtio_write(data->dev, iodev_sqe);
+	} else {
+		ret = -EINVAL;
+	}
+
+	if (ret < 0) {
+		LOG_DBG("%s request failed: %d", data->dev->name, ret);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, ret);
+	}
+}
+
+void i2s_rtio_iodev_default_submit(const struct device *dev, enum i2s_dir dir,
+				   struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	ARG_UNUSED(dir);
+
+	if (req == NULL) {
+		LOG_ERR("RTIO work item allocation failed for %s. Consider to increase "
+			"CONFIG_RTIO_WORKQ_POOL_ITEMS.", dev->name);
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, i2s_rtio_iodev_default_submit_sync);
+}
@@ -582,6 +582,11 @@ static int i2s_sam_configure(const struct device *dev, enum i2s_dir dir,
 		return 0;
 	}
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	if (i2s_cfg->format & I2S_FMT_FRAME_CLK_INV) {
 		LOG_ERR("Frame clock inversion is not implemented");
 		LOG_ERR("Please submit a patch");
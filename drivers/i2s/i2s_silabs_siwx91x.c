@@ -29,7 +29,7 @@
 #define DMA_MAX_TRANSFER_COUNT 1024
 #define I2S_SIWX91X_UNSUPPORTED_OPTIONS                                                            \
 	(I2S_OPT_BIT_CLK_SLAVE | I2S_OPT_FRAME_CLK_SLAVE | I2S_OPT_LOOPBACK | I2S_OPT_PINGPONG |   \
-	 I2S_OPT_BIT_CLK_GATED)
+	 I2S_OPT_BIT_CLK_GATED | I2S_OPT_PLANAR)
 
 struct i2s_siwx91x_config {
 	I2S0_Type *reg;
@@ -53,6 +53,10 @@ struct stream {
 	bool master;
 	bool last_block;
 
+	/* Frames of the blocks completed since the stream was started */
+	uint64_t frames;
+	struct i2s_stats stats;
+
 	int32_t state;
 	struct k_msgq queue;
 
@@ -61,6 +65,7 @@ struct stream {
 };
 
 struct i2s_stm32_sai_data {
+	const struct device *dev;
 	SAI_HandleTypeDef hsai;
 	DMA_HandleTypeDef hdma;
 	struct stream stream;
@@ -77,6 +82,23 @@ struct i2s_stm32_sai_cfg {
 	bool synchronous;
 };
 
+static uint32_t stream_frame_bytes(const struct stream *stream)
+{
+	return stream->i2s_cfg.channels * stream->dma_src_size;
+}
+
+static bool stream_xrun_recovery(const struct stream *stream)
+{
+	return (stream->i2s_cfg.options & (I2S_OPT_XRUN_SILENCE | I2S_OPT_XRUN_REPEAT)) != 0;
+}
+
+static void stream_slack_update(struct stream *stream, uint32_t blocks)
+{
+	uint32_t slack = blocks * (stream->i2s_cfg.block_size / stream_frame_bytes(stream));
+
+	stream->stats.min_slack_frames = MIN(stream->stats.min_slack_frames, slack);
+}
+
 void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai)
 {
 	struct i2s_stm32_sai_data *dev_data = CONTAINER_OF(hsai, struct i2s_stm32_sai_data, hsai);
@@ -101,21 +123,55 @@ void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai)
 	struct queue_item item = {.buffer = stream->mem_block, .size = stream->mem_block_len};
 
 	ret = k_msgq_put(&stream->queue, &item, K_NO_WAIT);
+	if (ret < 0 && stream_xrun_recovery(stream)) {
+		struct queue_item oldest;
+
+		/* Overrun, drop the oldest block not read yet */
+		stream->stats.xruns++;
+		if (k_msgq_get(&stream->queue, &oldest, K_NO_WAIT) == 0) {
+			k_mem_slab_free(stream->i2s_cfg.mem_slab, oldest.buffer);
+			ret = k_msgq_put(&stream->queue, &item, K_NO_WAIT);
+		}
+
+		if (ret == 0) {
+			stream->stats.xruns_recovered++;
+		}
+
+		i2s_xrun_notify(dev_data->dev, I2S_DIR_RX, ret == 0);
+	}
+
 	if (ret < 0) {
 		stream->state = I2S_STATE_ERROR;
 		goto exit;
 	}
 
+	stream->frames += item.size / stream_frame_bytes(stream);
+
 	if (stream->state == I2S_STATE_STOPPING) {
 		stream->state = I2S_STATE_READY;
 		LOG_DBG("Stopping RX ...");
 		goto exit;
 	}
 
+	stream_slack_update(stream, k_mem_slab_num_free_get(stream->i2s_cfg.mem_slab));
+
 	ret = k_mem_slab_alloc(stream->i2s_cfg.mem_slab, &stream->mem_block, K_NO_WAIT);
 	if (ret < 0) {
-		stream->state = I2S_STATE_ERROR;
-		goto exit;
+		/* Overrun, drop the oldest block not read yet and reuse it */
+		stream->stats.xruns++;
+		if (stream_xrun_recovery(stream)) {
+			ret = k_msgq_get(&stream->queue, &item, K_NO_WAIT);
+			stream->mem_block = item.buffer;
+		}
+
+		i2s_xrun_notify(dev_data->dev, I2S_DIR_RX, ret == 0);
+		if (ret < 0) {
+			stream->mem_block = NULL;
+			stream->state = I2S_STATE_ERROR;
+			goto exit;
+		}
+
+		stream->stats.xruns_recovered++;
 	}
 
 	stream->mem_block_len = stream->i2s_cfg.block_size;
@@ -152,11 +208,40 @@ void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai)
 		}
 	}
 
+	stream->frames += stream->mem_block_len / stream_frame_bytes(stream);
+
 	if (stream->last_block) {
 		LOG_DBG("TX Stopped ...");
 		goto exit;
 	}
 
+	if (k_msgq_num_used_get(&stream->queue) == 0 && stream->state == I2S_STATE_RUNNING) {
+		/* Underrun, this was the last block queued */
+		stream->stats.xruns++;
+		stream->stats.min_slack_frames = 0;
+
+		if (stream_xrun_recovery(stream)) {
+			/* Send the block again, or silence, and carry on */
+			if (!(stream->i2s_cfg.options & I2S_OPT_XRUN_REPEAT)) {
+				memset(stream->mem_block, 0, stream->mem_block_len);
+				sys_cache_data_flush_range(stream->mem_block, stream->mem_block_len);
+			}
+
+			if (HAL_SAI_Transmit_DMA(hsai, stream->mem_block,
+						 stream->mem_block_len / stream->dma_src_size) == HAL_OK) {
+				stream->stats.xruns_recovered++;
+				i2s_xrun_notify(dev_data->dev, I2S_DIR_TX, true);
+				goto exit;
+			}
+
+			LOG_ERR("HAL_SAI_Transmit_DMA: <FAILED>");
+		}
+
+		i2s_xrun_notify(dev_data->dev, I2S_DIR_TX, false);
+	} else {
+		stream_slack_update(stream, k_msgq_num_used_get(&stream->queue));
+	}
+
 	/* Exit callback, no more data in the queue */
 	/* Reset I2S state */
 	if (k_msgq_num_used_get(&stream->queue) == 0) {
@@ -328,6 +413,8 @@ static int i2s_stm32_sai_initialize(const struct device *dev)
 	const struct i2s_stm32_sai_cfg *cfg = dev->config;
 	int ret = 0;
 
+	dev_data->dev = dev;
+
 	/* Enable SAI clock */
 	ret = stm32_sai_enable_clock(dev);
 	if (ret < 0) {
@@ -388,7 +475,14 @@ static int i2s_stm32_sai_configure(const struct device *dev, enum i2s_dir dir,
 	uint8_t protocol;
 	uint8_t word_size;
 
+	if (i2s_cfg->options & I2S_OPT_PLANAR) {
+		LOG_ERR("Planar mode not supported");
+		return -ENOTSUP;
+	}
+
 	memcpy(&stream->i2s_cfg, i2s_cfg, sizeof(struct i2s_config));
+	memset(&stream->stats, 0, sizeof(stream->stats));
+	stream->stats.min_slack_frames = UINT32_MAX;
 
 	stream->master = true;
 	if (i2s_cfg->options & I2S_OPT_FRAME_CLK_SLAVE ||
@@ -618,6 +712,8 @@ static int stream_start(const struct device *dev, enum i2s_dir dir)
 	struct queue_item item;
 	int ret;
 
+	stream->frames = 0;
+
 	if (dir == I2S_DIR_TX) {
 		ret = k_msgq_get(&stream->queue, &item, K_NO_WAIT);
 		if (ret < 0) {
@@ -767,11 +863,125 @@ static int i2s_stm32_sai_trigger(const struct device *dev, enum i2s_dir dir,
 	return 0;
 }
 
+static int i2s_stm32_sai_group_arm(const struct device *dev, enum i2s_dir dir)
+{
+	const struct i2s_stm32_sai_cfg *cfg = dev->config;
+	struct i2s_stm32_sai_data *dev_data = dev->data;
+	struct stream *stream = &dev_data->stream;
+	int ret;
+
+	if (dir == I2S_DIR_BOTH) {
+		return -ENOSYS;
+	}
+
+	if (stream->state != I2S_STATE_READY) {
+		LOG_ERR("START trigger: invalid state %d", stream->state);
+		return -EIO;
+	}
+
+	/* Enabling the clock master starts the clocks, it is left to
+	 * i2s_stm32_sai_group_start(). Synchronous and slave blocks are enabled
+	 * right away and start on the first frame of their master.
+	 */
+	if (stream->master && !cfg->synchronous) {
+		return 0;
+	}
+
+	ret = stream->stream_start(dev, dir);
+	if (ret < 0) {
+		LOG_ERR("START trigger failed %d", ret);
+		return ret;
+	}
+
+	stream->state = I2S_STATE_RUNNING;
+	stream->last_block = false;
+
+	return 0;
+}
+
+static int i2s_stm32_sai_group_start(const struct device *dev, enum i2s_dir dir)
+{
+	struct i2s_stm32_sai_data *dev_data = dev->data;
+	struct stream *stream = &dev_data->stream;
+	int ret;
+
+	if (stream->state != I2S_STATE_READY) {
+		/* Already started when armed */
+		return 0;
+	}
+
+	ret = stream->stream_start(dev, dir);
+	if (ret < 0) {
+		return ret;
+	}
+
+	stream->state = I2S_STATE_RUNNING;
+	stream->last_block = false;
+
+	return 0;
+}
+
+static int i2s_stm32_sai_get_stats(const struct device *dev, enum i2s_dir dir,
+				   struct i2s_stats *stats)
+{
+	struct i2s_stm32_sai_data *dev_data = dev->data;
+	unsigned int key;
+
+	if (dir == I2S_DIR_BOTH) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	*stats = dev_data->stream.stats;
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int i2s_stm32_sai_get_position(const struct device *dev, enum i2s_dir dir,
+				      struct i2s_position *pos)
+{
+	struct i2s_stm32_sai_data *dev_data = dev->data;
+	struct stream *stream = &dev_data->stream;
+	struct dma_status status;
+	unsigned int key;
+
+	if (dir == I2S_DIR_BOTH) {
+		return -EINVAL;
+	}
+
+	if (stream->state == I2S_STATE_NOT_READY) {
+		return -EIO;
+	}
+
+	key = irq_lock();
+
+	pos->frames = stream->frames;
+	pos->cycles = k_cycle_get_32();
+
+	/* Add the progress of the DMA within the current block */
+	if ((stream->state == I2S_STATE_RUNNING || stream->state == I2S_STATE_STOPPING) &&
+	    stream->mem_block != NULL &&
+	    dma_get_status(stream->dma_dev, stream->dma_channel, &status) == 0 &&
+	    status.pending_length <= stream->mem_block_len) {
+		pos->frames += (stream->mem_block_len - status.pending_length) /
+			       stream_frame_bytes(stream);
+	}
+
+	irq_unlock(key);
+
+	return 0;
+}
+
 static DEVICE_API(i2s, i2s_stm32_driver_api) = {
 	.configure = i2s_stm32_sai_configure,
 	.trigger = i2s_stm32_sai_trigger,
 	.write = i2s_stm32_sai_write,
 	.read = i2s_stm32_sai_read,
+	.get_position = i2s_stm32_sai_get_position,
+	.group_arm = i2s_stm32_sai_group_arm,
+	.group_start = i2s_stm32_sai_group_start,
+	.get_stats = i2s_stm32_sai_get_stats,
 };
 
 #define SAI_DMA_CHANNEL_INIT(index, dir, src_dev, dest_dev)                                        \
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/sys/util.h>
+
+/* Frames converted per call of the decoder */
+#define CHUNK_FRAMES 16
+
+union soa_chunk {
+	struct sensor_three_axis_data three_axis;
+	struct sensor_q31_data q31;
+	uint8_t buf[MAX(sizeof(struct sensor_three_axis_data) +
+			(CHUNK_FRAMES - 1) * sizeof(struct sensor_three_axis_sample_data),
+			sizeof(struct sensor_q31_data) +
+			(CHUNK_FRAMES - 1) * sizeof(struct sensor_q31_sample_data))];
+};
+
+/* Axis held by a single axis channel in three axis data, -1 for other channels */
+static int soa_axis(enum sensor_channel chan_type)
+{
+	switch (chan_type) {
+	case SENSOR_CHAN_ACCEL_X:
+	case SENSOR_CHAN_GYRO_X:
+	case SENSOR_CHAN_MAGN_X:
+	case SENSOR_CHAN_POS_DX:
+		return 0;
+	case SENSOR_CHAN_ACCEL_Y:
+	case SENSOR_CHAN_GYRO_Y:
+	case SENSOR_CHAN_MAGN_Y:
+	case SENSOR_CHAN_POS_DY:
+		return 1;
+	case SENSOR_CHAN_ACCEL_Z:
+	case SENSOR_CHAN_GYRO_Z:
+	case SENSOR_CHAN_MAGN_Z:
+	case SENSOR_CHAN_POS_DZ:
+		return 2;
+	default:
+		return -1;
+	}
+}
+
+/*
+ * Number of axes of the data decoded for the channel, as reported by the size
+ * information of the decoder. Decoders without it decode the natively
+ * supported layouts.
+ */
+static int soa_num_axes(const struct sensor_decoder_api *decoder,
+			struct sensor_chan_spec channel)
+{
+	size_t base_size;
+	size_t frame_size;
+	int rc;
+
+	if (channel.chan_type >= SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if (decoder->get_size_info != NULL) {
+		rc = decoder->get_size_info(channel, &base_size, &frame_size);
+	} else {
+		rc = sensor_natively_supported_channel_size_info(channel, &base_size,
+								 &frame_size);
+	}
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (base_size == sizeof(struct sensor_three_axis_data) &&
+	    frame_size == sizeof(struct sensor_three_axis_sample_data)) {
+		return 3;
+	}
+
+	if (base_size == sizeof(struct sensor_q31_data) &&
+	    frame_size == sizeof(struct sensor_q31_sample_data)) {
+		return 1;
+	}
+
+	return -ENOTSUP;
+}
+
+/* Gather one axis of the decoded frames into a contiguous array */
+static void soa_gather(const union soa_chunk *chunk, int axes, int axis, uint16_t count,
+		       q31_t *raw)
+{
+	if (axes == 3) {
+		for (uint16_t i = 0; i < count; i++) {
+			raw[i] = chunk->three_axis.readings[i].v[axis];
+		}
+	} else {
+		for (uint16_t i = 0; i < count; i++) {
+			raw[i] = chunk->q31.readings[i].value;
+		}
+	}
+}
+
+static void soa_to_q31(const q31_t *restrict raw, q31_t *restrict out, uint16_t count,
+		       int8_t from_shift, int8_t to_shift)
+{
+	int diff = from_shift - to_shift;
+
+	if (diff >= 0) {
+		diff = MIN(diff, 31);
+		for (uint16_t i = 0; i < count; i++) {
+			out[i] = (q31_t)CLAMP((int64_t)raw[i] << diff, INT32_MIN, INT32_MAX);
+		}
+	} else {
+		diff = MIN(-diff, 31);
+		for (uint16_t i = 0; i < count; i++) {
+			out[i] = raw[i] >> diff;
+		}
+	}
+}
+
+static void soa_to_float(const q31_t *restrict raw, float *restrict out, uint16_t count,
+			 int8_t shift)
+{
+	/* Scale of a q31 value with the shift, 2^(shift - 31) */
+	float scale = 1.0f / (float)BIT64(31);
+
+	if (shift >= 0) {
+		scale *= (float)BIT64(shift);
+	} else {
+		scale /= (float)BIT64(-shift);
+	}
+
+	for (uint16_t i = 0; i < count; i++) {
+		out[i] = (float)raw[i] * scale;
+	}
+}
+
+/* Decode into q31 values when q31_values is set, into float values otherwise */
+static int sensor_decode_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			     struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+			     int8_t shift, q31_t *const q31_values[], float *const float_values[],
+			     uint64_t *timestamps_ns)
+{
+	union soa_chunk chunk;
+	q31_t raw[CHUNK_FRAMES];
+	int axes = soa_num_axes(decoder, channel);
+	int axis = -1;
+	int num_values = axes;
+	uint16_t total = 0;
+
+	if (axes < 0) {
+		return axes;
+	}
+
+	/* A single axis decoded as three axis data, only that axis is output */
+	if (axes == 3 && soa_axis(channel.chan_type) >= 0) {
+		axis = soa_axis(channel.chan_type);
+		num_values = 1;
+	}
+
+	while (total < max_count) {
+		uint16_t count = MIN(max_count - total, CHUNK_FRAMES);
+		int8_t chunk_shift;
+		uint64_t base_ns;
+		int rc;
+
+		rc = decoder->decode(buffer, channel, fit, count, &chunk);
+		if (rc <= 0) {
+			/* Frames already decoded are consumed, report them first */
+			return (total > 0) ? total : rc;
+		}
+		rc = MIN(rc, count);
+
+		if (axes == 3) {
+			base_ns = chunk.three_axis.header.base_timestamp_ns;
+			chunk_shift = chunk.three_axis.shift;
+		} else {
+			base_ns = chunk.q31.header.base_timestamp_ns;
+			chunk_shift = chunk.q31.shift;
+		}
+
+		for (int i = 0; i < num_values; i++) {
+			soa_gather(&chunk, axes, (axis >= 0) ? axis : i, rc, raw);
+			if (q31_values != NULL) {
+				soa_to_q31(raw, q31_values[i] + total, rc, chunk_shift, shift);
+			} else {
+				soa_to_float(raw, float_values[i] + total, rc, chunk_shift);
+			}
+		}
+
+		if (timestamps_ns != NULL) {
+			for (int i = 0; i < rc; i++) {
+				timestamps_ns[total + i] =
+					base_ns + ((axes == 3) ? chunk.three_axis.readings[i].timestamp_delta
+							       : chunk.q31.readings[i].timestamp_delta);
+			}
+		}
+
+		total += rc;
+
+		/* Fewer frames than requested, nothing more to decode */
+		if (rc < count) {
+			break;
+		}
+	}
+
+	return total;
+}
+
+int sensor_decode_q31_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			  struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+			  int8_t shift, q31_t *const values[], uint64_t *timestamps_ns)
+{
+	return sensor_decode_soa(decoder, buffer, channel, fit, max_count, shift, values, NULL,
+				 timestamps_ns);
+}
+
+int sensor_decode_float_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			    struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+			    float *const values[], uint64_t *timestamps_ns)
+{
+	return sensor_decode_soa(decoder, buffer, channel, fit, max_count, 0, NULL, values,
+				 timestamps_ns);
+}
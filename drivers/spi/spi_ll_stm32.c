@@ -487,11 +487,29 @@ static void spi_stm32_cs_control(const struct device *dev, bool on)
 #endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32_spi_subghz) */
 }
 
+#ifdef CONFIG_SPI_STM32_RTIO
+static void spi_stm32_iodev_complete(const struct device *dev, int status, bool next);
+
+/* Check if the next submission of the RTIO transaction follows with CS held */
+static bool spi_stm32_iodev_txn_next(struct spi_stm32_data *data, int status)
+{
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+
+	return (rtio_ctx->txn_head != NULL) && (status == 0) &&
+	       (rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION);
+}
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 static void spi_stm32_complete(const struct device *dev, int status)
 {
 	const struct spi_stm32_config *cfg = dev->config;
 	SPI_TypeDef *spi = cfg->spi;
 	struct spi_stm32_data *data = dev->data;
+#ifdef CONFIG_SPI_STM32_RTIO
+	bool txn_next = spi_stm32_iodev_txn_next(data, status);
+#else
+	bool txn_next = false;
+#endif /* CONFIG_SPI_STM32_RTIO */
 
 #ifdef CONFIG_SPI_STM32_INTERRUPT
 	ll_func_disable_int_tx_empty(spi);
@@ -519,7 +537,9 @@ static void spi_stm32_complete(const struct device *dev, int status)
 			/* NOP */
 		}
 
-		spi_stm32_cs_control(dev, false);
+		if (!txn_next) {
+			spi_stm32_cs_control(dev, false);
+		}
 	}
 
 	/* BSY flag is cleared when MODF flag is raised */
@@ -552,6 +572,16 @@ static void spi_stm32_complete(const struct device *dev, int status)
 #endif /* CONFIG_SPI_STM32_INTERRUPT && CONFIG_SOC_SERIES_STM32H7X */
 	}
 
+#ifdef CONFIG_SPI_STM32_RTIO
+	if (data->rtio_ctx->txn_head != NULL) {
+		if (!txn_next) {
+			spi_stm32_pm_policy_state_lock_put(dev);
+		}
+		spi_stm32_iodev_complete(dev, status, txn_next);
+		return;
+	}
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 #ifdef CONFIG_SPI_STM32_INTERRUPT
 	spi_context_complete(&data->ctx, dev, status);
 #endif
@@ -588,6 +618,7 @@ static void spi_stm32_isr(const struct device *dev)
 
 	if (err) {
 		spi_stm32_complete(dev, err);
+		return;
 	}
 
 	uint32_t transfer_dir = LL_SPI_GetTransferDirection(spi);
@@ -904,6 +935,67 @@ static int spi_stm32_half_duplex_switch_to_receive(const struct spi_stm32_config
 	return 0;
 }
 
+/* Enable the SPI for the transfer set up in the context */
+static void spi_stm32_start_transfer(const struct device *dev, bool rx_on, bool assert_cs)
+{
+	const struct spi_stm32_config *cfg = dev->config;
+	SPI_TypeDef *spi = cfg->spi;
+
+#if defined(CONFIG_SPI_STM32_INTERRUPT) && defined(CONFIG_SOC_SERIES_STM32H7X)
+	/* Make sure IRQ is disabled to avoid any spurious IRQ to happen */
+	irq_disable(cfg->irq_line);
+#endif  /* CONFIG_SPI_STM32_INTERRUPT && CONFIG_SOC_SERIES_STM32H7X */
+	LL_SPI_Enable(spi);
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
+	/* With the STM32MP1, STM32U5 and the STM32H7,
+	 * if the device is the SPI master,
+	 * we need to enable the start of the transfer with
+	 * LL_SPI_StartMasterTransfer(spi)
+	 */
+	if (LL_SPI_GetMode(spi) == LL_SPI_MODE_MASTER) {
+		LL_SPI_StartMasterTransfer(spi);
+		while (!LL_SPI_IsActiveMasterTransfer(spi)) {
+			/* NOP */
+		}
+	}
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi) */
+
+#ifdef CONFIG_SOC_SERIES_STM32H7X
+	/*
+	 * Add a small delay after enabling to prevent transfer stalling at high
+	 * system clock frequency (see errata sheet ES0392).
+	 */
+	k_busy_wait(WAIT_1US);
+#endif /* CONFIG_SOC_SERIES_STM32H7X */
+
+	/* This is turned off in spi_stm32_complete(). */
+	if (assert_cs) {
+		spi_stm32_cs_control(dev, true);
+	}
+
+#ifdef CONFIG_SPI_STM32_INTERRUPT
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
+	if (cfg->fifo_enabled) {
+		LL_SPI_EnableIT_EOT(spi);
+	}
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi) */
+
+	ll_func_enable_int_errors(spi);
+
+	if (rx_on) {
+		ll_func_enable_int_rx_not_empty(spi);
+	}
+
+	ll_func_enable_int_tx_empty(spi);
+
+#if defined(CONFIG_SPI_STM32_INTERRUPT) && defined(CONFIG_SOC_SERIES_STM32H7X)
+	irq_enable(cfg->irq_line);
+#endif  /* CONFIG_SPI_STM32_INTERRUPT && CONFIG_SOC_SERIES_STM32H7X */
+#endif /* CONFIG_SPI_STM32_INTERRUPT */
+}
+
 static int transceive(const struct device *dev,
 		      const struct spi_config *config,
 		      const struct spi_buf_set *tx_bufs,
@@ -969,57 +1061,9 @@ static int transceive(const struct device *dev,
 
 #endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi) */
 
-#if defined(CONFIG_SPI_STM32_INTERRUPT) && defined(CONFIG_SOC_SERIES_STM32H7X)
-	/* Make sure IRQ is disabled to avoid any spurious IRQ to happen */
-	irq_disable(cfg->irq_line);
-#endif  /* CONFIG_SPI_STM32_INTERRUPT && CONFIG_SOC_SERIES_STM32H7X */
-	LL_SPI_Enable(spi);
-
-#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
-	/* With the STM32MP1, STM32U5 and the STM32H7,
-	 * if the device is the SPI master,
-	 * we need to enable the start of the transfer with
-	 * LL_SPI_StartMasterTransfer(spi)
-	 */
-	if (LL_SPI_GetMode(spi) == LL_SPI_MODE_MASTER) {
-		LL_SPI_StartMasterTransfer(spi);
-		while (!LL_SPI_IsActiveMasterTransfer(spi)) {
-			/* NOP */
-		}
-	}
-#endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi) */
-
-#ifdef CONFIG_SOC_SERIES_STM32H7X
-	/*
-	 * Add a small delay after enabling to prevent transfer stalling at high
-	 * system clock frequency (see errata sheet ES0392).
-	 */
-	k_busy_wait(WAIT_1US);
-#endif /* CONFIG_SOC_SERIES_STM32H7X */
-
-	/* This is turned off in spi_stm32_complete(). */
-	spi_stm32_cs_control(dev, true);
+	spi_stm32_start_transfer(dev, rx_bufs != NULL, true);
 
 #ifdef CONFIG_SPI_STM32_INTERRUPT
-
-#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
-	if (cfg->fifo_enabled) {
-		LL_SPI_EnableIT_EOT(spi);
-	}
-#endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi) */
-
-	ll_func_enable_int_errors(spi);
-
-	if (rx_bufs) {
-		ll_func_enable_int_rx_not_empty(spi);
-	}
-
-	ll_func_enable_int_tx_empty(spi);
-
-#if defined(CONFIG_SPI_STM32_INTERRUPT) && defined(CONFIG_SOC_SERIES_STM32H7X)
-	irq_enable(cfg->irq_line);
-#endif  /* CONFIG_SPI_STM32_INTERRUPT && CONFIG_SOC_SERIES_STM32H7X */
-
 	do {
 		ret = spi_context_wait_for_completion(&data->ctx);
 
@@ -1351,6 +1395,146 @@ end:
 }
 #endif /* CONFIG_SPI_STM32_DMA */
 
+#ifdef CONFIG_SPI_STM32_RTIO
+/* Instances with DMA channels keep the work queue based RTIO support */
+static bool spi_stm32_rtio_native(const struct device *dev)
+{
+#ifdef CONFIG_SPI_STM32_DMA
+	struct spi_stm32_data *data = dev->data;
+
+	return (data->dma_tx.dma_dev == NULL) || (data->dma_rx.dma_dev == NULL);
+#else
+	ARG_UNUSED(dev);
+	return true;
+#endif /* CONFIG_SPI_STM32_DMA */
+}
+
+static void spi_stm32_iodev_start(const struct device *dev)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+	struct rtio_sqe *sqe = &rtio_ctx->txn_curr->sqe;
+	struct spi_dt_spec *spi_dt_spec = sqe->iodev->data;
+	const struct spi_config *config = &spi_dt_spec->config;
+	const struct spi_buf_set *tx_bufs = &data->rtio_tx_bufs;
+	const struct spi_buf_set *rx_bufs = &data->rtio_rx_bufs;
+	bool first = rtio_ctx->txn_curr == rtio_ctx->txn_head;
+	int ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		tx_bufs = NULL;
+		data->rtio_rx_buf.buf = sqe->rx.buf;
+		data->rtio_rx_buf.len = sqe->rx.buf_len;
+		break;
+	case RTIO_OP_TX:
+		rx_bufs = NULL;
+		data->rtio_tx_buf.buf = (void *)sqe->tx.buf;
+		data->rtio_tx_buf.len = sqe->tx.buf_len;
+		break;
+	case RTIO_OP_TINY_TX:
+		rx_bufs = NULL;
+		data->rtio_tx_buf.buf = (void *)sqe->tiny_tx.buf;
+		data->rtio_tx_buf.len = sqe->tiny_tx.buf_len;
+		break;
+	case RTIO_OP_TXRX:
+		data->rtio_tx_buf.buf = (void *)sqe->txrx.tx_buf;
+		data->rtio_tx_buf.len = sqe->txrx.buf_len;
+		data->rtio_rx_buf.buf = sqe->txrx.rx_buf;
+		data->rtio_rx_buf.len = sqe->txrx.buf_len;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		ret = -EINVAL;
+		goto fail;
+	}
+
+	if ((config->operation & (SPI_HALF_DUPLEX | SPI_OP_MODE_SLAVE)) != 0U) {
+		ret = -ENOTSUP;
+		goto fail;
+	}
+
+	/* The blocking API calls share one spec, its content changes between them */
+	if (spi_dt_spec == &rtio_ctx->dt_spec) {
+		data->ctx.config = NULL;
+	}
+
+	spi_stm32_pm_policy_state_lock_get(dev);
+
+	ret = spi_stm32_configure(dev, config, true);
+	if (ret != 0) {
+		goto fail;
+	}
+
+	spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs,
+				  SPI_WORD_SIZE_GET(config->operation) / 8);
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi)
+	const struct spi_stm32_config *cfg = dev->config;
+
+	if (cfg->fifo_enabled) {
+		ret = spi_stm32_count_total_frames(config, tx_bufs, rx_bufs);
+		if (ret < 0) {
+			goto fail;
+		}
+		LL_SPI_SetTransferSize(cfg->spi, (uint32_t)ret);
+	}
+#endif /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32h7_spi) */
+
+	spi_stm32_start_transfer(dev, rx_bufs != NULL, first);
+	return;
+
+fail:
+	/* Nothing was started, end the transaction here */
+	spi_stm32_cs_control(dev, false);
+	spi_stm32_pm_policy_state_lock_put(dev);
+	spi_stm32_iodev_complete(dev, ret, false);
+}
+
+static void spi_stm32_iodev_complete(const struct device *dev, int status, bool next)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct spi_rtio *rtio_ctx = data->rtio_ctx;
+
+	if (next) {
+		rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+		spi_stm32_iodev_start(dev);
+	} else if (spi_rtio_complete(rtio_ctx, status)) {
+		spi_stm32_iodev_start(dev);
+	}
+}
+
+static void spi_stm32_iodev_submit(const struct device *dev,
+				   struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_stm32_data *data = dev->data;
+
+	if (!spi_stm32_rtio_native(dev)) {
+		spi_rtio_iodev_default_submit(dev, iodev_sqe);
+		return;
+	}
+
+	if (spi_rtio_submit(data->rtio_ctx, iodev_sqe)) {
+		spi_stm32_iodev_start(dev);
+	}
+}
+
+static int spi_stm32_rtio_transceive(const struct device *dev,
+				     const struct spi_config *config,
+				     const struct spi_buf_set *tx_bufs,
+				     const struct spi_buf_set *rx_bufs)
+{
+	struct spi_stm32_data *data = dev->data;
+	int ret;
+
+	spi_context_lock(&data->ctx, false, NULL, NULL, config);
+	ret = spi_rtio_transceive(data->rtio_ctx, config, tx_bufs, rx_bufs);
+	spi_context_release(&data->ctx, ret);
+
+	return ret;
+}
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 static int spi_stm32_transceive(const struct device *dev,
 				const struct spi_config *config,
 				const struct spi_buf_set *tx_bufs,
@@ -1365,7 +1549,11 @@ static int spi_stm32_transceive(const struct device *dev,
 				      false, NULL, NULL);
 	}
 #endif /* CONFIG_SPI_STM32_DMA */
+#ifdef CONFIG_SPI_STM32_RTIO
+	return spi_stm32_rtio_transceive(dev, config, tx_bufs, rx_bufs);
+#else
 	return transceive(dev, config, tx_bufs, rx_bufs, false, NULL, NULL);
+#endif /* CONFIG_SPI_STM32_RTIO */
 }
 
 #ifdef CONFIG_SPI_ASYNC
@@ -1385,7 +1573,9 @@ static DEVICE_API(spi, api_funcs) = {
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_stm32_transceive_async,
 #endif
-#ifdef CONFIG_SPI_RTIO
+#if defined(CONFIG_SPI_STM32_RTIO)
+	.iodev_submit = spi_stm32_iodev_submit,
+#elif defined(CONFIG_SPI_RTIO)
 	.iodev_submit = spi_rtio_iodev_default_submit,
 #endif
 	.release = spi_stm32_release,
@@ -1466,6 +1656,14 @@ static int spi_stm32_init(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_SPI_STM32_RTIO
+	spi_rtio_init(data->rtio_ctx, dev);
+	data->rtio_tx_bufs.buffers = &data->rtio_tx_buf;
+	data->rtio_tx_bufs.count = 1;
+	data->rtio_rx_bufs.buffers = &data->rtio_rx_buf;
+	data->rtio_rx_bufs.count = 1;
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 	spi_context_unlock_unconditionally(&data->ctx);
 
 	return pm_device_runtime_enable(dev);
@@ -1595,11 +1793,24 @@ static void spi_stm32_irq_config_func_##id(const struct device *dev)		\
 #define SPI_GET_FIFO_PROP(id)	DT_INST_PROP(id, fifo_enable)
 #define SPI_FIFO_ENABLED(id)	COND_CODE_1(SPI_SUPPORTS_FIFO(id), (SPI_GET_FIFO_PROP(id)), (0))
 
+#ifdef CONFIG_SPI_STM32_RTIO
+#define SPI_STM32_RTIO_DEFINE(id)					\
+	SPI_RTIO_DEFINE(spi_stm32_rtio_##id,				\
+			CONFIG_SPI_STM32_RTIO_SQ_SIZE,			\
+			CONFIG_SPI_STM32_RTIO_SQ_SIZE)
+#define SPI_STM32_RTIO_CTX(id)	.rtio_ctx = &spi_stm32_rtio_##id,
+#else
+#define SPI_STM32_RTIO_DEFINE(id)
+#define SPI_STM32_RTIO_CTX(id)
+#endif /* CONFIG_SPI_STM32_RTIO */
+
 #define STM32_SPI_INIT(id)						\
 STM32_SPI_IRQ_HANDLER_DECL(id);						\
 									\
 PINCTRL_DT_INST_DEFINE(id);						\
 									\
+SPI_STM32_RTIO_DEFINE(id)						\
+									\
 static const struct stm32_pclken pclken_##id[] =			\
 					       STM32_DT_INST_CLOCKS(id);\
 									\
@@ -1627,6 +1838,7 @@ static struct spi_stm32_data spi_stm32_dev_data_##id = {		\
 	SPI_DMA_CHANNEL(id, rx, RX, PERIPHERAL, MEMORY)			\
 	SPI_DMA_CHANNEL(id, tx, TX, MEMORY, PERIPHERAL)			\
 	SPI_DMA_STATUS_SEM(id)						\
+	SPI_STM32_RTIO_CTX(id)						\
 	SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(id), ctx)		\
 };									\
 									\
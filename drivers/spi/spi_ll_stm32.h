@@ -71,6 +71,14 @@ struct spi_stm32_data {
 	struct stream dma_rx;
 	struct stream dma_tx;
 #endif /* CONFIG_SPI_STM32_DMA */
+#ifdef CONFIG_SPI_STM32_RTIO
+	struct spi_rtio *rtio_ctx;
+	/* Buffers of the submission in progress */
+	struct spi_buf rtio_tx_buf;
+	struct spi_buf rtio_rx_buf;
+	struct spi_buf_set rtio_tx_bufs;
+	struct spi_buf_set rtio_rx_bufs;
+#endif /* CONFIG_SPI_STM32_RTIO */
 	bool pm_policy_state_on;
 };
 
@@ -16,6 +16,14 @@ struct lpspi_driver_data {
 	size_t words_clocked;
 	uint8_t word_size_bytes;
 	uint8_t lpspi_op_mode;
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+	struct spi_rtio *rtio_ctx;
+	/* Buffers of the submission in progress */
+	struct spi_buf rtio_tx_buf;
+	struct spi_buf rtio_rx_buf;
+	struct spi_buf_set rtio_tx_bufs;
+	struct spi_buf_set rtio_rx_bufs;
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
 };
 
 static inline uint8_t rx_fifo_cur_len(LPSPI_Type *base)
@@ -225,6 +233,10 @@ static inline void lpspi_handle_tx_irq(const struct device *dev)
 	lpspi_next_tx_fill(dev);
 }
 
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+static void lpspi_iodev_end_xfer(const struct device *dev);
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
+
 static inline void lpspi_end_xfer(const struct device *dev)
 {
 	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
@@ -232,6 +244,15 @@ static inline void lpspi_end_xfer(const struct device *dev)
 	struct lpspi_data *data = dev->data;
 	struct spi_context *ctx = &data->ctx;
 
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+
+	if (lpspi_data->rtio_ctx->txn_head != NULL) {
+		lpspi_iodev_end_xfer(dev);
+		return;
+	}
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
+
 	spi_context_complete(ctx, dev, 0);
 	NVIC_ClearPendingIRQ(config->irqn);
 	if (!(ctx->config->operation & SPI_HOLD_ON_CS)) {
@@ -324,16 +345,18 @@ static void lpspi_isr(const struct device *dev)
 	lpspi_fill_tx_fifo_nop(dev, max_fill);
 }
 
-static void lpspi_master_setup_native_cs(const struct device *dev, const struct spi_config *spi_cfg)
+static void lpspi_master_setup_native_cs(const struct device *dev, const struct spi_config *spi_cfg,
+					 bool continue_cmd)
 {
 	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
 
 	/* keep the chip select asserted until the end of the zephyr xfer by using
-	 * continunous transfer mode. If SPI_HOLD_ON_CS is requested, we need
-	 * to also set CONTC in order to continue the previous command to keep CS
-	 * asserted.
+	 * continunous transfer mode. If SPI_HOLD_ON_CS is requested, or the xfer
+	 * continues an RTIO transaction, we need to also set CONTC in order to
+	 * continue the previous command to keep CS asserted.
 	 */
-	if (spi_cfg->operation & SPI_HOLD_ON_CS || base->TCR & LPSPI_TCR_CONTC_MASK) {
+	if (spi_cfg->operation & SPI_HOLD_ON_CS || base->TCR & LPSPI_TCR_CONTC_MASK ||
+	    continue_cmd) {
 		base->TCR |= LPSPI_TCR_CONTC_MASK | LPSPI_TCR_CONT_MASK;
 	} else {
 		base->TCR |= LPSPI_TCR_CONT_MASK;
@@ -419,7 +442,7 @@ static int transceive(const struct device *dev, const struct spi_config *spi_cfg
 	base->CR |= LPSPI_CR_MEN_MASK;
 
 	if (op_mode == SPI_OP_MODE_MASTER) {
-		lpspi_master_setup_native_cs(dev, spi_cfg);
+		lpspi_master_setup_native_cs(dev, spi_cfg, false);
 	}
 
 	/* start the transfer sequence which are handled by irqs */
@@ -437,10 +460,191 @@ error:
 	return ret;
 }
 
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+/* Chained submissions continue the LPSPI command to hold CS, which needs
+ * the SPI_HOLD_ON_CS support of version 2 and a module that is not reset
+ * before every transfer. Other modules keep the work queue based support.
+ */
+static bool lpspi_rtio_native(const struct device *dev)
+{
+	struct lpspi_data *data = dev->data;
+
+	return (data->major_version >= 2) && !IS_ENABLED(CONFIG_SOC_FAMILY_NXP_S32);
+}
+
+static void lpspi_iodev_complete(const struct device *dev, int status, bool next);
+
+static void lpspi_iodev_start(const struct device *dev)
+{
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+	struct spi_rtio *rtio_ctx = lpspi_data->rtio_ctx;
+	struct spi_context *ctx = &data->ctx;
+	struct rtio_sqe *sqe = &rtio_ctx->txn_curr->sqe;
+	struct spi_dt_spec *spi_dt_spec = sqe->iodev->data;
+	const struct spi_config *spi_cfg = &spi_dt_spec->config;
+	const struct spi_buf_set *tx_bufs = &lpspi_data->rtio_tx_bufs;
+	const struct spi_buf_set *rx_bufs = &lpspi_data->rtio_rx_bufs;
+	bool first = rtio_ctx->txn_curr == rtio_ctx->txn_head;
+	int ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		tx_bufs = NULL;
+		lpspi_data->rtio_rx_buf.buf = sqe->rx.buf;
+		lpspi_data->rtio_rx_buf.len = sqe->rx.buf_len;
+		break;
+	case RTIO_OP_TX:
+		rx_bufs = NULL;
+		lpspi_data->rtio_tx_buf.buf = (void *)sqe->tx.buf;
+		lpspi_data->rtio_tx_buf.len = sqe->tx.buf_len;
+		break;
+	case RTIO_OP_TINY_TX:
+		rx_bufs = NULL;
+		lpspi_data->rtio_tx_buf.buf = (void *)sqe->tiny_tx.buf;
+		lpspi_data->rtio_tx_buf.len = sqe->tiny_tx.buf_len;
+		break;
+	case RTIO_OP_TXRX:
+		lpspi_data->rtio_tx_buf.buf = (void *)sqe->txrx.tx_buf;
+		lpspi_data->rtio_tx_buf.len = sqe->txrx.buf_len;
+		lpspi_data->rtio_rx_buf.buf = sqe->txrx.rx_buf;
+		lpspi_data->rtio_rx_buf.len = sqe->txrx.buf_len;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		ret = -EINVAL;
+		goto error;
+	}
+
+	if (SPI_OP_MODE_GET(spi_cfg->operation) != SPI_OP_MODE_MASTER) {
+		ret = -ENOTSUP;
+		goto error;
+	}
+
+	lpspi_data->word_size_bytes =
+		DIV_ROUND_UP(SPI_WORD_SIZE_GET(spi_cfg->operation), BITS_PER_BYTE);
+	if (lpspi_data->word_size_bytes > 4) {
+		LOG_ERR("Maximum 4 byte word size");
+		ret = -EINVAL;
+		goto error;
+	}
+
+	/* The blocking API calls share one spec, its content changes between them */
+	if (spi_dt_spec == &rtio_ctx->dt_spec) {
+		ctx->config = NULL;
+	}
+
+	spi_context_buffers_setup(ctx, tx_bufs, rx_bufs, lpspi_data->word_size_bytes);
+	lpspi_data->lpspi_op_mode = SPI_OP_MODE_MASTER;
+
+	ret = lpspi_configure(dev, spi_cfg);
+	if (ret) {
+		goto error;
+	}
+
+	base->CR |= LPSPI_CR_RRF_MASK;
+	base->IER = 0;
+	base->SR |= LPSPI_INTERRUPT_BITS;
+
+	size_t max_side_clocks = MAX(spi_context_total_tx_len(ctx), spi_context_total_rx_len(ctx));
+
+	lpspi_data->total_words_to_clock =
+				DIV_ROUND_UP(max_side_clocks, lpspi_data->word_size_bytes);
+	lpspi_data->words_clocked = 0;
+
+	if (first) {
+		spi_context_cs_control(ctx, true);
+	}
+
+	base->FCR = 0;
+	base->CR |= LPSPI_CR_MEN_MASK;
+
+	lpspi_master_setup_native_cs(dev, spi_cfg, !first);
+
+	lpspi_next_tx_fill(dev);
+
+	base->IER |= LPSPI_IER_TDIE_MASK | LPSPI_IER_RDIE_MASK;
+	return;
+
+error:
+	/* Nothing was started, end the transaction here */
+	base->TCR &= ~(LPSPI_TCR_CONT_MASK | LPSPI_TCR_CONTC_MASK);
+	spi_context_cs_control(ctx, false);
+	lpspi_iodev_complete(dev, ret, false);
+}
+
+static void lpspi_iodev_complete(const struct device *dev, int status, bool next)
+{
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+	struct spi_rtio *rtio_ctx = lpspi_data->rtio_ctx;
+
+	if (next) {
+		rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+		lpspi_iodev_start(dev);
+	} else if (spi_rtio_complete(rtio_ctx, status)) {
+		lpspi_iodev_start(dev);
+	}
+}
+
+static void lpspi_iodev_end_xfer(const struct device *dev)
+{
+	LPSPI_Type *base = (LPSPI_Type *)DEVICE_MMIO_NAMED_GET(dev, reg_base);
+	const struct lpspi_config *config = dev->config;
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+	struct spi_context *ctx = &data->ctx;
+	bool next = lpspi_data->rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION;
+
+	NVIC_ClearPendingIRQ(config->irqn);
+
+	/* Within a transaction the command continues with the next submission */
+	if (!next) {
+		if (!(ctx->config->operation & SPI_HOLD_ON_CS)) {
+			base->TCR &= ~(LPSPI_TCR_CONT_MASK | LPSPI_TCR_CONTC_MASK);
+		}
+		spi_context_cs_control(ctx, false);
+	}
+
+	lpspi_iodev_complete(dev, 0, next);
+}
+
+static void lpspi_iodev_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct lpspi_data *data = dev->data;
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+
+	if (!lpspi_rtio_native(dev)) {
+		spi_rtio_iodev_default_submit(dev, iodev_sqe);
+		return;
+	}
+
+	if (spi_rtio_submit(lpspi_data->rtio_ctx, iodev_sqe)) {
+		lpspi_iodev_start(dev);
+	}
+}
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
+
 static int lpspi_transceive_sync(const struct device *dev, const struct spi_config *spi_cfg,
 				    const struct spi_buf_set *tx_bufs,
 				    const struct spi_buf_set *rx_bufs)
 {
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+	if (lpspi_rtio_native(dev)) {
+		struct lpspi_data *data = dev->data;
+		struct lpspi_driver_data *lpspi_data =
+			(struct lpspi_driver_data *)data->driver_data;
+		int ret;
+
+		spi_context_lock(&data->ctx, false, NULL, NULL, spi_cfg);
+		ret = spi_rtio_transceive(lpspi_data->rtio_ctx, spi_cfg, tx_bufs, rx_bufs);
+		spi_context_release(&data->ctx, ret);
+
+		return ret;
+	}
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
+
 	return transceive(dev, spi_cfg, tx_bufs, rx_bufs, false, NULL, NULL);
 }
 
@@ -459,7 +663,9 @@ static DEVICE_API(spi, lpspi_driver_api) = {
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = lpspi_transceive_async,
 #endif
-#ifdef CONFIG_SPI_RTIO
+#if defined(CONFIG_SPI_NXP_LPSPI_RTIO)
+	.iodev_submit = lpspi_iodev_submit,
+#elif defined(CONFIG_SPI_RTIO)
 	.iodev_submit = spi_rtio_iodev_default_submit,
 #endif
 	.release = spi_lpspi_release,
@@ -484,16 +690,39 @@ static int lpspi_init(const struct device *dev)
 	base->CFGR1 |= LPSPI_CFGR1_MASTER_MASK;
 	base->CFGR1 &= ~LPSPI_CFGR1_PCSPOL_MASK;
 
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+	struct lpspi_driver_data *lpspi_data = (struct lpspi_driver_data *)data->driver_data;
+
+	spi_rtio_init(lpspi_data->rtio_ctx, dev);
+	lpspi_data->rtio_tx_bufs.buffers = &lpspi_data->rtio_tx_buf;
+	lpspi_data->rtio_tx_bufs.count = 1;
+	lpspi_data->rtio_rx_bufs.buffers = &lpspi_data->rtio_rx_buf;
+	lpspi_data->rtio_rx_bufs.count = 1;
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
+
 	spi_context_unlock_unconditionally(&data->ctx);
 
 	return 0;
 }
 
+#ifdef CONFIG_SPI_NXP_LPSPI_RTIO
+#define LPSPI_RTIO_DEFINE(n)                                                                       \
+	SPI_RTIO_DEFINE(lpspi_rtio_##n, CONFIG_SPI_NXP_LPSPI_RTIO_SQ_SIZE,                         \
+			CONFIG_SPI_NXP_LPSPI_RTIO_SQ_SIZE)
+#define LPSPI_RTIO_CTX(n) .rtio_ctx = &lpspi_rtio_##n,
+#else
+#define LPSPI_RTIO_DEFINE(n)
+#define LPSPI_RTIO_CTX(n)
+#endif /* CONFIG_SPI_NXP_LPSPI_RTIO */
+
 #define LPSPI_INIT(n)                                                                              \
 	SPI_NXP_LPSPI_COMMON_INIT(n)                                                               \
 	SPI_LPSPI_CONFIG_INIT(n)                                                              \
+	LPSPI_RTIO_DEFINE(n)                                                                       \
                                                                                                    \
-	static struct lpspi_driver_data lpspi_##n##_driver_data;                                   \
+	static struct lpspi_driver_data lpspi_##n##_driver_data = {                                \
+		LPSPI_RTIO_CTX(n)                                                                  \
+	};                                                                                         \
                                                                                                    \
 	static struct lpspi_data lpspi_data_##n = {                                             \
 		SPI_NXP_LPSPI_COMMON_DATA_INIT(n)                                                  \
@@ -112,6 +112,8 @@ struct udc_dwc2_data {
 	atomic_t xfer_new;
 	/* Finished transactions (IN on bits 0-15, OUT on bits 16-31) */
 	atomic_t xfer_finished;
+	/* Endpoint is being disabled (IN on bits 0-15, OUT on bits 16-31) */
+	atomic_t ep_disabling;
 	struct dwc2_reg_backup backup;
 	uint32_t ghwcfg1;
 	uint32_t max_xfersize;
@@ -548,6 +550,12 @@ static int dwc2_tx_fifo_write(const struct device *dev,
 	/* Lock and write to endpoint FIFO */
 	key = k_spin_lock(&priv->lock);
 
+	if (atomic_test_bit(&priv->ep_disabling, ep_idx)) {
+		/* Endpoint is being disabled, do not arm it again */
+		k_spin_unlock(&priv->lock, key);
+		return -ECANCELED;
+	}
+
 	/* Set number of packets and transfer size */
 	sys_write32((is_periodic ? usb_dwc2_set_dieptsizn_mc(1 + addnl) : 0) |
 		    usb_dwc2_set_dieptsizn_pktcnt(pktcnt) |
@@ -1549,6 +1557,7 @@ static void udc_dwc2_ep_disable(const struct device *dev,
 	struct usb_dwc2_reg *const base = dwc2_get_base(dev);
 	uint8_t ep_idx = USB_EP_GET_IDX(cfg->addr);
 	uint8_t ep_bit = ep_idx + (USB_EP_DIR_IS_OUT(cfg->addr) ? 16 : 0);
+	k_spinlock_key_t key;
 	mem_addr_t dxepctl_reg;
 	uint32_t dxepctl;
 
@@ -1591,7 +1600,14 @@ static void udc_dwc2_ep_disable(const struct device *dev,
 		return;
 	}
 
+	/* Checked under the lock, the interrupt handler can start the next
+	 * queued transfer.
+	 */
+	key = k_spin_lock(&priv->lock);
+
 	if (k_event_test(&priv->ep_disabled, BIT(ep_bit))) {
+		k_spin_unlock(&priv->lock, key);
+
 		/* There is no active transfer, STALL if necessary */
 		if (stall) {
 			dxepctl |= USB_DWC2_DEPCTL_STALL;
@@ -1604,8 +1620,12 @@ static void udc_dwc2_ep_disable(const struct device *dev,
 		return;
 	}
 
+	/* Prevent interrupt handler from starting next queued transfer */
+	atomic_set_bit(&priv->ep_disabling, ep_bit);
+	k_spin_unlock(&priv->lock, key);
+
 	if (USB_EP_DIR_IS_OUT(cfg->addr)) {
-		k_spinlock_key_t key = k_spin_lock(&priv->lock);
+		key = k_spin_lock(&priv->lock);
 
 		priv->ep_out_disable |= BIT(ep_idx);
 		if (stall) {
@@ -1637,6 +1657,7 @@ static void udc_dwc2_ep_disable(const struct device *dev,
 		}
 	}
 
+	atomic_clear_bit(&priv->ep_disabling, ep_bit);
 	udc_ep_set_busy(cfg, false);
 }
 
@@ -2292,6 +2313,7 @@ static int dwc2_driver_preinit(const struct device *dev)
 	k_event_init(&priv->drv_evt);
 	atomic_clear(&priv->xfer_new);
 	atomic_clear(&priv->xfer_finished);
+	atomic_clear(&priv->ep_disabling);
 	k_event_init(&priv->ep_disabled);
 	k_event_set(&priv->ep_disabled, UINT32_MAX);
 	priv->ep_out_disable = 0;
@@ -2542,6 +2564,83 @@ static inline void dwc2_handle_rxflvl(const struct device *dev)
 	}
 }
 
+/* Finish transfer on non-control endpoint and start next queued transfer
+ * directly in the interrupt handler. Only used in Buffer DMA mode, where
+ * arming endpoint does not involve copying data to or from FIFO.
+ */
+static bool dwc2_isr_xfer_chain(const struct device *dev,
+				struct udc_ep_config *const cfg)
+{
+	struct udc_dwc2_data *const priv = udc_get_private(dev);
+	uint8_t ep_idx = USB_EP_GET_IDX(cfg->addr);
+	uint8_t ep_bit = ep_idx + (USB_EP_DIR_IS_OUT(cfg->addr) ? 16 : 0);
+	k_spinlock_key_t key;
+	struct net_buf *buf;
+	struct net_buf *next;
+	int err;
+
+	if (!IS_ENABLED(CONFIG_UDC_DWC2_DMA_CHAINING) ||
+	    !dwc2_in_buffer_dma_mode(dev) || ep_idx == 0) {
+		return false;
+	}
+
+	/* udc_dwc2_ep_disable() tests for an active transfer and marks the
+	 * endpoint under the same lock. The endpoint is reported idle only
+	 * when no transfer is started next, and OUT endpoints are armed under
+	 * the lock. IN endpoints are armed by dwc2_tx_fifo_write(), which
+	 * checks the mark again under the lock.
+	 */
+	key = k_spin_lock(&priv->lock);
+
+	if (atomic_test_bit(&priv->ep_disabling, ep_bit)) {
+		k_spin_unlock(&priv->lock, key);
+		return false;
+	}
+
+	buf = udc_buf_get(cfg);
+	next = udc_buf_peek(cfg);
+	if (next == NULL || cfg->stat.halted) {
+		next = NULL;
+		k_event_post(&priv->ep_disabled, BIT(ep_bit));
+	} else if (USB_EP_DIR_IS_OUT(cfg->addr)) {
+		dwc2_prep_rx(dev, next, cfg);
+	}
+
+	k_spin_unlock(&priv->lock, key);
+
+	if (next != NULL) {
+		if (USB_EP_DIR_IS_IN(cfg->addr)) {
+			err = dwc2_tx_fifo_write(dev, cfg, next);
+			if (err) {
+				k_event_post(&priv->ep_disabled, BIT(ep_bit));
+				udc_ep_set_busy(cfg, false);
+			}
+
+			if (err && err != -ECANCELED) {
+				/* Let the thread retry and report the error */
+				atomic_set_bit(&priv->xfer_new, ep_bit);
+				k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_XFER));
+			}
+		}
+	} else {
+		udc_ep_set_busy(cfg, false);
+
+		/* Buffer could have been queued after the peek above, but the
+		 * thread may have skipped it because endpoint was still busy.
+		 */
+		if (udc_buf_peek(cfg) != NULL && !cfg->stat.halted) {
+			atomic_set_bit(&priv->xfer_new, ep_bit);
+			k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_XFER));
+		}
+	}
+
+	if (udc_submit_ep_event(dev, buf, 0)) {
+		LOG_ERR("Failed to submit endpoint event");
+	}
+
+	return true;
+}
+
 static inline void dwc2_handle_in_xfercompl(const struct device *dev,
 					    const uint8_t ep_idx)
 {
@@ -2561,6 +2660,10 @@ static inline void dwc2_handle_in_xfercompl(const struct device *dev,
 		return;
 	}
 
+	if (buf->len == 0 && dwc2_isr_xfer_chain(dev, ep_cfg)) {
+		return;
+	}
+
 	atomic_set_bit(&priv->xfer_finished, ep_idx);
 	k_event_post(&priv->ep_disabled, BIT(ep_idx));
 	k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
@@ -2695,7 +2798,7 @@ static inline void dwc2_handle_out_xfercompl(const struct device *dev,
 	if (!is_iso && bcnt && (bcnt % udc_mps_ep_size(ep_cfg)) == 0 &&
 	    net_buf_tailroom(buf)) {
 		dwc2_prep_rx(dev, buf, ep_cfg);
-	} else {
+	} else if (!dwc2_isr_xfer_chain(dev, ep_cfg)) {
 		atomic_set_bit(&priv->xfer_finished, 16 + ep_idx);
 		k_event_post(&priv->ep_disabled, BIT(16 + ep_idx));
 		k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
@@ -338,6 +338,9 @@ static ALWAYS_INLINE void udc_vrt_thread_handler(void *arg)
 		case UVB_EVT_RESET:
 			err = udc_submit_event(dev, UDC_EVT_RESET, 0);
 			break;
+		case UVB_EVT_SOF:
+			udc_submit_sof_event(dev);
+			break;
 		case UVB_EVT_REQUEST:
 			err = vrt_handle_request(dev, vrt_ev->pkt);
 			break;
@@ -390,6 +393,8 @@ static void udc_vrt_uvb_cb(const void *const vrt_priv,
 	case UVB_EVT_RESUME:
 		__fallthrough;
 	case UVB_EVT_RESET:
+		__fallthrough;
+	case UVB_EVT_SOF:
 		if (udc_is_enabled(dev)) {
 			vrt_submit_uvb_event(dev, type, NULL);
 		}
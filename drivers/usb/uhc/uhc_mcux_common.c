@@ -263,6 +263,31 @@ static usb_host_pipe_handle uhc_mcux_check_hal_ep(const struct device *dev,
 	return mcux_ep;
 }
 
+static uint8_t uhc_mcux_get_pipe_type(const struct uhc_transfer *const xfer)
+{
+	const uint8_t ep_idx = USB_EP_GET_IDX(xfer->ep) & 0xF;
+	const struct usb_ep_descriptor *ep_desc;
+
+	if (USB_EP_DIR_IS_IN(xfer->ep)) {
+		ep_desc = xfer->udev->ep_in[ep_idx].desc;
+	} else {
+		ep_desc = xfer->udev->ep_out[ep_idx].desc;
+	}
+
+	if (ep_desc == NULL) {
+		return USB_ENDPOINT_BULK;
+	}
+
+	switch (ep_desc->bmAttributes & USB_EP_TRANSFER_TYPE_MASK) {
+	case USB_EP_TYPE_ISO:
+		return USB_ENDPOINT_ISOCHRONOUS;
+	case USB_EP_TYPE_INTERRUPT:
+		return USB_ENDPOINT_INTERRUPT;
+	default:
+		return USB_ENDPOINT_BULK;
+	}
+}
+
 usb_host_pipe_t *uhc_mcux_init_hal_ep(const struct device *dev, struct uhc_transfer *const xfer)
 {
 	usb_status_t status;
@@ -284,16 +309,15 @@ usb_host_pipe_t *uhc_mcux_init_hal_ep(const struct device *dev, struct uhc_trans
 	pipe_init.endpointAddress = USB_EP_GET_IDX(xfer->ep);
 	pipe_init.direction = USB_EP_GET_IDX(xfer->ep) == 0 ? USB_OUT :
 			      USB_EP_GET_DIR(xfer->ep) ? USB_IN : USB_OUT;
-	/* Current Zephyr Host stack is experimental, the endpoint's interval,
-	 * 'number per uframe' and the endpoint type cannot be got yet.
+	/* Current Zephyr Host stack is experimental, the endpoint's interval and
+	 * 'number per uframe' cannot be got yet.
 	 */
 	pipe_init.numberPerUframe = 0; /* TODO: need right way to implement it. */
 	pipe_init.interval = xfer->interval;
-	/* TODO: need right way to implement it. */
 	if (pipe_init.endpointAddress == 0) {
 		pipe_init.pipeType = USB_ENDPOINT_CONTROL;
 	} else {
-		pipe_init.pipeType = USB_ENDPOINT_BULK;
+		pipe_init.pipeType = uhc_mcux_get_pipe_type(xfer);
 	}
 
 	status = priv->mcux_if->controllerOpenPipe(priv->mcux_host.controllerHandle,
@@ -426,6 +426,8 @@ static void xfer_work_handler(struct k_work *work)
 		switch (ev->type) {
 		case UHC_VRT_EVT_SOF:
 			priv->frame_number++;
+			/* Devices miss a frame if there is no message left */
+			(void)uvb_advert(priv->host_node, UVB_EVT_SOF, NULL);
 			vrt_xfer_cleanup_cancelled(dev);
 			vrt_assemble_frame(dev);
 			schedule = true;
@@ -41,6 +41,10 @@ struct mem_block {
 
 static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
+/* Consumers holding each shared buffer, and where it returns once released */
+static atomic_t video_buf_refs[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
+static const struct device *video_buf_owner[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
+
 struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align, k_timeout_t timeout)
 {
 	struct video_buffer *vbuf = NULL;
@@ -99,6 +103,82 @@ void video_buffer_release(struct video_buffer *vbuf)
 	}
 }
 
+static int video_buffer_index(const struct video_buffer *vbuf)
+{
+	if (vbuf < video_buf || vbuf >= video_buf + ARRAY_SIZE(video_buf) ||
+	    vbuf->buffer == NULL) {
+		return -EINVAL;
+	}
+
+	return vbuf - video_buf;
+}
+
+int video_buffer_share(const struct device *dev, struct video_buffer *vbuf,
+		       unsigned int consumers)
+{
+	int i = video_buffer_index(vbuf);
+
+	if (i < 0 || consumers == 0) {
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&video_buf_refs[i], 0, consumers)) {
+		return -EBUSY;
+	}
+
+	/* Consumers get the buffer only once this returns */
+	video_buf_owner[i] = dev;
+
+	return 0;
+}
+
+int video_buffer_ref(struct video_buffer *vbuf)
+{
+	int i = video_buffer_index(vbuf);
+	atomic_val_t refs;
+
+	if (i < 0) {
+		return -EINVAL;
+	}
+
+	do {
+		refs = atomic_get(&video_buf_refs[i]);
+		if (refs == 0) {
+			return -EINVAL;
+		}
+	} while (!atomic_cas(&video_buf_refs[i], refs, refs + 1));
+
+	return 0;
+}
+
+int video_buffer_unref(struct video_buffer *vbuf)
+{
+	int i = video_buffer_index(vbuf);
+	atomic_val_t refs;
+
+	if (i < 0) {
+		return -EINVAL;
+	}
+
+	do {
+		refs = atomic_get(&video_buf_refs[i]);
+		if (refs == 0) {
+			return -EINVAL;
+		}
+	} while (!atomic_cas(&video_buf_refs[i], refs, refs - 1));
+
+	if (refs > 1) {
+		return 0;
+	}
+
+	if (video_buf_owner[i] == NULL) {
+		video_buffer_release(vbuf);
+		return 0;
+	}
+
+	return video_enqueue(video_buf_owner[i], vbuf);
+}
+
 int video_format_caps_index(const struct video_format_cap *fmts, const struct video_format *fmt,
 			    size_t *idx)
 {
@@ -157,6 +157,54 @@ int arch_dcache_flush_and_invd_range(void *addr, size_t size);
 #define cache_data_flush_and_invd_range(addr, size) \
 	arch_dcache_flush_and_invd_range(addr, size)
 
+#if defined(CONFIG_ARCH_HAS_DCACHE_RANGES) || defined(__DOXYGEN__)
+
+/**
+ * @brief Flush a list of address ranges in the d-cache
+ *
+ * Flush the specified address ranges of the data cache, issuing the barriers
+ * once for the whole list. The ranges are aligned on cache lines, sorted and
+ * do not overlap.
+ *
+ * The function must be implemented only when CONFIG_ARCH_HAS_DCACHE_RANGES is
+ * selected.
+ *
+ * @param ranges Address ranges to flush.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t count);
+
+/**
+ * @brief Invalidate a list of address ranges in the d-cache
+ *
+ * As arch_dcache_flush_ranges(), for invalidation.
+ *
+ * @param ranges Address ranges to invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t count);
+
+/**
+ * @brief Flush and Invalidate a list of address ranges in the d-cache
+ *
+ * As arch_dcache_flush_ranges(), for flushing and invalidation.
+ *
+ * @param ranges Address ranges to flush and invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t count);
+
+#endif /* CONFIG_ARCH_HAS_DCACHE_RANGES || __DOXYGEN__ */
+
 #if defined(CONFIG_DCACHE_LINE_SIZE_DETECT) || defined(__DOXYGEN__)
 
 /**
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API header file for the asynchronous sample rate converter
+ *
+ * The asynchronous sample rate converter (ASRC) resamples interleaved 16-bit
+ * PCM between two clock domains running at nominally the same rate, such as
+ * USB start of frame and a local I2S master clock, compensating for the
+ * drift between them.
+ */
+
+#ifndef ZEPHYR_INCLUDE_AUDIO_ASRC_H_
+#define ZEPHYR_INCLUDE_AUDIO_ASRC_H_
+
+/**
+ * @brief Asynchronous sample rate converter
+ *
+ * @defgroup audio_asrc_interface Asynchronous Sample Rate Converter
+ * @since 4.3
+ * @version 0.1.0
+ * @ingroup audio_interface
+ * @{
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/audio/pipeline.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of filter taps per polyphase branch. */
+#define AUDIO_ASRC_TAPS 8
+
+/** Fixed point representation of a resampling ratio of 1.0. */
+#define AUDIO_ASRC_RATIO_ONE (1U << 24)
+
+/**
+ * @brief Asynchronous sample rate converter state
+ *
+ * Must be initialized with audio_asrc_init() before use.
+ */
+struct audio_asrc {
+	/** @cond INTERNAL_HIDDEN */
+	/* Delay line, each channel stored twice for contiguous windows */
+	int16_t line[CONFIG_AUDIO_PIPELINE_ASRC_MAX_CHANNELS][2 * AUDIO_ASRC_TAPS];
+	uint32_t step;
+	uint32_t pos;
+	uint32_t in_frames;
+	uint32_t out_frames;
+	uint8_t channels;
+	uint8_t idx;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize an asynchronous sample rate converter
+ *
+ * @param asrc Converter to initialize.
+ * @param channels Number of interleaved channels.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Unsupported number of channels.
+ */
+int audio_asrc_init(struct audio_asrc *asrc, uint8_t channels);
+
+/**
+ * @brief Set the resampling ratio
+ *
+ * @param asrc Converter.
+ * @param ratio Input frames consumed per output frame, as a fixed point
+ *        value where @ref AUDIO_ASRC_RATIO_ONE is 1.0.
+ */
+void audio_asrc_set_ratio(struct audio_asrc *asrc, uint32_t ratio);
+
+/**
+ * @brief Get the current resampling ratio
+ *
+ * @param asrc Converter.
+ *
+ * @return Input frames consumed per output frame, as a fixed point value
+ *         where @ref AUDIO_ASRC_RATIO_ONE is 1.0.
+ */
+uint32_t audio_asrc_get_ratio(const struct audio_asrc *asrc);
+
+/**
+ * @brief Feed clock drift measurements to the converter
+ *
+ * To be called periodically, for example from the USB Audio Class start of
+ * frame callback, with the number of frames the input clock domain produced
+ * and the number of frames the output clock domain consumed since the last
+ * call. The output count is typically derived from the I2S DMA progress.
+ * Once CONFIG_AUDIO_PIPELINE_ASRC_DRIFT_WINDOW output frames have been
+ * accounted for, the measured ratio is blended into the resampling ratio.
+ *
+ * @param asrc Converter.
+ * @param in_frames Frames produced by the input clock domain.
+ * @param out_frames Frames consumed by the output clock domain.
+ */
+void audio_asrc_drift_update(struct audio_asrc *asrc, uint32_t in_frames, uint32_t out_frames);
+
+/**
+ * @brief Resample a block of interleaved samples
+ *
+ * All input frames are consumed. The number of output frames depends on the
+ * resampling ratio and is at most in_frames * AUDIO_ASRC_RATIO_ONE / ratio
+ * rounded up, plus one.
+ *
+ * @param asrc Converter.
+ * @param in Interleaved input samples.
+ * @param in_frames Number of input frames.
+ * @param out Interleaved output samples.
+ * @param out_frames Capacity of @p out in frames.
+ *
+ * @return Number of output frames written, or -ENOMEM if @p out is too small.
+ */
+int audio_asrc_process(struct audio_asrc *asrc, const int16_t *in, size_t in_frames,
+		       int16_t *out, size_t out_frames);
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct audio_pipeline_node_api audio_pipeline_asrc_api;
+
+struct audio_pipeline_asrc_config {
+	struct k_mem_slab *slab;
+};
+/** @endcond */
+
+/**
+ * @brief Statically define an ASRC pipeline processing node
+ *
+ * Each block is resampled into a new block allocated from @p _slab, whose
+ * block size must leave room for at least one frame more than the input
+ * blocks carry. The input block is freed afterwards.
+ *
+ * @param _name Name of the node.
+ * @param _asrc Pointer to an initialized @ref audio_asrc.
+ * @param _slab Memory slab for the output blocks.
+ */
+#define AUDIO_PIPELINE_ASRC_DEFINE(_name, _asrc, _slab)                                            \
+	static const struct audio_pipeline_asrc_config _CONCAT(_name, _config) = {                 \
+		.slab = _slab,                                                                     \
+	};                                                                                         \
+	AUDIO_PIPELINE_NODE_DEFINE(_name, &audio_pipeline_asrc_api, &_CONCAT(_name, _config),     \
+				   _asrc)
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_AUDIO_ASRC_H_ */
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API header file for the audio mixer
+ *
+ * The mixer sums several interleaved PCM streams with the same number of
+ * channels into one, for instance notifications, music and voice prompts
+ * into a single I2S stream. Each input has its own gain, changed with a
+ * linear ramp, and its own sample format.
+ */
+
+#ifndef ZEPHYR_INCLUDE_AUDIO_MIXER_H_
+#define ZEPHYR_INCLUDE_AUDIO_MIXER_H_
+
+/**
+ * @brief Audio mixer
+ *
+ * @defgroup audio_mixer_interface Audio Mixer
+ * @since 4.3
+ * @version 0.1.0
+ * @ingroup audio_interface
+ * @{
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/audio/pipeline.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Gain of 1.0, the largest gain of a mixer input. */
+#define AUDIO_MIXER_GAIN_UNITY INT32_MAX
+
+/**
+ * @brief Sample formats of the mixer inputs and output
+ */
+enum audio_mixer_format {
+	/** Signed 16-bit samples. */
+	AUDIO_MIXER_FMT_S16,
+	/** Signed 24-bit samples packed in 3 bytes, little endian. */
+	AUDIO_MIXER_FMT_S24,
+	/** Signed 32-bit samples. */
+	AUDIO_MIXER_FMT_S32,
+};
+
+/**
+ * @brief Mixer input
+ *
+ * The producer writes whole frames to the ring buffer of the input, with
+ * audio_mixer_input_write() or directly with the ring buffer API, and the
+ * mixer consumes them. With a single producer per input neither side takes
+ * a lock, so the producer can run in ISR context and is never blocked by
+ * the mixer. Must be initialized with audio_mixer_input_init() before use.
+ */
+struct audio_mixer_input {
+	/** @cond INTERNAL_HIDDEN */
+	struct ring_buf *ring;
+	atomic_t gain_req;
+	atomic_t ramp_req;
+	int32_t gain;
+	int32_t target;
+	int32_t step;
+	uint32_t ramp_chunks;
+	uint32_t underruns;
+	enum audio_mixer_format format;
+	bool active;
+	/** @endcond */
+};
+
+/**
+ * @brief Mixer state
+ *
+ * Must be initialized with audio_mixer_init() before use.
+ */
+struct audio_mixer {
+	/** @cond INTERNAL_HIDDEN */
+	struct audio_mixer_input *inputs;
+	int32_t acc[CONFIG_AUDIO_PIPELINE_MIXER_CHUNK_SAMPLES];
+	int32_t tmp[CONFIG_AUDIO_PIPELINE_MIXER_CHUNK_SAMPLES];
+	uint32_t raw[CONFIG_AUDIO_PIPELINE_MIXER_CHUNK_SAMPLES];
+	uint8_t num_inputs;
+	uint8_t channels;
+	enum audio_mixer_format format;
+	/** @endcond */
+};
+
+/**
+ * @brief Get the size of a sample
+ *
+ * @param format Sample format.
+ *
+ * @return Size of one sample in bytes.
+ */
+static inline size_t audio_mixer_sample_size(enum audio_mixer_format format)
+{
+	return format == AUDIO_MIXER_FMT_S16 ? 2 : (format == AUDIO_MIXER_FMT_S24 ? 3 : 4);
+}
+
+/**
+ * @brief Initialize a mixer input
+ *
+ * The input starts with unity gain.
+ *
+ * @param input Input to initialize.
+ * @param ring Ring buffer the input frames are written to.
+ * @param format Sample format of the input.
+ */
+void audio_mixer_input_init(struct audio_mixer_input *input, struct ring_buf *ring,
+			    enum audio_mixer_format format);
+
+/**
+ * @brief Initialize a mixer
+ *
+ * @param mixer Mixer to initialize.
+ * @param inputs Initialized inputs of the mixer.
+ * @param num_inputs Number of elements in @p inputs.
+ * @param channels Number of interleaved channels of the inputs and output.
+ * @param format Sample format of the output.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Unsupported number of channels.
+ */
+int audio_mixer_init(struct audio_mixer *mixer, struct audio_mixer_input *inputs,
+		     uint8_t num_inputs, uint8_t channels, enum audio_mixer_format format);
+
+/**
+ * @brief Write frames to a mixer input
+ *
+ * Writes as many whole frames as fit in the ring buffer, without waiting.
+ * Can be called from ISR context, but only from one context per input.
+ *
+ * @param mixer Mixer the input belongs to.
+ * @param input Mixer input.
+ * @param data Interleaved frames in the format of the input.
+ * @param size Size of @p data in bytes.
+ *
+ * @return Number of bytes written.
+ */
+size_t audio_mixer_input_write(const struct audio_mixer *mixer, struct audio_mixer_input *input,
+			       const void *data, size_t size);
+
+/**
+ * @brief Set the gain of a mixer input
+ *
+ * The gain moves linearly from its current value to @p gain over
+ * @p ramp_frames frames, in steps of
+ * CONFIG_AUDIO_PIPELINE_MIXER_CHUNK_SAMPLES samples. Can be called from
+ * any context, the mixer picks up the new gain at its next chunk.
+ *
+ * @param input Mixer input.
+ * @param gain New gain, from 0 to @ref AUDIO_MIXER_GAIN_UNITY.
+ * @param ramp_frames Duration of the ramp in frames, 0 to apply the gain
+ *        at once.
+ */
+void audio_mixer_set_gain(struct audio_mixer_input *input, int32_t gain, uint32_t ramp_frames);
+
+/**
+ * @brief Get the number of mixer input underruns
+ *
+ * An underrun is counted each time the input runs dry, that is when the
+ * mixer has to fill missing frames with silence after the input delivered
+ * data. An input that stays empty is idle and not counted again.
+ *
+ * @param input Mixer input.
+ *
+ * @return Number of underruns since the input was initialized.
+ */
+static inline uint32_t audio_mixer_input_underruns(const struct audio_mixer_input *input)
+{
+	return input->underruns;
+}
+
+/**
+ * @brief Mix a block of frames
+ *
+ * Consumes up to @p frames frames from each input, missing frames count as
+ * silence, and writes their saturated sum to @p out.
+ *
+ * @param mixer Mixer.
+ * @param out Interleaved output samples in the output format.
+ * @param frames Number of output frames.
+ */
+void audio_mixer_process(struct audio_mixer *mixer, void *out, size_t frames);
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct audio_pipeline_node_api audio_pipeline_mixer_api;
+
+struct audio_pipeline_mixer_config {
+	struct k_mem_slab *slab;
+	k_timeout_t timeout;
+};
+/** @endcond */
+
+/**
+ * @brief Statically define a mixer pipeline source node
+ *
+ * Each pulled block is allocated from @p _slab and filled with as many
+ * frames as it holds. The inputs do not pace the pipeline, the sink does,
+ * for instance by using the I2S TX memory slab as @p _slab.
+ *
+ * @param _name Name of the node.
+ * @param _mixer Pointer to an initialized @ref audio_mixer.
+ * @param _slab Memory slab for the output blocks.
+ * @param _timeout Time the pipeline waits for a free block, e.g. K_FOREVER.
+ */
+#define AUDIO_PIPELINE_MIXER_DEFINE(_name, _mixer, _slab, _timeout)                                \
+	static const struct audio_pipeline_mixer_config _CONCAT(_name, _config) = {                \
+		.slab = _slab,                                                                     \
+		.timeout = _timeout,                                                               \
+	};                                                                                         \
+	AUDIO_PIPELINE_NODE_DEFINE(_name, &audio_pipeline_mixer_api, &_CONCAT(_name, _config),    \
+				   _mixer)
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_AUDIO_MIXER_H_ */
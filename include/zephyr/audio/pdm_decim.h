@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API header file for the PDM to PCM decimator
+ *
+ * The decimator converts raw pulse density modulated bit streams, as
+ * captured from digital microphones over I2S, SPI or TDM, into 16-bit PCM.
+ * It is meant for microphone arrays with more channels than the hardware
+ * PDM interfaces provide.
+ */
+
+#ifndef ZEPHYR_INCLUDE_AUDIO_PDM_DECIM_H_
+#define ZEPHYR_INCLUDE_AUDIO_PDM_DECIM_H_
+
+/**
+ * @brief PDM to PCM decimator
+ *
+ * @defgroup audio_pdm_decim_interface PDM to PCM decimator
+ * @since 4.3
+ * @version 0.1.0
+ * @ingroup audio_interface
+ * @{
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Order of the CIC filter. */
+#define AUDIO_PDM_DECIM_CIC_ORDER 4
+
+/** Number of taps of the final half band filter. */
+#define AUDIO_PDM_DECIM_HB_TAPS 31
+
+/**
+ * @brief Compute the size of a raw PDM block
+ *
+ * @param pcm_frames Number of PCM frames the block decimates to.
+ * @param channels Number of channels.
+ * @param decimation Decimation factor.
+ *
+ * @return Size of the raw PDM block in bytes.
+ */
+#define AUDIO_PDM_DECIM_RAW_SIZE(pcm_frames, channels, decimation)                                \
+	((pcm_frames) * (channels) * (decimation) / 8)
+
+/**
+ * @brief PDM to PCM decimator state
+ *
+ * Must be initialized with audio_pdm_decim_init() before use.
+ */
+struct audio_pdm_decim {
+	/** @cond INTERNAL_HIDDEN */
+	struct {
+		int32_t integ[AUDIO_PDM_DECIM_CIC_ORDER];
+		int32_t comb[AUDIO_PDM_DECIM_CIC_ORDER];
+		/* Previous bytes of the bit stream, most recent first */
+		uint8_t hist[AUDIO_PDM_DECIM_CIC_ORDER - 1];
+		/* Half band delay line, stored twice for contiguous windows */
+		int16_t line[2 * AUDIO_PDM_DECIM_HB_TAPS];
+	} chan[CONFIG_AUDIO_PDM_DECIM_MAX_CHANNELS];
+	uint8_t channels;
+	uint8_t cic_bytes;
+	uint8_t cic_count;
+	uint8_t shift;
+	uint8_t hb_idx;
+	uint8_t hb_phase;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a PDM to PCM decimator
+ *
+ * The decimation is split between a fourth order CIC filter and a final
+ * half band FIR decimating by two.
+ *
+ * @param decim Decimator to initialize.
+ * @param channels Number of interleaved channels.
+ * @param decimation Ratio between the PDM clock and the PCM sample rate,
+ *        32, 64 or 128.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Unsupported number of channels or decimation factor.
+ */
+int audio_pdm_decim_init(struct audio_pdm_decim *decim, uint8_t channels, uint16_t decimation);
+
+/**
+ * @brief Clear the filter history of a decimator
+ *
+ * To be called when the bit stream is restarted.
+ *
+ * @param decim Decimator.
+ */
+void audio_pdm_decim_reset(struct audio_pdm_decim *decim);
+
+/**
+ * @brief Decimate a block of raw PDM data
+ *
+ * The input is byte interleaved: each group of @p channels bytes holds the
+ * next 8 bits of every channel in turn, the earliest bit being the most
+ * significant one. A set bit is a positive pulse. Full scale PDM density
+ * maps to full scale PCM.
+ *
+ * @param decim Decimator.
+ * @param pdm Raw PDM data.
+ * @param len Size of @p pdm in bytes, a multiple of the number of channels.
+ * @param pcm Interleaved 16-bit output samples.
+ * @param pcm_frames Capacity of @p pcm in frames.
+ *
+ * @return Number of output frames written, -EINVAL if @p len is not a
+ *         multiple of the number of channels or -ENOMEM if @p pcm is too
+ *         small.
+ */
+int audio_pdm_decim_process(struct audio_pdm_decim *decim, const uint8_t *pdm, size_t len,
+			    int16_t *pcm, size_t pcm_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_AUDIO_PDM_DECIM_H_ */
@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API header file for the audio pipeline subsystem
+ *
+ * The audio pipeline connects audio sources, processing stages and sinks
+ * into statically defined chains. Memory blocks are passed by reference
+ * along the chain, and all pipelines sharing a clock domain are run from a
+ * single thread.
+ */
+
+#ifndef ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_
+#define ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_
+
+/**
+ * @brief Audio pipeline
+ *
+ * @defgroup audio_pipeline_interface Audio Pipeline
+ * @since 4.3
+ * @version 0.1.0
+ * @ingroup audio_interface
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/pm/policy.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Reference to a block of audio data
+ *
+ * The data is owned by whoever holds the reference. When @ref slab is set
+ * the data is a block of that memory slab and is returned to it with
+ * audio_block_free().
+ */
+struct audio_block {
+	/** Pointer to the audio data. */
+	void *data;
+	/** Number of valid bytes at @ref data. */
+	size_t size;
+	/** Memory slab the data was allocated from, or NULL. */
+	struct k_mem_slab *slab;
+};
+
+struct audio_pipeline_node;
+
+/**
+ * @brief Audio pipeline node operations
+ *
+ * A source node implements @ref pull, a processing node implements
+ * @ref process and a sink node implements @ref push. @ref start and
+ * @ref stop are optional for all node types.
+ */
+struct audio_pipeline_node_api {
+	/**
+	 * @brief Produce the next block
+	 *
+	 * May block until data is available. On success ownership of the
+	 * block passes to the pipeline.
+	 */
+	int (*pull)(const struct audio_pipeline_node *node, struct audio_block *block);
+	/**
+	 * @brief Process a block in place
+	 *
+	 * The node may replace the block with another one, in which case it
+	 * is responsible for freeing the original block.
+	 */
+	int (*process)(const struct audio_pipeline_node *node, struct audio_block *block);
+	/**
+	 * @brief Consume a block
+	 *
+	 * Ownership of the block passes to the sink, including when an error
+	 * is returned.
+	 */
+	int (*push)(const struct audio_pipeline_node *node, struct audio_block *block);
+	/** Start the node, called before the domain thread starts. */
+	int (*start)(const struct audio_pipeline_node *node);
+	/** Stop the node, called when the domain is stopped. */
+	int (*stop)(const struct audio_pipeline_node *node);
+};
+
+/**
+ * @brief Audio pipeline node
+ */
+struct audio_pipeline_node {
+	/** Name of the node. */
+	const char *name;
+	/** Node operations. */
+	const struct audio_pipeline_node_api *api;
+	/** Node specific configuration. */
+	const void *config;
+	/** Node specific runtime data. */
+	void *data;
+};
+
+/**
+ * @brief Audio pipeline statistics
+ */
+struct audio_pipeline_stats {
+	/** Number of blocks delivered to the sink. */
+	uint32_t blocks;
+	/** Number of blocks dropped because a node returned an error. */
+	uint32_t errors;
+};
+
+/**
+ * @brief Linear chain of audio pipeline nodes
+ *
+ * The first node is the source, the last node the sink and any nodes in
+ * between process the blocks in order.
+ */
+struct audio_pipeline {
+	/** Name of the pipeline. */
+	const char *name;
+	/** Nodes of the pipeline, from source to sink. */
+	const struct audio_pipeline_node *const *nodes;
+	/** Number of nodes in @ref nodes. */
+	size_t num_nodes;
+	/** Pipeline statistics. */
+	struct audio_pipeline_stats stats;
+	/** @cond INTERNAL_HIDDEN */
+	bool active;
+	/** @endcond */
+};
+
+/**
+ * @brief Set of pipelines run by one thread
+ *
+ * All pipelines of a domain must share the same clock, as a single thread
+ * runs them one block at a time in turn.
+ */
+struct audio_pipeline_domain {
+	/** Name of the domain. */
+	const char *name;
+	/** Pipelines of the domain. */
+	struct audio_pipeline *const *pipelines;
+	/** Number of pipelines in @ref pipelines. */
+	size_t num_pipelines;
+	/** @cond INTERNAL_HIDDEN */
+	k_thread_stack_t *stack;
+	size_t stack_size;
+	int priority;
+	struct k_thread *thread;
+	atomic_t running;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_AUDIO_PIPELINE_REF(_node) &_node
+
+/* K_MSGQ_DEFINE() pastes its name, so it must be expanded first */
+#define Z_AUDIO_PIPELINE_MSGQ_DEFINE(_msgq, _depth)                                                \
+	K_MSGQ_DEFINE(_msgq, sizeof(struct audio_block), _depth, 4)
+/** @endcond */
+
+/**
+ * @brief Statically define an audio pipeline node
+ *
+ * @param _name Name of the node.
+ * @param _api Pointer to the node operations.
+ * @param _config Pointer to the node configuration, or NULL.
+ * @param _data Pointer to the node runtime data, or NULL.
+ */
+#define AUDIO_PIPELINE_NODE_DEFINE(_name, _api, _config, _data)                                    \
+	const struct audio_pipeline_node _name = {                                                 \
+		.name = STRINGIFY(_name),                                                          \
+		.api = _api,                                                                       \
+		.config = _config,                                                                 \
+		.data = _data,                                                                     \
+	}
+
+/**
+ * @brief Statically define an audio pipeline
+ *
+ * @param _name Name of the pipeline.
+ * @param ... Nodes of the pipeline, a source node followed by zero or more
+ *            processing nodes and a sink node.
+ */
+#define AUDIO_PIPELINE_DEFINE(_name, ...)                                                          \
+	BUILD_ASSERT(NUM_VA_ARGS(__VA_ARGS__) >= 2,                                                \
+		     "An audio pipeline needs at least a source and a sink");                     \
+	static const struct audio_pipeline_node *const _CONCAT(_name, _nodes)[] = {                \
+		FOR_EACH(Z_AUDIO_PIPELINE_REF, (,), __VA_ARGS__)                                   \
+	};                                                                                         \
+	struct audio_pipeline _name = {                                                            \
+		.name = STRINGIFY(_name),                                                          \
+		.nodes = _CONCAT(_name, _nodes),                                                   \
+		.num_nodes = ARRAY_SIZE(_CONCAT(_name, _nodes)),                                   \
+	}
+
+/**
+ * @brief Statically define an audio pipeline clock domain
+ *
+ * @param _name Name of the domain.
+ * @param _stack_size Stack size of the domain thread.
+ * @param _prio Priority of the domain thread.
+ * @param ... Pipelines run by the domain.
+ */
+#define AUDIO_PIPELINE_DOMAIN_DEFINE(_name, _stack_size, _prio, ...)                               \
+	static K_THREAD_STACK_DEFINE(_CONCAT(_name, _stack), _stack_size);                         \
+	static struct k_thread _CONCAT(_name, _thread);                                            \
+	static struct audio_pipeline *const _CONCAT(_name, _pipelines)[] = {                       \
+		FOR_EACH(Z_AUDIO_PIPELINE_REF, (,), __VA_ARGS__)                                   \
+	};                                                                                         \
+	struct audio_pipeline_domain _name = {                                                     \
+		.name = STRINGIFY(_name),                                                          \
+		.pipelines = _CONCAT(_name, _pipelines),                                           \
+		.num_pipelines = ARRAY_SIZE(_CONCAT(_name, _pipelines)),                           \
+		.stack = _CONCAT(_name, _stack),                                                   \
+		.stack_size = K_THREAD_STACK_SIZEOF(_CONCAT(_name, _stack)),                       \
+		.priority = _prio,                                                                 \
+		.thread = &_CONCAT(_name, _thread),                                                \
+	}
+
+/**
+ * @brief Return an audio block to its memory slab
+ *
+ * @param block Block to free. Blocks without a memory slab are ignored.
+ */
+static inline void audio_block_free(struct audio_block *block)
+{
+	if (block->slab != NULL && block->data != NULL) {
+		k_mem_slab_free(block->slab, block->data);
+	}
+
+	block->data = NULL;
+	block->size = 0;
+}
+
+/**
+ * @brief Start an audio pipeline domain
+ *
+ * Starts every node of every pipeline of the domain, sinks first, then
+ * starts the domain thread.
+ *
+ * @param domain Domain to start.
+ *
+ * @retval 0 If successful.
+ * @retval -EALREADY The domain is already running.
+ * @retval -errno Error returned by a node start operation.
+ */
+int audio_pipeline_domain_start(struct audio_pipeline_domain *domain);
+
+/**
+ * @brief Stop an audio pipeline domain
+ *
+ * Stops every node of every pipeline of the domain, sources first, and
+ * waits for the domain thread to exit. The blocks left in the queue sources
+ * are then freed. On return the domain thread is gone, so the domain can be
+ * started again.
+ *
+ * @param domain Domain to stop.
+ * @param timeout Time to wait for the domain thread to exit.
+ *
+ * @retval 0 If successful.
+ * @retval -EALREADY The domain is not running.
+ * @retval -EAGAIN The domain thread did not exit in time and was aborted. A
+ *         block it was processing may be lost.
+ */
+int audio_pipeline_domain_stop(struct audio_pipeline_domain *domain, k_timeout_t timeout);
+
+/**
+ * @brief Run one block through an audio pipeline
+ *
+ * This is what the domain thread does for each of its pipelines. It is
+ * exposed for applications running pipelines from their own thread.
+ *
+ * @param pipeline Pipeline to run.
+ *
+ * @retval 0 If a block was delivered to the sink.
+ * @retval -errno Error returned by one of the nodes.
+ */
+int audio_pipeline_run_once(struct audio_pipeline *pipeline);
+
+/**
+ * @name Queue source node
+ *
+ * Source node fed from another context, such as a USB Audio Class data
+ * received callback, through audio_pipeline_queue_put().
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct audio_pipeline_node_api audio_pipeline_queue_api;
+
+struct audio_pipeline_queue_config {
+	struct k_msgq *msgq;
+	k_timeout_t timeout;
+};
+/** @endcond */
+
+/**
+ * @brief Statically define a queue source node
+ *
+ * @param _name Name of the node.
+ * @param _depth Number of block references the queue can hold.
+ * @param _timeout Time the pipeline waits for a block, e.g. K_FOREVER.
+ */
+#define AUDIO_PIPELINE_QUEUE_SOURCE_DEFINE(_name, _depth, _timeout)                                \
+	Z_AUDIO_PIPELINE_MSGQ_DEFINE(_CONCAT(_name, _msgq), _depth);                               \
+	static const struct audio_pipeline_queue_config _CONCAT(_name, _config) = {                \
+		.msgq = &_CONCAT(_name, _msgq),                                                    \
+		.timeout = _timeout,                                                               \
+	};                                                                                         \
+	AUDIO_PIPELINE_NODE_DEFINE(_name, &audio_pipeline_queue_api, &_CONCAT(_name, _config),    \
+				   NULL)
+
+/**
+ * @brief Hand a block to a queue source node
+ *
+ * Can be called from ISR context with @p timeout set to K_NO_WAIT. On
+ * success ownership of the block passes to the pipeline.
+ *
+ * @param node Queue source node.
+ * @param block Block to queue.
+ * @param timeout Time to wait for room in the queue.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int audio_pipeline_queue_put(const struct audio_pipeline_node *node,
+			     const struct audio_block *block, k_timeout_t timeout);
+
+/** @} */
+
+#if defined(CONFIG_AUDIO_PIPELINE_I2S) || defined(__DOXYGEN__)
+/**
+ * @name I2S nodes
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct audio_pipeline_node_api audio_pipeline_i2s_source_api;
+extern const struct audio_pipeline_node_api audio_pipeline_i2s_sink_api;
+
+struct audio_pipeline_i2s_config {
+	const struct device *dev;
+	uint8_t prefill;
+};
+
+struct audio_pipeline_i2s_data {
+	uint8_t queued;
+	bool started;
+#ifdef CONFIG_AUDIO_PIPELINE_I2S_PM
+	struct pm_policy_stream pm;
+	uint32_t block_us;
+#endif
+};
+/** @endcond */
+
+/**
+ * @brief Statically define an I2S RX source node
+ *
+ * The I2S RX stream must be configured before the domain is started.
+ *
+ * @param _name Name of the node.
+ * @param _dev I2S device.
+ */
+#define AUDIO_PIPELINE_I2S_SOURCE_DEFINE(_name, _dev)                                              \
+	static const struct audio_pipeline_i2s_config _CONCAT(_name, _config) = {                  \
+		.dev = _dev,                                                                       \
+	};                                                                                         \
+	AUDIO_PIPELINE_NODE_DEFINE(_name, &audio_pipeline_i2s_source_api,                          \
+				   &_CONCAT(_name, _config), NULL)
+
+/**
+ * @brief Statically define an I2S TX sink node
+ *
+ * The I2S TX stream must be configured before the domain is started. The
+ * stream is started once @p _prefill blocks have been queued. Blocks
+ * coming from the TX memory slab are queued without copying, others are
+ * copied into a TX memory slab block.
+ *
+ * @param _name Name of the node.
+ * @param _dev I2S device.
+ * @param _prefill Number of blocks to queue before starting the stream.
+ */
+#define AUDIO_PIPELINE_I2S_SINK_DEFINE(_name, _dev, _prefill)                                      \
+	static const struct audio_pipeline_i2s_config _CONCAT(_name, _config) = {                  \
+		.dev = _dev,                                                                       \
+		.prefill = _prefill,                                                               \
+	};                                                                                         \
+	static struct audio_pipeline_i2s_data _CONCAT(_name, _data);                               \
+	AUDIO_PIPELINE_NODE_DEFINE(_name, &audio_pipeline_i2s_sink_api, &_CONCAT(_name, _config), \
+				   &_CONCAT(_name, _data))
+
+/** @} */
+#endif /* CONFIG_AUDIO_PIPELINE_I2S */
+
+#if defined(CONFIG_AUDIO_PIPELINE_DMIC) || defined(__DOXYGEN__)
+/**
+ * @name DMIC nodes
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct audio_pipeline_node_api audio_pipeline_dmic_source_api;
+
+struct audio_pipeline_dmic_config {
+	const struct device *dev;
+	struct k_mem_slab *slab;
+	uint8_t stream;
+	int32_t timeout;
+};
+/** @endcond */
+
+/**
+ * @brief Statically define a DMIC source node
+ *
+ * The DMIC must be configured before the domain is started.
+ *
+ * @param _name Name of the node.
+ * @param _dev DMIC device.
+ * @param _stream DMIC stream number.
+ * @param _slab Memory slab configured for the DMIC stream.
+ * @param _timeout Read timeout in milliseconds.
+ */
+#define AUDIO_PIPELINE_DMIC_SOURCE_DEFINE(_name, _dev, _stream, _slab, _timeout)                   \
+	static const struct audio_pipeline_dmic_config _CONCAT(_name, _config) = {                 \
+		.dev = _dev,                                                                       \
+		.slab = _slab,                                                                     \
+		.stream = _stream,                                                                 \
+		.timeout = _timeout,                                                               \
+	};                                                                                         \
+	AUDIO_PIPELINE_NODE_DEFINE(_name, &audio_pipeline_dmic_source_api,                         \
+				   &_CONCAT(_name, _config), NULL)
+
+/** @} */
+#endif /* CONFIG_AUDIO_PIPELINE_DMIC */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_ */
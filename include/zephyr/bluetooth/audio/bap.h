@@ -2437,6 +2437,16 @@ int bt_bap_broadcast_source_get_base(struct bt_bap_broadcast_source *source,
  * @{
  */
 
+/** @brief SDU of one stream of a BIG event, see @ref bt_bap_broadcast_sink_cb.recv */
+struct bt_bap_broadcast_sink_sdu {
+	/** The stream the SDU was received on */
+	struct bt_bap_stream *stream;
+	/** The SDU, or NULL if none was received for the BIG event */
+	struct net_buf *buf;
+	/** Metadata of the SDU, only valid if buf is not NULL */
+	struct bt_iso_recv_info info;
+};
+
 /** Broadcast Audio Sink callback structure */
 struct bt_bap_broadcast_sink_cb {
 	/**
@@ -2482,6 +2492,29 @@ struct bt_bap_broadcast_sink_cb {
 	 */
 	void (*stopped)(struct bt_bap_broadcast_sink *sink, uint8_t reason);
 
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV) || defined(__DOXYGEN__)
+	/**
+	 * @brief The SDUs of a BIG event have been received
+	 *
+	 * Called once per BIG event with the SDUs of all streams of the Broadcast Sink. The
+	 * recv callback of the streams is not called while this callback is registered.
+	 *
+	 * The @p info flags contain @ref BT_ISO_FLAGS_VALID only if every SDU is valid, and
+	 * @ref BT_ISO_FLAGS_ERROR or @ref BT_ISO_FLAGS_LOST if any SDU is in error or lost,
+	 * including SDUs that were not received at all.
+	 *
+	 * Only available when @kconfig{CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV} is enabled.
+	 *
+	 * @param sink  The Broadcast Sink the SDUs were received on.
+	 * @param info  Sequence number, timestamp and combined flags of the SDUs.
+	 * @param sdus  The SDUs, in the order of the streams given to
+	 *              bt_bap_broadcast_sink_sync().
+	 * @param count Number of elements in @p sdus.
+	 */
+	void (*recv)(struct bt_bap_broadcast_sink *sink, const struct bt_iso_recv_info *info,
+		     const struct bt_bap_broadcast_sink_sdu *sdus, size_t count);
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
+
 	/** @cond INTERNAL_HIDDEN */
 	/** Internally used list node */
 	sys_snode_t _node;
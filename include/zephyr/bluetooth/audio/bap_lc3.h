@@ -0,0 +1,237 @@
+/**
+ * @file
+ * @brief Bluetooth Basic Audio Profile (BAP) LC3 stream APIs.
+ */
+
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_BLUETOOTH_AUDIO_BAP_LC3_H_
+#define ZEPHYR_INCLUDE_BLUETOOTH_AUDIO_BAP_LC3_H_
+
+/**
+ * @brief BAP LC3 stream
+ *
+ * @defgroup bt_bap_lc3 BAP LC3 stream
+ *
+ * @since 4.3
+ * @version 0.1.0
+ *
+ * @ingroup bluetooth
+ * @{
+ *
+ * A BAP LC3 stream wraps a BAP stream and runs the LC3 codec for it, so that the application
+ * deals with PCM samples instead of encoded SDUs. The codec is configured from the codec
+ * configuration of the stream when it starts. A stream able to send asks the application for
+ * PCM and sends an SDU every time the previous one has been sent, a stream able to receive
+ * decodes every received SDU, using packet loss concealment for missing or invalid ones.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/bluetooth/audio/bap.h>
+#include <zephyr/bluetooth/iso.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_BT_BAP_LC3)
+#include <lc3.h>
+#endif /* CONFIG_BT_BAP_LC3 */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of PCM samples of one channel in one LC3 frame */
+#define BT_BAP_LC3_FRAME_SAMPLES_MAX 480
+
+/** Maximum number of octets of one LC3 frame */
+#define BT_BAP_LC3_FRAME_OCTETS_MAX 400
+
+struct bt_bap_lc3_stream;
+struct bt_bap_lc3_pcm_group;
+
+/** @brief LC3 stream operations. */
+struct bt_bap_lc3_stream_ops {
+	/**
+	 * @brief PCM for an SDU is needed.
+	 *
+	 * Called once per frame block of an SDU to be sent.
+	 *
+	 * @param stream  Stream object.
+	 * @param pcm     Buffer to fill with @p samples samples of every channel, interleaved.
+	 * @param samples Number of samples per channel.
+	 *
+	 * @return 0 to send the SDU, or a negative value to skip it.
+	 */
+	int (*pcm_get)(struct bt_bap_lc3_stream *stream, int16_t *pcm, size_t samples);
+
+	/**
+	 * @brief PCM of an SDU has been decoded.
+	 *
+	 * Called once per frame block of a received SDU.
+	 *
+	 * @param stream  Stream object.
+	 * @param info    Metadata of the received SDU.
+	 * @param pcm     Decoded samples of every channel, interleaved.
+	 * @param samples Number of samples per channel.
+	 */
+	void (*pcm_recv)(struct bt_bap_lc3_stream *stream, const struct bt_iso_recv_info *info,
+			 const int16_t *pcm, size_t samples);
+};
+
+/**
+ * @brief PCM shared by several sending LC3 streams.
+ *
+ * The streams of a group encode the same PCM, e.g. the subgroups of a broadcast source sending
+ * the same audio at different bitrates. The PCM of an SDU is then requested once from the group
+ * instead of once per stream. Streams are matched by the sequence number of their SDUs, which is
+ * the same for streams started together, like the streams of a broadcast source.
+ *
+ * Streams with other PCM parameters than the group, or with more than one frame block per SDU,
+ * request their PCM from their own @ref bt_bap_lc3_stream_ops.pcm_get instead.
+ */
+struct bt_bap_lc3_pcm_group {
+	/**
+	 * @brief PCM for an SDU of the group is needed.
+	 *
+	 * @param group   Group object.
+	 * @param pcm     Buffer to fill with @p samples samples of every channel, interleaved.
+	 * @param samples Number of samples per channel.
+	 *
+	 * @return 0 to send the SDUs, or a negative value to skip them.
+	 */
+	int (*pcm_get)(struct bt_bap_lc3_pcm_group *group, int16_t *pcm, size_t samples);
+
+	/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_BT_BAP_LC3)
+	struct k_mutex mutex;
+	uint32_t freq_hz;
+	uint16_t frame_dur_us;
+	uint8_t chan_cnt;
+	bool valid;
+	int err;
+	uint16_t seq_num;
+	int16_t pcm[BT_BAP_LC3_FRAME_SAMPLES_MAX * CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX];
+#endif /* CONFIG_BT_BAP_LC3 */
+	/** @endcond */
+};
+
+/** @brief BAP stream with an LC3 codec. */
+struct bt_bap_lc3_stream {
+	/** The underlying BAP audio stream */
+	struct bt_bap_stream bap_stream;
+
+	/** Audio stream operations, called after the LC3 stream handled them */
+	struct bt_bap_stream_ops *ops;
+
+	/** LC3 stream operations */
+	const struct bt_bap_lc3_stream_ops *lc3_ops;
+
+	/** Pool the SDUs are allocated from */
+	struct net_buf_pool *pool;
+
+	/** PCM group the stream gets its PCM from, may be NULL */
+	struct bt_bap_lc3_pcm_group *pcm_group;
+
+	/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_BT_BAP_LC3)
+	uint32_t freq_hz;
+	uint16_t frame_dur_us;
+	uint16_t octets_per_frame;
+	uint8_t frame_blocks_per_sdu;
+	uint8_t chan_cnt;
+	bool tx;
+	bool started;
+	uint16_t seq_num;
+	union {
+		lc3_encoder_t encoder[CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX];
+		lc3_decoder_t decoder[CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX];
+	};
+	union {
+		lc3_encoder_mem_48k_t encoder_mem[CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX];
+		lc3_decoder_mem_48k_t decoder_mem[CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX];
+	};
+	int16_t pcm[BT_BAP_LC3_FRAME_SAMPLES_MAX * CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX];
+#if defined(CONFIG_BT_ISO_RX_FRAG_CHAIN)
+	uint8_t frame[BT_BAP_LC3_FRAME_OCTETS_MAX];
+#endif /* CONFIG_BT_ISO_RX_FRAG_CHAIN */
+#endif /* CONFIG_BT_BAP_LC3 */
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize an LC3 stream.
+ *
+ * Registers the LC3 stream as the operations of its BAP stream. The BAP stream shall not be
+ * given other operations with bt_bap_stream_cb_register() afterwards, @p ops is called instead.
+ *
+ * @param stream  Stream object.
+ * @param ops     Audio stream operations, may be NULL.
+ * @param lc3_ops LC3 stream operations.
+ * @param pool    Pool to allocate the SDUs from, only used by streams able to send. Its buffers
+ *                shall hold @kconfig{CONFIG_BT_ISO_TX_MTU} bytes after
+ *                BT_ISO_CHAN_SEND_RESERVE.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ */
+int bt_bap_lc3_stream_init(struct bt_bap_lc3_stream *stream, struct bt_bap_stream_ops *ops,
+			   const struct bt_bap_lc3_stream_ops *lc3_ops, struct net_buf_pool *pool);
+
+/**
+ * @brief Get the PCM parameters of a started LC3 stream.
+ *
+ * @param stream   Stream object.
+ * @param freq_hz  Sampling frequency in Hz.
+ * @param dur_us   Frame duration in microseconds.
+ * @param chan_cnt Number of interleaved channels.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -EBADMSG The stream has not started.
+ */
+int bt_bap_lc3_stream_get_pcm_info(const struct bt_bap_lc3_stream *stream, uint32_t *freq_hz,
+				   uint16_t *dur_us, uint8_t *chan_cnt);
+
+/**
+ * @brief Initialize a PCM group.
+ *
+ * @param group    Group object, with @ref bt_bap_lc3_pcm_group.pcm_get set.
+ * @param freq_hz  Sampling frequency of the PCM in Hz.
+ * @param dur_us   Frame duration in microseconds.
+ * @param chan_cnt Number of interleaved channels of the PCM.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ */
+int bt_bap_lc3_pcm_group_init(struct bt_bap_lc3_pcm_group *group, uint32_t freq_hz,
+			      uint16_t dur_us, uint8_t chan_cnt);
+
+/**
+ * @brief Set the PCM group of an LC3 stream.
+ *
+ * Shall be called after bt_bap_lc3_stream_init() and before the stream starts.
+ *
+ * @param stream Stream object.
+ * @param group  Group to get the PCM from, or NULL to use the stream's own PCM.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -EBUSY The stream has started.
+ */
+int bt_bap_lc3_stream_set_pcm_group(struct bt_bap_lc3_stream *stream,
+				    struct bt_bap_lc3_pcm_group *group);
+
+/** @} */ /* end of bt_bap_lc3 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_BLUETOOTH_AUDIO_BAP_LC3_H_ */
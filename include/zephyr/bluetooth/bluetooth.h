@@ -2837,6 +2837,72 @@ int bt_le_scan_cb_register(struct bt_le_scan_cb *cb);
  */
 void bt_le_scan_cb_unregister(struct bt_le_scan_cb *cb);
 
+/** Options of a host advertising report filter. */
+enum bt_le_scan_filter_opt {
+	/** Only pass reports from @ref bt_le_scan_filter.addr. */
+	BT_LE_SCAN_FILTER_OPT_ADDR = BIT(0),
+
+	/** Only pass reports advertising the service @ref bt_le_scan_filter.uuid. */
+	BT_LE_SCAN_FILTER_OPT_UUID = BIT(1),
+
+	/** Only pass reports with manufacturer data of @ref bt_le_scan_filter.company_id. */
+	BT_LE_SCAN_FILTER_OPT_COMPANY_ID = BIT(2),
+
+	/**
+	 * @brief Drop reports identical to a recent one.
+	 *
+	 * A report is a duplicate if its address and data match one of the last
+	 * @kconfig{CONFIG_BT_SCAN_FILTER_DEDUP_COUNT} distinct reports passed within
+	 * @ref bt_le_scan_filter.dedup_timeout. Dropped duplicates do not extend the
+	 * timeout, so a report repeated continuously passes once per timeout.
+	 */
+	BT_LE_SCAN_FILTER_OPT_DEDUP = BIT(3),
+};
+
+/**
+ * @brief Host advertising report filter.
+ *
+ * Filters the advertising reports in the host, before they are passed to the scan callbacks.
+ * All enabled matchers shall match for a report to pass.
+ */
+struct bt_le_scan_filter {
+	/** Bit-field of @ref bt_le_scan_filter_opt. */
+	uint32_t options;
+
+	/** Identity or advertising address to match. */
+	bt_addr_le_t addr;
+
+	/** Service UUID to match in the complete or incomplete service UUID lists. */
+	const struct bt_uuid *uuid;
+
+	/** Company identifier to match in the manufacturer data. */
+	uint16_t company_id;
+
+	/** Time in milliseconds after which a duplicate report passes again, 0 for never. */
+	uint16_t dedup_timeout;
+
+	/** Maximum number of reports passed per second, 0 for unlimited. */
+	uint16_t max_rate;
+};
+
+/**
+ * @brief Set the host advertising report filter.
+ *
+ * The filter applies to the callback given to bt_le_scan_start() and to the
+ * callbacks registered with bt_le_scan_cb_register(). It does not apply to
+ * automatic connection establishment. Setting a filter clears the duplicate
+ * reports seen so far.
+ *
+ * Only available when @kconfig{CONFIG_BT_SCAN_FILTER} is enabled.
+ *
+ * @param filter Filter to apply, or NULL to pass all reports. The filter is copied, except for
+ *               the UUID it points to, which shall remain valid.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL The filter enables a matcher without its parameter.
+ */
+int bt_le_scan_filter_set(const struct bt_le_scan_filter *filter);
+
 /**
  * @brief Add device (LE) to filter accept list.
  *
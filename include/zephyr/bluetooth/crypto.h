@@ -118,6 +118,64 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13],
 		   const uint8_t *plaintext, size_t len, const uint8_t *aad,
 		   size_t aad_len, uint8_t *enc_data, size_t mic_size);
 
+/** @brief AES-CCM operation of a batch. */
+struct bt_ccm_op {
+	/** 13 byte MS byte first nonce */
+	const uint8_t *nonce;
+	/** Input data, for decryption followed by the MIC */
+	const uint8_t *in;
+	/** Length of the input data, without the MIC */
+	size_t len;
+	/** Additional authenticated data */
+	const uint8_t *aad;
+	/** Additional authenticated data length */
+	size_t aad_len;
+	/** Output buffer, for encryption with room for the MIC after the data */
+	uint8_t *out;
+	/** Result of the operation, set by the batch call */
+	int err;
+};
+
+/** @brief Encrypt several buffers with the same key with AES-CCM.
+ *
+ *  Same as calling bt_ccm_encrypt() for each operation, but the key is only
+ *  set up once, which saves most of the cost of short packets when a
+ *  hardware AES engine is used through the PSA Crypto API. All operations
+ *  are run, whether or not previous ones failed.
+ *
+ *  @param key      128 bit MS byte first key
+ *  @param ops      Operations to run, the result of each is set in its
+ *                  @c err field
+ *  @param count    Number of operations
+ *  @param mic_size Size of the trailing MIC (in bytes)
+ *
+ *  @retval 0        All operations succeeded.
+ *  @retval -EINVAL  Invalid parameters in at least one operation.
+ *  @retval -EIO     The crypto backend failed.
+ */
+int bt_ccm_encrypt_batch(const uint8_t key[16], struct bt_ccm_op *ops, size_t count,
+			 size_t mic_size);
+
+/** @brief Decrypt several buffers with the same key with AES-CCM.
+ *
+ *  Same as calling bt_ccm_decrypt() for each operation, with the key only
+ *  set up once. All operations are run, whether or not previous ones
+ *  failed.
+ *
+ *  @param key      128 bit MS byte first key
+ *  @param ops      Operations to run, the result of each is set in its
+ *                  @c err field
+ *  @param count    Number of operations
+ *  @param mic_size Size of the trailing MIC (in bytes)
+ *
+ *  @retval 0        All operations succeeded.
+ *  @retval -EINVAL  Invalid parameters in at least one operation.
+ *  @retval -EBADMSG Authentication failed for at least one operation.
+ *  @retval -EIO     The crypto backend failed.
+ */
+int bt_ccm_decrypt_batch(const uint8_t key[16], struct bt_ccm_op *ops, size_t count,
+			 size_t mic_size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -381,6 +381,49 @@ struct bt_iso_tx_info {
 	uint16_t seq_num;
 };
 
+/**
+ * @brief ISO channel statistics.
+ *
+ * Collected from the setup of the channel, see bt_iso_chan_get_stats(). All times are in
+ * microseconds.
+ */
+struct bt_iso_chan_stats {
+	/** Number of SDUs queued for sending */
+	uint32_t tx_sdus;
+
+	/** Number of SDUs that failed to send or were discarded on disconnection */
+	uint32_t tx_dropped;
+
+	/** Highest number of SDUs queued and not yet completed by the controller */
+	uint16_t tx_pending_max;
+
+	/** Time offset of the last bt_iso_chan_get_tx_sync() */
+	uint32_t tx_sync_offset;
+
+	/** Number of SDUs received, including lost and invalid ones */
+	uint32_t rx_sdus;
+
+	/** Number of SDUs reported lost */
+	uint32_t rx_lost;
+
+	/** Number of SDUs reported with errors */
+	uint32_t rx_errors;
+
+	/**
+	 * @brief Largest RX jitter
+	 *
+	 * Largest difference between the time between two timestamped SDUs reaching the host and
+	 * the time between their timestamps.
+	 */
+	uint32_t rx_jitter_max_us;
+
+	/** Time from the first fragment of the last SDU reaching the host to its recv callback */
+	uint32_t rx_latency_us;
+
+	/** Largest @ref bt_iso_chan_stats.rx_latency_us */
+	uint32_t rx_latency_max_us;
+};
+
 
 /** Opaque type representing an Connected Isochronous Group (CIG). */
 struct bt_iso_cig;
@@ -739,6 +782,9 @@ struct bt_iso_chan_ops {
 	/**
 	 * @brief Channel recv callback
 	 *
+	 * If @kconfig{CONFIG_BT_ISO_RX_FRAG_CHAIN} is enabled, an SDU received
+	 * in several HCI ISO Data packets is a chain of buffer fragments.
+	 *
 	 * @param chan The channel receiving data.
 	 * @param buf Buffer containing incoming data.
 	 * @param info Pointer to the metadata for the buffer. The lifetime of the
@@ -760,6 +806,23 @@ struct bt_iso_chan_ops {
 	 * @param chan The channel which has sent data.
 	 */
 	void (*sent)(struct bt_iso_chan *chan);
+
+#if defined(CONFIG_BT_ISO_TX_SCHED) || defined(__DOXYGEN__)
+	/**
+	 * @brief Channel TX underrun callback
+	 *
+	 * This callback will be called when the last SDU queued with
+	 * bt_iso_chan_send_sched() has been completed and no other SDU is
+	 * waiting to be sent, i.e. the controller will have nothing to send in
+	 * the following SDU intervals. It is called once per underrun, the next
+	 * call to bt_iso_chan_send_sched() arms it again.
+	 *
+	 * Only available when @kconfig{CONFIG_BT_ISO_TX_SCHED} is enabled.
+	 *
+	 * @param chan The channel which ran out of data.
+	 */
+	void (*tx_underrun)(struct bt_iso_chan *chan);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 };
 
 /** @brief ISO Accept Info Structure */
@@ -985,6 +1048,39 @@ int bt_iso_chan_send(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq
 int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
 			uint32_t ts);
 
+/**
+ * @brief Queue data with a timestamp to be sent on an ISO channel later
+ *
+ * Queue an SDU for a future SDU interval. Any number of SDUs can be queued
+ * ahead, the stack only keeps @kconfig{CONFIG_BT_ISO_TX_SCHED_DEPTH} of them
+ * in the controller at any time and hands over the next one each time one is
+ * completed, after the SDUs sent with bt_iso_chan_send() or
+ * bt_iso_chan_send_ts(). The controller sends each SDU in the SDU interval
+ * of its timestamp. When the queue runs dry @ref bt_iso_chan_ops.tx_underrun
+ * is called.
+ *
+ * For a BAP stream the channel is the iso_chan of bt_bap_ep_get_info().
+ *
+ * @note Buffer ownership is transferred to the stack in case of success, in
+ * case of an error the caller retains the ownership of the buffer.
+ *
+ * Only available when @kconfig{CONFIG_BT_ISO_TX_SCHED} is enabled.
+ *
+ * @param chan     Channel object.
+ * @param buf      Buffer containing data to be sent.
+ * @param seq_num  Packet Sequence number. This value shall be incremented for
+ *                 each SDU queued for a specific channel.
+ * @param ts       Timestamp of the SDU in microseconds (us), in the time
+ *                 base of the controller.
+ *
+ * @retval 0 The SDU has been queued.
+ * @retval -EINVAL Invalid parameters.
+ * @retval -ENOTCONN The channel is not connected.
+ * @retval -EMSGSIZE The SDU is larger than the maximum SDU size of the channel.
+ */
+int bt_iso_chan_send_sched(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
+			   uint32_t ts);
+
 /**
  * @brief Sets up the ISO data path for a ISO channel
  *
@@ -1231,6 +1327,31 @@ int bt_iso_chan_get_info(const struct bt_iso_chan *chan, struct bt_iso_info *inf
  */
 int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_info *info);
 
+/**
+ * @brief Get the statistics of an ISO channel
+ *
+ * Requires @kconfig{CONFIG_BT_ISO_STATS}.
+ *
+ * @param[in]  chan  The channel to get the statistics of.
+ * @param[out] stats The statistics of the channel.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ */
+int bt_iso_chan_get_stats(const struct bt_iso_chan *chan, struct bt_iso_chan_stats *stats);
+
+/**
+ * @brief Reset the statistics of an ISO channel
+ *
+ * Requires @kconfig{CONFIG_BT_ISO_STATS}.
+ *
+ * @param chan The channel to reset the statistics of.
+ *
+ * @retval 0 Success.
+ * @retval -EINVAL Invalid parameters.
+ */
+int bt_iso_chan_reset_stats(struct bt_iso_chan *chan);
+
 /**
  * @brief Struct to hold the Broadcast Isochronous Group callbacks
  *
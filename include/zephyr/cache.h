@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2015 Wind River Systems, Inc.
  * Copyright (c) 2022 Carlo Caione <ccaione@baylibre.com>
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -21,6 +22,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Address range of a batched d-cache operation
+ *
+ * @see sys_cache_data_flush_ranges()
+ */
+struct sys_cache_range {
+	/** Starting address */
+	void *addr;
+	/** Range size */
+	size_t size;
+};
+
 #if defined(CONFIG_EXTERNAL_CACHE)
 #include <zephyr/drivers/cache.h>
 
@@ -388,6 +401,104 @@ static ALWAYS_INLINE int sys_cache_instr_flush_and_invd_range(void *addr, size_t
 	return -ENOTSUP;
 }
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_CACHE_RANGES_FLUSH BIT(0)
+#define Z_CACHE_RANGES_INVD  BIT(1)
+
+int z_cache_data_ranges(struct sys_cache_range *ranges, size_t count, int op);
+
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Flush a list of address ranges in the d-cache
+ *
+ * Flush several address ranges of the data cache at once, such as the DMA
+ * buffers of a transfer. The ranges are extended to whole cache lines, and
+ * the ones that overlap or are adjacent are merged, so that each line is
+ * flushed once, and the barriers are issued once for the whole list where
+ * the architecture supports it. When the merged ranges add up to at least
+ * @kconfig{CONFIG_DCACHE_RANGES_ALL_THRESHOLD} bytes, the whole d-cache is
+ * flushed instead.
+ *
+ * @note @p ranges is used as scratch space: it is sorted and merged in place.
+ * @note Unlike the single range functions, these are not system calls: they
+ *       can only be used from supervisor threads.
+ *
+ * @param ranges Address ranges to flush.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static ALWAYS_INLINE int sys_cache_data_flush_ranges(struct sys_cache_range *ranges, size_t count)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+	return z_cache_data_ranges(ranges, count, Z_CACHE_RANGES_FLUSH);
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+/**
+ * @brief Invalidate a list of address ranges in the d-cache
+ *
+ * As sys_cache_data_flush_ranges(), for invalidation. When the threshold is
+ * reached, the whole d-cache is flushed and invalidated, since invalidating
+ * it would discard the dirty lines outside of the ranges.
+ *
+ * @note The same constraints as for sys_cache_data_invd_range() apply to
+ *       each range: lines shared with other data are invalidated as well.
+ *
+ * @param ranges Address ranges to invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static ALWAYS_INLINE int sys_cache_data_invd_ranges(struct sys_cache_range *ranges, size_t count)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+	return z_cache_data_ranges(ranges, count, Z_CACHE_RANGES_INVD);
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
+/**
+ * @brief Flush and invalidate a list of address ranges in the d-cache
+ *
+ * As sys_cache_data_flush_ranges(), for flushing and invalidation.
+ *
+ * @param ranges Address ranges to flush and invalidate.
+ * @param count Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static ALWAYS_INLINE int sys_cache_data_flush_and_invd_ranges(struct sys_cache_range *ranges,
+							      size_t count)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+	return z_cache_data_ranges(ranges, count, Z_CACHE_RANGES_FLUSH | Z_CACHE_RANGES_INVD);
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
+
 /**
  *
  * @brief Get the d-cache line size.
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup cpp_device C++ device wrappers
+ * @ingroup device_model
+ *
+ * @brief Device APIs for devices known at compile time
+ *
+ * The wrappers take the device as a template argument, usually from devicetree:
+ *
+ * @code{.cpp}
+ * using sai = zephyr::i2s<DEVICE_DT_GET(DT_NODELABEL(sai1))>;
+ *
+ * sai::configure(I2S_DIR_TX, &cfg);
+ * sai::trigger(I2S_DIR_TX, I2S_TRIGGER_START);
+ * @endcode
+ *
+ * By default, they call the C API of the device class and cost the same, through the device
+ * API pointer and the system calls. When the driver API of the device is visible where the
+ * wrapper is used, it can be bound to the device with DEVICE_API_BIND(): the calls then resolve
+ * to the driver functions at compile time, are made directly, and can be inlined. Bound devices
+ * must only be used from supervisor threads.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_DEVICE_HPP_
+#define ZEPHYR_INCLUDE_CPP_DEVICE_HPP_
+
+#include <errno.h>
+#include <zephyr/device.h>
+
+#if defined(CONFIG_I2S) || defined(__DOXYGEN__)
+#include <zephyr/drivers/i2s.h>
+#endif
+
+#if defined(CONFIG_DMA) || defined(__DOXYGEN__)
+#include <zephyr/drivers/dma.h>
+#endif
+
+#if defined(CONFIG_SENSOR) || defined(__DOXYGEN__)
+#include <zephyr/drivers/sensor.h>
+#endif
+
+namespace zephyr {
+
+/**
+ * @brief Driver API of a device
+ *
+ * Resolved at run time from the device, unless specialized by DEVICE_API_BIND().
+ *
+ * @tparam Api Driver API structure of the device class
+ * @tparam Dev Device
+ */
+template <typename Api, const struct device *Dev> struct device_api {
+	/** True when the API is known at compile time */
+	static constexpr bool bound = false;
+
+	/** Get the driver API */
+	static const Api *get() noexcept
+	{
+		return static_cast<const Api *>(Dev->api);
+	}
+};
+
+/**
+ * @brief Bind a device to its driver API at compile time
+ *
+ * Specializes zephyr::device_api so that the wrappers of the device call the functions of
+ * @p _api directly. Used at global scope, where @p _api is defined with its initializer, usually
+ * by a static DEVICE_API() in a header of the driver.
+ *
+ * @param _class The device API class.
+ * @param _dev The device instance pointer, such as from DEVICE_DT_GET().
+ * @param _api The driver API of the device.
+ */
+#define DEVICE_API_BIND(_class, _dev, _api)                                                        \
+	template <> struct zephyr::device_api<struct Z_DEVICE_API_TYPE(_class), _dev> {            \
+		static constexpr bool bound = true;                                                \
+                                                                                                   \
+		static constexpr const struct Z_DEVICE_API_TYPE(_class) *get() noexcept            \
+		{                                                                                  \
+			return &(_api);                                                            \
+		}                                                                                  \
+	}
+
+/**
+ * @brief Device known at compile time
+ *
+ * @tparam Dev Device
+ */
+template <const struct device *Dev> class device_ref {
+public:
+	/** Get the device */
+	static constexpr const struct device *get() noexcept
+	{
+		return Dev;
+	}
+
+	/** Check if the device is ready, as device_is_ready() */
+	static bool is_ready() noexcept
+	{
+		return device_is_ready(Dev);
+	}
+};
+
+#if defined(CONFIG_I2S) || defined(__DOXYGEN__)
+/**
+ * @brief I2S device known at compile time
+ *
+ * @tparam Dev I2S device
+ */
+template <const struct device *Dev> class i2s : public device_ref<Dev> {
+	using api = device_api<struct i2s_driver_api, Dev>;
+
+public:
+	/** As i2s_configure() */
+	static int configure(enum i2s_dir dir, const struct i2s_config *cfg)
+	{
+		if constexpr (api::bound) {
+			return api::get()->configure(Dev, dir, cfg);
+		} else {
+			return i2s_configure(Dev, dir, cfg);
+		}
+	}
+
+	/** As i2s_config_get() */
+	static const struct i2s_config *config_get(enum i2s_dir dir)
+	{
+		return api::get()->config_get(Dev, dir);
+	}
+
+	/** As i2s_read() */
+	static int read(void **mem_block, size_t *size)
+	{
+		return api::get()->read(Dev, mem_block, size);
+	}
+
+	/** As i2s_write() */
+	static int write(void *mem_block, size_t size)
+	{
+		return api::get()->write(Dev, mem_block, size);
+	}
+
+	/** As i2s_trigger() */
+	static int trigger(enum i2s_dir dir, enum i2s_trigger_cmd cmd)
+	{
+		if constexpr (api::bound) {
+			return api::get()->trigger(Dev, dir, cmd);
+		} else {
+			return i2s_trigger(Dev, dir, cmd);
+		}
+	}
+
+	/** As i2s_get_position() */
+	static int get_position(enum i2s_dir dir, struct i2s_position *pos)
+	{
+		if constexpr (api::bound) {
+			if (api::get()->get_position == nullptr) {
+				return -ENOSYS;
+			}
+
+			return api::get()->get_position(Dev, dir, pos);
+		} else {
+			return i2s_get_position(Dev, dir, pos);
+		}
+	}
+};
+#endif
+
+#if defined(CONFIG_DMA) || defined(__DOXYGEN__)
+/**
+ * @brief DMA controller known at compile time
+ *
+ * @tparam Dev DMA controller
+ */
+template <const struct device *Dev> class dma : public device_ref<Dev> {
+	using api = device_api<struct dma_driver_api, Dev>;
+
+public:
+#ifdef CONFIG_DMA_64BIT
+	using address = uint64_t;
+#else
+	using address = uint32_t;
+#endif
+
+	/** As dma_config() */
+	static int config(uint32_t channel, struct dma_config *config)
+	{
+		return api::get()->config(Dev, channel, config);
+	}
+
+	/** As dma_reload() */
+	static int reload(uint32_t channel, address src, address dst, size_t size)
+	{
+		if (api::get()->reload == nullptr) {
+			return -ENOSYS;
+		}
+
+		return api::get()->reload(Dev, channel, src, dst, size);
+	}
+
+	/** As dma_start() */
+	static int start(uint32_t channel)
+	{
+		if constexpr (api::bound) {
+			return api::get()->start(Dev, channel);
+		} else {
+			return dma_start(Dev, channel);
+		}
+	}
+
+	/** As dma_stop() */
+	static int stop(uint32_t channel)
+	{
+		if constexpr (api::bound) {
+			return api::get()->stop(Dev, channel);
+		} else {
+			return dma_stop(Dev, channel);
+		}
+	}
+
+	/** As dma_suspend() */
+	static int suspend(uint32_t channel)
+	{
+		if constexpr (api::bound) {
+			if (api::get()->suspend == nullptr) {
+				return -ENOSYS;
+			}
+
+			return api::get()->suspend(Dev, channel);
+		} else {
+			return dma_suspend(Dev, channel);
+		}
+	}
+
+	/** As dma_resume() */
+	static int resume(uint32_t channel)
+	{
+		if constexpr (api::bound) {
+			if (api::get()->resume == nullptr) {
+				return -ENOSYS;
+			}
+
+			return api::get()->resume(Dev, channel);
+		} else {
+			return dma_resume(Dev, channel);
+		}
+	}
+
+	/** As dma_get_status() */
+	static int get_status(uint32_t channel, struct dma_status *stat)
+	{
+		if (api::get()->get_status == nullptr) {
+			return -ENOSYS;
+		}
+
+		return api::get()->get_status(Dev, channel, stat);
+	}
+
+	/** As dma_get_attribute() */
+	static int get_attribute(uint32_t type, uint32_t *value)
+	{
+		if (api::get()->get_attribute == nullptr) {
+			return -ENOSYS;
+		}
+
+		return api::get()->get_attribute(Dev, type, value);
+	}
+};
+#endif
+
+#if defined(CONFIG_SENSOR) || defined(__DOXYGEN__)
+/**
+ * @brief Sensor known at compile time
+ *
+ * @tparam Dev Sensor
+ */
+template <const struct device *Dev> class sensor : public device_ref<Dev> {
+	using api = device_api<struct sensor_driver_api, Dev>;
+
+public:
+	/** As sensor_attr_set() */
+	static int attr_set(enum sensor_channel chan, enum sensor_attribute attr,
+			    const struct sensor_value *val)
+	{
+		if constexpr (api::bound) {
+			if (api::get()->attr_set == nullptr) {
+				return -ENOSYS;
+			}
+
+			return api::get()->attr_set(Dev, chan, attr, val);
+		} else {
+			return sensor_attr_set(Dev, chan, attr, val);
+		}
+	}
+
+	/** As sensor_attr_get() */
+	static int attr_get(enum sensor_channel chan, enum sensor_attribute attr,
+			    struct sensor_value *val)
+	{
+		if constexpr (api::bound) {
+			if (api::get()->attr_get == nullptr) {
+				return -ENOSYS;
+			}
+
+			return api::get()->attr_get(Dev, chan, attr, val);
+		} else {
+			return sensor_attr_get(Dev, chan, attr, val);
+		}
+	}
+
+	/** As sensor_trigger_set() */
+	static int trigger_set(const struct sensor_trigger *trig, sensor_trigger_handler_t handler)
+	{
+		if (api::get()->trigger_set == nullptr) {
+			return -ENOSYS;
+		}
+
+		return api::get()->trigger_set(Dev, trig, handler);
+	}
+
+	/** As sensor_sample_fetch() and sensor_sample_fetch_chan() */
+	static int sample_fetch(enum sensor_channel chan = SENSOR_CHAN_ALL)
+	{
+		if constexpr (api::bound) {
+			return api::get()->sample_fetch(Dev, chan);
+		} else {
+			return sensor_sample_fetch_chan(Dev, chan);
+		}
+	}
+
+	/** As sensor_channel_get() */
+	static int channel_get(enum sensor_channel chan, struct sensor_value *val)
+	{
+		if constexpr (api::bound) {
+			return api::get()->channel_get(Dev, chan, val);
+		} else {
+			return sensor_channel_get(Dev, chan, val);
+		}
+	}
+};
+#endif
+
+} /* namespace zephyr */
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_CPP_DEVICE_HPP_ */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup cpp_memory_resource C++ memory resources
+ * @ingroup memory_management
+ *
+ * @brief std::pmr::memory_resource adapters over the kernel allocators
+ *
+ * Allocator-aware containers given a std::pmr::polymorphic_allocator over one of these resources
+ * allocate from a dedicated k_heap, k_mem_slab or sys_mem_blocks instead of the global operator
+ * new, each with its own lock and allocation latency.
+ *
+ * When an allocation fails, the resources throw std::bad_alloc if CONFIG_CPP_EXCEPTIONS is
+ * enabled, and return a null pointer otherwise, as the operator new of the minimal C++ library.
+ * Resources compare equal only to themselves.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_
+#define ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_
+
+#include <memory_resource>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mem_blocks.h>
+
+namespace zephyr::pmr {
+
+/**
+ * @brief Memory resource allocating from a k_heap
+ *
+ * Any size and alignment can be allocated.
+ */
+class heap_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param heap Heap to allocate from
+	 * @param timeout Time to wait for memory to be freed when the heap is full
+	 */
+	explicit heap_resource(struct k_heap &heap, k_timeout_t timeout = K_NO_WAIT) noexcept
+		: heap_(heap), timeout_(timeout)
+	{
+	}
+
+private:
+	void *do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	struct k_heap &heap_;
+	k_timeout_t timeout_;
+};
+
+/**
+ * @brief Memory resource allocating from a k_mem_slab
+ *
+ * Each allocation takes one block, in constant time. Allocations larger than the blocks, or
+ * aligned more strictly than the blocks are, fail.
+ */
+class slab_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param slab Memory slab to allocate from
+	 * @param timeout Time to wait for a block to be freed when the slab is empty
+	 */
+	explicit slab_resource(struct k_mem_slab &slab, k_timeout_t timeout = K_NO_WAIT) noexcept
+		: slab_(slab), timeout_(timeout)
+	{
+	}
+
+private:
+	void *do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	struct k_mem_slab &slab_;
+	k_timeout_t timeout_;
+};
+
+#ifdef CONFIG_SYS_MEM_BLOCKS
+/**
+ * @brief Memory resource allocating from a sys_mem_blocks allocator
+ *
+ * Each allocation takes the contiguous blocks covering its size. Allocations aligned more
+ * strictly than the blocks are fail.
+ */
+class mem_blocks_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param mem_blocks Memory blocks allocator to allocate from
+	 */
+	explicit mem_blocks_resource(sys_mem_blocks_t &mem_blocks) noexcept
+		: mem_blocks_(mem_blocks)
+	{
+	}
+
+private:
+	void *do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	size_t blocks(size_t bytes) const noexcept;
+
+	sys_mem_blocks_t &mem_blocks_;
+};
+#endif /* CONFIG_SYS_MEM_BLOCKS */
+
+/**
+ * @brief Arena memory resource
+ *
+ * Allocations are carved one after the other from a buffer, in constant time, and deallocation
+ * does nothing: the memory is only reclaimed at once by release() or the destructor. When the
+ * buffer is exhausted, further buffers are requested from the upstream resource, each twice the
+ * size of the previous one. Unlike std::pmr::monotonic_buffer_resource, the resource can be shared
+ * by threads.
+ */
+class monotonic_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param buffer Initial buffer, may be NULL if size is 0
+	 * @param size Size of the initial buffer
+	 * @param upstream Resource providing the further buffers, or NULL to fail allocations when
+	 *                 the initial buffer is exhausted
+	 */
+	monotonic_resource(void *buffer, size_t size,
+			   std::pmr::memory_resource *upstream = nullptr) noexcept;
+
+	monotonic_resource(const monotonic_resource &) = delete;
+	monotonic_resource &operator=(const monotonic_resource &) = delete;
+
+	~monotonic_resource() override
+	{
+		release();
+	}
+
+	/**
+	 * @brief Free all the allocations at once
+	 *
+	 * The buffers obtained from the upstream resource are returned to it, and allocations start
+	 * again from the initial buffer. No allocation may be in use.
+	 */
+	void release() noexcept;
+
+private:
+	struct chunk {
+		struct chunk *next;
+		size_t size;
+	};
+
+	void *do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	void *carve(size_t bytes, size_t alignment) noexcept;
+
+	struct k_spinlock lock_ = {};
+	uint8_t *buffer_;
+	size_t size_;
+	std::pmr::memory_resource *upstream_;
+	uintptr_t next_;
+	uintptr_t end_;
+	struct chunk *chunks_ = nullptr;
+	size_t chunk_size_;
+};
+
+} /* namespace zephyr::pmr */
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_ */
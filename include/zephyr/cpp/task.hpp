@@ -0,0 +1,845 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup cpp_task C++ coroutine tasks
+ * @ingroup kernel_apis
+ *
+ * @brief C++20 coroutine tasks and their executor
+ *
+ * A zephyr::task is a coroutine which can co_await other tasks and kernel objects. The tasks
+ * spawned on a zephyr::executor all run on the thread calling executor::run(), on its stack, and
+ * only switch at co_await: a state machine driven by semaphores, message queues, signals, RTIO
+ * completions and sockets can be written as sequential code without a thread of its own.
+ *
+ * While tasks wait, the executor blocks in a single k_poll() on the events of all of them, up to
+ * @ref CONFIG_CPP_EXECUTOR_MAX_EVENTS events. An await which would exceed them fails at once with
+ * -ENOMEM. The awaitables take a timeout, and like the kernel calls they wrap they complete with
+ * 0, -EBUSY when the object is not available with K_NO_WAIT, or -EAGAIN when the timeout expires.
+ *
+ * @code{.cpp}
+ * zephyr::task<> control(struct k_msgq &requests)
+ * {
+ *	struct request req;
+ *
+ *	for (;;) {
+ *		int ret = co_await zephyr::msgq_get(requests, &req);
+ *
+ *		if (ret != 0) {
+ *			break;
+ *		}
+ *		co_await handle(req);
+ *	}
+ * }
+ *
+ * zephyr::executor ex;
+ *
+ * ex.spawn(control(requests));
+ * ex.run();
+ * @endcode
+ *
+ * Exceptions thrown by a task are rethrown where it is awaited. A task must not be awaited from
+ * another executor than the one running it, and the awaitables must be used from supervisor
+ * threads.
+ *
+ * @note GCC before 12.3 miscompiles a co_await in the condition of an if or while statement
+ * (GCC bug 106188), so the result is stored in a variable first, as above.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_TASK_HPP_
+#define ZEPHYR_INCLUDE_CPP_TASK_HPP_
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+
+#ifdef CONFIG_RTIO_CONSUME_SEM
+#include <zephyr/rtio/rtio.h>
+#endif
+
+#ifdef CONFIG_ZVFS_POLL
+#include <zephyr/sys/fdtable.h>
+#endif
+
+#ifdef CONFIG_CPP_EXECUTOR_MAX_EVENTS
+#define Z_CPP_EXECUTOR_MAX_EVENTS CONFIG_CPP_EXECUTOR_MAX_EVENTS
+#else
+#define Z_CPP_EXECUTOR_MAX_EVENTS 16
+#endif
+
+namespace zephyr {
+
+template <typename T = void> class task;
+class executor;
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail {
+
+struct promise_base {
+	/* Resumed when the task completes, if awaited */
+	std::coroutine_handle<> continuation;
+	/* The task itself */
+	std::coroutine_handle<> self;
+	executor *exec = nullptr;
+	/* Next task ready to run */
+	promise_base *next = nullptr;
+	/* Owned by the executor, destroyed when complete */
+	bool detached = false;
+#ifdef __cpp_exceptions
+	std::exception_ptr exception;
+#endif
+
+	std::suspend_always initial_suspend() noexcept
+	{
+		return {};
+	}
+
+	struct final_awaiter {
+		bool await_ready() noexcept
+		{
+			return false;
+		}
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) noexcept;
+
+		void await_resume() noexcept
+		{
+		}
+
+		promise_base &promise;
+	};
+
+	final_awaiter final_suspend() noexcept
+	{
+		return {*this};
+	}
+
+	void unhandled_exception() noexcept
+	{
+#ifdef __cpp_exceptions
+		exception = std::current_exception();
+#endif
+	}
+
+	void rethrow()
+	{
+#ifdef __cpp_exceptions
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+#endif
+	}
+};
+
+template <typename T> struct promise : promise_base {
+	std::optional<T> value;
+
+	task<T> get_return_object() noexcept;
+
+	template <typename U> void return_value(U &&v)
+	{
+		value.emplace(std::forward<U>(v));
+	}
+
+	T result()
+	{
+		rethrow();
+		return std::move(*value);
+	}
+};
+
+template <> struct promise<void> : promise_base {
+	task<void> get_return_object() noexcept;
+
+	void return_void() noexcept
+	{
+	}
+
+	void result()
+	{
+		rethrow();
+	}
+};
+
+/*
+ * An operation a task waits for. Like a file descriptor in zvfs_poll(), the waiter adds the
+ * events it needs before the executor calls k_poll(), and checks them after.
+ */
+class waiter {
+public:
+	bool await_ready()
+	{
+		if (try_complete()) {
+			return true;
+		}
+		if (sys_timepoint_expired(deadline)) {
+			result = -EBUSY;
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename P> void await_suspend(std::coroutine_handle<P> h);
+
+	int await_resume() noexcept
+	{
+		return result;
+	}
+
+protected:
+	explicit waiter(k_timeout_t timeout) noexcept : deadline(sys_timepoint_calc(timeout))
+	{
+	}
+
+	~waiter() = default;
+
+	/* Complete the operation if possible without waiting, setting result */
+	virtual bool try_complete() = 0;
+
+	/*
+	 * Add the events to wait for from *pev, up to end. Returns 0, -EALREADY if the operation
+	 * can already complete, or a negative error with which the operation fails.
+	 */
+	virtual int prepare(struct k_poll_event *&pev, struct k_poll_event *end) = 0;
+
+	/* Check the events added by prepare() from *pev after k_poll(), true when complete */
+	virtual bool update(struct k_poll_event *&pev) = 0;
+
+	int result = 0;
+
+private:
+	friend class zephyr::executor;
+
+	waiter *next = nullptr;
+	promise_base *promise = nullptr;
+	k_timepoint_t deadline;
+	bool prepared = false;
+};
+
+/* A waiter for a single kernel object */
+class event_waiter : public waiter {
+protected:
+	event_waiter(k_timeout_t timeout, uint32_t type, void *obj) noexcept
+		: waiter(timeout), type_(type), obj_(obj)
+	{
+	}
+
+	int prepare(struct k_poll_event *&pev, struct k_poll_event *end) override
+	{
+		if (pev == end) {
+			return -ENOMEM;
+		}
+		k_poll_event_init(pev++, type_, K_POLL_MODE_NOTIFY_ONLY, obj_);
+
+		return 0;
+	}
+
+	bool update(struct k_poll_event *&pev) override
+	{
+		bool fired = (pev++)->state != K_POLL_STATE_NOT_READY;
+
+		/* Another thread may have taken the object first */
+		return fired && try_complete();
+	}
+
+private:
+	uint32_t type_;
+	void *obj_;
+};
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Coroutine task
+ *
+ * A task starts when it is awaited or spawned on an executor, and completes with a value of type
+ * T, returned by co_await.
+ *
+ * @tparam T Type of the value, void if none
+ */
+template <typename T> class [[nodiscard]] task {
+public:
+	/** @cond INTERNAL_HIDDEN */
+	using promise_type = detail::promise<T>;
+
+	struct awaiter {
+		std::coroutine_handle<promise_type> h;
+
+		bool await_ready() noexcept
+		{
+			return h.done();
+		}
+
+		template <typename P>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<P> caller) noexcept
+		{
+			h.promise().continuation = caller;
+			h.promise().exec = caller.promise().exec;
+
+			return h;
+		}
+
+		T await_resume()
+		{
+			return h.promise().result();
+		}
+	};
+	/** @endcond */
+
+	task(task &&other) noexcept : h_(std::exchange(other.h_, {}))
+	{
+	}
+
+	task &operator=(task &&other) noexcept
+	{
+		if (this != &other) {
+			if (h_) {
+				h_.destroy();
+			}
+			h_ = std::exchange(other.h_, {});
+		}
+
+		return *this;
+	}
+
+	task(const task &) = delete;
+	task &operator=(const task &) = delete;
+
+	~task()
+	{
+		if (h_) {
+			h_.destroy();
+		}
+	}
+
+	/** @cond INTERNAL_HIDDEN */
+	awaiter operator co_await() noexcept
+	{
+		__ASSERT(h_, "awaiting an empty task");
+
+		return awaiter{h_};
+	}
+	/** @endcond */
+
+private:
+	friend struct detail::promise<T>;
+	friend class executor;
+
+	explicit task(std::coroutine_handle<promise_type> h) noexcept : h_(h)
+	{
+	}
+
+	std::coroutine_handle<promise_type> h_;
+};
+
+/**
+ * @brief Coroutine executor
+ *
+ * Runs the tasks spawned on it, on the thread calling run().
+ */
+class executor {
+public:
+	executor() noexcept
+	{
+		k_poll_signal_init(&wake_);
+	}
+
+	executor(const executor &) = delete;
+	executor &operator=(const executor &) = delete;
+
+	~executor()
+	{
+		__ASSERT(atomic_get(&live_) == 0, "executor destroyed with live tasks");
+	}
+
+	/**
+	 * @brief Start a task
+	 *
+	 * The executor owns the task until it completes. Can be called from any thread or ISR.
+	 */
+	void spawn(task<void> &&t) noexcept
+	{
+		detail::promise_base &p = std::exchange(t.h_, {}).promise();
+
+		p.exec = this;
+		p.detached = true;
+		atomic_inc(&live_);
+		post(p);
+	}
+
+	/**
+	 * @brief Run tasks until none is left
+	 */
+	void run()
+	{
+		while (atomic_get(&live_) > 0) {
+			resume_ready();
+			if (atomic_get(&live_) > 0) {
+				poll();
+			}
+		}
+	}
+
+	/**
+	 * @brief Number of the tasks spawned and not completed
+	 */
+	size_t size() const noexcept
+	{
+		return atomic_get(&live_);
+	}
+
+private:
+	friend struct detail::promise_base;
+	friend class detail::waiter;
+	friend struct yield;
+
+	/* Queue a task to resume, from any context */
+	void post(detail::promise_base &p) noexcept
+	{
+		k_spinlock_key_t key = k_spin_lock(&lock_);
+
+		p.next = nullptr;
+		if (tail_ != nullptr) {
+			tail_->next = &p;
+		} else {
+			head_ = &p;
+		}
+		tail_ = &p;
+		k_spin_unlock(&lock_, key);
+
+		k_poll_signal_raise(&wake_, 0);
+	}
+
+	void resume_ready()
+	{
+		for (;;) {
+			k_spinlock_key_t key = k_spin_lock(&lock_);
+			detail::promise_base *p = head_;
+
+			if (p != nullptr) {
+				head_ = p->next;
+				if (head_ == nullptr) {
+					tail_ = nullptr;
+				}
+			}
+			k_spin_unlock(&lock_, key);
+
+			if (p == nullptr) {
+				break;
+			}
+			p->self.resume();
+		}
+	}
+
+	/* Wait for the operations of the waiting tasks, and queue the completed ones */
+	void poll()
+	{
+		struct k_poll_event *pev = events_;
+		struct k_poll_event *end = events_ + ARRAY_SIZE(events_);
+		k_timepoint_t first = sys_timepoint_calc(K_FOREVER);
+		bool ready = false;
+
+		k_poll_event_init(pev++, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &wake_);
+
+		for (detail::waiter *w = waiters_; w != nullptr; w = w->next) {
+			w->prepared = false;
+
+			if (sys_timepoint_expired(w->deadline)) {
+				ready = true;
+				continue;
+			}
+
+			int ret = w->prepare(pev, end);
+
+			if (ret == 0 || ret == -EALREADY) {
+				w->prepared = true;
+				ready = ready || (ret == -EALREADY);
+				if (sys_timepoint_cmp(w->deadline, first) < 0) {
+					first = w->deadline;
+				}
+			} else {
+				w->result = ret;
+				ready = true;
+			}
+		}
+
+		(void)k_poll(events_, pev - events_, ready ? K_NO_WAIT : sys_timepoint_timeout(first));
+
+		if (events_[0].state != K_POLL_STATE_NOT_READY) {
+			k_poll_signal_reset(&wake_);
+		}
+
+		/* Walk the waiters in the same order to find their events */
+		pev = events_ + 1;
+		for (detail::waiter **prev = &waiters_; *prev != nullptr;) {
+			detail::waiter *w = *prev;
+			bool done;
+
+			if (w->prepared) {
+				done = w->update(pev);
+				if (!done && sys_timepoint_expired(w->deadline)) {
+					w->result = -EAGAIN;
+					done = true;
+				}
+			} else if (sys_timepoint_expired(w->deadline)) {
+				/* Last chance, then time out */
+				done = true;
+				if (!w->try_complete()) {
+					w->result = -EAGAIN;
+				}
+			} else {
+				/* Failed to prepare */
+				done = true;
+			}
+
+			if (done) {
+				*prev = w->next;
+				post(*w->promise);
+			} else {
+				prev = &w->next;
+			}
+		}
+	}
+
+	void wait(detail::waiter &w) noexcept
+	{
+		w.next = waiters_;
+		waiters_ = &w;
+	}
+
+	void task_done() noexcept
+	{
+		atomic_dec(&live_);
+	}
+
+	struct k_spinlock lock_ = {};
+	detail::promise_base *head_ = nullptr;
+	detail::promise_base *tail_ = nullptr;
+	struct k_poll_signal wake_;
+	atomic_t live_ = ATOMIC_INIT(0);
+	detail::waiter *waiters_ = nullptr;
+	struct k_poll_event events_[Z_CPP_EXECUTOR_MAX_EVENTS + 1];
+};
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail {
+
+inline std::coroutine_handle<> promise_base::final_awaiter::await_suspend(
+	std::coroutine_handle<> h) noexcept
+{
+	if (promise.detached) {
+		executor *exec = promise.exec;
+
+#ifdef __cpp_exceptions
+		if (promise.exception) {
+			std::terminate();
+		}
+#endif
+		h.destroy();
+		exec->task_done();
+
+		return std::noop_coroutine();
+	}
+
+	return promise.continuation ? promise.continuation : std::noop_coroutine();
+}
+
+template <typename T> task<T> promise<T>::get_return_object() noexcept
+{
+	auto h = std::coroutine_handle<promise<T>>::from_promise(*this);
+
+	self = h;
+
+	return task<T>(h);
+}
+
+inline task<void> promise<void>::get_return_object() noexcept
+{
+	auto h = std::coroutine_handle<promise<void>>::from_promise(*this);
+
+	self = h;
+
+	return task<void>(h);
+}
+
+template <typename P> void waiter::await_suspend(std::coroutine_handle<P> h)
+{
+	promise = &h.promise();
+	promise->exec->wait(*this);
+}
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Let the other ready tasks run
+ */
+struct yield {
+	/** @cond INTERNAL_HIDDEN */
+	bool await_ready() noexcept
+	{
+		return false;
+	}
+
+	template <typename P> void await_suspend(std::coroutine_handle<P> h) noexcept
+	{
+		h.promise().exec->post(h.promise());
+	}
+
+	void await_resume() noexcept
+	{
+	}
+	/** @endcond */
+};
+
+/**
+ * @brief Suspend the task for a time
+ *
+ * co_await completes with 0.
+ */
+class sleep : public detail::waiter {
+public:
+	explicit sleep(k_timeout_t timeout) noexcept : waiter(timeout), end_(sys_timepoint_calc(timeout))
+	{
+	}
+
+private:
+	bool try_complete() override
+	{
+		return sys_timepoint_expired(end_);
+	}
+
+	int prepare(struct k_poll_event *&, struct k_poll_event *) override
+	{
+		return 0;
+	}
+
+	bool update(struct k_poll_event *&) override
+	{
+		return try_complete();
+	}
+
+	k_timepoint_t end_;
+};
+
+/**
+ * @brief Take a semaphore
+ *
+ * co_await completes as k_sem_take().
+ */
+class sem_take : public detail::event_waiter {
+public:
+	explicit sem_take(struct k_sem &sem, k_timeout_t timeout = K_FOREVER) noexcept
+		: event_waiter(timeout, K_POLL_TYPE_SEM_AVAILABLE, &sem), sem_(sem)
+	{
+	}
+
+private:
+	bool try_complete() override
+	{
+		return k_sem_take(&sem_, K_NO_WAIT) == 0;
+	}
+
+	struct k_sem &sem_;
+};
+
+/**
+ * @brief Receive a message from a message queue
+ *
+ * co_await completes as k_msgq_get().
+ */
+class msgq_get : public detail::event_waiter {
+public:
+	msgq_get(struct k_msgq &msgq, void *data, k_timeout_t timeout = K_FOREVER) noexcept
+		: event_waiter(timeout, K_POLL_TYPE_MSGQ_DATA_AVAILABLE, &msgq), msgq_(msgq),
+		  data_(data)
+	{
+	}
+
+private:
+	bool try_complete() override
+	{
+		return k_msgq_get(&msgq_, data_, K_NO_WAIT) == 0;
+	}
+
+	struct k_msgq &msgq_;
+	void *data_;
+};
+
+/**
+ * @brief Wait for a poll signal to be raised
+ *
+ * The signal is reset when co_await completes with 0.
+ */
+class signal_wait : public detail::event_waiter {
+public:
+	/**
+	 * @param signal Signal to wait for
+	 * @param result Where to store the result of the signal, or NULL
+	 * @param timeout Time to wait for the signal
+	 */
+	explicit signal_wait(struct k_poll_signal &signal, int *result = nullptr,
+			     k_timeout_t timeout = K_FOREVER) noexcept
+		: event_waiter(timeout, K_POLL_TYPE_SIGNAL, &signal), signal_(signal),
+		  signal_result_(result)
+	{
+	}
+
+private:
+	bool try_complete() override
+	{
+		unsigned int signaled;
+		int res;
+
+		k_poll_signal_check(&signal_, &signaled, &res);
+		if (signaled == 0U) {
+			return false;
+		}
+
+		k_poll_signal_reset(&signal_);
+		if (signal_result_ != nullptr) {
+			*signal_result_ = res;
+		}
+
+		return true;
+	}
+
+	struct k_poll_signal &signal_;
+	int *signal_result_;
+};
+
+#if defined(CONFIG_RTIO_CONSUME_SEM) || defined(__DOXYGEN__)
+/**
+ * @brief Consume a completion queue event of an RTIO context
+ *
+ * co_await returns the event as rtio_cqe_consume(), to be released with rtio_cqe_release(), or
+ * NULL on timeout. Requires CONFIG_RTIO_CONSUME_SEM, which wakes the executor on completions.
+ */
+class rtio_cqe_get : public detail::event_waiter {
+public:
+	explicit rtio_cqe_get(struct rtio &r, k_timeout_t timeout = K_FOREVER) noexcept
+		: event_waiter(timeout, K_POLL_TYPE_SEM_AVAILABLE, r.consume_sem), r_(r)
+	{
+	}
+
+	/** @cond INTERNAL_HIDDEN */
+	struct rtio_cqe *await_resume() noexcept
+	{
+		return cqe_;
+	}
+	/** @endcond */
+
+private:
+	bool try_complete() override
+	{
+		cqe_ = rtio_cqe_consume(&r_);
+
+		return cqe_ != nullptr;
+	}
+
+	struct rtio &r_;
+	struct rtio_cqe *cqe_ = nullptr;
+};
+#endif
+
+#if defined(CONFIG_ZVFS_POLL) || defined(__DOXYGEN__)
+/**
+ * @brief Wait for a file descriptor to be ready
+ *
+ * Works with the descriptors supported by zvfs_poll(), such as sockets and eventfds, except
+ * offloaded sockets. co_await completes with the returned events, a negative error, or -EBUSY
+ * or -EAGAIN if none of the requested events happened.
+ */
+class fd_poll : public detail::waiter {
+public:
+	/**
+	 * @param fd File descriptor
+	 * @param events Events to wait for, ZVFS_POLLIN and ZVFS_POLLOUT
+	 * @param timeout Time to wait for the events
+	 */
+	fd_poll(int fd, short events, k_timeout_t timeout = K_FOREVER) noexcept
+		: waiter(timeout), pfd_{fd, events, 0}
+	{
+	}
+
+private:
+	bool try_complete() override
+	{
+		int ret = zvfs_poll(&pfd_, 1, 0);
+
+		if (ret == 0) {
+			return false;
+		}
+		result = (ret > 0) ? pfd_.revents : -errno;
+
+		return true;
+	}
+
+	int call(unsigned long request, struct k_poll_event **pev, struct k_poll_event *end)
+	{
+		const struct fd_op_vtable *vtable;
+		struct k_mutex *lock;
+		void *ctx = zvfs_get_fd_obj_and_vtable(pfd_.fd, &vtable, &lock);
+		int ret;
+
+		if (ctx == nullptr) {
+			return -EBADF;
+		}
+
+		(void)k_mutex_lock(lock, K_FOREVER);
+		if (request == ZFD_IOCTL_POLL_PREPARE) {
+			ret = zvfs_fdtable_call_ioctl(vtable, ctx, request, &pfd_, pev, end);
+		} else {
+			ret = zvfs_fdtable_call_ioctl(vtable, ctx, request, &pfd_, pev);
+		}
+		k_mutex_unlock(lock);
+
+		return ret;
+	}
+
+	int prepare(struct k_poll_event *&pev, struct k_poll_event *end) override
+	{
+		int ret = call(ZFD_IOCTL_POLL_PREPARE, &pev, end);
+
+		return (ret == -EXDEV) ? -ENOTSUP : ret;
+	}
+
+	bool update(struct k_poll_event *&pev) override
+	{
+		int ret = call(ZFD_IOCTL_POLL_UPDATE, &pev, nullptr);
+
+		if (ret == -EAGAIN) {
+			return false;
+		}
+		if (ret < 0) {
+			result = ret;
+			return true;
+		}
+		if (pfd_.revents != 0) {
+			result = pfd_.revents;
+			return true;
+		}
+
+		return false;
+	}
+
+	struct zvfs_pollfd pfd_;
+};
+#endif
+
+} /* namespace zephyr */
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_CPP_TASK_HPP_ */
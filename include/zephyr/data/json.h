@@ -12,6 +12,7 @@
 #include <zephyr/toolchain.h>
 #include <zephyr/types.h>
 #include <sys/types.h>
+#include <zephyr/sys_clock.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -699,6 +700,187 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+/**
+ * @brief Callbacks of the streaming parser
+ *
+ * Callbacks return 0 to continue parsing, or a negative error code that stops parsing and is
+ * returned by json_sax_feed().
+ */
+struct json_sax_callbacks {
+	/**
+	 * @brief Key of an object member
+	 *
+	 * @param user_data User data given to json_sax_init().
+	 * @param key Key, not unescaped and without quotes. Only valid during the call.
+	 * @param len Length of the key.
+	 */
+	int (*key)(void *user_data, char *key, size_t len);
+
+	/**
+	 * @brief Value, or start or end of a container
+	 *
+	 * @param user_data User data given to json_sax_init().
+	 * @param type One of JSON_TOK_OBJECT_START, JSON_TOK_OBJECT_END, JSON_TOK_ARRAY_START,
+	 *             JSON_TOK_ARRAY_END, JSON_TOK_STRING, JSON_TOK_NUMBER, JSON_TOK_TRUE,
+	 *             JSON_TOK_FALSE or JSON_TOK_NULL.
+	 * @param data Text of the value, not unescaped and without quotes for strings, NULL for
+	 *             containers. Only valid during the call, the byte following the value may be
+	 *             modified.
+	 * @param len Length of the text.
+	 */
+	int (*value)(void *user_data, enum json_tokens type, char *data, size_t len);
+};
+
+/**
+ * @brief State of the streaming parser
+ *
+ * Containers may be nested up to 32 levels deep.
+ */
+struct json_sax {
+	/** @cond INTERNAL_HIDDEN */
+	const struct json_sax_callbacks *cb;
+	void *user_data;
+	char *buf;
+	size_t buf_size;
+	size_t len;
+	uint32_t objects;
+	uint8_t depth;
+	uint8_t expect;
+	uint8_t lex;
+	uint8_t hex;
+	bool key;
+	int err;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a streaming parser
+ *
+ * Unlike json_obj_parse(), the streaming parser does not need the whole document in memory: it
+ * is fed with consecutive chunks of the document, e.g. as they are received from a socket, and
+ * reports keys and values to callbacks (SAX). Scalars split across chunks are accumulated in
+ * @a buf, so only the largest key, string or number has to fit in memory.
+ *
+ * Like json_obj_parse(), strings are not unescaped and no UTF-8 validation is performed.
+ *
+ * @param sax Parser state.
+ * @param cb Callbacks.
+ * @param user_data User data passed to the callbacks.
+ * @param buf Buffer for keys, strings and numbers.
+ * @param buf_size Size of @a buf, one more than the longest accepted key or value.
+ */
+void json_sax_init(struct json_sax *sax, const struct json_sax_callbacks *cb, void *user_data,
+		   char *buf, size_t buf_size);
+
+/**
+ * @brief Feed the next chunk of a document to a streaming parser
+ *
+ * @param sax Parser state.
+ * @param data Chunk of the document.
+ * @param len Length of the chunk.
+ *
+ * @retval 0 The chunk has been parsed.
+ * @retval -EINVAL The document is invalid.
+ * @retval -ENOSPC A key or value does not fit in the buffer of the parser.
+ * @retval -ENOMEM Containers are nested too deep.
+ * @retval -errno Error returned by a callback. Errors are sticky, later calls return them too.
+ */
+int json_sax_feed(struct json_sax *sax, const char *data, size_t len);
+
+/**
+ * @brief Signal the end of the document to a streaming parser
+ *
+ * Reports a number ending the document, if any.
+ *
+ * @param sax Parser state.
+ *
+ * @retval 0 A complete document has been parsed.
+ * @retval -EINVAL The document is incomplete.
+ * @retval -errno Error returned by json_sax_feed().
+ */
+int json_sax_finish(struct json_sax *sax);
+
+/** @cond INTERNAL_HIDDEN */
+struct json_field_index {
+	uint8_t slots[64];
+	bool valid;
+};
+/** @endcond */
+
+#if defined(CONFIG_JSON_LIBRARY_STREAM) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+struct json_obj_stream_frame {
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	void *val;
+	char *field;
+	size_t *elements;
+	int64_t decoded;
+	int8_t current;
+	bool array;
+	struct json_field_index index;
+};
+/** @endcond */
+
+/**
+ * @brief State of a streaming object decoder
+ *
+ * Objects and arrays may be nested up to @kconfig{CONFIG_JSON_LIBRARY_STREAM_DEPTH} levels deep,
+ * unknown members are skipped whatever their depth.
+ */
+struct json_obj_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct json_sax sax;
+	struct json_obj_stream_frame frames[CONFIG_JSON_LIBRARY_STREAM_DEPTH];
+	uint8_t depth;
+	uint32_t skip;
+	int64_t decoded;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a streaming object decoder
+ *
+ * Decodes an object like json_obj_parse(), from consecutive chunks of the document given to
+ * json_obj_stream_feed(). As the document does not stay in memory, descriptors of types
+ * JSON_TOK_STRING, JSON_TOK_OPAQUE, JSON_TOK_FLOAT and JSON_TOK_OBJ_ARRAY, which refer to the
+ * document, are not supported: use JSON_TOK_STRING_BUF for strings.
+ *
+ * @param stream Decoder state.
+ * @param descr Pointer to the descriptor array.
+ * @param descr_len Number of elements in the descriptor array. Must be less than 63.
+ * @param val Pointer to the struct to hold the decoded values.
+ * @param buf Buffer for keys, strings and numbers, see json_sax_init().
+ * @param buf_size Size of @a buf.
+ */
+void json_obj_stream_init(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val, char *buf, size_t buf_size);
+
+/**
+ * @brief Feed the next chunk of a document to a streaming object decoder
+ *
+ * @param stream Decoder state.
+ * @param data Chunk of the document.
+ * @param len Length of the chunk.
+ *
+ * @retval 0 The chunk has been decoded.
+ * @retval -ENOTSUP A descriptor type is not supported by the streaming decoder.
+ * @retval -errno Other negative errno code, see json_sax_feed() and json_obj_parse().
+ */
+int json_obj_stream_feed(struct json_obj_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Signal the end of the document to a streaming object decoder
+ *
+ * @param stream Decoder state.
+ *
+ * @return < 0 if error, bitmap of decoded fields on success, see json_obj_parse().
+ */
+int64_t json_obj_stream_finish(struct json_obj_stream *stream);
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -779,6 +961,48 @@ int json_obj_encode_buf(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 			char *buffer, size_t buf_size);
 
+#if defined(CONFIG_NET_BUF) || defined(__DOXYGEN__)
+
+struct net_buf;
+
+/**
+ * @brief Encodes an object at the end of a network buffer chain
+ *
+ * The encoding is written directly into the last fragment of @a buf, and into new fragments
+ * allocated from the pool of that fragment when it is full, so that no intermediate buffer is
+ * needed to send it.
+ *
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array
+ * @param val Struct holding the values
+ * @param buf Network buffer chain
+ * @param timeout Time to wait for fragments to be allocated
+ *
+ * @return 0 if object has been successfully encoded, -ENOMEM if fragments could not be
+ * allocated, in which case the chain holds part of the encoding, or another negative value
+ * as defined on errno.h.
+ */
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf, k_timeout_t timeout);
+
+/**
+ * @brief Encodes an array at the end of a network buffer chain
+ *
+ * See json_obj_encode_net_buf().
+ *
+ * @param descr Pointer to the descriptor array
+ * @param val Struct holding the values
+ * @param buf Network buffer chain
+ * @param timeout Time to wait for fragments to be allocated
+ *
+ * @return 0 if array has been successfully encoded, a negative value as defined on errno.h
+ * otherwise.
+ */
+int json_arr_encode_net_buf(const struct json_obj_descr *descr, const void *val,
+			    struct net_buf *buf, k_timeout_t timeout);
+
+#endif /* CONFIG_NET_BUF */
+
 /**
  * @brief Encodes an object using an arbitrary writer function
  *
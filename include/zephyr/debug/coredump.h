@@ -151,6 +151,7 @@ struct coredump_cmd_copy_arg {
 
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
+#define COREDUMP_MEM_HDR_VER_LZ4	2
 
 /* Target code */
 enum coredump_tgt_code {
@@ -222,6 +223,19 @@ struct coredump_mem_hdr_t {
 	uintptr_t	end;
 } __packed;
 
+/*
+ * Chunk of a memory block with version COREDUMP_MEM_HDR_VER_LZ4. The memory
+ * is a sequence of chunks, each followed by comp_len bytes: an LZ4 block, or
+ * the raw data if comp_len equals raw_len.
+ */
+struct coredump_mem_chunk_hdr_t {
+	/* Number of bytes of memory in this chunk */
+	uint16_t	raw_len;
+
+	/* Number of bytes following this header */
+	uint16_t	comp_len;
+} __packed;
+
 typedef void (*coredump_backend_start_t)(void);
 typedef void (*coredump_backend_end_t)(void);
 typedef void (*coredump_backend_buffer_output_t)(uint8_t *buf, size_t buflen);
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_IRQ_LATENCY_H_
+#define ZEPHYR_INCLUDE_DEBUG_IRQ_LATENCY_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup irq_latency Interrupt latency monitor
+ *  @ingroup debug
+ *  @brief Module for monitoring interrupt latency
+ *
+ *  This module periodically sets an alarm on a spare hardware counter and
+ *  measures the time from the alarm expiry to its handler (interrupt entry
+ *  latency) and from the handler to a waiting thread (wakeup latency).
+ *  Interrupt entry latency includes the time the interrupt was held off by
+ *  critical sections (irq_lock() or higher priority interrupts), so its
+ *  maximum and the thread running at that time point at the longest ones.
+ *  @{
+ */
+
+/** Latency types */
+enum irq_latency_type {
+	/** Time from the interrupt trigger to the start of its handler. */
+	IRQ_LATENCY_ENTRY,
+	/** Time from the interrupt handler to a thread woken up by it. */
+	IRQ_LATENCY_WAKEUP,
+	/** Number of latency types. */
+	IRQ_LATENCY_TYPE_COUNT,
+};
+
+/** @brief Latency histogram. */
+struct irq_latency_hist {
+	/** Number of samples. */
+	uint32_t samples;
+	/** Longest latency in nanoseconds. */
+	uint32_t max_ns;
+	/**
+	 * log2 histogram of latencies in nanoseconds, bucket i counts
+	 * latencies from 2^i to 2^(i+1) - 1 ns, the first one from 0 and
+	 * the last one everything above.
+	 */
+	uint32_t buckets[CONFIG_IRQ_LATENCY_BUCKETS];
+};
+
+/** @brief Add an interrupt line to the monitored lines.
+ *
+ * The interrupt line of the counter used by the module is added at
+ * initialization. Other lines can be added for drivers which measure the
+ * latency of their interrupts and report it with irq_latency_record().
+ *
+ * @param irq Interrupt line.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if there are already CONFIG_IRQ_LATENCY_MAX_LINES lines.
+ */
+int irq_latency_line_add(unsigned int irq);
+
+/** @brief Record a latency sample.
+ *
+ * Can be called from any context. Samples of lines that were not added
+ * with irq_latency_line_add() are ignored.
+ *
+ * @param irq Interrupt line.
+ * @param type Latency type.
+ * @param ns Latency in nanoseconds.
+ */
+void irq_latency_record(unsigned int irq, enum irq_latency_type type, uint32_t ns);
+
+/** @brief Get the latency histogram of an interrupt line.
+ *
+ * @param irq Interrupt line.
+ * @param type Latency type.
+ * @param hist Location where the histogram is copied.
+ * @param max_thread If not NULL, location where the thread running when the
+ *		     longest latency was recorded is stored. The thread may no
+ *		     longer exist and must only be used to identify it.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if the line is not monitored.
+ */
+int irq_latency_get(unsigned int irq, enum irq_latency_type type,
+		    struct irq_latency_hist *hist, k_tid_t *max_thread);
+
+/** @brief Get the name of the thread running when the longest latency was recorded.
+ *
+ * The name is copied when the latency is recorded, so it remains valid after
+ * the thread exits.
+ *
+ * @param irq Interrupt line.
+ * @param type Latency type.
+ * @param buf Buffer where the name is copied, always NUL terminated.
+ * @param size Size of the buffer.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the type or the size is invalid.
+ * @retval -ENOENT if the line is not monitored.
+ * @retval -ENOTSUP if CONFIG_THREAD_NAME is disabled.
+ */
+int irq_latency_max_thread_name_get(unsigned int irq, enum irq_latency_type type,
+				    char *buf, size_t size);
+
+/** @brief Reset histograms of all monitored lines. */
+void irq_latency_reset(void);
+
+/** @brief Interrupt latency callback.
+ *
+ * @param irq Interrupt line.
+ * @param user_data User data passed to irq_latency_foreach().
+ */
+typedef void (*irq_latency_cb_t)(unsigned int irq, void *user_data);
+
+/** @brief Iterate over monitored interrupt lines.
+ *
+ * @param cb Callback called for each line.
+ * @param user_data User data passed to the callback.
+ */
+void irq_latency_foreach(irq_latency_cb_t cb, void *user_data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_IRQ_LATENCY_H_ */
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_USAGE_STATS_H_
+#define ZEPHYR_INCLUDE_DEBUG_USAGE_STATS_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup usage_stats Utilization statistics
+ *  @ingroup debug
+ *  @brief Module exporting thread and CPU utilization as statistics groups
+ *
+ *  The utilization of every CPU and of selected threads over the windows
+ *  of CONFIG_SCHED_THREAD_USAGE_WINDOWS is periodically copied, in per
+ *  mille, into statistics groups which can be read with the MCUmgr
+ *  statistics group.
+ *  @{
+ */
+
+/** @brief Export the utilization of a thread.
+ *
+ * @param thread Thread. It must not be aborted after it was added.
+ * @param name Name of the statistics group. The string must remain valid.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if CONFIG_USAGE_STATS_MAX_THREADS threads are already added.
+ */
+int usage_stats_thread_add(k_tid_t thread, const char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_USAGE_STATS_H_ */
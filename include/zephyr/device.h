@@ -13,8 +13,10 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/sections.h>
 #include <zephyr/pm/state.h>
+#include <zephyr/sys/atomic_types.h>
 #include <zephyr/sys/device_mmio.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/slist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/toolchain.h>
 
@@ -466,8 +468,21 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_LAZY_INIT) || defined(__DOXYGEN__)
+	/** Lazy initialization state, arbitrates device_init() and device_init_async(). */
+	atomic_t init_state;
+#endif
 };
 
+/** @cond INTERNAL_HIDDEN */
+
+/* Bits of device_state::init_state */
+#define Z_DEVICE_INIT_PENDING 0
+#define Z_DEVICE_INIT_RUNNING 1
+
+/** @endcond */
+
 struct pm_device_base;
 struct pm_device;
 struct pm_device_isr;
@@ -876,10 +891,61 @@ __syscall bool device_is_ready(const struct device *dev);
  * @param dev device to be initialized.
  *
  * @retval -EALREADY Device is already initialized.
+ * @retval -EBUSY Device is being initialized by another context, only with
+ *         @kconfig{CONFIG_DEVICE_LAZY_INIT}.
  * @retval -errno For other errors.
  */
 __syscall int device_init(const struct device *dev);
 
+/**
+ * @brief Callback notified when an asynchronous device initialization completes
+ *
+ * Called from the system work queue.
+ *
+ * @param dev Device which was initialized.
+ * @param result 0 if the device is ready, a negative errno code otherwise.
+ * @param user_data User data given to device_init_async().
+ */
+typedef void (*device_init_cb_t)(const struct device *dev, int result, void *user_data);
+
+/** Asynchronous device initialization request, owned by the caller until its callback runs */
+struct device_init_req {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	const struct device *dev;
+	device_init_cb_t cb;
+	void *user_data;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a device from the system work queue.
+ *
+ * Requests the initialization of a device whose initialization was deferred,
+ * without waiting for it. With @kconfig{CONFIG_DEVICE_LAZY_INIT}, the same
+ * request is made when device_is_ready() is called on such a device.
+ *
+ * Devices requested before the work queue runs are initialized in
+ * initialization level and priority order. A deferred device required by a
+ * requested device must be requested as well.
+ *
+ * Only available if @kconfig{CONFIG_DEVICE_LAZY_INIT} is enabled. Can be called
+ * from an ISR.
+ *
+ * @param dev Device to be initialized.
+ * @param req Request storage, must stay valid until @p cb is called. May be
+ *            NULL if no completion callback is needed.
+ * @param cb Completion callback, ignored if @p req is NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 Initialization requested, @p cb will be called.
+ * @retval -EALREADY Device is already initialized, @p cb will not be called.
+ * @retval -EAGAIN The system work queue is not running, @p cb will not be
+ *         called. The request can be made again later.
+ */
+int device_init_async(const struct device *dev, struct device_init_req *req,
+		      device_init_cb_t cb, void *user_data);
+
 /**
  * @brief De-initialize a device.
  *
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API for 2D pixel operations
+ */
+
+#ifndef ZEPHYR_INCLUDE_DISPLAY_BLIT_H_
+#define ZEPHYR_INCLUDE_DISPLAY_BLIT_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/display.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 2D pixel operations
+ * @defgroup blit 2D pixel operations
+ * @ingroup utilities
+ * @{
+ *
+ * Pixel format conversion, fill, blend, rotation and scaling of image
+ * buffers, for instance to prepare camera frames or GUI layers for
+ * display_write(). Operations are offloaded to a 2D engine when one is
+ * enabled and supports them, and performed in software otherwise.
+ *
+ * Supported pixel formats are @ref PIXEL_FORMAT_RGB_888,
+ * @ref PIXEL_FORMAT_ARGB_8888, @ref PIXEL_FORMAT_RGB_565,
+ * @ref PIXEL_FORMAT_BGR_565 and @ref PIXEL_FORMAT_L_8, with the memory
+ * layout used by the display drivers. Colors are given as 32-bit ARGB
+ * values.
+ */
+
+/** @brief Image buffer operated on */
+struct blit_surface {
+	/** Pixel data */
+	void *buf;
+	/** Width in pixels */
+	uint16_t width;
+	/** Height in pixels */
+	uint16_t height;
+	/** Number of pixels between consecutive rows */
+	uint16_t pitch;
+	/** Pixel format */
+	enum display_pixel_format format;
+};
+
+/**
+ * @brief Convert an image to another pixel format
+ *
+ * @param dst Destination surface, same size as @p src.
+ * @param src Source surface.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the sizes differ.
+ * @retval -ENOTSUP if a pixel format is not supported.
+ */
+int blit_convert(const struct blit_surface *dst, const struct blit_surface *src);
+
+/**
+ * @brief Fill an image with a color
+ *
+ * @param dst Destination surface.
+ * @param argb Fill color.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if the pixel format is not supported.
+ */
+int blit_fill(const struct blit_surface *dst, uint32_t argb);
+
+/**
+ * @brief Blend an image over another one
+ *
+ * Each source pixel is blended over the destination pixel with the
+ * source alpha, if any, multiplied by @p alpha.
+ *
+ * @param dst Destination surface, same size as @p src.
+ * @param src Source surface.
+ * @param alpha Global opacity of the source, 255 for opaque.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the sizes differ.
+ * @retval -ENOTSUP if a pixel format is not supported.
+ */
+int blit_blend(const struct blit_surface *dst, const struct blit_surface *src, uint8_t alpha);
+
+/**
+ * @brief Rotate an image clockwise
+ *
+ * The pixel format is converted if the formats of the surfaces differ.
+ *
+ * @param dst Destination surface, with width and height swapped compared
+ *        to @p src for 90 and 270 degrees rotations. Must not overlap
+ *        @p src.
+ * @param src Source surface.
+ * @param rotation Rotation to apply.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the sizes do not match.
+ * @retval -ENOTSUP if a pixel format is not supported.
+ */
+int blit_rotate(const struct blit_surface *dst, const struct blit_surface *src,
+		enum display_orientation rotation);
+
+/**
+ * @brief Scale an image to the size of another one
+ *
+ * Uses nearest neighbour sampling. The pixel format is converted if the
+ * formats of the surfaces differ.
+ *
+ * @param dst Destination surface. Must not overlap @p src.
+ * @param src Source surface.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if a pixel format is not supported.
+ */
+int blit_scale(const struct blit_surface *dst, const struct blit_surface *src);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DISPLAY_BLIT_H_ */
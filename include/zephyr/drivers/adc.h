@@ -16,6 +16,10 @@
 #include <zephyr/device.h>
 #include <zephyr/dt-bindings/adc/adc.h>
 #include <zephyr/kernel.h>
+#ifdef CONFIG_ADC_STREAM
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/rtio/rtio.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -712,6 +716,58 @@ typedef int (*adc_api_read_async)(const struct device *dev,
 				  const struct adc_sequence *sequence,
 				  struct k_poll_signal *async);
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Configuration of an ADC stream
+ *
+ * Set by ADC_IODEV_DEFINE(), see there for the meaning of the fields.
+ */
+struct adc_stream_cfg {
+	/** Bit mask of the sampled channels. */
+	uint32_t channels;
+	/** Interval between frames in microseconds, 0 for back to back. */
+	uint32_t interval_us;
+	/** Driver specific hardware trigger, 0 for none. */
+	uint32_t trigger;
+	/** Number of frames per block. */
+	uint16_t frames;
+	/** Resolution of the samples. */
+	uint8_t resolution;
+	/** Oversampling setting, as in @ref adc_sequence. */
+	uint8_t oversampling;
+};
+
+/**
+ * @brief Callback of a driver for a filled half of the stream buffer
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param samples Filled half of the buffer, NULL on error.
+ * @param status 0 on success, negative error code if sampling failed.
+ * @param user_data User data passed to the driver when starting the stream.
+ */
+typedef void (*adc_stream_callback_t)(const struct device *dev, const int16_t *samples,
+				      int status, void *user_data);
+
+/**
+ * @brief Type definition of ADC API function for starting a stream.
+ *
+ * The driver samples @p cfg->channels into @p buf continuously, @p buf holds
+ * two blocks of @p cfg->frames frames. @p cb is called, possibly from an
+ * ISR, each time a block is filled while the driver fills the other one.
+ * The device stays reserved until the stream is stopped.
+ *
+ * @retval -ENOTSUP The driver cannot stream with this configuration, the
+ *         caller falls back to adc_read().
+ */
+typedef int (*adc_api_stream_start)(const struct device *dev, const struct adc_stream_cfg *cfg,
+				    int16_t *buf, adc_stream_callback_t cb, void *user_data);
+
+/**
+ * @brief Type definition of ADC API function for stopping a stream.
+ */
+typedef int (*adc_api_stream_stop)(const struct device *dev);
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief ADC driver API
  *
@@ -722,6 +778,10 @@ __subsystem struct adc_driver_api {
 	adc_api_read          read;
 #ifdef CONFIG_ADC_ASYNC
 	adc_api_read_async    read_async;
+#endif
+#ifdef CONFIG_ADC_STREAM
+	adc_api_stream_start  stream_start;
+	adc_api_stream_stop   stream_stop;
 #endif
 	uint16_t ref_internal;	/* mV */
 };
@@ -1048,6 +1108,173 @@ static inline bool adc_is_ready_dt(const struct adc_dt_spec *spec)
 	return device_is_ready(spec->dev);
 }
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+
+/**
+ * @brief Header of a block read from an ADC stream
+ *
+ * Followed by the samples of the block, as int16_t, frame after frame.
+ * Each frame holds one sample of every channel, in ascending channel order.
+ */
+struct adc_stream_header {
+	/** Uptime in nanoseconds when the last frame of the block was read. */
+	uint64_t timestamp;
+	/** Bit mask of the sampled channels. */
+	uint32_t channels;
+	/** Interval between frames in microseconds, 0 for back to back. */
+	uint32_t interval_us;
+	/** Number of blocks lost before this one, for lack of a pending read. */
+	uint32_t dropped;
+	/** Number of frames in the block. */
+	uint16_t frames;
+	/** Resolution of the samples. */
+	uint8_t resolution;
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t reserved;
+	/** @endcond */
+};
+
+/**
+ * @brief Size of a block read from an ADC stream
+ *
+ * @param _channels Bit mask of the sampled channels.
+ * @param _frames Number of frames per block.
+ */
+#define ADC_STREAM_BLOCK_SIZE(_channels, _frames)                                                  \
+	(sizeof(struct adc_stream_header) + (_frames) * POPCOUNT(_channels) * sizeof(int16_t))
+
+/** @cond INTERNAL_HIDDEN */
+struct adc_stream_state {
+	struct k_spinlock lock;
+	struct mpsc sqe_q;
+	uint32_t dropped;
+	bool running;
+	bool fallback;
+};
+
+extern const struct rtio_iodev_api adc_iodev_api;
+/** @endcond */
+
+/**
+ * @brief ADC stream of an RTIO iodev
+ *
+ * Defined by ADC_IODEV_DEFINE() or ADC_DT_IODEV_DEFINE().
+ */
+struct adc_iodev_data {
+	/** ADC device. */
+	const struct device *dev;
+	/** Stream configuration. */
+	struct adc_stream_cfg cfg;
+	/** @cond INTERNAL_HIDDEN */
+	int16_t *buf;
+	struct adc_stream_state *state;
+	/** @endcond */
+};
+
+/**
+ * @brief Define an RTIO iodev streaming ADC samples
+ *
+ * Every read SQE on the iodev completes with the next block of
+ * @p _frames frames, a @ref adc_stream_header followed by the samples, of
+ * ADC_STREAM_BLOCK_SIZE() bytes in total. The CQE result is the size of
+ * the block. The samples are raw values, extracted with adc_stream_decode()
+ * and converted with adc_raw_to_millivolts() if needed. With
+ * rtio_sqe_prep_read_multishot() and a mempool buffer the blocks keep
+ * coming until the SQE is cancelled.
+ *
+ * Drivers with native support capture continuously into a double buffer,
+ * with DMA where available, and copy each block into the buffer of the
+ * oldest pending read. No sample is lost as long as a read is pending when
+ * a block is complete, otherwise the block is dropped and counted in the
+ * header of the next one. The first read starts the capture, which runs
+ * until adc_stream_stop() is called. Meanwhile the device is reserved and
+ * other reads on it wait.
+ *
+ * Other drivers serve each read with adc_read() from the RTIO work queue,
+ * with a gap between the blocks.
+ *
+ * The channels must be configured with adc_channel_setup() beforehand.
+ *
+ * @param name Symbolic name of the iodev.
+ * @param _dev ADC device.
+ * @param _channels Bit mask of the sampled channels.
+ * @param _resolution Resolution of the samples.
+ * @param _frames Number of frames per block.
+ * @param _interval_us Interval between frames in microseconds, 0 to sample
+ *        back to back or at the pace of @p _trigger.
+ * @param _trigger Driver specific hardware trigger starting each frame, for
+ *        instance a timer output configured by the application, 0 for none.
+ *        Only supported natively.
+ */
+#define ADC_IODEV_DEFINE(name, _dev, _channels, _resolution, _frames, _interval_us, _trigger)    \
+	static int16_t _adc_stream_buf_##name[2 * (_frames) * POPCOUNT(_channels)] __nocache    \
+		__aligned(4);                                                                      \
+	static struct adc_stream_state _adc_stream_state_##name = {                                \
+		.sqe_q = MPSC_INIT(_adc_stream_state_##name.sqe_q),                                \
+	};                                                                                         \
+	static const struct adc_iodev_data _adc_iodev_data_##name = {                              \
+		.dev = _dev,                                                                       \
+		.cfg = {                                                                           \
+			.channels = _channels,                                                     \
+			.interval_us = _interval_us,                                               \
+			.trigger = _trigger,                                                       \
+			.frames = _frames,                                                         \
+			.resolution = _resolution,                                                 \
+		},                                                                                 \
+		.buf = _adc_stream_buf_##name,                                                     \
+		.state = &_adc_stream_state_##name,                                                \
+	};                                                                                         \
+	RTIO_IODEV_DEFINE(name, &adc_iodev_api, (void *)&_adc_iodev_data_##name)
+
+/**
+ * @brief Define an RTIO iodev streaming samples of an ADC devicetree node
+ *
+ * @param name Symbolic name of the iodev.
+ * @param node_id Devicetree node identifier of the ADC device.
+ * @param _channels Bit mask of the sampled channels.
+ * @param _resolution Resolution of the samples.
+ * @param _frames Number of frames per block.
+ * @param _interval_us Interval between frames in microseconds.
+ * @param _trigger Driver specific hardware trigger, 0 for none.
+ */
+#define ADC_DT_IODEV_DEFINE(name, node_id, _channels, _resolution, _frames, _interval_us,       \
+			    _trigger)                                                              \
+	ADC_IODEV_DEFINE(name, DEVICE_DT_GET(node_id), _channels, _resolution, _frames,          \
+			 _interval_us, _trigger)
+
+/**
+ * @brief Stop an ADC stream
+ *
+ * Stops the capture started by the first read on the iodev and releases
+ * the device. The pending reads complete with -ECANCELED, a multishot read
+ * should be cancelled with rtio_sqe_cancel() first. The next read starts
+ * the capture again.
+ *
+ * @param iodev Iodev defined with ADC_IODEV_DEFINE().
+ *
+ * @retval 0 If successful.
+ * @retval -EALREADY The capture is not running.
+ * @retval -errno Other negative errno code on failure.
+ */
+int adc_stream_stop(const struct rtio_iodev *iodev);
+
+/**
+ * @brief Extract the samples of a channel from an ADC stream block
+ *
+ * @param buf Block read from the stream.
+ * @param buf_len Size of @p buf in bytes, the CQE result.
+ * @param channel_id Channel to extract.
+ * @param values Raw sample values of the channel, oldest first.
+ * @param max_values Number of elements in @p values.
+ *
+ * @return Number of values extracted, or -EINVAL if @p buf is not a valid
+ *         block or does not hold @p channel_id.
+ */
+int adc_stream_decode(const uint8_t *buf, uint32_t buf_len, uint8_t channel_id, int32_t *values,
+		      uint16_t max_values);
+
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @}
  */
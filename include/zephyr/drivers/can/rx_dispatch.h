@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_CAN_RX_DISPATCH_H_
+#define ZEPHYR_INCLUDE_DRIVERS_CAN_RX_DISPATCH_H_
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief CAN RX dispatcher
+ * @defgroup can_rx_dispatch CAN RX dispatcher
+ * @ingroup can_interface
+ * @{
+ *
+ * A CAN RX dispatcher accepts more RX filters than the CAN controller
+ * provides. The application filters are merged into a set of disjoint CAN
+ * ID/mask filters fitting the controller, and the frames accepted by the
+ * controller are matched against the application filters in software.
+ *
+ * Filters are merged by clearing the mask bits in which their CAN IDs differ,
+ * picking the merges that widen the filters the least. Filters that overlap
+ * are always merged, so that each received frame matches at most one
+ * controller filter and is delivered once to each matching application
+ * filter.
+ *
+ * The functions of a given dispatcher must not be called concurrently.
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+struct can_rx_dispatch;
+
+struct can_rx_dispatch_filter {
+	struct can_filter filter;
+	can_rx_callback_t callback;
+	void *user_data;
+	int16_t group;
+	bool in_use;
+};
+
+struct can_rx_dispatch_group {
+	struct can_rx_dispatch *dispatch;
+	struct can_filter filter;
+	int filter_id;
+};
+
+/** @endcond */
+
+/**
+ * @brief CAN RX dispatcher
+ *
+ * The fields are private, use can_rx_dispatch_init() to initialize it.
+ */
+struct can_rx_dispatch {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *dev;
+	struct k_spinlock lock;
+	struct can_rx_dispatch_filter filters[CONFIG_CAN_RX_DISPATCH_MAX_FILTERS];
+	struct can_rx_dispatch_group groups[CONFIG_CAN_RX_DISPATCH_MAX_GROUPS];
+	uint8_t num_groups;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a CAN RX dispatcher
+ *
+ * @param dispatch CAN RX dispatcher.
+ * @param dev CAN controller the dispatcher installs its filters on.
+ */
+void can_rx_dispatch_init(struct can_rx_dispatch *dispatch, const struct device *dev);
+
+/**
+ * @brief Add an application filter to a CAN RX dispatcher
+ *
+ * The filter is not active until can_rx_dispatch_apply() is called. The
+ * callback is called in interrupt context, and must not call the functions
+ * of this dispatcher.
+ *
+ * @param dispatch CAN RX dispatcher.
+ * @param callback Function called for each received frame matching @p filter.
+ * @param user_data User data to pass to @p callback.
+ * @param filter Filter to add.
+ *
+ * @retval filter_id on success.
+ * @retval -ENOSPC if there are no free application filters.
+ * @retval -EINVAL if the filter is invalid.
+ */
+int can_rx_dispatch_add(struct can_rx_dispatch *dispatch, can_rx_callback_t callback,
+			void *user_data, const struct can_filter *filter);
+
+/**
+ * @brief Remove an application filter from a CAN RX dispatcher
+ *
+ * The filter stops receiving frames immediately. The CAN controller filters
+ * are only updated by can_rx_dispatch_apply().
+ *
+ * @param dispatch CAN RX dispatcher.
+ * @param filter_id Filter ID returned by can_rx_dispatch_add().
+ */
+void can_rx_dispatch_remove(struct can_rx_dispatch *dispatch, int filter_id);
+
+/**
+ * @brief Install the application filters of a CAN RX dispatcher
+ *
+ * Merges the application filters and replaces the CAN controller filters
+ * previously installed by the dispatcher. Frames received while the
+ * controller filters are being replaced may be lost.
+ *
+ * @param dispatch CAN RX dispatcher.
+ *
+ * @return Number of CAN controller filters installed on success, or a
+ * negative error code from can_add_rx_filter() or can_get_max_filters().
+ */
+int can_rx_dispatch_apply(struct can_rx_dispatch *dispatch);
+
+/**
+ * @brief Buffer delivering received CAN frames in batches
+ *
+ * Use can_rx_batch_put() as the RX callback of a CAN filter, or of a CAN RX
+ * dispatcher filter, with the batch as user data. The reader is only woken up
+ * once the watermark is reached, or when its timeout expires.
+ */
+struct can_rx_batch {
+	/** Number of frames dropped because the buffer was full */
+	uint32_t overruns;
+	/** @cond INTERNAL_HIDDEN */
+	struct can_frame *frames;
+	size_t size;
+	size_t head;
+	size_t count;
+	size_t watermark;
+	struct k_spinlock lock;
+	struct k_sem sem;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a CAN RX batch buffer
+ *
+ * @param batch CAN RX batch buffer.
+ * @param frames Storage for the buffered frames.
+ * @param size Number of frames in @p frames.
+ * @param watermark Number of buffered frames waking up the reader, at most
+ *        @p size.
+ */
+void can_rx_batch_init(struct can_rx_batch *batch, struct can_frame *frames, size_t size,
+		       size_t watermark);
+
+/**
+ * @brief Add a received frame to a CAN RX batch buffer
+ *
+ * This function has the signature of a @ref can_rx_callback_t, with the
+ * batch buffer as user data.
+ *
+ * @param dev CAN controller the frame was received on.
+ * @param frame Received frame.
+ * @param user_data CAN RX batch buffer.
+ */
+void can_rx_batch_put(const struct device *dev, struct can_frame *frame, void *user_data);
+
+/**
+ * @brief Get frames from a CAN RX batch buffer
+ *
+ * Waits until the watermark is reached or @p timeout expires, then returns
+ * the frames buffered so far.
+ *
+ * @param batch CAN RX batch buffer.
+ * @param frames Where to store the frames.
+ * @param max Maximum number of frames to store.
+ * @param timeout Maximum time to wait for the watermark.
+ *
+ * @return Number of frames stored on success.
+ * @retval -EAGAIN if no frame was received before @p timeout expired.
+ */
+int can_rx_batch_get(struct can_rx_batch *batch, struct can_frame *frames, size_t max,
+		     k_timeout_t timeout);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_CAN_RX_DISPATCH_H_ */
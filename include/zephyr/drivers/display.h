@@ -26,6 +26,9 @@
 #include <stddef.h>
 #include <zephyr/types.h>
 #include <zephyr/dt-bindings/display/panel.h>
+#ifdef CONFIG_DISPLAY_ASYNC
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -134,6 +137,18 @@ struct display_buffer_descriptor {
 	bool frame_incomplete;
 };
 
+/** @brief Structure describing a region to write to the display */
+struct display_region {
+	/** x Coordinate of the upper left corner of the region */
+	uint16_t x;
+	/** y Coordinate of the upper left corner of the region */
+	uint16_t y;
+	/** Layout of the region data buffer */
+	struct display_buffer_descriptor desc;
+	/** Region data buffer */
+	const void *buf;
+};
+
 /**
  * @typedef display_blanking_on_api
  * @brief Callback API to turn on display blanking
@@ -265,6 +280,122 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+/**
+ * @brief Write several regions to display
+ *
+ * Writes the regions in order, typically the dirty areas of a frame.
+ * The frame_incomplete flag of each region descriptor is set by the
+ * caller, usually on all regions but the last one of the frame.
+ *
+ * @param dev Pointer to device structure
+ * @param regions Regions to write
+ * @param count Number of regions
+ *
+ * @retval 0 on success else negative errno code of the first failed write.
+ */
+static inline int display_write_regions(const struct device *dev,
+					const struct display_region *regions,
+					size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		int ret = display_write(dev, regions[i].x, regions[i].y,
+					&regions[i].desc, regions[i].buf);
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_DISPLAY_ASYNC) || defined(__DOXYGEN__)
+
+struct display_async_op;
+
+/**
+ * @brief Completion callback of an asynchronous display write
+ *
+ * Called from the display async work queue thread. The operation object
+ * and the written buffers may be reused from the callback.
+ *
+ * @param dev Display device.
+ * @param op Completed operation.
+ * @param result 0 on success, negative errno code of the write otherwise.
+ */
+typedef void (*display_async_cb_t)(const struct device *dev,
+				   struct display_async_op *op, int result);
+
+/**
+ * @brief Asynchronous display write operation
+ *
+ * Caller owned object describing a queued write. It must be zero
+ * initialized before its first use, and must not be modified or released
+ * until its callback is called.
+ */
+struct display_async_op {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	const struct device *dev;
+	struct display_region region;
+	const struct display_region *regions;
+	size_t count;
+	/** @endcond */
+
+	/** Completion callback. */
+	display_async_cb_t cb;
+	/** User data, not used by the display API. */
+	void *user_data;
+};
+
+/**
+ * @brief Queue a write to display
+ *
+ * Same as display_write(), but performed by the display async work queue
+ * thread, so the caller can render the next frame into another buffer
+ * while this one is transferred to the panel. Writes queued by all
+ * callers are performed one at a time in the order they were queued.
+ *
+ * @param dev Pointer to device structure
+ * @param x x Coordinate of the upper left corner where to write the buffer
+ * @param y y Coordinate of the upper left corner where to write the buffer
+ * @param desc Buffer layout, copied into @p op
+ * @param buf Buffer to write, must stay valid until the callback is called.
+ * @param op Operation object.
+ * @param cb Completion callback.
+ *
+ * @retval 0 if the write was queued.
+ * @retval -EBUSY if @p op is already queued.
+ */
+int display_write_async(const struct device *dev, const uint16_t x,
+			const uint16_t y,
+			const struct display_buffer_descriptor *desc,
+			const void *buf, struct display_async_op *op,
+			display_async_cb_t cb);
+
+/**
+ * @brief Queue a write of several regions to display
+ *
+ * Same as display_write_regions(), performed as a single queued operation
+ * with one completion callback once all regions are written.
+ *
+ * @param dev Pointer to device structure
+ * @param regions Regions to write, the array and the region buffers must
+ *        stay valid until the callback is called.
+ * @param count Number of regions
+ * @param op Operation object.
+ * @param cb Completion callback.
+ *
+ * @retval 0 if the write was queued.
+ * @retval -EBUSY if @p op is already queued.
+ */
+int display_write_regions_async(const struct device *dev,
+				const struct display_region *regions,
+				size_t count, struct display_async_op *op,
+				display_async_cb_t cb);
+
+#endif /* CONFIG_DISPLAY_ASYNC */
+
 /**
  * @brief Read data from display
  *
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Pool of hardware descriptors shared by the channels of a DMA controller
+ *
+ * DMA drivers building scatter-gather chains from hardware descriptors can take them from a pool
+ * shared by all channels of the controller, instead of reserving a fixed array per channel. A
+ * channel allocates a contiguous run of descriptors when it is first configured for
+ * scatter-gather, keeps it across reconfigurations and returns it when the channel is released.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_DESC_POOL_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_DESC_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE != 0)
+#define Z_DMA_DESC_POOL_DCACHE_LINE CONFIG_DCACHE_LINE_SIZE
+#else
+#define Z_DMA_DESC_POOL_DCACHE_LINE 1
+#endif
+/** @endcond */
+
+/** Descriptor pool */
+struct dma_desc_pool {
+	/** Descriptor storage */
+	uint8_t *descs;
+	/** Size of one descriptor in bytes */
+	size_t desc_size;
+	/** Allocation state, one bit per descriptor */
+	sys_bitarray_t *bitmap;
+};
+
+/**
+ * @brief Statically define a descriptor pool
+ *
+ * The storage is aligned to at least a data cache line, so that the descriptors of the pool do not
+ * share a cache line with other data.
+ *
+ * @param _name Name of the pool.
+ * @param _type Type of the hardware descriptor.
+ * @param _count Number of descriptors in the pool.
+ * @param _align Alignment required by the hardware for descriptors.
+ * @param _attr Attributes of the storage, e.g. a non-cacheable memory section.
+ */
+#define DMA_DESC_POOL_DEFINE(_name, _type, _count, _align, _attr)                                  \
+	static __aligned(MAX(_align, Z_DMA_DESC_POOL_DCACHE_LINE)) _attr _type                     \
+		_CONCAT(_name, _descs)[_count];                                                    \
+	SYS_BITARRAY_DEFINE_STATIC(_CONCAT(_name, _bitmap), _count);                              \
+	static const struct dma_desc_pool _name = {                                                \
+		.descs = (uint8_t *)_CONCAT(_name, _descs),                                        \
+		.desc_size = sizeof(_type),                                                        \
+		.bitmap = &_CONCAT(_name, _bitmap),                                                \
+	}
+
+/**
+ * @brief Allocate contiguous descriptors from a pool
+ *
+ * Can be called from any context.
+ *
+ * @param pool Descriptor pool.
+ * @param count Number of contiguous descriptors.
+ *
+ * @return Pointer to the first descriptor, or NULL if the pool has no such run available.
+ */
+static inline void *dma_desc_pool_alloc(const struct dma_desc_pool *pool, size_t count)
+{
+	size_t offset;
+
+	if (sys_bitarray_alloc(pool->bitmap, count, &offset) != 0) {
+		return NULL;
+	}
+
+	return pool->descs + offset * pool->desc_size;
+}
+
+/**
+ * @brief Return descriptors to a pool
+ *
+ * @param pool Descriptor pool.
+ * @param descs Pointer returned by dma_desc_pool_alloc().
+ * @param count Number of descriptors allocated with it.
+ */
+static inline void dma_desc_pool_free(const struct dma_desc_pool *pool, void *descs, size_t count)
+{
+	size_t offset = ((uint8_t *)descs - pool->descs) / pool->desc_size;
+
+	(void)sys_bitarray_free(pool->bitmap, count, offset);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_DESC_POOL_H_ */
@@ -26,6 +26,9 @@
 #include <stddef.h>
 #include <sys/types.h>
 #include <zephyr/device.h>
+#ifdef CONFIG_FLASH_ASYNC
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -714,6 +717,89 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+
+struct flash_async_op;
+
+/**
+ * @brief Completion callback of an asynchronous flash operation
+ *
+ * Called from the flash async work queue thread. The operation is idle by
+ * then, it may be queued again from the callback or by a thread it wakes up.
+ *
+ * @param dev Flash device.
+ * @param op Completed operation.
+ * @param result 0 on success, negative errno code of the operation otherwise.
+ */
+typedef void (*flash_async_cb_t)(const struct device *dev, struct flash_async_op *op,
+				 int result);
+
+/**
+ * @brief Asynchronous flash operation
+ *
+ * Caller owned object describing a queued operation. It must be zero
+ * initialized before its first use, and must not be modified or released
+ * until its callback is called.
+ */
+struct flash_async_op {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	atomic_t busy;
+	const struct device *dev;
+	off_t offset;
+	const void *data;
+	size_t size;
+	/** @endcond */
+
+	/** Completion callback. */
+	flash_async_cb_t cb;
+	/** User data, not used by the flash API. */
+	void *user_data;
+};
+
+/**
+ * @brief Queue a write to flash memory
+ *
+ * Same as flash_write(), but performed by the flash async work queue
+ * thread, so the caller is not blocked for the duration of the program
+ * operation. Operations queued by all callers are performed one at a time
+ * in the order they were queued.
+ *
+ * @param dev Flash device.
+ * @param offset Starting offset for the write.
+ * @param data Data to write, must stay valid until the callback is called.
+ * @param len Number of bytes to write.
+ * @param op Operation object.
+ * @param cb Completion callback.
+ *
+ * @retval 0 if the operation was queued.
+ * @retval -EBUSY if @p op is already queued.
+ */
+int flash_write_async(const struct device *dev, off_t offset, const void *data, size_t len,
+		      struct flash_async_op *op, flash_async_cb_t cb);
+
+/**
+ * @brief Queue an erase of flash memory
+ *
+ * Same as flash_erase(), but performed by the flash async work queue
+ * thread. Drivers supporting erase suspend (see
+ * @kconfig{CONFIG_SPI_NOR_ERASE_SUSPEND}) serve reads from other threads
+ * while the erase is in progress.
+ *
+ * @param dev Flash device.
+ * @param offset Erase area starting offset.
+ * @param size Size of area to be erased.
+ * @param op Operation object.
+ * @param cb Completion callback.
+ *
+ * @retval 0 if the operation was queued.
+ * @retval -EBUSY if @p op is already queued.
+ */
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_op *op, flash_async_cb_t cb);
+
+#endif /* CONFIG_FLASH_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
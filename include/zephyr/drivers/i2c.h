@@ -1177,6 +1177,40 @@ struct rtio_sqe *i2c_rtio_copy_reg_write_byte(struct rtio *r, struct rtio_iodev
 struct rtio_sqe *i2c_rtio_copy_reg_burst_read(struct rtio *r, struct rtio_iodev *iodev,
 					      uint8_t start_addr, void *buf, size_t num_bytes);
 
+/**
+ * @brief Register burst read of one device, see i2c_rtio_copy_reg_burst_reads()
+ */
+struct i2c_rtio_burst {
+	/** RTIO IODev of the device */
+	struct rtio_iodev *iodev;
+	/** Register address to start reading from */
+	uint8_t start_addr;
+	/** Buffer for the data read */
+	void *buf;
+	/** Number of bytes to read */
+	size_t num_bytes;
+};
+
+/**
+ * @brief acquire and configure a chain of i2c burst reads of several devices
+ *
+ * Each burst read is a register address write followed by a read, as done by
+ * i2c_rtio_copy_reg_burst_read(), and the bursts are chained in order. Bus
+ * controllers with native RTIO support run the whole chain from their
+ * interrupt handler. Only the last read generates a completion, a burst which
+ * fails additionally completes with its own error.
+ *
+ * @param r RTIO context
+ * @param bursts Array of burst reads
+ * @param num_bursts Number of burst reads in the array
+ * @param userdata User data of the completions
+ *
+ * @retval sqe Last submission in the queue added
+ * @retval NULL Not enough memory in the context to copy the requests
+ */
+struct rtio_sqe *i2c_rtio_copy_reg_burst_reads(struct rtio *r, const struct i2c_rtio_burst *bursts,
+					       size_t num_bursts, void *userdata);
+
 #endif /* CONFIG_I2C_RTIO */
 
 /**
@@ -27,6 +27,9 @@
 
 #include <zephyr/types.h>
 #include <zephyr/device.h>
+#ifdef CONFIG_I2S_RTIO
+#include <zephyr/rtio/rtio.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -186,6 +189,39 @@ typedef uint8_t i2s_opt_t;
 /** I2S driver is frame clock slave */
 #define I2S_OPT_FRAME_CLK_SLAVE             BIT(2)
 
+/** @brief Planar memory blocks.
+ *
+ * Instead of interleaved frames, each memory block holds the samples of one
+ * channel after the other: the block is split into @c channels equally sized
+ * contiguous areas and channel N occupies area N. Drivers place the samples
+ * there directly by using the stride capabilities of their DMA engine, saving
+ * the application a de-interleaving pass over the data.
+ *
+ * Not supported by all drivers and directions. i2s_configure() fails with
+ * -ENOTSUP where it is not available.
+ */
+#define I2S_OPT_PLANAR                      BIT(3)
+
+/** @brief Recover from underruns by transmitting silence.
+ *
+ * When the TX queue runs empty while the stream is running, the driver
+ * transmits a block of silence instead of stopping, and the stream carries
+ * on with the next block written. When no RX memory block is available, the
+ * oldest received block not yet read is dropped and reused, so that the
+ * reception carries on. The stream does not go to the ERROR state and no
+ * PREPARE trigger is needed.
+ *
+ * Only supported by drivers implementing i2s_get_stats(), ignored by others.
+ */
+#define I2S_OPT_XRUN_SILENCE                BIT(4)
+
+/** @brief Recover from underruns by repeating the last block.
+ *
+ * As @ref I2S_OPT_XRUN_SILENCE, except that on TX underrun the last block
+ * transmitted is sent again rather than silence.
+ */
+#define I2S_OPT_XRUN_REPEAT                 BIT(5)
+
 /** @brief Loop back mode.
  *
  * In loop back mode RX input will be connected internally to TX output.
@@ -313,11 +349,71 @@ struct i2s_config {
 	int32_t timeout;
 };
 
+/** @struct i2s_group_member
+ * @brief Stream of a group started by i2s_trigger_group().
+ */
+struct i2s_group_member {
+	/** Pointer to the device structure for the driver instance. */
+	const struct device *dev;
+	/** Stream direction: RX or TX, as defined by I2S_DIR_*. */
+	enum i2s_dir dir;
+};
+
+/** @struct i2s_position
+ * @brief Stream position, as returned by i2s_get_position().
+ *
+ * Pairs a frame count with the time at which it was reached, so that the
+ * stream can be related to other clocks for synchronization.
+ */
+struct i2s_position {
+	/** Number of frames transferred since the stream was last started. */
+	uint64_t frames;
+	/** Value of k_cycle_get_32() when @ref frames was reached. */
+	uint32_t cycles;
+};
+
+/** @struct i2s_stats
+ * @brief Stream statistics, as returned by i2s_get_stats().
+ *
+ * The statistics are cleared by i2s_configure().
+ */
+struct i2s_stats {
+	/** Number of TX underruns or RX overruns. */
+	uint32_t xruns;
+	/** Number of xruns recovered without stopping the stream, see
+	 * @ref I2S_OPT_XRUN_SILENCE and @ref I2S_OPT_XRUN_REPEAT.
+	 */
+	uint32_t xruns_recovered;
+	/** Smallest slack seen when a block completed, in frames: data queued
+	 * ahead of the DMA for TX, free buffer space for RX. UINT32_MAX until
+	 * the first block completes.
+	 */
+	uint32_t min_slack_frames;
+};
+
+/**
+ * @brief Callback called on stream xruns, see i2s_xrun_callback_set().
+ *
+ * Called from interrupt context.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction, RX or TX.
+ * @param recovered True if the stream carried on.
+ * @param user_data User data given to i2s_xrun_callback_set().
+ */
+typedef void (*i2s_xrun_callback_t)(const struct device *dev, enum i2s_dir dir,
+				    bool recovered, void *user_data);
+
 /**
  * @cond INTERNAL_HIDDEN
  *
  * For internal use only, skip these in public documentation.
  */
+#ifdef CONFIG_I2S_RTIO
+typedef void (*i2s_api_iodev_submit)(const struct device *dev, enum i2s_dir dir,
+				     struct rtio_iodev_sqe *iodev_sqe);
+#endif /* CONFIG_I2S_RTIO */
+
 __subsystem struct i2s_driver_api {
 	int (*configure)(const struct device *dev, enum i2s_dir dir,
 			 const struct i2s_config *cfg);
@@ -327,6 +423,15 @@ __subsystem struct i2s_driver_api {
 	int (*write)(const struct device *dev, void *mem_block, size_t size);
 	int (*trigger)(const struct device *dev, enum i2s_dir dir,
 		       enum i2s_trigger_cmd cmd);
+	int (*get_position)(const struct device *dev, enum i2s_dir dir,
+			    struct i2s_position *pos);
+	int (*group_arm)(const struct device *dev, enum i2s_dir dir);
+	int (*group_start)(const struct device *dev, enum i2s_dir dir);
+	int (*get_stats)(const struct device *dev, enum i2s_dir dir,
+			 struct i2s_stats *stats);
+#ifdef CONFIG_I2S_RTIO
+	i2s_api_iodev_submit iodev_submit;
+#endif /* CONFIG_I2S_RTIO */
 };
 /**
  * @endcond
@@ -506,6 +611,70 @@ static inline int i2s_write(const struct device *dev, void *mem_block,
  */
 __syscall int i2s_buf_write(const struct device *dev, void *buf, size_t size);
 
+/**
+ * @brief Claim a memory block of the I2S stream for in-place access
+ *
+ * Zero-copy counterpart of i2s_buf_read() and i2s_buf_write(). Instead of
+ * copying data between a caller provided buffer and the stream memory slab,
+ * the memory block itself is lent to the caller, which must hand it back
+ * with i2s_buf_release().
+ *
+ * For the RX direction this removes the next block from the RX queue, in
+ * the same way as i2s_read(). For the TX direction a free block is taken
+ * from the TX memory slab, waiting at most the timeout set by
+ * i2s_configure().
+ *
+ * When called from user mode the memory slab buffer must be accessible to
+ * the calling thread, e.g. by placing it in a memory partition of the
+ * thread's memory domain.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction: RX or TX, as defined by I2S_DIR_*.
+ * @param mem_block Pointer to the variable storing the claimed memory block.
+ * @param size Pointer to the variable storing the number of valid bytes in
+ *        the block for RX, or the configured block size for TX.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid stream direction.
+ * @retval -EIO The interface is in NOT_READY or ERROR state and there are no
+ *         more data blocks in the RX queue, or the TX stream is not
+ *         configured.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -ENOMEM No memory in TX slab queue, or the user mode threads hold
+ *         CONFIG_I2S_USERSPACE_CLAIMED_BLOCKS blocks already.
+ * @retval -EPERM The calling thread has no access to the memory slab buffer.
+ */
+__syscall int i2s_buf_claim(const struct device *dev, enum i2s_dir dir,
+			    void **mem_block, size_t *size);
+
+/**
+ * @brief Return a memory block claimed with i2s_buf_claim()
+ *
+ * For the TX direction the block is queued for transmission, in the same
+ * way as i2s_write(). A @p size of 0 gives the block back to the TX memory
+ * slab without transmitting it. For the RX direction the block is freed
+ * and @p size is ignored.
+ *
+ * The caller gives up ownership of the block in all cases, including when
+ * an error is returned.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction: RX or TX, as defined by I2S_DIR_*.
+ * @param mem_block Memory block previously obtained with i2s_buf_claim().
+ * @param size Number of bytes to write. This value has to be equal or smaller
+ *        than the size of the channel's TX memory block configuration.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid stream direction, size larger than the TX memory
+ *         block, or from user mode, block not claimed by the calling thread.
+ * @retval -EIO The interface is not in READY or RUNNING state.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int i2s_buf_release(const struct device *dev, enum i2s_dir dir,
+			      void *mem_block, size_t size);
+
 /**
  * @brief Send a trigger command.
  *
@@ -536,6 +705,196 @@ static inline int z_impl_i2s_trigger(const struct device *dev,
 	return api->trigger(dev, dir, cmd);
 }
 
+/**
+ * @brief Get the xrun statistics of a stream.
+ *
+ * Used to tune the number and size of the stream memory blocks.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction: RX or TX, as defined by I2S_DIR_*.
+ * @param stats Pointer to the variable storing the statistics.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid stream direction.
+ * @retval -ENOSYS Not implemented by the driver.
+ */
+__syscall int i2s_get_stats(const struct device *dev, enum i2s_dir dir,
+			    struct i2s_stats *stats);
+
+static inline int z_impl_i2s_get_stats(const struct device *dev,
+				       enum i2s_dir dir,
+				       struct i2s_stats *stats)
+{
+	const struct i2s_driver_api *api =
+		(const struct i2s_driver_api *)dev->api;
+
+	if (api->get_stats == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->get_stats(dev, dir, stats);
+}
+
+/**
+ * @brief Set the callback called on stream xruns.
+ *
+ * A single callback serves all the I2S devices, meant for tracing. Only
+ * drivers implementing i2s_get_stats() call it.
+ *
+ * @param cb Callback, NULL to remove it.
+ * @param user_data User data passed to @p cb.
+ */
+void i2s_xrun_callback_set(i2s_xrun_callback_t cb, void *user_data);
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Called by the drivers to report an xrun to the callback */
+void i2s_xrun_notify(const struct device *dev, enum i2s_dir dir, bool recovered);
+
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Send a trigger command to a group of streams.
+ *
+ * With @ref I2S_TRIGGER_START the streams are started together: every stream
+ * is first armed, with its DMA loaded and its FIFO filled, then all of them
+ * are enabled back to back with interrupts locked. Streams clocked by another
+ * member of the group (bit or frame clock slaves, or synchronous SAI blocks)
+ * are enabled when armed and start on the first frame of their clock master,
+ * so that they are aligned to the sample. Members with independent clocks
+ * are only started within a few bus accesses of each other.
+ *
+ * If a stream fails to arm, the streams already armed are dropped. Other
+ * commands are sent to each stream in turn with i2s_trigger().
+ *
+ * Must not be called from user mode.
+ *
+ * @param members Streams of the group.
+ * @param count Number of elements in @p members.
+ * @param cmd Trigger command.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOSYS A driver does not support group start.
+ * @retval -errno Error returned by a driver.
+ */
+int i2s_trigger_group(const struct i2s_group_member *members, size_t count,
+		      enum i2s_trigger_cmd cmd);
+
+/**
+ * @brief Get the position of a running stream.
+ *
+ * Returns the number of frames transferred since the stream was last started
+ * together with the time at which that count was reached. Depending on the
+ * driver, the count is either sampled at the time of the call from the DMA
+ * progress within the current block, or the count at the last completed
+ * block. In both cases the position refers to the data moved to or from the
+ * controller FIFO, which leads the pins by the FIFO depth.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction: RX or TX, as defined by I2S_DIR_*.
+ * @param pos Pointer to the variable storing the position.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid stream direction.
+ * @retval -EIO The stream is not configured.
+ * @retval -ENOSYS Not implemented by the driver.
+ */
+__syscall int i2s_get_position(const struct device *dev, enum i2s_dir dir,
+			       struct i2s_position *pos);
+
+static inline int z_impl_i2s_get_position(const struct device *dev,
+					  enum i2s_dir dir,
+					  struct i2s_position *pos)
+{
+	const struct i2s_driver_api *api =
+		(const struct i2s_driver_api *)dev->api;
+
+	if (api->get_position == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->get_position(dev, dir, pos);
+}
+
+#if defined(CONFIG_I2S_RTIO) || defined(__DOXYGEN__)
+
+/**
+ * @brief I2S stream of an RTIO iodev
+ *
+ * Defined by I2S_IODEV_DEFINE() or I2S_DT_IODEV_DEFINE().
+ */
+struct i2s_iodev_data {
+	/** I2S device. */
+	const struct device *dev;
+	/** Stream direction, I2S_DIR_RX or I2S_DIR_TX. */
+	enum i2s_dir dir;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api i2s_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO iodev for a stream of an I2S device
+ *
+ * The stream is configured and triggered with the regular I2S API, the
+ * iodev replaces i2s_read() or i2s_write() for moving the data:
+ *
+ * - For I2S_DIR_RX, a read SQE completes with the next received block,
+ *   copied into its buffer. The buffer must be able to hold a block. With
+ *   rtio_sqe_prep_read_multishot() and a mempool buffer, every received
+ *   block produces a CQE whose buffer is obtained with
+ *   rtio_cqe_get_mempool_buffer(). The CQE result is the number of bytes
+ *   received.
+ * - For I2S_DIR_TX, a write SQE copies its buffer, at most one block, into
+ *   a block of the TX memory slab and queues it for transmission.
+ *
+ * Drivers may implement the iodev natively, otherwise the requests are
+ * served by the RTIO work queue with the blocking I2S API. Reading or
+ * writing a stream with both the iodev and i2s_read()/i2s_write() at the
+ * same time is not supported.
+ *
+ * @param name Symbolic name of the iodev.
+ * @param _dev I2S device.
+ * @param _dir Stream direction, I2S_DIR_RX or I2S_DIR_TX.
+ */
+#define I2S_IODEV_DEFINE(name, _dev, _dir)                                                         \
+	static const struct i2s_iodev_data _i2s_iodev_data_##name = {                              \
+		.dev = _dev,                                                                       \
+		.dir = _dir,                                                                       \
+	};                                                                                         \
+	RTIO_IODEV_DEFINE(name, &i2s_iodev_api, (void *)&_i2s_iodev_data_##name)
+
+/**
+ * @brief Define an RTIO iodev for a stream of an I2S devicetree node
+ *
+ * @param name Symbolic name of the iodev.
+ * @param node_id Devicetree node identifier of the I2S device.
+ * @param _dir Stream direction, I2S_DIR_RX or I2S_DIR_TX.
+ */
+#define I2S_DT_IODEV_DEFINE(name, node_id, _dir)                                                   \
+	I2S_IODEV_DEFINE(name, DEVICE_DT_GET(node_id), _dir)
+
+/**
+ * @brief Serve an I2S iodev request with the blocking I2S API
+ *
+ * Used for drivers without native iodev support, and by drivers for the
+ * requests they do not handle natively. The request is performed by the
+ * RTIO work queue.
+ *
+ * @param dev I2S device.
+ * @param dir Stream direction.
+ * @param iodev_sqe Request.
+ */
+void i2s_rtio_iodev_default_submit(const struct device *dev, enum i2s_dir dir,
+				   struct rtio_iodev_sqe *iodev_sqe);
+
+#endif /* CONFIG_I2S_RTIO */
+
 /**
  * @}
  */
@@ -600,6 +600,60 @@ static inline int sensor_decode(struct sensor_decode_context *ctx, void *out, ui
 int sensor_natively_supported_channel_size_info(struct sensor_chan_spec channel, size_t *base_size,
 						size_t *frame_size);
 
+/**
+ * @brief Decode N frames into one q31 array per axis
+ *
+ * Decodes up to @p max_count frames of a q31 or three axis channel with the decoder, and
+ * converts them to separate arrays of values per axis (structure of arrays) with a common
+ * @p shift. The data layout is taken from the size information of the decoder, or from
+ * sensor_natively_supported_channel_size_info() when the decoder has none. Values which do not fit the shift saturate. The frames are decoded in chunks, so
+ * a whole FIFO buffer costs a few decoder calls.
+ *
+ * @param[in]     decoder The decoder of the sensor
+ * @param[in]     buffer The buffer provided on the @ref rtio context
+ * @param[in]     channel The channel to decode
+ * @param[in,out] fit The current frame iterator
+ * @param[in]     max_count Maximum number of frames to decode
+ * @param[in]     shift Shift of the decoded values
+ * @param[out]    values Arrays of at least @p max_count values, three for three axis
+ *                channels and one for other channels, including a single axis of a
+ *                channel decoded as three axis data
+ * @param[out]    timestamps_ns Array of at least @p max_count timestamps, may be NULL
+ * @return 0 no more frames to decode
+ * @return >0 the number of decoded frames
+ * @return -ENOTSUP if the size information of the decoder does not report q31 or three
+ *         axis data for the channel
+ * @return <0 on other errors of the decoder
+ */
+int sensor_decode_q31_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			  struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+			  int8_t shift, q31_t *const values[], uint64_t *timestamps_ns);
+
+/**
+ * @brief Decode N frames into one float array per axis
+ *
+ * Same as sensor_decode_q31_soa(), with the values converted to float in the unit of the
+ * channel.
+ *
+ * @param[in]     decoder The decoder of the sensor
+ * @param[in]     buffer The buffer provided on the @ref rtio context
+ * @param[in]     channel The channel to decode
+ * @param[in,out] fit The current frame iterator
+ * @param[in]     max_count Maximum number of frames to decode
+ * @param[out]    values Arrays of at least @p max_count values, three for three axis
+ *                channels and one for other channels, including a single axis of a
+ *                channel decoded as three axis data
+ * @param[out]    timestamps_ns Array of at least @p max_count timestamps, may be NULL
+ * @return 0 no more frames to decode
+ * @return >0 the number of decoded frames
+ * @return -ENOTSUP if the size information of the decoder does not report q31 or three
+ *         axis data for the channel
+ * @return <0 on other errors of the decoder
+ */
+int sensor_decode_float_soa(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			    struct sensor_chan_spec channel, uint32_t *fit, uint16_t max_count,
+			    float *const values[], uint64_t *timestamps_ns);
+
 /**
  * @typedef sensor_get_decoder_t
  * @brief Get the decoder associate with the given device
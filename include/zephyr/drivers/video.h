@@ -913,6 +913,52 @@ struct video_buffer *video_buffer_alloc(size_t size, k_timeout_t timeout);
  */
 void video_buffer_release(struct video_buffer *buf);
 
+/**
+ * @brief Share a video buffer between several consumers.
+ *
+ * Typically called on a buffer dequeued from a capture device, to hand it
+ * at the same time to several consumers, such as a display, an encoder
+ * or the network, without copying it. Each consumer calls
+ * video_buffer_unref() once done with the buffer. When the last one
+ * does, the buffer is enqueued back to @p dev, or released if @p dev is
+ * NULL.
+ *
+ * Only buffers allocated with video_buffer_alloc() or
+ * video_buffer_aligned_alloc() can be shared.
+ *
+ * @param dev Device to enqueue the buffer to once released, or NULL.
+ * @param buf Pointer to the video buffer.
+ * @param consumers Initial number of consumers, at least 1.
+ *
+ * @retval 0 Is successful.
+ * @retval -EINVAL If the buffer is not from the video buffer pool.
+ * @retval -EBUSY If the buffer is already shared.
+ */
+int video_buffer_share(const struct device *dev, struct video_buffer *buf,
+		       unsigned int consumers);
+
+/**
+ * @brief Add a consumer to a shared video buffer.
+ *
+ * @param buf Pointer to the shared video buffer.
+ *
+ * @retval 0 Is successful.
+ * @retval -EINVAL If the buffer is not shared.
+ */
+int video_buffer_ref(struct video_buffer *buf);
+
+/**
+ * @brief Release a shared video buffer from a consumer.
+ *
+ * @param buf Pointer to the shared video buffer.
+ *
+ * @retval 0 Is successful.
+ * @retval -EINVAL If the buffer is not shared.
+ * @return Error of video_enqueue() if the buffer could not be enqueued
+ *         back once released by all consumers.
+ */
+int video_buffer_unref(struct video_buffer *buf);
+
 /**
  * @brief Search for a format that matches in a list of capabilities
  *
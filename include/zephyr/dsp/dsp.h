@@ -41,6 +41,10 @@
 
 #include <zephyr/dsp/basicmath.h>
 
+#include <zephyr/dsp/filtering.h>
+
+#include <zephyr/dsp/support.h>
+
 #include <zephyr/dsp/print_format.h>
 
 #include "zdsp_backend.h"
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/filtering.h
+ *
+ * @brief Public APIs for DSP filtering
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_FILTERING_H_
+#define ZEPHYR_INCLUDE_DSP_FILTERING_H_
+
+#include <string.h>
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_filtering Filtering Functions
+ * Block based FIR and IIR filters for DSP.
+ * @{
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @defgroup math_dsp_filtering_fir Finite Impulse Response Filters
+ *
+ * Block based FIR filter.
+ * <pre>
+ *     dst[n] = b[0] * src[n] + b[1] * src[n-1] + ... + b[num_taps-1] * src[n-num_taps+1]
+ * </pre>
+ * The coefficients are stored in time reversed order, i.e.
+ * <code>{b[num_taps-1], b[num_taps-2], ..., b[0]}</code>. The state buffer holds
+ * <code>num_taps + block_size - 1</code> samples, where @p block_size is the largest number of
+ * samples ever passed in one call.
+ *
+ * There are separate functions for floating-point, Q15, and Q31 data types.
+ * @{
+ */
+
+/** @brief Instance structure for the Q15 FIR filter. */
+struct zdsp_fir_q15 {
+	/** Points to the coefficient array, of length num_taps */
+	const DSP_DATA q15_t *coeffs;
+	/** Points to the state array, of length num_taps + block_size - 1 */
+	DSP_DATA q15_t *state;
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+};
+
+/** @brief Instance structure for the Q31 FIR filter. */
+struct zdsp_fir_q31 {
+	/** Points to the coefficient array, of length num_taps */
+	const DSP_DATA q31_t *coeffs;
+	/** Points to the state array, of length num_taps + block_size - 1 */
+	DSP_DATA q31_t *state;
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+};
+
+/** @brief Instance structure for the floating-point FIR filter. */
+struct zdsp_fir_f32 {
+	/** Points to the coefficient array, of length num_taps */
+	const DSP_DATA float32_t *coeffs;
+	/** Points to the state array, of length num_taps + block_size - 1 */
+	DSP_DATA float32_t *state;
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+};
+
+/**
+ * @brief Initialize a Q15 FIR filter and clear its state.
+ *
+ * @param[out] fir        FIR filter instance
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the time reversed coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+static inline void zdsp_fir_init_q15(struct zdsp_fir_q15 *fir, uint16_t num_taps,
+				     const DSP_DATA q15_t *coeffs, DSP_DATA q15_t *state,
+				     uint32_t block_size)
+{
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->num_taps = num_taps;
+	memset(state, 0, (num_taps + block_size - 1U) * sizeof(q15_t));
+}
+
+/**
+ * @brief Initialize a Q31 FIR filter and clear its state.
+ *
+ * @param[out] fir        FIR filter instance
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the time reversed coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+static inline void zdsp_fir_init_q31(struct zdsp_fir_q31 *fir, uint16_t num_taps,
+				     const DSP_DATA q31_t *coeffs, DSP_DATA q31_t *state,
+				     uint32_t block_size)
+{
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->num_taps = num_taps;
+	memset(state, 0, (num_taps + block_size - 1U) * sizeof(q31_t));
+}
+
+/**
+ * @brief Initialize a floating-point FIR filter and clear its state.
+ *
+ * @param[out] fir        FIR filter instance
+ * @param[in]  num_taps   number of filter coefficients
+ * @param[in]  coeffs     points to the time reversed coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  block_size largest number of samples processed per call
+ */
+static inline void zdsp_fir_init_f32(struct zdsp_fir_f32 *fir, uint16_t num_taps,
+				     const DSP_DATA float32_t *coeffs, DSP_DATA float32_t *state,
+				     uint32_t block_size)
+{
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->num_taps = num_taps;
+	memset(state, 0, (num_taps + block_size - 1U) * sizeof(float32_t));
+}
+
+/**
+ * @brief Q15 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are accumulated in a 64-bit accumulator, so no intermediate overflow occurs.
+ *   The result is shifted back to Q15 and saturated.
+ *
+ * @param[in]  fir        FIR filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_q15(const struct zdsp_fir_q15 *fir, const DSP_DATA q15_t *src,
+				 DSP_DATA q15_t *dst, uint32_t block_size);
+
+/**
+ * @brief Q31 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are accumulated in a 64-bit accumulator in 2.62 format. To avoid overflow the
+ *   input should be scaled down by log2(num_taps) bits.
+ *
+ * @param[in]  fir        FIR filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_q31(const struct zdsp_fir_q31 *fir, const DSP_DATA q31_t *src,
+				 DSP_DATA q31_t *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter.
+ *
+ * @param[in]  fir        FIR filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const DSP_DATA float32_t *src,
+				 DSP_DATA float32_t *dst, uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @defgroup math_dsp_filtering_biquad Biquad Cascade IIR Filters
+ *
+ * Cascade of second order sections in Direct Form I.
+ * <pre>
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * The feedback coefficients a1 and a2 are stored negated compared to the usual notation. Each
+ * stage keeps four state values <code>{x[n-1], x[n-2], y[n-1], y[n-2]}</code>.
+ *
+ * The Q15 coefficients are stored as <code>{b0, 0, b1, b2, a1, a2}</code> per stage, the Q31 and
+ * floating-point coefficients as <code>{b0, b1, b2, a1, a2}</code> per stage. For the fixed-point
+ * variants, coefficients are stored divided by <code>2^post_shift</code> so that values beyond
+ * the [-1 1) range can be represented.
+ *
+ * There are separate functions for floating-point, Q15, and Q31 data types.
+ * @{
+ */
+
+/** @brief Instance structure for the Q15 biquad cascade filter. */
+struct zdsp_biquad_q15 {
+	/** Points to the coefficient array, of length 6 * num_stages */
+	const DSP_DATA q15_t *coeffs;
+	/** Points to the state array, of length 4 * num_stages */
+	DSP_DATA q15_t *state;
+	/** Number of second order stages */
+	uint8_t num_stages;
+	/** Left shift applied to the accumulator to compensate for the coefficient scaling */
+	int8_t post_shift;
+};
+
+/** @brief Instance structure for the Q31 biquad cascade filter. */
+struct zdsp_biquad_q31 {
+	/** Points to the coefficient array, of length 5 * num_stages */
+	const DSP_DATA q31_t *coeffs;
+	/** Points to the state array, of length 4 * num_stages */
+	DSP_DATA q31_t *state;
+	/** Number of second order stages */
+	uint8_t num_stages;
+	/** Left shift applied to the accumulator to compensate for the coefficient scaling */
+	int8_t post_shift;
+};
+
+/** @brief Instance structure for the floating-point biquad cascade filter. */
+struct zdsp_biquad_f32 {
+	/** Points to the coefficient array, of length 5 * num_stages */
+	const DSP_DATA float32_t *coeffs;
+	/** Points to the state array, of length 4 * num_stages */
+	DSP_DATA float32_t *state;
+	/** Number of second order stages */
+	uint8_t num_stages;
+};
+
+/**
+ * @brief Initialize a Q15 biquad cascade filter and clear its state.
+ *
+ * @param[out] biquad     biquad filter instance
+ * @param[in]  num_stages number of second order stages
+ * @param[in]  coeffs     points to the coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  post_shift shift to compensate for the coefficient scaling
+ */
+static inline void zdsp_biquad_init_q15(struct zdsp_biquad_q15 *biquad, uint8_t num_stages,
+					const DSP_DATA q15_t *coeffs, DSP_DATA q15_t *state,
+					int8_t post_shift)
+{
+	biquad->coeffs = coeffs;
+	biquad->state = state;
+	biquad->num_stages = num_stages;
+	biquad->post_shift = post_shift;
+	memset(state, 0, 4U * num_stages * sizeof(q15_t));
+}
+
+/**
+ * @brief Initialize a Q31 biquad cascade filter and clear its state.
+ *
+ * @param[out] biquad     biquad filter instance
+ * @param[in]  num_stages number of second order stages
+ * @param[in]  coeffs     points to the coefficients
+ * @param[in]  state      points to the state buffer
+ * @param[in]  post_shift shift to compensate for the coefficient scaling
+ */
+static inline void zdsp_biquad_init_q31(struct zdsp_biquad_q31 *biquad, uint8_t num_stages,
+					const DSP_DATA q31_t *coeffs, DSP_DATA q31_t *state,
+					int8_t post_shift)
+{
+	biquad->coeffs = coeffs;
+	biquad->state = state;
+	biquad->num_stages = num_stages;
+	biquad->post_shift = post_shift;
+	memset(state, 0, 4U * num_stages * sizeof(q31_t));
+}
+
+/**
+ * @brief Initialize a floating-point biquad cascade filter and clear its state.
+ *
+ * @param[out] biquad     biquad filter instance
+ * @param[in]  num_stages number of second order stages
+ * @param[in]  coeffs     points to the coefficients
+ * @param[in]  state      points to the state buffer
+ */
+static inline void zdsp_biquad_init_f32(struct zdsp_biquad_f32 *biquad, uint8_t num_stages,
+					const DSP_DATA float32_t *coeffs, DSP_DATA float32_t *state)
+{
+	biquad->coeffs = coeffs;
+	biquad->state = state;
+	biquad->num_stages = num_stages;
+	memset(state, 0, 4U * num_stages * sizeof(float32_t));
+}
+
+/**
+ * @brief Q15 biquad cascade filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   Each stage accumulates in a 64-bit accumulator. The result is shifted back to Q15 according
+ *   to post_shift and saturated.
+ *
+ * @param[in]  biquad     biquad filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_q15(const struct zdsp_biquad_q15 *biquad,
+				    const DSP_DATA q15_t *src, DSP_DATA q15_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Q31 biquad cascade filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   Each stage accumulates in a 64-bit accumulator. The result is shifted back to Q31 according
+ *   to post_shift, without saturation. Scale the input down to avoid overflows.
+ *
+ * @param[in]  biquad     biquad filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_q31(const struct zdsp_biquad_q31 *biquad,
+				    const DSP_DATA q31_t *src, DSP_DATA q31_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Floating-point biquad cascade filter.
+ *
+ * @param[in]  biquad     biquad filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FUNC_SCOPE void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad,
+				    const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_FILTERING_H_ */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/offload.h
+ *
+ * @brief Public APIs for offloading DSP processing to another core
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_OFFLOAD_H_
+#define ZEPHYR_INCLUDE_DSP_OFFLOAD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_offload DSP Offload
+ *
+ * Processing jobs submitted by a host core and run by a remote core.
+ *
+ * The host and the remote exchange job requests and completions over the IPC service instance
+ * chosen with @c zephyr,dsp-offload-ipc. Jobs do not carry data, they reference buffers in memory
+ * shared by both cores. When the chosen @c zephyr,dsp-offload-shm memory region exists, buffers
+ * must be located in it and are exchanged as offsets into it, so that each core may map the
+ * region at its own address. Otherwise both cores must see the buffers at the same address.
+ *
+ * Data caches are maintained by the service, buffers should start and end on a data cache line.
+ * The remote runs the jobs in order, from a dedicated thread.
+ * @{
+ */
+
+/** @brief Operations of jobs. */
+enum zdsp_offload_op {
+	/** Q15 FIR filter, context is a struct zdsp_offload_fir */
+	ZDSP_OFFLOAD_OP_FIR_Q15 = 1,
+	/** Q31 FIR filter, context is a struct zdsp_offload_fir */
+	ZDSP_OFFLOAD_OP_FIR_Q31,
+	/** Floating-point FIR filter, context is a struct zdsp_offload_fir */
+	ZDSP_OFFLOAD_OP_FIR_F32,
+	/** Q15 biquad cascade, e.g. an equalizer, context is a struct zdsp_offload_biquad */
+	ZDSP_OFFLOAD_OP_BIQUAD_Q15,
+	/** Q31 biquad cascade, context is a struct zdsp_offload_biquad */
+	ZDSP_OFFLOAD_OP_BIQUAD_Q31,
+	/** Floating-point biquad cascade, context is a struct zdsp_offload_biquad */
+	ZDSP_OFFLOAD_OP_BIQUAD_F32,
+	/** Asynchronous sample rate conversion, context is a struct audio_asrc */
+	ZDSP_OFFLOAD_OP_ASRC,
+	/** LC3 frame encoding, handler provided by the application of the remote */
+	ZDSP_OFFLOAD_OP_LC3_ENCODE,
+	/** LC3 frame decoding, handler provided by the application of the remote */
+	ZDSP_OFFLOAD_OP_LC3_DECODE,
+	/** First operation free for application specific handlers */
+	ZDSP_OFFLOAD_OP_USER = 0x100,
+};
+
+/**
+ * @brief Context of FIR filter jobs
+ *
+ * Lives in shared memory, like the coefficients and the state it references, so that the state
+ * persists across jobs.
+ */
+struct zdsp_offload_fir {
+	/** Time reversed coefficients, see zdsp_offload_addr() */
+	uint32_t coeffs;
+	/** State buffer of num_taps + block_size - 1 samples, see zdsp_offload_addr() */
+	uint32_t state;
+	/** Number of filter coefficients */
+	uint16_t num_taps;
+};
+
+/**
+ * @brief Context of biquad cascade jobs
+ *
+ * Lives in shared memory, like the coefficients and the state it references, so that the state
+ * persists across jobs.
+ */
+struct zdsp_offload_biquad {
+	/** Coefficients, see zdsp_offload_addr() */
+	uint32_t coeffs;
+	/** State buffer of 4 * num_stages values, see zdsp_offload_addr() */
+	uint32_t state;
+	/** Number of second order stages */
+	uint8_t num_stages;
+	/** Accumulator left shift of the fixed-point variants */
+	int8_t post_shift;
+};
+
+struct zdsp_offload_job;
+
+/**
+ * @brief Completion callback of a job
+ *
+ * Called from the context receiving IPC messages on the host.
+ *
+ * @param job Completed job, with its result set.
+ */
+typedef void (*zdsp_offload_cb_t)(struct zdsp_offload_job *job);
+
+/** @brief Job submitted by the host, owned by the service until completed. */
+struct zdsp_offload_job {
+	/** Operation, one of @ref zdsp_offload_op */
+	uint16_t op;
+	/** Input buffer in shared memory */
+	const void *src;
+	/** Size of the input in bytes */
+	size_t src_len;
+	/** Output buffer in shared memory */
+	void *dst;
+	/** Capacity of the output in bytes */
+	size_t dst_len;
+	/** Operation specific context in shared memory, updated by the job, or NULL */
+	void *ctx;
+	/** Size of the context in bytes */
+	size_t ctx_len;
+	/** Operation specific argument, e.g. the number of samples or frames */
+	uint32_t arg;
+	/** Completion callback, or NULL */
+	zdsp_offload_cb_t cb;
+	/** User data of the callback */
+	void *user_data;
+	/**
+	 * Result, set on completion: a non-negative operation specific value, typically the number
+	 * of bytes written to the output, or a negative error code
+	 */
+	int result;
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	uint32_t id;
+	struct k_sem *done;
+	/** @endcond */
+};
+
+/**
+ * @brief Convert a pointer into shared memory to the address exchanged with the other core
+ *
+ * Used to fill the contexts of jobs, which reference further buffers.
+ *
+ * @param ptr Pointer into shared memory, or NULL.
+ *
+ * @return Address understood by the other core, an address the other core rejects for NULL or
+ *         pointers outside of shared memory.
+ */
+uint32_t zdsp_offload_addr(const void *ptr);
+
+/**
+ * @brief Submit a job to the remote core
+ *
+ * Only available on the host, with @kconfig{CONFIG_DSP_OFFLOAD_HOST}.
+ *
+ * @param job Job, must stay valid until completed.
+ *
+ * @retval 0 If the job was sent to the remote.
+ * @retval -EINVAL If a buffer is not in shared memory.
+ * @retval -ENOTCONN If the remote is not connected yet.
+ * @retval -errno Other negative errno code from the IPC service.
+ */
+int zdsp_offload_submit(struct zdsp_offload_job *job);
+
+/**
+ * @brief Run a job on the remote core and wait for its completion
+ *
+ * Only available on the host, with @kconfig{CONFIG_DSP_OFFLOAD_HOST}. The completion callback of
+ * the job is not used.
+ *
+ * @param job Job.
+ * @param timeout Time to wait for the completion.
+ *
+ * @return The result of the job, -EAGAIN on timeout, or an error from zdsp_offload_submit().
+ *         On timeout the job is cancelled and a late completion is ignored.
+ */
+int zdsp_offload_run(struct zdsp_offload_job *job, k_timeout_t timeout);
+
+/** @brief Job as seen by its handler on the remote, with buffers at their local address. */
+struct zdsp_offload_req {
+	/** Operation */
+	uint16_t op;
+	/** Input buffer */
+	const void *src;
+	/** Size of the input in bytes */
+	size_t src_len;
+	/** Output buffer */
+	void *dst;
+	/** Capacity of the output in bytes */
+	size_t dst_len;
+	/** Operation specific context, or NULL */
+	void *ctx;
+	/** Size of the context in bytes */
+	size_t ctx_len;
+	/** Operation specific argument */
+	uint32_t arg;
+};
+
+/** @brief Handler of an operation on the remote. */
+struct zdsp_offload_handler {
+	/** Operation */
+	uint16_t op;
+	/**
+	 * Run a job
+	 *
+	 * @return Result given to the host, a non-negative operation specific value, typically
+	 *         the number of bytes written to the output, or a negative error code.
+	 */
+	int (*run)(const struct zdsp_offload_req *req);
+};
+
+/**
+ * @brief Define the handler of an operation on the remote
+ *
+ * Handlers of the application take precedence over the built-in handlers of the same operation.
+ *
+ * @param _name Name of the handler.
+ * @param _op Operation.
+ * @param _run Function running a job, see struct zdsp_offload_handler.
+ */
+#define ZDSP_OFFLOAD_HANDLER_DEFINE(_name, _op, _run)                                              \
+	static const STRUCT_SECTION_ITERABLE(zdsp_offload_handler, _name) = {                      \
+		.op = (_op),                                                                       \
+		.run = (_run),                                                                     \
+	}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_OFFLOAD_H_ */
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/support.h
+ *
+ * @brief Public APIs for DSP sample format conversion and channel layout
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_SUPPORT_H_
+#define ZEPHYR_INCLUDE_DSP_SUPPORT_H_
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_support Support Functions
+ * Sample format conversion and channel layout operations for DSP.
+ * @{
+ */
+
+/**
+ * @ingroup math_dsp_support
+ * @defgroup math_dsp_support_convert Format Conversion
+ *
+ * Conversion of a vector between sample formats.
+ *
+ * Conversions to a narrower fixed-point format discard the low order bits. Conversions from
+ * floating-point scale the [-1 1) range onto the full fixed-point range and saturate values
+ * outside of it. Packed 24-bit samples are stored as three little endian bytes each.
+ * @{
+ */
+
+/**
+ * @brief Convert a Q15 vector to Q31.
+ *
+ * @param[in]  src        points to the Q15 input vector
+ * @param[out] dst        points to the Q31 output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_q15_to_q31(const DSP_DATA q15_t *src, DSP_DATA q31_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a Q31 vector to Q15.
+ *
+ * @param[in]  src        points to the Q31 input vector
+ * @param[out] dst        points to the Q15 output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_q31_to_q15(const DSP_DATA q31_t *src, DSP_DATA q15_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a Q15 vector to floating-point.
+ *
+ * @param[in]  src        points to the Q15 input vector
+ * @param[out] dst        points to the floating-point output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_q15_to_f32(const DSP_DATA q15_t *src, DSP_DATA float32_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a floating-point vector to Q15.
+ *
+ * @par Scaling and Overflow Behavior
+ *   Results outside of the allowable Q15 range [0x8000 0x7FFF] are saturated.
+ *
+ * @param[in]  src        points to the floating-point input vector
+ * @param[out] dst        points to the Q15 output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_f32_to_q15(const DSP_DATA float32_t *src, DSP_DATA q15_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a Q31 vector to floating-point.
+ *
+ * @param[in]  src        points to the Q31 input vector
+ * @param[out] dst        points to the floating-point output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_q31_to_f32(const DSP_DATA q31_t *src, DSP_DATA float32_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a floating-point vector to Q31.
+ *
+ * @par Scaling and Overflow Behavior
+ *   Results outside of the allowable Q31 range [0x80000000 0x7FFFFFFF] are saturated.
+ *
+ * @param[in]  src        points to the floating-point input vector
+ * @param[out] dst        points to the Q31 output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_f32_to_q31(const DSP_DATA float32_t *src, DSP_DATA q31_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a vector of packed 24-bit samples to Q31.
+ *
+ * @param[in]  src        points to the packed input samples, 3 bytes each
+ * @param[out] dst        points to the Q31 output vector
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_s24_to_q31(const DSP_DATA uint8_t *src, DSP_DATA q31_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @brief Convert a Q31 vector to packed 24-bit samples.
+ *
+ * @param[in]  src        points to the Q31 input vector
+ * @param[out] dst        points to the packed output samples, 3 bytes each
+ * @param[in]  block_size number of samples in each vector
+ */
+DSP_FUNC_SCOPE void zdsp_q31_to_s24(const DSP_DATA q31_t *src, DSP_DATA uint8_t *dst,
+				    uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @ingroup math_dsp_support
+ * @defgroup math_dsp_support_interleave Interleaving
+ *
+ * Conversion between one buffer of interleaved frames and one buffer per channel.
+ * <pre>
+ *     dst[n * channels + c] = src[c][n],   0 <= n < frames, 0 <= c < channels.
+ * </pre>
+ * There are separate functions for Q15 and Q31 data types. The Q31 variants can be used for
+ * any 32-bit sample format.
+ * @{
+ */
+
+/**
+ * @brief Interleave Q15 channel buffers.
+ *
+ * @param[in]  src      array of @p channels pointers to the channel buffers
+ * @param[in]  channels number of channels
+ * @param[out] dst      points to the interleaved output buffer
+ * @param[in]  frames   number of samples per channel
+ */
+DSP_FUNC_SCOPE void zdsp_interleave_q15(const DSP_DATA q15_t *const *src, uint32_t channels,
+					DSP_DATA q15_t *dst, uint32_t frames);
+
+/**
+ * @brief Deinterleave Q15 frames into channel buffers.
+ *
+ * @param[in]  src      points to the interleaved input buffer
+ * @param[in]  channels number of channels
+ * @param[out] dst      array of @p channels pointers to the channel buffers
+ * @param[in]  frames   number of samples per channel
+ */
+DSP_FUNC_SCOPE void zdsp_deinterleave_q15(const DSP_DATA q15_t *src, uint32_t channels,
+					  DSP_DATA q15_t *const *dst, uint32_t frames);
+
+/**
+ * @brief Interleave Q31 channel buffers.
+ *
+ * @param[in]  src      array of @p channels pointers to the channel buffers
+ * @param[in]  channels number of channels
+ * @param[out] dst      points to the interleaved output buffer
+ * @param[in]  frames   number of samples per channel
+ */
+DSP_FUNC_SCOPE void zdsp_interleave_q31(const DSP_DATA q31_t *const *src, uint32_t channels,
+					DSP_DATA q31_t *dst, uint32_t frames);
+
+/**
+ * @brief Deinterleave Q31 frames into channel buffers.
+ *
+ * @param[in]  src      points to the interleaved input buffer
+ * @param[in]  channels number of channels
+ * @param[out] dst      array of @p channels pointers to the channel buffers
+ * @param[in]  frames   number of samples per channel
+ */
+DSP_FUNC_SCOPE void zdsp_deinterleave_q31(const DSP_DATA q31_t *src, uint32_t channels,
+					  DSP_DATA q31_t *const *dst, uint32_t frames);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_SUPPORT_H_ */
@@ -446,6 +446,29 @@ off_t fs_tell(struct fs_file_t *zfp);
  */
 int fs_truncate(struct fs_file_t *zfp, off_t length);
 
+/**
+ * @brief Allocate contiguous storage to an empty open file
+ *
+ * Allocates @p length bytes of contiguous storage to the file and sets its
+ * size to @p length. Unlike fs_truncate(), the allocated region is not
+ * filled, its content is undefined. Data written to the file within the
+ * allocated region does not require further allocation, which avoids the
+ * file system metadata updates and fragmentation of a file growing by
+ * many small writes, e.g. when recording. The file should be truncated to
+ * the length of the data actually written before it is closed.
+ *
+ * @param zfp Pointer to the file object
+ * @param length New size of the file in bytes
+ *
+ * @retval 0 on success;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOTSUP when not implemented by underlying file system driver;
+ * @retval -EACCES when the file is not empty or there is no contiguous free
+ *	   space of the requested length;
+ * @retval <0 an other negative errno code on error.
+ */
+int fs_preallocate(struct fs_file_t *zfp, off_t length);
+
 /**
  * @brief Flush cached write data buffers of an open file
  *
@@ -77,6 +77,14 @@ struct fs_file_system_t {
 	 * @return 0 on success, negative errno code on fail.
 	 */
 	int (*truncate)(struct fs_file_t *filp, off_t length);
+	/**
+	 * Allocates contiguous storage to an empty file.
+	 *
+	 * @param filp File to allocate storage to.
+	 * @param length New length of the file.
+	 * @return 0 on success, negative errno code on fail.
+	 */
+	int (*preallocate)(struct fs_file_t *filp, off_t length);
 	/**
 	 * Flushes the cache of an open file.
 	 *
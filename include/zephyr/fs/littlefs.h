@@ -49,6 +49,22 @@ struct fs_littlefs {
 	 */
 	uint32_t *lookahead_buffer[CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE / sizeof(uint32_t)];
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_XIP_READ
+	/* Address of the flash area in the memory mapped (XIP) window of the
+	 * flash device. If not NULL, reads are copied from it instead of going
+	 * through flash_area_read().
+	 */
+	const uint8_t *xip_base;
+#endif /* CONFIG_FS_LITTLEFS_FMP_XIP_READ */
+
+#ifdef CONFIG_FS_LITTLEFS_HEAP_BUFFERS
+	/* If not NULL, the read, prog and lookahead buffers of cfg, which
+	 * must be left NULL, are allocated from this heap at mount and
+	 * released at unmount. Per-file caches are allocated from it too.
+	 */
+	struct k_heap *heap;
+#endif /* CONFIG_FS_LITTLEFS_HEAP_BUFFERS */
+
 	/* These structures are filled automatically at mount. */
 	struct lfs lfs;
 	void *backend;
@@ -100,6 +116,36 @@ struct fs_littlefs {
 		},									  \
 	}
 
+#if defined(CONFIG_FS_LITTLEFS_HEAP_BUFFERS) || defined(__DOXYGEN__)
+/** @brief Define a littlefs configuration with buffers allocated from a heap.
+ *
+ * Like @ref FS_LITTLEFS_DECLARE_CUSTOM_CONFIG, but instead of static arrays
+ * the caches and the lookahead buffer are allocated from @p heap_ptr while
+ * the file system is mounted. Files opened on it allocate their caches from
+ * the same heap, so it must be sized for two caches, the lookahead buffer
+ * and one cache per open file, plus the heap allocation overhead.
+ *
+ * @param name the name for the structure.  The defined object has
+ * file scope.
+ * @param heap_ptr pointer to the @ref k_heap to allocate buffers from
+ * @param read_sz see @kconfig{CONFIG_FS_LITTLEFS_READ_SIZE}
+ * @param prog_sz see @kconfig{CONFIG_FS_LITTLEFS_PROG_SIZE}
+ * @param cache_sz see @kconfig{CONFIG_FS_LITTLEFS_CACHE_SIZE}
+ * @param lookahead_sz see @kconfig{CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE}
+ */
+#define FS_LITTLEFS_DECLARE_HEAP_CONFIG(name, heap_ptr, read_sz, prog_sz, cache_sz,	  \
+					lookahead_sz)					  \
+	static struct fs_littlefs name = {						  \
+		.cfg = {								  \
+			.read_size = (read_sz),						  \
+			.prog_size = (prog_sz),						  \
+			.cache_size = (cache_sz),					  \
+			.lookahead_size = (lookahead_sz),				  \
+		},									  \
+		.heap = (heap_ptr),							  \
+	}
+#endif /* CONFIG_FS_LITTLEFS_HEAP_BUFFERS */
+
 /** @brief Define a littlefs configuration with default characteristics.
  *
  * This defines static arrays and initializes the littlefs
@@ -62,6 +62,10 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	/** Work item running the garbage collection ahead of time */
+	struct k_work gc_work;
+#endif
 };
 
 /**
@@ -62,8 +62,15 @@ struct zms_fs {
 	/** Size of an Allocation Table Entry */
 	size_t ate_size;
 #if CONFIG_ZMS_LOOKUP_CACHE
-	/** Lookup table used to cache ATE addresses of written IDs */
-	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+	/** Lookup table used to cache ATE addresses of written IDs, followed by
+	 *  the tag of the stored copy if CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT is enabled
+	 */
+	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE +
+			      IS_ENABLED(CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT)];
+#endif
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/** Work item running the garbage collection ahead of time */
+	struct k_work gc_work;
 #endif
 };
 
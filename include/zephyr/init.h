@@ -7,6 +7,7 @@
 #ifndef ZEPHYR_INCLUDE_INIT_H_
 #define ZEPHYR_INCLUDE_INIT_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -172,6 +173,38 @@ struct init_entry {
 			.srv = (const struct service *)&Z_SERVICE_NAME_GET(name)          \
 		}
 
+#if defined(CONFIG_INIT_PROFILE) || defined(__DOXYGEN__)
+/** Time spent running one init entry at boot */
+struct init_profile_record {
+	/** Init entry */
+	const struct init_entry *entry;
+	/** Cycle counter when the entry started */
+	uint32_t start;
+	/** Cycles spent in the entry */
+	uint32_t cycles;
+	/** Value returned by the entry */
+	int result;
+	/** Init level, from 0 for `EARLY` to 5 for `SMP` */
+	uint8_t level;
+	/** Whether the entry is about a device rather than a SYS_INIT() function */
+	bool is_device;
+};
+
+/**
+ * @brief Get the time spent in the init entries run at boot
+ *
+ * Records are kept in the order the entries completed. Only the first
+ * @kconfig{CONFIG_INIT_PROFILE_MAX_ENTRIES} entries are recorded. Cycles are read with
+ * k_cycle_get_32(), so entries running before the system timer is initialized may be
+ * reported as taking no time.
+ *
+ * @param[out] records Set to the first record.
+ *
+ * @return Number of records.
+ */
+size_t init_profile_get(const struct init_profile_record **records);
+#endif /* CONFIG_INIT_PROFILE */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -158,6 +158,81 @@ struct input_callback {
 #define INPUT_CALLBACK_DEFINE(_dev, _callback, _user_data)                     \
 	INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
 
+/**
+ * @brief Input batch callback state, internal use only.
+ */
+struct input_batch_callback_state {
+	/** Number of events in the buffer. */
+	uint16_t count;
+	/** Index of the first event after the last synchronization. */
+	uint16_t frame;
+};
+
+/**
+ * @brief Input batch callback structure.
+ */
+struct input_batch_callback {
+	/** @ref device pointer or NULL. */
+	const struct device *dev;
+	/** The callback function. */
+	void (*callback)(const struct input_event *evts, size_t count,
+			 void *user_data);
+	/** User data pointer. */
+	void *user_data;
+	/** Event buffer. */
+	struct input_event *events;
+	/** Buffer state. */
+	struct input_batch_callback_state *state;
+	/** Number of events in the buffer. */
+	uint16_t size;
+};
+
+/**
+ * @brief Register a batch callback for input events with a custom name.
+ *
+ * Same as @ref INPUT_BATCH_CALLBACK_DEFINE but allows specifying a custom
+ * name for the callback structure.
+ */
+#define INPUT_BATCH_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _size,  \
+					  name)                                \
+	BUILD_ASSERT((_size) > 0 && (_size) <= UINT16_MAX);                    \
+	static struct input_event _input_batch_events__##name[_size];          \
+	static struct input_batch_callback_state _input_batch_state__##name;   \
+	static const STRUCT_SECTION_ITERABLE(input_batch_callback,             \
+					     _input_batch_callback__##name) = {\
+		.dev = _dev,                                                   \
+		.callback = _callback,                                         \
+		.user_data = _user_data,                                       \
+		.events = _input_batch_events__##name,                         \
+		.state = &_input_batch_state__##name,                          \
+		.size = _size,                                                 \
+	}
+
+/**
+ * @brief Register a batch callback for input events.
+ *
+ * Events are buffered in a queue of @p _size entries and delivered to
+ * @p _callback as an array, once a synchronization event has been received
+ * and the input queue is empty, or when the buffer is full. Consecutive
+ * @ref INPUT_EV_ABS and @ref INPUT_EV_REL events for the same code received
+ * before the next synchronization are coalesced in a single event: absolute
+ * values are replaced and relative values are added up. Events reported
+ * after an @ref INPUT_ABS_MT_SLOT event are not coalesced with the ones
+ * before it.
+ *
+ * Only available with @kconfig{CONFIG_INPUT_BATCH_CALLBACK}, the callback is
+ * invoked from the input thread.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _callback The callback function, with the events, their count and
+ *        @p _user_data as arguments.
+ * @param _user_data Pointer to user specified data.
+ * @param _size Maximum number of events delivered at once.
+ */
+#define INPUT_BATCH_CALLBACK_DEFINE(_dev, _callback, _user_data, _size)        \
+	INPUT_BATCH_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _size,  \
+					  _callback)
+
 #ifdef __cplusplus
 }
 #endif
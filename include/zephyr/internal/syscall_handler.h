@@ -92,6 +92,37 @@ static inline bool k_is_in_user_syscall(void)
 int k_object_validate(struct k_object *ko, enum k_objects otype,
 		      enum _obj_init_check init);
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+/**
+ * Test whether the current thread recently validated an object
+ *
+ * Entries are added by k_object_cache_add() and dropped whenever any
+ * permission is revoked or any object is freed, recycled or uninitialized.
+ *
+ * @param obj Kernel object pointer
+ * @param otype Type the object was validated as
+ * @note This is an internal API. Do not use unless you are extending
+ *       functionality in the Zephyr tree.
+ *
+ * @return true if the object is known to be a valid, permitted and
+ *         initialized object of type @p otype
+ */
+bool k_object_cache_test(const void *obj, enum k_objects otype);
+
+/**
+ * Remember an object the current thread successfully validated
+ *
+ * Must follow a k_object_cache_test() miss on the same object, the object is
+ * not added if anything was invalidated in between.
+ *
+ * @param obj Kernel object pointer
+ * @param otype Type the object was validated as, with _OBJ_INIT_TRUE
+ * @note This is an internal API. Do not use unless you are extending
+ *       functionality in the Zephyr tree.
+ */
+void k_object_cache_add(const void *obj, enum k_objects otype);
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 /**
  * Dump out error information on failed k_object_validate() call
  *
@@ -539,9 +570,31 @@ static inline int k_object_validation_check(struct k_object *ko,
 	return ret;
 }
 
+static inline int k_object_validation_check_ptr(const void *obj,
+						enum k_objects otype,
+						enum _obj_init_check init)
+{
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	bool cacheable = (init == _OBJ_INIT_TRUE) && (otype != K_OBJ_ANY);
+	int ret;
+
+	if (cacheable && k_object_cache_test(obj, otype)) {
+		return 0;
+	}
+
+	ret = k_object_validation_check(k_object_find(obj), obj, otype, init);
+	if (cacheable && (ret == 0)) {
+		k_object_cache_add(obj, otype);
+	}
+
+	return ret;
+#else
+	return k_object_validation_check(k_object_find(obj), obj, otype, init);
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+}
+
 #define K_SYSCALL_IS_OBJ(ptr, type, init) \
-	K_SYSCALL_VERIFY_MSG(k_object_validation_check(			\
-				     k_object_find((const void *)(ptr)),	\
+	K_SYSCALL_VERIFY_MSG(k_object_validation_check_ptr(		\
 				     (const void *)(ptr),		\
 				     (type), (init)) == 0, "access denied")
 
@@ -79,6 +79,8 @@ struct icmsg_config_t {
 	struct mbox_dt_spec mbox_tx;
 	struct mbox_dt_spec mbox_rx;
 	enum icmsg_unbound_mode unbound_mode;
+	/* Received data is processed by icmsg_poll() instead of the RX mbox callback. */
+	bool rx_poll;
 };
 
 struct icmsg_data_t {
@@ -97,6 +99,18 @@ struct icmsg_data_t {
 	const struct icmsg_config_t *cfg;
 #ifdef CONFIG_MULTITHREADING
 	struct k_work mbox_work;
+#endif
+	/* TX buffer claimed for nocopy sending. */
+	void *tx_buf;
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	/* RX buffer being delivered and RX buffer held by the endpoint. */
+	const void *rx_buf;
+	atomic_ptr_t rx_held;
+#endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE
+	/* Messages sent and time since the last notification of the remote. */
+	uint16_t tx_unsignalled;
+	uint32_t tx_signal_cycles;
 #endif
 	uint16_t remote_sid;
 	uint16_t local_sid;
@@ -170,6 +184,135 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	       struct icmsg_data_t *dev_data,
 	       const void *msg, size_t len);
 
+/** @brief Process received data of an instance in polling mode.
+ *
+ *  Only for instances with @c rx_poll set, whose RX mbox interrupt is not used.
+ *  The received callback, and the callbacks of the handshake, are called from
+ *  the caller's context for all data received since the previous call.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *
+ *  @retval 0 on success.
+ *  @retval -ENOTSUP when the instance is not in polling mode.
+ */
+int icmsg_poll(const struct icmsg_config_t *conf,
+	       struct icmsg_data_t *dev_data);
+
+/** @brief Get the maximum size of a message.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *
+ *  @retval Maximum number of bytes of a message.
+ */
+int icmsg_get_tx_buffer_size(const struct icmsg_config_t *conf,
+			     struct icmsg_data_t *dev_data);
+
+/** @brief Claim a TX buffer in shared memory for nocopy sending.
+ *
+ *  The buffer is located in the TX region, so the message is written in place.
+ *  Until it is sent with @ref icmsg_send_nocopy or dropped with
+ *  @ref icmsg_drop_tx_buffer, no other message can be sent. With
+ *  @kconfig{CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC}, these must be called
+ *  from the thread which claimed the buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[out] data Set to the TX buffer.
+ *  @param[inout] size Requested size. Set to the size which can currently be
+ *                     claimed on -ENOBUFS.
+ *
+ *  @retval 0 on success.
+ *  @retval -EBUSY when the instance has not finished handshake with the remote
+ *                 instance.
+ *  @retval -EALREADY when a buffer is already claimed.
+ *  @retval -ENOMEM when the requested size is bigger than a message can be.
+ *  @retval -ENOBUFS when there is not enough free space in the TX region.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_get_tx_buffer(const struct icmsg_config_t *conf,
+			struct icmsg_data_t *dev_data,
+			void **data, size_t *size);
+
+/** @brief Drop a TX buffer claimed with @ref icmsg_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data TX buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY when the buffer is not claimed.
+ */
+int icmsg_drop_tx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data);
+
+/** @brief Send a message written in a TX buffer claimed with @ref icmsg_get_tx_buffer.
+ *
+ *  The buffer is released, whether the message is sent or not.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data TX buffer.
+ *  @param[in] len Size of the message, at most the size of the buffer.
+ *
+ *  @retval Number of sent bytes.
+ *  @retval -EALREADY when the buffer is not claimed.
+ *  @retval -ENODATA when the message is empty.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_send_nocopy(const struct icmsg_config_t *conf,
+		      struct icmsg_data_t *dev_data,
+		      const void *data, size_t len);
+
+/** @brief Hold the RX buffer being delivered to the received callback.
+ *
+ *  Only available with @kconfig{CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX}, and to be
+ *  called from the received callback. The buffer stays valid after the callback
+ *  returns, until released with @ref icmsg_release_rx_buffer. No further message
+ *  is delivered until then.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data RX buffer given to the received callback.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY when the buffer is already held.
+ *  @retval -ENOTSUP when the message was copied out of the RX region, because
+ *                   it wrapped around its end, and cannot be held.
+ */
+int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data);
+
+/** @brief Release an RX buffer held with @ref icmsg_hold_rx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data RX buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY when the buffer is not held.
+ */
+int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_data_t *dev_data,
+			    const void *data);
+
 /**
  * @}
  */
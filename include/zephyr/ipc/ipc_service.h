@@ -489,6 +489,26 @@ int ipc_service_hold_rx_buffer(struct ipc_ept *ept, void *data);
  */
 int ipc_service_release_rx_buffer(struct ipc_ept *ept, void *data);
 
+/** @brief Process received data in polling mode.
+ *
+ *  When supported by the backend, and the instance is configured to be polled
+ *  instead of being interrupted on reception, this function processes the data
+ *  received since the previous call. The callbacks of the endpoint are called
+ *  from the caller's context.
+ *
+ *  @param[in] ept Registered endpoint by @ref ipc_service_register_endpoint.
+ *
+ *  @retval -EIO when no backend is registered or poll hook is missing from
+ *		 backend.
+ *  @retval -EINVAL when instance or endpoint is invalid.
+ *  @retval -ENOENT when the endpoint is not registered with the instance.
+ *  @retval -ENOTSUP when the instance is not in polling mode.
+ *
+ *  @retval 0 on success.
+ *  @retval other errno codes depending on the implementation of the backend.
+ */
+int ipc_service_poll(struct ipc_ept *ept);
+
 /**
  * @}
  */
@@ -216,6 +216,22 @@ struct ipc_service_backend {
 	 */
 	int (*release_rx_buffer)(const struct device *instance, void *token,
 				 void *data);
+
+	/** @brief Pointer to the function that will process received data in
+	 *	   polling mode.
+	 *
+	 *  @param[in] instance Instance pointer.
+	 *  @param[in] token Backend-specific token.
+	 *
+	 *  @retval -EINVAL when instance is invalid.
+	 *  @retval -ENOENT when the endpoint is not registered with the instance.
+	 *  @retval -ENOTSUP when the instance is not in polling mode.
+	 *
+	 *  @retval 0 on success
+	 *  @retval other errno codes depending on the implementation of the
+	 *	    backend.
+	 */
+	int (*poll)(const struct device *instance, void *token);
 };
 
 /**
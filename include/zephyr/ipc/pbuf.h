@@ -235,6 +235,80 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Reserve space for a packet in the packet buffer.
+ *
+ * Provides a location in the shared memory where the writer can place the data
+ * of the next packet, to be sent with @ref pbuf_tx_commit without copying.
+ * The packet is not visible to the reader until committed. When the packet
+ * would wrap around the end of the buffer, the space is reserved at the
+ * beginning of the buffer and the data is moved in place on commit.
+ *
+ * Only one reservation can be outstanding, and @ref pbuf_write must not be
+ * called while it is.
+ *
+ * @param pb		A buffer in which to reserve.
+ * @param[in,out] len	Number of bytes to reserve. Set to the number of bytes
+ *			that can currently be reserved on -ENOBUFS.
+ * @param[out] buf	Set to the reserved location.
+ * @retval 0		on success.
+ *			-EINVAL, if any of input parameter is incorrect.
+ *			-ENOMEM, if len is bigger than the buffer can ever fit.
+ *			-ENOBUFS, if len does not fit in the free space now.
+ */
+int pbuf_tx_reserve(struct pbuf *pb, uint16_t *len, char **buf);
+
+/**
+ * @brief Commit a packet reserved with @ref pbuf_tx_reserve.
+ *
+ * @param pb	A buffer in which the packet was reserved.
+ * @param buf	Location returned by @ref pbuf_tx_reserve.
+ * @param len	Number of bytes of the packet, at most the reserved length.
+ * @retval int	Number of bytes written, negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ */
+int pbuf_tx_commit(struct pbuf *pb, char *buf, uint16_t len);
+
+/**
+ * @brief Get the number of bytes written and not yet consumed by the reader.
+ *
+ * Counts the packet headers and padding. Called by the writer after a write, it
+ * tells whether the reader had consumed all the previous packets, in which case
+ * the reader may be waiting for a notification. Otherwise the reader checks for
+ * more data after consuming a packet and sees the new one without notification.
+ *
+ * @param pb	A buffer to which data is written.
+ * @retval int	Number of bytes, negative error code on fail.
+ *		-EINVAL, if the read index is incorrect.
+ */
+int pbuf_tx_pending(struct pbuf *pb);
+
+/**
+ * @brief Get the next packet in place in the packet buffer.
+ *
+ * The packet stays in the buffer, and the writer cannot reuse its space, until
+ * @ref pbuf_read_done is called. Packets wrapping around the end of the buffer
+ * are not contiguous and must be read with @ref pbuf_read instead.
+ *
+ * @param pb		A buffer from which data will be read.
+ * @param[out] buf	Set to the data of the packet.
+ * @retval int	Length of the packet, negative error code on fail.
+ *		0, if the buffer is empty.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-EFBIG, if the packet wraps around the end of the buffer.
+ *		-EAGAIN, if not whole message is ready yet.
+ */
+int pbuf_read_nocopy(struct pbuf *pb, volatile char **buf);
+
+/**
+ * @brief Release the packet obtained with @ref pbuf_read_nocopy.
+ *
+ * @param pb	A buffer from which the packet was read.
+ * @retval 0 on success.
+ * @retval -EINVAL when the buffer is empty.
+ */
+int pbuf_read_done(struct pbuf *pb);
+
 /**
  * @brief Read handshake word from pbuf.
  *
@@ -23,6 +23,9 @@
 #include <zephyr/sys/mem_stats.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/ring_buffer.h>
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+#include <zephyr/sys/barrier.h>
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
 
 #ifdef __cplusplus
 extern "C" {
@@ -959,6 +962,64 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  *
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
+
+#if defined(CONFIG_SCHED_DEADLINE_PERIODIC) || defined(__DOXYGEN__)
+/**
+ * @brief Make a thread periodic
+ *
+ * Declares the release parameters of a thread which runs one job per
+ * period. The first period starts now and the thread's deadline is set to
+ * @p deadline from now. At the end of each job the thread calls
+ * k_thread_period_wait(), which sleeps until the next release and re-arms
+ * the deadline relative to that release, so the thread does not need to
+ * call k_thread_deadline_set() itself.
+ *
+ * As with k_thread_deadline_set(), the deadline only orders threads of
+ * the same static priority, so threads which should be scheduled earliest
+ * deadline first are expected to share a priority.
+ *
+ * When @kconfig{CONFIG_SCHED_THREAD_USAGE} is enabled and runtime stats
+ * are gathered for the thread, jobs running for longer than @p budget are
+ * counted in the budget_overruns field of k_thread_runtime_stats_t. The
+ * budget is compared with the runtime stats cycle counts, which use the
+ * timing functions when @kconfig{CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS}
+ * is enabled. The budget is not otherwise enforced.
+ *
+ * @note Releases are rounded up to the system tick, so the period
+ * should be large compared to the tick period.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_PERIODIC} in your
+ * project configuration.
+ *
+ * @param thread A thread to make periodic
+ * @param period Release period, in cycle units. Zero makes the thread
+ *               non periodic again.
+ * @param budget Execution time allowed per period, in cycle units. Zero
+ *               disables overrun accounting.
+ * @param deadline Deadline relative to each release, in cycle units.
+ *                 Zero uses the period.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the period exceeds INT_MAX, the deadline exceeds the
+ *                 period or the budget exceeds the deadline
+ */
+__syscall int k_thread_period_set(k_tid_t thread, uint32_t period, uint32_t budget,
+				  uint32_t deadline);
+
+/**
+ * @brief End the current job of a periodic thread
+ *
+ * Accounts the job against the budget of the calling thread, then sleeps
+ * until its next release and re-arms its deadline. If the job ended after
+ * its deadline, the thread is released at once and the following periods
+ * are counted from now.
+ *
+ * @retval 0 on success
+ * @retval -ETIMEDOUT if the job missed its deadline
+ * @retval -EINVAL if the calling thread is not periodic
+ */
+__syscall int k_thread_period_wait(void);
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 #endif
 
 /**
@@ -1863,10 +1924,51 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
  * ticks (c.f. @kconfig{CONFIG_SYS_CLOCK_TICKS_PER_SEC}), which is the
  * fundamental unit of resolution of kernel timekeeping.
  *
+ * With @kconfig{CONFIG_USERSPACE_TIME_PAGE}, user threads read the uptime
+ * from @ref k_user_time_partition without a system call.
+ *
  * @return Current uptime in ticks.
  */
 __syscall int64_t k_uptime_ticks(void);
 
+#if defined(CONFIG_USERSPACE_TIME_PAGE) || defined(__DOXYGEN__)
+/**
+ * @brief Memory partition publishing the uptime to user threads
+ *
+ * Part of the default memory domain. Add it to other memory domains whose
+ * threads call k_uptime_ticks(), or they fault reading it.
+ */
+extern struct k_mem_partition k_user_time_partition;
+
+/** @cond INTERNAL_HIDDEN */
+struct z_user_time {
+	/* Odd while the kernel updates the ticks */
+	uint32_t seq;
+	uint64_t ticks;
+};
+
+extern struct z_user_time z_user_time;
+
+/* Run instead of the system call by user threads calling k_uptime_ticks() */
+static inline int64_t z_user_fast_k_uptime_ticks(void)
+{
+	volatile struct z_user_time *ut = &z_user_time;
+	uint32_t seq;
+	uint64_t ticks;
+
+	do {
+		seq = ut->seq;
+		barrier_dmem_fence_full();
+		ticks = ut->ticks;
+		barrier_dmem_fence_full();
+	} while (((seq & 1U) != 0U) || (seq != ut->seq));
+
+	return (int64_t)ticks;
+}
+#define z_user_fast_k_uptime_ticks z_user_fast_k_uptime_ticks
+/** @endcond */
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
+
 /**
  * @brief Get system uptime.
  *
@@ -2173,6 +2275,31 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get several elements from a queue.
+ *
+ * This routine removes up to @a max_items data items from the head of
+ * @a queue under a single lock acquisition and stores their addresses in
+ * @a items. If @a queue is empty, it waits up to @a timeout for one data
+ * item to arrive and then takes whatever else is available without
+ * waiting again.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param items Array receiving the addresses of the data items.
+ * @param max_items Number of entries in @a items.
+ * @param timeout Waiting period to obtain the first data item, or one of
+ *                the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a items; 0 if returned without
+ * waiting, waiting period timed out or the wait was cancelled.
+ */
+__syscall int k_queue_get_n(struct k_queue *queue, void **items, uint32_t max_items,
+			    k_timeout_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2348,13 +2475,29 @@ __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
  * @{
  */
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#ifdef CONFIG_EVENTS_WAIT_Q_PARTITIONS
+#define Z_EVENT_WAIT_Q_PARTITIONS CONFIG_EVENTS_WAIT_Q_PARTITIONS
+#else
+#define Z_EVENT_WAIT_Q_PARTITIONS 1
+#endif
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * Event Structure
  * @ingroup event_apis
  */
-
 struct k_event {
-	_wait_q_t         wait_q;
+	/* Waiters, spread by the lowest event of their wait mask */
+	_wait_q_t         wait_q[Z_EVENT_WAIT_Q_PARTITIONS];
+	/* Union of the wait masks of the waiters of each wait queue */
+	uint32_t          waiting[Z_EVENT_WAIT_Q_PARTITIONS];
 	uint32_t          events;
 	struct k_spinlock lock;
 
@@ -2366,9 +2509,12 @@ struct k_event {
 
 };
 
+#define Z_EVENT_WAIT_Q_INIT(i, obj) Z_WAIT_Q_INIT(&(obj).wait_q[i])
+
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.wait_q = { LISTIFY(Z_EVENT_WAIT_Q_PARTITIONS, Z_EVENT_WAIT_Q_INIT, (,), obj) }, \
+	.waiting = { 0 }, \
 	.events = 0, \
 	.lock = {}, \
 	}
@@ -2707,6 +2853,30 @@ struct k_fifo {
 	fg_ret; \
 	})
 
+/**
+ * @brief Get several elements from a FIFO queue.
+ *
+ * This routine removes up to @a max_items data items from @a fifo in a
+ * "first in, first out" manner under a single lock acquisition. If @a fifo
+ * is empty, it waits up to @a timeout for the first data item. The first
+ * word of each data item is reserved for the kernel's use.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param items Array receiving the addresses of the data items.
+ * @param max_items Number of entries in @a items.
+ * @param timeout Waiting period to obtain the first data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items stored in @a items; 0 if returned without
+ * waiting or waiting period timed out.
+ */
+#define k_fifo_get_n(fifo, items, max_items, timeout) \
+	k_queue_get_n(&(fifo)->_queue, items, max_items, timeout)
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -3084,6 +3254,13 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	/** Contention statistics */
+	struct k_lock_stats stats;
+	/** Time (in cycles) when the current owner took the mutex */
+	uint32_t lock_time;
+#endif
 };
 
 /**
@@ -3286,6 +3463,9 @@ struct k_sem {
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	struct k_obj_core  obj_core;
+#endif
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	struct k_lock_stats stats;
 #endif
 	/** @endcond */
 };
@@ -3521,6 +3701,20 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+/** @brief Check whether the caller runs in a system work queue thread.
+ *
+ * With @kconfig{CONFIG_SYSTEM_WORKQUEUE_PER_CPU} this holds in the system
+ * work queue thread of any CPU, not only in the one of k_sys_work_q. Code
+ * that must not block while work items submitted with k_work_submit() from
+ * its own thread are pending should check this instead of comparing the
+ * current thread with the k_sys_work_q one.
+ *
+ * @funcprops \isr_ok
+ *
+ * @return true if the caller is a system work queue thread, false otherwise.
+ */
+bool k_is_in_sys_work_q(void);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4229,6 +4423,14 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** CPUs the work queue thread may run on, one bit per CPU.
+	 *
+	 * If non-zero, and CONFIG_SCHED_CPU_MASK is enabled, the work
+	 * queue thread is restricted to these CPUs before it starts.
+	 * Zero leaves the thread free to run on any CPU.
+	 */
+	uint32_t cpu_mask;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4806,6 +5008,32 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  */
 __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages stored at
+ * @a data to message queue @a msgq under a single lock acquisition,
+ * handing them to waiting receivers first, and reschedules at most once.
+ * If @a msgq is full, it waits up to @a timeout for space for the first
+ * message and then sends whatever else fits without waiting again.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to an array of @a num_msgs messages.
+ * @param num_msgs Number of messages at @a data.
+ * @param timeout Waiting period to add the first message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages sent, which may be less than @a num_msgs.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			      k_timeout_t timeout);
+
 /**
  * @brief Receive a message from a message queue.
  *
@@ -4828,6 +5056,34 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a max_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner under a single lock
+ * acquisition, refills the freed space from waiting senders, and
+ * reschedules at most once. If @a msgq is empty, it waits up to
+ * @a timeout for the first message and then takes whatever else is
+ * available without waiting again.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold up to @a max_msgs messages.
+ * @param max_msgs Number of messages @a data can hold.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t max_msgs,
+			      k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -5296,6 +5552,8 @@ __deprecated __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CLAIM = BIT(2),
+	PIPE_FLAG_READ_CLAIM = BIT(3),
 };
 
 struct k_pipe {
@@ -5362,6 +5620,7 @@ struct k_pipe {
  *
  * @retval number of bytes written on success
  * @retval -EAGAIN if no data could be written before the timeout expired
+ * @retval -EBUSY if no data could be written due to an outstanding write claim
  * @retval -ECANCELED if the write was interrupted by k_pipe_reset(..)
  * @retval -EPIPE if the pipe was closed
  */
@@ -5380,12 +5639,104 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
  *
  * @retval number of bytes read on success
  * @retval -EAGAIN if no data could be read before the timeout expired
+ * @retval -EBUSY if no data could be read due to an outstanding read claim
  * @retval -ECANCELED if the read was interrupted by k_pipe_reset(..)
  * @retval -EPIPE if the pipe was closed
  */
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
 
+/**
+ * @brief Claim space in a pipe for writing in place
+ *
+ * This routine returns a pointer to a contiguous area of up to @a len bytes
+ * of free space in the buffer of @a pipe, so the data can be produced
+ * directly into it instead of being copied by k_pipe_write(..). If the pipe
+ * is full, the routine will block until space is available or the timeout
+ * expires. The area may be smaller than requested when the free space wraps
+ * around the end of the buffer.
+ *
+ * The claimed data is made available to readers by k_pipe_write_commit(..).
+ * Only one write claim may be outstanding at a time, and k_pipe_write(..)
+ * fails with -EBUSY while it is. The pipe must have a non-empty buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed area.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for free space.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no space became available before the timeout expired
+ * @retval -EBUSY if a write claim is already outstanding
+ * @retval -ECANCELED if the wait was interrupted by k_pipe_reset(..)
+ * @retval -ENOTSUP if the pipe has no buffer
+ * @retval -EPIPE if the pipe was closed
+ */
+__syscall int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				 k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine ends the write claim made by k_pipe_write_claim(..) and makes
+ * the first @a len bytes of the claimed area available to readers, waking
+ * any reader waiting for data. The rest of the claimed area is released.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written into the claimed area.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a len exceeds the claimed size, or there is no
+ *         outstanding write claim (e.g. it was discarded by k_pipe_reset(..))
+ * @retval -EPIPE if the pipe was closed, which discards the claim
+ */
+__syscall int k_pipe_write_commit(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe for reading in place
+ *
+ * This routine returns a pointer to a contiguous area of up to @a len bytes
+ * of unread data in the buffer of @a pipe, so it can be consumed directly
+ * instead of being copied by k_pipe_read(..). If the pipe is empty, the
+ * routine will block until data is available or the timeout expires. The
+ * area may be smaller than requested when the data wraps around the end of
+ * the buffer.
+ *
+ * The data stays in the pipe until released by k_pipe_read_finish(..). Only
+ * one read claim may be outstanding at a time, and k_pipe_read(..) fails
+ * with -EBUSY while it is. The pipe must have a non-empty buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed data.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for data.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no data became available before the timeout expired
+ * @retval -EBUSY if a read claim is already outstanding
+ * @retval -ECANCELED if the wait was interrupted by k_pipe_reset(..)
+ * @retval -ENOTSUP if the pipe has no buffer
+ * @retval -EPIPE if the pipe was closed and is empty
+ */
+__syscall int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				k_timeout_t timeout);
+
+/**
+ * @brief Release data read in place from a pipe
+ *
+ * This routine ends the read claim made by k_pipe_read_claim(..) and frees
+ * the first @a len bytes of the claimed area, waking any writer waiting for
+ * space. The rest of the claimed data remains in the pipe.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes consumed from the claimed area.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a len exceeds the claimed size, or there is no
+ *         outstanding read claim (e.g. it was discarded by k_pipe_reset(..))
+ */
+__syscall int k_pipe_read_finish(struct k_pipe *pipe, size_t len);
+
 /**
  * @brief Reset a pipe
  * This routine resets the pipe, discarding any unread data and unblocking any threads waiting to
@@ -5427,6 +5778,14 @@ struct k_mem_slab {
 	char *buffer;
 	char *free_list;
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_t free_head;	/* tagged index of the first free block */
+	atomic_t num_used;
+	atomic_t waiters;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_t max_used;
+#endif
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5635,7 +5994,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	return (uint32_t)atomic_get(&slab->num_used);
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5650,7 +6013,9 @@ static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
 {
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && defined(CONFIG_MEM_SLAB_LOCKLESS)
+	return (uint32_t)atomic_get(&slab->max_used);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 	return slab->info.max_used;
 #else
 	ARG_UNUSED(slab);
@@ -5670,7 +6035,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5844,7 +6209,8 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
-#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#define Z_HEAP_MIN_SIZE (((sizeof(void *) > 4) ? 56 : 44) + Z_HEAP_TCACHE_SIZE + \
+			 Z_HEAP_FRAG_STATS_SIZE)
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -59,6 +59,11 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+	struct {
+		/** Number of data pages paged in ahead of page faults */
+		unsigned long			pages;
+	} read_ahead;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -263,6 +268,23 @@ void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf);
  */
 void k_mem_paging_eviction_accessed(uintptr_t phys);
 
+/**
+ * Submit a page frame read ahead for eviction candidate tracking
+ *
+ * Like k_mem_paging_eviction_add(), for a page frame paged in ahead of its
+ * use, see @kconfig{CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES}. The eviction
+ * algorithm should consider it a better eviction candidate than the page
+ * frames in use, until it is accessed. Its accessed flag was cleared.
+ *
+ * Only required from eviction algorithms selecting
+ * @kconfig{CONFIG_EVICTION_READ_AHEAD}.
+ *
+ * This function is invoked with interrupts locked.
+ *
+ * @param [in] pf The page frame to add
+ */
+void k_mem_paging_eviction_add_prefetched(struct k_mem_page_frame *pf);
+
 #else /* CONFIG_EVICTION_TRACKING || __DOXYGEN__ */
 
 static inline void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
@@ -280,6 +302,11 @@ static inline void k_mem_paging_eviction_accessed(uintptr_t phys)
 	ARG_UNUSED(phys);
 }
 
+static inline void k_mem_paging_eviction_add_prefetched(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
 #endif /* CONFIG_EVICTION_TRACKING || __DOXYGEN__ */
 
 /**
@@ -412,6 +439,25 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Announce the data pages about to be copied for a page fault
+ *
+ * Invoked before k_mem_paging_backing_store_page_in() is called for each of
+ * the locations in order: the faulting data page first, then the ones read
+ * ahead, see @kconfig{CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES}. Backing stores
+ * on slow media may fetch all of them with a single transfer here.
+ *
+ * Only required from backing stores selecting
+ * @kconfig{CONFIG_BACKING_STORE_PAGE_IN_BATCH}.
+ *
+ * Calls to this and k_mem_paging_backing_store_page_in() will always be
+ * serialized, but interrupts may be enabled.
+ *
+ * @param locations Location tokens of the data pages
+ * @param count Number of data pages
+ */
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations, size_t count);
+
 /**
  * Update internal accounting after a page-in
  *
@@ -15,6 +15,24 @@
  * and CPU usage.
  */
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_WINDOWS) || defined(__DOXYGEN__)
+/**
+ * Number of utilization windows. The first one is
+ * CONFIG_SCHED_THREAD_USAGE_WINDOW_MS long and every next one is ten times
+ * longer than the previous one.
+ */
+#define K_CYCLE_WINDOWS 3
+
+/**
+ * Structure used to accumulate cycles in a utilization window.
+ */
+struct k_cycle_window {
+	uint32_t  epoch;        /**< index of the current window */
+	uint64_t  current;      /**< \# of cycles in the current window */
+	uint64_t  last;         /**< \# of cycles in the previous window */
+};
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+
 struct k_cycle_stats {
 	uint64_t  total;        /**< total usage in cycles */
 #if defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) || defined(__DOXYGEN__)
@@ -27,7 +45,41 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_DEADLINE_PERIODIC) || defined(__DOXYGEN__)
+	uint32_t  budget_overruns; /**< \# of periods the budget was exceeded */
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+#if defined(CONFIG_SCHED_THREAD_LATENCY) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_LATENCY is selected.
+	 * @{
+	 */
+	uint32_t  ready_stamp;  /**< cycles when made ready, 0 if not waiting to run */
+	/** log2 histogram of ready to run latencies */
+	uint32_t  latency[CONFIG_SCHED_THREAD_LATENCY_BUCKETS];
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+#if defined(CONFIG_SCHED_THREAD_USAGE_WINDOWS) || defined(__DOXYGEN__)
+	/** cycles accumulated in utilization windows */
+	struct k_cycle_window windows[K_CYCLE_WINDOWS];
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+/**
+ * Structure used to track contention statistics of a lock: a spinlock
+ * (CONFIG_SPIN_LOCK_STATS), a mutex (CONFIG_OBJ_CORE_STATS_MUTEX) or a
+ * semaphore (CONFIG_OBJ_CORE_STATS_SEM).
+ */
+
+struct k_lock_stats {
+	uint32_t  acquired;     /**< \# of times the lock was acquired */
+	uint32_t  contended;    /**< \# of times the lock had to be waited for */
+	uint32_t  spins;        /**< \# of spin iterations (spinlocks only) */
+	uint32_t  max_hold;     /**< longest hold time in cycles (not semaphores, only
+				 *   contended acquisitions for spinlocks)
+				 */
+	uint32_t  max_wait;     /**< longest wait time in cycles */
+	uint64_t  total_wait;   /**< total wait time in cycles */
+};
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
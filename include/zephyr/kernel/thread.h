@@ -54,13 +54,30 @@ struct _pipe_desc {
 	struct k_thread *thread;         /* Back pointer to pended thread */
 };
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+struct _thread_period {
+	/* All durations and times are in k_cycle_get_32() units */
+	uint32_t period;	/* 0 if the thread is not periodic */
+	uint32_t budget;	/* execution time allowed per period */
+	uint32_t deadline;	/* relative to the release */
+	uint32_t release;	/* start of the current period */
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	uint64_t job_start;	/* usage total at the start of the current job */
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+};
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 /* can be used for creating 'dummy' threads, e.g. for pending on objects */
 struct _thread_base {
 
 	/* this thread's entry in a ready/wait queue */
 	union {
 		sys_dnode_t qnode_dlist;
+#ifdef CONFIG_PRIQ_BTREE
+		struct btree_node qnode_rb;
+#else
 		struct rbnode qnode_rb;
+#endif
 	};
 
 	/* wait queue on which the thread is pended (needed only for
@@ -105,6 +122,11 @@ struct _thread_base {
 	int prio_deadline;
 #endif /* CONFIG_SCHED_DEADLINE */
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	/* Release parameters set by k_thread_period_set() */
+	struct _thread_period period;
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 #if defined(CONFIG_SCHED_SCALABLE) || defined(CONFIG_WAITQ_SCALABLE)
 	uint32_t order_key;
 #endif
@@ -197,6 +219,19 @@ struct _mem_domain_info {
 };
 
 typedef struct _mem_domain_info _mem_domain_info_t;
+
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+struct _thread_obj_cache {
+	/** kernel objects validated for the thread */
+	const void *obj[CONFIG_USERSPACE_OBJ_CACHE_SIZE];
+	/** types the objects were validated as */
+	uint8_t type[CONFIG_USERSPACE_OBJ_CACHE_SIZE];
+	/** next entry to replace */
+	uint8_t next;
+	/** entries are stale once this differs from the global generation */
+	uint32_t gen;
+};
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
@@ -240,6 +275,32 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	/*
+	 * Histogram of the time between a thread being made ready and it
+	 * being switched in. Bucket n counts latencies from 2^n to
+	 * 2^(n+1) - 1 cycles, the last bucket also counts longer ones.
+	 * Always zero for CPU stats.
+	 */
+	uint32_t latency[CONFIG_SCHED_THREAD_LATENCY_BUCKETS];
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+	/*
+	 * Utilization in per mille over the last CONFIG_SCHED_THREAD_USAGE_WINDOW_MS
+	 * and over 10 and 100 times that. For CPUs, non-idle utilization.
+	 */
+	uint16_t utilization[K_CYCLE_WINDOWS];
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+
+#if defined(CONFIG_SCHED_THREAD_USAGE) && defined(CONFIG_SCHED_DEADLINE_PERIODIC)
+	/*
+	 * Number of periods in which a periodic thread ran for longer than
+	 * its budget. Always zero for CPU stats.
+	 */
+	uint32_t budget_overruns;
+#endif /* CONFIG_SCHED_THREAD_USAGE && CONFIG_SCHED_DEADLINE_PERIODIC */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -334,6 +395,11 @@ struct k_thread {
 
 	/** current syscall frame pointer */
 	void *syscall_frame;
+
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	/** kernel objects recently validated in system calls */
+	struct _thread_obj_cache obj_cache;
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
 #endif /* CONFIG_USERSPACE */
 
 
@@ -30,6 +30,7 @@
 #include <zephyr/kernel/stats.h>
 #include <zephyr/kernel/obj_core.h>
 #include <zephyr/sys/rb.h>
+#include <zephyr/sys/btree.h>
 #endif
 
 #define K_NUM_THREAD_PRIO (CONFIG_NUM_PREEMPT_PRIORITIES + CONFIG_NUM_COOP_PRIORITIES + 1)
@@ -107,7 +108,11 @@ extern "C" {
  */
 
 struct _priq_rb {
+#ifdef CONFIG_PRIQ_BTREE
+	struct btree tree;
+#else
 	struct rbtree tree;
+#endif
 	int next_order_key;
 };
 
@@ -157,7 +162,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -213,7 +218,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -278,7 +283,11 @@ typedef struct {
 } _wait_q_t;
 
 /* defined in kernel/priority_queues.c */
+#ifdef CONFIG_PRIQ_BTREE
+bool z_priq_rb_lessthan(struct btree_node *a, struct btree_node *b);
+#else
 bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
+#endif
 
 #define Z_WAIT_Q_INIT(wait_q) { { { .lessthan_fn = z_priq_rb_lessthan } } }
 
@@ -305,6 +314,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Index of the CPU queue this timeout was last armed on */
+	uint8_t queue;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -176,6 +176,17 @@ struct llext_load_param {
 	 *       before the extension can be unloaded via @ref llext_unload.
 	 */
 	bool keep_section_info;
+
+	/**
+	 * Execute the extension in place. The text region is used directly
+	 * from the ELF buffer, typically memory-mapped flash, and is never
+	 * copied to the LLEXT heap; read-only data is too unless it needs
+	 * relocations. This requires a loader with
+	 * @ref LLEXT_STORAGE_PERSISTENT storage that supports llext_peek(),
+	 * and an extension needing no relocations in its text, e.g. built
+	 * position independent. Cannot be combined with @ref pre_located.
+	 */
+	bool xip;
 };
 
 /** Default initializer for @ref llext_load_param */
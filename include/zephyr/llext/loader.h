@@ -142,6 +142,7 @@ struct llext_loader {
 	elf_ehdr_t hdr;
 	elf_shdr_t sects[LLEXT_MEM_COUNT];
 	struct llext_elf_sect_map *sect_map;
+	uintptr_t *sym_addrs;
 	/** @endcond */
 };
 
@@ -163,6 +163,27 @@ static inline bool z_log_is_local_domain(uint8_t domain_id)
  */
 log_timestamp_t z_log_timestamp(void);
 
+struct log_trace_evt;
+
+/** @brief Claim the oldest trace event from all CPU rings.
+ *
+ * @param evt Location where the trace event is copied.
+ *
+ * @retval true if trace event was claimed.
+ * @retval false if there are no trace events.
+ */
+bool z_log_trace_evt_claim(struct log_trace_evt *evt);
+
+/** @brief Check if there are any trace events pending.
+ *
+ * @retval true if at least one trace event is pending.
+ * @retval false if no trace event is pending.
+ */
+bool z_log_trace_evt_pending(void);
+
+/** @brief Notify logging core that a trace event ring is no longer empty. */
+void z_log_trace_evt_notify(void);
+
 #ifdef __cplusplus
 }
 #endif
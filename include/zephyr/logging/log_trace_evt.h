@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_LOGGING_LOG_TRACE_EVT_H_
+#define ZEPHYR_INCLUDE_LOGGING_LOG_TRACE_EVT_H_
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Binary trace events
+ * @defgroup log_trace_evt Binary trace events
+ * @ingroup logger
+ * @{
+ */
+
+/** Maximum number of 32-bit arguments of a trace event. */
+#define LOG_TRACE_EVT_MAX_ARGS 4
+
+/** @brief Trace event descriptor, created at compile time for every call site. */
+struct log_trace_evt_desc {
+	/** Format string, placed in the log strings section if enabled. */
+	const char *fmt;
+	/** Severity level. */
+	uint8_t level;
+	/** Number of arguments. */
+	uint8_t nargs;
+};
+
+/** @brief Trace event record stored in the per-CPU ring. */
+struct log_trace_evt {
+	/** Descriptor of the trace event. */
+	const struct log_trace_evt_desc *desc;
+	/** Log source of the trace event. */
+	const void *source;
+	/** Timestamp. */
+	log_timestamp_t timestamp;
+	/** Arguments. */
+	uint32_t args[LOG_TRACE_EVT_MAX_ARGS];
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+void z_log_trace_evt(const struct log_trace_evt_desc *desc, const void *source,
+		     const uint32_t *args);
+
+#define Z_LOG_TRACE_EVT(_level, _fmt, ...)                                                         \
+	do {                                                                                       \
+		if (!IS_ENABLED(CONFIG_LOG_TRACE_EVT) || !Z_LOG_CONST_LEVEL_CHECK(_level)) {       \
+			break;                                                                     \
+		}                                                                                  \
+		BUILD_ASSERT(NUM_VA_ARGS_LESS_1(_fmt, ##__VA_ARGS__) <= LOG_TRACE_EVT_MAX_ARGS,    \
+			     "Too many trace event arguments");                                    \
+		Z_LOG_MSG_STR_VAR(_trace_evt_fmt, _fmt)                                            \
+		static const struct log_trace_evt_desc _trace_evt_desc = {                         \
+			.fmt = COND_CODE_1(CONFIG_LOG_FMT_SECTION, (_trace_evt_fmt), (_fmt)),      \
+			.level = _level,                                                           \
+			.nargs = NUM_VA_ARGS_LESS_1(_fmt, ##__VA_ARGS__),                          \
+		};                                                                                 \
+		z_log_trace_evt(&_trace_evt_desc, (const void *)Z_LOG_CURRENT_DATA(),              \
+				(const uint32_t[LOG_TRACE_EVT_MAX_ARGS]){__VA_ARGS__});            \
+	} while (false)
+
+/** @endcond */
+
+/**
+ * @brief Write an error trace event.
+ *
+ * Trace event is a fixed size binary record with a pointer to the compile
+ * time descriptor, a timestamp and up to @ref LOG_TRACE_EVT_MAX_ARGS 32-bit
+ * integer arguments. It is written to a ring of the current CPU without
+ * packaging the arguments, so it can be used on hot paths and in ISRs. Trace
+ * events are processed by the log processing thread as regular log messages
+ * with the timestamp of the event, so they are decoded by the dictionary
+ * logging tools as well.
+ *
+ * Format string may only use 32-bit integer conversions. Only compile time
+ * level filtering is applied.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by up to @ref LOG_TRACE_EVT_MAX_ARGS integer arguments.
+ */
+#define LOG_TRACE_EVT_ERR(...) Z_LOG_TRACE_EVT(LOG_LEVEL_ERR, __VA_ARGS__)
+
+/**
+ * @brief Write a warning trace event.
+ *
+ * @details See @ref LOG_TRACE_EVT_ERR.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by up to @ref LOG_TRACE_EVT_MAX_ARGS integer arguments.
+ */
+#define LOG_TRACE_EVT_WRN(...) Z_LOG_TRACE_EVT(LOG_LEVEL_WRN, __VA_ARGS__)
+
+/**
+ * @brief Write an info trace event.
+ *
+ * @details See @ref LOG_TRACE_EVT_ERR.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by up to @ref LOG_TRACE_EVT_MAX_ARGS integer arguments.
+ */
+#define LOG_TRACE_EVT_INF(...) Z_LOG_TRACE_EVT(LOG_LEVEL_INF, __VA_ARGS__)
+
+/**
+ * @brief Write a debug trace event.
+ *
+ * @details See @ref LOG_TRACE_EVT_ERR.
+ *
+ * @param ... A string optionally containing printk valid conversion specifier,
+ * followed by up to @ref LOG_TRACE_EVT_MAX_ARGS integer arguments.
+ */
+#define LOG_TRACE_EVT_DBG(...) Z_LOG_TRACE_EVT(LOG_LEVEL_DBG, __VA_ARGS__)
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_LOGGING_LOG_TRACE_EVT_H_ */
@@ -14,7 +14,9 @@
  * @{
  */
 
+#include <zephyr/devicetree.h>
 #include <zephyr/mem_mgmt/mem_attr.h>
+#include <zephyr/dt-bindings/memory-attr/memory-attr-sw.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -87,6 +89,65 @@ void mem_attr_heap_free(void *block);
  */
 const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr);
 
+/**
+ * @brief Requirements of a device on its DMA buffers
+ */
+struct mem_attr_heap_dma_spec {
+	/** Software attribute(s) the region must have, e.g. DT_MEM_SW_ALLOC_DMA. */
+	uint32_t attr;
+	/** Address of the memory region to allocate from, 0 for any region. */
+	uintptr_t region;
+	/** Highest address the device can reach, 0 for no limit. */
+	uintptr_t addr_max;
+};
+
+/**
+ * @brief Get the DMA buffer requirements of a device from devicetree
+ *
+ * Buffers are allocated from the regions with the DT_MEM_SW_ALLOC_DMA
+ * attribute, restricted to the region referenced by the `memory-region`
+ * property of the node when it has one. The address limit can be set
+ * afterwards if the device cannot reach all of memory.
+ *
+ * @param node_id Node identifier of the device.
+ */
+#define MEM_ATTR_HEAP_DMA_SPEC_DT_GET(node_id)						\
+	{										\
+		.attr = DT_MEM_SW_ALLOC_DMA,						\
+		.region = COND_CODE_1(DT_NODE_HAS_PROP(node_id, memory_region),		\
+				      (DT_REG_ADDR(DT_PHANDLE(node_id, memory_region))),	\
+				      (0)),						\
+		.addr_max = 0,								\
+	}
+
+/**
+ * @brief Allocate a DMA buffer
+ *
+ * Allocates from a region matching @p spec a block aligned to the data cache
+ * line size and padded to a whole number of cache lines, so that cache
+ * maintenance on the buffer never touches unrelated data. Small blocks are
+ * rounded up to one of CONFIG_MEM_ATTR_HEAP_DMA_CACHE_CLASSES size classes,
+ * one cache line and its doubles, and freed blocks of these classes are
+ * kept for reuse, which makes the allocation of common buffer sizes quick.
+ *
+ * Available with CONFIG_MEM_ATTR_HEAP_DMA. Can be called from ISR context.
+ *
+ * @param spec Requirements of the device on the buffer.
+ * @param bytes Requested size of the buffer in bytes.
+ *
+ * @retval ptr a valid pointer to the allocated buffer.
+ * @retval NULL if no matching region has enough memory.
+ */
+void *mem_attr_heap_dma_alloc(const struct mem_attr_heap_dma_spec *spec, size_t bytes);
+
+/**
+ * @brief Free a DMA buffer
+ *
+ * @param block Buffer to free, must be a pointer returned by
+ *	  @ref mem_attr_heap_dma_alloc, or NULL.
+ */
+void mem_attr_heap_dma_free(void *block);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,191 @@
+/** @file
+ * @brief AES67 RTP audio profile helpers
+ *
+ * AES67 streams are RTP over UDP, sent and received with the regular
+ * socket API. These helpers build the RTP headers and payloads of the
+ * profile and derive the RTP timestamps from the gPTP time.
+ */
+
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_AES67_H_
+#define ZEPHYR_INCLUDE_NET_AES67_H_
+
+#include <errno.h>
+#include <zephyr/types.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/time_units.h>
+#include <zephyr/sys/byteorder.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief AES67 RTP audio profile
+ * @defgroup aes67 AES67 RTP audio profile
+ * @since 4.3
+ * @version 0.1.0
+ * @ingroup networking
+ * @{
+ */
+
+/** Length of an RTP header without CSRCs or extensions */
+#define AES67_RTP_HDR_LEN 12
+
+/** Default packet time of the profile in microseconds */
+#define AES67_PTIME_DEFAULT_US 1000
+
+/** Dynamic RTP payload type used for L24 audio by most AES67 devices */
+#define AES67_PT_L24 96
+
+/** @brief RTP header, all fields in network byte order */
+struct aes67_rtp_hdr {
+	/** Version, padding, extension and CSRC count */
+	uint8_t vpxcc;
+	/** Marker bit and payload type */
+	uint8_t mpt;
+	/** Sequence number */
+	uint16_t seq;
+	/** Media clock timestamp */
+	uint32_t timestamp;
+	/** Synchronization source */
+	uint32_t ssrc;
+} __packed;
+
+/** @cond INTERNAL_HIDDEN */
+BUILD_ASSERT(sizeof(struct aes67_rtp_hdr) == AES67_RTP_HDR_LEN);
+/** @endcond */
+
+/**
+ * @brief RTP timestamp of a gPTP time.
+ *
+ * AES67 runs the RTP media clock at the sample rate with its epoch at the
+ * PTP epoch, shifted by the offset announced in the SDP of the stream.
+ *
+ * @param ptp_time gPTP time in nanoseconds.
+ * @param rate Sample rate in Hz.
+ * @param offset Media clock offset.
+ *
+ * @return RTP timestamp.
+ */
+static inline uint32_t aes67_rtp_timestamp(uint64_t ptp_time, uint32_t rate, uint32_t offset)
+{
+	/* Split the time so the product cannot overflow */
+	uint64_t samples = (ptp_time / NSEC_PER_SEC) * rate +
+			   ((ptp_time % NSEC_PER_SEC) * rate) / NSEC_PER_SEC;
+
+	return (uint32_t)samples + offset;
+}
+
+/**
+ * @brief Number of sample frames in an RTP packet.
+ *
+ * @param rate Sample rate in Hz.
+ * @param ptime_us Packet time in microseconds.
+ *
+ * @return Frames per packet.
+ */
+static inline uint32_t aes67_frames_per_packet(uint32_t rate, uint32_t ptime_us)
+{
+	return (uint32_t)(((uint64_t)rate * ptime_us) / USEC_PER_SEC);
+}
+
+/**
+ * @brief Fill an RTP header.
+ *
+ * @param hdr Header to fill.
+ * @param pt Payload type.
+ * @param seq Sequence number.
+ * @param timestamp RTP timestamp of the first frame.
+ * @param ssrc Synchronization source.
+ */
+static inline void aes67_rtp_hdr_pack(struct aes67_rtp_hdr *hdr, uint8_t pt, uint16_t seq,
+				      uint32_t timestamp, uint32_t ssrc)
+{
+	hdr->vpxcc = 2U << 6;
+	hdr->mpt = pt & 0x7f;
+	hdr->seq = sys_cpu_to_be16(seq);
+	hdr->timestamp = sys_cpu_to_be32(timestamp);
+	hdr->ssrc = sys_cpu_to_be32(ssrc);
+}
+
+/**
+ * @brief Parse an RTP header.
+ *
+ * @param buf Received datagram.
+ * @param len Length of @p buf.
+ * @param hdr Header in host byte order, filled from @p buf.
+ *
+ * @return Offset of the payload in @p buf, or -EINVAL if @p buf does not
+ *         start with a valid RTP version 2 header.
+ */
+static inline int aes67_rtp_hdr_parse(const uint8_t *buf, size_t len, struct aes67_rtp_hdr *hdr)
+{
+	size_t off;
+
+	if (len < AES67_RTP_HDR_LEN || (buf[0] >> 6) != 2U) {
+		return -EINVAL;
+	}
+
+	hdr->vpxcc = buf[0];
+	hdr->mpt = buf[1];
+	hdr->seq = sys_get_be16(&buf[2]);
+	hdr->timestamp = sys_get_be32(&buf[4]);
+	hdr->ssrc = sys_get_be32(&buf[8]);
+
+	off = AES67_RTP_HDR_LEN + (buf[0] & 0x0f) * sizeof(uint32_t);
+
+	if (buf[0] & BIT(4)) {
+		if (len < off + sizeof(uint32_t)) {
+			return -EINVAL;
+		}
+
+		off += sizeof(uint32_t) + sys_get_be16(&buf[off + 2]) * sizeof(uint32_t);
+	}
+
+	return off <= len ? (int)off : -EINVAL;
+}
+
+/**
+ * @brief Pack samples into an L24 payload.
+ *
+ * @param dst Payload, 3 bytes per sample.
+ * @param src Samples with the value in the low 24 bits.
+ * @param count Number of samples.
+ */
+static inline void aes67_l24_pack(uint8_t *dst, const int32_t *src, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		sys_put_be24((uint32_t)src[i], &dst[i * 3U]);
+	}
+}
+
+/**
+ * @brief Unpack samples from an L24 payload.
+ *
+ * @param dst Sign extended samples.
+ * @param src Payload, 3 bytes per sample.
+ * @param count Number of samples.
+ */
+static inline void aes67_l24_unpack(int32_t *dst, const uint8_t *src, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		dst[i] = (int32_t)(sys_get_be24(&src[i * 3U]) << 8) >> 8;
+	}
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_NET_AES67_H_ */
@@ -0,0 +1,507 @@
+/** @file
+ * @brief IEEE 1722 Audio Video Transport Protocol (AVTP)
+ *
+ * AAF audio talker and listener and CRF media clock streams carried
+ * directly over Ethernet, timed by the gPTP synchronized PTP clock.
+ */
+
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_AVTP_H_
+#define ZEPHYR_INCLUDE_NET_AVTP_H_
+
+#include <errno.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/ethernet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief IEEE 1722 AVTP audio streaming
+ * @defgroup avtp Audio Video Transport Protocol
+ * @since 4.3
+ * @version 0.1.0
+ * @ingroup networking
+ * @{
+ */
+
+/** AVTPDU subtype of the AVTP Audio Format */
+#define AVTP_SUBTYPE_AAF 0x02
+/** AVTPDU subtype of the Clock Reference Format */
+#define AVTP_SUBTYPE_CRF 0x04
+
+/** Length of the AAF PCM stream header */
+#define AVTP_AAF_HDR_LEN 24
+/** Length of the CRF header, excluding the timestamps */
+#define AVTP_CRF_HDR_LEN 20
+
+/** Ethernet, VLAN tag, FCS, preamble and inter frame gap bytes added to every AVTPDU */
+#define AVTP_ETH_OVERHEAD 42
+
+/** @brief AAF sample formats */
+enum avtp_aaf_format {
+	AVTP_AAF_FORMAT_USER = 0x00,      /**< User specified */
+	AVTP_AAF_FORMAT_FLOAT_32BIT = 0x01, /**< 32-bit IEEE 754 floating point */
+	AVTP_AAF_FORMAT_INT_32BIT = 0x02, /**< 32-bit integer */
+	AVTP_AAF_FORMAT_INT_24BIT = 0x03, /**< 24-bit integer */
+	AVTP_AAF_FORMAT_INT_16BIT = 0x04, /**< 16-bit integer */
+};
+
+/** @brief AAF nominal sample rates */
+enum avtp_aaf_nsr {
+	AVTP_AAF_NSR_USER = 0x0,   /**< User specified */
+	AVTP_AAF_NSR_8KHZ = 0x1,   /**< 8 kHz */
+	AVTP_AAF_NSR_16KHZ = 0x2,  /**< 16 kHz */
+	AVTP_AAF_NSR_32KHZ = 0x3,  /**< 32 kHz */
+	AVTP_AAF_NSR_44_1KHZ = 0x4, /**< 44.1 kHz */
+	AVTP_AAF_NSR_48KHZ = 0x5,  /**< 48 kHz */
+	AVTP_AAF_NSR_88_2KHZ = 0x6, /**< 88.2 kHz */
+	AVTP_AAF_NSR_96KHZ = 0x7,  /**< 96 kHz */
+	AVTP_AAF_NSR_176_4KHZ = 0x8, /**< 176.4 kHz */
+	AVTP_AAF_NSR_192KHZ = 0x9, /**< 192 kHz */
+	AVTP_AAF_NSR_24KHZ = 0xa,  /**< 24 kHz */
+};
+
+/** @brief CRF types */
+enum avtp_crf_type {
+	AVTP_CRF_TYPE_USER = 0x00,         /**< User specified */
+	AVTP_CRF_TYPE_AUDIO_SAMPLE = 0x01, /**< Audio sample timestamps */
+	AVTP_CRF_TYPE_VIDEO_FRAME = 0x02,  /**< Video frame timestamps */
+	AVTP_CRF_TYPE_VIDEO_LINE = 0x03,   /**< Video line timestamps */
+	AVTP_CRF_TYPE_MACHINE_CYCLE = 0x04, /**< Machine cycle timestamps */
+};
+
+/** @brief AAF PCM stream header, all fields in network byte order */
+struct avtp_aaf_hdr {
+	/** AVTPDU subtype, @ref AVTP_SUBTYPE_AAF */
+	uint8_t subtype;
+	/** Stream valid, version, media clock restart and timestamp valid bits */
+	uint8_t flags;
+	/** Sequence number */
+	uint8_t seq_num;
+	/** Timestamp uncertain bit */
+	uint8_t tu;
+	/** Stream ID */
+	uint8_t stream_id[8];
+	/** Presentation time, low 32 bits of the gPTP time in nanoseconds */
+	uint32_t timestamp;
+	/** Sample format, see @ref avtp_aaf_format */
+	uint8_t format;
+	/** Nominal sample rate and the high bits of the channel count */
+	uint8_t nsr_chan;
+	/** Low bits of the channel count */
+	uint8_t chan;
+	/** Bit depth of the samples */
+	uint8_t bit_depth;
+	/** Length of the samples in bytes */
+	uint16_t data_len;
+	/** Sparse timestamp mode and event bits */
+	uint8_t evt;
+	/** Reserved */
+	uint8_t reserved;
+} __packed;
+
+/** @brief CRF header, all fields in network byte order */
+struct avtp_crf_hdr {
+	/** AVTPDU subtype, @ref AVTP_SUBTYPE_CRF */
+	uint8_t subtype;
+	/** Stream valid, version, media clock restart, frame sync and timestamp uncertain bits */
+	uint8_t flags;
+	/** Sequence number */
+	uint8_t seq_num;
+	/** CRF type, see @ref avtp_crf_type */
+	uint8_t type;
+	/** Stream ID */
+	uint8_t stream_id[8];
+	/** Base frequency multiplier and frequency in Hz */
+	uint32_t pull_freq;
+	/** Length of the timestamps in bytes */
+	uint16_t data_len;
+	/** Number of media clock events between two timestamps */
+	uint16_t interval;
+} __packed;
+
+/** @cond INTERNAL_HIDDEN */
+
+#define AVTP_FLAG_SV BIT(7)
+#define AVTP_FLAG_MR BIT(3)
+#define AVTP_FLAG_TV BIT(0)
+#define AVTP_FLAG_TU BIT(0)
+
+BUILD_ASSERT(sizeof(struct avtp_aaf_hdr) == AVTP_AAF_HDR_LEN);
+BUILD_ASSERT(sizeof(struct avtp_crf_hdr) == AVTP_CRF_HDR_LEN);
+
+/** @endcond */
+
+/** @brief AVTP stream configuration */
+struct avtp_stream_config {
+	/** Stream ID, the talker MAC address followed by a unique ID */
+	uint64_t stream_id;
+	/** Destination, usually a multicast address assigned by MAAP */
+	struct net_eth_addr dst;
+	/** Priority of the stream frames, which selects the SR class queue */
+	enum net_priority priority;
+	/** Maximum transit time in nanoseconds, added to the capture time */
+	uint32_t max_transit_time;
+	/** AAF sample format */
+	enum avtp_aaf_format format;
+	/** AAF nominal sample rate */
+	enum avtp_aaf_nsr nsr;
+	/** Number of channels in each frame */
+	uint16_t channels;
+	/** Number of significant bits in each sample */
+	uint8_t bit_depth;
+};
+
+/** @brief AVTP talker */
+struct avtp_talker {
+	/** Network interface the stream is sent on */
+	struct net_if *iface;
+	/** Stream configuration */
+	struct avtp_stream_config cfg;
+	/** Sequence number of the next AVTPDU */
+	uint8_t seq_num;
+};
+
+/** @brief Information about a received AVTPDU */
+struct avtp_stream_info {
+	/** AVTPDU subtype */
+	uint8_t subtype;
+	/** True if the presentation time, or the CRF timestamps, are valid */
+	bool tv;
+	/** Number of AVTPDUs lost before this one */
+	uint8_t lost;
+	/** Presentation time, low 32 bits of the gPTP time in nanoseconds */
+	uint32_t presentation_time;
+	/** Length of the payload in bytes */
+	uint16_t len;
+	/** Header fields of AAF streams */
+	struct {
+		/** Sample format */
+		enum avtp_aaf_format format;
+		/** Nominal sample rate */
+		enum avtp_aaf_nsr nsr;
+		/** Number of channels in each frame */
+		uint16_t channels;
+		/** Number of significant bits in each sample */
+		uint8_t bit_depth;
+	} aaf;
+	/** Header fields of CRF streams */
+	struct {
+		/** CRF type */
+		enum avtp_crf_type type;
+		/** Base frequency in Hz */
+		uint32_t base_freq;
+		/** Number of media clock events between two timestamps */
+		uint16_t interval;
+	} crf;
+};
+
+struct avtp_listener;
+
+/**
+ * @brief Callback receiving the AVTPDUs of a stream.
+ *
+ * It is called from the network RX thread with the packet cursor at the
+ * start of the payload, which can be read with net_pkt_read(). For CRF
+ * streams the payload is a list of 64-bit big endian timestamps. The
+ * packet is released once the callback returns.
+ *
+ * @param listener Listener the stream belongs to.
+ * @param pkt Received packet.
+ * @param info Header information of the AVTPDU.
+ */
+typedef void (*avtp_listener_cb_t)(struct avtp_listener *listener, struct net_pkt *pkt,
+				   const struct avtp_stream_info *info);
+
+/** @brief AVTP listener */
+struct avtp_listener {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	uint8_t next_seq;
+	bool started;
+	/** @endcond */
+
+	/** Stream ID to receive */
+	uint64_t stream_id;
+	/** Limit the stream to this interface, or NULL for any interface */
+	struct net_if *iface;
+	/** Called for every AVTPDU of the stream, may be NULL when writing to I2S */
+	avtp_listener_cb_t cb;
+#if defined(CONFIG_NET_AVTP_I2S) || defined(__DOXYGEN__)
+	/**
+	 * I2S device the AAF samples are written to, or NULL. The samples
+	 * are converted to host byte order while they are copied into a TX
+	 * block claimed from the device, so the block size must match the
+	 * payload of one AVTPDU.
+	 */
+	const struct device *i2s;
+	/** Number of AVTPDUs dropped because their presentation time had passed */
+	uint32_t late;
+#endif
+	/** User data for the callback */
+	void *user_data;
+};
+
+/**
+ * @brief Initialize an AAF talker.
+ *
+ * @param talker Talker to initialize.
+ * @param iface Network interface, a VLAN interface when the stream is tagged.
+ * @param cfg Stream configuration, copied into the talker.
+ *
+ * @return 0 if ok, <0 if error
+ */
+int avtp_talker_init(struct avtp_talker *talker, struct net_if *iface,
+		     const struct avtp_stream_config *cfg);
+
+/**
+ * @brief Send one AAF AVTPDU.
+ *
+ * The presentation time of the samples is @p capture_time plus the maximum
+ * transit time of the stream.
+ *
+ * @param talker Talker.
+ * @param samples Samples in network byte order, interleaved by channel.
+ * @param len Length of @p samples in bytes.
+ * @param capture_time gPTP time of the first sample in nanoseconds.
+ *
+ * @return 0 if ok, <0 if error
+ */
+int avtp_aaf_send(struct avtp_talker *talker, const void *samples, size_t len,
+		  uint64_t capture_time);
+
+/**
+ * @brief Send one CRF AVTPDU.
+ *
+ * The AAF fields of the talker configuration are not used.
+ *
+ * @param talker Talker.
+ * @param type CRF type.
+ * @param base_freq Base frequency in Hz.
+ * @param interval Number of media clock events between two timestamps.
+ * @param timestamps gPTP times of the media clock events in nanoseconds.
+ * @param count Number of timestamps.
+ *
+ * @return 0 if ok, <0 if error
+ */
+int avtp_crf_send(struct avtp_talker *talker, enum avtp_crf_type type, uint32_t base_freq,
+		  uint16_t interval, const uint64_t *timestamps, size_t count);
+
+/**
+ * @brief Register a listener.
+ *
+ * @param listener Listener with its stream ID and callback or I2S device set.
+ *
+ * @return 0 if ok, -EALREADY if the listener is already registered.
+ */
+int avtp_listener_register(struct avtp_listener *listener);
+
+/**
+ * @brief Unregister a listener.
+ *
+ * @param listener Registered listener.
+ *
+ * @return 0 if ok, -ENOENT if the listener is not registered.
+ */
+int avtp_listener_unregister(struct avtp_listener *listener);
+
+/**
+ * @brief Get the current gPTP time of an interface.
+ *
+ * @param iface Network interface.
+ * @param time Current time in nanoseconds.
+ *
+ * @return 0 if ok, -ENOTSUP if the interface has no PTP clock.
+ */
+int avtp_time_get(struct net_if *iface, uint64_t *time);
+
+/**
+ * @brief Reserve bandwidth for a stream with the credit based shaper.
+ *
+ * Set the idle slope of a Qav capable Ethernet queue to the bandwidth of
+ * the stream and enable the shaper.
+ *
+ * @param talker Talker.
+ * @param queue_id Ethernet TX queue of the stream SR class.
+ * @param len Payload length of each AVTPDU in bytes.
+ * @param frames_per_sec Number of AVTPDUs sent every second.
+ *
+ * @return 0 if ok, <0 if error
+ */
+int avtp_talker_reserve(struct avtp_talker *talker, int queue_id, size_t len,
+			uint32_t frames_per_sec);
+
+/**
+ * @brief Bandwidth used by a stream on the wire.
+ *
+ * @param hdr_len Length of the AVTPDU header.
+ * @param len Payload length of each AVTPDU in bytes.
+ * @param frames_per_sec Number of AVTPDUs sent every second.
+ *
+ * @return Bandwidth in bits per second.
+ */
+static inline uint64_t avtp_stream_bandwidth(size_t hdr_len, size_t len, uint32_t frames_per_sec)
+{
+	return (uint64_t)(AVTP_ETH_OVERHEAD + hdr_len + len) * 8U * frames_per_sec;
+}
+
+/**
+ * @brief Time left until a presentation time.
+ *
+ * AVTP timestamps carry the low 32 bits of the gPTP time, which wrap
+ * every 4.29 seconds, so the distance is taken modulo 2^32.
+ *
+ * @param presentation_time Presentation time of an AVTPDU.
+ * @param now Current gPTP time in nanoseconds.
+ *
+ * @return Nanoseconds until the presentation time, negative if it has passed.
+ */
+static inline int32_t avtp_presentation_delta(uint32_t presentation_time, uint64_t now)
+{
+	return (int32_t)(presentation_time - (uint32_t)now);
+}
+
+/**
+ * @brief Sample rate of an AAF nominal sample rate code.
+ *
+ * @param nsr Nominal sample rate.
+ *
+ * @return Sample rate in Hz, or 0 for @ref AVTP_AAF_NSR_USER and unknown codes.
+ */
+static inline uint32_t avtp_aaf_nsr_to_rate(enum avtp_aaf_nsr nsr)
+{
+	static const uint32_t rates[] = {
+		0, 8000, 16000, 32000, 44100, 48000, 88200, 96000, 176400, 192000, 24000,
+	};
+
+	return (unsigned int)nsr < ARRAY_SIZE(rates) ? rates[nsr] : 0U;
+}
+
+/**
+ * @brief Fill an AAF header.
+ *
+ * @param hdr Header to fill.
+ * @param cfg Stream configuration.
+ * @param seq_num Sequence number.
+ * @param timestamp Presentation time.
+ * @param len Length of the samples in bytes.
+ */
+static inline void avtp_aaf_hdr_pack(struct avtp_aaf_hdr *hdr,
+				     const struct avtp_stream_config *cfg, uint8_t seq_num,
+				     uint32_t timestamp, uint16_t len)
+{
+	hdr->subtype = AVTP_SUBTYPE_AAF;
+	hdr->flags = AVTP_FLAG_SV | AVTP_FLAG_TV;
+	hdr->seq_num = seq_num;
+	hdr->tu = 0U;
+	sys_put_be64(cfg->stream_id, hdr->stream_id);
+	hdr->timestamp = htonl(timestamp);
+	hdr->format = cfg->format;
+	hdr->nsr_chan = (cfg->nsr << 4) | ((cfg->channels >> 8) & 0x03);
+	hdr->chan = cfg->channels & 0xff;
+	hdr->bit_depth = cfg->bit_depth;
+	hdr->data_len = htons(len);
+	hdr->evt = 0U;
+	hdr->reserved = 0U;
+}
+
+/**
+ * @brief Parse an AAF header.
+ *
+ * @param hdr Received header.
+ * @param info Information of the AVTPDU, filled from @p hdr.
+ *
+ * @return 0 if ok, -EINVAL if @p hdr is not a valid AAF stream header.
+ */
+static inline int avtp_aaf_hdr_parse(const struct avtp_aaf_hdr *hdr,
+				     struct avtp_stream_info *info)
+{
+	if (hdr->subtype != AVTP_SUBTYPE_AAF || !(hdr->flags & AVTP_FLAG_SV) ||
+	    (hdr->flags & 0x70) != 0U) {
+		return -EINVAL;
+	}
+
+	info->subtype = AVTP_SUBTYPE_AAF;
+	info->tv = (hdr->flags & AVTP_FLAG_TV) != 0U;
+	info->presentation_time = ntohl(hdr->timestamp);
+	info->len = ntohs(hdr->data_len);
+	info->aaf.format = hdr->format;
+	info->aaf.nsr = hdr->nsr_chan >> 4;
+	info->aaf.channels = ((hdr->nsr_chan & 0x03) << 8) | hdr->chan;
+	info->aaf.bit_depth = hdr->bit_depth;
+
+	return 0;
+}
+
+/**
+ * @brief Fill a CRF header.
+ *
+ * @param hdr Header to fill.
+ * @param stream_id Stream ID.
+ * @param seq_num Sequence number.
+ * @param type CRF type.
+ * @param base_freq Base frequency in Hz, at most 536870911.
+ * @param interval Number of media clock events between two timestamps.
+ * @param count Number of timestamps following the header.
+ */
+static inline void avtp_crf_hdr_pack(struct avtp_crf_hdr *hdr, uint64_t stream_id,
+				     uint8_t seq_num, enum avtp_crf_type type,
+				     uint32_t base_freq, uint16_t interval, size_t count)
+{
+	hdr->subtype = AVTP_SUBTYPE_CRF;
+	hdr->flags = AVTP_FLAG_SV;
+	hdr->seq_num = seq_num;
+	hdr->type = type;
+	sys_put_be64(stream_id, hdr->stream_id);
+	/* A pull of 0 multiplies the base frequency by 1.0 */
+	hdr->pull_freq = htonl(base_freq & BIT_MASK(29));
+	hdr->data_len = htons(count * sizeof(uint64_t));
+	hdr->interval = htons(interval);
+}
+
+/**
+ * @brief Parse a CRF header.
+ *
+ * @param hdr Received header.
+ * @param info Information of the AVTPDU, filled from @p hdr.
+ *
+ * @return 0 if ok, -EINVAL if @p hdr is not a valid CRF header.
+ */
+static inline int avtp_crf_hdr_parse(const struct avtp_crf_hdr *hdr,
+				     struct avtp_stream_info *info)
+{
+	if (hdr->subtype != AVTP_SUBTYPE_CRF || !(hdr->flags & AVTP_FLAG_SV) ||
+	    (hdr->flags & 0x70) != 0U || ntohs(hdr->data_len) % sizeof(uint64_t) != 0U) {
+		return -EINVAL;
+	}
+
+	info->subtype = AVTP_SUBTYPE_CRF;
+	info->tv = !(hdr->flags & AVTP_FLAG_TU);
+	info->presentation_time = 0U;
+	info->len = ntohs(hdr->data_len);
+	info->crf.type = hdr->type;
+	info->crf.base_freq = ntohl(hdr->pull_freq) & BIT_MASK(29);
+	info->crf.interval = ntohs(hdr->interval);
+
+	return 0;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_NET_AVTP_H_ */
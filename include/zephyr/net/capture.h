@@ -13,6 +13,7 @@
 #ifndef ZEPHYR_INCLUDE_NET_CAPTURE_H_
 #define ZEPHYR_INCLUDE_NET_CAPTURE_H_
 
+#include <sys/types.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 
@@ -372,6 +373,105 @@ static inline void net_capture_foreach(net_capture_cb_t cb, void *user_data)
 
 /** @endcond */
 
+/** Local capture statistics. */
+struct net_capture_local_stats {
+	/** Number of packets captured since the capture was enabled. */
+	uint32_t packets;
+	/** Number of packets overwritten by newer ones. */
+	uint32_t overwritten;
+	/** Size of the pcapng data that can be exported, in bytes. */
+	size_t size;
+	/** Is the local capture running. */
+	bool enabled;
+};
+
+/**
+ * @typedef net_capture_local_cb_t
+ * @brief Callback used to export the local capture
+ *
+ * @param data Next chunk of the pcapng data, in place in the capture ring.
+ * @param len Length of the chunk in bytes.
+ * @param user_data A valid pointer to user data or NULL
+ *
+ * @return 0 to continue, <0 to stop the export with that error.
+ */
+typedef int (*net_capture_local_cb_t)(const void *data, size_t len, void *user_data);
+
+#if defined(CONFIG_NET_CAPTURE_LOCAL) || defined(__DOXYGEN__)
+
+/**
+ * @brief Start capturing packets to the local pcapng ring.
+ *
+ * @details Packets received on @p iface are written to a ring of
+ * CONFIG_NET_CAPTURE_LOCAL_RING_SIZE bytes as pcapng Enhanced Packet Blocks,
+ * truncated to @p snaplen bytes and timestamped with the hardware timestamp
+ * of the packet when the driver sets one. Nothing is allocated from the
+ * network packet pools. When the ring is full the oldest packets are
+ * overwritten. Enabling the capture discards the previous capture.
+ *
+ * @param iface Network interface to capture.
+ * @param snaplen Number of bytes kept from each packet, 0 for
+ *        CONFIG_NET_CAPTURE_LOCAL_SNAPLEN.
+ *
+ * @return 0 if ok, -EALREADY if the local capture is already running,
+ *         -EINVAL if the snap length is too large for the ring.
+ */
+int net_capture_local_enable(struct net_if *iface, uint16_t snaplen);
+
+/**
+ * @brief Stop capturing packets to the local pcapng ring.
+ *
+ * @details The captured packets are kept until the capture is enabled
+ * again, so that they can be exported.
+ *
+ * @return 0 if ok, -EALREADY if the local capture was not running.
+ */
+int net_capture_local_disable(void);
+
+/**
+ * @brief Export the local capture as a pcapng file.
+ *
+ * @details Calls @p cb with consecutive chunks of a pcapng file holding the
+ * captured packets, oldest first. The chunks point into the capture ring,
+ * nothing is copied, so the callback can hand them directly to a file
+ * system write or an HTTP response.
+ *
+ * @param cb Callback to call for each chunk.
+ * @param user_data User supplied data.
+ *
+ * @return 0 if ok, -EBUSY if the capture is running, -ENODATA if nothing
+ *         was captured, or the error returned by @p cb.
+ */
+int net_capture_local_export(net_capture_local_cb_t cb, void *user_data);
+
+/**
+ * @brief Read part of the local capture as a pcapng file.
+ *
+ * @details Same data as net_capture_local_export(), for readers that fetch
+ * the file in pieces, like a file download over MCUmgr.
+ *
+ * @param offset Offset in the pcapng file.
+ * @param buf Buffer to read to.
+ * @param len Size of @p buf.
+ *
+ * @return Number of bytes read, 0 at the end of the file, or the error of
+ *         net_capture_local_export().
+ */
+ssize_t net_capture_local_read(size_t offset, void *buf, size_t len);
+
+/**
+ * @brief Get local capture statistics.
+ *
+ * @param stats Statistics, filled by the function.
+ */
+void net_capture_local_stats_get(struct net_capture_local_stats *stats);
+
+/** @cond INTERNAL_HIDDEN */
+void net_capture_local_pkt(struct net_if *iface, struct net_pkt *pkt);
+/** @endcond */
+
+#endif /* CONFIG_NET_CAPTURE_LOCAL */
+
 /**
  * @}
  */
@@ -688,6 +688,9 @@ bool coap_packet_is_request(const struct coap_packet *cpkt);
  * @brief When a request is received, call the appropriate methods of
  * the matching resources.
  *
+ * The resources are looked up in array order, the time taken grows with
+ * @p resources_len and the first resource with a matching path is used.
+ *
  * @param cpkt Packet received
  * @param resources Array of known resources
  * @param resources_len Number of resources in the array
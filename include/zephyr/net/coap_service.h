@@ -307,6 +307,92 @@ int coap_resource_send(const struct coap_resource *resource, const struct coap_p
 		       const struct sockaddr *addr, socklen_t addr_len,
 		       const struct coap_transmission_parameters *params);
 
+/**
+ * @brief Callback reading a part of the content of a resource.
+ *
+ * @param offset Offset of the data in the content.
+ * @param buf Buffer to copy the data to.
+ * @param len Number of bytes to copy, the whole buffer must be filled.
+ * @param user_data User data provided in the @ref coap_resource_content.
+ * @return 0 in case of success or negative in case of error.
+ */
+typedef int (*coap_resource_read_t)(size_t offset, uint8_t *buf, size_t len, void *user_data);
+
+/**
+ * @brief Callback storing a part of the content sent to a resource.
+ *
+ * @param offset Offset of the data in the content.
+ * @param buf Received data.
+ * @param len Number of bytes received.
+ * @param last True if this is the last part of the content.
+ * @param user_data User data provided to @ref coap_resource_recv_block1.
+ * @return 0 in case of success or negative in case of error.
+ */
+typedef int (*coap_resource_write_t)(size_t offset, const uint8_t *buf, size_t len, bool last,
+				     void *user_data);
+
+/**
+ * @brief Content of a resource to be sent with block-wise transfers.
+ */
+struct coap_resource_content {
+	/** Total size of the content in bytes. */
+	size_t size;
+	/** Content-Format option value, or -1 to leave the option out. */
+	int format;
+	/** Callback reading the content, one block at a time. */
+	coap_resource_read_t read;
+	/** User data passed to the callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Reply to a GET request with one block of the @p content of the @p resource .
+ *
+ * @note This function is suitable for a @p resource defined with @ref COAP_RESOURCE_DEFINE.
+ *
+ * The block requested by the Block2 option of the @p request , or the first one, is read
+ * through the callback of the @p content straight into the response, which is then sent.
+ * No state is kept between the blocks. The block size is the smallest of the size requested
+ * by the client, @kconfig{CONFIG_COAP_SERVER_BLOCK_SIZE}, and what fits in a
+ * @kconfig{CONFIG_COAP_SERVER_MESSAGE_SIZE} message.
+ *
+ * @param resource Pointer to CoAP resource
+ * @param request CoAP request to reply to
+ * @param addr Peer address
+ * @param addr_len Peer address length
+ * @param content Content of the resource
+ * @return 0 in case of success, a positive CoAP response code to reply with in case the
+ * request can't be served, or negative in case of error.
+ */
+int coap_resource_send_block2(const struct coap_resource *resource,
+			      const struct coap_packet *request,
+			      const struct sockaddr *addr, socklen_t addr_len,
+			      const struct coap_resource_content *content);
+
+/**
+ * @brief Receive one block of the content sent to the @p resource by a PUT or POST request.
+ *
+ * @note This function is suitable for a @p resource defined with @ref COAP_RESOURCE_DEFINE.
+ *
+ * The payload of the @p request is passed to the @p write callback along with its offset, as
+ * given by the Block1 option. A request without Block1 option carries the whole content.
+ * Intermediate blocks are acknowledged with 2.31 Continue, and the last one with
+ * 2.04 Changed. No state is kept between the blocks.
+ *
+ * @param resource Pointer to CoAP resource
+ * @param request CoAP request to reply to
+ * @param addr Peer address
+ * @param addr_len Peer address length
+ * @param write Callback storing the received data
+ * @param user_data User data passed to the callback
+ * @return 0 in case of success, a positive CoAP response code to reply with in case the
+ * request can't be served, or negative in case of error.
+ */
+int coap_resource_recv_block1(const struct coap_resource *resource,
+			      const struct coap_packet *request,
+			      const struct sockaddr *addr, socklen_t addr_len,
+			      coap_resource_write_t write, void *user_data);
+
 /**
  * @brief Parse a CoAP observe request for the provided @p resource .
  *
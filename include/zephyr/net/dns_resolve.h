@@ -779,6 +779,32 @@ static inline int dns_cancel_addr_info(uint16_t dns_id)
 	return dns_resolve_cancel(dns_resolve_get_default(), dns_id);
 }
 
+/**
+ * @brief DNS resolver cache statistics.
+ */
+struct dns_resolve_cache_stats {
+	/** Lookups answered with cached addresses */
+	uint32_t hits;
+	/** Lookups answered from a cached negative (non-existing name) entry */
+	uint32_t negative_hits;
+	/** Lookups that had to go to the network */
+	uint32_t misses;
+	/** Valid entries overwritten because the cache was full */
+	uint32_t evictions;
+	/** Queries sent to refresh entries before they expired */
+	uint32_t prefetches;
+};
+
+/**
+ * @brief Get the DNS resolver cache statistics.
+ *
+ * @param stats Statistics are copied here.
+ *
+ * @return 0 if ok, -ENOTSUP if @kconfig{CONFIG_DNS_RESOLVER_CACHE} is not
+ * enabled, -EINVAL if @p stats is NULL.
+ */
+int dns_resolve_cache_stats_get(struct dns_resolve_cache_stats *stats);
+
 /**
  * @}
  */
@@ -202,6 +202,9 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload supported, see net_pkt_tso_mss() */
+	ETHERNET_HW_TSO			= BIT(21),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -633,6 +636,37 @@ enum ethernet_flags {
 	ETH_CARRIER_UP,
 };
 
+/** @cond INTERNAL_HIDDEN */
+
+#if defined(CONFIG_NET_ETHERNET_SW_SHAPER)
+/* Software 802.1Qav credit based shaper of one TX traffic class */
+struct ethernet_shaper_cbs {
+	/* Credit in nanobits, never positive between frames */
+	int64_t credit;
+	/* Time the credit was last updated in nanoseconds */
+	uint64_t last;
+	/* Idle slope in bits per second */
+	uint32_t idle_slope;
+	bool enabled;
+};
+
+/* Software 802.1Qav and 802.1Qbv state of an Ethernet interface */
+struct ethernet_shaper {
+	struct k_spinlock lock;
+	struct ethernet_shaper_cbs cbs[NET_TC_TX_COUNT];
+	/* Gate control list, one gate bit per TX traffic class */
+	uint32_t gcl_interval[CONFIG_NET_ETHERNET_SW_SHAPER_GCL_LEN];
+	uint8_t gcl_gates[CONFIG_NET_ETHERNET_SW_SHAPER_GCL_LEN];
+	uint16_t gcl_len;
+	bool gates_enabled;
+	/* Start and length of the gate cycle in gPTP nanoseconds */
+	uint64_t base_time;
+	uint64_t cycle_time;
+};
+#endif
+
+/** @endcond */
+
 /** Ethernet L2 context that is needed for VLAN */
 struct ethernet_context {
 	/** Flags representing ethernet state, which are accessed from multiple
@@ -702,6 +736,11 @@ struct ethernet_context {
 	struct dsa_switch_context *dsa_switch_ctx;
 #endif
 
+#if defined(CONFIG_NET_ETHERNET_SW_SHAPER)
+	/** Software traffic shaper, used when the driver has no Qav or Qbv */
+	struct ethernet_shaper shaper;
+#endif
+
 	/** Is network carrier up */
 	bool is_net_carrier_up : 1;
 
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Emna Rekik
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -61,6 +62,17 @@ enum http2_frame_type {
 #define HTTP2_PRIORITY_FRAME_LEN 5
 #define HTTP2_RST_STREAM_FRAME_LEN 4
 
+/* Initial SETTINGS_MAX_FRAME_SIZE, the largest payload any peer accepts */
+#define HTTP2_DEFAULT_MAX_FRAME_SIZE 16384
+#define HTTP2_MAX_FRAME_SIZE         0xFFFFFF
+
+/* Initial flow-control window, for the connection and every stream */
+#define HTTP2_DEFAULT_WINDOW_SIZE 65535
+#define HTTP2_MAX_WINDOW_SIZE     0x7FFFFFFF
+
+#define HTTP2_WINDOW_UPDATE_FRAME_LEN 4
+#define HTTP2_WINDOW_UPDATE_MASK      0x7FFFFFFF
+
 /** @endcond */
 
 /** HTTP2 settings field */
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2023, Emna Rekik
  * Copyright (c) 2024 Nordic Semiconductor ASA
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -120,6 +121,25 @@ struct http_resource_detail_static {
 
 	/** Size of the static resource. */
 	size_t static_data_len;
+
+	/** Precompressed variants of the static resource, or NULL. When
+	 *  @kconfig{CONFIG_HTTP_SERVER_COMPRESSION} is enabled, the variant
+	 *  best matching the client's Accept-Encoding header is served in
+	 *  place of @ref static_data, in the same order of preference as for
+	 *  the filesystem resources.
+	 */
+	const struct http_resource_static_variant *variants;
+
+	/** Number of entries in @ref variants. */
+	size_t num_variants;
+
+	/** Entity tag of the static resource, without the quotes, or NULL.
+	 *  When @kconfig{CONFIG_HTTP_SERVER_ETAG} is enabled, it is sent in
+	 *  the ETag response header, and requests with a matching If-None-Match
+	 *  header are answered with 304 Not Modified. The tag of a variant has
+	 *  the name of its encoding appended, e.g. "1a2b3c-gzip".
+	 */
+	const char *etag;
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -148,6 +168,20 @@ enum http_compression {
 	HTTP_ZSTD = 5      /**< ZSTD */
 };
 
+/**
+ * @brief Precompressed variant of a static server resource.
+ */
+struct http_resource_static_variant {
+	/** Compression the variant is encoded with. */
+	enum http_compression compression;
+
+	/** Content of the variant. */
+	const void *static_data;
+
+	/** Size of the variant. */
+	size_t static_data_len;
+};
+
 /** @cond INTERNAL_HIDDEN */
 /* Make sure that the common is the first in the struct. */
 BUILD_ASSERT(offsetof(struct http_resource_detail_static_fs, common) == 0);
@@ -352,10 +386,20 @@ struct http2_stream_ctx {
 	int stream_id; /**< Stream identifier. */
 	enum http2_stream_state stream_state; /**< Stream state. */
 	int window_size; /**< Stream-level window size. */
+	int tx_window_size; /**< Stream-level send window size. */
 
 	/** Currently processed resource detail. */
 	struct http_resource_detail *current_detail;
 
+	/** Static content queued for sending on the stream. */
+	const uint8_t *tx_data;
+
+	/** Length of the static content left to send. */
+	size_t tx_len;
+
+	/** Flag indicating that the rest of the stream is queued for sending. */
+	bool tx_pending : 1;
+
 	/** Flag indicating that headers were sent in the reply. */
 	bool headers_sent : 1;
 
@@ -425,6 +469,18 @@ struct http_client_ctx {
 	/** Connection-level window size. */
 	int window_size;
 
+	/** Connection-level send window size. */
+	int tx_window_size;
+
+	/** Initial stream-level send window size, set by the client. */
+	int tx_initial_window_size;
+
+	/** Maximum frame payload size accepted by the client. */
+	uint32_t tx_max_frame_size;
+
+	/** Index of the stream to send queued content from first. */
+	uint8_t tx_next_stream;
+
 	/** Server state for the associated client. */
 	enum http_server_state server_state;
 
@@ -490,6 +546,20 @@ struct http_client_ctx {
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (uint8_t supported_compression));
 /** @endcond */
 
+/** @cond INTERNAL_HIDDEN */
+	/** Entity tags from the If-None-Match request header. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG,
+		   (unsigned char if_none_match[HTTP_SERVER_MAX_HEADER_LEN]));
+/** @endcond */
+
+/** @cond INTERNAL_HIDDEN */
+	/** Whether the client is handed over to a worker thread. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_WORKER_POOL, (atomic_t worker_state));
+
+	/** Result of the request handling done by the worker thread. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_WORKER_POOL, (int worker_ret));
+/** @endcond */
+
 	/** Flag indicating that HTTP2 preface was sent. */
 	bool preface_sent : 1;
 
@@ -511,6 +581,15 @@ struct http_client_ctx {
 	/** Flag indicating accept encoding is being processed. */
 	IF_ENABLED(CONFIG_HTTP_SERVER_COMPRESSION, (bool accept_encoding_next: 1));
 
+	/** Flag indicating if-none-match is being processed. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_ETAG, (bool if_none_match_next: 1));
+
+	/** Flag indicating the connection is to be closed once the worker is done. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_WORKER_POOL, (bool close_requested: 1));
+
+	/** Flag indicating the client is to be released once the worker is done. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_WORKER_POOL, (bool release_requested: 1));
+
 	/** The next frame on the stream is expectd to be a continuation frame. */
 	bool expect_continuation : 1;
 };
@@ -544,6 +623,27 @@ int http_server_start(void);
  */
 int http_server_stop(void);
 
+/** @brief HTTP server worker thread statistics. */
+struct http_server_worker_stats {
+	/** Number of times the received data of a connection was handed over to the worker. */
+	uint32_t dispatched;
+	/** Number of connections currently waiting for the worker. */
+	uint32_t queued;
+	/** Highest number of connections seen waiting for the worker. */
+	uint32_t max_queued;
+};
+
+/** @brief Get the statistics of an HTTP server worker thread.
+ *
+ * Only available with @kconfig{CONFIG_HTTP_SERVER_WORKER_POOL}.
+ *
+ * @param worker Index of the worker thread.
+ * @param stats Statistics of the worker.
+ *
+ * @return 0 on success, -EINVAL if there is no such worker.
+ */
+int http_server_worker_stats_get(int worker, struct http_server_worker_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -889,6 +889,25 @@ struct mqtt_internal {
 	/** Internal. MQTT 5.0 disconnect reason set in case of processing errors. */
 	enum mqtt_disconnect_reason_code disconnect_reason;
 #endif /* CONFIG_MQTT_VERSION_5_0 */
+
+#if defined(CONFIG_MQTT_PUBLISH_BATCH) || defined(__DOXYGEN__)
+	/** Internal. Headers and payloads of the queued PUBLISH messages. */
+	struct iovec batch[2 * CONFIG_MQTT_PUBLISH_BATCH_MAX_MSGS];
+
+	/** Internal. Encoded headers of the queued PUBLISH messages. */
+	uint8_t batch_buf[CONFIG_MQTT_PUBLISH_BATCH_BUF_SIZE];
+
+	/** Internal. Length of the headers in batch_buf. */
+	uint16_t batch_buf_len;
+
+	/** Internal. Number of entries used in batch. */
+	uint8_t batch_cnt;
+
+	/** Internal. Wall clock value (in milliseconds) when the first
+	 *  message of the batch was queued.
+	 */
+	uint32_t batch_start;
+#endif /* CONFIG_MQTT_PUBLISH_BATCH */
 };
 
 /**
@@ -1086,6 +1105,43 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to queue a message for publishing, to be sent along with other
+ *        messages in a single transport write.
+ *
+ * The header of the message is encoded right away, the payload is not
+ * copied. The queued messages are sent, in order, with the next packet sent
+ * by the client, when @kconfig{CONFIG_MQTT_PUBLISH_BATCH_MAX_MSGS} messages
+ * are queued, when @ref mqtt_flush is called, or by @ref mqtt_live once the
+ * oldest of them was queued
+ * @kconfig{CONFIG_MQTT_PUBLISH_BATCH_FLUSH_TIMEOUT} milliseconds ago.
+ * The queued messages are dropped if the connection is closed.
+ *
+ * Only available with @kconfig{CONFIG_MQTT_PUBLISH_BATCH}.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] param Parameters to be used for the publish message.
+ *                  Shall not be NULL. The payload data shall remain valid
+ *                  until the message is sent.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_queue(struct mqtt_client *client,
+		       const struct mqtt_publish_param *param);
+
+/**
+ * @brief API to send the messages queued with @ref mqtt_publish_queue.
+ *
+ * Only available with @kconfig{CONFIG_MQTT_PUBLISH_BATCH}.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_flush(struct mqtt_client *client);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -1238,6 +1294,9 @@ int mqtt_live(struct mqtt_client *client);
  * @brief Helper function to determine when next keep alive message should be
  *        sent. Can be used for instance as a source for `poll` timeout.
  *
+ * With @kconfig{CONFIG_MQTT_PUBLISH_BATCH}, the time until the queued
+ * messages are due to be sent by @ref mqtt_live is accounted for as well.
+ *
  * @param[in] client Client instance for which the procedure is requested.
  *
  * @return Time in milliseconds until next keep alive message is expected to
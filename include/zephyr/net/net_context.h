@@ -1294,6 +1294,14 @@ int net_context_sendto(struct net_context *context,
  * After the network buffer is sent, a caller-supplied callback is called.
  * Note that the callback might be called after this function has returned.
  *
+ * With the ZSOCK_MSG_ZEROCOPY flag, supported for UDP when
+ * @kconfig{CONFIG_NET_CONTEXT_ZEROCOPY} is enabled, each msg_iov entry points
+ * to a net_buf fragment chain instead of to the data, and its iov_len is the
+ * total length of the chain. The packet references the fragments instead of
+ * copying them, so their data must not change until they are released. The
+ * caller keeps its own reference and may drop it right away; the destroy
+ * callback of the fragment pool then tells when the driver is done with them.
+ *
  * @param context The network context to use.
  * @param msghdr The data to send
  * @param flags Flags for the sending.
@@ -297,6 +297,9 @@ enum net_if_flag {
 	/** Mutex locking on TX data path disabled on the interface. */
 	NET_IF_NO_TX_LOCK,
 
+	/** Coalesce received TCP segments, see CONFIG_NET_TCP_RX_COALESCE. */
+	NET_IF_TCP_RX_COALESCE,
+
 /** @cond INTERNAL_HIDDEN */
 	/* Total number of flags - must be at the end of the enum */
 	NET_IF_NUM_FLAGS
@@ -747,6 +750,20 @@ struct net_if {
 	int tx_pending;
 #endif
 
+#if defined(CONFIG_NET_PKT_IFACE_QUOTA)
+	/** Number of RX packets currently charged to this interface */
+	atomic_t rx_pkts;
+
+	/** Number of TX packets currently charged to this interface */
+	atomic_t tx_pkts;
+
+	/** RX packet quota, 0 selects the Kconfig default */
+	uint16_t rx_pkt_quota;
+
+	/** TX packet quota, 0 selects the Kconfig default */
+	uint16_t tx_pkt_quota;
+#endif
+
 	/** Mutex protecting this network interface instance */
 	struct k_mutex lock;
 
@@ -3027,6 +3044,26 @@ typedef void (*net_if_cb_t)(struct net_if *iface, void *user_data);
  */
 void net_if_foreach(net_if_cb_t cb, void *user_data);
 
+/**
+ * @brief Set the packet quotas of an interface
+ *
+ * @details Limit the number of RX and TX network packets the interface may
+ *          hold at the same time, so that a flooded interface cannot starve
+ *          the others. An allocation over the quota fails immediately
+ *          whatever its timeout. Packets allocated from a net_context slab
+ *          are not charged to the interface.
+ *
+ * @param iface Pointer to network interface
+ * @param rx_quota Maximum number of RX packets, 0 selects the default of
+ *        CONFIG_NET_PKT_IFACE_QUOTA_PERCENT of CONFIG_NET_PKT_RX_COUNT
+ * @param tx_quota Maximum number of TX packets, 0 selects the default of
+ *        CONFIG_NET_PKT_IFACE_QUOTA_PERCENT of CONFIG_NET_PKT_TX_COUNT
+ *
+ * @return 0 on success, -EINVAL if a quota is larger than the packet count,
+ *         -ENOTSUP if CONFIG_NET_PKT_IFACE_QUOTA is not enabled.
+ */
+int net_if_pkt_quota_set(struct net_if *iface, uint16_t rx_quota, uint16_t tx_quota);
+
 /**
  * @brief Bring interface up
  *
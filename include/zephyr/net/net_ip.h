@@ -264,6 +264,12 @@ struct msghdr {
 	int           msg_flags;      /**< Flags on received message */
 };
 
+/** Message struct for sending or receiving several messages in one call */
+struct mmsghdr {
+	struct msghdr msg_hdr; /**< Message */
+	unsigned int  msg_len; /**< Number of bytes sent or received */
+};
+
 /** Control message ancillary data */
 struct cmsghdr {
 	socklen_t cmsg_len;    /**< Number of bytes, including header */
@@ -2112,6 +2118,54 @@ static inline int net_ipv6_pe_del_filter(struct in6_addr *addr)
 }
 #endif /* CONFIG_NET_IPV6_PE */
 
+/**
+ * @brief Update an Internet checksum after a 16-bit field changed.
+ *
+ * @details Incremental update of RFC 1624, HC' = ~(~HC + ~m + m'), so that
+ *          NAT and forwarding code rewriting a header does not need to sum
+ *          the whole packet again. All values are in the same byte order,
+ *          usually as found in the packet.
+ *
+ * @note A UDP checksum that becomes 0 must be sent as 0xffff.
+ *
+ * @param chksum Checksum covering the old value
+ * @param old_val Old value of the field
+ * @param new_val New value of the field
+ *
+ * @return Checksum covering the new value
+ */
+static inline uint16_t net_chksum_update_16(uint16_t chksum, uint16_t old_val,
+					    uint16_t new_val)
+{
+	uint32_t sum = (uint16_t)~chksum + (uint16_t)~old_val + (uint32_t)new_val;
+
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	return (uint16_t)~sum;
+}
+
+/**
+ * @brief Update an Internet checksum after a 32-bit field changed.
+ *
+ * @details Same as net_chksum_update_16() for a field such as an IPv4
+ *          address, or one word of an IPv6 address.
+ *
+ * @param chksum Checksum covering the old value
+ * @param old_val Old value of the field
+ * @param new_val New value of the field
+ *
+ * @return Checksum covering the new value
+ */
+static inline uint16_t net_chksum_update_32(uint16_t chksum, uint32_t old_val,
+					    uint32_t new_val)
+{
+	chksum = net_chksum_update_16(chksum, (uint16_t)(old_val >> 16),
+				      (uint16_t)(new_val >> 16));
+
+	return net_chksum_update_16(chksum, (uint16_t)old_val, (uint16_t)new_val);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -123,6 +123,10 @@ struct net_pkt {
 	struct net_if *orig_iface; /* Original network interface */
 #endif
 
+#if defined(CONFIG_NET_PKT_IFACE_QUOTA)
+	struct net_if *quota_iface; /* Interface the packet is charged to */
+#endif
+
 #if defined(CONFIG_NET_VPN)
 	struct {
 		/** Original network interface */
@@ -237,9 +241,19 @@ struct net_pkt {
 	uint8_t chksum_done : 1; /* Checksum has already been computed for
 				  * the packet.
 				  */
+	uint8_t rx_chksum_verified : 1; /* The IP header and transport
+					 * checksums of the received packet
+					 * were verified by the hardware.
+					 */
 #if defined(CONFIG_NET_IP_FRAGMENT)
 	uint8_t ip_reassembled : 1; /* Packet is a reassembled IP packet. */
 #endif
+#if defined(CONFIG_NET_TCP_RX_COALESCE)
+	uint8_t tcp_coalesced : 1; /* Packet holds several received TCP
+				    * segments whose checksums have been
+				    * verified.
+				    */
+#endif
 #if defined(CONFIG_NET_PKT_TIMESTAMP)
 	uint8_t tx_timestamping : 1; /** Timestamp transmitted packet */
 	uint8_t rx_timestamping : 1; /** Timestamp received packet */
@@ -316,6 +330,13 @@ struct net_pkt {
 	uint16_t vlan_tci;
 #endif /* CONFIG_NET_VLAN */
 
+#if defined(CONFIG_NET_TCP_TSO)
+	/* Segment size the driver shall split the TCP payload of this
+	 * packet into, 0 if the packet is sent as is.
+	 */
+	uint16_t tso_mss;
+#endif /* CONFIG_NET_TCP_TSO */
+
 #if defined(NET_PKT_HAS_CONTROL_BLOCK)
 	/* TODO: Evolve this into a union of orthogonal
 	 *       control block declarations if further L2
@@ -575,6 +596,20 @@ static inline void net_pkt_set_chksum_done(struct net_pkt *pkt,
 	pkt->chksum_done = is_chksum_done;
 }
 
+static inline bool net_pkt_is_rx_chksum_verified(struct net_pkt *pkt)
+{
+	return !!(pkt->rx_chksum_verified);
+}
+
+/* Drivers whose hardware reports a checksum status per received frame
+ * set this so that the stack does not verify the checksums again.
+ */
+static inline void net_pkt_set_rx_chksum_verified(struct net_pkt *pkt,
+						  bool is_verified)
+{
+	pkt->rx_chksum_verified = is_verified;
+}
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
@@ -1047,6 +1082,33 @@ static inline void net_pkt_set_ip_reassembled(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IP_FRAGMENT */
 
+#if defined(CONFIG_NET_TCP_RX_COALESCE)
+static inline bool net_pkt_is_tcp_coalesced(struct net_pkt *pkt)
+{
+	return !!(pkt->tcp_coalesced);
+}
+
+static inline void net_pkt_set_tcp_coalesced(struct net_pkt *pkt,
+					     bool coalesced)
+{
+	pkt->tcp_coalesced = coalesced;
+}
+#else /* CONFIG_NET_TCP_RX_COALESCE */
+static inline bool net_pkt_is_tcp_coalesced(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_tcp_coalesced(struct net_pkt *pkt,
+					     bool coalesced)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(coalesced);
+}
+#endif /* CONFIG_NET_TCP_RX_COALESCE */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
@@ -1172,6 +1234,39 @@ static inline void net_pkt_set_vlan_tci(struct net_pkt *pkt, uint16_t tci)
 }
 #endif
 
+#if defined(CONFIG_NET_TCP_TSO)
+/**
+ * @brief Get the TCP segmentation offload segment size.
+ *
+ * @param pkt Network packet
+ *
+ * @return Size the driver must split the TCP payload into, or 0 if the
+ *         packet is to be sent as is.
+ */
+static inline uint16_t net_pkt_tso_mss(struct net_pkt *pkt)
+{
+	return pkt->tso_mss;
+}
+
+static inline void net_pkt_set_tso_mss(struct net_pkt *pkt, uint16_t mss)
+{
+	pkt->tso_mss = mss;
+}
+#else
+static inline uint16_t net_pkt_tso_mss(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0U;
+}
+
+static inline void net_pkt_set_tso_mss(struct net_pkt *pkt, uint16_t mss)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(mss);
+}
+#endif /* CONFIG_NET_TCP_TSO */
+
 #if defined(CONFIG_NET_PKT_TIMESTAMP) || defined(CONFIG_NET_PKT_TXTIME)
 static inline struct net_ptp_time *net_pkt_timestamp(struct net_pkt *pkt)
 {
@@ -400,6 +400,27 @@ struct net_stats_pkt_filter {
 	} tx;
 };
 
+/**
+ * @brief Network packet quota statistics
+ */
+struct net_stats_pkt_quota {
+	/** RX packet allocations refused */
+	struct {
+		/** Refused because the interface was over its quota */
+		net_stats_t drop;
+		/** Refused early because the pool was nearly exhausted */
+		net_stats_t early_drop;
+	} rx;
+
+	/** TX packet allocations refused */
+	struct {
+		/** Refused because the interface was over its quota */
+		net_stats_t drop;
+		/** Refused early because the pool was nearly exhausted */
+		net_stats_t early_drop;
+	} tx;
+};
+
 /**
  * @brief All network statistics in one struct.
  */
@@ -420,6 +441,11 @@ struct net_stats {
 	struct net_stats_pkt_filter pkt_filter;
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_PKT_QUOTA)
+	/** Network packet quota statistics */
+	struct net_stats_pkt_quota pkt_quota;
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_IPV6)
 	/** IPv6 statistics */
 	struct net_stats_ip ipv6;
@@ -66,6 +66,10 @@ struct prometheus_metric {
 	int num_labels;
 	/** User defined data */
 	void *user_data;
+	/** Optional hook bringing the metric data up to date before it is
+	 * formatted, used by the metrics that are aggregated at scrape time.
+	 */
+	void (*aggregate)(struct prometheus_metric *metric);
 	/* Add any other necessary fields */
 };
 
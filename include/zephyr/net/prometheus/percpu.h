@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROMETHEUS_PERCPU_H_
+#define ZEPHYR_INCLUDE_PROMETHEUS_PERCPU_H_
+
+/**
+ * @file
+ *
+ * @brief Prometheus per-CPU counter and histogram APIs.
+ *
+ * The per-CPU metrics are updated in a slot of the running CPU, with the
+ * local interrupts masked but without atomic operations or a lock shared
+ * between CPUs. The slots are summed up into a regular counter or histogram
+ * when the metric is scraped, so these metrics are registered to and
+ * formatted by a collector like any other.
+ *
+ * A slot is a native word and is only compared with its value at the
+ * previous scrape, it may wrap around as long as it advances by less than
+ * ULONG_MAX between two scrapes.
+ *
+ * @addtogroup prometheus
+ * @{
+ */
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/net/prometheus/counter.h>
+#include <zephyr/net/prometheus/histogram.h>
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Slots of different CPUs never share a cache line */
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define Z_PROMETHEUS_PERCPU_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define Z_PROMETHEUS_PERCPU_ALIGN sizeof(unsigned long)
+#endif
+
+/* Words of a histogram slot: the bucket counts, then the count and the sum */
+#define Z_PROMETHEUS_PERCPU_HISTOGRAM_WORDS(_num_buckets) ((_num_buckets) + 2)
+
+#define Z_PROMETHEUS_PERCPU_HISTOGRAM_STRIDE(_num_buckets)			\
+	ROUND_UP(Z_PROMETHEUS_PERCPU_HISTOGRAM_WORDS(_num_buckets),		\
+		 Z_PROMETHEUS_PERCPU_ALIGN / sizeof(unsigned long))
+
+struct z_prometheus_percpu_slot {
+	unsigned long value;
+	unsigned long folded;
+} __aligned(Z_PROMETHEUS_PERCPU_ALIGN);
+
+void z_prometheus_percpu_counter_aggregate(struct prometheus_metric *metric);
+void z_prometheus_percpu_histogram_aggregate(struct prometheus_metric *metric);
+
+static inline unsigned int z_prometheus_percpu_id(void)
+{
+#if defined(CONFIG_SMP)
+	return arch_curr_cpu()->id;
+#else
+	return 0;
+#endif
+}
+
+/** @endcond */
+
+/**
+ * @brief Type used to represent a Prometheus per-CPU counter metric.
+ */
+struct prometheus_percpu_counter {
+	/** Counter holding the total at the last scrape */
+	struct prometheus_counter counter;
+	/** Per-CPU slots, each only written by its own CPU */
+	struct z_prometheus_percpu_slot *slots;
+};
+
+/**
+ * @brief Prometheus per-CPU Counter definition.
+ *
+ * This macro defines a per-CPU Counter metric. Register the embedded counter
+ * base with a collector to have it scraped.
+ *
+ * @param _name The counter metric name
+ * @param _desc Counter description
+ * @param _label Label for the metric. Additional labels can be added at runtime.
+ * @param _collector Collector to map this metric. Can be set to NULL if it not yet known.
+ * @param ... Optional user data specific to this metric instance.
+ *
+ * Example usage:
+ * @code{.c}
+ *
+ * PROMETHEUS_PERCPU_COUNTER_DEFINE(rx_packets, "Received packets",
+ *                                  ({ .key = "iface", .value = "eth0" }), NULL);
+ *
+ * prometheus_collector_register_metric(&collector, &rx_packets.counter.base);
+ * @endcode
+ */
+#define PROMETHEUS_PERCPU_COUNTER_DEFINE(_name, _desc, _label, _collector, ...) \
+	static struct z_prometheus_percpu_slot				\
+		_CONCAT(_name, _slots)[CONFIG_MP_MAX_NUM_CPUS];		\
+	STRUCT_SECTION_ITERABLE(prometheus_percpu_counter, _name) = {	\
+		.counter.base.name = STRINGIFY(_name),			\
+		.counter.base.type = PROMETHEUS_COUNTER,		\
+		.counter.base.description = _desc,			\
+		.counter.base.labels[0] = __DEBRACKET _label,		\
+		.counter.base.num_labels = 1,				\
+		.counter.base.collector = _collector,			\
+		.counter.base.aggregate = z_prometheus_percpu_counter_aggregate, \
+		.counter.value = 0ULL,					\
+		.counter.user_data = COND_CODE_0(			\
+			NUM_VA_ARGS_LESS_1(LIST_DROP_EMPTY(__VA_ARGS__, _)), \
+			(NULL),						\
+			(GET_ARG_N(1, __VA_ARGS__))),			\
+		.slots = _CONCAT(_name, _slots),			\
+	}
+
+/**
+ * @brief Increment a Prometheus per-CPU counter metric
+ *
+ * Adds to the slot of the running CPU. Safe to call from an ISR, but not
+ * from user mode.
+ *
+ * @param counter Pointer to the per-CPU counter metric to increment.
+ * @param value Amount to increment the counter by.
+ */
+static inline void prometheus_percpu_counter_add(struct prometheus_percpu_counter *counter,
+						 unsigned long value)
+{
+	unsigned int key = arch_irq_lock();
+
+	counter->slots[z_prometheus_percpu_id()].value += value;
+
+	arch_irq_unlock(key);
+}
+
+/**
+ * @brief Increment a Prometheus per-CPU counter metric by one
+ *
+ * @param counter Pointer to the per-CPU counter metric to increment.
+ */
+static inline void prometheus_percpu_counter_inc(struct prometheus_percpu_counter *counter)
+{
+	prometheus_percpu_counter_add(counter, 1UL);
+}
+
+/**
+ * @brief Type used to represent a Prometheus per-CPU histogram metric.
+ *
+ * Observations are integers, in whatever unit suits the metric, and the
+ * bucket counts are made cumulative when the histogram is scraped.
+ */
+struct prometheus_percpu_histogram {
+	/** Histogram holding the totals at the last scrape */
+	struct prometheus_histogram histogram;
+	/** Upper bounds of the buckets, in ascending order */
+	const uint32_t *bounds;
+	/** Per-CPU slots, each only written by its own CPU */
+	unsigned long *slots;
+	/** Slot values at the last scrape */
+	unsigned long *folded;
+	/** Distance between the slots of two CPUs, in words */
+	size_t stride;
+};
+
+/**
+ * @brief Prometheus per-CPU Histogram definition.
+ *
+ * This macro defines a per-CPU Histogram metric with one bucket for each
+ * upper bound. Register the embedded histogram base with a collector to have
+ * it scraped.
+ *
+ * @param _name The histogram metric name.
+ * @param _desc Histogram description
+ * @param _label Label for the metric. Additional labels can be added at runtime.
+ * @param _collector Collector to map this metric. Can be set to NULL if it not yet known.
+ * @param _bounds Array of uint32_t bucket upper bounds, in ascending order.
+ * @param ... Optional user data specific to this metric instance.
+ *
+ * Example usage:
+ * @code{.c}
+ *
+ * static const uint32_t latency_bounds[] = { 10, 100, 1000 };
+ *
+ * PROMETHEUS_PERCPU_HISTOGRAM_DEFINE(rx_latency_us, "Receive latency",
+ *                                    ({ .key = "iface", .value = "eth0" }), NULL,
+ *                                    latency_bounds);
+ * @endcode
+ */
+#define PROMETHEUS_PERCPU_HISTOGRAM_DEFINE(_name, _desc, _label, _collector, _bounds, ...) \
+	static unsigned long _CONCAT(_name, _slots)[CONFIG_MP_MAX_NUM_CPUS]	\
+		[Z_PROMETHEUS_PERCPU_HISTOGRAM_STRIDE(ARRAY_SIZE(_bounds))]	\
+		__aligned(Z_PROMETHEUS_PERCPU_ALIGN);				\
+	static unsigned long _CONCAT(_name, _folded)[CONFIG_MP_MAX_NUM_CPUS]	\
+		[Z_PROMETHEUS_PERCPU_HISTOGRAM_WORDS(ARRAY_SIZE(_bounds))];	\
+	static struct prometheus_histogram_bucket				\
+		_CONCAT(_name, _buckets)[ARRAY_SIZE(_bounds)];			\
+	STRUCT_SECTION_ITERABLE(prometheus_percpu_histogram, _name) = {	\
+		.histogram.base.name = STRINGIFY(_name),			\
+		.histogram.base.type = PROMETHEUS_HISTOGRAM,			\
+		.histogram.base.description = _desc,				\
+		.histogram.base.labels[0] = __DEBRACKET _label,		\
+		.histogram.base.num_labels = 1,				\
+		.histogram.base.collector = _collector,			\
+		.histogram.base.aggregate = z_prometheus_percpu_histogram_aggregate, \
+		.histogram.buckets = _CONCAT(_name, _buckets),			\
+		.histogram.num_buckets = ARRAY_SIZE(_bounds),			\
+		.histogram.sum = 0.0,						\
+		.histogram.count = 0U,						\
+		.histogram.user_data = COND_CODE_0(				\
+			NUM_VA_ARGS_LESS_1(LIST_DROP_EMPTY(__VA_ARGS__, _)),	\
+			(NULL),							\
+			(GET_ARG_N(1, __VA_ARGS__))),				\
+		.bounds = _bounds,						\
+		.slots = &_CONCAT(_name, _slots)[0][0],			\
+		.folded = &_CONCAT(_name, _folded)[0][0],			\
+		.stride = Z_PROMETHEUS_PERCPU_HISTOGRAM_STRIDE(ARRAY_SIZE(_bounds)), \
+	}
+
+/**
+ * @brief Observe a value in a Prometheus per-CPU histogram metric
+ *
+ * Counts the value in the slot of the running CPU. Safe to call from an ISR,
+ * but not from user mode.
+ *
+ * @param histogram Pointer to the per-CPU histogram metric to observe.
+ * @param value Value to observe in the histogram metric.
+ */
+void prometheus_percpu_histogram_observe(struct prometheus_percpu_histogram *histogram,
+					 uint32_t value);
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_PROMETHEUS_PERCPU_H_ */
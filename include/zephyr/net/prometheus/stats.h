@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROMETHEUS_STATS_H_
+#define ZEPHYR_INCLUDE_PROMETHEUS_STATS_H_
+
+/**
+ * @file
+ *
+ * @brief Prometheus export of the stats subsystem.
+ *
+ * A statistics entry is exported as a counter, which is read from its group
+ * when the collector is scraped, so the statistics are not touched on the
+ * path where they are updated.
+ *
+ * @addtogroup prometheus
+ * @{
+ */
+
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/net/prometheus/counter.h>
+
+/**
+ * @brief Statistics entry exported by a Prometheus counter.
+ */
+struct prometheus_stats_entry {
+	/** Name the statistics group is registered with */
+	const char *group;
+	/** Name of the entry in the group, "s<index>" without CONFIG_STATS_NAMES */
+	const char *name;
+};
+
+/**
+ * @brief Prometheus Counter exporting a statistics entry.
+ *
+ * This macro defines a Counter metric holding the value of an entry of a
+ * statistics group. The collector it is registered with must use
+ * prometheus_stats_scrape() as its callback.
+ *
+ * @param _name The counter metric name
+ * @param _desc Counter description
+ * @param _label Label for the metric. Additional labels can be added at runtime.
+ * @param _collector Collector to map this metric. Can be set to NULL if it not yet known.
+ * @param _group Name the statistics group is registered with.
+ * @param _entry Name of the entry in the group.
+ *
+ * Example usage:
+ * @code{.c}
+ *
+ * PROMETHEUS_COLLECTOR_DEFINE(stats_collector, prometheus_stats_scrape);
+ *
+ * PROMETHEUS_STATS_COUNTER_DEFINE(bt_iso_rx_dropped, "Dropped ISO packets",
+ *                                 ({ .key = "bt", .value = "iso" }), &stats_collector,
+ *                                 "bt_iso", "rx_dropped");
+ * @endcode
+ */
+#define PROMETHEUS_STATS_COUNTER_DEFINE(_name, _desc, _label, _collector, _group, _entry) \
+	static struct prometheus_stats_entry _CONCAT(_name, _stats_entry) = {	\
+		.group = _group,						\
+		.name = _entry,							\
+	};									\
+	PROMETHEUS_COUNTER_DEFINE(_name, _desc, _label, _collector,		\
+				  &_CONCAT(_name, _stats_entry))
+
+/**
+ * @brief Collector callback reading the statistics entries.
+ *
+ * Updates a counter defined with PROMETHEUS_STATS_COUNTER_DEFINE() from its
+ * statistics entry. Metrics without user data, such as the per-CPU metrics,
+ * are left alone so they can be registered with the same collector.
+ *
+ * @param collector Collector being scraped.
+ * @param metric Metric being scraped.
+ * @param user_data Unused.
+ *
+ * @return 0 if successful, -EAGAIN if the entry is not registered (yet),
+ *         otherwise a negative error code.
+ */
+int prometheus_stats_scrape(struct prometheus_collector *collector,
+			    struct prometheus_metric *metric, void *user_data);
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_PROMETHEUS_STATS_H_ */
@@ -77,6 +77,12 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Only block until the first message has been received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
+/** zsock_sendmsg: msg_iov entries point to net_buf fragment chains whose data is
+ *  sent without copying, see net_context_sendmsg()
+ */
+#define ZSOCK_MSG_ZEROCOPY 0x4000000
 /** @} */
 
 /**
@@ -260,6 +266,17 @@ extern "C" {
  *  Kconfig option is enabled.
  */
 #define TLS_CERT_VERIFY_CALLBACK 20
+/** Socket option to coalesce small writes into full TLS records, similar to
+ *  TCP_CORK. The option accepts an integer, 1 to enable and 0 to disable.
+ *  While enabled, data passed to send() is buffered and only encrypted once
+ *  the buffer is full. Disabling the option sends the buffered data as a
+ *  single record, which makes it the flush operation. Applications must
+ *  disable it before waiting for a response to the buffered data.
+ *
+ *  The option is only available for TLS (stream) sockets, if
+ *  CONFIG_NET_SOCKETS_TLS_CORK_BUF_SIZE is not 0.
+ */
+#define TLS_CORK 21
 
 /* Valid values for @ref TLS_PEER_VERIFY option */
 #define TLS_PEER_VERIFY_NONE 0     /**< Peer verification disabled. */
@@ -537,6 +554,46 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Send several messages to arbitrary network addresses
+ *
+ * @details
+ * Sends the messages of @p msgvec in order, as with zsock_sendmsg(), in a
+ * single call, and stores the number of bytes sent for each of them in its
+ * msg_len field. This is the Linux sendmmsg() call.
+ *
+ * @param sock Socket.
+ * @param msgvec Messages to send.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Flags for each of the messages.
+ *
+ * @return Number of messages sent, which is less than @p vlen if an error
+ *         occurred after the first one, or -1 with errno set if the first
+ *         message could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags);
+
+/**
+ * @brief Receive several messages from arbitrary network addresses
+ *
+ * @details
+ * Receives up to @p vlen messages into @p msgvec, as with zsock_recvmsg(), in
+ * a single call, and stores the number of bytes received for each of them in
+ * its msg_len field. With ZSOCK_MSG_WAITFORONE the call only blocks for the
+ * first message and returns what is queued after it. This is the Linux
+ * recvmmsg() call without the timeout.
+ *
+ * @param sock Socket.
+ * @param msgvec Messages to receive into.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Flags for each of the messages.
+ *
+ * @return Number of messages received, which is less than @p vlen if an error
+ *         occurred after the first one, or -1 with errno set if no message
+ *         could be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from a connected peer
  *
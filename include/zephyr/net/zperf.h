@@ -65,8 +65,12 @@ struct zperf_upload_params {
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		int thread_priority;
 		bool wait_for_start;
+		/* CPUs the upload thread may run on, 0 for any */
+		uint32_t cpu_mask;
 #endif
 		uint32_t report_interval_ms;
+		/* TCP packets passed to a single sendmsg() call, 0 or 1 for send() */
+		uint8_t send_batch;
 	} options;
 };
 
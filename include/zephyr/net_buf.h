@@ -1068,6 +1068,16 @@ struct net_buf_data_alloc {
 	size_t max_alloc_size;
 };
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+struct net_buf_pool_cache {
+	struct k_spinlock lock;
+	uint8_t count;
+	uint32_t hits;
+	uint32_t misses;
+	struct net_buf *bufs[CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE];
+};
+#endif
+
 /** @endcond */
 
 /**
@@ -1113,6 +1123,26 @@ struct net_buf_pool {
 
 	/** Start of buffer storage array */
 	struct net_buf * const __bufs;
+
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+	/** @cond INTERNAL_HIDDEN */
+	/* Free buffers kept by each CPU, in front of the LIFO */
+	struct net_buf_pool_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+
+	/* Threads waiting for the LIFO, which get freed buffers first */
+	atomic_t cache_waiters;
+	/** @endcond */
+#endif
+};
+
+/**
+ * @brief Per-CPU cache statistics of a pool.
+ */
+struct net_buf_pool_cache_stats {
+	/** Allocations served by the cache of the allocating CPU */
+	uint32_t hits;
+	/** Allocations which went to the pool */
+	uint32_t misses;
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1390,6 +1420,39 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate several variable length buffers from a pool.
+ *
+ * Takes up to @a count buffers from the pool under a single acquisition of
+ * its locks, then allocates @a size bytes of data for each of them. If the
+ * pool is empty, waits up to @a timeout for one buffer and then takes
+ * whatever else is available without waiting again.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param bufs Array receiving the buffers.
+ * @param count Number of entries in @a bufs.
+ * @param timeout Waiting period for the first buffer, or one of the special
+ *        values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of buffers stored in @a bufs, 0 if out of buffers.
+ */
+int __must_check net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+				    struct net_buf **bufs, int count,
+				    k_timeout_t timeout);
+
+/**
+ * @brief Get the per-CPU cache statistics of a pool.
+ *
+ * The counts are summed over the CPUs, and stay zero unless
+ * CONFIG_NET_BUF_POOL_CPU_CACHE is enabled.
+ *
+ * @param pool Pool to get the statistics of.
+ * @param stats Statistics output.
+ */
+void net_buf_pool_cache_stats_get(struct net_buf_pool *pool,
+				  struct net_buf_pool_cache_stats *stats);
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1423,6 +1486,10 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+void z_net_buf_pool_put(struct net_buf_pool *pool, struct net_buf *buf);
+/** @endcond */
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1443,7 +1510,11 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+	z_net_buf_pool_put(pool, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif
 }
 
 /**
@@ -1497,6 +1568,17 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line);
 void net_buf_unref(struct net_buf *buf);
 #endif
 
+/**
+ * @brief Decrements the reference count of a list of buffers.
+ *
+ * Empties @a list, as net_buf_unref() on each of its buffers, but returns
+ * the buffers of pools without a custom destroy callback to their pool a
+ * batch at a time rather than one by one.
+ *
+ * @param list List of buffers, as built by net_buf_slist_put().
+ */
+void net_buf_unref_list(sys_slist_t *list);
+
 /**
  * @brief Increment the reference count of a buffer.
  *
@@ -130,6 +130,22 @@ typedef int (*pm_device_action_cb_t)(const struct device *dev,
 typedef bool (*pm_device_action_failed_cb_t)(const struct device *dev,
 					 int err);
 
+/** @brief Device runtime PM transition statistics */
+struct pm_device_runtime_stats {
+	/** Number of completed resume operations */
+	uint32_t resume_count;
+	/** Duration of the last resume operation in microseconds */
+	uint32_t resume_last_us;
+	/** Duration of the longest resume operation in microseconds */
+	uint32_t resume_max_us;
+	/** Number of completed suspend operations */
+	uint32_t suspend_count;
+	/** Duration of the last suspend operation in microseconds */
+	uint32_t suspend_last_us;
+	/** Duration of the longest suspend operation in microseconds */
+	uint32_t suspend_max_us;
+};
+
 /**
  * @brief Device PM info
  *
@@ -147,6 +163,10 @@ struct pm_device_base {
 	/** Device usage count */
 	uint32_t usage;
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
+#if defined(CONFIG_PM_DEVICE_RUNTIME_STATS) || defined(__DOXYGEN__)
+	/** Suspend and resume statistics */
+	struct pm_device_runtime_stats stats;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 	/** Power Domain it belongs */
 	const struct device *domain;
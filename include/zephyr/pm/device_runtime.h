@@ -10,6 +10,7 @@
 
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
+#include <zephyr/pm/device.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,6 +23,34 @@ extern "C" {
  * @{
  */
 
+struct pm_device_runtime_batch;
+
+/**
+ * @brief Callback invoked when an asynchronous batched resume completes.
+ *
+ * @param batch Batch that completed.
+ * @param result 0 if all devices were resumed, or the error returned by the
+ * first device that failed to resume.
+ */
+typedef void (*pm_device_runtime_batch_cb_t)(struct pm_device_runtime_batch *batch, int result);
+
+/**
+ * @brief Asynchronous batched resume request.
+ *
+ * The fields are private, the structure must remain valid until the callback
+ * has been invoked.
+ *
+ * @see pm_device_runtime_get_async()
+ */
+struct pm_device_runtime_batch {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	const struct device *const *devs;
+	size_t count;
+	pm_device_runtime_batch_cb_t cb;
+	/** @endcond */
+};
+
 #if defined(CONFIG_PM_DEVICE_RUNTIME) || defined(__DOXYGEN__)
 /**
  * @brief Automatically enable device runtime based on devicetree properties
@@ -96,6 +125,39 @@ int pm_device_runtime_disable(const struct device *dev);
  */
 int pm_device_runtime_get(const struct device *dev);
 
+/**
+ * @brief Resume a set of devices based on usage count (asynchronously).
+ *
+ * This function calls pm_device_runtime_get() on each device from the device
+ * runtime work queue, in the given order, then invokes @p cb. The power domain
+ * of a device is resumed before the device itself, so the devices of the same
+ * domain share a single domain resume. The caller is not blocked by the
+ * resume operations of the devices and of their domains.
+ *
+ * If a device fails to resume, the devices of the batch already resumed are
+ * suspended again and the remaining ones are left untouched. On success, each
+ * device must later be released with pm_device_runtime_put() or
+ * pm_device_runtime_put_async().
+ *
+ * @note Asynchronous operations are not supported when in pre-kernel mode. In
+ * this case, the function will be blocking and @p cb is invoked before it
+ * returns.
+ *
+ * @funcprops \pre_kernel_ok, \async, \isr_ok
+ *
+ * @param batch Batch request, must remain valid until @p cb is invoked.
+ * @param devs Devices to resume, must remain valid until @p cb is invoked.
+ * @param count Number of devices in @p devs.
+ * @param cb Callback invoked on completion, may be NULL.
+ *
+ * @retval 0 If the batch has been queued.
+ * @retval -EBUSY If @p batch is still in use.
+ * @retval -ENOSYS If asynchronous device runtime PM is not enabled.
+ */
+int pm_device_runtime_get_async(struct pm_device_runtime_batch *batch,
+				const struct device *const *devs, size_t count,
+				pm_device_runtime_batch_cb_t cb);
+
 /**
  * @brief Suspend a device based on usage count.
  *
@@ -169,6 +231,18 @@ bool pm_device_runtime_is_enabled(const struct device *dev);
  */
 int pm_device_runtime_usage(const struct device *dev);
 
+/**
+ * @brief Get the suspend and resume statistics of a device.
+ *
+ * @param dev Device instance.
+ * @param stats Where to store the statistics.
+ *
+ * @retval 0 If it succeeds.
+ * @retval -ENOTSUP If the device does not support PM.
+ * @retval -ENOSYS If CONFIG_PM_DEVICE_RUNTIME_STATS is not enabled.
+ */
+int pm_device_runtime_stats_get(const struct device *dev, struct pm_device_runtime_stats *stats);
+
 #else
 
 static inline int pm_device_runtime_auto_enable(const struct device *dev)
@@ -215,12 +289,34 @@ static inline bool pm_device_runtime_is_enabled(const struct device *dev)
 	return false;
 }
 
+static inline int pm_device_runtime_get_async(struct pm_device_runtime_batch *batch,
+					      const struct device *const *devs, size_t count,
+					      pm_device_runtime_batch_cb_t cb)
+{
+	ARG_UNUSED(devs);
+	ARG_UNUSED(count);
+
+	if (cb != NULL) {
+		cb(batch, 0);
+	}
+
+	return 0;
+}
+
 static inline int pm_device_runtime_usage(const struct device *dev)
 {
 	ARG_UNUSED(dev);
 	return -ENOSYS;
 }
 
+static inline int pm_device_runtime_stats_get(const struct device *dev,
+					      struct pm_device_runtime_stats *stats)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(stats);
+	return -ENOSYS;
+}
+
 #endif
 
 /** @} */
@@ -71,6 +71,21 @@ struct pm_policy_event {
 	/** @endcond */
 };
 
+/**
+ * @brief Periodic stream.
+ *
+ * Deadline and wake latency tolerance of a periodic data stream, such as
+ * an audio stream fed through a DMA ring.
+ *
+ * @note All fields in this structure are meant for private usage.
+ */
+struct pm_policy_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct pm_policy_event evt;
+	struct pm_policy_latency_request req;
+	/** @endcond */
+};
+
 /** @cond INTERNAL_HIDDEN */
 
 /**
@@ -231,6 +246,43 @@ bool pm_policy_device_is_disabling_state(const struct device *dev,
  */
 int64_t pm_policy_next_event_ticks(void);
 
+/**
+ * @brief Add a periodic stream.
+ *
+ * The stream must be serviced before its deadline, and tolerates at most
+ * @p latency_us of wake-up latency, for instance to serve the interrupt
+ * of its DMA ring. The policy then picks the deepest state which exits
+ * before the deadline and within the tolerated latency, so that buffers
+ * are refilled in time.
+ *
+ * @param stream Stream.
+ * @param deadline_us Time until the next deadline, in microseconds.
+ * @param latency_us Tolerated wake-up latency, in microseconds.
+ *
+ * @see pm_policy_stream_update()
+ * @see pm_policy_stream_remove()
+ */
+void pm_policy_stream_add(struct pm_policy_stream *stream, uint32_t deadline_us,
+			  uint32_t latency_us);
+
+/**
+ * @brief Move the deadline of a periodic stream.
+ *
+ * Typically called each time the stream is serviced, for instance when a
+ * buffer is queued to its DMA ring.
+ *
+ * @param stream Stream.
+ * @param deadline_us Time until the next deadline, in microseconds.
+ */
+void pm_policy_stream_update(struct pm_policy_stream *stream, uint32_t deadline_us);
+
+/**
+ * @brief Remove a periodic stream.
+ *
+ * @param stream Stream.
+ */
+void pm_policy_stream_remove(struct pm_policy_stream *stream);
+
 #else
 static inline void pm_policy_state_lock_get(enum pm_state state, uint8_t substate_id)
 {
@@ -269,6 +321,26 @@ static inline void pm_policy_event_unregister(struct pm_policy_event *evt)
 	ARG_UNUSED(evt);
 }
 
+static inline void pm_policy_stream_add(struct pm_policy_stream *stream, uint32_t deadline_us,
+					uint32_t latency_us)
+{
+	ARG_UNUSED(stream);
+	ARG_UNUSED(deadline_us);
+	ARG_UNUSED(latency_us);
+}
+
+static inline void pm_policy_stream_update(struct pm_policy_stream *stream,
+					   uint32_t deadline_us)
+{
+	ARG_UNUSED(stream);
+	ARG_UNUSED(deadline_us);
+}
+
+static inline void pm_policy_stream_remove(struct pm_policy_stream *stream)
+{
+	ARG_UNUSED(stream);
+}
+
 static inline int64_t pm_policy_next_event_ticks(void)
 {
 	return -1;
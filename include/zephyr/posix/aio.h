@@ -17,6 +17,17 @@
 extern "C" {
 #endif
 
+#define AIO_ALLDONE     0
+#define AIO_CANCELED    1
+#define AIO_NOTCANCELED 2
+
+#define LIO_NOP   0
+#define LIO_READ  1
+#define LIO_WRITE 2
+
+#define LIO_NOWAIT 0
+#define LIO_WAIT   1
+
 struct aiocb {
 	int aio_fildes;
 	off_t aio_offset;
@@ -25,13 +36,17 @@ struct aiocb {
 	int aio_reqprio;
 	struct sigevent aio_sigevent;
 	int aio_lio_opcode;
+
+	/* Private, status of the last request submitted with this control block */
+	int _aio_error;
+	ssize_t _aio_return;
 };
 
 #if _POSIX_C_SOURCE >= 200112L
 
 int aio_cancel(int fildes, struct aiocb *aiocbp);
 int aio_error(const struct aiocb *aiocbp);
-int aio_fsync(int filedes, struct aiocb *aiocbp);
+int aio_fsync(int op, struct aiocb *aiocbp);
 int aio_read(struct aiocb *aiocbp);
 ssize_t aio_return(struct aiocb *aiocbp);
 int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout);
@@ -11,8 +11,10 @@
 
 #define O_APPEND   ZVFS_O_APPEND
 #define O_CREAT    ZVFS_O_CREAT
+#define O_DSYNC    ZVFS_O_DSYNC
 #define O_EXCL     ZVFS_O_EXCL
 #define O_NONBLOCK ZVFS_O_NONBLOCK
+#define O_SYNC     ZVFS_O_SYNC
 #define O_TRUNC    ZVFS_O_TRUNC
 
 #define O_ACCMODE (ZVFS_O_RDONLY | ZVFS_O_RDWR | ZVFS_O_WRONLY)
@@ -512,6 +512,31 @@ int pthread_setname_np(pthread_t thread, const char *name);
  */
 int pthread_getname_np(pthread_t thread, char *name, size_t len);
 
+/**
+ * @brief Set whether the stack of threads created with attr is paged in before they start.
+ *
+ * Non-portable, extension function. The hint only has an effect with demand paging, when the
+ * thread is created from a supervisor thread.
+ *
+ * @param attr Thread attributes object
+ * @param prefault Non-zero to page in the stack
+ * @retval 0 Success
+ * @retval EINVAL @p attr is not initialized
+ */
+int pthread_attr_setstackprefault_np(pthread_attr_t *attr, int prefault);
+
+/**
+ * @brief Get whether the stack of threads created with attr is paged in before they start.
+ *
+ * Non-portable, extension function.
+ *
+ * @param attr Thread attributes object
+ * @param prefault Destination of the hint
+ * @retval 0 Success
+ * @retval EINVAL @p attr is not initialized or @p prefault is NULL
+ */
+int pthread_attr_getstackprefault_np(const pthread_attr_t *attr, int *prefault);
+
 #ifdef CONFIG_POSIX_THREADS
 
 /**
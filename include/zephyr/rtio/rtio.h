@@ -433,6 +433,19 @@ struct rtio {
 	struct k_sem *consume_sem;
 #endif
 
+#ifdef CONFIG_RTIO_CONSUME_WATERMARK
+	/* A wait semaphore given once the number of completions ready to be
+	 * consumed reaches the watermark
+	 */
+	struct k_sem *watermark_sem;
+
+	/* Number of completions in the completion queue */
+	atomic_t cq_ready;
+
+	/* Number of completions rtio_cqe_consume_batch waits for */
+	uint16_t cq_watermark;
+#endif
+
 	/* Total number of completions */
 	atomic_t cq_count;
 
@@ -937,10 +950,16 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 		   (static K_SEM_DEFINE(CONCAT(_submit_sem_, name), 0, K_SEM_MAX_LIMIT)))          \
 	IF_ENABLED(CONFIG_RTIO_CONSUME_SEM,                                                        \
 		   (static K_SEM_DEFINE(CONCAT(_consume_sem_, name), 0, K_SEM_MAX_LIMIT)))         \
+	IF_ENABLED(CONFIG_RTIO_CONSUME_WATERMARK,                                                  \
+		   (static K_SEM_DEFINE(CONCAT(_watermark_sem_, name), 0, 1)))                     \
 	STRUCT_SECTION_ITERABLE(rtio, name) = {                                                    \
 		IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM, (.submit_sem = &CONCAT(_submit_sem_, name),))   \
 		IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM, (.submit_count = 0,))                           \
 		IF_ENABLED(CONFIG_RTIO_CONSUME_SEM, (.consume_sem = &CONCAT(_consume_sem_, name),))\
+		IF_ENABLED(CONFIG_RTIO_CONSUME_WATERMARK,                                          \
+			   (.watermark_sem = &CONCAT(_watermark_sem_, name),                       \
+			    .cq_ready = ATOMIC_INIT(0),                                            \
+			    .cq_watermark = 1,))                                                   \
 		.cq_count = ATOMIC_INIT(0),                                                        \
 		.xcqcnt = ATOMIC_INIT(0),                                                          \
 		.sqe_pool = _sqe_pool,                                                             \
@@ -1133,6 +1152,10 @@ static inline struct rtio_cqe *rtio_cqe_consume(struct rtio *r)
 	}
 	cqe = CONTAINER_OF(node, struct rtio_cqe, q);
 
+#ifdef CONFIG_RTIO_CONSUME_WATERMARK
+	atomic_dec(&r->cq_ready);
+#endif
+
 	return cqe;
 }
 
@@ -1161,9 +1184,73 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 	}
 	cqe = CONTAINER_OF(node, struct rtio_cqe, q);
 
+#ifdef CONFIG_RTIO_CONSUME_WATERMARK
+	atomic_dec(&r->cq_ready);
+#endif
+
 	return cqe;
 }
 
+#if defined(CONFIG_RTIO_CONSUME_WATERMARK) || defined(__DOXYGEN__)
+/**
+ * @brief Set the number of completions rtio_cqe_consume_batch() waits for
+ *
+ * @param r RTIO context
+ * @param watermark Number of completions, at least 1
+ */
+static inline void rtio_cqe_watermark_set(struct rtio *r, uint16_t watermark)
+{
+	r->cq_watermark = MAX(watermark, 1);
+}
+
+/**
+ * @brief Wait for a batch of completion queue events and consume them
+ *
+ * Sleeps until the number of completion queue events ready reaches the watermark set with
+ * rtio_cqe_watermark_set(), or until the timeout expires, then consumes up to @p max of them.
+ * Producers wake the waiting thread once per batch rather than once per completion.
+ *
+ * Each completion queue event returned must be released with rtio_cqe_release().
+ *
+ * @param r RTIO context
+ * @param cqes Array receiving the completion queue events
+ * @param max Size of @p cqes
+ * @param timeout Time to wait for the watermark to be reached
+ *
+ * @return Number of completion queue events consumed, which may be fewer than the watermark if the
+ *	   timeout expired
+ */
+static inline int rtio_cqe_consume_batch(struct rtio *r, struct rtio_cqe **cqes, size_t max,
+					 k_timeout_t timeout)
+{
+	struct mpsc_node *node;
+	size_t count = 0;
+
+	/* Drop a wakeup left over from a batch already consumed */
+	(void)k_sem_take(r->watermark_sem, K_NO_WAIT);
+
+	if (atomic_get(&r->cq_ready) < r->cq_watermark) {
+		(void)k_sem_take(r->watermark_sem, timeout);
+	}
+
+	while (count < max) {
+#ifdef CONFIG_RTIO_CONSUME_SEM
+		if (k_sem_take(r->consume_sem, K_NO_WAIT) != 0) {
+			break;
+		}
+#endif
+		node = mpsc_pop(&r->cq);
+		if (node == NULL) {
+			break;
+		}
+		atomic_dec(&r->cq_ready);
+		cqes[count++] = CONTAINER_OF(node, struct rtio_cqe, q);
+	}
+
+	return count;
+}
+#endif /* CONFIG_RTIO_CONSUME_WATERMARK */
+
 /**
  * @brief Release consumed completion queue event
  *
@@ -1309,6 +1396,12 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		cqe->userdata = userdata;
 		cqe->flags = flags;
 		rtio_cqe_produce(r, cqe);
+
+#ifdef CONFIG_RTIO_CONSUME_WATERMARK
+		if (atomic_inc(&r->cq_ready) + 1 == r->cq_watermark) {
+			k_sem_give(r->watermark_sem);
+		}
+#endif
 	}
 
 	/* atomic_t isn't guaranteed to wrap correctly as it could be signed, so
@@ -1433,6 +1526,10 @@ static inline void rtio_access_grant(struct rtio *r, struct k_thread *t)
 #ifdef CONFIG_RTIO_CONSUME_SEM
 	k_object_access_grant(r->consume_sem, t);
 #endif
+
+#ifdef CONFIG_RTIO_CONSUME_WATERMARK
+	k_object_access_grant(r->watermark_sem, t);
+#endif
 }
 
 /**
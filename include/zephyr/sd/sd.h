@@ -88,6 +88,12 @@ struct sd_card {
 	 */
 	uint8_t card_buffer[CONFIG_SD_BUFFER_SIZE]
 		__aligned(MAX(4, CONFIG_SDHC_BUFFER_ALIGNMENT)); /* Card internal buffer */
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+	uint32_t merge_start; /*!< First block of pending merged write */
+	uint32_t merge_count; /*!< Number of blocks pending in merge buffer */
+	uint8_t merge_buffer[CONFIG_SD_WRITE_MERGE_BLOCKS * SDMMC_DEFAULT_BLOCK_SIZE]
+		__aligned(MAX(4, CONFIG_SDHC_BUFFER_ALIGNMENT)); /* Write merge buffer */
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
 };
 
 /**
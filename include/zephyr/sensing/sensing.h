@@ -157,6 +157,13 @@ struct sensing_sensor_info {
 struct sensing_callback_list {
 	sensing_data_event_t on_data_event; /**< Callback function for a sensor data event. */
 	void *context;                      /**< Associated context with on_data_event */
+#if defined(CONFIG_SENSING_CLIENT_DISPATCH) || defined(__DOXYGEN__)
+	/**
+	 * Work queue to call on_data_event from, or NULL to call it from the sensing
+	 * dispatch thread. The connection must not be closed from this work queue.
+	 */
+	struct k_work_q *work_q;
+#endif
 };
 
 /**
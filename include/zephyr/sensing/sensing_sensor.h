@@ -91,6 +91,12 @@ struct sensing_connection {
 	/** Next consume time of the connection. Unit is micro seconds. */
 	uint64_t next_consume_time;
 	struct sensing_callback_list *callback_list; /**< Callback list of the connection. */
+#if defined(CONFIG_SENSING_CLIENT_DISPATCH) || defined(__DOXYGEN__)
+	/** Number of data events queued to the work queue of the client. */
+	atomic_t pending;
+	/** Given when the last queued data event is done with the connection. */
+	struct k_sem idle;
+#endif
 };
 
 /**
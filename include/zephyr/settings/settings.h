@@ -387,6 +387,41 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Start a batch of saves.
+ *
+ * Until settings_batch_commit() or settings_batch_abort() is called, the
+ * values saved by the calling thread with settings_save_one(),
+ * settings_delete() or settings_save() are kept in RAM and other threads
+ * wait to access the settings. Saving the same key again replaces the
+ * pending value.
+ *
+ * Available with CONFIG_SETTINGS_BATCH.
+ *
+ * @return 0 on success, -EALREADY if a batch is already in progress.
+ */
+int settings_batch_begin(void);
+
+/**
+ * Write the values of the current batch to persisted storage.
+ *
+ * Values equal to the persisted ones, and deletions of keys which are
+ * not persisted, are dropped. The others are written in the order they
+ * were first saved in the batch. This does not make the batch atomic,
+ * a power loss during the commit can leave part of it written.
+ *
+ * @return 0 on success, -EINVAL if no batch is in progress, else the
+ * first error returned by the back-end. The writes go on after an error.
+ */
+int settings_batch_commit(void);
+
+/**
+ * Discard the values of the current batch.
+ *
+ * @return 0 on success, -EINVAL if no batch is in progress.
+ */
+int settings_batch_abort(void);
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
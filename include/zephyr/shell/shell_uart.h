@@ -25,6 +25,10 @@ extern const struct shell_transport_api shell_uart_transport_api;
 #define CONFIG_SHELL_BACKEND_SERIAL_TX_RING_BUFFER_SIZE 0
 #endif
 
+#ifndef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_RING_BUFFER_SIZE
+#define CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_RING_BUFFER_SIZE 0
+#endif
+
 #ifndef CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_COUNT
 #define CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_COUNT 0
 #endif
@@ -64,6 +68,9 @@ struct shell_uart_async {
 	struct uart_async_rx_config async_rx_config;
 	atomic_t pending_rx_req;
 	uint8_t rx_data[ASYNC_RX_BUF_SIZE];
+	struct ring_buf tx_ringbuf;
+	uint8_t tx_buf[CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_RING_BUFFER_SIZE];
+	atomic_t tx_busy;
 };
 
 struct shell_uart_polling {
@@ -35,6 +35,23 @@ struct z_spinlock_key {
 	int key;
 };
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#if defined(CONFIG_SMP) && defined(CONFIG_MCS_SPINLOCKS)
+/* Queue node of a CPU waiting for or holding an MCS spinlock */
+struct z_spinlock_node {
+	atomic_ptr_t next;
+	atomic_t waiting;
+};
+
+struct z_spinlock_node *z_spinlock_node_get(void);
+void z_spinlock_node_put(struct z_spinlock_node *node);
+#endif /* CONFIG_SMP && CONFIG_MCS_SPINLOCKS */
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -61,6 +78,17 @@ struct k_spinlock {
 	 */
 	atomic_t owner;
 	atomic_t tail;
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	/*
+	 * MCS spinlocks queue the waiting CPUs in a linked list of nodes,
+	 * the lock only points to the last one. Each CPU spins on a flag
+	 * in its own node, which the previous holder clears when it
+	 * releases the lock, so that the cache line of the lock is not
+	 * bounced between the waiting CPUs.
+	 */
+	atomic_ptr_t tail;
+	/* Node of the current holder */
+	struct z_spinlock_node *node;
 #else
 	atomic_t locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -78,8 +106,17 @@ struct k_spinlock {
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Statistics of the lock, assigned on first acquisition */
+	struct z_spin_lock_stats *stats;
+	/* Time (in cycles) a contended acquisition got the lock, 0 if the
+	 * acquisition was not contended and the hold time is not measured
+	 */
+	uint32_t stats_lock_time;
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
-	!defined(CONFIG_SPIN_VALIDATE)
+	!defined(CONFIG_SPIN_VALIDATE) && !defined(CONFIG_SPIN_LOCK_STATS)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
 	 * the k_spinlock struct will have no members. The result
 	 * is that in C sizeof(k_spinlock) is 0 and in C++ it is 1.
@@ -116,6 +153,13 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+struct z_spin_lock_stats;
+void z_spin_lock_stats_acquired(struct k_spinlock *l, uint32_t spins,
+				uint32_t wait_start);
+void z_spin_lock_stats_released(struct k_spinlock *l);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /**
  * @brief Spinlock key type
  *
@@ -140,6 +184,39 @@ static ALWAYS_INLINE void z_spinlock_validate_pre(struct k_spinlock *l)
 #endif
 }
 
+static ALWAYS_INLINE void z_spinlock_stats_spin(uint32_t *spins, uint32_t *wait_start)
+{
+	ARG_UNUSED(spins);
+	ARG_UNUSED(wait_start);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	if ((*spins)++ == 0U) {
+		*wait_start = sys_clock_cycle_get_32();
+	}
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_post(struct k_spinlock *l, uint32_t spins,
+						uint32_t wait_start)
+{
+	ARG_UNUSED(l);
+	ARG_UNUSED(spins);
+	ARG_UNUSED(wait_start);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spin_lock_stats_acquired(l, spins, wait_start);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_release(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Only contended acquisitions have their hold time measured */
+	if (l->stats_lock_time != 0U) {
+		z_spin_lock_stats_released(l);
+	}
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
 static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
@@ -151,6 +228,30 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
+#if defined(CONFIG_SMP) && defined(CONFIG_MCS_SPINLOCKS)
+static ALWAYS_INLINE void z_spinlock_mcs_release(struct k_spinlock *l)
+{
+	struct z_spinlock_node *node = l->node;
+	struct z_spinlock_node *next = atomic_ptr_get(&node->next);
+
+	if (next == NULL) {
+		if (atomic_ptr_cas(&l->tail, node, NULL)) {
+			z_spinlock_node_put(node);
+			return;
+		}
+
+		/* A waiter took the tail but has not linked itself to us yet */
+		while ((next = atomic_ptr_get(&node->next)) == NULL) {
+			arch_spin_relax();
+		}
+	}
+
+	/* Hand the lock over to the next CPU in the queue */
+	(void)atomic_clear(&next->waiting);
+	z_spinlock_node_put(node);
+}
+#endif /* CONFIG_SMP && CONFIG_MCS_SPINLOCKS */
+
 /**
  * @brief Lock a spinlock
  *
@@ -183,6 +284,8 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
 	k_spinlock_key_t k;
+	uint32_t spins = 0U;
+	uint32_t wait_start = 0U;
 
 	/* Note that we need to use the underlying arch-specific lock
 	 * implementation.  The "irq_lock()" API in SMP context is
@@ -198,17 +301,46 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	 * receiving a ticket
 	 */
 	atomic_val_t ticket = atomic_inc(&l->tail);
+	atomic_val_t owner;
+
 	/* Spin until our ticket is served */
-	while (atomic_get(&l->owner) != ticket) {
+	while ((owner = atomic_get(&l->owner)) != ticket) {
+		/*
+		 * Back off in proportion to the number of CPUs served
+		 * before us, instead of all polling the lock at once
+		 */
+		unsigned long ahead = (unsigned long)ticket - (unsigned long)owner;
+
+		for (unsigned long i = ahead * CONFIG_TICKET_SPINLOCKS_BACKOFF; i > 0; i--) {
+			arch_spin_relax();
+		}
+
+		z_spinlock_stats_spin(&spins, &wait_start);
 		arch_spin_relax();
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	struct z_spinlock_node *node = z_spinlock_node_get();
+	struct z_spinlock_node *prev = atomic_ptr_set(&l->tail, node);
+
+	/* Link behind the previous tail and spin on our own node */
+	if (prev != NULL) {
+		(void)atomic_ptr_set(&prev->next, node);
+		while (atomic_get(&node->waiting) != 0) {
+			z_spinlock_stats_spin(&spins, &wait_start);
+			arch_spin_relax();
+		}
+	}
+
+	l->node = node;
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
+		z_spinlock_stats_spin(&spins, &wait_start);
 		arch_spin_relax();
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_stats_post(l, spins, wait_start);
 
 	return k;
 }
@@ -257,6 +389,15 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 	if (!atomic_cas(&l->tail, ticket_val, ticket_val + 1)) {
 		goto busy;
 	}
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	struct z_spinlock_node *node = z_spinlock_node_get();
+
+	if (!atomic_ptr_cas(&l->tail, NULL, node)) {
+		z_spinlock_node_put(node);
+		goto busy;
+	}
+
+	l->node = node;
 #else
 	if (!atomic_cas(&l->locked, 0, 1)) {
 		goto busy;
@@ -264,6 +405,7 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_stats_post(l, 0U, 0U);
 
 	k->key = key;
 
@@ -312,11 +454,14 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+	z_spinlock_stats_release(l);
 
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/* Give the spinlock to the next CPU in a FIFO */
 	(void)atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	z_spinlock_mcs_release(l);
 #else
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -349,6 +494,8 @@ static ALWAYS_INLINE bool z_spin_is_locked(struct k_spinlock *l)
 	atomic_val_t ticket_val = atomic_get(&l->owner);
 
 	return !atomic_cas(&l->tail, ticket_val, ticket_val);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	return atomic_ptr_get(&l->tail) != NULL;
 #else
 	return l->locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -362,9 +509,12 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+	z_spinlock_stats_release(l);
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	z_spinlock_mcs_release(l);
 #else
 	(void)atomic_clear(&l->locked);
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -439,6 +589,42 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
 	for (k_spinlock_key_t __i K_SPINLOCK_ONEXIT = {}, __key = k_spin_lock(lck); !__i.key;      \
 	     k_spin_unlock((lck), __key), __i.key = 1)
 
+#if defined(CONFIG_SPIN_LOCK_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Spinlock statistics callback.
+ *
+ * @param l Spinlock, NULL for the statistics shared by all the spinlocks
+ *	    that did not fit in the table.
+ * @param stats Statistics of the spinlock.
+ * @param user_data User data passed to k_spin_lock_stats_foreach().
+ */
+typedef void (*k_spin_lock_stats_cb_t)(const struct k_spinlock *l,
+				       const struct k_lock_stats *stats,
+				       void *user_data);
+
+/**
+ * @brief Iterate over statistics of all spinlocks acquired so far.
+ *
+ * Statistics are read without synchronization with spinlock users, so
+ * values of a spinlock taken at the same time may be inconsistent.
+ *
+ * @note @kconfig{CONFIG_SPIN_LOCK_STATS} must be selected for this
+ * function to be available.
+ *
+ * @param cb Callback called for each spinlock.
+ * @param user_data User data passed to the callback.
+ */
+void k_spin_lock_stats_foreach(k_spin_lock_stats_cb_t cb, void *user_data);
+
+/**
+ * @brief Reset statistics of all spinlocks.
+ *
+ * @note @kconfig{CONFIG_SPIN_LOCK_STATS} must be selected for this
+ * function to be available.
+ */
+void k_spin_lock_stats_reset(void);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /** @} */
 
 #ifdef __cplusplus
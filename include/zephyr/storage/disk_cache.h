@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Disk block cache API
+ *
+ * Write-back sector cache on top of the disk access layer, shared by all
+ * disks and used by file systems which opt into it.
+ */
+
+#ifndef ZEPHYR_INCLUDE_STORAGE_DISK_CACHE_H_
+#define ZEPHYR_INCLUDE_STORAGE_DISK_CACHE_H_
+
+/**
+ * @brief Disk block cache
+ * @defgroup disk_cache_interface Disk block cache
+ * @ingroup storage_apis
+ * @{
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Read sectors through the cache
+ *
+ * Requests of up to @kconfig{CONFIG_DISK_CACHE_MAX_REQUEST} sectors are
+ * served from the cache, loading missing sectors from the disk. Larger
+ * requests are read from the disk directly, with sectors modified in the
+ * cache copied over the data read. Disks with a sector size other than
+ * @kconfig{CONFIG_DISK_CACHE_SECTOR_SIZE} are not cached.
+ *
+ * @param[in] pdrv          Disk name
+ * @param[out] data_buf     Pointer to the memory buffer to put data.
+ * @param[in] start_sector  Start disk sector to read from
+ * @param[in] num_sector    Number of disk sectors to read
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int disk_cache_read(const char *pdrv, uint8_t *data_buf, uint32_t start_sector,
+		    uint32_t num_sector);
+
+/**
+ * @brief Write sectors through the cache
+ *
+ * Requests of up to @kconfig{CONFIG_DISK_CACHE_MAX_REQUEST} sectors are only
+ * stored in the cache and written to the disk when evicted or on
+ * disk_cache_sync(). Larger requests are written to the disk directly,
+ * updating sectors present in the cache.
+ *
+ * @param[in] pdrv          Disk name
+ * @param[in] data_buf      Pointer to the memory buffer
+ * @param[in] start_sector  Start disk sector to write to
+ * @param[in] num_sector    Number of disk sectors to write
+ *
+ * @return 0 on success, negative errno code on fail. Errors of writing
+ *	   evicted sectors of any disk are reported as well.
+ */
+int disk_cache_write(const char *pdrv, const uint8_t *data_buf, uint32_t start_sector,
+		     uint32_t num_sector);
+
+/**
+ * @brief Load sectors into the cache ahead of their use
+ *
+ * Hint that the sectors are about to be read. Loads the sectors which are
+ * not cached yet, at most @kconfig{CONFIG_DISK_CACHE_SECTORS}.
+ *
+ * @param[in] pdrv          Disk name
+ * @param[in] start_sector  First sector to load
+ * @param[in] num_sector    Number of sectors to load
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int disk_cache_read_ahead(const char *pdrv, uint32_t start_sector, uint32_t num_sector);
+
+/**
+ * @brief Write modified sectors of a disk and sync it
+ *
+ * Writes all modified cached sectors of the disk, then issues
+ * @ref DISK_IOCTL_CTRL_SYNC to it.
+ *
+ * @param[in] pdrv          Disk name
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int disk_cache_sync(const char *pdrv);
+
+/**
+ * @brief Drop all cached sectors of a disk
+ *
+ * Modified sectors are discarded, call disk_cache_sync() first to keep
+ * them. Used when the disk is deinitialized or its media is changed.
+ *
+ * @param[in] pdrv          Disk name
+ */
+void disk_cache_invalidate(const char *pdrv);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_STORAGE_DISK_CACHE_H_ */
@@ -25,6 +25,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -74,6 +77,17 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	uint8_t *pipe_buf;		/* Buffer of the write in progress, NULL
+					 * when writes are not pipelined
+					 */
+	size_t pipe_bytes;		/* Number of bytes of the write in progress */
+	struct flash_async_op write_op;	/* Write in progress */
+	struct flash_async_op erase_op;	/* Erase of the next page in progress */
+	struct k_sem pipe_sem;		/* Given on completion of each queued op */
+	uint8_t pipe_ops;		/* Number of queued ops */
+	int pipe_rc;			/* First error of queued ops */
+#endif
 };
 
 /**
@@ -106,6 +120,38 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
  */
 size_t stream_flash_bytes_written(const struct stream_flash_ctx *ctx);
 
+/**
+ * @brief Read number of bytes buffered and not yet written to the flash.
+ *
+ * Includes the bytes of a pipelined write still in progress.
+ *
+ * @param ctx context
+ *
+ * @return Number of payload bytes buffered.
+ */
+size_t stream_flash_bytes_buffered(const struct stream_flash_ctx *ctx);
+
+/**
+ * @brief Enable pipelined writes with a second write buffer.
+ *
+ * Once a write buffer is full, it is written to the flash in the background
+ * with flash_write_async() while following data is placed into the other
+ * buffer, so the caller is only blocked when it has filled the second
+ * buffer before the first write completes. When erasing, the page following
+ * the written data is erased in the background as well.
+ *
+ * Must be called after @ref stream_flash_init and before any write. Errors
+ * of background operations are reported by the next write or flush, and
+ * @ref stream_flash_bytes_written only counts completed writes. A context
+ * with pipelined writes must be flushed before it is re-initialized.
+ *
+ * @param ctx context
+ * @param buf Second write buffer, of the length given to stream_flash_init.
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_pipeline_enable(struct stream_flash_ctx *ctx, uint8_t *buf);
+
 /**
  * @brief Process input buffers to be written to flash device in single blocks.
  * Will store remainder between calls.
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/app_memory/app_memdomain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Arena allocator API
+ * @defgroup sys_arena Arena allocator API
+ * @ingroup datastructure_apis
+ *
+ * An arena hands out memory by bumping an offset into a fixed buffer and
+ * frees everything at once with @ref sys_arena_reset, which suits scratch
+ * data whose lifetime ends at a known point such as the end of a processing
+ * frame.
+ *
+ * Arenas perform no locking and make no system calls. Each arena is meant to
+ * be owned by a single thread; a user mode thread can use one directly once
+ * the memory partition holding it, see @ref SYS_ARENA_DEFINE_IN_PARTITION, is
+ * part of its memory domain.
+ *
+ * @{
+ */
+
+/** @brief Arena allocator. */
+struct sys_arena {
+	/** Start of the backing buffer. */
+	uint8_t *buf;
+	/** Size of the backing buffer in bytes. */
+	size_t size;
+	/** Number of bytes handed out since the last reset. */
+	size_t used;
+};
+
+/**
+ * @brief Statically initialize an arena.
+ *
+ * @param _buf Backing buffer.
+ * @param _size Size of @p _buf in bytes.
+ */
+#define SYS_ARENA_INIT(_buf, _size)			\
+	{						\
+		.buf = (uint8_t *)(_buf),		\
+		.size = (_size),			\
+		.used = 0,				\
+	}
+
+/**
+ * @brief Define an arena and its backing buffer.
+ *
+ * @param name Name of the arena.
+ * @param size Size of the backing buffer in bytes.
+ */
+#define SYS_ARENA_DEFINE(name, size)						\
+	static uint8_t __aligned(sizeof(void *)) _arena_buf_##name[size];		\
+	struct sys_arena name = SYS_ARENA_INIT(_arena_buf_##name, size)
+
+/**
+ * @brief Define an arena in an application memory partition.
+ *
+ * Both the arena and its backing buffer are placed in @p part, created with
+ * @ref K_APPMEM_PARTITION_DEFINE, so a user mode thread whose memory domain
+ * contains the partition can allocate from the arena without a system call.
+ * Without @kconfig{CONFIG_USERSPACE} this is the same as
+ * @ref SYS_ARENA_DEFINE.
+ *
+ * @param name Name of the arena.
+ * @param size Size of the backing buffer in bytes.
+ * @param part Name of the application memory partition.
+ */
+#define SYS_ARENA_DEFINE_IN_PARTITION(name, size, part)				\
+	K_APP_BMEM(part) static uint8_t __aligned(sizeof(void *))			\
+		_arena_buf_##name[size];						\
+	K_APP_DMEM(part) struct sys_arena name =					\
+		SYS_ARENA_INIT(_arena_buf_##name, size)
+
+/**
+ * @brief Initialize an arena at runtime.
+ *
+ * @param arena Arena.
+ * @param buf Backing buffer.
+ * @param size Size of @p buf in bytes.
+ */
+static inline void sys_arena_init(struct sys_arena *arena, void *buf, size_t size)
+{
+	arena->buf = buf;
+	arena->size = size;
+	arena->used = 0;
+}
+
+/**
+ * @brief Allocate aligned memory from an arena.
+ *
+ * @param arena Arena.
+ * @param align Required alignment in bytes, a power of two.
+ * @param bytes Number of bytes.
+ *
+ * @return Pointer to the memory, or NULL if the arena is exhausted.
+ */
+static inline void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align, size_t bytes)
+{
+	__ASSERT_NO_MSG(IS_POWER_OF_TWO(align));
+
+	uintptr_t start = (uintptr_t)arena->buf + arena->used;
+	size_t pad = ROUND_UP(start, align) - start;
+
+	if ((bytes > arena->size - arena->used) ||
+	    (pad > arena->size - arena->used - bytes)) {
+		return NULL;
+	}
+
+	arena->used += pad + bytes;
+
+	return (void *)(start + pad);
+}
+
+/**
+ * @brief Allocate memory from an arena.
+ *
+ * The memory is aligned to the size of a pointer.
+ *
+ * @param arena Arena.
+ * @param bytes Number of bytes.
+ *
+ * @return Pointer to the memory, or NULL if the arena is exhausted.
+ */
+static inline void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, sizeof(void *), bytes);
+}
+
+/**
+ * @brief Get a mark of the current allocation state.
+ *
+ * @param arena Arena.
+ *
+ * @return Value to pass to @ref sys_arena_release.
+ */
+static inline size_t sys_arena_mark(const struct sys_arena *arena)
+{
+	return arena->used;
+}
+
+/**
+ * @brief Free everything allocated since a mark was taken.
+ *
+ * @param arena Arena.
+ * @param mark Value returned by @ref sys_arena_mark.
+ */
+static inline void sys_arena_release(struct sys_arena *arena, size_t mark)
+{
+	__ASSERT_NO_MSG(mark <= arena->used);
+
+	arena->used = mark;
+}
+
+/**
+ * @brief Free everything allocated from an arena.
+ *
+ * @param arena Arena.
+ */
+static inline void sys_arena_reset(struct sys_arena *arena)
+{
+	arena->used = 0;
+}
+
+/**
+ * @brief Get the number of bytes still available in an arena.
+ *
+ * Alignment padding of later allocations may make less than this usable.
+ *
+ * @param arena Arena.
+ *
+ * @return Number of free bytes.
+ */
+static inline size_t sys_arena_free_get(const struct sys_arena *arena)
+{
+	return arena->size - arena->used;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ARENA_H_ */
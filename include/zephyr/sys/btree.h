@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup btree_apis B+tree
+ * @ingroup datastructure_apis
+ *
+ * @brief Intrusive B+tree implementation
+ *
+ * An ordered container with the interface of the @ref rbtree_apis, whose nodes are held in
+ * blocks of up to @ref BTREE_ORDER entries instead of one node per level. Insertion is
+ * O(log2(N)) comparisons, but walking down the tree touches O(log(N) / log(BTREE_ORDER)) blocks.
+ * The lowest and highest nodes are found in constant time, as leaves are chained, removal takes
+ * no comparison and iteration is linear without a stack.
+ *
+ * The tree never allocates memory: every @ref btree_node embeds a block, which it lends to the
+ * tree while it is inserted. A tree of N nodes needs less than N blocks, the remaining ones are
+ * kept on a free list and the block of a removed node is moved to a free one when the tree still
+ * uses it. The price is the size of the node, 2 * @ref BTREE_ORDER + 3 pointers instead of two
+ * for a red/black tree node.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_BTREE_H_
+#define ZEPHYR_INCLUDE_SYS_BTREE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Largest number of entries of a block */
+#ifdef CONFIG_BTREE_ORDER
+#define BTREE_ORDER CONFIG_BTREE_ORDER
+#else
+#define BTREE_ORDER 8
+#endif
+
+struct btree_node;
+
+/** @cond INTERNAL_HIDDEN */
+struct btree_block {
+	/* Parent block, or next free block */
+	struct btree_block *parent;
+	uint8_t count;
+	bool is_leaf;
+	bool is_free;
+	/* Nodes of a leaf, lowest nodes of the children of an inner block */
+	struct btree_node *keys[BTREE_ORDER];
+	union {
+		/* Children of an inner block */
+		struct btree_block *children[BTREE_ORDER];
+		/* Neighbours of a leaf, or previous free block */
+		struct {
+			struct btree_block *prev;
+			struct btree_block *next;
+		};
+	};
+};
+/** @endcond */
+
+/**
+ * @brief B+tree node structure
+ */
+struct btree_node {
+	/** @cond INTERNAL_HIDDEN */
+	/* Leaf holding the node */
+	struct btree_block *leaf;
+	/* Block lent to the tree */
+	struct btree_block block;
+	/** @endcond */
+};
+
+/**
+ * @typedef btree_lessthan_t
+ * @brief B+tree comparison predicate
+ *
+ * Compares the two nodes and returns true if node A is strictly less than B according to the
+ * tree's sorting criteria, false otherwise.
+ *
+ * As with @ref rb_lessthan_t, the node being inserted is always "A", and is inserted after the
+ * nodes which compare as equal.
+ */
+typedef bool (*btree_lessthan_t)(struct btree_node *a, struct btree_node *b);
+
+/**
+ * @brief B+tree structure
+ */
+struct btree {
+	/** Root block of the tree, NULL if empty */
+	struct btree_block *root;
+	/** Comparison function for nodes in the tree */
+	btree_lessthan_t lessthan_fn;
+	/** @cond INTERNAL_HIDDEN */
+	struct btree_block *first;
+	struct btree_block *last;
+	struct btree_block *free;
+	/** @endcond */
+};
+
+/**
+ * @brief Prototype for node visitor callback.
+ * @param node Node being visited
+ * @param cookie User-specified data
+ */
+typedef void (*btree_visit_t)(struct btree_node *node, void *cookie);
+
+/**
+ * @brief Insert node into tree
+ */
+void btree_insert(struct btree *tree, struct btree_node *node);
+
+/**
+ * @brief Remove node from tree
+ *
+ * The node must be in the tree.
+ */
+void btree_remove(struct btree *tree, struct btree_node *node);
+
+/**
+ * @brief Returns the lowest-sorted member of the tree
+ */
+static inline struct btree_node *btree_get_min(struct btree *tree)
+{
+	return (tree->first != NULL) ? tree->first->keys[0] : NULL;
+}
+
+/**
+ * @brief Returns the highest-sorted member of the tree
+ */
+static inline struct btree_node *btree_get_max(struct btree *tree)
+{
+	return (tree->last != NULL) ? tree->last->keys[tree->last->count - 1U] : NULL;
+}
+
+/**
+ * @brief Returns true if the given node is part of the tree
+ *
+ * As with rb_contains(), the node pointer is only compared with the nodes of the tree, besides
+ * being passed to the lessthan callback.
+ */
+bool btree_contains(struct btree *tree, struct btree_node *node);
+
+/** @cond INTERNAL_HIDDEN */
+struct _btree_foreach {
+	struct btree_block *leaf;
+	uint8_t pos;
+};
+
+#define _BTREE_FOREACH_INIT(tree) { .leaf = (tree)->first, .pos = 0U }
+
+static inline struct btree_node *z_btree_foreach_next(struct _btree_foreach *f)
+{
+	while ((f->leaf != NULL) && (f->pos >= f->leaf->count)) {
+		f->leaf = f->leaf->next;
+		f->pos = 0U;
+	}
+
+	return (f->leaf != NULL) ? f->leaf->keys[f->pos++] : NULL;
+}
+/** @endcond */
+
+/**
+ * @brief Walk/enumerate a B+tree
+ */
+static inline void btree_walk(struct btree *tree, btree_visit_t visit_fn, void *cookie)
+{
+	struct _btree_foreach f = _BTREE_FOREACH_INIT(tree);
+	struct btree_node *node;
+
+	while ((node = z_btree_foreach_next(&f)) != NULL) {
+		visit_fn(node, cookie);
+	}
+}
+
+/**
+ * @brief Walk a tree in-order
+ *
+ * Unlike RB_FOR_EACH(), this needs no stack. The loop is not safe against modifications of the
+ * tree.
+ *
+ * @param tree A pointer to a struct btree to walk
+ * @param node The symbol name of a local struct btree_node* variable to use as the iterator
+ */
+#define BTREE_FOR_EACH(tree, node)                                                                 \
+	for (struct _btree_foreach __f = _BTREE_FOREACH_INIT(tree);                                \
+	     ((node) = z_btree_foreach_next(&__f)) != NULL;                                        \
+	     /**/)
+
+/**
+ * @brief Loop over a B+tree with implicit container field logic
+ *
+ * As for BTREE_FOR_EACH(), but "node" can have an arbitrary type containing a struct btree_node.
+ *
+ * @param tree A pointer to a struct btree to walk
+ * @param node The symbol name of a local iterator
+ * @param field The field name of a struct btree_node inside node
+ */
+#define BTREE_FOR_EACH_CONTAINER(tree, node, field)                                                \
+	for (struct _btree_foreach __f = _BTREE_FOREACH_INIT(tree);                                \
+	     ({                                                                                    \
+		     struct btree_node *n = z_btree_foreach_next(&__f);                            \
+		     (node) = (n != NULL) ? CONTAINER_OF(n, __typeof__(*(node)), field) : NULL;    \
+		     (node);                                                                       \
+	     }) != NULL;                                                                           \
+	     /**/)
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* ZEPHYR_INCLUDE_SYS_BTREE_H_ */
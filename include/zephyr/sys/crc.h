@@ -265,6 +265,44 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len);
 uint32_t crc32_c(uint32_t crc, const uint8_t *data,
 		 size_t len, bool first_pkt, bool last_pkt);
 
+#if defined(CONFIG_CRC_BACKEND) || defined(__DOXYGEN__)
+/**
+ * @brief Hardware computing some of the CRCs
+ *
+ * With @kconfig{CONFIG_CRC_BACKEND}, crc32_ieee_update(), crc32_c() and
+ * crc16_ccitt() hand buffers of at least @c min_len bytes to the registered
+ * backend when it implements them, and compute them in software otherwise.
+ * Handlers may be called from any context and must serialize accesses to the
+ * hardware themselves.
+ */
+struct crc_backend {
+	/** Same as crc32_ieee_update(), or NULL */
+	uint32_t (*crc32_ieee_update)(uint32_t crc, const uint8_t *data, size_t len);
+	/**
+	 * Update the CRC-32C register, which is already initialized and not
+	 * inverted at the end, or NULL
+	 */
+	uint32_t (*crc32_c)(uint32_t crc, const uint8_t *data, size_t len);
+	/** Same as crc16_ccitt(), or NULL */
+	uint16_t (*crc16_ccitt)(uint16_t seed, const uint8_t *src, size_t len);
+	/** Shortest buffer worth the hardware setup */
+	size_t min_len;
+};
+
+/**
+ * @brief Register the CRC hardware backend
+ *
+ * Typically called by the driver of a CRC peripheral during initialization.
+ *
+ * @param backend Backend, or NULL to compute all CRCs in software again.
+ */
+void crc_backend_set(const struct crc_backend *backend);
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct crc_backend *z_crc_backend;
+/** @endcond */
+#endif /* CONFIG_CRC_BACKEND */
+
 /**
  * @brief Update a CRC-32K/4.2 (*op) (Koopman) checksum. This is a good HD=4
  * checksum up to 2,147,483,615 bits and HD=5/6 up to 6,167 bits.
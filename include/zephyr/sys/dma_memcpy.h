@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Memory copies offloaded to a DMA controller
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_DMA_MEMCPY_H_
+#define ZEPHYR_INCLUDE_SYS_DMA_MEMCPY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief DMA memory copy
+ * @defgroup sys_dma_memcpy DMA memory copy
+ * @ingroup os_services
+ *
+ * Copies of at least @kconfig{CONFIG_SYS_DMA_MEMCPY_THRESHOLD} bytes are done by a
+ * memory-to-memory channel of the controller chosen with @c zephyr,dma-memcpy, when one is free.
+ * Data caches are flushed and invalidated around the transfer. Copies are done by the CPU instead
+ * when they are smaller, when no channel is free, when the destination does not start and end on
+ * a data cache line or when the DMA transfer cannot be set up.
+ *
+ * With @kconfig{CONFIG_SYS_DMA_MEMCPY_MEM_ATTR}, the source and the destination must also lie in
+ * a memory region with the @c DT_MEM_DMA attribute, other copies are done by the CPU. Without it,
+ * the callers must only pass buffers the controller can reach.
+ *
+ * Without @kconfig{CONFIG_SYS_DMA_MEMCPY} the routines always use the CPU, so callers need no
+ * conditional code.
+ * @{
+ */
+
+/**
+ * @brief Completion callback of an asynchronous copy
+ *
+ * Called from the DMA controller's interrupt, or from the caller's context when the copy was done
+ * by the CPU.
+ *
+ * @param user_data User data given to sys_dma_memcpy_async().
+ * @param status 0 on success, a negative error code if the DMA transfer failed.
+ */
+typedef void (*sys_dma_memcpy_cb_t)(void *user_data, int status);
+
+/** Asynchronous copy request, owned by the caller until its callback runs */
+struct sys_dma_memcpy_req {
+	/** @cond INTERNAL_HIDDEN */
+	sys_dma_memcpy_cb_t cb;
+	void *user_data;
+	void *dst;
+	size_t len;
+	uint32_t channel;
+	uint32_t seq;
+	sys_snode_t node;
+	/** @endcond */
+};
+
+/** Timeout of the copies made by the kernel and the drivers */
+#define SYS_DMA_MEMCPY_TIMEOUT_DEFAULT \
+	K_MSEC(COND_CODE_1(CONFIG_SYS_DMA_MEMCPY, (CONFIG_SYS_DMA_MEMCPY_TIMEOUT_MS), (0)))
+
+#if defined(CONFIG_SYS_DMA_MEMCPY) || defined(__DOXYGEN__)
+
+/**
+ * @brief Copy memory, with DMA when worthwhile
+ *
+ * Waits for the DMA transfer to complete. Uses the CPU when called from an ISR, and to copy again
+ * if the DMA transfer failed or did not complete in time, in which case the transfer is stopped
+ * first.
+ *
+ * @param dst Destination.
+ * @param src Source.
+ * @param len Number of bytes.
+ * @param timeout Longest wait for the DMA transfer.
+ */
+void sys_dma_memcpy(void *dst, const void *src, size_t len, k_timeout_t timeout);
+
+/**
+ * @brief Start copying memory, with DMA when worthwhile
+ *
+ * The source and destination must not be accessed until @p cb is called. When the copy is done by
+ * the CPU, @p cb is called before this routine returns.
+ *
+ * @param req Request storage, must stay valid until @p cb is called.
+ * @param dst Destination.
+ * @param src Source.
+ * @param len Number of bytes.
+ * @param cb Completion callback.
+ * @param user_data User data passed to @p cb.
+ */
+void sys_dma_memcpy_async(struct sys_dma_memcpy_req *req, void *dst, const void *src, size_t len,
+			  sys_dma_memcpy_cb_t cb, void *user_data);
+
+#else
+
+static inline void sys_dma_memcpy(void *dst, const void *src, size_t len, k_timeout_t timeout)
+{
+	(void)timeout;
+	memcpy(dst, src, len);
+}
+
+static inline void sys_dma_memcpy_async(struct sys_dma_memcpy_req *req, void *dst,
+					const void *src, size_t len, sys_dma_memcpy_cb_t cb,
+					void *user_data)
+{
+	(void)req;
+	memcpy(dst, src, len);
+	cb(user_data, 0);
+}
+
+#endif /* CONFIG_SYS_DMA_MEMCPY */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_DMA_MEMCPY_H_ */
@@ -21,6 +21,21 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Number of children of each node.
+ *
+ * The children of a node are contiguous, a 4-ary heap is half as deep as a
+ * binary one and compares a node with children of the same cache line.
+ */
+#ifdef CONFIG_MIN_HEAP_ARITY
+#define MIN_HEAP_ARITY CONFIG_MIN_HEAP_ARITY
+#else
+#define MIN_HEAP_ARITY 2
+#endif
+
+/** Index passed to the index callback for an element leaving the heap. */
+#define MIN_HEAP_NO_INDEX SIZE_MAX
+
 /**
  * @brief Comparator function type for min-heap ordering.
  *
@@ -49,6 +64,19 @@ typedef int (*min_heap_cmp_t)(const void *a,
 typedef bool (*min_heap_eq_t)(const void *node,
 			       const void *other);
 
+/**
+ * @brief Index tracking function.
+ *
+ * Called whenever an element is stored at a new index of the heap, so that
+ * its owner can keep the index as a handle for min_heap_update() and
+ * min_heap_remove(). An element leaving the heap is reported with
+ * @ref MIN_HEAP_NO_INDEX, in the output buffer it was copied to.
+ *
+ * @param node Pointer to the element.
+ * @param index New index of the element.
+ */
+typedef void (*min_heap_index_t)(void *node, size_t index);
+
 /**
  * @brief min-heap data structure with user-provided comparator.
  */
@@ -63,6 +91,8 @@ struct min_heap {
 	size_t size;
 	/** Comparator function */
 	min_heap_cmp_t cmp;
+	/** Optional index tracking function */
+	min_heap_index_t index_cb;
 };
 
 /**
@@ -120,6 +150,34 @@ struct min_heap {
 void min_heap_init(struct min_heap *heap, void *storage, size_t cap,
 		   size_t elem_size, min_heap_cmp_t cmp);
 
+/**
+ * @brief Track the index of the elements of a min-heap.
+ *
+ * Installs a callback reporting every move of an element, and reports the
+ * current index of the elements already in the heap. Pass NULL to stop
+ * tracking.
+ *
+ * @param heap Pointer to the min-heap.
+ * @param index_cb Index tracking function, or NULL.
+ */
+void min_heap_set_index_cb(struct min_heap *heap, min_heap_index_t index_cb);
+
+/**
+ * @brief Build a min-heap from an array.
+ *
+ * Replaces the content of the heap with @p count elements copied from
+ * @p items and orders them in O(n) comparisons, instead of O(n log n) for
+ * as many min_heap_push() calls. @p items may be the storage of the heap,
+ * to order elements written there directly.
+ *
+ * @param heap Pointer to the min-heap.
+ * @param items Pointer to the elements.
+ * @param count Number of elements.
+ *
+ * @return 0 on Success, -ENOMEM if the elements do not fit the heap.
+ */
+int min_heap_build(struct min_heap *heap, const void *items, size_t count);
+
 /**
  * @brief Push an element into the min-heap.
  *
@@ -162,6 +220,19 @@ void *min_heap_peek(const struct min_heap *heap);
  */
 bool min_heap_remove(struct min_heap *heap, size_t id, void *out_buf);
 
+/**
+ * @brief Restore the order of an element whose key changed.
+ *
+ * Moves the element at index @p id up after its key decreased, or down after
+ * it increased. The index is typically kept by a min_heap_index_t callback.
+ *
+ * @param heap Pointer to the min-heap.
+ * @param id Index of the modified element.
+ *
+ * @return 0 on Success, -EINVAL if @p id is not in the heap.
+ */
+int min_heap_update(struct min_heap *heap, size_t id);
+
 /**
  * @brief Check if the min heap is empty.
  *
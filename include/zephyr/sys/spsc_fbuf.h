@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SPSC_FBUF_H_
+#define ZEPHYR_INCLUDE_SYS_SPSC_FBUF_H_
+
+#include <zephyr/sys/spsc_pbuf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Single producer, single consumer frame buffer API
+ * @defgroup spsc_fbuf SPSC (Single producer, single consumer) frame buffer API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/**@defgroup SPSC_FBUF_FLAGS SPSC frame buffer flags
+ * @{
+ */
+
+/** @brief Flag indicating that cache shall be handled.
+ *
+ * Same semantics as @ref SPSC_PBUF_CACHE. Cache handling is configured with the
+ * CONFIG_SPSC_PBUF_CACHE_* options which apply to both buffer types.
+ */
+#define SPSC_FBUF_CACHE SPSC_PBUF_CACHE
+
+/**@} */
+
+struct spsc_fbuf;
+
+/** @brief Frame buffer fill level notification.
+ *
+ * @param fb		Frame buffer.
+ * @param used		Number of frames in the buffer after the operation.
+ * @param user_data	User data from the watermark descriptor.
+ */
+typedef void (*spsc_fbuf_watermark_cb_t)(struct spsc_fbuf *fb, uint32_t used, void *user_data);
+
+/** @brief Watermark descriptor.
+ *
+ * Watermarks hold function pointers so they are kept in the local memory of the
+ * side which passes them to @ref spsc_fbuf_commit or @ref spsc_fbuf_free, never
+ * in the shared buffer.
+ */
+struct spsc_fbuf_watermark {
+	/** Fill level in frames. */
+	uint32_t level;
+	/** Called when the fill level crosses @ref level. */
+	spsc_fbuf_watermark_cb_t cb;
+	/** User data passed to @ref cb. */
+	void *user_data;
+};
+
+/** @brief First part of frame buffer control block.
+ *
+ * This part contains only data set during the initialization and data touched
+ * by the reader.
+ */
+struct spsc_fbuf_common {
+	uint32_t frames;	/* Capacity in frames, a power of two. */
+	uint32_t frame_size;	/* Size of a frame in bytes. */
+	uint32_t flags;		/* Flags. See @ref SPSC_FBUF_FLAGS */
+	uint32_t rd_idx;	/* Number of frames read, free running. */
+};
+
+/* Padding to fill cache line. */
+#define Z_SPSC_FBUF_PADDING \
+	MAX(0, Z_SPSC_PBUF_DCACHE_LINE - (int)sizeof(struct spsc_fbuf_common))
+
+/* Padding placing data[] at the start of a cache line. */
+#define Z_SPSC_FBUF_DATA_PADDING \
+	MAX(0, Z_SPSC_PBUF_DCACHE_LINE - (int)sizeof(uint32_t))
+
+/** @brief Remaining part of a frame buffer when cache is used.
+ *
+ * It contains data that is only changed by the writer. Gaps are added to ensure
+ * that the write index is in different cache line than the data changed by the
+ * reader and that frames start on a cache line.
+ */
+struct spsc_fbuf_ext_cache {
+	uint8_t reserved[Z_SPSC_FBUF_PADDING];
+	uint32_t wr_idx;	/* Number of frames written, free running. */
+	uint8_t reserved2[Z_SPSC_FBUF_DATA_PADDING];
+	uint8_t data[];		/* Buffer data. */
+};
+
+/** @brief Remaining part of a frame buffer when cache is not used. */
+struct spsc_fbuf_ext_nocache {
+	uint32_t wr_idx;	/* Number of frames written, free running. */
+	uint8_t data[];		/* Buffer data. */
+};
+
+/**
+ * @brief Single producer, single consumer frame buffer
+ *
+ * The SPSC frame buffer is the fixed frame counterpart of @ref spsc_pbuf
+ * intended for continuous streams such as audio. Data is stored as frames of
+ * equal size without any per frame header and the capacity is a power of two
+ * frames so indices wrap by masking. Like the packet buffer it lives entirely
+ * in a memory region shared by the writer and the reader and optionally embeds
+ * cache and memory barrier management, so the writer and the reader may be
+ * an interrupt, a thread or another core without any locking.
+ *
+ * Frames are accessed in place. A claimed span never crosses the end of the
+ * buffer, so a transfer which wraps takes two spans.
+ */
+struct spsc_fbuf {
+	struct spsc_fbuf_common common;
+	union {
+		struct spsc_fbuf_ext_cache cache;
+		struct spsc_fbuf_ext_nocache nocache;
+	} ext;
+};
+
+/** @brief Get buffer capacity.
+ *
+ * @param fb	A buffer.
+ *
+ * @return Frame buffer capacity in frames.
+ */
+static inline uint32_t spsc_fbuf_capacity(struct spsc_fbuf *fb)
+{
+	return fb->common.frames;
+}
+
+/**
+ * @brief Initialize the frame buffer.
+ *
+ * This function initializes the frame buffer on top of a dedicated memory
+ * region. The capacity is the largest power of two frames which fits in the
+ * region after the control block.
+ *
+ * @param buf			Pointer to a memory region on which buffer is
+ *				created. When cache is used it must be aligned to
+ *				Z_SPSC_PBUF_DCACHE_LINE, otherwise it must
+ *				be 32 bit word aligned.
+ * @param blen			Length of the buffer. Must be large enough to
+ *				contain the internal structure and at least one frame.
+ * @param frame_size		Size of a frame in bytes. If a DMA accesses the
+ *				buffer while cache is used, it should be a multiple
+ *				of Z_SPSC_PBUF_DCACHE_LINE.
+ * @param flags			Option flags. See @ref SPSC_FBUF_FLAGS.
+ * @retval struct spsc_fbuf*	Pointer to the created buffer. The pointer
+ *				points to the same address as buf.
+ * @retval NULL			Invalid buffer alignment or length.
+ */
+struct spsc_fbuf *spsc_fbuf_init(void *buf, size_t blen, size_t frame_size, uint32_t flags);
+
+/**
+ * @brief Get number of frames in the buffer.
+ *
+ * May be called by the writer or the reader. The value is a snapshot, the other
+ * side may change it immediately.
+ *
+ * @param fb	A buffer.
+ *
+ * @return Number of frames written and not yet freed.
+ */
+uint32_t spsc_fbuf_used(struct spsc_fbuf *fb);
+
+/**
+ * @brief Allocate frames in the buffer.
+ *
+ * Returns the largest continuous span of free frames, up to @p frames, starting
+ * at the write position. The span ends at the end of the buffer so a request
+ * which wraps is satisfied by a second call after committing the first span.
+ * Allocation does not change the state of the buffer.
+ *
+ * The span may be filled by the CPU or handed to a DMA as is. It must be
+ * committed (@ref spsc_fbuf_commit) to make the frames available for reading.
+ *
+ * @param[in]  fb	A buffer to which to write.
+ * @param[in]  frames	Requested number of frames.
+ * @param[out] buf	Location where the span address is written.
+ *
+ * @return Number of frames allocated, which can be smaller than @p frames.
+ */
+uint32_t spsc_fbuf_alloc(struct spsc_fbuf *fb, uint32_t frames, void **buf);
+
+/**
+ * @brief Commit frames to the buffer.
+ *
+ * Commit frames previously allocated (@ref spsc_fbuf_alloc). If cache is used,
+ * cache writeback is performed on the frames. Since the writer never reads the
+ * frames back this does not alter frames written by a DMA.
+ *
+ * @param fb		A buffer to which to write.
+ * @param frames	Number of frames, at most the number allocated.
+ * @param wm		Optional watermark. Its callback is called if the fill
+ *			level was below and is now at or above the watermark level.
+ */
+void spsc_fbuf_commit(struct spsc_fbuf *fb, uint32_t frames,
+		      const struct spsc_fbuf_watermark *wm);
+
+/**
+ * @brief Claim frames from the buffer.
+ *
+ * Returns the largest continuous span of written frames, up to @p frames,
+ * starting at the read position. The span ends at the end of the buffer so a
+ * request which wraps is satisfied by a second call after freeing the first span.
+ * Claimed frames must be freed using @ref spsc_fbuf_free.
+ *
+ * @note If data cache is used, cache is invalidated on the frames.
+ *
+ * @param[in]  fb	A buffer from which frames are claimed.
+ * @param[in]  frames	Requested number of frames.
+ * @param[out] buf	Location where the span address is written.
+ *
+ * @return Number of frames claimed, which can be smaller than @p frames.
+ */
+uint32_t spsc_fbuf_claim(struct spsc_fbuf *fb, uint32_t frames, void **buf);
+
+/**
+ * @brief Free frames to the buffer.
+ *
+ * @param fb		A buffer from which frames were claimed.
+ * @param frames	Number of frames, at most the number claimed.
+ * @param wm		Optional watermark. Its callback is called if the fill
+ *			level was above and is now at or below the watermark level.
+ */
+void spsc_fbuf_free(struct spsc_fbuf *fb, uint32_t frames,
+		    const struct spsc_fbuf_watermark *wm);
+
+/**
+ * @brief Write frames to the buffer.
+ *
+ * It copies the frames using @ref spsc_fbuf_alloc and @ref spsc_fbuf_commit,
+ * wrapping as needed.
+ *
+ * @param fb		A buffer to which to write.
+ * @param buf		Pointer to the frames to be written.
+ * @param frames	Number of frames to write.
+ * @param wm		Optional watermark, see @ref spsc_fbuf_commit.
+ *
+ * @return Number of frames written, smaller than @p frames if the buffer is full.
+ */
+uint32_t spsc_fbuf_write(struct spsc_fbuf *fb, const void *buf, uint32_t frames,
+			 const struct spsc_fbuf_watermark *wm);
+
+/**
+ * @brief Read frames from the buffer.
+ *
+ * It copies the frames using @ref spsc_fbuf_claim and @ref spsc_fbuf_free,
+ * wrapping as needed.
+ *
+ * @param fb		A buffer from which to read.
+ * @param buf		Pointer to which the frames are copied.
+ * @param frames	Number of frames to read.
+ * @param wm		Optional watermark, see @ref spsc_fbuf_free.
+ *
+ * @return Number of frames read, smaller than @p frames if the buffer is empty.
+ */
+uint32_t spsc_fbuf_read(struct spsc_fbuf *fb, void *buf, uint32_t frames,
+			const struct spsc_fbuf_watermark *wm);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SPSC_FBUF_H_ */
@@ -47,6 +47,29 @@ extern "C" {
  * locked operation.
  */
 
+/* Number of chunk size classes cached by CONFIG_SYS_HEAP_TCACHE, and an
+ * upper bound of the room the caches take in the heap header
+ */
+#ifdef CONFIG_SYS_HEAP_TCACHE
+#define Z_HEAP_TCACHE_CLASSES (CONFIG_SYS_HEAP_TCACHE_MAX_BYTES / 8 + 3)
+#define Z_HEAP_TCACHE_SIZE \
+	(CONFIG_MP_MAX_NUM_CPUS * ((Z_HEAP_TCACHE_CLASSES * 5 + 7) & ~7))
+#else
+#define Z_HEAP_TCACHE_SIZE 0
+#endif
+
+/** Number of allocation latency histogram bins in @ref sys_heap_frag_stats */
+#define SYS_HEAP_LATENCY_BINS 16
+
+/** Number of free list buckets reported in @ref sys_heap_frag_stats */
+#define SYS_HEAP_FRAG_BUCKETS 32
+
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+#define Z_HEAP_FRAG_STATS_SIZE (SYS_HEAP_LATENCY_BINS * 4)
+#else
+#define Z_HEAP_FRAG_STATS_SIZE 0
+#endif
+
 /* Note: the init_mem/bytes fields are for the static initializer to
  * have somewhere to put the arguments.  The actual heap metadata at
  * runtime lives in the heap memory itself and this struct simply
@@ -94,6 +117,49 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
  */
 int sys_heap_runtime_stats_reset_max(struct sys_heap *heap);
 
+/**
+ * @brief Heap fragmentation and allocation latency statistics.
+ */
+struct sys_heap_frag_stats {
+	/** Size of the largest free chunk, the biggest allocation that can
+	 * currently succeed is slightly smaller.
+	 */
+	size_t largest_free_bytes;
+	/** Total number of free chunks. */
+	uint32_t free_chunks;
+	/** Free chunks per bucket, bucket n holds the chunks of at least
+	 * 2^n and less than 2^(n+1) minimum allocation units.
+	 */
+	uint32_t bucket_chunks[SYS_HEAP_FRAG_BUCKETS];
+	/** Allocation calls per duration, bin n counts the calls that took
+	 * at least 2^n and less than 2^(n+1) cycles of k_cycle_get_32(), the
+	 * last bin also counts all longer calls.
+	 */
+	uint32_t alloc_latency[SYS_HEAP_LATENCY_BINS];
+};
+
+/**
+ * @brief Get heap fragmentation and allocation latency statistics.
+ *
+ * The free lists are walked to collect the fragmentation figures, so this
+ * takes time proportional to the number of free chunks.  Like the other
+ * sys_heap functions it must be serialized with use of the heap by the
+ * caller.
+ *
+ * @param heap Pointer to sys_heap
+ * @param stats Pointer to struct to copy statistics into
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int sys_heap_frag_stats_get(struct sys_heap *heap, struct sys_heap_frag_stats *stats);
+
+/**
+ * @brief Clear the allocation latency histogram.
+ *
+ * @param heap Pointer to sys_heap
+ * @return -EINVAL if null pointer was passed, otherwise 0
+ */
+int sys_heap_frag_stats_reset(struct sys_heap *heap);
+
 /** @brief Initialize sys_heap
  *
  * Initializes a sys_heap struct to manage the specified memory.
@@ -2187,6 +2187,29 @@
 
 /** @} */ /* end of subsys_tracing_apis_net */
 
+/**
+ * @brief Bluetooth ISO Tracing APIs
+ * @defgroup subsys_tracing_apis_bt_iso Bluetooth ISO Tracing APIs
+ * @{
+ */
+
+/**
+ * @brief Trace an ISO SDU handed to the recv callback of its channel
+ * @param chan ISO channel
+ * @param seq_num Sequence number of the SDU
+ * @param flags Flags of the SDU, see BT_ISO_FLAGS_VALID and others
+ */
+#define sys_port_trace_bt_iso_recv(chan, seq_num, flags)
+
+/**
+ * @brief Trace an ISO SDU queued for sending
+ * @param chan ISO channel
+ * @param seq_num Sequence number of the SDU
+ */
+#define sys_port_trace_bt_iso_send(chan, seq_num)
+
+/** @} */ /* end of subsys_tracing_apis_bt_iso */
+
 /**
  * @brief Network Socket Tracing APIs
  * @defgroup subsys_tracing_apis_socket Network Socket Tracing APIs
@@ -36,6 +36,20 @@ struct usbd_midi_ops {
 	 */
 	void (*rx_packet_cb)(const struct device *dev, const struct midi_ump ump);
 
+	/**
+	 * @brief Callback type for batches of incoming Universal MIDI Packets
+	 *
+	 * If set, this callback is used instead of @ref rx_packet_cb and is
+	 * called with all packets received in a single transfer, in chunks of
+	 * at most @kconfig{CONFIG_USBD_MIDI2_RX_BATCH_SIZE} packets.
+	 *
+	 * @param[in]  dev    The MIDI2 device receiving the packets
+	 * @param[in]  umps   The received packets in Universal MIDI Packet format
+	 * @param[in]  count  Number of packets in umps
+	 */
+	void (*rx_packets_cb)(const struct device *dev, const struct midi_ump *umps,
+			      size_t count);
+
 	/**
 	 * @brief Callback type for MIDI2 interface runtime status change
 	 * @param[in]  dev    The MIDI2 device
@@ -46,6 +60,13 @@ struct usbd_midi_ops {
 
 /**
  * @brief      Send a Universal MIDI Packet to the host
+ *
+ * The packet is stored in the TX queue and sent to the host together with
+ * other queued packets, either as soon as the bulk IN endpoint is idle or,
+ * if @kconfig{CONFIG_USBD_MIDI2_TX_FLUSH_TIMEOUT} is not zero, when a
+ * max-packet-size worth of packets is queued or the timeout expires. The
+ * timeout has the granularity of the system clock tick.
+ *
  * @param[in]  dev   The MIDI2 device
  * @param[in]  ump   The packet to send, in Universal MIDI Packet format
  * @return     0 on success, all other values should be treated as error
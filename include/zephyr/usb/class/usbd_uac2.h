@@ -68,6 +68,26 @@ struct uac2_ops {
 	void (*terminal_update_cb)(const struct device *dev, uint8_t terminal,
 				   bool enabled, bool microframes,
 				   void *user_data);
+	/**
+	 * @brief Audio format update callback
+	 *
+	 * Notifies application about audio format of the alternate setting
+	 * host is enabling. The callback is called before @ref
+	 * terminal_update_cb every time host enables a terminal, so the
+	 * application can reconfigure its audio path (e.g. I2S word size)
+	 * without re-enumeration. Additional formats are declared with
+	 * additional-subslot-sizes and additional-bit-resolutions devicetree
+	 * properties. This callback is optional.
+	 *
+	 * @param dev USB Audio 2 device
+	 * @param terminal Terminal ID linked to AudioStreaming interface
+	 * @param subslot_size Number of bytes occupied by one audio subslot
+	 * @param bit_resolution Number of effectively used bits in subslot
+	 * @param user_data Opaque user data pointer
+	 */
+	void (*format_update_cb)(const struct device *dev, uint8_t terminal,
+				 uint8_t subslot_size, uint8_t bit_resolution,
+				 void *user_data);
 	/**
 	 * @brief Get receive buffer address
 	 *
@@ -197,6 +217,42 @@ void usbd_uac2_set_ops(const struct device *dev,
 int usbd_uac2_send(const struct device *dev, uint8_t terminal,
 		   void *data, uint16_t size);
 
+/**
+ * @brief Bind AudioStreaming terminal to I2S device
+ *
+ * Audio data of a bound terminal is exchanged directly between the USB stack
+ * and the I2S device, without involving application data callbacks and
+ * without copying. Data from host is received to blocks allocated from the
+ * I2S TX memory slab and queued with i2s_write(). Blocks returned by
+ * i2s_read() are sent to host on SOF and freed back to the I2S RX memory slab
+ * once sent. Requires @kconfig{CONFIG_USBD_UAC2_I2S}.
+ *
+ * The I2S stream must be configured before host enables the terminal. I2S TX
+ * block size must be at least the endpoint wMaxPacketSize. Every packet is
+ * queued with i2s_write() using the number of bytes actually received, which
+ * varies between packets (e.g. at 44.1 kHz) and is usually smaller than the
+ * block size, so the I2S driver must transfer only the size passed to
+ * i2s_write() and not assume full blocks. Every I2S RX block is
+ * sent as single packet, so I2S RX block size must match the amount of data
+ * sent on every SOF and I2S RX timeout must be 0. The class starts I2S TX
+ * after @kconfig{CONFIG_USBD_UAC2_I2S_TX_PREFILL} blocks are queued, starts
+ * I2S RX when host enables the terminal and drops the I2S stream when host
+ * disables the terminal. Terminal update and feedback callbacks are called
+ * as usual.
+ *
+ * Must be called before usbd_uac2_set_ops().
+ *
+ * @param dev USB Audio 2 device
+ * @param terminal Terminal ID linked to AudioStreaming interface
+ * @param i2s_dev I2S device, or NULL to exchange data through application
+ *                callbacks
+ *
+ * @retval 0 on success
+ * @retval -ENOENT if terminal is not linked to isochronous data endpoint
+ */
+int usbd_uac2_i2s_bind(const struct device *dev, uint8_t terminal,
+		       const struct device *i2s_dev);
+
 /**
  * @}
  */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief USB Audio Class 2 host public header
+ *
+ * This header describes only class API interaction with application.
+ * The class captures audio from the first AudioStreaming interface with
+ * an isochronous IN endpoint of a connected USB Audio Class 2 device.
+ *
+ * This API is currently considered experimental.
+ */
+
+#ifndef ZEPHYR_INCLUDE_USB_CLASS_USBH_UAC2_H_
+#define ZEPHYR_INCLUDE_USB_CLASS_USBH_UAC2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief USB Audio Class 2 host API
+ * @defgroup usbh_uac2 USB Audio Class 2 host API
+ * @ingroup usb
+ * @since 4.3
+ * @version 0.1.0
+ * @{
+ */
+
+/**
+ * @brief USB Audio Class 2 host capture configuration
+ *
+ * Received audio data is stored in blocks allocated from the memory slab,
+ * the same way as I2S RX data is.
+ */
+struct usbh_uac2_cfg {
+	/** Memory slab to allocate RX blocks from */
+	struct k_mem_slab *mem_slab;
+	/** Size of a single RX block in bytes, at most the slab block size */
+	size_t block_size;
+	/** Sample rate in Hz to set on the device clock, 0 to keep current */
+	uint32_t sample_rate;
+	/** Required number of channels, 0 for any */
+	uint8_t channels;
+	/** Required subslot size in bytes, 0 for any */
+	uint8_t subslot_size;
+	/** Required bit resolution, 0 for any */
+	uint8_t bit_resolution;
+};
+
+/**
+ * @brief Configure USB Audio Class 2 host capture
+ *
+ * Must be called before a device is connected. Audio capture starts when
+ * a device with a matching AudioStreaming interface is connected and stops
+ * when the device is removed.
+ *
+ * @param cfg Capture configuration
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the configuration is invalid
+ * @retval -EBUSY if audio capture is already running
+ */
+int usbh_uac2_configure(const struct usbh_uac2_cfg *cfg);
+
+/**
+ * @brief Read a block of captured audio data
+ *
+ * The semantics match i2s_read(). The block must be freed with
+ * k_mem_slab_free() to the memory slab set in the configuration once the
+ * application no longer needs it.
+ *
+ * @param mem_block Pointer to the RX block containing received data
+ * @param size Pointer to the variable storing the number of bytes read
+ * @param timeout Waiting period for a block to become available
+ *
+ * @retval 0 on success
+ * @retval -EIO if no device is streaming and there is no data to read
+ * @retval -EAGAIN if the timeout expired
+ */
+int usbh_uac2_read(void **mem_block, size_t *size, k_timeout_t timeout);
+
+/**
+ * @brief Get the number of audio bytes dropped since capture started
+ *
+ * Data is dropped when no RX block can be allocated from the memory slab or
+ * when the RX queue is full.
+ *
+ * @return Number of dropped bytes
+ */
+uint32_t usbh_uac2_dropped(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_USB_CLASS_USBH_UAC2_H_ */
@@ -299,6 +299,8 @@ struct usbd_context {
 	sys_dlist_t vreqs;
 	/** Status of the USB device support */
 	struct usbd_status status;
+	/** Bitmap of enabled isochronous endpoints */
+	uint32_t iso_ep_bm;
 	/** Pointer to Full-Speed device descriptor */
 	void *fs_desc;
 	/** Pointer to High-Speed device descriptor */
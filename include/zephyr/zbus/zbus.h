@@ -24,6 +24,8 @@ extern "C" {
  * @{
  */
 
+struct net_buf;
+
 /**
  * @brief Type used to represent a channel mutable data.
  *
@@ -71,6 +73,11 @@ struct zbus_channel_data {
 	/** Number of times data has been published to this channel */
 	uint32_t publish_count;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Message sequence counter. Odd while zbus_chan_seq_pub() is writing the message. */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
 };
 
 /**
@@ -394,6 +401,29 @@ struct zbus_channel_observation {
 	/* Create all channel observations from observers list */                                  \
 	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
 
+/**
+ * @brief Zbus buffer channel definition.
+ *
+ * This macro defines a channel whose message is a reference counted net_buf. The channel only
+ * stores a reference to the last buffer published with zbus_chan_pub_buf(), which starts as NULL.
+ * Listeners access it with zbus_chan_buf() and message subscribers receive their own reference
+ * with zbus_sub_wait_buf(). Do not use zbus_chan_pub(), zbus_chan_read() or zbus_chan_notify()
+ * with buffer channels.
+ *
+ * @param _name The channel's name.
+ * @param _validator The validator function. It is called with the buffer's data and length.
+ * @param _user_data A pointer to the user data.
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ */
+#define ZBUS_BUF_CHAN_DEFINE(_name, _validator, _user_data, _observers)                            \
+	static struct net_buf *_ZBUS_MESSAGE_NAME(_name);                                          \
+	_ZBUS_CHAN_DEFINE(_name, ZBUS_CHAN_ID_INVALID, struct net_buf *, _validator, _user_data);  \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
 /**
  * @brief Zbus channel definition with numeric identifier.
  *
@@ -597,6 +627,108 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
  */
 int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+
+/**
+ * @brief Publish to a single writer channel
+ *
+ * This routine publishes a message to a channel without locking it. The message is written under
+ * the channel's sequence counter, so readers using zbus_chan_seq_read() never block and are never
+ * boosted. The channel is only locked to notify its observers, if it has any.
+ *
+ * @warning Only one thread may publish to the channel, and only with this routine. Other threads
+ * must read the channel with zbus_chan_seq_read() instead of zbus_chan_read() or claiming it.
+ *
+ * @param chan The channel's reference.
+ * @param msg Reference to the message where the publish function copies the channel's
+ * message data from.
+ * @param timeout Waiting period to notify the channel's observers,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The message is invalid based on the validator function or some of the
+ * observers could not receive the notification.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, the notification could not be sent to one or more
+ * observer, or the function context is invalid (inside an ISR). The function only returns this
+ * value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_seq_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout);
+
+/**
+ * @brief Read a single writer channel
+ *
+ * This routine copies the message of a channel published with zbus_chan_seq_pub() without
+ * locking it. The copy is retried when the publisher changed the message meanwhile, up to
+ * @kconfig{CONFIG_ZBUS_CHANNEL_SEQLOCK_READ_RETRIES} times. It can be used inside ISRs.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] msg Reference to the message where the read function copies the channel's
+ * message data to.
+ *
+ * @retval 0 Channel read.
+ * @retval -EAGAIN The publisher kept changing the message, for instance because the reader
+ * preempted it while it was writing.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_seq_read(const struct zbus_channel *chan, void *msg);
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
+#if defined(CONFIG_ZBUS_BUF_CHANNEL) || defined(__DOXYGEN__)
+
+/**
+ * @brief Publish a buffer to a buffer channel
+ *
+ * This routine publishes a net_buf to a channel defined with ZBUS_BUF_CHAN_DEFINE(). The caller's
+ * reference to the buffer is passed to the channel, which releases the reference to the previously
+ * published buffer. Message subscribers receive clones of the buffer, sharing its data when the
+ * buffer's pool supports data references. The reference is consumed even when publishing fails.
+ *
+ * @note With @kconfig{CONFIG_ZBUS_MSG_SUBSCRIBER} the buffer's user data must be large enough to
+ * hold a channel reference.
+ *
+ * @param chan The channel's reference.
+ * @param buf The buffer to publish.
+ * @param timeout Waiting period to publish the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The message is invalid based on the validator function or some of the
+ * observers could not receive the notification.
+ * @retval -ENOMEM A message subscriber's clone of the buffer could not be allocated.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, the notification could not be sent to one or more
+ * observer, or the function context is invalid (inside an ISR). The function only returns this
+ * value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_pub_buf(const struct zbus_channel *chan, struct net_buf *buf, k_timeout_t timeout);
+
+/**
+ * @brief Read a buffer channel
+ *
+ * This routine takes a new reference to the last buffer published to a channel defined with
+ * ZBUS_BUF_CHAN_DEFINE(). The caller must release it with net_buf_unref().
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] buf The buffer's reference.
+ * @param[in] timeout Waiting period to read the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel read.
+ * @retval -ENODATA No buffer was published to the channel yet.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_read_buf(const struct zbus_channel *chan, struct net_buf **buf, k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_BUF_CHANNEL */
+
 /**
  * @brief Claim a channel
  *
@@ -730,6 +862,28 @@ static inline const void *zbus_chan_const_msg(const struct zbus_channel *chan)
 	return chan->message;
 }
 
+/**
+ * @brief Get the buffer of a buffer channel directly.
+ *
+ * This routine returns the last buffer published to a channel defined with ZBUS_BUF_CHAN_DEFINE()
+ * without taking a reference. Listeners should use it to access the message.
+ *
+ * @warning This function must only be used directly for already locked channels. This
+ * can be done inside a listener for the receiving channel or after claim a channel. Take a
+ * reference with net_buf_ref() to keep the buffer afterwards.
+ *
+ * @param chan The channel's constant reference.
+ *
+ * @return The channel's buffer, or NULL if nothing was published yet.
+ */
+static inline struct net_buf *zbus_chan_buf(const struct zbus_channel *chan)
+{
+	__ASSERT(chan != NULL, "chan is required");
+	__ASSERT(chan->message_size == sizeof(struct net_buf *), "chan must be a buffer channel");
+
+	return *(struct net_buf **)chan->message;
+}
+
 /**
  * @brief Get the channel's message size.
  *
@@ -1126,6 +1280,30 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan, void *msg,
 		      k_timeout_t timeout);
 
+/**
+ * @brief Wait for a channel message buffer.
+ *
+ * This routine makes the subscriber wait for the new message in case of channel publication, like
+ * zbus_sub_wait_msg(), but returns the received buffer instead of copying the message out of it.
+ * For channels defined with ZBUS_BUF_CHAN_DEFINE() this is a reference to the published buffer's
+ * data, for other channels the buffer holds a copy of the message. The caller must release the
+ * buffer with net_buf_unref().
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[out] chan The notification channel's reference.
+ * @param[out] buf The received buffer.
+ * @param[in] timeout Waiting period for a notification arrival,
+ *                or one of the special values, K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -EINVAL The observer is not a subscriber.
+ * @retval -ENOMSG Could not retrieve the net_buf from the subscriber FIFO.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_wait_buf(const struct zbus_observer *sub, const struct zbus_channel **chan,
+		      struct net_buf **buf, k_timeout_t timeout);
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 /**
@@ -8,12 +8,16 @@
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/kobject.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/toolchain.h>
 
+#include <kernel_internal.h>
+
 /**
  * @brief Initialize state for all static devices.
  *
@@ -130,6 +134,108 @@ size_t z_device_get_all_static(struct device const **devices)
 	return cnt;
 }
 
+#ifdef CONFIG_DEVICE_LAZY_INIT
+static struct k_spinlock lazy_init_lock;
+static sys_slist_t lazy_init_reqs = SYS_SLIST_STATIC_INIT(&lazy_init_reqs);
+
+static void lazy_init_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	/* Devices are in initialization order, so a requested device is
+	 * initialized after the requested devices it depends on.
+	 */
+	STRUCT_SECTION_FOREACH(device, dev) {
+		sys_slist_t done = SYS_SLIST_STATIC_INIT(&done);
+		struct device_init_req *req, *tmp, *prev = NULL;
+		k_spinlock_key_t key;
+		int rc;
+
+		if (!atomic_test_and_clear_bit(&dev->state->init_state, Z_DEVICE_INIT_PENDING)) {
+			continue;
+		}
+
+		rc = z_impl_device_init(dev);
+		if (rc == -EBUSY) {
+			/* device_init() is running in another context, it kicks
+			 * the work again when done unless it is already done.
+			 */
+			atomic_set_bit(&dev->state->init_state, Z_DEVICE_INIT_PENDING);
+			z_device_lazy_init_kick(dev);
+			continue;
+		} else if (rc == -EALREADY) {
+			rc = -(int)dev->state->init_res;
+		}
+
+		key = k_spin_lock(&lazy_init_lock);
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&lazy_init_reqs, req, tmp, node) {
+			if (req->dev == dev) {
+				sys_slist_remove(&lazy_init_reqs, prev == NULL ? NULL : &prev->node,
+						 &req->node);
+				sys_slist_append(&done, &req->node);
+			} else {
+				prev = req;
+			}
+		}
+		k_spin_unlock(&lazy_init_lock, key);
+
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&done, req, tmp, node) {
+			req->cb(dev, rc, req->user_data);
+		}
+	}
+}
+
+static K_WORK_DEFINE(lazy_init_work, lazy_init_handler);
+
+void z_device_lazy_init_kick(const struct device *dev)
+{
+	if (atomic_test_bit(&dev->state->init_state, Z_DEVICE_INIT_PENDING) &&
+	    !atomic_test_bit(&dev->state->init_state, Z_DEVICE_INIT_RUNNING)) {
+		(void)k_work_submit(&lazy_init_work);
+	}
+}
+
+int device_init_async(const struct device *dev, struct device_init_req *req,
+		      device_init_cb_t cb, void *user_data)
+{
+	k_spinlock_key_t key = k_spin_lock(&lazy_init_lock);
+	bool was_pending;
+
+	if (dev->state->initialized) {
+		k_spin_unlock(&lazy_init_lock, key);
+		return -EALREADY;
+	}
+
+	/* Marked pending before the submission, so that the work cannot
+	 * miss it, and unmarked if the submission fails.
+	 */
+	was_pending = atomic_test_and_set_bit(&dev->state->init_state, Z_DEVICE_INIT_PENDING);
+	if (req != NULL) {
+		req->dev = dev;
+		req->cb = cb;
+		req->user_data = user_data;
+		sys_slist_append(&lazy_init_reqs, &req->node);
+	}
+	k_spin_unlock(&lazy_init_lock, key);
+
+	/* Fails before the system work queue is started */
+	if (k_work_submit(&lazy_init_work) < 0) {
+		key = k_spin_lock(&lazy_init_lock);
+		if (req != NULL) {
+			(void)sys_slist_find_and_remove(&lazy_init_reqs, &req->node);
+		}
+		if (!was_pending) {
+			atomic_clear_bit(&dev->state->init_state, Z_DEVICE_INIT_PENDING);
+		}
+		k_spin_unlock(&lazy_init_lock, key);
+
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DEVICE_LAZY_INIT */
+
 bool z_impl_device_is_ready(const struct device *dev)
 {
 	/*
@@ -140,6 +246,15 @@ bool z_impl_device_is_ready(const struct device *dev)
 		return false;
 	}
 
+#ifdef CONFIG_DEVICE_LAZY_INIT
+	/* First use of a deferred device starts its initialization */
+	if (!dev->state->initialized &&
+	    !atomic_test_bit(&dev->state->init_state, Z_DEVICE_INIT_PENDING) &&
+	    ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) != 0U)) {
+		(void)device_init_async(dev, NULL, NULL, NULL);
+	}
+#endif
+
 	return dev->state->initialized && (dev->state->init_res == 0U);
 }
 
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2021 Intel Corporation
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,10 +11,18 @@
  * Event objects are used to signal one or more threads that a custom set of
  * events has occurred. Threads wait on event objects until another thread or
  * ISR posts the desired set of events to the event object. Each time events
- * are posted to an event object, all threads waiting on that event object are
- * processed to determine if there is a match. All threads that whose wait
- * conditions match the current set of events now belonging to the event object
- * are awakened.
+ * are posted to an event object, the threads waiting for one of the events
+ * being set are processed to determine if there is a match. All threads that
+ * whose wait conditions match the current set of events now belonging to the
+ * event object are awakened.
+ *
+ * Waiters are spread over CONFIG_EVENTS_WAIT_Q_PARTITIONS wait queues by the
+ * lowest event of their wait mask, and each wait queue keeps the union of the
+ * wait masks of its waiters. A waiter that did not match before a post can
+ * only match after it if one of its events was set, so the wait queues without
+ * waiters for those events are skipped. The unions only grow when threads pend
+ * and are recomputed when the wait queue is walked, so they may include the
+ * masks of threads that timed out since, which only costs an extra walk.
  *
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
@@ -43,6 +52,7 @@
 struct event_walk_data {
 	struct k_thread  *head;
 	uint32_t events;
+	uint32_t waiting;
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -58,7 +68,10 @@ void z_impl_k_event_init(struct k_event *event)
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
-	z_waitq_init(&event->wait_q);
+	for (unsigned int i = 0; i < ARRAY_SIZE(event->wait_q); i++) {
+		z_waitq_init(&event->wait_q[i]);
+		event->waiting[i] = 0;
+	}
 
 	k_object_init(event);
 
@@ -100,6 +113,11 @@ static bool are_wait_conditions_met(uint32_t desired, uint32_t current,
 	return match != 0;
 }
 
+static inline unsigned int event_wait_q_index(uint32_t desired)
+{
+	return (find_lsb_set(desired) - 1) % Z_EVENT_WAIT_Q_PARTITIONS;
+}
+
 static int event_walk_op(struct k_thread *thread, void *data)
 {
 	unsigned int      wait_condition;
@@ -125,6 +143,8 @@ static int event_walk_op(struct k_thread *thread, void *data)
 		thread->next_event_link = event_data->head;
 		event_data->head = thread;
 		z_abort_timeout(&thread->base.timeout);
+	} else {
+		event_data->waiting |= thread->events;
 	}
 
 	return 0;
@@ -137,6 +157,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
+	uint32_t set_events;
 
 	data.head = NULL;
 	key = k_spin_lock(&event->lock);
@@ -147,6 +168,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	previous_events = event->events & events_mask;
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
+	set_events = events & ~event->events;
 	event->events = events;
 	data.events = events;
 	/*
@@ -154,12 +176,21 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * It is desirable to unpend all affected threads simultaneously. This
 	 * is done in three steps:
 	 *
-	 * 1. Walk the waitq and create a linked list of threads to unpend.
+	 * 1. Walk the waitqs with waiters for the events being set, and create
+	 *    a linked list of threads to unpend.
 	 * 2. Unpend each of the threads in the linked list
 	 * 3. Ready each of the threads in the linked list
 	 */
 
-	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+	for (unsigned int i = 0; i < ARRAY_SIZE(event->wait_q); i++) {
+		if ((event->waiting[i] & set_events) == 0) {
+			continue;
+		}
+
+		data.waiting = 0;
+		z_sched_waitq_walk(&event->wait_q[i], event_walk_op, &data);
+		event->waiting[i] = data.waiting;
+	}
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -244,6 +275,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 {
 	uint32_t  rv = 0;
 	unsigned int  wait_condition;
+	unsigned int  index;
 	struct k_thread  *thread;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
@@ -290,10 +322,13 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	thread->events = events;
 	thread->event_options = options;
 
+	index = event_wait_q_index(events);
+	event->waiting[index] |= events;
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
-	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+	if (z_pend_curr(&event->lock, key, &event->wait_q[index], timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
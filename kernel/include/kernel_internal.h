@@ -67,6 +67,11 @@ FUNC_NORETURN void z_cstart(void);
 
 void z_device_state_init(void);
 
+#ifdef CONFIG_DEVICE_LAZY_INIT
+/* Submit the lazy initialization work if a request for @p dev is pending */
+void z_device_lazy_init_kick(const struct device *dev);
+#endif
+
 extern FUNC_NORETURN void z_thread_entry(k_thread_entry_t entry,
 			  void *p1, void *p2, void *p3);
 
@@ -147,6 +152,20 @@ extern struct k_thread z_main_thread;
 #ifdef CONFIG_MULTITHREADING
 extern struct k_thread z_idle_threads[CONFIG_MP_MAX_NUM_CPUS];
 #endif /* CONFIG_MULTITHREADING */
+
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+extern struct k_work_q *const z_sys_work_q_cpu[CONFIG_MP_MAX_NUM_CPUS];
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
+
+/* System work queue of the calling CPU, only a hint unless it cannot migrate */
+static inline struct k_work_q *z_sys_work_q_local(void)
+{
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+	return z_sys_work_q_cpu[arch_curr_cpu()->id];
+#else
+	return &k_sys_work_q;
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
+}
 K_KERNEL_PINNED_STACK_ARRAY_DECLARE(z_interrupt_stacks, CONFIG_MP_MAX_NUM_CPUS,
 				    CONFIG_ISR_STACK_SIZE);
 K_THREAD_STACK_DECLARE(z_main_stack, CONFIG_MAIN_STACK_SIZE);
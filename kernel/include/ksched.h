@@ -61,6 +61,7 @@ void z_reschedule_irqlock(uint32_t key);
 void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
 bool z_thread_prio_set(struct k_thread *thread, int prio);
+bool z_thread_running_elsewhere(struct k_thread *thread);
 void *z_get_next_switch_handle(void *interrupted);
 
 void z_time_slice(void);
@@ -328,12 +329,46 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+/**
+ * @brief Ends the current job of a periodic thread
+ *
+ * Counts a budget overrun if @p thread ran for more than @p budget cycles
+ * since the previous call, then starts accounting the next job. A zero
+ * @p budget only restarts the accounting.
+ */
+void z_sched_usage_job_end(struct k_thread *thread, uint32_t budget);
+
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+/**
+ * @brief Timestamps a thread being made ready
+ *
+ * Only the first call after the thread last ran is recorded.
+ */
+void z_sched_latency_ready(struct k_thread *thread);
+
+/**
+ * @brief Records the ready to run latency of a thread being switched in
+ */
+void z_sched_latency_switch(struct k_thread *thread);
+#else
+static inline void z_sched_latency_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+
+static inline void z_sched_latency_switch(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	z_sched_usage_stop();
 	z_sched_usage_start(thread);
+	z_sched_latency_switch(thread);
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 }
 
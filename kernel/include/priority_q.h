@@ -184,10 +184,20 @@ static ALWAYS_INLINE struct k_thread *z_priq_simple_mask_best(sys_dlist_t *pq)
 #endif /* CONFIG_SCHED_CPU_MASK */
 
 #if defined(CONFIG_SCHED_SCALABLE) || defined(CONFIG_WAITQ_SCALABLE)
+#ifdef CONFIG_PRIQ_BTREE
+#define Z_PRIQ_RB_FOR_EACH_CONTAINER BTREE_FOR_EACH_CONTAINER
+#define z_priq_rb_insert	     btree_insert
+#define z_priq_rb_delete	     btree_remove
+#define z_priq_rb_get_min	     btree_get_min
+#else
+#define Z_PRIQ_RB_FOR_EACH_CONTAINER RB_FOR_EACH_CONTAINER
+#define z_priq_rb_insert	     rb_insert
+#define z_priq_rb_delete	     rb_remove
+#define z_priq_rb_get_min	     rb_get_min
+#endif
+
 static ALWAYS_INLINE void z_priq_rb_init(struct _priq_rb *pq)
 {
-	bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
-
 	*pq = (struct _priq_rb) {
 		.tree = {
 			.lessthan_fn = z_priq_rb_lessthan,
@@ -209,18 +219,18 @@ static ALWAYS_INLINE void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *th
 	 * a latency glitch to loop over all the threads like this.
 	 */
 	if (!pq->next_order_key) {
-		RB_FOR_EACH_CONTAINER(&pq->tree, t, base.qnode_rb) {
+		Z_PRIQ_RB_FOR_EACH_CONTAINER(&pq->tree, t, base.qnode_rb) {
 			t->base.order_key = pq->next_order_key;
 			++pq->next_order_key;
 		}
 	}
 
-	rb_insert(&pq->tree, &thread->base.qnode_rb);
+	z_priq_rb_insert(&pq->tree, &thread->base.qnode_rb);
 }
 
 static ALWAYS_INLINE void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread)
 {
-	rb_remove(&pq->tree, &thread->base.qnode_rb);
+	z_priq_rb_delete(&pq->tree, &thread->base.qnode_rb);
 
 	if (!pq->tree.root) {
 		pq->next_order_key = 0;
@@ -238,7 +248,7 @@ static ALWAYS_INLINE void z_priq_rb_yield(struct _priq_rb *pq)
 static ALWAYS_INLINE struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 {
 	struct k_thread *thread = NULL;
-	struct rbnode *n = rb_get_min(&pq->tree);
+	__typeof__(thread->base.qnode_rb) *n = z_priq_rb_get_min(&pq->tree);
 
 	if (n != NULL) {
 		thread = CONTAINER_OF(n, struct k_thread, base.qnode_rb);
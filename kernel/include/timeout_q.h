@@ -28,6 +28,9 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	to->queue = 0U;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 }
 
 /* Adds the timeout to the queue.
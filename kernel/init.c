@@ -346,6 +346,206 @@ static inline bool is_entry_about_service(const void *obj)
 		obj < (void *)_service_list_end);
 }
 
+#ifdef CONFIG_INIT_PROFILE
+static struct init_profile_record init_profile_records[CONFIG_INIT_PROFILE_MAX_ENTRIES];
+static atomic_t init_profile_count;
+
+static inline uint32_t init_profile_enter(void)
+{
+	return k_cycle_get_32();
+}
+
+static void init_profile_exit(const struct init_entry *entry, enum init_level level,
+			      uint32_t start, int result)
+{
+	uint32_t end = k_cycle_get_32();
+	atomic_val_t idx = atomic_inc(&init_profile_count);
+
+	if (idx >= ARRAY_SIZE(init_profile_records)) {
+		return;
+	}
+
+	init_profile_records[idx] = (struct init_profile_record){
+		.entry = entry,
+		.start = start,
+		.cycles = end - start,
+		.result = result,
+		.level = level,
+		.is_device = !is_entry_about_service(entry->_init_object),
+	};
+}
+
+size_t init_profile_get(const struct init_profile_record **records)
+{
+	*records = init_profile_records;
+
+	return MIN((size_t)atomic_get(&init_profile_count), ARRAY_SIZE(init_profile_records));
+}
+#else
+static inline uint32_t init_profile_enter(void)
+{
+	return 0;
+}
+
+static inline void init_profile_exit(const struct init_entry *entry, enum init_level level,
+				     uint32_t start, int result)
+{
+	ARG_UNUSED(entry);
+	ARG_UNUSED(level);
+	ARG_UNUSED(start);
+	ARG_UNUSED(result);
+}
+#endif /* CONFIG_INIT_PROFILE */
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/* Consecutive device entries of one level initialized by a pool of threads */
+struct init_parallel {
+	const struct init_entry *start;
+	const struct init_entry *next;
+	const struct init_entry *end;
+	enum init_level level;
+	struct k_mutex lock;
+	struct k_condvar done;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(init_parallel_stacks, CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_parallel_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+/* A dependency is pending if it is initialized by the same run and has not completed yet.
+ * Dependencies from earlier levels or runs are complete, and those placed after the
+ * device in the run are ignored as they would be with serial initialization.
+ */
+static bool init_parallel_pending(const struct init_parallel *ip,
+				  const struct init_entry *entry,
+				  const device_handle_t *handles, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		const struct device *dep = device_from_handle(handles[i]);
+
+		if ((dep == NULL) || dep->state->initialized ||
+		    ((dep->flags & DEVICE_FLAG_INIT_DEFERRED) != 0U)) {
+			continue;
+		}
+
+		for (const struct init_entry *e = ip->start; e < entry; e++) {
+			if (e->dev == dep) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static bool init_parallel_ready(const struct init_parallel *ip, const struct init_entry *entry)
+{
+	const device_handle_t *handles;
+	size_t count;
+
+	if (entry->_init_object == NULL) {
+		return true;
+	}
+
+	handles = device_required_handles_get(entry->dev, &count);
+	if (init_parallel_pending(ip, entry, handles, count)) {
+		return false;
+	}
+
+	handles = device_injected_handles_get(entry->dev, &count);
+
+	return !init_parallel_pending(ip, entry, handles, count);
+}
+
+static void init_parallel_worker(void *p1, void *p2, void *p3)
+{
+	struct init_parallel *ip = p1;
+	const struct init_entry *entry;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		uint32_t start;
+		int result = 0;
+
+		/* Entries are taken in link order, so everything a device waits
+		 * for has already been taken by another thread.
+		 */
+		k_mutex_lock(&ip->lock, K_FOREVER);
+		if (ip->next == ip->end) {
+			k_mutex_unlock(&ip->lock);
+			break;
+		}
+		entry = ip->next++;
+		while (!init_parallel_ready(ip, entry)) {
+			k_condvar_wait(&ip->done, &ip->lock, K_FOREVER);
+		}
+		k_mutex_unlock(&ip->lock);
+
+		if (entry->_init_object == NULL) {
+			continue;
+		}
+
+		sys_trace_sys_init_enter(entry, ip->level);
+		start = init_profile_enter();
+		if ((entry->dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
+			result = do_device_init(entry->dev);
+		}
+		init_profile_exit(entry, ip->level, start, result);
+		sys_trace_sys_init_exit(entry, ip->level, result);
+
+		k_mutex_lock(&ip->lock, K_FOREVER);
+		k_condvar_broadcast(&ip->done);
+		k_mutex_unlock(&ip->lock);
+	}
+}
+
+/**
+ * @brief Initialize consecutive devices of a level concurrently
+ *
+ * The calling thread and up to CONFIG_DEVICE_INIT_PARALLEL_THREADS helper threads take the
+ * devices in link order. A device waits for the devices of the run it requires, as given by
+ * devicetree or injected dependencies, so that a device sleeping in its init function lets
+ * unrelated devices make progress. Failures are logged in link order once the run completes.
+ */
+static void z_sys_init_run_devices_parallel(const struct init_entry *start,
+					    const struct init_entry *end,
+					    enum init_level level)
+{
+	static struct init_parallel ip;
+	int prio = k_thread_priority_get(k_current_get());
+	size_t threads = MIN((size_t)(end - start) - 1U, CONFIG_DEVICE_INIT_PARALLEL_THREADS);
+
+	ip.start = start;
+	ip.next = start;
+	ip.end = end;
+	ip.level = level;
+	k_mutex_init(&ip.lock);
+	k_condvar_init(&ip.done);
+
+	for (size_t i = 0; i < threads; i++) {
+		k_thread_create(&init_parallel_threads[i], init_parallel_stacks[i],
+				K_THREAD_STACK_SIZEOF(init_parallel_stacks[i]),
+				init_parallel_worker, &ip, NULL, NULL, prio, 0, K_NO_WAIT);
+		k_thread_name_set(&init_parallel_threads[i], "dev_init");
+	}
+
+	init_parallel_worker(&ip, NULL, NULL);
+
+	for (size_t i = 0; i < threads; i++) {
+		(void)k_thread_join(&init_parallel_threads[i], K_FOREVER);
+	}
+
+	for (const struct init_entry *entry = start; entry < end; entry++) {
+		if ((entry->_init_object != NULL) && (entry->dev->state->init_res != 0U)) {
+			LOG_ERR("Device %s init failed: %d", entry->dev->name,
+				-(int)entry->dev->state->init_res);
+		}
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -374,13 +574,34 @@ static void z_sys_init_run_level(enum init_level level)
 	const struct init_entry *entry;
 
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+		uint32_t start;
 		int result = 0;
 
 		if (unlikely(entry->_init_object == NULL)) {
 			continue;
 		}
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		/* Services have no dependency information and keep running
+		 * alone, in order, between runs of devices.
+		 */
+		if (((level == INIT_LEVEL_POST_KERNEL) || (level == INIT_LEVEL_APPLICATION)) &&
+		    !is_entry_about_service(entry->_init_object)) {
+			const struct init_entry *end = entry + 1;
+
+			while ((end < levels[level+1]) &&
+			       !is_entry_about_service(end->_init_object)) {
+				end++;
+			}
+
+			z_sys_init_run_devices_parallel(entry, end, level);
+			entry = end - 1;
+			continue;
+		}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 		sys_trace_sys_init_enter(entry, level);
+		start = init_profile_enter();
 
 		if (is_entry_about_service(entry->_init_object)) {
 			const struct service *srv = entry->srv;
@@ -394,6 +615,7 @@ static void z_sys_init_run_level(enum init_level level)
 			}
 		}
 
+		init_profile_exit(entry, level, start, result);
 		sys_trace_sys_init_exit(entry, level, result);
 	}
 }
@@ -401,11 +623,29 @@ static void z_sys_init_run_level(enum init_level level)
 
 int z_impl_device_init(const struct device *dev)
 {
+#ifdef CONFIG_DEVICE_LAZY_INIT
+	int rc;
+
+	/* Only one context runs the initialization, a lazy initialization
+	 * request made meanwhile is served once it is done.
+	 */
+	if (atomic_test_and_set_bit(&dev->state->init_state, Z_DEVICE_INIT_RUNNING)) {
+		return -EBUSY;
+	}
+
+	rc = dev->state->initialized ? -EALREADY : do_device_init(dev);
+
+	atomic_clear_bit(&dev->state->init_state, Z_DEVICE_INIT_RUNNING);
+	z_device_lazy_init_kick(dev);
+
+	return rc;
+#else
 	if (dev->state->initialized) {
 		return -EALREADY;
 	}
 
 	return do_device_init(dev);
+#endif
 }
 
 #ifdef CONFIG_USERSPACE
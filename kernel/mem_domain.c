@@ -361,6 +361,14 @@ static int init_mem_domain_module(void)
 	__ASSERT(ret == 0, "failed to add default libc mem partition");
 #endif /* Z_LIBC_PARTITION_EXISTS */
 
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+	/* Application partitions are user writable by default */
+	k_user_time_partition.attr = K_MEM_PARTITION_P_RW_U_RO;
+	ret = k_mem_domain_add_partition(&k_mem_domain_default,
+					 &k_user_time_partition);
+	__ASSERT(ret == 0, "failed to add default user time mem partition");
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
+
 	return 0;
 }
 
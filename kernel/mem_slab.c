@@ -18,6 +18,86 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+/*
+ * The lock-free free list head holds the index of the first free block
+ * plus one (zero meaning empty) in its low half and a counter bumped on
+ * every update in its high half, so a compare-and-swap against a head
+ * that was popped and pushed back in between fails (ABA).  Each free
+ * block stores the index plus one of the next free block.
+ */
+#define SLAB_IDX_BITS (sizeof(atomic_val_t) * 4U)
+#define SLAB_IDX_MASK ((1UL << SLAB_IDX_BITS) - 1UL)
+#define SLAB_TAG_INC  (1UL << SLAB_IDX_BITS)
+
+static inline char *slab_block(struct k_mem_slab *slab, unsigned long idx1)
+{
+	return slab->buffer + (idx1 - 1UL) * slab->info.block_size;
+}
+
+static void *slab_pop(struct k_mem_slab *slab)
+{
+	unsigned long old, next;
+	char *block;
+
+	do {
+		old = (unsigned long)atomic_get(&slab->free_head);
+		if ((old & SLAB_IDX_MASK) == 0UL) {
+			return NULL;
+		}
+		block = slab_block(slab, old & SLAB_IDX_MASK);
+		/* may be stale if the block was taken meanwhile, then the
+		 * tag has changed and the swap fails
+		 */
+		next = *(volatile unsigned long *)block;
+	} while (!atomic_cas(&slab->free_head, (atomic_val_t)old,
+			     (atomic_val_t)(((old & ~SLAB_IDX_MASK) + SLAB_TAG_INC) |
+					    (next & SLAB_IDX_MASK))));
+
+	return block;
+}
+
+static void slab_push(struct k_mem_slab *slab, void *mem)
+{
+	unsigned long idx1 = ((char *)mem - slab->buffer) / slab->info.block_size + 1UL;
+	unsigned long old;
+
+	do {
+		old = (unsigned long)atomic_get(&slab->free_head);
+		*(volatile unsigned long *)mem = old & SLAB_IDX_MASK;
+	} while (!atomic_cas(&slab->free_head, (atomic_val_t)old,
+			     (atomic_val_t)(((old & ~SLAB_IDX_MASK) + SLAB_TAG_INC) | idx1)));
+}
+
+static inline void slab_count_alloc(struct k_mem_slab *slab)
+{
+	atomic_val_t used = atomic_inc(&slab->num_used) + 1;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&slab->max_used);
+	} while ((used > max) && !atomic_cas(&slab->max_used, max, used));
+#else
+	ARG_UNUSED(used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
+
+/* Bring the counters in slab->info up to date, called with the slab lock held */
+static inline void slab_info_sync(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	slab->info.num_used = (uint32_t)atomic_get(&slab->num_used);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = (uint32_t)atomic_get(&slab->max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#else
+	ARG_UNUSED(slab);
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
+}
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -32,6 +112,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
+	slab_info_sync(slab);
 	memcpy(stats, &slab->info, sizeof(slab->info));
 	k_spin_unlock(&slab->lock, key);
 
@@ -48,6 +129,7 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
+	slab_info_sync(slab);
 	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
 			  slab->info.block_size;
 	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
@@ -72,7 +154,11 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab_info_sync(slab);
 	slab->info.max_used = slab->info.num_used;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_set(&slab->max_used, slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -112,6 +198,24 @@ static int create_free_list(struct k_mem_slab *slab)
 	}
 
 	slab->free_list = NULL;
+
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	CHECKIF(slab->info.num_blocks >= SLAB_IDX_MASK) {
+		return -EINVAL;
+	}
+
+	p = slab->buffer;
+	for (uint32_t i = 1; i <= slab->info.num_blocks; i++) {
+		*(unsigned long *)p = (i < slab->info.num_blocks) ? (i + 1UL) : 0UL;
+		p += slab->info.block_size;
+	}
+	atomic_set(&slab->free_head, (slab->info.num_blocks != 0U) ? 1 : 0);
+	atomic_set(&slab->num_used, 0);
+	atomic_set(&slab->waiters, 0);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_set(&slab->max_used, 0);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#else
 	p = slab->buffer + slab->info.block_size * (slab->info.num_blocks - 1);
 
 	for (int i = slab->info.num_blocks - 1; i >= 0; i--) {
@@ -119,6 +223,7 @@ static int create_free_list(struct k_mem_slab *slab)
 		slab->free_list = p;
 		p -= slab->info.block_size;
 	}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 
 	return 0;
 }
@@ -219,6 +324,90 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+
+	*mem = slab_pop(slab);
+	if (*mem != NULL) {
+		slab_count_alloc(slab);
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
+		/* don't wait for a free block to become available */
+		result = -ENOMEM;
+	} else {
+		key = k_spin_lock(&slab->lock);
+
+		/* Announce ourselves before the final check, so that a
+		 * concurrent free either leaves its block for this pop or
+		 * sees the waiter and hands the block over under the lock.
+		 */
+		atomic_inc(&slab->waiters);
+		*mem = slab_pop(slab);
+		if (*mem != NULL) {
+			atomic_dec(&slab->waiters);
+			k_spin_unlock(&slab->lock, key);
+			slab_count_alloc(slab);
+			result = 0;
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
+
+			/* wait for a free block or timeout */
+			result = z_pend_curr(&slab->lock, key, &slab->wait_q, timeout);
+			atomic_dec(&slab->waiters);
+			if (result == 0) {
+				*mem = _current->base.swap_data;
+			}
+		}
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	if (!slab_ptr_is_good(slab, mem)) {
+		__ASSERT(false, "Invalid memory pointer provided");
+		k_panic();
+		return;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	slab_push(slab, mem);
+	atomic_dec(&slab->num_used);
+
+	if (unlikely(atomic_get(&slab->waiters) != 0) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+		void *block = slab_pop(slab);
+
+		if (block != NULL) {
+			struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				slab_count_alloc(slab);
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+				z_thread_return_value_set_with_data(pending_thread, 0, block);
+				z_ready_thread(pending_thread);
+				z_reschedule(&slab->lock, key);
+				return;
+			}
+			slab_push(slab, block);
+		}
+		k_spin_unlock(&slab->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+}
+#else
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -299,6 +488,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 
 	k_spin_unlock(&slab->lock, key);
 }
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
@@ -308,6 +498,7 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+	slab_info_sync(slab);
 	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
 	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
 			    slab->info.block_size;
@@ -332,7 +523,11 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+	slab_info_sync(slab);
 	slab->info.max_used = slab->info.num_used;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_set(&slab->max_used, slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 
 	k_spin_unlock(&slab->lock, key);
 
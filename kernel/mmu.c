@@ -1610,6 +1610,89 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#if CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0
+/* Data pages paged in for a page fault: the faulting one, then the ones read ahead */
+struct page_in_batch {
+	uintptr_t locations[1 + CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	struct k_mem_page_frame *pfs[CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES];
+	uint8_t *addr;
+	size_t count;
+};
+
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread,
+					       size_t count)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.read_ahead.pages += count;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.read_ahead.pages += count;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/*
+ * Take free page frames for the paged out data pages following a faulting
+ * one. Reading ahead never evicts nor uses reserved page frames, and stops
+ * at the first page that is not paged out.
+ */
+static void read_ahead_collect_locked(struct page_in_batch *batch, void *addr,
+				      uintptr_t location)
+{
+	uint8_t *next = (uint8_t *)ROUND_DOWN(POINTER_TO_UINT(addr), CONFIG_MMU_PAGE_SIZE);
+
+	batch->locations[0] = location;
+	batch->addr = next;
+	batch->count = 0;
+
+	while (batch->count < CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES &&
+	       z_free_page_count > CONFIG_DEMAND_PAGING_PAGE_FRAMES_RESERVE) {
+		next += CONFIG_MMU_PAGE_SIZE;
+		if (arch_page_location_get(next, &batch->locations[batch->count + 1]) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		batch->pfs[batch->count] = free_page_frame_list_get();
+		batch->count++;
+	}
+}
+
+/*
+ * Page in the data pages read ahead, with the same steps as a page fault
+ * into a free page frame.
+ */
+static void read_ahead_page_in_locked(struct page_in_batch *batch, k_spinlock_key_t *key)
+{
+	for (size_t i = 0; i < batch->count; i++) {
+		struct k_mem_page_frame *pf = batch->pfs[i];
+		uintptr_t location = batch->locations[i + 1];
+		void *addr = batch->addr + (i + 1) * CONFIG_MMU_PAGE_SIZE;
+
+		arch_mem_scratch(k_mem_page_frame_to_phys(pf));
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_BUSY);
+		k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = k_spin_lock(&z_mm_lock);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		frame_mapped_set(pf, addr);
+		arch_mem_page_in(addr, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, location);
+
+		/* Not accessed until used, so that it is evicted first otherwise */
+		(void)arch_page_info_get(addr, NULL, true);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add_prefetched(pf);
+		}
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0 */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1620,6 +1703,9 @@ static bool do_page_fault(void *addr, bool pin)
 	bool dirty = false;
 	struct k_thread *faulting_thread;
 	int ret;
+#if CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0
+	struct page_in_batch batch;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0 */
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
@@ -1724,6 +1810,15 @@ static bool do_page_fault(void *addr, bool pin)
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
 
+#if CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0
+	if (pin) {
+		/* Pinning is done page by page, without reading ahead */
+		batch.count = 0;
+	} else {
+		read_ahead_collect_locked(&batch, addr, page_in_location);
+	}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0 */
+
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	k_spin_unlock(&z_mm_lock, key);
 	/* Interrupts are now unlocked if they were not locked when we entered
@@ -1734,6 +1829,11 @@ static bool do_page_fault(void *addr, bool pin)
 	if (dirty) {
 		do_backing_store_page_out(page_out_location);
 	}
+#if defined(CONFIG_BACKING_STORE_PAGE_IN_BATCH) && (CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0)
+	if (batch.count > 0) {
+		k_mem_paging_backing_store_page_in_batch(batch.locations, batch.count + 1);
+	}
+#endif
 	do_backing_store_page_in(page_in_location);
 
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1751,6 +1851,10 @@ static bool do_page_fault(void *addr, bool pin)
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
+#if CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0
+	read_ahead_page_in_locked(&batch, &key);
+	paging_stats_read_ahead_inc(faulting_thread, batch.count);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0 */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
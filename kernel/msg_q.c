@@ -199,6 +199,165 @@ static inline int z_vrfy_k_msgq_put(struct k_msgq *msgq, const void *data,
 #include <zephyr/syscalls/k_msgq_put_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* copy @a count messages into the ring buffer, wrapping at most once */
+static void msgq_copy_in(struct k_msgq *msgq, const char *src, uint32_t count)
+{
+	size_t len = (size_t)count * msgq->msg_size;
+	size_t to_end = msgq->buffer_end - msgq->write_ptr;
+
+	if (len >= to_end) {
+		(void)memcpy(msgq->write_ptr, src, to_end);
+		(void)memcpy(msgq->buffer_start, src + to_end, len - to_end);
+		msgq->write_ptr = msgq->buffer_start + (len - to_end);
+	} else {
+		(void)memcpy(msgq->write_ptr, src, len);
+		msgq->write_ptr += len;
+	}
+	msgq->used_msgs += count;
+}
+
+/* copy @a count messages out of the ring buffer, wrapping at most once */
+static void msgq_copy_out(struct k_msgq *msgq, char *dst, uint32_t count)
+{
+	size_t len = (size_t)count * msgq->msg_size;
+	size_t to_end = msgq->buffer_end - msgq->read_ptr;
+
+	if (len >= to_end) {
+		(void)memcpy(dst, msgq->read_ptr, to_end);
+		(void)memcpy(dst + to_end, msgq->buffer_start, len - to_end);
+		msgq->read_ptr = msgq->buffer_start + (len - to_end);
+	} else {
+		(void)memcpy(dst, msgq->read_ptr, len);
+		msgq->read_ptr += len;
+	}
+	msgq->used_msgs -= count;
+}
+
+/* Move up to @a num_msgs messages from @a data into the queue without
+ * blocking, handing them to waiting readers first.  Returns the number
+ * of messages sent.
+ */
+static uint32_t msgq_put_many_locked(struct k_msgq *msgq, const char *data,
+				     uint32_t num_msgs, bool *resched)
+{
+	struct k_thread *pending_thread;
+	uint32_t count = 0U;
+	uint32_t n;
+
+	/* readers only wait on an empty queue */
+	while ((count < num_msgs) && (msgq->used_msgs == 0U)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+		(void)memcpy(pending_thread->base.swap_data, data, msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		data += msgq->msg_size;
+		count++;
+		*resched = true;
+	}
+
+	n = MIN(num_msgs - count, msgq->max_msgs - msgq->used_msgs);
+	if (n > 0U) {
+		msgq_copy_in(msgq, data, n);
+		count += n;
+		*resched = handle_poll_events(msgq) || *resched;
+	}
+
+	return count;
+}
+
+/* Move up to @a max_msgs messages from the queue into @a data without
+ * blocking, then refill the freed slots from waiting writers.  Returns
+ * the number of messages received.
+ */
+static uint32_t msgq_get_many_locked(struct k_msgq *msgq, char *data,
+				     uint32_t max_msgs, bool *resched)
+{
+	struct k_thread *pending_thread;
+	uint32_t count = MIN(max_msgs, msgq->used_msgs);
+
+	if (count == 0U) {
+		return 0U;
+	}
+
+	msgq_copy_out(msgq, data, count);
+
+	/* writers only wait on a full queue */
+	while (msgq->used_msgs < msgq->max_msgs) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+		msgq_copy_in(msgq, pending_thread->base.swap_data, 1U);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		*resched = true;
+	}
+
+	return count;
+}
+
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	uint32_t count;
+	int result;
+	bool resched = false;
+
+	if (num_msgs == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	count = msgq_put_many_locked(msgq, data, num_msgs, &resched);
+	if (count > 0U) {
+		result = (int)count;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* queue is full: wait until the first message is taken, then
+		 * send whatever else fits without waiting again
+		 */
+		_current->base.swap_data = (void *)data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if ((result != 0) || (num_msgs == 1U)) {
+			return (result != 0) ? result : 1;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		count = msgq_put_many_locked(msgq, (const char *)data + msgq->msg_size,
+					     num_msgs - 1U, &resched);
+		result = (int)count + 1;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+					 uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_many_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
@@ -298,6 +457,65 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t max_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	uint32_t count;
+	int result;
+	bool resched = false;
+
+	if (max_msgs == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	count = msgq_get_many_locked(msgq, data, max_msgs, &resched);
+	if (count > 0U) {
+		result = (int)count;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* queue is empty: wait for the first message, then take
+		 * whatever else has arrived without waiting again
+		 */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if ((result != 0) || (max_msgs == 1U)) {
+			return (result != 0) ? result : 1;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		count = msgq_get_many_locked(msgq, (char *)data + msgq->msg_size,
+					     max_msgs - 1U, &resched);
+		result = (int)count + 1;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t max_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, max_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, max_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_many_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
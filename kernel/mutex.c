@@ -33,6 +33,7 @@
 #include <kthread.h>
 #include <wait_q.h>
 #include <errno.h>
+#include <string.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
@@ -50,8 +51,97 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static struct k_obj_type obj_type_mutex;
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static int k_mutex_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &mutex->stats, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_mutex_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mutex *mutex;
+	k_spinlock_key_t key;
+
+	mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+	key = k_spin_lock(&lock);
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mutex_stats_desc = {
+	.raw_size = sizeof(struct k_lock_stats),
+	.query_size = sizeof(struct k_lock_stats),
+	.raw   = k_mutex_stats_raw,
+	.query = k_mutex_stats_raw,
+	.reset = k_mutex_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+static inline uint32_t mutex_stats_time(void)
+{
+	return IS_ENABLED(CONFIG_OBJ_CORE_STATS_MUTEX) ? k_cycle_get_32() : 0U;
+}
+
+/* Statistics are updated with the lock held */
+static inline void mutex_stats_locked(struct k_mutex *mutex)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	mutex->stats.acquired++;
+	mutex->lock_time = k_cycle_get_32();
+#else
+	ARG_UNUSED(mutex);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+}
+
+static inline void mutex_stats_waited(struct k_mutex *mutex, uint32_t wait_start,
+				      bool acquired)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	uint32_t wait = k_cycle_get_32() - wait_start;
+
+	mutex->stats.contended++;
+	mutex->stats.total_wait += wait;
+	mutex->stats.max_wait = MAX(mutex->stats.max_wait, wait);
+
+	if (acquired) {
+		mutex_stats_locked(mutex);
+	}
+#else
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(wait_start);
+	ARG_UNUSED(acquired);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+}
+
+static inline void mutex_stats_unlocked(struct k_mutex *mutex)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	uint32_t hold = k_cycle_get_32() - mutex->lock_time;
+
+	mutex->stats.max_hold = MAX(mutex->stats.max_hold, hold);
+#else
+	ARG_UNUSED(mutex);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+}
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
@@ -64,6 +154,11 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
 #endif /* CONFIG_OBJ_CORE_MUTEX */
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	memset(&mutex->stats, 0, sizeof(mutex->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+				  sizeof(struct k_lock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
 
@@ -102,6 +197,46 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Spin while the owner runs on another CPU, it is likely to release the
+ * mutex sooner than two context switches would take. Polls without the
+ * lock and with preemption enabled, so nothing there may depend on the
+ * current CPU. The lock is taken again before returning. Threads already waiting
+ * get the mutex first on release, there is no point spinning behind them.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	volatile struct k_mutex *m = mutex;
+	uint32_t budget = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	uint32_t start;
+
+	if (z_waitq_head(&mutex->wait_q) != NULL) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	start = k_cycle_get_32();
+	while ((m->lock_count != 0U) && z_thread_running_elsewhere(m->owner) &&
+	       ((k_cycle_get_32() - start) < budget)) {
+		arch_spin_relax();
+	}
+
+	*key = k_spin_lock(&lock);
+
+	return mutex->lock_count == 0U;
+}
+#else
+static inline bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(key);
+
+	return false;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -114,7 +249,12 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
-	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current)) ||
+	    (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) && mutex_spin(mutex, &key))) {
+
+		if (mutex->lock_count == 0U) {
+			mutex_stats_locked(mutex);
+		}
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
 					_current->base.prio :
@@ -153,6 +293,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
+	uint32_t wait_start = mutex_stats_time();
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
@@ -161,6 +302,12 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		got_mutex ? 'y' : 'n');
 
 	if (got_mutex == 0) {
+		if (IS_ENABLED(CONFIG_OBJ_CORE_STATS_MUTEX)) {
+			key = k_spin_lock(&lock);
+			mutex_stats_waited(mutex, wait_start, true);
+			k_spin_unlock(&lock, key);
+		}
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
 		return 0;
 	}
@@ -171,6 +318,8 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+	mutex_stats_waited(mutex, wait_start, false);
+
 	/*
 	 * Check if mutex was unlocked after this thread was unpended.
 	 * If so, skip adjusting owner's priority down.
@@ -251,6 +400,7 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
+	mutex_stats_unlocked(mutex);
 	adjust_owner_prio(mutex, mutex->owner_orig_prio);
 
 	/* Get the new owner, if any */
@@ -299,11 +449,18 @@ static int init_mutex_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &mutex_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 
 	/* Initialize and link statically defined mutexes */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->stats,
+					  sizeof(struct k_lock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 	}
 
 	return 0;
@@ -34,6 +34,11 @@ static inline bool pipe_empty(struct k_pipe *pipe)
 	return ring_buf_is_empty(&pipe->buf);
 }
 
+static inline bool pipe_claimed(struct k_pipe *pipe, uint8_t flag)
+{
+	return (pipe->flags & flag) != 0;
+}
+
 static int wait_for(_wait_q_t *waitq, struct k_pipe *pipe, k_spinlock_key_t *key,
 		    k_timepoint_t time_limit, bool *need_resched)
 {
@@ -165,6 +170,11 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
+		if (unlikely(pipe_claimed(pipe, PIPE_FLAG_WRITE_CLAIM))) {
+			rc = written ? written : -EBUSY;
+			break;
+		}
+
 		if (pipe_empty(pipe)) {
 			if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
 				/*
@@ -233,6 +243,11 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 	}
 
 	for (;;) {
+		if (unlikely(pipe_claimed(pipe, PIPE_FLAG_READ_CLAIM))) {
+			rc = buf.used ? buf.used : -EBUSY;
+			break;
+		}
+
 		if (pipe_full(pipe)) {
 			/* One or more pending writers may exist. */
 			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
@@ -270,11 +285,186 @@ exit:
 	return rc;
 }
 
+int z_impl_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if (unlikely(ring_buf_capacity_get(&pipe->buf) == 0U)) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		if (unlikely(pipe_claimed(pipe, PIPE_FLAG_WRITE_CLAIM))) {
+			rc = -EBUSY;
+			break;
+		}
+
+		rc = ring_buf_put_claim(&pipe->buf, data, MIN(len, INT_MAX));
+		if (likely(rc != 0) || (len == 0U)) {
+			if (rc != 0) {
+				pipe->flags |= PIPE_FLAG_WRITE_CLAIM;
+			}
+			break;
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int z_impl_k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_closed(pipe))) {
+		rc = -EPIPE;
+		goto exit;
+	}
+
+	if (unlikely(!pipe_claimed(pipe, PIPE_FLAG_WRITE_CLAIM))) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	rc = ring_buf_put_finish(&pipe->buf, len);
+	if (rc != 0) {
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_WRITE_CLAIM;
+
+	if (len != 0U) {
+		/*
+		 * The data is already in the ring buffer, so let waiting
+		 * readers pick it up from there; their direct copy buffers
+		 * are simply left untouched.
+		 */
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+#ifdef CONFIG_POLL
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int z_impl_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	/* empty direct copy spec: writers wake us up without copying */
+	uint8_t none;
+	struct pipe_buf_spec buf = { &none, 0, 0 };
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if (unlikely(ring_buf_capacity_get(&pipe->buf) == 0U)) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_claimed(pipe, PIPE_FLAG_READ_CLAIM))) {
+			rc = -EBUSY;
+			break;
+		}
+
+		rc = ring_buf_get_claim(&pipe->buf, data, MIN(len, INT_MAX));
+		if (likely(rc != 0) || (len == 0U)) {
+			if (rc != 0) {
+				pipe->flags |= PIPE_FLAG_READ_CLAIM;
+			}
+			break;
+		}
+
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		_current->base.swap_data = &buf;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int z_impl_k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	bool was_full;
+
+	if (unlikely(!pipe_claimed(pipe, PIPE_FLAG_READ_CLAIM))) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	was_full = pipe_full(pipe);
+	rc = ring_buf_get_finish(&pipe->buf, len);
+	if (rc != 0) {
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_READ_CLAIM;
+
+	if ((len != 0U) && was_full) {
+		/* One or more pending writers may exist. */
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
 		ring_buf_reset(&pipe->buf);
+		pipe->flags &= ~(PIPE_FLAG_WRITE_CLAIM | PIPE_FLAG_READ_CLAIM);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
@@ -288,7 +478,9 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		pipe->flags = 0;
+		/* drop a pending write claim, but let a reader finish */
+		(void)ring_buf_put_finish(&pipe->buf, 0);
+		pipe->flags &= PIPE_FLAG_READ_CLAIM;
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
 	}
@@ -323,6 +515,60 @@ int z_vrfy_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 }
 #include <zephyr/syscalls/k_pipe_write_mrsh.c>
 
+int z_vrfy_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	uint8_t *area;
+	int rc;
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	/* the caller is going to fill the pipe buffer directly */
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(pipe->buf.buffer, pipe->buf.size));
+
+	rc = z_impl_k_pipe_write_claim(pipe, &area, len, timeout);
+	if (rc > 0) {
+		K_OOPS(k_usermode_to_copy(data, &area, sizeof(area)));
+	}
+
+	return rc;
+}
+#include <zephyr/syscalls/k_pipe_write_claim_mrsh.c>
+
+int z_vrfy_k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_write_commit(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_write_commit_mrsh.c>
+
+int z_vrfy_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	uint8_t *area;
+	int rc;
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	/* the caller is going to read the pipe buffer directly */
+	K_OOPS(K_SYSCALL_MEMORY_READ(pipe->buf.buffer, pipe->buf.size));
+
+	rc = z_impl_k_pipe_read_claim(pipe, &area, len, timeout);
+	if (rc > 0) {
+		K_OOPS(k_usermode_to_copy(data, &area, sizeof(area)));
+	}
+
+	return rc;
+}
+#include <zephyr/syscalls/k_pipe_read_claim_mrsh.c>
+
+int z_vrfy_k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_read_finish(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_read_finish_mrsh.c>
+
 void z_vrfy_k_pipe_reset(struct k_pipe *pipe)
 {
 	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
@@ -9,7 +9,11 @@
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/dlist.h>
 
+#ifdef CONFIG_PRIQ_BTREE
+bool z_priq_rb_lessthan(struct btree_node *a, struct btree_node *b)
+#else
 bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b)
+#endif
 {
 	struct k_thread *thread_a, *thread_b;
 	int32_t cmp;
@@ -369,6 +369,60 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+static uint32_t queue_take_locked(struct k_queue *queue, void **items, uint32_t max_items)
+{
+	uint32_t count = 0U;
+
+	while ((count < max_items) && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		items[count++] = z_queue_node_peek(node, true);
+	}
+
+	return count;
+}
+
+int z_impl_k_queue_get_n(struct k_queue *queue, void **items, uint32_t max_items,
+			 k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	uint32_t count;
+	int ret;
+
+	if (max_items == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&queue->lock);
+
+	count = queue_take_locked(queue, items, max_items);
+
+	if ((count > 0U) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+
+		return (int)count;
+	}
+
+	/* nothing queued: wait for one item, then take whatever else
+	 * arrived in the meantime without waiting again
+	 */
+	ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+	if ((ret != 0) || (_current->base.swap_data == NULL)) {
+		/* timed out or k_queue_cancel_wait() */
+		return 0;
+	}
+	items[0] = _current->base.swap_data;
+	count = 1U;
+
+	key = k_spin_lock(&queue->lock);
+
+	count += queue_take_locked(queue, &items[count], max_items - count);
+
+	k_spin_unlock(&queue->lock, key);
+
+	return (int)count;
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
@@ -428,6 +482,15 @@ static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 }
 #include <zephyr/syscalls/k_queue_get_mrsh.c>
 
+static inline int z_vrfy_k_queue_get_n(struct k_queue *queue, void **items,
+				       uint32_t max_items, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(items, max_items, sizeof(void *)));
+	return z_impl_k_queue_get_n(queue, items, max_items, timeout);
+}
+#include <zephyr/syscalls/k_queue_get_n_mrsh.c>
+
 static inline int z_vrfy_k_queue_is_empty(struct k_queue *queue)
 {
 	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
@@ -38,6 +38,7 @@ __incoherent struct k_thread _thread_dummy;
 static ALWAYS_INLINE void update_cache(int preempt_ok);
 static ALWAYS_INLINE void halt_thread(struct k_thread *thread, uint8_t new_state);
 static void add_to_waitq_locked(struct k_thread *thread, _wait_q_t *wait_q);
+static int32_t z_tick_sleep(k_timeout_t timeout);
 
 
 BUILD_ASSERT(CONFIG_NUM_COOP_PRIORITIES >= CONFIG_NUM_METAIRQ_PRIORITIES,
@@ -58,6 +59,22 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	 */
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
+	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_RUNQ)
+	/* Threads are queued on the CPU they last ran on, which cannot
+	 * change while they are queued.  Other CPUs take them from there
+	 * in runq_best().
+	 */
+	int cpu = thread->base.cpu;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	int m = thread->base.cpu_mask;
+
+	if ((m != 0) && ((m & BIT(cpu)) == 0)) {
+		cpu = u32_count_trailing_zeros(m);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 	return &_kernel.cpus[cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
@@ -67,11 +84,11 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
@@ -95,7 +112,32 @@ static ALWAYS_INLINE void runq_yield(void)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	struct _cpu *curr = arch_curr_cpu();
+	struct k_thread *thread = _priq_run_best(&curr->ready_q.runq);
+	unsigned int num_cpus = arch_num_cpus();
+
+	/* Steal from the other CPUs' queues, but only a thread which is
+	 * strictly more important than the local best, so equal priority
+	 * work stays on the CPU whose cache it warmed.
+	 */
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *t;
+
+		if (i == curr->id) {
+			continue;
+		}
+
+		t = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((t != NULL) && ((thread == NULL) || (z_sched_prio_cmp(t, thread) > 0))) {
+			thread = t;
+		}
+	}
+
+	return thread;
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -335,6 +377,26 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
+/*
+ * Lockless, the answer may be stale by the time the caller looks at it.
+ * The thread is never the caller, so every CPU is looked at, and this is
+ * safe to call with preemption enabled.
+ */
+bool z_thread_running_elsewhere(struct k_thread *thread)
+{
+#ifdef CONFIG_SMP
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (*(struct k_thread *volatile *)&_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+#endif /* CONFIG_SMP */
+	ARG_UNUSED(thread);
+	return false;
+}
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -347,6 +409,10 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+		if (thread != _current) {
+			z_sched_latency_ready(thread);
+		}
+
 		queue_thread(thread);
 		update_cache(0);
 
@@ -957,13 +1023,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -999,14 +1065,8 @@ static inline void z_vrfy_k_thread_priority_set(k_tid_t thread, int prio)
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_SCHED_DEADLINE
-void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
+static void deadline_update(struct k_thread *thread, int32_t newdl)
 {
-
-	deadline = CLAMP(deadline, 0, INT_MAX);
-
-	struct k_thread *thread = tid;
-	int32_t newdl = k_cycle_get_32() + deadline;
-
 	/* The prio_deadline field changes the sorting order, so can't
 	 * change it while the thread is in the run queue (dlists
 	 * actually are benign as long as we requeue it before we
@@ -1024,6 +1084,14 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	}
 }
 
+void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
+{
+
+	deadline = CLAMP(deadline, 0, INT_MAX);
+
+	deadline_update(tid, k_cycle_get_32() + deadline);
+}
+
 #ifdef CONFIG_USERSPACE
 static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 {
@@ -1038,6 +1106,94 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 }
 #include <zephyr/syscalls/k_thread_deadline_set_mrsh.c>
 #endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+int z_impl_k_thread_period_set(k_tid_t tid, uint32_t period, uint32_t budget,
+			       uint32_t deadline)
+{
+	struct k_thread *thread = tid;
+	struct _thread_period *p = &thread->base.period;
+
+	deadline = (deadline == 0U) ? period : deadline;
+
+	if ((period > INT_MAX) || (deadline > period) || (budget > deadline)) {
+		return -EINVAL;
+	}
+
+	p->period = period;
+	p->budget = budget;
+	p->deadline = deadline;
+
+	if (period == 0U) {
+		return 0;
+	}
+
+	p->release = k_cycle_get_32();
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	z_sched_usage_job_end(thread, 0);
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+
+	deadline_update(thread, p->release + deadline);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_period_set(k_tid_t tid, uint32_t period, uint32_t budget,
+					     uint32_t deadline)
+{
+	K_OOPS(K_SYSCALL_OBJ(tid, K_OBJ_THREAD));
+
+	return z_impl_k_thread_period_set(tid, period, budget, deadline);
+}
+#include <zephyr/syscalls/k_thread_period_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_thread_period_wait(void)
+{
+	struct _thread_period *p = &_current->base.period;
+	int ret = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+
+	if (p->period == 0U) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	z_sched_usage_job_end(_current, p->budget);
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+
+	uint32_t now = k_cycle_get_32();
+
+	if ((int32_t)(now - (p->release + p->deadline)) > 0) {
+		/* Deadline missed: release at once and restart the sequence from now */
+		p->release = now;
+		ret = -ETIMEDOUT;
+	} else {
+		/* The release is computed from the previous one so the period does not drift */
+		p->release += p->period;
+
+		int32_t delay = (int32_t)(p->release - now);
+
+		if (delay > 0) {
+			(void)z_tick_sleep(K_CYC(delay));
+		}
+	}
+
+	deadline_update(_current, p->release + p->deadline);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_period_wait(void)
+{
+	return z_impl_k_thread_period_wait();
+}
+#include <zephyr/syscalls/k_thread_period_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 #endif /* CONFIG_SCHED_DEADLINE */
 
 void z_impl_k_reschedule(void)
@@ -17,6 +17,7 @@
  * having to poll.
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/kernel_structs.h>
 
@@ -40,8 +41,79 @@ static struct k_spinlock lock;
 
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+static int k_sem_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_sem *sem;
+	k_spinlock_key_t key;
+
+	sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &sem->stats, sizeof(sem->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_sem_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_sem *sem;
+	k_spinlock_key_t key;
+
+	sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+	key = k_spin_lock(&lock);
+	memset(&sem->stats, 0, sizeof(sem->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc sem_stats_desc = {
+	.raw_size = sizeof(struct k_lock_stats),
+	.query_size = sizeof(struct k_lock_stats),
+	.raw   = k_sem_stats_raw,
+	.query = k_sem_stats_raw,
+	.reset = k_sem_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
+/* Statistics are updated with the lock held */
+static inline void sem_stats_taken(struct k_sem *sem)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	sem->stats.acquired++;
+#else
+	ARG_UNUSED(sem);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+}
+
+static inline void sem_stats_waited(struct k_sem *sem, uint32_t wait_start, bool taken)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	uint32_t wait = k_cycle_get_32() - wait_start;
+
+	sem->stats.contended++;
+	sem->stats.total_wait += wait;
+	sem->stats.max_wait = MAX(sem->stats.max_wait, wait);
+
+	if (taken) {
+		sem_stats_taken(sem);
+	}
+#else
+	ARG_UNUSED(sem);
+	ARG_UNUSED(wait_start);
+	ARG_UNUSED(taken);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+}
+
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
 {
@@ -68,6 +140,11 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 #ifdef CONFIG_OBJ_CORE_SEM
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
 #endif /* CONFIG_OBJ_CORE_SEM */
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	memset(&sem->stats, 0, sizeof(sem->stats));
+	k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->stats,
+				  sizeof(struct k_lock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 
 	return 0;
 }
@@ -131,6 +208,7 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
+	uint32_t wait_start;
 	int ret;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
@@ -142,6 +220,7 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	if (likely(sem->count > 0U)) {
 		sem->count--;
+		sem_stats_taken(sem);
 		k_spin_unlock(&lock, key);
 		ret = 0;
 		goto out;
@@ -155,8 +234,16 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
+	wait_start = IS_ENABLED(CONFIG_OBJ_CORE_STATS_SEM) ? k_cycle_get_32() : 0U;
+
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
 
+	if (IS_ENABLED(CONFIG_OBJ_CORE_STATS_SEM)) {
+		key = k_spin_lock(&lock);
+		sem_stats_waited(sem, wait_start, ret == 0);
+		k_spin_unlock(&lock, key);
+	}
+
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
 
@@ -222,11 +309,18 @@ static int init_sem_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_type_stats_init(&obj_type_sem, &sem_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->stats,
+					  sizeof(struct k_lock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 	}
 
 	return 0;
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Queue nodes of the MCS spinlocks. A CPU needs one node per spinlock it
+ * holds or waits for, and it can only wait for one at a time, so a small
+ * pool per CPU covers the nesting depth. Interrupts are locked while a
+ * spinlock is held, the pool of a CPU is only allocated from that CPU.
+ */
+
+#include <kernel_internal.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/llext/symbol.h>
+#include <zephyr/sys/util.h>
+
+#define NUM_NODES CONFIG_MCS_SPINLOCKS_NODES
+
+BUILD_ASSERT(NUM_NODES <= ATOMIC_BITS);
+
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define NODES_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define NODES_ALIGN 64
+#endif
+
+/* Cache line aligned, the nodes of a CPU are polled by that CPU only */
+static struct cpu_nodes {
+	struct z_spinlock_node node[NUM_NODES];
+	atomic_t used;
+} __aligned(NODES_ALIGN) cpu_nodes[CONFIG_MP_MAX_NUM_CPUS];
+
+struct z_spinlock_node *z_spinlock_node_get(void)
+{
+	struct cpu_nodes *nodes = &cpu_nodes[_current_cpu->id];
+	struct z_spinlock_node *node;
+
+	for (int i = 0; i < NUM_NODES; i++) {
+		if (atomic_test_and_set_bit(&nodes->used, i)) {
+			continue;
+		}
+
+		node = &nodes->node[i];
+		(void)atomic_ptr_clear(&node->next);
+		(void)atomic_set(&node->waiting, 1);
+
+		return node;
+	}
+
+	__ASSERT(false, "Spinlocks nested deeper than %d", NUM_NODES);
+	k_panic();
+	CODE_UNREACHABLE;
+}
+EXPORT_SYMBOL(z_spinlock_node_get);
+
+void z_spinlock_node_put(struct z_spinlock_node *node)
+{
+	/* Not necessarily the current CPU, a lock can be released after a context switch */
+	size_t cpu = ((uintptr_t)node - (uintptr_t)cpu_nodes) / sizeof(struct cpu_nodes);
+
+	atomic_clear_bit(&cpu_nodes[cpu].used, node - cpu_nodes[cpu].node);
+}
+EXPORT_SYMBOL(z_spinlock_node_put);
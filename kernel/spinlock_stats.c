@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <kernel_internal.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/kernel/stats.h>
+#include <zephyr/llext/symbol.h>
+#include <zephyr/sys/atomic.h>
+
+/*
+ * Statistics are updated with atomic operations: the statistics of a lock
+ * are only updated with that lock held, but the shared entry is updated
+ * under different locks, and all of them are read without any lock.
+ */
+struct z_spin_lock_stats {
+	atomic_t acquired;
+	atomic_t contended;
+	atomic_t spins;
+	atomic_t max_hold;
+	atomic_t max_wait;
+	/* Total wait, in two 32-bit halves */
+	atomic_t total_wait_lo;
+	atomic_t total_wait_hi;
+};
+
+struct spin_lock_stats_entry {
+	const struct k_spinlock *lock;
+	struct z_spin_lock_stats stats;
+};
+
+static struct spin_lock_stats_entry entries[CONFIG_SPIN_LOCK_STATS_MAX_LOCKS];
+static atomic_t num_entries;
+
+/* Shared by all locks acquired once the table is full */
+static struct z_spin_lock_stats untracked_stats;
+
+static void stats_max(atomic_t *max, uint32_t value)
+{
+	atomic_val_t old;
+
+	do {
+		old = atomic_get(max);
+		if ((uint32_t)old >= value) {
+			return;
+		}
+	} while (!atomic_cas(max, old, (atomic_val_t)value));
+}
+
+static void stats_add64(atomic_t *lo, atomic_t *hi, uint32_t value)
+{
+	uint32_t old = (uint32_t)atomic_add(lo, (atomic_val_t)value);
+
+	if ((uint32_t)(old + value) < old) {
+		(void)atomic_inc(hi);
+	}
+}
+
+static struct z_spin_lock_stats *stats_assign(struct k_spinlock *l)
+{
+	atomic_val_t idx = atomic_inc(&num_entries);
+
+	if (idx >= ARRAY_SIZE(entries)) {
+		return &untracked_stats;
+	}
+
+	entries[idx].lock = l;
+
+	return &entries[idx].stats;
+}
+
+/* Called with the lock held */
+void z_spin_lock_stats_acquired(struct k_spinlock *l, uint32_t spins,
+				uint32_t wait_start)
+{
+	struct z_spin_lock_stats *stats = l->stats;
+
+	if (stats == NULL) {
+		stats = stats_assign(l);
+		l->stats = stats;
+	}
+
+	(void)atomic_inc(&stats->acquired);
+
+	/* The cycle counter is only read when the lock was contended */
+	if (spins != 0U) {
+		uint32_t now = sys_clock_cycle_get_32();
+		uint32_t wait = now - wait_start;
+
+		(void)atomic_inc(&stats->contended);
+		(void)atomic_add(&stats->spins, (atomic_val_t)spins);
+		stats_add64(&stats->total_wait_lo, &stats->total_wait_hi, wait);
+		stats_max(&stats->max_wait, wait);
+
+		l->stats_lock_time = MAX(now, 1U);
+	} else {
+		l->stats_lock_time = 0U;
+	}
+}
+EXPORT_SYMBOL(z_spin_lock_stats_acquired);
+
+void z_spin_lock_stats_released(struct k_spinlock *l)
+{
+	uint32_t hold = sys_clock_cycle_get_32() - l->stats_lock_time;
+
+	stats_max(&l->stats->max_hold, hold);
+	l->stats_lock_time = 0U;
+}
+EXPORT_SYMBOL(z_spin_lock_stats_released);
+
+static void stats_get(const struct z_spin_lock_stats *stats, struct k_lock_stats *out)
+{
+	out->acquired = (uint32_t)atomic_get(&stats->acquired);
+	out->contended = (uint32_t)atomic_get(&stats->contended);
+	out->spins = (uint32_t)atomic_get(&stats->spins);
+	out->max_hold = (uint32_t)atomic_get(&stats->max_hold);
+	out->max_wait = (uint32_t)atomic_get(&stats->max_wait);
+	out->total_wait = ((uint64_t)(uint32_t)atomic_get(&stats->total_wait_hi) << 32) |
+			  (uint32_t)atomic_get(&stats->total_wait_lo);
+}
+
+static void stats_clear(struct z_spin_lock_stats *stats)
+{
+	atomic_clear(&stats->acquired);
+	atomic_clear(&stats->contended);
+	atomic_clear(&stats->spins);
+	atomic_clear(&stats->max_hold);
+	atomic_clear(&stats->max_wait);
+	atomic_clear(&stats->total_wait_lo);
+	atomic_clear(&stats->total_wait_hi);
+}
+
+void k_spin_lock_stats_foreach(k_spin_lock_stats_cb_t cb, void *user_data)
+{
+	size_t num = MIN((size_t)atomic_get(&num_entries), ARRAY_SIZE(entries));
+	struct k_lock_stats stats;
+
+	for (size_t i = 0; i < num; i++) {
+		/* Entry may be assigned but not yet published */
+		if (entries[i].lock != NULL) {
+			stats_get(&entries[i].stats, &stats);
+			cb(entries[i].lock, &stats, user_data);
+		}
+	}
+
+	if (atomic_get(&num_entries) > ARRAY_SIZE(entries)) {
+		stats_get(&untracked_stats, &stats);
+		cb(NULL, &stats, user_data);
+	}
+}
+
+void k_spin_lock_stats_reset(void)
+{
+	size_t num = MIN((size_t)atomic_get(&num_entries), ARRAY_SIZE(entries));
+
+	for (size_t i = 0; i < num; i++) {
+		stats_clear(&entries[i].stats);
+	}
+
+	stats_clear(&untracked_stats);
+}
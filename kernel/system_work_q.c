@@ -13,12 +13,49 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
+#include <zephyr/sys/printk.h>
+#include <kernel_internal.h>
 
 static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 			     CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
 
 struct k_work_q k_sys_work_q;
 
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+#define SYS_WORK_Q_CPUS (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_cpu_stacks, SYS_WORK_Q_CPUS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+static struct k_work_q sys_work_q_cpu[SYS_WORK_Q_CPUS];
+
+#define SYS_WORK_Q_CPU_PTR(i, _) &sys_work_q_cpu[i]
+
+struct k_work_q *const z_sys_work_q_cpu[CONFIG_MP_MAX_NUM_CPUS] = {
+	&k_sys_work_q,
+	LISTIFY(SYS_WORK_Q_CPUS, SYS_WORK_Q_CPU_PTR, (,))
+};
+
+static void sys_work_q_cpu_start(void)
+{
+	static char names[SYS_WORK_Q_CPUS][sizeof("sysworkq") + 2];
+
+	for (unsigned int i = 0; i < SYS_WORK_Q_CPUS; i++) {
+		struct k_work_queue_config cfg = {
+			.name = names[i],
+			.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
+			.essential = true,
+			.work_timeout_ms = CONFIG_SYSTEM_WORKQUEUE_WORK_TIMEOUT_MS,
+			.cpu_mask = BIT(i + 1),
+		};
+
+		snprintk(names[i], sizeof(names[i]), "sysworkq%u", i + 1);
+		k_work_queue_start(&sys_work_q_cpu[i], sys_work_q_cpu_stacks[i],
+				   K_KERNEL_STACK_SIZEOF(sys_work_q_cpu_stacks[i]),
+				   CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+	}
+}
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
+
 static int k_sys_work_q_init(void)
 {
 	static const struct k_work_queue_config cfg = {
@@ -26,13 +63,36 @@ static int k_sys_work_q_init(void)
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
 		.essential = true,
 		.work_timeout_ms = CONFIG_SYSTEM_WORKQUEUE_WORK_TIMEOUT_MS,
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+		.cpu_mask = BIT(0),
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
 	};
 
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+	sys_work_q_cpu_start();
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
 	return 0;
 }
 
+bool k_is_in_sys_work_q(void)
+{
+	k_tid_t current = k_current_get();
+
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		if (current == k_work_queue_thread_get(z_sys_work_q_cpu[i])) {
+			return true;
+		}
+	}
+
+	return false;
+#else
+	return current == k_work_queue_thread_get(&k_sys_work_q);
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
+}
+
 SYS_INIT(k_sys_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -623,6 +623,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #endif /* CONFIG_ARCH_HAS_CUSTOM_SWAP_TO_MAIN */
 #ifdef CONFIG_USERSPACE
 	z_mem_domain_init_thread(new_thread);
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	new_thread->obj_cache = (struct _thread_obj_cache) {};
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
 
 	if ((options & K_INHERIT_PERMS) != 0U) {
 		k_thread_perms_inherit(_current, new_thread);
@@ -631,6 +634,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_SCHED_DEADLINE
 	new_thread->base.prio_deadline = 0;
 #endif /* CONFIG_SCHED_DEADLINE */
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	new_thread->base.period = (struct _thread_period) {};
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 	new_thread->resource_pool = _current->resource_pool;
 
 #ifdef CONFIG_SMP
@@ -988,6 +994,11 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+		for (int j = 0; j < K_CYCLE_WINDOWS; j++) {
+			stats->utilization[j] += tmp_stats.utilization[j] / num_cpus;
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
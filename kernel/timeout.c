@@ -11,16 +11,32 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
-
-static uint64_t curr_tick;
-
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/app_memory/app_memdomain.h>
 
 /*
- * The timeout code shall take no locks other than its own (timeout_lock), nor
- * shall it call any other subsystem while holding this lock.
+ * Pending timeouts are kept in one queue per CPU with CONFIG_TIMEOUT_PER_CPU
+ * and in a single queue otherwise. Adding or aborting a timeout only takes
+ * the lock of the queue which owns it. curr_tick and announce_remaining are
+ * only written while all queue locks are held, so they are stable while any
+ * of them is held.
+ *
+ * The timeout code shall take no locks other than its own (the queue locks
+ * and timer_lock), nor shall it call any other subsystem while holding them.
  */
-static struct k_spinlock timeout_lock;
+#ifdef CONFIG_TIMEOUT_PER_CPU
+#define TIMEOUT_QUEUES CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TIMEOUT_QUEUES 1
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+static uint64_t curr_tick;
+
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+K_APPMEM_PARTITION_DEFINE(k_user_time_partition);
+K_APP_DMEM(k_user_time_partition) struct z_user_time z_user_time;
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
@@ -40,29 +56,471 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+#ifdef CONFIG_TIMEOUT_WHEEL
+/*
+ * Hierarchical timing wheel. Level k has WHEEL_SLOTS slots of
+ * WHEEL_SLOTS^k ticks each and holds the timeouts which expire in the same
+ * level k + 1 slot as wheel_tick, but not in the same level k slot. All
+ * timeouts of a level expire before those of the next level, and the
+ * timeouts of a level 0 slot all expire on the same tick. Timeouts beyond
+ * the last level are kept unsorted in wheel_overflow.
+ *
+ * A timeout stores its absolute expiry in dticks and its slot is a pure
+ * function of that expiry and wheel_tick, so insertion and removal are
+ * O(1). When wheel_tick advances, the slots it enters are cascaded down to
+ * lower levels, each timeout moving at most once per level. The earliest
+ * timeout is cached. Finding it again after it is removed takes a bitmap
+ * lookup, or a walk of a single slot when level 0 is empty.
+ */
+#define WHEEL_BITS 5
+#define WHEEL_SLOTS BIT(WHEEL_BITS)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+struct timeout_queue {
+	struct k_spinlock lock;
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Ticks until the first timeout, for the CPUs not holding lock */
+	atomic_t next;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+#ifdef CONFIG_TIMEOUT_WHEEL
+	/* Slot lists are only valid while their bit is set in wheel_map */
+	sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+	uint32_t wheel_map[WHEEL_LEVELS];
+	sys_dlist_t wheel_overflow;
+	uint64_t wheel_tick;
+	struct _timeout *wheel_next;
+	bool wheel_next_valid;
+#else
+	sys_dlist_t list;
+#endif /* CONFIG_TIMEOUT_WHEEL */
+};
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+#define TIMEOUT_QUEUE_NEXT_INIT .next = ATOMIC_INIT(-1),
+#else
+#define TIMEOUT_QUEUE_NEXT_INIT
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+#define TIMEOUT_QUEUE_INIT(i, _)						\
+	{									\
+		TIMEOUT_QUEUE_NEXT_INIT						\
+		.wheel_overflow = SYS_DLIST_STATIC_INIT(&timeout_queues[i].wheel_overflow), \
+		.wheel_next_valid = true,					\
+	}
+#else
+#define TIMEOUT_QUEUE_INIT(i, _)						\
+	{									\
+		TIMEOUT_QUEUE_NEXT_INIT						\
+		.list = SYS_DLIST_STATIC_INIT(&timeout_queues[i].list),	\
+	}
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+static struct timeout_queue timeout_queues[TIMEOUT_QUEUES] = {
+	LISTIFY(TIMEOUT_QUEUES, TIMEOUT_QUEUE_INIT, (,))
+};
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+/* Serializes programming the timer with the earliest timeout of all queues */
+static struct k_spinlock timer_lock;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+static uint64_t wheel_expiry(struct timeout_queue *q, const struct _timeout *t)
+{
+#ifdef CONFIG_TIMEOUT_64BIT
+	ARG_UNUSED(q);
+
+	return (uint64_t)t->dticks;
+#else
+	/* Timeouts are less than 2^31 ticks away from wheel_tick */
+	return q->wheel_tick + (int32_t)((uint32_t)t->dticks - (uint32_t)q->wheel_tick);
+#endif /* CONFIG_TIMEOUT_64BIT */
+}
+
+static unsigned int wheel_digit(uint64_t tick, int level)
+{
+	return (tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+}
+
+/* Level of a timeout expiring at @p expiry, WHEEL_LEVELS for overflow */
+static int wheel_level(struct timeout_queue *q, uint64_t expiry)
+{
+	int level;
+
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		if ((expiry >> (WHEEL_BITS * (level + 1))) ==
+		    (q->wheel_tick >> (WHEEL_BITS * (level + 1)))) {
+			break;
+		}
+	}
+
+	return level;
+}
+
+static void wheel_place(struct timeout_queue *q, struct _timeout *t)
+{
+	uint64_t expiry = wheel_expiry(q, t);
+	int level = wheel_level(q, expiry);
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&q->wheel_overflow, &t->node);
+		return;
+	}
+
+	unsigned int slot = wheel_digit(expiry, level);
+
+	if ((q->wheel_map[level] & BIT(slot)) == 0U) {
+		sys_dlist_init(&q->wheel[level][slot]);
+		q->wheel_map[level] |= BIT(slot);
+	}
+
+	sys_dlist_append(&q->wheel[level][slot], &t->node);
+}
+
+static void wheel_unplace(struct timeout_queue *q, struct _timeout *t)
+{
+	uint64_t expiry = wheel_expiry(q, t);
+	int level = wheel_level(q, expiry);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		unsigned int slot = wheel_digit(expiry, level);
+
+		if (sys_dlist_is_empty(&q->wheel[level][slot])) {
+			q->wheel_map[level] &= ~BIT(slot);
+		}
+	}
+}
+
+/* Re-place all timeouts of a list which wheel_tick has moved into */
+static void wheel_cascade(struct timeout_queue *q, sys_dlist_t *list)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	/* FIFO order among equal expiries is preserved */
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		wheel_place(q, CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Earliest timeout of a list, the first queued one on ties */
+static struct _timeout *wheel_min(struct timeout_queue *q, sys_dlist_t *list)
+{
+	struct _timeout *ret = NULL;
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		if ((ret == NULL) || (wheel_expiry(q, t) < wheel_expiry(q, ret))) {
+			ret = t;
+		}
+	}
+
+	return ret;
+}
+
+static struct _timeout *first(struct timeout_queue *q)
+{
+	if (q->wheel_next_valid) {
+		return q->wheel_next;
+	}
+
+	q->wheel_next = NULL;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		uint32_t map = q->wheel_map[level] & ~BIT_MASK(wheel_digit(q->wheel_tick, level));
+
+		if (map != 0U) {
+			sys_dlist_t *list = &q->wheel[level][find_lsb_set(map) - 1];
+
+			q->wheel_next = (level == 0) ?
+				CONTAINER_OF(sys_dlist_peek_head(list), struct _timeout, node) :
+				wheel_min(q, list);
+			break;
+		}
+	}
+
+	if (q->wheel_next == NULL) {
+		q->wheel_next = wheel_min(q, &q->wheel_overflow);
+	}
+
+	q->wheel_next_valid = true;
+
+	return q->wheel_next;
+}
+
+/* Ticks from curr_tick to the expiry of a queued timeout, must be locked */
+static k_ticks_t timeout_rem(struct timeout_queue *q, const struct _timeout *t)
+{
+	return (k_ticks_t)(wheel_expiry(q, t) - curr_tick);
+}
+
+/* Queue a timeout expiring @p dticks after curr_tick, returns true if it is the first */
+static bool insert_timeout(struct timeout_queue *q, struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *next = first(q);
+
+	to->dticks = (k_ticks_t)(curr_tick + dticks);
+	wheel_place(q, to);
+
+	/* Equal expiries are served in insertion order */
+	if ((next == NULL) || (wheel_expiry(q, to) < wheel_expiry(q, next))) {
+		q->wheel_next = to;
+	}
+
+	return q->wheel_next == to;
+}
+
+static void remove_timeout(struct timeout_queue *q, struct _timeout *t)
+{
+	wheel_unplace(q, t);
+
+	if (t == q->wheel_next) {
+		q->wheel_next_valid = false;
+	}
+}
+
+/* Called before curr_tick advances by @p ticks, no timeout expires in between */
+static void advance_timeouts(struct timeout_queue *q, k_ticks_t ticks)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	uint64_t tick = curr_tick + ticks;
+	bool wrapped = (tick >> (WHEEL_BITS * WHEEL_LEVELS)) !=
+		       (q->wheel_tick >> (WHEEL_BITS * WHEEL_LEVELS));
+
+	q->wheel_tick = tick;
+
+	if (wrapped) {
+		wheel_cascade(q, &q->wheel_overflow);
+	}
+
+	/* Top down, so timeouts can cascade through several levels at once */
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		unsigned int slot = wheel_digit(tick, level);
+
+		if ((q->wheel_map[level] & BIT(slot)) != 0U) {
+			q->wheel_map[level] &= ~BIT(slot);
+			wheel_cascade(q, &q->wheel[level][slot]);
+		}
+	}
+}
+#else
+static struct _timeout *first(struct timeout_queue *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
 
 	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next(struct timeout_queue *q, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
 
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static void remove_timeout(struct timeout_queue *q, struct _timeout *t)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	if (next(q, t) != NULL) {
+		next(q, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
+/* must be locked */
+static k_ticks_t timeout_rem(struct timeout_queue *q, const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+static bool insert_timeout(struct timeout_queue *q, struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+
+	for (t = first(q); t != NULL; t = next(q, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+
+	return to == first(q);
+}
+
+static void advance_timeouts(struct timeout_queue *q, k_ticks_t ticks)
+{
+	struct _timeout *t = first(q);
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+}
+
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+/* Queue of the calling CPU, which may be stale unless interrupts are locked */
+static struct timeout_queue *local_queue(void)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	return &timeout_queues[arch_curr_cpu()->id];
+#else
+	return &timeout_queues[0];
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
+/* Lock the queue owning @p to */
+static struct timeout_queue *lock_owner(const struct _timeout *to, k_spinlock_key_t *key)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	struct timeout_queue *q = &timeout_queues[to->queue];
+
+	/* The owner only changes while the old owner is locked */
+	*key = k_spin_lock(&q->lock);
+	while (q != &timeout_queues[to->queue]) {
+		k_spin_unlock(&q->lock, *key);
+		q = &timeout_queues[to->queue];
+		*key = k_spin_lock(&q->lock);
+	}
+
+	return q;
+#else
+	ARG_UNUSED(to);
+
+	*key = k_spin_lock(&timeout_queues[0].lock);
+
+	return &timeout_queues[0];
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
+/* Lock the queue of the calling CPU and make it the owner of inactive @p to */
+static struct timeout_queue *lock_local(struct _timeout *to, k_spinlock_key_t *key)
+{
+	struct timeout_queue *q = lock_owner(to, key);
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	uint8_t cpu = arch_curr_cpu()->id;
+
+	if (to->queue != cpu) {
+		to->queue = cpu;
+		k_spin_unlock(&q->lock, *key);
+		q = lock_owner(to, key);
+	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+	return q;
+}
+
+/* Take all queue locks, always in the same order */
+static void lock_all(k_spinlock_key_t keys[TIMEOUT_QUEUES])
+{
+	for (int i = 0; i < TIMEOUT_QUEUES; i++) {
+		keys[i] = k_spin_lock(&timeout_queues[i].lock);
+	}
+}
+
+static void unlock_all(k_spinlock_key_t keys[TIMEOUT_QUEUES])
+{
+	for (int i = TIMEOUT_QUEUES - 1; i >= 0; i--) {
+		k_spin_unlock(&timeout_queues[i].lock, keys[i]);
+	}
+}
+
+/* Publish the first expiry of a locked queue after it changed */
+static void queue_update(struct timeout_queue *q)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	struct _timeout *to = first(q);
+
+	atomic_set(&q->next, (to == NULL) ? -1 : (atomic_val_t)MIN(timeout_rem(q, to), INT_MAX));
+#else
+	ARG_UNUSED(q);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
+/* Ticks from curr_tick to the first timeout of a queue, negative if empty */
+static k_ticks_t queue_rem(struct timeout_queue *q)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Only one of the queues is locked, use the published value */
+	return (k_ticks_t)atomic_get(&q->next);
+#else
+	struct _timeout *to = first(q);
+
+	return (to == NULL) ? -1 : timeout_rem(q, to);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
+/* Earliest timeout of all queues, all of them must be locked */
+static struct _timeout *first_all(struct timeout_queue **qp)
+{
+	struct _timeout *ret = NULL;
+
+	for (int i = 0; i < TIMEOUT_QUEUES; i++) {
+		struct timeout_queue *q = &timeout_queues[i];
+		struct _timeout *t = first(q);
+
+		if ((t != NULL) && ((ret == NULL) || (timeout_rem(q, t) < timeout_rem(*qp, ret)))) {
+			ret = t;
+			*qp = q;
+		}
+	}
+
+	return ret;
+}
+
+/* Mirror curr_tick to user threads, all queues must be locked */
+static void user_time_publish(void)
+{
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+	z_user_time.seq++;
+	barrier_dmem_fence_full();
+	z_user_time.ticks = curr_tick;
+	barrier_dmem_fence_full();
+	z_user_time.seq++;
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
+}
+
+/* Advance curr_tick by @p ticks, all queues must be locked */
+static void advance_all(k_ticks_t ticks)
+{
+	for (int i = 0; i < TIMEOUT_QUEUES; i++) {
+		advance_timeouts(&timeout_queues[i], ticks);
+	}
+
+	curr_tick += ticks;
+	user_time_publish();
+
+	for (int i = 0; i < TIMEOUT_QUEUES; i++) {
+		queue_update(&timeout_queues[i]);
+	}
+}
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -86,22 +544,49 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	k_ticks_t rem = -1;
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	for (int i = 0; i < TIMEOUT_QUEUES; i++) {
+		k_ticks_t r = queue_rem(&timeout_queues[i]);
+
+		if ((r >= 0) && ((rem < 0) || (r < rem))) {
+			rem = r;
+		}
+	}
+
+	if ((rem < 0) ||
+	    ((int64_t)(rem - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, rem - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+static void set_next_timeout(int32_t ticks_elapsed)
+{
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Each CPU publishes its queue before getting here, so the last one
+	 * to program the timer has seen all earlier changes.
+	 */
+	K_SPINLOCK(&timer_lock) {
+		sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+	}
+#else
+	sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+}
+
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
+	struct timeout_queue *q;
+	k_spinlock_key_t key;
 	k_ticks_t ticks = 0;
+	int32_t ticks_elapsed;
+	bool has_elapsed = false;
+	k_ticks_t dticks;
 
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		return 0;
@@ -114,117 +599,96 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
-	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-		int32_t ticks_elapsed;
-		bool has_elapsed = false;
-
-		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
-			ticks_elapsed = elapsed();
-			has_elapsed = true;
-			to->dticks = timeout.ticks + 1 + ticks_elapsed;
-			ticks = curr_tick + to->dticks;
-		} else {
-			k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = MAX(1, dticks);
-			ticks = timeout.ticks;
-		}
+	q = lock_local(to, &key);
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+	if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
+		ticks_elapsed = elapsed();
+		has_elapsed = true;
+		dticks = timeout.ticks + 1 + ticks_elapsed;
+		ticks = curr_tick + dticks;
+	} else {
+		dticks = MAX(1, Z_TICK_ABS(timeout.ticks) - curr_tick);
+		ticks = timeout.ticks;
+	}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+	if (insert_timeout(q, to, dticks)) {
+		queue_update(q);
 
-		if (to == first() && announce_remaining == 0) {
+		if (announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
 				 */
 				ticks_elapsed = elapsed();
 			}
-			sys_clock_set_timeout(next_timeout(ticks_elapsed), false);
+			set_next_timeout(ticks_elapsed);
 		}
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 int z_abort_timeout(struct _timeout *to)
 {
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_owner(to, &key);
 	int ret = -EINVAL;
 
-	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+	if (sys_dnode_is_linked(&to->node)) {
+		bool is_first = (to == first(q));
 
-			remove_timeout(to);
-			to->dticks = TIMEOUT_DTICKS_ABORTED;
-			ret = 0;
-			if (is_first) {
-				sys_clock_set_timeout(next_timeout(elapsed()), false);
-			}
+		remove_timeout(q, to);
+		to->dticks = TIMEOUT_DTICKS_ABORTED;
+		ret = 0;
+		if (is_first) {
+			queue_update(q);
+			set_next_timeout(elapsed());
 		}
 	}
 
-	return ret;
-}
-
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
+	k_spin_unlock(&q->lock, key);
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
+	return ret;
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_owner(timeout, &key);
 	k_ticks_t ticks = 0;
 
-	K_SPINLOCK(&timeout_lock) {
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
-		}
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks = timeout_rem(q, timeout) - elapsed();
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
+	k_spinlock_key_t key;
+	struct timeout_queue *q = lock_owner(timeout, &key);
+	k_ticks_t ticks = curr_tick;
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick;
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
-		}
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks += timeout_rem(q, timeout);
 	}
 
+	k_spin_unlock(&q->lock, key);
+
 	return ticks;
 }
 
 int32_t z_get_next_timeout_expiry(void)
 {
+	struct timeout_queue *q = local_queue();
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
 
-	K_SPINLOCK(&timeout_lock) {
+	K_SPINLOCK(&q->lock) {
 		ret = next_timeout(elapsed());
 	}
 	return ret;
@@ -232,7 +696,9 @@ int32_t z_get_next_timeout_expiry(void)
 
 void sys_clock_announce(int32_t ticks)
 {
-	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	k_spinlock_key_t keys[TIMEOUT_QUEUES];
+
+	lock_all(keys);
 
 	/* We release the lock around the callbacks below, so on SMP
 	 * systems someone might be already running the loop.  Don't
@@ -242,39 +708,37 @@ void sys_clock_announce(int32_t ticks)
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
 		announce_remaining += ticks;
-		k_spin_unlock(&timeout_lock, key);
+		unlock_all(keys);
 		return;
 	}
 
 	announce_remaining = ticks;
 
+	struct timeout_queue *q = NULL;
 	struct _timeout *t;
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
+	for (t = first_all(&q);
+	     (t != NULL) && (timeout_rem(q, t) <= announce_remaining);
+	     t = first_all(&q)) {
+		int dt = timeout_rem(q, t);
 
-		curr_tick += dt;
+		advance_all(dt);
+		remove_timeout(q, t);
+		queue_update(q);
 		t->dticks = 0;
-		remove_timeout(t);
 
-		k_spin_unlock(&timeout_lock, key);
+		unlock_all(keys);
 		t->fn(t);
-		key = k_spin_lock(&timeout_lock);
+		lock_all(keys);
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
-	curr_tick += announce_remaining;
+	advance_all(announce_remaining);
 	announce_remaining = 0;
 
-	sys_clock_set_timeout(next_timeout(0), false);
+	set_next_timeout(0);
 
-	k_spin_unlock(&timeout_lock, key);
+	unlock_all(keys);
 
 #ifdef CONFIG_TIMESLICING
 	z_time_slice();
@@ -283,9 +747,10 @@ void sys_clock_announce(int32_t ticks)
 
 int64_t sys_clock_tick_get(void)
 {
+	struct timeout_queue *q = local_queue();
 	uint64_t t = 0U;
 
-	K_SPINLOCK(&timeout_lock) {
+	K_SPINLOCK(&q->lock) {
 		t = curr_tick + elapsed();
 	}
 	return t;
@@ -351,9 +816,58 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 }
 
 #ifdef CONFIG_ZTEST
+#ifdef CONFIG_TIMEOUT_WHEEL
+/* Moves all queued timeouts along with the tick, as the list keeps them relative */
+static void wheel_rebase(struct timeout_queue *q, uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (unsigned int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			if ((q->wheel_map[level] & BIT(slot)) == 0U) {
+				continue;
+			}
+
+			while ((node = sys_dlist_get(&q->wheel[level][slot])) != NULL) {
+				struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+				t->dticks = (k_ticks_t)(tick + timeout_rem(q, t));
+				sys_dlist_append(&pending, node);
+			}
+		}
+
+		q->wheel_map[level] = 0U;
+	}
+
+	while ((node = sys_dlist_get(&q->wheel_overflow)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks = (k_ticks_t)(tick + timeout_rem(q, t));
+		sys_dlist_append(&pending, node);
+	}
+
+	q->wheel_tick = tick;
+	q->wheel_next_valid = false;
+	wheel_cascade(q, &pending);
+}
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+	k_spinlock_key_t keys[TIMEOUT_QUEUES];
+
+	lock_all(keys);
+#ifdef CONFIG_TIMEOUT_WHEEL
+	for (int i = 0; i < TIMEOUT_QUEUES; i++) {
+		wheel_rebase(&timeout_queues[i], tick);
+	}
+#endif /* CONFIG_TIMEOUT_WHEEL */
 	curr_tick = tick;
+	user_time_publish();
+	unlock_all(keys);
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -32,6 +32,99 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+/*
+ * Windows are aligned to a common 64-bit clock extended from usage_now(), so
+ * a thread or CPU only needs to compare its window index to the current one
+ * to know whether its accumulated cycles belong to the current window, the
+ * previous one or an older one. The division is only done when a window
+ * ends, which keeps the cost per context switch constant.
+ */
+static struct {
+	uint64_t start;
+	uint64_t len;
+	uint32_t epoch;
+} usage_windows[K_CYCLE_WINDOWS];
+static uint64_t usage_clock;
+static uint32_t usage_clock_last;
+
+static void usage_windows_advance(uint32_t now)
+{
+	if (usage_windows[0].len == 0U) {
+#ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
+		uint64_t len = timing_freq_get();
+#else
+		uint64_t len = sys_clock_hw_cycles_per_sec();
+#endif /* CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS */
+
+		len = len * CONFIG_SCHED_THREAD_USAGE_WINDOW_MS / MSEC_PER_SEC;
+		for (int i = 0; i < K_CYCLE_WINDOWS; i++) {
+			usage_windows[i].len = MAX(len, 1U);
+			len *= 10U;
+		}
+		usage_clock_last = now;
+	}
+
+	usage_clock += now - usage_clock_last;
+	usage_clock_last = now;
+
+	for (int i = 0; i < K_CYCLE_WINDOWS; i++) {
+		uint64_t elapsed = usage_clock - usage_windows[i].start;
+
+		if (elapsed >= usage_windows[i].len) {
+			uint64_t n = elapsed / usage_windows[i].len;
+
+			usage_windows[i].start += n * usage_windows[i].len;
+			usage_windows[i].epoch += (uint32_t)n;
+		}
+	}
+}
+
+static void usage_windows_update(struct k_cycle_stats *usage, uint32_t cycles)
+{
+	for (int i = 0; i < K_CYCLE_WINDOWS; i++) {
+		struct k_cycle_window *w = &usage->windows[i];
+		uint32_t diff = usage_windows[i].epoch - w->epoch;
+
+		if (diff != 0U) {
+			w->last = (diff == 1U) ? w->current : 0U;
+			w->current = 0U;
+			w->epoch = usage_windows[i].epoch;
+		}
+
+		w->current += cycles;
+	}
+}
+
+/*
+ * Utilization over a sliding window ending now, estimated from the cycles of
+ * the current window and the share of the previous window that still falls
+ * into the sliding one.
+ */
+static void usage_windows_get(struct k_cycle_stats *usage, uint16_t *utilization)
+{
+	usage_windows_update(usage, 0U);
+
+	for (int i = 0; i < K_CYCLE_WINDOWS; i++) {
+		const struct k_cycle_window *w = &usage->windows[i];
+		uint64_t len = usage_windows[i].len;
+		uint64_t remaining;
+
+		if (len == 0U) {
+			utilization[i] = 0U;
+			continue;
+		}
+
+		remaining = (len - (usage_clock - usage_windows[i].start)) * 1000U / len;
+		utilization[i] = (uint16_t)MIN((w->current * 1000U + w->last * remaining) / len,
+					       1000U);
+	}
+}
+#else
+#define usage_windows_advance(now)         do { } while (0)
+#define usage_windows_update(usage, cycles) do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -41,6 +134,7 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 
 	if (cpu->current != cpu->idle_thread) {
 		cpu->usage->total += cycles;
+		usage_windows_update(cpu->usage, cycles);
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 		cpu->usage->current += cycles;
@@ -61,6 +155,7 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 {
 	thread->base.usage.total += cycles;
+	usage_windows_update(&thread->base.usage, cycles);
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	thread->base.usage.current += cycles;
@@ -105,7 +200,10 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
+
+		usage_windows_advance(now);
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
@@ -139,6 +237,8 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 		 * that information up-to-date.
 		 */
 
+		usage_windows_advance(now);
+
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
@@ -166,6 +266,18 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	memset(stats->latency, 0, sizeof(stats->latency));
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	stats->budget_overruns = 0;
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+	usage_windows_get(_kernel.cpus[cpu_id].usage, stats->utilization);
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -191,6 +303,8 @@ void z_sched_thread_usage(struct k_thread *thread,
 		 * that information up-to-date.
 		 */
 
+		usage_windows_advance(now);
+
 		if (thread->base.usage.track_usage) {
 			sched_thread_update_usage(thread, cycles);
 		}
@@ -221,8 +335,84 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	memcpy(stats->latency, thread->base.usage.latency, sizeof(stats->latency));
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	stats->budget_overruns = thread->base.usage.budget_overruns;
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+	usage_windows_get(&thread->base.usage, stats->utilization);
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+/*
+ * Both hooks are called with the scheduler lock held, which already
+ * serializes all accesses to the ready stamp.
+ */
+void z_sched_latency_ready(struct k_thread *thread)
+{
+	if (thread->base.usage.track_usage && (thread->base.usage.ready_stamp == 0U)) {
+		thread->base.usage.ready_stamp = usage_now();
+	}
+}
+
+void z_sched_latency_switch(struct k_thread *thread)
+{
+	uint32_t stamp = thread->base.usage.ready_stamp;
+
+	if (stamp != 0U) {
+		uint32_t cycles = usage_now() - stamp;
+		unsigned int bucket = (cycles < 2U) ? 0U : (find_msb_set(cycles) - 1U);
+
+		bucket = MIN(bucket, CONFIG_SCHED_THREAD_LATENCY_BUCKETS - 1);
+		thread->base.usage.latency[bucket]++;
+		thread->base.usage.ready_stamp = 0U;
+	}
+}
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+void z_sched_usage_job_end(struct k_thread *thread, uint32_t budget)
+{
+	k_spinlock_key_t  key;
+	struct _cpu *cpu;
+
+	key = k_spin_lock(&usage_lock);
+	cpu = _current_cpu;
+
+	if (thread == cpu->current) {
+		uint32_t now = usage_now();
+		uint32_t cycles = now - cpu->usage0;
+
+		/* Bring the total up to date so it includes the job just ended */
+
+		usage_windows_advance(now);
+
+		if (thread->base.usage.track_usage) {
+			sched_thread_update_usage(thread, cycles);
+		}
+
+		sched_cpu_update_usage(cpu, cycles);
+
+		cpu->usage0 = now;
+	}
+
+	if ((budget != 0U) && thread->base.usage.track_usage &&
+	    ((thread->base.usage.total - thread->base.period.job_start) > budget)) {
+		thread->base.usage.budget_overruns++;
+	}
+
+	thread->base.period.job_start = thread->base.usage.total;
+
 	k_spin_unlock(&usage_lock, key);
 }
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 int k_thread_runtime_stats_enable(k_tid_t  thread)
@@ -377,6 +567,16 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats = obj_core->stats;
 
 	stats->total = 0ULL;
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+	memset(stats->latency, 0, sizeof(stats->latency));
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+	memset(stats->windows, 0, sizeof(stats->windows));
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+	stats->budget_overruns = 0U;
+	thread->base.period.job_start = 0ULL;
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	stats->current = 0ULL;
 	stats->longest = 0ULL;
@@ -80,6 +80,55 @@ extern uint8_t _thread_idx_map[CONFIG_MAX_THREAD_BYTES];
 
 static void clear_perms_cb(struct k_object *ko, void *ctx_ptr);
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+/* Bumped to drop the cached validations of all threads */
+static atomic_t obj_cache_gen = ATOMIC_INIT(1);
+
+static inline void obj_cache_invalidate(void)
+{
+	(void)atomic_inc(&obj_cache_gen);
+}
+
+bool k_object_cache_test(const void *obj, enum k_objects otype)
+{
+	struct _thread_obj_cache *cache = &_current->obj_cache;
+	uint32_t gen = (uint32_t)atomic_get(&obj_cache_gen);
+
+	if (cache->gen != gen) {
+		*cache = (struct _thread_obj_cache) { .gen = gen };
+		return false;
+	}
+
+	for (int i = 0; i < CONFIG_USERSPACE_OBJ_CACHE_SIZE; i++) {
+		if ((cache->obj[i] == obj) && (cache->type[i] == otype)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void k_object_cache_add(const void *obj, enum k_objects otype)
+{
+	struct _thread_obj_cache *cache = &_current->obj_cache;
+
+	/* Something was invalidated since k_object_cache_test(), possibly
+	 * after the object was validated
+	 */
+	if (cache->gen != (uint32_t)atomic_get(&obj_cache_gen)) {
+		return;
+	}
+
+	cache->obj[cache->next] = obj;
+	cache->type[cache->next] = otype;
+	cache->next = (cache->next + 1U) % CONFIG_USERSPACE_OBJ_CACHE_SIZE;
+}
+#else
+static inline void obj_cache_invalidate(void)
+{
+}
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 const char *otype_to_str(enum k_objects otype)
 {
 	const char *ret;
@@ -471,6 +520,7 @@ void k_object_free(void *obj)
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
 		sys_dlist_remove(&dyn->dobj_list);
+		obj_cache_invalidate();
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -566,6 +616,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
 	sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
+	obj_cache_invalidate();
 
 #ifdef CONFIG_DYNAMIC_OBJECTS
 	if ((ko->flags & K_OBJ_FLAG_ALLOC) == 0U) {
@@ -821,6 +872,7 @@ void k_object_recycle(const void *obj)
 
 	if (ko != NULL) {
 		(void)memset(ko->perms, 0, sizeof(ko->perms));
+		obj_cache_invalidate();
 		k_thread_perms_set(ko, _current);
 		ko->flags |= K_OBJ_FLAG_INITIALIZED;
 	}
@@ -837,6 +889,7 @@ void k_object_uninit(const void *obj)
 	}
 
 	ko->flags &= ~K_OBJ_FLAG_INITIALIZED;
+	obj_cache_invalidate();
 }
 
 /*
@@ -14,8 +14,11 @@
 #include <zephyr/kernel_structs.h>
 #include <wait_q.h>
 #include <zephyr/spinlock.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/math_extras.h>
 #include <errno.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/logging/log.h>
 
@@ -381,6 +384,20 @@ int z_work_submit_to_queue(struct k_work_q *queue,
 	__ASSERT_NO_MSG(work != NULL);
 	__ASSERT_NO_MSG(work->handler != NULL);
 
+	/* Resubmitting work which is still queued has no effect, and is
+	 * the common case for work submitted from interrupts faster than
+	 * it is processed, so detect it without taking the lock.  The
+	 * queue thread clears the queued flag before running the handler
+	 * and the fences pair, so either the handler has not started yet
+	 * and will see everything written before this call, or the flag
+	 * reads as clear and the work is submitted normally.
+	 */
+	barrier_dmem_fence_full();
+	if ((*(volatile uint32_t *)&work->flags & (K_WORK_QUEUED | K_WORK_CANCELING)) ==
+	    K_WORK_QUEUED) {
+		return 0;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	int ret = submit_to_queue_locked(work, &queue);
@@ -415,7 +432,7 @@ int k_work_submit(struct k_work *work)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, submit, work);
 
-	int ret = k_work_submit_to_queue(&k_sys_work_q, work);
+	int ret = k_work_submit_to_queue(z_sys_work_q_local(), work);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, submit, work, ret);
 
@@ -733,6 +750,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		k_spin_unlock(&lock, key);
 
+		/* Pairs with the lockless check in z_work_submit_to_queue() */
+		barrier_dmem_fence_full();
+
 		__ASSERT_NO_MSG(handler != NULL);
 		handler(work);
 
@@ -849,6 +869,16 @@ void k_work_queue_start(struct k_work_q *queue,
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
 
+#ifdef CONFIG_SCHED_CPU_MASK
+	if ((cfg != NULL) && (cfg->cpu_mask != 0U)) {
+		(void)k_thread_cpu_mask_clear(&queue->thread);
+		for (uint32_t m = cfg->cpu_mask; m != 0U; m &= m - 1U) {
+			(void)k_thread_cpu_mask_enable(&queue->thread,
+						       u32_count_trailing_zeros(m));
+		}
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 	if ((cfg != NULL) && (cfg->work_timeout_ms)) {
 		queue->work_timeout = K_MSEC(cfg->work_timeout_ms);
@@ -1132,7 +1162,7 @@ int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule, dwork, delay);
 
-	int ret = k_work_schedule_for_queue(&k_sys_work_q, dwork, delay);
+	int ret = k_work_schedule_for_queue(z_sys_work_q_local(), dwork, delay);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule, dwork, delay, ret);
 
@@ -1167,7 +1197,7 @@ int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, reschedule, dwork, delay);
 
-	int ret = k_work_reschedule_for_queue(&k_sys_work_q, dwork, delay);
+	int ret = k_work_reschedule_for_queue(z_sys_work_q_local(), dwork, delay);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, reschedule, dwork, delay, ret);
 
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <new>
+#include <zephyr/cpp/memory_resource.hpp>
+#include <zephyr/sys/util.h>
+
+namespace zephyr::pmr {
+
+namespace {
+
+/* Smallest buffer requested from the upstream resource of a monotonic resource */
+constexpr size_t min_chunk_size = 256;
+
+void *checked(void *p)
+{
+#ifdef CONFIG_CPP_EXCEPTIONS
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+#endif
+	return p;
+}
+
+/* Alignment of the blocks of a buffer, given its start and block size */
+size_t block_alignment(const void *buffer, size_t block_size)
+{
+	uintptr_t a = reinterpret_cast<uintptr_t>(buffer) | block_size;
+
+	return a & (~a + 1U);
+}
+
+} /* namespace */
+
+void *heap_resource::do_allocate(size_t bytes, size_t alignment)
+{
+	return checked(k_heap_aligned_alloc(&heap_, alignment, bytes, timeout_));
+}
+
+void heap_resource::do_deallocate(void *p, size_t, size_t)
+{
+	k_heap_free(&heap_, p);
+}
+
+bool heap_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+void *slab_resource::do_allocate(size_t bytes, size_t alignment)
+{
+	void *p = nullptr;
+
+	if ((bytes <= slab_.info.block_size) &&
+	    (alignment <= block_alignment(slab_.buffer, slab_.info.block_size))) {
+		if (k_mem_slab_alloc(&slab_, &p, timeout_) != 0) {
+			p = nullptr;
+		}
+	}
+
+	return checked(p);
+}
+
+void slab_resource::do_deallocate(void *p, size_t, size_t)
+{
+	k_mem_slab_free(&slab_, p);
+}
+
+bool slab_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+#ifdef CONFIG_SYS_MEM_BLOCKS
+size_t mem_blocks_resource::blocks(size_t bytes) const noexcept
+{
+	return MAX(1U, DIV_ROUND_UP(bytes, BIT(mem_blocks_.info.blk_sz_shift)));
+}
+
+void *mem_blocks_resource::do_allocate(size_t bytes, size_t alignment)
+{
+	void *p = nullptr;
+
+	if (alignment <= block_alignment(mem_blocks_.buffer, BIT(mem_blocks_.info.blk_sz_shift))) {
+		if (sys_mem_blocks_alloc_contiguous(&mem_blocks_, blocks(bytes), &p) != 0) {
+			p = nullptr;
+		}
+	}
+
+	return checked(p);
+}
+
+void mem_blocks_resource::do_deallocate(void *p, size_t bytes, size_t)
+{
+	(void)sys_mem_blocks_free_contiguous(&mem_blocks_, p, blocks(bytes));
+}
+
+bool mem_blocks_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+#endif /* CONFIG_SYS_MEM_BLOCKS */
+
+monotonic_resource::monotonic_resource(void *buffer, size_t size,
+				       std::pmr::memory_resource *upstream) noexcept
+	: buffer_(static_cast<uint8_t *>(buffer)), size_(size), upstream_(upstream),
+	  next_(reinterpret_cast<uintptr_t>(buffer)), end_(next_ + size),
+	  chunk_size_(MAX(size, min_chunk_size))
+{
+}
+
+void monotonic_resource::release() noexcept
+{
+	k_spinlock_key_t key = k_spin_lock(&lock_);
+	struct chunk *c = chunks_;
+
+	chunks_ = nullptr;
+	next_ = reinterpret_cast<uintptr_t>(buffer_);
+	end_ = next_ + size_;
+	chunk_size_ = MAX(size_, min_chunk_size);
+	k_spin_unlock(&lock_, key);
+
+	while (c != nullptr) {
+		struct chunk *next = c->next;
+
+		upstream_->deallocate(c, c->size, alignof(std::max_align_t));
+		c = next;
+	}
+}
+
+/* Take bytes from the current buffer, with the lock held */
+void *monotonic_resource::carve(size_t bytes, size_t alignment) noexcept
+{
+	uintptr_t p = (next_ + alignment - 1U) & ~(uintptr_t)(alignment - 1U);
+
+	if ((p < next_) || (p > end_) || ((end_ - p) < bytes)) {
+		return nullptr;
+	}
+	next_ = p + bytes;
+
+	return reinterpret_cast<void *>(p);
+}
+
+void *monotonic_resource::do_allocate(size_t bytes, size_t alignment)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock_);
+	void *p = carve(bytes, alignment);
+	size_t size = MAX(chunk_size_, sizeof(struct chunk) + bytes + alignment);
+
+	k_spin_unlock(&lock_, key);
+
+	if ((p != nullptr) || (upstream_ == nullptr)) {
+		return checked(p);
+	}
+
+	/* Switch to a new buffer, what is left of the current one is lost */
+	struct chunk *c =
+		static_cast<struct chunk *>(upstream_->allocate(size, alignof(std::max_align_t)));
+
+	if (c == nullptr) {
+		return checked(nullptr);
+	}
+
+	c->size = size;
+
+	key = k_spin_lock(&lock_);
+	c->next = chunks_;
+	chunks_ = c;
+	next_ = reinterpret_cast<uintptr_t>(c + 1);
+	end_ = reinterpret_cast<uintptr_t>(c) + size;
+	chunk_size_ = (size <= (SIZE_MAX / 2U)) ? (size * 2U) : size;
+	p = carve(bytes, alignment);
+	k_spin_unlock(&lock_, key);
+
+	return p;
+}
+
+void monotonic_resource::do_deallocate(void *, size_t, size_t)
+{
+}
+
+bool monotonic_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+} /* namespace zephyr::pmr */
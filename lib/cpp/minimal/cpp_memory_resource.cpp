@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <memory_resource>
+#include <zephyr/sys/atomic.h>
+
+#if __cplusplus >= 201703L
+
+namespace {
+
+/* Same allocator as the operator new of cpp_new.cpp */
+class new_delete_memory_resource : public std::pmr::memory_resource {
+	void *do_allocate(size_t bytes, size_t alignment) override
+	{
+		return aligned_alloc(alignment, bytes);
+	}
+
+	void do_deallocate(void *p, size_t, size_t) override
+	{
+		free(p);
+	}
+
+	bool do_is_equal(const memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+class null_resource : public std::pmr::memory_resource {
+	void *do_allocate(size_t, size_t) override
+	{
+		return nullptr;
+	}
+
+	void do_deallocate(void *, size_t, size_t) override
+	{
+	}
+
+	bool do_is_equal(const memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+new_delete_memory_resource new_delete_res;
+null_resource null_res;
+atomic_ptr_t default_resource = ATOMIC_PTR_INIT(&new_delete_res);
+
+} /* namespace */
+
+namespace std::pmr {
+
+memory_resource *new_delete_resource() noexcept
+{
+	return &new_delete_res;
+}
+
+memory_resource *null_memory_resource() noexcept
+{
+	return &null_res;
+}
+
+memory_resource *set_default_resource(memory_resource *r) noexcept
+{
+	return static_cast<memory_resource *>(
+		atomic_ptr_set(&default_resource, (r != nullptr) ? r : &new_delete_res));
+}
+
+memory_resource *get_default_resource() noexcept
+{
+	return static_cast<memory_resource *>(atomic_ptr_get(&default_resource));
+}
+
+} /* namespace std::pmr */
+
+#endif /* __cplusplus >= 201703L */
@@ -6,6 +6,288 @@
 
 #include <zephyr/sys/crc.h>
 
+#include "crc_table.h"
+
+#ifdef CRC_TABLE_SLICES
+/* crc tables generated from polynomial 0x1021, reflected */
+static const uint16_t crc16_ccitt_table[CRC_TABLE_SLICES][256] = {
+	{
+		0x0000U, 0x1189U, 0x2312U, 0x329bU, 0x4624U, 0x57adU, 0x6536U, 0x74bfU,
+		0x8c48U, 0x9dc1U, 0xaf5aU, 0xbed3U, 0xca6cU, 0xdbe5U, 0xe97eU, 0xf8f7U,
+		0x1081U, 0x0108U, 0x3393U, 0x221aU, 0x56a5U, 0x472cU, 0x75b7U, 0x643eU,
+		0x9cc9U, 0x8d40U, 0xbfdbU, 0xae52U, 0xdaedU, 0xcb64U, 0xf9ffU, 0xe876U,
+		0x2102U, 0x308bU, 0x0210U, 0x1399U, 0x6726U, 0x76afU, 0x4434U, 0x55bdU,
+		0xad4aU, 0xbcc3U, 0x8e58U, 0x9fd1U, 0xeb6eU, 0xfae7U, 0xc87cU, 0xd9f5U,
+		0x3183U, 0x200aU, 0x1291U, 0x0318U, 0x77a7U, 0x662eU, 0x54b5U, 0x453cU,
+		0xbdcbU, 0xac42U, 0x9ed9U, 0x8f50U, 0xfbefU, 0xea66U, 0xd8fdU, 0xc974U,
+		0x4204U, 0x538dU, 0x6116U, 0x709fU, 0x0420U, 0x15a9U, 0x2732U, 0x36bbU,
+		0xce4cU, 0xdfc5U, 0xed5eU, 0xfcd7U, 0x8868U, 0x99e1U, 0xab7aU, 0xbaf3U,
+		0x5285U, 0x430cU, 0x7197U, 0x601eU, 0x14a1U, 0x0528U, 0x37b3U, 0x263aU,
+		0xdecdU, 0xcf44U, 0xfddfU, 0xec56U, 0x98e9U, 0x8960U, 0xbbfbU, 0xaa72U,
+		0x6306U, 0x728fU, 0x4014U, 0x519dU, 0x2522U, 0x34abU, 0x0630U, 0x17b9U,
+		0xef4eU, 0xfec7U, 0xcc5cU, 0xddd5U, 0xa96aU, 0xb8e3U, 0x8a78U, 0x9bf1U,
+		0x7387U, 0x620eU, 0x5095U, 0x411cU, 0x35a3U, 0x242aU, 0x16b1U, 0x0738U,
+		0xffcfU, 0xee46U, 0xdcddU, 0xcd54U, 0xb9ebU, 0xa862U, 0x9af9U, 0x8b70U,
+		0x8408U, 0x9581U, 0xa71aU, 0xb693U, 0xc22cU, 0xd3a5U, 0xe13eU, 0xf0b7U,
+		0x0840U, 0x19c9U, 0x2b52U, 0x3adbU, 0x4e64U, 0x5fedU, 0x6d76U, 0x7cffU,
+		0x9489U, 0x8500U, 0xb79bU, 0xa612U, 0xd2adU, 0xc324U, 0xf1bfU, 0xe036U,
+		0x18c1U, 0x0948U, 0x3bd3U, 0x2a5aU, 0x5ee5U, 0x4f6cU, 0x7df7U, 0x6c7eU,
+		0xa50aU, 0xb483U, 0x8618U, 0x9791U, 0xe32eU, 0xf2a7U, 0xc03cU, 0xd1b5U,
+		0x2942U, 0x38cbU, 0x0a50U, 0x1bd9U, 0x6f66U, 0x7eefU, 0x4c74U, 0x5dfdU,
+		0xb58bU, 0xa402U, 0x9699U, 0x8710U, 0xf3afU, 0xe226U, 0xd0bdU, 0xc134U,
+		0x39c3U, 0x284aU, 0x1ad1U, 0x0b58U, 0x7fe7U, 0x6e6eU, 0x5cf5U, 0x4d7cU,
+		0xc60cU, 0xd785U, 0xe51eU, 0xf497U, 0x8028U, 0x91a1U, 0xa33aU, 0xb2b3U,
+		0x4a44U, 0x5bcdU, 0x6956U, 0x78dfU, 0x0c60U, 0x1de9U, 0x2f72U, 0x3efbU,
+		0xd68dU, 0xc704U, 0xf59fU, 0xe416U, 0x90a9U, 0x8120U, 0xb3bbU, 0xa232U,
+		0x5ac5U, 0x4b4cU, 0x79d7U, 0x685eU, 0x1ce1U, 0x0d68U, 0x3ff3U, 0x2e7aU,
+		0xe70eU, 0xf687U, 0xc41cU, 0xd595U, 0xa12aU, 0xb0a3U, 0x8238U, 0x93b1U,
+		0x6b46U, 0x7acfU, 0x4854U, 0x59ddU, 0x2d62U, 0x3cebU, 0x0e70U, 0x1ff9U,
+		0xf78fU, 0xe606U, 0xd49dU, 0xc514U, 0xb1abU, 0xa022U, 0x92b9U, 0x8330U,
+		0x7bc7U, 0x6a4eU, 0x58d5U, 0x495cU, 0x3de3U, 0x2c6aU, 0x1ef1U, 0x0f78U,
+	},
+#if CRC_TABLE_SLICES == 8
+	{
+		0x0000U, 0x19d8U, 0x33b0U, 0x2a68U, 0x6760U, 0x7eb8U, 0x54d0U, 0x4d08U,
+		0xcec0U, 0xd718U, 0xfd70U, 0xe4a8U, 0xa9a0U, 0xb078U, 0x9a10U, 0x83c8U,
+		0x9591U, 0x8c49U, 0xa621U, 0xbff9U, 0xf2f1U, 0xeb29U, 0xc141U, 0xd899U,
+		0x5b51U, 0x4289U, 0x68e1U, 0x7139U, 0x3c31U, 0x25e9U, 0x0f81U, 0x1659U,
+		0x2333U, 0x3aebU, 0x1083U, 0x095bU, 0x4453U, 0x5d8bU, 0x77e3U, 0x6e3bU,
+		0xedf3U, 0xf42bU, 0xde43U, 0xc79bU, 0x8a93U, 0x934bU, 0xb923U, 0xa0fbU,
+		0xb6a2U, 0xaf7aU, 0x8512U, 0x9ccaU, 0xd1c2U, 0xc81aU, 0xe272U, 0xfbaaU,
+		0x7862U, 0x61baU, 0x4bd2U, 0x520aU, 0x1f02U, 0x06daU, 0x2cb2U, 0x356aU,
+		0x4666U, 0x5fbeU, 0x75d6U, 0x6c0eU, 0x2106U, 0x38deU, 0x12b6U, 0x0b6eU,
+		0x88a6U, 0x917eU, 0xbb16U, 0xa2ceU, 0xefc6U, 0xf61eU, 0xdc76U, 0xc5aeU,
+		0xd3f7U, 0xca2fU, 0xe047U, 0xf99fU, 0xb497U, 0xad4fU, 0x8727U, 0x9effU,
+		0x1d37U, 0x04efU, 0x2e87U, 0x375fU, 0x7a57U, 0x638fU, 0x49e7U, 0x503fU,
+		0x6555U, 0x7c8dU, 0x56e5U, 0x4f3dU, 0x0235U, 0x1bedU, 0x3185U, 0x285dU,
+		0xab95U, 0xb24dU, 0x9825U, 0x81fdU, 0xccf5U, 0xd52dU, 0xff45U, 0xe69dU,
+		0xf0c4U, 0xe91cU, 0xc374U, 0xdaacU, 0x97a4U, 0x8e7cU, 0xa414U, 0xbdccU,
+		0x3e04U, 0x27dcU, 0x0db4U, 0x146cU, 0x5964U, 0x40bcU, 0x6ad4U, 0x730cU,
+		0x8cccU, 0x9514U, 0xbf7cU, 0xa6a4U, 0xebacU, 0xf274U, 0xd81cU, 0xc1c4U,
+		0x420cU, 0x5bd4U, 0x71bcU, 0x6864U, 0x256cU, 0x3cb4U, 0x16dcU, 0x0f04U,
+		0x195dU, 0x0085U, 0x2aedU, 0x3335U, 0x7e3dU, 0x67e5U, 0x4d8dU, 0x5455U,
+		0xd79dU, 0xce45U, 0xe42dU, 0xfdf5U, 0xb0fdU, 0xa925U, 0x834dU, 0x9a95U,
+		0xafffU, 0xb627U, 0x9c4fU, 0x8597U, 0xc89fU, 0xd147U, 0xfb2fU, 0xe2f7U,
+		0x613fU, 0x78e7U, 0x528fU, 0x4b57U, 0x065fU, 0x1f87U, 0x35efU, 0x2c37U,
+		0x3a6eU, 0x23b6U, 0x09deU, 0x1006U, 0x5d0eU, 0x44d6U, 0x6ebeU, 0x7766U,
+		0xf4aeU, 0xed76U, 0xc71eU, 0xdec6U, 0x93ceU, 0x8a16U, 0xa07eU, 0xb9a6U,
+		0xcaaaU, 0xd372U, 0xf91aU, 0xe0c2U, 0xadcaU, 0xb412U, 0x9e7aU, 0x87a2U,
+		0x046aU, 0x1db2U, 0x37daU, 0x2e02U, 0x630aU, 0x7ad2U, 0x50baU, 0x4962U,
+		0x5f3bU, 0x46e3U, 0x6c8bU, 0x7553U, 0x385bU, 0x2183U, 0x0bebU, 0x1233U,
+		0x91fbU, 0x8823U, 0xa24bU, 0xbb93U, 0xf69bU, 0xef43U, 0xc52bU, 0xdcf3U,
+		0xe999U, 0xf041U, 0xda29U, 0xc3f1U, 0x8ef9U, 0x9721U, 0xbd49U, 0xa491U,
+		0x2759U, 0x3e81U, 0x14e9U, 0x0d31U, 0x4039U, 0x59e1U, 0x7389U, 0x6a51U,
+		0x7c08U, 0x65d0U, 0x4fb8U, 0x5660U, 0x1b68U, 0x02b0U, 0x28d8U, 0x3100U,
+		0xb2c8U, 0xab10U, 0x8178U, 0x98a0U, 0xd5a8U, 0xcc70U, 0xe618U, 0xffc0U,
+	},
+	{
+		0x0000U, 0x5adcU, 0xb5b8U, 0xef64U, 0x6361U, 0x39bdU, 0xd6d9U, 0x8c05U,
+		0xc6c2U, 0x9c1eU, 0x737aU, 0x29a6U, 0xa5a3U, 0xff7fU, 0x101bU, 0x4ac7U,
+		0x8595U, 0xdf49U, 0x302dU, 0x6af1U, 0xe6f4U, 0xbc28U, 0x534cU, 0x0990U,
+		0x4357U, 0x198bU, 0xf6efU, 0xac33U, 0x2036U, 0x7aeaU, 0x958eU, 0xcf52U,
+		0x033bU, 0x59e7U, 0xb683U, 0xec5fU, 0x605aU, 0x3a86U, 0xd5e2U, 0x8f3eU,
+		0xc5f9U, 0x9f25U, 0x7041U, 0x2a9dU, 0xa698U, 0xfc44U, 0x1320U, 0x49fcU,
+		0x86aeU, 0xdc72U, 0x3316U, 0x69caU, 0xe5cfU, 0xbf13U, 0x5077U, 0x0aabU,
+		0x406cU, 0x1ab0U, 0xf5d4U, 0xaf08U, 0x230dU, 0x79d1U, 0x96b5U, 0xcc69U,
+		0x0676U, 0x5caaU, 0xb3ceU, 0xe912U, 0x6517U, 0x3fcbU, 0xd0afU, 0x8a73U,
+		0xc0b4U, 0x9a68U, 0x750cU, 0x2fd0U, 0xa3d5U, 0xf909U, 0x166dU, 0x4cb1U,
+		0x83e3U, 0xd93fU, 0x365bU, 0x6c87U, 0xe082U, 0xba5eU, 0x553aU, 0x0fe6U,
+		0x4521U, 0x1ffdU, 0xf099U, 0xaa45U, 0x2640U, 0x7c9cU, 0x93f8U, 0xc924U,
+		0x054dU, 0x5f91U, 0xb0f5U, 0xea29U, 0x662cU, 0x3cf0U, 0xd394U, 0x8948U,
+		0xc38fU, 0x9953U, 0x7637U, 0x2cebU, 0xa0eeU, 0xfa32U, 0x1556U, 0x4f8aU,
+		0x80d8U, 0xda04U, 0x3560U, 0x6fbcU, 0xe3b9U, 0xb965U, 0x5601U, 0x0cddU,
+		0x461aU, 0x1cc6U, 0xf3a2U, 0xa97eU, 0x257bU, 0x7fa7U, 0x90c3U, 0xca1fU,
+		0x0cecU, 0x5630U, 0xb954U, 0xe388U, 0x6f8dU, 0x3551U, 0xda35U, 0x80e9U,
+		0xca2eU, 0x90f2U, 0x7f96U, 0x254aU, 0xa94fU, 0xf393U, 0x1cf7U, 0x462bU,
+		0x8979U, 0xd3a5U, 0x3cc1U, 0x661dU, 0xea18U, 0xb0c4U, 0x5fa0U, 0x057cU,
+		0x4fbbU, 0x1567U, 0xfa03U, 0xa0dfU, 0x2cdaU, 0x7606U, 0x9962U, 0xc3beU,
+		0x0fd7U, 0x550bU, 0xba6fU, 0xe0b3U, 0x6cb6U, 0x366aU, 0xd90eU, 0x83d2U,
+		0xc915U, 0x93c9U, 0x7cadU, 0x2671U, 0xaa74U, 0xf0a8U, 0x1fccU, 0x4510U,
+		0x8a42U, 0xd09eU, 0x3ffaU, 0x6526U, 0xe923U, 0xb3ffU, 0x5c9bU, 0x0647U,
+		0x4c80U, 0x165cU, 0xf938U, 0xa3e4U, 0x2fe1U, 0x753dU, 0x9a59U, 0xc085U,
+		0x0a9aU, 0x5046U, 0xbf22U, 0xe5feU, 0x69fbU, 0x3327U, 0xdc43U, 0x869fU,
+		0xcc58U, 0x9684U, 0x79e0U, 0x233cU, 0xaf39U, 0xf5e5U, 0x1a81U, 0x405dU,
+		0x8f0fU, 0xd5d3U, 0x3ab7U, 0x606bU, 0xec6eU, 0xb6b2U, 0x59d6U, 0x030aU,
+		0x49cdU, 0x1311U, 0xfc75U, 0xa6a9U, 0x2aacU, 0x7070U, 0x9f14U, 0xc5c8U,
+		0x09a1U, 0x537dU, 0xbc19U, 0xe6c5U, 0x6ac0U, 0x301cU, 0xdf78U, 0x85a4U,
+		0xcf63U, 0x95bfU, 0x7adbU, 0x2007U, 0xac02U, 0xf6deU, 0x19baU, 0x4366U,
+		0x8c34U, 0xd6e8U, 0x398cU, 0x6350U, 0xef55U, 0xb589U, 0x5aedU, 0x0031U,
+		0x4af6U, 0x102aU, 0xff4eU, 0xa592U, 0x2997U, 0x734bU, 0x9c2fU, 0xc6f3U,
+	},
+	{
+		0x0000U, 0x1cbbU, 0x3976U, 0x25cdU, 0x72ecU, 0x6e57U, 0x4b9aU, 0x5721U,
+		0xe5d8U, 0xf963U, 0xdcaeU, 0xc015U, 0x9734U, 0x8b8fU, 0xae42U, 0xb2f9U,
+		0xc3a1U, 0xdf1aU, 0xfad7U, 0xe66cU, 0xb14dU, 0xadf6U, 0x883bU, 0x9480U,
+		0x2679U, 0x3ac2U, 0x1f0fU, 0x03b4U, 0x5495U, 0x482eU, 0x6de3U, 0x7158U,
+		0x8f53U, 0x93e8U, 0xb625U, 0xaa9eU, 0xfdbfU, 0xe104U, 0xc4c9U, 0xd872U,
+		0x6a8bU, 0x7630U, 0x53fdU, 0x4f46U, 0x1867U, 0x04dcU, 0x2111U, 0x3daaU,
+		0x4cf2U, 0x5049U, 0x7584U, 0x693fU, 0x3e1eU, 0x22a5U, 0x0768U, 0x1bd3U,
+		0xa92aU, 0xb591U, 0x905cU, 0x8ce7U, 0xdbc6U, 0xc77dU, 0xe2b0U, 0xfe0bU,
+		0x16b7U, 0x0a0cU, 0x2fc1U, 0x337aU, 0x645bU, 0x78e0U, 0x5d2dU, 0x4196U,
+		0xf36fU, 0xefd4U, 0xca19U, 0xd6a2U, 0x8183U, 0x9d38U, 0xb8f5U, 0xa44eU,
+		0xd516U, 0xc9adU, 0xec60U, 0xf0dbU, 0xa7faU, 0xbb41U, 0x9e8cU, 0x8237U,
+		0x30ceU, 0x2c75U, 0x09b8U, 0x1503U, 0x4222U, 0x5e99U, 0x7b54U, 0x67efU,
+		0x99e4U, 0x855fU, 0xa092U, 0xbc29U, 0xeb08U, 0xf7b3U, 0xd27eU, 0xcec5U,
+		0x7c3cU, 0x6087U, 0x454aU, 0x59f1U, 0x0ed0U, 0x126bU, 0x37a6U, 0x2b1dU,
+		0x5a45U, 0x46feU, 0x6333U, 0x7f88U, 0x28a9U, 0x3412U, 0x11dfU, 0x0d64U,
+		0xbf9dU, 0xa326U, 0x86ebU, 0x9a50U, 0xcd71U, 0xd1caU, 0xf407U, 0xe8bcU,
+		0x2d6eU, 0x31d5U, 0x1418U, 0x08a3U, 0x5f82U, 0x4339U, 0x66f4U, 0x7a4fU,
+		0xc8b6U, 0xd40dU, 0xf1c0U, 0xed7bU, 0xba5aU, 0xa6e1U, 0x832cU, 0x9f97U,
+		0xeecfU, 0xf274U, 0xd7b9U, 0xcb02U, 0x9c23U, 0x8098U, 0xa555U, 0xb9eeU,
+		0x0b17U, 0x17acU, 0x3261U, 0x2edaU, 0x79fbU, 0x6540U, 0x408dU, 0x5c36U,
+		0xa23dU, 0xbe86U, 0x9b4bU, 0x87f0U, 0xd0d1U, 0xcc6aU, 0xe9a7U, 0xf51cU,
+		0x47e5U, 0x5b5eU, 0x7e93U, 0x6228U, 0x3509U, 0x29b2U, 0x0c7fU, 0x10c4U,
+		0x619cU, 0x7d27U, 0x58eaU, 0x4451U, 0x1370U, 0x0fcbU, 0x2a06U, 0x36bdU,
+		0x8444U, 0x98ffU, 0xbd32U, 0xa189U, 0xf6a8U, 0xea13U, 0xcfdeU, 0xd365U,
+		0x3bd9U, 0x2762U, 0x02afU, 0x1e14U, 0x4935U, 0x558eU, 0x7043U, 0x6cf8U,
+		0xde01U, 0xc2baU, 0xe777U, 0xfbccU, 0xacedU, 0xb056U, 0x959bU, 0x8920U,
+		0xf878U, 0xe4c3U, 0xc10eU, 0xddb5U, 0x8a94U, 0x962fU, 0xb3e2U, 0xaf59U,
+		0x1da0U, 0x011bU, 0x24d6U, 0x386dU, 0x6f4cU, 0x73f7U, 0x563aU, 0x4a81U,
+		0xb48aU, 0xa831U, 0x8dfcU, 0x9147U, 0xc666U, 0xdaddU, 0xff10U, 0xe3abU,
+		0x5152U, 0x4de9U, 0x6824U, 0x749fU, 0x23beU, 0x3f05U, 0x1ac8U, 0x0673U,
+		0x772bU, 0x6b90U, 0x4e5dU, 0x52e6U, 0x05c7U, 0x197cU, 0x3cb1U, 0x200aU,
+		0x92f3U, 0x8e48U, 0xab85U, 0xb73eU, 0xe01fU, 0xfca4U, 0xd969U, 0xc5d2U,
+	},
+	{
+		0x0000U, 0x0b44U, 0x1688U, 0x1dccU, 0x2d10U, 0x2654U, 0x3b98U, 0x30dcU,
+		0x5a20U, 0x5164U, 0x4ca8U, 0x47ecU, 0x7730U, 0x7c74U, 0x61b8U, 0x6afcU,
+		0xb440U, 0xbf04U, 0xa2c8U, 0xa98cU, 0x9950U, 0x9214U, 0x8fd8U, 0x849cU,
+		0xee60U, 0xe524U, 0xf8e8U, 0xf3acU, 0xc370U, 0xc834U, 0xd5f8U, 0xdebcU,
+		0x6091U, 0x6bd5U, 0x7619U, 0x7d5dU, 0x4d81U, 0x46c5U, 0x5b09U, 0x504dU,
+		0x3ab1U, 0x31f5U, 0x2c39U, 0x277dU, 0x17a1U, 0x1ce5U, 0x0129U, 0x0a6dU,
+		0xd4d1U, 0xdf95U, 0xc259U, 0xc91dU, 0xf9c1U, 0xf285U, 0xef49U, 0xe40dU,
+		0x8ef1U, 0x85b5U, 0x9879U, 0x933dU, 0xa3e1U, 0xa8a5U, 0xb569U, 0xbe2dU,
+		0xc122U, 0xca66U, 0xd7aaU, 0xdceeU, 0xec32U, 0xe776U, 0xfabaU, 0xf1feU,
+		0x9b02U, 0x9046U, 0x8d8aU, 0x86ceU, 0xb612U, 0xbd56U, 0xa09aU, 0xabdeU,
+		0x7562U, 0x7e26U, 0x63eaU, 0x68aeU, 0x5872U, 0x5336U, 0x4efaU, 0x45beU,
+		0x2f42U, 0x2406U, 0x39caU, 0x328eU, 0x0252U, 0x0916U, 0x14daU, 0x1f9eU,
+		0xa1b3U, 0xaaf7U, 0xb73bU, 0xbc7fU, 0x8ca3U, 0x87e7U, 0x9a2bU, 0x916fU,
+		0xfb93U, 0xf0d7U, 0xed1bU, 0xe65fU, 0xd683U, 0xddc7U, 0xc00bU, 0xcb4fU,
+		0x15f3U, 0x1eb7U, 0x037bU, 0x083fU, 0x38e3U, 0x33a7U, 0x2e6bU, 0x252fU,
+		0x4fd3U, 0x4497U, 0x595bU, 0x521fU, 0x62c3U, 0x6987U, 0x744bU, 0x7f0fU,
+		0x8a55U, 0x8111U, 0x9cddU, 0x9799U, 0xa745U, 0xac01U, 0xb1cdU, 0xba89U,
+		0xd075U, 0xdb31U, 0xc6fdU, 0xcdb9U, 0xfd65U, 0xf621U, 0xebedU, 0xe0a9U,
+		0x3e15U, 0x3551U, 0x289dU, 0x23d9U, 0x1305U, 0x1841U, 0x058dU, 0x0ec9U,
+		0x6435U, 0x6f71U, 0x72bdU, 0x79f9U, 0x4925U, 0x4261U, 0x5fadU, 0x54e9U,
+		0xeac4U, 0xe180U, 0xfc4cU, 0xf708U, 0xc7d4U, 0xcc90U, 0xd15cU, 0xda18U,
+		0xb0e4U, 0xbba0U, 0xa66cU, 0xad28U, 0x9df4U, 0x96b0U, 0x8b7cU, 0x8038U,
+		0x5e84U, 0x55c0U, 0x480cU, 0x4348U, 0x7394U, 0x78d0U, 0x651cU, 0x6e58U,
+		0x04a4U, 0x0fe0U, 0x122cU, 0x1968U, 0x29b4U, 0x22f0U, 0x3f3cU, 0x3478U,
+		0x4b77U, 0x4033U, 0x5dffU, 0x56bbU, 0x6667U, 0x6d23U, 0x70efU, 0x7babU,
+		0x1157U, 0x1a13U, 0x07dfU, 0x0c9bU, 0x3c47U, 0x3703U, 0x2acfU, 0x218bU,
+		0xff37U, 0xf473U, 0xe9bfU, 0xe2fbU, 0xd227U, 0xd963U, 0xc4afU, 0xcfebU,
+		0xa517U, 0xae53U, 0xb39fU, 0xb8dbU, 0x8807U, 0x8343U, 0x9e8fU, 0x95cbU,
+		0x2be6U, 0x20a2U, 0x3d6eU, 0x362aU, 0x06f6U, 0x0db2U, 0x107eU, 0x1b3aU,
+		0x71c6U, 0x7a82U, 0x674eU, 0x6c0aU, 0x5cd6U, 0x5792U, 0x4a5eU, 0x411aU,
+		0x9fa6U, 0x94e2U, 0x892eU, 0x826aU, 0xb2b6U, 0xb9f2U, 0xa43eU, 0xaf7aU,
+		0xc586U, 0xcec2U, 0xd30eU, 0xd84aU, 0xe896U, 0xe3d2U, 0xfe1eU, 0xf55aU,
+	},
+	{
+		0x0000U, 0x042bU, 0x0856U, 0x0c7dU, 0x10acU, 0x1487U, 0x18faU, 0x1cd1U,
+		0x2158U, 0x2573U, 0x290eU, 0x2d25U, 0x31f4U, 0x35dfU, 0x39a2U, 0x3d89U,
+		0x42b0U, 0x469bU, 0x4ae6U, 0x4ecdU, 0x521cU, 0x5637U, 0x5a4aU, 0x5e61U,
+		0x63e8U, 0x67c3U, 0x6bbeU, 0x6f95U, 0x7344U, 0x776fU, 0x7b12U, 0x7f39U,
+		0x8560U, 0x814bU, 0x8d36U, 0x891dU, 0x95ccU, 0x91e7U, 0x9d9aU, 0x99b1U,
+		0xa438U, 0xa013U, 0xac6eU, 0xa845U, 0xb494U, 0xb0bfU, 0xbcc2U, 0xb8e9U,
+		0xc7d0U, 0xc3fbU, 0xcf86U, 0xcbadU, 0xd77cU, 0xd357U, 0xdf2aU, 0xdb01U,
+		0xe688U, 0xe2a3U, 0xeedeU, 0xeaf5U, 0xf624U, 0xf20fU, 0xfe72U, 0xfa59U,
+		0x02d1U, 0x06faU, 0x0a87U, 0x0eacU, 0x127dU, 0x1656U, 0x1a2bU, 0x1e00U,
+		0x2389U, 0x27a2U, 0x2bdfU, 0x2ff4U, 0x3325U, 0x370eU, 0x3b73U, 0x3f58U,
+		0x4061U, 0x444aU, 0x4837U, 0x4c1cU, 0x50cdU, 0x54e6U, 0x589bU, 0x5cb0U,
+		0x6139U, 0x6512U, 0x696fU, 0x6d44U, 0x7195U, 0x75beU, 0x79c3U, 0x7de8U,
+		0x87b1U, 0x839aU, 0x8fe7U, 0x8bccU, 0x971dU, 0x9336U, 0x9f4bU, 0x9b60U,
+		0xa6e9U, 0xa2c2U, 0xaebfU, 0xaa94U, 0xb645U, 0xb26eU, 0xbe13U, 0xba38U,
+		0xc501U, 0xc12aU, 0xcd57U, 0xc97cU, 0xd5adU, 0xd186U, 0xddfbU, 0xd9d0U,
+		0xe459U, 0xe072U, 0xec0fU, 0xe824U, 0xf4f5U, 0xf0deU, 0xfca3U, 0xf888U,
+		0x05a2U, 0x0189U, 0x0df4U, 0x09dfU, 0x150eU, 0x1125U, 0x1d58U, 0x1973U,
+		0x24faU, 0x20d1U, 0x2cacU, 0x2887U, 0x3456U, 0x307dU, 0x3c00U, 0x382bU,
+		0x4712U, 0x4339U, 0x4f44U, 0x4b6fU, 0x57beU, 0x5395U, 0x5fe8U, 0x5bc3U,
+		0x664aU, 0x6261U, 0x6e1cU, 0x6a37U, 0x76e6U, 0x72cdU, 0x7eb0U, 0x7a9bU,
+		0x80c2U, 0x84e9U, 0x8894U, 0x8cbfU, 0x906eU, 0x9445U, 0x9838U, 0x9c13U,
+		0xa19aU, 0xa5b1U, 0xa9ccU, 0xade7U, 0xb136U, 0xb51dU, 0xb960U, 0xbd4bU,
+		0xc272U, 0xc659U, 0xca24U, 0xce0fU, 0xd2deU, 0xd6f5U, 0xda88U, 0xdea3U,
+		0xe32aU, 0xe701U, 0xeb7cU, 0xef57U, 0xf386U, 0xf7adU, 0xfbd0U, 0xfffbU,
+		0x0773U, 0x0358U, 0x0f25U, 0x0b0eU, 0x17dfU, 0x13f4U, 0x1f89U, 0x1ba2U,
+		0x262bU, 0x2200U, 0x2e7dU, 0x2a56U, 0x3687U, 0x32acU, 0x3ed1U, 0x3afaU,
+		0x45c3U, 0x41e8U, 0x4d95U, 0x49beU, 0x556fU, 0x5144U, 0x5d39U, 0x5912U,
+		0x649bU, 0x60b0U, 0x6ccdU, 0x68e6U, 0x7437U, 0x701cU, 0x7c61U, 0x784aU,
+		0x8213U, 0x8638U, 0x8a45U, 0x8e6eU, 0x92bfU, 0x9694U, 0x9ae9U, 0x9ec2U,
+		0xa34bU, 0xa760U, 0xab1dU, 0xaf36U, 0xb3e7U, 0xb7ccU, 0xbbb1U, 0xbf9aU,
+		0xc0a3U, 0xc488U, 0xc8f5U, 0xccdeU, 0xd00fU, 0xd424U, 0xd859U, 0xdc72U,
+		0xe1fbU, 0xe5d0U, 0xe9adU, 0xed86U, 0xf157U, 0xf57cU, 0xf901U, 0xfd2aU,
+	},
+	{
+		0x0000U, 0x9fd5U, 0x37bbU, 0xa86eU, 0x6f76U, 0xf0a3U, 0x58cdU, 0xc718U,
+		0xdeecU, 0x4139U, 0xe957U, 0x7682U, 0xb19aU, 0x2e4fU, 0x8621U, 0x19f4U,
+		0xb5c9U, 0x2a1cU, 0x8272U, 0x1da7U, 0xdabfU, 0x456aU, 0xed04U, 0x72d1U,
+		0x6b25U, 0xf4f0U, 0x5c9eU, 0xc34bU, 0x0453U, 0x9b86U, 0x33e8U, 0xac3dU,
+		0x6383U, 0xfc56U, 0x5438U, 0xcbedU, 0x0cf5U, 0x9320U, 0x3b4eU, 0xa49bU,
+		0xbd6fU, 0x22baU, 0x8ad4U, 0x1501U, 0xd219U, 0x4dccU, 0xe5a2U, 0x7a77U,
+		0xd64aU, 0x499fU, 0xe1f1U, 0x7e24U, 0xb93cU, 0x26e9U, 0x8e87U, 0x1152U,
+		0x08a6U, 0x9773U, 0x3f1dU, 0xa0c8U, 0x67d0U, 0xf805U, 0x506bU, 0xcfbeU,
+		0xc706U, 0x58d3U, 0xf0bdU, 0x6f68U, 0xa870U, 0x37a5U, 0x9fcbU, 0x001eU,
+		0x19eaU, 0x863fU, 0x2e51U, 0xb184U, 0x769cU, 0xe949U, 0x4127U, 0xdef2U,
+		0x72cfU, 0xed1aU, 0x4574U, 0xdaa1U, 0x1db9U, 0x826cU, 0x2a02U, 0xb5d7U,
+		0xac23U, 0x33f6U, 0x9b98U, 0x044dU, 0xc355U, 0x5c80U, 0xf4eeU, 0x6b3bU,
+		0xa485U, 0x3b50U, 0x933eU, 0x0cebU, 0xcbf3U, 0x5426U, 0xfc48U, 0x639dU,
+		0x7a69U, 0xe5bcU, 0x4dd2U, 0xd207U, 0x151fU, 0x8acaU, 0x22a4U, 0xbd71U,
+		0x114cU, 0x8e99U, 0x26f7U, 0xb922U, 0x7e3aU, 0xe1efU, 0x4981U, 0xd654U,
+		0xcfa0U, 0x5075U, 0xf81bU, 0x67ceU, 0xa0d6U, 0x3f03U, 0x976dU, 0x08b8U,
+		0x861dU, 0x19c8U, 0xb1a6U, 0x2e73U, 0xe96bU, 0x76beU, 0xded0U, 0x4105U,
+		0x58f1U, 0xc724U, 0x6f4aU, 0xf09fU, 0x3787U, 0xa852U, 0x003cU, 0x9fe9U,
+		0x33d4U, 0xac01U, 0x046fU, 0x9bbaU, 0x5ca2U, 0xc377U, 0x6b19U, 0xf4ccU,
+		0xed38U, 0x72edU, 0xda83U, 0x4556U, 0x824eU, 0x1d9bU, 0xb5f5U, 0x2a20U,
+		0xe59eU, 0x7a4bU, 0xd225U, 0x4df0U, 0x8ae8U, 0x153dU, 0xbd53U, 0x2286U,
+		0x3b72U, 0xa4a7U, 0x0cc9U, 0x931cU, 0x5404U, 0xcbd1U, 0x63bfU, 0xfc6aU,
+		0x5057U, 0xcf82U, 0x67ecU, 0xf839U, 0x3f21U, 0xa0f4U, 0x089aU, 0x974fU,
+		0x8ebbU, 0x116eU, 0xb900U, 0x26d5U, 0xe1cdU, 0x7e18U, 0xd676U, 0x49a3U,
+		0x411bU, 0xdeceU, 0x76a0U, 0xe975U, 0x2e6dU, 0xb1b8U, 0x19d6U, 0x8603U,
+		0x9ff7U, 0x0022U, 0xa84cU, 0x3799U, 0xf081U, 0x6f54U, 0xc73aU, 0x58efU,
+		0xf4d2U, 0x6b07U, 0xc369U, 0x5cbcU, 0x9ba4U, 0x0471U, 0xac1fU, 0x33caU,
+		0x2a3eU, 0xb5ebU, 0x1d85U, 0x8250U, 0x4548U, 0xda9dU, 0x72f3U, 0xed26U,
+		0x2298U, 0xbd4dU, 0x1523U, 0x8af6U, 0x4deeU, 0xd23bU, 0x7a55U, 0xe580U,
+		0xfc74U, 0x63a1U, 0xcbcfU, 0x541aU, 0x9302U, 0x0cd7U, 0xa4b9U, 0x3b6cU,
+		0x9751U, 0x0884U, 0xa0eaU, 0x3f3fU, 0xf827U, 0x67f2U, 0xcf9cU, 0x5049U,
+		0x49bdU, 0xd668U, 0x7e06U, 0xe1d3U, 0x26cbU, 0xb91eU, 0x1170U, 0x8ea5U,
+	},
+	{
+		0x0000U, 0x81bfU, 0x0b6fU, 0x8ad0U, 0x16deU, 0x9761U, 0x1db1U, 0x9c0eU,
+		0x2dbcU, 0xac03U, 0x26d3U, 0xa76cU, 0x3b62U, 0xbaddU, 0x300dU, 0xb1b2U,
+		0x5b78U, 0xdac7U, 0x5017U, 0xd1a8U, 0x4da6U, 0xcc19U, 0x46c9U, 0xc776U,
+		0x76c4U, 0xf77bU, 0x7dabU, 0xfc14U, 0x601aU, 0xe1a5U, 0x6b75U, 0xeacaU,
+		0xb6f0U, 0x374fU, 0xbd9fU, 0x3c20U, 0xa02eU, 0x2191U, 0xab41U, 0x2afeU,
+		0x9b4cU, 0x1af3U, 0x9023U, 0x119cU, 0x8d92U, 0x0c2dU, 0x86fdU, 0x0742U,
+		0xed88U, 0x6c37U, 0xe6e7U, 0x6758U, 0xfb56U, 0x7ae9U, 0xf039U, 0x7186U,
+		0xc034U, 0x418bU, 0xcb5bU, 0x4ae4U, 0xd6eaU, 0x5755U, 0xdd85U, 0x5c3aU,
+		0x65f1U, 0xe44eU, 0x6e9eU, 0xef21U, 0x732fU, 0xf290U, 0x7840U, 0xf9ffU,
+		0x484dU, 0xc9f2U, 0x4322U, 0xc29dU, 0x5e93U, 0xdf2cU, 0x55fcU, 0xd443U,
+		0x3e89U, 0xbf36U, 0x35e6U, 0xb459U, 0x2857U, 0xa9e8U, 0x2338U, 0xa287U,
+		0x1335U, 0x928aU, 0x185aU, 0x99e5U, 0x05ebU, 0x8454U, 0x0e84U, 0x8f3bU,
+		0xd301U, 0x52beU, 0xd86eU, 0x59d1U, 0xc5dfU, 0x4460U, 0xceb0U, 0x4f0fU,
+		0xfebdU, 0x7f02U, 0xf5d2U, 0x746dU, 0xe863U, 0x69dcU, 0xe30cU, 0x62b3U,
+		0x8879U, 0x09c6U, 0x8316U, 0x02a9U, 0x9ea7U, 0x1f18U, 0x95c8U, 0x1477U,
+		0xa5c5U, 0x247aU, 0xaeaaU, 0x2f15U, 0xb31bU, 0x32a4U, 0xb874U, 0x39cbU,
+		0xcbe2U, 0x4a5dU, 0xc08dU, 0x4132U, 0xdd3cU, 0x5c83U, 0xd653U, 0x57ecU,
+		0xe65eU, 0x67e1U, 0xed31U, 0x6c8eU, 0xf080U, 0x713fU, 0xfbefU, 0x7a50U,
+		0x909aU, 0x1125U, 0x9bf5U, 0x1a4aU, 0x8644U, 0x07fbU, 0x8d2bU, 0x0c94U,
+		0xbd26U, 0x3c99U, 0xb649U, 0x37f6U, 0xabf8U, 0x2a47U, 0xa097U, 0x2128U,
+		0x7d12U, 0xfcadU, 0x767dU, 0xf7c2U, 0x6bccU, 0xea73U, 0x60a3U, 0xe11cU,
+		0x50aeU, 0xd111U, 0x5bc1U, 0xda7eU, 0x4670U, 0xc7cfU, 0x4d1fU, 0xcca0U,
+		0x266aU, 0xa7d5U, 0x2d05U, 0xacbaU, 0x30b4U, 0xb10bU, 0x3bdbU, 0xba64U,
+		0x0bd6U, 0x8a69U, 0x00b9U, 0x8106U, 0x1d08U, 0x9cb7U, 0x1667U, 0x97d8U,
+		0xae13U, 0x2facU, 0xa57cU, 0x24c3U, 0xb8cdU, 0x3972U, 0xb3a2U, 0x321dU,
+		0x83afU, 0x0210U, 0x88c0U, 0x097fU, 0x9571U, 0x14ceU, 0x9e1eU, 0x1fa1U,
+		0xf56bU, 0x74d4U, 0xfe04U, 0x7fbbU, 0xe3b5U, 0x620aU, 0xe8daU, 0x6965U,
+		0xd8d7U, 0x5968U, 0xd3b8U, 0x5207U, 0xce09U, 0x4fb6U, 0xc566U, 0x44d9U,
+		0x18e3U, 0x995cU, 0x138cU, 0x9233U, 0x0e3dU, 0x8f82U, 0x0552U, 0x84edU,
+		0x355fU, 0xb4e0U, 0x3e30U, 0xbf8fU, 0x2381U, 0xa23eU, 0x28eeU, 0xa951U,
+		0x439bU, 0xc224U, 0x48f4U, 0xc94bU, 0x5545U, 0xd4faU, 0x5e2aU, 0xdf95U,
+		0x6e27U, 0xef98U, 0x6548U, 0xe4f7U, 0x78f9U, 0xf946U, 0x7396U, 0xf229U,
+	},
+#endif /* CRC_TABLE_SLICES == 8 */
+};
+#endif /* CRC_TABLE_SLICES */
+
 uint16_t crc16(uint16_t poly, uint16_t seed, const uint8_t *src, size_t len)
 {
 	uint16_t crc = seed;
@@ -51,6 +333,17 @@ uint16_t crc16_reflect(uint16_t poly, uint16_t seed, const uint8_t *src, size_t
 
 uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 {
+#ifdef CONFIG_CRC_BACKEND
+	const struct crc_backend *backend = z_crc_backend;
+
+	if ((backend != NULL) && (backend->crc16_ccitt != NULL) && (len >= backend->min_len)) {
+		return backend->crc16_ccitt(seed, src, len);
+	}
+#endif /* CONFIG_CRC_BACKEND */
+
+#ifdef CRC_TABLE_SLICES
+	return crc16_table_update(crc16_ccitt_table, seed, src, len);
+#else
 	for (; len > 0; len--) {
 		uint8_t e, f;
 
@@ -61,6 +354,7 @@ uint16_t crc16_ccitt(uint16_t seed, const uint8_t *src, size_t len)
 	}
 
 	return seed;
+#endif /* CRC_TABLE_SLICES */
 }
 
 uint16_t crc16_itu_t(uint16_t seed, const uint8_t *src, size_t len)
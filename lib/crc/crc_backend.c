@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/crc.h>
+
+const struct crc_backend *z_crc_backend;
+
+void crc_backend_set(const struct crc_backend *backend)
+{
+	z_crc_backend = backend;
+}
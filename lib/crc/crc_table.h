@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Table driven kernels of the reflected CRCs, selected with the CRC_TABLE
+ * choice. Tables hold CRC_TABLE_SLICES rows of 256 entries: row k is the CRC
+ * of a byte followed by k zero bytes, so that slicing-by-8 consumes eight
+ * bytes with eight independent lookups. The byte variant only uses row 0.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC_TABLE_H_
+#define ZEPHYR_LIB_CRC_CRC_TABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC_TABLE_SLICE8)
+#define CRC_TABLE_SLICES 8
+#elif defined(CONFIG_CRC_TABLE_BYTE)
+#define CRC_TABLE_SLICES 1
+#endif
+
+#if defined(CONFIG_CRC_CPU_INSTRUCTIONS) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC_ARM_CRC32 1
+#endif
+
+#ifdef CRC_TABLE_SLICES
+
+/* Update a reflected CRC-32 register, without inverting it */
+static inline uint32_t crc32_table_update(const uint32_t table[][256], uint32_t crc,
+					  const uint8_t *data, size_t len)
+{
+#if CRC_TABLE_SLICES == 8
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t lo = crc ^ sys_get_le32(data);
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][lo & 0xff] ^ table[6][(lo >> 8) & 0xff] ^
+		      table[5][(lo >> 16) & 0xff] ^ table[4][lo >> 24] ^
+		      table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
+	}
+#endif /* CRC_TABLE_SLICES == 8 */
+
+	for (; len > 0; len--, data++) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+	}
+
+	return crc;
+}
+
+/* Update a reflected CRC-16 register */
+static inline uint16_t crc16_table_update(const uint16_t table[][256], uint16_t crc,
+					  const uint8_t *data, size_t len)
+{
+#if CRC_TABLE_SLICES == 8
+	for (; len >= 8; len -= 8, data += 8) {
+		uint16_t x = crc ^ sys_get_le16(data);
+
+		crc = table[7][x & 0xff] ^ table[6][x >> 8] ^
+		      table[5][data[2]] ^ table[4][data[3]] ^
+		      table[3][data[4]] ^ table[2][data[5]] ^
+		      table[1][data[6]] ^ table[0][data[7]];
+	}
+#endif /* CRC_TABLE_SLICES == 8 */
+
+	for (; len > 0; len--, data++) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+	}
+
+	return crc;
+}
+
+#endif /* CRC_TABLE_SLICES */
+
+#endif /* ZEPHYR_LIB_CRC_CRC_TABLE_H_ */
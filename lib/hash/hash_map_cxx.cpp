@@ -5,6 +5,8 @@
  */
 
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <unordered_map>
 
 #include <zephyr/sys/hash_map.h>
@@ -12,6 +14,19 @@
 
 using cxx_map = std::unordered_map<uint64_t, uint64_t>;
 
+/* The position of iterators is kept in their state pointer */
+static_assert(sizeof(cxx_map::iterator) <= sizeof(void *),
+	      "unordered_map iterator does not fit in the iterator state");
+static_assert(alignof(cxx_map::iterator) <= alignof(void *),
+	      "unordered_map iterator is not aligned in the iterator state");
+static_assert(std::is_trivially_destructible<cxx_map::iterator>::value,
+	      "unordered_map iterator would leak from the iterator state");
+
+static cxx_map::iterator &sys_hashmap_cxx_iter_state(struct sys_hashmap_iterator *it)
+{
+	return *reinterpret_cast<cxx_map::iterator *>(&it->state);
+}
+
 static void sys_hashmap_cxx_iter_next(struct sys_hashmap_iterator *it)
 {
 	cxx_map *umap = static_cast<cxx_map *>(it->map->data->buckets);
@@ -21,9 +36,13 @@ static void sys_hashmap_cxx_iter_next(struct sys_hashmap_iterator *it)
 	__ASSERT(it->size == it->map->data->size, "Concurrent modification!");
 	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
 
-	auto it2 = umap->begin();
-	for (size_t i = 0; i < it->pos; ++i, it2++)
-		;
+	if (it->pos == 0) {
+		new (&it->state) cxx_map::iterator(umap->begin());
+	} else {
+		++sys_hashmap_cxx_iter_state(it);
+	}
+
+	auto &it2 = sys_hashmap_cxx_iter_state(it);
 
 	it->key = it2->first;
 	it->value = it2->second;
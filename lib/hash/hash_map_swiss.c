@@ -0,0 +1,550 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Open Addressing Hashmap in the style of the "Swiss Table".
+ *
+ * The table holds n_buckets entries followed by n_buckets control bytes, one per entry. A control
+ * byte is either EMPTY, DELETED (a tombstone) or, for used entries, the low 7 bits of the hash of
+ * the key (h2). The remaining bits of the hash (h1) select the first group of GROUP_WIDTH
+ * consecutive buckets to probe, further groups are probed quadratically.
+ *
+ * Each group is matched against h2 at once, so keys are only compared for the few buckets whose
+ * control byte matches, and probing stops at the first group holding an EMPTY bucket.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xfe
+
+/*
+ * Group matching primitives, returning a bit mask of the matching buckets of the group starting at
+ * @p ctrl. GROUP_MASK_SHIFT converts the index of the lowest set bit into a bucket index.
+ */
+#if defined(CONFIG_SYS_HASH_MAP_SWISS_SIMD) && defined(__SSE2__)
+
+#include <emmintrin.h>
+
+#define GROUP_WIDTH	 16
+#define GROUP_MASK_SHIFT 0
+typedef uint32_t group_mask_t;
+
+static inline __m128i group_load(const uint8_t *ctrl)
+{
+	return _mm_loadu_si128((const __m128i *)ctrl);
+}
+
+static inline group_mask_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(group_load(ctrl), _mm_set1_epi8((char)h2)));
+}
+
+static inline group_mask_t group_match_empty(const uint8_t *ctrl)
+{
+	return group_match(ctrl, CTRL_EMPTY);
+}
+
+static inline group_mask_t group_match_empty_or_deleted(const uint8_t *ctrl)
+{
+	/* only EMPTY and DELETED are below -1 as signed bytes */
+	return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), group_load(ctrl)));
+}
+
+static inline group_mask_t group_first(group_mask_t mask)
+{
+	return u32_count_trailing_zeros(mask);
+}
+
+#elif defined(CONFIG_SYS_HASH_MAP_SWISS_SIMD) && defined(__ARM_FEATURE_MVE)
+
+#include <arm_mve.h>
+
+#define GROUP_WIDTH	 16
+#define GROUP_MASK_SHIFT 0
+typedef uint32_t group_mask_t;
+
+static inline group_mask_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	return vcmpeqq_n_u8(vld1q_u8(ctrl), h2);
+}
+
+static inline group_mask_t group_match_empty(const uint8_t *ctrl)
+{
+	return group_match(ctrl, CTRL_EMPTY);
+}
+
+static inline group_mask_t group_match_empty_or_deleted(const uint8_t *ctrl)
+{
+	/* only EMPTY and DELETED are below -1 as signed bytes */
+	return vcmpltq_n_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl)), -1);
+}
+
+static inline group_mask_t group_first(group_mask_t mask)
+{
+	return u32_count_trailing_zeros(mask);
+}
+
+#else /* SWAR */
+
+/*
+ * Bytes of a group are loaded into a machine word, in little endian order so that the lowest set
+ * bit of a mask belongs to the first matching bucket. Masks have the top bit of matching bytes set.
+ */
+#if defined(CONFIG_64BIT)
+#define GROUP_WIDTH 8
+typedef uint64_t group_mask_t;
+#define group_load(ctrl) sys_get_le64(ctrl)
+#define group_first(mask) u64_count_trailing_zeros(mask)
+#else
+#define GROUP_WIDTH 4
+typedef uint32_t group_mask_t;
+#define group_load(ctrl) sys_get_le32(ctrl)
+#define group_first(mask) u32_count_trailing_zeros(mask)
+#endif
+
+#define GROUP_MASK_SHIFT 3
+#define GROUP_LSBS	 ((group_mask_t)-1 / 0xff)
+#define GROUP_MSBS	 (GROUP_LSBS << 7)
+
+static inline group_mask_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	/*
+	 * Zero bytes of x are the matches. Borrows may flag a byte above a match when it holds
+	 * h2 ^ 0x01, such false positives are full buckets and are rejected by comparing keys.
+	 */
+	group_mask_t x = group_load(ctrl) ^ (GROUP_LSBS * h2);
+
+	return (x - GROUP_LSBS) & ~x & GROUP_MSBS;
+}
+
+static inline group_mask_t group_match_empty(const uint8_t *ctrl)
+{
+	group_mask_t w = group_load(ctrl);
+
+	/* EMPTY is the only control byte with the top bit set and bit 1 cleared */
+	return w & ~(w << 6) & GROUP_MSBS;
+}
+
+static inline group_mask_t group_match_empty_or_deleted(const uint8_t *ctrl)
+{
+	group_mask_t w = group_load(ctrl);
+
+	/* EMPTY and DELETED are the only control bytes with the top bit set and bit 0 cleared */
+	return w & ~(w << 7) & GROUP_MSBS;
+}
+
+#endif /* SWAR */
+
+struct swiss_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static inline uint8_t *swiss_ctrl(const struct sys_hashmap_swiss_data *data)
+{
+	return (uint8_t *)((struct swiss_entry *)data->buckets + data->n_buckets);
+}
+
+static inline bool swiss_ctrl_is_full(uint8_t ctrl)
+{
+	return (ctrl & 0x80) == 0;
+}
+
+static inline uint32_t swiss_hash(const struct sys_hashmap *map, uint64_t key)
+{
+	return map->hash_func(&key, sizeof(key));
+}
+
+static inline uint8_t swiss_h2(uint32_t hash)
+{
+	return hash & 0x7f;
+}
+
+/*
+ * Visit the groups in triangular order, which reaches every group once since the number of
+ * groups is a power of two.
+ */
+#define SWISS_FOR_EACH_GROUP(_data, _hash, _i, _g)                                                 \
+	for (size_t _i = 0, _g = ((_hash) >> 7) & ((_data)->n_buckets / GROUP_WIDTH - 1);          \
+	     _i < (_data)->n_buckets / GROUP_WIDTH;                                                \
+	     ++_i, _g = (_g + _i) & ((_data)->n_buckets / GROUP_WIDTH - 1))
+
+static struct swiss_entry *sys_hashmap_swiss_find(const struct sys_hashmap *map, uint64_t key)
+{
+	const struct sys_hashmap_swiss_data *data =
+		(const struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *const buckets = data->buckets;
+	const uint8_t *const ctrl = swiss_ctrl(data);
+	uint32_t hash;
+
+	if (data->n_buckets == 0) {
+		return NULL;
+	}
+
+	hash = swiss_hash(map, key);
+
+	SWISS_FOR_EACH_GROUP(data, hash, i, g) {
+		const uint8_t *group = &ctrl[g * GROUP_WIDTH];
+
+		for (group_mask_t m = group_match(group, swiss_h2(hash)); m != 0; m &= m - 1) {
+			size_t j = g * GROUP_WIDTH + (group_first(m) >> GROUP_MASK_SHIFT);
+
+			if (buckets[j].key == key) {
+				return &buckets[j];
+			}
+		}
+
+		if (group_match_empty(group) != 0) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+/* Index of the first EMPTY or DELETED bucket in the probe sequence of @p hash */
+static size_t sys_hashmap_swiss_find_free(const struct sys_hashmap_swiss_data *data,
+					  uint32_t hash)
+{
+	const uint8_t *const ctrl = swiss_ctrl(data);
+
+	SWISS_FOR_EACH_GROUP(data, hash, i, g) {
+		group_mask_t m = group_match_empty_or_deleted(&ctrl[g * GROUP_WIDTH]);
+
+		if (m != 0) {
+			return g * GROUP_WIDTH + (group_first(m) >> GROUP_MASK_SHIFT);
+		}
+	}
+
+	__ASSERT(false, "No free bucket, the load factor has been exceeded");
+
+	return SIZE_MAX;
+}
+
+static void sys_hashmap_swiss_set_ctrl(struct sys_hashmap_swiss_data *data, size_t i,
+				       uint8_t value)
+{
+	swiss_ctrl(data)[i] = value;
+}
+
+static int sys_hashmap_swiss_resize(struct sys_hashmap *map, size_t new_n_buckets)
+{
+	size_t old_n_buckets;
+	struct swiss_entry *old_buckets;
+	const uint8_t *old_ctrl;
+	struct swiss_entry *new_buckets = NULL;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	if (new_n_buckets != 0) {
+		new_buckets = map->alloc_func(NULL, new_n_buckets * (sizeof(*new_buckets) + 1));
+		if (new_buckets == NULL) {
+			return -ENOMEM;
+		}
+
+		memset(&new_buckets[new_n_buckets], CTRL_EMPTY, new_n_buckets);
+	}
+
+	old_n_buckets = data->n_buckets;
+	old_buckets = data->buckets;
+	old_ctrl = swiss_ctrl(data);
+
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+	data->n_tombstones = 0;
+
+	/* re-insert all entries, the keys are known to be unique */
+	for (size_t i = 0, j = 0; i < old_n_buckets && j < data->size; ++i) {
+		if (swiss_ctrl_is_full(old_ctrl[i])) {
+			uint32_t hash = swiss_hash(map, old_buckets[i].key);
+			size_t k = sys_hashmap_swiss_find_free(data, hash);
+
+			sys_hashmap_swiss_set_ctrl(data, k, swiss_h2(hash));
+			new_buckets[k] = old_buckets[i];
+			++j;
+		}
+	}
+
+	if (old_buckets != NULL) {
+		map->alloc_func(old_buckets, 0);
+	}
+
+	return 0;
+}
+
+/*
+ * Purge the tombstones without allocating: every entry is moved to the first free bucket of its
+ * probe sequence, or kept in place when that bucket is in the same group. While purging, DELETED
+ * marks the entries not placed yet, and EMPTY the free buckets.
+ */
+static void sys_hashmap_swiss_drop_tombstones(struct sys_hashmap *map)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *const buckets = data->buckets;
+	uint8_t *const ctrl = swiss_ctrl(data);
+	struct swiss_entry tmp;
+
+	for (size_t i = 0; i < data->n_buckets; ++i) {
+		ctrl[i] = swiss_ctrl_is_full(ctrl[i]) ? CTRL_DELETED : CTRL_EMPTY;
+	}
+
+	for (size_t i = 0; i < data->n_buckets;) {
+		uint32_t hash;
+		size_t j;
+
+		if (ctrl[i] != CTRL_DELETED) {
+			++i;
+			continue;
+		}
+
+		hash = swiss_hash(map, buckets[i].key);
+		j = sys_hashmap_swiss_find_free(data, hash);
+
+		if (j / GROUP_WIDTH == i / GROUP_WIDTH) {
+			ctrl[i] = swiss_h2(hash);
+			++i;
+		} else if (ctrl[j] == CTRL_EMPTY) {
+			ctrl[j] = swiss_h2(hash);
+			buckets[j] = buckets[i];
+			ctrl[i] = CTRL_EMPTY;
+			++i;
+		} else {
+			/* swap with an entry not placed yet, then place that one */
+			ctrl[j] = swiss_h2(hash);
+			tmp = buckets[j];
+			buckets[j] = buckets[i];
+			buckets[i] = tmp;
+		}
+	}
+
+	data->n_tombstones = 0;
+}
+
+/* Make room for one more entry */
+static int sys_hashmap_swiss_reserve(struct sys_hashmap *map)
+{
+	size_t n_buckets;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	const uint8_t load_factor = map->config->load_factor;
+
+	if (data->n_buckets != 0 &&
+	    (data->size + data->n_tombstones + 1) * 100 <= data->n_buckets * load_factor) {
+		return 0;
+	}
+
+	/* purge in place when the table is no more than half loaded without its tombstones */
+	if (data->n_tombstones != 0 &&
+	    (data->size + 1) * 200 <= data->n_buckets * load_factor) {
+		sys_hashmap_swiss_drop_tombstones(map);
+		return 0;
+	}
+
+	if (data->n_buckets == 0) {
+		n_buckets = MAX(GROUP_WIDTH, map->config->initial_n_buckets);
+		n_buckets = NHPOT(n_buckets);
+	} else {
+		n_buckets = data->n_buckets * 2;
+	}
+
+	/* a table of n_buckets must be able to hold at least one entry */
+	while (n_buckets * load_factor < 100) {
+		n_buckets *= 2;
+	}
+
+	return sys_hashmap_swiss_resize(map, n_buckets);
+}
+
+static void sys_hashmap_swiss_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	const struct sys_hashmap_swiss_data *data =
+		(const struct sys_hashmap_swiss_data *)map->data;
+	const struct swiss_entry *buckets = data->buckets;
+	const uint8_t *ctrl = swiss_ctrl(data);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = NULL;
+	}
+
+	/* the state holds the index of the next bucket to visit */
+	for (i = (uintptr_t)it->state; i < data->n_buckets; ++i) {
+		if (swiss_ctrl_is_full(ctrl[i])) {
+			it->state = (void *)(uintptr_t)(i + 1);
+			it->key = buckets[i].key;
+			it->value = buckets[i].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Swiss Table Hashmap API
+ */
+
+static void sys_hashmap_swiss_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_swiss_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_swiss_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	const struct swiss_entry *buckets = data->buckets;
+	const uint8_t *ctrl = swiss_ctrl(data);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		if (swiss_ctrl_is_full(ctrl[i])) {
+			cb(buckets[i].key, buckets[i].value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+	data->n_tombstones = 0;
+}
+
+static int sys_hashmap_swiss_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				    uint64_t *old_value)
+{
+	int ret;
+	size_t i;
+	uint32_t hash;
+	struct swiss_entry *entry;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	entry = sys_hashmap_swiss_find(map, key);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
+	if (data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	ret = sys_hashmap_swiss_reserve(map);
+	if (ret < 0) {
+		return ret;
+	}
+
+	hash = swiss_hash(map, key);
+	i = sys_hashmap_swiss_find_free(data, hash);
+	if (swiss_ctrl(data)[i] == CTRL_DELETED) {
+		--data->n_tombstones;
+	}
+
+	sys_hashmap_swiss_set_ctrl(data, i, swiss_h2(hash));
+	entry = &((struct swiss_entry *)data->buckets)[i];
+	entry->key = key;
+	entry->value = value;
+	++data->size;
+
+	return 1;
+}
+
+static bool sys_hashmap_swiss_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t i;
+	struct swiss_entry *entry;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	entry = sys_hashmap_swiss_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	i = entry - (struct swiss_entry *)data->buckets;
+	--data->size;
+
+	/*
+	 * A group holding an EMPTY bucket has never been full since the last rehash, so no probe
+	 * went past it and the bucket can be freed without leaving a tombstone.
+	 */
+	if (group_match_empty(&swiss_ctrl(data)[i - i % GROUP_WIDTH]) != 0) {
+		sys_hashmap_swiss_set_ctrl(data, i, CTRL_EMPTY);
+	} else {
+		sys_hashmap_swiss_set_ctrl(data, i, CTRL_DELETED);
+		++data->n_tombstones;
+	}
+
+	/* shrink by half once a quarter of the load factor is reached, ignoring -ENOMEM */
+	if (data->size == 0) {
+		(void)sys_hashmap_swiss_resize(map, 0);
+	} else if (data->n_buckets > GROUP_WIDTH &&
+		   data->size * 400 < data->n_buckets * map->config->load_factor) {
+		(void)sys_hashmap_swiss_resize(map, data->n_buckets / 2);
+	}
+
+	return true;
+}
+
+static bool sys_hashmap_swiss_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct swiss_entry *entry;
+
+	entry = sys_hashmap_swiss_find(map, key);
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_swiss_api = {
+	.iter = sys_hashmap_swiss_iter,
+	.clear = sys_hashmap_swiss_clear,
+	.insert = sys_hashmap_swiss_insert,
+	.remove = sys_hashmap_swiss_remove,
+	.get = sys_hashmap_swiss_get,
+};
@@ -21,6 +21,32 @@ static inline void increase_allocated_bytes(struct z_heap *h, size_t num_bytes)
 }
 #endif
 
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+static inline uint32_t alloc_latency_start(void)
+{
+	return k_cycle_get_32();
+}
+
+static inline void alloc_latency_record(struct z_heap *h, uint32_t start)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+	int bin = (cycles == 0U) ? 0 : (31 - __builtin_clz(cycles));
+
+	h->alloc_latency[MIN(bin, SYS_HEAP_LATENCY_BINS - 1)]++;
+}
+#else
+static inline uint32_t alloc_latency_start(void)
+{
+	return 0;
+}
+
+static inline void alloc_latency_record(struct z_heap *h, uint32_t start)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(start);
+}
+#endif
+
 static void *chunk_mem(struct z_heap *h, chunkid_t c)
 {
 	chunk_unit_t *buf = chunk_buf(h);
@@ -148,6 +174,118 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_TCACHE
+/* All cache slots are protected by the caller's heap lock like the rest
+ * of the heap, the CPU only selects which one to use.  User threads
+ * cannot read the CPU structure and share the first slot.
+ */
+static inline struct z_heap_tcache *tcache_local(struct z_heap *h)
+{
+#ifdef CONFIG_SMP
+	if (!k_is_user_context()) {
+		return &h->tcache[arch_curr_cpu()->id];
+	}
+#endif
+	return &h->tcache[0];
+}
+
+static chunkid_t tcache_get(struct z_heap *h, chunksz_t sz)
+{
+	if (sz >= Z_HEAP_TCACHE_CLASSES) {
+		return 0;
+	}
+
+	struct z_heap_tcache *t = tcache_local(h);
+	chunkid_t c = t->next[sz];
+
+	if (c != 0U) {
+		CHECK(chunk_used(h, c) && chunk_size(h, c) == sz);
+		t->next[sz] = next_free_chunk(h, c);
+		t->count[sz]--;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+	}
+
+	return c;
+}
+
+/* Takes a used chunk the caller is done with, leaving it marked used */
+static bool tcache_put(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	if ((sz >= Z_HEAP_TCACHE_CLASSES) || solo_free_header(h, c)) {
+		return false;
+	}
+
+	struct z_heap_tcache *t = tcache_local(h);
+
+	if (t->count[sz] >= CONFIG_SYS_HEAP_TCACHE_DEPTH) {
+		return false;
+	}
+
+	set_next_free_chunk(h, c, t->next[sz]);
+	t->next[sz] = c;
+	t->count[sz]++;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+
+	return true;
+}
+
+/* Returns all cached chunks to the heap, true if there were any */
+static bool tcache_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (int s = 0; s < TCACHE_SLOTS; s++) {
+		struct z_heap_tcache *t = &h->tcache[s];
+
+		for (int i = 0; i < Z_HEAP_TCACHE_CLASSES; i++) {
+			while (t->next[i] != 0U) {
+				chunkid_t c = t->next[i];
+
+				t->next[i] = next_free_chunk(h, c);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+				h->free_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+				set_chunk_used(h, c, false);
+				free_chunk(h, c);
+				flushed = true;
+			}
+			t->count[i] = 0;
+		}
+	}
+
+	return flushed;
+}
+#else
+static inline chunkid_t tcache_get(struct z_heap *h, chunksz_t sz)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(sz);
+
+	return 0;
+}
+
+static inline bool tcache_put(struct z_heap *h, chunkid_t c)
+{
+	ARG_UNUSED(h);
+	ARG_UNUSED(c);
+
+	return false;
+}
+
+static inline bool tcache_flush(struct z_heap *h)
+{
+	ARG_UNUSED(h);
+
+	return false;
+}
+#endif /* CONFIG_SYS_HEAP_TCACHE */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,7 +322,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +331,11 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	if (tcache_put(h, c)) {
+		return;
+	}
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -257,10 +399,15 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 		return c;
 	}
 
+	/* Last resort: give cached chunks back and try again */
+	if (tcache_flush(h)) {
+		return alloc_chunk(h, sz);
+	}
+
 	return 0;
 }
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+static ALWAYS_INLINE void *heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -270,19 +417,22 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes, 0);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = tcache_get(h, chunk_sz);
 
 	if (c == 0U) {
-		return NULL;
-	}
+		c = alloc_chunk(h, chunk_sz);
+		if (c == 0U) {
+			return NULL;
+		}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
-	}
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
 
-	set_chunk_used(h, c, true);
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -299,6 +449,16 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	return mem;
 }
 
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	uint32_t start = alloc_latency_start();
+	void *mem = heap_alloc(heap, bytes);
+
+	alloc_latency_record(heap->heap, start);
+
+	return mem;
+}
+
 void *sys_heap_noalign_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	ARG_UNUSED(align);
@@ -306,7 +466,7 @@ void *sys_heap_noalign_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	return sys_heap_alloc(heap, bytes);
 }
 
-void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+static void *heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	size_t gap, rew;
@@ -324,7 +484,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		gap = MIN(rew, chunk_header_bytes(h));
 	} else {
 		if (align <= chunk_header_bytes(h)) {
-			return sys_heap_alloc(heap, bytes);
+			return heap_alloc(heap, bytes);
 		}
 		rew = 0;
 		gap = chunk_header_bytes(h);
@@ -384,6 +544,16 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	return mem;
 }
 
+void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	uint32_t start = alloc_latency_start();
+	void *mem = heap_aligned_alloc(heap, align, bytes);
+
+	alloc_latency_record(heap->heap, start);
+
+	return mem;
+}
+
 static bool inplace_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -556,6 +726,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->allocated_bytes = 0;
 	h->max_allocated_bytes = 0;
 #endif
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+	memset(h->alloc_latency, 0, sizeof(h->alloc_latency));
+#endif
 
 #if CONFIG_SYS_HEAP_ARRAY_SIZE
 	sys_heap_array_save(heap);
@@ -571,6 +744,10 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_TCACHE
+	memset(h->tcache, 0, sizeof(h->tcache));
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -65,6 +65,25 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+/* Freed chunks small enough to be cached are kept, still marked used,
+ * on a LIFO list per exact chunk size threaded through their FREE_NEXT
+ * field, and handed out again without touching the free lists.  On SMP
+ * there is one set of lists per CPU so a CPU preferably reuses memory
+ * it touched last.
+ */
+#ifdef CONFIG_SYS_HEAP_TCACHE
+#ifdef CONFIG_SMP
+#define TCACHE_SLOTS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TCACHE_SLOTS 1
+#endif
+
+struct z_heap_tcache {
+	chunkid_t next[Z_HEAP_TCACHE_CLASSES];
+	uint8_t count[Z_HEAP_TCACHE_CLASSES];
+};
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +92,12 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+	uint32_t alloc_latency[SYS_HEAP_LATENCY_BINS];
+#endif
+#ifdef CONFIG_SYS_HEAP_TCACHE
+	struct z_heap_tcache tcache[TCACHE_SLOTS];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -279,6 +304,18 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_TCACHE
+	/* cached chunks are marked used but account as free */
+	for (int s = 0; s < TCACHE_SLOTS; s++) {
+		for (int i = 0; i < Z_HEAP_TCACHE_CLASSES; i++) {
+			for (c = h->tcache[s].next[i]; c != 0; c = next_free_chunk(h, c)) {
+				*alloc_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+				*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
+			}
+		}
+	}
+#endif
 }
 
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
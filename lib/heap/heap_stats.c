@@ -6,6 +6,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
+#include <string.h>
 #include "heap.h"
 
 int sys_heap_runtime_stats_get(struct sys_heap *heap,
@@ -32,3 +33,51 @@ int sys_heap_runtime_stats_reset_max(struct sys_heap *heap)
 
 	return 0;
 }
+
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+int sys_heap_frag_stats_get(struct sys_heap *heap, struct sys_heap_frag_stats *stats)
+{
+	if ((heap == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	struct z_heap *h = heap->heap;
+	int nb_buckets = bucket_idx(h, h->end_chunk) + 1;
+	chunksz_t largest = 0;
+
+	memset(stats, 0, sizeof(*stats));
+
+	for (int i = 0; i < nb_buckets; i++) {
+		chunkid_t first = h->buckets[i].next;
+		chunkid_t c = first;
+
+		if (first == 0U) {
+			continue;
+		}
+
+		do {
+			stats->bucket_chunks[i]++;
+			largest = MAX(largest, chunk_size(h, c));
+			c = next_free_chunk(h, c);
+		} while (c != first);
+
+		stats->free_chunks += stats->bucket_chunks[i];
+	}
+
+	stats->largest_free_bytes = chunksz_to_bytes(h, largest);
+	memcpy(stats->alloc_latency, h->alloc_latency, sizeof(stats->alloc_latency));
+
+	return 0;
+}
+
+int sys_heap_frag_stats_reset(struct sys_heap *heap)
+{
+	if (heap == NULL) {
+		return -EINVAL;
+	}
+
+	memset(heap->heap->alloc_latency, 0, sizeof(heap->heap->alloc_latency));
+
+	return 0;
+}
+#endif /* CONFIG_SYS_HEAP_FRAG_STATS */
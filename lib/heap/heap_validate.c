@@ -85,6 +85,23 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_TCACHE
+	/* Cached chunks must be used chunks of their class size */
+	for (int s = 0; s < TCACHE_SLOTS; s++) {
+		for (int i = 0; i < Z_HEAP_TCACHE_CLASSES; i++) {
+			uint32_t n = 0;
+
+			for (c = h->tcache[s].next[i]; c != 0; c = next_free_chunk(h, c)) {
+				VALIDATE(in_bounds(h, c));
+				VALIDATE(chunk_used(h, c));
+				VALIDATE(chunk_size(h, c) == i);
+				VALIDATE(++n <= CONFIG_SYS_HEAP_TCACHE_DEPTH);
+			}
+			VALIDATE(n == h->tcache[s].count[i]);
+		}
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
@@ -7,6 +7,7 @@
  */
 
 #include <string.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <sys/types.h>
 
@@ -234,65 +235,152 @@ int memcmp(const void *m1, const void *m2, size_t n)
 	return *c1 - *c2;
 }
 
-/**
- *
- * @brief Copy bytes in memory with overlapping areas
- *
- * @return pointer to destination buffer <d>
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE) && defined(CONFIG_MINIMAL_LIBC_STRING_SIMD)
+#if defined(__ARM_FEATURE_MVE)
+#include <arm_mve.h>
+#define STRING_MVE
+#elif defined(__riscv_vector)
+#include <riscv_vector.h>
+#define STRING_RVV
+#endif
+#endif
+
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+#if defined(__ARM_FEATURE_UNALIGNED) || defined(__aarch64__) || defined(__i386__) ||             \
+	defined(__x86_64__) || defined(__riscv_misaligned_fast)
+/* Words read from any address, when the CPU supports it */
+typedef mem_word_t __attribute__((__aligned__(1), __may_alias__)) mem_uword_t;
+#define STRING_UNALIGNED_LOADS
+#endif
+
+/*
+ * The word copies move four words per step, which Arm cores turn into multiple load and store
+ * instructions. All the words of a step are read before any is written, so that copying forward
+ * stays safe when <dest> overlaps the end of <src>, and backward when it overlaps the start.
  */
 
-void *memmove(void *d, const void *s, size_t n)
+static size_t copy_words_fwd(mem_word_t *d_word, const mem_word_t *s_word, size_t n)
 {
-	char *dest = d;
-	const char *src  = s;
+	size_t words = n / sizeof(mem_word_t);
+
+	for (; words >= 4; words -= 4) {
+		mem_word_t w0 = s_word[0];
+		mem_word_t w1 = s_word[1];
+		mem_word_t w2 = s_word[2];
+		mem_word_t w3 = s_word[3];
+
+		d_word[0] = w0;
+		d_word[1] = w1;
+		d_word[2] = w2;
+		d_word[3] = w3;
+		d_word += 4;
+		s_word += 4;
+	}
 
-	if ((size_t) (dest - src) < n) {
-		/*
-		 * The <src> buffer overlaps with the start of the <dest> buffer.
-		 * Copy backwards to prevent the premature corruption of <src>.
-		 */
+	while (words > 0) {
+		*(d_word++) = *(s_word++);
+		words--;
+	}
 
-		while (n > 0) {
-			n--;
-			dest[n] = src[n];
-		}
-	} else {
-		/* It is safe to perform a forward-copy */
-		while (n > 0) {
-			*dest = *src;
-			dest++;
-			src++;
-			n--;
-		}
+	return n & ~(sizeof(mem_word_t) - 1);
+}
+
+#if defined(STRING_UNALIGNED_LOADS)
+static size_t copy_words_fwd_unaligned(mem_word_t *d_word, const mem_uword_t *s_word, size_t n)
+{
+	size_t words = n / sizeof(mem_word_t);
+
+	for (; words >= 4; words -= 4) {
+		mem_word_t w0 = s_word[0];
+		mem_word_t w1 = s_word[1];
+		mem_word_t w2 = s_word[2];
+		mem_word_t w3 = s_word[3];
+
+		d_word[0] = w0;
+		d_word[1] = w1;
+		d_word[2] = w2;
+		d_word[3] = w3;
+		d_word += 4;
+		s_word += 4;
 	}
 
-	return d;
+	while (words > 0) {
+		*(d_word++) = *(s_word++);
+		words--;
+	}
+
+	return n & ~(sizeof(mem_word_t) - 1);
 }
+#endif
 
-/**
- *
- * @brief Copy bytes in memory
- *
- * @return pointer to start of destination buffer
- */
+/* Copy the words ending at <d_end> and <s_end>, returns the number of bytes copied */
+static size_t copy_words_bwd(mem_word_t *d_end, const mem_word_t *s_end, size_t n)
+{
+	size_t words = n / sizeof(mem_word_t);
 
-void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
+	for (; words >= 4; words -= 4) {
+		d_end -= 4;
+		s_end -= 4;
+
+		mem_word_t w0 = s_end[0];
+		mem_word_t w1 = s_end[1];
+		mem_word_t w2 = s_end[2];
+		mem_word_t w3 = s_end[3];
+
+		d_end[0] = w0;
+		d_end[1] = w1;
+		d_end[2] = w2;
+		d_end[3] = w3;
+	}
+
+	while (words > 0) {
+		*(--d_end) = *(--s_end);
+		words--;
+	}
+
+	return n & ~(sizeof(mem_word_t) - 1);
+}
+#endif /* !CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE */
+
+/* Copy from the start, safe when <d> does not overlap the end of <s> */
+static inline void copy_fwd(unsigned char *d_byte, const unsigned char *s_byte, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
+#if defined(STRING_MVE)
+	for (; n >= 16; n -= 16) {
+		vst1q_u8(d_byte, vld1q_u8(s_byte));
+		d_byte += 16;
+		s_byte += 16;
+	}
 
-	unsigned char *d_byte = (unsigned char *)d;
-	const unsigned char *s_byte = (const unsigned char *)s;
+	if (n > 0) {
+		mve_pred16_t p = vctp8q(n);
 
+		vstrbq_p_u8(d_byte, vldrbq_z_u8(s_byte, p), p);
+	}
+#elif defined(STRING_RVV)
+	for (size_t vl; n > 0; n -= vl) {
+		vl = __riscv_vsetvl_e8m8(n);
+		__riscv_vse8_v_u8m8(d_byte, __riscv_vle8_v_u8m8(s_byte, vl), vl);
+		d_byte += vl;
+		s_byte += vl;
+	}
+#else
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
 	const uintptr_t mask = sizeof(mem_word_t) - 1;
-
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
-
+	bool aligned = (((uintptr_t)d_byte ^ (uintptr_t)s_byte) & mask) == 0;
+	size_t done;
+
+#if defined(STRING_UNALIGNED_LOADS)
+	/* unaligned loads only pay off over a few words */
+	if (aligned || (n >= 4 * sizeof(mem_word_t))) {
+#else
+	if (aligned) {
+#endif
 		/* do byte-sized copying until word-aligned or finished */
 
 		while (((uintptr_t)d_byte) & mask) {
 			if (n == 0) {
-				return d;
+				return;
 			}
 			*(d_byte++) = *(s_byte++);
 			n--;
@@ -300,16 +388,20 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 
 		/* do word-sized copying as long as possible */
 
-		mem_word_t *d_word = (mem_word_t *)d_byte;
-		const mem_word_t *s_word = (const mem_word_t *)s_byte;
-
-		while (n >= sizeof(mem_word_t)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
+#if defined(STRING_UNALIGNED_LOADS)
+		if (!aligned) {
+			done = copy_words_fwd_unaligned((mem_word_t *)d_byte,
+							(const mem_uword_t *)s_byte, n);
+		} else {
+			done = copy_words_fwd((mem_word_t *)d_byte, (const mem_word_t *)s_byte, n);
 		}
+#else
+		done = copy_words_fwd((mem_word_t *)d_byte, (const mem_word_t *)s_byte, n);
+#endif
 
-		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
+		d_byte += done;
+		s_byte += done;
+		n -= done;
 	}
 #endif
 
@@ -319,6 +411,96 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 		*(d_byte++) = *(s_byte++);
 		n--;
 	}
+#endif
+}
+
+/* Copy from the end, safe when <d> does not overlap the start of <s> */
+static inline void copy_bwd(unsigned char *d_byte, const unsigned char *s_byte, size_t n)
+{
+#if defined(STRING_MVE)
+	while (n >= 16) {
+		n -= 16;
+		vst1q_u8(d_byte + n, vld1q_u8(s_byte + n));
+	}
+
+	if (n > 0) {
+		mve_pred16_t p = vctp8q(n);
+
+		vstrbq_p_u8(d_byte, vldrbq_z_u8(s_byte, p), p);
+	}
+#elif defined(STRING_RVV)
+	for (size_t vl; n > 0;) {
+		vl = __riscv_vsetvl_e8m8(n);
+		n -= vl;
+		__riscv_vse8_v_u8m8(d_byte + n, __riscv_vle8_v_u8m8(s_byte + n, vl), vl);
+	}
+#else
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+	if ((((uintptr_t)d_byte ^ (uintptr_t)s_byte) & mask) == 0) {
+		/* do byte-sized copying until the end is word-aligned or finished */
+
+		while (((uintptr_t)(d_byte + n)) & mask) {
+			if (n == 0) {
+				return;
+			}
+			n--;
+			d_byte[n] = s_byte[n];
+		}
+
+		/* do word-sized copying as long as possible */
+
+		n -= copy_words_bwd((mem_word_t *)(d_byte + n), (const mem_word_t *)(s_byte + n), n);
+	}
+#endif
+
+	/* do byte-sized copying until finished */
+
+	while (n > 0) {
+		n--;
+		d_byte[n] = s_byte[n];
+	}
+#endif
+}
+
+/**
+ *
+ * @brief Copy bytes in memory with overlapping areas
+ *
+ * @return pointer to destination buffer <d>
+ */
+
+void *memmove(void *d, const void *s, size_t n)
+{
+	unsigned char *dest = d;
+	const unsigned char *src = s;
+
+	if ((size_t) (dest - src) < n) {
+		/*
+		 * The <src> buffer overlaps with the start of the <dest> buffer.
+		 * Copy backwards to prevent the premature corruption of <src>.
+		 */
+
+		copy_bwd(dest, src, n);
+	} else {
+		/* It is safe to perform a forward-copy */
+		copy_fwd(dest, src, n);
+	}
+
+	return d;
+}
+
+/**
+ *
+ * @brief Copy bytes in memory
+ *
+ * @return pointer to start of destination buffer
+ */
+
+void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
+{
+	copy_fwd((unsigned char *)d, (const unsigned char *)s, n);
 
 	return d;
 }
@@ -332,12 +514,34 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 
 void *memset(void *buf, int c, size_t n)
 {
-	/* do byte-sized initialization until word-aligned or finished */
-
 	unsigned char *d_byte = (unsigned char *)buf;
 	unsigned char c_byte = (unsigned char)c;
 
+#if defined(STRING_MVE)
+	uint8x16_t c_vec = vdupq_n_u8(c_byte);
+
+	for (; n >= 16; n -= 16) {
+		vst1q_u8(d_byte, c_vec);
+		d_byte += 16;
+	}
+
+	if (n > 0) {
+		vstrbq_p_u8(d_byte, c_vec, vctp8q(n));
+	}
+
+	return buf;
+#elif defined(STRING_RVV)
+	for (size_t vl; n > 0; n -= vl) {
+		vl = __riscv_vsetvl_e8m8(n);
+		__riscv_vse8_v_u8m8(d_byte, __riscv_vmv_v_x_u8m8(c_byte, vl), vl);
+		d_byte += vl;
+	}
+
+	return buf;
+#else
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* do byte-sized initialization until word-aligned or finished */
+
 	while (((uintptr_t)d_byte) & (sizeof(mem_word_t) - 1)) {
 		if (n == 0) {
 			return buf;
@@ -357,6 +561,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
@@ -373,6 +586,7 @@ void *memset(void *buf, int c, size_t n)
 	}
 
 	return buf;
+#endif
 }
 
 /**
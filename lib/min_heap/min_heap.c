@@ -10,6 +10,21 @@
 
 LOG_MODULE_REGISTER(min_heap);
 
+/* Tell the owner of the element at index where it now lives */
+static inline void set_index(struct min_heap *heap, size_t index)
+{
+	if (heap->index_cb != NULL) {
+		heap->index_cb(min_heap_get_element(heap, index), index);
+	}
+}
+
+static inline void swap(struct min_heap *heap, size_t a, size_t b)
+{
+	byteswp(min_heap_get_element(heap, a), min_heap_get_element(heap, b), heap->elem_size);
+	set_index(heap, a);
+	set_index(heap, b);
+}
+
 /**
  * @brief Restore heap order by moving a node up the tree.
  *
@@ -18,54 +33,54 @@ LOG_MODULE_REGISTER(min_heap);
  *
  * @param heap Pointer to the min-heap.
  * @param index Index of the node to heapify upwards.
+ *
+ * @return true if the node moved.
  */
-static void heapify_up(struct min_heap *heap, size_t index)
+static bool heapify_up(struct min_heap *heap, size_t index)
 {
+	size_t start = index;
+
 	while (index > 0) {
-		size_t parent = (index - 1) / 2;
+		size_t parent = (index - 1) / MIN_HEAP_ARITY;
 		void *curr = min_heap_get_element(heap, index);
 		void *par = min_heap_get_element(heap, parent);
 
 		if (heap->cmp(curr, par) >= 0) {
 			break;
 		}
-		byteswp(curr, par, heap->elem_size);
+		swap(heap, index, parent);
 		index = parent;
 	}
+
+	return index != start;
 }
 
 /**
  * @brief Restore heap order by moving a node down the tree.
  *
  * Moves the node at the specified index downward in the heap until the
- * min-heap property is restored.
+ * min-heap property is restored. Each level compares the node with its
+ * MIN_HEAP_ARITY children, which are contiguous in memory.
  *
  * @param heap Pointer to the min-heap.
  * @param index Index of the node to heapify downward.
  */
-
 static void heapify_down(struct min_heap *heap, size_t index)
 {
-	/* Terminate the loop naturally when the left child is out of bounds */
-	for (size_t left = 2 * index + 1; left < heap->size; left = 2 * index + 1) {
+	/* Terminate the loop naturally when the first child is out of bounds */
+	for (size_t first = MIN_HEAP_ARITY * index + 1; first < heap->size;
+	     first = MIN_HEAP_ARITY * index + 1) {
 
-		size_t right = left + 1;
+		size_t last = MIN(first + MIN_HEAP_ARITY, heap->size);
 		size_t smallest = index;
-		void *elem_index = min_heap_get_element(heap, index);
-		void *elem_left = min_heap_get_element(heap, left);
-		void *elem_smallest = elem_index;
+		void *elem_smallest = min_heap_get_element(heap, index);
 
-		if (heap->cmp(elem_left, elem_index) < 0) {
-			smallest = left;
-			elem_smallest = elem_left;
-		}
+		for (size_t child = first; child < last; child++) {
+			void *elem_child = min_heap_get_element(heap, child);
 
-		if (right < heap->size) {
-			void *elem_right = min_heap_get_element(heap, right);
-
-			if (heap->cmp(elem_right, elem_smallest) < 0) {
-				smallest = right;
-				elem_smallest = elem_right;
+			if (heap->cmp(elem_child, elem_smallest) < 0) {
+				smallest = child;
+				elem_smallest = elem_child;
 			}
 		}
 
@@ -73,12 +88,11 @@ static void heapify_down(struct min_heap *heap, size_t index)
 			break;
 		}
 
-		byteswp(elem_index, elem_smallest, heap->elem_size);
+		swap(heap, index, smallest);
 		index = smallest;
 	}
 }
 
-
 void min_heap_init(struct min_heap *heap, void *storage, size_t cap,
 		   size_t elem_size, min_heap_cmp_t cmp)
 {
@@ -86,9 +100,42 @@ void min_heap_init(struct min_heap *heap, void *storage, size_t cap,
 	heap->capacity = cap;
 	heap->elem_size = elem_size;
 	heap->cmp = cmp;
+	heap->index_cb = NULL;
 	heap->size = 0;
 }
 
+void min_heap_set_index_cb(struct min_heap *heap, min_heap_index_t index_cb)
+{
+	heap->index_cb = index_cb;
+
+	for (size_t i = 0; i < heap->size; i++) {
+		set_index(heap, i);
+	}
+}
+
+int min_heap_build(struct min_heap *heap, const void *items, size_t count)
+{
+	if (count > heap->capacity) {
+		return -ENOMEM;
+	}
+
+	if (items != heap->storage) {
+		memcpy(heap->storage, items, count * heap->elem_size);
+	}
+	heap->size = count;
+
+	for (size_t i = 0; i < count; i++) {
+		set_index(heap, i);
+	}
+
+	/* Floyd's construction, sift down every parent from the last one: O(n) */
+	for (size_t i = (count + MIN_HEAP_ARITY - 2) / MIN_HEAP_ARITY; i-- > 0;) {
+		heapify_down(heap, i);
+	}
+
+	return 0;
+}
+
 void *min_heap_peek(const struct min_heap *heap)
 {
 	if (heap->size == 0) {
@@ -107,8 +154,9 @@ int min_heap_push(struct min_heap *heap, const void *item)
 	void *dest = min_heap_get_element(heap, heap->size);
 
 	memcpy(dest, item, heap->elem_size);
-	heapify_up(heap, heap->size);
 	heap->size++;
+	set_index(heap, heap->size - 1);
+	heapify_up(heap, heap->size - 1);
 
 	return 0;
 }
@@ -122,18 +170,37 @@ bool min_heap_remove(struct min_heap *heap, size_t id, void *out_buf)
 	void *removed = min_heap_get_element(heap, id);
 
 	memcpy(out_buf, removed, heap->elem_size);
+	if (heap->index_cb != NULL) {
+		heap->index_cb(out_buf, MIN_HEAP_NO_INDEX);
+	}
+
 	heap->size--;
 	if (id != heap->size) {
 		void *last = min_heap_get_element(heap, heap->size);
 
 		memcpy(removed, last, heap->elem_size);
-		heapify_down(heap, id);
-		heapify_up(heap, id);
+		set_index(heap, id);
+		if (!heapify_up(heap, id)) {
+			heapify_down(heap, id);
+		}
 	}
 
 	return true;
 }
 
+int min_heap_update(struct min_heap *heap, size_t id)
+{
+	if (id >= heap->size) {
+		return -EINVAL;
+	}
+
+	if (!heapify_up(heap, id)) {
+		heapify_down(heap, id);
+	}
+
+	return 0;
+}
+
 bool min_heap_pop(struct min_heap *heap, void *out_buf)
 {
 	return min_heap_remove(heap, 0, out_buf);
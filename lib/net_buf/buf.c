@@ -17,6 +17,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/dma_memcpy.h>
 
 #include <zephyr/net_buf.h>
 
@@ -93,6 +94,138 @@ void net_buf_reset(struct net_buf *buf)
 	net_buf_simple_reset(&buf->b);
 }
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+static struct net_buf_pool_cache *pool_cache(struct net_buf_pool *pool)
+{
+#if defined(CONFIG_SMP)
+	/* Being migrated right after reading the CPU id only costs locality */
+	return &pool->cache[arch_curr_cpu()->id];
+#else
+	return &pool->cache[0];
+#endif
+}
+
+static int cache_get(struct net_buf_pool *pool, struct net_buf **bufs, int count)
+{
+	struct net_buf_pool_cache *cache = pool_cache(pool);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	int n = 0;
+
+	while ((n < count) && (cache->count > 0U)) {
+		bufs[n++] = cache->bufs[--cache->count];
+	}
+
+	cache->hits += n;
+	if (n < count) {
+		cache->misses++;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return n;
+}
+
+/* Keep a free buffer on the current CPU, unless a thread waits for the LIFO */
+static bool cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	struct net_buf_pool_cache *cache = pool_cache(pool);
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool cached = false;
+
+	/* Checked under the cache lock, which cache_flush() takes after
+	 * registering a waiter, so that no buffer is cached behind its back.
+	 */
+	if ((cache->count < CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE) &&
+	    (atomic_get(&pool->cache_waiters) == 0)) {
+		cache->bufs[cache->count++] = buf;
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return cached;
+}
+
+/* Return the buffers cached by all CPUs to the LIFO */
+static void cache_flush(struct net_buf_pool *pool)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct net_buf_pool_cache *cache = &pool->cache[cpu];
+		sys_slist_t list;
+		k_spinlock_key_t key;
+
+		sys_slist_init(&list);
+
+		key = k_spin_lock(&cache->lock);
+		while (cache->count > 0U) {
+			sys_slist_append(&list, &cache->bufs[--cache->count]->node);
+		}
+		k_spin_unlock(&cache->lock, key);
+
+		/* Outside the cache lock, as this may wake a waiter up */
+		if (!sys_slist_is_empty(&list)) {
+			k_queue_merge_slist(&pool->free._queue, &list);
+		}
+	}
+}
+
+void z_net_buf_pool_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	if (!cache_put(pool, buf)) {
+		k_lifo_put(&pool->free, buf);
+	}
+}
+#endif /* CONFIG_NET_BUF_POOL_CPU_CACHE */
+
+void net_buf_pool_cache_stats_get(struct net_buf_pool *pool,
+				  struct net_buf_pool_cache_stats *stats)
+{
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(stats);
+
+	stats->hits = 0U;
+	stats->misses = 0U;
+
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		stats->hits += pool->cache[cpu].hits;
+		stats->misses += pool->cache[cpu].misses;
+	}
+#endif
+}
+
+/* Take a buffer from the LIFO, waiting up to timeout for one */
+static struct net_buf *free_get(struct net_buf_pool *pool, k_timeout_t timeout)
+{
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+	bool wait = !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+	struct net_buf *buf;
+
+	buf = k_lifo_get(&pool->free, K_NO_WAIT);
+	if (buf) {
+		return buf;
+	}
+
+	/* Other CPUs may hold the free buffers, and must give the next ones
+	 * to the LIFO while this thread waits.
+	 */
+	if (wait) {
+		atomic_inc(&pool->cache_waiters);
+	}
+
+	cache_flush(pool);
+	buf = k_lifo_get(&pool->free, timeout);
+
+	if (wait) {
+		atomic_dec(&pool->cache_waiters);
+	}
+
+	return buf;
+#else
+	return k_lifo_get(&pool->free, timeout);
+#endif
+}
+
 static uint8_t *generic_data_ref(struct net_buf *buf, uint8_t *data)
 {
 	uint8_t *ref_count;
@@ -222,6 +355,44 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+/* Prepare a buffer taken from the pool, which is freed on failure */
+static int buf_init(struct net_buf_pool *pool, struct net_buf *buf, size_t size,
+		    k_timepoint_t end)
+{
+	if (size) {
+#if __ASSERT_ON
+		size_t req_size = size;
+#endif
+		buf->__buf = data_alloc(buf, &size, sys_timepoint_timeout(end));
+		if (!buf->__buf) {
+			net_buf_destroy(buf);
+			return -ENOMEM;
+		}
+
+#if __ASSERT_ON
+		NET_BUF_ASSERT(req_size <= size);
+#endif
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	memset(buf->user_data, 0, buf->user_data_size);
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+	pool->max_used = MAX(pool->max_used,
+			     pool->buf_count - atomic_get(&pool->avail_count));
+#endif
+
+	return 0;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -239,6 +410,12 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+	if (cache_get(pool, &buf, 1) == 1) {
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -274,7 +451,7 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
-		buf = k_lifo_get(&pool->free, K_NO_WAIT);
+		buf = free_get(pool, K_NO_WAIT);
 		while (!buf) {
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 			NET_BUF_WARN("%s():%d: Pool %s low on buffers.",
@@ -283,7 +460,7 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 			NET_BUF_WARN("%s():%d: Pool %p low on buffers.",
 				     func, line, pool);
 #endif
-			buf = k_lifo_get(&pool->free, WARN_ALLOC_INTERVAL);
+			buf = free_get(pool, WARN_ALLOC_INTERVAL);
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 			NET_BUF_WARN("%s():%d: Pool %s blocked for %u secs",
 				     func, line, pool->name,
@@ -295,10 +472,10 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #endif
 		}
 	} else {
-		buf = k_lifo_get(&pool->free, timeout);
+		buf = free_get(pool, timeout);
 	}
 #else
-	buf = k_lifo_get(&pool->free, timeout);
+	buf = free_get(pool, timeout);
 #endif
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
@@ -308,40 +485,72 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-#if __ASSERT_ON
-		size_t req_size = size;
+	if (buf_init(pool, buf, size, end) < 0) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		return NULL;
+	}
+
+	return buf;
+}
+
+int net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+		       struct net_buf **bufs, int count, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int n = 0;
+
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(bufs);
+
+	if (count <= 0) {
+		return 0;
+	}
+
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+	n = cache_get(pool, bufs, count);
 #endif
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
+
+	if (n < count) {
+		key = k_spin_lock(&pool->lock);
+
+		if (pool->uninit_count < pool->buf_count) {
+			n += k_queue_get_n(&pool->free._queue, (void **)&bufs[n],
+					   count - n, K_NO_WAIT);
 		}
 
-#if __ASSERT_ON
-		NET_BUF_ASSERT(req_size <= size);
-#endif
-	} else {
-		buf->__buf = NULL;
+		while ((n < count) && pool->uninit_count) {
+			bufs[n] = pool_get_uninit(pool, pool->uninit_count);
+			pool->uninit_count--;
+			n++;
+		}
+
+		k_spin_unlock(&pool->lock, key);
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	memset(buf->user_data, 0, buf->user_data_size);
-	net_buf_reset(buf);
+	if (n == 0) {
+		bufs[0] = free_get(pool, timeout);
+		if (!bufs[0]) {
+			return 0;
+		}
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-	pool->max_used = MAX(pool->max_used,
-			     pool->buf_count - atomic_get(&pool->avail_count));
-#endif
-	return buf;
+		n = 1 + k_queue_get_n(&pool->free._queue, (void **)&bufs[1],
+				      count - 1, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < n; i++) {
+		if (buf_init(pool, bufs[i], size, end) < 0) {
+			NET_BUF_ERR("Failed to allocate data");
+			/* buf_init() freed the failed buffer */
+			for (int j = i + 1; j < n; j++) {
+				bufs[j]->__buf = NULL;
+				net_buf_destroy(bufs[j]);
+			}
+			return i;
+		}
+	}
+
+	return n;
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -464,6 +673,86 @@ void net_buf_unref(struct net_buf *buf)
 	}
 }
 
+/* Return a batch of buffers of the same pool to its LIFO */
+static void batch_flush(struct net_buf_pool *pool, sys_slist_t *batch)
+{
+	if (!sys_slist_is_empty(batch)) {
+		k_queue_merge_slist(&pool->free._queue, batch);
+	}
+}
+
+void net_buf_unref_list(sys_slist_t *list)
+{
+	struct net_buf_pool *batch_pool = NULL;
+	sys_slist_t batch;
+	struct net_buf *buf;
+
+	__ASSERT_NO_MSG(list);
+
+	sys_slist_init(&batch);
+
+	while ((buf = (struct net_buf *)sys_slist_get(list)) != NULL) {
+		while (buf) {
+			struct net_buf *frags = buf->frags;
+			struct net_buf_pool *pool;
+
+#if defined(CONFIG_NET_BUF_LOG)
+			if (!buf->ref) {
+				NET_BUF_ERR("buf %p double free", buf);
+				break;
+			}
+#endif
+			if (--buf->ref > 0) {
+				break;
+			}
+
+			buf->data = NULL;
+			buf->frags = NULL;
+
+			pool = net_buf_pool_get(buf->pool_id);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+			atomic_inc(&pool->avail_count);
+			__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
+#endif
+
+			if (pool->destroy) {
+				pool->destroy(buf);
+				buf = frags;
+				continue;
+			}
+
+			if (buf->__buf) {
+				if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+					pool->alloc->cb->unref(buf, buf->__buf);
+				}
+				buf->__buf = NULL;
+			}
+
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE)
+			if (cache_put(pool, buf)) {
+				buf = frags;
+				continue;
+			}
+#endif
+
+			if (pool != batch_pool) {
+				if (batch_pool) {
+					batch_flush(batch_pool, &batch);
+				}
+				batch_pool = pool;
+			}
+
+			sys_slist_append(&batch, &buf->node);
+			buf = frags;
+		}
+	}
+
+	if (batch_pool) {
+		batch_flush(batch_pool, &batch);
+	}
+}
+
 struct net_buf *net_buf_ref(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf);
@@ -627,7 +916,8 @@ size_t net_buf_linearize(void *dst, size_t dst_len, const struct net_buf *src,
 	copied = 0;
 	while (frag && len > 0) {
 		to_copy = MIN(len, frag->len - offset);
-		memcpy((uint8_t *)dst + copied, frag->data + offset, to_copy);
+		sys_dma_memcpy((uint8_t *)dst + copied, frag->data + offset, to_copy,
+			       SYS_DMA_MEMCPY_TIMEOUT_DEFAULT);
 
 		copied += to_copy;
 
@@ -778,6 +778,76 @@ static inline size_t conversion_radix(char specifier)
 	}
 }
 
+#ifdef CONFIG_CBPRINTF_FAST_INT
+/* Decimal representation of all values from 0 to 99. */
+static const char dec_pairs[200] = {
+	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4',
+	'0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+#define DEC_PAIRS_ROW(t) \
+	t, '0', t, '1', t, '2', t, '3', t, '4', \
+	t, '5', t, '6', t, '7', t, '8', t, '9'
+	DEC_PAIRS_ROW('1'), DEC_PAIRS_ROW('2'), DEC_PAIRS_ROW('3'),
+	DEC_PAIRS_ROW('4'), DEC_PAIRS_ROW('5'), DEC_PAIRS_ROW('6'),
+	DEC_PAIRS_ROW('7'), DEC_PAIRS_ROW('8'), DEC_PAIRS_ROW('9'),
+#undef DEC_PAIRS_ROW
+};
+
+/* Writes the decimal representation of value backwards from bp, two
+ * digits per division.  Values wider than 32 bits are reduced with full
+ * width divisions only until they fit in 32 bits, so that 32-bit targets
+ * do not call the 64-bit division helper for every digit.
+ */
+static char *encode_dec(uint_value_type value, const char *bps, char *bp)
+{
+	uint32_t v;
+
+	while (((uint64_t)value > UINT32_MAX) && ((bp - bps) >= 2)) {
+		unsigned int idx = (unsigned int)(value % 100U) * 2U;
+
+		value /= 100U;
+		*--bp = dec_pairs[idx + 1U];
+		*--bp = dec_pairs[idx];
+	}
+
+	v = (uint32_t)value;
+	while ((v >= 100U) && ((bp - bps) >= 2)) {
+		unsigned int idx = (v % 100U) * 2U;
+
+		v /= 100U;
+		*--bp = dec_pairs[idx + 1U];
+		*--bp = dec_pairs[idx];
+	}
+
+	if ((v >= 10U) && ((bp - bps) >= 2)) {
+		*--bp = dec_pairs[v * 2U + 1U];
+		*--bp = dec_pairs[v * 2U];
+	} else if (bps < bp) {
+		*--bp = (char)('0' + v);
+	} else {
+		;
+	}
+
+	return bp;
+}
+
+/* Writes the representation of value in a power of two base backwards
+ * from bp, using shifts and masks instead of divisions.
+ */
+static char *encode_pow2(uint_value_type value, unsigned int shift, bool upcase,
+			 const char *bps, char *bp)
+{
+	const char *digits = upcase ? "0123456789ABCDEF" : "0123456789abcdef";
+	const unsigned int mask = BIT(shift) - 1U;
+
+	do {
+		*--bp = digits[value & mask];
+		value >>= shift;
+	} while ((value != 0) && (bps < bp));
+
+	return bp;
+}
+#endif /* CONFIG_CBPRINTF_FAST_INT */
+
 /* Writes the given value into the buffer in the specified base.
  *
  * Precision is applied *ONLY* within the space allowed.
@@ -797,6 +867,13 @@ static char *encode_uint(uint_value_type value,
 	const unsigned int radix = conversion_radix(conv->specifier);
 	char *bp = bps + (bpe - bps);
 
+#ifdef CONFIG_CBPRINTF_FAST_INT
+	if (radix == 10) {
+		bp = encode_dec(value, bps, bp);
+	} else {
+		bp = encode_pow2(value, (radix == 8) ? 3 : 4, upcase, bps, bp);
+	}
+#else
 	do {
 		unsigned int lsv = (unsigned int)(value % radix);
 
@@ -805,6 +882,7 @@ static char *encode_uint(uint_value_type value,
 			: upcase ? ('A' + lsv - 10) : ('a' + lsv - 10);
 		value /= radix;
 	} while ((value != 0) && (bps < bp));
+#endif
 
 	/* Record required alternate forms.  This can be determined
 	 * from the radix without re-checking specifier.
@@ -1412,6 +1490,68 @@ int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 			continue;
 		}
 
+#ifdef CONFIG_CBPRINTF_FAST_INT
+		/* Plain %d, %i, %u, %x, %X, %s and %c conversions without
+		 * flags, width, precision or length modifier make up most of
+		 * the formatted output, convert them without the generic
+		 * parser.
+		 */
+		switch (fp[1]) {
+		case 'd':
+		case 'i':
+		case 'u':
+		case 'x':
+		case 'X':
+		case 's':
+		case 'c': {
+			const char spec = fp[1];
+			char *bpe = buf + sizeof(buf);
+			char *bps;
+
+			if (IS_ENABLED(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
+			    && tagged_ap) {
+				(void)va_arg(ap, int);
+			}
+
+			fp += 2;
+
+			if (spec == 's') {
+				const char *str = va_arg(ap, const char *);
+
+				OUTS(str, str + strlen(str));
+				continue;
+			}
+
+			if (spec == 'c') {
+				char c = (char)va_arg(ap, int);
+
+				OUTC(c);
+				continue;
+			}
+
+			if (spec == 'u') {
+				bps = encode_dec(va_arg(ap, unsigned int), buf, bpe);
+			} else if (spec == 'x' || spec == 'X') {
+				bps = encode_pow2(va_arg(ap, unsigned int), 4, spec == 'X',
+						  buf, bpe);
+			} else {
+				int arg = va_arg(ap, int);
+
+				if (arg < 0) {
+					OUTC('-');
+				}
+				bps = encode_dec((arg < 0) ? -(unsigned int)arg : (unsigned int)arg,
+						 buf, bpe);
+			}
+
+			OUTS(bps, bpe);
+			continue;
+		}
+		default:
+			break;
+		}
+#endif /* CONFIG_CBPRINTF_FAST_INT */
+
 		/* Force union into RAM with conversion state to
 		 * mitigate LLVM code generation bug.
 		 */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cache.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/mem_mgmt/mem_attr.h>
+#include <zephyr/dt-bindings/memory-attr/memory-attr.h>
+#include <zephyr/sys/dma_memcpy.h>
+
+static const struct device *const dma_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_dma_memcpy));
+
+/*
+ * Transfers in flight. The DMA callback gets the sequence number of its
+ * transfer rather than the request, so that it cannot touch a request
+ * whose transfer timed out and was cancelled by the caller.
+ */
+static struct k_spinlock lock;
+static sys_slist_t active = SYS_SLIST_STATIC_INIT(&active);
+static uint32_t next_seq;
+
+struct dma_memcpy_sync {
+	struct k_sem sem;
+	int status;
+};
+
+/* The destination must not share cache lines with data the CPU may write meanwhile */
+static bool dma_memcpy_dst_ok(const void *dst, size_t len)
+{
+	if (!IS_ENABLED(CONFIG_DCACHE)) {
+		return true;
+	}
+
+	size_t line = sys_cache_data_line_size_get();
+
+	return (line != 0) && IS_ALIGNED(dst, line) && ((len % line) == 0);
+}
+
+static bool dma_memcpy_reachable(const void *buf, size_t len)
+{
+	if (!IS_ENABLED(CONFIG_SYS_DMA_MEMCPY_MEM_ATTR)) {
+		return true;
+	}
+
+	return mem_attr_check_buf((void *)buf, len, DT_MEM_DMA) == 0;
+}
+
+/* Removes the transfer from the ones in flight, NULL if it is already gone */
+static struct sys_dma_memcpy_req *dma_memcpy_take(uint32_t seq)
+{
+	struct sys_dma_memcpy_req *req;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&active, req, node) {
+		if (req->seq == seq) {
+			(void)sys_slist_find_and_remove(&active, &req->node);
+			k_spin_unlock(&lock, key);
+			return req;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return NULL;
+}
+
+static void dma_memcpy_done(const struct device *dev, void *user_data, uint32_t channel,
+			    int status)
+{
+	struct sys_dma_memcpy_req *req = dma_memcpy_take(POINTER_TO_UINT(user_data));
+
+	if (req == NULL) {
+		/* Cancelled */
+		return;
+	}
+
+	dma_release_channel(dev, req->channel);
+	(void)sys_cache_data_invd_range(req->dst, req->len);
+
+	req->cb(req->user_data, (status < 0) ? -EIO : 0);
+}
+
+/* Returns 0 once the DMA transfer is started, an error if the CPU has to copy */
+static int dma_memcpy_start(struct sys_dma_memcpy_req *req, void *dst, const void *src,
+			    size_t len)
+{
+	struct dma_block_config block = {0};
+	struct dma_config cfg = {0};
+	uintptr_t align = (uintptr_t)dst | (uintptr_t)src | len;
+	uint32_t width = ((align & 3U) == 0U) ? 4U : (((align & 1U) == 0U) ? 2U : 1U);
+	k_spinlock_key_t key;
+	int channel;
+	int ret;
+
+	if (len < CONFIG_SYS_DMA_MEMCPY_THRESHOLD || !dma_memcpy_dst_ok(dst, len) ||
+	    !dma_memcpy_reachable(src, len) || !dma_memcpy_reachable(dst, len) ||
+	    !device_is_ready(dma_dev)) {
+		return -ENOTSUP;
+	}
+
+	channel = dma_request_channel(dma_dev, NULL);
+	if (channel < 0) {
+		return -EBUSY;
+	}
+
+	req->dst = dst;
+	req->len = len;
+	req->channel = channel;
+
+	key = k_spin_lock(&lock);
+	req->seq = next_seq++;
+	sys_slist_append(&active, &req->node);
+	k_spin_unlock(&lock, key);
+
+	block.source_address = (uintptr_t)src;
+	block.dest_address = (uintptr_t)dst;
+	block.block_size = len;
+
+	cfg.channel_direction = MEMORY_TO_MEMORY;
+	cfg.source_data_size = width;
+	cfg.dest_data_size = width;
+	cfg.source_burst_length = width;
+	cfg.dest_burst_length = width;
+	cfg.block_count = 1;
+	cfg.head_block = &block;
+	cfg.dma_callback = dma_memcpy_done;
+	cfg.user_data = UINT_TO_POINTER(req->seq);
+
+	(void)sys_cache_data_flush_range((void *)src, len);
+	(void)sys_cache_data_flush_and_invd_range(dst, len);
+
+	ret = dma_config(dma_dev, channel, &cfg);
+	if (ret == 0) {
+		ret = dma_start(dma_dev, channel);
+	}
+
+	if (ret != 0) {
+		(void)dma_memcpy_take(req->seq);
+		dma_release_channel(dma_dev, channel);
+	}
+
+	return ret;
+}
+
+/* Returns true if the transfer was stopped before it completed */
+static bool dma_memcpy_cancel(struct sys_dma_memcpy_req *req)
+{
+	if (dma_memcpy_take(req->seq) != req) {
+		/* The callback is running */
+		return false;
+	}
+
+	(void)dma_stop(dma_dev, req->channel);
+	dma_release_channel(dma_dev, req->channel);
+
+	return true;
+}
+
+static void dma_memcpy_sync_done(void *user_data, int status)
+{
+	struct dma_memcpy_sync *sync = user_data;
+
+	sync->status = status;
+	k_sem_give(&sync->sem);
+}
+
+void sys_dma_memcpy(void *dst, const void *src, size_t len, k_timeout_t timeout)
+{
+	struct sys_dma_memcpy_req req;
+	struct dma_memcpy_sync sync;
+
+	if (!k_is_in_isr() && !k_is_pre_kernel()) {
+		k_sem_init(&sync.sem, 0, 1);
+		req.cb = dma_memcpy_sync_done;
+		req.user_data = &sync;
+		sync.status = -ETIMEDOUT;
+
+		if (dma_memcpy_start(&req, dst, src, len) == 0) {
+			if (k_sem_take(&sync.sem, timeout) != 0 && !dma_memcpy_cancel(&req)) {
+				/* Completing meanwhile, the callback gives the semaphore */
+				k_sem_take(&sync.sem, K_FOREVER);
+			}
+
+			if (sync.status == 0) {
+				return;
+			}
+		}
+	}
+
+	memcpy(dst, src, len);
+}
+
+void sys_dma_memcpy_async(struct sys_dma_memcpy_req *req, void *dst, const void *src, size_t len,
+			  sys_dma_memcpy_cb_t cb, void *user_data)
+{
+	req->cb = cb;
+	req->user_data = user_data;
+
+	if (dma_memcpy_start(req, dst, src, len) != 0) {
+		memcpy(dst, src, len);
+		cb(user_data, 0);
+	}
+}
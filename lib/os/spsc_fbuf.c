@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <zephyr/cache.h>
+#include <zephyr/sys/spsc_fbuf.h>
+
+/*
+ * Indices count frames since initialization and wrap naturally at 2^32. Since
+ * the capacity is a power of two the position in data[] is the index masked
+ * by capacity - 1 and the fill level is the difference of the indices, so no
+ * frame has to be left unused to distinguish between empty and full.
+ */
+
+static inline bool use_cache(uint32_t flags)
+{
+	return IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
+	       (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_FBUF_CACHE));
+}
+
+static inline void cache_wb(void *data, size_t len, uint32_t flags)
+{
+	if (use_cache(flags)) {
+		sys_cache_data_flush_range(data, len);
+	}
+}
+
+static inline void cache_inv(void *data, size_t len, uint32_t flags)
+{
+	if (use_cache(flags)) {
+		sys_cache_data_invd_range(data, len);
+	}
+}
+
+static uint32_t *get_wr_idx_loc(struct spsc_fbuf *fb, uint32_t flags)
+{
+	return use_cache(flags) ? &fb->ext.cache.wr_idx : &fb->ext.nocache.wr_idx;
+}
+
+static uint8_t *get_data_loc(struct spsc_fbuf *fb, uint32_t flags)
+{
+	return use_cache(flags) ? fb->ext.cache.data : fb->ext.nocache.data;
+}
+
+static size_t get_data_offset(uint32_t flags)
+{
+	return use_cache(flags) ? offsetof(struct spsc_fbuf, ext.cache.data) :
+				  offsetof(struct spsc_fbuf, ext.nocache.data);
+}
+
+static bool check_alignment(void *buf, uint32_t flags)
+{
+	if ((Z_SPSC_PBUF_DCACHE_LINE > 0) && use_cache(flags)) {
+		return ((uintptr_t)buf & (Z_SPSC_PBUF_DCACHE_LINE - 1)) == 0;
+	}
+
+	return ((uintptr_t)buf & (sizeof(uint32_t) - 1)) == 0;
+}
+
+static void notify(struct spsc_fbuf *fb, const struct spsc_fbuf_watermark *wm,
+		   uint32_t before, uint32_t after)
+{
+	if ((wm == NULL) || (wm->cb == NULL)) {
+		return;
+	}
+
+	/* Edge triggered, so the callback runs once per crossing in either direction. */
+	if (((before < wm->level) && (after >= wm->level)) ||
+	    ((before > wm->level) && (after <= wm->level))) {
+		wm->cb(fb, after, wm->user_data);
+	}
+}
+
+struct spsc_fbuf *spsc_fbuf_init(void *buf, size_t blen, size_t frame_size, uint32_t flags)
+{
+	if (!check_alignment(buf, flags)) {
+		__ASSERT(false, "Failed to initialize due to memory misalignment");
+		return NULL;
+	}
+
+	size_t offset = get_data_offset(flags);
+
+	if ((frame_size == 0) || (blen < offset + frame_size)) {
+		return NULL;
+	}
+
+	struct spsc_fbuf *fb = buf;
+	uint32_t *wr_idx_loc = get_wr_idx_loc(fb, flags);
+	uint32_t frames = MIN((blen - offset) / frame_size, (size_t)BIT(31));
+
+	fb->common.frames = BIT(find_msb_set(frames) - 1);
+	fb->common.frame_size = frame_size;
+	fb->common.flags = flags;
+	fb->common.rd_idx = 0;
+	*wr_idx_loc = 0;
+
+	__sync_synchronize();
+	cache_wb(&fb->common, sizeof(fb->common), flags);
+	cache_wb(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+
+	return fb;
+}
+
+uint32_t spsc_fbuf_used(struct spsc_fbuf *fb)
+{
+	const uint32_t flags = fb->common.flags;
+	uint32_t *wr_idx_loc = get_wr_idx_loc(fb, flags);
+
+	cache_inv(&fb->common.rd_idx, sizeof(fb->common.rd_idx), flags);
+	cache_inv(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+	__sync_synchronize();
+
+	return *wr_idx_loc - fb->common.rd_idx;
+}
+
+uint32_t spsc_fbuf_alloc(struct spsc_fbuf *fb, uint32_t frames, void **buf)
+{
+	/* Capacity, frame size and flags are immutable - avoid reloading. */
+	const uint32_t capacity = fb->common.frames;
+	const uint32_t frame_size = fb->common.frame_size;
+	const uint32_t flags = fb->common.flags;
+	uint32_t *rd_idx_loc = &fb->common.rd_idx;
+	uint32_t wr_idx = *get_wr_idx_loc(fb, flags);
+	uint32_t pos = wr_idx & (capacity - 1);
+
+	cache_inv(rd_idx_loc, sizeof(*rd_idx_loc), flags);
+	__sync_synchronize();
+
+	uint32_t free_frames = capacity - (wr_idx - *rd_idx_loc);
+
+	frames = MIN(frames, MIN(free_frames, capacity - pos));
+	*buf = &get_data_loc(fb, flags)[pos * frame_size];
+
+	return frames;
+}
+
+void spsc_fbuf_commit(struct spsc_fbuf *fb, uint32_t frames,
+		      const struct spsc_fbuf_watermark *wm)
+{
+	if (frames == 0) {
+		return;
+	}
+
+	/* Capacity, frame size and flags are immutable - avoid reloading. */
+	const uint32_t capacity = fb->common.frames;
+	const uint32_t frame_size = fb->common.frame_size;
+	const uint32_t flags = fb->common.flags;
+	uint32_t *wr_idx_loc = get_wr_idx_loc(fb, flags);
+	uint32_t wr_idx = *wr_idx_loc;
+	uint32_t pos = wr_idx & (capacity - 1);
+
+	__ASSERT_NO_MSG(pos + frames <= capacity);
+
+	cache_wb(&get_data_loc(fb, flags)[pos * frame_size], frames * frame_size, flags);
+	__sync_synchronize();
+
+	*wr_idx_loc = wr_idx + frames;
+	__sync_synchronize();
+	cache_wb(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+
+	if (wm != NULL) {
+		uint32_t used = spsc_fbuf_used(fb);
+
+		notify(fb, wm, used - frames, used);
+	}
+}
+
+uint32_t spsc_fbuf_claim(struct spsc_fbuf *fb, uint32_t frames, void **buf)
+{
+	/* Capacity, frame size and flags are immutable - avoid reloading. */
+	const uint32_t capacity = fb->common.frames;
+	const uint32_t frame_size = fb->common.frame_size;
+	const uint32_t flags = fb->common.flags;
+	uint32_t *wr_idx_loc = get_wr_idx_loc(fb, flags);
+	uint32_t rd_idx = fb->common.rd_idx;
+	uint32_t pos = rd_idx & (capacity - 1);
+	uint8_t *data_loc = &get_data_loc(fb, flags)[pos * frame_size];
+
+	cache_inv(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+	__sync_synchronize();
+
+	uint32_t used = *wr_idx_loc - rd_idx;
+
+	frames = MIN(frames, MIN(used, capacity - pos));
+	if (frames > 0) {
+		cache_inv(data_loc, frames * frame_size, flags);
+	}
+
+	*buf = data_loc;
+
+	return frames;
+}
+
+void spsc_fbuf_free(struct spsc_fbuf *fb, uint32_t frames,
+		    const struct spsc_fbuf_watermark *wm)
+{
+	if (frames == 0) {
+		return;
+	}
+
+	const uint32_t flags = fb->common.flags;
+	uint32_t *rd_idx_loc = &fb->common.rd_idx;
+
+	__ASSERT_NO_MSG(frames <= spsc_fbuf_used(fb));
+
+	/* Frames must not be reused by the writer before the reader is done. */
+	__sync_synchronize();
+	*rd_idx_loc += frames;
+	__sync_synchronize();
+	cache_wb(rd_idx_loc, sizeof(*rd_idx_loc), flags);
+
+	if (wm != NULL) {
+		uint32_t used = spsc_fbuf_used(fb);
+
+		notify(fb, wm, used + frames, used);
+	}
+}
+
+uint32_t spsc_fbuf_write(struct spsc_fbuf *fb, const void *buf, uint32_t frames,
+			 const struct spsc_fbuf_watermark *wm)
+{
+	const uint8_t *src = buf;
+	uint32_t written = 0;
+
+	/* At most two spans, one before and one after the wrap. */
+	while (written < frames) {
+		void *span;
+		uint32_t len = spsc_fbuf_alloc(fb, frames - written, &span);
+
+		if (len == 0) {
+			break;
+		}
+
+		memcpy(span, &src[written * fb->common.frame_size], len * fb->common.frame_size);
+		spsc_fbuf_commit(fb, len, wm);
+		written += len;
+	}
+
+	return written;
+}
+
+uint32_t spsc_fbuf_read(struct spsc_fbuf *fb, void *buf, uint32_t frames,
+			const struct spsc_fbuf_watermark *wm)
+{
+	uint8_t *dst = buf;
+	uint32_t read = 0;
+
+	while (read < frames) {
+		void *span;
+		uint32_t len = spsc_fbuf_claim(fb, frames - read, &span);
+
+		if (len == 0) {
+			break;
+		}
+
+		memcpy(&dst[read * fb->common.frame_size], span, len * fb->common.frame_size);
+		spsc_fbuf_free(fb, len, wm);
+		read += len;
+	}
+
+	return read;
+}
@@ -1,82 +1,526 @@
 /*
  * Copyright 2024 Tenstorrent AI ULC
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include <errno.h>
+#include <limits.h>
 #include <signal.h>
+#include <stdio.h>
 
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/posix/aio.h>
+#include <zephyr/posix/fcntl.h>
+#include <zephyr/sys/dlist.h>
+
+/* prototypes for external, not-yet-public, functions in fdtable.c */
+ssize_t zvfs_read(int fd, void *buf, size_t sz, const size_t *from_offset);
+ssize_t zvfs_write(int fd, const void *buf, size_t sz, const size_t *from_offset);
+off_t zvfs_lseek(int fd, off_t offset, int whence);
+int zvfs_fsync(int fd);
+
+/* Operation of the requests submitted by aio_fsync(), next to the LIO_* ones */
+#define AIO_FSYNC (LIO_WRITE + 1)
+
+/* Requests submitted together by lio_listio() */
+struct aio_lio {
+	struct sigevent sig;
+	int pending;
+	bool failed;
+	bool wait;
+	struct k_condvar done;
+};
+
+struct aio_req {
+	sys_dnode_t node;
+	struct aiocb *cb;
+	struct aio_lio *lio;
+	struct sigevent sig;
+	int op;
+};
+
+static struct aio_req aio_req_pool[CONFIG_POSIX_AIO_MAX];
+static struct aio_lio aio_lio_pool[CONFIG_POSIX_AIO_MAX];
+/* Requests the workers are carrying out */
+static struct aio_req *aio_running[CONFIG_POSIX_AIO_WORKERS];
+
+static sys_dlist_t aio_free = SYS_DLIST_STATIC_INIT(&aio_free);
+static sys_dlist_t aio_queue = SYS_DLIST_STATIC_INIT(&aio_queue);
+
+static K_MUTEX_DEFINE(aio_lock);
+/* Signalled when a request is queued */
+static K_CONDVAR_DEFINE(aio_queued);
+/* Broadcast when a request completes */
+static K_CONDVAR_DEFINE(aio_completed);
+
+static K_THREAD_STACK_ARRAY_DEFINE(aio_worker_stacks, CONFIG_POSIX_AIO_WORKERS,
+				   CONFIG_POSIX_AIO_WORKER_STACK_SIZE);
+static struct k_thread aio_worker_threads[CONFIG_POSIX_AIO_WORKERS];
+
+static void aio_notify(const struct sigevent *sig)
+{
+	if (sig->sigev_notify == SIGEV_THREAD && sig->sigev_notify_function != NULL) {
+		sig->sigev_notify_function(sig->sigev_value);
+	}
+}
+
+static ssize_t aio_rw(struct aiocb *cb, bool is_write)
+{
+	size_t off = (size_t)cb->aio_offset;
+	void *buf = (void *)cb->aio_buf;
+	ssize_t ret;
+
+	ret = is_write ? zvfs_write(cb->aio_fildes, buf, cb->aio_nbytes, &off)
+		       : zvfs_read(cb->aio_fildes, buf, cb->aio_nbytes, &off);
+	if (ret >= 0 || errno != ENOTSUP) {
+		return ret;
+	}
+
+	/*
+	 * The descriptor has no positioned I/O. Seek files to the offset of the request, and use
+	 * sockets and other streams from where they are, as the offset does not apply to them.
+	 */
+	(void)zvfs_lseek(cb->aio_fildes, cb->aio_offset, SEEK_SET);
+
+	return is_write ? zvfs_write(cb->aio_fildes, buf, cb->aio_nbytes, NULL)
+			: zvfs_read(cb->aio_fildes, buf, cb->aio_nbytes, NULL);
+}
+
+static ssize_t aio_perform(struct aio_req *req)
+{
+	switch (req->op) {
+	case LIO_READ:
+		return aio_rw(req->cb, false);
+	case LIO_WRITE:
+		return aio_rw(req->cb, true);
+	default:
+		return zvfs_fsync(req->cb->aio_fildes);
+	}
+}
+
+/*
+ * Record the result of a request and release it. Called with aio_lock held, which is released
+ * before the notifications are run, as they may submit new requests.
+ */
+static void aio_complete(struct aio_req *req, ssize_t ret, int err)
+{
+	struct sigevent sig = req->sig;
+	struct sigevent lio_sig = {.sigev_notify = SIGEV_NONE};
+	struct aio_lio *lio = req->lio;
+
+	req->cb->_aio_return = ret;
+	req->cb->_aio_error = (ret < 0) ? err : 0;
+
+	if (lio != NULL) {
+		lio->failed |= (ret < 0);
+		if (--lio->pending == 0) {
+			if (lio->wait) {
+				k_condvar_signal(&lio->done);
+			} else {
+				lio_sig = lio->sig;
+				lio->pending = -1;
+			}
+		}
+	}
+
+	req->cb = NULL;
+	sys_dlist_append(&aio_free, &req->node);
+	k_condvar_broadcast(&aio_completed);
+	k_mutex_unlock(&aio_lock);
+
+	aio_notify(&sig);
+	aio_notify(&lio_sig);
+}
+
+static void aio_worker(void *p1, void *p2, void *p3)
+{
+	struct aio_req **running = p1;
+	struct aio_req *req;
+	ssize_t ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_mutex_lock(&aio_lock, K_FOREVER);
+		while (sys_dlist_is_empty(&aio_queue)) {
+			k_condvar_wait(&aio_queued, &aio_lock, K_FOREVER);
+		}
+		req = CONTAINER_OF(sys_dlist_get(&aio_queue), struct aio_req, node);
+		*running = req;
+		k_mutex_unlock(&aio_lock);
+
+		errno = 0;
+		ret = aio_perform(req);
+
+		k_mutex_lock(&aio_lock, K_FOREVER);
+		*running = NULL;
+		aio_complete(req, ret, errno);
+	}
+}
+
+static bool aio_sigevent_valid(const struct sigevent *sig)
+{
+	/* Signals are not delivered to the process, only SIGEV_THREAD notifies */
+	return sig->sigev_notify == SIGEV_NONE || sig->sigev_notify == SIGEV_THREAD;
+}
+
+static bool aio_cb_valid(const struct aiocb *cb, int op)
+{
+	if (cb->aio_fildes < 0) {
+		errno = EBADF;
+		return false;
+	}
+
+	if (op != AIO_FSYNC && (cb->aio_offset < 0 || cb->aio_nbytes > SSIZE_MAX)) {
+		errno = EINVAL;
+		return false;
+	}
+
+	if (!aio_sigevent_valid(&cb->aio_sigevent)) {
+		errno = EINVAL;
+		return false;
+	}
+
+	return true;
+}
+
+/* Queue a request, with aio_lock held and a request known to be free */
+static void aio_enqueue(struct aiocb *cb, int op, struct aio_lio *lio)
+{
+	struct aio_req *req = CONTAINER_OF(sys_dlist_get(&aio_free), struct aio_req, node);
+
+	req->cb = cb;
+	req->op = op;
+	req->lio = lio;
+	if (lio != NULL && lio->wait) {
+		/* The notifications of the requests of a blocking lio_listio() are ignored */
+		req->sig.sigev_notify = SIGEV_NONE;
+	} else {
+		req->sig = cb->aio_sigevent;
+	}
+
+	cb->_aio_error = EINPROGRESS;
+	cb->_aio_return = -1;
+
+	sys_dlist_append(&aio_queue, &req->node);
+	k_condvar_signal(&aio_queued);
+}
+
+static int aio_submit(struct aiocb *aiocbp, int op)
+{
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (!aio_cb_valid(aiocbp, op)) {
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	if (sys_dlist_is_empty(&aio_free)) {
+		k_mutex_unlock(&aio_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+
+	aio_enqueue(aiocbp, op, NULL);
+	k_mutex_unlock(&aio_lock);
+
+	return 0;
+}
+
+static struct aio_req *aio_find_queued(int fildes, const struct aiocb *aiocbp)
+{
+	struct aio_req *req;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&aio_queue, req, node) {
+		if (req->cb->aio_fildes == fildes && (aiocbp == NULL || req->cb == aiocbp)) {
+			return req;
+		}
+	}
+
+	return NULL;
+}
 
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	struct aio_req *req;
+	int ret = AIO_ALLDONE;
+
+	if (aiocbp != NULL && aiocbp->aio_fildes != fildes) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_running); i++) {
+		req = aio_running[i];
+		if (req != NULL && req->cb->aio_fildes == fildes &&
+		    (aiocbp == NULL || req->cb == aiocbp)) {
+			ret = AIO_NOTCANCELED;
+		}
+	}
+
+	while ((req = aio_find_queued(fildes, aiocbp)) != NULL) {
+		sys_dlist_remove(&req->node);
+		if (ret == AIO_ALLDONE) {
+			ret = AIO_CANCELED;
+		}
+
+		/* Completing releases the lock, to notify */
+		aio_complete(req, -1, ECANCELED);
+		k_mutex_lock(&aio_lock, K_FOREVER);
+	}
 
-	errno = ENOSYS;
-	return -1;
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
 }
 
 int aio_error(const struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	int ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	ret = aiocbp->_aio_error;
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
 }
 
-int aio_fsync(int fildes, struct aiocb *aiocbp)
+int aio_fsync(int op, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	if (op != O_SYNC && op != O_DSYNC) {
+		errno = EINVAL;
+		return -1;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, AIO_FSYNC);
 }
 
 int aio_read(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, LIO_READ);
 }
 
 ssize_t aio_return(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	ssize_t ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	if (aiocbp->_aio_error == EINPROGRESS) {
+		k_mutex_unlock(&aio_lock);
+		errno = EINVAL;
+		return -1;
+	}
+
+	ret = aiocbp->_aio_return;
+	if (ret < 0) {
+		errno = aiocbp->_aio_error;
+	}
+	k_mutex_unlock(&aio_lock);
 
-	errno = ENOSYS;
-	return -1;
+	return ret;
+}
+
+static bool aio_any_done(const struct aiocb *const list[], int nent)
+{
+	for (int i = 0; i < nent; i++) {
+		if (list[i] != NULL && list[i]->_aio_error != EINPROGRESS) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
 {
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(timeout);
+	k_timepoint_t end = sys_timepoint_calc(K_FOREVER);
+	int ret = 0;
+
+	if (list == NULL || nent < 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout != NULL) {
+		if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+		    timeout->tv_nsec >= NSEC_PER_SEC) {
+			errno = EINVAL;
+			return -1;
+		}
 
-	errno = ENOSYS;
-	return -1;
+		end = sys_timepoint_calc(K_NSEC((int64_t)timeout->tv_sec * NSEC_PER_SEC +
+						timeout->tv_nsec));
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	while (!aio_any_done(list, nent)) {
+		if (k_condvar_wait(&aio_completed, &aio_lock, sys_timepoint_timeout(end)) != 0) {
+			if (!aio_any_done(list, nent)) {
+				errno = EAGAIN;
+				ret = -1;
+			}
+			break;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
 }
 
 int aio_write(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	return aio_submit(aiocbp, LIO_WRITE);
+}
 
-	errno = ENOSYS;
-	return -1;
+static struct aio_lio *aio_lio_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_lio_pool); i++) {
+		if (aio_lio_pool[i].pending < 0) {
+			return &aio_lio_pool[i];
+		}
+	}
+
+	return NULL;
 }
 
 int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	       struct sigevent *ZRESTRICT sig)
 {
-	ARG_UNUSED(mode);
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(sig);
+	struct aio_lio wait_lio;
+	struct aio_lio *lio;
+	sys_dnode_t *node;
+	int nfree = 0;
+	int count = 0;
+	bool failed;
+
+	if ((mode != LIO_WAIT && mode != LIO_NOWAIT) || list == NULL || nent < 0 ||
+	    nent > AIO_LISTIO_MAX) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (mode == LIO_NOWAIT && sig != NULL && !aio_sigevent_valid(sig)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if (list[i] == NULL || list[i]->aio_lio_opcode == LIO_NOP) {
+			continue;
+		}
+
+		if (list[i]->aio_lio_opcode != LIO_READ && list[i]->aio_lio_opcode != LIO_WRITE) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		if (!aio_cb_valid(list[i], list[i]->aio_lio_opcode)) {
+			return -1;
+		}
+
+		count++;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+
+	SYS_DLIST_FOR_EACH_NODE(&aio_free, node) {
+		nfree++;
+	}
+
+	if (mode == LIO_WAIT) {
+		lio = &wait_lio;
+		k_condvar_init(&lio->done);
+	} else {
+		lio = aio_lio_alloc();
+	}
+
+	/* Submit all the requests, or none */
+	if (nfree < count || lio == NULL) {
+		k_mutex_unlock(&aio_lock);
+		errno = EAGAIN;
+		return -1;
+	}
+
+	lio->pending = count;
+	lio->failed = false;
+	lio->wait = (mode == LIO_WAIT);
+	if (sig != NULL && mode == LIO_NOWAIT) {
+		lio->sig = *sig;
+	} else {
+		lio->sig.sigev_notify = SIGEV_NONE;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if (list[i] != NULL && list[i]->aio_lio_opcode != LIO_NOP) {
+			aio_enqueue(list[i], list[i]->aio_lio_opcode, lio);
+		}
+	}
+
+	if (count == 0) {
+		lio->pending = -1;
+		k_mutex_unlock(&aio_lock);
+		if (mode == LIO_NOWAIT) {
+			aio_notify(&lio->sig);
+		}
+		return 0;
+	}
+
+	if (mode == LIO_NOWAIT) {
+		k_mutex_unlock(&aio_lock);
+		return 0;
+	}
+
+	while (lio->pending > 0) {
+		k_condvar_wait(&lio->done, &aio_lock, K_FOREVER);
+	}
+	failed = lio->failed;
+	k_mutex_unlock(&aio_lock);
+
+	if (failed) {
+		errno = EIO;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int aio_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_req_pool); i++) {
+		sys_dlist_append(&aio_free, &aio_req_pool[i].node);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_lio_pool); i++) {
+		aio_lio_pool[i].pending = -1;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_worker_threads); i++) {
+		k_thread_create(&aio_worker_threads[i], aio_worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(aio_worker_stacks[i]), aio_worker,
+				&aio_running[i], NULL, NULL, CONFIG_POSIX_AIO_WORKER_PRIORITY, 0,
+				K_NO_WAIT);
+		k_thread_name_set(&aio_worker_threads[i], "posix_aio");
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return 0;
 }
+SYS_INIT(aio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
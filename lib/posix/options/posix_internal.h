@@ -44,6 +44,7 @@ struct posix_thread_attr
 	bool cancelstate: 1;
 	bool canceltype: 1;
 	bool detachstate: 1;
+	bool stackprefault: 1;
 };
 
 struct posix_thread {
@@ -13,6 +13,7 @@
 
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
+#include <zephyr/kernel/mm.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/posix/pthread.h>
@@ -43,6 +44,12 @@ LOG_MODULE_REGISTER(pthread, CONFIG_PTHREAD_LOG_LEVEL);
 #define DYNAMIC_STACK_SIZE 0
 #endif
 
+#ifdef CONFIG_POSIX_THREAD_STACK_CACHE_SIZE
+#define STACK_CACHE_SIZE CONFIG_POSIX_THREAD_STACK_CACHE_SIZE
+#else
+#define STACK_CACHE_SIZE 0
+#endif
+
 static inline size_t __get_attr_stacksize(const struct posix_thread_attr *attr)
 {
 	return attr->stacksize + 1;
@@ -96,6 +103,179 @@ static __pinned_bss struct posix_thread posix_thread_pool[CONFIG_POSIX_THREAD_TH
 static SYS_SEM_DEFINE(pthread_pool_lock, 1, 1);
 static int pthread_concurrency;
 
+#if STACK_CACHE_SIZE > 0
+/* A dynamically allocated stack, kept for reuse when not in use */
+struct posix_thread_stack_slot {
+	void *stack;
+	size_t size;
+	int flags;
+	bool in_use;
+};
+
+static struct posix_thread_stack_slot posix_thread_stack_cache[STACK_CACHE_SIZE];
+static SYS_SEM_DEFINE(posix_thread_stack_cache_lock, 1, 1);
+
+/*
+ * Claim a slot for a stack of size bytes. A cached stack is of the same size class when it is no
+ * more than twice as large. Otherwise, an empty slot is preferred to an idle one whose stack is
+ * returned in evicted. Called with posix_thread_stack_cache_lock held.
+ */
+static struct posix_thread_stack_slot *posix_thread_stack_claim(size_t size, int flags,
+								 void **evicted)
+{
+	struct posix_thread_stack_slot *victim = NULL;
+
+	ARRAY_FOR_EACH_PTR(posix_thread_stack_cache, slot) {
+		if (slot->in_use) {
+			continue;
+		}
+
+		if (slot->stack == NULL) {
+			victim = slot;
+		} else if (slot->flags == flags && slot->size >= size && slot->size / 2U < size) {
+			slot->in_use = true;
+			return slot;
+		} else if (victim == NULL) {
+			victim = slot;
+		}
+	}
+
+	if (victim != NULL) {
+		*evicted = victim->stack;
+		victim->stack = NULL;
+		victim->in_use = true;
+	}
+
+	return victim;
+}
+
+static struct posix_thread_stack_slot *posix_thread_stack_find(void *stack)
+{
+	ARRAY_FOR_EACH_PTR(posix_thread_stack_cache, slot) {
+		if (slot->in_use && slot->stack == stack) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+struct posix_thread_stack_user {
+	void *stack;
+	bool live;
+};
+
+static void posix_thread_stack_user_cb(const struct k_thread *thread, void *user_data)
+{
+	struct posix_thread_stack_user *user = user_data;
+
+	if ((void *)thread->stack_info.start == user->stack &&
+	    (thread->base.thread_state & (_THREAD_DUMMY | _THREAD_DEAD)) == 0) {
+		user->live = true;
+	}
+}
+
+/* Same liveness check as k_thread_stack_free(), a stack is not reused under a running thread */
+static bool posix_thread_stack_is_live(void *stack)
+{
+	struct posix_thread_stack_user user = {.stack = stack};
+
+	k_thread_foreach(posix_thread_stack_user_cb, &user);
+
+	return user.live;
+}
+#endif /* STACK_CACHE_SIZE > 0 */
+
+static void *posix_thread_stack_alloc(size_t size)
+{
+	int flags = k_is_user_context() ? K_USER : 0;
+	void *stack;
+
+#if STACK_CACHE_SIZE > 0
+	struct posix_thread_stack_slot *slot = NULL;
+	void *evicted = NULL;
+
+	stack = NULL;
+	SYS_SEM_LOCK(&posix_thread_stack_cache_lock) {
+		slot = posix_thread_stack_claim(size, flags, &evicted);
+		if (slot != NULL) {
+			stack = slot->stack;
+		}
+	}
+
+	if (stack != NULL) {
+		LOG_DBG("Reused cached thread stack %zu@%p", slot->size, stack);
+		return stack;
+	}
+
+	if (evicted != NULL) {
+		(void)k_thread_stack_free(evicted);
+	}
+
+	stack = k_thread_stack_alloc(size, flags);
+
+	if (slot != NULL) {
+		SYS_SEM_LOCK(&posix_thread_stack_cache_lock) {
+			slot->stack = stack;
+			slot->size = size;
+			slot->flags = flags;
+			slot->in_use = (stack != NULL);
+		}
+	}
+#else
+	stack = k_thread_stack_alloc(size, flags);
+#endif
+
+	return stack;
+}
+
+/* Release a stack from posix_thread_stack_alloc(), or fail as k_thread_stack_free() */
+static int posix_thread_stack_free(void *stack)
+{
+#if STACK_CACHE_SIZE > 0
+	struct posix_thread_stack_slot *slot = NULL;
+
+	if (stack != NULL && posix_thread_stack_is_live(stack)) {
+		LOG_DBG("Thread stack %p is in use", stack);
+		return -EBUSY;
+	}
+
+	if (stack != NULL) {
+		SYS_SEM_LOCK(&posix_thread_stack_cache_lock) {
+			slot = posix_thread_stack_find(stack);
+			if (slot != NULL) {
+				slot->in_use = false;
+			}
+		}
+	}
+
+	if (slot != NULL) {
+		return 0;
+	}
+#endif
+
+	return k_thread_stack_free(stack);
+}
+
+/* Page in the stack of attr, so that the thread does not fault on it */
+static void posix_thread_stack_prefault(const struct posix_thread_attr *attr)
+{
+#ifdef CONFIG_DEMAND_PAGING
+	uintptr_t addr;
+	size_t size;
+
+	if (k_is_user_context()) {
+		return;
+	}
+
+	(void)k_mem_region_align(&addr, &size, (uintptr_t)attr->stack,
+				 __get_attr_stacksize(attr) + attr->guardsize, CONFIG_MMU_PAGE_SIZE);
+	k_mem_page_in((void *)addr, size);
+#else
+	ARG_UNUSED(attr);
+#endif
+}
+
 static inline void posix_thread_q_set(struct posix_thread *t, enum posix_thread_qid qid)
 {
 	switch (qid) {
@@ -358,7 +538,7 @@ int pthread_attr_setstack(pthread_attr_t *_attr, void *stackaddr, size_t stacksi
 	}
 
 	if (attr->stack != NULL) {
-		ret = k_thread_stack_free(attr->stack);
+		ret = posix_thread_stack_free(attr->stack);
 		if (ret == 0) {
 			LOG_DBG("Freed attr %p thread stack %zu@%p", _attr,
 				__get_attr_stacksize(attr), attr->stack);
@@ -658,6 +838,10 @@ int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadrou
 		t->attr.schedpolicy = pol;
 	}
 
+	if (t->attr.stackprefault) {
+		posix_thread_stack_prefault(&t->attr);
+	}
+
 	/* spawn the thread */
 	k_thread_create(
 		&t->thread, t->attr.stack, __get_attr_stacksize(&t->attr) + t->attr.guardsize,
@@ -950,8 +1134,7 @@ int pthread_attr_init(pthread_attr_t *_attr)
 	attr->inheritsched = PTHREAD_INHERIT_SCHED;
 
 	if (DYNAMIC_STACK_SIZE > 0) {
-		attr->stack = k_thread_stack_alloc(DYNAMIC_STACK_SIZE + attr->guardsize,
-						   k_is_user_context() ? K_USER : 0);
+		attr->stack = posix_thread_stack_alloc(DYNAMIC_STACK_SIZE + attr->guardsize);
 		if (attr->stack == NULL) {
 			LOG_DBG("Did not auto-allocate thread stack");
 		} else {
@@ -1319,8 +1502,7 @@ int pthread_attr_setstacksize(pthread_attr_t *_attr, size_t stacksize)
 		return 0;
 	}
 
-	new_stack =
-		k_thread_stack_alloc(stacksize + attr->guardsize, k_is_user_context() ? K_USER : 0);
+	new_stack = posix_thread_stack_alloc(stacksize + attr->guardsize);
 	if (new_stack == NULL) {
 		if (stacksize < __get_attr_stacksize(attr)) {
 			__set_attr_stacksize(attr, stacksize);
@@ -1334,7 +1516,7 @@ int pthread_attr_setstacksize(pthread_attr_t *_attr, size_t stacksize)
 	LOG_DBG("Allocated thread stack %zu@%p", stacksize + attr->guardsize, new_stack);
 
 	if (attr->stack != NULL) {
-		ret = k_thread_stack_free(attr->stack);
+		ret = posix_thread_stack_free(attr->stack);
 		if (ret == 0) {
 			LOG_DBG("Freed attr %p thread stack %zu@%p", _attr,
 				__get_attr_stacksize(attr), attr->stack);
@@ -1422,7 +1604,7 @@ int pthread_attr_destroy(pthread_attr_t *_attr)
 		return EINVAL;
 	}
 
-	ret = k_thread_stack_free(attr->stack);
+	ret = posix_thread_stack_free(attr->stack);
 	if (ret == 0) {
 		LOG_DBG("Freed attr %p thread stack %zu@%p", _attr, __get_attr_stacksize(attr),
 			attr->stack);
@@ -1434,6 +1616,30 @@ int pthread_attr_destroy(pthread_attr_t *_attr)
 	return 0;
 }
 
+int pthread_attr_setstackprefault_np(pthread_attr_t *_attr, int prefault)
+{
+	struct posix_thread_attr *attr = (struct posix_thread_attr *)_attr;
+
+	if (!__attr_is_initialized(attr)) {
+		return EINVAL;
+	}
+
+	attr->stackprefault = (prefault != 0);
+	return 0;
+}
+
+int pthread_attr_getstackprefault_np(const pthread_attr_t *_attr, int *prefault)
+{
+	const struct posix_thread_attr *attr = (const struct posix_thread_attr *)_attr;
+
+	if (!__attr_is_initialized(attr) || (prefault == NULL)) {
+		return EINVAL;
+	}
+
+	*prefault = attr->stackprefault;
+	return 0;
+}
+
 int pthread_setname_np(pthread_t thread, const char *name)
 {
 #ifdef CONFIG_THREAD_NAME
@@ -22,16 +22,8 @@ struct internal_ctx {
 };
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
-static bool share_parent(const struct smf_state *test_state, const struct smf_state *target_state)
-{
-	for (const struct smf_state *state = test_state; state != NULL; state = state->parent) {
-		if (target_state == state) {
-			return true;
-		}
-	}
-
-	return false;
-}
+/* Entry paths up to this deep are recorded on the stack instead of walked again */
+#define SMF_ENTRY_PATH_MAX 8
 
 static const struct smf_state *get_child_of(const struct smf_state *states,
 					    const struct smf_state *parent)
@@ -56,26 +48,55 @@ static const struct smf_state *get_last_of(const struct smf_state *states)
 	return get_child_of(states, NULL);
 }
 
+static int get_depth_of(const struct smf_state *state)
+{
+	int depth = 0;
+
+	for (; state->parent != NULL; state = state->parent) {
+		depth++;
+	}
+
+	return depth;
+}
+
 /**
- * @brief Find the Least Common Ancestor (LCA) of two states
+ * @brief Find the topmost state of a transition, whose exit and entry actions are not executed
+ *
+ * This is the destination if it is an ancestor of (or the same as) the source, the source
+ * if it is an ancestor of the destination, and else their Least Common Ancestor (LCA).
+ * Both states are brought to the same depth first, so each is walked up once.
  *
  * @param source transition source
  * @param dest transition destination
- * @return LCA state, or NULL if states have no LCA.
+ * @return topmost state, or NULL if states have no LCA.
  */
-static const struct smf_state *get_lca_of(const struct smf_state *source,
-					  const struct smf_state *dest)
+static const struct smf_state *get_topmost_of(const struct smf_state *source,
+					      const struct smf_state *dest)
 {
-	for (const struct smf_state *ancestor = source->parent; ancestor != NULL;
-	     ancestor = ancestor->parent) {
-		if (ancestor == dest) {
-			return ancestor->parent;
-		} else if (share_parent(dest, ancestor)) {
-			return ancestor;
-		}
+	int source_depth = get_depth_of(source);
+	int dest_depth = get_depth_of(dest);
+	const struct smf_state *s = source;
+	const struct smf_state *d = dest;
+
+	for (; source_depth > dest_depth; source_depth--) {
+		s = s->parent;
 	}
 
-	return NULL;
+	for (; dest_depth > source_depth; dest_depth--) {
+		d = d->parent;
+	}
+
+	if (s == d) {
+		/* One is an ancestor of the other */
+		return s == dest ? dest : source;
+	}
+
+	while (s != d) {
+		s = s->parent;
+		d = d->parent;
+	}
+
+	return s;
 }
 
 /**
@@ -92,14 +113,43 @@ static bool smf_execute_all_entry_actions(struct smf_ctx *const ctx,
 {
 	struct internal_ctx *const internal = (void *)&ctx->internal;
 
+	const struct smf_state *path[SMF_ENTRY_PATH_MAX];
+	const struct smf_state *to_execute;
+	int depth = 0;
+
 	if (new_state == topmost) {
 		/* There are no child states, so do nothing */
 		return false;
 	}
 
-	for (const struct smf_state *to_execute = get_child_of(new_state, topmost);
-	     to_execute != NULL && to_execute != new_state;
-	     to_execute = get_child_of(new_state, to_execute)) {
+	/* Record the ancestors between topmost and the new state, innermost first */
+	for (to_execute = new_state->parent; to_execute != topmost && to_execute != NULL;
+	     to_execute = to_execute->parent) {
+		if (depth == SMF_ENTRY_PATH_MAX) {
+			break;
+		}
+
+		path[depth++] = to_execute;
+	}
+
+	/* Levels above the recorded ones, in deeper trees, are found with a walk each */
+	if (depth == SMF_ENTRY_PATH_MAX) {
+		for (to_execute = get_child_of(new_state, topmost); to_execute != path[depth - 1];
+		     to_execute = get_child_of(new_state, to_execute)) {
+			ctx->executing = to_execute;
+			if (to_execute->entry) {
+				to_execute->entry(ctx);
+
+				if (internal->terminate) {
+					return true;
+				}
+			}
+		}
+	}
+
+	while (depth > 0) {
+		to_execute = path[--depth];
+
 		/* Keep track of the executing entry action in case it calls
 		 * smf_set_state()
 		 */
@@ -289,18 +339,7 @@ void smf_set_state(struct smf_ctx *const ctx, const struct smf_state *new_state)
 	}
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
-	const struct smf_state *topmost;
-
-	if (share_parent(ctx->executing, new_state)) {
-		/* new state is a parent of where we are now*/
-		topmost = new_state;
-	} else if (share_parent(new_state, ctx->executing)) {
-		/* we are a parent of the new state */
-		topmost = ctx->executing;
-	} else {
-		/* not directly related, find LCA */
-		topmost = get_lca_of(ctx->executing, new_state);
-	}
+	const struct smf_state *topmost = get_topmost_of(ctx->executing, new_state);
 
 	internal->is_exit = true;
 	internal->new_state = true;
@@ -26,6 +26,8 @@
 #include <errno.h>
 #include <zephyr/sys/base64.h>
 
+#include "swar.h"
+
 static const uint8_t base64_enc_map[64] = {
 	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J',
 	'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T',
@@ -54,6 +56,212 @@ static const uint8_t base64_dec_map[128] = {
 
 #define BASE64_SIZE_T_MAX	((size_t) -1) /* SIZE_T_MAX is not standard */
 
+/*
+ * Vector kernels encode 48 bytes into 64 characters, and decode 64 characters without padding nor
+ * line breaks back into 48 bytes.
+ */
+#if defined(CONFIG_BASE64_HEX_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BASE64_VEC_BYTES 48
+
+static inline uint8x16_t base64_vec_enc_map(uint8x16_t idx)
+{
+	return vqtbl4q_u8(vld1q_u8_x4(base64_enc_map), idx);
+}
+
+/* Decoding map entry of each character, ignoring its top bit */
+static inline uint8x16_t base64_vec_dec_map(uint8x16_t c)
+{
+	uint8x16_t idx = vandq_u8(c, vdupq_n_u8(0x7f));
+	uint8x16_t lo = vqtbl4q_u8(vld1q_u8_x4(&base64_dec_map[0]), idx);
+
+	return vqtbx4q_u8(lo, vld1q_u8_x4(&base64_dec_map[64]), vsubq_u8(idx, vdupq_n_u8(64)));
+}
+
+static inline uint8x16x3_t base64_vec_load3(const uint8_t *src)
+{
+	return vld3q_u8(src);
+}
+
+static inline void base64_vec_store3(uint8_t *dst, uint8x16x3_t val)
+{
+	vst3q_u8(dst, val);
+}
+
+static inline uint8_t base64_vec_max(uint8x16_t x)
+{
+	return vmaxvq_u8(x);
+}
+
+#elif defined(CONFIG_BASE64_HEX_SIMD) && defined(__ARM_FEATURE_MVE)
+#include <arm_mve.h>
+#define BASE64_VEC_BYTES 48
+
+/* Helium has no table lookup instructions, maps are read with gathers */
+static inline uint8x16_t base64_vec_enc_map(uint8x16_t idx)
+{
+	return vldrbq_gather_offset_u8(base64_enc_map, idx);
+}
+
+static inline uint8x16_t base64_vec_dec_map(uint8x16_t c)
+{
+	return vldrbq_gather_offset_u8(base64_dec_map, vandq_u8(c, vdupq_n_u8(0x7f)));
+}
+
+/* Nor three way interleaving loads and stores */
+static inline uint8x16x3_t base64_vec_load3(const uint8_t *src)
+{
+	uint8x16_t offset = vmulq_n_u8(vidupq_n_u8(0, 1), 3);
+	uint8x16x3_t val;
+
+	val.val[0] = vldrbq_gather_offset_u8(src, offset);
+	val.val[1] = vldrbq_gather_offset_u8(src + 1, offset);
+	val.val[2] = vldrbq_gather_offset_u8(src + 2, offset);
+
+	return val;
+}
+
+static inline void base64_vec_store3(uint8_t *dst, uint8x16x3_t val)
+{
+	uint8x16_t offset = vmulq_n_u8(vidupq_n_u8(0, 1), 3);
+
+	vstrbq_scatter_offset_u8(dst, offset, val.val[0]);
+	vstrbq_scatter_offset_u8(dst + 1, offset, val.val[1]);
+	vstrbq_scatter_offset_u8(dst + 2, offset, val.val[2]);
+}
+
+static inline uint8_t base64_vec_max(uint8x16_t x)
+{
+	return vmaxvq_u8(0, x);
+}
+#endif
+
+#ifdef BASE64_VEC_BYTES
+#define BASE64_VEC_CHARS (BASE64_VEC_BYTES / 3 * 4)
+
+static inline void base64_enc_vec(uint8_t *dst, const uint8_t *src)
+{
+	uint8x16x3_t in = base64_vec_load3(src);
+	uint8x16x4_t out;
+
+	out.val[0] = vshrq_n_u8(in.val[0], 2);
+	out.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(0x03)), 4),
+			      vshrq_n_u8(in.val[1], 4));
+	out.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0x0f)), 2),
+			      vshrq_n_u8(in.val[2], 6));
+	out.val[3] = vandq_u8(in.val[2], vdupq_n_u8(0x3f));
+
+	for (int k = 0; k < 4; k++) {
+		out.val[k] = base64_vec_enc_map(out.val[k]);
+	}
+
+	vst4q_u8(dst, out);
+}
+
+/* Decode into dst unless NULL, false if a character is not in the alphabet */
+static inline bool base64_dec_vec(uint8_t *dst, const uint8_t *src)
+{
+	uint8x16x4_t in = vld4q_u8(src);
+	uint8x16x3_t out;
+	uint8x16_t bad = vdupq_n_u8(0);
+
+	for (int k = 0; k < 4; k++) {
+		uint8x16_t c = in.val[k];
+
+		/* Only sextets are below 64, the top bit flags characters above 0x7f */
+		in.val[k] = base64_vec_dec_map(c);
+		bad = vorrq_u8(bad, vorrq_u8(in.val[k], vandq_u8(c, vdupq_n_u8(0x80))));
+	}
+
+	if (base64_vec_max(bad) >= 64U) {
+		return false;
+	}
+
+	if (dst != NULL) {
+		out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+		out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+		out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+		base64_vec_store3(dst, out);
+	}
+
+	return true;
+}
+#endif /* BASE64_VEC_BYTES */
+
+/* Binary bytes held by a word of characters */
+#define BASE64_WORD_BYTES (SWAR_BYTES / 4U * 3U)
+
+#if defined(CONFIG_64BIT)
+#define base64_load_bin(src)	   sys_get_be48(src)
+#define base64_store_bin(val, dst) sys_put_be48(val, dst)
+#else
+#define base64_load_bin(src)	   sys_get_be24(src)
+#define base64_store_bin(val, dst) sys_put_be24(val, dst)
+#endif
+
+/* Encode BASE64_WORD_BYTES bytes into a word of characters */
+static inline swar_t base64_enc_word(swar_t x)
+{
+	swar_t c;
+
+	/* Spread the sextets into bytes */
+#if defined(CONFIG_64BIT)
+	x = ((x & 0xffffff000000U) << 8) | (x & 0xffffffU);
+#endif
+	x = ((x & (SWAR_LSB32 * 0xfff000)) << 4) | (x & (SWAR_LSB32 * 0xfff));
+	x = ((x & (SWAR_LSB16 * 0xfc0)) << 2) | (x & (SWAR_LSB16 * 0x3f));
+
+	/*
+	 * Offset each sextet to its character, the ranges of the alphabet being consecutive.
+	 * Bytes stay within [0, 0xff] at each step so that no carry crosses them.
+	 */
+	c = x + SWAR_LSBS * 'A';
+	c += (swar_ge(x, 26) >> 7) * ('a' - 26 - 'A');
+	c -= (swar_ge(x, 52) >> 7) * (('a' - 26) - ('0' - 52));
+	c -= (swar_ge(x, 62) >> 7) * (('0' - 52) - ('+' - 62));
+	c += (swar_ge(x, 63) >> 7) * (('/' - 63) - ('+' - 62));
+
+	return c;
+}
+
+/* Decode a word of characters into BASE64_WORD_BYTES bytes, false if one is not in the alphabet */
+static inline bool base64_dec_word(swar_t x, swar_t *out)
+{
+	swar_t upper;
+	swar_t lower;
+	swar_t digit;
+	swar_t plus;
+	swar_t slash;
+
+	if ((x & SWAR_MSBS) != 0U) {
+		return false;
+	}
+
+	upper = swar_in_range(x, 'A', 'Z');
+	lower = swar_in_range(x, 'a', 'z');
+	digit = swar_in_range(x, '0', '9');
+	plus = swar_in_range(x, '+', '+');
+	slash = swar_in_range(x, '/', '/');
+	if ((upper | lower | digit | plus | slash) != SWAR_MSBS) {
+		return false;
+	}
+
+	/* A single range selects each byte, so the offsets do not add up */
+	x = swar_add(x, (upper >> 7) * (uint8_t)(0 - 'A') + (lower >> 7) * (uint8_t)(26 - 'a') +
+				(digit >> 7) * (uint8_t)(52 - '0') + (plus >> 7) * (62 - '+') +
+				(slash >> 7) * (63 - '/'));
+
+	/* Pack the sextets */
+	x = ((x & (SWAR_LSB16 * 0x3f00)) >> 2) | (x & (SWAR_LSB16 * 0x3f));
+	x = ((x & (SWAR_LSB32 * 0xfff0000)) >> 4) | (x & (SWAR_LSB32 * 0xfff));
+#if defined(CONFIG_64BIT)
+	x = ((x >> 8) & 0xffffff000000U) | (x & 0xffffffU);
+#endif
+	*out = x;
+
+	return true;
+}
+
 /*
  * Encode a buffer into base64 format
  */
@@ -84,8 +292,24 @@ int base64_encode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	}
 
 	n = (slen / 3) * 3;
+	i = 0;
+	p = dst;
+
+#ifdef BASE64_VEC_BYTES
+	for (; (n - i) >= BASE64_VEC_BYTES; i += BASE64_VEC_BYTES) {
+		base64_enc_vec(p, src);
+		src += BASE64_VEC_BYTES;
+		p += BASE64_VEC_CHARS;
+	}
+#endif
 
-	for (i = 0, p = dst; i < n; i += 3) {
+	for (; (n - i) >= BASE64_WORD_BYTES; i += BASE64_WORD_BYTES) {
+		swar_store(base64_enc_word(base64_load_bin(src)), p);
+		src += BASE64_WORD_BYTES;
+		p += SWAR_BYTES;
+	}
+
+	for (; i < n; i += 3) {
 		C1 = *src++;
 		C2 = *src++;
 		C3 = *src++;
@@ -127,9 +351,23 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	size_t i, n;
 	uint32_t j, x;
 	uint8_t *p;
+	swar_t w;
 
 	/* First pass: check for validity and get output length */
 	for (i = n = j = 0U; i < slen; i++) {
+		/* Skip runs of characters of the alphabet at once */
+#ifdef BASE64_VEC_BYTES
+		while (j == 0U && (slen - i) >= BASE64_VEC_CHARS &&
+		       base64_dec_vec(NULL, &src[i])) {
+			i += BASE64_VEC_CHARS;
+			n += BASE64_VEC_CHARS;
+		}
+#endif
+		while (j == 0U && (slen - i) >= SWAR_BYTES && base64_dec_word(swar_load(&src[i]), &w)) {
+			i += SWAR_BYTES;
+			n += SWAR_BYTES;
+		}
+
 		/* Skip spaces before checking for EOL */
 		x = 0U;
 		while (i < slen && src[i] == ' ') {
@@ -188,6 +426,24 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	}
 
 	for (j = 3U, n = x = 0U, p = dst; i > 0; i--, src++) {
+		/* Decode whole quanta at once until a line break or padding */
+#ifdef BASE64_VEC_BYTES
+		while (n == 0U && i >= BASE64_VEC_CHARS && base64_dec_vec(p, src)) {
+			p += BASE64_VEC_BYTES;
+			src += BASE64_VEC_CHARS;
+			i -= BASE64_VEC_CHARS;
+		}
+#endif
+		while (n == 0U && i >= SWAR_BYTES && base64_dec_word(swar_load(src), &w)) {
+			base64_store_bin(w, p);
+			p += BASE64_WORD_BYTES;
+			src += SWAR_BYTES;
+			i -= SWAR_BYTES;
+		}
+
+		if (i == 0) {
+			break;
+		}
 
 		if (*src == '\r' || *src == '\n' || *src == ' ') {
 			continue;
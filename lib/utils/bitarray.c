@@ -8,8 +8,10 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/sys/bitarray.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/sys_io.h>
 
 /* Number of bits represented by one bundle */
@@ -26,6 +28,83 @@ struct bundle_data {
 	uint32_t smask, emask;
 };
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+/* Record which of the bundles from sidx to eidx are fully set */
+static void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	for (size_t idx = sidx; idx <= eidx; idx++) {
+		uint32_t bit = BIT(idx % bundle_bitness(bitarray));
+		uint32_t *summary = &bitarray->summary[idx / bundle_bitness(bitarray)];
+
+		if (bitarray->bundles[idx] == ~0U) {
+			*summary |= bit;
+		} else {
+			*summary &= ~bit;
+		}
+	}
+}
+
+/* First bundle from idx, up to the bundle of limit, which is not fully set */
+static size_t skip_full_bundles(sys_bitarray_t *bitarray, size_t idx, size_t limit)
+{
+	size_t sidx = idx / bundle_bitness(bitarray);
+	uint32_t free = ~bitarray->summary[sidx] & ~(BIT(idx % bundle_bitness(bitarray)) - 1);
+
+	while (free == 0U) {
+		sidx++;
+		if (sidx * bundle_bitness(bitarray) * bundle_bitness(bitarray) >= limit) {
+			return limit / bundle_bitness(bitarray);
+		}
+		free = ~bitarray->summary[sidx];
+	}
+
+	return sidx * bundle_bitness(bitarray) + u32_count_trailing_zeros(free);
+}
+#else
+static inline void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	ARG_UNUSED(bitarray);
+	ARG_UNUSED(sidx);
+	ARG_UNUSED(eidx);
+}
+#endif
+
+/*
+ * Find the first bit set, or cleared, from bit "from" up to "limit" excluded,
+ * a bundle at a time.
+ *
+ * @return Offset of the bit, or limit if there is none.
+ */
+static size_t find_next(sys_bitarray_t *bitarray, size_t from, size_t limit,
+			bool find_set)
+{
+	size_t idx = from / bundle_bitness(bitarray);
+	uint32_t flip = find_set ? 0U : ~0U;
+	uint32_t bundle;
+
+	if (from >= limit) {
+		return limit;
+	}
+
+	bundle = (bitarray->bundles[idx] ^ flip) &
+		 ~(BIT(from % bundle_bitness(bitarray)) - 1);
+
+	while (bundle == 0U) {
+		idx++;
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+		if (!find_set) {
+			idx = skip_full_bundles(bitarray, idx, limit);
+		}
+#endif
+		if (idx * bundle_bitness(bitarray) >= limit) {
+			return limit;
+		}
+		bundle = bitarray->bundles[idx] ^ flip;
+	}
+
+	return MIN(idx * bundle_bitness(bitarray) + u32_count_trailing_zeros(bundle), limit);
+}
+
 static void setup_bundle_data(sys_bitarray_t *bitarray,
 			      struct bundle_data *bd,
 			      size_t offset, size_t num_bits)
@@ -197,17 +276,16 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 		if (to_set) {
 			bitarray->bundles[bd->sidx] |= bd->smask;
 			bitarray->bundles[bd->eidx] |= bd->emask;
-			for (idx = bd->sidx + 1; idx < bd->eidx; idx++) {
-				bitarray->bundles[idx] = ~0U;
-			}
 		} else {
 			bitarray->bundles[bd->sidx] &= ~bd->smask;
 			bitarray->bundles[bd->eidx] &= ~bd->emask;
-			for (idx = bd->sidx + 1; idx < bd->eidx; idx++) {
-				bitarray->bundles[idx] = 0U;
-			}
 		}
+		idx = bd->sidx + 1;
+		(void)memset(&bitarray->bundles[idx], to_set ? 0xff : 0x00,
+			     (bd->eidx - idx) * sizeof(bitarray->bundles[0]));
 	}
+
+	update_summary(bitarray, bd->sidx, bd->eidx);
 }
 
 int sys_bitarray_popcount_region(sys_bitarray_t *bitarray, size_t num_bits, size_t offset,
@@ -309,6 +387,7 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 		}
 	}
 
+	update_summary(dst, bd.sidx, bd.eidx);
 	ret = 0;
 
 out:
@@ -337,6 +416,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -365,6 +445,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -441,6 +522,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -480,6 +562,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -492,11 +575,8 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
+	size_t bit_idx, run_end, off_end;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -513,46 +593,23 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
+	/* Walk the runs of free bits a bundle at a time: find the start of
+	 * the next run, then its end up to the requested size. Every bundle
+	 * is visited at most twice.
 	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
-
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
-	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
+	for (bit_idx = find_next(bitarray, 0, bitarray->num_bits, false);
+	     bit_idx <= off_end;
+	     bit_idx = find_next(bitarray, run_end, bitarray->num_bits, false)) {
+		run_end = find_next(bitarray, bit_idx, bit_idx + num_bits, true);
+		if (run_end == bit_idx + num_bits) {
+			set_region(bitarray, bit_idx, num_bits, true, NULL);
 
 			*offset = bit_idx;
 			ret = 0;
 			break;
 		}
-
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
 	}
 
 out:
@@ -617,18 +674,15 @@ int sys_bitarray_find_nth_set(sys_bitarray_t *bitarray, size_t n, size_t num_bit
 	goto out;
 
 found:
-	/* The bit we are looking for must be in the current bundle idx.
-	 * Find out the exact index of the bit.
+	/* The bit we are looking for is the n-th set bit of the current
+	 * bundle idx, drop the lower ones.
 	 */
-	for (size_t j = 0; j <= bundle_bitness(bitarray) - 1; j++) {
-		if (bitarray->bundles[idx] & mask & BIT(j)) {
-			if (--n <= 0) {
-				*found_at = idx * bundle_bitness(bitarray) + j;
-				ret = 0;
-				break;
-			}
-		}
+	mask &= bitarray->bundles[idx];
+	while (--n > 0) {
+		mask &= mask - 1U;
 	}
+	*found_at = idx * bundle_bitness(bitarray) + u32_count_trailing_zeros(mask);
+	ret = 0;
 
 out:
 	k_spin_unlock(&bitarray->lock, key);
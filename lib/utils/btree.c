@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Blocks hold between BTREE_MIN and BTREE_ORDER entries, except the root which holds at least
+ * one node or two children. Inner blocks keep the lowest node of each child as its key, and are
+ * walked down to the last child whose key is not above the searched node. With at least two
+ * entries per block, a tree of N > 1 nodes never needs more than N - 1 blocks, so that a free
+ * block is always lent by another node when the block of a removed node must be moved.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/btree.h>
+
+#define BTREE_MIN (BTREE_ORDER / 2)
+
+BUILD_ASSERT(BTREE_MIN >= 2, "B+tree blocks must hold at least two entries");
+BUILD_ASSERT(BTREE_ORDER <= UINT8_MAX);
+
+static void block_free(struct btree *tree, struct btree_block *b)
+{
+	b->is_free = true;
+	b->prev = NULL;
+	b->parent = tree->free;
+	if (tree->free != NULL) {
+		tree->free->prev = b;
+	}
+	tree->free = b;
+}
+
+static void block_unlink_free(struct btree *tree, struct btree_block *b)
+{
+	if (b->prev != NULL) {
+		b->prev->parent = b->parent;
+	} else {
+		tree->free = b->parent;
+	}
+	if (b->parent != NULL) {
+		b->parent->prev = b->prev;
+	}
+	b->is_free = false;
+}
+
+static struct btree_block *block_alloc(struct btree *tree, bool is_leaf)
+{
+	struct btree_block *b = tree->free;
+
+	__ASSERT_NO_MSG(b != NULL);
+
+	block_unlink_free(tree, b);
+	b->parent = NULL;
+	b->count = 0U;
+	b->is_leaf = is_leaf;
+	b->prev = NULL;
+	b->next = NULL;
+
+	return b;
+}
+
+static uint8_t child_index(struct btree_block *parent, struct btree_block *child)
+{
+	uint8_t i = 0U;
+
+	while (parent->children[i] != child) {
+		i++;
+	}
+
+	return i;
+}
+
+/* Number of entries whose key is not above node */
+static uint8_t upper_bound(struct btree *tree, struct btree_block *b, struct btree_node *node)
+{
+	uint8_t lo = 0U;
+	uint8_t hi = b->count;
+
+	while (lo < hi) {
+		uint8_t mid = (lo + hi) / 2U;
+
+		if (tree->lessthan_fn(node, b->keys[mid])) {
+			hi = mid;
+		} else {
+			lo = mid + 1U;
+		}
+	}
+
+	return lo;
+}
+
+/* Point the entry at pos of b back to b */
+static inline void adopt(struct btree_block *b, uint8_t pos)
+{
+	if (b->is_leaf) {
+		b->keys[pos]->leaf = b;
+	} else {
+		b->children[pos]->parent = b;
+	}
+}
+
+/* Move n entries from src at spos to dst at dpos, src may be dst */
+static void move_entries(struct btree_block *dst, uint8_t dpos, struct btree_block *src,
+			 uint8_t spos, uint8_t n)
+{
+	memmove(&dst->keys[dpos], &src->keys[spos], n * sizeof(dst->keys[0]));
+	if (!dst->is_leaf) {
+		memmove(&dst->children[dpos], &src->children[spos], n * sizeof(dst->children[0]));
+	}
+
+	if (dst != src) {
+		for (uint8_t i = dpos; i < dpos + n; i++) {
+			adopt(dst, i);
+		}
+	}
+}
+
+/* Propagate the lowest node of b to the keys of its ancestors */
+static void update_min(struct btree_block *b)
+{
+	while (b->parent != NULL) {
+		struct btree_block *p = b->parent;
+		uint8_t i = child_index(p, b);
+
+		p->keys[i] = b->keys[0];
+		if (i != 0U) {
+			break;
+		}
+		b = p;
+	}
+}
+
+/* Insert an entry into b, which has room for it */
+static void block_insert(struct btree_block *b, uint8_t pos, struct btree_node *key,
+			 struct btree_block *child)
+{
+	move_entries(b, pos + 1U, b, pos, b->count - pos);
+	b->keys[pos] = key;
+	if (!b->is_leaf) {
+		b->children[pos] = child;
+	}
+	adopt(b, pos);
+	b->count++;
+}
+
+static void insert_entry(struct btree *tree, struct btree_block *b, uint8_t pos,
+			 struct btree_node *key, struct btree_block *child)
+{
+	struct btree_block *r;
+	uint8_t left = (BTREE_ORDER + 1U) / 2U;
+
+	if (b->count < BTREE_ORDER) {
+		block_insert(b, pos, key, child);
+		if (pos == 0U) {
+			update_min(b);
+		}
+		return;
+	}
+
+	/* Split, the left block keeps the lowest half of the entries and the new one */
+	r = block_alloc(tree, b->is_leaf);
+	if (pos < left) {
+		move_entries(r, 0U, b, left - 1U, BTREE_ORDER - left + 1U);
+		b->count = left - 1U;
+		r->count = BTREE_ORDER - left + 1U;
+		block_insert(b, pos, key, child);
+		if (pos == 0U) {
+			update_min(b);
+		}
+	} else {
+		move_entries(r, 0U, b, left, BTREE_ORDER - left);
+		b->count = left;
+		r->count = BTREE_ORDER - left;
+		block_insert(r, pos - left, key, child);
+	}
+
+	if (b->is_leaf) {
+		r->prev = b;
+		r->next = b->next;
+		if (b->next != NULL) {
+			b->next->prev = r;
+		} else {
+			tree->last = r;
+		}
+		b->next = r;
+	}
+
+	if (b->parent == NULL) {
+		struct btree_block *root = block_alloc(tree, false);
+
+		block_insert(root, 0U, b->keys[0], b);
+		block_insert(root, 1U, r->keys[0], r);
+		tree->root = root;
+	} else {
+		insert_entry(tree, b->parent, child_index(b->parent, b) + 1U, r->keys[0], r);
+	}
+}
+
+void btree_insert(struct btree *tree, struct btree_node *node)
+{
+	struct btree_block *b;
+
+	block_free(tree, &node->block);
+
+	if (tree->root == NULL) {
+		b = block_alloc(tree, true);
+		tree->root = b;
+		tree->first = b;
+		tree->last = b;
+		block_insert(b, 0U, node, NULL);
+		return;
+	}
+
+	for (b = tree->root; !b->is_leaf;) {
+		uint8_t i = upper_bound(tree, b, node);
+
+		b = b->children[(i > 0U) ? (i - 1U) : 0U];
+	}
+
+	insert_entry(tree, b, upper_bound(tree, b, node), node, NULL);
+}
+
+static void remove_entry(struct btree *tree, struct btree_block *b, uint8_t pos);
+
+/* Refill or merge b, which is below BTREE_MIN entries */
+static void rebalance(struct btree *tree, struct btree_block *b)
+{
+	struct btree_block *p = b->parent;
+	uint8_t i = child_index(p, b);
+	struct btree_block *left = (i > 0U) ? p->children[i - 1U] : NULL;
+	struct btree_block *right = (i + 1U < p->count) ? p->children[i + 1U] : NULL;
+
+	if ((left != NULL) && (left->count > BTREE_MIN)) {
+		move_entries(b, 1U, b, 0U, b->count);
+		move_entries(b, 0U, left, left->count - 1U, 1U);
+		left->count--;
+		b->count++;
+		p->keys[i] = b->keys[0];
+	} else if ((right != NULL) && (right->count > BTREE_MIN)) {
+		move_entries(b, b->count, right, 0U, 1U);
+		move_entries(right, 0U, right, 1U, right->count - 1U);
+		right->count--;
+		b->count++;
+		p->keys[i + 1U] = right->keys[0];
+	} else {
+		/* Merge the right block of the pair into the left one */
+		if (left == NULL) {
+			left = b;
+			b = right;
+			i++;
+		}
+
+		move_entries(left, left->count, b, 0U, b->count);
+		left->count += b->count;
+		if (b->is_leaf) {
+			left->next = b->next;
+			if (b->next != NULL) {
+				b->next->prev = left;
+			} else {
+				tree->last = left;
+			}
+		}
+
+		remove_entry(tree, p, i);
+		block_free(tree, b);
+	}
+}
+
+static void remove_entry(struct btree *tree, struct btree_block *b, uint8_t pos)
+{
+	b->count--;
+	move_entries(b, pos, b, pos + 1U, b->count - pos);
+
+	if (b == tree->root) {
+		if (b->count == 0U) {
+			tree->root = NULL;
+			tree->first = NULL;
+			tree->last = NULL;
+			block_free(tree, b);
+		} else if (!b->is_leaf && (b->count == 1U)) {
+			tree->root = b->children[0];
+			tree->root->parent = NULL;
+			block_free(tree, b);
+		}
+		return;
+	}
+
+	if (pos == 0U) {
+		update_min(b);
+	}
+
+	if (b->count < BTREE_MIN) {
+		rebalance(tree, b);
+	}
+}
+
+/* Move a block of the tree into a free block */
+static void block_move(struct btree *tree, struct btree_block *from)
+{
+	struct btree_block *to = block_alloc(tree, from->is_leaf);
+
+	*to = *from;
+	if (from->parent != NULL) {
+		from->parent->children[child_index(from->parent, from)] = to;
+	} else {
+		tree->root = to;
+	}
+
+	for (uint8_t i = 0U; i < to->count; i++) {
+		adopt(to, i);
+	}
+
+	if (to->is_leaf) {
+		if (to->prev != NULL) {
+			to->prev->next = to;
+		} else {
+			tree->first = to;
+		}
+		if (to->next != NULL) {
+			to->next->prev = to;
+		} else {
+			tree->last = to;
+		}
+	}
+}
+
+void btree_remove(struct btree *tree, struct btree_node *node)
+{
+	struct btree_block *b = node->leaf;
+	uint8_t pos = 0U;
+
+	while (b->keys[pos] != node) {
+		pos++;
+	}
+
+	remove_entry(tree, b, pos);
+	node->leaf = NULL;
+
+	/* Take the lent block back */
+	if (node->block.is_free) {
+		block_unlink_free(tree, &node->block);
+	} else {
+		block_move(tree, &node->block);
+	}
+}
+
+bool btree_contains(struct btree *tree, struct btree_node *node)
+{
+	struct btree_block *b = tree->root;
+	uint8_t pos;
+
+	if (b == NULL) {
+		return false;
+	}
+
+	while (!b->is_leaf) {
+		pos = upper_bound(tree, b, node);
+		b = b->children[(pos > 0U) ? (pos - 1U) : 0U];
+	}
+
+	/* Look back through the nodes equal to node */
+	pos = upper_bound(tree, b, node);
+	while (b != NULL) {
+		while (pos > 0U) {
+			struct btree_node *n = b->keys[--pos];
+
+			if (n == node) {
+				return true;
+			}
+			if (tree->lessthan_fn(n, node)) {
+				return false;
+			}
+		}
+
+		b = b->prev;
+		pos = (b != NULL) ? b->count : 0U;
+	}
+
+	return false;
+}
@@ -9,6 +9,132 @@
 #include <errno.h>
 #include <zephyr/sys/util.h>
 
+#include "swar.h"
+
+#if defined(CONFIG_BASE64_HEX_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HEX_VEC_BYTES 16
+
+static inline uint8x16_t hex_vec_lookup(const uint8_t table[16], uint8x16_t idx)
+{
+	return vqtbl1q_u8(vld1q_u8(table), idx);
+}
+
+/* Characters to nibbles, false if a character is not a hex digit */
+static inline bool hex_vec_nibbles(uint8x16_t c, uint8x16_t *x)
+{
+	uint8x16_t digit = vsubq_u8(c, vdupq_n_u8('0'));
+	uint8x16_t alpha = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+	uint8x16_t is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+	uint8x16_t is_alpha = vcltq_u8(alpha, vdupq_n_u8(6));
+
+	*x = vbslq_u8(is_digit, digit, vaddq_u8(alpha, vdupq_n_u8(10)));
+
+	return vminvq_u8(vorrq_u8(is_digit, is_alpha)) != 0U;
+}
+
+#elif defined(CONFIG_BASE64_HEX_SIMD) && defined(__ARM_FEATURE_MVE)
+#include <arm_mve.h>
+#define HEX_VEC_BYTES 16
+
+static inline uint8x16_t hex_vec_lookup(const uint8_t table[16], uint8x16_t idx)
+{
+	return vldrbq_gather_offset_u8(table, idx);
+}
+
+static inline bool hex_vec_nibbles(uint8x16_t c, uint8x16_t *x)
+{
+	uint8x16_t digit = vsubq_n_u8(c, '0');
+	uint8x16_t alpha = vsubq_n_u8(vorrq_u8(c, vdupq_n_u8(0x20)), 'a');
+	mve_pred16_t is_digit = vcmphiq_u8(vdupq_n_u8(10), digit);
+	mve_pred16_t is_alpha = vcmphiq_u8(vdupq_n_u8(6), alpha);
+
+	*x = vpselq_u8(digit, vaddq_n_u8(alpha, 10), is_digit);
+
+	return (is_digit | is_alpha) == 0xffffU;
+}
+#endif
+
+#ifdef HEX_VEC_BYTES
+static const uint8_t hex_digits[] = "0123456789abcdef";
+
+static inline void hex_enc_vec(char *hex, const uint8_t *buf)
+{
+	uint8x16_t x = vld1q_u8(buf);
+	uint8x16x2_t out;
+
+	out.val[0] = hex_vec_lookup(hex_digits, vshrq_n_u8(x, 4));
+	out.val[1] = hex_vec_lookup(hex_digits, vandq_u8(x, vdupq_n_u8(0x0f)));
+	vst2q_u8((uint8_t *)hex, out);
+}
+
+static inline bool hex_dec_vec(uint8_t *buf, const char *hex)
+{
+	uint8x16x2_t in = vld2q_u8((const uint8_t *)hex);
+	uint8x16_t hi;
+	uint8x16_t lo;
+
+	if (!hex_vec_nibbles(in.val[0], &hi) || !hex_vec_nibbles(in.val[1], &lo)) {
+		return false;
+	}
+
+	vst1q_u8(buf, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+
+	return true;
+}
+#endif /* HEX_VEC_BYTES */
+
+/* Binary bytes held by a word of characters */
+#define HEX_WORD_BYTES (SWAR_BYTES / 2U)
+
+#if defined(CONFIG_64BIT)
+#define hex_load_bin(src)	sys_get_be32(src)
+#define hex_store_bin(val, dst) sys_put_be32(val, dst)
+#else
+#define hex_load_bin(src)	sys_get_be16(src)
+#define hex_store_bin(val, dst) sys_put_be16(val, dst)
+#endif
+
+/* Spread the nibbles of HEX_WORD_BYTES bytes into the bytes of a word of characters */
+static inline swar_t hex_enc_word(swar_t x)
+{
+#if defined(CONFIG_64BIT)
+	x = (x | (x << 16)) & (SWAR_LSB32 * 0xffff);
+#endif
+	x = (x | (x << 8)) & (SWAR_LSB16 * 0xff);
+	x = (x | (x << 4)) & (SWAR_LSBS * 0x0f);
+
+	/* '0' to '9', then 'a' to 'f' above 9 */
+	return x + SWAR_LSBS * '0' + (swar_ge(x, 10) >> 7) * ('a' - '0' - 10);
+}
+
+/* Pack a word of characters into HEX_WORD_BYTES bytes, false if one is not a hex digit */
+static inline bool hex_dec_word(swar_t x, swar_t *out)
+{
+	swar_t digit;
+	swar_t alpha;
+
+	if ((x & SWAR_MSBS) != 0U) {
+		return false;
+	}
+
+	digit = swar_in_range(x, '0', '9');
+	alpha = swar_in_range(x | (SWAR_LSBS * 0x20), 'a', 'f');
+	if ((digit | alpha) != SWAR_MSBS) {
+		return false;
+	}
+
+	x = (x & (SWAR_LSBS * 0x0f)) + (alpha >> 7) * 9U;
+	x = (x | (x >> 4)) & (SWAR_LSB16 * 0xff);
+	x = (x | (x >> 8)) & (SWAR_LSB32 * 0xffff);
+#if defined(CONFIG_64BIT)
+	x = (x | (x >> 16)) & 0xffffffffU;
+#endif
+	*out = x;
+
+	return true;
+}
+
 int char2hex(char c, uint8_t *x)
 {
 	if ((c >= '0') && (c <= '9')) {
@@ -39,11 +165,23 @@ int hex2char(uint8_t x, char *c)
 
 size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
 {
+	size_t i = 0;
+
 	if (hexlen < ((buflen * 2U) + 1U)) {
 		return 0;
 	}
 
-	for (size_t i = 0; i < buflen; i++) {
+#ifdef HEX_VEC_BYTES
+	for (; (buflen - i) >= HEX_VEC_BYTES; i += HEX_VEC_BYTES) {
+		hex_enc_vec(&hex[2U * i], &buf[i]);
+	}
+#endif
+
+	for (; (buflen - i) >= HEX_WORD_BYTES; i += HEX_WORD_BYTES) {
+		swar_store(hex_enc_word(hex_load_bin(&buf[i])), (uint8_t *)&hex[2U * i]);
+	}
+
+	for (; i < buflen; i++) {
 		hex2char(buf[i] >> 4, &hex[2U * i]);
 		hex2char(buf[i] & 0xf, &hex[2U * i + 1U]);
 	}
@@ -54,7 +192,10 @@ size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
 
 size_t hex2bin(const char *hex, size_t hexlen, uint8_t *buf, size_t buflen)
 {
+	size_t len = hexlen / 2U;
+	size_t i = 0;
 	uint8_t dec;
+	swar_t x;
 
 	if (buflen < (hexlen / 2U + hexlen % 2U)) {
 		return 0;
@@ -71,7 +212,22 @@ size_t hex2bin(const char *hex, size_t hexlen, uint8_t *buf, size_t buflen)
 	}
 
 	/* regular hex conversion */
-	for (size_t i = 0; i < (hexlen / 2U); i++) {
+#ifdef HEX_VEC_BYTES
+	for (; (len - i) >= HEX_VEC_BYTES; i += HEX_VEC_BYTES) {
+		if (!hex_dec_vec(&buf[i], &hex[2U * i])) {
+			return 0;
+		}
+	}
+#endif
+
+	for (; (len - i) >= HEX_WORD_BYTES; i += HEX_WORD_BYTES) {
+		if (!hex_dec_word(swar_load((const uint8_t *)&hex[2U * i]), &x)) {
+			return 0;
+		}
+		hex_store_bin(x, &buf[i]);
+	}
+
+	for (; i < len; i++) {
 		if (char2hex(hex[2U * i], &dec) < 0) {
 			return 0;
 		}
@@ -18,6 +18,10 @@
 
 #include <zephyr/data/json.h>
 
+#ifdef CONFIG_NET_BUF
+#include <zephyr/net_buf.h>
+#endif
+
 struct json_obj_key_value {
 	const char *key;
 	size_t key_len;
@@ -1071,55 +1075,124 @@ static int arr_data_parse(struct json_obj *obj, struct json_obj_token *val)
 	return -EINVAL;
 }
 
+/*
+ * Keys are looked up in a hash table of the descriptors of the object, with linear probing. Slots
+ * hold the index of a descriptor plus one, 0 for free slots. Small objects are searched faster
+ * linearly, and large ones would fill the table too much.
+ */
+#define FIELD_INDEX_SLOTS ARRAY_SIZE(((struct json_field_index *)0)->slots)
+#define FIELD_INDEX_MIN	  8
+#define FIELD_INDEX_MAX	  (FIELD_INDEX_SLOTS * 2 / 3)
+
+static size_t field_hash(const char *name, size_t len)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint8_t)name[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static void field_index_init(struct json_field_index *index,
+			     const struct json_obj_descr *descr, size_t descr_len)
+{
+	index->valid = IS_ENABLED(CONFIG_JSON_LIBRARY_FIELD_INDEX) &&
+		       descr_len >= FIELD_INDEX_MIN && descr_len <= FIELD_INDEX_MAX;
+	if (!index->valid) {
+		return;
+	}
+
+	memset(index->slots, 0, sizeof(index->slots));
+
+	for (size_t i = 0; i < descr_len; i++) {
+		size_t slot = field_hash(descr[i].field_name, descr[i].field_name_len);
+
+		while (index->slots[slot % FIELD_INDEX_SLOTS] != 0) {
+			slot++;
+		}
+
+		index->slots[slot % FIELD_INDEX_SLOTS] = i + 1;
+	}
+}
+
+static bool field_matches(const struct json_obj_descr *descr, size_t i, int64_t decoded_fields,
+			  const char *key, size_t key_len)
+{
+	/* Field has been decoded already, skip */
+	if (decoded_fields & ((int64_t)1 << i)) {
+		return false;
+	}
+
+	return key_len == descr[i].field_name_len &&
+	       memcmp(key, descr[i].field_name, key_len) == 0;
+}
+
+/* Returns the index of the first descriptor of @p key not decoded yet */
+static int field_find(const struct json_field_index *index, const struct json_obj_descr *descr,
+		      size_t descr_len, int64_t decoded_fields, const char *key, size_t key_len)
+{
+	if (index->valid) {
+		for (size_t slot = field_hash(key, key_len);; slot++) {
+			uint8_t i = index->slots[slot % FIELD_INDEX_SLOTS];
+
+			if (i == 0) {
+				return -ENOENT;
+			}
+
+			if (field_matches(descr, i - 1, decoded_fields, key, key_len)) {
+				return i - 1;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < descr_len; i++) {
+		if (field_matches(descr, i, decoded_fields, key, key_len)) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
 static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 			 size_t descr_len, void *val)
 {
+	struct json_field_index index;
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	int i;
 	int ret;
 
+	field_index_init(&index, descr, descr_len);
+
 	while (!obj_next(obj, &kv)) {
 		if (kv.value.type == JSON_TOK_OBJECT_END) {
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
-
-			/* Field has been decoded already, skip */
-			if (decoded_fields & ((int64_t)1 << i)) {
-				continue;
-			}
-
-			/* Check if it's the i-th field */
-			if (kv.key_len != descr[i].field_name_len) {
-				continue;
-			}
-
-			if (memcmp(kv.key, descr[i].field_name,
-				   descr[i].field_name_len)) {
-				continue;
-			}
+		i = field_find(&index, descr, descr_len, decoded_fields, kv.key, kv.key_len);
 
-			/* Store the decoded value */
-			ret = decode_value(obj, &descr[i], &kv.value,
-					   decode_field, val);
+		/* Skip field, if no descriptor was found */
+		if (i < 0) {
+			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
 			}
 
-			decoded_fields |= (int64_t)1<<i;
-			break;
+			continue;
 		}
 
-		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
-			ret = skip_field(obj, &kv);
-			if (ret < 0) {
-				return ret;
-			}
+		/* Store the decoded value */
+		ret = decode_value(obj, &descr[i], &kv.value,
+				   (char *)val + descr[i].offset, val);
+		if (ret < 0) {
+			return ret;
 		}
+
+		decoded_fields |= (int64_t)1 << i;
 	}
 
 	return -EINVAL;
@@ -1189,6 +1262,485 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+enum sax_expect {
+	EXPECT_VALUE,
+	EXPECT_VALUE_OR_END,
+	EXPECT_KEY,
+	EXPECT_KEY_OR_END,
+	EXPECT_COLON,
+	EXPECT_COMMA_OR_END,
+	EXPECT_NOTHING,
+};
+
+enum sax_lex {
+	LEX_NONE,
+	LEX_STRING,
+	LEX_ESCAPE,
+	LEX_UNICODE,
+	LEX_NUMBER,
+	LEX_LITERAL,
+};
+
+void json_sax_init(struct json_sax *sax, const struct json_sax_callbacks *cb, void *user_data,
+		   char *buf, size_t buf_size)
+{
+	*sax = (struct json_sax){
+		.cb = cb,
+		.user_data = user_data,
+		.buf = buf,
+		.buf_size = buf_size,
+		.expect = EXPECT_VALUE,
+		.lex = LEX_NONE,
+	};
+}
+
+static int sax_append(struct json_sax *sax, char chr)
+{
+	/* keep room for the byte following the value */
+	if (sax->len + 1 >= sax->buf_size) {
+		return -ENOSPC;
+	}
+
+	sax->buf[sax->len++] = chr;
+
+	return 0;
+}
+
+static bool sax_in_object(const struct json_sax *sax)
+{
+	return (sax->objects & BIT(sax->depth - 1)) != 0;
+}
+
+static void sax_value_done(struct json_sax *sax)
+{
+	sax->expect = (sax->depth == 0) ? EXPECT_NOTHING : EXPECT_COMMA_OR_END;
+}
+
+static int sax_scalar(struct json_sax *sax, enum json_tokens type)
+{
+	sax->lex = LEX_NONE;
+	sax->buf[sax->len] = '\0';
+
+	if (type == JSON_TOK_STRING && sax->key) {
+		sax->expect = EXPECT_COLON;
+		return sax->cb->key(sax->user_data, sax->buf, sax->len);
+	}
+
+	sax_value_done(sax);
+
+	return sax->cb->value(sax->user_data, type, sax->buf, sax->len);
+}
+
+static int sax_literal(struct json_sax *sax, char chr)
+{
+	static const char *const literals[] = {"true", "false", "null"};
+	static const enum json_tokens types[] = {JSON_TOK_TRUE, JSON_TOK_FALSE, JSON_TOK_NULL};
+	size_t i = (sax->buf[0] == 't') ? 0 : ((sax->buf[0] == 'f') ? 1 : 2);
+	int ret;
+
+	if (chr != literals[i][sax->len]) {
+		return -EINVAL;
+	}
+
+	ret = sax_append(sax, chr);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (literals[i][sax->len] == '\0') {
+		return sax_scalar(sax, types[i]);
+	}
+
+	return 0;
+}
+
+/* Process a character outside of strings, numbers and literals */
+static int sax_structural(struct json_sax *sax, char chr)
+{
+	bool value_ok = sax->expect == EXPECT_VALUE || sax->expect == EXPECT_VALUE_OR_END;
+
+	switch (chr) {
+	case '{':
+	case '[':
+		if (!value_ok) {
+			return -EINVAL;
+		}
+
+		if (sax->depth == sizeof(sax->objects) * CHAR_BIT) {
+			return -ENOMEM;
+		}
+
+		WRITE_BIT(sax->objects, sax->depth, chr == '{');
+		sax->depth++;
+		sax->expect = (chr == '{') ? EXPECT_KEY_OR_END : EXPECT_VALUE_OR_END;
+
+		return sax->cb->value(sax->user_data, (enum json_tokens)chr, NULL, 0);
+	case '}':
+	case ']':
+		if (sax->depth == 0 || sax_in_object(sax) != (chr == '}') ||
+		    (sax->expect != EXPECT_COMMA_OR_END &&
+		     sax->expect != ((chr == '}') ? EXPECT_KEY_OR_END : EXPECT_VALUE_OR_END))) {
+			return -EINVAL;
+		}
+
+		sax->depth--;
+		sax_value_done(sax);
+
+		return sax->cb->value(sax->user_data, (enum json_tokens)chr, NULL, 0);
+	case ',':
+		if (sax->expect != EXPECT_COMMA_OR_END) {
+			return -EINVAL;
+		}
+
+		sax->expect = sax_in_object(sax) ? EXPECT_KEY : EXPECT_VALUE;
+
+		return 0;
+	case ':':
+		if (sax->expect != EXPECT_COLON) {
+			return -EINVAL;
+		}
+
+		sax->expect = EXPECT_VALUE;
+
+		return 0;
+	case '"':
+		sax->key = sax->expect == EXPECT_KEY || sax->expect == EXPECT_KEY_OR_END;
+		if (!sax->key && !value_ok) {
+			return -EINVAL;
+		}
+
+		sax->lex = LEX_STRING;
+		sax->len = 0;
+
+		return 0;
+	case 't':
+	case 'f':
+	case 'n':
+		sax->lex = LEX_LITERAL;
+		break;
+	default:
+		if (isspace((unsigned char)chr) != 0) {
+			return 0;
+		}
+
+		if (chr != '-' && isdigit((unsigned char)chr) == 0) {
+			return -EINVAL;
+		}
+
+		sax->lex = LEX_NUMBER;
+		break;
+	}
+
+	if (!value_ok) {
+		return -EINVAL;
+	}
+
+	sax->len = 0;
+
+	return sax_append(sax, chr);
+}
+
+static int sax_char(struct json_sax *sax, char chr)
+{
+	int ret;
+
+	switch (sax->lex) {
+	case LEX_STRING:
+		if (chr == '"') {
+			return sax_scalar(sax, JSON_TOK_STRING);
+		}
+
+		if (chr == '\\') {
+			sax->lex = LEX_ESCAPE;
+		}
+
+		return sax_append(sax, chr);
+	case LEX_ESCAPE:
+		switch (chr) {
+		case '"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			sax->lex = LEX_STRING;
+			break;
+		case 'u':
+			sax->lex = LEX_UNICODE;
+			sax->hex = 4;
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		return sax_append(sax, chr);
+	case LEX_UNICODE:
+		if (isxdigit((unsigned char)chr) == 0) {
+			return -EINVAL;
+		}
+
+		if (--sax->hex == 0) {
+			sax->lex = LEX_STRING;
+		}
+
+		return sax_append(sax, chr);
+	case LEX_NUMBER:
+		if (isdigit((unsigned char)chr) != 0 || chr == '.' || chr == 'e' || chr == 'E' ||
+		    chr == '+' || chr == '-') {
+			return sax_append(sax, chr);
+		}
+
+		ret = sax_scalar(sax, JSON_TOK_NUMBER);
+		if (ret < 0) {
+			return ret;
+		}
+
+		return sax_structural(sax, chr);
+	case LEX_LITERAL:
+		return sax_literal(sax, chr);
+	default:
+		return sax_structural(sax, chr);
+	}
+}
+
+int json_sax_feed(struct json_sax *sax, const char *data, size_t len)
+{
+	for (size_t i = 0; i < len && sax->err == 0; i++) {
+		sax->err = sax_char(sax, data[i]);
+	}
+
+	return sax->err;
+}
+
+int json_sax_finish(struct json_sax *sax)
+{
+	if (sax->err == 0 && sax->lex == LEX_NUMBER) {
+		sax->err = sax_scalar(sax, JSON_TOK_NUMBER);
+	}
+
+	if (sax->err == 0 && (sax->lex != LEX_NONE || sax->expect != EXPECT_NOTHING)) {
+		sax->err = -EINVAL;
+	}
+
+	return sax->err;
+}
+
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+
+static void stream_push(struct json_obj_stream *stream, struct json_obj_stream_frame *frame)
+{
+	if (!frame->array) {
+		frame->decoded = 0;
+		frame->current = -1;
+		field_index_init(&frame->index, frame->descr, frame->descr_len);
+	}
+
+	stream->depth++;
+}
+
+static int stream_decode(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			 struct json_token *value, void *field, void *val)
+{
+	struct json_obj_stream_frame *frame = &stream->frames[stream->depth];
+
+	if (!equivalent_types(value->type, descr->type)) {
+		return -EINVAL;
+	}
+
+	switch (descr->type) {
+	case JSON_TOK_OBJECT_START:
+	case JSON_TOK_ARRAY_START:
+		if (stream->depth == ARRAY_SIZE(stream->frames)) {
+			return -ENOMEM;
+		}
+
+		break;
+	case JSON_TOK_STRING:
+	case JSON_TOK_OPAQUE:
+	case JSON_TOK_FLOAT:
+	case JSON_TOK_OBJ_ARRAY:
+		/* these refer to the document */
+		return -ENOTSUP;
+	default:
+		return decode_value(NULL, descr, value, field, val);
+	}
+
+	if (descr->type == JSON_TOK_OBJECT_START) {
+		*frame = (struct json_obj_stream_frame){
+			.descr = descr->object.sub_descr,
+			.descr_len = descr->object.sub_descr_len,
+			.val = field,
+		};
+	} else {
+		/* same layout as arr_parse() */
+		const struct json_obj_descr *elem_descr = descr->array.element_descr;
+
+		*frame = (struct json_obj_stream_frame){
+			.descr_len = descr->array.n_elements,
+			.val = val,
+			.field = field,
+			.elements = (size_t *)((char *)val + elem_descr->offset),
+			.array = true,
+		};
+
+		if (elem_descr->type == JSON_TOK_ARRAY_START) {
+			elem_descr = elem_descr->array.element_descr;
+		}
+
+		frame->descr = elem_descr;
+		*frame->elements = 0;
+	}
+
+	stream_push(stream, frame);
+
+	return 0;
+}
+
+static int stream_key(void *user_data, char *key, size_t len)
+{
+	struct json_obj_stream *stream = user_data;
+	struct json_obj_stream_frame *frame = &stream->frames[stream->depth - 1];
+
+	if (stream->skip > 0) {
+		return 0;
+	}
+
+	frame->current = field_find(&frame->index, frame->descr, frame->descr_len,
+				    frame->decoded, key, len);
+
+	return 0;
+}
+
+static int stream_value(void *user_data, enum json_tokens type, char *data, size_t len)
+{
+	struct json_obj_stream *stream = user_data;
+	struct json_obj_stream_frame *frame;
+	const struct json_obj_descr *descr;
+	struct json_token value = {
+		.type = type,
+		.start = data,
+		.end = data + len,
+	};
+	void *field;
+	void *val;
+	int ret;
+
+	if (stream->skip > 0) {
+		if (type == JSON_TOK_OBJECT_START || type == JSON_TOK_ARRAY_START) {
+			stream->skip++;
+		} else if (type == JSON_TOK_OBJECT_END || type == JSON_TOK_ARRAY_END) {
+			stream->skip--;
+		}
+
+		return 0;
+	}
+
+	if (stream->depth == 0) {
+		/* the top-level object, set up by json_obj_stream_init() */
+		if (type != JSON_TOK_OBJECT_START) {
+			return -EINVAL;
+		}
+
+		stream_push(stream, &stream->frames[0]);
+
+		return 0;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+
+	if (type == JSON_TOK_OBJECT_END || type == JSON_TOK_ARRAY_END) {
+		if (--stream->depth == 0) {
+			stream->decoded = frame->decoded;
+		}
+
+		return 0;
+	}
+
+	if (frame->array) {
+		if (*frame->elements == frame->descr_len) {
+			return -ENOSPC;
+		}
+
+		descr = frame->descr;
+		field = frame->field;
+		/* for nested arrays, the length field follows the elements */
+		val = (descr->type == JSON_TOK_ARRAY_START) ? field : frame->val;
+
+		ret = stream_decode(stream, descr, &value, field, val);
+		if (ret < 0) {
+			return ret;
+		}
+
+		(*frame->elements)++;
+		frame->field += get_elem_size(descr);
+
+		return 0;
+	}
+
+	if (frame->current < 0) {
+		/* Skip field, if no descriptor was found */
+		if (type == JSON_TOK_OBJECT_START || type == JSON_TOK_ARRAY_START) {
+			stream->skip = 1;
+		}
+
+		return 0;
+	}
+
+	descr = &frame->descr[frame->current];
+	ret = stream_decode(stream, descr, &value, (char *)frame->val + descr->offset,
+			    frame->val);
+	if (ret < 0) {
+		return ret;
+	}
+
+	frame->decoded |= (int64_t)1 << frame->current;
+
+	return 0;
+}
+
+static const struct json_sax_callbacks stream_callbacks = {
+	.key = stream_key,
+	.value = stream_value,
+};
+
+void json_obj_stream_init(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val, char *buf, size_t buf_size)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(stream->decoded) * CHAR_BIT - 1));
+
+	json_sax_init(&stream->sax, &stream_callbacks, stream, buf, buf_size);
+
+	stream->frames[0] = (struct json_obj_stream_frame){
+		.descr = descr,
+		.descr_len = descr_len,
+		.val = val,
+	};
+	stream->depth = 0;
+	stream->skip = 0;
+	stream->decoded = 0;
+}
+
+int json_obj_stream_feed(struct json_obj_stream *stream, const char *data, size_t len)
+{
+	return json_sax_feed(&stream->sax, data, len);
+}
+
+int64_t json_obj_stream_finish(struct json_obj_stream *stream)
+{
+	int ret;
+
+	ret = json_sax_finish(&stream->sax);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return stream->decoded;
+}
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
@@ -1370,72 +1922,91 @@ static int str_encode(const char *str, json_append_bytes_t append_bytes,
 	return ret;
 }
 
-static int int32_encode(const int32_t *num, json_append_bytes_t append_bytes,
-			void *data)
+/* Two digits of each number below 100 */
+static const char digit_pairs[] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/*
+ * Write the decimal digits of @p num backwards, ending at @p end, and return the first one.
+ * 64-bit divisions are only used while the number does not fit in 32 bits.
+ */
+static char *format_uint(char *end, uint64_t num)
 {
-	char buf[3 * sizeof(int32_t)];
-	int ret;
+	uint32_t low;
 
-	ret = snprintk(buf, sizeof(buf), "%d", *num);
-	if (ret < 0) {
-		return ret;
+	while (num > UINT32_MAX) {
+		low = (uint32_t)(num % 100000000U);
+		num /= 100000000U;
+
+		for (int i = 0; i < 4; i++) {
+			end -= 2;
+			memcpy(end, &digit_pairs[(low % 100U) * 2U], 2);
+			low /= 100U;
+		}
 	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+
+	for (low = (uint32_t)num; low >= 100U; low /= 100U) {
+		end -= 2;
+		memcpy(end, &digit_pairs[(low % 100U) * 2U], 2);
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	if (low >= 10U) {
+		end -= 2;
+		memcpy(end, &digit_pairs[low * 2U], 2);
+	} else {
+		*--end = (char)('0' + low);
+	}
+
+	return end;
 }
 
-static int uint32_encode(const uint32_t *num, json_append_bytes_t append_bytes,
-			 void *data)
+static char *format_int(char *end, int64_t num)
 {
-	char buf[3 * sizeof(uint32_t)];
-	int ret;
+	char *start = format_uint(end, (num < 0) ? -(uint64_t)num : (uint64_t)num);
 
-	ret = snprintk(buf, sizeof(buf), "%u", *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+	if (num < 0) {
+		*--start = '-';
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	return start;
 }
 
 static int int64_encode(const int64_t *num, json_append_bytes_t append_bytes,
 			void *data)
 {
-	char buf[sizeof("-9223372036854775808")];
-	int ret;
-
-	ret = snprintk(buf, sizeof(buf), "%" PRId64, *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
+	char buf[sizeof("-9223372036854775808") - 1];
+	char *start = format_int(&buf[sizeof(buf)], *num);
 
-	return append_bytes(buf, (size_t)ret, data);
+	return append_bytes(start, &buf[sizeof(buf)] - start, data);
 }
 
 static int uint64_encode(const uint64_t *num, json_append_bytes_t append_bytes,
 			void *data)
 {
-	char buf[sizeof("18446744073709551610")];
-	int ret;
+	char buf[sizeof("18446744073709551615") - 1];
+	char *start = format_uint(&buf[sizeof(buf)], *num);
 
-	ret = snprintk(buf, sizeof(buf), "%" PRIu64, *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
-	}
+	return append_bytes(start, &buf[sizeof(buf)] - start, data);
+}
 
-	return append_bytes(buf, (size_t)ret, data);
+static int int32_encode(const int32_t *num, json_append_bytes_t append_bytes,
+			void *data)
+{
+	int64_t num_64 = *num;
+
+	return int64_encode(&num_64, append_bytes, data);
+}
+
+static int uint32_encode(const uint32_t *num, json_append_bytes_t append_bytes,
+			 void *data)
+{
+	uint64_t num_64 = *num;
+
+	return uint64_encode(&num_64, append_bytes, data);
 }
 
 static int print_double(char *str, size_t size, const char *fmt, double num)
@@ -1452,6 +2023,23 @@ static int print_double(char *str, size_t size, const char *fmt, double num)
 		return snprintk(str, size, "Infinity");
 	}
 
+	/*
+	 * Integral values below 1e9 are printed as integers by both "%.9g" and "%.16g", format
+	 * them without cbprintf.
+	 */
+	if (fabs(num) < 1e9 && num == (double)(int32_t)num && !(num == 0 && signbit(num))) {
+		char buf[sizeof("-999999999") - 1];
+		char *start = format_int(&buf[sizeof(buf)], (int32_t)num);
+		int len = &buf[sizeof(buf)] - start;
+
+		if ((size_t)len < size) {
+			memcpy(str, start, len);
+			str[len] = '\0';
+		}
+
+		return len;
+	}
+
 	return snprintk(str, size, fmt, num);
 
 #else
@@ -1739,6 +2327,63 @@ int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 	return json_arr_encode(descr, val, append_bytes_to_buf, &appender);
 }
 
+#ifdef CONFIG_NET_BUF
+
+/* Size of the fragments allocated from pools of variable size */
+#define NET_BUF_FRAG_SIZE 128
+
+struct net_buf_appender {
+	struct net_buf *tail;
+	k_timeout_t timeout;
+};
+
+static struct net_buf *net_buf_appender_alloc(k_timeout_t timeout, void *user_data)
+{
+	struct net_buf_appender *appender = user_data;
+	struct net_buf_pool *pool = net_buf_pool_get(appender->tail->pool_id);
+	size_t size = pool->alloc->max_alloc_size;
+
+	/* Fixed size pools ignore the size, others would allocate each byte run separately */
+	return net_buf_alloc_len(pool, (size != 0) ? size : NET_BUF_FRAG_SIZE, timeout);
+}
+
+static int append_bytes_to_net_buf(const char *bytes, size_t len, void *data)
+{
+	struct net_buf_appender *appender = data;
+	size_t added;
+
+	/* Start from the last fragment, so that appending does not walk the whole chain */
+	added = net_buf_append_bytes(appender->tail, len, bytes, appender->timeout,
+				     net_buf_appender_alloc, appender);
+	appender->tail = net_buf_frag_last(appender->tail);
+
+	return (added == len) ? 0 : -ENOMEM;
+}
+
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf_appender appender = {
+		.tail = net_buf_frag_last(buf),
+		.timeout = timeout,
+	};
+
+	return json_obj_encode(descr, descr_len, val, append_bytes_to_net_buf, &appender);
+}
+
+int json_arr_encode_net_buf(const struct json_obj_descr *descr, const void *val,
+			    struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf_appender appender = {
+		.tail = net_buf_frag_last(buf),
+		.timeout = timeout,
+	};
+
+	return json_arr_encode(descr, val, append_bytes_to_net_buf, &appender);
+}
+
+#endif /* CONFIG_NET_BUF */
+
 static int measure_bytes(const char *bytes, size_t len, void *data)
 {
 	ssize_t *total = data;
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Helpers of the text codecs processing the bytes of a machine word at once. Words are loaded in
+ * big endian order so that the first character of a buffer is the most significant byte. Masks
+ * have the top bit of the selected bytes set.
+ */
+
+#ifndef ZEPHYR_LIB_UTILS_SWAR_H_
+#define ZEPHYR_LIB_UTILS_SWAR_H_
+
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_64BIT)
+typedef uint64_t swar_t;
+#define swar_load(src)	     sys_get_be64(src)
+#define swar_store(val, dst) sys_put_be64(val, dst)
+#else
+typedef uint32_t swar_t;
+#define swar_load(src)	     sys_get_be32(src)
+#define swar_store(val, dst) sys_put_be32(val, dst)
+#endif
+
+#define SWAR_BYTES sizeof(swar_t)
+#define SWAR_LSBS  ((swar_t)-1 / 0xff)
+#define SWAR_MSBS  (SWAR_LSBS << 7)
+/* Lowest bit of each 16-bit and 32-bit lane */
+#define SWAR_LSB16 ((swar_t)-1 / 0xffff)
+#define SWAR_LSB32 ((swar_t)-1 / 0xffffffff)
+
+/* Mask of the bytes of x at least t, for bytes below 0x80 and t up to 0x80 */
+static inline swar_t swar_ge(swar_t x, uint8_t t)
+{
+	return (x + SWAR_LSBS * (0x80 - t)) & SWAR_MSBS;
+}
+
+/* Mask of the bytes of x within [lo, hi], for bytes and bounds below 0x80 */
+static inline swar_t swar_in_range(swar_t x, uint8_t lo, uint8_t hi)
+{
+	return swar_ge(x, lo) & ~swar_ge(x, hi + 1);
+}
+
+/* Add the bytes of two words modulo 256 */
+static inline swar_t swar_add(swar_t a, swar_t b)
+{
+	return ((a & ~SWAR_MSBS) + (b & ~SWAR_MSBS)) ^ ((a ^ b) & SWAR_MSBS);
+}
+
+#endif /* ZEPHYR_LIB_UTILS_SWAR_H_ */
@@ -128,6 +128,11 @@
 #define FF_USE_FIND 1
 #endif /* defined(CONFIG_FS_FATFS_EXTRA_NATIVE_API) */
 
+#if defined(CONFIG_FS_FATFS_PREALLOCATE)
+#undef FF_USE_EXPAND
+#define FF_USE_EXPAND 1
+#endif /* defined(CONFIG_FS_FATFS_PREALLOCATE) */
+
 /*
  * When custom mount points are activated FF_VOLUME_STRS needs
  * to be undefined in order to be able to provide a custom
@@ -15,6 +15,7 @@
 #include <diskio.h>	/* FatFs lower layer API */
 #include <zfs_diskio.h> /* Zephyr specific FatFS API */
 #include <zephyr/storage/disk_access.h>
+#include <zephyr/storage/disk_cache.h>
 
 #if CONFIG_FS_FATFS_CUSTOM_MOUNT_POINT_COUNT
 #define PDRV_STR_ARRAY VolumeStr
@@ -48,6 +49,11 @@ DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(PDRV_STR_ARRAY), "pdrv out-of-range\n");
 
+	if (IS_ENABLED(CONFIG_FS_FATFS_DISK_CACHE)) {
+		return (disk_cache_read(PDRV_STR_ARRAY[pdrv], buff, sector, count) != 0) ?
+			RES_ERROR : RES_OK;
+	}
+
 	if (disk_access_read(PDRV_STR_ARRAY[pdrv], buff, sector, count) != 0) {
 		return RES_ERROR;
 	} else {
@@ -60,6 +66,11 @@ DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(PDRV_STR_ARRAY), "pdrv out-of-range\n");
 
+	if (IS_ENABLED(CONFIG_FS_FATFS_DISK_CACHE)) {
+		return (disk_cache_write(PDRV_STR_ARRAY[pdrv], buff, sector, count) != 0) ?
+			RES_ERROR : RES_OK;
+	}
+
 	if (disk_access_write(PDRV_STR_ARRAY[pdrv], buff, sector, count) != 0) {
 		return RES_ERROR;
 	} else {
@@ -77,7 +88,12 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
 
 	switch (cmd) {
 	case CTRL_SYNC:
-		if (disk_access_ioctl(PDRV_STR_ARRAY[pdrv], DISK_IOCTL_CTRL_SYNC, buff) != 0) {
+		if (IS_ENABLED(CONFIG_FS_FATFS_DISK_CACHE)) {
+			if (disk_cache_sync(PDRV_STR_ARRAY[pdrv]) != 0) {
+				ret = RES_ERROR;
+			}
+		} else if (disk_access_ioctl(PDRV_STR_ARRAY[pdrv], DISK_IOCTL_CTRL_SYNC, buff) !=
+			   0) {
 			ret = RES_ERROR;
 		}
 		break;
@@ -116,6 +132,10 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
 	case CTRL_POWER:
 		if (((*(uint8_t *)buff)) == DISK_IOCTL_POWER_OFF) {
 			/* Power disk off */
+			if (IS_ENABLED(CONFIG_FS_FATFS_DISK_CACHE)) {
+				(void)disk_cache_sync(PDRV_STR_ARRAY[pdrv]);
+				disk_cache_invalidate(PDRV_STR_ARRAY[pdrv]);
+			}
 			if (disk_access_ioctl(PDRV_STR_ARRAY[pdrv], DISK_IOCTL_CTRL_DEINIT, NULL) !=
 			    0) {
 				ret = RES_ERROR;
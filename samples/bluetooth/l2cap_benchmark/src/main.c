@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/bluetooth/l2cap.h>
+#include <zephyr/console/console.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define BENCHMARK_PSM   0x0080
+#define SDU_LEN         1980
+#define TX_SDU_COUNT    3
+#define RX_SDU_COUNT    2
+#define REPORT_INTERVAL K_SECONDS(1)
+
+enum benchmark_role {
+	ROLE_CENTRAL,
+	ROLE_PERIPHERAL,
+	ROLE_QUIT,
+};
+
+NET_BUF_POOL_FIXED_DEFINE(tx_pool, TX_SDU_COUNT, BT_L2CAP_SDU_BUF_SIZE(SDU_LEN),
+			  CONFIG_BT_CONN_TX_USER_DATA_SIZE, NULL);
+NET_BUF_POOL_FIXED_DEFINE(rx_pool, RX_SDU_COUNT, BT_L2CAP_SDU_BUF_SIZE(SDU_LEN), 8, NULL);
+
+static struct bt_l2cap_le_chan le_chan;
+static struct bt_conn *default_conn;
+static uint8_t sdu_data[SDU_LEN];
+static size_t sdu_len;
+static atomic_t byte_count;
+
+static K_SEM_DEFINE(sem_connected, 0, 1);
+static K_SEM_DEFINE(sem_chan_connected, 0, 1);
+static K_SEM_DEFINE(sem_tx, TX_SDU_COUNT, TX_SDU_COUNT);
+
+static const struct bt_data ad[] = {
+	BT_DATA_BYTES(BT_DATA_FLAGS, (BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR)),
+	BT_DATA(BT_DATA_NAME_COMPLETE, CONFIG_BT_DEVICE_NAME, sizeof(CONFIG_BT_DEVICE_NAME) - 1),
+};
+
+static void report_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(report_work, report_work_handler);
+
+static void report_work_handler(struct k_work *work)
+{
+	const uint32_t bytes = (uint32_t)atomic_clear(&byte_count);
+
+	printk("%u bytes/s (%u kbps)\n", bytes, bytes * 8U / 1000U);
+
+	(void)k_work_reschedule(&report_work, REPORT_INTERVAL);
+}
+
+static void chan_connected(struct bt_l2cap_chan *chan)
+{
+	printk("Channel connected, TX MTU %u MPS %u\n", le_chan.tx.mtu, le_chan.tx.mps);
+
+	sdu_len = MIN(sizeof(sdu_data), le_chan.tx.mtu);
+
+	k_sem_give(&sem_chan_connected);
+	(void)k_work_reschedule(&report_work, REPORT_INTERVAL);
+}
+
+static void chan_disconnected(struct bt_l2cap_chan *chan)
+{
+	printk("Channel disconnected\n");
+
+	(void)k_work_cancel_delayable(&report_work);
+}
+
+static struct net_buf *chan_alloc_buf(struct bt_l2cap_chan *chan)
+{
+	return net_buf_alloc(&rx_pool, K_NO_WAIT);
+}
+
+static int chan_recv(struct bt_l2cap_chan *chan, struct net_buf *buf)
+{
+	(void)atomic_add(&byte_count, net_buf_frags_len(buf));
+
+	return 0;
+}
+
+static void chan_sent(struct bt_l2cap_chan *chan)
+{
+	(void)atomic_add(&byte_count, sdu_len);
+
+	k_sem_give(&sem_tx);
+}
+
+static const struct bt_l2cap_chan_ops chan_ops = {
+	.connected = chan_connected,
+	.disconnected = chan_disconnected,
+	.alloc_buf = chan_alloc_buf,
+	.recv = chan_recv,
+	.sent = chan_sent,
+};
+
+static void chan_init(void)
+{
+	memset(&le_chan, 0, sizeof(le_chan));
+	le_chan.chan.ops = &chan_ops;
+	/* Received SDUs are reassembled in rx_pool */
+	le_chan.rx.mtu = SDU_LEN;
+}
+
+static int server_accept(struct bt_conn *conn, struct bt_l2cap_server *server,
+			 struct bt_l2cap_chan **chan)
+{
+	chan_init();
+	*chan = &le_chan.chan;
+
+	return 0;
+}
+
+static struct bt_l2cap_server server = {
+	.psm = BENCHMARK_PSM,
+	.accept = server_accept,
+};
+
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+	if (err != 0) {
+		printk("Connection failed (err 0x%02x)\n", err);
+		return;
+	}
+
+	printk("Connected\n");
+
+	if (default_conn == NULL) {
+		default_conn = bt_conn_ref(conn);
+	}
+
+	k_sem_give(&sem_connected);
+}
+
+static void disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	printk("Disconnected (reason 0x%02x)\n", reason);
+
+	if (conn == default_conn) {
+		bt_conn_unref(default_conn);
+		default_conn = NULL;
+	}
+}
+
+BT_CONN_CB_DEFINE(conn_callbacks) = {
+	.connected = connected,
+	.disconnected = disconnected,
+};
+
+static bool ad_name_found(struct bt_data *data, void *user_data)
+{
+	bool *found = user_data;
+
+	if (data->type == BT_DATA_NAME_COMPLETE &&
+	    data->data_len == sizeof(CONFIG_BT_DEVICE_NAME) - 1 &&
+	    memcmp(data->data, CONFIG_BT_DEVICE_NAME, data->data_len) == 0) {
+		*found = true;
+		return false;
+	}
+
+	return true;
+}
+
+static void device_found(const bt_addr_le_t *addr, int8_t rssi, uint8_t type,
+			 struct net_buf_simple *ad_buf)
+{
+	struct bt_conn *conn;
+	bool found = false;
+	int err;
+
+	if (type != BT_GAP_ADV_TYPE_ADV_IND || default_conn != NULL) {
+		return;
+	}
+
+	bt_data_parse(ad_buf, ad_name_found, &found);
+	if (!found) {
+		return;
+	}
+
+	err = bt_le_scan_stop();
+	if (err != 0) {
+		printk("Failed to stop scanning (err %d)\n", err);
+		return;
+	}
+
+	err = bt_conn_le_create(addr, BT_CONN_LE_CREATE_CONN, BT_LE_CONN_PARAM_DEFAULT, &conn);
+	if (err != 0) {
+		printk("Failed to connect (err %d)\n", err);
+		return;
+	}
+
+	bt_conn_unref(conn);
+}
+
+static enum benchmark_role device_role_select(void)
+{
+	char role_char;
+
+	while (true) {
+		printk("Choose device role - type c (central role, sending) or p (peripheral role, "
+		       "receiving), or q to quit: ");
+
+		role_char = tolower(console_getchar());
+
+		printk("%c\n", role_char);
+
+		if (role_char == 'c') {
+			return ROLE_CENTRAL;
+		} else if (role_char == 'p') {
+			return ROLE_PERIPHERAL;
+		} else if (role_char == 'q') {
+			return ROLE_QUIT;
+		} else if (role_char == '\n' || role_char == '\r') {
+			continue;
+		}
+
+		printk("Invalid role: %c\n", role_char);
+	}
+}
+
+static void link_update(struct bt_conn *conn)
+{
+	int err;
+
+	err = bt_conn_le_data_len_update(conn, BT_LE_DATA_LEN_PARAM_MAX);
+	if (err != 0) {
+		printk("Failed to update data length (err %d)\n", err);
+	}
+
+	err = bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M);
+	if (err != 0) {
+		printk("Failed to update PHY (err %d)\n", err);
+	}
+}
+
+static int run_central(void)
+{
+	int err;
+
+	err = bt_le_scan_start(BT_LE_SCAN_PASSIVE, device_found);
+	if (err != 0) {
+		printk("Failed to start scanning (err %d)\n", err);
+		return err;
+	}
+
+	printk("Scanning for \"%s\"\n", CONFIG_BT_DEVICE_NAME);
+	k_sem_take(&sem_connected, K_FOREVER);
+
+	link_update(default_conn);
+
+	chan_init();
+	err = bt_l2cap_chan_connect(default_conn, &le_chan.chan, BENCHMARK_PSM);
+	if (err != 0) {
+		printk("Failed to connect channel (err %d)\n", err);
+		return err;
+	}
+
+	k_sem_take(&sem_chan_connected, K_FOREVER);
+
+	for (size_t i = 0U; i < ARRAY_SIZE(sdu_data); i++) {
+		sdu_data[i] = (uint8_t)i;
+	}
+
+	while (default_conn != NULL) {
+		struct net_buf *buf;
+
+		k_sem_take(&sem_tx, K_FOREVER);
+
+		buf = net_buf_alloc(&tx_pool, K_FOREVER);
+		net_buf_reserve(buf, BT_L2CAP_SDU_CHAN_SEND_RESERVE);
+		net_buf_add_mem(buf, sdu_data, sdu_len);
+
+		err = bt_l2cap_chan_send(&le_chan.chan, buf);
+		if (err < 0) {
+			printk("Failed to send SDU (err %d)\n", err);
+			net_buf_unref(buf);
+			k_sem_give(&sem_tx);
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static int run_peripheral(void)
+{
+	int err;
+
+	err = bt_l2cap_server_register(&server);
+	if (err != 0) {
+		printk("Failed to register server (err %d)\n", err);
+		return err;
+	}
+
+	err = bt_le_adv_start(BT_LE_ADV_CONN_FAST_1, ad, ARRAY_SIZE(ad), NULL, 0);
+	if (err != 0) {
+		printk("Failed to start advertising (err %d)\n", err);
+		return err;
+	}
+
+	printk("Advertising as \"%s\"\n", CONFIG_BT_DEVICE_NAME);
+	k_sem_take(&sem_connected, K_FOREVER);
+
+	link_update(default_conn);
+
+	return 0;
+}
+
+int main(void)
+{
+	enum benchmark_role role;
+	int err;
+
+	err = console_init();
+	if (err != 0) {
+		printk("Failed to initialize the console (err %d)\n", err);
+		return 0;
+	}
+
+	err = bt_enable(NULL);
+	if (err != 0) {
+		printk("Bluetooth init failed (err %d)\n", err);
+		return 0;
+	}
+
+	printk("L2CAP benchmark with CONFIG_BT_CONN_TX_BATCH=%d\n", CONFIG_BT_CONN_TX_BATCH);
+
+	role = device_role_select();
+	err = 0;
+	if (role == ROLE_CENTRAL) {
+		err = run_central();
+	} else if (role == ROLE_PERIPHERAL) {
+		err = run_peripheral();
+	}
+
+	if (err != 0) {
+		printk("Benchmark failed (err %d)\n", err);
+	}
+
+	return 0;
+}
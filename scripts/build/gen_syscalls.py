@@ -249,6 +249,17 @@ def wrapper_defs(func_name, func_type, args, fn, userspace_only):
     wrap += ("\t" + "uint64_t ret64;\n") if ret64 else ""
     if not userspace_only:
         wrap += "\t" + "if (z_syscall_trap()) {\n"
+        # A header may provide a user mode implementation not trapping
+        # into the kernel, e.g. reading kernel data mapped read-only.
+        fast_name = "z_user_fast_" + func_name
+        fast_call = "%s(%s)" % (fast_name, ", ".join([argrec[1] for argrec in args]))
+        wrap += "#ifdef %s\n" % fast_name
+        if func_type == "void":
+            wrap += "\t\t%s;\n" % fast_call
+            wrap += "\t\treturn;\n"
+        else:
+            wrap += "\t\treturn %s;\n" % fast_call
+        wrap += "#endif\n"
 
     valist_args = []
     for argnum, (argtype, argname) in enumerate(args):
@@ -217,26 +217,52 @@ class ZephyrElfExptabPreparator():
         return 0
 
     def _prepare_exptab_for_str_linking(self):
-        #TODO: sort the export table by symbol
-        #      name to allow binary search too
-        #
-        # Plan of action:
-        #   1) Locate in which section the names are located
-        #   2) Load the export table and resolve names
-        #   3) Sort the exports by name
-        #       WARN: THIS MUST USE THE SAME SORTING RULES
-        #       AS LLEXT CODE OR DICHOTOMIC SEARCH WILL BREAK
-        #       Using a custom sorting function might be required.
-        #   4) Write back the updated export table
-        #
-        # N.B.: reusing part of the code in _prepare_elf_for_slid_linking
-        # might be possible and desireable.
-        #
-        # As of writing, this function will never be called as this script
-        # is only called if CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID is enabled,
-        # which makes _prepare_exptab_for_slid_linking be called instead.
-        #
-        self.log.warn(f"_prepare_exptab_for_str_linking: do nothing")
+        """
+        IMPLEMENTATION NOTES:
+          Symbol names are regular NUL-terminated strings placed in
+          the image by the linker, so pointers in the export table
+          are their addresses: they are converted to file offsets
+          using the section containing them.
+
+          The export table is sorted by name in ASCENDING order of
+          the raw bytes, which matches the ordering of strcmp().
+        """
+        def read_symbol_name(name_ptr):
+            for section in self.elf.iter_sections():
+                start = section['sh_addr']
+                if (section['sh_type'] != 'SHT_PROGBITS' or
+                        not start <= name_ptr < start + section['sh_size']):
+                    continue
+
+                raw_name = b''
+                self.elf_fd.seek(section['sh_offset'] + name_ptr - start)
+
+                c = self.elf_fd.read(1)
+                while c not in (b'\0', b''):
+                    raw_name += c
+                    c = self.elf_fd.read(1)
+
+                return raw_name
+
+            return None
+
+        #1) Load the export table
+        exports_list = []
+        for (name_ptr, export_address) in self.exptab_manipulator:
+            export_name = read_symbol_name(name_ptr)
+            if export_name is None:
+                self.log.error(f"export name at 0x{name_ptr:X} not found in ELF")
+                return 1
+
+            exports_list.append((export_name, name_ptr, export_address))
+
+        #2) Sort the export table (order specified above)
+        exports_list.sort(key=lambda export: export[0])
+
+        #3) Write the updated export table to ELF
+        for i, (_, name_ptr, export_address) in enumerate(exports_list):
+            self.exptab_manipulator[i] = (name_ptr, export_address)
+
         return 0
 
     def _set_prep_done_shdr_flag(self):
@@ -24,13 +24,61 @@ LOG_THREADS_META_HDR_SIZE = struct.calcsize(LOG_THREADS_META_HDR_STRUCT)
 
 COREDUMP_MEM_HDR_ID = b'M'
 COREDUMP_MEM_HDR_VER = 1
+COREDUMP_MEM_HDR_VER_LZ4 = 2
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
+LOG_MEM_CHUNK_HDR_STRUCT = "<HH"
+LOG_MEM_CHUNK_HDR_SIZE = struct.calcsize(LOG_MEM_CHUNK_HDR_STRUCT)
 
 
 logger = logging.getLogger("parser")
 
 
+def lz4_block_decode(src):
+    """
+    Decode a block in the LZ4 block format.
+    """
+    out = bytearray()
+    i = 0
+
+    while i < len(src):
+        token = src[i]
+        i += 1
+
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                lit_len += src[i]
+                i += 1
+                if src[i - 1] != 255:
+                    break
+
+        out += src[i:i + lit_len]
+        i += lit_len
+
+        if i >= len(src):
+            # Last sequence, literals only
+            break
+
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+
+        match_len = token & 0xF
+        if match_len == 15:
+            while True:
+                match_len += src[i]
+                i += 1
+                if src[i - 1] != 255:
+                    break
+        match_len += 4
+
+        # The match may overlap the bytes it produces
+        for _ in range(match_len):
+            out.append(out[-offset])
+
+    return bytes(out)
+
+
 def reason_string(reason):
     # Keep sync with "enum k_fatal_error_reason"
     ret = "(Unknown)"
@@ -99,11 +147,33 @@ class CoredumpLogFile:
 
         return True
 
+    def read_compressed_memory(self, size):
+        data = bytearray()
+
+        while len(data) < size:
+            hdr = self.fd.read(LOG_MEM_CHUNK_HDR_SIZE)
+            if len(hdr) < LOG_MEM_CHUNK_HDR_SIZE:
+                break
+
+            raw_len, comp_len = struct.unpack(LOG_MEM_CHUNK_HDR_STRUCT, hdr)
+
+            chunk = self.fd.read(comp_len)
+            if len(chunk) < comp_len:
+                break
+
+            if comp_len == raw_len:
+                # Stored as is
+                data += chunk
+            else:
+                data += lz4_block_decode(chunk)
+
+        return bytes(data)
+
     def parse_memory_section(self):
         hdr = self.fd.read(LOG_MEM_HDR_SIZE)
         _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
 
-        if hdr_ver != COREDUMP_MEM_HDR_VER:
+        if hdr_ver not in (COREDUMP_MEM_HDR_VER, COREDUMP_MEM_HDR_VER_LZ4):
             logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}!")
             return False
 
@@ -121,7 +191,17 @@ class CoredumpLogFile:
 
         size = eaddr - saddr
 
-        data = self.fd.read(size)
+        if hdr_ver == COREDUMP_MEM_HDR_VER_LZ4:
+            data = self.read_compressed_memory(size)
+        else:
+            data = self.fd.read(size)
+
+        if len(data) < size:
+            # The backend ran out of space, keep what was stored
+            logger.warning("Memory: 0x%x to 0x%x truncated to %d bytes" %
+                           (saddr, eaddr, len(data)))
+            size = len(data)
+            eaddr = saddr + size
 
         mem = {"start": saddr, "end": eaddr, "data": data}
         self.memory_regions.append(mem)
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Audio Inventions Ltd
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Boot profile symbolizer
+
+Resolves the addresses of SYS_INIT() functions printed by the
+"kernel boot_profile" shell command to symbol names, using the ELF file
+of the image. Device entries are printed with their names and are left
+unchanged.
+
+Usage:
+    ./scripts/profiling/boot_profile.py <file with shell output> <ELF file>
+"""
+
+import argparse
+import bisect
+import re
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+ADDR_RE = re.compile(r"(0x[0-9a-fA-F]+)\s*$")
+
+
+def load_functions(elf_path):
+    with open(elf_path, "rb") as f:
+        elf = ELFFile(f)
+        symtab = elf.get_section_by_name(".symtab")
+        if symtab is None:
+            sys.exit(f"{elf_path}: no symbol table")
+
+        funcs = sorted(
+            (sym["st_value"] & ~1, sym["st_size"], sym.name)
+            for sym in symtab.iter_symbols()
+            if sym["st_info"]["type"] == "STT_FUNC" and sym["st_value"] != 0
+        )
+
+    return funcs
+
+
+def symbolize(addr, funcs, starts):
+    # Thumb function pointers have bit 0 set
+    addr &= ~1
+    idx = bisect.bisect_right(starts, addr) - 1
+    if idx < 0:
+        return None
+
+    start, size, name = funcs[idx]
+    if addr >= start + max(size, 1):
+        return None
+
+    return name if addr == start else f"{name}+{addr - start:#x}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("profile", help="output of the kernel boot_profile shell command")
+    parser.add_argument("elf", help="ELF file of the profiled image")
+    args = parser.parse_args()
+
+    funcs = load_functions(args.elf)
+    starts = [f[0] for f in funcs]
+
+    with open(args.profile, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\r\n")
+            match = ADDR_RE.search(line)
+            if match:
+                name = symbolize(int(match.group(1), 16), funcs, starts)
+                if name is not None:
+                    line = line[:match.start(1)] + name
+            print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/audio/asrc.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+#define ASRC_PHASE_BITS 5
+#define ASRC_PHASES     BIT(ASRC_PHASE_BITS)
+#define ASRC_POS_BITS   24
+#define ASRC_SUB_SHIFT  (ASRC_POS_BITS - ASRC_PHASE_BITS - 15)
+
+BUILD_ASSERT(AUDIO_ASRC_RATIO_ONE == BIT(ASRC_POS_BITS));
+
+/*
+ * Kaiser windowed sinc (beta 5, cutoff 0.9 of Nyquist) fractional delay
+ * filters, one row per phase plus a last row for interpolating past the
+ * final phase. Each row is normalized to unity DC gain in Q15.
+ */
+static const int16_t asrc_coeffs[ASRC_PHASES + 1][AUDIO_ASRC_TAPS] __aligned(4) = {
+	{   644,  -1683,   2778,  29288,   2778,  -1683,    644,      0},
+	{   574,  -1425,   1940,  29338,   3680,  -1955,    718,   -103},
+	{   503,  -1168,   1142,  29222,   4616,  -2222,    789,   -116},
+	{   433,   -918,    394,  29023,   5593,  -2489,    858,   -128},
+	{   366,   -677,   -303,  28741,   6607,  -2751,    925,   -140},
+	{   301,   -446,   -947,  28378,   7652,  -3007,    987,   -152},
+	{   238,   -227,  -1537,  27936,   8727,  -3252,   1045,   -162},
+	{   180,    -22,  -2072,  27416,   9824,  -3485,   1097,   -172},
+	{   125,    169,  -2551,  26823,  10940,  -3701,   1142,   -180},
+	{    75,    345,  -2976,  26159,  12070,  -3899,   1179,   -187},
+	{    28,    506,  -3346,  25428,  13208,  -4074,   1207,   -191},
+	{   -13,    650,  -3662,  24634,  14349,  -4223,   1225,   -193},
+	{   -51,    778,  -3924,  23782,  15486,  -4344,   1231,   -192},
+	{   -83,    889,  -4136,  22877,  16615,  -4433,   1225,   -187},
+	{  -111,    984,  -4297,  21922,  17729,  -4487,   1206,   -180},
+	{  -135,   1063,  -4411,  20925,  18823,  -4503,   1173,   -169},
+	{  -154,   1126,  -4478,  19890,  19890,  -4478,   1126,   -154},
+	{  -169,   1173,  -4503,  18823,  20925,  -4411,   1063,   -135},
+	{  -180,   1206,  -4487,  17729,  21922,  -4297,    984,   -111},
+	{  -187,   1225,  -4433,  16615,  22877,  -4136,    889,    -83},
+	{  -192,   1231,  -4344,  15486,  23782,  -3924,    778,    -51},
+	{  -193,   1225,  -4223,  14349,  24634,  -3662,    650,    -13},
+	{  -191,   1207,  -4074,  13208,  25428,  -3346,    506,     28},
+	{  -187,   1179,  -3899,  12070,  26159,  -2976,    345,     75},
+	{  -180,   1142,  -3701,  10940,  26823,  -2551,    169,    125},
+	{  -172,   1097,  -3485,   9824,  27416,  -2072,    -22,    180},
+	{  -162,   1045,  -3252,   8727,  27936,  -1537,   -227,    238},
+	{  -152,    987,  -3007,   7652,  28378,   -947,   -446,    301},
+	{  -140,    925,  -2751,   6607,  28741,   -303,   -677,    366},
+	{  -128,    858,  -2489,   5593,  29023,    394,   -918,    433},
+	{  -116,    789,  -2222,   4616,  29222,   1142,  -1168,    503},
+	{  -103,    718,  -1955,   3680,  29338,   1940,  -1425,    574},
+	{     0,    644,  -1683,   2778,  29288,   2778,  -1683,    644},
+};
+
+static inline int32_t asrc_dot(const int16_t *x, const int16_t *h)
+{
+	int32_t acc = 0;
+
+#if defined(__ARM_FEATURE_DSP)
+	for (int k = 0; k < AUDIO_ASRC_TAPS; k += 2) {
+		uint32_t xv;
+		uint32_t hv;
+
+		/* The delay line window is only 16-bit aligned */
+		memcpy(&xv, &x[k], sizeof(xv));
+		memcpy(&hv, &h[k], sizeof(hv));
+		acc = __smlad(xv, hv, acc);
+	}
+#else
+	for (int k = 0; k < AUDIO_ASRC_TAPS; k++) {
+		acc += (int32_t)x[k] * h[k];
+	}
+#endif
+
+	return acc;
+}
+
+static int16_t asrc_interpolate(const int16_t *x, uint32_t pos)
+{
+	uint32_t phase = pos >> (ASRC_POS_BITS - ASRC_PHASE_BITS);
+	int32_t sub = (pos >> ASRC_SUB_SHIFT) & BIT_MASK(15);
+	int32_t acc0 = asrc_dot(x, asrc_coeffs[phase]);
+	int32_t acc1 = asrc_dot(x, asrc_coeffs[phase + 1]);
+	int32_t acc = acc0 + (int32_t)(((int64_t)(acc1 - acc0) * sub) >> 15);
+
+	return (int16_t)CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+}
+
+int audio_asrc_init(struct audio_asrc *asrc, uint8_t channels)
+{
+	if (channels == 0 || channels > CONFIG_AUDIO_PIPELINE_ASRC_MAX_CHANNELS) {
+		return -EINVAL;
+	}
+
+	memset(asrc, 0, sizeof(*asrc));
+	asrc->channels = channels;
+	asrc->step = AUDIO_ASRC_RATIO_ONE;
+
+	return 0;
+}
+
+void audio_asrc_set_ratio(struct audio_asrc *asrc, uint32_t ratio)
+{
+	__ASSERT(ratio > 0, "invalid ratio");
+
+	asrc->step = ratio;
+}
+
+uint32_t audio_asrc_get_ratio(const struct audio_asrc *asrc)
+{
+	return asrc->step;
+}
+
+void audio_asrc_drift_update(struct audio_asrc *asrc, uint32_t in_frames, uint32_t out_frames)
+{
+	uint32_t measured;
+
+	asrc->in_frames += in_frames;
+	asrc->out_frames += out_frames;
+
+	if (asrc->out_frames < CONFIG_AUDIO_PIPELINE_ASRC_DRIFT_WINDOW) {
+		return;
+	}
+
+	measured = ((uint64_t)asrc->in_frames << ASRC_POS_BITS) / asrc->out_frames;
+
+	/* First order low pass, so that SOF jitter does not modulate the ratio */
+	asrc->step += ((int32_t)(measured - asrc->step)) >> CONFIG_AUDIO_PIPELINE_ASRC_DRIFT_SHIFT;
+
+	asrc->in_frames = 0;
+	asrc->out_frames = 0;
+}
+
+int audio_asrc_process(struct audio_asrc *asrc, const int16_t *in, size_t in_frames,
+		       int16_t *out, size_t out_frames)
+{
+	uint64_t span = (uint64_t)in_frames << ASRC_POS_BITS;
+	size_t produced = 0;
+
+	if (span > asrc->pos &&
+	    DIV_ROUND_UP(span - asrc->pos, asrc->step) > out_frames) {
+		return -ENOMEM;
+	}
+
+	for (size_t f = 0; f < in_frames; f++) {
+		for (uint8_t ch = 0; ch < asrc->channels; ch++) {
+			int16_t *line = asrc->line[ch];
+
+			line[asrc->idx] = *in;
+			line[asrc->idx + AUDIO_ASRC_TAPS] = *in;
+			in++;
+		}
+
+		asrc->idx = (asrc->idx + 1) % AUDIO_ASRC_TAPS;
+
+		while (asrc->pos < AUDIO_ASRC_RATIO_ONE) {
+			for (uint8_t ch = 0; ch < asrc->channels; ch++) {
+				*out++ = asrc_interpolate(&asrc->line[ch][asrc->idx], asrc->pos);
+			}
+
+			produced++;
+			asrc->pos += asrc->step;
+		}
+
+		asrc->pos -= AUDIO_ASRC_RATIO_ONE;
+	}
+
+	return produced;
+}
+
+static int asrc_node_process(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	const struct audio_pipeline_asrc_config *config = node->config;
+	struct audio_asrc *asrc = node->data;
+	size_t frame_size = asrc->channels * sizeof(int16_t);
+	struct audio_block out = {
+		.slab = config->slab,
+	};
+	int ret;
+
+	ret = k_mem_slab_alloc(config->slab, &out.data, K_NO_WAIT);
+	if (ret < 0) {
+		return -ENOMEM;
+	}
+
+	ret = audio_asrc_process(asrc, block->data, block->size / frame_size, out.data,
+				 config->slab->info.block_size / frame_size);
+	if (ret < 0) {
+		audio_block_free(&out);
+		return ret;
+	}
+
+	out.size = ret * frame_size;
+
+	audio_block_free(block);
+	*block = out;
+
+	return 0;
+}
+
+const struct audio_pipeline_node_api audio_pipeline_asrc_api = {
+	.process = asrc_node_process,
+};
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/audio/mixer.h>
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/sys/util.h>
+
+#define CHUNK_SAMPLES CONFIG_AUDIO_PIPELINE_MIXER_CHUNK_SAMPLES
+
+static size_t mixer_frame_size(const struct audio_mixer *mixer, enum audio_mixer_format format)
+{
+	return mixer->channels * audio_mixer_sample_size(format);
+}
+
+static void mixer_gain_update(struct audio_mixer_input *input, size_t chunk_frames)
+{
+	int32_t req = atomic_get(&input->gain_req);
+
+	if (req != input->target) {
+		uint32_t chunks = (uint32_t)atomic_get(&input->ramp_req) / chunk_frames;
+
+		input->target = req;
+		input->ramp_chunks = chunks;
+		if (chunks == 0) {
+			input->gain = req;
+		} else {
+			input->step = ((int64_t)req - input->gain) / chunks;
+		}
+	}
+
+	if (input->ramp_chunks > 0) {
+		/* Land exactly on the target, whatever the rounding of the step */
+		input->gain = --input->ramp_chunks == 0 ? input->target : input->gain + input->step;
+	}
+}
+
+static void mixer_accumulate(struct audio_mixer *mixer, struct audio_mixer_input *input,
+			     size_t frames, size_t chunk_frames)
+{
+	const size_t frame_size = mixer_frame_size(mixer, input->format);
+	const size_t samples = frames * mixer->channels;
+	uint8_t *raw = (uint8_t *)mixer->raw;
+	const q31_t *src = (const q31_t *)mixer->raw;
+	uint32_t avail;
+	uint32_t got;
+
+	mixer_gain_update(input, chunk_frames);
+
+	/* Whole frames only, the producer may be halfway through one */
+	avail = ring_buf_size_get(input->ring);
+	avail = MIN(avail - avail % frame_size, frames * frame_size);
+	got = avail > 0 ? ring_buf_get(input->ring, raw, avail) : 0;
+
+	if (got < frames * frame_size) {
+		if (got > 0 || input->active) {
+			input->underruns++;
+		}
+
+		input->active = false;
+
+		if (got == 0) {
+			return;
+		}
+
+		/* Zero is silence in every format */
+		memset(&raw[got], 0, frames * frame_size - got);
+	} else {
+		input->active = true;
+	}
+
+	if (input->gain == 0 && input->ramp_chunks == 0) {
+		return;
+	}
+
+	switch (input->format) {
+	case AUDIO_MIXER_FMT_S16:
+		zdsp_q15_to_q31((const q15_t *)raw, mixer->tmp, samples);
+		src = mixer->tmp;
+		break;
+	case AUDIO_MIXER_FMT_S24:
+		zdsp_s24_to_q31(raw, mixer->tmp, samples);
+		src = mixer->tmp;
+		break;
+	default:
+		break;
+	}
+
+	if (input->gain != AUDIO_MIXER_GAIN_UNITY) {
+		zdsp_scale_q31(src, input->gain, 0, mixer->tmp, samples);
+		src = mixer->tmp;
+	}
+
+	/* Saturating add, a loud sum clips instead of wrapping around */
+	zdsp_add_q31(mixer->acc, src, mixer->acc, samples);
+}
+
+static void mixer_store(struct audio_mixer *mixer, uint8_t *dst, size_t samples)
+{
+	switch (mixer->format) {
+	case AUDIO_MIXER_FMT_S16:
+		zdsp_q31_to_q15(mixer->acc, (q15_t *)dst, samples);
+		break;
+	case AUDIO_MIXER_FMT_S24:
+		zdsp_q31_to_s24(mixer->acc, dst, samples);
+		break;
+	default:
+		memcpy(dst, mixer->acc, samples * sizeof(q31_t));
+		break;
+	}
+}
+
+void audio_mixer_input_init(struct audio_mixer_input *input, struct ring_buf *ring,
+			    enum audio_mixer_format format)
+{
+	memset(input, 0, sizeof(*input));
+	input->ring = ring;
+	input->format = format;
+	input->gain = AUDIO_MIXER_GAIN_UNITY;
+	input->target = AUDIO_MIXER_GAIN_UNITY;
+	atomic_set(&input->gain_req, AUDIO_MIXER_GAIN_UNITY);
+}
+
+int audio_mixer_init(struct audio_mixer *mixer, struct audio_mixer_input *inputs,
+		     uint8_t num_inputs, uint8_t channels, enum audio_mixer_format format)
+{
+	if (channels == 0 || channels > CHUNK_SAMPLES) {
+		return -EINVAL;
+	}
+
+	mixer->inputs = inputs;
+	mixer->num_inputs = num_inputs;
+	mixer->channels = channels;
+	mixer->format = format;
+
+	return 0;
+}
+
+size_t audio_mixer_input_write(const struct audio_mixer *mixer, struct audio_mixer_input *input,
+			       const void *data, size_t size)
+{
+	const size_t frame_size = mixer_frame_size(mixer, input->format);
+	size_t len = MIN(size, ring_buf_space_get(input->ring));
+
+	return ring_buf_put(input->ring, data, len - len % frame_size);
+}
+
+void audio_mixer_set_gain(struct audio_mixer_input *input, int32_t gain, uint32_t ramp_frames)
+{
+	__ASSERT(gain >= 0, "invalid gain");
+
+	/* The ramp first, the mixer starts a ramp when it sees a new gain */
+	atomic_set(&input->ramp_req, ramp_frames);
+	atomic_set(&input->gain_req, gain);
+}
+
+void audio_mixer_process(struct audio_mixer *mixer, void *out, size_t frames)
+{
+	const size_t chunk_frames = CHUNK_SAMPLES / mixer->channels;
+	const size_t out_frame_size = mixer_frame_size(mixer, mixer->format);
+	uint8_t *dst = out;
+
+	while (frames > 0) {
+		size_t n = MIN(frames, chunk_frames);
+		size_t samples = n * mixer->channels;
+
+		memset(mixer->acc, 0, samples * sizeof(q31_t));
+
+		for (uint8_t i = 0; i < mixer->num_inputs; i++) {
+			mixer_accumulate(mixer, &mixer->inputs[i], n, chunk_frames);
+		}
+
+		mixer_store(mixer, dst, samples);
+
+		dst += n * out_frame_size;
+		frames -= n;
+	}
+}
+
+static int mixer_node_pull(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	const struct audio_pipeline_mixer_config *config = node->config;
+	struct audio_mixer *mixer = node->data;
+	const size_t frame_size = mixer_frame_size(mixer, mixer->format);
+	size_t frames = config->slab->info.block_size / frame_size;
+	int ret;
+
+	ret = k_mem_slab_alloc(config->slab, &block->data, config->timeout);
+	if (ret < 0) {
+		return ret;
+	}
+
+	audio_mixer_process(mixer, block->data, frames);
+
+	block->size = frames * frame_size;
+	block->slab = config->slab;
+
+	return 0;
+}
+
+const struct audio_pipeline_node_api audio_pipeline_mixer_api = {
+	.pull = mixer_node_pull,
+};
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/audio/pdm_decim.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * The CIC filter decimating by R = 8 * M is split as
+ *
+ *   ((1 - z^-R) / (1 - z^-1))^N = box8(z)^N * boxM(z^8)^N
+ *
+ * The first factor spans N bytes of the bit stream and is evaluated once per
+ * byte with one table lookup per byte, processing 8 bits in parallel. By the
+ * noble identity, the second factor runs as a regular CIC filter at the byte
+ * rate, with integrators updated once per byte and combs once per output.
+ */
+#define CIC_ORDER AUDIO_PDM_DECIM_CIC_ORDER
+#define HB_TAPS   AUDIO_PDM_DECIM_HB_TAPS
+
+/* Gain of the first CIC factor is 8^N */
+#define CIC_BYTE_GAIN_BITS (3 * CIC_ORDER)
+
+BUILD_ASSERT(CIC_ORDER == 4, "lookup table sized for a fourth order CIC");
+
+static int16_t cic_lut[CIC_ORDER][256];
+static bool cic_lut_ready;
+
+/*
+ * Half band low pass, Kaiser window (beta 7), unity DC gain in Q15. Only the
+ * odd taps around the center are non-zero, listed from the center outwards.
+ */
+static const int16_t hb_coeffs[(HB_TAPS + 1) / 4] = {
+	10281, -3050, 1441, -708, 321, -124, 35, -4,
+};
+
+#define HB_CENTER_COEFF 16384
+
+static void cic_lut_build(void)
+{
+	/* Impulse response of box8^N, length 8 * N - (N - 1) */
+	int16_t g[8 * CIC_ORDER] = {0};
+	int len = 8;
+
+	for (int k = 0; k < 8; k++) {
+		g[k] = 1;
+	}
+
+	for (int order = 1; order < CIC_ORDER; order++) {
+		int16_t prev[8 * CIC_ORDER];
+
+		memcpy(prev, g, sizeof(prev));
+		memset(g, 0, sizeof(g));
+		for (int k = 0; k < len; k++) {
+			for (int j = 0; j < 8; j++) {
+				g[k + j] += prev[k];
+			}
+		}
+		len += 7;
+	}
+
+	/* Byte j back in time, bit i from the MSB, weighs g[8 * j + 7 - i] */
+	for (int j = 0; j < CIC_ORDER; j++) {
+		for (int v = 0; v < 256; v++) {
+			int32_t sum = 0;
+
+			for (int i = 0; i < 8; i++) {
+				int16_t w = g[8 * j + 7 - i];
+
+				sum += (v & BIT(7 - i)) ? w : -w;
+			}
+
+			cic_lut[j][v] = sum;
+		}
+	}
+
+	cic_lut_ready = true;
+}
+
+static int16_t hb_filter(const int16_t *w)
+{
+	const int c = HB_TAPS / 2;
+	int32_t acc = (int32_t)w[c] * HB_CENTER_COEFF;
+
+	for (int k = 0; k < ARRAY_SIZE(hb_coeffs); k++) {
+		int d = 2 * k + 1;
+
+		acc += ((int32_t)w[c - d] + w[c + d]) * hb_coeffs[k];
+	}
+
+	return (int16_t)CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+}
+
+int audio_pdm_decim_init(struct audio_pdm_decim *decim, uint8_t channels, uint16_t decimation)
+{
+	uint8_t cic_bytes;
+
+	if (channels == 0 || channels > CONFIG_AUDIO_PDM_DECIM_MAX_CHANNELS) {
+		return -EINVAL;
+	}
+
+	switch (decimation) {
+	case 32:
+	case 64:
+	case 128:
+		/* The half band filter decimates by 2, a byte holds 8 bits */
+		cic_bytes = decimation / 16;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (!cic_lut_ready) {
+		cic_lut_build();
+	}
+
+	memset(decim, 0, sizeof(*decim));
+	decim->channels = channels;
+	decim->cic_bytes = cic_bytes;
+	/* CIC gain is 8^N * M^N, scaled down to Q15 */
+	decim->shift = CIC_BYTE_GAIN_BITS + CIC_ORDER * LOG2(cic_bytes) - 15;
+
+	return 0;
+}
+
+void audio_pdm_decim_reset(struct audio_pdm_decim *decim)
+{
+	memset(decim->chan, 0, sizeof(decim->chan));
+	decim->cic_count = 0;
+	decim->hb_idx = 0;
+	decim->hb_phase = 0;
+}
+
+int audio_pdm_decim_process(struct audio_pdm_decim *decim, const uint8_t *pdm, size_t len,
+			    int16_t *pcm, size_t pcm_frames)
+{
+	const uint8_t channels = decim->channels;
+	size_t byte_frames;
+	size_t cic_out;
+	size_t out = 0;
+
+	if (len % channels != 0) {
+		return -EINVAL;
+	}
+
+	byte_frames = len / channels;
+	cic_out = (decim->cic_count + byte_frames) / decim->cic_bytes;
+	if ((decim->hb_phase + cic_out) / 2 > pcm_frames) {
+		return -ENOMEM;
+	}
+
+	for (size_t n = 0; n < byte_frames; n++, pdm += channels) {
+		for (uint8_t c = 0; c < channels; c++) {
+			typeof(decim->chan[0]) *ch = &decim->chan[c];
+			uint8_t b = pdm[c];
+			int32_t s;
+
+			s = cic_lut[0][b] + cic_lut[1][ch->hist[0]] + cic_lut[2][ch->hist[1]] +
+			    cic_lut[3][ch->hist[2]];
+			ch->hist[2] = ch->hist[1];
+			ch->hist[1] = ch->hist[0];
+			ch->hist[0] = b;
+
+			ch->integ[0] += s;
+			ch->integ[1] += ch->integ[0];
+			ch->integ[2] += ch->integ[1];
+			ch->integ[3] += ch->integ[2];
+		}
+
+		if (++decim->cic_count < decim->cic_bytes) {
+			continue;
+		}
+
+		decim->cic_count = 0;
+
+		for (uint8_t c = 0; c < channels; c++) {
+			typeof(decim->chan[0]) *ch = &decim->chan[c];
+			int32_t v = ch->integ[CIC_ORDER - 1];
+
+			/* Integrators wrap around, the combs undo it */
+			for (int k = 0; k < CIC_ORDER; k++) {
+				int32_t d = v - ch->comb[k];
+
+				ch->comb[k] = v;
+				v = d;
+			}
+
+			v >>= decim->shift;
+			v = CLAMP(v, INT16_MIN, INT16_MAX);
+
+			ch->line[decim->hb_idx] = v;
+			ch->line[decim->hb_idx + HB_TAPS] = v;
+
+			if (decim->hb_phase) {
+				pcm[out * channels + c] = hb_filter(&ch->line[decim->hb_idx + 1]);
+			}
+		}
+
+		decim->hb_idx = (decim->hb_idx + 1) % HB_TAPS;
+		if (decim->hb_phase) {
+			out++;
+		}
+		decim->hb_phase ^= 1;
+	}
+
+	return out;
+}
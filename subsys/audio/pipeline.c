@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/audio/pipeline.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(audio_pipeline, CONFIG_AUDIO_PIPELINE_LOG_LEVEL);
+
+static int node_start(const struct audio_pipeline_node *node)
+{
+	if (node->api->start == NULL) {
+		return 0;
+	}
+
+	return node->api->start(node);
+}
+
+static void node_stop(const struct audio_pipeline_node *node)
+{
+	int ret;
+
+	if (node->api->stop == NULL) {
+		return;
+	}
+
+	ret = node->api->stop(node);
+	if (ret < 0) {
+		LOG_WRN("Failed to stop node %s (%d)", node->name, ret);
+	}
+}
+
+static void domain_stop_nodes(struct audio_pipeline_domain *domain, size_t num_pipelines)
+{
+	/* Sources first, so that nothing new enters the pipelines */
+	for (size_t i = 0; i < num_pipelines; i++) {
+		struct audio_pipeline *pipeline = domain->pipelines[i];
+
+		for (size_t n = 0; n < pipeline->num_nodes; n++) {
+			node_stop(pipeline->nodes[n]);
+		}
+
+		pipeline->active = false;
+	}
+}
+
+int audio_pipeline_run_once(struct audio_pipeline *pipeline)
+{
+	const struct audio_pipeline_node *source = pipeline->nodes[0];
+	const struct audio_pipeline_node *sink = pipeline->nodes[pipeline->num_nodes - 1];
+	struct audio_block block = {0};
+	int ret;
+
+	ret = source->api->pull(source, &block);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (size_t n = 1; n < pipeline->num_nodes - 1; n++) {
+		const struct audio_pipeline_node *node = pipeline->nodes[n];
+
+		ret = node->api->process(node, &block);
+		if (ret < 0) {
+			LOG_DBG("%s: node %s failed (%d)", pipeline->name, node->name, ret);
+			audio_block_free(&block);
+			pipeline->stats.errors++;
+			return ret;
+		}
+	}
+
+	ret = sink->api->push(sink, &block);
+	if (ret < 0) {
+		LOG_DBG("%s: sink %s failed (%d)", pipeline->name, sink->name, ret);
+		pipeline->stats.errors++;
+		return ret;
+	}
+
+	pipeline->stats.blocks++;
+
+	return 0;
+}
+
+static void domain_thread(void *p1, void *p2, void *p3)
+{
+	struct audio_pipeline_domain *domain = p1;
+	size_t active;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	do {
+		active = 0;
+
+		for (size_t i = 0; i < domain->num_pipelines; i++) {
+			struct audio_pipeline *pipeline = domain->pipelines[i];
+			int ret;
+
+			if (!pipeline->active) {
+				continue;
+			}
+
+			active++;
+
+			ret = audio_pipeline_run_once(pipeline);
+			if (ret == -EIO && atomic_get(&domain->running)) {
+				/* The source will not produce any more data */
+				LOG_WRN("%s: source stopped", pipeline->name);
+				pipeline->active = false;
+			}
+		}
+	} while (active > 0 && atomic_get(&domain->running));
+
+	LOG_DBG("%s: domain thread exit", domain->name);
+}
+
+int audio_pipeline_domain_start(struct audio_pipeline_domain *domain)
+{
+	int ret;
+
+	if (!atomic_cas(&domain->running, 0, 1)) {
+		return -EALREADY;
+	}
+
+	for (size_t i = 0; i < domain->num_pipelines; i++) {
+		struct audio_pipeline *pipeline = domain->pipelines[i];
+
+		__ASSERT(pipeline->nodes[0]->api->pull != NULL, "%s: source cannot pull",
+			 pipeline->name);
+		__ASSERT(pipeline->nodes[pipeline->num_nodes - 1]->api->push != NULL,
+			 "%s: sink cannot push", pipeline->name);
+
+		/* Sinks first, so that no produced block is lost */
+		for (size_t n = pipeline->num_nodes; n > 0; n--) {
+			const struct audio_pipeline_node *node = pipeline->nodes[n - 1];
+
+			ret = node_start(node);
+			if (ret < 0) {
+				LOG_ERR("%s: failed to start node %s (%d)", pipeline->name,
+					node->name, ret);
+
+				while (++n <= pipeline->num_nodes) {
+					node_stop(pipeline->nodes[n - 1]);
+				}
+
+				domain_stop_nodes(domain, i);
+				atomic_set(&domain->running, 0);
+
+				return ret;
+			}
+		}
+
+		pipeline->active = true;
+	}
+
+	k_thread_create(domain->thread, domain->stack, domain->stack_size, domain_thread, domain,
+			NULL, NULL, domain->priority, 0, K_NO_WAIT);
+	k_thread_name_set(domain->thread, domain->name);
+
+	return 0;
+}
+
+static void queue_purge(const struct audio_pipeline_node *node);
+
+int audio_pipeline_domain_stop(struct audio_pipeline_domain *domain, k_timeout_t timeout)
+{
+	int ret = 0;
+
+	if (!atomic_cas(&domain->running, 1, 0)) {
+		return -EALREADY;
+	}
+
+	/* Stopping the nodes releases a domain thread blocked in a node */
+	domain_stop_nodes(domain, domain->num_pipelines);
+
+	if (k_thread_join(domain->thread, timeout) != 0) {
+		LOG_WRN("%s: domain thread did not exit, aborting it", domain->name);
+		k_thread_abort(domain->thread);
+		ret = -EAGAIN;
+	}
+
+	/* The thread is gone, drop the wake up markers and any block queued
+	 * while stopping, so that a restart does not see them.
+	 */
+	for (size_t i = 0; i < domain->num_pipelines; i++) {
+		struct audio_pipeline *pipeline = domain->pipelines[i];
+
+		for (size_t n = 0; n < pipeline->num_nodes; n++) {
+			if (pipeline->nodes[n]->api == &audio_pipeline_queue_api) {
+				queue_purge(pipeline->nodes[n]);
+			}
+		}
+	}
+
+	return ret;
+}
+
+static int queue_pull(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	const struct audio_pipeline_queue_config *config = node->config;
+	int ret;
+
+	ret = k_msgq_get(config->msgq, block, config->timeout);
+	if (ret == 0 && block->data == NULL) {
+		/* Wake up marker queued by queue_stop() */
+		return -EAGAIN;
+	}
+
+	return ret;
+}
+
+static void queue_purge(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_queue_config *config = node->config;
+	struct audio_block block;
+
+	while (k_msgq_get(config->msgq, &block, K_NO_WAIT) == 0) {
+		audio_block_free(&block);
+	}
+}
+
+static int queue_stop(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_queue_config *config = node->config;
+	struct audio_block block;
+
+	queue_purge(node);
+
+	/* Wake up the domain thread if it waits for a block */
+	block = (struct audio_block){0};
+	(void)k_msgq_put(config->msgq, &block, K_NO_WAIT);
+
+	return 0;
+}
+
+int audio_pipeline_queue_put(const struct audio_pipeline_node *node,
+			     const struct audio_block *block, k_timeout_t timeout)
+{
+	const struct audio_pipeline_queue_config *config = node->config;
+
+	return k_msgq_put(config->msgq, block, timeout);
+}
+
+const struct audio_pipeline_node_api audio_pipeline_queue_api = {
+	.pull = queue_pull,
+	.stop = queue_stop,
+};
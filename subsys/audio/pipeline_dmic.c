@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/audio/dmic.h>
+#include <zephyr/audio/pipeline.h>
+
+static int dmic_source_pull(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	const struct audio_pipeline_dmic_config *config = node->config;
+	int ret;
+
+	ret = dmic_read(config->dev, config->stream, &block->data, &block->size,
+			config->timeout);
+	if (ret < 0) {
+		return ret;
+	}
+
+	block->slab = config->slab;
+
+	return 0;
+}
+
+static int dmic_source_start(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_dmic_config *config = node->config;
+
+	return dmic_trigger(config->dev, DMIC_TRIGGER_START);
+}
+
+static int dmic_source_stop(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_dmic_config *config = node->config;
+
+	return dmic_trigger(config->dev, DMIC_TRIGGER_STOP);
+}
+
+const struct audio_pipeline_node_api audio_pipeline_dmic_source_api = {
+	.pull = dmic_source_pull,
+	.start = dmic_source_start,
+	.stop = dmic_source_stop,
+};
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/audio/pipeline.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(audio_pipeline, CONFIG_AUDIO_PIPELINE_LOG_LEVEL);
+
+static int i2s_source_pull(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	const struct audio_pipeline_i2s_config *config = node->config;
+	const struct i2s_config *rx_cfg;
+	int ret;
+
+	ret = i2s_read(config->dev, &block->data, &block->size);
+	if (ret < 0) {
+		return ret;
+	}
+
+	rx_cfg = i2s_config_get(config->dev, I2S_DIR_RX);
+	block->slab = rx_cfg->mem_slab;
+
+	return 0;
+}
+
+static int i2s_source_start(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_i2s_config *config = node->config;
+
+	return i2s_trigger(config->dev, I2S_DIR_RX, I2S_TRIGGER_START);
+}
+
+static int i2s_source_stop(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_i2s_config *config = node->config;
+
+	return i2s_trigger(config->dev, I2S_DIR_RX, I2S_TRIGGER_DROP);
+}
+
+#ifdef CONFIG_AUDIO_PIPELINE_I2S_PM
+static uint32_t i2s_block_us(const struct i2s_config *cfg)
+{
+	uint32_t sample_bytes = cfg->word_size <= 8 ? 1 : (cfg->word_size <= 16 ? 2 : 4);
+	uint32_t frame_bytes = sample_bytes * MAX(cfg->channels, 1);
+
+	if (cfg->frame_clk_freq == 0) {
+		return 0;
+	}
+
+	return (uint64_t)(cfg->block_size / frame_bytes) * USEC_PER_SEC / cfg->frame_clk_freq;
+}
+#endif
+
+static int i2s_sink_push(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	const struct audio_pipeline_i2s_config *config = node->config;
+	struct audio_pipeline_i2s_data *data = node->data;
+	const struct i2s_config *tx_cfg;
+	int ret;
+
+	tx_cfg = i2s_config_get(config->dev, I2S_DIR_TX);
+	if (tx_cfg == NULL || tx_cfg->mem_slab == NULL) {
+		audio_block_free(block);
+		return -EIO;
+	}
+
+	if (block->slab == tx_cfg->mem_slab) {
+		ret = i2s_write(config->dev, block->data, block->size);
+		if (ret < 0) {
+			audio_block_free(block);
+			return ret;
+		}
+	} else {
+		/* Block does not belong to the TX memory slab, copy it */
+		ret = i2s_buf_write(config->dev, block->data, block->size);
+		audio_block_free(block);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	if (!data->started && ++data->queued >= config->prefill) {
+		ret = i2s_trigger(config->dev, I2S_DIR_TX, I2S_TRIGGER_START);
+		if (ret < 0) {
+			LOG_ERR("%s: TX START trigger failed (%d)", node->name, ret);
+			return ret;
+		}
+
+		data->started = true;
+
+#ifdef CONFIG_AUDIO_PIPELINE_I2S_PM
+		/* The TX ring holds about prefill blocks once streaming */
+		data->block_us = i2s_block_us(tx_cfg);
+		pm_policy_stream_add(&data->pm, data->block_us * MAX(config->prefill, 1),
+				     data->block_us);
+	} else if (data->started) {
+		pm_policy_stream_update(&data->pm, data->block_us * MAX(config->prefill, 1));
+#endif
+	}
+
+	return 0;
+}
+
+static int i2s_sink_start(const struct audio_pipeline_node *node)
+{
+	struct audio_pipeline_i2s_data *data = node->data;
+
+	data->queued = 0;
+	data->started = false;
+
+	return 0;
+}
+
+static int i2s_sink_stop(const struct audio_pipeline_node *node)
+{
+	const struct audio_pipeline_i2s_config *config = node->config;
+	struct audio_pipeline_i2s_data *data = node->data;
+
+	if (!data->started) {
+		/* Release the blocks queued while prefilling */
+		return i2s_trigger(config->dev, I2S_DIR_TX, I2S_TRIGGER_DROP);
+	}
+
+	data->started = false;
+#ifdef CONFIG_AUDIO_PIPELINE_I2S_PM
+	pm_policy_stream_remove(&data->pm);
+#endif
+
+	return i2s_trigger(config->dev, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
+}
+
+const struct audio_pipeline_node_api audio_pipeline_i2s_source_api = {
+	.pull = i2s_source_pull,
+	.start = i2s_source_start,
+	.stop = i2s_source_stop,
+};
+
+const struct audio_pipeline_node_api audio_pipeline_i2s_sink_api = {
+	.push = i2s_sink_push,
+	.start = i2s_sink_start,
+	.stop = i2s_sink_stop,
+};
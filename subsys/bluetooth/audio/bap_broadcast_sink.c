@@ -276,6 +276,110 @@ static void broadcast_sink_set_ep_state(struct bt_bap_ep *ep, uint8_t state)
 	}
 }
 
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+static bool broadcast_sink_grouped_recv_registered(void)
+{
+	struct bt_bap_broadcast_sink_cb *listener;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&sink_cbs, listener, _node) {
+		if (listener->recv != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void broadcast_sink_group_release(struct bt_bap_broadcast_sink *sink)
+{
+	for (uint8_t i = 0U; i < ARRAY_SIZE(sink->group); i++) {
+		if (sink->group[i].buf != NULL) {
+			net_buf_unref(sink->group[i].buf);
+			sink->group[i].buf = NULL;
+		}
+	}
+
+	sink->group_bitfield = 0U;
+}
+
+static void broadcast_sink_group_flush(struct bt_bap_broadcast_sink *sink)
+{
+	struct bt_bap_broadcast_sink_cb *listener;
+	struct bt_iso_recv_info info = {
+		.seq_num = sink->group_seq_num,
+		.flags = BT_ISO_FLAGS_VALID,
+	};
+
+	for (uint8_t i = 0U; i < sink->stream_count; i++) {
+		const struct bt_bap_broadcast_sink_sdu *sdu = &sink->group[i];
+
+		if (sdu->buf == NULL) {
+			info.flags |= BT_ISO_FLAGS_LOST;
+			continue;
+		}
+
+		/* The SDUs of a BIG event share the timestamp, take the first one */
+		if ((sdu->info.flags & BT_ISO_FLAGS_TS) != 0 &&
+		    (info.flags & BT_ISO_FLAGS_TS) == 0) {
+			info.ts = sdu->info.ts;
+			info.flags |= BT_ISO_FLAGS_TS;
+		}
+
+		info.flags |= sdu->info.flags & (BT_ISO_FLAGS_ERROR | BT_ISO_FLAGS_LOST);
+		if ((sdu->info.flags & BT_ISO_FLAGS_VALID) == 0) {
+			info.flags &= ~BT_ISO_FLAGS_VALID;
+		}
+	}
+
+	if ((info.flags & (BT_ISO_FLAGS_ERROR | BT_ISO_FLAGS_LOST)) != 0) {
+		info.flags &= ~BT_ISO_FLAGS_VALID;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&sink_cbs, listener, _node) {
+		if (listener->recv != NULL) {
+			listener->recv(sink, &info, sink->group, sink->stream_count);
+		}
+	}
+
+	broadcast_sink_group_release(sink);
+}
+
+/* Collect the SDU of a stream into the current BIG event, delivering the event once every stream
+ * has its SDU, or earlier if an SDU of a later event arrives first
+ */
+static void broadcast_sink_group_recv(struct bt_bap_broadcast_sink *sink,
+				      const struct bt_iso_chan *chan,
+				      const struct bt_iso_recv_info *info, struct net_buf *buf)
+{
+	uint8_t index;
+
+	for (index = 0U; index < sink->stream_count; index++) {
+		if (sink->bis[index].chan == chan) {
+			break;
+		}
+	}
+
+	if (index == sink->stream_count) {
+		LOG_ERR("Could not lookup BIS of iso %p", chan);
+		return;
+	}
+
+	if (sink->group_bitfield != 0U &&
+	    (info->seq_num != sink->group_seq_num || (sink->group_bitfield & BIT(index)) != 0U)) {
+		broadcast_sink_group_flush(sink);
+	}
+
+	sink->group[index].buf = net_buf_ref(buf);
+	sink->group[index].info = *info;
+	sink->group_seq_num = info->seq_num;
+	sink->group_bitfield |= BIT(index);
+
+	if (sink->group_bitfield == BIT_MASK(sink->stream_count)) {
+		broadcast_sink_group_flush(sink);
+	}
+}
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
+
 static void broadcast_sink_iso_recv(struct bt_iso_chan *chan,
 				    const struct bt_iso_recv_info *info,
 				    struct net_buf *buf)
@@ -309,6 +413,13 @@ static void broadcast_sink_iso_recv(struct bt_iso_chan *chan,
 			stream, stream->qos->sdu);
 	}
 
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+	if (ep->broadcast_sink != NULL && broadcast_sink_grouped_recv_registered()) {
+		broadcast_sink_group_recv(ep->broadcast_sink, chan, info, buf);
+		return;
+	}
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
+
 	if (ops != NULL && ops->recv != NULL) {
 		ops->recv(stream, info, buf);
 	} else {
@@ -423,6 +534,11 @@ static void broadcast_sink_iso_disconnected(struct bt_iso_chan *chan,
 	if (sink == NULL) {
 		LOG_ERR("Could not lookup sink by iso %p", chan);
 	} else {
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+		/* A partial BIG event is of no use once a stream is gone */
+		broadcast_sink_group_release(sink);
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
+
 		if (!sys_slist_find_and_remove(&sink->streams, &stream->_node)) {
 			LOG_DBG("Could not find and remove stream %p from sink %p", stream, sink);
 		}
@@ -1343,6 +1459,9 @@ int bt_bap_broadcast_sink_sync(struct bt_bap_broadcast_sink *sink, uint32_t inde
 		}
 
 		sink->bis[i].chan = bt_bap_stream_iso_chan_get(stream);
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+		sink->group[i].stream = stream;
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
 		sys_slist_append(&sink->streams, &stream->_node);
 		sink->stream_count++;
 
@@ -188,6 +188,12 @@ struct bt_bap_broadcast_sink {
 	const struct bt_bap_scan_delegator_recv_state *recv_state;
 	/* The streams used to create the broadcast sink */
 	sys_slist_t streams;
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+	/* SDUs of the BIG event being received, indexed as bis */
+	struct bt_bap_broadcast_sink_sdu group[CONFIG_BT_BAP_BROADCAST_SNK_STREAM_COUNT];
+	uint32_t group_bitfield;
+	uint16_t group_seq_num;
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
 
 	/** Flags */
 	ATOMIC_DEFINE(flags, BT_BAP_BROADCAST_SINK_FLAG_NUM_FLAGS);
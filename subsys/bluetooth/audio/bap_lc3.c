@@ -0,0 +1,595 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/autoconf.h>
+#include <zephyr/bluetooth/audio/audio.h>
+#include <zephyr/bluetooth/audio/bap.h>
+#include <zephyr/bluetooth/audio/bap_lc3.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/bluetooth/iso.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/util.h>
+
+#include <lc3.h>
+
+LOG_MODULE_REGISTER(bt_bap_lc3, CONFIG_BT_BAP_LC3_LOG_LEVEL);
+
+static struct bt_bap_lc3_stream *lc3_stream_from_bap(struct bt_bap_stream *bap_stream)
+{
+	return CONTAINER_OF(bap_stream, struct bt_bap_lc3_stream, bap_stream);
+}
+
+static int lc3_stream_parse_cfg(struct bt_bap_lc3_stream *stream)
+{
+	const struct bt_audio_codec_cfg *codec_cfg = stream->bap_stream.codec_cfg;
+	enum bt_audio_location chan_allocation;
+	int ret;
+
+	if (codec_cfg == NULL || codec_cfg->id != BT_HCI_CODING_FORMAT_LC3) {
+		LOG_DBG("Stream %p is not configured for LC3", &stream->bap_stream);
+		return -ENOTSUP;
+	}
+
+	ret = bt_audio_codec_cfg_get_freq(codec_cfg);
+	if (ret >= 0) {
+		ret = bt_audio_codec_cfg_freq_to_freq_hz(ret);
+	}
+
+	if (ret <= 0 || !LC3_CHECK_SR_HZ(ret)) {
+		LOG_ERR("Unsupported sampling frequency: %d", ret);
+		return -ENOTSUP;
+	}
+
+	stream->freq_hz = (uint32_t)ret;
+
+	ret = bt_audio_codec_cfg_get_frame_dur(codec_cfg);
+	if (ret >= 0) {
+		ret = bt_audio_codec_cfg_frame_dur_to_frame_dur_us(ret);
+	}
+
+	if (ret <= 0 || !LC3_CHECK_DT_US(ret)) {
+		LOG_ERR("Unsupported frame duration: %d", ret);
+		return -ENOTSUP;
+	}
+
+	stream->frame_dur_us = (uint16_t)ret;
+
+	ret = bt_audio_codec_cfg_get_octets_per_frame(codec_cfg);
+	if (ret <= 0 || ret > BT_BAP_LC3_FRAME_OCTETS_MAX) {
+		LOG_ERR("Unsupported octets per frame: %d", ret);
+		return -ENOTSUP;
+	}
+
+	stream->octets_per_frame = (uint16_t)ret;
+
+	ret = bt_audio_codec_cfg_get_frame_blocks_per_sdu(codec_cfg, true);
+	if (ret <= 0) {
+		LOG_ERR("Could not get frame blocks per SDU: %d", ret);
+		return -ENOTSUP;
+	}
+
+	stream->frame_blocks_per_sdu = (uint8_t)ret;
+
+	ret = bt_audio_codec_cfg_get_chan_allocation(codec_cfg, &chan_allocation, true);
+	if (ret != 0) {
+		LOG_ERR("Could not get channel allocation: %d", ret);
+		return -ENOTSUP;
+	}
+
+	stream->chan_cnt = bt_audio_get_chan_count(chan_allocation);
+	if (stream->chan_cnt == 0U || stream->chan_cnt > CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX) {
+		LOG_ERR("Unsupported channel count %u", stream->chan_cnt);
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+static size_t lc3_stream_samples(const struct bt_bap_lc3_stream *stream)
+{
+	return lc3_frame_samples(stream->frame_dur_us, stream->freq_hz);
+}
+
+static int lc3_stream_setup(struct bt_bap_lc3_stream *stream)
+{
+	struct bt_bap_ep_info info;
+	int err;
+
+	err = bt_bap_ep_get_info(stream->bap_stream.ep, &info);
+	if (err != 0) {
+		return err;
+	}
+
+	err = lc3_stream_parse_cfg(stream);
+	if (err != 0) {
+		return err;
+	}
+
+	stream->tx = info.can_send;
+
+	for (uint8_t i = 0U; i < stream->chan_cnt; i++) {
+		if (stream->tx) {
+			stream->encoder[i] = lc3_setup_encoder(stream->frame_dur_us,
+							       stream->freq_hz, 0,
+							       &stream->encoder_mem[i]);
+			err = stream->encoder[i] == NULL ? -ENOEXEC : 0;
+		} else {
+			stream->decoder[i] = lc3_setup_decoder(stream->frame_dur_us,
+							       stream->freq_hz, 0,
+							       &stream->decoder_mem[i]);
+			err = stream->decoder[i] == NULL ? -ENOEXEC : 0;
+		}
+
+		if (err != 0) {
+			LOG_ERR("Failed to set up LC3 codec for channel %u", i);
+			return err;
+		}
+	}
+
+	LOG_DBG("Stream %p: %s %u Hz, %u us, %u octets, %u blocks, %u channels",
+		&stream->bap_stream, stream->tx ? "TX" : "RX", stream->freq_hz,
+		stream->frame_dur_us, stream->octets_per_frame, stream->frame_blocks_per_sdu,
+		stream->chan_cnt);
+
+	return 0;
+}
+
+#if defined(CONFIG_BT_AUDIO_TX)
+static bool lc3_stream_pcm_shared(const struct bt_bap_lc3_stream *stream)
+{
+	const struct bt_bap_lc3_pcm_group *group = stream->pcm_group;
+
+	return group != NULL && stream->frame_blocks_per_sdu == 1U &&
+	       group->freq_hz == stream->freq_hz && group->frame_dur_us == stream->frame_dur_us &&
+	       group->chan_cnt == stream->chan_cnt;
+}
+
+/* Frames of a block are ordered by channel, each read from the interleaved PCM */
+static int lc3_stream_encode(struct bt_bap_lc3_stream *stream, const int16_t *pcm,
+			     struct net_buf *buf)
+{
+	int err;
+
+	for (uint8_t i = 0U; i < stream->chan_cnt; i++) {
+		err = lc3_encode(stream->encoder[i], LC3_PCM_FORMAT_S16, &pcm[i], stream->chan_cnt,
+				 stream->octets_per_frame,
+				 net_buf_add(buf, stream->octets_per_frame));
+		if (err < 0) {
+			LOG_ERR("Stream %p: encoding failed: %d", &stream->bap_stream, err);
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static int lc3_stream_encode_shared(struct bt_bap_lc3_stream *stream, struct net_buf *buf)
+{
+	struct bt_bap_lc3_pcm_group *group = stream->pcm_group;
+	int err;
+
+	(void)k_mutex_lock(&group->mutex, K_FOREVER);
+
+	/* A stream that skipped SDUs catches up with the others */
+	if (group->valid && (int16_t)(stream->seq_num - group->seq_num) < 0) {
+		stream->seq_num = group->seq_num;
+	}
+
+	/* The first stream to send an SDU gets its PCM, the others reuse it */
+	if (!group->valid || group->seq_num != stream->seq_num) {
+		group->err = group->pcm_get(group, group->pcm, lc3_stream_samples(stream));
+		group->seq_num = stream->seq_num;
+		group->valid = true;
+	}
+
+	err = group->err != 0 ? group->err : lc3_stream_encode(stream, group->pcm, buf);
+
+	(void)k_mutex_unlock(&group->mutex);
+
+	return err;
+}
+
+static void lc3_stream_send_sdu(struct bt_bap_lc3_stream *stream)
+{
+	const size_t samples = lc3_stream_samples(stream);
+	const bool shared = lc3_stream_pcm_shared(stream);
+	struct net_buf *buf;
+	int err;
+
+	if ((!shared && stream->lc3_ops->pcm_get == NULL) || stream->pool == NULL) {
+		return;
+	}
+
+	buf = net_buf_alloc(stream->pool, K_NO_WAIT);
+	if (buf == NULL) {
+		LOG_WRN("Stream %p: no buffer for SDU", &stream->bap_stream);
+		return;
+	}
+
+	net_buf_reserve(buf, BT_ISO_CHAN_SEND_RESERVE);
+
+	if (net_buf_tailroom(buf) <
+	    stream->frame_blocks_per_sdu * stream->chan_cnt * stream->octets_per_frame) {
+		LOG_ERR("Stream %p: buffer too small for SDU", &stream->bap_stream);
+		err = -ENOMEM;
+		goto unref;
+	}
+
+	if (shared) {
+		err = lc3_stream_encode_shared(stream, buf);
+	} else {
+		err = 0;
+
+		for (uint8_t block = 0U; block < stream->frame_blocks_per_sdu; block++) {
+			err = stream->lc3_ops->pcm_get(stream, stream->pcm, samples);
+			if (err == 0) {
+				err = lc3_stream_encode(stream, stream->pcm, buf);
+			}
+
+			if (err != 0) {
+				break;
+			}
+		}
+	}
+
+	if (err != 0) {
+		goto unref;
+	}
+
+	/* The buffer is only consumed when the SDU is sent */
+	err = bt_bap_stream_send(&stream->bap_stream, buf, stream->seq_num);
+	if (err != 0) {
+		LOG_DBG("Stream %p: send failed: %d", &stream->bap_stream, err);
+		goto unref;
+	}
+
+	stream->seq_num++;
+	return;
+
+unref:
+	net_buf_unref(buf);
+}
+#endif /* CONFIG_BT_AUDIO_TX */
+
+#if defined(CONFIG_BT_BAP_UNICAST)
+static void lc3_stream_configured_cb(struct bt_bap_stream *bap_stream,
+				     const struct bt_bap_qos_cfg_pref *pref)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->configured != NULL) {
+		ops->configured(bap_stream, pref);
+	}
+}
+
+static void lc3_stream_qos_set_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->qos_set != NULL) {
+		ops->qos_set(bap_stream);
+	}
+}
+
+static void lc3_stream_enabled_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->enabled != NULL) {
+		ops->enabled(bap_stream);
+	}
+}
+
+static void lc3_stream_metadata_updated_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->metadata_updated != NULL) {
+		ops->metadata_updated(bap_stream);
+	}
+}
+
+static void lc3_stream_disabled_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->disabled != NULL) {
+		ops->disabled(bap_stream);
+	}
+}
+
+static void lc3_stream_released_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->released != NULL) {
+		ops->released(bap_stream);
+	}
+}
+#endif /* CONFIG_BT_BAP_UNICAST */
+
+static void lc3_stream_started_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_lc3_stream *stream = lc3_stream_from_bap(bap_stream);
+	struct bt_bap_stream_ops *ops = stream->ops;
+	int err;
+
+	err = lc3_stream_setup(stream);
+	if (err != 0) {
+		LOG_WRN("Stream %p started without LC3 codec: %d", bap_stream, err);
+	}
+
+	stream->started = err == 0;
+	stream->seq_num = 0U;
+
+	if (ops != NULL && ops->started != NULL) {
+		ops->started(bap_stream);
+	}
+
+#if defined(CONFIG_BT_AUDIO_TX)
+	if (stream->started && stream->tx && stream->pcm_group != NULL &&
+	    !lc3_stream_pcm_shared(stream)) {
+		LOG_WRN("Stream %p does not match the PCM of its group", bap_stream);
+	}
+
+	/* Keep a few SDUs queued, every sent one is then replaced by a new one */
+	if (stream->started && stream->tx) {
+		for (int i = 0; i < CONFIG_BT_BAP_LC3_TX_SDU_COUNT; i++) {
+			lc3_stream_send_sdu(stream);
+		}
+	}
+#endif /* CONFIG_BT_AUDIO_TX */
+}
+
+static void lc3_stream_stopped_cb(struct bt_bap_stream *bap_stream, uint8_t reason)
+{
+	struct bt_bap_lc3_stream *stream = lc3_stream_from_bap(bap_stream);
+	struct bt_bap_stream_ops *ops = stream->ops;
+
+	stream->started = false;
+
+	if (ops != NULL && ops->stopped != NULL) {
+		ops->stopped(bap_stream, reason);
+	}
+}
+
+#if defined(CONFIG_BT_AUDIO_RX)
+/* Return the next frame of a received SDU and advance past it. Frames are read in place, except
+ * those split across fragments of a chained SDU, which are gathered in the stream.
+ */
+static const uint8_t *lc3_stream_next_frame(struct bt_bap_lc3_stream *stream,
+					    struct net_buf **frag, size_t *off)
+{
+	const uint16_t octets = stream->octets_per_frame;
+	const uint8_t *data;
+
+	while (*frag != NULL && *off == (*frag)->len) {
+		*frag = (*frag)->frags;
+		*off = 0U;
+	}
+
+	if (*frag == NULL) {
+		return NULL;
+	}
+
+	if ((*frag)->len - *off >= octets) {
+		data = (*frag)->data + *off;
+		*off += octets;
+
+		return data;
+	}
+
+#if defined(CONFIG_BT_ISO_RX_FRAG_CHAIN)
+	size_t copied = 0U;
+
+	while (*frag != NULL && copied < octets) {
+		const size_t len = MIN((*frag)->len - *off, octets - copied);
+
+		memcpy(&stream->frame[copied], (*frag)->data + *off, len);
+		copied += len;
+		*off += len;
+
+		if (*off == (*frag)->len) {
+			*frag = (*frag)->frags;
+			*off = 0U;
+		}
+	}
+
+	return copied == octets ? stream->frame : NULL;
+#else
+	return NULL;
+#endif /* CONFIG_BT_ISO_RX_FRAG_CHAIN */
+}
+
+static void lc3_stream_recv_cb(struct bt_bap_stream *bap_stream,
+			       const struct bt_iso_recv_info *info, struct net_buf *buf)
+{
+	struct bt_bap_lc3_stream *stream = lc3_stream_from_bap(bap_stream);
+	struct bt_bap_stream_ops *ops = stream->ops;
+
+	if (stream->started && !stream->tx && stream->lc3_ops->pcm_recv != NULL) {
+		const size_t samples = lc3_stream_samples(stream);
+		const uint16_t octets = stream->octets_per_frame;
+		struct net_buf *frag = NULL;
+		const uint8_t *data;
+		size_t off = 0U;
+		int err;
+
+		/* A lost or malformed SDU is concealed from the previous frames */
+		if ((info->flags & BT_ISO_FLAGS_VALID) != 0 &&
+		    net_buf_frags_len(buf) == (size_t)stream->frame_blocks_per_sdu *
+						      stream->chan_cnt * octets) {
+			frag = buf;
+		}
+
+		for (uint8_t block = 0U; block < stream->frame_blocks_per_sdu; block++) {
+			for (uint8_t i = 0U; i < stream->chan_cnt; i++) {
+				data = lc3_stream_next_frame(stream, &frag, &off);
+				err = lc3_decode(stream->decoder[i], data,
+						 data != NULL ? octets : 0, LC3_PCM_FORMAT_S16,
+						 &stream->pcm[i], stream->chan_cnt);
+				if (err < 0) {
+					LOG_DBG("Stream %p: decoding failed: %d", bap_stream, err);
+				}
+			}
+
+			stream->lc3_ops->pcm_recv(stream, info, stream->pcm, samples);
+		}
+	}
+
+	if (ops != NULL && ops->recv != NULL) {
+		ops->recv(bap_stream, info, buf);
+	}
+}
+#endif /* CONFIG_BT_AUDIO_RX */
+
+#if defined(CONFIG_BT_AUDIO_TX)
+static void lc3_stream_sent_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_lc3_stream *stream = lc3_stream_from_bap(bap_stream);
+	struct bt_bap_stream_ops *ops = stream->ops;
+
+	if (ops != NULL && ops->sent != NULL) {
+		ops->sent(bap_stream);
+	}
+
+	if (stream->started && stream->tx) {
+		lc3_stream_send_sdu(stream);
+	}
+}
+#endif /* CONFIG_BT_AUDIO_TX */
+
+static void lc3_stream_connected_cb(struct bt_bap_stream *bap_stream)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->connected != NULL) {
+		ops->connected(bap_stream);
+	}
+}
+
+static void lc3_stream_disconnected_cb(struct bt_bap_stream *bap_stream, uint8_t reason)
+{
+	struct bt_bap_stream_ops *ops = lc3_stream_from_bap(bap_stream)->ops;
+
+	if (ops != NULL && ops->disconnected != NULL) {
+		ops->disconnected(bap_stream, reason);
+	}
+}
+
+static struct bt_bap_stream_ops lc3_stream_ops = {
+#if defined(CONFIG_BT_BAP_UNICAST)
+	.configured = lc3_stream_configured_cb,
+	.qos_set = lc3_stream_qos_set_cb,
+	.enabled = lc3_stream_enabled_cb,
+	.metadata_updated = lc3_stream_metadata_updated_cb,
+	.disabled = lc3_stream_disabled_cb,
+	.released = lc3_stream_released_cb,
+#endif /* CONFIG_BT_BAP_UNICAST */
+	.started = lc3_stream_started_cb,
+	.stopped = lc3_stream_stopped_cb,
+#if defined(CONFIG_BT_AUDIO_RX)
+	.recv = lc3_stream_recv_cb,
+#endif /* CONFIG_BT_AUDIO_RX */
+#if defined(CONFIG_BT_AUDIO_TX)
+	.sent = lc3_stream_sent_cb,
+#endif /* CONFIG_BT_AUDIO_TX */
+	.connected = lc3_stream_connected_cb,
+	.disconnected = lc3_stream_disconnected_cb,
+};
+
+int bt_bap_lc3_stream_init(struct bt_bap_lc3_stream *stream, struct bt_bap_stream_ops *ops,
+			   const struct bt_bap_lc3_stream_ops *lc3_ops, struct net_buf_pool *pool)
+{
+	CHECKIF(stream == NULL || lc3_ops == NULL) {
+		LOG_DBG("stream %p lc3_ops %p", stream, lc3_ops);
+
+		return -EINVAL;
+	}
+
+	stream->ops = ops;
+	stream->lc3_ops = lc3_ops;
+	stream->pool = pool;
+	stream->pcm_group = NULL;
+	stream->started = false;
+
+	bt_bap_stream_cb_register(&stream->bap_stream, &lc3_stream_ops);
+
+	return 0;
+}
+
+int bt_bap_lc3_stream_get_pcm_info(const struct bt_bap_lc3_stream *stream, uint32_t *freq_hz,
+				   uint16_t *dur_us, uint8_t *chan_cnt)
+{
+	CHECKIF(stream == NULL || freq_hz == NULL || dur_us == NULL || chan_cnt == NULL) {
+		LOG_DBG("Invalid parameters");
+
+		return -EINVAL;
+	}
+
+	if (!stream->started) {
+		return -EBADMSG;
+	}
+
+	*freq_hz = stream->freq_hz;
+	*dur_us = stream->frame_dur_us;
+	*chan_cnt = stream->chan_cnt;
+
+	return 0;
+}
+
+int bt_bap_lc3_pcm_group_init(struct bt_bap_lc3_pcm_group *group, uint32_t freq_hz,
+			      uint16_t dur_us, uint8_t chan_cnt)
+{
+	CHECKIF(group == NULL || group->pcm_get == NULL) {
+		LOG_DBG("group %p", group);
+
+		return -EINVAL;
+	}
+
+	CHECKIF(!LC3_CHECK_SR_HZ(freq_hz) || !LC3_CHECK_DT_US(dur_us) || chan_cnt == 0U ||
+		chan_cnt > CONFIG_BT_BAP_LC3_CHAN_COUNT_MAX) {
+		LOG_DBG("Invalid PCM parameters %u Hz %u us %u channels", freq_hz, dur_us,
+			chan_cnt);
+
+		return -EINVAL;
+	}
+
+	(void)k_mutex_init(&group->mutex);
+	group->freq_hz = freq_hz;
+	group->frame_dur_us = dur_us;
+	group->chan_cnt = chan_cnt;
+	group->valid = false;
+
+	return 0;
+}
+
+int bt_bap_lc3_stream_set_pcm_group(struct bt_bap_lc3_stream *stream,
+				    struct bt_bap_lc3_pcm_group *group)
+{
+	CHECKIF(stream == NULL) {
+		LOG_DBG("stream is NULL");
+
+		return -EINVAL;
+	}
+
+	if (stream->started) {
+		return -EBUSY;
+	}
+
+	stream->pcm_group = group;
+
+	return 0;
+}
@@ -350,6 +350,22 @@ struct ticker_instance {
 						     */
 };
 
+#if !defined(CONFIG_BT_TICKER_LOW_LAT)
+/* Number of nodes remembered by the insertion index */
+#define TICKER_INSERT_INDEX_SIZE 8
+
+/* Nodes enqueued during one ticker_job_list_insert, sorted by their ticks to
+ * expire relative to ticks_current. Enqueueing does not move existing nodes in
+ * time, so each of them remains a valid starting point for the search of the
+ * insertion point of the next node.
+ */
+struct ticker_insert_index {
+	uint8_t  count;
+	uint8_t  id[TICKER_INSERT_INDEX_SIZE];
+	uint32_t ticks[TICKER_INSERT_INDEX_SIZE];
+};
+#endif /* !CONFIG_BT_TICKER_LOW_LAT */
+
 BUILD_ASSERT(sizeof(struct ticker_node)    == TICKER_NODE_T_SIZE);
 BUILD_ASSERT(sizeof(struct ticker_user)    == TICKER_USER_T_SIZE);
 BUILD_ASSERT(sizeof(struct ticker_user_op) == TICKER_USER_OP_T_SIZE);
@@ -564,33 +580,67 @@ static void ticker_by_next_slot_get(struct ticker_instance *instance,
  * @brief Enqueue ticker node
  *
  * @details Finds insertion point for new ticker node and inserts the
- * node in the linked node list.
+ * node in the linked node list. The search starts from the last node in
+ * the insertion index it would have gone past anyway, instead of the head
+ * of the list, so that inserting many nodes in one ticker_job does not
+ * walk the whole list for each of them.
  *
  * @param instance Pointer to ticker instance
  * @param id       Ticker node id to enqueue
+ * @param index    Pointer to insertion index, updated with the new node
  *
  * @return Id of enqueued ticker node
  * @internal
  */
-static uint8_t ticker_enqueue(struct ticker_instance *instance, uint8_t id)
+static uint8_t ticker_enqueue(struct ticker_instance *instance, uint8_t id,
+			      struct ticker_insert_index *index)
 {
 	struct ticker_node *ticker_current;
 	struct ticker_node *ticker_new;
 	uint32_t ticks_to_expire_current;
+	uint32_t ticks_to_expire_new;
 	struct ticker_node *node;
 	uint32_t ticks_to_expire;
 	uint8_t previous;
 	uint8_t current;
+	uint8_t lo;
+	uint8_t hi;
 
 	node = &instance->nodes[0];
 	ticker_new = &node[id];
-	ticks_to_expire = ticker_new->ticks_to_expire;
-	current = instance->ticker_id_head;
+	ticks_to_expire_new = ticker_new->ticks_to_expire;
+	ticks_to_expire = ticks_to_expire_new;
+
+	/* Binary search the index for the number of indexed nodes that a
+	 * search from the head would go past, i.e. the ones expiring before
+	 * the new node, and the ones expiring in the same tick unless the
+	 * new node has latency and is then ordered among them below.
+	 */
+	lo = 0U;
+	hi = index->count;
+	while (lo < hi) {
+		uint8_t mid = (lo + hi) / 2U;
+
+		if ((index->ticks[mid] < ticks_to_expire) ||
+		    ((index->ticks[mid] == ticks_to_expire) &&
+		     !ticker_new->lazy_current)) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
 
 	/* Find insertion point for new ticker node and adjust ticks_to_expire
 	 * relative to insertion point
 	 */
-	previous = TICKER_NULL;
+	if (lo) {
+		previous = index->id[lo - 1U];
+		current = node[previous].next;
+		ticks_to_expire -= index->ticks[lo - 1U];
+	} else {
+		previous = TICKER_NULL;
+		current = instance->ticker_id_head;
+	}
 
 	while ((current != TICKER_NULL) && (ticks_to_expire >=
 		(ticks_to_expire_current =
@@ -626,6 +676,23 @@ static uint8_t ticker_enqueue(struct ticker_instance *instance, uint8_t id)
 		node[current].ticks_to_expire -= ticks_to_expire;
 	}
 
+	/* Add the new node to the index, keeping it sorted. When full, the
+	 * new node replaces its neighbour, it is the better starting point
+	 * for nodes that follow it.
+	 */
+	if (index->count < TICKER_INSERT_INDEX_SIZE) {
+		for (hi = index->count; hi > lo; hi--) {
+			index->id[hi] = index->id[hi - 1U];
+			index->ticks[hi] = index->ticks[hi - 1U];
+		}
+		index->count++;
+	} else if (lo) {
+		lo--;
+	}
+
+	index->id[lo] = id;
+	index->ticks[lo] = ticks_to_expire_new;
+
 	return id;
 }
 #else /* CONFIG_BT_TICKER_LOW_LAT */
@@ -2404,22 +2471,19 @@ static inline uint32_t ticker_job_op_start(struct ticker_instance *instance,
  * @param instance    Pointer to ticker instance
  * @param id_insert   Id of ticker to insert
  * @param ticker      Pointer to ticker node to insert
- * @param insert_head Pointer to current head. Updated if colliding nodes
- *		      are un-scheduled
+ * @param index       Pointer to insertion index of the current ticker_job
  * @internal
  */
 static inline uint8_t ticker_job_insert(struct ticker_instance *instance,
 				      uint8_t id_insert,
 				      struct ticker_node *ticker,
-				      uint8_t *insert_head)
+				      struct ticker_insert_index *index)
 {
-	ARG_UNUSED(insert_head);
-
 	/* Prepare to insert */
 	ticker->next = TICKER_NULL;
 
 	/* Enqueue the ticker node */
-	(void)ticker_enqueue(instance, id_insert);
+	(void)ticker_enqueue(instance, id_insert, index);
 
 	/* Inserted/Scheduled */
 	ticker->req = ticker->ack + 1;
@@ -2867,6 +2931,11 @@ static inline void ticker_job_list_insert(struct ticker_instance *instance,
 	struct ticker_node *node;
 	struct ticker_user *users;
 	uint8_t count_user;
+#if !defined(CONFIG_BT_TICKER_LOW_LAT)
+	struct ticker_insert_index index;
+
+	index.count = 0U;
+#endif /* !CONFIG_BT_TICKER_LOW_LAT */
 
 	node = &instance->nodes[0];
 	users = &instance->users[0];
@@ -2938,8 +3007,13 @@ static inline void ticker_job_list_insert(struct ticker_instance *instance,
 
 			if (!status) {
 				/* Insert ticker node */
+#if !defined(CONFIG_BT_TICKER_LOW_LAT)
+				status = ticker_job_insert(instance, id_insert, ticker,
+							   &index);
+#else /* CONFIG_BT_TICKER_LOW_LAT */
 				status = ticker_job_insert(instance, id_insert, ticker,
 							   &insert_head);
+#endif /* CONFIG_BT_TICKER_LOW_LAT */
 			}
 
 			if (user_op) {
@@ -15,11 +15,93 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/byteorder.h>
 
+#if defined(CONFIG_BT_HOST_CCM_PSA)
+#include <psa/crypto.h>
+#endif
+
 #include "common/bt_str.h"
 
 #define LOG_LEVEL CONFIG_BT_HCI_CORE_LOG_LEVEL
 LOG_MODULE_REGISTER(bt_aes_ccm);
 
+#if defined(CONFIG_BT_HOST_CCM_PSA)
+static int ccm_key_import(const uint8_t key[16], psa_algorithm_t alg, psa_key_id_t *key_id)
+{
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+	psa_status_t status;
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attr, 128);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+	psa_set_key_algorithm(&attr, alg);
+
+	status = psa_import_key(&attr, key, 16, key_id);
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("Failed to import AES key %d", status);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int ccm_batch(const uint8_t key[16], struct bt_ccm_op *ops, size_t count,
+		     size_t mic_size, bool encrypt)
+{
+	psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, mic_size);
+	psa_key_id_t key_id;
+	psa_status_t status;
+	int ret = 0;
+	int err;
+
+	if (mic_size < 4 || mic_size > 16 || (mic_size % 2) != 0) {
+		return -EINVAL;
+	}
+
+	/* One key for the whole batch, it can stay loaded in the AES engine */
+	err = ccm_key_import(key, alg, &key_id);
+	if (err) {
+		return err;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct bt_ccm_op *op = &ops[i];
+		size_t out_len;
+
+		if (encrypt) {
+			status = psa_aead_encrypt(key_id, alg, op->nonce, 13, op->aad, op->aad_len,
+						  op->in, op->len, op->out, op->len + mic_size,
+						  &out_len);
+		} else {
+			status = psa_aead_decrypt(key_id, alg, op->nonce, 13, op->aad, op->aad_len,
+						  op->in, op->len + mic_size, op->out, op->len,
+						  &out_len);
+		}
+
+		if (status == PSA_SUCCESS) {
+			op->err = 0;
+		} else if (status == PSA_ERROR_INVALID_SIGNATURE) {
+			op->err = -EBADMSG;
+		} else if (status == PSA_ERROR_INVALID_ARGUMENT) {
+			op->err = -EINVAL;
+		} else {
+			LOG_ERR("AES-CCM failed %d", status);
+			op->err = -EIO;
+		}
+
+		if (op->err && !ret) {
+			ret = op->err;
+		}
+	}
+
+	status = psa_destroy_key(key_id);
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("Failed to destroy AES key %d", status);
+		return -EIO;
+	}
+
+	return ret;
+}
+#else /* !CONFIG_BT_HOST_CCM_PSA */
 static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 {
 	dst[0] = a[0] ^ b[0];
@@ -99,7 +181,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 	return 0;
 }
 
-static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
+static int ccm_auth(const uint8_t key[16], const uint8_t nonce[13],
 		    const uint8_t *cleartext_msg, uint16_t msg_len, const uint8_t *aad,
 		    size_t aad_len, uint8_t *mic, size_t mic_size)
 {
@@ -191,46 +273,105 @@ static int ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
 	return 0;
 }
 
-int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13],
-		   const uint8_t *enc_data, size_t len, const uint8_t *aad,
-		   size_t aad_len, uint8_t *plaintext, size_t mic_size)
+static int ccm_decrypt_one(const uint8_t key[16], const struct bt_ccm_op *op, size_t mic_size)
 {
 	uint8_t mic[16];
 
-	if (aad_len >= 0xff00 || mic_size > sizeof(mic) || len > UINT16_MAX) {
+	if (op->aad_len >= 0xff00 || mic_size > sizeof(mic) || op->len > UINT16_MAX) {
 		return -EINVAL;
 	}
 
-	ccm_crypt(key, nonce, enc_data, plaintext, len);
+	ccm_crypt(key, op->nonce, op->in, op->out, op->len);
 
-	ccm_auth(key, nonce, plaintext, len, aad, aad_len, mic, mic_size);
+	ccm_auth(key, op->nonce, op->out, op->len, op->aad, op->aad_len, mic, mic_size);
 
-	if (memcmp(mic, enc_data + len, mic_size)) {
+	if (memcmp(mic, op->in + op->len, mic_size)) {
 		return -EBADMSG;
 	}
 
 	return 0;
 }
 
+static int ccm_encrypt_one(const uint8_t key[16], const struct bt_ccm_op *op, size_t mic_size)
+{
+	uint8_t *mic = op->out + op->len;
+
+	/* Unsupported AAD size */
+	if (op->aad_len >= 0xff00 || mic_size > 16 || op->len > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	ccm_auth(key, op->nonce, op->in, op->len, op->aad, op->aad_len, mic, mic_size);
+
+	ccm_crypt(key, op->nonce, op->in, op->out, op->len);
+
+	return 0;
+}
+
+static int ccm_batch(const uint8_t key[16], struct bt_ccm_op *ops, size_t count,
+		     size_t mic_size, bool encrypt)
+{
+	int ret = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		struct bt_ccm_op *op = &ops[i];
+
+		op->err = encrypt ? ccm_encrypt_one(key, op, mic_size) :
+				    ccm_decrypt_one(key, op, mic_size);
+		if (op->err && !ret) {
+			ret = op->err;
+		}
+	}
+
+	return ret;
+}
+#endif /* CONFIG_BT_HOST_CCM_PSA */
+
+int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13],
+		   const uint8_t *enc_data, size_t len, const uint8_t *aad,
+		   size_t aad_len, uint8_t *plaintext, size_t mic_size)
+{
+	struct bt_ccm_op op = {
+		.nonce = nonce,
+		.in = enc_data,
+		.len = len,
+		.aad = aad,
+		.aad_len = aad_len,
+		.out = plaintext,
+	};
+
+	return ccm_batch(key, &op, 1, mic_size, false);
+}
+
 int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13],
 		   const uint8_t *plaintext, size_t len, const uint8_t *aad,
 		   size_t aad_len, uint8_t *enc_data, size_t mic_size)
 {
-	uint8_t *mic = enc_data + len;
+	struct bt_ccm_op op = {
+		.nonce = nonce,
+		.in = plaintext,
+		.len = len,
+		.aad = aad,
+		.aad_len = aad_len,
+		.out = enc_data,
+	};
 
 	LOG_DBG("key %s", bt_hex(key, 16));
 	LOG_DBG("nonce %s", bt_hex(nonce, 13));
 	LOG_DBG("msg (len %zu) %s", len, bt_hex(plaintext, len));
 	LOG_DBG("aad_len %zu mic_size %zu", aad_len, mic_size);
 
-	/* Unsupported AAD size */
-	if (aad_len >= 0xff00 || mic_size > 16 || len > UINT16_MAX) {
-		return -EINVAL;
-	}
-
-	ccm_auth(key, nonce, plaintext, len, aad, aad_len, mic, mic_size);
+	return ccm_batch(key, &op, 1, mic_size, true);
+}
 
-	ccm_crypt(key, nonce, plaintext, enc_data, len);
+int bt_ccm_encrypt_batch(const uint8_t key[16], struct bt_ccm_op *ops, size_t count,
+			 size_t mic_size)
+{
+	return ccm_batch(key, ops, count, mic_size, true);
+}
 
-	return 0;
+int bt_ccm_decrypt_batch(const uint8_t key[16], struct bt_ccm_op *ops, size_t count,
+			 size_t mic_size)
+{
+	return ccm_batch(key, ops, count, mic_size, false);
 }
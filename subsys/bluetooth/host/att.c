@@ -733,7 +733,7 @@ static struct net_buf *bt_att_chan_create_pdu(struct bt_att_chan *chan, uint8_t
 	default: {
 		k_tid_t current_thread = k_current_get();
 
-		if (current_thread == k_work_queue_thread_get(&k_sys_work_q)) {
+		if (k_is_in_sys_work_q()) {
 			/* No blocking in the sysqueue. */
 			timeout = K_NO_WAIT;
 		} else if (current_thread == att_handle_rsp_thread) {
@@ -3935,8 +3935,7 @@ struct bt_att_req *bt_att_req_alloc(k_timeout_t timeout)
 	struct bt_att_req *req = NULL;
 	k_tid_t current_thread = k_current_get();
 
-	if (current_thread == att_handle_rsp_thread ||
-	    current_thread == k_work_queue_thread_get(&k_sys_work_q)) {
+	if (current_thread == att_handle_rsp_thread || k_is_in_sys_work_q()) {
 		/* bt_att_req are released by the att_handle_rsp_thread.
 		 * A blocking allocation the same thread would cause a
 		 * deadlock.
@@ -93,6 +93,10 @@ static void conn_tx_destroy(struct bt_conn *conn, struct bt_conn_tx *tx)
 
 #if defined(CONFIG_BT_CONN_TX)
 static void tx_complete_work(struct k_work *work);
+
+#define CONN_TX_BATCH CONFIG_BT_CONN_TX_BATCH
+#else
+#define CONN_TX_BATCH 1
 #endif /* CONFIG_BT_CONN_TX */
 
 static void notify_recycled_conn_slot(void);
@@ -281,6 +285,8 @@ static struct k_work_q *tx_notify_workqueue_get(void)
 
 static void tx_notify_process(struct bt_conn *conn)
 {
+	bool notified = false;
+
 	/* TX notify processing is done only from a single thread. */
 	__ASSERT_NO_MSG(k_current_get() == k_work_queue_thread_get(tx_notify_workqueue_get()));
 
@@ -301,7 +307,7 @@ static void tx_notify_process(struct bt_conn *conn)
 		irq_unlock(key);
 
 		if (!tx) {
-			return;
+			break;
 		}
 
 		LOG_DBG("tx %p cb %p user_data %p", tx, tx->cb, tx->user_data);
@@ -321,6 +327,16 @@ static void tx_notify_process(struct bt_conn *conn)
 			cb(conn, user_data, 0);
 		}
 
+		notified = true;
+
+		/* When batching, the TX processor is kicked once the completions are done */
+		if (CONN_TX_BATCH == 1) {
+			LOG_DBG("raise TX IRQ");
+			bt_tx_irq_raise();
+		}
+	}
+
+	if (CONN_TX_BATCH > 1 && notified) {
 		LOG_DBG("raise TX IRQ");
 		bt_tx_irq_raise();
 	}
@@ -486,8 +502,12 @@ void bt_conn_recv(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 	 *
 	 * Always do so from the same context for sanity. In this case that will
 	 * be either a dedicated Bluetooth connection TX workqueue or system workqueue.
+	 *
+	 * ISO data processed in its own work queue does not wait for it, so that it
+	 * is never held up by the users of that workqueue.
 	 */
-	bt_conn_tx_notify(conn, true);
+	bt_conn_tx_notify(conn, !(IS_ENABLED(CONFIG_BT_ISO_RX_WQ) &&
+				  conn->type == BT_CONN_TYPE_ISO));
 
 	LOG_DBG("handle %u len %u flags %02x", conn->handle, buf->len, flags);
 
@@ -1012,9 +1032,11 @@ void bt_conn_suspend_tx(bool suspend)
 }
 #endif	/* CONFIG_BT_TESTING */
 
-void bt_conn_tx_processor(void)
+/* Send one data packet of the next connection ready to send. Returns true if the TX processor
+ * shall run again.
+ */
+static bool conn_tx_process_one(void)
 {
-	LOG_DBG("start");
 	struct bt_conn *conn;
 	struct net_buf *buf;
 	bt_conn_tx_cb_t cb = NULL;
@@ -1023,25 +1045,25 @@ void bt_conn_tx_processor(void)
 
 	if (!IS_ENABLED(CONFIG_BT_CONN_TX)) {
 		/* Mom, can we have a real compiler? */
-		return;
+		return false;
 	}
 
 	if (IS_ENABLED(CONFIG_BT_TESTING) && _suspend_tx) {
-		return;
+		return false;
 	}
 
 	conn = get_conn_ready();
 
 	if (!conn) {
 		LOG_DBG("no connection wants to do stuff");
-		return;
+		return false;
 	}
 
 	LOG_DBG("processing conn %p", conn);
 
 	if (conn->state != BT_CONN_CONNECTED) {
 		LOG_WRN("conn %p: not connected", conn);
-		goto raise_and_exit;
+		goto rerun;
 	}
 
 	/* now that we are guaranteed resources, we can pull data from the upper
@@ -1080,15 +1102,32 @@ void bt_conn_tx_processor(void)
 		goto exit;
 	}
 
-raise_and_exit:
+rerun:
+	/* Give back the ref that `get_conn_ready()` gave us */
+	bt_conn_unref(conn);
+
+	return true;
+
+exit:
+	bt_conn_unref(conn);
+
+	return false;
+}
+
+void bt_conn_tx_processor(void)
+{
+	LOG_DBG("start");
+
+	for (int i = 0; i < CONN_TX_BATCH; i++) {
+		if (!conn_tx_process_one()) {
+			return;
+		}
+	}
+
 	/* Always kick the TX work. It will self-suspend if it doesn't get
 	 * resources or there is nothing left to send.
 	 */
 	bt_tx_irq_raise();
-
-exit:
-	/* Give back the ref that `get_conn_ready()` gave us */
-	bt_conn_unref(conn);
 }
 
 static void process_unack_tx(struct bt_conn *conn)
@@ -1574,8 +1613,7 @@ struct net_buf *bt_conn_create_pdu_timeout(struct net_buf_pool *pool,
 	 */
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
-	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
-	    k_current_get() == k_work_queue_thread_get(&k_sys_work_q)) {
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) && k_is_in_sys_work_q()) {
 		LOG_WRN("Timeout discarded. No blocking in syswq.");
 		timeout = K_NO_WAIT;
 	}
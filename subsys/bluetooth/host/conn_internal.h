@@ -97,6 +97,10 @@ enum {
 	BT_CONN_CTE_REQ_ENABLED,              /* CTE request procedure is enabled */
 	BT_CONN_CTE_RSP_ENABLED,              /* CTE response procedure is enabled */
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	BT_CONN_ISO_RX_READY,                 /* ISO data may be delivered to the channel */
+#endif /* CONFIG_BT_ISO_RX_WQ */
+
 	/* Total number of flags - must be at the end of the enum */
 	BT_CONN_NUM_FLAGS,
 };
@@ -198,6 +202,36 @@ struct bt_conn_iso {
 
 	/** Queue from which conn will pull data */
 	struct k_fifo                   txq;
+
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	/** SDUs queued with bt_iso_chan_send_sched(), moved to txq as the
+	 *  controller completes the SDUs it holds.
+	 */
+	struct k_fifo                   sched_q;
+
+	/** Number of SDUs handed to the controller and not completed yet */
+	atomic_t                        sched_in_flight;
+
+	/** Set by a scheduled SDU, cleared when an underrun is reported */
+	atomic_t                        sched_active;
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
+#if defined(CONFIG_BT_ISO_STATS)
+	/** Statistics of the channel, updated under stats_lock */
+	struct bt_iso_chan_stats        stats;
+	struct k_spinlock               stats_lock;
+
+	/** Number of SDUs queued and not yet completed */
+	uint16_t                        tx_pending;
+
+	/** Cycle count when the first fragment of the current RX SDU arrived */
+	uint32_t                        rx_start_cyc;
+
+	/** Arrival cycle count and timestamp of the last timestamped RX SDU */
+	uint32_t                        rx_last_cyc;
+	uint32_t                        rx_last_ts;
+	bool                            rx_last_valid;
+#endif /* CONFIG_BT_ISO_STATS */
 };
 
 typedef void (*bt_conn_tx_cb_t)(struct bt_conn *conn, void *user_data, int err);
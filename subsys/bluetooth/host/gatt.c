@@ -65,6 +65,15 @@ LOG_MODULE_REGISTER(bt_gatt);
 
 static uint16_t last_static_handle;
 
+#if defined(CONFIG_BT_GATT_STATIC_SVC_INDEX)
+/* First handle of each static service, in section order */
+static uint16_t static_svc_start[CONFIG_BT_GATT_STATIC_SVC_INDEX_SIZE];
+/* Section indexes of the static services sorted by attribute address */
+static uint8_t static_svc_by_addr[CONFIG_BT_GATT_STATIC_SVC_INDEX_SIZE];
+/* Number of indexed static services, 0 if the index is not used */
+static uint8_t static_svc_count;
+#endif /* CONFIG_BT_GATT_STATIC_SVC_INDEX */
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -1511,6 +1520,97 @@ static void gatt_store_ccc_cf(uint8_t id, const bt_addr_le_t *peer_addr)
 	}
 }
 
+#if defined(CONFIG_BT_GATT_STATIC_SVC_INDEX)
+static const struct bt_gatt_service_static *static_svc_get(size_t index)
+{
+	struct bt_gatt_service_static *svc;
+
+	STRUCT_SECTION_GET(bt_gatt_service_static, index, &svc);
+
+	return svc;
+}
+
+static void static_svc_index_init(void)
+{
+	size_t count;
+	uint16_t handle = 1;
+
+	STRUCT_SECTION_COUNT(bt_gatt_service_static, &count);
+	if (count == 0U || count > ARRAY_SIZE(static_svc_start)) {
+		LOG_WRN("%zu static services, not indexed", count);
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const struct bt_gatt_attr *attrs = static_svc_get(i)->attrs;
+		size_t j = i;
+
+		static_svc_start[i] = handle;
+		handle += static_svc_get(i)->attr_count;
+
+		/* Insertion sort, once at init */
+		while (j > 0 && static_svc_get(static_svc_by_addr[j - 1])->attrs > attrs) {
+			static_svc_by_addr[j] = static_svc_by_addr[j - 1];
+			j--;
+		}
+
+		static_svc_by_addr[j] = i;
+	}
+
+	static_svc_count = count;
+}
+
+/* Section index of the static service holding handle, or -1 */
+static int static_svc_index_find_handle(uint16_t handle)
+{
+	size_t lo = 0, hi = static_svc_count;
+
+	if (handle == 0U || handle > last_static_handle) {
+		return -1;
+	}
+
+	/* Last service starting at or before handle */
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (static_svc_start[mid] <= handle) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static uint16_t static_svc_index_attr_handle(const struct bt_gatt_attr *attr)
+{
+	const struct bt_gatt_service_static *svc;
+	size_t lo = 0, hi = static_svc_count;
+	size_t index;
+
+	/* Last service whose attributes start at or before attr */
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (static_svc_get(static_svc_by_addr[mid])->attrs <= attr) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	index = static_svc_by_addr[lo];
+	svc = static_svc_get(index);
+
+	if (attr < &svc->attrs[0] || attr >= &svc->attrs[svc->attr_count]) {
+		return 0;
+	}
+
+	return static_svc_start[index] + (attr - svc->attrs);
+}
+#endif /* CONFIG_BT_GATT_STATIC_SVC_INDEX */
+
 static void bt_gatt_service_init(void)
 {
 	if (atomic_test_and_set_bit(gatt_flags, GATT_SERVICE_INITIALIZED)) {
@@ -1520,6 +1620,10 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+#if defined(CONFIG_BT_GATT_STATIC_SVC_INDEX)
+	static_svc_index_init();
+#endif /* CONFIG_BT_GATT_STATIC_SVC_INDEX */
 }
 
 void bt_gatt_init(void)
@@ -1895,6 +1999,12 @@ uint16_t bt_gatt_attr_get_handle(const struct bt_gatt_attr *attr)
 		return attr->handle;
 	}
 
+#if defined(CONFIG_BT_GATT_STATIC_SVC_INDEX)
+	if (static_svc_count > 0U) {
+		return static_svc_index_attr_handle(attr);
+	}
+#endif /* CONFIG_BT_GATT_STATIC_SVC_INDEX */
+
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
 		/* Skip ahead if start is not within service attributes array */
 		if ((attr < &static_svc->attrs[0]) ||
@@ -2044,6 +2154,40 @@ static uint8_t gatt_foreach_iter(const struct bt_gatt_attr *attr,
 	return result;
 }
 
+static bool static_svc_indexed(void)
+{
+#if defined(CONFIG_BT_GATT_STATIC_SVC_INDEX)
+	return static_svc_count > 0U;
+#else
+	return false;
+#endif /* CONFIG_BT_GATT_STATIC_SVC_INDEX */
+}
+
+/* Iterate over the static services from the one holding start_handle */
+static uint8_t foreach_attr_type_static_indexed(uint16_t start_handle, uint16_t end_handle,
+						const struct bt_uuid *uuid,
+						const void *attr_data, uint16_t *num_matches,
+						bt_gatt_attr_func_t func, void *user_data)
+{
+#if defined(CONFIG_BT_GATT_STATIC_SVC_INDEX)
+	for (int index = static_svc_index_find_handle(start_handle);
+	     index >= 0 && index < static_svc_count; index++) {
+		const struct bt_gatt_service_static *static_svc = static_svc_get(index);
+		uint16_t handle = static_svc_start[index];
+
+		for (size_t i = 0; i < static_svc->attr_count; i++, handle++) {
+			if (gatt_foreach_iter(&static_svc->attrs[i], handle, start_handle,
+					      end_handle, uuid, attr_data, num_matches, func,
+					      user_data) == BT_GATT_ITER_STOP) {
+				return BT_GATT_ITER_STOP;
+			}
+		}
+	}
+#endif /* CONFIG_BT_GATT_STATIC_SVC_INDEX */
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
 static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 				    const struct bt_uuid *uuid,
 				    const void *attr_data, uint16_t num_matches,
@@ -2092,7 +2236,13 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
-	if (start_handle <= last_static_handle) {
+	if (start_handle <= last_static_handle && static_svc_indexed()) {
+		if (foreach_attr_type_static_indexed(start_handle, end_handle, uuid, attr_data,
+						     &num_matches, func,
+						     user_data) == BT_GATT_ITER_STOP) {
+			return;
+		}
+	} else if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
 		STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
@@ -123,6 +123,13 @@ static K_WORK_DEFINE(rx_work, rx_work_handler);
 static struct k_work_q bt_workq;
 static K_KERNEL_STACK_DEFINE(rx_thread_stack, CONFIG_BT_RX_STACK_SIZE);
 #endif /* CONFIG_BT_RECV_WORKQ_BT */
+#if defined(CONFIG_BT_ISO_RX_WQ)
+static void iso_rx_work_handler(struct k_work *work);
+static K_WORK_DEFINE(iso_rx_work, iso_rx_work_handler);
+static struct k_work_q iso_rx_workq;
+static K_KERNEL_STACK_DEFINE(iso_rx_thread_stack, CONFIG_BT_ISO_RX_WQ_STACK_SIZE);
+static sys_slist_t iso_rx_queue;
+#endif /* CONFIG_BT_ISO_RX_WQ */
 
 static void init_work(struct k_work *work);
 
@@ -4163,7 +4170,8 @@ static void rx_queue_put(struct net_buf *buf)
 	net_buf_slist_put(&bt_dev.rx_queue, buf);
 
 #if defined(CONFIG_BT_RECV_WORKQ_SYS)
-	const int err = k_work_submit(&rx_work);
+	/* Always the same thread, even with a system work queue per CPU */
+	const int err = k_work_submit_to_queue(&k_sys_work_q, &rx_work);
 #elif defined(CONFIG_BT_RECV_WORKQ_BT)
 	const int err = k_work_submit_to_queue(&bt_workq, &rx_work);
 #endif /* CONFIG_BT_RECV_WORKQ_SYS */
@@ -4172,6 +4180,19 @@ static void rx_queue_put(struct net_buf *buf)
 	}
 }
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+static void iso_rx_queue_put(struct net_buf *buf)
+{
+	net_buf_slist_put(&iso_rx_queue, buf);
+
+	const int err = k_work_submit_to_queue(&iso_rx_workq, &iso_rx_work);
+
+	if (err < 0) {
+		LOG_ERR("Could not submit iso_rx_work: %d", err);
+	}
+}
+#endif /* CONFIG_BT_ISO_RX_WQ */
+
 static int bt_recv_unsafe(struct net_buf *buf)
 {
 	/* Don't pull the type, snice we still need it in the rx queue */
@@ -4204,7 +4225,11 @@ static int bt_recv_unsafe(struct net_buf *buf)
 	}
 #if defined(CONFIG_BT_ISO)
 	case BT_HCI_H4_ISO:
+#if defined(CONFIG_BT_ISO_RX_WQ)
+		iso_rx_queue_put(buf);
+#else
 		rx_queue_put(buf);
+#endif /* CONFIG_BT_ISO_RX_WQ */
 		return 0;
 #endif /* CONFIG_BT_ISO */
 	default:
@@ -4328,7 +4353,7 @@ static void rx_work_handler(struct k_work *work)
 	if (!sys_slist_is_empty(&bt_dev.rx_queue)) {
 
 #if defined(CONFIG_BT_RECV_WORKQ_SYS)
-		err = k_work_submit(&rx_work);
+		err = k_work_submit_to_queue(&k_sys_work_q, &rx_work);
 #elif defined(CONFIG_BT_RECV_WORKQ_BT)
 		err = k_work_submit_to_queue(&bt_workq, &rx_work);
 #endif
@@ -4338,6 +4363,35 @@ static void rx_work_handler(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+/* The work queue only serves ISO data, so it drains the whole queue at once
+ * instead of resubmitting itself for every packet.
+ */
+static void iso_rx_work_handler(struct k_work *work)
+{
+	struct net_buf *buf;
+
+	while ((buf = net_buf_slist_get(&iso_rx_queue)) != NULL) {
+		/* Only ISO data is queued here */
+		(void)net_buf_pull_u8(buf);
+
+		LOG_DBG("buf %p len %u", buf, buf->len);
+
+		hci_iso(buf);
+	}
+}
+
+void bt_iso_rx_flush(void)
+{
+	struct k_work_sync sync;
+
+	/* The ISO RX work queue cannot wait for itself */
+	if (k_current_get() != k_work_queue_thread_get(&iso_rx_workq)) {
+		(void)k_work_flush(&iso_rx_work, &sync);
+	}
+}
+#endif /* CONFIG_BT_ISO_RX_WQ */
+
 #if defined(CONFIG_BT_TESTING)
 k_tid_t bt_testing_tx_tid_get(void)
 {
@@ -4409,6 +4463,15 @@ int bt_enable(bt_ready_cb_t cb)
 	k_thread_name_set(&bt_workq.thread, "BT RX WQ");
 #endif
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	/* ISO RX thread */
+	k_work_queue_init(&iso_rx_workq);
+	k_work_queue_start(&iso_rx_workq, iso_rx_thread_stack,
+			   CONFIG_BT_ISO_RX_WQ_STACK_SIZE,
+			   K_PRIO_COOP(CONFIG_BT_ISO_RX_WQ_PRIO), NULL);
+	k_thread_name_set(&iso_rx_workq.thread, "BT ISO RX WQ");
+#endif /* CONFIG_BT_ISO_RX_WQ */
+
 	err = bt_hci_open(bt_dev.hci, bt_hci_recv);
 	if (err) {
 		LOG_ERR("HCI driver open failed (%d)", err);
@@ -4427,6 +4490,9 @@ int bt_enable(bt_ready_cb_t cb)
 
 int bt_disable(void)
 {
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	struct net_buf *buf;
+#endif /* CONFIG_BT_ISO_RX_WQ */
 	int err;
 
 	if (atomic_test_and_set_bit(bt_dev.flags, BT_DEV_DISABLE)) {
@@ -4489,6 +4555,18 @@ int bt_disable(void)
 	k_thread_abort(&bt_workq.thread);
 #endif
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	/* Abort ISO RX thread, dropping the ISO data it has not processed */
+	k_thread_abort(&iso_rx_workq.thread);
+
+	while ((buf = net_buf_slist_get(&iso_rx_queue)) != NULL) {
+		net_buf_unref(buf);
+	}
+
+	/* The work may have been left pending or running by the abort */
+	k_work_init(&iso_rx_work, iso_rx_work_handler);
+#endif /* CONFIG_BT_ISO_RX_WQ */
+
 	/* Some functions rely on checking this bitfield */
 	memset(bt_dev.supported_commands, 0x00, sizeof(bt_dev.supported_commands));
 
@@ -4822,5 +4900,9 @@ static K_WORK_DEFINE(tx_work, tx_processor);
 void bt_tx_irq_raise(void)
 {
 	LOG_DBG("kick TX");
-	k_work_submit(&tx_work);
+
+	/* Commands and data are sent from k_sys_work_q only, see
+	 * bt_hci_cmd_send_sync() and bt_testing_tx_tid_get().
+	 */
+	k_work_submit_to_queue(&k_sys_work_q, &tx_work);
 }
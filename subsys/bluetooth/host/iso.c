@@ -21,9 +21,11 @@
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/hci_types.h>
 #include <zephyr/bluetooth/iso.h>
+#include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/net_buf.h>
+#include <zephyr/stats/stats.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/byteorder.h>
@@ -93,6 +95,167 @@ struct bt_iso_big bigs[CONFIG_BT_ISO_MAX_BIG];
 static struct bt_iso_big *lookup_big_by_handle(uint8_t big_handle);
 #endif /* CONFIG_BT_ISO_BROADCAST */
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+/* Whether a scheduled SDU may be handed to the controller */
+static bool iso_sched_ready(struct bt_conn *iso)
+{
+	return !k_fifo_is_empty(&iso->iso.sched_q) &&
+	       atomic_get(&iso->iso.sched_in_flight) < CONFIG_BT_ISO_TX_SCHED_DEPTH;
+}
+
+static void iso_sched_sent(struct bt_conn *iso, int err)
+{
+	struct bt_iso_chan *chan = iso->iso.chan;
+
+	if (atomic_dec(&iso->iso.sched_in_flight) <= 0) {
+		atomic_set(&iso->iso.sched_in_flight, 0);
+	}
+
+	if (!k_fifo_is_empty(&iso->iso.sched_q)) {
+		bt_conn_data_ready(iso);
+		return;
+	}
+
+	/* The controller has nothing left to send in the coming intervals */
+	if (err == 0 && atomic_get(&iso->iso.sched_in_flight) == 0 &&
+	    k_fifo_is_empty(&iso->iso.txq) && atomic_cas(&iso->iso.sched_active, 1, 0)) {
+		LOG_DBG("chan %p TX underrun", chan);
+
+		if (chan->ops != NULL && chan->ops->tx_underrun != NULL) {
+			chan->ops->tx_underrun(chan);
+		}
+	}
+}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
+#if defined(CONFIG_BT_ISO_STATS)
+#if defined(CONFIG_STATS)
+STATS_SECT_START(bt_iso_stats)
+STATS_SECT_ENTRY32(tx_sdus)
+STATS_SECT_ENTRY32(tx_dropped)
+STATS_SECT_ENTRY32(rx_sdus)
+STATS_SECT_ENTRY32(rx_lost)
+STATS_SECT_ENTRY32(rx_errors)
+STATS_SECT_END;
+
+STATS_NAME_START(bt_iso_stats)
+STATS_NAME(bt_iso_stats, tx_sdus)
+STATS_NAME(bt_iso_stats, tx_dropped)
+STATS_NAME(bt_iso_stats, rx_sdus)
+STATS_NAME(bt_iso_stats, rx_lost)
+STATS_NAME(bt_iso_stats, rx_errors)
+STATS_NAME_END(bt_iso_stats);
+
+/* Totals of all channels */
+static STATS_SECT_DECL(bt_iso_stats) bt_iso_stats;
+
+static int iso_stats_init(void)
+{
+	return STATS_INIT_AND_REG(bt_iso_stats, STATS_SIZE_32, "bt_iso");
+}
+
+SYS_INIT(iso_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#define ISO_STATS_INC(_var) STATS_INC(bt_iso_stats, _var)
+#else
+#define ISO_STATS_INC(_var)
+#endif /* CONFIG_STATS */
+
+static void iso_stats_reset(struct bt_conn *iso)
+{
+	k_spinlock_key_t key = k_spin_lock(&iso->iso.stats_lock);
+
+	(void)memset(&iso->iso.stats, 0, sizeof(iso->iso.stats));
+	iso->iso.rx_last_valid = false;
+
+	k_spin_unlock(&iso->iso.stats_lock, key);
+}
+
+#if defined(CONFIG_BT_ISO_TX)
+static void iso_stats_tx_queued(struct bt_conn *iso)
+{
+	k_spinlock_key_t key = k_spin_lock(&iso->iso.stats_lock);
+
+	iso->iso.stats.tx_sdus++;
+	iso->iso.tx_pending++;
+	iso->iso.stats.tx_pending_max = MAX(iso->iso.stats.tx_pending_max, iso->iso.tx_pending);
+
+	k_spin_unlock(&iso->iso.stats_lock, key);
+
+	ISO_STATS_INC(tx_sdus);
+}
+
+static void iso_stats_tx_done(struct bt_conn *iso, bool dropped)
+{
+	k_spinlock_key_t key = k_spin_lock(&iso->iso.stats_lock);
+
+	if (iso->iso.tx_pending > 0U) {
+		iso->iso.tx_pending--;
+	}
+
+	if (dropped) {
+		iso->iso.stats.tx_dropped++;
+	}
+
+	k_spin_unlock(&iso->iso.stats_lock, key);
+
+	if (dropped) {
+		ISO_STATS_INC(tx_dropped);
+	}
+}
+#endif /* CONFIG_BT_ISO_TX */
+
+#if defined(CONFIG_BT_ISO_RX)
+static void iso_stats_rx(struct bt_conn *iso, const struct bt_iso_recv_info *info)
+{
+	const uint32_t start = iso->iso.rx_start_cyc;
+	const uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	k_spinlock_key_t key = k_spin_lock(&iso->iso.stats_lock);
+	struct bt_iso_chan_stats *stats = &iso->iso.stats;
+
+	stats->rx_sdus++;
+	if ((info->flags & BT_ISO_FLAGS_LOST) != 0) {
+		stats->rx_lost++;
+	}
+
+	if ((info->flags & BT_ISO_FLAGS_ERROR) != 0) {
+		stats->rx_errors++;
+	}
+
+	stats->rx_latency_us = latency_us;
+	stats->rx_latency_max_us = MAX(stats->rx_latency_max_us, latency_us);
+
+	/* The controller timestamps give the time the SDUs should have reached the host at */
+	if ((info->flags & BT_ISO_FLAGS_TS) != 0) {
+		const uint32_t ts_us = info->ts - iso->iso.rx_last_ts;
+
+		if (iso->iso.rx_last_valid && ts_us < USEC_PER_SEC) {
+			const uint32_t host_us = k_cyc_to_us_floor32(start - iso->iso.rx_last_cyc);
+			const uint32_t jitter_us = host_us > ts_us ? host_us - ts_us :
+						   ts_us - host_us;
+
+			stats->rx_jitter_max_us = MAX(stats->rx_jitter_max_us, jitter_us);
+		}
+
+		iso->iso.rx_last_cyc = start;
+		iso->iso.rx_last_ts = info->ts;
+		iso->iso.rx_last_valid = true;
+	}
+
+	k_spin_unlock(&iso->iso.stats_lock, key);
+
+	ISO_STATS_INC(rx_sdus);
+	if ((info->flags & BT_ISO_FLAGS_LOST) != 0) {
+		ISO_STATS_INC(rx_lost);
+	}
+
+	if ((info->flags & BT_ISO_FLAGS_ERROR) != 0) {
+		ISO_STATS_INC(rx_errors);
+	}
+}
+#endif /* CONFIG_BT_ISO_RX */
+#endif /* CONFIG_BT_ISO_STATS */
+
 static void bt_iso_sent_cb(struct bt_conn *iso, void *user_data, int err)
 {
 #if defined(CONFIG_BT_ISO_TX)
@@ -106,6 +269,14 @@ static void bt_iso_sent_cb(struct bt_conn *iso, void *user_data, int err)
 	if (!err && ops != NULL && ops->sent != NULL) {
 		ops->sent(chan);
 	}
+
+#if defined(CONFIG_BT_ISO_STATS)
+	iso_stats_tx_done(iso, err != 0);
+#endif /* CONFIG_BT_ISO_STATS */
+
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	iso_sched_sent(iso, err);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 #endif /* CONFIG_BT_ISO_TX */
 }
 
@@ -149,7 +320,22 @@ void hci_iso(struct net_buf *buf)
 
 	iso(buf)->index = bt_conn_index(iso);
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	/* ISO data is processed in its own work queue while the channel is
+	 * connected and disconnected in the HCI event context, so the data may
+	 * overtake the events. It is only delivered between the connected and
+	 * disconnected callbacks of the channel.
+	 */
+	if (atomic_test_bit(iso->flags, BT_CONN_ISO_RX_READY)) {
+		bt_conn_recv(iso, buf, flags);
+	} else {
+		BT_ISO_DATA_DBG("Dropping data for handle %u in state %u", iso->handle,
+				iso->state);
+		net_buf_unref(buf);
+	}
+#else
 	bt_conn_recv(iso, buf, flags);
+#endif /* CONFIG_BT_ISO_RX_WQ */
 	bt_conn_unref(iso);
 }
 
@@ -235,6 +421,15 @@ static void bt_iso_chan_add(struct bt_conn *iso, struct bt_iso_chan *chan)
 	chan->iso = iso;
 	iso->iso.chan = chan;
 	k_fifo_init(&iso->iso.txq);
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	k_fifo_init(&iso->iso.sched_q);
+	atomic_set(&iso->iso.sched_in_flight, 0);
+	atomic_set(&iso->iso.sched_active, 0);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+#if defined(CONFIG_BT_ISO_STATS)
+	iso->iso.tx_pending = 0U;
+	iso_stats_reset(iso);
+#endif /* CONFIG_BT_ISO_STATS */
 
 	LOG_DBG("iso %p chan %p", iso, chan);
 }
@@ -449,6 +644,10 @@ void bt_iso_connected(struct bt_conn *iso)
 	if (chan->ops->connected) {
 		chan->ops->connected(chan);
 	}
+
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	atomic_set_bit(iso->flags, BT_CONN_ISO_RX_READY);
+#endif /* CONFIG_BT_ISO_RX_WQ */
 }
 
 static void bt_iso_chan_disconnected(struct bt_iso_chan *chan, uint8_t reason)
@@ -460,12 +659,32 @@ static void bt_iso_chan_disconnected(struct bt_iso_chan *chan, uint8_t reason)
 
 	__ASSERT(chan->iso != NULL, "NULL conn for iso chan %p", chan);
 
+#if defined(CONFIG_BT_ISO_RX_WQ)
+	/* No SDU shall be delivered from here on, nor be in delivery */
+	atomic_clear_bit(chan->iso->flags, BT_CONN_ISO_RX_READY);
+	bt_iso_rx_flush();
+#endif /* CONFIG_BT_ISO_RX_WQ */
+
 	/* release buffers from tx_queue */
 	while ((buf = k_fifo_get(&chan->iso->iso.txq, K_NO_WAIT))) {
 		__ASSERT_NO_MSG(!bt_buf_has_view(buf));
 		net_buf_unref(buf);
+#if defined(CONFIG_BT_ISO_STATS) && defined(CONFIG_BT_ISO_TX)
+		iso_stats_tx_done(chan->iso, true);
+#endif /* CONFIG_BT_ISO_STATS && CONFIG_BT_ISO_TX */
+	}
+
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	while ((buf = k_fifo_get(&chan->iso->iso.sched_q, K_NO_WAIT))) {
+		net_buf_unref(buf);
+#if defined(CONFIG_BT_ISO_STATS)
+		iso_stats_tx_done(chan->iso, true);
+#endif /* CONFIG_BT_ISO_STATS */
 	}
 
+	atomic_set(&chan->iso->iso.sched_active, 0);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 	bt_iso_chan_set_state(chan, BT_ISO_STATE_DISCONNECTED);
 	bt_conn_set_state(chan->iso, BT_CONN_DISCONNECT_COMPLETE);
 
@@ -635,6 +854,39 @@ void bt_iso_buf_rx_freed_cb_set(bt_iso_buf_rx_freed_cb_t cb)
 	buf_rx_freed_cb = cb;
 }
 
+/* Add a continuation or end fragment to the SDU being received, consuming buf */
+static int iso_rx_append(struct bt_conn *iso, struct net_buf *buf)
+{
+	/* The fragments shall not add up to more than the announced SDU length */
+	if (buf->len > iso->rx_len) {
+		LOG_ERR("ISO fragment too long (len %u rx_len %u)", buf->len, iso->rx_len);
+		net_buf_unref(buf);
+		return -EMSGSIZE;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_ISO_RX_FRAG_CHAIN)) {
+		/* Empty fragments would only hold on to RX buffers */
+		if (buf->len == 0U) {
+			net_buf_unref(buf);
+		} else {
+			net_buf_frag_add(iso->rx, buf);
+		}
+
+		return 0;
+	}
+
+	if (buf->len > net_buf_tailroom(iso->rx)) {
+		LOG_ERR("Not enough buffer space for ISO data");
+		net_buf_unref(buf);
+		return -ENOMEM;
+	}
+
+	net_buf_add_mem(iso->rx, buf->data, buf->len);
+	net_buf_unref(buf);
+
+	return 0;
+}
+
 void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 {
 	struct bt_hci_iso_sdu_hdr *hdr;
@@ -694,12 +946,22 @@ void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 				pb == BT_ISO_START ? "Start" : "Single", buf->len, len, flags,
 				iso_info(buf)->ts);
 
+#if defined(CONFIG_BT_ISO_STATS)
+		iso->iso.rx_start_cyc = k_cycle_get_32();
+#endif /* CONFIG_BT_ISO_STATS */
+
 		if (iso->rx) {
 			LOG_ERR("Unexpected ISO %s fragment",
 				pb == BT_ISO_START ? "Start" : "Single");
 			bt_conn_reset_rx_state(iso);
 		}
 
+		if (buf->len > len) {
+			LOG_ERR("ISO fragment too long (len %u SDU len %u)", buf->len, len);
+			net_buf_unref(buf);
+			return;
+		}
+
 		iso->rx = buf;
 		iso->rx_len = len - buf->len;
 		if (iso->rx_len) {
@@ -726,16 +988,13 @@ void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 
 		BT_ISO_DATA_DBG("Cont, len %u rx_len %u", buf->len, iso->rx_len);
 
-		if (buf->len > net_buf_tailroom(iso->rx)) {
-			LOG_ERR("Not enough buffer space for ISO data");
+		len = buf->len;
+		if (iso_rx_append(iso, buf) != 0) {
 			bt_conn_reset_rx_state(iso);
-			net_buf_unref(buf);
 			return;
 		}
 
-		net_buf_add_mem(iso->rx, buf->data, buf->len);
-		iso->rx_len -= buf->len;
-		net_buf_unref(buf);
+		iso->rx_len -= len;
 		return;
 
 	case BT_ISO_END:
@@ -750,17 +1009,13 @@ void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 			return;
 		}
 
-		if (buf->len > net_buf_tailroom(iso->rx)) {
-			LOG_ERR("Not enough buffer space for ISO data");
+		len = buf->len;
+		if (iso_rx_append(iso, buf) != 0) {
 			bt_conn_reset_rx_state(iso);
-			net_buf_unref(buf);
 			return;
 		}
 
-		(void)net_buf_add_mem(iso->rx, buf->data, buf->len);
-		iso->rx_len -= buf->len;
-		net_buf_unref(buf);
-
+		iso->rx_len -= len;
 		break;
 	default:
 		LOG_ERR("Unexpected ISO pb flags (0x%02x)", pb);
@@ -772,8 +1027,17 @@ void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 	chan = iso_chan(iso);
 	if (chan == NULL) {
 		LOG_ERR("Could not lookup chan from receiving ISO");
-	} else if (chan->ops->recv != NULL) {
-		chan->ops->recv(chan, iso_info(iso->rx), iso->rx);
+	} else {
+#if defined(CONFIG_BT_ISO_STATS)
+		iso_stats_rx(iso, iso_info(iso->rx));
+#endif /* CONFIG_BT_ISO_STATS */
+
+		sys_port_trace_bt_iso_recv(chan, iso_info(iso->rx)->seq_num,
+					   iso_info(iso->rx)->flags);
+
+		if (chan->ops->recv != NULL) {
+			chan->ops->recv(chan, iso_info(iso->rx), iso->rx);
+		}
 	}
 
 	bt_conn_reset_rx_state(iso);
@@ -782,7 +1046,10 @@ void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 
 static bool iso_has_data(struct bt_conn *conn)
 {
-#if defined(CONFIG_BT_ISO_TX)
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	return ((conn->iso.chan->state == BT_ISO_STATE_CONNECTED) &&
+		(!k_fifo_is_empty(&conn->iso.txq) || iso_sched_ready(conn)));
+#elif defined(CONFIG_BT_ISO_TX)
 	return ((conn->iso.chan->state == BT_ISO_STATE_CONNECTED) &&
 		!k_fifo_is_empty(&conn->iso.txq));
 #else  /* !CONFIG_BT_ISO_TX */
@@ -795,6 +1062,15 @@ static struct net_buf *iso_data_pull(struct bt_conn *conn, size_t amount, size_t
 #if defined(CONFIG_BT_ISO_TX)
 	BT_ISO_DATA_DBG("conn %p amount %d", conn, amount);
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	/* Scheduled SDUs go after the ones sent directly, and only as the
+	 * controller makes room for them
+	 */
+	if (k_fifo_is_empty(&conn->iso.txq) && iso_sched_ready(conn)) {
+		k_fifo_put(&conn->iso.txq, k_fifo_get(&conn->iso.sched_q, K_NO_WAIT));
+	}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 	/* Leave the PDU buffer in the queue until we have sent all its
 	 * fragments.
 	 */
@@ -837,6 +1113,10 @@ static struct net_buf *iso_data_pull(struct bt_conn *conn, size_t amount, size_t
 		__ASSERT_NO_MSG(q_frag == frag);
 
 		net_buf_unref(q_frag);
+
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+		atomic_inc(&conn->iso.sched_in_flight);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 	}
 
 	*length = frag->len;
@@ -879,6 +1159,10 @@ int conn_iso_send(struct bt_conn *conn, struct net_buf *buf, enum bt_iso_timesta
 	k_fifo_put(&conn->iso.txq, buf);
 	BT_ISO_DATA_DBG("%p put on list", buf);
 
+#if defined(CONFIG_BT_ISO_STATS)
+	iso_stats_tx_queued(conn);
+#endif /* CONFIG_BT_ISO_STATS */
+
 	/* only one ISO channel per conn-object */
 	bt_conn_data_ready(conn);
 
@@ -957,14 +1241,26 @@ int bt_iso_chan_send(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq
 
 	iso_conn = chan->iso;
 
+	sys_port_trace_bt_iso_send(chan, seq_num);
+
 	BT_ISO_DATA_DBG("send-iso (no ts)");
 	return conn_iso_send(iso_conn, buf, BT_ISO_TS_ABSENT);
 }
 
+static void iso_push_ts_hdr(struct net_buf *buf, uint16_t seq_num, uint32_t ts)
+{
+	struct bt_hci_iso_sdu_ts_hdr *hdr;
+
+	hdr = net_buf_push(buf, sizeof(*hdr));
+	hdr->ts = sys_cpu_to_le32(ts);
+	hdr->sdu.sn = sys_cpu_to_le16(seq_num);
+	hdr->sdu.slen = sys_cpu_to_le16(
+		bt_iso_pkt_len_pack(net_buf_frags_len(buf) - sizeof(*hdr), BT_ISO_DATA_VALID));
+}
+
 int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
 			uint32_t ts)
 {
-	struct bt_hci_iso_sdu_ts_hdr *hdr;
 	struct bt_conn *iso_conn;
 	int err;
 
@@ -975,18 +1271,53 @@ int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t
 
 	BT_ISO_DATA_DBG("chan %p len %zu", chan, net_buf_frags_len(buf));
 
-	hdr = net_buf_push(buf, sizeof(*hdr));
-	hdr->ts = sys_cpu_to_le32(ts);
-	hdr->sdu.sn = sys_cpu_to_le16(seq_num);
-	hdr->sdu.slen = sys_cpu_to_le16(
-		bt_iso_pkt_len_pack(net_buf_frags_len(buf) - sizeof(*hdr), BT_ISO_DATA_VALID));
+	iso_push_ts_hdr(buf, seq_num, ts);
 
 	iso_conn = chan->iso;
 
+	sys_port_trace_bt_iso_send(chan, seq_num);
+
 	LOG_DBG("send-iso (ts)");
 	return conn_iso_send(iso_conn, buf, BT_ISO_TS_PRESENT);
 }
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+int bt_iso_chan_send_sched(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
+			   uint32_t ts)
+{
+	struct bt_conn *iso_conn;
+	int err;
+
+	err = validate_send(chan, buf, BT_HCI_ISO_SDU_TS_HDR_SIZE);
+	if (err != 0) {
+		return err;
+	}
+
+	if (buf->user_data_size < CONFIG_BT_CONN_TX_USER_DATA_SIZE) {
+		LOG_ERR("not enough room in user_data %d < %d pool %u", buf->user_data_size,
+			CONFIG_BT_CONN_TX_USER_DATA_SIZE, buf->pool_id);
+		return -EINVAL;
+	}
+
+	BT_ISO_DATA_DBG("chan %p len %zu ts %u", chan, net_buf_frags_len(buf), ts);
+
+	iso_push_ts_hdr(buf, seq_num, ts);
+
+	iso_conn = chan->iso;
+	atomic_set(&iso_conn->iso.sched_active, 1);
+
+	sys_port_trace_bt_iso_send(chan, seq_num);
+
+	k_fifo_put(&iso_conn->iso.sched_q, buf);
+#if defined(CONFIG_BT_ISO_STATS)
+	iso_stats_tx_queued(iso_conn);
+#endif /* CONFIG_BT_ISO_STATS */
+	bt_conn_data_ready(iso_conn);
+
+	return 0;
+}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 #if defined(CONFIG_BT_ISO_CENTRAL) || defined(CONFIG_BT_ISO_BROADCASTER)
 static bool valid_chan_io_qos(const struct bt_iso_chan_io_qos *io_qos, bool is_tx,
 			      bool is_broadcast, bool advanced)
@@ -1090,6 +1421,13 @@ int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_inf
 		info->seq_num = sys_le16_to_cpu(rp->seq);
 		info->offset = sys_get_le24(rp->offset);
 
+#if defined(CONFIG_BT_ISO_STATS)
+		k_spinlock_key_t key = k_spin_lock(&chan->iso->iso.stats_lock);
+
+		chan->iso->iso.stats.tx_sync_offset = info->offset;
+		k_spin_unlock(&chan->iso->iso.stats_lock, key);
+#endif /* CONFIG_BT_ISO_STATS */
+
 		net_buf_unref(rsp);
 	} else {
 		return -ENOTSUP;
@@ -1099,6 +1437,36 @@ int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_inf
 }
 #endif /* CONFIG_BT_ISO_TX */
 
+#if defined(CONFIG_BT_ISO_STATS)
+int bt_iso_chan_get_stats(const struct bt_iso_chan *chan, struct bt_iso_chan_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF(chan == NULL || chan->iso == NULL || stats == NULL) {
+		LOG_DBG("Invalid parameters: chan %p stats %p", chan, stats);
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&chan->iso->iso.stats_lock);
+	*stats = chan->iso->iso.stats;
+	k_spin_unlock(&chan->iso->iso.stats_lock, key);
+
+	return 0;
+}
+
+int bt_iso_chan_reset_stats(struct bt_iso_chan *chan)
+{
+	CHECKIF(chan == NULL || chan->iso == NULL) {
+		LOG_DBG("Invalid parameter: chan %p", chan);
+		return -EINVAL;
+	}
+
+	iso_stats_reset(chan->iso);
+
+	return 0;
+}
+#endif /* CONFIG_BT_ISO_STATS */
+
 #if defined(CONFIG_BT_ISO_UNICAST)
 int bt_iso_chan_disconnect(struct bt_iso_chan *chan)
 {
@@ -81,6 +81,9 @@ struct bt_iso_big {
 /* Process ISO buffer */
 void hci_iso(struct net_buf *buf);
 
+/* Wait for the ISO data being processed in the ISO RX work queue */
+void bt_iso_rx_flush(void);
+
 /* Allocates RX buffer */
 struct net_buf *bt_iso_get_rx(k_timeout_t timeout);
 
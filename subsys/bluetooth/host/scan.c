@@ -21,6 +21,7 @@
 #include <zephyr/bluetooth/addr.h>
 #include <zephyr/bluetooth/hci.h>
 #include <zephyr/bluetooth/hci_vs.h>
+#include <zephyr/bluetooth/uuid.h>
 #include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/sys/__assert.h>
@@ -66,6 +67,26 @@ static sys_slist_t scan_cbs = SYS_SLIST_STATIC_INIT(&scan_cbs);
 
 static struct scanner_state scan_state;
 
+#if defined(CONFIG_BT_SCAN_FILTER)
+/* Number of slots probed for a report in the duplicate table */
+#define SCAN_FILTER_DEDUP_PROBE MIN(4, CONFIG_BT_SCAN_FILTER_DEDUP_COUNT)
+
+struct scan_filter_dedup_entry {
+	/* Hash of address and data, 0 for a free entry */
+	uint32_t hash;
+	uint32_t last_seen;
+};
+
+static struct {
+	struct k_spinlock lock;
+	bool enabled;
+	struct bt_le_scan_filter param;
+	struct scan_filter_dedup_entry dedup[CONFIG_BT_SCAN_FILTER_DEDUP_COUNT];
+	uint32_t rate_window_start;
+	uint16_t rate_count;
+} scan_filter;
+#endif /* CONFIG_BT_SCAN_FILTER */
+
 #if defined(CONFIG_BT_EXT_ADV)
 /* A buffer used to reassemble advertisement data from the controller. */
 NET_BUF_SIMPLE_DEFINE(ext_scan_buf, CONFIG_BT_EXT_SCAN_BUF_SIZE);
@@ -626,42 +647,235 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
-static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
-			struct net_buf_simple *buf, uint16_t len)
+#if defined(CONFIG_BT_SCAN_FILTER)
+struct scan_filter_ad_match {
+	const struct bt_le_scan_filter *param;
+	bool uuid;
+	bool company_id;
+};
+
+static bool scan_filter_uuid_match(const struct bt_data *data, size_t uuid_len,
+				   const struct bt_uuid *uuid)
 {
-	struct bt_le_scan_cb *listener, *next;
+	for (size_t i = 0; i + uuid_len <= data->data_len; i += uuid_len) {
+		struct bt_uuid_any found;
+
+		if (bt_uuid_create(&found.uuid, &data->data[i], uuid_len) &&
+		    bt_uuid_cmp(&found.uuid, uuid) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool scan_filter_ad_cb(struct bt_data *data, void *user_data)
+{
+	struct scan_filter_ad_match *match = user_data;
+	const struct bt_le_scan_filter *param = match->param;
+
+	switch (data->type) {
+	case BT_DATA_UUID16_SOME:
+	case BT_DATA_UUID16_ALL:
+		match->uuid |= scan_filter_uuid_match(data, BT_UUID_SIZE_16, param->uuid);
+		break;
+	case BT_DATA_UUID32_SOME:
+	case BT_DATA_UUID32_ALL:
+		match->uuid |= scan_filter_uuid_match(data, BT_UUID_SIZE_32, param->uuid);
+		break;
+	case BT_DATA_UUID128_SOME:
+	case BT_DATA_UUID128_ALL:
+		match->uuid |= scan_filter_uuid_match(data, BT_UUID_SIZE_128, param->uuid);
+		break;
+	case BT_DATA_MANUFACTURER_DATA:
+		match->company_id |= data->data_len >= sizeof(uint16_t) &&
+				     sys_get_le16(data->data) == param->company_id;
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
+/* FNV-1a over the address and the data of a report */
+static uint32_t scan_filter_hash(const bt_addr_le_t *addr, const uint8_t *data, uint16_t len)
+{
+	const uint8_t *addr_data = (const uint8_t *)addr;
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < sizeof(*addr); i++) {
+		hash = (hash ^ addr_data[i]) * 16777619U;
+	}
+
+	for (uint16_t i = 0; i < len; i++) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+
+	return hash != 0U ? hash : 1U;
+}
+
+/*
+ * Returns the entry of a report, or the least recently passed entry of the
+ * probed slots to replace. dup is set if the report was passed recently.
+ */
+static struct scan_filter_dedup_entry *scan_filter_dedup(uint32_t hash, uint32_t now, bool *dup)
+{
+	const uint16_t timeout = scan_filter.param.dedup_timeout;
+	struct scan_filter_dedup_entry *oldest = NULL;
+
+	*dup = false;
+
+	for (size_t i = 0; i < SCAN_FILTER_DEDUP_PROBE; i++) {
+		struct scan_filter_dedup_entry *entry =
+			&scan_filter.dedup[(hash + i) % ARRAY_SIZE(scan_filter.dedup)];
+
+		if (entry->hash == hash) {
+			*dup = timeout == 0U || now - entry->last_seen < timeout;
+
+			return entry;
+		}
+
+		if (entry->hash == 0U) {
+			return entry;
+		}
+
+		if (oldest == NULL || (int32_t)(entry->last_seen - oldest->last_seen) < 0) {
+			oldest = entry;
+		}
+	}
+
+	return oldest;
+}
+
+static bool scan_filter_pass(const bt_addr_le_t *id_addr, const bt_addr_le_t *addr,
+			     struct net_buf_simple *buf, uint16_t len)
+{
+	const struct bt_le_scan_filter *param = &scan_filter.param;
+	struct scan_filter_ad_match match = {
+		.param = param,
+	};
+	struct scan_filter_dedup_entry *dedup = NULL;
 	struct net_buf_simple_state state;
-	bt_addr_le_t id_addr;
+	k_spinlock_key_t key;
+	uint32_t hash = 0U;
+	uint32_t now;
+	bool pass = false;
+	bool dup;
 
-	LOG_DBG("%s event %u, len %u, rssi %d dBm", bt_addr_le_str(addr), info->adv_type, len,
-		info->rssi);
+	if (!scan_filter.enabled) {
+		return true;
+	}
 
-	if (!IS_ENABLED(CONFIG_BT_PRIVACY) && !IS_ENABLED(CONFIG_BT_SCAN_WITH_IDENTITY) &&
-	    atomic_test_bit(scan_state.scan_flags, BT_LE_SCAN_USER_EXPLICIT_SCAN) &&
-	    (info->adv_props & BT_HCI_LE_ADV_PROP_DIRECT)) {
-		LOG_DBG("Dropped direct adv report");
-		return;
+	key = k_spin_lock(&scan_filter.lock);
+
+	if ((param->options & BT_LE_SCAN_FILTER_OPT_ADDR) != 0U &&
+	    !bt_addr_le_eq(&param->addr, id_addr) && !bt_addr_le_eq(&param->addr, addr)) {
+		goto unlock;
 	}
 
-	if (bt_addr_le_is_resolved(addr)) {
-		bt_addr_le_copy_resolved(&id_addr, addr);
-	} else if (addr->type == BT_HCI_PEER_ADDR_ANONYMOUS) {
-		bt_addr_le_copy(&id_addr, BT_ADDR_LE_ANY);
-	} else {
-		bt_addr_le_copy(&id_addr,
-				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
+	if ((param->options & (BT_LE_SCAN_FILTER_OPT_UUID | BT_LE_SCAN_FILTER_OPT_COMPANY_ID)) !=
+	    0U) {
+		net_buf_simple_save(buf, &state);
+		buf->len = len;
+		bt_data_parse(buf, scan_filter_ad_cb, &match);
+		net_buf_simple_restore(buf, &state);
+
+		if (((param->options & BT_LE_SCAN_FILTER_OPT_UUID) != 0U && !match.uuid) ||
+		    ((param->options & BT_LE_SCAN_FILTER_OPT_COMPANY_ID) != 0U &&
+		     !match.company_id)) {
+			goto unlock;
+		}
+	}
+
+	now = k_uptime_get_32();
+
+	if ((param->options & BT_LE_SCAN_FILTER_OPT_DEDUP) != 0U) {
+		hash = scan_filter_hash(addr, buf->data, len);
+		dedup = scan_filter_dedup(hash, now, &dup);
+		if (dup) {
+			goto unlock;
+		}
+	}
+
+	if (param->max_rate != 0U) {
+		if (now - scan_filter.rate_window_start >= MSEC_PER_SEC) {
+			scan_filter.rate_window_start = now;
+			scan_filter.rate_count = 0U;
+		}
+
+		if (scan_filter.rate_count >= param->max_rate) {
+			goto unlock;
+		}
+
+		scan_filter.rate_count++;
+	}
+
+	/*
+	 * Only a report passed to the application starts a new timeout, a
+	 * report repeated more often than the timeout still passes again.
+	 */
+	if (dedup != NULL) {
+		dedup->hash = hash;
+		dedup->last_seen = now;
 	}
 
+	pass = true;
+
+unlock:
+	k_spin_unlock(&scan_filter.lock, key);
+
+	return pass;
+}
+
+int bt_le_scan_filter_set(const struct bt_le_scan_filter *filter)
+{
+	k_spinlock_key_t key;
+
+	if (filter != NULL && (filter->options & BT_LE_SCAN_FILTER_OPT_UUID) != 0U &&
+	    filter->uuid == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&scan_filter.lock);
+
+	if (filter != NULL) {
+		scan_filter.param = *filter;
+	}
+
+	scan_filter.enabled = filter != NULL;
+	scan_filter.rate_window_start = k_uptime_get_32();
+	scan_filter.rate_count = 0U;
+	memset(scan_filter.dedup, 0, sizeof(scan_filter.dedup));
+
+	k_spin_unlock(&scan_filter.lock, key);
+
+	return 0;
+}
+#else
+static bool scan_filter_pass(const bt_addr_le_t *id_addr, const bt_addr_le_t *addr,
+			     struct net_buf_simple *buf, uint16_t len)
+{
+	return true;
+}
+#endif /* CONFIG_BT_SCAN_FILTER */
+
+static void le_adv_recv_notify(bt_addr_le_t *id_addr, struct bt_le_scan_recv_info *info,
+			       struct net_buf_simple *buf, uint16_t len)
+{
+	struct bt_le_scan_cb *listener, *next;
+	struct net_buf_simple_state state;
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
 		buf->len = len;
-		scan_dev_found_cb(&id_addr, info->rssi, info->adv_type, buf);
+		scan_dev_found_cb(id_addr, info->rssi, info->adv_type, buf);
 
 		net_buf_simple_restore(buf, &state);
 	}
 
-	info->addr = &id_addr;
+	info->addr = id_addr;
 
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&scan_cbs, listener, next, node) {
 		if (listener->recv) {
@@ -676,6 +890,35 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 
 	/* Clear pointer to this stack frame before returning to calling function */
 	info->addr = NULL;
+}
+
+static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
+			struct net_buf_simple *buf, uint16_t len)
+{
+	bt_addr_le_t id_addr;
+
+	LOG_DBG("%s event %u, len %u, rssi %d dBm", bt_addr_le_str(addr), info->adv_type, len,
+		info->rssi);
+
+	if (!IS_ENABLED(CONFIG_BT_PRIVACY) && !IS_ENABLED(CONFIG_BT_SCAN_WITH_IDENTITY) &&
+	    atomic_test_bit(scan_state.scan_flags, BT_LE_SCAN_USER_EXPLICIT_SCAN) &&
+	    (info->adv_props & BT_HCI_LE_ADV_PROP_DIRECT)) {
+		LOG_DBG("Dropped direct adv report");
+		return;
+	}
+
+	if (bt_addr_le_is_resolved(addr)) {
+		bt_addr_le_copy_resolved(&id_addr, addr);
+	} else if (addr->type == BT_HCI_PEER_ADDR_ANONYMOUS) {
+		bt_addr_le_copy(&id_addr, BT_ADDR_LE_ANY);
+	} else {
+		bt_addr_le_copy(&id_addr,
+				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
+	}
+
+	if (scan_filter_pass(&id_addr, addr, buf, len)) {
+		le_adv_recv_notify(&id_addr, info, buf, len);
+	}
 
 #if defined(CONFIG_BT_CENTRAL)
 	check_pending_conn(&id_addr, addr, info->adv_props);
@@ -991,6 +991,57 @@ static int cmd_big_term(const struct shell *sh, size_t argc, char *argv[])
 }
 #endif /* CONFIG_BT_ISO_BROADCAST*/
 
+#if defined(CONFIG_BT_ISO_STATS)
+static void print_stats(const struct shell *sh, const char *name, const struct bt_iso_chan *chan)
+{
+	struct bt_iso_chan_stats stats;
+	int err;
+
+	if (chan->iso == NULL) {
+		return;
+	}
+
+	err = bt_iso_chan_get_stats(chan, &stats);
+	if (err != 0) {
+		shell_error(sh, "Unable to get %s stats (err %d)", name, err);
+		return;
+	}
+
+	shell_print(sh, "%s stats:\n\tTX SDUs=%u dropped=%u pending max=%u sync offset=%u us",
+		    name, stats.tx_sdus, stats.tx_dropped, stats.tx_pending_max,
+		    stats.tx_sync_offset);
+	shell_print(sh, "\tRX SDUs=%u lost=%u errors=%u jitter max=%u us",
+		    stats.rx_sdus, stats.rx_lost, stats.rx_errors, stats.rx_jitter_max_us);
+	shell_print(sh, "\tRX latency=%u us max=%u us", stats.rx_latency_us,
+		    stats.rx_latency_max_us);
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	const bool reset = argc > 1 && strcmp(argv[1], "reset") == 0;
+
+	if (argc > 1 && !reset) {
+		shell_help(sh);
+		return SHELL_CMD_HELP_PRINTED;
+	}
+
+#if defined(CONFIG_BT_ISO_UNICAST)
+	print_stats(sh, "CIS", &iso_chan);
+	if (reset && iso_chan.iso != NULL) {
+		(void)bt_iso_chan_reset_stats(&iso_chan);
+	}
+#endif /* CONFIG_BT_ISO_UNICAST */
+#if defined(CONFIG_BT_ISO_BROADCAST)
+	print_stats(sh, "BIS", &bis_iso_chan);
+	if (reset && bis_iso_chan.iso != NULL) {
+		(void)bt_iso_chan_reset_stats(&bis_iso_chan);
+	}
+#endif /* CONFIG_BT_ISO_BROADCAST */
+
+	return 0;
+}
+#endif /* CONFIG_BT_ISO_STATS */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(iso_cmds,
 #if defined(CONFIG_BT_ISO_UNICAST)
 #if defined(CONFIG_BT_ISO_CENTRAL)
@@ -1033,6 +1084,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(iso_cmds,
 #if defined(CONFIG_BT_ISO_BROADCAST)
 	SHELL_CMD_ARG(term-big, NULL, "Terminate a BIG", cmd_big_term, 1, 0),
 #endif /* CONFIG_BT_ISO_BROADCAST */
+#if defined(CONFIG_BT_ISO_STATS)
+	SHELL_CMD_ARG(stats, NULL, "Print ISO channel statistics [reset]", cmd_stats, 1, 1),
+#endif /* CONFIG_BT_ISO_STATS */
 	SHELL_SUBCMD_SET_END
 );
 
@@ -818,7 +818,7 @@ static void send_process_fc(struct isotp_send_ctx *sctx, struct can_frame *frame
 		sctx->state = ISOTP_TX_SEND_CF;
 		sctx->wft = 0;
 		sctx->tx_backlog = 0;
-		k_sem_reset(&sctx->tx_sem);
+		k_sem_init(&sctx->tx_sem, CONFIG_ISOTP_TX_WINDOW, CONFIG_ISOTP_TX_WINDOW);
 		sctx->opts.bs = *data++;
 		sctx->opts.stmin = *data++;
 		sctx->bs = sctx->opts.bs;
@@ -1095,6 +1095,11 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 		LOG_DBG("SM send CF");
 		k_timer_stop(&sctx->timer);
 		do {
+			/* Ensure FIFO style transmission of CF, with at most
+			 * CONFIG_ISOTP_TX_WINDOW of them queued in the controller
+			 */
+			k_sem_take(&sctx->tx_sem, K_FOREVER);
+
 			ret = send_cf(sctx);
 			if (!ret) {
 				sctx->state = ISOTP_TX_WAIT_BACKLOG;
@@ -1118,9 +1123,6 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				sctx->state = ISOTP_TX_WAIT_ST;
 				break;
 			}
-
-			/* Ensure FIFO style transmission of CF */
-			k_sem_take(&sctx->tx_sem, K_FOREVER);
 		} while (ret > 0);
 
 		break;
@@ -1219,7 +1221,7 @@ static int send(struct isotp_send_ctx *sctx, const struct device *can_dev,
 		sctx->has_callback = 0;
 	}
 
-	k_sem_init(&sctx->tx_sem, 0, 1);
+	k_sem_init(&sctx->tx_sem, CONFIG_ISOTP_TX_WINDOW, CONFIG_ISOTP_TX_WINDOW);
 	sctx->can_dev = can_dev;
 	sctx->tx_addr = *tx_addr;
 	sctx->rx_addr = *rx_addr;
@@ -30,6 +30,14 @@ LOG_MODULE_REGISTER(coredump, CONFIG_DEBUG_COREDUMP_LOG_LEVEL);
  * coredump data follows. The padding is to simplify the data read
  * function so that the first read of a data stream is always
  * aligned to flash write size.
+ *
+ * With CONFIG_STREAM_FLASH_ERASE, only the header block is erased
+ * when a dump starts, and stream flash erases the pages ahead of the
+ * data as it goes. The time spent erasing then follows the size of
+ * the dump rather than the size of the partition.
+ *
+ * A dump which does not fit in the partition is kept up to the last
+ * chunk that fits, and flagged as truncated.
  */
 #define FLASH_PARTITION		coredump_partition
 #define FLASH_PARTITION_ID	FIXED_PARTITION_ID(FLASH_PARTITION)
@@ -58,6 +66,8 @@ LOG_MODULE_REGISTER(coredump, CONFIG_DEBUG_COREDUMP_LOG_LEVEL);
 
 #define HDR_VER			1
 
+#define HDR_FLAG_TRUNCATED	BIT(0)
+
 #define FLASH_BACKEND_SEM_TIMEOUT (k_is_in_isr() ? K_NO_WAIT : K_FOREVER)
 
 typedef int (*data_read_cb_t)(void *arg, uint8_t *buf, size_t len);
@@ -72,6 +82,9 @@ static struct {
 	/* Checksum of data so far */
 	uint16_t			checksum;
 
+	/* Ran out of space, the rest of the dump is dropped */
+	bool				truncated;
+
 	/* Error encountered */
 	int				error;
 } backend_ctx;
@@ -414,13 +427,18 @@ static void coredump_flash_backend_start(void)
 	ret = partition_open();
 
 	if (ret == 0) {
-		/* Erase whole flash partition */
+		/*
+		 * Erase the header block, or the whole flash partition if
+		 * stream flash does not erase as it writes.
+		 */
 		ret = flash_area_flatten(backend_ctx.flash_area, 0,
-					 backend_ctx.flash_area->fa_size);
+					 IS_ENABLED(CONFIG_STREAM_FLASH_ERASE) ?
+					 HEADER_SCRAMBLE_SIZE : backend_ctx.flash_area->fa_size);
 	}
 
 	if (ret == 0) {
 		backend_ctx.checksum = 0;
+		backend_ctx.truncated = false;
 
 		flash_dev = flash_area_get_device(backend_ctx.flash_area);
 
@@ -478,7 +496,11 @@ static void coredump_flash_backend_end(void)
 	hdr.size = stream_flash_bytes_written(&backend_ctx.stream_ctx);
 	hdr.checksum = backend_ctx.checksum;
 	hdr.error = backend_ctx.error;
-	hdr.flags = 0;
+	hdr.flags = backend_ctx.truncated ? HDR_FLAG_TRUNCATED : 0;
+
+	if (backend_ctx.truncated) {
+		LOG_WRN("Coredump truncated to %zu bytes", hdr.size);
+	}
 
 	ret = flash_area_write(backend_ctx.flash_area, 0, (void *)&hdr, sizeof(hdr));
 	if (ret != 0) {
@@ -512,7 +534,8 @@ static void coredump_flash_backend_buffer_output(uint8_t *buf, size_t buflen)
 	uint8_t *ptr = buf;
 	uint8_t tmp_buf[FLASH_BUF_SIZE];
 
-	if ((backend_ctx.error != 0) || (backend_ctx.flash_area == NULL)) {
+	if ((backend_ctx.error != 0) || (backend_ctx.flash_area == NULL) ||
+	    backend_ctx.truncated) {
 		return;
 	}
 
@@ -533,6 +556,12 @@ static void coredump_flash_backend_buffer_output(uint8_t *buf, size_t buflen)
 		backend_ctx.error = stream_flash_buffered_write(
 					&backend_ctx.stream_ctx,
 					tmp_buf, copy_sz, false);
+		if (backend_ctx.error == -ENOMEM) {
+			/* Partition full, keep what was written so far */
+			backend_ctx.error = 0;
+			backend_ctx.truncated = true;
+			break;
+		}
 		if (backend_ctx.error != 0) {
 			LOG_ERR("Flash write error: %d", backend_ctx.error);
 			break;
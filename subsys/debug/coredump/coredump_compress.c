@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Compression of memory blocks. The memory is cut in chunks which are
+ * compressed on their own in the LZ4 block format, so the output goes to
+ * the backend as it is produced and a truncated dump can still be decoded
+ * up to the last complete chunk. The match finder uses a static hash table
+ * and nothing is allocated, which suits the fatal error path.
+ */
+
+#include <string.h>
+#include <zephyr/debug/coredump.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "coredump_internal.h"
+
+#define CHUNK_SIZE CONFIG_DEBUG_COREDUMP_COMPRESS_CHUNK_SIZE
+
+#define HASH_BITS 10
+
+/* LZ4 block format limits */
+#define MIN_MATCH     4
+#define MF_LIMIT      12
+#define LAST_LITERALS 5
+
+/*
+ * Positions in the current chunk. Stale entries left by the previous chunk
+ * are harmless, a candidate is only used after its bytes are compared.
+ */
+static uint16_t hash_table[1 << HASH_BITS];
+
+/* Worst case output of a chunk of literals */
+static uint8_t out_buf[CHUNK_SIZE + CHUNK_SIZE / 255 + 16];
+
+static inline uint32_t read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static inline uint32_t hash32(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+static uint8_t *put_len(uint8_t *op, size_t len)
+{
+	for (; len >= 255; len -= 255) {
+		*op++ = 255;
+	}
+
+	*op++ = len;
+
+	return op;
+}
+
+/* A match length of zero ends the block with literals only */
+static uint8_t *put_sequence(uint8_t *op, const uint8_t *lit, size_t lit_len, size_t offset,
+			     size_t match_len)
+{
+	uint8_t *token = op++;
+
+	*token = MIN(lit_len, 15) << 4;
+	if (lit_len >= 15) {
+		op = put_len(op, lit_len - 15);
+	}
+
+	memcpy(op, lit, lit_len);
+	op += lit_len;
+
+	if (match_len == 0) {
+		return op;
+	}
+
+	sys_put_le16(offset, op);
+	op += 2;
+
+	match_len -= MIN_MATCH;
+	*token |= MIN(match_len, 15);
+	if (match_len >= 15) {
+		op = put_len(op, match_len - 15);
+	}
+
+	return op;
+}
+
+static size_t compress_chunk(const uint8_t *src, size_t len)
+{
+	const uint8_t *const mf_limit = src + (len > MF_LIMIT ? len - MF_LIMIT : 0);
+	const uint8_t *const match_limit = src + (len > MF_LIMIT ? len - LAST_LITERALS : 0);
+	const uint8_t *anchor = src;
+	const uint8_t *ip = src;
+	uint8_t *op = out_buf;
+
+	while (ip < mf_limit) {
+		uint32_t seq = read32(ip);
+		uint32_t h = hash32(seq);
+		const uint8_t *ref = src + hash_table[h];
+		const uint8_t *end;
+
+		hash_table[h] = ip - src;
+
+		if (ref >= ip || read32(ref) != seq) {
+			/* Speed up through data that does not compress */
+			ip += 1 + ((ip - anchor) >> 6);
+			continue;
+		}
+
+		for (end = ip + MIN_MATCH; end < match_limit && *end == ref[end - ip]; end++) {
+		}
+
+		op = put_sequence(op, anchor, ip - anchor, ip - ref, end - ip);
+		ip = end;
+		anchor = end;
+	}
+
+	op = put_sequence(op, anchor, src + len - anchor, 0, 0);
+
+	return op - out_buf;
+}
+
+void z_coredump_compressed_output(uintptr_t start_addr, size_t len)
+{
+	const uint8_t *src = UINT_TO_POINTER(start_addr);
+	struct coredump_mem_chunk_hdr_t hdr;
+
+	while (len > 0) {
+		size_t raw_len = MIN(len, CHUNK_SIZE);
+		size_t comp_len = compress_chunk(src, raw_len);
+
+		/* Chunks which do not shrink are stored as they are */
+		hdr.raw_len = sys_cpu_to_le16(raw_len);
+		hdr.comp_len = sys_cpu_to_le16(MIN(comp_len, raw_len));
+
+		coredump_buffer_output((uint8_t *)&hdr, sizeof(hdr));
+		coredump_buffer_output(comp_len < raw_len ? out_buf : (uint8_t *)src,
+				       MIN(comp_len, raw_len));
+
+		src += raw_len;
+		len -= raw_len;
+	}
+}
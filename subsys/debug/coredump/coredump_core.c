@@ -48,6 +48,11 @@ static struct coredump_backend_api
 #define STACK_TOP_LIMIT SIZE_MAX
 #endif
 
+#if defined(CONFIG_DEBUG_COREDUMP_FAULTING_THREAD_FIRST)
+/* Dumped ahead of the memory regions */
+static struct k_thread *first_thread;
+#endif
+
 #if defined(CONFIG_DEBUG_COREDUMP_DUMP_THREAD_PRIV_STACK)
 __weak void arch_coredump_priv_stack_dump(struct k_thread *thread)
 {
@@ -78,7 +83,8 @@ static void dump_header(unsigned int reason)
 }
 
 #if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) ||                                              \
-	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS)
+	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS) ||                                      \
+	defined(CONFIG_DEBUG_COREDUMP_FAULTING_THREAD_FIRST)
 
 static inline void select_stack_region(const struct k_thread *thread, uintptr_t *start,
 				       uintptr_t *end)
@@ -167,6 +173,11 @@ void process_memory_region_list(void)
 	struct k_thread *current;
 
 	for (current = _kernel.threads; current; current = current->next_thread) {
+#if defined(CONFIG_DEBUG_COREDUMP_FAULTING_THREAD_FIRST)
+		if (current == first_thread) {
+			continue;
+		}
+#endif
 		dump_thread(current);
 	}
 
@@ -215,7 +226,11 @@ void coredump(unsigned int reason, const struct arch_esf *esf,
 #endif
 
 	if (thread != NULL) {
-#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN
+#if defined(CONFIG_DEBUG_COREDUMP_FAULTING_THREAD_FIRST)
+		first_thread = thread;
+#endif
+#if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) ||                                              \
+	defined(CONFIG_DEBUG_COREDUMP_FAULTING_THREAD_FIRST)
 		dump_thread(thread);
 #endif
 	}
@@ -262,7 +277,8 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 	len = end_addr - start_addr;
 
 	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+	m.hdr_version = IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS) ? COREDUMP_MEM_HDR_VER_LZ4
+								   : COREDUMP_MEM_HDR_VER;
 
 	if (sizeof(uintptr_t) == 8) {
 		m.start	= sys_cpu_to_le64(start_addr);
@@ -274,7 +290,11 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 
 	coredump_buffer_output((uint8_t *)&m, sizeof(m));
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS
+	z_coredump_compressed_output(start_addr, len);
+#else
 	coredump_buffer_output((uint8_t *)start_addr, len);
+#endif
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
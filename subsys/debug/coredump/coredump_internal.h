@@ -43,6 +43,17 @@ void z_coredump_start(void);
  */
 void z_coredump_end(void);
 
+/**
+ * @brief Output memory in compressed chunks
+ *
+ * This outputs the data of a memory block with version
+ * COREDUMP_MEM_HDR_VER_LZ4, its header is output by the caller.
+ *
+ * @param start_addr Start address of the memory
+ * @param len Number of bytes of memory
+ */
+void z_coredump_compressed_output(uintptr_t start_addr, size_t len);
+
 /**
  * @endcond
  */
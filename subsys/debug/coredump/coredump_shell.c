@@ -314,6 +314,40 @@ static int print_raw_data(const struct shell *sh,
 	return 0;
 }
 
+/**
+ * @brief Get the stored size of a compressed memory block
+ *
+ * @param copy A pointer on the coredump copy context, at the first chunk
+ * @param raw_size Number of bytes of memory in the block
+ * @return size of the chunks if successful, a negative errno otherwise
+ */
+static int compressed_data_size(struct coredump_cmd_copy_arg *copy, size_t raw_size)
+{
+	struct coredump_mem_chunk_hdr_t *hdr = (struct coredump_mem_chunk_hdr_t *)copy->buffer;
+	struct coredump_cmd_copy_arg chunk = {
+		.offset = copy->offset,
+		.buffer = copy->buffer,
+		.length = sizeof(*hdr),
+	};
+	int ret;
+
+	while (raw_size > 0) {
+		ret = coredump_cmd(COREDUMP_CMD_COPY_STORED_DUMP, &chunk);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (hdr->raw_len == 0 || sys_le16_to_cpu(hdr->raw_len) > raw_size) {
+			return -EINVAL;
+		}
+
+		raw_size -= sys_le16_to_cpu(hdr->raw_len);
+		chunk.offset += sizeof(*hdr) + sys_le16_to_cpu(hdr->comp_len);
+	}
+
+	return chunk.offset - copy->offset;
+}
+
 /**
  * @brief Helper parsing and pretty-printing the coredump
  *
@@ -414,6 +448,18 @@ static int parse_and_print_coredump(const struct shell *sh,
 		shell_print(sh, "\tSize %u", data_size);
 		shell_print(sh, "\tStarts at %p ends at %p",
 			    (void *)hdr->start, (void *)hdr->end);
+
+		if (hdr->hdr_version == COREDUMP_MEM_HDR_VER_LZ4) {
+			/* Past the memory header, the chunks are printed as stored */
+			copy->offset += copy->length;
+			data_size = compressed_data_size(copy, data_size);
+			copy->offset -= copy->length;
+			if (data_size < 0) {
+				return data_size;
+			}
+
+			shell_print(sh, "\tCompressed to %u", data_size);
+		}
 		break;
 	}
 	default:
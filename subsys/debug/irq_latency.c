@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/debug/irq_latency.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/util.h>
+#ifdef CONFIG_IRQ_LATENCY_STATS
+#include <zephyr/stats/stats.h>
+#endif
+#ifdef CONFIG_IRQ_LATENCY_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(irq_latency, CONFIG_IRQ_LATENCY_LOG_LEVEL);
+
+#define COUNTER_NODE DT_CHOSEN(zephyr_irq_latency_counter)
+#define COUNTER_IRQ  COND_CODE_1(DT_IRQ_HAS_IDX(COUNTER_NODE, 0), (DT_IRQN(COUNTER_NODE)), (0))
+
+struct irq_latency_data {
+#ifdef CONFIG_IRQ_LATENCY_STATS
+	/* Histogram is exposed as a statistics group, so it must follow the header. */
+	struct stats_hdr s_hdr;
+#endif
+	struct irq_latency_hist hist;
+	k_tid_t max_thread;
+#ifdef CONFIG_THREAD_NAME
+	/* Copied when recorded, the thread may exit before it is read */
+	char max_thread_name[CONFIG_THREAD_MAX_NAME_LEN];
+#endif
+};
+
+struct irq_latency_line {
+	bool used;
+	unsigned int irq;
+	struct irq_latency_data data[IRQ_LATENCY_TYPE_COUNT];
+#ifdef CONFIG_IRQ_LATENCY_STATS
+	char names[IRQ_LATENCY_TYPE_COUNT][sizeof("irq_lat_XXXX_wakeup")];
+#endif
+};
+
+static const struct device *const counter = DEVICE_DT_GET(COUNTER_NODE);
+static struct irq_latency_line lines[CONFIG_IRQ_LATENCY_MAX_LINES];
+static struct k_spinlock lock;
+
+static K_SEM_DEFINE(alarm_sem, 0, 1);
+static uint32_t alarm_target;
+static uint32_t counter_top;
+static uint32_t counter_freq;
+static timing_t isr_timestamp;
+
+#if defined(CONFIG_IRQ_LATENCY_STATS) && defined(CONFIG_STATS_NAMES)
+static const struct stats_name_map irq_latency_stats_map[] = {
+	{ offsetof(struct irq_latency_data, hist.samples), "samples" },
+	{ offsetof(struct irq_latency_data, hist.max_ns), "max_ns" },
+};
+#define IRQ_LATENCY_STATS_MAP irq_latency_stats_map, ARRAY_SIZE(irq_latency_stats_map)
+#else
+#define IRQ_LATENCY_STATS_MAP NULL, 0
+#endif
+
+static struct irq_latency_line *line_find(unsigned int irq)
+{
+	ARRAY_FOR_EACH_PTR(lines, line) {
+		if (line->used && line->irq == irq) {
+			return line;
+		}
+	}
+
+	return NULL;
+}
+
+#ifdef CONFIG_IRQ_LATENCY_STATS
+static void line_stats_register(struct irq_latency_line *line)
+{
+	static const char *const type_str[] = { "entry", "wakeup" };
+
+	BUILD_ASSERT(ARRAY_SIZE(type_str) == IRQ_LATENCY_TYPE_COUNT);
+
+	for (int i = 0; i < IRQ_LATENCY_TYPE_COUNT; i++) {
+		snprintk(line->names[i], sizeof(line->names[i]), "irq_lat_%u_%s",
+			 line->irq, type_str[i]);
+		stats_init(&line->data[i].s_hdr, STATS_SIZE_32,
+			   sizeof(struct irq_latency_hist) / sizeof(uint32_t),
+			   IRQ_LATENCY_STATS_MAP);
+		stats_register(line->names[i], &line->data[i].s_hdr);
+	}
+}
+#endif
+
+int irq_latency_line_add(unsigned int irq)
+{
+	struct irq_latency_line *line = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (line_find(irq) != NULL) {
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	ARRAY_FOR_EACH_PTR(lines, l) {
+		if (!l->used) {
+			line = l;
+			break;
+		}
+	}
+
+	if (line == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOMEM;
+	}
+
+	memset(line->data, 0, sizeof(line->data));
+	line->irq = irq;
+	line->used = true;
+	k_spin_unlock(&lock, key);
+
+#ifdef CONFIG_IRQ_LATENCY_STATS
+	line_stats_register(line);
+#endif
+
+	return 0;
+}
+
+static void record(unsigned int irq, enum irq_latency_type type, uint32_t ns, k_tid_t thread)
+{
+	struct irq_latency_line *line;
+	struct irq_latency_data *data;
+	k_spinlock_key_t key;
+	int idx;
+
+	if (type >= IRQ_LATENCY_TYPE_COUNT) {
+		return;
+	}
+
+	idx = MIN(MAX(LOG2(ns), 0), CONFIG_IRQ_LATENCY_BUCKETS - 1);
+
+	key = k_spin_lock(&lock);
+	line = line_find(irq);
+	if (line == NULL) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	data = &line->data[type];
+	data->hist.samples++;
+	data->hist.buckets[idx]++;
+	if (ns >= data->hist.max_ns) {
+		data->hist.max_ns = ns;
+		data->max_thread = thread;
+#ifdef CONFIG_THREAD_NAME
+		const char *name = (thread != NULL) ? k_thread_name_get(thread) : NULL;
+
+		strncpy(data->max_thread_name, (name != NULL) ? name : "",
+			sizeof(data->max_thread_name) - 1);
+		data->max_thread_name[sizeof(data->max_thread_name) - 1] = '\0';
+#endif
+	}
+	k_spin_unlock(&lock, key);
+}
+
+void irq_latency_record(unsigned int irq, enum irq_latency_type type, uint32_t ns)
+{
+	record(irq, type, ns, k_current_get());
+}
+
+int irq_latency_get(unsigned int irq, enum irq_latency_type type,
+		    struct irq_latency_hist *hist, k_tid_t *max_thread)
+{
+	struct irq_latency_line *line;
+	k_spinlock_key_t key;
+
+	if (type >= IRQ_LATENCY_TYPE_COUNT) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+	line = line_find(irq);
+	if (line == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOENT;
+	}
+
+	*hist = line->data[type].hist;
+	if (max_thread != NULL) {
+		*max_thread = line->data[type].max_thread;
+	}
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int irq_latency_max_thread_name_get(unsigned int irq, enum irq_latency_type type,
+				    char *buf, size_t size)
+{
+#ifdef CONFIG_THREAD_NAME
+	struct irq_latency_line *line;
+	k_spinlock_key_t key;
+
+	if (type >= IRQ_LATENCY_TYPE_COUNT || size == 0U) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+	line = line_find(irq);
+	if (line == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENOENT;
+	}
+
+	strncpy(buf, line->data[type].max_thread_name, size - 1);
+	buf[size - 1] = '\0';
+	k_spin_unlock(&lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(irq);
+	ARG_UNUSED(type);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(size);
+
+	return -ENOTSUP;
+#endif
+}
+
+void irq_latency_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ARRAY_FOR_EACH_PTR(lines, line) {
+		for (int i = 0; i < IRQ_LATENCY_TYPE_COUNT; i++) {
+			memset(&line->data[i].hist, 0, sizeof(line->data[i].hist));
+			line->data[i].max_thread = NULL;
+#ifdef CONFIG_THREAD_NAME
+			line->data[i].max_thread_name[0] = '\0';
+#endif
+		}
+	}
+	k_spin_unlock(&lock, key);
+}
+
+void irq_latency_foreach(irq_latency_cb_t cb, void *user_data)
+{
+	ARRAY_FOR_EACH_PTR(lines, line) {
+		if (line->used) {
+			cb(line->irq, user_data);
+		}
+	}
+}
+
+static uint32_t ticks_to_ns(uint32_t ticks)
+{
+	return (uint32_t)MIN((uint64_t)ticks * NSEC_PER_SEC / counter_freq, UINT32_MAX);
+}
+
+static void alarm_handler(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+			  void *user_data)
+{
+	uint32_t now;
+
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(ticks);
+	ARG_UNUSED(user_data);
+
+	isr_timestamp = timing_counter_get();
+	(void)counter_get_value(dev, &now);
+
+	/*
+	 * Current thread is the one that was interrupted, so with the longest
+	 * latency it points at the code which held the interrupt off.
+	 */
+	record(COUNTER_IRQ, IRQ_LATENCY_ENTRY,
+	       ticks_to_ns((now - alarm_target) & counter_top), k_current_get());
+
+	k_sem_give(&alarm_sem);
+}
+
+static int alarm_set(uint32_t *seed)
+{
+	struct counter_alarm_cfg cfg = {
+		.callback = alarm_handler,
+		.flags = COUNTER_ALARM_CFG_ABSOLUTE,
+	};
+	uint32_t period = counter_us_to_ticks(counter, CONFIG_IRQ_LATENCY_PERIOD_US);
+	uint32_t now;
+	int err;
+
+	/*
+	 * Add up to a quarter of the period of jitter, so that the alarm does
+	 * not stay in phase with other periodic activity.
+	 */
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	period += *seed % (period / 4U + 1U);
+
+	err = counter_get_value(counter, &now);
+	if (err != 0) {
+		return err;
+	}
+
+	alarm_target = (uint32_t)(((uint64_t)now + period) % ((uint64_t)counter_top + 1U));
+	cfg.ticks = alarm_target;
+
+	err = counter_set_channel_alarm(counter, 0, &cfg);
+	if (err == -ETIME) {
+		LOG_DBG("Alarm at %u already expired", alarm_target);
+	} else if (err != 0) {
+		LOG_ERR("Failed to set counter alarm at %u (err %d)", alarm_target, err);
+	}
+
+	return err;
+}
+
+static void irq_latency_thread(void *p1, void *p2, void *p3)
+{
+	uint32_t seed = 0x2545f491U;
+	timing_t end;
+	int err;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (!device_is_ready(counter)) {
+		LOG_ERR("Counter %s not ready", counter->name);
+		return;
+	}
+
+	counter_top = counter_get_top_value(counter);
+	counter_freq = counter_get_frequency(counter);
+	if (!IS_POWER_OF_TWO((uint64_t)counter_top + 1U)) {
+		LOG_ERR("Counter top value must be a power of two minus one");
+		return;
+	}
+
+	timing_init();
+	timing_start();
+
+	err = irq_latency_line_add(COUNTER_IRQ);
+	__ASSERT_NO_MSG(err == 0);
+
+	err = counter_start(counter);
+	if (err != 0 && err != -EALREADY) {
+		LOG_ERR("Failed to start counter (err %d)", err);
+		return;
+	}
+
+	while (true) {
+		err = alarm_set(&seed);
+		if (err == -ETIME) {
+			/* Preempted for longer than the period, try again */
+			continue;
+		} else if (err != 0) {
+			return;
+		}
+
+		k_sem_take(&alarm_sem, K_FOREVER);
+		end = timing_counter_get();
+
+		record(COUNTER_IRQ, IRQ_LATENCY_WAKEUP,
+		       (uint32_t)MIN(timing_cycles_to_ns(timing_cycles_get(&isr_timestamp, &end)),
+				     UINT32_MAX),
+		       k_current_get());
+	}
+}
+
+K_THREAD_DEFINE(irq_latency, CONFIG_IRQ_LATENCY_STACK_SIZE, irq_latency_thread, NULL, NULL,
+		NULL, CONFIG_IRQ_LATENCY_THREAD_PRIORITY, 0, 0);
+
+#ifdef CONFIG_IRQ_LATENCY_SHELL
+static void hist_print(const struct shell *sh, const char *name, unsigned int irq,
+		       enum irq_latency_type type)
+{
+	struct irq_latency_hist hist;
+	k_tid_t thread;
+	char thread_name[COND_CODE_1(CONFIG_THREAD_NAME, (CONFIG_THREAD_MAX_NAME_LEN), (1))];
+
+	if (irq_latency_get(irq, type, &hist, &thread) != 0) {
+		return;
+	}
+
+	/* The thread may have exited, only the name copied when recorded is safe to use */
+	if (irq_latency_max_thread_name_get(irq, type, thread_name, sizeof(thread_name)) != 0) {
+		thread_name[0] = '\0';
+	}
+
+	shell_print(sh, "  %s: samples %u max %u ns (thread %p %s)", name, hist.samples,
+		    hist.max_ns, (void *)thread, thread_name);
+
+	for (int i = 0; i < CONFIG_IRQ_LATENCY_BUCKETS; i++) {
+		if (hist.buckets[i] == 0U) {
+			continue;
+		}
+
+		if (i == CONFIG_IRQ_LATENCY_BUCKETS - 1) {
+			shell_print(sh, "    >= %u ns: %u", BIT(i), hist.buckets[i]);
+		} else {
+			shell_print(sh, "    %u-%u ns: %u", i == 0 ? 0 : BIT(i), BIT(i + 1) - 1,
+				    hist.buckets[i]);
+		}
+	}
+}
+
+static void line_print(unsigned int irq, void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	shell_print(sh, "IRQ %u", irq);
+	hist_print(sh, "entry", irq, IRQ_LATENCY_ENTRY);
+	hist_print(sh, "wakeup", irq, IRQ_LATENCY_WAKEUP);
+}
+
+static int cmd_irq_latency_show(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	irq_latency_foreach(line_print, (void *)sh);
+
+	return 0;
+}
+
+static int cmd_irq_latency_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	irq_latency_reset();
+	shell_print(sh, "Interrupt latency histograms reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_irq_latency,
+	SHELL_CMD_ARG(show, NULL, "Show interrupt latency histograms", cmd_irq_latency_show,
+		      1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset interrupt latency histograms", cmd_irq_latency_reset,
+		      1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(irq_latency, &sub_irq_latency, "Interrupt latency monitor", NULL);
+#endif /* CONFIG_IRQ_LATENCY_SHELL */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/debug/usage_stats.h>
+#include <zephyr/kernel.h>
+#include <zephyr/stats/stats.h>
+
+STATS_SECT_START(usage_stats)
+STATS_SECT_ENTRY32(window0)
+STATS_SECT_ENTRY32(window1)
+STATS_SECT_ENTRY32(window2)
+STATS_SECT_END;
+
+STATS_NAME_START(usage_stats)
+STATS_NAME(usage_stats, window0)
+STATS_NAME(usage_stats, window1)
+STATS_NAME(usage_stats, window2)
+STATS_NAME_END(usage_stats);
+
+BUILD_ASSERT(K_CYCLE_WINDOWS == 3);
+
+#define CPU_STAT_NAME_LEN sizeof("usage_cpu_XXX")
+
+static STATS_SECT_DECL(usage_stats) cpu_stats[CONFIG_MP_MAX_NUM_CPUS];
+static char cpu_names[CONFIG_MP_MAX_NUM_CPUS][CPU_STAT_NAME_LEN];
+
+static STATS_SECT_DECL(usage_stats) thread_stats[CONFIG_USAGE_STATS_MAX_THREADS];
+static k_tid_t threads[CONFIG_USAGE_STATS_MAX_THREADS];
+static K_MUTEX_DEFINE(threads_lock);
+
+static void usage_stats_set(STATS_SECT_DECL(usage_stats) *group,
+			    const k_thread_runtime_stats_t *stats)
+{
+	STATS_SET(*group, window0, stats->utilization[0]);
+	STATS_SET(*group, window1, stats->utilization[1]);
+	STATS_SET(*group, window2, stats->utilization[2]);
+}
+
+static void usage_stats_update(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	k_thread_runtime_stats_t stats;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (k_thread_runtime_stats_cpu_get(i, &stats) == 0) {
+			usage_stats_set(&cpu_stats[i], &stats);
+		}
+	}
+
+	k_mutex_lock(&threads_lock, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(threads); i++) {
+		if (threads[i] != NULL && k_thread_runtime_stats_get(threads[i], &stats) == 0) {
+			usage_stats_set(&thread_stats[i], &stats);
+		}
+	}
+	k_mutex_unlock(&threads_lock);
+
+	k_work_reschedule(dwork, K_MSEC(CONFIG_SCHED_THREAD_USAGE_WINDOW_MS));
+}
+
+static K_WORK_DELAYABLE_DEFINE(usage_stats_work, usage_stats_update);
+
+int usage_stats_thread_add(k_tid_t thread, const char *name)
+{
+	int err = -ENOMEM;
+
+	k_mutex_lock(&threads_lock, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(threads); i++) {
+		if (threads[i] == NULL) {
+			stats_init(&thread_stats[i].s_hdr, STATS_SIZE_32, K_CYCLE_WINDOWS,
+				   STATS_NAME_INIT_PARMS(usage_stats));
+			stats_register(name, &thread_stats[i].s_hdr);
+			threads[i] = thread;
+			err = 0;
+			break;
+		}
+	}
+	k_mutex_unlock(&threads_lock);
+
+	return err;
+}
+
+static int usage_stats_init(void)
+{
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		snprintk(cpu_names[i], CPU_STAT_NAME_LEN, "usage_cpu_%d", i);
+		stats_init(&cpu_stats[i].s_hdr, STATS_SIZE_32, K_CYCLE_WINDOWS,
+			   STATS_NAME_INIT_PARMS(usage_stats));
+		stats_register(cpu_names[i], &cpu_stats[i].s_hdr);
+	}
+
+	k_work_schedule(&usage_stats_work, K_MSEC(CONFIG_SCHED_THREAD_USAGE_WINDOW_MS));
+
+	return 0;
+}
+
+SYS_INIT(usage_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
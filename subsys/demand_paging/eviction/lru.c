@@ -27,6 +27,10 @@
  *   to the end of the queue, preventing it from being the next page
  *   reclamation victim. Then the new head page is made unaccessible.
  *
+ * - Pages read ahead of page faults are inserted at the head of the queue
+ *   with k_mem_paging_eviction_add_prefetched(), unaccessible, so that they
+ *   are reclaimed first unless actually used in the meantime.
+ *
  * This way, unused pages will migrate toward the head of the queue, used
  * pages will tend to remain towards the end of the queue. And there won't be
  * any fault overhead while the set of accessed pages remain stable.
@@ -85,6 +89,14 @@ static inline void lru_pf_append(uint32_t pf_idx)
 	LRU_PF_TAIL = pf_idx;
 }
 
+static inline void lru_pf_prepend(uint32_t pf_idx)
+{
+	lru_pf_queue[pf_idx].prev = 0;
+	lru_pf_queue[pf_idx].next = LRU_PF_HEAD;
+	lru_pf_queue[LRU_PF_HEAD].prev = pf_idx;
+	LRU_PF_HEAD = pf_idx;
+}
+
 static inline void lru_pf_unlink(uint32_t pf_idx)
 {
 	uint32_t next = lru_pf_queue[pf_idx].next;
@@ -136,6 +148,21 @@ void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
 	k_spin_unlock(&lru_lock, key);
 }
 
+void k_mem_paging_eviction_add_prefetched(struct k_mem_page_frame *pf)
+{
+	uint32_t pf_idx = pf_to_idx(pf);
+	k_spinlock_key_t key = k_spin_lock(&lru_lock);
+
+	/*
+	 * Pages read ahead go to the head of the queue, as the next victims.
+	 * They were made unaccessible, so a first use moves them to the end.
+	 */
+	__ASSERT(k_mem_page_frame_is_evictable(pf), "");
+	__ASSERT(!lru_pf_in_queue(pf_idx), "");
+	lru_pf_prepend(pf_idx);
+	k_spin_unlock(&lru_lock, key);
+}
+
 void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
 {
 	uint32_t pf_idx = pf_to_idx(pf);
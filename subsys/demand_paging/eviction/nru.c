@@ -133,4 +133,9 @@ void k_mem_paging_eviction_accessed(uintptr_t phys)
 	ARG_UNUSED(phys);
 }
 
+void k_mem_paging_eviction_add_prefetched(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
 #endif /* CONFIG_EVICTION_TRACKING */
@@ -61,7 +61,11 @@ static int scramble_mcuboot_trailer(struct flash_img_context *ctx)
 	int rc = 0;
 
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
-	if (stream_flash_bytes_written(&ctx->stream) == 0) {
+	/* Data still buffered or being written in the background means the
+	 * trailer has already been scrambled.
+	 */
+	if (stream_flash_bytes_written(&ctx->stream) == 0 &&
+	    stream_flash_bytes_buffered(&ctx->stream) == 0) {
 		off_t toff = boot_get_trailer_status_offset(ctx->flash_area->fa_size);
 		off_t offset;
 		size_t size;
@@ -238,14 +242,22 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 		}
 	}
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
-				 (ctx->flash_area->fa_off + sector_data.fs_size),
-				 (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
+			       (ctx->flash_area->fa_off + sector_data.fs_size),
+			       (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
 #else
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
 #endif
+
+#ifdef CONFIG_IMG_PIPELINED_WRITE
+	if (rc == 0) {
+		rc = stream_flash_pipeline_enable(&ctx->stream, ctx->pipe_buf);
+	}
+#endif
+
+	return rc;
 }
 
 #ifdef CONFIG_MCUBOOT_BOOTLOADER_MODE_RAM_LOAD
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_ACCESS_INTERNAL_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_ACCESS_INTERNAL_H_
+
+#include <zephyr/drivers/disk.h>
+
+/* Get the registered disk with the given name, NULL if there is none */
+struct disk_info *disk_access_get_di(const char *name);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_ACCESS_INTERNAL_H_ */
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/storage/disk_cache.h>
+
+#include "disk_access_internal.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define SECTOR_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+
+struct disk_cache_entry {
+	sys_dnode_t node;
+	/* Disk of the cached sector, NULL if the entry is unused */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	uint8_t data[SECTOR_SIZE] __aligned(4);
+};
+
+static struct disk_cache_entry entries[CONFIG_DISK_CACHE_SECTORS];
+
+/* Entries from the least to the most recently used, unused entries first */
+static sys_dlist_t lru = SYS_DLIST_STATIC_INIT(&lru);
+
+static K_MUTEX_DEFINE(cache_lock);
+
+/* Get the disk if its sectors can be cached */
+static struct disk_info *cache_disk(const char *pdrv)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+	uint32_t sector_size;
+
+	if ((disk == NULL) ||
+	    (disk_access_ioctl(pdrv, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0) ||
+	    (sector_size != SECTOR_SIZE)) {
+		return NULL;
+	}
+
+	return disk;
+}
+
+static struct disk_cache_entry *cache_find(struct disk_info *disk, uint32_t sector)
+{
+	ARRAY_FOR_EACH_PTR(entries, entry) {
+		if ((entry->disk == disk) && (entry->sector == sector)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void cache_touch(struct disk_cache_entry *entry)
+{
+	sys_dlist_remove(&entry->node);
+	sys_dlist_append(&lru, &entry->node);
+}
+
+static void cache_drop(struct disk_cache_entry *entry)
+{
+	entry->disk = NULL;
+	entry->dirty = false;
+	sys_dlist_remove(&entry->node);
+	sys_dlist_prepend(&lru, &entry->node);
+}
+
+static int cache_entry_flush(struct disk_cache_entry *entry)
+{
+	int rc;
+
+	if (!entry->dirty) {
+		return 0;
+	}
+
+	rc = disk_access_write(entry->disk->name, entry->data, entry->sector, 1);
+	if (rc < 0) {
+		LOG_ERR("Failed to write cached sector %u of %s (%d)", entry->sector,
+			entry->disk->name, rc);
+		return rc;
+	}
+
+	entry->dirty = false;
+	return 0;
+}
+
+/* Take the least recently used entry for a sector, writing it out if modified */
+static int cache_alloc(struct disk_info *disk, uint32_t sector, struct disk_cache_entry **out)
+{
+	struct disk_cache_entry *entry;
+	int rc;
+
+	entry = SYS_DLIST_PEEK_HEAD_CONTAINER(&lru, entry, node);
+	rc = cache_entry_flush(entry);
+	if (rc < 0) {
+		return rc;
+	}
+
+	entry->disk = disk;
+	entry->sector = sector;
+	cache_touch(entry);
+	*out = entry;
+
+	return 0;
+}
+
+/* Get the entry of a sector, loading it from the disk if not cached */
+static int cache_load(struct disk_info *disk, uint32_t sector, struct disk_cache_entry **out)
+{
+	struct disk_cache_entry *entry;
+	int rc;
+
+	entry = cache_find(disk, sector);
+	if (entry != NULL) {
+		cache_touch(entry);
+		*out = entry;
+		return 0;
+	}
+
+	rc = cache_alloc(disk, sector, &entry);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = disk_access_read(disk->name, entry->data, sector, 1);
+	if (rc < 0) {
+		cache_drop(entry);
+		return rc;
+	}
+
+	*out = entry;
+	return 0;
+}
+
+int disk_cache_read(const char *pdrv, uint8_t *data_buf, uint32_t start_sector,
+		    uint32_t num_sector)
+{
+	struct disk_info *disk = cache_disk(pdrv);
+	struct disk_cache_entry *entry;
+	int rc = 0;
+
+	if (disk == NULL) {
+		return disk_access_read(pdrv, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (num_sector > CONFIG_DISK_CACHE_MAX_REQUEST) {
+		rc = disk_access_read(pdrv, data_buf, start_sector, num_sector);
+		if (rc < 0) {
+			goto out;
+		}
+
+		/* Only modified sectors differ from what was read */
+		ARRAY_FOR_EACH_PTR(entries, e) {
+			if ((e->disk == disk) && e->dirty && (e->sector >= start_sector) &&
+			    ((e->sector - start_sector) < num_sector)) {
+				memcpy(&data_buf[(e->sector - start_sector) * SECTOR_SIZE], e->data,
+				       SECTOR_SIZE);
+			}
+		}
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		rc = cache_load(disk, start_sector + i, &entry);
+		if (rc < 0) {
+			break;
+		}
+		memcpy(&data_buf[i * SECTOR_SIZE], entry->data, SECTOR_SIZE);
+	}
+
+out:
+	k_mutex_unlock(&cache_lock);
+	return rc;
+}
+
+int disk_cache_write(const char *pdrv, const uint8_t *data_buf, uint32_t start_sector,
+		     uint32_t num_sector)
+{
+	struct disk_info *disk = cache_disk(pdrv);
+	struct disk_cache_entry *entry;
+	int rc = 0;
+
+	if (disk == NULL) {
+		return disk_access_write(pdrv, data_buf, start_sector, num_sector);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (num_sector > CONFIG_DISK_CACHE_MAX_REQUEST) {
+		rc = disk_access_write(pdrv, data_buf, start_sector, num_sector);
+		if (rc < 0) {
+			goto out;
+		}
+
+		/* Cached copies now match the disk */
+		ARRAY_FOR_EACH_PTR(entries, e) {
+			if ((e->disk == disk) && (e->sector >= start_sector) &&
+			    ((e->sector - start_sector) < num_sector)) {
+				memcpy(e->data, &data_buf[(e->sector - start_sector) * SECTOR_SIZE],
+				       SECTOR_SIZE);
+				e->dirty = false;
+			}
+		}
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		entry = cache_find(disk, start_sector + i);
+		if (entry != NULL) {
+			cache_touch(entry);
+		} else {
+			rc = cache_alloc(disk, start_sector + i, &entry);
+			if (rc < 0) {
+				break;
+			}
+		}
+		memcpy(entry->data, &data_buf[i * SECTOR_SIZE], SECTOR_SIZE);
+		entry->dirty = true;
+	}
+
+out:
+	k_mutex_unlock(&cache_lock);
+	return rc;
+}
+
+int disk_cache_read_ahead(const char *pdrv, uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_info *disk = cache_disk(pdrv);
+	struct disk_cache_entry *entry;
+	int rc = 0;
+
+	if (disk == NULL) {
+		return 0;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	num_sector = MIN(num_sector, CONFIG_DISK_CACHE_SECTORS);
+	for (uint32_t i = 0; i < num_sector; i++) {
+		rc = cache_load(disk, start_sector + i, &entry);
+		if (rc < 0) {
+			break;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+	return rc;
+}
+
+int disk_cache_sync(const char *pdrv)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+	int rc = 0;
+
+	if (disk == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(entries, entry) {
+		if (entry->disk == disk) {
+			rc = cache_entry_flush(entry);
+			if (rc < 0) {
+				break;
+			}
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	return disk_access_ioctl(pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+}
+
+void disk_cache_invalidate(const char *pdrv)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+
+	if (disk == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(entries, entry) {
+		if (entry->disk == disk) {
+			cache_drop(entry);
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static int disk_cache_init(void)
+{
+	ARRAY_FOR_EACH_PTR(entries, entry) {
+		sys_dlist_append(&lru, &entry->node);
+	}
+
+	return 0;
+}
+
+SYS_INIT(disk_cache_init, PRE_KERNEL_1, 0);
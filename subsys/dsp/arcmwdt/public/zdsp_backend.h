@@ -18,6 +18,7 @@ extern "C" {
 
 #include <arm_math.h>
 #include "dsplib.h"
+#include <zdsp_portable.h>
 
 static inline void zdsp_mult_q7(const DSP_DATA q7_t *src_a, const DSP_DATA q7_t *src_b,
 				DSP_DATA q7_t *dst, uint32_t block_size)
@@ -286,6 +287,102 @@ static inline void zdsp_not_u32(const DSP_DATA uint32_t *src, DSP_DATA uint32_t
 	arm_not_u32(src, dst, block_size);
 }
 
+/* The filtering and support functions use the portable implementations */
+static inline void zdsp_fir_q15(const struct zdsp_fir_q15 *fir, const DSP_DATA q15_t *src,
+				DSP_DATA q15_t *dst, uint32_t block_size)
+{
+	zdsp_portable_fir_q15(fir, src, dst, block_size);
+}
+static inline void zdsp_fir_q31(const struct zdsp_fir_q31 *fir, const DSP_DATA q31_t *src,
+				DSP_DATA q31_t *dst, uint32_t block_size)
+{
+	zdsp_portable_fir_q31(fir, src, dst, block_size);
+}
+static inline void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const DSP_DATA float32_t *src,
+				DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	zdsp_portable_fir_f32(fir, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_q15(const struct zdsp_biquad_q15 *biquad, const DSP_DATA q15_t *src,
+				   DSP_DATA q15_t *dst, uint32_t block_size)
+{
+	zdsp_portable_biquad_q15(biquad, src, dst, block_size);
+}
+static inline void zdsp_biquad_q31(const struct zdsp_biquad_q31 *biquad, const DSP_DATA q31_t *src,
+				   DSP_DATA q31_t *dst, uint32_t block_size)
+{
+	zdsp_portable_biquad_q31(biquad, src, dst, block_size);
+}
+static inline void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad,
+				   const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_biquad_f32(biquad, src, dst, block_size);
+}
+
+static inline void zdsp_q15_to_q31(const DSP_DATA q15_t *src, DSP_DATA q31_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_q15_to_q31(src, dst, block_size);
+}
+static inline void zdsp_q31_to_q15(const DSP_DATA q31_t *src, DSP_DATA q15_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_q31_to_q15(src, dst, block_size);
+}
+static inline void zdsp_q15_to_f32(const DSP_DATA q15_t *src, DSP_DATA float32_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_q15_to_f32(src, dst, block_size);
+}
+static inline void zdsp_f32_to_q15(const DSP_DATA float32_t *src, DSP_DATA q15_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_f32_to_q15(src, dst, block_size);
+}
+static inline void zdsp_q31_to_f32(const DSP_DATA q31_t *src, DSP_DATA float32_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_q31_to_f32(src, dst, block_size);
+}
+static inline void zdsp_f32_to_q31(const DSP_DATA float32_t *src, DSP_DATA q31_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_f32_to_q31(src, dst, block_size);
+}
+static inline void zdsp_s24_to_q31(const DSP_DATA uint8_t *src, DSP_DATA q31_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_s24_to_q31(src, dst, block_size);
+}
+static inline void zdsp_q31_to_s24(const DSP_DATA q31_t *src, DSP_DATA uint8_t *dst,
+				   uint32_t block_size)
+{
+	zdsp_portable_q31_to_s24(src, dst, block_size);
+}
+
+static inline void zdsp_interleave_q15(const DSP_DATA q15_t *const *src, uint32_t channels,
+				       DSP_DATA q15_t *dst, uint32_t frames)
+{
+	zdsp_portable_interleave_q15(src, channels, dst, frames);
+}
+static inline void zdsp_deinterleave_q15(const DSP_DATA q15_t *src, uint32_t channels,
+					 DSP_DATA q15_t *const *dst, uint32_t frames)
+{
+	zdsp_portable_deinterleave_q15(src, channels, dst, frames);
+}
+static inline void zdsp_interleave_q31(const DSP_DATA q31_t *const *src, uint32_t channels,
+				       DSP_DATA q31_t *dst, uint32_t frames)
+{
+	zdsp_portable_interleave_q31(src, channels, dst, frames);
+}
+static inline void zdsp_deinterleave_q31(const DSP_DATA q31_t *src, uint32_t channels,
+					 DSP_DATA q31_t *const *dst, uint32_t frames)
+{
+	zdsp_portable_deinterleave_q31(src, channels, dst, frames);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,7 @@ extern "C" {
 #include <zephyr/kernel.h>
 
 #include <arm_math.h>
+#include <zdsp_portable.h>
 
 static inline void zdsp_mult_q7(const q7_t *src_a, const q7_t *src_b, q7_t *dst,
 				uint32_t block_size)
@@ -269,6 +270,193 @@ static inline void zdsp_not_u32(const uint32_t *src, uint32_t *dst, uint32_t blo
 	arm_not_u32(src, dst, block_size);
 }
 
+#ifdef CONFIG_CMSIS_DSP_FILTERING
+static inline void zdsp_fir_q15(const struct zdsp_fir_q15 *fir, const q15_t *src, q15_t *dst,
+				uint32_t block_size)
+{
+	const arm_fir_instance_q15 inst = {
+		.numTaps = fir->num_taps,
+		.pState = fir->state,
+		.pCoeffs = fir->coeffs,
+	};
+
+	arm_fir_q15(&inst, src, dst, block_size);
+}
+static inline void zdsp_fir_q31(const struct zdsp_fir_q31 *fir, const q31_t *src, q31_t *dst,
+				uint32_t block_size)
+{
+	const arm_fir_instance_q31 inst = {
+		.numTaps = fir->num_taps,
+		.pState = fir->state,
+		.pCoeffs = fir->coeffs,
+	};
+
+	arm_fir_q31(&inst, src, dst, block_size);
+}
+static inline void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const float32_t *src,
+				float32_t *dst, uint32_t block_size)
+{
+	const arm_fir_instance_f32 inst = {
+		.numTaps = fir->num_taps,
+		.pState = fir->state,
+		.pCoeffs = fir->coeffs,
+	};
+
+	arm_fir_f32(&inst, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_q15(const struct zdsp_biquad_q15 *biquad, const q15_t *src,
+				   q15_t *dst, uint32_t block_size)
+{
+	const arm_biquad_casd_df1_inst_q15 inst = {
+		.numStages = biquad->num_stages,
+		.pState = biquad->state,
+		.pCoeffs = biquad->coeffs,
+		.postShift = biquad->post_shift,
+	};
+
+	arm_biquad_cascade_df1_q15(&inst, src, dst, block_size);
+}
+static inline void zdsp_biquad_q31(const struct zdsp_biquad_q31 *biquad, const q31_t *src,
+				   q31_t *dst, uint32_t block_size)
+{
+	const arm_biquad_casd_df1_inst_q31 inst = {
+		.numStages = biquad->num_stages,
+		.pState = biquad->state,
+		.pCoeffs = biquad->coeffs,
+		.postShift = biquad->post_shift,
+	};
+
+	arm_biquad_cascade_df1_q31(&inst, src, dst, block_size);
+}
+static inline void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad, const float32_t *src,
+				   float32_t *dst, uint32_t block_size)
+{
+	const arm_biquad_casd_df1_inst_f32 inst = {
+		.numStages = biquad->num_stages,
+		.pState = biquad->state,
+		.pCoeffs = biquad->coeffs,
+	};
+
+	arm_biquad_cascade_df1_f32(&inst, src, dst, block_size);
+}
+#else
+static inline void zdsp_fir_q15(const struct zdsp_fir_q15 *fir, const q15_t *src, q15_t *dst,
+				uint32_t block_size)
+{
+	zdsp_portable_fir_q15(fir, src, dst, block_size);
+}
+static inline void zdsp_fir_q31(const struct zdsp_fir_q31 *fir, const q31_t *src, q31_t *dst,
+				uint32_t block_size)
+{
+	zdsp_portable_fir_q31(fir, src, dst, block_size);
+}
+static inline void zdsp_fir_f32(const struct zdsp_fir_f32 *fir, const float32_t *src,
+				float32_t *dst, uint32_t block_size)
+{
+	zdsp_portable_fir_f32(fir, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_q15(const struct zdsp_biquad_q15 *biquad, const q15_t *src,
+				   q15_t *dst, uint32_t block_size)
+{
+	zdsp_portable_biquad_q15(biquad, src, dst, block_size);
+}
+static inline void zdsp_biquad_q31(const struct zdsp_biquad_q31 *biquad, const q31_t *src,
+				   q31_t *dst, uint32_t block_size)
+{
+	zdsp_portable_biquad_q31(biquad, src, dst, block_size);
+}
+static inline void zdsp_biquad_f32(const struct zdsp_biquad_f32 *biquad, const float32_t *src,
+				   float32_t *dst, uint32_t block_size)
+{
+	zdsp_portable_biquad_f32(biquad, src, dst, block_size);
+}
+#endif /* CONFIG_CMSIS_DSP_FILTERING */
+
+#ifdef CONFIG_CMSIS_DSP_SUPPORT
+static inline void zdsp_q15_to_q31(const q15_t *src, q31_t *dst, uint32_t block_size)
+{
+	arm_q15_to_q31(src, dst, block_size);
+}
+static inline void zdsp_q31_to_q15(const q31_t *src, q15_t *dst, uint32_t block_size)
+{
+	arm_q31_to_q15(src, dst, block_size);
+}
+static inline void zdsp_q15_to_f32(const q15_t *src, float32_t *dst, uint32_t block_size)
+{
+	arm_q15_to_float(src, dst, block_size);
+}
+static inline void zdsp_f32_to_q15(const float32_t *src, q15_t *dst, uint32_t block_size)
+{
+	arm_float_to_q15(src, dst, block_size);
+}
+static inline void zdsp_q31_to_f32(const q31_t *src, float32_t *dst, uint32_t block_size)
+{
+	arm_q31_to_float(src, dst, block_size);
+}
+static inline void zdsp_f32_to_q31(const float32_t *src, q31_t *dst, uint32_t block_size)
+{
+	arm_float_to_q31(src, dst, block_size);
+}
+#else
+static inline void zdsp_q15_to_q31(const q15_t *src, q31_t *dst, uint32_t block_size)
+{
+	zdsp_portable_q15_to_q31(src, dst, block_size);
+}
+static inline void zdsp_q31_to_q15(const q31_t *src, q15_t *dst, uint32_t block_size)
+{
+	zdsp_portable_q31_to_q15(src, dst, block_size);
+}
+static inline void zdsp_q15_to_f32(const q15_t *src, float32_t *dst, uint32_t block_size)
+{
+	zdsp_portable_q15_to_f32(src, dst, block_size);
+}
+static inline void zdsp_f32_to_q15(const float32_t *src, q15_t *dst, uint32_t block_size)
+{
+	zdsp_portable_f32_to_q15(src, dst, block_size);
+}
+static inline void zdsp_q31_to_f32(const q31_t *src, float32_t *dst, uint32_t block_size)
+{
+	zdsp_portable_q31_to_f32(src, dst, block_size);
+}
+static inline void zdsp_f32_to_q31(const float32_t *src, q31_t *dst, uint32_t block_size)
+{
+	zdsp_portable_f32_to_q31(src, dst, block_size);
+}
+#endif /* CONFIG_CMSIS_DSP_SUPPORT */
+
+/* Not provided by CMSIS-DSP */
+static inline void zdsp_s24_to_q31(const uint8_t *src, q31_t *dst, uint32_t block_size)
+{
+	zdsp_portable_s24_to_q31(src, dst, block_size);
+}
+static inline void zdsp_q31_to_s24(const q31_t *src, uint8_t *dst, uint32_t block_size)
+{
+	zdsp_portable_q31_to_s24(src, dst, block_size);
+}
+
+static inline void zdsp_interleave_q15(const q15_t *const *src, uint32_t channels, q15_t *dst,
+				       uint32_t frames)
+{
+	zdsp_portable_interleave_q15(src, channels, dst, frames);
+}
+static inline void zdsp_deinterleave_q15(const q15_t *src, uint32_t channels, q15_t *const *dst,
+					 uint32_t frames)
+{
+	zdsp_portable_deinterleave_q15(src, channels, dst, frames);
+}
+static inline void zdsp_interleave_q31(const q31_t *const *src, uint32_t channels, q31_t *dst,
+				       uint32_t frames)
+{
+	zdsp_portable_interleave_q31(src, channels, dst, frames);
+}
+static inline void zdsp_deinterleave_q31(const q31_t *src, uint32_t channels, q31_t *const *dst,
+					 uint32_t frames)
+{
+	zdsp_portable_deinterleave_q31(src, channels, dst, frames);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/dsp/offload.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "offload_internal.h"
+
+LOG_MODULE_REGISTER(dsp_offload, CONFIG_DSP_OFFLOAD_LOG_LEVEL);
+
+#if DT_HAS_CHOSEN(zephyr_dsp_offload_shm)
+/* Buffers are exchanged as offsets into the shared memory region */
+#define SHM_BASE DT_REG_ADDR(DT_CHOSEN(zephyr_dsp_offload_shm))
+#define SHM_SIZE DT_REG_SIZE(DT_CHOSEN(zephyr_dsp_offload_shm))
+#else
+/* Buffers are exchanged as addresses, the same on both cores */
+BUILD_ASSERT(sizeof(void *) == sizeof(uint32_t),
+	     "zephyr,dsp-offload-shm must be chosen on 64-bit targets");
+#define SHM_BASE 0
+#define SHM_SIZE ((uint64_t)UINT32_MAX)
+#endif
+
+uint32_t zdsp_offload_addr(const void *ptr)
+{
+	uintptr_t addr = (uintptr_t)ptr;
+
+	if (ptr == NULL || addr < SHM_BASE || addr - SHM_BASE >= SHM_SIZE) {
+		return DSP_OFFLOAD_ADDR_NULL;
+	}
+
+	return addr - SHM_BASE;
+}
+
+void *dsp_offload_ptr(uint32_t addr, size_t len)
+{
+	if (addr == DSP_OFFLOAD_ADDR_NULL || len > SHM_SIZE - addr) {
+		return NULL;
+	}
+
+	return (void *)((uintptr_t)SHM_BASE + addr);
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/cache.h>
+#include <zephyr/dsp/offload.h>
+#include <zephyr/init.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+
+#include "offload_internal.h"
+
+LOG_MODULE_DECLARE(dsp_offload, CONFIG_DSP_OFFLOAD_LOG_LEVEL);
+
+static struct ipc_ept ept;
+static atomic_t connected;
+static struct k_spinlock lock;
+/* Jobs sent to the remote, in submission order */
+static sys_slist_t pending;
+static uint32_t next_id;
+
+static bool job_remove(struct zdsp_offload_job *job)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	bool found = sys_slist_find_and_remove(&pending, &job->node);
+
+	k_spin_unlock(&lock, key);
+
+	return found;
+}
+
+static struct zdsp_offload_job *job_take(uint32_t id)
+{
+	struct zdsp_offload_job *job;
+	sys_snode_t *prev = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Jobs complete in order, the head is the usual match */
+	SYS_SLIST_FOR_EACH_CONTAINER(&pending, job, node) {
+		if (job->id == id) {
+			sys_slist_remove(&pending, prev, &job->node);
+			k_spin_unlock(&lock, key);
+			return job;
+		}
+		prev = &job->node;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return NULL;
+}
+
+static void ept_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	atomic_set(&connected, 1);
+	LOG_DBG("remote connected");
+}
+
+static void ept_unbound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	atomic_set(&connected, 0);
+	LOG_WRN("remote disconnected");
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	struct dsp_offload_msg msg;
+	struct zdsp_offload_job *job;
+
+	ARG_UNUSED(priv);
+
+	if (len != sizeof(msg)) {
+		LOG_WRN("invalid completion of %zu bytes", len);
+		return;
+	}
+	memcpy(&msg, data, sizeof(msg));
+
+	job = job_take(msg.id);
+	if (job == NULL) {
+		/* Cancelled after a timeout */
+		LOG_DBG("late completion of job %u", msg.id);
+		return;
+	}
+
+	if (job->dst != NULL) {
+		(void)sys_cache_data_invd_range(job->dst, job->dst_len);
+	}
+	if (job->ctx != NULL) {
+		(void)sys_cache_data_invd_range(job->ctx, job->ctx_len);
+	}
+
+	job->result = msg.result;
+
+	if (job->done != NULL) {
+		k_sem_give(job->done);
+	} else if (job->cb != NULL) {
+		job->cb(job);
+	}
+}
+
+static const struct ipc_ept_cfg ept_cfg = {
+	.name = DSP_OFFLOAD_EPT_NAME,
+	.cb = {
+		.bound = ept_bound,
+		.unbound = ept_unbound,
+		.received = ept_received,
+	},
+};
+
+static int buf_addr(const void *buf, size_t len, uint32_t *addr)
+{
+	if (buf == NULL) {
+		*addr = DSP_OFFLOAD_ADDR_NULL;
+		return 0;
+	}
+
+	*addr = zdsp_offload_addr(buf);
+	if (*addr == DSP_OFFLOAD_ADDR_NULL || dsp_offload_ptr(*addr, len) == NULL) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int job_submit(struct zdsp_offload_job *job, struct k_sem *done)
+{
+	struct dsp_offload_msg msg = {
+		.op = job->op,
+		.src_len = job->src_len,
+		.dst_len = job->dst_len,
+		.ctx_len = job->ctx_len,
+		.arg = job->arg,
+	};
+	k_spinlock_key_t key;
+	int ret;
+
+	if (buf_addr(job->src, job->src_len, &msg.src) != 0 ||
+	    buf_addr(job->dst, job->dst_len, &msg.dst) != 0 ||
+	    buf_addr(job->ctx, job->ctx_len, &msg.ctx) != 0) {
+		return -EINVAL;
+	}
+
+	if (!atomic_get(&connected)) {
+		return -ENOTCONN;
+	}
+
+	if (job->src != NULL) {
+		(void)sys_cache_data_flush_range((void *)job->src, job->src_len);
+	}
+	if (job->dst != NULL) {
+		/* No dirty line may be written back over the output of the remote */
+		(void)sys_cache_data_flush_and_invd_range(job->dst, job->dst_len);
+	}
+	if (job->ctx != NULL) {
+		(void)sys_cache_data_flush_range(job->ctx, job->ctx_len);
+	}
+
+	job->done = done;
+
+	/* Queued first, the completion may arrive before the send returns */
+	key = k_spin_lock(&lock);
+	job->id = next_id++;
+	msg.id = job->id;
+	sys_slist_append(&pending, &job->node);
+	k_spin_unlock(&lock, key);
+
+	ret = ipc_service_send(&ept, &msg, sizeof(msg));
+	if (ret < 0) {
+		(void)job_remove(job);
+		return ret;
+	}
+
+	return 0;
+}
+
+int zdsp_offload_submit(struct zdsp_offload_job *job)
+{
+	return job_submit(job, NULL);
+}
+
+int zdsp_offload_run(struct zdsp_offload_job *job, k_timeout_t timeout)
+{
+	struct k_sem done;
+	int ret;
+
+	k_sem_init(&done, 0, 1);
+
+	ret = job_submit(job, &done);
+	if (ret == 0 && k_sem_take(&done, timeout) != 0) {
+		if (job_remove(job)) {
+			ret = -EAGAIN;
+		} else {
+			/* Completing right now */
+			(void)k_sem_take(&done, K_FOREVER);
+		}
+	}
+
+	job->done = NULL;
+
+	return (ret == 0) ? job->result : ret;
+}
+
+static int dsp_offload_host_init(void)
+{
+	const struct device *ipc = DSP_OFFLOAD_IPC;
+	int ret;
+
+	ret = ipc_service_open_instance(ipc);
+	if (ret < 0 && ret != -EALREADY) {
+		LOG_ERR("cannot open IPC instance (%d)", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc, &ept, &ept_cfg);
+	if (ret < 0) {
+		LOG_ERR("cannot register endpoint (%d)", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+SYS_INIT(dsp_offload_host_init, APPLICATION, CONFIG_DSP_OFFLOAD_INIT_PRIORITY);
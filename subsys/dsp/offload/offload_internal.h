@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DSP_OFFLOAD_OFFLOAD_INTERNAL_H_
+#define ZEPHYR_SUBSYS_DSP_OFFLOAD_OFFLOAD_INTERNAL_H_
+
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+
+/* Name of the IPC endpoint on both cores */
+#define DSP_OFFLOAD_EPT_NAME "dsp_offload"
+
+#define DSP_OFFLOAD_IPC DEVICE_DT_GET(DT_CHOSEN(zephyr_dsp_offload_ipc))
+
+/* Address of a NULL pointer */
+#define DSP_OFFLOAD_ADDR_NULL UINT32_MAX
+
+/* Job request from the host, sent back by the remote with the result set */
+struct dsp_offload_msg {
+	uint32_t id;
+	uint16_t op;
+	uint16_t reserved;
+	int32_t result;
+	uint32_t src;
+	uint32_t src_len;
+	uint32_t dst;
+	uint32_t dst_len;
+	uint32_t ctx;
+	uint32_t ctx_len;
+	uint32_t arg;
+};
+
+/* Local pointer to len bytes at an address received from the other core, NULL if invalid */
+void *dsp_offload_ptr(uint32_t addr, size_t len);
+
+#endif /* ZEPHYR_SUBSYS_DSP_OFFLOAD_OFFLOAD_INTERNAL_H_ */
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/cache.h>
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/dsp/offload.h>
+#include <zephyr/init.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/math_extras.h>
+
+#ifdef CONFIG_AUDIO_PIPELINE_ASRC
+#include <zephyr/audio/asrc.h>
+#endif
+
+#include "offload_internal.h"
+
+LOG_MODULE_DECLARE(dsp_offload, CONFIG_DSP_OFFLOAD_LOG_LEVEL);
+
+/* Attempts at sending a completion while the IPC buffer is full */
+#define SEND_RETRIES 100
+
+static struct ipc_ept ept;
+K_MSGQ_DEFINE(job_msgq, sizeof(struct dsp_offload_msg), CONFIG_DSP_OFFLOAD_MAX_JOBS, 4);
+
+/* Buffer referenced from a context, invalidated before use */
+static void *ctx_buf(uint32_t addr, size_t len)
+{
+	void *buf = dsp_offload_ptr(addr, len);
+
+	if (buf != NULL) {
+		(void)sys_cache_data_invd_range(buf, len);
+	}
+
+	return buf;
+}
+
+#define FIR_RUN(_sfx, _type)                                                                       \
+	static int fir_run_##_sfx(const struct zdsp_offload_req *req)                              \
+	{                                                                                          \
+		const struct zdsp_offload_fir *ctx = req->ctx;                                     \
+		struct zdsp_fir_##_sfx fir;                                                        \
+		size_t state_len;                                                                  \
+		size_t len;                                                                        \
+                                                                                                   \
+		if (ctx == NULL || req->ctx_len < sizeof(*ctx) || req->arg == 0 ||                 \
+		    size_mul_overflow(req->arg, sizeof(_type), &len) ||                            \
+		    req->src_len < len || req->dst_len < len) {                                    \
+			return -EINVAL;                                                            \
+		}                                                                                  \
+                                                                                                   \
+		/* Read once, the context is in memory shared with the host */                     \
+		fir.num_taps = ctx->num_taps;                                                      \
+		if (fir.num_taps == 0 ||                                                           \
+		    size_add_overflow(fir.num_taps, req->arg - 1, &state_len) ||                   \
+		    size_mul_overflow(state_len, sizeof(_type), &state_len)) {                     \
+			return -EINVAL;                                                            \
+		}                                                                                  \
+                                                                                                   \
+		fir.coeffs = ctx_buf(ctx->coeffs, fir.num_taps * sizeof(_type));                   \
+		fir.state = ctx_buf(ctx->state, state_len);                                        \
+		if (fir.coeffs == NULL || fir.state == NULL) {                                     \
+			return -EINVAL;                                                            \
+		}                                                                                  \
+                                                                                                   \
+		zdsp_fir_##_sfx(&fir, req->src, req->dst, req->arg);                               \
+		(void)sys_cache_data_flush_range(fir.state, state_len);                            \
+                                                                                                   \
+		return len;                                                                        \
+	}
+
+/* Only the fixed-point variants take a post shift */
+#define BIQUAD_RUN(_sfx, _type, _coeffs_per_stage, _fixed)                                         \
+	static int biquad_run_##_sfx(const struct zdsp_offload_req *req)                           \
+	{                                                                                          \
+		const struct zdsp_offload_biquad *ctx = req->ctx;                                  \
+		struct zdsp_biquad_##_sfx biquad;                                                  \
+		size_t len;                                                                        \
+                                                                                                   \
+		if (ctx == NULL || req->ctx_len < sizeof(*ctx) ||                                  \
+		    size_mul_overflow(req->arg, sizeof(_type), &len) ||                            \
+		    req->src_len < len || req->dst_len < len) {                                    \
+			return -EINVAL;                                                            \
+		}                                                                                  \
+                                                                                                   \
+		/* Read once, the context is in memory shared with the host */                     \
+		biquad.num_stages = ctx->num_stages;                                               \
+		IF_ENABLED(_fixed, (biquad.post_shift = ctx->post_shift;))                         \
+		if (biquad.num_stages == 0) {                                                      \
+			return -EINVAL;                                                            \
+		}                                                                                  \
+                                                                                                   \
+		biquad.coeffs = ctx_buf(ctx->coeffs,                                               \
+					(_coeffs_per_stage) * biquad.num_stages * sizeof(_type));  \
+		biquad.state = ctx_buf(ctx->state, 4 * biquad.num_stages * sizeof(_type));         \
+		if (biquad.coeffs == NULL || biquad.state == NULL) {                               \
+			return -EINVAL;                                                            \
+		}                                                                                  \
+                                                                                                   \
+		zdsp_biquad_##_sfx(&biquad, req->src, req->dst, req->arg);                         \
+		(void)sys_cache_data_flush_range(biquad.state,                                     \
+						 4 * biquad.num_stages * sizeof(_type));           \
+                                                                                                   \
+		return len;                                                                        \
+	}
+
+FIR_RUN(q15, q15_t)
+FIR_RUN(q31, q31_t)
+FIR_RUN(f32, float32_t)
+BIQUAD_RUN(q15, q15_t, 6, 1)
+BIQUAD_RUN(q31, q31_t, 5, 1)
+BIQUAD_RUN(f32, float32_t, 5, 0)
+
+#ifdef CONFIG_AUDIO_PIPELINE_ASRC
+static int asrc_run(const struct zdsp_offload_req *req)
+{
+	struct audio_asrc *asrc = req->ctx;
+	size_t frame_len;
+	int ret;
+
+	if (asrc == NULL || req->ctx_len != sizeof(*asrc) || asrc->channels == 0) {
+		return -EINVAL;
+	}
+
+	frame_len = asrc->channels * sizeof(int16_t);
+	if (req->src_len < req->arg * frame_len) {
+		return -EINVAL;
+	}
+
+	ret = audio_asrc_process(asrc, req->src, req->arg, req->dst, req->dst_len / frame_len);
+
+	return (ret < 0) ? ret : ret * frame_len;
+}
+#endif
+
+static int builtin_run(const struct zdsp_offload_req *req)
+{
+	switch (req->op) {
+	case ZDSP_OFFLOAD_OP_FIR_Q15:
+		return fir_run_q15(req);
+	case ZDSP_OFFLOAD_OP_FIR_Q31:
+		return fir_run_q31(req);
+	case ZDSP_OFFLOAD_OP_FIR_F32:
+		return fir_run_f32(req);
+	case ZDSP_OFFLOAD_OP_BIQUAD_Q15:
+		return biquad_run_q15(req);
+	case ZDSP_OFFLOAD_OP_BIQUAD_Q31:
+		return biquad_run_q31(req);
+	case ZDSP_OFFLOAD_OP_BIQUAD_F32:
+		return biquad_run_f32(req);
+#ifdef CONFIG_AUDIO_PIPELINE_ASRC
+	case ZDSP_OFFLOAD_OP_ASRC:
+		return asrc_run(req);
+#endif
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int job_run(const struct dsp_offload_msg *msg)
+{
+	struct zdsp_offload_req req = {
+		.op = msg->op,
+		.src_len = msg->src_len,
+		.dst_len = msg->dst_len,
+		.ctx_len = msg->ctx_len,
+		.arg = msg->arg,
+	};
+	int ret;
+
+	req.src = dsp_offload_ptr(msg->src, msg->src_len);
+	req.dst = dsp_offload_ptr(msg->dst, msg->dst_len);
+	req.ctx = dsp_offload_ptr(msg->ctx, msg->ctx_len);
+	if ((req.src == NULL && msg->src != DSP_OFFLOAD_ADDR_NULL) ||
+	    (req.dst == NULL && msg->dst != DSP_OFFLOAD_ADDR_NULL) ||
+	    (req.ctx == NULL && msg->ctx != DSP_OFFLOAD_ADDR_NULL)) {
+		return -EINVAL;
+	}
+
+	if (req.src != NULL) {
+		(void)sys_cache_data_invd_range((void *)req.src, req.src_len);
+	}
+	if (req.ctx != NULL) {
+		(void)sys_cache_data_invd_range(req.ctx, req.ctx_len);
+	}
+
+	ret = -ENOTSUP;
+	STRUCT_SECTION_FOREACH(zdsp_offload_handler, handler) {
+		if (handler->op == req.op) {
+			ret = handler->run(&req);
+			break;
+		}
+	}
+
+	if (ret == -ENOTSUP) {
+		ret = builtin_run(&req);
+	}
+
+	if (req.dst != NULL) {
+		(void)sys_cache_data_flush_range(req.dst, req.dst_len);
+	}
+	if (req.ctx != NULL) {
+		(void)sys_cache_data_flush_range(req.ctx, req.ctx_len);
+	}
+
+	return ret;
+}
+
+static void job_complete(struct dsp_offload_msg *msg, int result)
+{
+	int ret;
+
+	msg->result = result;
+
+	for (int i = 0; i < SEND_RETRIES; i++) {
+		ret = ipc_service_send(&ept, msg, sizeof(*msg));
+		if (ret != -ENOMEM && ret != -ENOBUFS) {
+			break;
+		}
+		k_yield();
+	}
+
+	if (ret < 0) {
+		LOG_ERR("cannot complete job %u (%d)", msg->id, ret);
+	}
+}
+
+static void ept_received(const void *data, size_t len, void *priv)
+{
+	struct dsp_offload_msg msg;
+
+	ARG_UNUSED(priv);
+
+	if (len != sizeof(msg)) {
+		LOG_WRN("invalid job of %zu bytes", len);
+		return;
+	}
+	memcpy(&msg, data, sizeof(msg));
+
+	if (k_msgq_put(&job_msgq, &msg, K_NO_WAIT) != 0) {
+		job_complete(&msg, -EBUSY);
+	}
+}
+
+static const struct ipc_ept_cfg ept_cfg = {
+	.name = DSP_OFFLOAD_EPT_NAME,
+	.cb = {
+		.received = ept_received,
+	},
+};
+
+static void dsp_offload_thread(void *p1, void *p2, void *p3)
+{
+	struct dsp_offload_msg msg;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&job_msgq, &msg, K_FOREVER);
+		job_complete(&msg, job_run(&msg));
+	}
+}
+
+K_THREAD_DEFINE(dsp_offload_tid, CONFIG_DSP_OFFLOAD_THREAD_STACK_SIZE, dsp_offload_thread, NULL,
+		NULL, NULL, CONFIG_DSP_OFFLOAD_THREAD_PRIORITY, 0, 0);
+
+static int dsp_offload_remote_init(void)
+{
+	const struct device *ipc = DSP_OFFLOAD_IPC;
+	int ret;
+
+	ret = ipc_service_open_instance(ipc);
+	if (ret < 0 && ret != -EALREADY) {
+		LOG_ERR("cannot open IPC instance (%d)", ret);
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc, &ept, &ept_cfg);
+	if (ret < 0) {
+		LOG_ERR("cannot register endpoint (%d)", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+SYS_INIT(dsp_offload_remote_init, APPLICATION, CONFIG_DSP_OFFLOAD_INIT_PRIORITY);
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Portable C implementations of the zdsp filtering and support functions.
+ *
+ * Backends use these for the functions their library does not provide, and custom backends may
+ * wrap them instead of providing their own implementation.
+ */
+
+#ifndef SUBSYS_MATH_PORTABLE_PUBLIC_ZDSP_PORTABLE_H_
+#define SUBSYS_MATH_PORTABLE_PUBLIC_ZDSP_PORTABLE_H_
+
+#include <string.h>
+
+#include <zephyr/dsp/dsp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline q15_t zdsp_portable_sat_q15(q63_t value)
+{
+	return (value > INT16_MAX) ? INT16_MAX : ((value < INT16_MIN) ? INT16_MIN : (q15_t)value);
+}
+
+static inline q31_t zdsp_portable_sat_q31(q63_t value)
+{
+	return (value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : (q31_t)value);
+}
+
+static inline void zdsp_portable_fir_q15(const struct zdsp_fir_q15 *fir,
+					 const DSP_DATA q15_t *src, DSP_DATA q15_t *dst,
+					 uint32_t block_size)
+{
+	DSP_DATA q15_t *state = fir->state;
+	uint32_t num_taps = fir->num_taps;
+
+	memcpy(&state[num_taps - 1U], src, block_size * sizeof(q15_t));
+
+	for (uint32_t n = 0; n < block_size; n++) {
+		q63_t acc = 0;
+
+		for (uint32_t k = 0; k < num_taps; k++) {
+			acc += (q31_t)state[n + k] * fir->coeffs[k];
+		}
+
+		dst[n] = zdsp_portable_sat_q15(acc >> 15);
+	}
+
+	memmove(state, &state[block_size], (num_taps - 1U) * sizeof(q15_t));
+}
+
+static inline void zdsp_portable_fir_q31(const struct zdsp_fir_q31 *fir,
+					 const DSP_DATA q31_t *src, DSP_DATA q31_t *dst,
+					 uint32_t block_size)
+{
+	DSP_DATA q31_t *state = fir->state;
+	uint32_t num_taps = fir->num_taps;
+
+	memcpy(&state[num_taps - 1U], src, block_size * sizeof(q31_t));
+
+	for (uint32_t n = 0; n < block_size; n++) {
+		q63_t acc = 0;
+
+		for (uint32_t k = 0; k < num_taps; k++) {
+			acc += (q63_t)state[n + k] * fir->coeffs[k];
+		}
+
+		dst[n] = (q31_t)(acc >> 31);
+	}
+
+	memmove(state, &state[block_size], (num_taps - 1U) * sizeof(q31_t));
+}
+
+static inline void zdsp_portable_fir_f32(const struct zdsp_fir_f32 *fir,
+					 const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+					 uint32_t block_size)
+{
+	DSP_DATA float32_t *state = fir->state;
+	uint32_t num_taps = fir->num_taps;
+
+	memcpy(&state[num_taps - 1U], src, block_size * sizeof(float32_t));
+
+	for (uint32_t n = 0; n < block_size; n++) {
+		float32_t acc = 0.0f;
+
+		for (uint32_t k = 0; k < num_taps; k++) {
+			acc += state[n + k] * fir->coeffs[k];
+		}
+
+		dst[n] = acc;
+	}
+
+	memmove(state, &state[block_size], (num_taps - 1U) * sizeof(float32_t));
+}
+
+static inline void zdsp_portable_biquad_q15(const struct zdsp_biquad_q15 *biquad,
+					    const DSP_DATA q15_t *src, DSP_DATA q15_t *dst,
+					    uint32_t block_size)
+{
+	const DSP_DATA q15_t *coeffs = biquad->coeffs;
+	DSP_DATA q15_t *state = biquad->state;
+	int shift = 15 - biquad->post_shift;
+
+	for (uint32_t stage = 0; stage < biquad->num_stages; stage++) {
+		q15_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+
+		for (uint32_t n = 0; n < block_size; n++) {
+			q15_t x0 = src[n];
+			q63_t acc = (q31_t)coeffs[0] * x0 + (q31_t)coeffs[2] * x1 +
+				    (q31_t)coeffs[3] * x2 + (q31_t)coeffs[4] * y1 +
+				    (q31_t)coeffs[5] * y2;
+			q15_t y0 = zdsp_portable_sat_q15(acc >> shift);
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = y0;
+			dst[n] = y0;
+		}
+
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+
+		coeffs += 6;
+		state += 4;
+		/* Later stages filter the output of the previous one */
+		src = dst;
+	}
+}
+
+static inline void zdsp_portable_biquad_q31(const struct zdsp_biquad_q31 *biquad,
+					    const DSP_DATA q31_t *src, DSP_DATA q31_t *dst,
+					    uint32_t block_size)
+{
+	const DSP_DATA q31_t *coeffs = biquad->coeffs;
+	DSP_DATA q31_t *state = biquad->state;
+	int shift = 31 - biquad->post_shift;
+
+	for (uint32_t stage = 0; stage < biquad->num_stages; stage++) {
+		q31_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+
+		for (uint32_t n = 0; n < block_size; n++) {
+			q31_t x0 = src[n];
+			q63_t acc = (q63_t)coeffs[0] * x0 + (q63_t)coeffs[1] * x1 +
+				    (q63_t)coeffs[2] * x2 + (q63_t)coeffs[3] * y1 +
+				    (q63_t)coeffs[4] * y2;
+			q31_t y0 = (q31_t)(acc >> shift);
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = y0;
+			dst[n] = y0;
+		}
+
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+
+		coeffs += 5;
+		state += 4;
+		src = dst;
+	}
+}
+
+static inline void zdsp_portable_biquad_f32(const struct zdsp_biquad_f32 *biquad,
+					    const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+					    uint32_t block_size)
+{
+	const DSP_DATA float32_t *coeffs = biquad->coeffs;
+	DSP_DATA float32_t *state = biquad->state;
+
+	for (uint32_t stage = 0; stage < biquad->num_stages; stage++) {
+		float32_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+
+		for (uint32_t n = 0; n < block_size; n++) {
+			float32_t x0 = src[n];
+			float32_t y0 = coeffs[0] * x0 + coeffs[1] * x1 + coeffs[2] * x2 +
+				       coeffs[3] * y1 + coeffs[4] * y2;
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = y0;
+			dst[n] = y0;
+		}
+
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+
+		coeffs += 5;
+		state += 4;
+		src = dst;
+	}
+}
+
+static inline void zdsp_portable_q15_to_q31(const DSP_DATA q15_t *src, DSP_DATA q31_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		dst[n] = (q31_t)((uint32_t)src[n] << 16);
+	}
+}
+
+static inline void zdsp_portable_q31_to_q15(const DSP_DATA q31_t *src, DSP_DATA q15_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		dst[n] = (q15_t)(src[n] >> 16);
+	}
+}
+
+static inline void zdsp_portable_q15_to_f32(const DSP_DATA q15_t *src, DSP_DATA float32_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		dst[n] = (float32_t)src[n] / 32768.0f;
+	}
+}
+
+static inline void zdsp_portable_f32_to_q15(const DSP_DATA float32_t *src, DSP_DATA q15_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		float32_t value = src[n] * 32768.0f;
+
+		/* Clamp before converting, out of range conversions are undefined */
+		if (value >= 32767.0f) {
+			dst[n] = INT16_MAX;
+		} else if (value <= -32768.0f) {
+			dst[n] = INT16_MIN;
+		} else {
+			dst[n] = (q15_t)value;
+		}
+	}
+}
+
+static inline void zdsp_portable_q31_to_f32(const DSP_DATA q31_t *src, DSP_DATA float32_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		dst[n] = (float32_t)src[n] / 2147483648.0f;
+	}
+}
+
+static inline void zdsp_portable_f32_to_q31(const DSP_DATA float32_t *src, DSP_DATA q31_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		float32_t value = src[n] * 2147483648.0f;
+
+		if (value >= 2147483648.0f) {
+			dst[n] = INT32_MAX;
+		} else if (value <= -2147483648.0f) {
+			dst[n] = INT32_MIN;
+		} else {
+			dst[n] = (q31_t)value;
+		}
+	}
+}
+
+static inline void zdsp_portable_s24_to_q31(const DSP_DATA uint8_t *src, DSP_DATA q31_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		dst[n] = (q31_t)(((uint32_t)src[0] << 8) | ((uint32_t)src[1] << 16) |
+				 ((uint32_t)src[2] << 24));
+		src += 3;
+	}
+}
+
+static inline void zdsp_portable_q31_to_s24(const DSP_DATA q31_t *src, DSP_DATA uint8_t *dst,
+					    uint32_t block_size)
+{
+	for (uint32_t n = 0; n < block_size; n++) {
+		uint32_t value = (uint32_t)src[n];
+
+		dst[0] = (uint8_t)(value >> 8);
+		dst[1] = (uint8_t)(value >> 16);
+		dst[2] = (uint8_t)(value >> 24);
+		dst += 3;
+	}
+}
+
+static inline void zdsp_portable_interleave_q15(const DSP_DATA q15_t *const *src,
+						uint32_t channels, DSP_DATA q15_t *dst,
+						uint32_t frames)
+{
+	for (uint32_t c = 0; c < channels; c++) {
+		const DSP_DATA q15_t *in = src[c];
+
+		for (uint32_t n = 0; n < frames; n++) {
+			dst[n * channels + c] = in[n];
+		}
+	}
+}
+
+static inline void zdsp_portable_deinterleave_q15(const DSP_DATA q15_t *src, uint32_t channels,
+						  DSP_DATA q15_t *const *dst, uint32_t frames)
+{
+	for (uint32_t c = 0; c < channels; c++) {
+		DSP_DATA q15_t *out = dst[c];
+
+		for (uint32_t n = 0; n < frames; n++) {
+			out[n] = src[n * channels + c];
+		}
+	}
+}
+
+static inline void zdsp_portable_interleave_q31(const DSP_DATA q31_t *const *src,
+						uint32_t channels, DSP_DATA q31_t *dst,
+						uint32_t frames)
+{
+	for (uint32_t c = 0; c < channels; c++) {
+		const DSP_DATA q31_t *in = src[c];
+
+		for (uint32_t n = 0; n < frames; n++) {
+			dst[n * channels + c] = in[n];
+		}
+	}
+}
+
+static inline void zdsp_portable_deinterleave_q31(const DSP_DATA q31_t *src, uint32_t channels,
+						  DSP_DATA q31_t *const *dst, uint32_t frames)
+{
+	for (uint32_t c = 0; c < channels; c++) {
+		DSP_DATA q31_t *out = dst[c];
+
+		for (uint32_t n = 0; n < frames; n++) {
+			out[n] = src[n * channels + c];
+		}
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUBSYS_MATH_PORTABLE_PUBLIC_ZDSP_PORTABLE_H_ */
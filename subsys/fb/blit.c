@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/display/blit.h>
+#include <zephyr/sys/byteorder.h>
+
+#ifdef CONFIG_BLIT_MCUX_PXP
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/dma/dma_mcux_pxp.h>
+#endif
+
+static size_t blit_bpp(enum display_pixel_format format)
+{
+	switch (format) {
+	case PIXEL_FORMAT_ARGB_8888:
+		return 4;
+	case PIXEL_FORMAT_RGB_888:
+		return 3;
+	case PIXEL_FORMAT_RGB_565:
+	case PIXEL_FORMAT_BGR_565:
+		return 2;
+	case PIXEL_FORMAT_L_8:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static inline uint8_t *blit_pixel(const struct blit_surface *s, size_t bpp, uint16_t x,
+				  uint16_t y)
+{
+	return (uint8_t *)s->buf + ((size_t)y * s->pitch + x) * bpp;
+}
+
+static inline uint32_t blit_from_565(uint16_t v)
+{
+	uint32_t r = (v >> 11) & 0x1F;
+	uint32_t g = (v >> 5) & 0x3F;
+	uint32_t b = v & 0x1F;
+
+	return 0xFF000000 | ((r << 3 | r >> 2) << 16) | ((g << 2 | g >> 4) << 8) |
+	       (b << 3 | b >> 2);
+}
+
+static inline uint16_t blit_to_565(uint32_t argb)
+{
+	return ((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F);
+}
+
+/* RGB_565 is big endian, BGR_565 holds the same layout in CPU byte order */
+static inline uint32_t blit_get(const uint8_t *p, enum display_pixel_format format)
+{
+	uint32_t v32;
+	uint16_t v16;
+
+	switch (format) {
+	case PIXEL_FORMAT_ARGB_8888:
+		memcpy(&v32, p, sizeof(v32));
+		return v32;
+	case PIXEL_FORMAT_RGB_888:
+		return 0xFF000000 | (p[0] << 16) | (p[1] << 8) | p[2];
+	case PIXEL_FORMAT_RGB_565:
+		return blit_from_565(sys_get_be16(p));
+	case PIXEL_FORMAT_BGR_565:
+		memcpy(&v16, p, sizeof(v16));
+		return blit_from_565(v16);
+	default:
+		return 0xFF000000 | (p[0] << 16) | (p[0] << 8) | p[0];
+	}
+}
+
+static inline void blit_set(uint8_t *p, enum display_pixel_format format, uint32_t argb)
+{
+	uint16_t v16;
+
+	switch (format) {
+	case PIXEL_FORMAT_ARGB_8888:
+		memcpy(p, &argb, sizeof(argb));
+		break;
+	case PIXEL_FORMAT_RGB_888:
+		p[0] = argb >> 16;
+		p[1] = argb >> 8;
+		p[2] = argb;
+		break;
+	case PIXEL_FORMAT_RGB_565:
+		sys_put_be16(blit_to_565(argb), p);
+		break;
+	case PIXEL_FORMAT_BGR_565:
+		v16 = blit_to_565(argb);
+		memcpy(p, &v16, sizeof(v16));
+		break;
+	default:
+		/* ITU-R BT.601 luma */
+		p[0] = (((argb >> 16) & 0xFF) * 77 + ((argb >> 8) & 0xFF) * 150 +
+			(argb & 0xFF) * 29) >> 8;
+		break;
+	}
+}
+
+static inline uint8_t blit_mix(uint32_t s, uint32_t d, uint32_t a)
+{
+	uint32_t v = (s & 0xFF) * a + (d & 0xFF) * (255 - a) + 128;
+
+	/* Exact division by 255 */
+	return (v + (v >> 8)) >> 8;
+}
+
+static int blit_check(const struct blit_surface *dst, const struct blit_surface *src,
+		      size_t *dst_bpp, size_t *src_bpp)
+{
+	*dst_bpp = blit_bpp(dst->format);
+	*src_bpp = blit_bpp(src->format);
+
+	if (*dst_bpp == 0 || *src_bpp == 0) {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+int blit_convert(const struct blit_surface *dst, const struct blit_surface *src)
+{
+	size_t dst_bpp;
+	size_t src_bpp;
+	int ret;
+
+	ret = blit_check(dst, src, &dst_bpp, &src_bpp);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (dst->width != src->width || dst->height != src->height) {
+		return -EINVAL;
+	}
+
+	for (uint16_t y = 0; y < src->height; y++) {
+		const uint8_t *s = blit_pixel(src, src_bpp, 0, y);
+		uint8_t *d = blit_pixel(dst, dst_bpp, 0, y);
+
+		if (src->format == dst->format) {
+			memmove(d, s, (size_t)src->width * src_bpp);
+		} else if (src_bpp == 2 && dst_bpp == 2 && IS_ENABLED(CONFIG_LITTLE_ENDIAN)) {
+			/* Between RGB_565 and BGR_565 only the byte order differs */
+			for (uint16_t x = 0; x < src->width; x++, s += 2, d += 2) {
+				uint8_t b = s[0];
+
+				d[0] = s[1];
+				d[1] = b;
+			}
+		} else {
+			for (uint16_t x = 0; x < src->width; x++, s += src_bpp, d += dst_bpp) {
+				blit_set(d, dst->format, blit_get(s, src->format));
+			}
+		}
+	}
+
+	return 0;
+}
+
+int blit_fill(const struct blit_surface *dst, uint32_t argb)
+{
+	size_t bpp = blit_bpp(dst->format);
+	size_t row = (size_t)dst->width * bpp;
+	uint8_t *first;
+
+	if (bpp == 0) {
+		return -ENOTSUP;
+	}
+
+	if (dst->height == 0 || dst->width == 0) {
+		return 0;
+	}
+
+	/* Pack the color once, then replicate the first row */
+	first = blit_pixel(dst, bpp, 0, 0);
+	blit_set(first, dst->format, argb);
+	for (size_t off = bpp; off < row; off += bpp) {
+		memcpy(first + off, first, bpp);
+	}
+
+	for (uint16_t y = 1; y < dst->height; y++) {
+		memcpy(blit_pixel(dst, bpp, 0, y), first, row);
+	}
+
+	return 0;
+}
+
+int blit_blend(const struct blit_surface *dst, const struct blit_surface *src, uint8_t alpha)
+{
+	size_t dst_bpp;
+	size_t src_bpp;
+	int ret;
+
+	ret = blit_check(dst, src, &dst_bpp, &src_bpp);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (dst->width != src->width || dst->height != src->height) {
+		return -EINVAL;
+	}
+
+	for (uint16_t y = 0; y < src->height; y++) {
+		const uint8_t *s = blit_pixel(src, src_bpp, 0, y);
+		uint8_t *d = blit_pixel(dst, dst_bpp, 0, y);
+
+		for (uint16_t x = 0; x < src->width; x++, s += src_bpp, d += dst_bpp) {
+			uint32_t sp = blit_get(s, src->format);
+			uint32_t dp;
+			uint32_t a = blit_mix(sp >> 24, 0, alpha);
+
+			if (a == 0) {
+				continue;
+			}
+
+			if (a == 255) {
+				blit_set(d, dst->format, sp);
+				continue;
+			}
+
+			dp = blit_get(d, dst->format);
+			dp = ((uint32_t)(a + blit_mix(dp >> 24, 0, 255 - a)) << 24) |
+			     (blit_mix(sp >> 16, dp >> 16, a) << 16) |
+			     (blit_mix(sp >> 8, dp >> 8, a) << 8) | blit_mix(sp, dp, a);
+			blit_set(d, dst->format, dp);
+		}
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_BLIT_MCUX_PXP
+
+static const struct device *const pxp_dev = DEVICE_DT_GET_ONE(nxp_pxp);
+static K_MUTEX_DEFINE(pxp_lock);
+static K_SEM_DEFINE(pxp_done, 0, 1);
+
+static void blit_pxp_callback(const struct device *dev, void *user_data, uint32_t channel,
+			      int status)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+	ARG_UNUSED(channel);
+	ARG_UNUSED(status);
+
+	k_sem_give(&pxp_done);
+}
+
+static int blit_pxp_rotate(const struct blit_surface *dst, const struct blit_surface *src,
+			   enum display_orientation rotation, size_t bpp)
+{
+	struct dma_config pxp_dma = {0};
+	struct dma_block_config pxp_block = {0};
+	int ret;
+
+	/* The PXP output covers the whole destination buffer */
+	if (src->format != dst->format || dst->pitch != dst->width) {
+		return -ENOTSUP;
+	}
+
+	switch (src->format) {
+	case PIXEL_FORMAT_RGB_565:
+		pxp_dma.dma_slot = DMA_MCUX_PXP_FMT(DMA_MCUX_PXP_FMT_RGB565);
+		break;
+	case PIXEL_FORMAT_RGB_888:
+		pxp_dma.dma_slot = DMA_MCUX_PXP_FMT(DMA_MCUX_PXP_FMT_RGB888);
+		break;
+	case PIXEL_FORMAT_ARGB_8888:
+		pxp_dma.dma_slot = DMA_MCUX_PXP_FMT(DMA_MCUX_PXP_FMT_ARGB8888);
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	/* The rotation values match the enum display_orientation ones */
+	pxp_dma.dma_slot |= DMA_MCUX_PXP_CMD(rotation);
+	pxp_dma.linked_channel = DMA_MCUX_PXP_FLIP(DMA_MCUX_PXP_FLIP_DISABLE);
+
+	pxp_block.source_address = (uint32_t)src->buf;
+	pxp_block.dest_address = (uint32_t)dst->buf;
+	pxp_block.block_size = MAX((size_t)src->pitch * src->height,
+				   (size_t)dst->pitch * dst->height) * bpp;
+
+	pxp_dma.channel_direction = MEMORY_TO_MEMORY;
+	pxp_dma.source_data_size = src->pitch * bpp;
+	pxp_dma.dest_data_size = dst->pitch * bpp;
+	pxp_dma.source_burst_length = src->height;
+	pxp_dma.dest_burst_length = dst->height;
+	pxp_dma.head_block = &pxp_block;
+	pxp_dma.dma_callback = blit_pxp_callback;
+
+	k_mutex_lock(&pxp_lock, K_FOREVER);
+
+	ret = dma_config(pxp_dev, 0, &pxp_dma);
+	if (ret == 0) {
+		ret = dma_start(pxp_dev, 0);
+	}
+	if (ret == 0) {
+		k_sem_take(&pxp_done, K_FOREVER);
+	}
+
+	k_mutex_unlock(&pxp_lock);
+
+	return ret;
+}
+
+#endif /* CONFIG_BLIT_MCUX_PXP */
+
+int blit_rotate(const struct blit_surface *dst, const struct blit_surface *src,
+		enum display_orientation rotation)
+{
+	bool swap = rotation == DISPLAY_ORIENTATION_ROTATED_90 ||
+		    rotation == DISPLAY_ORIENTATION_ROTATED_270;
+	size_t dst_bpp;
+	size_t src_bpp;
+	int ret;
+
+	ret = blit_check(dst, src, &dst_bpp, &src_bpp);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if ((swap ? dst->height : dst->width) != src->width ||
+	    (swap ? dst->width : dst->height) != src->height) {
+		return -EINVAL;
+	}
+
+	if (rotation == DISPLAY_ORIENTATION_NORMAL) {
+		return blit_convert(dst, src);
+	}
+
+#ifdef CONFIG_BLIT_MCUX_PXP
+	ret = blit_pxp_rotate(dst, src, rotation, src_bpp);
+	if (ret != -ENOTSUP) {
+		return ret;
+	}
+#endif
+
+	for (uint16_t y = 0; y < dst->height; y++) {
+		uint8_t *d = blit_pixel(dst, dst_bpp, 0, y);
+
+		for (uint16_t x = 0; x < dst->width; x++, d += dst_bpp) {
+			uint16_t sx;
+			uint16_t sy;
+			const uint8_t *s;
+
+			if (rotation == DISPLAY_ORIENTATION_ROTATED_90) {
+				sx = y;
+				sy = src->height - 1 - x;
+			} else if (rotation == DISPLAY_ORIENTATION_ROTATED_180) {
+				sx = src->width - 1 - x;
+				sy = src->height - 1 - y;
+			} else {
+				sx = src->width - 1 - y;
+				sy = x;
+			}
+
+			s = blit_pixel(src, src_bpp, sx, sy);
+			if (src->format == dst->format) {
+				memcpy(d, s, dst_bpp);
+			} else {
+				blit_set(d, dst->format, blit_get(s, src->format));
+			}
+		}
+	}
+
+	return 0;
+}
+
+int blit_scale(const struct blit_surface *dst, const struct blit_surface *src)
+{
+	uint32_t step_x;
+	uint32_t step_y;
+	size_t dst_bpp;
+	size_t src_bpp;
+	int ret;
+
+	ret = blit_check(dst, src, &dst_bpp, &src_bpp);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (dst->width == 0 || dst->height == 0) {
+		return 0;
+	}
+
+	/* 16.16 fixed point source steps, sampling at the pixel centers */
+	step_x = ((uint32_t)src->width << 16) / dst->width;
+	step_y = ((uint32_t)src->height << 16) / dst->height;
+
+	for (uint16_t y = 0; y < dst->height; y++) {
+		uint16_t sy = (step_y / 2 + y * step_y) >> 16;
+		uint8_t *d = blit_pixel(dst, dst_bpp, 0, y);
+		uint32_t fx = step_x / 2;
+
+		for (uint16_t x = 0; x < dst->width; x++, d += dst_bpp, fx += step_x) {
+			const uint8_t *s = blit_pixel(src, src_bpp, fx >> 16, sy);
+
+			if (src->format == dst->format) {
+				memcpy(d, s, dst_bpp);
+			} else {
+				blit_set(d, dst->format, blit_get(s, src->format));
+			}
+		}
+	}
+
+	return 0;
+}
@@ -7,6 +7,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/device.h>
 #include <zephyr/storage/disk_access.h>
+#include <zephyr/storage/disk_cache.h>
 
 #include "ext2.h"
 #include "ext2_struct.h"
@@ -40,7 +41,9 @@ static int disk_read(const char *disk, uint8_t *buf, uint32_t start, uint32_t nu
 	do {
 		rc = disk_access_ioctl(disk, DISK_IOCTL_CTRL_SYNC, NULL);
 		if (rc == 0) {
-			rc = disk_access_read(disk, buf, start, num);
+			rc = IS_ENABLED(CONFIG_EXT2_DISK_CACHE) ?
+				disk_cache_read(disk, buf, start, num) :
+				disk_access_read(disk, buf, start, num);
 			LOG_DBG("disk read: (start:%d, num:%d) (ret: %d)", start, num, rc);
 		}
 	} while ((rc == -EBUSY) && (loop++ < 16));
@@ -54,7 +57,9 @@ static int disk_write(const char *disk, const uint8_t *buf, uint32_t start, uint
 	do {
 		rc = disk_access_ioctl(disk, DISK_IOCTL_CTRL_SYNC, NULL);
 		if (rc == 0) {
-			rc = disk_access_write(disk, buf, start, num);
+			rc = IS_ENABLED(CONFIG_EXT2_DISK_CACHE) ?
+				disk_cache_write(disk, buf, start, num) :
+				disk_access_write(disk, buf, start, num);
 			LOG_DBG("disk write: (start:%d, num:%d) (ret: %d)", start, num, rc);
 		}
 	} while ((rc == -EBUSY) && (loop++ < 16));
@@ -133,6 +138,9 @@ static int disk_access_sync(struct ext2_data *fs)
 	struct disk_data *disk = fs->backend;
 
 	LOG_DBG("Sync disk %s", disk->name);
+	if (IS_ENABLED(CONFIG_EXT2_DISK_CACHE)) {
+		return disk_cache_sync(disk->name);
+	}
 	return disk_access_ioctl(disk->name, DISK_IOCTL_CTRL_SYNC, NULL);
 }
 
@@ -169,6 +177,11 @@ int ext2_init_disk_access_backend(struct ext2_data *fs, const void *storage_dev,
 		return rc;
 	}
 
+	if (IS_ENABLED(CONFIG_EXT2_DISK_CACHE)) {
+		/* Media may have changed since the disk was last mounted */
+		disk_cache_invalidate(name);
+	}
+
 	disk_data = (struct disk_data) {
 		.name = storage_dev,
 		.sector_size = sector_size,
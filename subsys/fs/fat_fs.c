@@ -26,8 +26,27 @@ LOG_MODULE_DECLARE(fs, CONFIG_FS_LOG_LEVEL);
 K_MEM_SLAB_DEFINE(fatfs_dirp_pool, sizeof(DIR),
 			CONFIG_FS_FATFS_NUM_DIRS, 4);
 
+#if defined(CONFIG_FS_FATFS_WRITE_BUFFER_SIZE)
+#define FATFS_WB_SIZE CONFIG_FS_FATFS_WRITE_BUFFER_SIZE
+#else
+#define FATFS_WB_SIZE 0
+#endif
+
+BUILD_ASSERT((FATFS_WB_SIZE % CONFIG_FS_FATFS_MAX_SS) == 0,
+	     "Write buffer size must be a multiple of the sector size");
+
+/* FatFs file object, followed by the write buffer if enabled */
+struct fatfs_file {
+	FIL fil;
+#if FATFS_WB_SIZE
+	/* Number of bytes buffered, to be written at the FatFs file position */
+	size_t wb_len;
+	uint8_t wb[FATFS_WB_SIZE] __aligned(4);
+#endif
+};
+
 /* Memory pool for FatFs file objects */
-K_MEM_SLAB_DEFINE(fatfs_filep_pool, sizeof(FIL),
+K_MEM_SLAB_DEFINE(fatfs_filep_pool, sizeof(struct fatfs_file),
 			CONFIG_FS_FATFS_NUM_FILES, 4);
 
 static int translate_error(int error)
@@ -114,6 +133,37 @@ static uint8_t translate_flags(fs_mode_t flags)
 	return fat_mode;
 }
 
+#if FATFS_WB_SIZE
+/* Writes the buffered data at the FatFs file position */
+static int fatfs_wb_flush(struct fs_file_t *zfp)
+{
+	struct fatfs_file *file = zfp->filep;
+	unsigned int bw;
+	FRESULT res;
+	size_t len = file->wb_len;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	file->wb_len = 0;
+
+	res = f_write(&file->fil, file->wb, len, &bw);
+	if (res != FR_OK) {
+		return translate_error(res);
+	}
+
+	return (bw < len) ? -ENOSPC : 0;
+}
+#else
+static inline int fatfs_wb_flush(struct fs_file_t *zfp)
+{
+	ARG_UNUSED(zfp);
+
+	return 0;
+}
+#endif /* FATFS_WB_SIZE */
+
 static int fatfs_open(struct fs_file_t *zfp, const char *file_name,
 		      fs_mode_t mode)
 {
@@ -123,6 +173,9 @@ static int fatfs_open(struct fs_file_t *zfp, const char *file_name,
 
 	if (k_mem_slab_alloc(&fatfs_filep_pool, &ptr, K_NO_WAIT) == 0) {
 		(void)memset(ptr, 0, sizeof(FIL));
+#if FATFS_WB_SIZE
+		((struct fatfs_file *)ptr)->wb_len = 0;
+#endif
 		zfp->filep = ptr;
 	} else {
 		return -ENOMEM;
@@ -143,6 +196,9 @@ static int fatfs_open(struct fs_file_t *zfp, const char *file_name,
 static int fatfs_close(struct fs_file_t *zfp)
 {
 	FRESULT res;
+	int rc;
+
+	rc = fatfs_wb_flush(zfp);
 
 	res = f_close(zfp->filep);
 
@@ -150,7 +206,7 @@ static int fatfs_close(struct fs_file_t *zfp)
 	k_mem_slab_free(&fatfs_filep_pool, zfp->filep);
 	zfp->filep = NULL;
 
-	return translate_error(res);
+	return (rc < 0) ? rc : translate_error(res);
 }
 
 static int fatfs_unlink(struct fs_mount_t *mountp, const char *path)
@@ -194,6 +250,12 @@ static ssize_t fatfs_read(struct fs_file_t *zfp, void *ptr, size_t size)
 {
 	FRESULT res;
 	unsigned int br;
+	int rc;
+
+	rc = fatfs_wb_flush(zfp);
+	if (rc < 0) {
+		return rc;
+	}
 
 	res = f_read(zfp->filep, ptr, size, &br);
 	if (res != FR_OK) {
@@ -203,13 +265,73 @@ static ssize_t fatfs_read(struct fs_file_t *zfp, void *ptr, size_t size)
 	return br;
 }
 
+#if FATFS_WB_SIZE
+/*
+ * Buffers the data so that it is written to FatFs in whole multiples of the
+ * buffer size, at file positions aligned to the buffer size. Aligned data of
+ * at least the buffer size is written directly.
+ */
+static FRESULT fatfs_wb_write(struct fs_file_t *zfp, const uint8_t *ptr, size_t size,
+			      unsigned int *bw)
+{
+	struct fatfs_file *file = zfp->filep;
+	FRESULT res = FR_OK;
+	size_t done = 0;
+
+	/* Report the error of f_write() now rather than when flushing */
+	if (!(file->fil.flag & FA_WRITE)) {
+		return FR_DENIED;
+	}
+
+	while (done < size) {
+		FSIZE_t pos = f_tell(&file->fil) + file->wb_len;
+		size_t room = FATFS_WB_SIZE - (pos % FATFS_WB_SIZE);
+		size_t len = MIN(room, size - done);
+
+		if ((file->wb_len == 0) && (room == FATFS_WB_SIZE) &&
+		    ((size - done) >= FATFS_WB_SIZE)) {
+			unsigned int written;
+
+			len = ROUND_DOWN(size - done, FATFS_WB_SIZE);
+			res = f_write(&file->fil, ptr + done, len, &written);
+			done += written;
+			if ((res != FR_OK) || (written < len)) {
+				break;
+			}
+			continue;
+		}
+
+		memcpy(&file->wb[file->wb_len], ptr + done, len);
+		file->wb_len += len;
+		done += len;
+
+		if (len == room) {
+			unsigned int written;
+
+			len = file->wb_len;
+			file->wb_len = 0;
+			res = f_write(&file->fil, file->wb, len, &written);
+			if ((res != FR_OK) || (written < len)) {
+				/* Data accepted before this call is lost */
+				done -= MIN(done, len - written);
+				break;
+			}
+		}
+	}
+
+	*bw = done;
+
+	return res;
+}
+#endif /* FATFS_WB_SIZE */
+
 static ssize_t fatfs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 {
 	int res = -ENOTSUP;
 
 #if !defined(CONFIG_FS_FATFS_READ_ONLY)
 	unsigned int bw;
-	off_t pos = f_size((FIL *)zfp->filep);
+	off_t pos;
 	res = FR_OK;
 
 	/* FA_APPEND flag means that file has been opened for append.
@@ -218,11 +340,20 @@ static ssize_t fatfs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 	 * at the end before each write if FA_APPEND is set.
 	 */
 	if (zfp->flags & FS_O_APPEND) {
+		res = fatfs_wb_flush(zfp);
+		if (res < 0) {
+			return res;
+		}
+		pos = f_size((FIL *)zfp->filep);
 		res = f_lseek(zfp->filep, pos);
 	}
 
 	if (res == FR_OK) {
+#if FATFS_WB_SIZE
+		res = fatfs_wb_write(zfp, ptr, size, &bw);
+#else
 		res = f_write(zfp->filep, ptr, size, &bw);
+#endif
 	}
 
 	if (res != FR_OK) {
@@ -239,6 +370,12 @@ static int fatfs_seek(struct fs_file_t *zfp, off_t offset, int whence)
 {
 	FRESULT res = FR_OK;
 	off_t pos;
+	int rc;
+
+	rc = fatfs_wb_flush(zfp);
+	if (rc < 0) {
+		return rc;
+	}
 
 	switch (whence) {
 	case FS_SEEK_SET:
@@ -265,7 +402,11 @@ static int fatfs_seek(struct fs_file_t *zfp, off_t offset, int whence)
 
 static off_t fatfs_tell(struct fs_file_t *zfp)
 {
+#if FATFS_WB_SIZE
+	return f_tell((FIL *)zfp->filep) + ((struct fatfs_file *)zfp->filep)->wb_len;
+#else
 	return f_tell((FIL *)zfp->filep);
+#endif
 }
 
 static int fatfs_truncate(struct fs_file_t *zfp, off_t length)
@@ -273,6 +414,11 @@ static int fatfs_truncate(struct fs_file_t *zfp, off_t length)
 	int res = -ENOTSUP;
 
 #if !defined(CONFIG_FS_FATFS_READ_ONLY)
+	res = fatfs_wb_flush(zfp);
+	if (res < 0) {
+		return res;
+	}
+
 	off_t cur_length = f_size((FIL *)zfp->filep);
 
 	/* f_lseek expands file if new position is larger than file size */
@@ -319,11 +465,34 @@ static int fatfs_truncate(struct fs_file_t *zfp, off_t length)
 	return res;
 }
 
+static int fatfs_preallocate(struct fs_file_t *zfp, off_t length)
+{
+	int res = -ENOTSUP;
+
+#if defined(CONFIG_FS_FATFS_PREALLOCATE)
+	res = fatfs_wb_flush(zfp);
+	if (res < 0) {
+		return res;
+	}
+
+	/* Allocate the contiguous clusters now, so that writes do not need to */
+	res = f_expand(zfp->filep, length, 1);
+	res = translate_error(res);
+#endif
+
+	return res;
+}
+
 static int fatfs_sync(struct fs_file_t *zfp)
 {
 	int res = -ENOTSUP;
 
 #if !defined(CONFIG_FS_FATFS_READ_ONLY)
+	res = fatfs_wb_flush(zfp);
+	if (res < 0) {
+		return res;
+	}
+
 	res = f_sync(zfp->filep);
 	res = translate_error(res);
 #endif
@@ -541,6 +710,7 @@ static const struct fs_file_system_t fatfs_fs = {
 	.lseek = fatfs_seek,
 	.tell = fatfs_tell,
 	.truncate = fatfs_truncate,
+	.preallocate = fatfs_preallocate,
 	.sync = fatfs_sync,
 	.opendir = fatfs_opendir,
 	.readdir = fatfs_readdir,
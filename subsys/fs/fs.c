@@ -319,6 +319,26 @@ int fs_truncate(struct fs_file_t *zfp, off_t length)
 	return rc;
 }
 
+int fs_preallocate(struct fs_file_t *zfp, off_t length)
+{
+	int rc = -EINVAL;
+
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	CHECKIF(zfp->mp->fs->preallocate == NULL) {
+		return -ENOTSUP;
+	}
+
+	rc = zfp->mp->fs->preallocate(zfp, length);
+	if (rc < 0) {
+		LOG_ERR("file preallocate error (%d)", rc);
+	}
+
+	return rc;
+}
+
 int fs_sync(struct fs_file_t *zfp)
 {
 	int rc = -EINVAL;
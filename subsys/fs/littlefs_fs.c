@@ -22,6 +22,9 @@
 #include <zephyr/drivers/flash.h>
 #include <zephyr/storage/flash_map.h>
 #endif
+#ifdef CONFIG_FS_LITTLEFS_FMP_XIP_READ
+#include <zephyr/cache.h>
+#endif
 #ifdef CONFIG_FS_LITTLEFS_BLK_DEV
 #include <zephyr/storage/disk_access.h>
 #endif
@@ -74,18 +77,28 @@ static inline bool littlefs_on_blkdev(int flags)
 	return (flags & FS_MOUNT_FLAG_USE_DISK_ACCESS) ? true : false;
 }
 
-static inline void *fc_allocate(size_t size)
+static inline struct k_heap *fc_heap(struct fs_littlefs *fs)
+{
+#ifdef CONFIG_FS_LITTLEFS_HEAP_BUFFERS
+	if (fs->heap != NULL) {
+		return fs->heap;
+	}
+#endif
+	return &file_cache_heap;
+}
+
+static inline void *fc_allocate(struct fs_littlefs *fs, size_t size)
 {
 	void *ret = NULL;
 
-	ret = k_heap_alloc(&file_cache_heap, size, K_NO_WAIT);
+	ret = k_heap_alloc(fc_heap(fs), size, K_NO_WAIT);
 
 	return ret;
 }
 
-static inline void fc_release(void *buf)
+static inline void fc_release(struct fs_littlefs *fs, void *buf)
 {
-	k_heap_free(&file_cache_heap, buf);
+	k_heap_free(fc_heap(fs), buf);
 }
 
 static inline void fs_lock(struct fs_littlefs *fs)
@@ -171,12 +184,33 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+/* Drop data cached from the XIP window for a range which was modified */
+static inline void xip_invalidate(const struct lfs_config *c, size_t offset, size_t size)
+{
+#ifdef CONFIG_FS_LITTLEFS_FMP_XIP_READ
+	const struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	if (fs->xip_base != NULL) {
+		(void)sys_cache_data_invd_range((void *)(fs->xip_base + offset), size);
+	}
+#endif /* CONFIG_FS_LITTLEFS_FMP_XIP_READ */
+}
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_XIP_READ
+	const struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	if (fs->xip_base != NULL) {
+		memcpy(buffer, fs->xip_base + offset, size);
+		return LFS_ERR_OK;
+	}
+#endif /* CONFIG_FS_LITTLEFS_FMP_XIP_READ */
+
 	int rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -190,6 +224,8 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+	xip_invalidate(c, offset, size);
+
 	return errno_to_lfs(rc);
 }
 
@@ -200,6 +236,8 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	int rc = flash_area_flatten(fa, offset, c->block_size);
 
+	xip_invalidate(c, offset, c->block_size);
+
 	return errno_to_lfs(rc);
 }
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
@@ -264,7 +302,7 @@ static void release_file_data(struct fs_file_t *fp)
 	struct lfs_file_data *fdp = fp->filep;
 
 	if (fdp->config.buffer) {
-		fc_release(fdp->cache_block);
+		fc_release(fp->mp->fs_data, fdp->cache_block);
 	}
 
 	k_mem_slab_free(&file_data_pool, fp->filep);
@@ -302,7 +340,7 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 
 	memset(fdp, 0, sizeof(*fdp));
 
-	fdp->cache_block = fc_allocate(lfs->cfg->cache_size);
+	fdp->cache_block = fc_allocate(fs, lfs->cfg->cache_size);
 	if (fdp->cache_block == NULL) {
 		ret = -ENOMEM;
 		goto out;
@@ -897,6 +935,63 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 	return 0;
 }
 
+#ifdef CONFIG_FS_LITTLEFS_HEAP_BUFFERS
+static void littlefs_free_buffers(struct fs_littlefs *fs)
+{
+	if ((fs->heap == NULL) || (fs->cfg.lookahead_buffer == NULL)) {
+		return;
+	}
+
+	/* Buffers are carved from a single allocation, see below */
+	k_heap_free(fs->heap, fs->cfg.lookahead_buffer);
+	fs->cfg.read_buffer = NULL;
+	fs->cfg.prog_buffer = NULL;
+	fs->cfg.lookahead_buffer = NULL;
+}
+
+static int littlefs_alloc_buffers(struct fs_littlefs *fs)
+{
+	struct lfs_config *lcp = &fs->cfg;
+	uint8_t *buf;
+
+	if (fs->heap == NULL) {
+		return 0;
+	}
+
+	if ((lcp->read_buffer != NULL) || (lcp->prog_buffer != NULL) ||
+	    (lcp->lookahead_buffer != NULL)) {
+		LOG_ERR("Buffers must not be set when allocated from a heap");
+		return -EINVAL;
+	}
+
+	/* Lookahead buffer goes first, its size is a multiple of 8 so the
+	 * caches following it keep the alignment of the allocation.
+	 */
+	buf = k_heap_aligned_alloc(fs->heap, sizeof(uint32_t),
+				   lcp->lookahead_size + (2 * lcp->cache_size), K_NO_WAIT);
+	if (buf == NULL) {
+		LOG_ERR("Can't allocate %u byte caches and %u byte lookahead buffer",
+			lcp->cache_size, lcp->lookahead_size);
+		return -ENOMEM;
+	}
+
+	lcp->lookahead_buffer = buf;
+	lcp->read_buffer = buf + lcp->lookahead_size;
+	lcp->prog_buffer = buf + lcp->lookahead_size + lcp->cache_size;
+
+	return 0;
+}
+#else
+static inline void littlefs_free_buffers(struct fs_littlefs *fs)
+{
+}
+
+static inline int littlefs_alloc_buffers(struct fs_littlefs *fs)
+{
+	return 0;
+}
+#endif /* CONFIG_FS_LITTLEFS_HEAP_BUFFERS */
+
 static int littlefs_init_fs(struct fs_littlefs *fs, void *dev_id, int flags)
 {
 	int ret = 0;
@@ -918,7 +1013,8 @@ static int littlefs_init_fs(struct fs_littlefs *fs, void *dev_id, int flags)
 	if (ret < 0) {
 		return ret;
 	}
-	return 0;
+
+	return littlefs_alloc_buffers(fs);
 }
 
 static int littlefs_mount(struct fs_mount_t *mountp)
@@ -968,6 +1064,7 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 
 out:
 	if (ret < 0) {
+		littlefs_free_buffers(fs);
 		fs->backend = NULL;
 	}
 
@@ -1007,6 +1104,7 @@ static int littlefs_mkfs(uintptr_t dev_id, void *cfg, int flags)
 		goto out;
 	}
 out:
+	littlefs_free_buffers(fs);
 	fs->backend = NULL;
 	fs_unlock(fs);
 	return ret;
@@ -1028,6 +1126,7 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
+	littlefs_free_buffers(fs);
 	fs->backend = NULL;
 	fs_unlock(fs);
 
@@ -1070,6 +1169,13 @@ static const struct fs_file_system_t littlefs_fs = {
 #define FS_DISK_VERSION(inst)
 #endif
 
+#ifdef CONFIG_FS_LITTLEFS_FMP_XIP_READ
+#define FS_XIP_BASE(inst) \
+	.xip_base = (const uint8_t *)DT_INST_PROP_OR(inst, xip_address, 0),
+#else
+#define FS_XIP_BASE(inst)
+#endif
+
 #define DEFINE_FS(inst) \
 static uint8_t __aligned(4) \
 	read_buffer_##inst[DT_INST_PROP(inst, cache_size)]; \
@@ -1098,6 +1204,7 @@ static struct fs_littlefs fs_data_##inst = { \
 		.lookahead_buffer = lookahead_buffer_##inst, \
 		FS_DISK_VERSION(inst) \
 	}, \
+	FS_XIP_BASE(inst) \
 }; \
 struct fs_mount_t FS_FSTAB_ENTRY(DT_DRV_INST(inst)) = { \
 	.type = FS_LITTLEFS, \
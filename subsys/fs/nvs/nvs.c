@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <zephyr/fs/nvs.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/crc.h>
 #include "nvs_priv.h"
 
@@ -19,6 +20,11 @@ LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate);
 static int nvs_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+static K_KERNEL_STACK_DEFINE(nvs_gc_stack, CONFIG_NVS_BACKGROUND_GC_STACK_SIZE);
+static struct k_work_q nvs_gc_workq;
+#endif
+
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 
 static inline size_t nvs_lookup_cache_pos(uint16_t id)
@@ -979,6 +985,52 @@ end:
 	return rc;
 }
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+/* Returns true when the free space left in the active sector is below the
+ * background garbage collection threshold.
+ */
+static inline bool nvs_gc_needed(struct nvs_fs *fs)
+{
+	return (fs->ate_wra - fs->data_wra) < CONFIG_NVS_BACKGROUND_GC_THRESHOLD;
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc = 0;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* A write might have already switched to the next sector */
+	if (fs->ready && nvs_gc_needed(fs)) {
+		rc = nvs_sector_close(fs);
+		if (rc == 0) {
+			rc = nvs_gc(fs);
+		}
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+
+	if (rc) {
+		LOG_ERR("Background garbage collection failed, returned = %d", rc);
+	}
+}
+
+static int nvs_gc_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "nvs_gc",
+	};
+
+	k_work_queue_start(&nvs_gc_workq, nvs_gc_stack, K_KERNEL_STACK_SIZEOF(nvs_gc_stack),
+			   CONFIG_NVS_BACKGROUND_GC_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(nvs_gc_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 int nvs_clear(struct nvs_fs *fs)
 {
 	int rc;
@@ -989,6 +1041,12 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	struct k_work_sync sync;
+
+	k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1010,6 +1068,9 @@ int nvs_mount(struct nvs_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->nvs_lock);
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1170,11 +1231,23 @@ no_cached_entry:
 		}
 
 		if (fs->ate_wra >= (fs->data_wra + required_space)) {
+#ifdef CONFIG_NVS_BACKGROUND_GC
+			bool gc_needed = nvs_gc_needed(fs);
+#endif
 
 			rc = nvs_flash_wrt_entry(fs, id, data, len);
 			if (rc) {
 				goto end;
 			}
+#ifdef CONFIG_NVS_BACKGROUND_GC
+			/* Only schedule the garbage collection when this write crosses the
+			 * threshold, so that a sector which is still short of space after
+			 * the garbage collection does not trigger it again.
+			 */
+			if (!gc_needed && nvs_gc_needed(fs)) {
+				k_work_submit_to_queue(&nvs_gc_workq, &fs->gc_work);
+			}
+#endif
 			break;
 		}
 
@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <zephyr/fs/zms.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/crc.h>
 #include "zms_priv.h"
 #ifdef CONFIG_ZMS_LOOKUP_CACHE_FOR_SETTINGS
@@ -27,6 +28,11 @@ static int zms_get_sector_header(struct zms_fs *fs, uint64_t addr, struct zms_at
 static int zms_ate_valid_different_sector(struct zms_fs *fs, const struct zms_ate *entry,
 					  uint8_t cycle_cnt);
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+static K_KERNEL_STACK_DEFINE(zms_gc_stack, CONFIG_ZMS_BACKGROUND_GC_STACK_SIZE);
+static struct k_work_q zms_gc_workq;
+#endif
+
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 
 static inline size_t zms_lookup_cache_pos(uint32_t id)
@@ -761,6 +767,115 @@ static int zms_add_gc_done_ate(struct zms_fs *fs)
  * 4- Steps [2..3] occurred 255 times in a row
  * At this point the sector that we should erase becomes closed.
  */
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT
+BUILD_ASSERT(SIZEOF_FIELD(struct zms_fs, lookup_cache) <= UINT16_MAX,
+	     "ZMS lookup cache too large to be checkpointed");
+
+/* Store a copy of the lookup cache right after the gc done ATE of the active
+ * sector, so that the next mount only needs to replay the ATEs written after
+ * it. The copy is skipped if it does not fit, the next mount then rebuilds the
+ * cache from all ATEs.
+ */
+static int zms_lookup_cache_save(struct zms_fs *fs)
+{
+	const size_t len = sizeof(fs->lookup_cache);
+
+	if ((len > (fs->sector_size - 5 * fs->ate_size)) ||
+	    (fs->ate_wra < (fs->data_wra + zms_al_size(fs, len) + fs->ate_size))) {
+		LOG_DBG("No space for lookup cache checkpoint");
+		return 0;
+	}
+
+	fs->lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE] = ZMS_LOOKUP_CACHE_CKPT_TAG;
+
+	return zms_flash_write_entry(fs, ZMS_LOOKUP_CACHE_CKPT_ID, fs->lookup_cache, len);
+}
+
+/* Load the lookup cache from the checkpoint of the active sector and replay
+ * the ATEs written after it.
+ * return 0 on success, -ENOENT if there is no valid checkpoint
+ */
+static int zms_lookup_cache_load(struct zms_fs *fs)
+{
+	int rc;
+	uint64_t addr;
+	uint64_t ckpt_addr;
+	uint64_t data_addr;
+	uint64_t *cache_entry;
+	uint8_t cycle_cnt;
+	struct zms_ate ate;
+	struct zms_ate prev_ate;
+
+	rc = zms_get_sector_cycle(fs, fs->ate_wra, &cycle_cnt);
+	if (rc) {
+		return rc;
+	}
+
+	/* Look for the checkpoint, from the newest ATE of the active sector */
+	for (addr = fs->ate_wra + fs->ate_size;
+	     SECTOR_OFFSET(addr) < (fs->sector_size - 2 * fs->ate_size); addr += fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if ((ate.id == ZMS_LOOKUP_CACHE_CKPT_ID) &&
+		    zms_ate_valid_different_sector(fs, &ate, cycle_cnt)) {
+			break;
+		}
+	}
+
+	if (SECTOR_OFFSET(addr) >= (fs->sector_size - 2 * fs->ate_size)) {
+		return -ENOENT;
+	}
+
+	/* Only a checkpoint written right after the garbage collection is up to
+	 * date, an older one might have been moved by it.
+	 */
+	ckpt_addr = addr;
+	rc = zms_flash_ate_rd(fs, ckpt_addr + fs->ate_size, &prev_ate);
+	if (rc) {
+		return rc;
+	}
+
+	if (!zms_gc_done_ate_valid(fs, &prev_ate) || (prev_ate.cycle_cnt != cycle_cnt) ||
+	    (ate.len != sizeof(fs->lookup_cache))) {
+		return -ENOENT;
+	}
+
+	data_addr = (ckpt_addr & ADDR_SECT_MASK) + ate.offset;
+	rc = zms_flash_rd(fs, data_addr, fs->lookup_cache, ate.len);
+	if (rc) {
+		return rc;
+	}
+
+	if ((fs->lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE] != ZMS_LOOKUP_CACHE_CKPT_TAG) ||
+	    (IS_ENABLED(CONFIG_ZMS_DATA_CRC) &&
+	     (crc32_ieee((const uint8_t *)fs->lookup_cache, ate.len) != ate.data_crc))) {
+		return -ENOENT;
+	}
+
+	/* Replay the checkpoint ATE and the newer ones, from the oldest to the newest */
+	for (addr = ckpt_addr; addr > fs->ate_wra; addr -= fs->ate_size) {
+		rc = zms_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if ((ate.id == ZMS_HEAD_ID) || !zms_ate_valid_different_sector(fs, &ate, cycle_cnt)) {
+			continue;
+		}
+
+		cache_entry = &fs->lookup_cache[zms_lookup_cache_pos(ate.id)];
+		*cache_entry = addr;
+	}
+
+	LOG_DBG("Lookup cache loaded from %llx", ckpt_addr);
+
+	return 0;
+}
+#endif /* CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT */
+
 static inline int zms_verify_and_increment_cycle_cnt(struct zms_fs *fs, uint64_t addr,
 						     uint8_t *cycle_cnt)
 {
@@ -1093,9 +1208,62 @@ gc_done:
 #endif
 	rc = zms_add_empty_ate(fs, sec_addr);
 
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT
+	/* The lookup cache is only valid once the file system is mounted */
+	if (!rc && fs->ready) {
+		rc = zms_lookup_cache_save(fs);
+	}
+#endif
+
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+/* Returns true when the free space left in the active sector is below the
+ * background garbage collection threshold.
+ */
+static inline bool zms_gc_needed(struct zms_fs *fs)
+{
+	return (fs->ate_wra - fs->data_wra) < CONFIG_ZMS_BACKGROUND_GC_THRESHOLD;
+}
+
+static void zms_gc_work_handler(struct k_work *work)
+{
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+	int rc = 0;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	/* A write might have already switched to the next sector */
+	if (fs->ready && zms_gc_needed(fs)) {
+		rc = zms_sector_close(fs);
+		if (rc == 0) {
+			rc = zms_gc(fs);
+		}
+	}
+
+	k_mutex_unlock(&fs->zms_lock);
+
+	if (rc) {
+		LOG_ERR("Background garbage collection failed, returned = %d", rc);
+	}
+}
+
+static int zms_gc_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "zms_gc",
+	};
+
+	k_work_queue_start(&zms_gc_workq, zms_gc_stack, K_KERNEL_STACK_SIZEOF(zms_gc_stack),
+			   CONFIG_ZMS_BACKGROUND_GC_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(zms_gc_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_ZMS_BACKGROUND_GC */
+
 int zms_clear(struct zms_fs *fs)
 {
 	int rc;
@@ -1106,6 +1274,12 @@ int zms_clear(struct zms_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	struct k_work_sync sync;
+
+	k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
 	for (uint32_t i = 0; i < fs->sector_count; i++) {
 		addr = (uint64_t)i << ADDR_SECT_SHIFT;
@@ -1373,7 +1547,14 @@ static int zms_init(struct zms_fs *fs)
 	}
 
 end:
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT
+	if (!rc) {
+		rc = zms_lookup_cache_load(fs);
+		if (rc == -ENOENT) {
+			rc = zms_lookup_cache_rebuild(fs);
+		}
+	}
+#elif defined(CONFIG_ZMS_LOOKUP_CACHE)
 	if (!rc) {
 		rc = zms_lookup_cache_rebuild(fs);
 	}
@@ -1396,6 +1577,9 @@ int zms_mount(struct zms_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->zms_lock);
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	k_work_init(&fs->gc_work, zms_gc_work_handler);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1482,6 +1666,13 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT
+	/* This ID is reserved for the lookup cache checkpoint */
+	if (id == ZMS_LOOKUP_CACHE_CKPT_ID) {
+		return -EINVAL;
+	}
+#endif
+
 #ifdef CONFIG_ZMS_NO_DOUBLE_WRITE
 	/* find latest entry with same id */
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
@@ -1574,10 +1765,22 @@ no_cached_entry:
 		if ((SECTOR_OFFSET(fs->ate_wra)) &&
 		    (fs->ate_wra >= (fs->data_wra + required_space)) &&
 		    (SECTOR_OFFSET(fs->ate_wra - fs->ate_size) || !len)) {
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+			bool gc_needed = zms_gc_needed(fs);
+#endif
 			rc = zms_flash_write_entry(fs, id, data, len);
 			if (rc) {
 				goto end;
 			}
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+			/* Only schedule the garbage collection when this write crosses the
+			 * threshold, so that a sector which is still short of space after
+			 * the garbage collection does not trigger it again.
+			 */
+			if (!gc_needed && zms_gc_needed(fs)) {
+				k_work_submit_to_queue(&zms_gc_workq, &fs->gc_work);
+			}
+#endif
 			break;
 		}
 		rc = zms_sector_close(fs);
@@ -38,6 +38,11 @@
 #define ZMS_GET_MAGIC_NUMBER(x) FIELD_GET(ZMS_MAGIC_NUMBER_MASK, x)
 #define ZMS_MIN_ATE_NUM         5
 
+#define ZMS_LOOKUP_CACHE_CKPT_ID GENMASK(31, 1)
+#define ZMS_LOOKUP_CACHE_CKPT_TAG                                                                  \
+	(((uint64_t)CONFIG_ZMS_LOOKUP_CACHE_SIZE << 32) |                                          \
+	 ((uint64_t)IS_ENABLED(CONFIG_ZMS_LOOKUP_CACHE_FOR_SETTINGS) << 16) | ZMS_MAGIC_NUMBER)
+
 #define ZMS_INVALID_SECTOR_NUM -1
 #define ZMS_DATA_IN_ATE_SIZE   8
 
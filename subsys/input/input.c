@@ -18,6 +18,94 @@ K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 
 #endif
 
+#ifdef CONFIG_INPUT_BATCH_CALLBACK
+
+static bool input_batch_coalesce(const struct input_batch_callback *callback,
+				 struct input_event *evt)
+{
+	struct input_batch_callback_state *state = callback->state;
+
+	if (evt->type != INPUT_EV_ABS && evt->type != INPUT_EV_REL) {
+		return false;
+	}
+
+	if (evt->type == INPUT_EV_ABS && evt->code == INPUT_ABS_MT_SLOT) {
+		return false;
+	}
+
+	for (uint16_t i = state->count; i > state->frame; i--) {
+		struct input_event *prev = &callback->events[i - 1];
+
+		if (prev->type == INPUT_EV_ABS && prev->code == INPUT_ABS_MT_SLOT) {
+			break;
+		}
+
+		if (prev->dev != evt->dev || prev->type != evt->type ||
+		    prev->code != evt->code) {
+			continue;
+		}
+
+		/* Keep the synchronization bit on the last event of the frame */
+		if (evt->sync && i != state->count) {
+			return false;
+		}
+
+		if (evt->type == INPUT_EV_REL) {
+			prev->value += evt->value;
+		} else {
+			prev->value = evt->value;
+		}
+		prev->sync = evt->sync;
+
+		return true;
+	}
+
+	return false;
+}
+
+static void input_batch_flush(const struct input_batch_callback *callback)
+{
+	struct input_batch_callback_state *state = callback->state;
+
+	if (state->count == 0) {
+		return;
+	}
+
+	callback->callback(callback->events, state->count, callback->user_data);
+
+	state->count = 0;
+	state->frame = 0;
+}
+
+static void input_batch_process(struct input_event *evt)
+{
+	STRUCT_SECTION_FOREACH(input_batch_callback, callback) {
+		struct input_batch_callback_state *state = callback->state;
+
+		if (callback->dev != NULL && callback->dev != evt->dev) {
+			continue;
+		}
+
+		if (!input_batch_coalesce(callback, evt)) {
+			if (state->count == callback->size) {
+				input_batch_flush(callback);
+			}
+
+			callback->events[state->count++] = *evt;
+		}
+
+		if (evt->sync) {
+			state->frame = state->count;
+
+			if (input_queue_empty()) {
+				input_batch_flush(callback);
+			}
+		}
+	}
+}
+
+#endif /* CONFIG_INPUT_BATCH_CALLBACK */
+
 static void input_process(struct input_event *evt)
 {
 	STRUCT_SECTION_FOREACH(input_callback, callback) {
@@ -25,6 +113,10 @@ static void input_process(struct input_event *evt)
 			callback->callback(evt, callback->user_data);
 		}
 	}
+
+#ifdef CONFIG_INPUT_BATCH_CALLBACK
+	input_batch_process(evt);
+#endif
 }
 
 bool input_queue_empty(void)
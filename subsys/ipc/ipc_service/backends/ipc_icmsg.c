@@ -43,10 +43,97 @@ static int send(const struct device *instance, void *token,
 	return icmsg_send(conf, dev_data, msg, len);
 }
 
+static int poll_rx(const struct device *instance, void *token)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_poll(conf, dev_data);
+}
+
+static int get_tx_buffer_size(const struct device *instance, void *token)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_get_tx_buffer_size(conf, dev_data);
+}
+
+static int get_tx_buffer(const struct device *instance, void *token,
+			 void **data, uint32_t *len, k_timeout_t wait)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+	k_timepoint_t end = sys_timepoint_calc(wait);
+	size_t size;
+	int ret;
+
+	do {
+		size = *len;
+		ret = icmsg_get_tx_buffer(conf, dev_data, data, &size);
+		if (ret != -ENOBUFS || !IS_ENABLED(CONFIG_MULTITHREADING) || k_is_in_isr() ||
+		    sys_timepoint_expired(end)) {
+			break;
+		}
+
+		/* Space is freed as the remote reads, without notification. */
+		k_sleep(K_TICKS(1));
+	} while (true);
+
+	if (ret == 0 || ret == -ENOMEM) {
+		*len = size;
+	}
+
+	return ret;
+}
+
+static int drop_tx_buffer(const struct device *instance, void *token,
+			  const void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_drop_tx_buffer(conf, dev_data, data);
+}
+
+static int send_nocopy(const struct device *instance, void *token,
+		       const void *data, size_t len)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_send_nocopy(conf, dev_data, data, len);
+}
+
+static int hold_rx_buffer(const struct device *instance, void *token,
+			  void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_hold_rx_buffer(conf, dev_data, data);
+}
+
+static int release_rx_buffer(const struct device *instance, void *token,
+			     void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_release_rx_buffer(conf, dev_data, data);
+}
+
 const static struct ipc_service_backend backend_ops = {
 	.register_endpoint = register_ept,
 	.deregister_endpoint = deregister_ept,
 	.send = send,
+	.get_tx_buffer_size = get_tx_buffer_size,
+	.get_tx_buffer = get_tx_buffer,
+	.drop_tx_buffer = drop_tx_buffer,
+	.send_nocopy = send_nocopy,
+	.hold_rx_buffer = hold_rx_buffer,
+	.release_rx_buffer = release_rx_buffer,
+	.poll = poll_rx,
 };
 
 static int backend_init(const struct device *instance)
@@ -61,6 +148,7 @@ static int backend_init(const struct device *instance)
 		.mbox_tx = MBOX_DT_SPEC_INST_GET(i, tx),			\
 		.mbox_rx = MBOX_DT_SPEC_INST_GET(i, rx),			\
 		.unbound_mode = UNBOUND_MODE(i),				\
+		.rx_poll = DT_INST_PROP(i, rx_poll),				\
 	};									\
 										\
 	PBUF_DEFINE(tx_pb_##i,							\
@@ -318,3 +318,27 @@ int ipc_service_release_rx_buffer(struct ipc_ept *ept, void *data)
 
 	return backend->release_rx_buffer(ept->instance, ept->token, data);
 }
+
+int ipc_service_poll(struct ipc_ept *ept)
+{
+	const struct ipc_service_backend *backend;
+
+	if (!ept) {
+		LOG_ERR("Invalid endpoint");
+		return -EINVAL;
+	}
+
+	if (!ept->instance) {
+		LOG_ERR("Endpoint not registered\n");
+		return -ENOENT;
+	}
+
+	backend = ept->instance->api;
+
+	if (!backend || !backend->poll) {
+		LOG_ERR("Invalid backend configuration");
+		return -EIO;
+	}
+
+	return backend->poll(ept->instance, ept->token);
+}
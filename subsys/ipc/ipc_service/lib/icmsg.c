@@ -65,6 +65,10 @@ static int mbox_deinit(const struct icmsg_config_t *conf,
 {
 	int err;
 
+	if (conf->rx_poll) {
+		return 0;
+	}
+
 	err = mbox_set_enabled_dt(&conf->mbox_rx, 0);
 	if (err != 0) {
 		return err;
@@ -123,6 +127,38 @@ static void submit_mbox_work(struct icmsg_data_t *dev_data)
 
 #endif
 
+/* Decide under the TX lock, right after writing a message of len bytes, whether
+ * the remote must be notified.
+ */
+static bool tx_notify_needed(struct icmsg_data_t *dev_data, size_t len)
+{
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE
+	int pending = pbuf_tx_pending(dev_data->tx_pb);
+	uint32_t now = k_cycle_get_32();
+
+	/* The remote checks for more data after each message, it only needs to be
+	 * woken up when it had consumed everything before this message.
+	 */
+	if (pending < 0 || pending <= PBUF_PACKET_LEN_SZ + ROUND_UP(len, _PBUF_IDX_SIZE) ||
+	    (CONFIG_IPC_SERVICE_ICMSG_NOTIFY_MAX_MSGS > 0 &&
+	     ++dev_data->tx_unsignalled >= CONFIG_IPC_SERVICE_ICMSG_NOTIFY_MAX_MSGS) ||
+	    (CONFIG_IPC_SERVICE_ICMSG_NOTIFY_MAX_US > 0 &&
+	     k_cyc_to_us_floor32(now - dev_data->tx_signal_cycles) >=
+		     CONFIG_IPC_SERVICE_ICMSG_NOTIFY_MAX_US)) {
+		dev_data->tx_unsignalled = 0;
+		dev_data->tx_signal_cycles = now;
+		return true;
+	}
+
+	return false;
+#else
+	ARG_UNUSED(dev_data);
+	ARG_UNUSED(len);
+
+	return true;
+#endif
+}
+
 static int initialize_tx_with_sid_disabled(struct icmsg_data_t *dev_data)
 {
 	int ret;
@@ -149,10 +185,57 @@ static int initialize_tx_with_sid_disabled(struct icmsg_data_t *dev_data)
 	return 0;
 }
 
+/* Read the next message in place if possible, into rx_buffer otherwise. */
+static uint32_t rx_read(struct icmsg_data_t *dev_data, uint8_t *rx_buffer, size_t size,
+			uint32_t len_available, const uint8_t **rx_data)
+{
+	int ret;
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	volatile char *buf;
+
+	/* A message wrapping around the end of the RX region is copied. */
+	ret = pbuf_read_nocopy(dev_data->rx_pb, &buf);
+	if (ret > 0) {
+		*rx_data = (const uint8_t *)buf;
+		dev_data->rx_buf = *rx_data;
+		return ret;
+	}
+#endif
+
+	*rx_data = rx_buffer;
+	if (len_available > size) {
+		return 0;
+	}
+
+	ret = pbuf_read(dev_data->rx_pb, (char *)rx_buffer, size);
+
+	return (ret > 0) ? ret : 0;
+}
+
+/* Consume a message read in place, unless it is held by the endpoint. */
+static bool rx_done(struct icmsg_data_t *dev_data, const uint8_t *rx_data,
+		    const uint8_t *rx_buffer)
+{
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	if (rx_data != rx_buffer) {
+		if (dev_data->rx_buf == NULL) {
+			/* Held, consumed when released. */
+			return false;
+		}
+		dev_data->rx_buf = NULL;
+		(void)pbuf_read_done(dev_data->rx_pb);
+	}
+#endif
+
+	return true;
+}
+
 static bool callback_process(struct icmsg_data_t *dev_data)
 {
 	int ret;
 	uint8_t rx_buffer[CONFIG_PBUF_RX_READ_BUF_SIZE] __aligned(4);
+	const uint8_t *rx_data = rx_buffer;
 	uint32_t len = 0;
 	uint32_t len_available;
 	bool rerun = false;
@@ -256,10 +339,18 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 	case ICMSG_STATE_INITIALIZING_SID_DISABLED:
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+		if (atomic_ptr_get(&dev_data->rx_held) != NULL) {
+			/* Resumed when the held message is released. */
+			return false;
+		}
+#endif
+
 		len_available = data_available(dev_data);
 
-		if (len_available > 0 && sizeof(rx_buffer) >= len_available) {
-			len = pbuf_read(dev_data->rx_pb, rx_buffer, sizeof(rx_buffer));
+		if (len_available > 0) {
+			len = rx_read(dev_data, rx_buffer, sizeof(rx_buffer), len_available,
+				      &rx_data);
 		}
 
 		if (state == ICMSG_STATE_CONNECTED_SID_ENABLED &&
@@ -271,6 +362,9 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 				pbuf_handshake_read(dev_data->tx_pb));
 
 			if (remote_sid_req != dev_data->remote_sid) {
+				if (len > 0) {
+					(void)rx_done(dev_data, rx_data, rx_buffer);
+				}
 				atomic_set(&dev_data->state, ICMSG_STATE_DISCONNECTED);
 				if (dev_data->cb->unbound) {
 					dev_data->cb->unbound(dev_data->ctx);
@@ -284,22 +378,30 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 			return false;
 		}
 
-		__ASSERT_NO_MSG(len_available <= sizeof(rx_buffer));
+		/* Messages not read in place must fit in rx_buffer. */
+		__ASSERT_NO_MSG(len > 0);
 
-		if (sizeof(rx_buffer) < len_available) {
+		if (len == 0) {
 			return false;
 		}
 
 		if (state != ICMSG_STATE_INITIALIZING_SID_DISABLED || !UNBOUND_DISABLED) {
 			if (dev_data->cb->received) {
-				dev_data->cb->received(rx_buffer, len, dev_data->ctx);
+				dev_data->cb->received(rx_data, len, dev_data->ctx);
+			}
+
+			if (!rx_done(dev_data, rx_data, rx_buffer)) {
+				/* No further message until the held one is released. */
+				return false;
 			}
 		} else {
 			/* Allow magic number longer than sizeof(magic) for future protocol
 			 * version.
 			 */
 			bool endpoint_invalid = (len < sizeof(magic) ||
-						memcmp(magic, rx_buffer, sizeof(magic)));
+						memcmp(magic, rx_data, sizeof(magic)));
+
+			(void)rx_done(dev_data, rx_data, rx_buffer);
 
 			if (endpoint_invalid) {
 				__ASSERT_NO_MSG(false);
@@ -360,6 +462,24 @@ static void mbox_callback(const struct device *instance, uint32_t channel,
 #endif
 }
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+/* Process the data received while a held RX buffer blocked delivery. */
+static void rx_resume(struct icmsg_data_t *dev_data)
+{
+	if (dev_data->cfg->rx_poll) {
+		/* Picked up by the next poll. */
+		return;
+	}
+
+#ifdef CONFIG_MULTITHREADING
+	submit_mbox_work(dev_data);
+#else
+	while (callback_process(dev_data)) {
+	}
+#endif
+}
+#endif
+
 static int mbox_init(const struct icmsg_config_t *conf,
 		     struct icmsg_data_t *dev_data)
 {
@@ -369,6 +489,10 @@ static int mbox_init(const struct icmsg_config_t *conf,
 	k_work_init(&dev_data->mbox_work, workq_callback_process);
 #endif
 
+	if (conf->rx_poll) {
+		return 0;
+	}
+
 	err = mbox_register_callback_dt(&conf->mbox_rx, mbox_callback, dev_data);
 	if (err != 0) {
 		return err;
@@ -498,6 +622,7 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	int write_ret;
 	int release_ret;
 	int sent_bytes;
+	bool notify;
 	uint32_t state = atomic_get(&dev_data->state);
 
 	if (!is_endpoint_ready(state)) {
@@ -517,7 +642,15 @@ int icmsg_send(const struct icmsg_config_t *conf,
 		return -ENOBUFS;
 	}
 
+	if (dev_data->tx_buf != NULL) {
+		/* A nocopy TX buffer is claimed by this thread. */
+		release_ret = release_tx_buffer(dev_data);
+		__ASSERT_NO_MSG(!release_ret);
+		return -ENOBUFS;
+	}
+
 	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
+	notify = (write_ret > 0) && tx_notify_needed(dev_data, write_ret);
 
 	release_ret = release_tx_buffer(dev_data);
 	__ASSERT_NO_MSG(!release_ret);
@@ -529,6 +662,10 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	}
 	sent_bytes = write_ret;
 
+	if (!notify) {
+		return sent_bytes;
+	}
+
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
 	ret = mbox_send_dt(&conf->mbox_tx, NULL);
@@ -539,6 +676,186 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	return sent_bytes;
 }
 
+int icmsg_poll(const struct icmsg_config_t *conf,
+	       struct icmsg_data_t *dev_data)
+{
+	if (!conf->rx_poll) {
+		return -ENOTSUP;
+	}
+
+	while (callback_process(dev_data)) {
+	}
+
+	return 0;
+}
+
+int icmsg_get_tx_buffer_size(const struct icmsg_config_t *conf,
+			     struct icmsg_data_t *dev_data)
+{
+	ARG_UNUSED(conf);
+
+	return MIN(dev_data->tx_pb->cfg->len - _PBUF_IDX_SIZE - PBUF_PACKET_LEN_SZ, UINT16_MAX);
+}
+
+int icmsg_get_tx_buffer(const struct icmsg_config_t *conf,
+			struct icmsg_data_t *dev_data,
+			void **data, size_t *size)
+{
+	int ret;
+	int max_size = icmsg_get_tx_buffer_size(conf, dev_data);
+	uint16_t len;
+	char *buf;
+
+	if (!is_endpoint_ready(atomic_get(&dev_data->state))) {
+		return -EBUSY;
+	}
+
+	if (*size == 0) {
+		return -EINVAL;
+	}
+
+	if (*size > max_size) {
+		*size = max_size;
+		return -ENOMEM;
+	}
+
+	ret = reserve_tx_buffer_if_unused(dev_data);
+	if (ret < 0) {
+		return -ENOBUFS;
+	}
+
+	if (dev_data->tx_buf != NULL) {
+		/* Claimed by this thread, the lock is recursive. */
+		(void)release_tx_buffer(dev_data);
+		return -EALREADY;
+	}
+
+	len = *size;
+	ret = pbuf_tx_reserve(dev_data->tx_pb, &len, &buf);
+	if (ret < 0) {
+		(void)release_tx_buffer(dev_data);
+		if (ret == -ENOBUFS) {
+			*size = len;
+		}
+		return ret;
+	}
+
+	/* The TX lock is kept until the buffer is sent or dropped. */
+	dev_data->tx_buf = buf;
+	*data = buf;
+
+	return 0;
+}
+
+int icmsg_drop_tx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data)
+{
+	int release_ret;
+
+	ARG_UNUSED(conf);
+
+	if (data == NULL || dev_data->tx_buf != data) {
+		return -EALREADY;
+	}
+
+	dev_data->tx_buf = NULL;
+
+	release_ret = release_tx_buffer(dev_data);
+	__ASSERT_NO_MSG(!release_ret);
+
+	return 0;
+}
+
+int icmsg_send_nocopy(const struct icmsg_config_t *conf,
+		      struct icmsg_data_t *dev_data,
+		      const void *data, size_t len)
+{
+	int ret;
+	int write_ret;
+	int release_ret;
+	bool notify;
+
+	if (data == NULL || dev_data->tx_buf != data) {
+		return -EALREADY;
+	}
+
+	dev_data->tx_buf = NULL;
+
+	/* Empty message is not allowed */
+	write_ret = (len == 0) ? -ENODATA : pbuf_tx_commit(dev_data->tx_pb, (char *)data, len);
+	notify = (write_ret > 0) && tx_notify_needed(dev_data, write_ret);
+
+	release_ret = release_tx_buffer(dev_data);
+	__ASSERT_NO_MSG(!release_ret);
+
+	if (write_ret < 0) {
+		return write_ret;
+	}
+
+	if (!notify) {
+		return write_ret;
+	}
+
+	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
+
+	ret = mbox_send_dt(&conf->mbox_tx, NULL);
+	if (ret) {
+		return ret;
+	}
+
+	return write_ret;
+}
+
+int icmsg_hold_rx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data)
+{
+	ARG_UNUSED(conf);
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	if (data == NULL || data != dev_data->rx_buf) {
+		return (atomic_ptr_get(&dev_data->rx_held) == data) ? -EALREADY : -ENOTSUP;
+	}
+
+	dev_data->rx_buf = NULL;
+	atomic_ptr_set(&dev_data->rx_held, (void *)data);
+
+	return 0;
+#else
+	ARG_UNUSED(dev_data);
+	ARG_UNUSED(data);
+
+	return -ENOTSUP;
+#endif
+}
+
+int icmsg_release_rx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_data_t *dev_data,
+			    const void *data)
+{
+	ARG_UNUSED(conf);
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
+	if (data == NULL || atomic_ptr_get(&dev_data->rx_held) != data) {
+		return -EALREADY;
+	}
+
+	(void)pbuf_read_done(dev_data->rx_pb);
+	atomic_ptr_clear(&dev_data->rx_held);
+
+	/* Deliver the messages received meanwhile. */
+	rx_resume(dev_data);
+
+	return 0;
+#else
+	ARG_UNUSED(dev_data);
+	ARG_UNUSED(data);
+
+	return -EALREADY;
+#endif
+}
+
 #if defined(CONFIG_IPC_SERVICE_BACKEND_ICMSG_WQ_ENABLE)
 
 static int work_q_init(void)
@@ -179,6 +179,123 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	return len;
 }
 
+/* Space the writer can use, given the reader index received from the reader */
+static int tx_free_space(struct pbuf *pb, uint32_t *rd_idx)
+{
+	const uint32_t blen = pb->cfg->len;
+
+	/* Invalidate rd_idx only, local wr_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	*rd_idx = *(pb->cfg->rd_idx_loc);
+	if (!IS_PTR_ALIGNED_BYTES(*rd_idx, _PBUF_IDX_SIZE) || *rd_idx >= blen) {
+		return -EINVAL;
+	}
+
+	return blen - idx_occupied(blen, pb->data.wr_idx, *rd_idx) - _PBUF_IDX_SIZE;
+}
+
+int pbuf_tx_reserve(struct pbuf *pb, uint16_t *len, char **buf)
+{
+	if (pb == NULL || len == NULL || *len == 0 || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = pb->data.wr_idx;
+	uint32_t data_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
+	uint32_t rd_idx;
+	uint32_t avail;
+	int free_space;
+
+	if (*len > blen - _PBUF_IDX_SIZE - PBUF_PACKET_LEN_SZ) {
+		return -ENOMEM;
+	}
+
+	free_space = tx_free_space(pb, &rd_idx);
+	if (free_space < 0) {
+		return free_space;
+	}
+
+	avail = (free_space > PBUF_PACKET_LEN_SZ) ? (free_space - PBUF_PACKET_LEN_SZ) : 0;
+
+	/* A wrapping packet is written at the beginning of the buffer first, where it
+	 * must not overlap unread data.
+	 */
+	if (data_idx + avail > blen) {
+		avail = MIN(avail, MAX(blen - data_idx, rd_idx));
+	}
+
+	if (*len > avail) {
+		*len = avail;
+		return -ENOBUFS;
+	}
+
+	*buf = (data_idx + *len > blen) ? (char *)&pb->cfg->data_loc[0] :
+					  (char *)&pb->cfg->data_loc[data_idx];
+
+	return 0;
+}
+
+int pbuf_tx_commit(struct pbuf *pb, char *buf, uint16_t len)
+{
+	if (pb == NULL || len == 0 || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = pb->data.wr_idx;
+	uint32_t data_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
+	uint32_t tail = MIN(len, blen - data_idx);
+
+	if ((uint8_t *)buf != &data_loc[data_idx]) {
+		if ((uint8_t *)buf != &data_loc[0]) {
+			return -EINVAL;
+		}
+
+		/* Reserved at the beginning as the packet wraps, move its head to the end. */
+		memcpy(&data_loc[data_idx], buf, tail);
+		memmove(&data_loc[0], buf + tail, len - tail);
+	}
+
+	*((uint32_t *)(&data_loc[wr_idx])) = 0;
+	sys_put_be16(len, &data_loc[wr_idx]);
+	__sync_synchronize();
+	sys_cache_data_flush_range(&data_loc[wr_idx], PBUF_PACKET_LEN_SZ);
+
+	sys_cache_data_flush_range(&data_loc[data_idx], tail);
+	if (len > tail) {
+		sys_cache_data_flush_range(&data_loc[0], len - tail);
+	}
+
+	wr_idx = idx_wrap(blen, ROUND_UP(data_idx + len, _PBUF_IDX_SIZE));
+	/* Update wr_idx. */
+	pb->data.wr_idx = wr_idx;
+	*(pb->cfg->wr_idx_loc) = wr_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->wr_idx_loc, sizeof(*(pb->cfg->wr_idx_loc)));
+
+	return len;
+}
+
+int pbuf_tx_pending(struct pbuf *pb)
+{
+	uint32_t rd_idx;
+	int ret;
+
+	/* Only the freshly read rd_idx is of interest. */
+	ret = tx_free_space(pb, &rd_idx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return idx_occupied(pb->cfg->len, pb->data.wr_idx, rd_idx);
+}
+
 int pbuf_get_initial_buf(struct pbuf *pb, volatile char **buf, uint16_t *len)
 {
 	uint32_t wr_idx;
@@ -295,6 +412,80 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 	return len;
 }
 
+int pbuf_read_nocopy(struct pbuf *pb, volatile char **buf)
+{
+	if (pb == NULL || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	/* Invalidate wr_idx only, local rd_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->wr_idx_loc), sizeof(*(pb->cfg->wr_idx_loc)));
+	__sync_synchronize();
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = *(pb->cfg->wr_idx_loc);
+	uint32_t rd_idx = pb->data.rd_idx;
+
+	if (!IS_PTR_ALIGNED_BYTES(wr_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	if (rd_idx == wr_idx) {
+		/* Buffer is empty. */
+		return 0;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], PBUF_PACKET_LEN_SZ);
+	uint16_t plen = sys_get_be16(&data_loc[rd_idx]);
+
+	if (idx_occupied(blen, wr_idx, rd_idx) < plen + PBUF_PACKET_LEN_SZ) {
+		return -EAGAIN;
+	}
+
+	rd_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
+	if (rd_idx + plen > blen) {
+		return -EFBIG;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], plen);
+	*buf = (volatile char *)&data_loc[rd_idx];
+
+	return plen;
+}
+
+int pbuf_read_done(struct pbuf *pb)
+{
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = pb->data.rd_idx;
+	uint16_t plen;
+
+	/* The packet header was validated by pbuf_read_nocopy() and is not modified by the writer
+	 * until rd_idx is updated.
+	 */
+	if (rd_idx == *(pb->cfg->wr_idx_loc)) {
+		return -EINVAL;
+	}
+	plen = sys_get_be16(&data_loc[rd_idx]);
+
+	rd_idx = idx_wrap(blen, ROUND_UP(idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ) + plen,
+					 _PBUF_IDX_SIZE));
+
+	pb->data.rd_idx = rd_idx;
+	*(pb->cfg->rd_idx_loc) = rd_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
+
+	return 0;
+}
+
 uint32_t pbuf_handshake_read(struct pbuf *pb)
 {
 	volatile uint32_t *ptr = pb->cfg->handshake_loc;
@@ -11,6 +11,7 @@
 #include <zephyr/llext/llext.h>
 #include <zephyr/kernel.h>
 #include <zephyr/cache.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(llext, CONFIG_LLEXT_LOG_LEVEL);
@@ -127,37 +128,141 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
-const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+#ifdef CONFIG_LLEXT_SYMBOL_CACHE
+/*
+ * Direct-mapped cache of built-in symbol lookups. The built-in table never
+ * changes, so entries stay valid forever; they are only hints that are
+ * checked on use, which makes racing updates harmless.
+ */
+static const struct llext_const_symbol *llext_sym_cache[CONFIG_LLEXT_SYMBOL_CACHE_SIZE];
+
+static size_t llext_sym_cache_slot(const char *sym_name)
 {
-	if (sym_table == NULL) {
-		/* Built-in symbol table */
 #ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
-		/* 'sym_name' is actually a SLID to search for */
-		uintptr_t slid = (uintptr_t)sym_name;
-
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
-		 */
+	/* SLIDs already are hashes */
+	return (uintptr_t)sym_name % CONFIG_LLEXT_SYMBOL_CACHE_SIZE;
+#else
+	return sys_hash32(sym_name, strlen(sym_name)) % CONFIG_LLEXT_SYMBOL_CACHE_SIZE;
+#endif
+}
+#endif
+
+static int llext_builtin_sym_cmp(const struct llext_const_symbol *sym, const char *sym_name)
+{
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+	/* 'sym_name' is actually a SLID to search for */
+	uintptr_t slid = (uintptr_t)sym_name;
+
+	return (sym->slid < slid) ? -1 : (sym->slid > slid);
+#else
+	return strcmp(sym->name, sym_name);
+#endif
+}
+
+/*
+ * Whether the built-in table can be searched with a binary search. With SLIDs
+ * it is always sorted by scripts/build/llext_prepare_exptab.py; names are
+ * sorted by the same script with CONFIG_LLEXT_EXPORT_BUILTINS_SORTED, which
+ * is verified once in case the image was not post-processed.
+ */
+static bool llext_builtin_sorted(void)
+{
+#if defined(CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID)
+	return true;
+#elif defined(CONFIG_LLEXT_EXPORT_BUILTINS_SORTED)
+	static int sorted = -1;
+	const struct llext_const_symbol *prev = NULL;
+
+	if (sorted < 0) {
+		sorted = 1;
 		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (slid == sym->slid) {
-				return sym->addr;
+			if (prev != NULL && strcmp(prev->name, sym->name) > 0) {
+				LOG_WRN("Built-in symbol table not sorted");
+				sorted = 0;
+				break;
 			}
+			prev = sym;
 		}
+	}
+
+	return sorted == 1;
 #else
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (strcmp(sym->name, sym_name) == 0) {
-				return sym->addr;
+	return false;
+#endif
+}
+
+static const struct llext_const_symbol *llext_search_builtin_sym(const char *sym_name)
+{
+	const struct llext_const_symbol *sym;
+	size_t lo = 0;
+	size_t hi;
+
+	if (!llext_builtin_sorted()) {
+		STRUCT_SECTION_FOREACH(llext_const_symbol, entry) {
+			if (llext_builtin_sym_cmp(entry, sym_name) == 0) {
+				return entry;
 			}
 		}
+
+		return NULL;
+	}
+
+	STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		int cmp;
+
+		STRUCT_SECTION_GET(llext_const_symbol, mid, &sym);
+		cmp = llext_builtin_sym_cmp(sym, sym_name);
+		if (cmp == 0) {
+			return sym;
+		} else if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+
+static const void *llext_find_builtin_sym(const char *sym_name)
+{
+	const struct llext_const_symbol *sym;
+
+#ifdef CONFIG_LLEXT_SYMBOL_CACHE
+	size_t slot = llext_sym_cache_slot(sym_name);
+
+	sym = llext_sym_cache[slot];
+	if (sym != NULL && llext_builtin_sym_cmp(sym, sym_name) == 0) {
+		return sym->addr;
+	}
 #endif
-	} else {
-		/* find symbols in module */
-		for (size_t i = 0; i < sym_table->sym_cnt; i++) {
-			if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
-				return sym_table->syms[i].addr;
-			}
+
+	sym = llext_search_builtin_sym(sym_name);
+	if (sym == NULL) {
+		return NULL;
+	}
+
+#ifdef CONFIG_LLEXT_SYMBOL_CACHE
+	llext_sym_cache[slot] = sym;
+#endif
+
+	return sym->addr;
+}
+
+const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+{
+	if (sym_table == NULL) {
+		/* Built-in symbol table */
+		return llext_find_builtin_sym(sym_name);
+	}
+
+	/* find symbols in module */
+	for (size_t i = 0; i < sym_table->sym_cnt; i++) {
+		if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
+			return sym_table->syms[i].addr;
 		}
 	}
 
@@ -163,6 +163,21 @@ int llext_read_symbol(struct llext_loader *ldr, struct llext *ext, const elf_rel
 	return ret;
 }
 
+/*
+ * Cached address of the symbol a relocation refers to, NULL without a cache.
+ */
+static uintptr_t *llext_cached_sym_addr(struct llext_loader *ldr, const elf_rela_t *rel)
+{
+	size_t idx = ELF_R_SYM(rel->r_info);
+
+	if (ldr->sym_addrs == NULL ||
+	    idx >= ldr->sects[LLEXT_MEM_SYMTAB].sh_size / sizeof(elf_sym_t)) {
+		return NULL;
+	}
+
+	return &ldr->sym_addrs[idx];
+}
+
 /*
  * Determine address of a symbol.
  */
@@ -177,6 +192,13 @@ int llext_lookup_symbol(struct llext_loader *ldr, struct llext *ext, uintptr_t *
 		 */
 		*link_addr = 0;
 	} else if (sym->st_shndx == SHN_UNDEF) {
+		uintptr_t *cached = llext_cached_sym_addr(ldr, rel);
+
+		if (cached != NULL && *cached != 0) {
+			*link_addr = *cached;
+			return 0;
+		}
+
 		/* If symbol is undefined, then we need to look it up */
 		*link_addr = (uintptr_t)llext_find_sym(NULL, SYM_NAME_OR_SLID(name, sym->st_value));
 
@@ -215,6 +237,10 @@ int llext_lookup_symbol(struct llext_loader *ldr, struct llext *ext, uintptr_t *
 			return -ENODATA;
 		}
 
+		if (cached != NULL) {
+			*cached = *link_addr;
+		}
+
 		LOG_DBG("found symbol %s at %#lx", name, *link_addr);
 	} else if (sym->st_shndx == SHN_ABS) {
 		/* Absolute symbol */
@@ -403,7 +429,8 @@ static int llext_link_plt(struct llext_loader *ldr, struct llext *ext, elf_shdr_
 	return link_err;
 }
 
-int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_load_param *ldr_parm)
+static int do_llext_link(struct llext_loader *ldr, struct llext *ext,
+			 const struct llext_load_param *ldr_parm)
 {
 	uintptr_t sect_base = 0;
 	elf_rela_t rel = {0};
@@ -583,3 +610,25 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 
 	return 0;
 }
+
+int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_load_param *ldr_parm)
+{
+	size_t sym_cnt = ldr->sects[LLEXT_MEM_SYMTAB].sh_size / sizeof(elf_sym_t);
+	int ret;
+
+	if (IS_ENABLED(CONFIG_LLEXT_RELOC_SYMBOL_CACHE) && sym_cnt > 0) {
+		ldr->sym_addrs = llext_alloc(sym_cnt * sizeof(uintptr_t));
+		if (ldr->sym_addrs) {
+			memset(ldr->sym_addrs, 0, sym_cnt * sizeof(uintptr_t));
+		} else {
+			LOG_DBG("No memory to cache symbol addresses");
+		}
+	}
+
+	ret = do_llext_link(ldr, ext, ldr_parm);
+
+	llext_free(ldr->sym_addrs);
+	ldr->sym_addrs = NULL;
+
+	return ret;
+}
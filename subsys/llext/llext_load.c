@@ -733,6 +733,14 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 	 */
 	memset(ext, 0, sizeof(*ext));
 	ldr->sect_map = NULL;
+	ldr->sym_addrs = NULL;
+
+	if (ldr_parm->xip &&
+	    (ldr->storage != LLEXT_STORAGE_PERSISTENT || ldr_parm->pre_located)) {
+		LOG_ERR("Execute in place needs persistent storage, not pre-located");
+		ret = -EINVAL;
+		goto out;
+	}
 
 	LOG_DBG("Loading ELF data...");
 	ret = llext_prepare(ldr);
@@ -819,7 +827,7 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 		goto out;
 	}
 
-	if (!ldr_parm->pre_located) {
+	if (!ldr_parm->pre_located && !ldr_parm->xip) {
 		llext_adjust_mmu_permissions(ext);
 	}
 
@@ -102,6 +102,29 @@ static int llext_copy_region(struct llext_loader *ldr, struct llext *ext,
 		}
 	}
 
+	if (ldr_parm->xip && mem_idx == LLEXT_MEM_TEXT) {
+		/*
+		 * Executing in place: the text is used from the ELF buffer as
+		 * is, so nothing in it may need relocating. Other read-only
+		 * regions are mapped in place below when they need no
+		 * relocations either, and copied otherwise.
+		 */
+		if (region->sh_flags & SHF_LLEXT_HAS_RELOCS) {
+			LOG_ERR("Region %d needs relocations, cannot execute in place", mem_idx);
+			return -ENOEXEC;
+		}
+
+		ext->mem[mem_idx] = llext_peek(ldr, region->sh_offset);
+		if (!ext->mem[mem_idx]) {
+			LOG_ERR("Region %d is not memory mapped, cannot execute in place", mem_idx);
+			return -EFAULT;
+		}
+
+		llext_init_mem_part(ext, mem_idx, (uintptr_t)ext->mem[mem_idx], region_alloc);
+		ext->mem_on_heap[mem_idx] = false;
+		return 0;
+	}
+
 	if (ldr->storage == LLEXT_STORAGE_WRITABLE ||           /* writable storage         */
 	    (ldr->storage == LLEXT_STORAGE_PERSISTENT &&        /* || persistent storage    */
 	     !(region->sh_flags & SHF_WRITE) &&                 /*    && read-only region   */
@@ -14,16 +14,29 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/sys/util_macro.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
 LOG_MODULE_REGISTER(log_uart);
 
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC) && (CONFIG_LOG_BACKEND_UART_ASYNC_RING_SIZE > 0)
+#define LBU_RING_SIZE CONFIG_LOG_BACKEND_UART_ASYNC_RING_SIZE
+#else
+#define LBU_RING_SIZE 0
+#endif
+
 struct lbu_data {
 	struct k_sem sem;
 	uint32_t log_format_current;
 	volatile bool in_panic;
 	bool use_async;
+#if LBU_RING_SIZE > 0
+	/* Transmit ring, consumed by back-to-back transfers from the UART callback. */
+	struct ring_buf ring;
+	struct k_spinlock lock;
+	bool tx_active;
+#endif
 };
 
 struct lbu_cb_ctx {
@@ -32,6 +45,9 @@ struct lbu_cb_ctx {
 	const struct device *uart_dev;
 #endif
 	struct lbu_data *data;
+#if LBU_RING_SIZE > 0
+	uint8_t *ring_buffer;
+#endif
 };
 
 #define LBU_UART_DEV(ctx)                                                                          \
@@ -43,6 +59,99 @@ struct lbu_cb_ctx {
  */
 static const char LOG_HEX_SEP[10] = "##ZLOGV1##";
 
+#if LBU_RING_SIZE > 0
+/* Start the transfer of the next contiguous chunk of the ring. Must be called
+ * with the ring lock held. Returns false if there is nothing to transmit.
+ */
+static bool ring_tx_next(const struct device *uart_dev, struct lbu_data *data)
+{
+	uint8_t *chunk;
+	uint32_t len = ring_buf_get_claim(&data->ring, &chunk, LBU_RING_SIZE);
+
+	if (len == 0) {
+		return false;
+	}
+
+	if (uart_tx(uart_dev, chunk, len, SYS_FOREVER_US) != 0) {
+		/* Drop the data rather than block the logging thread forever. */
+		ring_buf_get_finish(&data->ring, len);
+		return false;
+	}
+
+	return true;
+}
+
+static void ring_tx_done(const struct device *uart_dev, struct lbu_data *data, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	bool active = false;
+
+	if (!data->in_panic) {
+		ring_buf_get_finish(&data->ring, len);
+		active = ring_tx_next(uart_dev, data);
+		data->tx_active = active;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if (!active) {
+		(void)pm_device_runtime_put_async(uart_dev, K_MSEC(1));
+	}
+
+	/* Wake up the logging thread in case it waits for room in the ring. */
+	k_sem_give(&data->sem);
+}
+
+static void ring_out(const struct device *uart_dev, struct lbu_data *data,
+		     const uint8_t *buf, size_t length)
+{
+	while (length > 0) {
+		k_spinlock_key_t key = k_spin_lock(&data->lock);
+		uint32_t n = ring_buf_put(&data->ring, buf, length);
+		bool start = !data->tx_active;
+
+		data->tx_active = true;
+		k_spin_unlock(&data->lock, key);
+
+		buf += n;
+		length -= n;
+
+		if (start) {
+			/* Device is kept active until the ring is drained. */
+			(void)pm_device_runtime_get(uart_dev);
+
+			key = k_spin_lock(&data->lock);
+			data->tx_active = ring_tx_next(uart_dev, data);
+			start = data->tx_active;
+			k_spin_unlock(&data->lock, key);
+
+			if (!start) {
+				(void)pm_device_runtime_put_async(uart_dev, K_MSEC(1));
+			}
+		}
+
+		if (length > 0) {
+			(void)k_sem_take(&data->sem, K_FOREVER);
+		}
+	}
+}
+
+static void ring_panic(const struct device *uart_dev, struct lbu_data *data)
+{
+	uint8_t c;
+
+	(void)uart_tx_abort(uart_dev);
+
+	/* Transfer in progress may have been partially sent, output it again
+	 * together with the rest of the ring.
+	 */
+	ring_buf_get_finish(&data->ring, 0);
+	while (ring_buf_get(&data->ring, &c, 1) == 1) {
+		uart_poll_out(uart_dev, c);
+	}
+}
+#endif /* LBU_RING_SIZE > 0 */
+
 static void uart_callback(const struct device *dev,
 			  struct uart_event *evt,
 			  void *user_data)
@@ -54,7 +163,11 @@ static void uart_callback(const struct device *dev,
 
 	switch (evt->type) {
 	case UART_TX_DONE:
+#if LBU_RING_SIZE > 0
+		ring_tx_done(dev, data, evt->data.tx.len);
+#else
 		k_sem_give(&data->sem);
+#endif
 		break;
 	default:
 		break;
@@ -86,6 +199,13 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 	struct lbu_data *lb_data = cb_ctx->data;
 	const struct device *uart_dev = LBU_UART_DEV(cb_ctx);
 
+#if LBU_RING_SIZE > 0
+	if (lb_data->use_async && !lb_data->in_panic) {
+		ring_out(uart_dev, lb_data, data, length);
+		return length;
+	}
+#endif
+
 	if (pm_device_runtime_get(uart_dev) < 0) {
 		/* Enabling the UART instance has failed but this
 		 * function MUST return the number of bytes consumed.
@@ -173,6 +293,9 @@ static void log_backend_uart_init(struct log_backend const *const backend)
 		if (err == 0) {
 			data->use_async = true;
 			k_sem_init(&data->sem, 0, 1);
+#if LBU_RING_SIZE > 0
+			ring_buf_init(&data->ring, LBU_RING_SIZE, ctx->ring_buffer);
+#endif
 		} else {
 			LOG_WRN("Failed to initialize asynchronous mode (err:%d). "
 				"Fallback to polling.",
@@ -198,11 +321,16 @@ static void panic(struct log_backend const *const backend)
 	if ((rc == 0) && (pm_state == PM_DEVICE_STATE_SUSPENDED)) {
 		pm_device_action_run(uart_dev, PM_DEVICE_ACTION_RESUME);
 	}
-#else
+#elif LBU_RING_SIZE == 0
 	ARG_UNUSED(uart_dev);
 #endif /* CONFIG_PM_DEVICE */
 
 	data->in_panic = true;
+#if LBU_RING_SIZE > 0
+	if (data->use_async) {
+		ring_panic(uart_dev, data);
+	}
+#endif
 	log_backend_std_panic(ctx->output);
 }
 
@@ -232,8 +360,18 @@ const struct log_backend_api log_backend_uart_api = {
 #define NOCACHE_ATTR
 #endif
 
+#if LBU_RING_SIZE > 0
+#define LBU_RING_DEFINE(...)                                                                       \
+	static uint8_t lbu_ring_buffer##__VA_ARGS__[LBU_RING_SIZE] NOCACHE_ATTR;
+#define LBU_RING_INIT(...) .ring_buffer = lbu_ring_buffer##__VA_ARGS__,
+#else
+#define LBU_RING_DEFINE(...)
+#define LBU_RING_INIT(...)
+#endif
+
 #define LBU_DEFINE(node_id, ...)                                                                   \
 	static uint8_t lbu_buffer##__VA_ARGS__[CONFIG_LOG_BACKEND_UART_BUFFER_SIZE] NOCACHE_ATTR;  \
+	LBU_RING_DEFINE(__VA_ARGS__)                                                               \
 	LOG_OUTPUT_DEFINE(lbu_output##__VA_ARGS__, char_out, lbu_buffer##__VA_ARGS__,              \
 			  CONFIG_LOG_BACKEND_UART_BUFFER_SIZE);                                    \
                                                                                                    \
@@ -246,6 +384,7 @@ const struct log_backend_api log_backend_uart_api = {
 		COND_CODE_0(NUM_VA_ARGS_LESS_1(_, ##__VA_ARGS__), (),                              \
 				(.uart_dev = DEVICE_DT_GET(node_id),))                             \
 		.data = &lbu_data##__VA_ARGS__,                                                    \
+		LBU_RING_INIT(__VA_ARGS__)                                                         \
 	};                                                                                         \
                                                                                                    \
 	LOG_BACKEND_DEFINE(log_backend_uart##__VA_ARGS__, log_backend_uart_api,                    \
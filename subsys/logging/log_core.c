@@ -11,6 +11,7 @@
 #include <zephyr/logging/log_internal.h>
 #include <zephyr/sys/mpsc_pbuf.h>
 #include <zephyr/logging/log_link.h>
+#include <zephyr/logging/log_trace_evt.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/sys_clock.h>
 #include <zephyr/sys/clock.h>
@@ -140,6 +141,18 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 		 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?
 		  MPSC_PBUF_MAX_UTILIZATION : 0)
 };
+
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* CPU 0 uses log_buffer, other CPUs use dedicated buffers. */
+#define LOG_CPU_BUFFERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	cpu_buf32[LOG_CPU_BUFFERS][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+static struct mpsc_pbuf_buffer cpu_log_buffer[LOG_CPU_BUFFERS];
+
+/* Oldest message claimed from each buffer, CPU 0 at index 0. */
+static union log_msg_generic *cpu_log_msg[LOG_CPU_BUFFERS + 1];
+#endif
 #endif
 
 /* Check that default tag can fit in tag buffer. */
@@ -200,6 +213,29 @@ static void z_log_msg_post_finalize(void)
 	}
 }
 
+#ifdef CONFIG_LOG_TRACE_EVT
+void z_log_trace_evt_notify(void)
+{
+	if (panic_mode) {
+		k_spinlock_key_t key = k_spin_lock(&process_lock);
+		(void)log_process();
+
+		k_spin_unlock(&process_lock, key);
+	} else if (proc_tid != NULL) {
+		/* Trace events are processed together, so only the first
+		 * event in an empty ring triggers the processing.
+		 */
+		if (CONFIG_LOG_PROCESS_TRIGGER_THRESHOLD == 1) {
+			k_sem_give(&log_process_thread_sem);
+		} else {
+			k_timer_start(&log_process_thread_timer,
+				      K_MSEC(CONFIG_LOG_PROCESS_THREAD_SLEEP_MS),
+				      K_NO_WAIT);
+		}
+	}
+}
+#endif
+
 const struct log_backend *log_format_set_all_active_backends(size_t log_type)
 {
 	const struct log_backend *failed_backend = NULL;
@@ -547,6 +583,58 @@ void z_log_notify_backend_enabled(void)
 	backend_attached = true;
 }
 
+#ifdef CONFIG_LOG_TRACE_EVT
+/* Convert a binary trace event into a log message and pass it to backends. */
+static void trace_evt_msg_process(const struct log_trace_evt *evt)
+{
+	uint32_t buf[Z_LOG_MSG_ALIGNED_WLEN(CONFIG_LOG_TRACE_EVT_PACKAGE_SIZE, 0)]
+		__aligned(Z_LOG_MSG_ALIGNMENT);
+	struct log_msg *msg = (struct log_msg *)buf;
+	const struct log_trace_evt_desc *desc = evt->desc;
+	const uint32_t *args = evt->args;
+	uint32_t flags = Z_LOG_MSG_CBPRINTF_FLAGS(0);
+	size_t len = CONFIG_LOG_TRACE_EVT_PACKAGE_SIZE;
+	int plen;
+
+	switch (desc->nargs) {
+	case 0:
+		plen = cbprintf_package(msg->data, len, flags, desc->fmt);
+		break;
+	case 1:
+		plen = cbprintf_package(msg->data, len, flags, desc->fmt, args[0]);
+		break;
+	case 2:
+		plen = cbprintf_package(msg->data, len, flags, desc->fmt, args[0], args[1]);
+		break;
+	case 3:
+		plen = cbprintf_package(msg->data, len, flags, desc->fmt, args[0], args[1],
+					args[2]);
+		break;
+	default:
+		plen = cbprintf_package(msg->data, len, flags, desc->fmt, args[0], args[1],
+					args[2], args[3]);
+		break;
+	}
+
+	if (plen < 0) {
+		z_log_dropped(false);
+		return;
+	}
+
+	struct log_msg_desc msg_desc =
+		Z_LOG_MSG_DESC_INITIALIZER(Z_LOG_LOCAL_DOMAIN_ID, desc->level, plen, 0);
+
+	msg->hdr.desc = msg_desc;
+	msg->hdr.source = evt->source;
+	msg->hdr.timestamp = evt->timestamp;
+#if defined(CONFIG_LOG_THREAD_ID_PREFIX)
+	msg->hdr.tid = NULL;
+#endif
+
+	msg_process((union log_msg_generic *)msg);
+}
+#endif
+
 static inline bool z_log_unordered_pending(void)
 {
 	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && unordered_cnt;
@@ -565,6 +653,14 @@ bool z_impl_log_process(void)
 		return false;
 	}
 
+#ifdef CONFIG_LOG_TRACE_EVT
+	struct log_trace_evt evt;
+
+	if (z_log_trace_evt_claim(&evt)) {
+		trace_evt_msg_process(&evt);
+	}
+#endif
+
 	msg = z_log_msg_claim(&backoff);
 
 	if (msg) {
@@ -652,7 +748,86 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (size_t i = 0; i < LOG_CPU_BUFFERS; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = cpu_buf32[i];
+		config.size = ARRAY_SIZE(cpu_buf32[i]);
+		mpsc_pbuf_init(&cpu_log_buffer[i], &config);
+	}
+#endif
+}
+
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+static struct mpsc_pbuf_buffer *cpu_buffer_get(unsigned int cpu)
+{
+	return cpu == 0 ? &log_buffer : &cpu_log_buffer[cpu - 1];
+}
+
+/* Buffer of the CPU on which the message is created. */
+static struct mpsc_pbuf_buffer *local_buffer_get(void)
+{
+	return cpu_buffer_get(arch_curr_cpu()->id);
+}
+
+/* Thread may have migrated to another CPU since the message was allocated. */
+static struct mpsc_pbuf_buffer *msg_buffer_get(const struct log_msg *msg)
+{
+	const uint32_t *addr = (const uint32_t *)msg;
+
+	for (size_t i = 0; i < LOG_CPU_BUFFERS; i++) {
+		if (addr >= cpu_buf32[i] && addr < &cpu_buf32[i][ARRAY_SIZE(cpu_buf32[i])]) {
+			return &cpu_log_buffer[i];
+		}
+	}
+
+	return &log_buffer;
+}
+
+/* Claim the oldest message (lowest timestamp) from all CPU buffers. */
+static union log_msg_generic *cpu_msg_claim_oldest(void)
+{
+	union log_msg_generic *msg = NULL;
+	log_timestamp_t t_min = 0;
+	unsigned int chosen = 0;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(cpu_log_msg); i++) {
+		if (cpu_log_msg[i] == NULL) {
+			cpu_log_msg[i] =
+				(union log_msg_generic *)mpsc_pbuf_claim(cpu_buffer_get(i));
+		}
+
+		if (cpu_log_msg[i] != NULL) {
+			log_timestamp_t t = log_msg_get_timestamp(&cpu_log_msg[i]->log);
+
+			if (msg == NULL || t < t_min) {
+				t_min = t;
+				msg = cpu_log_msg[i];
+				chosen = i;
+			}
+		}
+	}
+
+	if (msg != NULL) {
+		cpu_log_msg[chosen] = NULL;
+		curr_log_buffer = cpu_buffer_get(chosen);
+	}
+
+	return msg;
+}
+
+static bool cpu_msg_pending(void)
+{
+	for (unsigned int i = 0; i < ARRAY_SIZE(cpu_log_msg); i++) {
+		if (cpu_log_msg[i] != NULL || mpsc_pbuf_is_pending(cpu_buffer_get(i))) {
+			return true;
+		}
+	}
+
+	return false;
 }
+#endif
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 {
@@ -669,7 +844,11 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return msg_alloc(local_buffer_get(), wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -701,12 +880,18 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	msg_commit(msg_buffer_get(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
 {
-#ifdef CONFIG_MPSC_PBUF
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+	return cpu_msg_claim_oldest();
+#elif defined(CONFIG_MPSC_PBUF)
 	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer);
 #else
 	return NULL;
@@ -821,10 +1006,18 @@ bool z_log_msg_pending(void)
 	size_t len;
 	int i = 0;
 
+	if (IS_ENABLED(CONFIG_LOG_TRACE_EVT) && z_log_trace_evt_pending()) {
+		return true;
+	}
+
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+		return cpu_msg_pending();
+#else
 		return msg_pending(&log_buffer);
+#endif
 	}
 
 	STRUCT_SECTION_FOREACH(log_msg_ptr, msg_ptr) {
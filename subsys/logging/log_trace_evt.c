@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_trace_evt.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/sys/atomic.h>
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_LOG_TRACE_EVT_BUFFER_SIZE),
+	     "Trace event buffer size must be a power of two");
+
+/*
+ * Ring of trace events of a single CPU. Only the owning CPU writes events,
+ * with interrupts locked, and advances the head. Only the log processing
+ * thread advances the tail.
+ */
+struct trace_evt_ring {
+	atomic_t head;
+	atomic_t tail;
+	struct log_trace_evt evts[CONFIG_LOG_TRACE_EVT_BUFFER_SIZE];
+};
+
+static struct trace_evt_ring rings[CONFIG_MP_MAX_NUM_CPUS];
+
+void z_log_trace_evt(const struct log_trace_evt_desc *desc, const void *source,
+		     const uint32_t *args)
+{
+	struct trace_evt_ring *ring;
+	struct log_trace_evt *evt;
+	atomic_val_t head;
+	atomic_val_t tail;
+	unsigned int key;
+
+	key = arch_irq_lock();
+	ring = &rings[arch_curr_cpu()->id];
+	head = atomic_get(&ring->head);
+	tail = atomic_get(&ring->tail);
+
+	if ((head - tail) >= CONFIG_LOG_TRACE_EVT_BUFFER_SIZE) {
+		arch_irq_unlock(key);
+		z_log_dropped(false);
+		return;
+	}
+
+	evt = &ring->evts[head & (CONFIG_LOG_TRACE_EVT_BUFFER_SIZE - 1)];
+	evt->desc = desc;
+	evt->source = source;
+	evt->timestamp = z_log_timestamp();
+	memcpy(evt->args, args, desc->nargs * sizeof(uint32_t));
+
+	atomic_set(&ring->head, head + 1);
+	arch_irq_unlock(key);
+
+	if (head == tail) {
+		z_log_trace_evt_notify();
+	}
+}
+
+bool z_log_trace_evt_claim(struct log_trace_evt *evt)
+{
+	struct trace_evt_ring *oldest = NULL;
+	log_timestamp_t t_min = 0;
+
+	/* Take the oldest event (lowest timestamp) from all CPU rings. */
+	ARRAY_FOR_EACH_PTR(rings, ring) {
+		atomic_val_t tail = atomic_get(&ring->tail);
+		struct log_trace_evt *e;
+
+		if (atomic_get(&ring->head) == tail) {
+			continue;
+		}
+
+		e = &ring->evts[tail & (CONFIG_LOG_TRACE_EVT_BUFFER_SIZE - 1)];
+		if (oldest == NULL || e->timestamp < t_min) {
+			oldest = ring;
+			t_min = e->timestamp;
+		}
+	}
+
+	if (oldest == NULL) {
+		return false;
+	}
+
+	atomic_val_t tail = atomic_get(&oldest->tail);
+
+	*evt = oldest->evts[tail & (CONFIG_LOG_TRACE_EVT_BUFFER_SIZE - 1)];
+	atomic_set(&oldest->tail, tail + 1);
+
+	return true;
+}
+
+bool z_log_trace_evt_pending(void)
+{
+	ARRAY_FOR_EACH_PTR(rings, ring) {
+		if (atomic_get(&ring->head) != atomic_get(&ring->tail)) {
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -5,16 +5,27 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/cache.h>
 #include <zephyr/device.h>
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/mem_mgmt/mem_attr.h>
 #include <zephyr/sys/multi_heap.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr-sw.h>
+#include <zephyr/mem_mgmt/mem_attr_heap.h>
+#include <zephyr/sys/slist.h>
+
+#define DMA_CLASSES CONFIG_MEM_ATTR_HEAP_DMA_CACHE_CLASSES
 
 struct ma_heap {
 	struct sys_heap heap;
 	uint32_t attr;
+#ifdef CONFIG_MEM_ATTR_HEAP_DMA
+	const struct mem_attr_region_t *region;
+	/* Freed DMA blocks kept per size class */
+	sys_slist_t cache[DMA_CLASSES];
+	uint8_t cached[DMA_CLASSES];
+#endif /* CONFIG_MEM_ATTR_HEAP_DMA */
 };
 
 struct {
@@ -23,6 +34,8 @@ struct {
 	int nheaps;
 } mah_data;
 
+static struct k_spinlock mah_lock;
+
 static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align, size_t size)
 {
 	uint32_t attr;
@@ -57,20 +70,148 @@ static void *mah_choice(struct sys_multi_heap *m_heap, void *cfg, size_t align,
 
 void mem_attr_heap_free(void *block)
 {
-	sys_multi_heap_free(&mah_data.multi_heap, block);
+	K_SPINLOCK(&mah_lock) {
+		sys_multi_heap_free(&mah_data.multi_heap, block);
+	}
 }
 
 void *mem_attr_heap_alloc(uint32_t attr, size_t bytes)
 {
-	return sys_multi_heap_alloc(&mah_data.multi_heap,
-				    (void *)(long) attr, bytes);
+	void *block = NULL;
+
+	K_SPINLOCK(&mah_lock) {
+		block = sys_multi_heap_alloc(&mah_data.multi_heap,
+					     (void *)(long) attr, bytes);
+	}
+
+	return block;
 }
 
 void *mem_attr_heap_aligned_alloc(uint32_t attr, size_t align, size_t bytes)
 {
-	return sys_multi_heap_aligned_alloc(&mah_data.multi_heap,
-					    (void *)(long) attr, align, bytes);
+	void *block = NULL;
+
+	K_SPINLOCK(&mah_lock) {
+		block = sys_multi_heap_aligned_alloc(&mah_data.multi_heap,
+						     (void *)(long) attr, align, bytes);
+	}
+
+	return block;
+}
+
+#ifdef CONFIG_MEM_ATTR_HEAP_DMA
+/* DMA blocks are aligned to and padded to whole cache lines */
+static size_t dma_line_size(void)
+{
+	return MAX(sys_cache_data_line_size_get(), sizeof(sys_snode_t));
+}
+
+/* Size class of a block of at least @p bytes, -1 if it is not cached */
+static int dma_class(size_t bytes, size_t line)
+{
+	for (int cls = 0; cls < DMA_CLASSES; cls++) {
+		if (bytes <= (line << cls)) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+static bool dma_heap_match(const struct ma_heap *h, const struct mem_attr_heap_dma_spec *spec)
+{
+	const struct mem_attr_region_t *region = h->region;
+
+	if ((h->attr & spec->attr) != spec->attr) {
+		return false;
+	}
+
+	if ((spec->region != 0U) && (region->dt_addr != spec->region)) {
+		return false;
+	}
+
+	/* The whole region must be reachable, wherever the block lands */
+	return (spec->addr_max == 0U) || (region->dt_addr + region->dt_size - 1U <= spec->addr_max);
+}
+
+void *mem_attr_heap_dma_alloc(const struct mem_attr_heap_dma_spec *spec, size_t bytes)
+{
+	size_t line = dma_line_size();
+	int cls = dma_class(bytes, line);
+	size_t size = (cls >= 0) ? (line << cls) : ROUND_UP(bytes, line);
+	k_spinlock_key_t key;
+	void *block = NULL;
+
+	if (bytes == 0) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&mah_lock);
+
+	for (int hdx = 0; hdx < mah_data.nheaps; hdx++) {
+		struct ma_heap *h = &mah_data.ma_heaps[hdx];
+
+		if (!dma_heap_match(h, spec)) {
+			continue;
+		}
+
+		/* Freed blocks first, of the same class or a bigger one */
+		for (int c = cls; (c >= 0) && (c < DMA_CLASSES); c++) {
+			if (h->cached[c] > 0U) {
+				h->cached[c]--;
+				block = sys_slist_get_not_empty(&h->cache[c]);
+				break;
+			}
+		}
+
+		if (block == NULL) {
+			block = sys_heap_aligned_alloc(&h->heap, line, size);
+		}
+		if (block != NULL) {
+			break;
+		}
+	}
+
+	k_spin_unlock(&mah_lock, key);
+
+	return block;
+}
+
+void mem_attr_heap_dma_free(void *block)
+{
+	const struct sys_multi_heap_rec *heap_rec;
+	size_t line = dma_line_size();
+	k_spinlock_key_t key;
+	struct ma_heap *h;
+	size_t usable;
+	int cls;
+
+	if (block == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&mah_lock);
+
+	heap_rec = sys_multi_heap_get_heap(&mah_data.multi_heap, block);
+	h = CONTAINER_OF(heap_rec->heap, struct ma_heap, heap);
+
+	/* The largest class the block can serve, the heap may have padded it */
+	usable = sys_heap_usable_size(&h->heap, block);
+	cls = dma_class(usable, line);
+	if ((cls > 0) && (usable < (line << cls))) {
+		cls--;
+	}
+
+	if ((cls >= 0) && (usable >= line) && (h->cached[cls] < CONFIG_MEM_ATTR_HEAP_DMA_CACHE_DEPTH)) {
+		sys_slist_prepend(&h->cache[cls], (sys_snode_t *)block);
+		h->cached[cls]++;
+	} else {
+		sys_heap_free(&h->heap, block);
+	}
+
+	k_spin_unlock(&mah_lock, key);
 }
+#endif /* CONFIG_MEM_ATTR_HEAP_DMA */
 
 const struct mem_attr_region_t *mem_attr_heap_get_region(void *addr)
 {
@@ -95,6 +236,9 @@ static int ma_heap_add(const struct mem_attr_region_t *region, uint32_t attr)
 	h = &mh->heap;
 
 	mh->attr = attr;
+#ifdef CONFIG_MEM_ATTR_HEAP_DMA
+	mh->region = region;
+#endif /* CONFIG_MEM_ATTR_HEAP_DMA */
 
 	sys_heap_init(h, (void *) region->dt_addr, region->dt_size);
 	sys_multi_heap_add_heap(&mah_data.multi_heap, h, (void *) region);
@@ -43,6 +43,15 @@ NET_BUF_POOL_DEFINE(pkt_pool, CONFIG_MCUMGR_TRANSPORT_NETBUF_COUNT,
 		    CONFIG_MCUMGR_TRANSPORT_NETBUF_SIZE,
 		    CONFIG_MCUMGR_TRANSPORT_NETBUF_USER_DATA_SIZE, NULL);
 
+#if CONFIG_MCUMGR_TRANSPORT_NETBUF_RSP_COUNT > 0
+/* Responses are allocated from here first, so that the requests queued by a
+ * client that pipelines them cannot starve the responses.
+ */
+NET_BUF_POOL_DEFINE(rsp_pool, CONFIG_MCUMGR_TRANSPORT_NETBUF_RSP_COUNT,
+		    CONFIG_MCUMGR_TRANSPORT_NETBUF_SIZE,
+		    CONFIG_MCUMGR_TRANSPORT_NETBUF_USER_DATA_SIZE, NULL);
+#endif
+
 struct net_buf *smp_packet_alloc(void)
 {
 	return net_buf_alloc(&pkt_pool, K_NO_WAIT);
@@ -72,7 +81,14 @@ void *smp_alloc_rsp(const void *req, void *arg)
 
 	req_nb = req;
 
+#if CONFIG_MCUMGR_TRANSPORT_NETBUF_RSP_COUNT > 0
+	rsp_nb = net_buf_alloc(&rsp_pool, K_NO_WAIT);
+	if (rsp_nb == NULL) {
+		rsp_nb = smp_packet_alloc();
+	}
+#else
 	rsp_nb = smp_packet_alloc();
+#endif
 	if (rsp_nb == NULL) {
 		return NULL;
 	}
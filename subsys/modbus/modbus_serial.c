@@ -29,6 +29,69 @@ LOG_MODULE_REGISTER(modbus_serial, CONFIG_MODBUS_LOG_LEVEL);
 #include <zephyr/sys/crc.h>
 #include <modbus_internal.h>
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+static void modbus_serial_tx_on(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	int err;
+
+	if (cfg->de != NULL) {
+		gpio_pin_set(cfg->de->port, cfg->de->pin, 1);
+	}
+
+	err = uart_tx(cfg->dev, cfg->uart_buf, cfg->uart_buf_ctr, SYS_FOREVER_US);
+	if (err != 0) {
+		LOG_ERR("Failed to start transmission (%d)", err);
+	}
+}
+
+static void modbus_serial_tx_off(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	if (cfg->de != NULL) {
+		gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
+	}
+}
+
+static void modbus_serial_rx_on(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	int err;
+
+	if (cfg->re != NULL) {
+		gpio_pin_set(cfg->re->port, cfg->re->pin, 1);
+	}
+
+	cfg->uart_buf_ctr = 0;
+	cfg->uart_buf_ptr = &cfg->uart_buf[0];
+	atomic_set_bit(&ctx->state, MODBUS_STATE_RX_ENABLED);
+
+	/*
+	 * The receiver timeout is the inter-frame gap, so the end of an RTU
+	 * frame is detected by the UART instead of a per character timer.
+	 * If the previous reception is still being stopped, it is restarted
+	 * from the UART_RX_DISABLED event.
+	 */
+	err = uart_rx_enable(cfg->dev, cfg->uart_buf, CONFIG_MODBUS_BUFFER_SIZE,
+			     cfg->rtu_timeout);
+	if (err != 0 && err != -EBUSY) {
+		LOG_ERR("Failed to enable reception (%d)", err);
+	}
+}
+
+static void modbus_serial_rx_off(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	atomic_clear_bit(&ctx->state, MODBUS_STATE_RX_ENABLED);
+	(void)uart_rx_disable(cfg->dev);
+
+	if (cfg->re != NULL) {
+		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
+	}
+}
+#else
 static void modbus_serial_tx_on(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
@@ -84,6 +147,7 @@ static void modbus_serial_rx_off(struct modbus_context *ctx)
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
 	}
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 #ifdef CONFIG_MODBUS_ASCII_MODE
 /* The function calculates an 8-bit Longitudinal Redundancy Check. */
@@ -318,6 +382,80 @@ static void rtu_tx_adu(struct modbus_context *ctx)
 	modbus_serial_tx_on(ctx);
 }
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+/*
+ * Data has been received in the frame buffer, either because the line has
+ * been idle for the inter-frame gap or because the buffer is full.
+ */
+static void async_handler_rx_rdy(struct modbus_context *ctx,
+				 const struct uart_event_rx *rx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	if (!atomic_test_bit(&ctx->state, MODBUS_STATE_RX_ENABLED)) {
+		return;
+	}
+
+	cfg->uart_buf_ctr = rx->offset + rx->len;
+	cfg->uart_buf_ptr = &cfg->uart_buf[cfg->uart_buf_ctr];
+
+	if ((ctx->mode == MODBUS_MODE_ASCII) &&
+	    IS_ENABLED(CONFIG_MODBUS_ASCII_MODE) &&
+	    cfg->uart_buf_ctr < CONFIG_MODBUS_BUFFER_SIZE &&
+	    cfg->uart_buf[cfg->uart_buf_ctr - 1] != MODBUS_ASCII_END_FRAME_CHAR2) {
+		/* Pause in the middle of an ASCII frame */
+		return;
+	}
+
+	/* Ignore anything received until the frame has been processed */
+	atomic_clear_bit(&ctx->state, MODBUS_STATE_RX_ENABLED);
+	k_work_submit(&ctx->server_work);
+}
+
+static void uart_async_handler(const struct device *dev,
+			       struct uart_event *evt, void *user_data)
+{
+	struct modbus_context *ctx = (struct modbus_context *)user_data;
+	struct modbus_serial_config *cfg;
+
+	if (ctx == NULL) {
+		LOG_ERR("Modbus hardware is not properly initialized");
+		return;
+	}
+
+	cfg = ctx->cfg;
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		async_handler_rx_rdy(ctx, &evt->data.rx);
+		break;
+	case UART_RX_DISABLED:
+		if (atomic_test_bit(&ctx->state, MODBUS_STATE_RX_ENABLED)) {
+			(void)uart_rx_enable(dev, cfg->uart_buf,
+					     CONFIG_MODBUS_BUFFER_SIZE,
+					     cfg->rtu_timeout);
+		}
+		break;
+	case UART_RX_STOPPED:
+		LOG_DBG("Reception stopped, reason %d", evt->data.rx_stop.reason);
+		break;
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		/*
+		 * The driver reports completion once the last stop bit has
+		 * been sent, so the RS-485 transceiver can be released.
+		 */
+		cfg->uart_buf_ctr = 0;
+		cfg->uart_buf_ptr = &cfg->uart_buf[0];
+		modbus_serial_tx_off(ctx);
+		modbus_serial_rx_on(ctx);
+		break;
+	default:
+		/* A single frame buffer is used, no further buffer is provided */
+		break;
+	}
+}
+#else
 /*
  * A byte has been received from a serial port. We just store it in the buffer
  * for processing when a complete packet has been received.
@@ -438,6 +576,7 @@ static void rtu_tmr_handler(struct k_timer *t_id)
 
 	k_work_submit(&ctx->server_work);
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 static int configure_gpio(struct modbus_context *ctx)
 {
@@ -616,6 +755,12 @@ int modbus_serial_init(struct modbus_context *ctx,
 	cfg->uart_buf_ctr = 0;
 	cfg->uart_buf_ptr = &cfg->uart_buf[0];
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	err = uart_callback_set(cfg->dev, uart_async_handler, ctx);
+	if (err != 0) {
+		return err;
+	}
+#else
 	err = uart_irq_callback_user_data_set(cfg->dev, uart_cb_handler, ctx);
 	if (err != 0) {
 		return err;
@@ -623,6 +768,7 @@ int modbus_serial_init(struct modbus_context *ctx,
 
 	k_timer_init(&cfg->rtu_timer, rtu_tmr_handler, NULL);
 	k_timer_user_data_set(&cfg->rtu_timer, ctx);
+#endif
 
 	modbus_serial_rx_on(ctx);
 	LOG_INF("RTU timeout %u us", cfg->rtu_timeout);
@@ -634,5 +780,9 @@ void modbus_serial_disable(struct modbus_context *ctx)
 {
 	modbus_serial_tx_off(ctx);
 	modbus_serial_rx_off(ctx);
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	(void)uart_tx_abort(ctx->cfg->dev);
+#else
 	k_timer_stop(&ctx->cfg->rtu_timer);
+#endif
 }
@@ -315,7 +315,20 @@ static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
 	buf[0] = fcs;
 	buf[1] = 0xF9;
 	ring_buf_put(&cmux->transmit_rb, buf, 2);
-	k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
+
+	/*
+	 * Let small frames queued within the coalescing delay go out in a
+	 * single pipe transmit, unless the buffer is already half full.
+	 */
+	if (CONFIG_MODEM_CMUX_TRANSMIT_COALESCE_US == 0) {
+		k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
+	} else if (ring_buf_size_get(&cmux->transmit_rb) <
+		   ring_buf_capacity_get(&cmux->transmit_rb) / 2) {
+		k_work_schedule(&cmux->transmit_work, K_USEC(CONFIG_MODEM_CMUX_TRANSMIT_COALESCE_US));
+	} else {
+		k_work_reschedule(&cmux->transmit_work, K_NO_WAIT);
+	}
+
 	return data_len;
 }
 
@@ -910,6 +923,54 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+/* Returns the number of bytes consumed, one unless a run could be handled at once */
+static size_t modem_cmux_process_received_run(struct modem_cmux *cmux, const uint8_t *data,
+					      size_t len)
+{
+	const uint8_t *flag;
+	size_t n;
+
+	switch (cmux->receive_state) {
+	case MODEM_CMUX_RECEIVE_STATE_SOF:
+		/* Skip noise up to the next flag */
+		flag = memchr(data, 0xF9, len);
+		if (flag == NULL) {
+			return len;
+		}
+
+		modem_cmux_process_received_byte(cmux, 0xF9);
+		return flag - data + 1;
+
+	case MODEM_CMUX_RECEIVE_STATE_DATA:
+		if (cmux->receive_buf_len >= cmux->frame.data_len) {
+			/* Malformed empty frame, the byte path handles it */
+			modem_cmux_process_received_byte(cmux, data[0]);
+			return 1;
+		}
+
+		n = MIN(len, cmux->frame.data_len - cmux->receive_buf_len);
+
+		/* An overrun is detected at the FCS, only copy what fits */
+		if (cmux->receive_buf_len < cmux->receive_buf_size) {
+			memcpy(&cmux->receive_buf[cmux->receive_buf_len], data,
+			       MIN(n, cmux->receive_buf_size - cmux->receive_buf_len));
+		}
+
+		cmux->receive_buf_len += n;
+
+		if (cmux->frame.data_len == cmux->receive_buf_len) {
+			/* Await FCS */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+		}
+
+		return n;
+
+	default:
+		modem_cmux_process_received_byte(cmux, data[0]);
+		return 1;
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
@@ -926,8 +987,8 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (int i = 0; i < ret; i++) {
-		modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
+	for (int i = 0; i < ret;) {
+		i += modem_cmux_process_received_run(cmux, &cmux->work_buf[i], ret - i);
 	}
 
 	/* Reschedule received work */
@@ -201,6 +201,17 @@ static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 	return false;
 }
 
+static void modem_ppp_drop_received(struct modem_ppp *ppp)
+{
+	LOG_WRN("Dropped PPP frame");
+	net_pkt_unref(ppp->rx_pkt);
+	ppp->rx_pkt = NULL;
+	ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+	ppp->stats.drop++;
+#endif
+}
+
 static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 {
 	switch (ppp->receive_state) {
@@ -285,26 +296,14 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 		}
 
 		if (net_pkt_write_u8(ppp->rx_pkt, byte) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_received(ppp);
 		}
 
 		break;
 
 	case MODEM_PPP_RECEIVE_STATE_UNESCAPING:
 		if (net_pkt_write_u8(ppp->rx_pkt, (byte ^ MODEM_PPP_VALUE_ESCAPE)) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_received(ppp);
 			break;
 		}
 
@@ -313,6 +312,55 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+/* Returns the number of bytes consumed, one unless a run could be written at once */
+static size_t modem_ppp_process_received_run(struct modem_ppp *ppp, const uint8_t *data,
+					     size_t len)
+{
+	size_t avail;
+	size_t run;
+	size_t n;
+
+	if (ppp->receive_state != MODEM_PPP_RECEIVE_STATE_WRITING) {
+		modem_ppp_process_received_byte(ppp, data[0]);
+		return 1;
+	}
+
+	/* Bytes up to the next delimiter or escape are copied as they are */
+	for (run = 0; run < len; run++) {
+		if (data[run] == MODEM_PPP_CODE_DELIMITER || data[run] == MODEM_PPP_CODE_ESCAPE) {
+			break;
+		}
+	}
+
+	if (run < 2) {
+		modem_ppp_process_received_byte(ppp, data[0]);
+		return 1;
+	}
+
+	/* Like the byte path, keep one spare byte of buffer space */
+	avail = net_pkt_available_buffer(ppp->rx_pkt);
+	if (avail <= 1) {
+		if (net_pkt_alloc_buffer(ppp->rx_pkt, CONFIG_MODEM_PPP_NET_BUF_FRAG_SIZE,
+					 AF_INET, K_NO_WAIT) < 0) {
+			LOG_WRN("Failed to alloc buffer");
+			net_pkt_unref(ppp->rx_pkt);
+			ppp->rx_pkt = NULL;
+			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+			return run;
+		}
+
+		avail = net_pkt_available_buffer(ppp->rx_pkt);
+	}
+
+	n = MIN(run, avail - 1);
+	if (net_pkt_write(ppp->rx_pkt, data, n) < 0) {
+		modem_ppp_drop_received(ppp);
+		return run;
+	}
+
+	return n;
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -420,8 +468,8 @@ static void modem_ppp_process_handler(struct k_work *item)
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
+	for (int i = 0; i < ret;) {
+		i += modem_ppp_process_received_run(ppp, &ppp->receive_buf[i], ret - i);
 	}
 
 	k_work_submit(&ppp->process_work);
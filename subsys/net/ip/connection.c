@@ -61,6 +61,18 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_BUCKETS),
+	     "CONFIG_NET_CONN_HASH_BUCKETS must be a power of two");
+
+/* Connections bound to a TCP or UDP port, indexed by protocol and port (in
+ * network byte order), and all the others, which have to be checked for
+ * every received packet.
+ */
+static sys_slist_t conn_buckets[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_wildcard;
+#endif
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -132,12 +144,90 @@ static struct net_conn *conn_get_unused(void)
 	return CONTAINER_OF(node, struct net_conn, node);
 }
 
+#if defined(CONFIG_NET_CONN_HASH)
+static sys_slist_t *conn_bucket(uint16_t proto, uint16_t port)
+{
+	return &conn_buckets[(proto ^ port ^ (port >> 8)) & (CONFIG_NET_CONN_HASH_BUCKETS - 1)];
+}
+
+static sys_slist_t *conn_index_list(struct net_conn *conn)
+{
+	uint16_t port = net_sin(&conn->local_addr)->sin_port;
+
+	if ((conn->proto == IPPROTO_UDP || conn->proto == IPPROTO_TCP) && port != 0U &&
+	    (conn->family == AF_INET || conn->family == AF_INET6 ||
+	     conn->family == AF_UNSPEC)) {
+		return conn_bucket(conn->proto, port);
+	}
+
+	return &conn_wildcard;
+}
+
+/* Must be called with conn_lock held */
+static void conn_index_add(struct net_conn *conn)
+{
+	sys_slist_prepend(conn_index_list(conn), &conn->hash_node);
+}
+
+/* Must be called with conn_lock held, before the local port changes */
+static void conn_index_remove(struct net_conn *conn)
+{
+	sys_slist_find_and_remove(conn_index_list(conn), &conn->hash_node);
+}
+
+/* Handlers of the destination port first, then those not bound to a port.
+ * The handlers of the two lists never have the same rank, so the order in
+ * which they are checked does not change which one is picked.
+ */
+static struct net_conn *conn_input_first(uint16_t proto, uint16_t port)
+{
+	struct net_conn *conn;
+	sys_slist_t *bucket = conn_bucket(proto, port);
+
+	if (port != 0U && !sys_slist_is_empty(bucket)) {
+		return SYS_SLIST_PEEK_HEAD_CONTAINER(bucket, conn, hash_node);
+	}
+
+	return SYS_SLIST_PEEK_HEAD_CONTAINER(&conn_wildcard, conn, hash_node);
+}
+
+static struct net_conn *conn_input_next(struct net_conn *conn)
+{
+	struct net_conn *next = SYS_SLIST_PEEK_NEXT_CONTAINER(conn, hash_node);
+
+	if (next == NULL && conn_index_list(conn) != &conn_wildcard) {
+		next = SYS_SLIST_PEEK_HEAD_CONTAINER(&conn_wildcard, next, hash_node);
+	}
+
+	return next;
+}
+#else
+#define conn_index_add(conn)
+#define conn_index_remove(conn)
+
+static struct net_conn *conn_input_first(uint16_t proto, uint16_t port)
+{
+	struct net_conn *conn;
+
+	ARG_UNUSED(proto);
+	ARG_UNUSED(port);
+
+	return SYS_SLIST_PEEK_HEAD_CONTAINER(&conn_used, conn, node);
+}
+
+static struct net_conn *conn_input_next(struct net_conn *conn)
+{
+	return SYS_SLIST_PEEK_NEXT_CONTAINER(conn, node);
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static void conn_set_used(struct net_conn *conn)
 {
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_index_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -463,6 +553,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_index_remove(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -491,12 +582,17 @@ int net_conn_update(struct net_conn_handle *handle,
 
 	net_conn_change_callback(conn, cb, user_data);
 
+	/* The lookup table position depends on the local port */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_index_remove(conn);
+
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_index_add(conn);
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -936,7 +1032,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	for (conn = conn_input_first(proto, dst_port); conn != NULL;
+	     conn = conn_input_next(conn)) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (!is_iface_matching(conn, pkt)) {
 			continue; /* wrong interface */
@@ -1118,6 +1215,14 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_buckets[i]);
+	}
+
+	sys_slist_init(&conn_wildcard);
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
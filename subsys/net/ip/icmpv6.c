@@ -358,8 +358,7 @@ enum net_verdict net_icmpv6_input(struct net_pkt *pkt,
 	}
 
 
-	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), NET_IF_CHECKSUM_IPV6_ICMP) ||
-	    net_pkt_is_ip_reassembled(pkt)) {
+	if (net_pkt_need_rx_chksum(pkt, NET_IF_CHECKSUM_IPV6_ICMP)) {
 		if (net_calc_chksum_icmpv6(pkt) != 0U) {
 			NET_DBG("DROP: invalid checksum");
 			goto drop;
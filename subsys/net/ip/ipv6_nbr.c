@@ -252,18 +252,71 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+/*
+ * Neighbors are hashed on their IPv6 address, so that a lookup only walks
+ * the entries sharing a bucket. Buckets and chains hold pool indexes plus
+ * one, zero ends a chain.
+ */
+#define NBR_HASH_SIZE CONFIG_NET_IPV6_MAX_NEIGHBORS
+
+static uint16_t nbr_bucket[NBR_HASH_SIZE];
+static uint16_t nbr_chain[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static inline int nbr_index(struct net_nbr *nbr)
+{
+	return CONTAINER_OF(nbr, typeof(net_neighbor_pool[0]), nbr) -
+	       net_neighbor_pool;
+}
+
+static uint32_t nbr_hash(const struct in6_addr *addr)
+{
+	uint32_t hash = 2166136261U;
+	int i;
+
+	/* FNV-1a */
+	for (i = 0; i < sizeof(addr->s6_addr); i++) {
+		hash = (hash ^ addr->s6_addr[i]) * 16777619U;
+	}
+
+	return hash % NBR_HASH_SIZE;
+}
+
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	uint32_t hash = nbr_hash(&net_ipv6_nbr_data(nbr)->addr);
+	int idx = nbr_index(nbr);
+
+	nbr_chain[idx] = nbr_bucket[hash];
+	nbr_bucket[hash] = idx + 1;
+}
+
+static void nbr_hash_del(struct net_nbr *nbr)
+{
+	uint16_t *link = &nbr_bucket[nbr_hash(&net_ipv6_nbr_data(nbr)->addr)];
+	int idx = nbr_index(nbr);
+
+	while (*link != 0 && *link != idx + 1) {
+		link = &nbr_chain[*link - 1];
+	}
+
+	if (*link != 0) {
+		*link = nbr_chain[idx];
+		nbr_chain[idx] = 0;
+	}
+}
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
-	int i;
+	uint16_t next = nbr_bucket[nbr_hash(addr)];
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+	ARG_UNUSED(table);
 
-		if (!nbr->ref) {
-			continue;
-		}
+	while (next != 0) {
+		struct net_nbr *nbr = get_nbr(next - 1);
+
+		next = nbr_chain[next - 1];
 
 		if (iface && nbr->iface != iface) {
 			continue;
@@ -412,6 +465,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_add(nbr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -656,7 +710,7 @@ void net_neighbor_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	nbr_hash_del(nbr);
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
@@ -797,9 +851,10 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. Packets
+	 * segmented by the driver are larger than the MTU by design.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_tso_mss(pkt) == 0U) {
 		size_t pkt_len = net_pkt_get_len(pkt);
 		uint16_t mtu;
 
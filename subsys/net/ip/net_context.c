@@ -2110,6 +2110,60 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 	return ret;
 }
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+static void zerocopy_buf_destroy(struct net_buf *buf);
+
+/* Views into the application buffers passed with ZSOCK_MSG_ZEROCOPY, the
+ * user data holds the fragment the view references.
+ */
+NET_BUF_POOL_FIXED_DEFINE(zerocopy_bufs, CONFIG_NET_CONTEXT_ZEROCOPY_BUF_COUNT, 0,
+			  sizeof(struct net_buf *), zerocopy_buf_destroy);
+
+static void zerocopy_buf_destroy(struct net_buf *buf)
+{
+	struct net_buf *frag = *(struct net_buf **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	/* Hand the fragment back to the application, its pool destroy
+	 * callback tells that the data is no longer used.
+	 */
+	net_buf_unref(frag);
+}
+
+static int context_attach_data(struct net_pkt *pkt, const struct msghdr *msghdr)
+{
+	for (int i = 0; i < msghdr->msg_iovlen; i++) {
+		struct net_buf *frag = msghdr->msg_iov[i].iov_base;
+
+		if (frag == NULL || net_buf_frags_len(frag) != msghdr->msg_iov[i].iov_len) {
+			return -EINVAL;
+		}
+
+		for (; frag != NULL; frag = frag->frags) {
+			struct net_buf *view;
+
+			if (frag->len == 0U) {
+				continue;
+			}
+
+			view = net_buf_alloc_with_data(&zerocopy_bufs, frag->data, frag->len,
+						       PKT_WAIT_TIME);
+			if (view == NULL) {
+				return -ENOBUFS;
+			}
+
+			*(struct net_buf **)net_buf_user_data(view) = net_buf_ref(frag);
+			net_pkt_append_buffer(pkt, view);
+		}
+	}
+
+	return 0;
+}
+#else
+#define context_attach_data(pkt, msghdr) -EOPNOTSUPP
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 static int context_setup_udp_packet(struct net_context *context,
 				    sa_family_t family,
 				    struct net_pkt *pkt,
@@ -2117,7 +2171,8 @@ static int context_setup_udp_packet(struct net_context *context,
 				    size_t len,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
-				    socklen_t addrlen)
+				    socklen_t addrlen,
+				    int flags)
 {
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
@@ -2155,7 +2210,12 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
+	if (flags & ZSOCK_MSG_ZEROCOPY) {
+		ret = context_attach_data(pkt, msg);
+	} else {
+		ret = context_write_data(pkt, buf, len, msg);
+	}
+
 	if (ret) {
 		return ret;
 	}
@@ -2303,7 +2363,8 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  int flags)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface = NULL;
@@ -2327,6 +2388,15 @@ static int context_sendto(struct net_context *context,
 		return -EDESTADDRREQ;
 	}
 
+	/* Zero-copy is only supported for datagrams built by the stack */
+	if ((flags & ZSOCK_MSG_ZEROCOPY) &&
+	    (!IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY) || msghdr == NULL ||
+	     net_context_get_type(context) != SOCK_DGRAM ||
+	     net_context_get_proto(context) != IPPROTO_UDP ||
+	     net_if_is_ip_offloaded(net_context_get_iface(context)))) {
+		return -EOPNOTSUPP;
+	}
+
 	/* Are we trying to send IPv4 packet to mapped V6 address, in that case
 	 * we need to set the family to AF_INET so that various checks below
 	 * are done to the packet correctly and we actually send an IPv4 pkt.
@@ -2575,7 +2645,9 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	/* With zero-copy only the headers are placed in the allocated buffer */
+	pkt = context_alloc_pkt(context, family, (flags & ZSOCK_MSG_ZEROCOPY) ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2583,7 +2655,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (tmp_len < len && !(flags & ZSOCK_MSG_ZEROCOPY)) {
 		if (net_context_get_type(context) == SOCK_DGRAM ||
 		    net_context_get_type(context) == SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2646,7 +2718,7 @@ skip_alloc:
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
 		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+					       dst_addr, addrlen, flags);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -2839,7 +2911,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, 0);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -2858,7 +2930,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, flags);
 
 	k_mutex_unlock(&context->lock);
 
@@ -2879,7 +2951,7 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, 0);
 
 	k_mutex_unlock(&context->lock);
 
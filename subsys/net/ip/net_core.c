@@ -64,6 +64,33 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "net_stats.h"
 
 #if defined(CONFIG_NET_NATIVE)
+static enum net_verdict process_l3(struct net_pkt *pkt, bool is_loopback)
+{
+	uint8_t family = net_pkt_family(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IP) && (family == AF_INET || family == AF_INET6 ||
+					  family == AF_UNSPEC || family == AF_PACKET)) {
+		/* IP version and header length. */
+		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
+
+		if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
+			return net_ipv6_input(pkt, is_loopback);
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
+			return net_ipv4_input(pkt, is_loopback);
+		}
+
+		NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
+		net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
+		net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
+		return NET_DROP;
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == AF_CAN) {
+		return net_canbus_socket_input(pkt);
+	}
+
+	NET_DBG("Unknown protocol family packet (0x%x)", family);
+	return NET_DROP;
+}
+
 static inline enum net_verdict process_data(struct net_pkt *pkt,
 					    bool is_loopback)
 {
@@ -123,30 +150,25 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 		}
 	}
 
-	uint8_t family = net_pkt_family(pkt);
-
-	if (IS_ENABLED(CONFIG_NET_IP) && (family == AF_INET || family == AF_INET6 ||
-					  family == AF_UNSPEC || family == AF_PACKET)) {
-		/* IP version and header length. */
-		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
-
-		if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
-			return net_ipv6_input(pkt, is_loopback);
-		} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
-			return net_ipv4_input(pkt, is_loopback);
+	if (IS_ENABLED(CONFIG_NET_TCP_RX_COALESCE) && !is_loopback && !locally_routed) {
+		ret = net_tcp_coalesce_input(pkt);
+		if (ret != NET_CONTINUE) {
+			return ret;
 		}
-
-		NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
-		net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
-		net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
-		return NET_DROP;
-	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == AF_CAN) {
-		return net_canbus_socket_input(pkt);
 	}
 
-	NET_DBG("Unknown protocol family packet (0x%x)", family);
-	return NET_DROP;
+	return process_l3(pkt, is_loopback);
+}
+
+#if defined(CONFIG_NET_TCP_RX_COALESCE)
+void net_process_l3_packet(struct net_pkt *pkt)
+{
+	if (process_l3(pkt, false) != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
 }
+#endif /* CONFIG_NET_TCP_RX_COALESCE */
 
 static void processing_data(struct net_pkt *pkt, bool is_loopback)
 {
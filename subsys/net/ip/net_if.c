@@ -5699,6 +5699,26 @@ void net_if_foreach(net_if_cb_t cb, void *user_data)
 	}
 }
 
+int net_if_pkt_quota_set(struct net_if *iface, uint16_t rx_quota, uint16_t tx_quota)
+{
+#if defined(CONFIG_NET_PKT_IFACE_QUOTA)
+	if (rx_quota > CONFIG_NET_PKT_RX_COUNT || tx_quota > CONFIG_NET_PKT_TX_COUNT) {
+		return -EINVAL;
+	}
+
+	iface->rx_pkt_quota = rx_quota;
+	iface->tx_pkt_quota = tx_quota;
+
+	return 0;
+#else
+	ARG_UNUSED(iface);
+	ARG_UNUSED(rx_quota);
+	ARG_UNUSED(tx_quota);
+
+	return -ENOTSUP;
+#endif
+}
+
 bool net_if_is_offloaded(struct net_if *iface)
 {
 	return (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
@@ -39,6 +39,7 @@ LOG_MODULE_REGISTER(net_pkt, CONFIG_NET_PKT_LOG_LEVEL);
 #include <zephyr/net/udp.h>
 
 #include "net_private.h"
+#include "net_stats.h"
 #include "tcp_internal.h"
 
 /* Make sure net_buf data size is large enough that IPv6
@@ -515,6 +516,107 @@ static inline struct net_buf_pool *get_data_pool(struct net_context *context)
 #define get_data_pool(...) NULL
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 
+#if defined(CONFIG_NET_PKT_IFACE_QUOTA)
+static atomic_t *pkt_quota_counter(struct k_mem_slab *slab, struct net_if *iface)
+{
+	if (slab == &rx_pkts) {
+		return &iface->rx_pkts;
+	} else if (slab == &tx_pkts) {
+		return &iface->tx_pkts;
+	}
+
+	/* Slabs of a net_context are a partition of their own */
+	return NULL;
+}
+
+static int pkt_quota_iface_count(void)
+{
+	static int count;
+
+	if (count == 0) {
+		STRUCT_SECTION_COUNT(net_if, &count);
+	}
+
+	return count;
+}
+
+static bool pkt_quota_charge(struct k_mem_slab *slab, struct net_if *iface)
+{
+	bool rx = slab == &rx_pkts;
+	uint32_t pool = rx ? CONFIG_NET_PKT_RX_COUNT : CONFIG_NET_PKT_TX_COUNT;
+	uint16_t quota = rx ? iface->rx_pkt_quota : iface->tx_pkt_quota;
+	atomic_t *used = pkt_quota_counter(slab, iface);
+	atomic_val_t held;
+
+	if (used == NULL) {
+		return true;
+	}
+
+	if (quota == 0U) {
+		quota = MAX(pool * CONFIG_NET_PKT_IFACE_QUOTA_PERCENT / 100U, 1U);
+	}
+
+	held = atomic_inc(used);
+	if (held >= quota) {
+		atomic_dec(used);
+
+		if (rx) {
+			net_stats_update_pkt_quota_rx_drop(iface);
+		} else {
+			net_stats_update_pkt_quota_tx_drop(iface);
+		}
+
+		NET_DBG("iface %d over its %s quota of %u packets",
+			net_if_get_by_iface(iface), rx ? "RX" : "TX", quota);
+		return false;
+	}
+
+	/* With the pool nearly exhausted, leave the last packets to the
+	 * interfaces that hold less than their fair share of it.
+	 */
+	if (k_mem_slab_num_free_get(slab) <= CONFIG_NET_PKT_LOW_WATERMARK &&
+	    held >= MAX(pool / pkt_quota_iface_count(), 1U)) {
+		atomic_dec(used);
+
+		if (rx) {
+			net_stats_update_pkt_quota_rx_early_drop(iface);
+		} else {
+			net_stats_update_pkt_quota_tx_early_drop(iface);
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+static void pkt_quota_release(struct k_mem_slab *slab, struct net_if *iface)
+{
+	atomic_t *used = pkt_quota_counter(slab, iface);
+
+	if (used != NULL) {
+		atomic_dec(used);
+	}
+}
+
+static inline void pkt_quota_set_owner(struct net_pkt *pkt, struct net_if *iface)
+{
+	pkt->quota_iface = iface;
+}
+
+static void pkt_quota_uncharge(struct net_pkt *pkt)
+{
+	if (pkt->quota_iface != NULL) {
+		pkt_quota_release(pkt->slab, pkt->quota_iface);
+	}
+}
+#else
+#define pkt_quota_charge(slab, iface) true
+#define pkt_quota_release(slab, iface)
+#define pkt_quota_set_owner(pkt, iface)
+#define pkt_quota_uncharge(pkt)
+#endif /* CONFIG_NET_PKT_IFACE_QUOTA */
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 void net_pkt_unref_debug(struct net_pkt *pkt, const char *caller, int line)
 {
@@ -613,6 +715,8 @@ done:
 		net_pkt_cursor_init(pkt);
 	}
 
+	pkt_quota_uncharge(pkt);
+
 	k_mem_slab_free(pkt->slab, (void *)pkt);
 }
 
@@ -1594,6 +1698,10 @@ static struct net_pkt *pkt_alloc_on_iface(struct k_mem_slab *slab,
 {
 	struct net_pkt *pkt;
 
+	if (iface != NULL && !pkt_quota_charge(slab, iface)) {
+		return NULL;
+	}
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 	pkt = pkt_alloc(slab, timeout, caller, line);
 #else
@@ -1602,6 +1710,9 @@ static struct net_pkt *pkt_alloc_on_iface(struct k_mem_slab *slab,
 
 	if (pkt) {
 		net_pkt_set_iface(pkt, iface);
+		pkt_quota_set_owner(pkt, iface);
+	} else if (iface != NULL) {
+		pkt_quota_release(slab, iface);
 	}
 
 	return pkt;
@@ -2047,12 +2158,14 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_rx_timestamping(clone_pkt, net_pkt_is_rx_timestamping(pkt));
 	net_pkt_set_forwarding(clone_pkt, net_pkt_forwarding(pkt));
 	net_pkt_set_chksum_done(clone_pkt, net_pkt_is_chksum_done(pkt));
+	net_pkt_set_rx_chksum_verified(clone_pkt, net_pkt_is_rx_chksum_verified(pkt));
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
 	net_pkt_set_cooked_mode(clone_pkt, net_pkt_is_cooked_mode(pkt));
 	net_pkt_set_ipv4_pmtu(clone_pkt, net_pkt_ipv4_pmtu(pkt));
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_tso_mss(clone_pkt, net_pkt_tso_mss(pkt));
 
 #if defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_L2_IPIP)
 	net_pkt_set_remote_address(clone_pkt, net_pkt_remote_address(pkt),
@@ -206,6 +206,34 @@ static inline void net_tc_rx_init(void) { }
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout);
 extern enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+
+/* Number of RX queues, each with its own thread, per traffic class */
+#if defined(CONFIG_NET_TC_RX_STEERING)
+#define NET_TC_RX_QUEUES CONFIG_NET_TC_RX_STEERING_QUEUES
+#else
+#define NET_TC_RX_QUEUES 1
+#endif
+
+#define NET_TC_RX_THREAD_COUNT (NET_TC_RX_COUNT * NET_TC_RX_QUEUES)
+
+#if defined(CONFIG_NET_TCP_RX_COALESCE)
+extern int net_tc_rx_thread_id(void);
+extern void net_process_l3_packet(struct net_pkt *pkt);
+extern enum net_verdict net_tcp_coalesce_input(struct net_pkt *pkt);
+extern void net_tcp_coalesce_flush(int thread_id);
+#else
+static inline enum net_verdict net_tcp_coalesce_input(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+
+static inline void net_tcp_coalesce_flush(int thread_id)
+{
+	ARG_UNUSED(thread_id);
+}
+#endif /* CONFIG_NET_TCP_RX_COALESCE */
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
 char *net_sprint_addr(sa_family_t af, const void *addr);
@@ -351,6 +379,20 @@ static inline uint16_t net_calc_chksum_tcp(struct net_pkt *pkt)
 	return net_calc_chksum(pkt, IPPROTO_TCP);
 }
 
+/* Whether a checksum of a received packet still has to be verified. The
+ * hardware status of a reassembled packet only covers its first fragment.
+ */
+static inline bool net_pkt_need_rx_chksum(struct net_pkt *pkt,
+					  enum net_if_checksum_type type)
+{
+	if (net_pkt_is_ip_reassembled(pkt)) {
+		return true;
+	}
+
+	return !net_pkt_is_rx_chksum_verified(pkt) &&
+	       net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type);
+}
+
 static inline char *net_sprint_ll_addr(const uint8_t *ll, uint8_t ll_len)
 {
 	static char buf[sizeof("xx:xx:xx:xx:xx:xx:xx:xx")];
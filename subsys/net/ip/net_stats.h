@@ -98,6 +98,33 @@ static inline void net_stats_update_filter_rx_local_drop(struct net_if *iface)
 #define net_stats_update_filter_rx_ipv6_drop(iface)
 #define net_stats_update_filter_rx_local_drop(iface)
 #endif /* CONFIG_NET_STATISTICS_PKT_FILTER */
+
+#if defined(CONFIG_NET_STATISTICS_PKT_QUOTA)
+static inline void net_stats_update_pkt_quota_rx_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.pkt_quota.rx.drop++);
+}
+
+static inline void net_stats_update_pkt_quota_rx_early_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.pkt_quota.rx.early_drop++);
+}
+
+static inline void net_stats_update_pkt_quota_tx_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.pkt_quota.tx.drop++);
+}
+
+static inline void net_stats_update_pkt_quota_tx_early_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.pkt_quota.tx.early_drop++);
+}
+#else /* CONFIG_NET_STATISTICS_PKT_QUOTA */
+#define net_stats_update_pkt_quota_rx_drop(iface)
+#define net_stats_update_pkt_quota_rx_early_drop(iface)
+#define net_stats_update_pkt_quota_tx_drop(iface)
+#define net_stats_update_pkt_quota_tx_early_drop(iface)
+#endif /* CONFIG_NET_STATISTICS_PKT_QUOTA */
 #else
 #define net_stats_update_processing_error(iface)
 #define net_stats_update_ip_errors_protoerr(iface)
@@ -109,6 +136,10 @@ static inline void net_stats_update_filter_rx_local_drop(struct net_if *iface)
 #define net_stats_update_filter_rx_ipv4_drop(iface)
 #define net_stats_update_filter_rx_ipv6_drop(iface)
 #define net_stats_update_filter_rx_local_drop(iface)
+#define net_stats_update_pkt_quota_rx_drop(iface)
+#define net_stats_update_pkt_quota_rx_early_drop(iface)
+#define net_stats_update_pkt_quota_tx_drop(iface)
+#define net_stats_update_pkt_quota_tx_early_drop(iface)
 #endif /* CONFIG_NET_STATISTICS */
 
 #if defined(CONFIG_NET_STATISTICS_IPV6) && defined(CONFIG_NET_NATIVE_IPV6)
@@ -13,6 +13,9 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_function.h>
 
 #include "net_private.h"
 #include "net_stats.h"
@@ -22,7 +25,8 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #define NET_TC_RX_EFFECTIVE_COUNT (NET_TC_RX_COUNT + TC_RX_PSEUDO_QUEUE)
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-#define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / NET_TC_RX_EFFECTIVE_COUNT)
+/* The packets of a traffic class are shared by its steering queues */
+#define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / NET_TC_RX_EFFECTIVE_COUNT / NET_TC_RX_QUEUES)
 BUILD_ASSERT(NET_TC_RX_SLOTS > 0,
 		"Misconfiguration: There are more traffic classes then packets, "
 		"either increase CONFIG_NET_PKT_RX_COUNT or decrease "
@@ -46,15 +50,16 @@ BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * With RX steering, ".z" is appended to y, z being the steering queue id.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[y.z]")
 
 /* Stacks for TX work queue */
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_THREAD_COUNT,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -62,7 +67,8 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+/* The RX queues of traffic class tc start at index tc * NET_TC_RX_QUEUES */
+static struct net_traffic_class rx_classes[NET_TC_RX_THREAD_COUNT];
 #endif
 
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
@@ -86,16 +92,97 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 #endif
 }
 
+#if defined(CONFIG_NET_TC_RX_STEERING)
+struct rx_flow_key {
+	uint8_t addr[2 * NET_IPV6_ADDR_SIZE];
+	uint16_t ports[2];
+	uint8_t proto;
+};
+
+/* Pick the steering queue from the addresses, protocol and ports of an
+ * Ethernet frame, so that all packets of a flow go to the same RX thread.
+ * Only the first buffer is looked at, the driver has not handed the frame
+ * to L2 yet.
+ */
+static uint8_t rx_flow_queue(struct net_pkt *pkt)
+{
+	const struct net_buf *buf = pkt->buffer;
+	struct rx_flow_key key;
+	const uint8_t *hdr;
+	size_t off = sizeof(struct net_eth_hdr);
+	size_t l4_off = 0;
+	uint16_t type;
+
+	if (buf == NULL || buf->len < off ||
+	    net_if_l2(net_pkt_iface(pkt)) != &NET_L2_GET_NAME(ETHERNET)) {
+		return 0;
+	}
+
+	hdr = buf->data;
+	type = ntohs(((const struct net_eth_hdr *)hdr)->type);
+
+	if (type == NET_ETH_PTYPE_VLAN) {
+		if (buf->len < off + sizeof(uint32_t)) {
+			return 0;
+		}
+
+		type = sys_get_be16(hdr + off + sizeof(uint16_t));
+		off += sizeof(uint32_t);
+	}
+
+	memset(&key, 0, sizeof(key));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && type == NET_ETH_PTYPE_IP) {
+		const struct net_ipv4_hdr *ip = (const struct net_ipv4_hdr *)(hdr + off);
+
+		if (buf->len < off + sizeof(*ip)) {
+			return 0;
+		}
+
+		memcpy(key.addr, ip->src, 2 * NET_IPV4_ADDR_SIZE);
+		key.proto = ip->proto;
+
+		/* Only the first fragment has the ports, leave them out for all */
+		if ((ip->offset[0] & 0x3f) == 0 && ip->offset[1] == 0) {
+			l4_off = off + (ip->vhl & 0x0f) * 4U;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && type == NET_ETH_PTYPE_IPV6) {
+		const struct net_ipv6_hdr *ip = (const struct net_ipv6_hdr *)(hdr + off);
+
+		if (buf->len < off + sizeof(*ip)) {
+			return 0;
+		}
+
+		memcpy(key.addr, ip->src, 2 * NET_IPV6_ADDR_SIZE);
+		key.proto = ip->nexthdr;
+		l4_off = off + sizeof(*ip);
+	} else {
+		return 0;
+	}
+
+	if ((key.proto == IPPROTO_TCP || key.proto == IPPROTO_UDP) && l4_off != 0 &&
+	    buf->len >= l4_off + sizeof(key.ports)) {
+		memcpy(key.ports, hdr + l4_off, sizeof(key.ports));
+	}
+
+	return sys_hash32(&key, sizeof(key)) % NET_TC_RX_QUEUES;
+}
+#else
+#define rx_flow_queue(pkt) 0
+#endif /* CONFIG_NET_TC_RX_STEERING */
+
 enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
+	struct net_traffic_class *rx_class = &rx_classes[tc * NET_TC_RX_QUEUES +
+							 rx_flow_queue(pkt)];
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	uint8_t retry_cnt = NET_TC_RETRY_CNT;
 #endif
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-	while (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
+	while (k_sem_take(&rx_class->fifo_slot, K_NO_WAIT) != 0) {
 		if (k_is_in_isr() || retry_cnt == 0) {
 			return NET_DROP;
 		}
@@ -108,7 +195,7 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 	}
 #endif
 
-	k_fifo_put(&rx_classes[tc].fifo, pkt);
+	k_fifo_put(&rx_class->fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -285,10 +372,24 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static void tc_rx_handler(void *p1, void *p2, void *p3)
+#if defined(CONFIG_NET_TCP_RX_COALESCE)
+int net_tc_rx_thread_id(void)
 {
-	ARG_UNUSED(p3);
+	k_tid_t current = k_current_get();
+
+	for (int i = 0; i < NET_TC_RX_THREAD_COUNT; i++) {
+		if (current == &rx_classes[i].handler) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+#endif /* CONFIG_NET_TCP_RX_COALESCE */
 
+static void tc_rx_handler(void *p1, void *p2, void *p3)
+{
+	int thread_id = POINTER_TO_INT(p3);
 	struct k_fifo *fifo = p1;
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	struct k_sem *fifo_slot = p2;
@@ -308,6 +409,11 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 #endif
 
 		net_process_rx_packet(pkt);
+
+		/* Hand coalesced segments to TCP once the queue runs dry */
+		if (IS_ENABLED(CONFIG_NET_TCP_RX_COALESCE) && k_fifo_is_empty(fifo)) {
+			net_tcp_coalesce_flush(thread_id);
+		}
 	}
 }
 #endif
@@ -425,12 +531,13 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_THREAD_COUNT; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		/* All the steering queues of a class share its priority */
+		thread_priority = rx_tc2thread(i / NET_TC_RX_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -460,17 +567,29 @@ void net_tc_rx_init(void)
 #else
 				      NULL,
 #endif
-				      NULL,
+				      INT_TO_POINTER(i),
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
 			continue;
 		}
 
+#if defined(CONFIG_NET_TC_RX_STEERING_CPU_PIN)
+		if (k_thread_cpu_pin(tid, (i % NET_TC_RX_QUEUES) % arch_num_cpus()) < 0) {
+			NET_ERR("Cannot pin TC handler thread %d", i);
+		}
+#endif
+
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (NET_TC_RX_QUEUES > 1) {
+				snprintk(name, sizeof(name), "rx_q[%d.%d]", i / NET_TC_RX_QUEUES,
+					 i % NET_TC_RX_QUEUES);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
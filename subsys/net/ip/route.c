@@ -94,9 +94,13 @@ static struct net_nbr *get_nexthop_route(void)
 	return NULL;
 }
 
+static void route_index_del(struct net_nbr *nbr);
+
 static void net_route_entry_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Route %p removed", nbr);
+
+	route_index_del(nbr);
 }
 
 static void net_route_entries_table_clear(struct net_nbr_table *table)
@@ -125,6 +129,129 @@ static inline struct net_route_entry *net_route_data(struct net_nbr *nbr)
 	return (struct net_route_entry *)nbr->data;
 }
 
+/*
+ * Routes are indexed by prefix length and by a hash of the prefix bits,
+ * so that a lookup probes one bucket per prefix length in use, longest
+ * first, instead of scanning the whole table. Buckets and chains hold
+ * pool indexes plus one, zero ends a chain. Protected by the neighbor lock
+ * like the rest of the table.
+ */
+#define ROUTE_HASH_SIZE CONFIG_NET_MAX_ROUTES
+
+static uint16_t route_bucket[ROUTE_HASH_SIZE];
+static uint16_t route_chain[CONFIG_NET_MAX_ROUTES];
+static uint16_t route_len_count[129];
+static uint32_t route_len_map[DIV_ROUND_UP(129, 32)];
+
+static inline int route_index(struct net_nbr *nbr)
+{
+	return CONTAINER_OF(nbr, typeof(net_route_entries_pool[0]), nbr) -
+	       net_route_entries_pool;
+}
+
+static uint32_t route_hash(const struct in6_addr *addr, uint8_t prefix_len)
+{
+	uint32_t hash = 2166136261U ^ prefix_len;
+	int i;
+
+	/* FNV-1a over the prefix bits only, host bits are masked out */
+	for (i = 0; i < DIV_ROUND_UP(prefix_len, 8); i++) {
+		uint8_t b = addr->s6_addr[i];
+
+		if (i == prefix_len / 8) {
+			b &= (uint8_t)(0xff << (8 - prefix_len % 8));
+		}
+
+		hash = (hash ^ b) * 16777619U;
+	}
+
+	return hash % ROUTE_HASH_SIZE;
+}
+
+static void route_index_add(struct net_nbr *nbr)
+{
+	struct net_route_entry *route = net_route_data(nbr);
+	uint32_t hash = route_hash(&route->addr, route->prefix_len);
+	int idx = route_index(nbr);
+
+	route_chain[idx] = route_bucket[hash];
+	route_bucket[hash] = idx + 1;
+
+	if (route_len_count[route->prefix_len]++ == 0) {
+		route_len_map[route->prefix_len / 32] |= BIT(route->prefix_len % 32);
+	}
+}
+
+static void route_index_del(struct net_nbr *nbr)
+{
+	struct net_route_entry *route = net_route_data(nbr);
+	uint16_t *link = &route_bucket[route_hash(&route->addr, route->prefix_len)];
+	int idx = route_index(nbr);
+
+	while (*link != 0 && *link != idx + 1) {
+		link = &route_chain[*link - 1];
+	}
+
+	if (*link == 0) {
+		return;
+	}
+
+	*link = route_chain[idx];
+	route_chain[idx] = 0;
+
+	if (--route_len_count[route->prefix_len] == 0) {
+		route_len_map[route->prefix_len / 32] &= ~BIT(route->prefix_len % 32);
+	}
+}
+
+static struct net_nbr *route_index_find(struct net_if *iface,
+					const struct in6_addr *addr,
+					uint8_t prefix_len)
+{
+	uint16_t next = route_bucket[route_hash(addr, prefix_len)];
+
+	while (next != 0) {
+		struct net_nbr *nbr = get_nbr(next - 1);
+		struct net_route_entry *route = net_route_data(nbr);
+
+		next = route_chain[next - 1];
+
+		if (iface && nbr->iface != iface) {
+			continue;
+		}
+
+		if (route->prefix_len == prefix_len &&
+		    net_ipv6_is_prefix(addr->s6_addr, route->addr.s6_addr,
+				       prefix_len)) {
+			return nbr;
+		}
+	}
+
+	return NULL;
+}
+
+static struct net_nbr *route_index_lookup(struct net_if *iface,
+					  const struct in6_addr *dst)
+{
+	for (int word = ARRAY_SIZE(route_len_map) - 1; word >= 0; word--) {
+		uint32_t map = route_len_map[word];
+
+		while (map != 0) {
+			uint8_t bit = find_msb_set(map) - 1;
+			struct net_nbr *nbr;
+
+			map &= ~BIT(bit);
+
+			nbr = route_index_find(iface, dst, word * 32 + bit);
+			if (nbr) {
+				return nbr;
+			}
+		}
+	}
+
+	return NULL;
+}
+
 struct net_nbr *net_route_get_nbr(struct net_route_entry *route)
 {
 	struct net_nbr *ret = NULL;
@@ -205,6 +332,8 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 	net_ipaddr_copy(&net_route_data(nbr)->addr, addr);
 	net_route_data(nbr)->prefix_len = prefix_len;
 
+	route_index_add(nbr);
+
 	NET_DBG("[%d] nbr %p iface %p IPv6 %s/%d",
 		nbr->idx, nbr, iface,
 		net_sprint_ipv6_addr(&net_route_data(nbr)->addr),
@@ -270,35 +399,15 @@ static inline void update_route_access(struct net_route_entry *route)
 struct net_route_entry *net_route_lookup(struct net_if *iface,
 					 struct in6_addr *dst)
 {
-	struct net_route_entry *route, *found = NULL;
-	uint8_t longest_match = 0U;
-	int i;
+	struct net_route_entry *found = NULL;
+	struct net_nbr *nbr;
 
 	net_ipv6_nbr_lock();
 
-	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
-		struct net_nbr *nbr = get_nbr(i);
-
-		if (!nbr->ref) {
-			continue;
-		}
-
-		if (iface && nbr->iface != iface) {
-			continue;
-		}
-
-		route = net_route_data(nbr);
+	nbr = route_index_lookup(iface, dst);
+	if (nbr) {
+		found = net_route_data(nbr);
 
-		if (route->prefix_len >= longest_match &&
-		    net_ipv6_is_prefix(dst->s6_addr,
-				       route->addr.s6_addr,
-				       route->prefix_len)) {
-			found = route;
-			longest_match = route->prefix_len;
-		}
-	}
-
-	if (found) {
 		net_route_info("Found", found, dst);
 
 		update_route_access(found);
@@ -361,11 +470,13 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 			net_sprint_ll_addr(nexthop_lladdr->addr, nexthop_lladdr->len));
 	}
 
-	route = net_route_lookup(iface, addr);
-	if (route) {
+	/* Only a route to the same prefix is replaced, not a covering one */
+	nbr = route_index_find(iface, addr, prefix_len);
+	if (nbr) {
 		/* Update nexthop if not the same */
 		struct in6_addr *nexthop_addr;
 
+		route = net_route_data(nbr);
 		nexthop_addr = net_route_get_nexthop(route);
 		if (nexthop_addr && net_ipv6_addr_cmp(nexthop, nexthop_addr)) {
 			NET_DBG("No changes, return old route %p", route);
@@ -19,6 +19,7 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
 #include <zephyr/net/udp.h>
+#include <zephyr/net/ethernet.h>
 #include "ipv4.h"
 #include "ipv6.h"
 #include "connection.h"
@@ -1472,6 +1473,11 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	}
 
 	if (data) {
+		/* Let the driver split data larger than a segment */
+		if (IS_ENABLED(CONFIG_NET_TCP_TSO) && net_pkt_get_len(data) > conn_mss(conn)) {
+			net_pkt_set_tso_mss(pkt, conn_mss(conn));
+		}
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
@@ -1660,13 +1666,35 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
+#if defined(CONFIG_NET_TCP_TSO)
+/* Largest amount of data to pass down in one packet, more than a segment
+ * only if the interface can do the segmentation and the checksums.
+ */
+static int tcp_send_max_len(struct tcp *conn)
+{
+	const enum ethernet_hw_caps tso = ETHERNET_HW_TSO | ETHERNET_HW_TX_CHKSUM_OFFLOAD;
+	int mss = conn_mss(conn);
+
+	if (conn->iface == NULL || net_if_l2(conn->iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    (net_eth_get_hw_capabilities(conn->iface) & tso) != tso) {
+		return mss;
+	}
+
+	/* Leave room for the largest IP and TCP headers we generate */
+	return MAX(mss, (int)ROUND_DOWN(CONFIG_NET_TCP_TSO_MAX_SIZE - NET_IPV6TCPH_LEN -
+					sizeof(uint32_t), mss));
+}
+#else
+#define tcp_send_max_len(_conn) conn_mss(_conn)
+#endif /* CONFIG_NET_TCP_TSO */
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_send_max_len(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1678,6 +1706,12 @@ static int tcp_send_data(struct tcp *conn)
 	}
 
 	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt && len > conn_mss(conn)) {
+		/* Not enough buffers for a large send, segment in software */
+		len = conn_mss(conn);
+		pkt = tcp_pkt_alloc(conn, len);
+	}
+
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
@@ -4037,9 +4071,9 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
-	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
-	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
-	     net_pkt_is_ip_reassembled(pkt)) &&
+	/* Coalesced segments were verified one by one before merging */
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) && !net_pkt_is_tcp_coalesced(pkt) &&
+	    net_pkt_need_rx_chksum(pkt, type) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
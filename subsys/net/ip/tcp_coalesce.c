@@ -0,0 +1,276 @@
+/** @file
+ * @brief TCP receive segment coalescing
+ *
+ * Merge consecutive in-order data segments of a TCP flow received by the
+ * same RX thread into a single packet before they are handed to IP
+ * and TCP, so the connection lookup, the ACK and the receiver wakeup are
+ * done once per batch instead of once per segment.
+ */
+
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_tcp_coalesce, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "tcp_private.h"
+
+struct coalesce_slot {
+	/* Segment being built, its headers are in the first buffer */
+	struct net_pkt *pkt;
+	/* Sequence number expected from the next segment */
+	uint32_t next_seq;
+	/* Length of the IP and TCP headers */
+	uint16_t hdr_len;
+	/* Number of segments merged into pkt */
+	uint8_t segs;
+};
+
+static struct coalesce_slot slots[NET_TC_RX_THREAD_COUNT];
+
+/* Return the IP header of a plain data carrying TCP segment, together with
+ * the IP and the total header length, or NULL if the packet is not a
+ * candidate for coalescing.
+ */
+static uint8_t *segment_parse(struct net_pkt *pkt, size_t *ip_len, size_t *hdr_len)
+{
+	struct net_buf *buf = pkt->buffer;
+	size_t len = net_pkt_get_len(pkt);
+	struct net_tcp_hdr *tcp;
+	size_t tcp_len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)buf->data;
+
+		/* No options, fragments, CE marks or link layer padding */
+		if (buf->len < sizeof(*hdr) || hdr->vhl != 0x45 ||
+		    hdr->proto != IPPROTO_TCP || (hdr->offset[0] & 0x3f) != 0 ||
+		    hdr->offset[1] != 0 || (hdr->tos & 0x03) == 0x03 ||
+		    ntohs(hdr->len) != len) {
+			return NULL;
+		}
+
+		*ip_len = sizeof(*hdr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)buf->data;
+
+		/* No extension headers, CE marks or link layer padding */
+		if (buf->len < sizeof(*hdr) || (hdr->vtc & 0xf0) != 0x60 ||
+		    hdr->nexthdr != IPPROTO_TCP || (hdr->tcflow & 0x30) == 0x30 ||
+		    ntohs(hdr->len) + sizeof(*hdr) != len) {
+			return NULL;
+		}
+
+		*ip_len = sizeof(*hdr);
+	} else {
+		return NULL;
+	}
+
+	if (buf->len < *ip_len + sizeof(*tcp)) {
+		return NULL;
+	}
+
+	tcp = (struct net_tcp_hdr *)(buf->data + *ip_len);
+	tcp_len = (tcp->offset >> 4) * 4U;
+
+	if (tcp_len < sizeof(*tcp) || buf->len < *ip_len + tcp_len ||
+	    len <= *ip_len + tcp_len || (tcp->flags & ~(ACK | PSH)) != 0 ||
+	    (tcp->flags & ACK) == 0) {
+		return NULL;
+	}
+
+	*hdr_len = *ip_len + tcp_len;
+
+	return buf->data;
+}
+
+/* The headers of a merged segment are dropped, so check them here */
+static bool segment_chksum_ok(struct net_pkt *pkt, size_t ip_len)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+
+	net_pkt_set_ip_hdr_len(pkt, ip_len);
+
+	if (net_pkt_is_rx_chksum_verified(pkt)) {
+		return true;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_opts_len(pkt, 0);
+
+		if (net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_HEADER) &&
+		    net_calc_chksum_ipv4(pkt) != 0U) {
+			return false;
+		}
+
+		return !IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) ||
+		       !net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_TCP) ||
+		       net_calc_chksum_tcp(pkt) == 0U;
+	}
+
+	net_pkt_set_ipv6_ext_len(pkt, 0);
+
+	return !IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) ||
+	       !net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV6_TCP) ||
+	       net_calc_chksum_tcp(pkt) == 0U;
+}
+
+static bool same_flow(struct coalesce_slot *slot, struct net_pkt *pkt,
+		      const uint8_t *hdr, size_t ip_len, size_t hdr_len)
+{
+	const uint8_t *held = slot->pkt->buffer->data;
+	const struct net_tcp_hdr *held_tcp = (const struct net_tcp_hdr *)(held + ip_len);
+	const struct net_tcp_hdr *tcp = (const struct net_tcp_hdr *)(hdr + ip_len);
+
+	if (net_pkt_iface(slot->pkt) != net_pkt_iface(pkt) ||
+	    net_pkt_family(slot->pkt) != net_pkt_family(pkt) || slot->hdr_len != hdr_len) {
+		return false;
+	}
+
+	if (net_pkt_family(pkt) == AF_INET) {
+		const struct net_ipv4_hdr *a = (const struct net_ipv4_hdr *)held;
+		const struct net_ipv4_hdr *b = (const struct net_ipv4_hdr *)hdr;
+
+		if (a->tos != b->tos || memcmp(a->src, b->src, 2 * NET_IPV4_ADDR_SIZE) != 0) {
+			return false;
+		}
+	} else {
+		const struct net_ipv6_hdr *a = (const struct net_ipv6_hdr *)held;
+		const struct net_ipv6_hdr *b = (const struct net_ipv6_hdr *)hdr;
+
+		if (a->vtc != b->vtc || a->tcflow != b->tcflow || a->flow != b->flow ||
+		    memcmp(a->src, b->src, 2 * NET_IPV6_ADDR_SIZE) != 0) {
+			return false;
+		}
+	}
+
+	/* Ports, acknowledgment and options must match, and the segment
+	 * must continue where the held one ends.
+	 */
+	return held_tcp->src_port == tcp->src_port && held_tcp->dst_port == tcp->dst_port &&
+	       memcmp(held_tcp->ack, tcp->ack, sizeof(tcp->ack)) == 0 &&
+	       memcmp(held_tcp->optdata, tcp->optdata, hdr_len - ip_len - sizeof(*tcp)) == 0 &&
+	       sys_get_be32(tcp->seq) == slot->next_seq;
+}
+
+static void segment_merge(struct coalesce_slot *slot, struct net_pkt *pkt, size_t ip_len)
+{
+	struct net_pkt *held = slot->pkt;
+	uint8_t *hdr = held->buffer->data;
+	struct net_tcp_hdr *held_tcp = (struct net_tcp_hdr *)(hdr + ip_len);
+	struct net_tcp_hdr *tcp = (struct net_tcp_hdr *)(pkt->buffer->data + ip_len);
+	size_t payload = net_pkt_get_len(pkt) - slot->hdr_len;
+	size_t total = net_pkt_get_len(held) + payload;
+
+	/* The latest window and push flag apply to the whole batch */
+	memcpy(held_tcp->wnd, tcp->wnd, sizeof(tcp->wnd));
+	held_tcp->flags |= tcp->flags;
+
+	if (net_pkt_family(held) == AF_INET) {
+		struct net_ipv4_hdr *ipv4 = (struct net_ipv4_hdr *)hdr;
+
+		ipv4->len = htons(total);
+		ipv4->chksum = 0U;
+		ipv4->chksum = net_calc_chksum_ipv4(held);
+	} else {
+		((struct net_ipv6_hdr *)hdr)->len = htons(total - ip_len);
+	}
+
+	net_buf_pull(pkt->buffer, slot->hdr_len);
+	if (pkt->buffer->len == 0U) {
+		pkt->buffer = net_buf_frag_del(NULL, pkt->buffer);
+	}
+
+	net_pkt_frag_add(held, pkt->buffer);
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	net_pkt_set_tcp_coalesced(held, true);
+	slot->next_seq += payload;
+	slot->segs++;
+}
+
+static void slot_flush(struct coalesce_slot *slot)
+{
+	struct net_pkt *pkt = slot->pkt;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	slot->pkt = NULL;
+
+	NET_DBG("Flushing pkt %p with %u segments", pkt, slot->segs);
+
+	net_pkt_cursor_init(pkt);
+	net_process_l3_packet(pkt);
+}
+
+enum net_verdict net_tcp_coalesce_input(struct net_pkt *pkt)
+{
+	int thread_id = net_tc_rx_thread_id();
+	struct coalesce_slot *slot;
+	size_t ip_len, hdr_len;
+	const uint8_t *hdr;
+	bool push;
+
+	/* Packets of high priority classes may be processed in the driver
+	 * context, only the RX thread owning the slot may use it.
+	 */
+	if (!net_if_flag_is_set(net_pkt_iface(pkt), NET_IF_TCP_RX_COALESCE) || thread_id < 0) {
+		return NET_CONTINUE;
+	}
+
+	slot = &slots[thread_id];
+
+	hdr = segment_parse(pkt, &ip_len, &hdr_len);
+	if (hdr == NULL || !segment_chksum_ok(pkt, ip_len)) {
+		slot_flush(slot);
+		return NET_CONTINUE;
+	}
+
+	push = (((const struct net_tcp_hdr *)(hdr + ip_len))->flags & PSH) != 0;
+
+	if (slot->pkt != NULL && same_flow(slot, pkt, hdr, ip_len, hdr_len) &&
+	    slot->segs < CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS &&
+	    net_pkt_get_len(slot->pkt) + net_pkt_get_len(pkt) - hdr_len <=
+		    CONFIG_NET_TCP_RX_COALESCE_MAX_BYTES) {
+		segment_merge(slot, pkt, ip_len);
+		if (push) {
+			slot_flush(slot);
+		}
+
+		return NET_OK;
+	}
+
+	slot_flush(slot);
+
+	if (push) {
+		return NET_CONTINUE;
+	}
+
+	slot->pkt = pkt;
+	slot->hdr_len = hdr_len;
+	slot->next_seq = sys_get_be32(((const struct net_tcp_hdr *)(hdr + ip_len))->seq) +
+			 (net_pkt_get_len(pkt) - hdr_len);
+	slot->segs = 1U;
+
+	return NET_OK;
+}
+
+void net_tcp_coalesce_flush(int thread_id)
+{
+	slot_flush(&slots[thread_id]);
+}
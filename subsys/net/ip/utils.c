@@ -559,6 +559,31 @@ static uint16_t offset_based_swap8(const uint8_t *data)
 	}
 }
 
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+/* Sum blocks of four words with the carry fed back into the sum, which
+ * takes one add per word where the 64-bit accumulator of the generic code
+ * needs two on a 32-bit core.
+ */
+static uint32_t calc_chksum_blocks(const uint32_t *p, size_t blocks)
+{
+	uint32_t sum = 0U;
+
+	while (blocks-- > 0U) {
+		__asm__("adds %[sum], %[sum], %[a]\n\t"
+			"adcs %[sum], %[sum], %[b]\n\t"
+			"adcs %[sum], %[sum], %[c]\n\t"
+			"adcs %[sum], %[sum], %[d]\n\t"
+			"adc %[sum], %[sum], #0"
+			: [sum] "+r" (sum)
+			: [a] "r" (p[0]), [b] "r" (p[1]), [c] "r" (p[2]), [d] "r" (p[3])
+			: "cc");
+		p += 4;
+	}
+
+	return sum;
+}
+#endif /* CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+
 /* Word based checksum calculation based on:
  * https://blogs.igalia.com/dpino/2018/06/14/fast-checksum-computation/
  * It’s not necessary to add octets as 16-bit words. Due to the associative property of addition,
@@ -596,6 +621,12 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 	p = (uint32_t *)data;
 
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+	i = pending / (sizeof(uint32_t) * 4);
+	sum += calc_chksum_blocks(p, i);
+	pending -= i * sizeof(uint32_t) * 4;
+	i *= 4;
+#else
 	/* Do loop unrolling for the very large data sets */
 	while (pending >= sizeof(uint32_t) * 4) {
 		uint64_t sum_a = p[i];
@@ -607,6 +638,7 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 		i += 4;
 		sum += sum_a + sum_b;
 	}
+#endif
 	while (pending >= sizeof(uint32_t)) {
 		pending -= sizeof(uint32_t);
 		sum = sum + p[i++];
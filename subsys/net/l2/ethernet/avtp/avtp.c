@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_avtp, CONFIG_NET_AVTP_LOG_LEVEL);
+
+#include <errno.h>
+#include <limits.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/ethernet_mgmt.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/avtp.h>
+#include <zephyr/drivers/ptp_clock.h>
+#include <zephyr/drivers/i2s.h>
+
+#define AVTP_ALLOC_TIMEOUT K_MSEC(10)
+
+static sys_slist_t listeners = SYS_SLIST_STATIC_INIT(&listeners);
+static K_MUTEX_DEFINE(listeners_lock);
+
+int avtp_talker_init(struct avtp_talker *talker, struct net_if *iface,
+		     const struct avtp_stream_config *cfg)
+{
+	if (iface == NULL || net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    cfg->channels > BIT_MASK(10)) {
+		return -EINVAL;
+	}
+
+	talker->iface = iface;
+	talker->cfg = *cfg;
+	talker->seq_num = 0U;
+
+	return 0;
+}
+
+static struct net_pkt *avtp_alloc(struct avtp_talker *talker, size_t len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(talker->iface, len, AF_UNSPEC, 0, AVTP_ALLOC_TIMEOUT);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	net_pkt_set_ll_proto_type(pkt, NET_ETH_PTYPE_TSN);
+	net_pkt_set_priority(pkt, talker->cfg.priority);
+
+	(void)net_linkaddr_copy(net_pkt_lladdr_src(pkt), net_if_get_link_addr(talker->iface));
+	(void)net_linkaddr_set(net_pkt_lladdr_dst(pkt), talker->cfg.dst.addr,
+			       sizeof(struct net_eth_addr));
+
+	return pkt;
+}
+
+static int avtp_send(struct avtp_talker *talker, struct net_pkt *pkt)
+{
+	/* Streams are paced by the media clock, never wait for the TX queue */
+	if (net_if_try_send_data(talker->iface, pkt, K_NO_WAIT) == NET_DROP) {
+		net_pkt_unref(pkt);
+		return -EIO;
+	}
+
+	talker->seq_num++;
+
+	return 0;
+}
+
+int avtp_aaf_send(struct avtp_talker *talker, const void *samples, size_t len,
+		  uint64_t capture_time)
+{
+	struct avtp_aaf_hdr hdr;
+	struct net_pkt *pkt;
+
+	if (len > UINT16_MAX) {
+		return -EMSGSIZE;
+	}
+
+	pkt = avtp_alloc(talker, sizeof(hdr) + len);
+	if (pkt == NULL) {
+		return -ENOMEM;
+	}
+
+	avtp_aaf_hdr_pack(&hdr, &talker->cfg, talker->seq_num,
+			  (uint32_t)(capture_time + talker->cfg.max_transit_time), len);
+
+	if (net_pkt_write(pkt, &hdr, sizeof(hdr)) < 0 || net_pkt_write(pkt, samples, len) < 0) {
+		net_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	return avtp_send(talker, pkt);
+}
+
+int avtp_crf_send(struct avtp_talker *talker, enum avtp_crf_type type, uint32_t base_freq,
+		  uint16_t interval, const uint64_t *timestamps, size_t count)
+{
+	struct avtp_crf_hdr hdr;
+	struct net_pkt *pkt;
+
+	if (count == 0U || count * sizeof(uint64_t) > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	pkt = avtp_alloc(talker, sizeof(hdr) + count * sizeof(uint64_t));
+	if (pkt == NULL) {
+		return -ENOMEM;
+	}
+
+	avtp_crf_hdr_pack(&hdr, talker->cfg.stream_id, talker->seq_num, type, base_freq,
+			  interval, count);
+
+	if (net_pkt_write(pkt, &hdr, sizeof(hdr)) < 0) {
+		goto fail;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		uint8_t ts[sizeof(uint64_t)];
+
+		sys_put_be64(timestamps[i], ts);
+
+		if (net_pkt_write(pkt, ts, sizeof(ts)) < 0) {
+			goto fail;
+		}
+	}
+
+	return avtp_send(talker, pkt);
+
+fail:
+	net_pkt_unref(pkt);
+	return -ENOBUFS;
+}
+
+int avtp_time_get(struct net_if *iface, uint64_t *time)
+{
+#if defined(CONFIG_PTP_CLOCK)
+	const struct device *clk = net_eth_get_ptp_clock(iface);
+	struct net_ptp_time tm;
+
+	if (clk == NULL || ptp_clock_get(clk, &tm) < 0) {
+		return -ENOTSUP;
+	}
+
+	*time = tm.second * NSEC_PER_SEC + tm.nanosecond;
+
+	return 0;
+#else
+	ARG_UNUSED(iface);
+	ARG_UNUSED(time);
+
+	return -ENOTSUP;
+#endif
+}
+
+int avtp_talker_reserve(struct avtp_talker *talker, int queue_id, size_t len,
+			uint32_t frames_per_sec)
+{
+	struct ethernet_req_params params = { 0 };
+	uint64_t bw = avtp_stream_bandwidth(AVTP_AAF_HDR_LEN, len, frames_per_sec);
+	int ret;
+
+	if (!(net_eth_get_hw_capabilities(talker->iface) & ETHERNET_QAV)) {
+		return -ENOTSUP;
+	}
+
+	if (bw > UINT_MAX) {
+		return -ERANGE;
+	}
+
+	params.qav_param.queue_id = queue_id;
+	params.qav_param.type = ETHERNET_QAV_PARAM_TYPE_IDLE_SLOPE;
+	params.qav_param.idle_slope = (unsigned int)bw;
+
+	ret = net_mgmt(NET_REQUEST_ETHERNET_SET_QAV_PARAM, talker->iface, &params,
+		       sizeof(params));
+	if (ret < 0) {
+		NET_DBG("Cannot set idle slope of queue %d (%d)", queue_id, ret);
+		return ret;
+	}
+
+	params.qav_param.type = ETHERNET_QAV_PARAM_TYPE_STATUS;
+	params.qav_param.enabled = true;
+
+	return net_mgmt(NET_REQUEST_ETHERNET_SET_QAV_PARAM, talker->iface, &params,
+			sizeof(params));
+}
+
+int avtp_listener_register(struct avtp_listener *listener)
+{
+	int ret = 0;
+
+	k_mutex_lock(&listeners_lock, K_FOREVER);
+
+	if (sys_slist_find(&listeners, &listener->node, NULL)) {
+		ret = -EALREADY;
+	} else {
+		listener->started = false;
+#if defined(CONFIG_NET_AVTP_I2S)
+		listener->late = 0U;
+#endif
+		sys_slist_append(&listeners, &listener->node);
+	}
+
+	k_mutex_unlock(&listeners_lock);
+
+	return ret;
+}
+
+int avtp_listener_unregister(struct avtp_listener *listener)
+{
+	int ret = 0;
+
+	k_mutex_lock(&listeners_lock, K_FOREVER);
+
+	if (!sys_slist_find_and_remove(&listeners, &listener->node)) {
+		ret = -ENOENT;
+	}
+
+	k_mutex_unlock(&listeners_lock);
+
+	return ret;
+}
+
+#if defined(CONFIG_NET_AVTP_I2S)
+/* Copy the samples straight from the packet into an I2S TX block, taking
+ * them from network to host byte order in place.
+ */
+static void avtp_i2s_write(struct avtp_listener *listener, struct net_if *iface,
+			   struct net_pkt *pkt, const struct avtp_stream_info *info)
+{
+	size_t width;
+	uint64_t now;
+	size_t size;
+	void *block;
+	int ret;
+
+	switch (info->aaf.format) {
+	case AVTP_AAF_FORMAT_INT_16BIT:
+		width = sizeof(uint16_t);
+		break;
+	case AVTP_AAF_FORMAT_INT_32BIT:
+	case AVTP_AAF_FORMAT_FLOAT_32BIT:
+		width = sizeof(uint32_t);
+		break;
+	default:
+		NET_DBG("Unsupported AAF format %u", info->aaf.format);
+		return;
+	}
+
+	if (info->tv && avtp_time_get(iface, &now) == 0 &&
+	    avtp_presentation_delta(info->presentation_time, now) < 0) {
+		listener->late++;
+		return;
+	}
+
+	ret = i2s_buf_claim(listener->i2s, I2S_DIR_TX, &block, &size);
+	if (ret < 0) {
+		NET_DBG("Cannot claim I2S block (%d)", ret);
+		return;
+	}
+
+	if (info->len > size || net_pkt_read(pkt, block, info->len) < 0) {
+		(void)i2s_buf_release(listener->i2s, I2S_DIR_TX, block, 0);
+		return;
+	}
+
+	if (width == sizeof(uint16_t)) {
+		uint16_t *s = block;
+
+		for (size_t i = 0; i < info->len / width; i++) {
+			s[i] = sys_be16_to_cpu(s[i]);
+		}
+	} else {
+		uint32_t *s = block;
+
+		for (size_t i = 0; i < info->len / width; i++) {
+			s[i] = sys_be32_to_cpu(s[i]);
+		}
+	}
+
+	ret = i2s_buf_release(listener->i2s, I2S_DIR_TX, block, info->len);
+	if (ret < 0) {
+		NET_DBG("Cannot queue I2S block (%d)", ret);
+	}
+}
+#endif /* CONFIG_NET_AVTP_I2S */
+
+static struct avtp_listener *avtp_listener_find(struct net_if *iface, uint64_t stream_id)
+{
+	struct avtp_listener *listener;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&listeners, listener, node) {
+		if (listener->stream_id == stream_id &&
+		    (listener->iface == NULL || listener->iface == iface)) {
+			return listener;
+		}
+	}
+
+	return NULL;
+}
+
+static enum net_verdict avtp_recv(struct net_if *iface, uint16_t ptype, struct net_pkt *pkt)
+{
+	union {
+		struct avtp_aaf_hdr aaf;
+		struct avtp_crf_hdr crf;
+	} hdr;
+	struct avtp_stream_info info = { 0 };
+	struct avtp_listener *listener;
+	int ret;
+
+	ARG_UNUSED(ptype);
+
+	net_pkt_cursor_init(pkt);
+
+	/* The stream ID is at the same offset in both headers */
+	if (net_pkt_read(pkt, &hdr, AVTP_CRF_HDR_LEN) < 0) {
+		return NET_DROP;
+	}
+
+	if (hdr.aaf.subtype == AVTP_SUBTYPE_AAF) {
+		if (net_pkt_read(pkt, (uint8_t *)&hdr + AVTP_CRF_HDR_LEN,
+				 AVTP_AAF_HDR_LEN - AVTP_CRF_HDR_LEN) < 0) {
+			return NET_DROP;
+		}
+
+		ret = avtp_aaf_hdr_parse(&hdr.aaf, &info);
+	} else if (hdr.crf.subtype == AVTP_SUBTYPE_CRF) {
+		ret = avtp_crf_hdr_parse(&hdr.crf, &info);
+	} else {
+		ret = -EINVAL;
+	}
+
+	if (ret < 0 || info.len > net_pkt_remaining_data(pkt)) {
+		return NET_DROP;
+	}
+
+	k_mutex_lock(&listeners_lock, K_FOREVER);
+
+	listener = avtp_listener_find(iface, sys_get_be64(hdr.aaf.stream_id));
+	if (listener == NULL) {
+		k_mutex_unlock(&listeners_lock);
+		return NET_DROP;
+	}
+
+	if (listener->started) {
+		info.lost = hdr.aaf.seq_num - listener->next_seq;
+	}
+
+	listener->started = true;
+	listener->next_seq = hdr.aaf.seq_num + 1U;
+
+	if (listener->cb != NULL) {
+		listener->cb(listener, pkt, &info);
+	}
+
+#if defined(CONFIG_NET_AVTP_I2S)
+	if (listener->i2s != NULL && info.subtype == AVTP_SUBTYPE_AAF) {
+		if (listener->cb != NULL) {
+			/* Rewind in case the callback consumed the samples */
+			net_pkt_cursor_init(pkt);
+			net_pkt_skip(pkt, AVTP_AAF_HDR_LEN);
+		}
+
+		avtp_i2s_write(listener, iface, pkt, &info);
+	}
+#endif
+
+	k_mutex_unlock(&listeners_lock);
+
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+ETH_NET_L3_REGISTER(AVTP, NET_ETH_PTYPE_TSN, avtp_recv);
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ETH_SHAPER_H__
+#define __ETH_SHAPER_H__
+
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+
+#if defined(CONFIG_NET_ETHERNET_SW_SHAPER)
+
+int ethernet_shaper_set_qav(struct net_if *iface, const struct ethernet_qav_param *param);
+int ethernet_shaper_set_qbv(struct net_if *iface, const struct ethernet_qbv_param *param);
+
+/* Wait until the packet may be sent according to the credit of its traffic
+ * class and the gate schedule. Returns -EAGAIN if the gate of the class
+ * never opens for long enough to send the packet.
+ */
+int ethernet_shaper_wait(struct ethernet_context *ctx, struct net_if *iface,
+			 struct net_pkt *pkt);
+
+#else
+
+static inline int ethernet_shaper_wait(struct ethernet_context *ctx, struct net_if *iface,
+				       struct net_pkt *pkt)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+#endif /* CONFIG_NET_ETHERNET_SW_SHAPER */
+
+#endif /* __ETH_SHAPER_H__ */
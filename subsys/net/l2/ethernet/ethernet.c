@@ -28,6 +28,7 @@ LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 #include "ipv6.h"
 #include "ipv4.h"
 #include "bridge.h"
+#include "eth_shaper.h"
 
 #define NET_BUF_TIMEOUT K_MSEC(100)
 
@@ -801,6 +802,14 @@ send:
 		(void)net_if_queue_tx(bridge, out_pkt);
 	}
 
+	if (IS_ENABLED(CONFIG_NET_ETHERNET_SW_SHAPER)) {
+		ret = ethernet_shaper_wait(ctx, iface, pkt);
+		if (ret < 0) {
+			eth_stats_update_errors_tx(iface);
+			goto arp_error;
+		}
+	}
+
 	ret = net_l2_send(api->send, net_if_get_device(iface), iface, pkt);
 	if (ret != 0) {
 		eth_stats_update_errors_tx(iface);
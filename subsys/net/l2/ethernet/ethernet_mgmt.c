@@ -13,6 +13,8 @@ LOG_MODULE_REGISTER(net_ethernet_mgmt, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/ethernet_mgmt.h>
 
+#include "eth_shaper.h"
+
 static inline bool is_hw_caps_supported(const struct device *dev,
 					enum ethernet_hw_caps caps)
 {
@@ -39,6 +41,32 @@ static int ethernet_set_config(uint64_t mgmt_request,
 		return -ENOENT;
 	}
 
+#if defined(CONFIG_NET_ETHERNET_SW_SHAPER)
+	/* Shape in software what the hardware cannot */
+	if (mgmt_request == NET_REQUEST_ETHERNET_SET_QAV_PARAM &&
+	    !is_hw_caps_supported(dev, ETHERNET_QAV)) {
+		if (!data || (len != sizeof(struct ethernet_req_params))) {
+			return -EINVAL;
+		}
+
+		return ethernet_shaper_set_qav(iface, &params->qav_param);
+	}
+
+	if (mgmt_request == NET_REQUEST_ETHERNET_SET_QBV_PARAM &&
+	    !is_hw_caps_supported(dev, ETHERNET_QBV)) {
+		if (!data || (len != sizeof(struct ethernet_req_params))) {
+			return -EINVAL;
+		}
+
+		if (params->qbv_param.state == ETHERNET_QBV_STATE_TYPE_OPER) {
+			/* Read-only parameters */
+			return -EINVAL;
+		}
+
+		return ethernet_shaper_set_qbv(iface, &params->qbv_param);
+	}
+#endif
+
 	if (!api->set_config) {
 		return -ENOTSUP;
 	}
@@ -0,0 +1,311 @@
+/** @file
+ * @brief Software Ethernet traffic shaper
+ *
+ * 802.1Qav credit based shaping and an 802.1Qbv gate schedule applied per
+ * TX traffic class in the TX threads, for drivers without hardware support.
+ */
+
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_ethernet_shaper, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/drivers/ptp_clock.h>
+
+#include "eth_shaper.h"
+
+/* Preamble, start of frame delimiter, FCS and inter frame gap bytes */
+#define FRAME_OVERHEAD (8 + 4 + 12)
+
+static uint64_t port_rate(struct net_if *iface)
+{
+	enum ethernet_hw_caps caps = net_eth_get_hw_capabilities(iface);
+
+	if (caps & ETHERNET_LINK_5000BASE) {
+		return 5000000000ULL;
+	} else if (caps & ETHERNET_LINK_2500BASE) {
+		return 2500000000ULL;
+	} else if (caps & ETHERNET_LINK_1000BASE) {
+		return 1000000000ULL;
+	} else if (caps & ETHERNET_LINK_10BASE && !(caps & ETHERNET_LINK_100BASE)) {
+		return 10000000ULL;
+	}
+
+	return 100000000ULL;
+}
+
+/* The credit follows the local clock, which gPTP never steps */
+static uint64_t local_now(void)
+{
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
+}
+
+/* The gate schedule follows the gPTP time when the interface has a PTP clock */
+static uint64_t gate_now(struct net_if *iface)
+{
+#if defined(CONFIG_PTP_CLOCK)
+	const struct device *clk = net_eth_get_ptp_clock(iface);
+	struct net_ptp_time tm;
+
+	if (clk != NULL && ptp_clock_get(clk, &tm) == 0) {
+		return tm.second * NSEC_PER_SEC + tm.nanosecond;
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+
+	return local_now();
+}
+
+int ethernet_shaper_set_qav(struct net_if *iface, const struct ethernet_qav_param *param)
+{
+	struct ethernet_context *ctx = net_if_l2_data(iface);
+	struct ethernet_shaper_cbs *cbs;
+	k_spinlock_key_t key;
+	uint64_t rate;
+	int ret = 0;
+
+	if (param->queue_id < 0 || param->queue_id >= NET_TC_TX_COUNT) {
+		return -EINVAL;
+	}
+
+	cbs = &ctx->shaper.cbs[param->queue_id];
+	rate = port_rate(iface);
+
+	key = k_spin_lock(&ctx->shaper.lock);
+
+	switch (param->type) {
+	case ETHERNET_QAV_PARAM_TYPE_STATUS:
+		if (param->enabled && cbs->idle_slope == 0U) {
+			ret = -EINVAL;
+			break;
+		}
+
+		cbs->enabled = param->enabled;
+		cbs->credit = 0;
+		cbs->last = local_now();
+		break;
+	case ETHERNET_QAV_PARAM_TYPE_IDLE_SLOPE:
+		if (param->idle_slope == 0U || param->idle_slope >= rate) {
+			ret = -EINVAL;
+			break;
+		}
+
+		cbs->idle_slope = param->idle_slope;
+		break;
+	case ETHERNET_QAV_PARAM_TYPE_DELTA_BANDWIDTH:
+		if (param->delta_bandwidth == 0U || param->delta_bandwidth >= 100U) {
+			ret = -EINVAL;
+			break;
+		}
+
+		if (rate * param->delta_bandwidth / 100U > UINT32_MAX) {
+			ret = -ERANGE;
+			break;
+		}
+
+		cbs->idle_slope = rate * param->delta_bandwidth / 100U;
+		break;
+	default:
+		ret = -ENOTSUP;
+		break;
+	}
+
+	k_spin_unlock(&ctx->shaper.lock, key);
+
+	return ret;
+}
+
+int ethernet_shaper_set_qbv(struct net_if *iface, const struct ethernet_qbv_param *param)
+{
+	struct ethernet_context *ctx = net_if_l2_data(iface);
+	struct ethernet_shaper *shaper = &ctx->shaper;
+	k_spinlock_key_t key;
+	uint8_t gates = 0U;
+	int ret = 0;
+
+	key = k_spin_lock(&shaper->lock);
+
+	switch (param->type) {
+	case ETHERNET_QBV_PARAM_TYPE_STATUS:
+		if (param->enabled && (shaper->gcl_len == 0U || shaper->cycle_time == 0U)) {
+			ret = -EINVAL;
+			break;
+		}
+
+		shaper->gates_enabled = param->enabled;
+		break;
+	case ETHERNET_QBV_PARAM_TYPE_GATE_CONTROL_LIST_LEN:
+		if (param->gate_control_list_len == 0U ||
+		    param->gate_control_list_len > CONFIG_NET_ETHERNET_SW_SHAPER_GCL_LEN) {
+			ret = -EINVAL;
+			break;
+		}
+
+		shaper->gcl_len = param->gate_control_list_len;
+		break;
+	case ETHERNET_QBV_PARAM_TYPE_GATE_CONTROL_LIST:
+		if (param->gate_control.row >= CONFIG_NET_ETHERNET_SW_SHAPER_GCL_LEN) {
+			ret = -EINVAL;
+			break;
+		}
+
+		/* Without frame preemption only plain gate states apply */
+		if (param->gate_control.operation != ETHERNET_SET_GATE_STATE) {
+			ret = -ENOTSUP;
+			break;
+		}
+
+		for (int i = 0; i < NET_TC_TX_COUNT; i++) {
+			if (param->gate_control.gate_status[i]) {
+				gates |= BIT(i);
+			}
+		}
+
+		shaper->gcl_gates[param->gate_control.row] = gates;
+		shaper->gcl_interval[param->gate_control.row] = param->gate_control.time_interval;
+		break;
+	case ETHERNET_QBV_PARAM_TYPE_TIME:
+		shaper->base_time = param->base_time.second * NSEC_PER_SEC +
+				    param->base_time.fract_nsecond;
+		shaper->cycle_time = param->cycle_time.second * NSEC_PER_SEC +
+				     param->cycle_time.nanosecond;
+		if (shaper->cycle_time == 0U) {
+			shaper->gates_enabled = false;
+		}
+		break;
+	default:
+		ret = -ENOTSUP;
+		break;
+	}
+
+	k_spin_unlock(&shaper->lock, key);
+
+	return ret;
+}
+
+/* Time to wait until the credit of the class is no longer negative. The
+ * credit is not allowed to build up while the class is idle, so a class
+ * never bursts above its idle slope.
+ */
+static int64_t cbs_delay(struct ethernet_shaper_cbs *cbs, uint64_t now)
+{
+	uint64_t elapsed;
+
+	if (!cbs->enabled) {
+		return 0;
+	}
+
+	elapsed = now - cbs->last;
+	cbs->last = now;
+
+	if (elapsed >= NSEC_PER_SEC) {
+		cbs->credit = 0;
+	} else {
+		cbs->credit = MIN(cbs->credit + (int64_t)(cbs->idle_slope * elapsed), 0);
+	}
+
+	if (cbs->credit == 0) {
+		return 0;
+	}
+
+	return DIV_ROUND_UP(-cbs->credit, cbs->idle_slope);
+}
+
+/* Time to wait until the gate of the class opens for long enough to send a
+ * frame of tx_time nanoseconds, or -1 if it never does. Entries past the end
+ * of the cycle are cut, and the last entry lasts until the end of the cycle.
+ */
+static int64_t gate_delay(struct ethernet_shaper *shaper, struct net_if *iface, int tc,
+			  uint64_t tx_time)
+{
+	uint64_t cycle = shaper->cycle_time;
+	uint64_t start = 0U, cycle_start = 0U;
+	uint64_t now, off, end;
+
+	if (!shaper->gates_enabled) {
+		return 0;
+	}
+
+	now = gate_now(iface);
+	if (now < shaper->base_time) {
+		return shaper->base_time - now;
+	}
+
+	off = (now - shaper->base_time) % cycle;
+
+	/* Look through the rest of this cycle and all of the next one */
+	for (int n = 0; n < 2 * shaper->gcl_len; n++) {
+		int i = n % shaper->gcl_len;
+
+		if (i == 0) {
+			cycle_start = n == 0 ? 0U : cycle;
+			start = cycle_start;
+		}
+
+		end = i == shaper->gcl_len - 1 ? cycle_start + cycle :
+		      MIN(start + shaper->gcl_interval[i], cycle_start + cycle);
+
+		if (end > off && (shaper->gcl_gates[i] & BIT(tc)) &&
+		    end - MAX(start, off) >= tx_time) {
+			return start > off ? start - off : 0;
+		}
+
+		start = end;
+	}
+
+	return -1;
+}
+
+int ethernet_shaper_wait(struct ethernet_context *ctx, struct net_if *iface,
+			 struct net_pkt *pkt)
+{
+	struct ethernet_shaper *shaper = &ctx->shaper;
+	int tc = net_tx_priority2tc(net_pkt_priority(pkt));
+	size_t bits = (net_pkt_get_len(pkt) + FRAME_OVERHEAD) * 8U;
+	uint64_t tx_time = (uint64_t)bits * NSEC_PER_SEC / port_rate(iface);
+	struct ethernet_shaper_cbs *cbs = &shaper->cbs[tc];
+	k_spinlock_key_t key;
+	int64_t delay;
+
+	/* Shaping may only block a thread */
+	if (k_is_in_isr()) {
+		return 0;
+	}
+
+	while (true) {
+		key = k_spin_lock(&shaper->lock);
+
+		delay = cbs_delay(cbs, local_now());
+		if (delay == 0) {
+			delay = gate_delay(shaper, iface, tc, tx_time);
+		}
+
+		if (delay == 0) {
+			/* The credit recovers at the idle slope from here on */
+			if (cbs->enabled) {
+				cbs->credit -= (int64_t)bits * NSEC_PER_SEC;
+			}
+
+			k_spin_unlock(&shaper->lock, key);
+			return 0;
+		}
+
+		k_spin_unlock(&shaper->lock, key);
+
+		if (delay < 0) {
+			NET_DBG("Gate of traffic class %d never opens for %zu bits", tc, bits);
+			return -EAGAIN;
+		}
+
+		k_sleep(K_NSEC(delay));
+	}
+}
@@ -525,6 +525,10 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 		return -EALREADY;
 	}
 
+#if defined(CONFIG_NET_CAPTURE_LOCAL)
+	net_capture_local_pkt(iface, pkt);
+#endif
+
 	k_mutex_lock(&lock, K_FOREVER);
 
 	SYS_SLIST_FOR_EACH_NODE_SAFE(&net_capture_devlist, sn, sns) {
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Local packet capture to a pcapng ring held in RAM. Each packet is written
+ * as an Enhanced Packet Block, truncated to the snap length, so that only
+ * the headers are copied by default. The oldest blocks are overwritten
+ * when the ring is full, it always holds the most recent traffic.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+#include <zephyr/sys/util.h>
+
+#define RING_SIZE ROUND_UP(CONFIG_NET_CAPTURE_LOCAL_RING_SIZE, 4)
+
+#define PCAPNG_SHB_TYPE 0x0A0D0D0AU
+#define PCAPNG_IDB_TYPE 0x00000001U
+#define PCAPNG_EPB_TYPE 0x00000006U
+#define PCAPNG_MAGIC    0x1A2B3C4DU
+
+#define PCAPNG_OPT_IF_TSRESOL 9
+
+#define LINKTYPE_ETHERNET           1
+#define LINKTYPE_RAW                101
+#define LINKTYPE_IEEE802_15_4_NOFCS 230
+
+struct pcapng_shb {
+	uint32_t type;
+	uint32_t len;
+	uint32_t magic;
+	uint16_t major;
+	uint16_t minor;
+	int64_t section_len;
+	uint32_t len_trailer;
+} __packed;
+
+struct pcapng_idb {
+	uint32_t type;
+	uint32_t len;
+	uint16_t linktype;
+	uint16_t reserved;
+	uint32_t snaplen;
+	/* if_tsresol, nanoseconds */
+	uint16_t tsresol_code;
+	uint16_t tsresol_len;
+	uint8_t tsresol[4];
+	/* opt_endofopt */
+	uint32_t end_of_opt;
+	uint32_t len_trailer;
+} __packed;
+
+struct pcapng_epb {
+	uint32_t type;
+	uint32_t len;
+	uint32_t if_id;
+	uint32_t ts_high;
+	uint32_t ts_low;
+	uint32_t cap_len;
+	uint32_t orig_len;
+} __packed;
+
+/* Block length without the packet data */
+#define EPB_OVERHEAD (sizeof(struct pcapng_epb) + sizeof(uint32_t))
+
+/*
+ * Blocks never straddle the end of the ring. When a block does not fit, the
+ * space left at the end is skipped and the ring data ends at "wrap". The
+ * skipped bytes count as used until the oldest block is at the wrap point.
+ */
+static struct {
+	struct k_spinlock lock;
+	struct net_if *iface;
+	struct pcapng_shb shb;
+	struct pcapng_idb idb;
+	size_t head;
+	size_t tail;
+	size_t wrap;
+	size_t used;
+	uint32_t packets;
+	uint32_t overwritten;
+	uint16_t snaplen;
+	bool enabled;
+	uint8_t buf[RING_SIZE] __aligned(4);
+} ring;
+
+static uint16_t iface_linktype(struct net_if *iface)
+{
+	if (IS_ENABLED(CONFIG_NET_L2_ETHERNET) &&
+	    net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return LINKTYPE_ETHERNET;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_L2_IEEE802154) &&
+	    net_if_l2(iface) == &NET_L2_GET_NAME(IEEE802154)) {
+		return LINKTYPE_IEEE802_15_4_NOFCS;
+	}
+
+	return LINKTYPE_RAW;
+}
+
+static void ring_evict(void)
+{
+	if (ring.tail == ring.wrap) {
+		ring.used -= RING_SIZE - ring.wrap;
+		ring.wrap = RING_SIZE;
+		ring.tail = 0;
+		return;
+	}
+
+	ring.used -= ((struct pcapng_epb *)&ring.buf[ring.tail])->len;
+	ring.tail += ((struct pcapng_epb *)&ring.buf[ring.tail])->len;
+	ring.overwritten++;
+
+	if (ring.tail == RING_SIZE) {
+		ring.tail = 0;
+	}
+}
+
+/* Make room for a block at the head, evicting the oldest blocks */
+static uint8_t *ring_reserve(size_t len)
+{
+	uint8_t *block;
+
+	for (;;) {
+		if (ring.used == 0) {
+			ring.head = 0;
+			ring.tail = 0;
+			ring.wrap = RING_SIZE;
+		}
+
+		if (ring.head > ring.tail || ring.used == 0) {
+			if (RING_SIZE - ring.head >= len) {
+				break;
+			}
+
+			ring.used += RING_SIZE - ring.head;
+			ring.wrap = ring.head;
+			ring.head = 0;
+		} else if (ring.tail - ring.head >= len) {
+			break;
+		} else {
+			ring_evict();
+		}
+	}
+
+	block = &ring.buf[ring.head];
+
+	ring.used += len;
+	ring.head += len;
+	if (ring.head == RING_SIZE) {
+		ring.head = 0;
+	}
+
+	return block;
+}
+
+static uint64_t pkt_timestamp_ns(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_PKT_TIMESTAMP)
+	net_time_t ts = net_pkt_timestamp_ns(pkt);
+
+	/* Hardware timestamp if the driver set one */
+	if (ts > 0) {
+		return ts;
+	}
+#else
+	ARG_UNUSED(pkt);
+#endif
+
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
+}
+
+void net_capture_local_pkt(struct net_if *iface, struct net_pkt *pkt)
+{
+	size_t orig_len = net_pkt_get_len(pkt);
+	struct pcapng_epb *epb;
+	struct net_buf *frag;
+	k_spinlock_key_t key;
+	uint64_t ts;
+	size_t cap_len;
+	size_t len;
+	uint8_t *data;
+
+	if (!ring.enabled || ring.iface != iface) {
+		return;
+	}
+
+	ts = pkt_timestamp_ns(pkt);
+
+	key = k_spin_lock(&ring.lock);
+
+	if (!ring.enabled) {
+		goto out;
+	}
+
+	cap_len = MIN(orig_len, ring.snaplen);
+	len = EPB_OVERHEAD + ROUND_UP(cap_len, 4);
+
+	epb = (struct pcapng_epb *)ring_reserve(len);
+	epb->type = PCAPNG_EPB_TYPE;
+	epb->len = len;
+	epb->if_id = 0;
+	epb->ts_high = ts >> 32;
+	epb->ts_low = (uint32_t)ts;
+	epb->cap_len = cap_len;
+	epb->orig_len = orig_len;
+
+	data = (uint8_t *)(epb + 1);
+
+	/* Copy straight from the fragments, the packet cursor is left alone */
+	for (frag = pkt->buffer; frag != NULL && cap_len > 0; frag = frag->frags) {
+		size_t n = MIN(frag->len, cap_len);
+
+		memcpy(data, frag->data, n);
+		data += n;
+		cap_len -= n;
+	}
+
+	/* Padding, then the trailing copy of the block length */
+	memset(data, 0, (uint8_t *)epb + len - sizeof(uint32_t) - data);
+	*(uint32_t *)((uint8_t *)epb + len - sizeof(uint32_t)) = len;
+
+	ring.packets++;
+
+out:
+	k_spin_unlock(&ring.lock, key);
+}
+
+int net_capture_local_enable(struct net_if *iface, uint16_t snaplen)
+{
+	k_spinlock_key_t key;
+
+	if (snaplen == 0) {
+		snaplen = CONFIG_NET_CAPTURE_LOCAL_SNAPLEN;
+	}
+
+	/* Keep at least a few packets in the ring */
+	if (iface == NULL || EPB_OVERHEAD + ROUND_UP(snaplen, 4) > RING_SIZE / 4) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&ring.lock);
+
+	if (ring.enabled) {
+		k_spin_unlock(&ring.lock, key);
+		return -EALREADY;
+	}
+
+	ring.shb = (struct pcapng_shb){
+		.type = PCAPNG_SHB_TYPE,
+		.len = sizeof(struct pcapng_shb),
+		.magic = PCAPNG_MAGIC,
+		.major = 1,
+		.minor = 0,
+		.section_len = -1,
+		.len_trailer = sizeof(struct pcapng_shb),
+	};
+
+	ring.idb = (struct pcapng_idb){
+		.type = PCAPNG_IDB_TYPE,
+		.len = sizeof(struct pcapng_idb),
+		.linktype = iface_linktype(iface),
+		.snaplen = snaplen,
+		.tsresol_code = PCAPNG_OPT_IF_TSRESOL,
+		.tsresol_len = 1,
+		.tsresol = { 9 },
+		.len_trailer = sizeof(struct pcapng_idb),
+	};
+
+	ring.iface = iface;
+	ring.snaplen = snaplen;
+	ring.used = 0;
+	ring.packets = 0;
+	ring.overwritten = 0;
+	ring.enabled = true;
+
+	k_spin_unlock(&ring.lock, key);
+
+	NET_DBG("Local capture on iface %d, snaplen %u", net_if_get_by_iface(iface), snaplen);
+
+	return 0;
+}
+
+int net_capture_local_disable(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring.lock);
+	int ret = ring.enabled ? 0 : -EALREADY;
+
+	ring.enabled = false;
+
+	k_spin_unlock(&ring.lock, key);
+
+	return ret;
+}
+
+int net_capture_local_export(net_capture_local_cb_t cb, void *user_data)
+{
+	int ret;
+
+	if (ring.enabled) {
+		return -EBUSY;
+	}
+
+	if (ring.shb.type == 0) {
+		return -ENODATA;
+	}
+
+	ret = cb(&ring.shb, sizeof(ring.shb), user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = cb(&ring.idb, sizeof(ring.idb), user_data);
+	if (ret < 0 || ring.used == 0) {
+		return ret;
+	}
+
+	if (ring.head > ring.tail) {
+		return cb(&ring.buf[ring.tail], ring.head - ring.tail, user_data);
+	}
+
+	ret = cb(&ring.buf[ring.tail], ring.wrap - ring.tail, user_data);
+	if (ret < 0 || ring.head == 0) {
+		return ret;
+	}
+
+	return cb(ring.buf, ring.head, user_data);
+}
+
+struct read_state {
+	size_t offset;
+	uint8_t *dst;
+	size_t len;
+	size_t copied;
+};
+
+static int read_cb(const void *data, size_t len, void *user_data)
+{
+	struct read_state *state = user_data;
+	size_t n;
+
+	if (state->offset >= len) {
+		state->offset -= len;
+		return 0;
+	}
+
+	n = MIN(len - state->offset, state->len - state->copied);
+	memcpy(&state->dst[state->copied], (const uint8_t *)data + state->offset, n);
+	state->copied += n;
+	state->offset = 0;
+
+	return 0;
+}
+
+ssize_t net_capture_local_read(size_t offset, void *buf, size_t len)
+{
+	struct read_state state = {
+		.offset = offset,
+		.dst = buf,
+		.len = len,
+	};
+	int ret;
+
+	ret = net_capture_local_export(read_cb, &state);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return state.copied;
+}
+
+void net_capture_local_stats_get(struct net_capture_local_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring.lock);
+
+	stats->packets = ring.packets;
+	stats->overwritten = ring.overwritten;
+	stats->size = 0;
+
+	if (ring.shb.type != 0) {
+		stats->size = sizeof(ring.shb) + sizeof(ring.idb);
+	}
+
+	if (ring.used > 0) {
+		/* Without the skipped space at the end of the ring */
+		stats->size += ring.used - (ring.head > ring.tail ? 0 : RING_SIZE - ring.wrap);
+	}
+
+	stats->enabled = ring.enabled;
+
+	k_spin_unlock(&ring.lock, key);
+}
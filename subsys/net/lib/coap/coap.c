@@ -1176,6 +1176,37 @@ bool coap_packet_is_request(const struct coap_packet *cpkt)
 	return (code != COAP_CODE_EMPTY) && !(code & ~COAP_REQUEST_MASK);
 }
 
+/* Match a resource path against the URI-Path segments of a request, the
+ * segments being consecutive options.
+ */
+static bool uri_segments_match(const char * const *path,
+			       const struct coap_option *segments,
+			       uint8_t seg_num)
+{
+	uint8_t i;
+
+	for (i = 0U; i < seg_num && path[i]; i++) {
+		size_t len = strlen(path[i]);
+
+		if (IS_ENABLED(CONFIG_COAP_URI_WILDCARD) && len == 1) {
+			if (*path[i] == '+') {
+				/* Single-level wildcard */
+				continue;
+			} else if (*path[i] == '#') {
+				/* Multi-level wildcard */
+				return true;
+			}
+		}
+
+		if (segments[i].len != len ||
+		    memcmp(segments[i].value, path[i], len) != 0) {
+			return false;
+		}
+	}
+
+	return i == seg_num && path[i] == NULL;
+}
+
 int coap_handle_request_len(struct coap_packet *cpkt,
 			    struct coap_resource *resources,
 			    size_t resources_len,
@@ -1183,16 +1214,47 @@ int coap_handle_request_len(struct coap_packet *cpkt,
 			    uint8_t opt_num,
 			    struct sockaddr *addr, socklen_t addr_len)
 {
+	struct coap_option *segments = options;
+	uint8_t seg_num = 0U;
+	bool consecutive = true;
+
 	if (!coap_packet_is_request(cpkt)) {
 		return -ENOTSUP;
 	}
 
-	/* FIXME: deal with hierarchical resources */
+	/* Options are sorted by number, so the URI-Path segments normally
+	 * follow each other. Locate them once instead of walking all the
+	 * options for every resource.
+	 */
+	for (uint8_t i = 0U; i < opt_num; i++) {
+		if (options[i].delta != COAP_OPTION_URI_PATH) {
+			continue;
+		}
+
+		if (seg_num == 0U) {
+			segments = &options[i];
+		} else if (&segments[seg_num] != &options[i]) {
+			consecutive = false;
+			break;
+		}
+
+		seg_num++;
+	}
+
+	/* The resources are still scanned in array order and the first match
+	 * wins, only comparing each path is made cheaper. No index is built
+	 * over them: the array belongs to the caller and is not sorted by
+	 * path, and wildcard segments match paths a sorted index would skip.
+	 *
+	 * FIXME: deal with hierarchical resources
+	 */
 	for (size_t i = 0; i < resources_len; i++) {
 		coap_method_t method;
 		uint8_t code;
 
-		if (!coap_uri_path_match(resources[i].path, options, opt_num)) {
+		if (consecutive ?
+		    !uri_segments_match(resources[i].path, segments, seg_num) :
+		    !coap_uri_path_match(resources[i].path, options, opt_num)) {
 			continue;
 		}
 
@@ -665,6 +665,170 @@ int coap_resource_send(const struct coap_resource *resource, const struct coap_p
 	return -ENOENT;
 }
 
+/* Largest Block2 and Size2 options, and the payload marker */
+#define BLOCK2_OVERHEAD (5U + 5U + 1U)
+
+static uint32_t block_option_value(uint32_t num, bool more, enum coap_block_size szx)
+{
+	return (num << 4) | (more ? BIT(3) : 0U) | szx;
+}
+
+/* Piggybacked response to confirmable requests, separate response otherwise */
+static int block_response_init(struct coap_packet *response, const struct coap_packet *request,
+			       uint8_t *buf, uint16_t len, uint8_t code)
+{
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+
+	if (coap_header_get_type(request) == COAP_TYPE_CON) {
+		return coap_ack_init(response, request, buf, len, code);
+	}
+
+	tkl = coap_header_get_token(request, token);
+
+	return coap_packet_init(response, buf, len, COAP_VERSION_1, COAP_TYPE_NON_CON, tkl, token,
+				code, coap_next_id());
+}
+
+int coap_resource_send_block2(const struct coap_resource *resource,
+			      const struct coap_packet *request,
+			      const struct sockaddr *addr, socklen_t addr_len,
+			      const struct coap_resource_content *content)
+{
+	uint8_t buf[CONFIG_COAP_SERVER_MESSAGE_SIZE];
+	struct coap_packet response;
+	int szx = coap_bytes_to_block_size(CONFIG_COAP_SERVER_BLOCK_SIZE);
+	uint32_t num = 0U;
+	size_t offset = 0;
+	size_t avail;
+	size_t len;
+	bool more;
+	int ret;
+
+	ret = coap_get_block2_option(request, &more, &num);
+	if (ret > 0) {
+		szx = MIN(szx, coap_bytes_to_block_size(ret));
+		offset = (size_t)num * ret;
+	}
+
+	if (offset > content->size || (offset > 0 && offset == content->size)) {
+		return COAP_RESPONSE_CODE_BAD_OPTION;
+	}
+
+	ret = block_response_init(&response, request, buf, sizeof(buf),
+				  COAP_RESPONSE_CODE_CONTENT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (content->format >= 0) {
+		ret = coap_append_option_int(&response, COAP_OPTION_CONTENT_FORMAT,
+					     content->format);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* Use a smaller block if it doesn't fit in the message, the offset is a
+	 * multiple of any smaller block size.
+	 */
+	avail = response.max_len - response.offset;
+	if (avail < BLOCK2_OVERHEAD + coap_block_size_to_bytes(COAP_BLOCK_16)) {
+		return -ENOMEM;
+	}
+
+	avail -= BLOCK2_OVERHEAD;
+	while (szx > COAP_BLOCK_16 && coap_block_size_to_bytes(szx) > avail) {
+		szx--;
+	}
+
+	num = offset / coap_block_size_to_bytes(szx);
+	len = MIN(coap_block_size_to_bytes(szx), content->size - offset);
+	more = offset + len < content->size;
+
+	ret = coap_append_option_int(&response, COAP_OPTION_BLOCK2,
+				     block_option_value(num, more, szx));
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (num == 0U) {
+		ret = coap_append_option_int(&response, COAP_OPTION_SIZE2, content->size);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	if (len > 0) {
+		ret = coap_packet_append_payload_marker(&response);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* Read the block straight into the response */
+		ret = content->read(offset, response.data + response.offset, len,
+				    content->user_data);
+		if (ret < 0) {
+			LOG_ERR("Failed to read block %u (%d)", num, ret);
+			return COAP_RESPONSE_CODE_INTERNAL_ERROR;
+		}
+
+		response.offset += len;
+	}
+
+	return coap_resource_send(resource, &response, addr, addr_len, NULL);
+}
+
+int coap_resource_recv_block1(const struct coap_resource *resource,
+			      const struct coap_packet *request,
+			      const struct sockaddr *addr, socklen_t addr_len,
+			      coap_resource_write_t write, void *user_data)
+{
+	/* Header, token and Block1 option */
+	uint8_t buf[4U + COAP_TOKEN_MAX_LEN + 5U];
+	struct coap_packet response;
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint32_t num = 0U;
+	bool more = false;
+	int size;
+	int ret;
+
+	payload = coap_packet_get_payload(request, &payload_len);
+
+	size = coap_get_block1_option(request, &more, &num);
+	if (size < 0) {
+		/* The whole content in a single message */
+		ret = write(0, payload, payload_len, true, user_data);
+
+		return ret < 0 ? COAP_RESPONSE_CODE_INTERNAL_ERROR : COAP_RESPONSE_CODE_CHANGED;
+	}
+
+	if (more && payload_len != size) {
+		return COAP_RESPONSE_CODE_INCOMPLETE;
+	}
+
+	ret = write((size_t)num * size, payload, payload_len, !more, user_data);
+	if (ret < 0) {
+		LOG_ERR("Failed to write block %u (%d)", num, ret);
+		return COAP_RESPONSE_CODE_INTERNAL_ERROR;
+	}
+
+	ret = block_response_init(&response, request, buf, sizeof(buf),
+				  more ? COAP_RESPONSE_CODE_CONTINUE : COAP_RESPONSE_CODE_CHANGED);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = coap_append_option_int(&response, COAP_OPTION_BLOCK1,
+				     block_option_value(num, more, coap_bytes_to_block_size(size)));
+	if (ret < 0) {
+		return ret;
+	}
+
+	return coap_resource_send(resource, &response, addr, addr_len, NULL);
+}
+
 int coap_resource_parse_observe(struct coap_resource *resource, const struct coap_packet *request,
 				const struct sockaddr *addr)
 {
@@ -6,12 +6,36 @@
 
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/sys/crc.h>
 #include "dns_cache.h"
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
+static uint32_t dns_cache_hash(const char *query)
+{
+	return crc32_ieee((const uint8_t *)query, strlen(query));
+}
+
+static bool dns_cache_match(const struct dns_cache_entry *entry, uint32_t hash, const char *query)
+{
+	return entry->in_use && entry->hash == hash && strcmp(entry->query, query) == 0;
+}
+
+static int dns_cache_family(enum dns_query_type type, sa_family_t *family)
+{
+	if (type == DNS_QUERY_TYPE_A) {
+		*family = AF_INET;
+	} else if (type == DNS_QUERY_TYPE_AAAA) {
+		*family = AF_INET6;
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
@@ -23,12 +47,13 @@ int dns_cache_flush(struct dns_cache *cache)
 	return 0;
 }
 
-int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
-		  uint32_t ttl)
+static int dns_cache_store(struct dns_cache *cache, char const *query,
+			   struct dns_addrinfo const *addrinfo, uint32_t ttl, bool negative)
 {
 	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
 	size_t index_to_replace = 0;
 	bool found_empty = false;
+	struct dns_cache_entry *entry;
 
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
@@ -43,7 +68,7 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 	k_mutex_lock(cache->lock, K_FOREVER);
 
-	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
+	NET_DBG("Add %s\"%s\" with TTL %" PRIu32, negative ? "negative " : "", query, ttl);
 
 	dns_cache_clean(cache);
 
@@ -58,23 +83,56 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 		}
 	}
 
+	entry = &cache->entries[index_to_replace];
+
 	if (!found_empty) {
-		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+		NET_DBG("Overwrite \"%s\"", entry->query);
+		cache->stats.evictions++;
 	}
 
-	strncpy(cache->entries[index_to_replace].query, query,
-		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
-	cache->entries[index_to_replace].data = *addrinfo;
-	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
-	cache->entries[index_to_replace].in_use = true;
+	strncpy(entry->query, query, CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	entry->hash = dns_cache_hash(query);
+	entry->data = *addrinfo;
+	entry->expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	entry->negative = negative;
+	entry->prefetch_started = false;
+	if (CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT > 0 && !negative) {
+		entry->prefetch = sys_timepoint_calc(
+			K_MSEC((uint64_t)ttl * MSEC_PER_SEC *
+			       (100 - CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT) / 100));
+	} else {
+		entry->prefetch = sys_timepoint_calc(K_FOREVER);
+	}
+	entry->in_use = true;
 
 	k_mutex_unlock(cache->lock);
 
 	return 0;
 }
 
-int dns_cache_remove(struct dns_cache *cache, char const *query)
+int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
+		  uint32_t ttl)
 {
+	return dns_cache_store(cache, query, addrinfo, ttl, false);
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl)
+{
+	struct dns_addrinfo info = {0};
+
+	if (dns_cache_family(type, &info.ai_family) < 0) {
+		return -EINVAL;
+	}
+
+	return dns_cache_store(cache, query, &info, ttl, true);
+}
+
+static int dns_cache_remove_family(struct dns_cache *cache, char const *query,
+				   sa_family_t family)
+{
+	uint32_t hash;
+
 	if (cache == NULL || query == NULL) {
 		return -EINVAL;
 	}
@@ -87,14 +145,20 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (cache->entries[i].in_use && strcmp(cache->entries[i].query, query) == 0) {
-			cache->entries[i].in_use = false;
+		if (!dns_cache_match(&cache->entries[i], hash, query)) {
+			continue;
+		}
+		if (family != AF_UNSPEC && cache->entries[i].data.ai_family != family) {
+			continue;
 		}
+		cache->entries[i].in_use = false;
 	}
 
 	k_mutex_unlock(cache->lock);
@@ -102,21 +166,35 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 	return 0;
 }
 
-int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
+int dns_cache_remove(struct dns_cache *cache, char const *query)
+{
+	return dns_cache_remove_family(cache, query, AF_UNSPEC);
+}
+
+int dns_cache_remove_type(struct dns_cache *cache, char const *query, enum dns_query_type type)
+{
+	sa_family_t family;
+
+	if (dns_cache_family(type, &family) < 0) {
+		return -EINVAL;
+	}
+
+	return dns_cache_remove_family(cache, query, family);
+}
+
+int dns_cache_find(struct dns_cache *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	bool negative = false;
 	sa_family_t family;
+	uint32_t hash;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
 		return -EINVAL;
 	}
-	if (type == DNS_QUERY_TYPE_A) {
-		family = AF_INET;
-	} else if (type == DNS_QUERY_TYPE_AAAA) {
-		family = AF_INET6;
-	} else {
+	if (dns_cache_family(type, &family) < 0) {
 		return -EINVAL;
 	}
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
@@ -126,18 +204,21 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
+		if (!dns_cache_match(&cache->entries[i], hash, query)) {
 			continue;
 		}
-		if (strcmp(cache->entries[i].query, query) != 0) {
+		if (cache->entries[i].data.ai_family != family) {
 			continue;
 		}
-		if (cache->entries[i].data.ai_family != family) {
+		if (cache->entries[i].negative) {
+			negative = true;
 			continue;
 		}
 		if (found >= addrinfo_array_len) {
@@ -150,6 +231,14 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		}
 	}
 
+	if (found > 0) {
+		cache->stats.hits++;
+	} else if (negative) {
+		cache->stats.negative_hits++;
+	} else {
+		cache->stats.misses++;
+	}
+
 	k_mutex_unlock(cache->lock);
 
 	if (found > addrinfo_array_len) {
@@ -157,11 +246,73 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 	}
 
 	if (found == 0) {
+		if (negative) {
+			NET_DBG("\"%s\" is cached as not existing", query);
+			return -ENOENT;
+		}
 		NET_DBG("Could not find \"%s\"", query);
 	}
 	return found;
 }
 
+bool dns_cache_prefetch_due(struct dns_cache *cache, const char *query, enum dns_query_type type)
+{
+	bool due = false;
+	sa_family_t family;
+	uint32_t hash;
+
+	if (cache == NULL || query == NULL || dns_cache_family(type, &family) < 0) {
+		return false;
+	}
+
+	hash = dns_cache_hash(query);
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	for (size_t i = 0; i < cache->size; i++) {
+		struct dns_cache_entry *entry = &cache->entries[i];
+
+		if (!dns_cache_match(entry, hash, query) || entry->data.ai_family != family ||
+		    entry->negative) {
+			continue;
+		}
+
+		if (entry->prefetch_started) {
+			due = false;
+			break;
+		}
+
+		if (sys_timepoint_expired(entry->prefetch)) {
+			due = true;
+		}
+	}
+
+	if (due) {
+		for (size_t i = 0; i < cache->size; i++) {
+			struct dns_cache_entry *entry = &cache->entries[i];
+
+			if (dns_cache_match(entry, hash, query) &&
+			    entry->data.ai_family == family) {
+				entry->prefetch_started = true;
+			}
+		}
+
+		cache->stats.prefetches++;
+		NET_DBG("Prefetch \"%s\"", query);
+	}
+
+	k_mutex_unlock(cache->lock);
+
+	return due;
+}
+
+void dns_cache_stats_get(struct dns_cache *cache, struct dns_resolve_cache_stats *stats)
+{
+	k_mutex_lock(cache->lock, K_FOREVER);
+	*stats = cache->stats;
+	k_mutex_unlock(cache->lock);
+}
+
 /* Needs to be called when lock is already acquired */
 static void dns_cache_clean(struct dns_cache const *cache)
 {
@@ -22,13 +22,21 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	/* Point after which a hit should trigger a refresh of the entry */
+	k_timepoint_t prefetch;
+	/* Hash of the query, compared before the query string itself */
+	uint32_t hash;
 	bool in_use;
+	/* The name does not exist, only data.ai_family is valid */
+	bool negative;
+	bool prefetch_started;
 };
 
 struct dns_cache {
 	size_t size;
 	struct dns_cache_entry *entries;
 	struct k_mutex *lock;
+	struct dns_resolve_cache_stats stats;
 };
 
 /**
@@ -71,6 +79,21 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Adds a negative entry recording that the queried name does not
+ * exist (RFC 2308), so that repeated lookups are not sent to the network.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which should be persisted in the cache.
+ * @param type Query type the negative answer was received for.
+ * @param ttl Time to live for the entry in seconds, usually the minimum of the
+ * TTL and the MINIMUM field of the SOA record of the negative response.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, enum dns_query_type type,
+			   uint32_t ttl);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -81,6 +104,17 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
  */
 int dns_cache_remove(struct dns_cache *cache, char const *query);
 
+/**
+ * @brief Removes the entries with the given query and query type
+ *
+ * @param cache Cache where the entries should be removed.
+ * @param query Query which should be searched for.
+ * @param type Query type of the entries to remove.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_remove_type(struct dns_cache *cache, char const *query, enum dns_query_type type);
+
 /**
  * @brief Tries to find the specified query entry within the cache.
  *
@@ -94,8 +128,31 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
  * @retval On error a negative value is returned.
  * -ENOSR means there was not enough space in the addrinfo array to accommodate all cache hits the
  * array will however be filled with valid data.
+ * -ENOENT means the query is cached as not existing.
  */
-int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
+int dns_cache_find(struct dns_cache *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len);
 
+/**
+ * @brief Checks whether the cached entries of a query are close enough to
+ * expiry to be refreshed.
+ *
+ * Returns true at most once per cached answer, the caller is expected to send
+ * the query again and add the new answer to the cache.
+ *
+ * @param cache Cache where the entry should be searched.
+ * @param query Query which should be searched for.
+ * @param type Query type of the entries.
+ * @retval true if the query should be sent again.
+ */
+bool dns_cache_prefetch_due(struct dns_cache *cache, const char *query, enum dns_query_type type);
+
+/**
+ * @brief Copies the cache statistics.
+ *
+ * @param cache Cache to get the statistics of.
+ * @param stats Statistics are copied here.
+ */
+void dns_cache_stats_get(struct dns_cache *cache, struct dns_resolve_cache_stats *stats);
+
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
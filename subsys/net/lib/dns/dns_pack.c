@@ -183,6 +183,53 @@ int dns_unpack_answer(struct dns_msg_t *dns_msg, int dname_ptr, uint32_t *ttl,
 	return 0;
 }
 
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl)
+{
+	int count = dns_header_ancount(dns_msg->msg) + dns_header_nscount(dns_msg->msg);
+	int offset = dns_msg->answer_offset;
+
+	for (int i = 0; i < count; i++) {
+		uint8_t *rr = dns_msg->msg + offset;
+		uint16_t rdlength;
+		int dname_len;
+
+		dname_len = skip_fqdn(rr, dns_msg->msg_size - offset);
+		if (dname_len < 0) {
+			return dname_len;
+		}
+
+		if (dns_msg->msg_size - offset - dname_len <
+		    DNS_COMMON_UINT_SIZE + DNS_COMMON_UINT_SIZE + DNS_TTL_LEN + DNS_RDLENGTH_LEN) {
+			return -EINVAL;
+		}
+
+		rdlength = dns_answer_rdlength(dname_len, rr);
+		offset += dname_len + DNS_COMMON_UINT_SIZE + DNS_COMMON_UINT_SIZE +
+			  DNS_TTL_LEN + DNS_RDLENGTH_LEN;
+		if (offset + rdlength > dns_msg->msg_size) {
+			return -EINVAL;
+		}
+
+		if (dns_answer_type(dname_len, rr) == DNS_RR_TYPE_SOA) {
+			uint32_t minimum;
+
+			/* MINIMUM is the last field of the SOA RDATA */
+			if (rdlength < sizeof(minimum)) {
+				return -EINVAL;
+			}
+
+			minimum = ntohl(UNALIGNED_GET((uint32_t *)(dns_msg->msg + offset + rdlength -
+								   sizeof(minimum))));
+			*ttl = MIN((uint32_t)dns_answer_ttl(dname_len, rr), minimum);
+			return 0;
+		}
+
+		offset += rdlength;
+	}
+
+	return -ENOENT;
+}
+
 int dns_unpack_response_header(struct dns_msg_t *msg, int src_id)
 {
 	uint8_t *dns_header;
@@ -89,6 +89,7 @@ enum dns_rr_type {
 	DNS_RR_TYPE_INVALID = 0,
 	DNS_RR_TYPE_A	= 1,		/* IPv4  */
 	DNS_RR_TYPE_CNAME = 5,		/* CNAME */
+	DNS_RR_TYPE_SOA = 6,		/* SOA   */
 	DNS_RR_TYPE_PTR = 12,		/* PTR   */
 	DNS_RR_TYPE_TXT = 16,		/* TXT   */
 	DNS_RR_TYPE_AAAA = 28,		/* IPv6  */
@@ -350,6 +351,21 @@ int dns_msg_pack_qname(uint16_t *len, uint8_t *buf, uint16_t size,
 int dns_unpack_answer(struct dns_msg_t *dns_msg, int dname_ptr, uint32_t *ttl,
 		      enum dns_rr_type *type);
 
+/**
+ * @brief Finds the negative caching TTL of a response without answers
+ *
+ * @details RFC 2308, 5. The TTL is the minimum of the TTL of the SOA record
+ *          in the authority section and of its MINIMUM field.
+ *
+ * @param dns_msg Structure containing the message, the answer_offset field
+ *        must point after the question.
+ * @param ttl Negative caching TTL.
+ * @retval 0 on success
+ * @retval -ENOENT if the response has no SOA record, it must not be cached.
+ * @retval -EINVAL if the message is malformed.
+ */
+int dns_unpack_negative_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl);
+
 /**
  * @brief Unpacks the header's response.
  *
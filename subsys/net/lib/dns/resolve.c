@@ -1042,6 +1042,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 	int answer_ptr;
 	int items;
 	int server_idx;
+	int rcode = DNS_HEADER_NOERROR;
 	int ret = 0;
 
 	/* Make sure that we can read DNS id, flags and rcode */
@@ -1078,6 +1079,8 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		goto quit;
 	}
 
+	rcode = ret;
+
 	if (dns_header_qdcount(dns_msg->msg) != 1) {
 		/* For mDNS (when dns_id == 0) the query count is 0 */
 		if (*dns_id > 0) {
@@ -1309,6 +1312,13 @@ rr_qtype_aaaa:
 			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
 					      &ctx->queries[*query_idx]);
 #ifdef CONFIG_DNS_RESOLVER_CACHE
+			if (items == 0) {
+				/* A fresh answer replaces what was cached for the query */
+				(void)dns_cache_remove_type(&dns_cache,
+							    ctx->queries[*query_idx].query,
+							    ctx->queries[*query_idx].query_type);
+			}
+
 			dns_cache_add(&dns_cache,
 				ctx->queries[*query_idx].query, &info, ttl);
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
@@ -1381,6 +1391,15 @@ rr_qtype_aaaa:
 
 	if (items == 0) {
 		ret = DNS_EAI_NODATA;
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+		if (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL_MAX > 0 &&
+		    rcode == DNS_HEADER_NAMEERROR && *dns_id > 0 &&
+		    dns_unpack_negative_ttl(dns_msg, &ttl) == 0) {
+			dns_cache_add_negative(&dns_cache, ctx->queries[*query_idx].query,
+					       ctx->queries[*query_idx].query_type,
+					       MIN(ttl, CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL_MAX));
+		}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
 	} else {
 		ret = DNS_EAI_ALLDONE;
 	}
@@ -1725,6 +1744,19 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+#define DNS_PREFETCH_TIMEOUT_MS (5 * MSEC_PER_SEC)
+
+static void dns_prefetch_cb(enum dns_resolve_status status, struct dns_addrinfo *info,
+			    void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	NET_DBG("Prefetch done (%d)", status);
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 int dns_resolve_name_internal(struct dns_resolve_context *ctx,
 			      const char *query,
 			      enum dns_query_type type,
@@ -1820,6 +1852,25 @@ try_resolve:
 
 			cb(DNS_EAI_ALLDONE, NULL, user_data);
 
+			/* Refresh a hot entry in the background before it expires, the
+			 * answer goes to the cache through the normal path. Nobody can
+			 * cancel the prefetch, so it must not wait forever.
+			 */
+			if (dns_cache_prefetch_due(&dns_cache, query, type)) {
+				(void)dns_resolve_name_internal(ctx, query, type, NULL,
+								dns_prefetch_cb, NULL,
+								timeout == SYS_FOREVER_MS ?
+								DNS_PREFETCH_TIMEOUT_MS : timeout,
+								false);
+			}
+
+			return 0;
+		}
+
+		if (ret == -ENOENT) {
+			/* The name is known not to exist */
+			cb(DNS_EAI_NODATA, NULL, user_data);
+
 			return 0;
 		}
 	}
@@ -1984,6 +2035,23 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 					 user_data, timeout, true);
 }
 
+int dns_resolve_cache_stats_get(struct dns_resolve_cache_stats *stats)
+{
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+
+	dns_cache_stats_get(&dns_cache, stats);
+
+	return 0;
+#else
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+}
+
 static int dns_server_close(struct dns_resolve_context *ctx,
 			    int server_idx)
 {
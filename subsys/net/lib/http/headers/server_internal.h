@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2023, Emna Rekik
  * Copyright (c) 2023 Nordic Semiconductor ASA
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -35,6 +36,7 @@ void http_server_release_client(struct http_client_ctx *client);
 int enter_http1_request(struct http_client_ctx *client);
 int enter_http2_request(struct http_client_ctx *client);
 int enter_http_done_state(struct http_client_ctx *client);
+int http2_send_pending_data(struct http_client_ctx *client);
 
 /* HTTP Compression handling */
 #define HTTP_COMPRESSION_MAX_STRING_LEN 8
@@ -44,10 +46,42 @@ const char *http_compression_text(enum http_compression compression);
 int http_compression_from_text(enum http_compression *compression, const char *text);
 bool compression_value_is_valid(enum http_compression compression);
 
+/* Static resource handling */
+struct http_static_response {
+	/** Content to send, the resource itself or one of its variants. */
+	const void *data;
+	/** Length of the content. */
+	size_t len;
+	/** Content encoding of the content, or NULL. */
+	const char *content_encoding;
+	/** Quoted entity tag of the content, empty if none. */
+	char etag[HTTP_SERVER_MAX_HEADER_LEN];
+	/** The content depends on the Accept-Encoding header. */
+	bool vary;
+	/** The client's copy is up to date, 304 Not Modified should be sent. */
+	bool not_modified;
+};
+
+void http_server_static_response(struct http_client_ctx *client,
+				 const struct http_resource_detail_static *detail,
+				 struct http_static_response *rsp);
+
+#if defined(CONFIG_FILE_SYSTEM)
+#define HTTP_SERVER_FS_TX_BUF_SIZE CONFIG_HTTP_SERVER_STATIC_FS_TX_BUF_SIZE
+
+/* Bounce buffer for the static filesystem resources, one per thread handling the requests. */
+uint8_t *http_server_fs_tx_buf_get(struct http_client_ctx *client);
+#endif
+
+/* Claim a dynamic resource for the client, false if another client holds it. */
+bool http_server_dynamic_claim(struct http_resource_detail_dynamic *detail,
+			       struct http_client_ctx *client);
+
 /* Others */
 struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
 						 const char *path, int *len, bool is_ws);
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len);
+int http_server_sendmsg_all(struct http_client_ctx *client, struct iovec *iov, size_t iovlen);
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
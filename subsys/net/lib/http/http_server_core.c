@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2023, Emna Rekik
  * Copyright (c) 2024 Nordic Semiconductor ASA
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -41,12 +42,25 @@ LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 
 #define HTTP_SERVER_MAX_SERVICES CONFIG_HTTP_SERVER_NUM_SERVICES
 #define HTTP_SERVER_MAX_CLIENTS  CONFIG_HTTP_SERVER_MAX_CLIENTS
-#define HTTP_SERVER_SOCK_COUNT (1 + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_MAX_CLIENTS)
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+#define HTTP_SERVER_NUM_WORKERS CONFIG_HTTP_SERVER_WORKER_COUNT
+/* Second eventfd, signalled by the workers when they are done with a client */
+#define HTTP_SERVER_EVENT_FDS 2
+#define WORKER_EVENT_FD 1
+/* Placeholder of a client socket that must not be polled, the worker owns it */
+#define WORKER_SOCK -2
+#else
+#define HTTP_SERVER_EVENT_FDS 1
+#endif
+
+#define HTTP_SERVER_SOCK_COUNT \
+	(HTTP_SERVER_EVENT_FDS + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_MAX_CLIENTS)
 
 struct http_server_ctx {
-	int listen_fds; /* max value of 1 + MAX_SERVICES */
+	int listen_fds; /* max value of EVENT_FDS + MAX_SERVICES */
 
 	/* First pollfd is eventfd that can be used to stop the server,
+	 * then the worker eventfd if the worker pool is enabled,
 	 * then we have the server listen sockets,
 	 * and then the accepted sockets.
 	 */
@@ -57,6 +71,30 @@ struct http_server_ctx {
 static struct http_server_ctx server_ctx;
 static K_SEM_DEFINE(server_start, 0, 1);
 static bool server_running;
+static struct k_spinlock holder_lock;
+
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+enum http_server_worker_state {
+	WORKER_IDLE,
+	WORKER_BUSY,
+	WORKER_DONE,
+};
+
+struct http_server_worker {
+	struct k_thread thread;
+	struct k_msgq queue;
+	struct http_client_ctx *queue_buf[HTTP_SERVER_MAX_CLIENTS];
+	atomic_t dispatched;
+	atomic_t max_queued;
+#if defined(CONFIG_FILE_SYSTEM)
+	uint8_t fs_tx_buf[CONFIG_HTTP_SERVER_STATIC_FS_TX_BUF_SIZE];
+#endif
+};
+
+static struct http_server_worker workers[HTTP_SERVER_NUM_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, HTTP_SERVER_NUM_WORKERS,
+				   CONFIG_HTTP_SERVER_WORKER_STACK_SIZE);
+#endif
 
 #if defined(CONFIG_HTTP_SERVER_TLS_USE_ALPN)
 static const char *const alpn_list[] = {"h2", "http/1.1"};
@@ -109,6 +147,20 @@ int http_server_init(struct http_server_ctx *ctx)
 	ctx->fds[count].events = ZSOCK_POLLIN;
 	count++;
 
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+	fd = eventfd(0, 0);
+	if (fd < 0) {
+		fd = -errno;
+		LOG_ERR("eventfd failed (%d)", fd);
+		zsock_close(ctx->fds[0].fd);
+		return fd;
+	}
+
+	ctx->fds[count].fd = fd;
+	ctx->fds[count].events = ZSOCK_POLLIN;
+	count++;
+#endif
+
 	HTTP_SERVICE_FOREACH(svc) {
 		/* set the default address (in6addr_any / INADDR_ANY are all 0) */
 		memset(&addr_storage, 0, sizeof(struct sockaddr_storage));
@@ -248,6 +300,9 @@ int http_server_init(struct http_server_ctx *ctx)
 		LOG_ERR("All services failed (%d)", failed);
 		/* Close eventfd socket */
 		zsock_close(ctx->fds[0].fd);
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+		zsock_close(ctx->fds[WORKER_EVENT_FD].fd);
+#endif
 		return -ESRCH;
 	}
 
@@ -345,6 +400,21 @@ static void client_release_resources(struct http_client_ctx *client)
 	}
 }
 
+bool http_server_dynamic_claim(struct http_resource_detail_dynamic *detail,
+			       struct http_client_ctx *client)
+{
+	bool claimed = false;
+
+	K_SPINLOCK(&holder_lock) {
+		if (detail->holder == NULL || detail->holder == client) {
+			detail->holder = client;
+			claimed = true;
+		}
+	}
+
+	return claimed;
+}
+
 void http_server_release_client(struct http_client_ctx *client)
 {
 	int i;
@@ -352,6 +422,18 @@ void http_server_release_client(struct http_client_ctx *client)
 
 	__ASSERT_NO_MSG(IS_ARRAY_ELEMENT(server_ctx.clients, client));
 
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+	if (atomic_get(&client->worker_state) == WORKER_BUSY) {
+		/* Called from the worker, the server thread releases the
+		 * client once the worker is done with it. Nothing is left
+		 * to parse for a released client.
+		 */
+		client->release_requested = true;
+		client->data_len = 0;
+		return;
+	}
+#endif
+
 	k_work_cancel_delayable_sync(&client->inactivity_timer, &sync);
 	client_release_resources(client);
 
@@ -378,6 +460,16 @@ static void close_client_connection(struct http_client_ctx *client)
 {
 	int fd = client->fd;
 
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+	if (atomic_get(&client->worker_state) == WORKER_BUSY) {
+		/* Called from the worker, the server thread closes the
+		 * connection once the worker is done with it.
+		 */
+		client->close_requested = true;
+		return;
+	}
+#endif
+
 	http_server_release_client(client);
 
 	(void)zsock_close(fd);
@@ -425,6 +517,10 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 	client->has_upgrade_header = false;
 	client->preface_sent = false;
 	client->window_size = HTTP_SERVER_INITIAL_WINDOW_SIZE;
+	client->tx_window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+	client->tx_initial_window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+	client->tx_max_frame_size = HTTP2_DEFAULT_MAX_FRAME_SIZE;
+	client->tx_next_stream = 0;
 
 	memset(client->buffer, 0, sizeof(client->buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
@@ -434,6 +530,7 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 	ARRAY_FOR_EACH(client->streams, i) {
 		client->streams[i].stream_state = HTTP2_STREAM_IDLE;
 		client->streams[i].stream_id = 0;
+		client->streams[i].tx_pending = false;
 	}
 
 	client->current_stream = NULL;
@@ -536,6 +633,14 @@ static int handle_http_request(struct http_client_ctx *client)
 		return ret;
 	}
 
+	/* Responses queued while processing the received frames are sent
+	 * together, interleaved between their streams.
+	 */
+	ret = http2_send_pending_data(client);
+	if (ret < 0) {
+		return ret;
+	}
+
 	if (client->data_len > 0) {
 		/* Move any remaining data in the buffer. */
 		memmove(client->buffer, client->cursor, client->data_len);
@@ -544,6 +649,147 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+static void handle_http_request_result(struct http_client_ctx *client, int ret)
+{
+	if (ret < 0 && ret != -EAGAIN) {
+		if (ret == -ENOTCONN) {
+			LOG_DBG("Client closed connection while handling request");
+		} else {
+			LOG_ERR("HTTP request handling error (%d)", ret);
+		}
+		close_client_connection(client);
+	} else if (client->data_len == sizeof(client->buffer)) {
+		/* If the RX buffer is still full after parsing,
+		 * it means we won't be able to handle this request
+		 * with the current buffer size.
+		 */
+		LOG_ERR("RX buffer too small to handle request");
+		close_client_connection(client);
+	}
+}
+
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+static void worker_thread(void *p1, void *p2, void *p3)
+{
+	struct http_server_worker *worker = p1;
+	struct http_client_ctx *client;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&worker->queue, &client, K_FOREVER);
+
+		client->worker_ret = handle_http_request(client);
+
+		atomic_set(&client->worker_state, WORKER_DONE);
+		eventfd_write(server_ctx.fds[WORKER_EVENT_FD].fd, 1);
+	}
+}
+
+static void workers_start(void)
+{
+	ARRAY_FOR_EACH(workers, i) {
+		struct http_server_worker *worker = &workers[i];
+
+		k_msgq_init(&worker->queue, (char *)worker->queue_buf,
+			    sizeof(worker->queue_buf[0]), ARRAY_SIZE(worker->queue_buf));
+		k_thread_create(&worker->thread, worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]), worker_thread, worker,
+				NULL, NULL, THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker->thread, "http_server_worker");
+	}
+}
+
+/* Hand the received data of a client over to its worker. The client is
+ * not polled until the worker is done, so that a connection is only ever
+ * handled by one thread and its requests are processed in order.
+ */
+static void worker_dispatch(struct http_server_ctx *ctx, int idx)
+{
+	struct http_client_ctx *client = &ctx->clients[idx - ctx->listen_fds];
+	struct http_server_worker *worker =
+		&workers[(idx - ctx->listen_fds) % HTTP_SERVER_NUM_WORKERS];
+	atomic_val_t queued;
+	atomic_val_t max;
+
+	ctx->fds[idx].fd = WORKER_SOCK;
+	atomic_set(&client->worker_state, WORKER_BUSY);
+
+	/* The queue has room for all the clients, this cannot fail */
+	(void)k_msgq_put(&worker->queue, &client, K_NO_WAIT);
+
+	atomic_inc(&worker->dispatched);
+	queued = k_msgq_num_used_get(&worker->queue);
+	do {
+		max = atomic_get(&worker->max_queued);
+	} while (queued > max && !atomic_cas(&worker->max_queued, max, queued));
+}
+
+/* Take back the clients the workers are done with */
+static void workers_complete(struct http_server_ctx *ctx)
+{
+	ARRAY_FOR_EACH_PTR(ctx->clients, client) {
+		if (!atomic_cas(&client->worker_state, WORKER_DONE, WORKER_IDLE)) {
+			continue;
+		}
+
+		ctx->fds[ctx->listen_fds + ARRAY_INDEX(ctx->clients, client)].fd = client->fd;
+
+		if (client->close_requested) {
+			close_client_connection(client);
+			continue;
+		}
+
+		if (client->release_requested) {
+			http_server_release_client(client);
+			continue;
+		}
+
+		handle_http_request_result(client, client->worker_ret);
+	}
+}
+
+static bool workers_busy(struct http_server_ctx *ctx)
+{
+	ARRAY_FOR_EACH_PTR(ctx->clients, client) {
+		if (atomic_get(&client->worker_state) == WORKER_BUSY) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Wait for the workers to be done with all the clients, each of them
+ * signals the eventfd after finishing with one.
+ */
+static void workers_drain(struct http_server_ctx *ctx)
+{
+	eventfd_t value;
+
+	workers_complete(ctx);
+
+	while (workers_busy(ctx)) {
+		(void)eventfd_read(ctx->fds[WORKER_EVENT_FD].fd, &value);
+		workers_complete(ctx);
+	}
+}
+
+int http_server_worker_stats_get(int worker, struct http_server_worker_stats *stats)
+{
+	if (worker < 0 || (size_t)worker >= ARRAY_SIZE(workers) || stats == NULL) {
+		return -EINVAL;
+	}
+
+	stats->dispatched = atomic_get(&workers[worker].dispatched);
+	stats->queued = k_msgq_num_used_get(&workers[worker].queue);
+	stats->max_queued = atomic_get(&workers[worker].max_queued);
+
+	return 0;
+}
+#endif /* CONFIG_HTTP_SERVER_WORKER_POOL */
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
 	struct http_client_ctx *client;
@@ -582,6 +828,17 @@ static int http_server_run(struct http_server_ctx *ctx)
 				continue;
 			}
 
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+			if (i == WORKER_EVENT_FD) {
+				if (ctx->fds[i].revents & ZSOCK_POLLIN) {
+					eventfd_read(ctx->fds[i].fd, &value);
+					workers_complete(ctx);
+				}
+
+				continue;
+			}
+#endif
+
 			if (ctx->fds[i].revents & ZSOCK_POLLHUP) {
 				if (i >= ctx->listen_fds) {
 					LOG_DBG("Client #%d has disconnected",
@@ -684,28 +941,21 @@ static int http_server_run(struct http_server_ctx *ctx)
 
 			http_client_timer_restart(client);
 
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+			worker_dispatch(ctx, i);
+#else
 			ret = handle_http_request(client);
-			if (ret < 0 && ret != -EAGAIN) {
-				if (ret == -ENOTCONN) {
-					LOG_DBG("Client closed connection while handling request");
-				} else {
-					LOG_ERR("HTTP request handling error (%d)", ret);
-				}
-				close_client_connection(client);
-			} else if (client->data_len == sizeof(client->buffer)) {
-				/* If the RX buffer is still full after parsing,
-				 * it means we won't be able to handle this request
-				 * with the current buffer size.
-				 */
-				LOG_ERR("RX buffer too small to handle request");
-				close_client_connection(client);
-			}
+			handle_http_request_result(client, ret);
+#endif
 		}
 	}
 
 	return 0;
 
 closing:
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+	workers_drain(ctx);
+#endif
 	/* Close all client connections and the server socket */
 	close_all_sockets(ctx);
 	return ret;
@@ -858,6 +1108,144 @@ return_filename:
 	return ret;
 }
 
+#if defined(CONFIG_FILE_SYSTEM)
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+uint8_t *http_server_fs_tx_buf_get(struct http_client_ctx *client)
+{
+	size_t idx = ARRAY_INDEX(server_ctx.clients, client) % HTTP_SERVER_NUM_WORKERS;
+
+	return workers[idx].fs_tx_buf;
+}
+#else
+static uint8_t fs_tx_buf[CONFIG_HTTP_SERVER_STATIC_FS_TX_BUF_SIZE];
+
+uint8_t *http_server_fs_tx_buf_get(struct http_client_ctx *client)
+{
+	ARG_UNUSED(client);
+
+	return fs_tx_buf;
+}
+#endif
+#endif
+
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+static const struct http_resource_static_variant *
+find_static_variant(const struct http_resource_detail_static *detail,
+		    uint8_t supported_compression)
+{
+	/* Same order of preference as http_server_find_file() */
+	static const enum http_compression preference[] = {
+		HTTP_BR, HTTP_GZIP, HTTP_ZSTD, HTTP_COMPRESS, HTTP_DEFLATE,
+	};
+
+	ARRAY_FOR_EACH(preference, i) {
+		if (!IS_BIT_SET(supported_compression, preference[i])) {
+			continue;
+		}
+
+		for (size_t j = 0; j < detail->num_variants; j++) {
+			if (detail->variants[j].compression == preference[i]) {
+				return &detail->variants[j];
+			}
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+/* Weak comparison of a quoted entity tag against the list from an
+ * If-None-Match header.
+ */
+static bool etag_list_match(const char *list, const char *etag)
+{
+	size_t etag_len = strlen(etag);
+
+	while (*list != '\0') {
+		const char *end;
+
+		if (*list == ' ' || *list == ',') {
+			list++;
+			continue;
+		}
+
+		if (*list == '*') {
+			return true;
+		}
+
+		if (strncmp(list, "W/", 2) == 0) {
+			list += 2;
+		}
+
+		end = strchr(list, ',');
+		if (end == NULL) {
+			end = list + strlen(list);
+		}
+
+		while (end > list && end[-1] == ' ') {
+			end--;
+		}
+
+		if ((size_t)(end - list) == etag_len && strncmp(list, etag, etag_len) == 0) {
+			return true;
+		}
+
+		list = end;
+	}
+
+	return false;
+}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
+void http_server_static_response(struct http_client_ctx *client,
+				 const struct http_resource_detail_static *detail,
+				 struct http_static_response *rsp)
+{
+	const struct http_resource_static_variant *variant = NULL;
+
+	rsp->data = detail->static_data;
+	rsp->len = detail->static_data_len;
+	rsp->content_encoding = detail->common.content_encoding;
+	rsp->etag[0] = '\0';
+	rsp->vary = false;
+	rsp->not_modified = false;
+
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+	rsp->vary = detail->num_variants > 0;
+
+	variant = find_static_variant(detail, client->supported_compression);
+	if (variant != NULL) {
+		rsp->data = variant->static_data;
+		rsp->len = variant->static_data_len;
+		rsp->content_encoding = http_compression_text(variant->compression);
+	}
+#endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+
+#if defined(CONFIG_HTTP_SERVER_ETAG)
+	if (detail->etag != NULL) {
+		int ret;
+
+		if (variant != NULL) {
+			ret = snprintk(rsp->etag, sizeof(rsp->etag), "\"%s-%s\"", detail->etag,
+				       http_compression_text(variant->compression));
+		} else {
+			ret = snprintk(rsp->etag, sizeof(rsp->etag), "\"%s\"", detail->etag);
+		}
+
+		if (ret >= sizeof(rsp->etag)) {
+			LOG_WRN("ETag %s too long, not sent", detail->etag);
+			rsp->etag[0] = '\0';
+		} else {
+			rsp->not_modified = etag_list_match(client->if_none_match, rsp->etag);
+		}
+	}
+#else
+	ARG_UNUSED(client);
+	ARG_UNUSED(variant);
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+}
+
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size)
 {
@@ -897,6 +1285,42 @@ int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t
 	return 0;
 }
 
+int http_server_sendmsg_all(struct http_client_ctx *client, struct iovec *iov, size_t iovlen)
+{
+	struct msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = iovlen,
+	};
+	size_t total_len = 0;
+
+	for (size_t i = 0; i < iovlen; i++) {
+		total_len += iov[i].iov_len;
+	}
+
+	while (total_len > 0) {
+		ssize_t out_len = zsock_sendmsg(client->fd, &msg, 0);
+
+		if (out_len < 0) {
+			return -errno;
+		}
+
+		total_len -= out_len;
+
+		/* Skip what has been sent for the next iteration. */
+		for (size_t i = 0; i < iovlen && out_len > 0; i++) {
+			size_t len = MIN(out_len, iov[i].iov_len);
+
+			iov[i].iov_base = (uint8_t *)iov[i].iov_base + len;
+			iov[i].iov_len -= len;
+			out_len -= len;
+		}
+
+		http_client_timer_restart(client);
+	}
+
+	return 0;
+}
+
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status)
 {
 	if (status != HTTP_SERVER_DATA_FINAL) {
@@ -976,6 +1400,10 @@ static void http_server_thread(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+	workers_start();
+#endif
+
 	while (true) {
 		k_sem_take(&server_start, K_FOREVER);
 
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2023, Emna Rekik
  * Copyright (c) 2024 Nordic Semiconductor ASA
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -124,15 +125,19 @@ static int handle_http1_static_resource(
 #define RESPONSE_TEMPLATE			\
 	"HTTP/1.1 200 OK\r\n"			\
 	"%s%s\r\n"				\
-	"Content-Length: %d\r\n"
+	"Content-Length: %zu\r\n"
+#define NOT_MODIFIED_TEMPLATE			\
+	"HTTP/1.1 304 Not Modified\r\n"
 
 	/* Add couple of bytes to total response */
 	char http_response[sizeof(RESPONSE_TEMPLATE) +
 			   sizeof("Content-Encoding: 01234567890123456789\r\n") +
 			   sizeof("Content-Type: \r\n") + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
-			   sizeof("xxxx") +
+			   sizeof("01234567890123456789") +
+			   sizeof("Vary: Accept-Encoding\r\n") +
+			   sizeof("ETag: \r\n") + HTTP_SERVER_MAX_HEADER_LEN +
 			   sizeof("\r\n")];
-	const char *data;
+	struct http_static_response rsp;
 	int len;
 	int ret;
 
@@ -140,34 +145,50 @@ static int handle_http1_static_resource(
 		return send_http1_405(client);
 	}
 
-	data = static_detail->static_data;
-	len = static_detail->static_data_len;
-
-	if (static_detail->common.content_encoding != NULL &&
-	    static_detail->common.content_encoding[0] != '\0') {
-		snprintk(http_response, sizeof(http_response),
-			 RESPONSE_TEMPLATE "Content-Encoding: %s\r\n\r\n",
-			 "Content-Type: ",
-			 static_detail->common.content_type == NULL ?
-			 "text/html" : static_detail->common.content_type,
-			 len, static_detail->common.content_encoding);
+	http_server_static_response(client, static_detail, &rsp);
+
+	if (rsp.not_modified) {
+		len = snprintk(http_response, sizeof(http_response), NOT_MODIFIED_TEMPLATE);
 	} else {
-		snprintk(http_response, sizeof(http_response),
-			 RESPONSE_TEMPLATE "\r\n",
-			 "Content-Type: ",
-			 static_detail->common.content_type == NULL ?
-			 "text/html" : static_detail->common.content_type,
-			 len);
+		len = snprintk(http_response, sizeof(http_response), RESPONSE_TEMPLATE,
+			       "Content-Type: ",
+			       static_detail->common.content_type == NULL ?
+			       "text/html" : static_detail->common.content_type,
+			       rsp.len);
+
+		if (rsp.content_encoding != NULL && rsp.content_encoding[0] != '\0') {
+			len += snprintk(http_response + len, sizeof(http_response) - len,
+					"Content-Encoding: %s\r\n", rsp.content_encoding);
+		}
 	}
 
-	ret = http_server_sendall(client, http_response, strlen(http_response));
+	if (rsp.vary) {
+		len += snprintk(http_response + len, sizeof(http_response) - len,
+				"Vary: Accept-Encoding\r\n");
+	}
+
+	if (rsp.etag[0] != '\0') {
+		len += snprintk(http_response + len, sizeof(http_response) - len,
+				"ETag: %s\r\n", rsp.etag);
+	}
+
+	len += snprintk(http_response + len, sizeof(http_response) - len, "\r\n");
+
+	ret = http_server_sendall(client, http_response, len);
 	if (ret < 0) {
 		return ret;
 	}
 
 	client->http1_headers_sent = true;
 
-	ret = http_server_sendall(client, data, len);
+	if (rsp.not_modified) {
+		return 0;
+	}
+
+	/* The content is sent straight from where it is stored, in a single
+	 * call, so large resources are not copied nor split up by the server.
+	 */
+	ret = http_server_sendall(client, rsp.data, rsp.len);
 	if (ret < 0) {
 		return ret;
 	}
@@ -556,13 +577,14 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 	/* read and send file */
 	remaining = file_size;
 	while (remaining > 0) {
-		len = fs_read(&file, http_response, sizeof(http_response));
+		len = fs_read(&file, http_server_fs_tx_buf_get(client),
+			      HTTP_SERVER_FS_TX_BUF_SIZE);
 		if (len < 0) {
 			LOG_ERR("Filesystem read error (%d)", len);
 			goto close;
 		}
 
-		ret = http_server_sendall(client, http_response, len);
+		ret = http_server_sendall(client, http_server_fs_tx_buf_get(client), len);
 		if (ret < 0) {
 			goto close;
 		}
@@ -595,7 +617,7 @@ static int handle_http1_dynamic_resource(
 		return send_http1_405(client);
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_dynamic_claim(dynamic_detail, client)) {
 		ret = send_http1_409(client);
 		if (ret < 0) {
 			return ret;
@@ -604,8 +626,6 @@ static int handle_http1_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_HEAD:
 		if (user_method & BIT(HTTP_HEAD)) {
@@ -724,6 +744,11 @@ static int on_header_field(struct http_parser *parser, const char *at,
 				ctx->accept_encoding_next = true;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+			else if (strcasecmp(ctx->header_buffer, "If-None-Match") == 0) {
+				ctx->if_none_match_next = true;
+			}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -781,6 +806,11 @@ static int on_header_value(struct http_parser *parser,
 			ctx->header_capture_ctx.store_next_value = false;
 			ctx->header_capture_ctx.status = HTTP_HEADER_STATUS_DROPPED;
 		}
+
+#ifdef CONFIG_HTTP_SERVER_ETAG
+		/* A truncated list of tags could match by mistake */
+		ctx->if_none_match_next = false;
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 	} else {
 		memcpy(ctx->header_buffer + offset, at, length);
 		offset += length;
@@ -816,6 +846,12 @@ static int on_header_value(struct http_parser *parser,
 				ctx->accept_encoding_next = false;
 			}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+			if (ctx->if_none_match_next) {
+				memcpy(ctx->if_none_match, ctx->header_buffer, offset + 1);
+				ctx->if_none_match_next = false;
+			}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 
 			ctx->header_buffer[0] = '\0';
 		}
@@ -903,6 +939,11 @@ int enter_http1_request(struct http_client_ctx *client)
 	memset(client->header_buffer, 0, sizeof(client->header_buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
 
+#ifdef CONFIG_HTTP_SERVER_ETAG
+	client->if_none_match[0] = '\0';
+	client->if_none_match_next = false;
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 	return 0;
 }
 
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2023, Emna Rekik
  * Copyright (c) 2024 Nordic Semiconductor ASA
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -29,6 +30,66 @@ static const char content_404[] = {
 #endif
 };
 
+#define HTTP2_TX_BATCH_FRAMES CONFIG_HTTP_SERVER_HTTP2_TX_BATCH_FRAMES
+
+#if CONFIG_HTTP_SERVER_HPACK_ENCODE_CACHE_SIZE > 0
+#define HPACK_CACHE_FIELD_LEN   48
+#define HPACK_CACHE_ENCODED_LEN 52
+
+/* Encoded response header fields, as the encoder keeps no dynamic table
+ * the same field always encodes the same way. Shared by the threads
+ * handling the requests.
+ */
+struct hpack_cache_entry {
+	uint8_t name_len;
+	uint8_t value_len;
+	uint8_t encoded_len;
+	char field[HPACK_CACHE_FIELD_LEN];
+	uint8_t encoded[HPACK_CACHE_ENCODED_LEN];
+};
+
+static struct hpack_cache_entry hpack_cache[CONFIG_HTTP_SERVER_HPACK_ENCODE_CACHE_SIZE];
+static size_t hpack_cache_next;
+static K_MUTEX_DEFINE(hpack_cache_lock);
+
+static struct hpack_cache_entry *hpack_cache_find(const struct http_hpack_header_buf *header)
+{
+	ARRAY_FOR_EACH_PTR(hpack_cache, entry) {
+		if (entry->encoded_len > 0 &&
+		    entry->name_len == header->name_len &&
+		    entry->value_len == header->value_len &&
+		    memcmp(entry->field, header->name, header->name_len) == 0 &&
+		    memcmp(entry->field + header->name_len, header->value,
+			   header->value_len) == 0) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void hpack_cache_add(const struct http_hpack_header_buf *header,
+			    const uint8_t *encoded, size_t encoded_len)
+{
+	struct hpack_cache_entry *entry;
+
+	if (header->name_len + header->value_len > HPACK_CACHE_FIELD_LEN ||
+	    encoded_len > HPACK_CACHE_ENCODED_LEN) {
+		return;
+	}
+
+	entry = &hpack_cache[hpack_cache_next];
+	hpack_cache_next = (hpack_cache_next + 1) % ARRAY_SIZE(hpack_cache);
+
+	entry->name_len = header->name_len;
+	entry->value_len = header->value_len;
+	entry->encoded_len = encoded_len;
+	memcpy(entry->field, header->name, header->name_len);
+	memcpy(entry->field + header->name_len, header->value, header->value_len);
+	memcpy(entry->encoded, encoded, encoded_len);
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_ENCODE_CACHE_SIZE > 0 */
+
 static bool is_header_flag_set(uint8_t flags, uint8_t mask)
 {
 	return (flags & mask) != 0;
@@ -85,8 +146,10 @@ static struct http2_stream_ctx *allocate_http_stream_context(
 			client->streams[i].stream_state = HTTP2_STREAM_OPEN;
 			client->streams[i].window_size =
 				HTTP_SERVER_INITIAL_WINDOW_SIZE;
+			client->streams[i].tx_window_size = client->tx_initial_window_size;
 			client->streams[i].headers_sent = false;
 			client->streams[i].end_stream_sent = false;
+			client->streams[i].tx_pending = false;
 			return &client->streams[i];
 		}
 	}
@@ -102,6 +165,9 @@ static void release_http_stream_context(struct http_client_ctx *client,
 			client->streams[i].stream_id = 0;
 			client->streams[i].stream_state = HTTP2_STREAM_IDLE;
 			client->streams[i].current_detail = NULL;
+			client->streams[i].tx_pending = false;
+			client->streams[i].tx_data = NULL;
+			client->streams[i].tx_len = 0;
 			break;
 		}
 	}
@@ -110,6 +176,9 @@ static void release_http_stream_context(struct http_client_ctx *client,
 static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 			    size_t *buflen, const char *name, const char *value)
 {
+#if CONFIG_HTTP_SERVER_HPACK_ENCODE_CACHE_SIZE > 0
+	struct hpack_cache_entry *entry;
+#endif
 	int ret;
 
 	client->header_field.name = name;
@@ -117,12 +186,42 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
+#if CONFIG_HTTP_SERVER_HPACK_ENCODE_CACHE_SIZE > 0
+	ret = -ENOENT;
+
+	k_mutex_lock(&hpack_cache_lock, K_FOREVER);
+	entry = hpack_cache_find(&client->header_field);
+	if (entry != NULL) {
+		ret = -ENOBUFS;
+		if (entry->encoded_len <= *buflen) {
+			ret = entry->encoded_len;
+			memcpy(*buf, entry->encoded, ret);
+		}
+	}
+	k_mutex_unlock(&hpack_cache_lock);
+
+	if (ret == -ENOBUFS) {
+		return ret;
+	} else if (ret >= 0) {
+		*buf += ret;
+		*buflen -= ret;
+
+		return 0;
+	}
+#endif
+
 	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
 	if (ret < 0) {
 		LOG_DBG("Failed to encode header, err %d", ret);
 		return ret;
 	}
 
+#if CONFIG_HTTP_SERVER_HPACK_ENCODE_CACHE_SIZE > 0
+	k_mutex_lock(&hpack_cache_lock, K_FOREVER);
+	hpack_cache_add(&client->header_field, *buf, ret);
+	k_mutex_unlock(&hpack_cache_lock);
+#endif
+
 	*buf += ret;
 	*buflen -= ret;
 
@@ -214,10 +313,21 @@ static int send_headers_frame(struct http_client_ctx *client, enum http_status s
 	return 0;
 }
 
+static void consume_tx_window(struct http_client_ctx *client,
+			      struct http2_stream_ctx *stream, size_t length)
+{
+	client->tx_window_size -= length;
+	if (stream != NULL) {
+		stream->tx_window_size -= length;
+	}
+}
+
 static int send_data_frame(struct http_client_ctx *client, const char *payload,
 			   size_t length, uint32_t stream_id, uint8_t flags)
 {
 	uint8_t frame_header[HTTP2_FRAME_HEADER_SIZE];
+	struct iovec iov[2];
+	size_t iovlen = 0;
 	int ret;
 
 	encode_frame_header(frame_header, length, HTTP2_DATA_FRAME,
@@ -225,21 +335,104 @@ static int send_data_frame(struct http_client_ctx *client, const char *payload,
 			    HTTP2_FLAG_END_STREAM : 0,
 			    stream_id);
 
-	ret = http_server_sendall(client, frame_header, sizeof(frame_header));
+	iov[iovlen].iov_base = frame_header;
+	iov[iovlen++].iov_len = sizeof(frame_header);
+
+	if (payload != NULL && length > 0) {
+		iov[iovlen].iov_base = (void *)payload;
+		iov[iovlen++].iov_len = length;
+	}
+
+	/* Frame header and payload go out in a single send */
+	ret = http_server_sendmsg_all(client, iov, iovlen);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
-	} else {
-		if (payload != NULL && length > 0) {
-			ret = http_server_sendall(client, payload, length);
-			if (ret < 0) {
-				LOG_DBG("Cannot write to socket (%d)", ret);
-			}
-		}
+		return ret;
 	}
 
+	consume_tx_window(client, find_http_stream_context(client, stream_id), length);
+
 	return ret;
 }
 
+/* Send the static content queued on the streams. Each stream with content
+ * left gets one DATA frame per round, within the flow-control windows, and
+ * the frames of a round are sent in a single call.
+ */
+int http2_send_pending_data(struct http_client_ctx *client)
+{
+	uint8_t frame_headers[HTTP2_TX_BATCH_FRAMES][HTTP2_FRAME_HEADER_SIZE];
+	struct iovec iov[2 * HTTP2_TX_BATCH_FRAMES];
+	size_t iovlen;
+	size_t frames;
+	int ret;
+
+	do {
+		iovlen = 0;
+		frames = 0;
+
+		for (size_t n = 0; n < ARRAY_SIZE(client->streams) &&
+				   frames < HTTP2_TX_BATCH_FRAMES; n++) {
+			size_t i = (client->tx_next_stream + n) % ARRAY_SIZE(client->streams);
+			struct http2_stream_ctx *stream = &client->streams[i];
+			size_t len = MIN(stream->tx_len, client->tx_max_frame_size);
+			uint8_t flags = 0;
+
+			if (!stream->tx_pending) {
+				continue;
+			}
+
+			if (len > 0) {
+				int window = MIN(client->tx_window_size, stream->tx_window_size);
+
+				if (window <= 0) {
+					continue;
+				}
+
+				len = MIN(len, window);
+			}
+
+			if (len == stream->tx_len) {
+				flags = HTTP2_FLAG_END_STREAM;
+			}
+
+			encode_frame_header(frame_headers[frames], len, HTTP2_DATA_FRAME, flags,
+					    stream->stream_id);
+			iov[iovlen].iov_base = frame_headers[frames];
+			iov[iovlen++].iov_len = HTTP2_FRAME_HEADER_SIZE;
+
+			if (len > 0) {
+				iov[iovlen].iov_base = (void *)stream->tx_data;
+				iov[iovlen++].iov_len = len;
+			}
+
+			stream->tx_data += len;
+			stream->tx_len -= len;
+			consume_tx_window(client, stream, len);
+			frames++;
+
+			client->tx_next_stream = (i + 1) % ARRAY_SIZE(client->streams);
+
+			if (flags == HTTP2_FLAG_END_STREAM) {
+				stream->end_stream_sent = true;
+				release_http_stream_context(client, stream->stream_id);
+			}
+		}
+
+		if (frames == 0) {
+			break;
+		}
+
+		ret = http_server_sendmsg_all(client, iov, iovlen);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			return ret;
+		}
+	} while (true);
+
+	return 0;
+}
+
 int send_settings_frame(struct http_client_ctx *client, bool ack)
 {
 	uint8_t settings_frame[HTTP2_FRAME_HEADER_SIZE +
@@ -414,6 +607,10 @@ static int handle_http2_static_resource(
 	struct http_resource_detail_static *static_detail,
 	struct http2_frame *frame, struct http_client_ctx *client)
 {
+	struct http_static_response rsp;
+	struct http_resource_detail res_detail;
+	struct http_header extra_headers[2];
+	size_t extra_headers_count = 0;
 	const char *content_200;
 	size_t content_len;
 	int ret;
@@ -426,24 +623,78 @@ static int handle_http2_static_resource(
 		return -ENOENT;
 	}
 
-	content_200 = static_detail->static_data;
-	content_len = static_detail->static_data_len;
+	http_server_static_response(client, static_detail, &rsp);
+
+	res_detail = static_detail->common;
+	res_detail.content_encoding = rsp.content_encoding;
+
+	if (rsp.vary) {
+		extra_headers[extra_headers_count++] = (struct http_header){
+			.name = "vary",
+			.value = "accept-encoding",
+		};
+	}
+
+	if (rsp.etag[0] != '\0') {
+		extra_headers[extra_headers_count++] = (struct http_header){
+			.name = "etag",
+			.value = rsp.etag,
+		};
+	}
+
+	if (rsp.not_modified) {
+		ret = send_headers_frame(client, HTTP_304_NOT_MODIFIED, frame->stream_identifier,
+					 NULL, HTTP2_FLAG_END_STREAM, extra_headers,
+					 extra_headers_count);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			goto out;
+		}
+
+		client->current_stream->end_stream_sent = true;
+		goto out;
+	}
+
+	content_200 = rsp.data;
+	content_len = rsp.len;
 
 	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier,
-				 &static_detail->common, 0, NULL, 0);
+				 &res_detail, 0, extra_headers, extra_headers_count);
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		goto out;
 	}
 
-	ret = send_data_frame(client, content_200, content_len,
-			      frame->stream_identifier,
-			      HTTP2_FLAG_END_STREAM);
-	if (ret < 0) {
-		LOG_DBG("Cannot write to socket (%d)", ret);
+	if (frame->type == HTTP2_HEADERS_FRAME) {
+		/* The content is sent by http2_send_pending_data() once the
+		 * received frames are processed, interleaved with the other
+		 * streams and within the flow-control windows.
+		 */
+		client->current_stream->tx_data = content_200;
+		client->current_stream->tx_len = content_len;
+		client->current_stream->tx_pending = true;
 		goto out;
 	}
 
+	/* Request from an HTTP/1 upgrade, the client settings are not known
+	 * yet. Large resources are sent in as many frames as needed, each
+	 * straight from where the resource is stored.
+	 */
+	do {
+		size_t frame_len = MIN(content_len, client->tx_max_frame_size);
+
+		content_len -= frame_len;
+		ret = send_data_frame(client, content_200, frame_len,
+				      frame->stream_identifier,
+				      content_len > 0 ? 0 : HTTP2_FLAG_END_STREAM);
+		if (ret < 0) {
+			LOG_DBG("Cannot write to socket (%d)", ret);
+			goto out;
+		}
+
+		content_200 += frame_len;
+	} while (content_len > 0);
+
 	client->current_stream->end_stream_sent = true;
 
 out:
@@ -469,7 +720,6 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 	enum http_compression chosen_compression = 0;
 	int len;
 	int remaining;
-	char tmp[64];
 
 	if (client->method != HTTP_GET) {
 		return send_http2_405(client, frame);
@@ -531,14 +781,16 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 	/* read and send file */
 	remaining = client->data_len;
 	while (remaining > 0) {
-		len = fs_read(&file, tmp, sizeof(tmp));
+		len = fs_read(&file, http_server_fs_tx_buf_get(client),
+			      HTTP_SERVER_FS_TX_BUF_SIZE);
 		if (len < 0) {
 			LOG_ERR("Filesystem read error (%d)", len);
 			goto out;
 		}
 
 		remaining -= len;
-		ret = send_data_frame(client, tmp, len, frame->stream_identifier,
+		ret = send_data_frame(client, http_server_fs_tx_buf_get(client), len,
+				      frame->stream_identifier,
 				      (remaining > 0) ? 0 : HTTP2_FLAG_END_STREAM);
 		if (ret < 0) {
 			LOG_DBG("Cannot write to socket (%d)", ret);
@@ -782,7 +1034,7 @@ static int handle_http2_dynamic_resource(
 		return send_http2_405(client, frame);
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_dynamic_claim(dynamic_detail, client)) {
 		ret = send_http2_409(client, frame);
 		if (ret < 0) {
 			return ret;
@@ -791,8 +1043,6 @@ static int handle_http2_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_GET:
 	case HTTP_DELETE:
@@ -926,6 +1176,10 @@ static int enter_http_frame_headers_state(struct http_client_ctx *client)
 		client->expect_continuation = false;
 	}
 
+#ifdef CONFIG_HTTP_SERVER_ETAG
+	client->if_none_match[0] = '\0';
+#endif /* CONFIG_HTTP_SERVER_ETAG */
+
 	if (IS_ENABLED(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)) {
 		/* Reset header capture state for new headers frame */
 		client->header_capture_ctx.count = 0;
@@ -1405,6 +1659,16 @@ static int process_header(struct http_client_ctx *client,
 						       &client->supported_compression);
 	}
 #endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+#ifdef CONFIG_HTTP_SERVER_ETAG
+	else if (header->name_len == (sizeof("if-none-match") - 1) &&
+		 memcmp(header->name, "if-none-match", header->name_len) == 0) {
+		/* A truncated list of tags could match by mistake */
+		if (header->value_len < sizeof(client->if_none_match)) {
+			memcpy(client->if_none_match, header->value, header->value_len);
+			client->if_none_match[header->value_len] = '\0';
+		}
+	}
+#endif /* CONFIG_HTTP_SERVER_ETAG */
 	else {
 		/* Just ignore for now. */
 		LOG_DBG("Ignoring field %.*s", (int)header->name_len, header->name);
@@ -1530,7 +1794,10 @@ static int handle_http_frame_headers_end_stream(struct http_client_ctx *client)
 	client->current_stream->current_detail = NULL;
 
 out:
-	release_http_stream_context(client, frame->stream_identifier);
+	/* Released once the queued content is sent */
+	if (!client->current_stream->tx_pending) {
+		release_http_stream_context(client, frame->stream_identifier);
+	}
 
 	return ret;
 }
@@ -1725,6 +1992,50 @@ int handle_http_frame_rst_stream(struct http_client_ctx *client)
 	return 0;
 }
 
+static int apply_peer_settings(struct http_client_ctx *client, const uint8_t *buf, size_t len)
+{
+	const size_t field_len = sizeof(struct http2_settings_field);
+
+	if (len % field_len != 0) {
+		return -EBADMSG;
+	}
+
+	for (; len > 0; len -= field_len, buf += field_len) {
+		uint16_t id = sys_get_be16(buf);
+		uint32_t value = sys_get_be32(buf + sizeof(uint16_t));
+		int delta;
+
+		switch (id) {
+		case HTTP2_SETTINGS_INITIAL_WINDOW_SIZE:
+			if (value > HTTP2_MAX_WINDOW_SIZE) {
+				return -EBADMSG;
+			}
+
+			/* Applies to the streams already open as well */
+			delta = (int)value - client->tx_initial_window_size;
+			ARRAY_FOR_EACH(client->streams, i) {
+				if (client->streams[i].stream_state != HTTP2_STREAM_IDLE) {
+					client->streams[i].tx_window_size += delta;
+				}
+			}
+
+			client->tx_initial_window_size = value;
+			break;
+		case HTTP2_SETTINGS_MAX_FRAME_SIZE:
+			if (value < HTTP2_DEFAULT_MAX_FRAME_SIZE || value > HTTP2_MAX_FRAME_SIZE) {
+				return -EBADMSG;
+			}
+
+			client->tx_max_frame_size = value;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
 int handle_http_frame_settings(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1736,6 +2047,15 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+	if (!is_header_flag_set(frame->flags, HTTP2_FLAG_SETTINGS_ACK)) {
+		int ret;
+
+		ret = apply_peer_settings(client, client->cursor, frame->length);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
@@ -1770,6 +2090,9 @@ int handle_http_frame_goaway(struct http_client_ctx *client)
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
 
+	/* Complete the responses already queued before closing */
+	(void)http2_send_pending_data(client);
+
 	enter_http_done_state(client);
 
 	return 0;
@@ -1778,16 +2101,40 @@ int handle_http_frame_goaway(struct http_client_ctx *client)
 int handle_http_frame_window_update(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
+	struct http2_stream_ctx *stream;
+	uint32_t increment;
+	int *window;
 	int bytes_consumed;
 
 	LOG_DBG("HTTP_SERVER_FRAME_WINDOW_UPDATE");
 
-	/* TODO Implement flow control, for now just ignore. */
+	if (frame->length != HTTP2_WINDOW_UPDATE_FRAME_LEN) {
+		return -EBADMSG;
+	}
 
 	if (client->data_len < frame->length) {
 		return -EAGAIN;
 	}
 
+	increment = sys_get_be32(client->cursor) & HTTP2_WINDOW_UPDATE_MASK;
+
+	if (frame->stream_identifier == 0) {
+		window = &client->tx_window_size;
+	} else {
+		stream = find_http_stream_context(client, frame->stream_identifier);
+		/* Updates may still arrive for the streams already closed */
+		window = (stream != NULL) ? &stream->tx_window_size : NULL;
+	}
+
+	if (window != NULL) {
+		if ((int64_t)*window + increment > HTTP2_MAX_WINDOW_SIZE) {
+			LOG_DBG("Flow-control window overflow");
+			return -EBADMSG;
+		}
+
+		*window += increment;
+	}
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
@@ -598,6 +598,7 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 	struct observe_node *obs;
 	int rc;
 	int64_t next = INT64_MAX;
+	int generated = 0;
 
 	lwm2m_registry_lock();
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
@@ -609,7 +610,8 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 			next = obs->event_timestamp;
 		}
 
-		if (timestamp < obs->event_timestamp) {
+		if (timestamp < obs->event_timestamp ||
+		    generated >= CONFIG_LWM2M_ENGINE_NOTIFY_BATCH) {
 			continue;
 		}
 		/* Check That There is not pending process*/
@@ -628,8 +630,8 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 		obs->last_timestamp = timestamp;
 
 		if (!rc) {
-			/* create at most one notification */
-			goto cleanup;
+			/* create at most CONFIG_LWM2M_ENGINE_NOTIFY_BATCH notifications */
+			generated++;
 		}
 	}
 cleanup:
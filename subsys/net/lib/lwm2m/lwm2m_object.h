@@ -210,6 +210,9 @@ struct lwm2m_engine_obj {
 
 	/* Object is a core object (defined in the official LwM2M spec.) */
 	bool is_core : 1;
+
+	/* Field definitions are in ascending res_id order, set on registration */
+	bool fields_sorted : 1;
 };
 
 /* Resource instances with this value are considered "not created" yet */
@@ -415,6 +418,9 @@ struct lwm2m_engine_obj_inst {
 	/* object instance member data */
 	uint16_t obj_inst_id;
 	uint16_t resource_count;
+
+	/* Resources are in ascending res_id order, set on registration */
+	bool resources_sorted : 1;
 };
 
 /* Initialize resource instances prior to use */
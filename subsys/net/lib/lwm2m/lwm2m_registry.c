@@ -103,6 +103,8 @@ static void lwm2m_engine_cache_write(const struct lwm2m_engine_obj_field *obj_fi
 
 void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 {
+	struct lwm2m_engine_obj *prev;
+
 	k_mutex_lock(&registry_lock, K_FOREVER);
 #if defined(CONFIG_LWM2M_ACCESS_CONTROL_ENABLE)
 	/* If bootstrap, then bootstrap server should create the ac obj instances */
@@ -112,7 +114,28 @@ void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 	access_control_add_obj(obj->obj_id, server_obj_inst_id);
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
-	sys_slist_append(&engine_obj_list, &obj->node);
+	obj->fields_sorted = true;
+	for (int i = 1; i < obj->field_count; i++) {
+		if (obj->fields[i - 1].res_id >= obj->fields[i].res_id) {
+			obj->fields_sorted = false;
+			break;
+		}
+	}
+
+	/* Keep the list ordered by object ID so that lookups can stop early */
+	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_list, prev, node) {
+		struct lwm2m_engine_obj *next = SYS_SLIST_PEEK_NEXT_CONTAINER(prev, node);
+
+		if (next == NULL || next->obj_id > obj->obj_id) {
+			break;
+		}
+	}
+
+	if (prev == NULL || prev->obj_id > obj->obj_id) {
+		sys_slist_prepend(&engine_obj_list, &obj->node);
+	} else {
+		sys_slist_insert(&engine_obj_list, &prev->node, &obj->node);
+	}
 	k_mutex_unlock(&registry_lock);
 }
 
@@ -135,6 +158,10 @@ struct lwm2m_engine_obj *get_engine_obj(int obj_id)
 		if (obj->obj_id == obj_id) {
 			return obj;
 		}
+
+		if (obj->obj_id > obj_id) {
+			break;
+		}
 	}
 
 	return NULL;
@@ -144,17 +171,83 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 {
 	int i;
 
-	if (obj && obj->fields && obj->field_count > 0) {
-		for (i = 0; i < obj->field_count; i++) {
+	if (!obj || !obj->fields || obj->field_count == 0) {
+		return NULL;
+	}
+
+	if (obj->fields_sorted) {
+		int lo = 0;
+		int hi = obj->field_count - 1;
+
+		while (lo <= hi) {
+			i = lo + (hi - lo) / 2;
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
+			} else if (obj->fields[i].res_id < res_id) {
+				lo = i + 1;
+			} else {
+				hi = i - 1;
+			}
+		}
+
+		return NULL;
+	}
+
+	for (i = 0; i < obj->field_count; i++) {
+		if (obj->fields[i].res_id == res_id) {
+			return &obj->fields[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct lwm2m_engine_res *engine_obj_inst_res(struct lwm2m_engine_obj_inst *obj_inst,
+						    int res_id)
+{
+	int i;
+
+	if (obj_inst->resources_sorted) {
+		int lo = 0;
+		int hi = obj_inst->resource_count - 1;
+
+		while (lo <= hi) {
+			i = lo + (hi - lo) / 2;
+			if (obj_inst->resources[i].res_id == res_id) {
+				return &obj_inst->resources[i];
+			} else if (obj_inst->resources[i].res_id < res_id) {
+				lo = i + 1;
+			} else {
+				hi = i - 1;
 			}
 		}
+
+		return NULL;
+	}
+
+	for (i = 0; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i].res_id == res_id) {
+			return &obj_inst->resources[i];
+		}
 	}
 
 	return NULL;
 }
 
+/* Ordering of the instance list: by object ID, then by instance ID */
+static int obj_inst_cmp(const struct lwm2m_engine_obj_inst *obj_inst, int obj_id, int obj_inst_id)
+{
+	if (obj_inst->obj->obj_id != obj_id) {
+		return obj_inst->obj->obj_id < obj_id ? -1 : 1;
+	}
+
+	if (obj_inst->obj_inst_id != obj_inst_id) {
+		return obj_inst->obj_inst_id < obj_inst_id ? -1 : 1;
+	}
+
+	return 0;
+}
+
 struct lwm2m_engine_obj *lwm2m_engine_get_obj(const struct lwm2m_obj_path *path)
 {
 	if (path->level < LWM2M_PATH_LEVEL_OBJECT) {
@@ -167,6 +260,8 @@ struct lwm2m_engine_obj *lwm2m_engine_get_obj(const struct lwm2m_obj_path *path)
 
 static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 {
+	struct lwm2m_engine_obj_inst *prev;
+
 #if defined(CONFIG_LWM2M_ACCESS_CONTROL_ENABLE)
 	/* If bootstrap, then bootstrap server should create the ac obj instances */
 #if !defined(CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP)
@@ -175,7 +270,28 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 	access_control_add(obj_inst->obj->obj_id, obj_inst->obj_inst_id, server_obj_inst_id);
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
-	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+	obj_inst->resources_sorted = true;
+	for (int i = 1; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i - 1].res_id >= obj_inst->resources[i].res_id) {
+			obj_inst->resources_sorted = false;
+			break;
+		}
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, prev, node) {
+		struct lwm2m_engine_obj_inst *next = SYS_SLIST_PEEK_NEXT_CONTAINER(prev, node);
+
+		if (next == NULL ||
+		    obj_inst_cmp(next, obj_inst->obj->obj_id, obj_inst->obj_inst_id) > 0) {
+			break;
+		}
+	}
+
+	if (prev == NULL || obj_inst_cmp(prev, obj_inst->obj->obj_id, obj_inst->obj_inst_id) > 0) {
+		sys_slist_prepend(&engine_obj_inst_list, &obj_inst->node);
+	} else {
+		sys_slist_insert(&engine_obj_inst_list, &prev->node, &obj_inst->node);
+	}
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -190,11 +306,17 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
+	int cmp;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
-		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+		cmp = obj_inst_cmp(obj_inst, obj_id, obj_inst_id);
+		if (cmp == 0) {
 			return obj_inst;
 		}
+
+		if (cmp > 0) {
+			break;
+		}
 	}
 
 	return NULL;
@@ -202,16 +324,15 @@ struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 
 struct lwm2m_engine_obj_inst *next_engine_obj_inst(int obj_id, int obj_inst_id)
 {
-	struct lwm2m_engine_obj_inst *obj_inst, *next = NULL;
+	struct lwm2m_engine_obj_inst *obj_inst;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
-		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id > obj_inst_id &&
-		    (!next || next->obj_inst_id > obj_inst->obj_inst_id)) {
-			next = obj_inst;
+		if (obj_inst_cmp(obj_inst, obj_id, obj_inst_id) > 0) {
+			return obj_inst->obj->obj_id == obj_id ? obj_inst : NULL;
 		}
 	}
 
-	return next;
+	return NULL;
 }
 
 int lwm2m_create_obj_inst(uint16_t obj_id, uint16_t obj_inst_id,
@@ -395,13 +516,7 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
-		if (oi->resources[i].res_id == path->res_id) {
-			r = &oi->resources[i];
-			break;
-		}
-	}
-
+	r = engine_obj_inst_res(oi, path->res_id);
 	if (!r) {
 		if (LWM2M_HAS_PERM(of, BIT(LWM2M_FLAG_OPTIONAL))) {
 			LOG_DBG("resource %d not found", path->res_id);
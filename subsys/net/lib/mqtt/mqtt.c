@@ -25,6 +25,10 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	client->internal.batch_cnt = 0U;
+	client->internal.batch_buf_len = 0U;
+#endif
 }
 
 /** @brief Initialize tx buffer. */
@@ -181,11 +185,61 @@ static int client_read(struct mqtt_client *client)
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+/** @brief Send the queued messages, followed by the given message. */
+static int batch_write_msg(struct mqtt_client *client,
+			   const struct msghdr *message)
+{
+	struct mqtt_internal *internal = &client->internal;
+	struct iovec io_vector[ARRAY_SIZE(internal->batch) + 2];
+	struct msghdr msg;
+	size_t count = internal->batch_cnt;
+
+	__ASSERT_NO_MSG(message->msg_iovlen <= 2);
+
+	/* The transport updates the vector on partial writes, work on a copy. */
+	memcpy(io_vector, internal->batch, count * sizeof(io_vector[0]));
+	if (message->msg_iovlen > 0) {
+		memcpy(&io_vector[count], message->msg_iov,
+		       message->msg_iovlen * sizeof(io_vector[0]));
+		count += message->msg_iovlen;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = count;
+
+	internal->batch_cnt = 0U;
+	internal->batch_buf_len = 0U;
+
+	return mqtt_transport_write_msg(client, &msg);
+}
+#endif /* CONFIG_MQTT_PUBLISH_BATCH */
+
+static int client_write_msg(struct mqtt_client *client,
+			    const struct msghdr *message);
+
 static int client_write(struct mqtt_client *client, const uint8_t *data,
 			uint32_t datalen)
 {
 	int err_code;
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if (client->internal.batch_cnt > 0U) {
+		struct iovec io_vector = {
+			.iov_base = (void *)data,
+			.iov_len = datalen,
+		};
+		struct msghdr msg = {
+			.msg_iov = &io_vector,
+			.msg_iovlen = 1,
+		};
+
+		return client_write_msg(client, &msg);
+	}
+#endif
+
 	NET_DBG("[%p]: Transport writing %d bytes.", client, datalen);
 
 	err_code = mqtt_transport_write(client, data, datalen);
@@ -209,7 +263,14 @@ static int client_write_msg(struct mqtt_client *client,
 
 	NET_DBG("[%p]: Transport writing message.", client);
 
-	err_code = mqtt_transport_write_msg(client, message);
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if (client->internal.batch_cnt > 0U) {
+		err_code = batch_write_msg(client, message);
+	} else
+#endif
+	{
+		err_code = mqtt_transport_write_msg(client, message);
+	}
 	if (err_code < 0) {
 		NET_ERR("Transport write failed, err_code = %d, "
 			 "closing connection", err_code);
@@ -344,6 +405,116 @@ error:
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+static int batch_flush(struct mqtt_client *client)
+{
+	struct msghdr msg;
+
+	if (client->internal.batch_cnt == 0U) {
+		return 0;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+
+	return client_write_msg(client, &msg);
+}
+
+static int batch_encode(struct mqtt_client *client,
+			const struct mqtt_publish_param *param)
+{
+	struct mqtt_internal *internal = &client->internal;
+	struct buf_ctx packet;
+	int err_code;
+
+	packet.cur = internal->batch_buf + internal->batch_buf_len;
+	packet.end = internal->batch_buf + sizeof(internal->batch_buf);
+
+	err_code = publish_encode(client, param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	if (internal->batch_cnt == 0U) {
+		internal->batch_start = mqtt_sys_tick_in_ms_get();
+	}
+
+	internal->batch[internal->batch_cnt].iov_base = packet.cur;
+	internal->batch[internal->batch_cnt].iov_len = packet.end - packet.cur;
+	internal->batch[internal->batch_cnt + 1].iov_base = param->message.payload.data;
+	internal->batch[internal->batch_cnt + 1].iov_len = param->message.payload.len;
+	internal->batch_cnt += 2U;
+	internal->batch_buf_len = packet.end - internal->batch_buf;
+
+	return 0;
+}
+
+int mqtt_publish_queue(struct mqtt_client *client,
+		       const struct mqtt_publish_param *param)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
+		 "Data size 0x%08x", client, client->internal.state,
+		 param->message.topic.topic.size,
+		 param->message.payload.len);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	err_code = batch_encode(client, param);
+	if (err_code == -ENOMEM && client->internal.batch_cnt > 0U) {
+		/* No room left for the header, send the batch and retry. */
+		err_code = batch_flush(client);
+		if (err_code < 0) {
+			goto error;
+		}
+
+		err_code = batch_encode(client, param);
+	}
+
+	if (err_code < 0) {
+		goto error;
+	}
+
+	if (client->internal.batch_cnt == ARRAY_SIZE(client->internal.batch)) {
+		err_code = batch_flush(client);
+	}
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+			 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
+int mqtt_flush(struct mqtt_client *client)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+	if (err_code == 0) {
+		err_code = batch_flush(client);
+	}
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+#endif /* CONFIG_MQTT_PUBLISH_BATCH */
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -711,6 +882,18 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if (client->internal.batch_cnt > 0U &&
+	    mqtt_elapsed_time_in_ms_get(client->internal.batch_start) >=
+	    CONFIG_MQTT_PUBLISH_BATCH_FLUSH_TIMEOUT) {
+		err_code = batch_flush(client);
+		if (err_code < 0) {
+			mqtt_mutex_unlock(client);
+			return err_code;
+		}
+	}
+#endif
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
@@ -733,17 +916,25 @@ int mqtt_keepalive_time_left(const struct mqtt_client *client)
 	uint32_t elapsed_time = mqtt_elapsed_time_in_ms_get(
 					client->internal.last_activity);
 	uint32_t keepalive_ms = 1000U * client->keepalive;
+	int time_left = -1;
 
-	if (client->keepalive == 0) {
-		/* Keep alive not enabled. */
-		return -1;
+	if (client->keepalive > 0) {
+		time_left = (keepalive_ms <= elapsed_time) ? 0 : keepalive_ms - elapsed_time;
 	}
 
-	if (keepalive_ms <= elapsed_time) {
-		return 0;
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+	if (client->internal.batch_cnt > 0U) {
+		uint32_t queued = mqtt_elapsed_time_in_ms_get(client->internal.batch_start);
+		int flush_left = (queued >= CONFIG_MQTT_PUBLISH_BATCH_FLUSH_TIMEOUT) ?
+				 0 : CONFIG_MQTT_PUBLISH_BATCH_FLUSH_TIMEOUT - queued;
+
+		if (time_left < 0 || flush_left < time_left) {
+			time_left = flush_left;
+		}
 	}
+#endif
 
-	return keepalive_ms - elapsed_time;
+	return time_left;
 }
 
 int mqtt_input(struct mqtt_client *client)
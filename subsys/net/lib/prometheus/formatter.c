@@ -51,6 +51,10 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 {
 	int ret = 0;
 
+	if (metric->aggregate != NULL) {
+		metric->aggregate(metric);
+	}
+
 	/* write HELP line if available */
 	if (metric->description[0] != '\0') {
 		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net/prometheus/percpu.h>
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(pm_percpu, CONFIG_PROMETHEUS_LOG_LEVEL);
+
+/*
+ * The slots are read while their CPU may be updating them. A word is read
+ * in one go, so only the words of a histogram slot can be seen out of step
+ * with each other, which the next scrape makes up for.
+ */
+static unsigned long slot_fold(volatile unsigned long *value, unsigned long *folded)
+{
+	unsigned long now = *value;
+	unsigned long delta = now - *folded;
+
+	*folded = now;
+
+	return delta;
+}
+
+void z_prometheus_percpu_counter_aggregate(struct prometheus_metric *metric)
+{
+	struct prometheus_counter *counter = CONTAINER_OF(metric, struct prometheus_counter, base);
+	struct prometheus_percpu_counter *percpu =
+		CONTAINER_OF(counter, struct prometheus_percpu_counter, counter);
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		counter->value += slot_fold(&percpu->slots[cpu].value, &percpu->slots[cpu].folded);
+	}
+
+	LOG_DBG("counter->value: %llu", counter->value);
+}
+
+void z_prometheus_percpu_histogram_aggregate(struct prometheus_metric *metric)
+{
+	struct prometheus_histogram *histogram =
+		CONTAINER_OF(metric, struct prometheus_histogram, base);
+	struct prometheus_percpu_histogram *percpu =
+		CONTAINER_OF(histogram, struct prometheus_percpu_histogram, histogram);
+	const size_t n = histogram->num_buckets;
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		unsigned long *slot = &percpu->slots[cpu * percpu->stride];
+		unsigned long *folded = &percpu->folded[cpu * (n + 2)];
+		unsigned long cumulative = 0;
+
+		/* Observations are counted in their own bucket only, the
+		 * Prometheus buckets are cumulative
+		 */
+		for (size_t i = 0; i < n; i++) {
+			cumulative += slot_fold(&slot[i], &folded[i]);
+			histogram->buckets[i].count += cumulative;
+		}
+
+		histogram->count += slot_fold(&slot[n], &folded[n]);
+		histogram->sum += slot_fold(&slot[n + 1], &folded[n + 1]);
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		histogram->buckets[i].upper_bound = percpu->bounds[i];
+	}
+
+	LOG_DBG("histogram->count: %lu", histogram->count);
+}
+
+void prometheus_percpu_histogram_observe(struct prometheus_percpu_histogram *histogram,
+					 uint32_t value)
+{
+	const size_t n = histogram->histogram.num_buckets;
+	unsigned long *slot;
+	unsigned int key;
+	size_t i = 0;
+
+	while (i < n && value > histogram->bounds[i]) {
+		i++;
+	}
+
+	key = arch_irq_lock();
+
+	slot = &histogram->slots[z_prometheus_percpu_id() * histogram->stride];
+
+	/* Above the last bound, only in the count and the sum */
+	if (i < n) {
+		slot[i]++;
+	}
+
+	slot[n]++;
+	slot[n + 1] += value;
+
+	arch_irq_unlock(key);
+}
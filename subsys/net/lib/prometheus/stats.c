@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net/prometheus/stats.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/stats/stats.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(pm_stats, CONFIG_PROMETHEUS_LOG_LEVEL);
+
+struct stats_lookup {
+	const char *name;
+	uint64_t value;
+};
+
+static int stats_lookup_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
+{
+	struct stats_lookup *lookup = arg;
+	const uint8_t *ptr = (const uint8_t *)hdr + off;
+
+	if (strcmp(name, lookup->name) != 0) {
+		return 0;
+	}
+
+	switch (hdr->s_size) {
+	case sizeof(uint16_t):
+		lookup->value = *(const uint16_t *)ptr;
+		break;
+	case sizeof(uint32_t):
+		lookup->value = *(const uint32_t *)ptr;
+		break;
+	case sizeof(uint64_t):
+		lookup->value = *(const uint64_t *)ptr;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 1;
+}
+
+int prometheus_stats_scrape(struct prometheus_collector *collector,
+			    struct prometheus_metric *metric, void *user_data)
+{
+	const struct prometheus_stats_entry *entry;
+	struct prometheus_counter *counter;
+	struct stats_lookup lookup;
+	struct stats_hdr *hdr;
+	int ret;
+
+	ARG_UNUSED(collector);
+	ARG_UNUSED(user_data);
+
+	if (metric->type != PROMETHEUS_COUNTER) {
+		return 0;
+	}
+
+	counter = CONTAINER_OF(metric, struct prometheus_counter, base);
+	entry = counter->user_data;
+	if (entry == NULL) {
+		return 0;
+	}
+
+	hdr = stats_group_find(entry->group);
+	if (hdr == NULL) {
+		LOG_DBG("Stats group %s not found", entry->group);
+		return -EAGAIN;
+	}
+
+	lookup.name = entry->name;
+
+	ret = stats_walk(hdr, stats_lookup_cb, &lookup);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret == 0) {
+		LOG_DBG("Stats entry %s/%s not found", entry->group, entry->name);
+		return -EAGAIN;
+	}
+
+	/* A group that was reset shows as a counter reset */
+	counter->value = lookup.value;
+
+	return 0;
+}
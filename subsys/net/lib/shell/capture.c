@@ -14,6 +14,10 @@ LOG_MODULE_DECLARE(net_shell);
 
 #include <zephyr/net/capture.h>
 
+#if defined(CONFIG_NET_CAPTURE_LOCAL) && defined(CONFIG_FILE_SYSTEM)
+#include <zephyr/fs/fs.h>
+#endif
+
 #if defined(CONFIG_NET_CAPTURE)
 #define DEFAULT_DEV_NAME "NET_CAPTURE0"
 static const struct device *capture_dev;
@@ -249,6 +253,104 @@ static int cmd_net_capture_disable(const struct shell *sh, size_t argc, char *ar
 	return 0;
 }
 
+#if defined(CONFIG_NET_CAPTURE_LOCAL)
+static int cmd_net_capture_local_start(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct net_if *iface;
+	int if_index;
+	int snaplen = 0;
+	int ret;
+
+	if_index = atoi(argv[1]);
+	iface = net_if_get_by_index(if_index);
+	if (iface == NULL) {
+		PR_WARNING("No such interface with index %d\n", if_index);
+		return -ENOEXEC;
+	}
+
+	if (argc > 2) {
+		snaplen = atoi(argv[2]);
+		if (snaplen <= 0 || snaplen > UINT16_MAX) {
+			PR_WARNING("Invalid snap length %s\n", argv[2]);
+			return -ENOEXEC;
+		}
+	}
+
+	ret = net_capture_local_enable(iface, snaplen);
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "start", ret);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
+static int cmd_net_capture_local_stop(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct net_capture_local_stats stats;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	(void)net_capture_local_disable();
+
+	net_capture_local_stats_get(&stats);
+	PR("Captured %u packets, %u overwritten, %zu bytes\n", stats.packets,
+	   stats.overwritten, stats.size);
+
+	return 0;
+}
+
+#if defined(CONFIG_FILE_SYSTEM)
+static int capture_save_cb(const void *data, size_t len, void *user_data)
+{
+	ssize_t ret = fs_write(user_data, data, len);
+
+	return ret < 0 ? ret : (ret == len ? 0 : -ENOSPC);
+}
+
+static int cmd_net_capture_local_save(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct fs_file_t file;
+	int ret;
+
+	ARG_UNUSED(argc);
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, argv[1], FS_O_CREATE | FS_O_WRITE | FS_O_TRUNC);
+	if (ret < 0) {
+		PR_WARNING("Cannot open %s (%d)\n", argv[1], ret);
+		return -ENOEXEC;
+	}
+
+	ret = net_capture_local_export(capture_save_cb, &file);
+	(void)fs_close(&file);
+
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "save", ret);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_FILE_SYSTEM */
+
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture_local,
+	SHELL_CMD_ARG(start, NULL, "Capture packets to the local pcapng ring.\n"
+		      "'net capture local start <interface index> [snaplen]'",
+		      cmd_net_capture_local_start, 2, 1),
+	SHELL_CMD(stop, NULL, "Stop the local capture.",
+		  cmd_net_capture_local_stop),
+#if defined(CONFIG_FILE_SYSTEM)
+	SHELL_CMD_ARG(save, NULL, "Save the local capture to a pcapng file.\n"
+		      "'net capture local save <path>'",
+		      cmd_net_capture_local_save, 2, 0),
+#endif
+	SHELL_SUBCMD_SET_END
+);
+#endif /* CONFIG_NET_CAPTURE_LOCAL */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 	SHELL_CMD(setup, NULL, "Setup network packet capture.\n"
 		  "'net capture setup <remote-ip-addr> <local-addr> <peer-addr>'\n"
@@ -266,6 +368,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 		  cmd_net_capture_enable),
 	SHELL_CMD(disable, NULL, "Disable network packet capture.",
 		  cmd_net_capture_disable),
+#if defined(CONFIG_NET_CAPTURE_LOCAL)
+	SHELL_CMD(local, &net_cmd_capture_local,
+		  "Capture to a local pcapng ring that can be saved to a file.",
+		  NULL),
+#endif
 	SHELL_SUBCMD_SET_END
 );
 
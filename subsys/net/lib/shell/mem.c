@@ -117,10 +117,10 @@ static int cmd_net_mem(const struct shell *sh, size_t argc, char *argv[])
 	PR("Address\t\tTotal\tAvail\tMaxUsed\tName\n");
 #if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 	PR("%p\t%d\t%u\t%u\tRX\n", rx, rx->info.num_blocks,
-	   k_mem_slab_num_free_get(rx), rx->info.max_used);
+	   k_mem_slab_num_free_get(rx), k_mem_slab_max_used_get(rx));
 
 	PR("%p\t%d\t%u\t%u\tTX\n", tx, tx->info.num_blocks,
-	   k_mem_slab_num_free_get(tx), tx->info.max_used);
+	   k_mem_slab_num_free_get(tx), k_mem_slab_max_used_get(tx));
 #else
 	PR("%p\t%d\t%u\t-\tRX\n",
 	       rx, rx->info.num_blocks, k_mem_slab_num_free_get(rx));
@@ -574,6 +574,13 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 		      (GET_STAT(iface, pkt_filter.rx.local_drop),))
 	   GET_STAT(iface, pkt_filter.tx.drop));
 #endif /* CONFIG_NET_STATISTICS_DNS */
+#if defined(CONFIG_NET_STATISTICS_PKT_QUOTA)
+	PR("Quota drop rx  %u\tearly\t%u\ttx\t%u\tearly\t%u\n",
+	   GET_STAT(iface, pkt_quota.rx.drop),
+	   GET_STAT(iface, pkt_quota.rx.early_drop),
+	   GET_STAT(iface, pkt_quota.tx.drop),
+	   GET_STAT(iface, pkt_quota.tx.early_drop));
+#endif /* CONFIG_NET_STATISTICS_PKT_QUOTA */
 
 	PR("Bytes received %llu\n", GET_STAT(iface, bytes.received));
 	PR("Bytes sent     %llu\n", GET_STAT(iface, bytes.sent));
@@ -47,6 +47,9 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -68,6 +71,12 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #define DTLS_SENDMSG_BUF_SIZE 0
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CORK_BUF_SIZE)
+#define TLS_CORK_BUF_SIZE (CONFIG_NET_SOCKETS_TLS_CORK_BUF_SIZE)
+#else
+#define TLS_CORK_BUF_SIZE 0
+#endif /* CONFIG_NET_SOCKETS_TLS_CORK_BUF_SIZE */
+
 static const struct socket_op_vtable tls_sock_fd_op_vtable;
 
 #ifndef MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED
@@ -107,6 +116,11 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Peer hostname, stored after the session data, or NULL if the
+	 *  session is identified by the peer address.
+	 */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -143,6 +157,9 @@ __net_socket struct tls_context {
 	/** Session ended at the TLS/DTLS level. */
 	bool session_closed : 1;
 
+	/** Small writes are buffered into full records (TLS_CORK). */
+	bool is_corked : 1;
+
 	/** Socket type. */
 	enum net_sock_type type;
 
@@ -246,6 +263,14 @@ __net_socket struct tls_context {
 #endif /* MBEDTLS_X509_CRT_PARSE_C */
 
 #endif /* CONFIG_MBEDTLS */
+
+#if TLS_CORK_BUF_SIZE > 0
+	/** Length of the data waiting in cork_buf. */
+	size_t cork_len;
+
+	/** Plaintext waiting to be sent as one record. */
+	uint8_t cork_buf[TLS_CORK_BUF_SIZE];
+#endif
 };
 
 
@@ -258,6 +283,11 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+static mbedtls_ssl_ticket_context server_tickets;
+static bool server_tickets_ready;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -377,6 +407,10 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	mbedtls_ssl_ticket_init(&server_tickets);
+#endif
+
 	return 0;
 }
 
@@ -575,10 +609,56 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+static uint16_t peer_port(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return net_sin6(addr)->sin6_port;
+	}
+
+	return net_sin(addr)->sin_port;
+}
+
+/* Sessions of sockets with a hostname are identified by hostname and port,
+ * so that they can be resumed with any of the server addresses.
+ */
+static bool tls_session_match(const struct tls_session_cache *entry,
+			      const struct sockaddr *peer_addr,
+			      const char *hostname)
+{
+	if (entry->session == NULL) {
+		return false;
+	}
+
+	if (hostname != NULL) {
+		return entry->hostname != NULL &&
+		       strcmp(entry->hostname, hostname) == 0 &&
+		       peer_port(&entry->peer_addr) == peer_port(peer_addr);
+	}
+
+	return entry->hostname == NULL &&
+	       peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
+static const char *tls_session_hostname(struct tls_context *context)
+{
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (context->options.is_hostname_set &&
+	    context->ssl.hostname != NULL && context->ssl.hostname[0] != '\0') {
+		return context->ssl.hostname;
+	}
+#else
+	ARG_UNUSED(context);
+#endif
+
+	return NULL;
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
+	size_t hostname_len = hostname != NULL ? strlen(hostname) + 1 : 0;
 	size_t session_len;
 	int ret;
 
@@ -589,7 +669,8 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+			if (tls_session_match(&client_cache[i], peer_addr,
+					      hostname)) {
 				/* Reuse old entry for given address. */
 				entry = &client_cache[i];
 				break;
@@ -609,11 +690,12 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 	if (entry->session != NULL) {
 		mbedtls_free(entry->session);
 		entry->session = NULL;
+		entry->hostname = NULL;
 	}
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
 
-	entry->session = mbedtls_calloc(1, session_len);
+	entry->session = mbedtls_calloc(1, session_len + hostname_len);
 	if (entry->session == NULL) {
 		NET_ERR("Failed to allocate session buffer.");
 		return -ENOMEM;
@@ -628,6 +710,11 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 		return -ENOMEM;
 	}
 
+	if (hostname != NULL) {
+		entry->hostname = (char *)entry->session + session_len;
+		memcpy(entry->hostname, hostname, hostname_len);
+	}
+
 	entry->session_len = session_len;
 	entry->timestamp = k_uptime_get();
 	memcpy(&entry->peer_addr, peer_addr, sizeof(*peer_addr));
@@ -636,14 +723,14 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
 	int ret;
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
-		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		if (tls_session_match(&client_cache[i], peer_addr, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -659,6 +746,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 		/* Discard corrupted session data. */
 		mbedtls_free(entry->session);
 		entry->session = NULL;
+		entry->hostname = NULL;
 		NET_ERR("Failed to load TLS session %d", ret);
 		return -EIO;
 	}
@@ -687,7 +775,8 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, tls_session_hostname(context),
+			       &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -711,7 +800,8 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, tls_session_hostname(context),
+			      &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -726,10 +816,43 @@ exit:
 	mbedtls_ssl_session_free(&session);
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+static int tls_server_tickets_setup(void)
+{
+	int ret = 0;
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	if (!server_tickets_ready) {
+		ret = mbedtls_ssl_ticket_setup(&server_tickets, tls_ctr_drbg_random,
+					       NULL, MBEDTLS_CIPHER_AES_256_GCM,
+					       CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME);
+		if (ret != 0) {
+			NET_ERR("Failed to set up session tickets, err: -0x%x", -ret);
+		} else {
+			server_tickets_ready = true;
+		}
+	}
+
+	k_mutex_unlock(&context_lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS */
+
 static void tls_session_purge(void)
 {
 	tls_session_cache_reset();
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	/* New keys are generated on next use, outstanding tickets become
+	 * invalid.
+	 */
+	mbedtls_ssl_ticket_free(&server_tickets);
+	mbedtls_ssl_ticket_init(&server_tickets);
+	server_tickets_ready = false;
+#endif
+
 #if defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
@@ -1425,6 +1548,18 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TICKETS)
+	if (is_server && context->options.cache_enabled) {
+		ret = tls_server_tickets_setup();
+		if (ret == 0) {
+			mbedtls_ssl_conf_session_tickets_cb(&context->config,
+							    mbedtls_ssl_ticket_write,
+							    mbedtls_ssl_ticket_parse,
+							    &server_tickets);
+		}
+	}
+#endif
+
 #if defined(MBEDTLS_SSL_EARLY_DATA)
 	mbedtls_ssl_conf_early_data(&context->config, MBEDTLS_SSL_EARLY_DATA_ENABLED);
 #endif
@@ -1981,6 +2116,55 @@ static int tls_opt_session_cache_purge_set(struct tls_context *context,
 	return 0;
 }
 
+#if TLS_CORK_BUF_SIZE > 0
+static int tls_cork_flush(struct tls_context *ctx, int flags);
+#endif
+
+static int tls_opt_cork_set(struct tls_context *context,
+			    const void *optval, socklen_t optlen)
+{
+#if TLS_CORK_BUF_SIZE > 0
+	if (!optval || optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	if (context->type != SOCK_STREAM) {
+		return -EOPNOTSUPP;
+	}
+
+	if (*(const int *)optval != 0) {
+		context->is_corked = true;
+		return 0;
+	}
+
+	context->is_corked = false;
+
+	return tls_cork_flush(context, 0);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(optval);
+	ARG_UNUSED(optlen);
+
+	return -ENOPROTOOPT;
+#endif /* TLS_CORK_BUF_SIZE > 0 */
+}
+
+static int tls_opt_cork_get(struct tls_context *context,
+			    void *optval, socklen_t *optlen)
+{
+	if (TLS_CORK_BUF_SIZE == 0) {
+		return -ENOPROTOOPT;
+	}
+
+	if (*optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = context->is_corked ? 1 : 0;
+
+	return 0;
+}
+
 static int tls_opt_peer_verify_set(struct tls_context *context,
 				   const void *optval, socklen_t optlen)
 {
@@ -2175,6 +2359,12 @@ int ztls_close_ctx(struct tls_context *ctx, int sock)
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
+#if TLS_CORK_BUF_SIZE > 0
+	if (ctx->cork_len > 0) {
+		(void)tls_cork_flush(ctx, 0);
+	}
+#endif
+
 	(void)mbedtls_ssl_close_notify(&ctx->ssl);
 
 	err = tls_release(ctx);
@@ -2413,6 +2603,58 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 	return -1;
 }
 
+#if TLS_CORK_BUF_SIZE > 0
+/* Send the buffered plaintext. What could not be sent stays at the start of
+ * the buffer, as mbedTLS expects the same data on a retried write.
+ */
+static int tls_cork_flush(struct tls_context *ctx, int flags)
+{
+	size_t sent = 0;
+	ssize_t ret;
+
+	while (sent < ctx->cork_len) {
+		ret = send_tls(ctx, ctx->cork_buf + sent, ctx->cork_len - sent,
+			       flags);
+		if (ret < 0) {
+			memmove(ctx->cork_buf, ctx->cork_buf + sent,
+				ctx->cork_len - sent);
+			ctx->cork_len -= sent;
+			return -errno;
+		}
+
+		sent += ret;
+	}
+
+	ctx->cork_len = 0;
+
+	return 0;
+}
+
+static ssize_t send_tls_corked(struct tls_context *ctx, const void *buf,
+			       size_t len, int flags)
+{
+	int ret;
+
+	if (ctx->cork_len + len > sizeof(ctx->cork_buf)) {
+		ret = tls_cork_flush(ctx, flags);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	/* Data that fills a record by itself does not need the copy. */
+	if (len >= sizeof(ctx->cork_buf)) {
+		return send_tls(ctx, buf, len, flags);
+	}
+
+	memcpy(ctx->cork_buf + ctx->cork_len, buf, len);
+	ctx->cork_len += len;
+
+	return len;
+}
+#endif /* TLS_CORK_BUF_SIZE > 0 */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 				  size_t len, int flags,
@@ -2506,6 +2748,11 @@ ssize_t ztls_sendto_ctx(struct tls_context *ctx, const void *buf, size_t len,
 
 	/* TLS */
 	if (ctx->type == SOCK_STREAM) {
+#if TLS_CORK_BUF_SIZE > 0
+		if (ctx->is_corked) {
+			return send_tls_corked(ctx, buf, len, flags);
+		}
+#endif
 		return send_tls(ctx, buf, len, flags);
 	}
 
@@ -2598,6 +2845,12 @@ ssize_t ztls_sendmsg_ctx(struct tls_context *ctx, const struct msghdr *msg,
 		return -1;
 	}
 
+	/* Data is encrypted into TLS records, so it is always copied */
+	if (flags & ZSOCK_MSG_ZEROCOPY) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
 	if (IS_ENABLED(CONFIG_NET_SOCKETS_ENABLE_DTLS) &&
 	    ctx->type == SOCK_DGRAM) {
 		if (DTLS_SENDMSG_BUF_SIZE > 0) {
@@ -2622,6 +2875,31 @@ ssize_t ztls_sendmsg_ctx(struct tls_context *ctx, const struct msghdr *msg,
 		}
 	}
 
+#if TLS_CORK_BUF_SIZE > 0
+	/* Coalesce the buffers of a blocking call into as few records as
+	 * possible. Non-blocking calls are not, as the data left in the
+	 * buffer on EAGAIN would not be sent before the next call.
+	 */
+	if (ctx->type == SOCK_STREAM && !ctx->is_corked &&
+	    msghdr_non_empty_iov_count(msg) > 1 &&
+	    is_blocking(ctx->sock, flags)) {
+		ssize_t len;
+		int ret;
+
+		ctx->is_corked = true;
+		len = tls_sendmsg_loop_and_send(ctx, msg, flags);
+		ctx->is_corked = false;
+
+		ret = tls_cork_flush(ctx, flags);
+		if (len >= 0 && ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+
+		return len;
+	}
+#endif /* TLS_CORK_BUF_SIZE > 0 */
+
 send_loop:
 	return tls_sendmsg_loop_and_send(ctx, msg, flags);
 }
@@ -3553,6 +3831,10 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_get(ctx, optval, optlen);
 		break;
 
+	case TLS_CORK:
+		err = tls_opt_cork_get(ctx, optval, optlen);
+		break;
+
 	case TLS_CERT_VERIFY_RESULT:
 		err = tls_opt_cert_verify_result_get(ctx, optval, optlen);
 		break;
@@ -3679,6 +3961,10 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_purge_set(ctx, optval, optlen);
 		break;
 
+	case TLS_CORK:
+		err = tls_opt_cork_set(ctx, optval, optlen);
+		break;
+
 	case TLS_CERT_VERIFY_CALLBACK:
 		err = tls_opt_cert_verify_callback_set(ctx, optval, optlen);
 		break;
@@ -7,6 +7,7 @@
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/sys/math_extras.h>
 
 #include "zperf_internal.h"
 #include "zperf_session.h"
@@ -99,6 +100,46 @@ void start_jobs(void)
 {
 	k_event_set(&start_event, START_EVENT);
 }
+
+int zperf_thread_cpu_mask_set(k_tid_t tid, uint32_t cpu_mask)
+{
+#if defined(CONFIG_SCHED_CPU_MASK)
+	int ret;
+
+	/* The work queue threads are reused by the sessions, so an earlier
+	 * affinity must be dropped when none is requested.
+	 */
+	if (cpu_mask == 0U) {
+		if (IS_ENABLED(CONFIG_SCHED_CPU_MASK_PIN_ONLY)) {
+			return 0;
+		}
+
+		return k_thread_cpu_mask_enable_all(tid);
+	}
+
+	if ((cpu_mask & (cpu_mask - 1U)) == 0U) {
+		return k_thread_cpu_pin(tid, u32_count_trailing_zeros(cpu_mask));
+	}
+
+	if (IS_ENABLED(CONFIG_SCHED_CPU_MASK_PIN_ONLY)) {
+		return -EINVAL;
+	}
+
+	ret = k_thread_cpu_mask_clear(tid);
+
+	for (int cpu = 0; ret == 0 && cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if ((cpu_mask & BIT(cpu)) != 0U) {
+			ret = k_thread_cpu_mask_enable(tid, cpu);
+		}
+	}
+
+	return ret;
+#else
+	ARG_UNUSED(tid);
+
+	return cpu_mask == 0U ? 0 : -ENOTSUP;
+#endif
+}
 #else /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 K_THREAD_STACK_DEFINE(zperf_work_q_stack, CONFIG_ZPERF_WORK_Q_STACK_SIZE);
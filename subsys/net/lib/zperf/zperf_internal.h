@@ -127,6 +127,10 @@ struct zperf_work {
 #define START_EVENT 0x0001
 extern void start_jobs(void);
 extern struct zperf_work *get_queue(enum session_proto proto, int session_id);
+int zperf_thread_cpu_mask_set(k_tid_t tid, uint32_t cpu_mask);
+
+/* Upper limit of the packets sent with a single sendmsg() call */
+#define ZPERF_SEND_BATCH_MAX 16
 
 int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, uint8_t tos,
 			      int priority, int tcp_nodelay, int proto);
@@ -73,6 +73,9 @@ static struct in6_addr shell_ipv6;
 
 static struct in_addr shell_ipv4;
 
+/* Print the upload results as one JSON object per line, for scripts */
+static bool json_output;
+
 #define DEVICE_NAME "zperf shell"
 
 const uint32_t TIME_US[] = { 60 * 1000 * 1000, 1000 * 1000, 1000, 0 };
@@ -489,6 +492,41 @@ static int cmd_udp_download(const struct shell *sh, size_t argc,
 
 #endif
 
+static void shell_upload_print_json(const struct shell *sh,
+				    struct zperf_results *results,
+				    bool is_udp, bool is_async)
+{
+	uint64_t client_rate_in_kbps = 0U;
+	int id = -1;
+
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+	if (is_async) {
+		id = CONTAINER_OF(results, struct session, result)->id;
+	}
+#else
+	ARG_UNUSED(is_async);
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
+
+	if (results->client_time_in_us != 0U) {
+		client_rate_in_kbps =
+			((uint64_t)results->nb_packets_sent * results->packet_size *
+			 8U * USEC_PER_SEC) / (results->client_time_in_us * 1000U);
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "{\"proto\":\"%s\",\"session\":%d,\"packet_size\":%u,"
+		      "\"packets_sent\":%u,\"packets_rcvd\":%u,\"packets_lost\":%u,"
+		      "\"packets_outorder\":%u,\"errors\":%u,\"bytes_rcvd\":%llu,"
+		      "\"time_us\":%llu,\"client_time_us\":%llu,\"jitter_us\":%u,"
+		      "\"client_rate_kbps\":%llu}\n",
+		      is_udp ? "udp" : "tcp", id, results->packet_size,
+		      results->nb_packets_sent, results->nb_packets_rcvd,
+		      results->nb_packets_lost, results->nb_packets_outorder,
+		      results->nb_packets_errors, results->total_len,
+		      results->time_in_us, results->client_time_in_us,
+		      results->jitter_in_us, client_rate_in_kbps);
+}
+
 static void shell_udp_upload_print_stats(const struct shell *sh,
 					 struct zperf_results *results,
 					 bool is_async)
@@ -496,6 +534,11 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 	if (IS_ENABLED(CONFIG_NET_UDP)) {
 		uint64_t rate_in_kbps, client_rate_in_kbps;
 
+		if (json_output) {
+			shell_upload_print_json(sh, results, true, is_async);
+			return;
+		}
+
 		shell_fprintf(sh, SHELL_NORMAL, "-\nUpload completed!\n");
 
 		if (results->time_in_us != 0U) {
@@ -584,6 +627,11 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 	if (IS_ENABLED(CONFIG_NET_TCP)) {
 		uint64_t client_rate_in_kbps;
 
+		if (json_output) {
+			shell_upload_print_json(sh, results, false, is_async);
+			return;
+		}
+
 		shell_fprintf(sh, SHELL_NORMAL, "-\nUpload completed!\n");
 
 		if (results->client_time_in_us != 0U) {
@@ -796,9 +844,23 @@ static void send_ping(const struct shell *sh,
 	(void)net_icmp_cleanup_ctx(&ctx);
 }
 
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+/* The streams started by one command are spread over the CPUs, starting
+ * from the requested one.
+ */
+static uint32_t stream_cpu_mask(uint32_t cpu_mask, int stream)
+{
+	if (cpu_mask == 0U) {
+		return 0U;
+	}
+
+	return BIT((find_lsb_set(cpu_mask) - 1 + stream) % arch_num_cpus());
+}
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
+
 static int execute_upload(const struct shell *sh,
 			  const struct zperf_upload_params *param,
-			  bool is_udp, bool async)
+			  bool is_udp, bool async, int streams)
 {
 	struct zperf_results results = { 0 };
 	int ret;
@@ -813,6 +875,10 @@ static int execute_upload(const struct shell *sh,
 	print_number(sh, param->rate_kbps, KBPS, KBPS_UNIT);
 	shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+	if (streams > 1) {
+		shell_fprintf(sh, SHELL_NORMAL, "Streams:\t%d\n", streams);
+	}
+
 	if (IS_ENABLED(CONFIG_ZPERF_SESSION_PER_THREAD) &&
 	    COND_CODE_1(CONFIG_ZPERF_SESSION_PER_THREAD,
 			(param->options.wait_for_start), (0))) {
@@ -874,12 +940,21 @@ static int execute_upload(const struct shell *sh,
 
 	if (!is_udp && IS_ENABLED(CONFIG_NET_TCP)) {
 		if (async) {
-			ret = zperf_tcp_upload_async(param, tcp_upload_cb,
-						     (void *)sh);
-			if (ret < 0) {
-				shell_fprintf(sh, SHELL_ERROR,
-					"Failed to start TCP async upload (%d)\n", ret);
-				return ret;
+			struct zperf_upload_params stream_param = *param;
+
+			for (int i = 0; i < streams; i++) {
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+				stream_param.options.cpu_mask =
+					stream_cpu_mask(param->options.cpu_mask, i);
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
+
+				ret = zperf_tcp_upload_async(&stream_param, tcp_upload_cb,
+							     (void *)sh);
+				if (ret < 0) {
+					shell_fprintf(sh, SHELL_ERROR,
+						"Failed to start TCP async upload (%d)\n", ret);
+					return ret;
+				}
 			}
 		} else {
 			ret = zperf_tcp_upload(param, &results);
@@ -962,6 +1037,7 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 	size_t opt_cnt = 0;
 	int ret;
 	int seconds;
+	int streams = 1;
 
 	param.unix_offset_us = k_uptime_get() * USEC_PER_MSEC;
 	param.options.priority = -1;
@@ -1021,6 +1097,62 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			break;
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
+		case 'b': {
+			int batch = parse_arg(&i, argc, argv);
+
+			if (is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "UDP does not support -b option\n");
+				return -ENOEXEC;
+			}
+			if (batch < 1 || batch > ZPERF_SEND_BATCH_MAX) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.send_batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+		case 'P':
+			streams = parse_arg(&i, argc, argv);
+
+			if (is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "UDP does not support -P option\n");
+				return -ENOEXEC;
+			}
+			if (streams < 1 || streams > CONFIG_NET_ZPERF_MAX_SESSIONS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			opt_cnt += 2;
+			async = true;
+			break;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		case 'c': {
+			int cpu = parse_arg(&i, argc, argv);
+
+			if (cpu < 0 || cpu >= arch_num_cpus()) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.cpu_mask = BIT(cpu);
+			opt_cnt += 2;
+			async = true;
+			break;
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
+
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		case 'p':
 			param.options.priority = parse_arg(&i, argc, argv);
@@ -1193,7 +1325,7 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 		param.rate_kbps = DEF_RATE_KBPS;
 	}
 
-	return execute_upload(sh, &param, is_udp, async);
+	return execute_upload(sh, &param, is_udp, async, streams);
 }
 
 static int cmd_tcp_upload(const struct shell *sh, size_t argc, char *argv[])
@@ -1216,6 +1348,7 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 	int start = 0;
 	size_t opt_cnt = 0;
 	int seconds;
+	int streams = 1;
 
 	param.unix_offset_us = k_uptime_get() * USEC_PER_MSEC;
 	is_udp = proto == IPPROTO_UDP;
@@ -1274,6 +1407,62 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			break;
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
+		case 'b': {
+			int batch = parse_arg(&i, argc, argv);
+
+			if (is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "UDP does not support -b option\n");
+				return -ENOEXEC;
+			}
+			if (batch < 1 || batch > ZPERF_SEND_BATCH_MAX) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.send_batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+		case 'P':
+			streams = parse_arg(&i, argc, argv);
+
+			if (is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "UDP does not support -P option\n");
+				return -ENOEXEC;
+			}
+			if (streams < 1 || streams > CONFIG_NET_ZPERF_MAX_SESSIONS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			opt_cnt += 2;
+			async = true;
+			break;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		case 'c': {
+			int cpu = parse_arg(&i, argc, argv);
+
+			if (cpu < 0 || cpu >= arch_num_cpus()) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.cpu_mask = BIT(cpu);
+			opt_cnt += 2;
+			async = true;
+			break;
+		}
+#endif /* CONFIG_SCHED_CPU_MASK */
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
+
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		case 'p':
 			param.options.priority = parse_arg(&i, argc, argv);
@@ -1399,7 +1588,7 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 		param.rate_kbps = DEF_RATE_KBPS;
 	}
 
-	return execute_upload(sh, &param, is_udp, async);
+	return execute_upload(sh, &param, is_udp, async, streams);
 }
 
 static int cmd_tcp_upload2(const struct shell *sh, size_t argc,
@@ -1561,6 +1750,26 @@ static int cmd_tcp_download(const struct shell *sh, size_t argc,
 
 #endif
 
+static int cmd_output(const struct shell *sh, size_t argc, char *argv[])
+{
+	if (argc < 2) {
+		shell_fprintf(sh, SHELL_NORMAL, "Output format: %s\n",
+			      json_output ? "json" : "text");
+		return 0;
+	}
+
+	if (strcmp(argv[1], "json") == 0) {
+		json_output = true;
+	} else if (strcmp(argv[1], "text") == 0) {
+		json_output = false;
+	} else {
+		shell_fprintf(sh, SHELL_WARNING, "Unknown format: %s\n", argv[1]);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
 static int cmd_version(const struct shell *sh, size_t argc, char *argv[])
 {
 	shell_fprintf(sh, SHELL_NORMAL, "Version: %s\nConfig: %s\n",
@@ -1914,6 +2123,13 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+		  "-b count: Send count packets with each sendmsg() call\n"
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+		  "-P streams: Number of parallel streams (async only)\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Pin the streams to CPUs starting from cpu (async only)\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 		  "Example: tcp upload 192.0.2.2 1111 1 1K\n"
 		  "Example: tcp upload 2001:db8::2\n",
 		  cmd_tcp_upload),
@@ -1938,6 +2154,13 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+		  "-b count: Send count packets with each sendmsg() call\n"
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+		  "-P streams: Number of parallel streams (async only)\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Pin the streams to CPUs starting from cpu (async only)\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
+#endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 		  "Example: tcp upload2 v6 1 1K\n"
 		  "Example: tcp upload2 v4\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
@@ -1987,6 +2210,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Pin the upload to the CPU (async only)\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -2012,6 +2238,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+#ifdef CONFIG_SCHED_CPU_MASK
+		  "-c cpu: Pin the upload to the CPU (async only)\n"
+#endif /* CONFIG_SCHED_CPU_MASK */
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -2055,6 +2284,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_commands,
 	SHELL_CMD(jobs, &zperf_cmd_jobs,
 		  "Show currently active tests",
 		  cmd_jobs),
+	SHELL_CMD(output, NULL,
+		  "[text|json] Format of the upload results\n"
+		  "Example: output json\n",
+		  cmd_output),
 	SHELL_CMD(setip, NULL,
 		  "Set IP address\n"
 		  "<my ip> <prefix len>\n"
@@ -39,6 +39,36 @@ static ssize_t sendall(int sock, const void *buf, size_t len)
 	return 0;
 }
 
+static ssize_t sendmsg_all(int sock, struct iovec *iov, size_t iovlen)
+{
+	struct msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = iovlen,
+	};
+
+	while (msg.msg_iovlen > 0) {
+		ssize_t out_len = zsock_sendmsg(sock, &msg, 0);
+
+		if (out_len < 0) {
+			return out_len;
+		}
+
+		/* Drop the entries that went out, resend the rest of a partial one */
+		while (msg.msg_iovlen > 0 && (size_t)out_len >= msg.msg_iov->iov_len) {
+			out_len -= msg.msg_iov->iov_len;
+			msg.msg_iov++;
+			msg.msg_iovlen--;
+		}
+
+		if (out_len > 0) {
+			msg.msg_iov->iov_base = (char *)msg.msg_iov->iov_base + out_len;
+			msg.msg_iov->iov_len -= out_len;
+		}
+	}
+
+	return 0;
+}
+
 static int tcp_upload(int sock,
 		      unsigned int duration_in_ms,
 		      const struct zperf_upload_params *param,
@@ -49,7 +79,9 @@ static int tcp_upload(int sock,
 	int64_t start_time, end_time;
 	uint32_t nb_packets = 0U, nb_errors = 0U;
 	uint32_t packet_size = param->packet_size;
+	uint32_t batch = MAX(param->options.send_batch, 1U);
 	uint32_t alloc_errors = 0U;
+	struct iovec iov[ZPERF_SEND_BATCH_MAX];
 	int ret = 0;
 
 	if (packet_size > PACKET_SIZE_MAX) {
@@ -57,6 +89,16 @@ static int tcp_upload(int sock,
 		packet_size = PACKET_SIZE_MAX;
 	}
 
+	if (batch > ZPERF_SEND_BATCH_MAX) {
+		NET_WARN("Send batch too large! max batch: %u", ZPERF_SEND_BATCH_MAX);
+		batch = ZPERF_SEND_BATCH_MAX;
+	}
+
+	/* A custom payload is loaded packet by packet into the same buffer */
+	if (param->data_loader != NULL) {
+		batch = 1U;
+	}
+
 	/* Start the loop */
 	start_time = k_uptime_ticks();
 
@@ -81,8 +123,17 @@ static int tcp_upload(int sock,
 		}
 		*data_offset += packet_size;
 
-		/* Send the packet */
-		ret = sendall(sock, sample_packet, packet_size);
+		/* Send the packet, or a batch of copies of it in one call */
+		if (batch > 1U) {
+			for (uint32_t i = 0U; i < batch; i++) {
+				iov[i].iov_base = sample_packet;
+				iov[i].iov_len = packet_size;
+			}
+
+			ret = sendmsg_all(sock, iov, batch);
+		} else {
+			ret = sendall(sock, sample_packet, packet_size);
+		}
 		if (ret < 0) {
 			if (nb_errors == 0 && ret != -ENOMEM) {
 				NET_ERR("Failed to send the packet (%d)", errno);
@@ -102,7 +153,7 @@ static int tcp_upload(int sock,
 				break;
 			}
 		} else {
-			nb_packets++;
+			nb_packets += batch;
 		}
 
 #if defined(CONFIG_ARCH_POSIX)
@@ -278,6 +329,7 @@ int zperf_tcp_upload_async(const struct zperf_upload_params *param,
 	struct zperf_work *zperf;
 	struct session *ses;
 	k_tid_t tid;
+	int ret;
 
 	ses = get_free_session(&param->peer_addr, SESSION_TCP);
 	if (ses == NULL) {
@@ -307,6 +359,14 @@ int zperf_tcp_upload_async(const struct zperf_upload_params *param,
 	tid = k_work_queue_thread_get(queue);
 	k_thread_priority_set(tid, ses->async_upload_ctx.param.options.thread_priority);
 
+	ret = zperf_thread_cpu_mask_set(tid, param->options.cpu_mask);
+	if (ret < 0) {
+		NET_ERR("[%d] cannot set CPU mask 0x%x (%d)", ses->id,
+			param->options.cpu_mask, ret);
+		ses->state = STATE_NULL;
+		return ret;
+	}
+
 	k_work_init(&ses->async_upload_ctx.work, tcp_upload_async_work);
 
 	ses->start_time = k_uptime_ticks();
@@ -408,6 +408,7 @@ int zperf_udp_upload_async(const struct zperf_upload_params *param,
 	struct zperf_work *zperf;
 	struct session *ses;
 	k_tid_t tid;
+	int ret;
 
 	ses = get_free_session(&param->peer_addr, SESSION_UDP);
 	if (ses == NULL) {
@@ -437,6 +438,14 @@ int zperf_udp_upload_async(const struct zperf_upload_params *param,
 	tid = k_work_queue_thread_get(queue);
 	k_thread_priority_set(tid, ses->async_upload_ctx.param.options.thread_priority);
 
+	ret = zperf_thread_cpu_mask_set(tid, param->options.cpu_mask);
+	if (ret < 0) {
+		NET_ERR("[%d] cannot set CPU mask 0x%x (%d)", ses->id,
+			param->options.cpu_mask, ret);
+		ses->state = STATE_NULL;
+		return ret;
+	}
+
 	k_work_init(&ses->async_upload_ctx.work, udp_upload_async_work);
 
 	ses->start_time = k_uptime_ticks();
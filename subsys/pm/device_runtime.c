@@ -32,6 +32,49 @@ static struct k_work_q pm_device_runtime_wq;
 
 #define EVENT_MASK		(EVENT_STATE_ACTIVE | EVENT_STATE_SUSPENDED)
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+static void runtime_stats_update(struct pm_device_runtime_stats *stats,
+				 enum pm_device_action action, uint32_t cycles)
+{
+	uint32_t us = k_cyc_to_us_ceil32(cycles);
+
+	if (action == PM_DEVICE_ACTION_RESUME) {
+		stats->resume_count++;
+		stats->resume_last_us = us;
+		stats->resume_max_us = MAX(stats->resume_max_us, us);
+	} else {
+		stats->suspend_count++;
+		stats->suspend_last_us = us;
+		stats->suspend_max_us = MAX(stats->suspend_max_us, us);
+	}
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
+/**
+ * @brief Run a suspend or resume action on a device
+ *
+ * Transitions of a given device are serialized by the callers, so the
+ * statistics are updated without further locking.
+ */
+static int runtime_action(const struct device *dev, enum pm_device_action action)
+{
+	struct pm_device_base *pm = dev->pm_base;
+	int ret;
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
+	ret = pm->action_cb(dev, action);
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	if (ret == 0) {
+		runtime_stats_update(&pm->stats, action, k_cycle_get_32() - start);
+	}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
+	return ret;
+}
+
 /**
  * @brief Suspend a device
  *
@@ -96,7 +139,7 @@ static int runtime_suspend(const struct device *dev, bool async,
 #endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
 	} else {
 		/* suspend now */
-		ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
+		ret = runtime_action(pm->dev, PM_DEVICE_ACTION_SUSPEND);
 		if (ret < 0) {
 			pm->base.usage++;
 			goto unlock;
@@ -126,7 +169,7 @@ static void runtime_suspend_work(struct k_work *work)
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 	struct pm_device *pm = CONTAINER_OF(dwork, struct pm_device, work);
 
-	ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
+	ret = runtime_action(pm->dev, PM_DEVICE_ACTION_SUSPEND);
 
 	(void)k_sem_take(&pm->lock, K_FOREVER);
 	if (ret < 0) {
@@ -172,7 +215,7 @@ static int get_sync_locked(const struct device *dev)
 			}
 		}
 
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_RESUME);
+		ret = runtime_action(dev, PM_DEVICE_ACTION_RESUME);
 		if (ret < 0) {
 			return ret;
 		}
@@ -280,7 +323,7 @@ int pm_device_runtime_get(const struct device *dev)
 		goto unlock;
 	}
 
-	ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_RESUME);
+	ret = runtime_action(pm->dev, PM_DEVICE_ACTION_RESUME);
 	if (ret < 0) {
 		pm->base.usage--;
 		goto unlock;
@@ -316,7 +359,7 @@ static int put_sync_locked(const struct device *dev)
 
 	pm->base.usage--;
 	if (pm->base.usage == 0U) {
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_SUSPEND);
+		ret = runtime_action(dev, PM_DEVICE_ACTION_SUSPEND);
 		if (ret < 0) {
 			return ret;
 		}
@@ -411,7 +454,7 @@ static int runtime_enable_sync(const struct device *dev)
 	k_spinlock_key_t k = k_spin_lock(&pm->lock);
 
 	if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_SUSPEND);
+		ret = runtime_action(dev, PM_DEVICE_ACTION_SUSPEND);
 		if (ret < 0) {
 			goto unlock;
 		}
@@ -467,7 +510,7 @@ int pm_device_runtime_enable(const struct device *dev)
 	}
 
 	if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
-		ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
+		ret = runtime_action(pm->dev, PM_DEVICE_ACTION_SUSPEND);
 		if (ret < 0) {
 			goto unlock;
 		}
@@ -495,7 +538,7 @@ static int runtime_disable_sync(const struct device *dev)
 	k_spinlock_key_t k = k_spin_lock(&pm->lock);
 
 	if (pm->base.state == PM_DEVICE_STATE_SUSPENDED) {
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_RESUME);
+		ret = runtime_action(dev, PM_DEVICE_ACTION_RESUME);
 		if (ret < 0) {
 			goto unlock;
 		}
@@ -558,7 +601,7 @@ int pm_device_runtime_disable(const struct device *dev)
 
 	/* wake up the device if suspended */
 	if (pm->base.state == PM_DEVICE_STATE_SUSPENDED) {
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_RESUME);
+		ret = runtime_action(dev, PM_DEVICE_ACTION_RESUME);
 		if (ret < 0) {
 			goto unlock;
 		}
@@ -597,6 +640,92 @@ int pm_device_runtime_usage(const struct device *dev)
 	return dev->pm_base->usage;
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+static void runtime_get_batch(struct pm_device_runtime_batch *batch)
+{
+	size_t i;
+	int ret = 0;
+
+	for (i = 0; i < batch->count; i++) {
+		ret = pm_device_runtime_get(batch->devs[i]);
+		if (ret < 0) {
+			LOG_ERR("Could not resume %s (%d)", batch->devs[i]->name, ret);
+			break;
+		}
+	}
+
+	if (ret < 0) {
+		while (i-- > 0) {
+			(void)pm_device_runtime_put(batch->devs[i]);
+		}
+	}
+
+	if (batch->cb != NULL) {
+		batch->cb(batch, ret);
+	}
+}
+
+static void runtime_get_batch_work(struct k_work *work)
+{
+	runtime_get_batch(CONTAINER_OF(work, struct pm_device_runtime_batch, work));
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
+int pm_device_runtime_get_async(struct pm_device_runtime_batch *batch,
+				const struct device *const *devs, size_t count,
+				pm_device_runtime_batch_cb_t cb)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+	if (k_work_busy_get(&batch->work) != 0) {
+		return -EBUSY;
+	}
+
+	batch->devs = devs;
+	batch->count = count;
+	batch->cb = cb;
+
+	if (k_is_pre_kernel()) {
+		runtime_get_batch(batch);
+		return 0;
+	}
+
+	k_work_init(&batch->work, runtime_get_batch_work);
+#ifdef CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ
+	(void)k_work_submit(&batch->work);
+#else
+	(void)k_work_submit_to_queue(&pm_device_runtime_wq, &batch->work);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_USE_SYSTEM_WQ */
+
+	return 0;
+#else
+	ARG_UNUSED(batch);
+	ARG_UNUSED(devs);
+	ARG_UNUSED(count);
+	ARG_UNUSED(cb);
+
+	LOG_WRN("Function not available");
+	return -ENOSYS;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+}
+
+int pm_device_runtime_stats_get(const struct device *dev, struct pm_device_runtime_stats *stats)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	if (dev->pm_base == NULL) {
+		return -ENOTSUP;
+	}
+
+	*stats = dev->pm_base->stats;
+
+	return 0;
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(stats);
+
+	return -ENOSYS;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+}
+
 #ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
 #ifdef CONFIG_PM_DEVICE_RUNTIME_USE_DEDICATED_WQ
 
@@ -83,3 +83,23 @@ void pm_policy_event_unregister(struct pm_policy_event *evt)
 		update_next_event();
 	}
 }
+
+void pm_policy_stream_add(struct pm_policy_stream *stream, uint32_t deadline_us,
+			  uint32_t latency_us)
+{
+	pm_policy_latency_request_add(&stream->req, latency_us);
+	pm_policy_event_register(&stream->evt,
+				 k_uptime_ticks() + k_us_to_ticks_floor64(deadline_us));
+}
+
+void pm_policy_stream_update(struct pm_policy_stream *stream, uint32_t deadline_us)
+{
+	pm_policy_event_update(&stream->evt,
+			       k_uptime_ticks() + k_us_to_ticks_floor64(deadline_us));
+}
+
+void pm_policy_stream_remove(struct pm_policy_stream *stream)
+{
+	pm_policy_event_unregister(&stream->evt);
+	pm_policy_latency_request_remove(&stream->req);
+}
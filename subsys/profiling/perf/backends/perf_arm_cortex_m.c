@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2026 Audio Inventions Ltd
+ *
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/linker/linker-defs.h>
+#include <cmsis_core.h>
+
+static bool valid_stack(uintptr_t addr, k_tid_t current)
+{
+	return current->stack_info.start <= addr &&
+		addr < current->stack_info.start + current->stack_info.size;
+}
+
+static inline bool in_text_region(uintptr_t addr)
+{
+	return (addr >= (uintptr_t)__text_region_start) && (addr < (uintptr_t)__text_region_end);
+}
+
+/*
+ * Check that addr is a Thumb return address, i.e. that the instruction
+ * preceding it is either BL <label> (32-bit) or BLX <Rm> (16-bit).
+ */
+static bool is_return_address(uintptr_t addr)
+{
+	uintptr_t ra = addr & ~1UL;
+	uint16_t hw1, hw2;
+
+	if ((addr & 1UL) == 0U || !in_text_region(ra) || !in_text_region(ra - 4U)) {
+		return false;
+	}
+
+	hw1 = *(const uint16_t *)(ra - 4U);
+	hw2 = *(const uint16_t *)(ra - 2U);
+
+	if ((hw2 & 0xFF87U) == 0x4780U) {
+		return true;
+	}
+
+	return (hw1 & 0xF800U) == 0xF000U && (hw2 & 0xD000U) == 0xD000U;
+}
+
+/*
+ * GCC does not keep a frame record chain in Thumb code, even with frame
+ * pointers enabled, and there are no unwind tables in a Zephyr image by
+ * default. So the stack of the interrupted thread is scanned for words that
+ * look like return addresses, i.e. that point into the text region right
+ * after a call instruction. Return addresses are translated in corresponding
+ * function's names using .elf file. So we get function call trace
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	if (size < 2U) {
+		return 0;
+	}
+
+	size_t idx = 0;
+
+	/*
+	 * perf tracer runs in the timer interrupt handler, so the hardware has
+	 * stacked r0-r3, r12, lr, pc and xpsr of the interrupted thread on the
+	 * process stack. If the timer interrupt preempted another handler,
+	 * the trace points to the thread running underneath it.
+	 */
+	const struct arch_esf * const esf = (struct arch_esf *)__get_PSP();
+	const uintptr_t *sp = (const uintptr_t *)(&esf->basic + 1);
+
+	buf[idx++] = (uintptr_t)esf->basic.pc;
+
+	/*
+	 * lr is the only place the return address of a leaf function can be
+	 * found, as leaf functions do not push it on the stack.
+	 */
+	if (is_return_address(esf->basic.lr)) {
+		buf[idx++] = (uintptr_t)esf->basic.lr;
+	}
+
+	while (valid_stack((uintptr_t)sp, _current)) {
+		uintptr_t addr = *sp++;
+
+		if (!is_return_address(addr) || addr == buf[idx - 1]) {
+			continue;
+		}
+
+		if (idx >= size) {
+			return 0;
+		}
+
+		buf[idx++] = addr;
+	}
+
+	return idx;
+}
@@ -0,0 +1,124 @@
+/*
+ *  Copyright (c) 2026 Audio Inventions Ltd
+ *
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/linker/linker-defs.h>
+#include <zephyr/offsets.h>
+
+static bool valid_stack(uintptr_t addr, k_tid_t current)
+{
+	return current->stack_info.start <= addr &&
+		addr < current->stack_info.start + current->stack_info.size;
+}
+
+static inline bool in_text_region(uintptr_t addr)
+{
+	return (addr >= (uintptr_t)__text_region_start) && (addr < (uintptr_t)__text_region_end);
+}
+
+static inline bool in_irq_stack(uintptr_t addr)
+{
+	uintptr_t top = (uintptr_t)_current_cpu->irq_stack;
+
+	return top - CONFIG_ISR_STACK_SIZE < addr && addr <= top;
+}
+
+/*
+ * Top two bits of a return address hold the window increment of the call,
+ * replace them with the top bits of an address in the same region.
+ */
+static inline uintptr_t ra_to_pc(uintptr_t ra, uintptr_t pc)
+{
+	return (ra & 0x3fffffffU) | (pc & 0xc0000000U);
+}
+
+/*
+ * This function use windowed ABI base save areas to unwind stack and get trace
+ * of return addresses. Return addresses are translated in corresponding
+ * function's names using .elf file. So we get function call trace
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	if (size < 1U) {
+		return 0;
+	}
+
+	size_t idx = 0;
+	uintptr_t sp;
+	int32_t a0save;
+
+	/*
+	 * Spill all register windows, so that a0 and a1 of every caller are
+	 * stored in the base save area below the stack pointer of its callee.
+	 */
+	__asm__ volatile("mov %0, a0;"
+			 "call0 xtensa_spill_reg_windows;"
+			 "mov a0, %0"
+			 : "=r"(a0save));
+	__asm__ volatile("mov %0, a1" : "=r"(sp));
+
+	/*
+	 * In xtensa (arch/xtensa/include/xtensa_asm2_s.h) the interrupt entry
+	 * saves pc, a0 and the rest of the interrupted context in the BSA on
+	 * the thread stack, then calls the handler on _current_cpu->irq_stack
+	 * through two phantom frames. The upper one holds the interrupted a1,
+	 * which points right above the BSA.
+	 *
+	 * The following lines walk the handler frames up to the first stack
+	 * pointer outside of the interrupt stack to get the interrupted a1.
+	 */
+	for (int i = 0; i < 64 && in_irq_stack(sp); i++) {
+		sp = *(uintptr_t *)(sp - 12U);
+	}
+
+	if (!valid_stack(sp, _current)) {
+		/* Interrupted context is unknown */
+		buf[idx++] = 0;
+		return idx;
+	}
+
+	const uintptr_t bsa = sp - ___xtensa_irq_bsa_t_SIZEOF;
+	const uintptr_t pc = *(uintptr_t *)(bsa + ___xtensa_irq_bsa_t_pc_OFFSET);
+	uintptr_t ra = *(uintptr_t *)(bsa + ___xtensa_irq_bsa_t_a0_OFFSET);
+
+	buf[idx++] = pc;
+
+	/*
+	 * Base save area of the caller in memory:
+	 * (addresses growth up)
+	 *  ....
+	 *  a0 (caller's return address) <- $sp - 16
+	 *  a1 (caller's $sp)            <- $sp - 12
+	 *  a2
+	 *  a3
+	 *  ....                         <- $sp
+	 */
+	while (valid_stack(sp, _current)) {
+		if (idx >= size) {
+			return 0;
+		}
+
+		if (!in_text_region(ra_to_pc(ra, pc))) {
+			break;
+		}
+
+		buf[idx++] = ra_to_pc(ra, pc);
+		ra = *(uintptr_t *)(sp - 16U);
+		uintptr_t new_sp = *(uintptr_t *)(sp - 12U);
+
+		/*
+		 * anti-infinity-loop if
+		 * new_sp can't be smaller than sp, cause the stack is growing down
+		 * and trace moves deeper into the stack
+		 */
+		if (new_sp <= sp) {
+			break;
+		}
+		sp = new_sp;
+	}
+
+	return idx;
+}
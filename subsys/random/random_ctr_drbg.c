@@ -8,6 +8,7 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/entropy.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 #include <string.h>
 
 #if !defined(CONFIG_MBEDTLS_CFG_FILE)
@@ -19,22 +20,43 @@
 
 /*
  * entropy_dev is initialized at runtime to allow first time initialization
- * of the ctr_drbg engine.
+ * of the ctr_drbg engines.
  */
 static const struct device *entropy_dev;
 static const unsigned char drbg_seed[] = CONFIG_CS_CTR_DRBG_PERSONALIZATION;
-static bool ctr_initialised;
-static K_MUTEX_DEFINE(ctr_lock);
 
-static mbedtls_ctr_drbg_context ctr_ctx;
+#define CSRAND_BUF_SIZE CONFIG_CS_CTR_DRBG_BUFFER_SIZE
+
+/*
+ * One DRBG per CPU, so that concurrent callers do not wait for each other.
+ * When buffering is enabled, each one also keeps a block of output ahead,
+ * served under a spinlock, and a spare block refilled from the system work
+ * queue, so that short requests are a copy instead of an AES-CTR run.
+ */
+struct csrand_cpu {
+	struct k_mutex drbg_lock;
+	mbedtls_ctr_drbg_context ctx;
+	bool initialised;
+#if CSRAND_BUF_SIZE > 0
+	struct k_spinlock lock;
+	struct k_work refill;
+	uint8_t buf[2][CSRAND_BUF_SIZE];
+	uint8_t active;
+	bool spare_ready;
+	size_t pos;
+#endif
+};
+
+static struct csrand_cpu csrand_cpus[CONFIG_MP_MAX_NUM_CPUS];
 
 static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
 {
 	return entropy_get_entropy(entropy_dev, (void *)buf, len);
 }
 
-static int ctr_drbg_initialize(void)
+static int ctr_drbg_initialize(struct csrand_cpu *cpu)
 {
+	unsigned char custom[sizeof(drbg_seed) + 1];
 	int ret;
 
 	entropy_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
@@ -44,42 +66,164 @@ static int ctr_drbg_initialize(void)
 		return -ENODEV;
 	}
 
-	mbedtls_ctr_drbg_init(&ctr_ctx);
+	/* Tell the instances apart, on top of their own entropy */
+	memcpy(custom, drbg_seed, sizeof(drbg_seed));
+	custom[sizeof(drbg_seed)] = cpu - csrand_cpus;
+
+	mbedtls_ctr_drbg_init(&cpu->ctx);
 
-	ret = mbedtls_ctr_drbg_seed(&ctr_ctx,
+	ret = mbedtls_ctr_drbg_seed(&cpu->ctx,
 				    ctr_drbg_entropy_func,
 				    NULL,
-				    drbg_seed,
-				    sizeof(drbg_seed));
+				    custom,
+				    sizeof(custom));
 
 	if (ret != 0) {
-		mbedtls_ctr_drbg_free(&ctr_ctx);
+		mbedtls_ctr_drbg_free(&cpu->ctx);
 		return -EIO;
 	}
 
-	ctr_initialised = true;
+	cpu->initialised = true;
 	return 0;
 }
 
-
-int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
+static int ctr_drbg_generate(struct csrand_cpu *cpu, void *dst, size_t outlen)
 {
 	int ret;
 
-	k_mutex_lock(&ctr_lock, K_FOREVER);
+	k_mutex_lock(&cpu->drbg_lock, K_FOREVER);
 
-	if (unlikely(!ctr_initialised)) {
-		ret = ctr_drbg_initialize();
+	if (unlikely(!cpu->initialised)) {
+		ret = ctr_drbg_initialize(cpu);
 		if (ret != 0) {
 			ret = -EIO;
 			goto end;
 		}
 	}
 
-	ret = mbedtls_ctr_drbg_random(&ctr_ctx, (unsigned char *)dst, outlen);
+	ret = mbedtls_ctr_drbg_random(&cpu->ctx, (unsigned char *)dst, outlen);
 
 end:
-	k_mutex_unlock(&ctr_lock);
+	k_mutex_unlock(&cpu->drbg_lock);
+
+	return ret;
+}
+
+static struct csrand_cpu *csrand_cpu_get(void)
+{
+#if defined(CONFIG_SMP)
+	unsigned int key = arch_irq_lock();
+	uint8_t id = arch_curr_cpu()->id;
+
+	arch_irq_unlock(key);
+
+	/* Migrating afterwards is fine, each instance has its own locks */
+	return &csrand_cpus[id];
+#else
+	return &csrand_cpus[0];
+#endif
+}
+
+#if CSRAND_BUF_SIZE > 0
+static void csrand_refill(struct k_work *work)
+{
+	struct csrand_cpu *cpu = CONTAINER_OF(work, struct csrand_cpu, refill);
+	k_spinlock_key_t key;
+	uint8_t spare;
+
+	key = k_spin_lock(&cpu->lock);
+	if (cpu->spare_ready) {
+		k_spin_unlock(&cpu->lock, key);
+		return;
+	}
+	spare = !cpu->active;
+	k_spin_unlock(&cpu->lock, key);
+
+	/* Readers only touch the active block until spare_ready is set */
+	if (ctr_drbg_generate(cpu, cpu->buf[spare], CSRAND_BUF_SIZE) != 0) {
+		return;
+	}
+
+	key = k_spin_lock(&cpu->lock);
+	cpu->spare_ready = true;
+	k_spin_unlock(&cpu->lock, key);
+}
+
+static bool csrand_buffered_get(struct csrand_cpu *cpu, void *dst, size_t outlen)
+{
+	k_spinlock_key_t key;
+	bool done = false;
+
+	key = k_spin_lock(&cpu->lock);
+
+	if (CSRAND_BUF_SIZE - cpu->pos < outlen && cpu->spare_ready) {
+		/* Whatever is left of the active block is dropped */
+		memset(&cpu->buf[cpu->active][cpu->pos], 0, CSRAND_BUF_SIZE - cpu->pos);
+		cpu->active = !cpu->active;
+		cpu->pos = 0;
+		cpu->spare_ready = false;
+		k_work_submit(&cpu->refill);
+	}
+
+	if (CSRAND_BUF_SIZE - cpu->pos >= outlen) {
+		uint8_t *src = &cpu->buf[cpu->active][cpu->pos];
+
+		memcpy(dst, src, outlen);
+		/* Handed out bytes must not stay in memory */
+		memset(src, 0, outlen);
+		cpu->pos += outlen;
+		done = true;
+	}
+
+	k_spin_unlock(&cpu->lock, key);
+
+	return done;
+}
+
+static int csrand_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(csrand_cpus); i++) {
+		struct csrand_cpu *cpu = &csrand_cpus[i];
+
+		k_mutex_init(&cpu->drbg_lock);
+		k_work_init(&cpu->refill, csrand_refill);
+		/* Empty until the first refill */
+		cpu->pos = CSRAND_BUF_SIZE;
+	}
+
+	return 0;
+}
+#else
+static int csrand_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(csrand_cpus); i++) {
+		k_mutex_init(&csrand_cpus[i].drbg_lock);
+	}
+
+	return 0;
+}
+#endif /* CSRAND_BUF_SIZE > 0 */
+
+SYS_INIT(csrand_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
+{
+	struct csrand_cpu *cpu = csrand_cpu_get();
+	int ret;
+
+#if CSRAND_BUF_SIZE > 0
+	if (csrand_buffered_get(cpu, dst, outlen)) {
+		return 0;
+	}
+#endif
+
+	ret = ctr_drbg_generate(cpu, dst, outlen);
+
+#if CSRAND_BUF_SIZE > 0
+	if (ret == 0 && !cpu->spare_ready) {
+		k_work_submit(&cpu->refill);
+	}
+#endif
 
 	return ret;
 }
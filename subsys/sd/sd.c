@@ -257,6 +257,11 @@ int sd_init(const struct device *sdhc_dev, struct sd_card *card)
 		return ret;
 	}
 
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+	/* Blocks pending for a previous card can not be written to this one */
+	card->merge_count = 0U;
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
+
 	/* Initialize SDHC IO with defaults */
 	ret = sd_init_io(card);
 	if (ret) {
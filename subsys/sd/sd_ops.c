@@ -540,6 +540,58 @@ static int card_read(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 	return 0;
 }
 
+static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_block,
+		      uint32_t num_blocks);
+
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+/* Writes blocks pending in the merge buffer to the card */
+static int card_merge_flush(struct sd_card *card)
+{
+	int ret;
+
+	if (card->merge_count == 0U) {
+		return 0;
+	}
+	ret = card_write(card, card->merge_buffer, card->merge_start, card->merge_count);
+	card->merge_count = 0U;
+	return ret;
+}
+
+/*
+ * Adds blocks to the merge buffer, writing out pending blocks first if the
+ * new ones do not directly follow them or do not fit. Returns -EAGAIN if
+ * the blocks do not fit in an empty buffer and must be written directly.
+ */
+static int card_merge_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_block,
+			    uint32_t num_blocks)
+{
+	uint32_t max_blocks = sizeof(card->merge_buffer) / card->block_size;
+	int ret;
+
+	if ((card->merge_count != 0U) &&
+	    ((start_block != (card->merge_start + card->merge_count)) ||
+	     ((card->merge_count + num_blocks) > max_blocks))) {
+		ret = card_merge_flush(card);
+		if (ret) {
+			return ret;
+		}
+	}
+	if (num_blocks >= max_blocks) {
+		return -EAGAIN;
+	}
+	if (card->merge_count == 0U) {
+		card->merge_start = start_block;
+	}
+	memcpy(&card->merge_buffer[card->merge_count * card->block_size], wbuf,
+	       num_blocks * card->block_size);
+	card->merge_count += num_blocks;
+	if (card->merge_count == max_blocks) {
+		return card_merge_flush(card);
+	}
+	return 0;
+}
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
+
 /* Reads data from SD card memory card */
 int card_read_blocks(struct sd_card *card, uint8_t *rbuf, uint32_t start_block, uint32_t num_blocks)
 {
@@ -561,6 +613,18 @@ int card_read_blocks(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 		return -EBUSY;
 	}
 
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+	/* Pending merged writes must reach the card before they are read back */
+	if ((start_block < (card->merge_start + card->merge_count)) &&
+	    (card->merge_start < (start_block + num_blocks))) {
+		ret = card_merge_flush(card);
+		if (ret) {
+			k_mutex_unlock(&card->lock);
+			return ret;
+		}
+	}
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
+
 	/*
 	 * If the buffer we are provided with is aligned, we can use it
 	 * directly. Otherwise, we need to use the card's internal buffer
@@ -579,6 +643,7 @@ int card_read_blocks(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 		sector = 0;
 		buf_offset = rbuf;
 		while (sector < num_blocks) {
+			rlen = MIN(rlen, num_blocks - sector);
 			/* Read from disk to card buffer */
 			ret = card_read(card, card->card_buffer, sector + start_block, rlen);
 			if (ret) {
@@ -650,6 +715,36 @@ static int card_query_written(struct sd_card *card, uint32_t *num_written)
 	return 0;
 }
 
+/*
+ * Sends ACMD23 (set write block erase count) so the card can pre-erase the
+ * blocks of the following multiple block write
+ */
+static int card_set_pre_erase(struct sd_card *card, uint32_t num_blocks)
+{
+	int ret;
+	struct sdhc_command cmd;
+
+	ret = card_app_command(card, card->relative_addr);
+	if (ret) {
+		LOG_DBG("App CMD for ACMD23 failed");
+		return ret;
+	}
+
+	cmd.opcode = SD_APP_SET_WRITE_BLK_ERASE_CNT;
+	/* Erase count is a 23 bit field */
+	cmd.arg = MIN(num_blocks, BIT_MASK(23));
+	cmd.response_type = (SD_RSP_TYPE_R1 | SD_SPI_RSP_TYPE_R1);
+	cmd.retries = CONFIG_SD_CMD_RETRIES;
+	cmd.timeout_ms = CONFIG_SD_CMD_TIMEOUT;
+
+	ret = sdhc_request(card->sdhc, &cmd, NULL);
+	if (ret) {
+		LOG_DBG("ACMD23 failed: %d", ret);
+		return ret;
+	}
+	return sd_check_response(&cmd);
+}
+
 static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_block,
 		      uint32_t num_blocks)
 {
@@ -658,6 +753,15 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	struct sdhc_command cmd;
 	struct sdhc_data data;
 
+	if (IS_ENABLED(CONFIG_SD_WRITE_PRE_ERASE) && (card->type == CARD_SDMMC) &&
+	    (num_blocks > 1U)) {
+		/* Only a hint to the card, the write does not depend on it */
+		ret = card_set_pre_erase(card, num_blocks);
+		if (ret) {
+			LOG_DBG("Pre-erase hint failed: %d", ret);
+		}
+	}
+
 	/*
 	 * See the note in card_read() above. We will not issue CMD23
 	 * or CMD12, and expect the host to handle those details.
@@ -726,6 +830,13 @@ int card_write_blocks(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 		LOG_WRN("Could not get SD card mutex");
 		return -EBUSY;
 	}
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+	ret = card_merge_write(card, wbuf, start_block, num_blocks);
+	if (ret != -EAGAIN) {
+		k_mutex_unlock(&card->lock);
+		return ret;
+	}
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
 	/*
 	 * If the buffer we are provided with is aligned, we can use it
 	 * directly. Otherwise, we need to use the card's internal buffer
@@ -744,6 +855,7 @@ int card_write_blocks(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 		sector = 0;
 		buf_offset = wbuf;
 		while (sector < num_blocks) {
+			wlen = MIN(wlen, num_blocks - sector);
 			/* Copy data into card buffer */
 			memcpy(card->card_buffer, buf_offset, wlen * card->block_size);
 			/* Write card buffer to disk */
@@ -793,9 +905,21 @@ int card_ioctl(struct sd_card *card, uint8_t cmd, void *buf)
 		 * Note that SD stack does not support enabling caching, so
 		 * cache flush is not required here
 		 */
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+		ret = card_merge_flush(card);
+		if (ret) {
+			break;
+		}
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
 		ret = sdmmc_wait_ready(card);
 		break;
 	case DISK_IOCTL_CTRL_DEINIT:
+#if CONFIG_SD_WRITE_MERGE_BLOCKS
+		ret = card_merge_flush(card);
+		if (ret) {
+			LOG_ERR("Failed to write merged blocks: %d", ret);
+		}
+#endif /* CONFIG_SD_WRITE_MERGE_BLOCKS */
 		/* Ensure card is not busy with data write */
 		ret = sdmmc_wait_ready(card);
 		if (ret < 0) {
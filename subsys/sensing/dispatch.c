@@ -11,6 +11,8 @@
 
 LOG_MODULE_DECLARE(sensing, CONFIG_SENSING_LOG_LEVEL);
 
+struct sample_block;
+
 /* check whether it is right time for client to consume this sample */
 static inline bool sensor_test_consume_time(struct sensing_sensor *sensor,
 				     struct sensing_connection *conn,
@@ -34,9 +36,121 @@ static void update_client_consume_time(struct sensing_sensor *sensor,
 	conn->next_consume_time += interval;
 }
 
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+/* sample data shared by clients, released when the last reference is put */
+struct sample_block {
+	atomic_t refs;
+	uint8_t *data;
+	uint32_t data_len;
+};
+
+/* data event queued to the work queue of a client */
+struct client_event {
+	struct k_work work;
+	struct sensing_connection *conn;
+	struct sample_block *block;
+};
+
+/* a mempool buffer spans at least one block, so there are no more buffers than blocks */
+K_MEM_SLAB_DEFINE_STATIC(sample_block_slab, sizeof(struct sample_block),
+			 CONFIG_SENSING_RTIO_BLOCK_COUNT, sizeof(void *));
+K_MEM_SLAB_DEFINE_STATIC(client_event_slab, sizeof(struct client_event),
+			 CONFIG_SENSING_CLIENT_DISPATCH_EVENTS, sizeof(void *));
+
+static struct sample_block *sample_block_alloc(uint8_t *data, uint32_t data_len)
+{
+	struct sample_block *block;
+
+	if (k_mem_slab_alloc(&sample_block_slab, (void **)&block, K_NO_WAIT) != 0) {
+		return NULL;
+	}
+
+	atomic_set(&block->refs, 1);
+	block->data = data;
+	block->data_len = data_len;
+
+	return block;
+}
+
+static void sample_block_put(struct sample_block *block)
+{
+	if (atomic_dec(&block->refs) == 1) {
+		rtio_release_buffer(&sensing_rtio_ctx, block->data, block->data_len);
+		k_mem_slab_free(&sample_block_slab, block);
+	}
+}
+
+/* orders the last pending event giving conn->idle with client_events_drain() */
+static struct k_spinlock client_event_lock;
+
+static void client_event_done(struct sensing_connection *conn)
+{
+	k_spinlock_key_t key = k_spin_lock(&client_event_lock);
+
+	if (atomic_dec(&conn->pending) == 1) {
+		k_sem_give(&conn->idle);
+	}
+
+	k_spin_unlock(&client_event_lock, key);
+}
+
+void client_events_drain(struct sensing_connection *conn)
+{
+	k_spinlock_key_t key = k_spin_lock(&client_event_lock);
+
+	/* conn->idle may have been given when an earlier event was done, so check again */
+	while (atomic_get(&conn->pending) > 0) {
+		k_spin_unlock(&client_event_lock, key);
+		k_sem_take(&conn->idle, K_FOREVER);
+		key = k_spin_lock(&client_event_lock);
+	}
+
+	k_spin_unlock(&client_event_lock, key);
+}
+
+static void client_event_handler(struct k_work *work)
+{
+	struct client_event *event = CONTAINER_OF(work, struct client_event, work);
+	struct sensing_connection *conn = event->conn;
+
+	conn->callback_list->on_data_event(conn, event->block->data,
+					   conn->callback_list->context);
+
+	sample_block_put(event->block);
+	k_mem_slab_free(&client_event_slab, event);
+	client_event_done(conn);
+}
+
+/* queue data event to the work queue of the client, dropped if the client is behind */
+static void client_event_submit(struct sensing_connection *conn, struct sample_block *block)
+{
+	struct client_event *event;
+
+	if (block == NULL ||
+	    atomic_get(&conn->pending) >= CONFIG_SENSING_CLIENT_DISPATCH_DEPTH ||
+	    k_mem_slab_alloc(&client_event_slab, (void **)&event, K_NO_WAIT) != 0) {
+		LOG_WRN("sensor:%s client:%p behind, data dropped",
+				conn->source->dev->name, conn);
+		return;
+	}
+
+	k_work_init(&event->work, client_event_handler);
+	event->conn = conn;
+	event->block = block;
+	atomic_inc(&block->refs);
+	atomic_inc(&conn->pending);
+
+	if (k_work_submit_to_queue(conn->callback_list->work_q, &event->work) < 0) {
+		client_event_done(conn);
+		sample_block_put(block);
+		k_mem_slab_free(&client_event_slab, event);
+	}
+}
+#endif /* CONFIG_SENSING_CLIENT_DISPATCH */
+
 /* send data to clients based on interval and sensitivity */
 static int send_data_to_clients(struct sensing_sensor *sensor,
-				void *data)
+				void *data, struct sample_block *block)
 {
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
@@ -64,6 +178,13 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 					conn->source->dev->name);
 			continue;
 		}
+
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+		if (conn->callback_list->work_q != NULL) {
+			client_event_submit(conn, block);
+			continue;
+		}
+#endif
 		conn->callback_list->on_data_event(conn, data,
 				conn->callback_list->context);
 	}
@@ -113,7 +234,18 @@ static void dispatch_task(void *a, void *b, void *c)
 		    (uintptr_t)cqe.userdata < (uintptr_t)STRUCT_SECTION_END(sensing_sensor)) {
 			struct sensing_sensor *sensor = cqe.userdata;
 
-			send_data_to_clients(sensor, data);
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+			/* data is shared with the clients and released by the last one */
+			struct sample_block *block = sample_block_alloc(data, data_len);
+
+			send_data_to_clients(sensor, data, block);
+			if (block != NULL) {
+				sample_block_put(block);
+				continue;
+			}
+#else
+			send_data_to_clients(sensor, data, NULL);
+#endif
 		}
 
 		rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
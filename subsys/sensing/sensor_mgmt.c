@@ -275,6 +275,10 @@ static void init_connection(struct sensing_connection *conn,
 
 	conn->interval = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+	atomic_set(&conn->pending, 0);
+	k_sem_init(&conn->idle, 0, 1);
+#endif
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&conn->source->client_list, &conn->snode);
 }
@@ -382,6 +386,16 @@ int close_sensor(struct sensing_connection **conn)
 
 	save_config_and_notify(tmp_conn->source);
 
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+	/* Let the data events already queued to the client finish with the connection */
+	if (tmp_conn->callback_list != NULL && tmp_conn->callback_list->work_q != NULL) {
+		__ASSERT(k_current_get() != k_work_queue_thread_get(tmp_conn->callback_list->work_q),
+			 "connection cannot be closed from its own work queue");
+
+		client_events_drain(tmp_conn);
+	}
+#endif
+
 	free(*conn);
 	*conn = NULL;
 
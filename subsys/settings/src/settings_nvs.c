@@ -30,12 +30,17 @@ struct settings_nvs_read_fn_arg {
 
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
+static ssize_t settings_nvs_load_one(struct settings_store *cs, const char *name,
+				     char *buf, size_t buf_len);
+static ssize_t settings_nvs_get_val_len(struct settings_store *cs, const char *name);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
 static void *settings_nvs_storage_get(struct settings_store *cs);
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+	.csi_load_one = settings_nvs_load_one,
+	.csi_get_val_len = settings_nvs_get_val_len,
 	.csi_save = settings_nvs_save,
 	.csi_storage_get = settings_nvs_storage_get
 };
@@ -120,6 +125,119 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+/* Search for the name ID that corresponds to name without reading any value
+ * or calling any handler. The name cache is used if enabled, if it holds all
+ * the names the storage is not read at all.
+ * If no name ID that corresponds to name is found, returns NVS_NAMECNT_ID.
+ */
+static uint16_t settings_nvs_find_name_id(struct settings_nvs *cf, const char *name)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t name_id;
+	ssize_t rc;
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	name_id = settings_nvs_cache_match(cf, name, rdname, sizeof(rdname));
+	if (name_id != NVS_NAMECNT_ID) {
+		return name_id;
+	}
+
+	/* We can skip reading NVS if we know that the cache wasn't overflowed. */
+	if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return NVS_NAMECNT_ID;
+	}
+#endif
+
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &rdname, sizeof(rdname) - 1);
+		if (rc <= 0) {
+			continue;
+		}
+
+		rdname[rc] = '\0';
+
+		if (strcmp(name, rdname) == 0) {
+			return name_id;
+		}
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+static ssize_t settings_nvs_load_one(struct settings_store *cs, const char *name,
+				     char *buf, size_t buf_len)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+	ssize_t rc;
+
+	if (!name || !buf) {
+		return -EINVAL;
+	}
+
+	name_id = settings_nvs_find_name_id(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, buf, buf_len);
+
+	return (rc == -ENOENT) ? 0 : rc;
+}
+
+static ssize_t settings_nvs_get_val_len(struct settings_store *cs, const char *name)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+	ssize_t rc;
+	char buf;
+
+	if (!name) {
+		return -EINVAL;
+	}
+
+	name_id = settings_nvs_find_name_id(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	/* nvs_read() returns the length of the whole entry */
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf, sizeof(buf));
+
+	return (rc == -ENOENT) ? 0 : rc;
+}
+
+#ifdef CONFIG_SETTINGS_NVS_LOAD_SUBTREE_PATH
+/* Loads first the key which is defined by the name found in "subtree" root.
+ * If the key is not found or further keys under the same subtree are needed
+ * by the caller, returns 0.
+ */
+static int settings_nvs_load_subtree(struct settings_nvs *cf,
+				     const struct settings_load_arg *arg)
+{
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	uint16_t name_id;
+	ssize_t rc;
+	char buf;
+
+	name_id = settings_nvs_find_name_id(cf, arg->subtree);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf, sizeof(buf));
+	if (rc <= 0) {
+		return 0;
+	}
+
+	read_fn_arg.fs = &cf->cf_nvs;
+	read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+
+	return settings_call_set_handler(arg->subtree, rc, settings_nvs_read_fn,
+					 &read_fn_arg, (void *)arg);
+}
+#endif /* CONFIG_SETTINGS_NVS_LOAD_SUBTREE_PATH */
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -131,6 +249,16 @@ static int settings_nvs_load(struct settings_store *cs,
 	ssize_t rc1, rc2;
 	uint16_t name_id = NVS_NAMECNT_ID;
 
+#ifdef CONFIG_SETTINGS_NVS_LOAD_SUBTREE_PATH
+	/* If arg->subtree is not null we must first load settings in that subtree */
+	if (arg->subtree != NULL) {
+		ret = settings_nvs_load_subtree(cf, arg);
+		if (ret) {
+			return ret;
+		}
+	}
+#endif /* CONFIG_SETTINGS_NVS_LOAD_SUBTREE_PATH */
+
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	uint16_t cached = 0;
 
@@ -204,6 +204,195 @@ ssize_t settings_load_one(const char *name, void *buf, size_t buf_len)
 	return rc;
 }
 
+#ifdef CONFIG_SETTINGS_BATCH
+/*
+ * Pending batch entries are packed one after the other in the buffer: a
+ * header, the name including its terminator, then the value.
+ */
+struct batch_hdr {
+	uint16_t name_len;
+	uint16_t val_len;
+};
+
+static struct {
+	bool active;
+	size_t used;
+	uint8_t buf[CONFIG_SETTINGS_BATCH_BUFFER_SIZE];
+} batch;
+
+static size_t batch_entry_size(const struct batch_hdr *hdr)
+{
+	return sizeof(*hdr) + hdr->name_len + hdr->val_len;
+}
+
+static int settings_batch_put(const char *name, const void *value, size_t val_len)
+{
+	size_t name_len;
+	struct batch_hdr hdr;
+	size_t off;
+
+	if (!name) {
+		return -EINVAL;
+	}
+
+	name_len = strlen(name) + 1;
+
+	if (value == NULL) {
+		val_len = 0;
+	}
+
+	/* The last value saved for a key replaces the pending one */
+	for (off = 0; off < batch.used; off += batch_entry_size(&hdr)) {
+		memcpy(&hdr, &batch.buf[off], sizeof(hdr));
+
+		if (hdr.name_len == name_len &&
+		    memcmp(&batch.buf[off + sizeof(hdr)], name, name_len) == 0) {
+			break;
+		}
+	}
+
+	if (off < batch.used) {
+		size_t size = batch_entry_size(&hdr);
+
+		if (batch.used - size + sizeof(hdr) + name_len + val_len > sizeof(batch.buf)) {
+			return -ENOMEM;
+		}
+
+		/* Keep the position of the key, move the entries behind it */
+		memmove(&batch.buf[off + sizeof(hdr) + name_len + val_len], &batch.buf[off + size],
+			batch.used - off - size);
+		batch.used = batch.used - size + sizeof(hdr) + name_len + val_len;
+	} else {
+		if (batch.used + sizeof(hdr) + name_len + val_len > sizeof(batch.buf)) {
+			return -ENOMEM;
+		}
+
+		batch.used += sizeof(hdr) + name_len + val_len;
+	}
+
+	hdr.name_len = name_len;
+	hdr.val_len = val_len;
+	memcpy(&batch.buf[off], &hdr, sizeof(hdr));
+	memcpy(&batch.buf[off + sizeof(hdr)], name, name_len);
+	if (val_len > 0) {
+		memcpy(&batch.buf[off + sizeof(hdr) + name_len], value, val_len);
+	}
+
+	return 0;
+}
+
+/* Compares with the persisted value, using the unused end of the buffer */
+static bool settings_batch_unchanged(const char *name, const void *value, size_t val_len)
+{
+	uint8_t *scratch = &batch.buf[batch.used];
+	ssize_t len = settings_get_val_len(name);
+
+	if (len < 0 || (size_t)len != val_len) {
+		return false;
+	}
+
+	if (val_len == 0) {
+		/* Deleting a key which does not exist */
+		return true;
+	}
+
+	if (val_len > sizeof(batch.buf) - batch.used) {
+		return false;
+	}
+
+	return settings_load_one(name, scratch, val_len) == (ssize_t)val_len &&
+	       memcmp(scratch, value, val_len) == 0;
+}
+
+int settings_batch_begin(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (batch.active) {
+		k_mutex_unlock(&settings_lock);
+		return -EALREADY;
+	}
+
+	/* The lock is held until the batch is committed or aborted */
+	batch.active = true;
+	batch.used = 0;
+
+	return 0;
+}
+
+int settings_batch_commit(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	struct batch_hdr hdr;
+	int rc = 0;
+	int rc2;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!batch.active) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	batch.active = false;
+
+	if (!cs) {
+		rc = -ENOENT;
+		goto out;
+	}
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	for (size_t off = 0; off < batch.used; off += batch_entry_size(&hdr)) {
+		const char *name = (const char *)&batch.buf[off + sizeof(hdr)];
+		const char *value;
+
+		memcpy(&hdr, &batch.buf[off], sizeof(hdr));
+		value = hdr.val_len > 0 ? name + hdr.name_len : NULL;
+
+		if (settings_batch_unchanged(name, value, hdr.val_len)) {
+			continue;
+		}
+
+		rc2 = cs->cs_itf->csi_save(cs, name, value, hdr.val_len);
+		if (!rc) {
+			rc = rc2;
+		}
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+out:
+	batch.used = 0;
+	k_mutex_unlock(&settings_lock);
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+int settings_batch_abort(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!batch.active) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	batch.active = false;
+	batch.used = 0;
+
+	k_mutex_unlock(&settings_lock);
+	k_mutex_unlock(&settings_lock);
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_BATCH */
+
 /*
  * Append a single value to persisted config. Don't store duplicate value.
  */
@@ -219,6 +408,15 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
+#ifdef CONFIG_SETTINGS_BATCH
+	/* Other threads wait on the lock until the batch is done */
+	if (batch.active) {
+		rc = settings_batch_put(name, value, val_len);
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+#endif
+
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
 
 	k_mutex_unlock(&settings_lock);
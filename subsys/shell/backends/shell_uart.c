@@ -28,13 +28,51 @@ NET_BUF_POOL_DEFINE(smp_shell_rx_pool, CONFIG_MCUMGR_TRANSPORT_SHELL_RX_BUF_COUN
 		    SMP_SHELL_RX_BUF_SIZE, 0, NULL);
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 
+/* Start the transfer of the next chunk of the TX ring. Called with tx_busy set,
+ * which is cleared when the ring is empty.
+ */
+static void async_tx_next(struct shell_uart_async *sh_uart)
+{
+	uint8_t *data;
+	uint32_t len;
+
+	while (true) {
+		len = ring_buf_get_claim(&sh_uart->tx_ringbuf, &data, sh_uart->tx_ringbuf.size);
+		if (len == 0) {
+			atomic_clear(&sh_uart->tx_busy);
+
+			/* Data may have been added before tx_busy was cleared. */
+			if (ring_buf_is_empty(&sh_uart->tx_ringbuf) ||
+			    atomic_set(&sh_uart->tx_busy, 1) != 0) {
+				return;
+			}
+
+			continue;
+		}
+
+		if (uart_tx(sh_uart->common.dev, data, len, SYS_FOREVER_US) == 0) {
+			return;
+		}
+
+		/* Drop data which cannot be sent. */
+		(void)ring_buf_get_finish(&sh_uart->tx_ringbuf, len);
+	}
+}
+
 static void async_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	struct shell_uart_async *sh_uart = (struct shell_uart_async *)user_data;
 
 	switch (evt->type) {
 	case  UART_TX_DONE:
-		k_sem_give(&sh_uart->tx_sem);
+		if (CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_RING_BUFFER_SIZE > 0) {
+			(void)ring_buf_get_finish(&sh_uart->tx_ringbuf, evt->data.tx.len);
+			async_tx_next(sh_uart);
+			sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY,
+						sh_uart->common.context);
+		} else {
+			k_sem_give(&sh_uart->tx_sem);
+		}
 		break;
 	case  UART_RX_RDY:
 		uart_async_rx_on_rdy(&sh_uart->async_rx, evt->data.rx.buf, evt->data.rx.len);
@@ -245,6 +283,11 @@ static void async_init(struct shell_uart_async *sh_uart)
 
 	k_sem_init(&sh_uart->tx_sem, 0, 1);
 
+	if (CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_RING_BUFFER_SIZE > 0) {
+		ring_buf_init(&sh_uart->tx_ringbuf, sizeof(sh_uart->tx_buf), sh_uart->tx_buf);
+		sh_uart->tx_busy = 0;
+	}
+
 	err = uart_async_rx_init(async_rx, &sh_uart->async_rx_config);
 	(void)err;
 	__ASSERT_NO_MSG(err == 0);
@@ -389,6 +432,17 @@ static int async_write(struct shell_uart_async *sh_uart,
 {
 	int err;
 
+	if (CONFIG_SHELL_BACKEND_SERIAL_ASYNC_TX_RING_BUFFER_SIZE > 0) {
+		/* Shell pends on TX ready if nothing fits in the ring. */
+		*cnt = ring_buf_put(&sh_uart->tx_ringbuf, data, length);
+
+		if (atomic_set(&sh_uart->tx_busy, 1) == 0) {
+			async_tx_next(sh_uart);
+		}
+
+		return 0;
+	}
+
 	err = uart_tx(sh_uart->common.dev, data, length, SYS_FOREVER_US);
 	if (err < 0) {
 		*cnt = 0;
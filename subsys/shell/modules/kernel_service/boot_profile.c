@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <stdlib.h>
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+#define BOOT_PROFILE_DEFAULT_COUNT 10
+
+static const char *const level_names[] = {
+	"EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION", "SMP",
+};
+
+static int cmd_kernel_boot_profile(const struct shell *sh, size_t argc, char **argv)
+{
+	const struct init_profile_record *records;
+	size_t count = init_profile_get(&records);
+	size_t top = BOOT_PROFILE_DEFAULT_COUNT;
+	uint64_t total = 0;
+	uint32_t prev_max = UINT32_MAX;
+	size_t prev_idx = SIZE_MAX;
+
+	if (argc > 1) {
+		top = strtoul(argv[1], NULL, 10);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		total += records[i].cycles;
+	}
+
+	shell_print(sh, "%zu init entries, %u us in total", count,
+		    (uint32_t)k_cyc_to_us_floor64(total));
+	shell_print(sh, "%10s %-12s %6s %s", "us", "level", "result", "entry");
+
+	/* Records are in completion order, select the longest ones without sorting them */
+	for (size_t n = 0; n < MIN(top, count); n++) {
+		const struct init_profile_record *rec = NULL;
+		size_t idx = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			const struct init_profile_record *r = &records[i];
+
+			/* Rank ties by index so that each record is printed once */
+			if ((r->cycles > prev_max) || ((r->cycles == prev_max) && (i <= prev_idx))) {
+				continue;
+			}
+			if ((rec == NULL) || (r->cycles > rec->cycles)) {
+				rec = r;
+				idx = i;
+			}
+		}
+
+		if (rec == NULL) {
+			break;
+		}
+		prev_max = rec->cycles;
+		prev_idx = idx;
+
+		if (rec->is_device) {
+			shell_print(sh, "%10u %-12s %6d %s", k_cyc_to_us_floor32(rec->cycles),
+				    level_names[rec->level], rec->result, rec->entry->dev->name);
+		} else {
+			shell_print(sh, "%10u %-12s %6d %p", k_cyc_to_us_floor32(rec->cycles),
+				    level_names[rec->level], rec->result, (void *)rec->entry->srv->init);
+		}
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ARG_ADD(boot_profile, NULL, "[count] Longest init entries run at boot.",
+		   cmd_kernel_boot_profile, 1, 1);
@@ -10,7 +10,7 @@
 
 #include <zephyr/sys/sys_heap.h>
 
-extern struct sys_heap _system_heap;
+extern struct k_heap _system_heap;
 
 static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 {
@@ -20,7 +20,7 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 	int err;
 	struct sys_memory_stats stats;
 
-	err = sys_heap_runtime_stats_get(&_system_heap, &stats);
+	err = sys_heap_runtime_stats_get(&_system_heap.heap, &stats);
 	if (err) {
 		shell_error(sh, "Failed to read kernel system heap statistics (err %d)", err);
 		return -ENOEXEC;
@@ -30,6 +30,33 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "allocated:      %zu", stats.allocated_bytes);
 	shell_print(sh, "max. allocated: %zu", stats.max_allocated_bytes);
 
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+	struct sys_heap_frag_stats frag;
+	k_spinlock_key_t key = k_spin_lock(&_system_heap.lock);
+
+	err = sys_heap_frag_stats_get(&_system_heap.heap, &frag);
+	k_spin_unlock(&_system_heap.lock, key);
+	if (err) {
+		shell_error(sh, "Failed to read kernel system heap fragmentation (err %d)", err);
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "largest free:   %zu", frag.largest_free_bytes);
+	shell_print(sh, "free chunks:    %u", frag.free_chunks);
+	for (int i = 0; i < SYS_HEAP_FRAG_BUCKETS; i++) {
+		if (frag.bucket_chunks[i] != 0U) {
+			shell_print(sh, "  bucket %2d:    %u", i, frag.bucket_chunks[i]);
+		}
+	}
+	shell_print(sh, "alloc latency (cycles):");
+	for (int i = 0; i < SYS_HEAP_LATENCY_BINS; i++) {
+		if (frag.alloc_latency[i] != 0U) {
+			shell_print(sh, "  >= %-10u  %u", (i == 0) ? 0U : (uint32_t)BIT(i),
+				    frag.alloc_latency[i]);
+		}
+	}
+#endif /* CONFIG_SYS_HEAP_FRAG_STATS */
+
 	return 0;
 }
 
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/obj_core.h>
+
+#define LOCKS_TOP_DEFAULT 10
+#define LOCKS_TOP_MAX     32
+
+struct lock_entry {
+	const char *type;
+	const void *obj;
+	struct k_lock_stats stats;
+};
+
+struct lock_top {
+	struct lock_entry entries[LOCKS_TOP_MAX];
+	size_t num;
+	size_t max;
+};
+
+static bool lock_is_worse(const struct k_lock_stats *a, const struct k_lock_stats *b)
+{
+	if (a->contended != b->contended) {
+		return a->contended > b->contended;
+	}
+
+	return a->total_wait > b->total_wait;
+}
+
+/* Insert a lock in the table sorted by contention, dropping the least contended one */
+static void lock_top_add(struct lock_top *top, const char *type, const void *obj,
+			 const struct k_lock_stats *stats)
+{
+	size_t i = top->num;
+
+	if (top->num == top->max) {
+		if (!lock_is_worse(stats, &top->entries[top->max - 1].stats)) {
+			return;
+		}
+		i--;
+	} else {
+		top->num++;
+	}
+
+	for (; i > 0 && lock_is_worse(stats, &top->entries[i - 1].stats); i--) {
+		top->entries[i] = top->entries[i - 1];
+	}
+
+	top->entries[i].type = type;
+	top->entries[i].obj = obj;
+	top->entries[i].stats = *stats;
+}
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+static void spin_lock_stats_cb(const struct k_spinlock *l, const struct k_lock_stats *stats,
+			       void *user_data)
+{
+	lock_top_add(user_data, (l != NULL) ? "spinlock" : "spinlock*", l, stats);
+}
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+#if defined(CONFIG_OBJ_CORE_STATS_MUTEX) || defined(CONFIG_OBJ_CORE_STATS_SEM)
+static int obj_core_stats_cb(struct k_obj_core *obj_core, void *user_data)
+{
+	const void *obj = (const uint8_t *)obj_core - obj_core->type->obj_core_offset;
+	const char *type = (obj_core->type->id == K_OBJ_TYPE_MUTEX_ID) ? "mutex" : "sem";
+	struct k_lock_stats stats;
+
+	if (k_obj_core_stats_raw(obj_core, &stats, sizeof(stats)) == 0) {
+		lock_top_add(user_data, type, obj, &stats);
+	}
+
+	return 0;
+}
+
+static int obj_core_reset_cb(struct k_obj_core *obj_core, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	(void)k_obj_core_stats_reset(obj_core);
+
+	return 0;
+}
+
+static void obj_core_walk(uint32_t type_id, int (*func)(struct k_obj_core *, void *),
+			  void *user_data)
+{
+	struct k_obj_type *type = k_obj_type_find(type_id);
+
+	if (type != NULL) {
+		/*
+		 * Use the unlocked version as accessing the statistics takes
+		 * the object core lock.
+		 */
+		k_obj_type_walk_unlocked(type, func, user_data);
+	}
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX || CONFIG_OBJ_CORE_STATS_SEM */
+
+static int cmd_kernel_locks(const struct shell *sh, size_t argc, char **argv)
+{
+	static struct lock_top top;
+	int err = 0;
+
+	top.num = 0;
+	top.max = LOCKS_TOP_DEFAULT;
+
+	if (argc > 1) {
+		top.max = shell_strtoul(argv[1], 10, &err);
+		if (err != 0 || top.max == 0) {
+			shell_error(sh, "Unable to parse input (err %d)", err);
+			return -EINVAL;
+		}
+
+		top.max = MIN(top.max, LOCKS_TOP_MAX);
+	}
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	k_spin_lock_stats_foreach(spin_lock_stats_cb, &top);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	obj_core_walk(K_OBJ_TYPE_MUTEX_ID, obj_core_stats_cb, &top);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	obj_core_walk(K_OBJ_TYPE_SEM_ID, obj_core_stats_cb, &top);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
+	shell_print(sh, "%-10s %-10s %10s %10s %10s %10s %10s %12s", "type", "object",
+		    "acquired", "contended", "spins", "max hold", "max wait", "total wait");
+
+	for (size_t i = 0; i < top.num; i++) {
+		const struct lock_entry *e = &top.entries[i];
+
+		shell_print(sh, "%-10s %-10p %10u %10u %10u %10u %10u %12llu", e->type, e->obj,
+			    e->stats.acquired, e->stats.contended, e->stats.spins,
+			    e->stats.max_hold, e->stats.max_wait,
+			    (unsigned long long)e->stats.total_wait);
+	}
+
+	shell_print(sh, "Times in cycles, spinlock* are spinlocks beyond the statistics table.");
+
+	return 0;
+}
+
+static int cmd_kernel_locks_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	k_spin_lock_stats_reset();
+#endif /* CONFIG_SPIN_LOCK_STATS */
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	obj_core_walk(K_OBJ_TYPE_MUTEX_ID, obj_core_reset_cb, NULL);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	obj_core_walk(K_OBJ_TYPE_SEM_ID, obj_core_reset_cb, NULL);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_locks,
+	SHELL_CMD(reset, NULL, "Reset lock statistics.", cmd_kernel_locks_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+KERNEL_CMD_ARG_ADD(locks, &sub_kernel_locks,
+		   "Most contended locks, sorted by contended acquisitions.\n"
+		   "Usage: kernel locks [<count>]",
+		   cmd_kernel_locks, 1, 1);
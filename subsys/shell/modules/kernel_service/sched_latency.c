@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+static void shell_latency_dump(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname;
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%s%p %-10s",
+		    (thread == k_current_get()) ? "*" : " ",
+		    thread,
+		    tname ? tname : "NA");
+
+	for (unsigned int i = 0; i < CONFIG_SCHED_THREAD_LATENCY_BUCKETS; i++) {
+		if (stats.latency[i] == 0U) {
+			continue;
+		}
+
+		if (i == CONFIG_SCHED_THREAD_LATENCY_BUCKETS - 1) {
+			shell_print(sh, "\t>= %u cycles: %u", (1U << i), stats.latency[i]);
+		} else {
+			shell_print(sh, "\t%u - %u cycles: %u", (i == 0U) ? 0U : (1U << i),
+				    (2U << i) - 1U, stats.latency[i]);
+		}
+	}
+}
+
+static int cmd_kernel_sched_latency(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Ready to run latency:");
+
+	/*
+	 * Use the unlocked version as the callback itself might call
+	 * arch_irq_unlock.
+	 */
+	k_thread_foreach_unlocked(shell_latency_dump, (void *)sh);
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(sched_latency, NULL, "Thread scheduling latency histograms.",
+	       cmd_kernel_sched_latency);
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+#define WINDOW_MS(i) (CONFIG_SCHED_THREAD_USAGE_WINDOW_MS * ((i) == 0 ? 1 : (i) == 1 ? 10 : 100))
+
+static void shell_usage_print(const struct shell *sh, const char *label,
+			      const k_thread_runtime_stats_t *stats)
+{
+	shell_print(sh, "%-24s %3u.%u%% %3u.%u%% %3u.%u%%", label,
+		    stats->utilization[0] / 10U, stats->utilization[0] % 10U,
+		    stats->utilization[1] / 10U, stats->utilization[1] % 10U,
+		    stats->utilization[2] / 10U, stats->utilization[2] % 10U);
+}
+
+static void shell_usage_dump(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname;
+	char label[24 + 1];
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+	snprintk(label, sizeof(label), "%s%p %s", (thread == k_current_get()) ? "*" : " ",
+		 thread, tname ? tname : "NA");
+
+	shell_usage_print(sh, label, &stats);
+}
+
+static int cmd_kernel_usage(const struct shell *sh, size_t argc, char **argv)
+{
+	k_thread_runtime_stats_t stats;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Utilization over the last %u ms, %u ms and %u ms:", WINDOW_MS(0),
+		    WINDOW_MS(1), WINDOW_MS(2));
+
+	if (IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)) {
+		unsigned int num_cpus = arch_num_cpus();
+
+		for (unsigned int i = 0; i < num_cpus; i++) {
+			char label[sizeof(" CPU XXX")];
+
+			(void)k_thread_runtime_stats_cpu_get(i, &stats);
+			snprintk(label, sizeof(label), " CPU %u", i);
+			shell_usage_print(sh, label, &stats);
+		}
+	}
+
+	/*
+	 * Use the unlocked version as the callback itself might call
+	 * arch_irq_unlock.
+	 */
+	k_thread_foreach_unlocked(shell_usage_dump, (void *)sh);
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(usage, NULL, "Thread and CPU utilization over sliding windows.",
+	       cmd_kernel_usage);
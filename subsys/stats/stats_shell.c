@@ -6,6 +6,10 @@
 
 #include <zephyr/shell/shell.h>
 #include <zephyr/stats/stats.h>
+#include <zephyr/sys/base64.h>
+
+/* Multiple of 3 so that encoded chunks can be concatenated. */
+#define STATS_DUMP_CHUNK 48
 
 static int stats_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
 {
@@ -43,8 +47,56 @@ static int cmd_stats_list(const struct shell *sh, size_t argc,
 	return stats_group_walk(stats_group_cb, (struct shell *)sh);
 }
 
+/* Print a group as a single line: name, size and number of entries, and the
+ * raw entries encoded in base64.
+ */
+static int stats_dump_cb(struct stats_hdr *hdr, void *arg)
+{
+	const struct shell *sh = arg;
+	const uint8_t *data = (const uint8_t *)hdr + sizeof(*hdr);
+	size_t len = (size_t)hdr->s_size * hdr->s_cnt;
+	char out[4 * (STATS_DUMP_CHUNK / 3) + 1];
+
+	shell_fprintf_normal(sh, "%s %u %u ", hdr->s_name, hdr->s_size, hdr->s_cnt);
+
+	for (size_t off = 0; off < len; off += STATS_DUMP_CHUNK) {
+		size_t olen;
+
+		if (base64_encode(out, sizeof(out), &olen, &data[off],
+				  MIN(len - off, STATS_DUMP_CHUNK)) != 0) {
+			return -ENOMEM;
+		}
+
+		shell_fprintf_normal(sh, "%s", out);
+	}
+
+	shell_fprintf_normal(sh, "\n");
+
+	return 0;
+}
+
+static int cmd_stats_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	struct stats_hdr *hdr;
+
+	if (argc < 2) {
+		return stats_group_walk(stats_dump_cb, (void *)sh);
+	}
+
+	hdr = stats_group_find(argv[1]);
+	if (hdr == NULL) {
+		shell_error(sh, "Stats group %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	return stats_dump_cb(hdr, (void *)sh);
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_stats,
 			       SHELL_CMD(list, NULL, "List stats", cmd_stats_list),
+			       SHELL_CMD_ARG(dump, NULL,
+					     "Dump raw stats in base64 [<group>]",
+					     cmd_stats_dump, 1, 1),
 			       SHELL_SUBCMD_SET_END /* Array terminated. */
 			       );
 
@@ -184,10 +184,158 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Read back written data and hand it to the callback */
+static int stream_flash_verify(struct stream_flash_ctx *ctx, uint8_t *buf, size_t len,
+			       size_t write_addr)
 {
 	int rc = 0;
+
+#if defined(CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK)
+
+	if (ctx->callback) {
+		/* Invert to ensure that caller is able to discover a faulty
+		 * flash_read() even if no error code is returned.
+		 */
+		for (int i = 0; i < len; i++) {
+			buf[i] = ~buf[i];
+		}
+
+		rc = flash_read(ctx->fdev, write_addr, buf, len);
+		if (rc != 0) {
+			LOG_ERR("flash read failed: %d", rc);
+			return rc;
+		}
+
+		rc = ctx->callback(buf, len, write_addr);
+		if (rc != 0) {
+			LOG_ERR("callback failed: %d", rc);
+			return rc;
+		}
+	}
+
+#endif
+
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+static void stream_flash_pipe_done(const struct device *dev, struct flash_async_op *op,
+				   int result)
+{
+	struct stream_flash_ctx *ctx = op->user_data;
+
+	if ((result != 0) && (ctx->pipe_rc == 0)) {
+		ctx->pipe_rc = result;
+	}
+
+	/* The operation is idle by now, the writer may preempt the flash
+	 * async thread and queue it again as soon as it is woken up
+	 */
+	k_sem_give(&ctx->pipe_sem);
+}
+
+/* Wait for queued operations and complete the write in progress */
+static int stream_flash_pipe_wait(struct stream_flash_ctx *ctx)
+{
 	size_t write_addr = ctx->offset + ctx->bytes_written;
+	size_t len = ctx->pipe_bytes;
+	int rc;
+
+	for (; ctx->pipe_ops > 0; ctx->pipe_ops--) {
+		(void)k_sem_take(&ctx->pipe_sem, K_FOREVER);
+	}
+
+	rc = ctx->pipe_rc;
+	ctx->pipe_rc = 0;
+	ctx->pipe_bytes = 0;
+
+	if (rc != 0) {
+		LOG_ERR("background write error %d offset=0x%08zx", rc, write_addr);
+		return rc;
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	rc = stream_flash_verify(ctx, ctx->pipe_buf, len, write_addr);
+	if (rc != 0) {
+		return rc;
+	}
+
+	ctx->bytes_written += len;
+
+	return 0;
+}
+
+/* Erase the page following the queued write, if the next write will need it */
+static void stream_flash_pipe_erase_ahead(struct stream_flash_ctx *ctx)
+{
+#if defined(CONFIG_STREAM_FLASH_ERASE)
+	struct flash_pages_info page;
+	size_t next_end = ctx->bytes_written + ctx->pipe_bytes + ctx->buf_len;
+	int rc;
+#if defined(CONFIG_STREAM_FLASH_ERASE_ONLY_WHEN_SUPPORTED)
+	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
+
+	if (!(flash_params_get_erase_cap(fparams) & FLASH_ERASE_C_EXPLICIT)) {
+		return;
+	}
+#endif
+
+	if ((next_end <= ctx->erased_up_to) || (ctx->erased_up_to >= ctx->available)) {
+		return;
+	}
+
+	rc = flash_get_page_info_by_offs(ctx->fdev, ctx->offset + ctx->erased_up_to, &page);
+	if (rc != 0) {
+		/* The next write erases it synchronously */
+		return;
+	}
+
+	LOG_DBG("Erasing page at offset 0x%08lx ahead", (long)page.start_offset);
+
+	/* Queued after the write, and before the write that needs the page */
+	rc = flash_erase_async(ctx->fdev, page.start_offset, page.size, &ctx->erase_op,
+			       stream_flash_pipe_done);
+	if (rc == 0) {
+		ctx->erased_up_to += page.size;
+		ctx->pipe_ops++;
+	}
+#endif
+}
+
+static int stream_flash_pipe_write(struct stream_flash_ctx *ctx, size_t write_addr,
+				   size_t len)
+{
+	uint8_t *buf = ctx->buf;
+	int rc;
+
+	rc = flash_write_async(ctx->fdev, write_addr, buf, len, &ctx->write_op,
+			       stream_flash_pipe_done);
+	if (rc != 0) {
+		LOG_ERR("flash_write_async error %d offset=0x%08zx", rc, write_addr);
+		return rc;
+	}
+
+	ctx->pipe_ops = 1;
+	ctx->pipe_bytes = ctx->buf_bytes;
+
+	/* Fill the other buffer while this one is being written */
+	ctx->buf = ctx->pipe_buf;
+	ctx->pipe_buf = buf;
+	ctx->buf_bytes = 0U;
+
+	stream_flash_pipe_erase_ahead(ctx);
+
+	return 0;
+}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc = 0;
+	size_t write_addr;
 	size_t buf_bytes_aligned;
 	size_t fill_length;
 	uint8_t filler;
@@ -197,6 +345,16 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		return 0;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	/* Only one write is in progress at a time */
+	rc = stream_flash_pipe_wait(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+#endif
+
+	write_addr = ctx->offset + ctx->bytes_written;
+
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
@@ -218,6 +376,13 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	buf_bytes_aligned = ctx->buf_bytes + fill_length;
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->pipe_buf != NULL) {
+		return stream_flash_pipe_write(ctx, write_addr, buf_bytes_aligned);
+	}
+#endif
+
 	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
 
 	if (rc != 0) {
@@ -226,32 +391,11 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		return rc;
 	}
 
-#if defined(CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK)
-
-	if (ctx->callback) {
-		/* Invert to ensure that caller is able to discover a faulty
-		 * flash_read() even if no error code is returned.
-		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
-		}
-
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
-		if (rc != 0) {
-			LOG_ERR("flash read failed: %d", rc);
-			return rc;
-		}
-
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
-		if (rc != 0) {
-			LOG_ERR("callback failed: %d", rc);
-			return rc;
-		}
+	rc = stream_flash_verify(ctx, ctx->buf, ctx->buf_bytes, write_addr);
+	if (rc != 0) {
+		return rc;
 	}
 
-#endif
-
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
@@ -269,7 +413,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (ctx->bytes_written + stream_flash_bytes_buffered(ctx) + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -299,6 +443,12 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (flush && (rc == 0)) {
+		rc = stream_flash_pipe_wait(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -307,6 +457,30 @@ size_t stream_flash_bytes_written(const struct stream_flash_ctx *ctx)
 	return ctx->bytes_written;
 }
 
+size_t stream_flash_bytes_buffered(const struct stream_flash_ctx *ctx)
+{
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	return ctx->buf_bytes + ctx->pipe_bytes;
+#else
+	return ctx->buf_bytes;
+#endif
+}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+int stream_flash_pipeline_enable(struct stream_flash_ctx *ctx, uint8_t *buf)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	ctx->pipe_buf = buf;
+	ctx->write_op.user_data = ctx;
+	ctx->erase_op.user_data = ctx;
+
+	return 0;
+}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
 #ifdef CONFIG_STREAM_FLASH_INSPECT
 struct _inspect_flash {
 	size_t buf_len;
@@ -408,6 +582,16 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 #endif
 	ctx->erase_value = params->erase_value;
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	ctx->pipe_buf = NULL;
+	ctx->pipe_bytes = 0;
+	ctx->pipe_ops = 0;
+	ctx->pipe_rc = 0;
+	memset(&ctx->write_op, 0, sizeof(ctx->write_op));
+	memset(&ctx->erase_op, 0, sizeof(ctx->erase_op));
+	k_sem_init(&ctx->pipe_sem, 0, 2);
+#endif
+
 	/* Inspection is deliberately done once context has been filled in */
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_INSPECT)) {
 		int ret  = inspect_device(ctx);
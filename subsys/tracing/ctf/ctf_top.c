@@ -760,6 +760,16 @@ void sys_trace_net_tx_time(struct net_pkt *pkt, uint32_t end_time)
 			    (uint32_t)duration_us);
 }
 
+void sys_trace_bt_iso_recv(struct bt_iso_chan *chan, uint16_t seq_num, uint8_t flags)
+{
+	ctf_top_bt_iso_recv((uint32_t)(uintptr_t)chan, (uint32_t)seq_num, (uint32_t)flags);
+}
+
+void sys_trace_bt_iso_send(struct bt_iso_chan *chan, uint16_t seq_num)
+{
+	ctf_top_bt_iso_send((uint32_t)(uintptr_t)chan, (uint32_t)seq_num);
+}
+
 void sys_trace_named_event(const char *name, uint32_t arg0, uint32_t arg1)
 {
 	ctf_bounded_string_t ctf_name = {""};
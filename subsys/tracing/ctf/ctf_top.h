@@ -186,6 +186,8 @@ typedef enum {
 	CTF_EVENT_GPIO_GET_PENDING_INT_EXIT = 0x7C,
 	CTF_EVENT_GPIO_FIRE_CALLBACKS_ENTER = 0x7D,
 	CTF_EVENT_GPIO_FIRE_CALLBACK = 0x7E,
+	CTF_EVENT_BT_ISO_RECV = 0x7F,
+	CTF_EVENT_BT_ISO_SEND = 0x80,
 } ctf_event_t;
 
 typedef struct {
@@ -685,6 +687,16 @@ static inline void ctf_top_net_tx_time(int32_t if_index, uint32_t iface, uint32_
 		  if_index, iface, pkt, priority, tc, duration);
 }
 
+static inline void ctf_top_bt_iso_recv(uint32_t chan, uint32_t seq_num, uint32_t flags)
+{
+	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_BT_ISO_RECV), chan, seq_num, flags);
+}
+
+static inline void ctf_top_bt_iso_send(uint32_t chan, uint32_t seq_num)
+{
+	CTF_EVENT(CTF_LITERAL(uint8_t, CTF_EVENT_BT_ISO_SEND), chan, seq_num);
+}
+
 static inline void ctf_named_event(ctf_bounded_string_t name, uint32_t arg0,
 				   uint32_t arg1)
 {
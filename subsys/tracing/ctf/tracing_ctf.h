@@ -598,6 +598,11 @@ void sys_trace_socket_socketpair_exit(int sock_A, int sock_B, int ret);
 #define sys_port_trace_net_tx_time(pkt, end_time)		\
 	sys_trace_net_tx_time(pkt, end_time)
 
+#define sys_port_trace_bt_iso_recv(chan, seq_num, flags)	\
+	sys_trace_bt_iso_recv(chan, seq_num, flags)
+#define sys_port_trace_bt_iso_send(chan, seq_num)		\
+	sys_trace_bt_iso_send(chan, seq_num)
+
 struct net_if;
 struct net_pkt;
 
@@ -608,6 +613,11 @@ void sys_trace_net_send_data_exit(struct net_pkt *pkt, int ret);
 void sys_trace_net_rx_time(struct net_pkt *pkt, uint32_t end_time);
 void sys_trace_net_tx_time(struct net_pkt *pkt, uint32_t end_time);
 
+struct bt_iso_chan;
+
+void sys_trace_bt_iso_recv(struct bt_iso_chan *chan, uint16_t seq_num, uint8_t flags);
+void sys_trace_bt_iso_send(struct bt_iso_chan *chan, uint16_t seq_num);
+
 void sys_trace_named_event(const char *name, uint32_t arg0, uint32_t arg1);
 
 /* GPIO */
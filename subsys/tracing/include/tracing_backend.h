@@ -31,6 +31,16 @@ struct tracing_backend_api {
 	void (*init)(void);
 	void (*output)(const struct tracing_backend *backend,
 		       uint8_t *data, uint32_t length);
+	/**
+	 * Optional, queue tracing buffer data for output without copying it.
+	 * Data stays valid until the backend gives it back, in order, with
+	 * tracing_buffer_release(). Used instead of output() by the tracing
+	 * thread when provided. output() may then be NULL, in which case the
+	 * backend must depend on CONFIG_TRACING_ASYNC as the synchronous
+	 * format does not queue data.
+	 */
+	void (*queue)(const struct tracing_backend *backend,
+		      uint8_t *data, uint32_t length);
 };
 
 /**
@@ -77,11 +87,40 @@ static inline void tracing_backend_output(
 		const struct tracing_backend *backend,
 		uint8_t *data, uint32_t length)
 {
-	if (backend && backend->api) {
+	if (backend && backend->api && backend->api->output) {
 		backend->api->output(backend, data, length);
 	}
 }
 
+/**
+ * @brief Check if tracing backend can queue data without copying it.
+ *
+ * @param backend Pointer to tracing_backend instance.
+ *
+ * @return true if the backend implements queue().
+ */
+static inline bool tracing_backend_has_queue(
+		const struct tracing_backend *backend)
+{
+	return backend && backend->api && backend->api->queue;
+}
+
+/**
+ * @brief Queue tracing buffer data with tracing backend.
+ *
+ * Only valid if tracing_backend_has_queue() is true for the backend.
+ *
+ * @param backend Pointer to tracing_backend instance.
+ * @param data    Address of queued tracing buffer data.
+ * @param length  Length of queued tracing buffer data.
+ */
+static inline void tracing_backend_queue(
+		const struct tracing_backend *backend,
+		uint8_t *data, uint32_t length)
+{
+	backend->api->queue(backend, data, length);
+}
+
 /**
  * @brief Get tracing backend based on the name of
  *        tracing backend in tracing backend section.
@@ -33,6 +33,16 @@ bool is_tracing_enabled(void);
  */
 void tracing_buffer_handle(uint8_t *data, uint32_t length);
 
+/**
+ * @brief Give tracing buffer data queued by backend back to tracing buffer.
+ *
+ * Data must be released in the order it was queued. Can be called from
+ * any context.
+ *
+ * @param length Length of released data.
+ */
+void tracing_buffer_release(uint32_t length);
+
 /**
  * @brief Handle tracing packet drop.
  */
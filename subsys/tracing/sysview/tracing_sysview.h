@@ -755,6 +755,12 @@ void sys_trace_named_event(const char *name, uint32_t arg0, uint32_t arg1);
 #define sys_port_trace_net_rx_time(pkt, end_time)
 #define sys_port_trace_net_tx_time(pkt, end_time)
 
+#define sys_port_trace_bt_iso_recv(chan, seq_num, flags)                                           \
+	SEGGER_SYSVIEW_RecordU32x3(TID_BT_ISO_RECV, (uint32_t)(uintptr_t)chan,                     \
+				   (uint32_t)seq_num, (uint32_t)flags)
+#define sys_port_trace_bt_iso_send(chan, seq_num)                                                  \
+	SEGGER_SYSVIEW_RecordU32x2(TID_BT_ISO_SEND, (uint32_t)(uintptr_t)chan, (uint32_t)seq_num)
+
 #define sys_port_trace_gpio_pin_interrupt_configure_enter(port, pin, flags)
 #define sys_port_trace_gpio_pin_interrupt_configure_exit(port, pin, ret)
 #define sys_port_trace_gpio_pin_configure_enter(port, pin, flags)
@@ -158,7 +158,10 @@ extern "C" {
 
 #define TID_NAMED_EVENT (131u + TID_OFFSET)
 
-/* latest ID is 130 */
+#define TID_BT_ISO_RECV (132u + TID_OFFSET)
+#define TID_BT_ISO_SEND (133u + TID_OFFSET)
+
+/* latest ID is 133 */
 
 #ifdef __cplusplus
 }
@@ -778,6 +778,9 @@ void sys_trace_k_event_init(struct k_event *event);
 #define sys_port_trace_net_rx_time(pkt, end_time)
 #define sys_port_trace_net_tx_time(pkt, end_time)
 
+#define sys_port_trace_bt_iso_recv(chan, seq_num, flags)
+#define sys_port_trace_bt_iso_send(chan, seq_num)
+
 #define sys_trace_sys_init_enter(...)
 #define sys_trace_sys_init_exit(...)
 
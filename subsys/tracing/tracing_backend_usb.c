@@ -19,9 +19,29 @@
 #include <tracing_buffer.h>
 #include <tracing_backend.h>
 
-/* Single bounce buffer for bulk IN transfer */
-UDC_BUF_POOL_DEFINE(tracing_data_pool, 1, CONFIG_TRACING_BUFFER_SIZE,
-		    sizeof(struct udc_buf_info), NULL);
+/*
+ * Number of bulk IN transfers in flight. While one transfer is processed by
+ * the controller, the next one is already queued.
+ */
+#define TRACING_USB_XFERS		2
+
+/* Workaround net_buf that uses uint16_t storage for lengths */
+#define TRACING_USB_XFER_MAX_LEN	ROUND_DOWN(UINT16_MAX, 512)
+
+struct tracing_buf_info {
+	struct udc_buf_info udc;
+	/* Length of tracing buffer data to be released on completion */
+	uint16_t length;
+};
+
+/*
+ * Bulk IN transfers point directly into the tracing buffer. The pool only
+ * provides bounce buffers for the data up to the next address aligned for
+ * the controller, if it has alignment requirements.
+ */
+UDC_BUF_POOL_VAR_DEFINE(tracing_data_pool, TRACING_USB_XFERS + 1,
+			TRACING_USB_XFERS * ROUND_UP(UDC_BUF_ALIGN, UDC_BUF_GRANULARITY),
+			sizeof(struct tracing_buf_info), NULL);
 
 struct tracing_func_desc {
 	struct usb_if_descriptor if0;
@@ -35,7 +55,7 @@ struct tracing_func_data {
 	struct tracing_func_desc *const desc;
 	const struct usb_desc_header **const fs_desc;
 	const struct usb_desc_header **const hs_desc;
-	struct k_sem sync_sem;
+	struct k_sem xfer_sem;
 	atomic_t state;
 };
 
@@ -116,8 +136,11 @@ static int tracing_func_request_handler(struct usbd_class_data *const c_data,
 	}
 
 	if (bi->ep == tracing_func_get_bulk_in(c_data)) {
+		uint16_t length = ((struct tracing_buf_info *)bi)->length;
+
 		usbd_ep_buf_free(uds_ctx, buf);
-		k_sem_give(&data->sync_sem);
+		tracing_buffer_release(length);
+		k_sem_give(&data->xfer_sem);
 	}
 
 	return 0;
@@ -236,62 +259,89 @@ static struct tracing_func_data func_data = {
 	.desc = &func_desc,
 	.fs_desc = tracing_func_fs_desc,
 	.hs_desc = COND_CODE_1(USBD_SUPPORTS_HIGH_SPEED, (tracing_func_hs_desc), (NULL)),
-	.sync_sem = Z_SEM_INITIALIZER(func_data.sync_sem, 0, 1),
+	.xfer_sem = Z_SEM_INITIALIZER(func_data.xfer_sem, TRACING_USB_XFERS, TRACING_USB_XFERS),
 };
 
 USBD_DEFINE_CLASS(tracing_func, &tracing_func_api, &func_data, NULL);
 
-struct net_buf *tracing_func_buf_alloc(struct usbd_class_data *const c_data)
+static struct net_buf *tracing_func_buf_alloc(struct usbd_class_data *const c_data,
+					      uint8_t *data, uint32_t length)
 {
-	struct udc_buf_info *bi;
+	struct tracing_buf_info *bi;
 	struct net_buf *buf;
 
-	buf = net_buf_alloc(&tracing_data_pool, K_NO_WAIT);
-	if (!buf) {
+	if (IS_UDC_ALIGNED((uintptr_t)data)) {
+		/* Pass the tracing buffer content with zero-copy */
+		length = MIN(length, TRACING_USB_XFER_MAX_LEN);
+		buf = net_buf_alloc_with_data(&tracing_data_pool, data, length, K_NO_WAIT);
+	} else {
+		/* Copy the data up to the next aligned address */
+		length = MIN(length, UDC_BUF_ALIGN - (uintptr_t)data % UDC_BUF_ALIGN);
+		buf = net_buf_alloc_len(&tracing_data_pool, length, K_NO_WAIT);
+		if (buf != NULL) {
+			net_buf_add_mem(buf, data, length);
+		}
+	}
+
+	if (buf == NULL) {
 		return NULL;
 	}
 
-	bi = udc_get_buf_info(buf);
-	bi->ep = tracing_func_get_bulk_in(c_data);
+	bi = (struct tracing_buf_info *)udc_get_buf_info(buf);
+	bi->udc.ep = tracing_func_get_bulk_in(c_data);
+	bi->length = length;
 
 	return buf;
 }
 
-static void tracing_backend_usb_output(const struct tracing_backend *backend,
-				       uint8_t *data, uint32_t length)
+/* Give data back once all transfers in flight, which precede it, complete */
+static void tracing_backend_usb_discard(uint32_t length)
+{
+	for (int i = 1; i < TRACING_USB_XFERS; i++) {
+		k_sem_take(&func_data.xfer_sem, K_FOREVER);
+	}
+
+	tracing_buffer_release(length);
+
+	for (int i = 0; i < TRACING_USB_XFERS; i++) {
+		k_sem_give(&func_data.xfer_sem);
+	}
+}
+
+static void tracing_backend_usb_queue(const struct tracing_backend *backend,
+				      uint8_t *data, uint32_t length)
 {
-	int ret = 0;
-	uint32_t bytes;
 	struct net_buf *buf;
 
 	while (length > 0) {
+		k_sem_take(&func_data.xfer_sem, K_FOREVER);
+
 		if (!atomic_test_bit(&func_data.state, TRACING_FUNCTION_ENABLED) ||
 		    !is_tracing_enabled()) {
+			tracing_backend_usb_discard(length);
 			return;
 		}
 
-		buf = tracing_func_buf_alloc(&tracing_func);
+		buf = tracing_func_buf_alloc(&tracing_func, data, length);
 		if (buf == NULL) {
+			tracing_backend_usb_discard(length);
 			return;
 		}
 
-		bytes = MIN(length, net_buf_tailroom(buf));
-		net_buf_add_mem(buf, data, bytes);
+		data += buf->len;
+		length -= buf->len;
+
+		if (usbd_ep_enqueue(&tracing_func, buf)) {
+			uint16_t len = buf->len;
 
-		ret = usbd_ep_enqueue(&tracing_func, buf);
-		if (ret) {
 			net_buf_unref(buf);
-			continue;
+			tracing_backend_usb_discard(len);
 		}
-
-		data += bytes;
-		length -= bytes;
-		k_sem_take(&func_data.sync_sem, K_FOREVER);
 	}
 }
 
 const struct tracing_backend_api tracing_backend_usb_api = {
-	.output = tracing_backend_usb_output
+	.queue = tracing_backend_usb_queue
 };
 
 TRACING_BACKEND_DEFINE(tracing_backend_usb, tracing_backend_usb_api);
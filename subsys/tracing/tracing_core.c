@@ -40,6 +40,52 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+/* Data queued by the backend and data given back by the backend */
+static uint32_t tracing_queued_length;
+static atomic_t tracing_released_length;
+
+void tracing_buffer_release(uint32_t length)
+{
+	atomic_add(&tracing_released_length, length);
+	k_sem_give(&tracing_thread_sem);
+}
+
+/*
+ * Hand tracing buffer data to a backend that transfers it without copying.
+ * Data stays claimed until the backend releases it, so that the producers
+ * cannot overwrite it while the backend sends more data.
+ */
+static void tracing_thread_queue(uint32_t max_length)
+{
+	uint32_t released = atomic_clear(&tracing_released_length);
+	uint8_t *data;
+	uint32_t length;
+
+	if (released) {
+		/*
+		 * Finishing the released data also drops the claim of data
+		 * still queued by the backend, which has to be claimed again.
+		 */
+		tracing_buffer_get_finish(released);
+		tracing_queued_length -= released;
+
+		for (uint32_t claimed = 0; claimed < tracing_queued_length;
+		     claimed += length) {
+			length = tracing_buffer_get_claim(&data,
+					tracing_queued_length - claimed);
+		}
+	}
+
+	length = tracing_buffer_get_claim(&data, max_length);
+	if (length == 0) {
+		k_sem_take(&tracing_thread_sem, K_FOREVER);
+		return;
+	}
+
+	tracing_queued_length += length;
+	tracing_backend_queue(working_backend, data, length);
+}
+
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -50,7 +96,9 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 	tracing_buffer_max_length = tracing_buffer_capacity_get();
 
 	while (true) {
-		if (tracing_buffer_is_empty()) {
+		if (tracing_backend_has_queue(working_backend)) {
+			tracing_thread_queue(tracing_buffer_max_length);
+		} else if (tracing_buffer_is_empty()) {
 			k_sem_take(&tracing_thread_sem, K_FOREVER);
 		} else {
 			transferring_length =
@@ -456,6 +456,9 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_net_rx_time(pkt, end_time)
 #define sys_port_trace_net_tx_time(pkt, end_time)
 
+#define sys_port_trace_bt_iso_recv(chan, seq_num, flags)
+#define sys_port_trace_bt_iso_send(chan, seq_num)
+
 #define sys_trace_named_event(name, arg0, arg1)
 
 #define sys_port_trace_gpio_pin_interrupt_configure_enter(port, pin, flags) \
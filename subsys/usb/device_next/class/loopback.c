@@ -28,6 +28,8 @@ static uint8_t lb_buf[1024];
 
 #define LB_VENDOR_REQ_OUT		0x5b
 #define LB_VENDOR_REQ_IN		0x5c
+#define LB_VENDOR_REQ_STATS		0x5d
+#define LB_VENDOR_REQ_STATS_RESET	0x5e
 
 #define LB_ISO_EP_MPS			256
 #define LB_ISO_EP_INTERVAL		1
@@ -36,10 +38,53 @@ static uint8_t lb_buf[1024];
 #define LB_FUNCTION_BULK_MANUAL		1
 #define LB_FUNCTION_IN_ENGAGED		2
 #define LB_FUNCTION_OUT_ENGAGED		3
+#define LB_FUNCTION_ISO_ENABLED		4
+
+/* Number of transfers kept queued on each isochronous endpoint */
+#define LB_ISO_NUM_BUFS			2
 
 /* Make supported vendor request visible for the device stack */
+#if defined(CONFIG_USBD_LOOPBACK_BENCHMARK)
+static const struct usbd_cctx_vendor_req lb_vregs =
+	USBD_VENDOR_REQ(LB_VENDOR_REQ_OUT, LB_VENDOR_REQ_IN,
+			LB_VENDOR_REQ_STATS, LB_VENDOR_REQ_STATS_RESET);
+#else
 static const struct usbd_cctx_vendor_req lb_vregs =
 	USBD_VENDOR_REQ(LB_VENDOR_REQ_OUT, LB_VENDOR_REQ_IN);
+#endif
+
+enum lb_stats_idx {
+	LB_STATS_BULK_OUT,
+	LB_STATS_BULK_IN,
+	LB_STATS_ISO_OUT,
+	LB_STATS_ISO_IN,
+	LB_STATS_CONTROL,
+	LB_STATS_NUM,
+};
+
+/*
+ * Transfer statistics of a single endpoint. The timestamps are taken in the
+ * USB device stack thread when the transfer completion is processed, the
+ * interval values are in cycles between two consecutive completions.
+ */
+struct lb_stats {
+	uint32_t count;
+	uint32_t errors;
+	uint64_t bytes;
+	uint32_t last;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint64_t sum_sq;
+};
+
+/*
+ * Statistics report layout, all values are little-endian:
+ * uint32_t cycles per second, uint32_t number of entries, followed by
+ * entries with count, errors, bytes, min, max, sum, sum_sq fields.
+ */
+#define LB_STATS_ENTRY_SIZE		40U
+#define LB_STATS_REPORT_SIZE		(8U + LB_STATS_NUM * LB_STATS_ENTRY_SIZE)
 
 struct loopback_desc {
 	struct usb_association_descriptor iad;
@@ -65,8 +110,84 @@ struct lb_data {
 	const struct usb_desc_header **const fs_desc;
 	const struct usb_desc_header **const hs_desc;
 	atomic_t state;
+#if defined(CONFIG_USBD_LOOPBACK_BENCHMARK)
+	struct lb_stats stats[LB_STATS_NUM];
+#endif
 };
 
+#if defined(CONFIG_USBD_LOOPBACK_BENCHMARK)
+static void lb_stats_reset(struct lb_data *const data)
+{
+	memset(data->stats, 0, sizeof(data->stats));
+	for (size_t i = 0; i < ARRAY_SIZE(data->stats); i++) {
+		data->stats[i].min = UINT32_MAX;
+	}
+}
+
+static void lb_stats_update(struct lb_data *const data,
+			    const enum lb_stats_idx idx,
+			    const size_t len, const int err)
+{
+	struct lb_stats *const st = &data->stats[idx];
+	const uint32_t now = k_cycle_get_32();
+	uint32_t delta;
+
+	if (err == -ECONNABORTED) {
+		return;
+	}
+
+	if (err != 0) {
+		st->errors++;
+		return;
+	}
+
+	if (st->count != 0) {
+		delta = now - st->last;
+		st->min = MIN(st->min, delta);
+		st->max = MAX(st->max, delta);
+		st->sum += delta;
+		st->sum_sq += (uint64_t)delta * delta;
+	}
+
+	st->last = now;
+	st->count++;
+	st->bytes += len;
+}
+
+static int lb_stats_report(struct lb_data *const data,
+			   const struct usb_setup_packet *const setup,
+			   struct net_buf *const buf)
+{
+	if (setup->wLength < LB_STATS_REPORT_SIZE ||
+	    net_buf_tailroom(buf) < LB_STATS_REPORT_SIZE) {
+		return -EINVAL;
+	}
+
+	net_buf_add_le32(buf, sys_clock_hw_cycles_per_sec());
+	net_buf_add_le32(buf, LB_STATS_NUM);
+
+	for (size_t i = 0; i < ARRAY_SIZE(data->stats); i++) {
+		const struct lb_stats *const st = &data->stats[i];
+
+		net_buf_add_le32(buf, st->count);
+		net_buf_add_le32(buf, st->errors);
+		net_buf_add_le64(buf, st->bytes);
+		net_buf_add_le32(buf, st->count > 1 ? st->min : 0);
+		net_buf_add_le32(buf, st->max);
+		net_buf_add_le64(buf, st->sum);
+		net_buf_add_le64(buf, st->sum_sq);
+	}
+
+	return 0;
+}
+#else
+static inline void lb_stats_update(struct lb_data *const data,
+				   const enum lb_stats_idx idx,
+				   const size_t len, const int err)
+{
+}
+#endif
+
 static uint8_t lb_get_bulk_out(struct usbd_class_data *const c_data)
 {
 	struct lb_data *data = usbd_class_get_private(c_data);
@@ -152,6 +273,49 @@ static int lb_submit_bulk_in(struct usbd_class_data *const c_data)
 	return err;
 }
 
+static uint8_t lb_get_iso_out(struct usbd_class_data *const c_data)
+{
+	struct lb_data *data = usbd_class_get_private(c_data);
+
+	return data->desc->if2_1_iso_out_ep.bEndpointAddress;
+}
+
+static uint8_t lb_get_iso_in(struct usbd_class_data *const c_data)
+{
+	struct lb_data *data = usbd_class_get_private(c_data);
+
+	return data->desc->if2_1_iso_in_ep.bEndpointAddress;
+}
+
+static int lb_submit_iso(struct usbd_class_data *const c_data, const uint8_t ep)
+{
+	struct lb_data *data = usbd_class_get_private(c_data);
+	struct net_buf *buf;
+	int err;
+
+	if (!atomic_test_bit(&data->state, LB_FUNCTION_ISO_ENABLED)) {
+		return -EPERM;
+	}
+
+	buf = usbd_ep_buf_alloc(c_data, ep, LB_ISO_EP_MPS);
+	if (buf == NULL) {
+		LOG_ERR("Failed to allocate buffer");
+		return -ENOMEM;
+	}
+
+	if (USB_EP_DIR_IS_IN(ep)) {
+		net_buf_add_mem(buf, lb_buf, LB_ISO_EP_MPS);
+	}
+
+	err = usbd_ep_enqueue(c_data, buf);
+	if (err) {
+		LOG_ERR("Failed to enqueue buffer");
+		net_buf_unref(buf);
+	}
+
+	return err;
+}
+
 static int lb_request_handler(struct usbd_class_data *const c_data,
 			      struct net_buf *const buf, const int err)
 {
@@ -163,6 +327,7 @@ static int lb_request_handler(struct usbd_class_data *const c_data,
 
 	if (bi->ep == lb_get_bulk_out(c_data)) {
 		atomic_clear_bit(&data->state, LB_FUNCTION_OUT_ENGAGED);
+		lb_stats_update(data, LB_STATS_BULK_OUT, len, err);
 		if (err == 0) {
 			memcpy(lb_buf, buf->data, MIN(sizeof(lb_buf), buf->len));
 		}
@@ -170,6 +335,15 @@ static int lb_request_handler(struct usbd_class_data *const c_data,
 
 	if (bi->ep == lb_get_bulk_in(c_data)) {
 		atomic_clear_bit(&data->state, LB_FUNCTION_IN_ENGAGED);
+		lb_stats_update(data, LB_STATS_BULK_IN, len, err);
+	}
+
+	if (bi->ep == lb_get_iso_out(c_data)) {
+		lb_stats_update(data, LB_STATS_ISO_OUT, len, err);
+	}
+
+	if (bi->ep == lb_get_iso_in(c_data)) {
+		lb_stats_update(data, LB_STATS_ISO_IN, len, err);
 	}
 
 	net_buf_unref(buf);
@@ -192,14 +366,37 @@ static int lb_request_handler(struct usbd_class_data *const c_data,
 		}
 	}
 
+	/* Transfers cancelled on alternate change are not resubmitted */
+	if (err != -ECONNABORTED &&
+	    (ep == lb_get_iso_out(c_data) || ep == lb_get_iso_in(c_data))) {
+		lb_submit_iso(c_data, ep);
+	}
+
 	return ret;
 }
 
 static void lb_update(struct usbd_class_data *c_data,
 		      uint8_t iface, uint8_t alternate)
 {
+	struct lb_data *data = usbd_class_get_private(c_data);
+
 	LOG_DBG("Instance %p, interface %u alternate %u changed",
 		c_data, iface, alternate);
+
+	if (iface != data->desc->if2_0.bInterfaceNumber) {
+		return;
+	}
+
+	if (alternate != data->desc->if2_1.bAlternateSetting) {
+		atomic_clear_bit(&data->state, LB_FUNCTION_ISO_ENABLED);
+		return;
+	}
+
+	atomic_set_bit(&data->state, LB_FUNCTION_ISO_ENABLED);
+	for (int i = 0; i < LB_ISO_NUM_BUFS; i++) {
+		lb_submit_iso(c_data, lb_get_iso_out(c_data));
+		lb_submit_iso(c_data, lb_get_iso_in(c_data));
+	}
 }
 
 static int lb_control_to_host(struct usbd_class_data *c_data,
@@ -221,6 +418,20 @@ static int lb_control_to_host(struct usbd_class_data *c_data,
 		return 0;
 	}
 
+#if defined(CONFIG_USBD_LOOPBACK_BENCHMARK)
+	if (setup->bRequest == LB_VENDOR_REQ_STATS) {
+		struct lb_data *data = usbd_class_get_private(c_data);
+		int ret;
+
+		ret = lb_stats_report(data, setup, buf);
+		if (ret != 0) {
+			errno = ret;
+		}
+
+		return 0;
+	}
+#endif
+
 	LOG_ERR("Class request 0x%x not supported", setup->bRequest);
 	errno = -ENOTSUP;
 
@@ -231,11 +442,22 @@ static int lb_control_to_dev(struct usbd_class_data *c_data,
 			     const struct usb_setup_packet *const setup,
 			     const struct net_buf *const buf)
 {
+	struct lb_data *data = usbd_class_get_private(c_data);
+
 	if (setup->RequestType.recipient != USB_REQTYPE_RECIPIENT_DEVICE) {
 		errno = -ENOTSUP;
 		return 0;
 	}
 
+	lb_stats_update(data, LB_STATS_CONTROL, setup->wLength, 0);
+
+#if defined(CONFIG_USBD_LOOPBACK_BENCHMARK)
+	if (setup->bRequest == LB_VENDOR_REQ_STATS_RESET) {
+		lb_stats_reset(data);
+		return 0;
+	}
+#endif
+
 	if (setup->bRequest == LB_VENDOR_REQ_OUT) {
 		LOG_WRN("Host-to-Device, wLength %u | %zu", setup->wLength,
 			MIN(sizeof(lb_buf), buf->len));
@@ -278,6 +500,7 @@ static void lb_disable(struct usbd_class_data *const c_data)
 	struct lb_data *data = usbd_class_get_private(c_data);
 
 	atomic_clear_bit(&data->state, LB_FUNCTION_ENABLED);
+	atomic_clear_bit(&data->state, LB_FUNCTION_ISO_ENABLED);
 	LOG_INF("Disable %s", c_data->name);
 }
 
@@ -285,6 +508,10 @@ static int lb_init(struct usbd_class_data *c_data)
 {
 	LOG_DBG("Init class instance %p", c_data);
 
+#if defined(CONFIG_USBD_LOOPBACK_BENCHMARK)
+	lb_stats_reset(usbd_class_get_private(c_data));
+#endif
+
 	return 0;
 }
 
@@ -42,8 +42,9 @@ enum {
 #define CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_MAX_DGRAM_PER_NTB
 #define CDC_NCM_RECV_NTB_MAX_SIZE 2048
 
-#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB 1
-#define CDC_NCM_SEND_NTB_MAX_SIZE 2048
+#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_SEND_MAX_DGRAM_PER_NTB
+#define CDC_NCM_SEND_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_SEND_NTB_MAX_SIZE
+#define CDC_NCM_TX_AGGREGATION_TIMEOUT CONFIG_USBD_CDC_NCM_TX_AGGREGATION_TIMEOUT
 
 /* Chapter 6.3 table 6-5 and 6-6 */
 struct cdc_ncm_notification {
@@ -162,6 +163,15 @@ union send_ntb {
 	uint8_t data[CDC_NCM_SEND_NTB_MAX_SIZE];
 } __packed;
 
+/* Smallest NTB that can hold the headers and one full Ethernet frame */
+#define CDC_NCM_SEND_NTB_MIN_SIZE						\
+	(sizeof(struct nth16) + sizeof(struct ndp16) +				\
+	 (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) * sizeof(struct ndp16_datagram) + \
+	 NET_ETH_MAX_FRAME_SIZE)
+
+BUILD_ASSERT(CDC_NCM_SEND_NTB_MIN_SIZE <= CDC_NCM_SEND_NTB_MAX_SIZE,
+	     "Too many datagrams per NTB for the NTB size");
+
 union recv_ntb {
 	struct {
 		struct nth16 nth;
@@ -171,11 +181,11 @@ union recv_ntb {
 } __packed;
 
 /*
- * Transfers through two endpoints proceed in a synchronous manner,
- * with maximum block of CDC_NCM_SEND_NTB_MAX_SIZE.
+ * There is one OUT transfer and at most one IN transfer in flight, and one
+ * more NTB that is being assembled while the previous IN transfer proceeds.
  */
 UDC_BUF_POOL_DEFINE(cdc_ncm_ep_pool,
-		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 3,
 		    MAX(CDC_NCM_SEND_NTB_MAX_SIZE, CDC_NCM_RECV_NTB_MAX_SIZE),
 		    sizeof(struct udc_buf_info), NULL);
 
@@ -230,6 +240,16 @@ struct cdc_ncm_eth_data {
 	uint16_t tx_seq;
 	uint16_t rx_seq;
 
+	/* Limits of sent NTB, may be set by host with SetNtbInputSize */
+	uint32_t ntb_in_max_size;
+	uint16_t ntb_in_max_datagrams;
+
+	/* NTB being assembled and number of datagrams it contains */
+	struct net_buf *tx_ntb;
+	uint16_t tx_ntb_datagrams;
+	struct k_mutex tx_mutex;
+	struct k_work_delayable tx_work;
+	/* Taken while IN transfer is in flight */
 	struct k_sem sync_sem;
 
 	struct k_work_delayable notif_work;
@@ -654,7 +674,10 @@ static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 	}
 
 	if (bi->ep == cdc_ncm_get_bulk_in(c_data)) {
+		net_buf_unref(buf);
 		k_sem_give(&data->sync_sem);
+		/* Send NTB assembled meanwhile, if any */
+		(void)k_work_schedule(&data->tx_work, K_NO_WAIT);
 		return 0;
 	}
 
@@ -886,6 +909,44 @@ static void usbd_cdc_ncm_resumed(struct usbd_class_data *const c_data)
 	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
 }
 
+/* Chapter 6.2.8, wLength is either 4 or 8 */
+static int cdc_ncm_set_ntb_input_size(struct usbd_class_data *const c_data,
+				      const struct net_buf *const buf)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	struct cdc_ncm_eth_data *data = dev->data;
+	uint32_t max_size;
+	uint16_t max_datagrams = 0;
+
+	if (buf == NULL || buf->len < sizeof(uint32_t)) {
+		errno = -EINVAL;
+		return 0;
+	}
+
+	max_size = sys_get_le32(buf->data);
+	if (buf->len >= sizeof(struct ntb_input_size)) {
+		max_datagrams = sys_get_le16(buf->data + sizeof(uint32_t));
+	}
+
+	if (max_size < CDC_NCM_SEND_NTB_MIN_SIZE) {
+		LOG_WRN("Unsupported dwNtbInMaxSize %u", max_size);
+		errno = -EINVAL;
+		return 0;
+	}
+
+	data->ntb_in_max_size = MIN(max_size, CDC_NCM_SEND_NTB_MAX_SIZE);
+	if (max_datagrams == 0 || max_datagrams > CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB) {
+		data->ntb_in_max_datagrams = CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB;
+	} else {
+		data->ntb_in_max_datagrams = max_datagrams;
+	}
+
+	LOG_DBG("SetNtbInputSize %u/%u", data->ntb_in_max_size,
+		data->ntb_in_max_datagrams);
+
+	return 0;
+}
+
 static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 			    const struct usb_setup_packet *const setup,
 			    const struct net_buf *const buf)
@@ -898,9 +959,7 @@ static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 		}
 
 		if (setup->bRequest == SET_NTB_INPUT_SIZE) {
-			LOG_DBG("bRequest 0x%02x (%s) not implemented",
-				setup->bRequest, "SetNtbInputSize");
-			return 0;
+			return cdc_ncm_set_ntb_input_size(c_data, buf);
 		}
 
 		if (setup->bRequest == SET_NTB_FORMAT) {
@@ -952,9 +1011,11 @@ static int usbd_cdc_ncm_cth(struct usbd_class_data *const c_data,
 	}
 
 	case GET_NTB_INPUT_SIZE: {
+		const struct device *dev = usbd_class_get_private(c_data);
+		struct cdc_ncm_eth_data *data = dev->data;
 		struct ntb_input_size input_size = {
-			.dwNtbInMaxSize = sys_cpu_to_le32(CDC_NCM_SEND_NTB_MAX_SIZE),
-			.wNtbInMaxDatagrams = sys_cpu_to_le16(CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB),
+			.dwNtbInMaxSize = sys_cpu_to_le32(data->ntb_in_max_size),
+			.wNtbInMaxDatagrams = sys_cpu_to_le16(data->ntb_in_max_datagrams),
 			.wReserved = sys_cpu_to_le16(0),
 		};
 
@@ -1020,13 +1081,116 @@ static void *usbd_cdc_ncm_get_desc(struct usbd_class_data *const c_data,
 	return data->fs_desc;
 }
 
+static uint16_t cdc_ncm_send_ndp_len(struct cdc_ncm_eth_data *const data)
+{
+	/* NDP with room for all datagram pointers and terminating zero entry */
+	return sizeof(struct ndp16) +
+	       (data->ntb_in_max_datagrams + 1) * sizeof(struct ndp16_datagram);
+}
+
+static struct net_buf *cdc_ncm_ntb_alloc(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_class_data *c_data = data->c_data;
+	uint16_t ndp_len = cdc_ncm_send_ndp_len(data);
+	struct net_buf *buf;
+	union send_ntb *ntb;
+
+	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(c_data));
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	ntb = (union send_ntb *)buf->data;
+
+	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
+	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->nth.wSequence = 0;
+	ntb->nth.wBlockLength = 0;
+	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
+	ntb->ndp.wLength = sys_cpu_to_le16(ndp_len);
+	ntb->ndp.wNextNdpIndex = 0;
+	memset(ntb->ndp_datagram, 0, ndp_len - sizeof(struct ndp16));
+
+	net_buf_add(buf, sizeof(struct nth16) + ndp_len);
+
+	return buf;
+}
+
+/* Send assembled NTB, must be called with tx_mutex held */
+static int cdc_ncm_tx_flush(struct cdc_ncm_eth_data *const data,
+			    const k_timeout_t timeout)
+{
+	struct usbd_class_data *c_data = data->c_data;
+	struct net_buf *buf = data->tx_ntb;
+	union send_ntb *ntb;
+	int ret;
+
+	if (buf == NULL) {
+		return 0;
+	}
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		LOG_DBG("Drop NTB, configuration is not enabled");
+		data->tx_ntb = NULL;
+		net_buf_unref(buf);
+		return -EACCES;
+	}
+
+	/* Wait for previous NTB to be sent */
+	if (k_sem_take(&data->sync_sem, timeout)) {
+		return -EAGAIN;
+	}
+
+	data->tx_ntb = NULL;
+	ntb = (union send_ntb *)buf->data;
+	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
+	ntb->nth.wBlockLength = sys_cpu_to_le16(buf->len);
+
+	if (buf->len % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	LOG_DBG("Send NTB %u with %u datagram(s), len %u",
+		data->tx_seq, data->tx_ntb_datagrams, buf->len);
+
+	ret = usbd_ep_enqueue(c_data, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", cdc_ncm_get_bulk_in(c_data));
+		net_buf_unref(buf);
+		k_sem_give(&data->sync_sem);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_tx_work(struct k_work *work)
+{
+	struct k_work_delayable *tx_work = k_work_delayable_from_work(work);
+	struct cdc_ncm_eth_data *data;
+
+	data = CONTAINER_OF(tx_work, struct cdc_ncm_eth_data, tx_work);
+
+	/* Sender holding the mutex takes care of the pending NTB */
+	if (k_mutex_lock(&data->tx_mutex, K_NO_WAIT)) {
+		return;
+	}
+
+	/* If IN transfer is in flight, the NTB is sent on its completion */
+	(void)cdc_ncm_tx_flush(data, K_NO_WAIT);
+
+	k_mutex_unlock(&data->tx_mutex);
+}
+
 static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 {
 	struct cdc_ncm_eth_data *const data = dev->data;
-	struct usbd_class_data *c_data = data->c_data;
 	size_t len = net_pkt_get_len(pkt);
-	struct net_buf *buf;
+	struct ndp16_datagram *ndp_datagram;
 	union send_ntb *ntb;
+	bool pending;
+	size_t offset;
+	int ret = 0;
 
 	if (len > NET_ETH_MAX_FRAME_SIZE) {
 		LOG_WRN("Trying to send too large packet, drop");
@@ -1041,53 +1205,65 @@ static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 		return -EACCES;
 	}
 
-	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(c_data));
-	if (buf == NULL) {
-		LOG_ERR("Failed to allocate buffer");
-		return -ENOMEM;
+	k_mutex_lock(&data->tx_mutex, K_FOREVER);
+
+	if (data->tx_ntb != NULL) {
+		offset = ROUND_UP(data->tx_ntb->len, CDC_NCM_ALIGNMENT);
+		if (data->tx_ntb_datagrams >= data->ntb_in_max_datagrams ||
+		    offset + len > data->ntb_in_max_size) {
+			/* No room left, send it and start a new one */
+			(void)cdc_ncm_tx_flush(data, K_FOREVER);
+		}
 	}
 
-	ntb = (union send_ntb *)buf->data;
+	if (data->tx_ntb == NULL) {
+		data->tx_ntb = cdc_ncm_ntb_alloc(data);
+		if (data->tx_ntb == NULL) {
+			LOG_ERR("Failed to allocate buffer");
+			ret = -ENOMEM;
+			goto unlock;
+		}
 
-	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
-	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
-	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
-	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
-	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
-	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
-					   (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) *
-					   sizeof(struct ndp16_datagram));
-	ntb->ndp.wNextNdpIndex = 0;
-	ntb->ndp_datagram[0].wDatagramIndex =
-		sys_cpu_to_le16(sys_le16_to_cpu(ntb->nth.wHeaderLength) +
-				sys_le16_to_cpu(ntb->ndp.wLength));
-	ntb->ndp_datagram[0].wDatagramLength = sys_cpu_to_le16(len);
-	ntb->ndp_datagram[1].wDatagramIndex  = 0;
-	ntb->ndp_datagram[1].wDatagramLength = 0;
-	ntb->nth.wBlockLength = sys_cpu_to_le16(
-		sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex) + len);
-
-	net_buf_add(buf, sys_le16_to_cpu(ntb->ndp_datagram[0].wDatagramIndex));
-
-	if (net_pkt_read(pkt, buf->data + buf->len, len)) {
-		LOG_ERR("Failed copy net_pkt");
-		net_buf_unref(buf);
+		data->tx_ntb_datagrams = 0;
+	}
 
-		return -ENOBUFS;
+	offset = ROUND_UP(data->tx_ntb->len, CDC_NCM_ALIGNMENT);
+	if (net_pkt_read(pkt, data->tx_ntb->data + offset, len)) {
+		LOG_ERR("Failed copy net_pkt");
+		ret = -ENOBUFS;
+		goto unlock;
 	}
 
-	net_buf_add(buf, len);
+	/* Padding between datagrams is not examined by the host */
+	net_buf_add(data->tx_ntb, offset + len - data->tx_ntb->len);
 
-	if (sys_le16_to_cpu(ntb->nth.wBlockLength) % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
-		udc_ep_buf_set_zlp(buf);
+	ntb = (union send_ntb *)data->tx_ntb->data;
+	ndp_datagram = &ntb->ndp_datagram[data->tx_ntb_datagrams];
+	ndp_datagram->wDatagramIndex = sys_cpu_to_le16(offset);
+	ndp_datagram->wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_ntb_datagrams++;
+
+	if (CDC_NCM_TX_AGGREGATION_TIMEOUT == 0) {
+		/* Send right away if the endpoint is idle */
+		(void)cdc_ncm_tx_flush(data, K_NO_WAIT);
 	}
 
-	usbd_ep_enqueue(c_data, buf);
-	k_sem_take(&data->sync_sem, K_FOREVER);
+unlock:
+	pending = data->tx_ntb != NULL;
+	k_mutex_unlock(&data->tx_mutex);
 
-	net_buf_unref(buf);
+	if (pending) {
+		if (CDC_NCM_TX_AGGREGATION_TIMEOUT != 0) {
+			/* Timeout runs from the first datagram of the NTB */
+			(void)k_work_schedule(&data->tx_work,
+					      K_USEC(CDC_NCM_TX_AGGREGATION_TIMEOUT));
+		} else if (k_sem_count_get(&data->sync_sem) != 0) {
+			/* IN transfer finished while we were holding the mutex */
+			(void)k_work_schedule(&data->tx_work, K_NO_WAIT);
+		}
+	}
 
-	return 0;
+	return ret;
 }
 
 static int cdc_ncm_set_config(const struct device *dev,
@@ -1165,6 +1341,11 @@ static int usbd_cdc_ncm_preinit(const struct device *dev)
 	struct cdc_ncm_eth_data *data = dev->data;
 
 	k_work_init_delayable(&data->notif_work, send_notification_work);
+	k_work_init_delayable(&data->tx_work, cdc_ncm_tx_work);
+	k_mutex_init(&data->tx_mutex);
+
+	data->ntb_in_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+	data->ntb_in_max_datagrams = CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB;
 
 	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
 		gen_random_mac(data->mac_addr, 0, 0, 0);
@@ -1384,7 +1565,7 @@ const static struct usb_desc_header *cdc_ncm_hs_desc_##n[] = {			\
 	static struct cdc_ncm_eth_data eth_data_##n = {				\
 		.c_data = &cdc_ncm_##n,						\
 		.mac_addr = DT_INST_PROP_OR(n, local_mac_address, {0}),		\
-		.sync_sem = Z_SEM_INITIALIZER(eth_data_##n.sync_sem, 0, 1),	\
+		.sync_sem = Z_SEM_INITIALIZER(eth_data_##n.sync_sem, 1, 1),	\
 		.mac_desc_data = &mac_desc_data_##n,				\
 		.desc = &cdc_ncm_desc_##n,					\
 		.fs_desc = cdc_ncm_fs_desc_##n,					\
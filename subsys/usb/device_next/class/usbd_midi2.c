@@ -23,7 +23,10 @@ LOG_MODULE_REGISTER(usbd_midi2, CONFIG_USBD_MIDI2_LOG_LEVEL);
 UDC_BUF_POOL_DEFINE(usbd_midi_buf_pool, DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2, 512U,
 		    sizeof(struct udc_buf_info), NULL);
 
-#define MIDI_QUEUE_SIZE 64
+#define MIDI_QUEUE_SIZE CONFIG_USBD_MIDI2_TX_QUEUE_SIZE
+
+/* Bits of struct usbd_midi_data tx_state */
+#define MIDI_TX_BUSY	0
 
 /* midi20 A.1 MS Class-Specific Interface Descriptor Types */
 #define CS_GR_TRM_BLOCK	0x26
@@ -149,34 +152,51 @@ struct usbd_midi_config {
 struct usbd_midi_data {
 	struct usbd_class_data *class_data;
 	struct k_work rx_work;
-	struct k_work tx_work;
+	struct k_work_delayable tx_work;
 	uint8_t tx_queue_buf[MIDI_QUEUE_SIZE];
 	struct ring_buf tx_queue;
+	struct k_spinlock tx_lock;
+	atomic_t tx_state;
+	struct midi_ump rx_batch[CONFIG_USBD_MIDI2_RX_BATCH_SIZE];
+	/* UMP being received, and number of its words already received */
+	struct midi_ump rx_ump;
+	uint8_t rx_words;
 	uint8_t altsetting;
 	struct usbd_midi_ops ops;
 };
 
+static void usbd_midi_tx_kick(const struct device *dev);
+
 static void usbd_midi2_recv(const struct device *dev, struct net_buf *const buf)
 {
 	struct usbd_midi_data *data = dev->data;
-	struct midi_ump ump;
+	size_t count = 0;
 
 	LOG_HEXDUMP_DBG(buf->data, buf->len, "MIDI2 - Rx DATA");
 	while (buf->len >= 4) {
-		ump.data[0] = net_buf_pull_le32(buf);
-		for (size_t i = 1; i < UMP_NUM_WORDS(ump); i++) {
-			if (buf->len < 4) {
-				LOG_ERR("Incomplete UMP");
-				return;
-			}
-			ump.data[i] = net_buf_pull_le32(buf);
+		/* A UMP split across two transfers is completed by the next one */
+		data->rx_ump.data[data->rx_words++] = net_buf_pull_le32(buf);
+		if (data->rx_words < UMP_NUM_WORDS(data->rx_ump)) {
+			continue;
 		}
 
-		if (data->ops.rx_packet_cb) {
-			data->ops.rx_packet_cb(dev, ump);
+		data->rx_words = 0;
+
+		if (data->ops.rx_packets_cb) {
+			data->rx_batch[count++] = data->rx_ump;
+			if (count == ARRAY_SIZE(data->rx_batch)) {
+				data->ops.rx_packets_cb(dev, data->rx_batch, count);
+				count = 0;
+			}
+		} else if (data->ops.rx_packet_cb) {
+			data->ops.rx_packet_cb(dev, data->rx_ump);
 		}
 	}
 
+	if (count && data->ops.rx_packets_cb) {
+		data->ops.rx_packets_cb(dev, data->rx_batch, count);
+	}
+
 	if (buf->len) {
 		LOG_HEXDUMP_WRN(buf->data, buf->len, "Trailing data in Rx buffer");
 	}
@@ -201,9 +221,8 @@ static int usbd_midi_class_request(struct usbd_class_data *const class_data,
 		k_work_submit(&data->rx_work);
 	} else {
 		LOG_HEXDUMP_DBG(buf->data, buf->len, "Tx DATA complete");
-		if (ring_buf_size_get(&data->tx_queue)) {
-			k_work_submit(&data->tx_work);
-		}
+		atomic_clear_bit(&data->tx_state, MIDI_TX_BUSY);
+		usbd_midi_tx_kick(dev);
 	}
 
 	return usbd_ep_buf_free(uds_ctx, buf);
@@ -225,6 +244,7 @@ static void usbd_midi_class_update(struct usbd_class_data *const class_data,
 		break;
 	case MIDI2_ALTERNATE:
 		data->altsetting = MIDI2_ALTERNATE;
+		data->rx_words = 0;
 		ready = true;
 		LOG_INF("%s set USB-MIDI2.0 altsetting", dev->name);
 		break;
@@ -245,6 +265,7 @@ static void usbd_midi_class_enable(struct usbd_class_data *const class_data)
 	}
 
 	LOG_DBG("Enable %s", dev->name);
+	data->rx_words = 0;
 	k_work_submit(&data->rx_work);
 }
 
@@ -259,6 +280,7 @@ static void usbd_midi_class_disable(struct usbd_class_data *const class_data)
 
 	LOG_DBG("Disable %s", dev->name);
 	k_work_cancel(&data->rx_work);
+	k_work_cancel_delayable(&data->tx_work);
 }
 
 static void usbd_midi_class_suspended(struct usbd_class_data *const class_data)
@@ -408,6 +430,48 @@ static uint8_t usbd_midi_get_bulk_out(struct usbd_class_data *const class_data)
 	return cfg->desc->if1_1_out_ep_fs.bEndpointAddress;
 }
 
+static uint16_t usbd_midi_get_bulk_in_mps(struct usbd_class_data *const class_data)
+{
+	struct usbd_context *uds_ctx = usbd_class_get_ctx(class_data);
+	const struct device *dev = usbd_class_get_private(class_data);
+	const struct usbd_midi_config *cfg = dev->config;
+
+	if (USBD_SUPPORTS_HIGH_SPEED &&
+	    usbd_bus_speed(uds_ctx) == USBD_SPEED_HS) {
+		return sys_le16_to_cpu(cfg->desc->if1_1_in_ep_hs.wMaxPacketSize);
+	}
+
+	return sys_le16_to_cpu(cfg->desc->if1_1_in_ep_fs.wMaxPacketSize);
+}
+
+/*
+ * Schedule flush of the TX queue. Packets are coalesced while a transfer is
+ * in progress, and additionally up to the flush timeout, unless there is
+ * already enough data queued to fill a max-packet-size transfer.
+ */
+static void usbd_midi_tx_kick(const struct device *dev)
+{
+	struct usbd_midi_data *data = dev->data;
+	uint32_t queued;
+
+	if (atomic_test_bit(&data->tx_state, MIDI_TX_BUSY)) {
+		return;
+	}
+
+	queued = ring_buf_size_get(&data->tx_queue);
+	if (queued == 0) {
+		return;
+	}
+
+	if (CONFIG_USBD_MIDI2_TX_FLUSH_TIMEOUT == 0 ||
+	    queued >= usbd_midi_get_bulk_in_mps(data->class_data)) {
+		k_work_reschedule(&data->tx_work, K_NO_WAIT);
+	} else {
+		k_work_schedule(&data->tx_work,
+				K_USEC(CONFIG_USBD_MIDI2_TX_FLUSH_TIMEOUT));
+	}
+}
+
 static void usbd_midi_rx_work(struct k_work *work)
 {
 	struct usbd_midi_data *data = CONTAINER_OF(work, struct usbd_midi_data, rx_work);
@@ -430,23 +494,44 @@ static void usbd_midi_rx_work(struct k_work *work)
 
 static void usbd_midi_tx_work(struct k_work *work)
 {
-	struct usbd_midi_data *data = CONTAINER_OF(work, struct usbd_midi_data, tx_work);
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct usbd_midi_data *data = CONTAINER_OF(dwork, struct usbd_midi_data, tx_work);
+	struct midi_ump ump = {0};
 	struct net_buf *buf;
+	uint32_t word;
+	size_t len;
 	int ret;
 
+	if (ring_buf_is_empty(&data->tx_queue) ||
+	    atomic_test_and_set_bit(&data->tx_state, MIDI_TX_BUSY)) {
+		return;
+	}
+
 	buf = usbd_midi_buf_alloc(usbd_midi_get_bulk_in(data->class_data));
 	if (buf == NULL) {
 		LOG_ERR("Unable to allocate Tx net_buf");
+		atomic_clear_bit(&data->tx_state, MIDI_TX_BUSY);
 		return;
 	}
 
-	net_buf_add(buf, ring_buf_get(&data->tx_queue, buf->data, buf->size));
+	/* Only take whole UMPs, a packet must not be split across transfers */
+	while (ring_buf_peek(&data->tx_queue, (uint8_t *)&word, sizeof(word)) == sizeof(word)) {
+		ump.data[0] = sys_le32_to_cpu(word);
+		len = 4 * UMP_NUM_WORDS(ump);
+		if (len > net_buf_tailroom(buf)) {
+			break;
+		}
+
+		net_buf_add(buf, ring_buf_get(&data->tx_queue, net_buf_tail(buf), len));
+	}
+
 	LOG_HEXDUMP_DBG(buf->data, buf->len, "MIDI2 - Tx DATA");
 
 	ret = usbd_ep_enqueue(data->class_data, buf);
 	if (ret) {
 		LOG_ERR("Failed to enqueue Tx net_buf -> %d", ret);
 		net_buf_unref(buf);
+		atomic_clear_bit(&data->tx_state, MIDI_TX_BUSY);
 	}
 }
 
@@ -457,7 +542,7 @@ static int usbd_midi_preinit(const struct device *dev)
 	LOG_DBG("Init device %s", dev->name);
 	ring_buf_init(&data->tx_queue, MIDI_QUEUE_SIZE, data->tx_queue_buf);
 	k_work_init(&data->rx_work, usbd_midi_rx_work);
-	k_work_init(&data->tx_work, usbd_midi_tx_work);
+	k_work_init_delayable(&data->tx_work, usbd_midi_tx_work);
 
 	return 0;
 }
@@ -467,6 +552,7 @@ int usbd_midi_send(const struct device *dev, const struct midi_ump ump)
 	struct usbd_midi_data *data = dev->data;
 	size_t words = UMP_NUM_WORDS(ump);
 	size_t buflen = 4 * words;
+	k_spinlock_key_t key;
 	uint32_t word;
 
 	LOG_DBG("Send MT=%X group=%X", UMP_MT(ump), UMP_GROUP(ump));
@@ -475,7 +561,9 @@ int usbd_midi_send(const struct device *dev, const struct midi_ump ump)
 		return -EIO;
 	}
 
+	key = k_spin_lock(&data->tx_lock);
 	if (buflen > ring_buf_space_get(&data->tx_queue)) {
+		k_spin_unlock(&data->tx_lock, key);
 		LOG_WRN("Not enough space in tx queue");
 		return -ENOBUFS;
 	}
@@ -484,7 +572,9 @@ int usbd_midi_send(const struct device *dev, const struct midi_ump ump)
 		word = sys_cpu_to_le32(ump.data[i]);
 		ring_buf_put(&data->tx_queue, (const uint8_t *)&word, 4);
 	}
-	k_work_submit(&data->tx_work);
+	k_spin_unlock(&data->tx_lock, key);
+
+	usbd_midi_tx_kick(dev);
 
 	return 0;
 }
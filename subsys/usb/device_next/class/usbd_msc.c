@@ -67,6 +67,18 @@ UDC_BUF_POOL_DEFINE(msc_ep_pool,
 		    MSC_NUM_INSTANCES * 2, MSC_BUF_SIZE,
 		    sizeof(struct udc_buf_info), NULL);
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+BUILD_ASSERT(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE % MSC_BUF_SIZE == 0,
+	     "SCSI buffer size must be a multiple of bulk endpoint MPS");
+
+#define MSC_DATA_BUF_SIZE \
+	ROUND_UP(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE, UDC_BUF_GRANULARITY)
+
+/* There is at most one transfer in each direction on transfer buffers */
+NET_BUF_POOL_DEFINE(msc_data_pool, MSC_NUM_INSTANCES * 2, 0,
+		    sizeof(struct udc_buf_info), NULL);
+#endif
+
 struct msc_event {
 	struct usbd_class_data *c_data;
 	/* NULL to request Bulk-Only Mass Storage Reset
@@ -125,6 +137,14 @@ struct msc_bot_ctx {
 	uint32_t transferred_data;
 	size_t scsi_offset;
 	size_t scsi_bytes;
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	/* Two transfer buffers of MSC_DATA_BUF_SIZE bytes */
+	uint8_t *const data_buf;
+	/* Transfer buffer to be used next */
+	uint8_t data_idx;
+	/* Command data is transferred directly from/to transfer buffers */
+	bool pipelined;
+#endif
 };
 
 static struct net_buf *msc_buf_alloc(const uint8_t ep)
@@ -143,6 +163,39 @@ static struct net_buf *msc_buf_alloc(const uint8_t ep)
 	return buf;
 }
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+static uint8_t *msc_next_data_buf(struct msc_bot_ctx *const ctx)
+{
+	return &ctx->data_buf[ctx->data_idx * MSC_DATA_BUF_SIZE];
+}
+
+/* Transfer buffers are used alternately, therefore the next buffer is never
+ * the one that was most recently used for an USB transfer.
+ */
+static struct net_buf *msc_data_buf_alloc(struct msc_bot_ctx *const ctx,
+					  const uint8_t ep, const size_t size)
+{
+	struct net_buf *buf;
+	struct udc_buf_info *bi;
+
+	buf = net_buf_alloc_with_data(&msc_data_pool, msc_next_data_buf(ctx),
+				      size, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	if (USB_EP_DIR_IS_OUT(ep)) {
+		net_buf_reset(buf);
+	}
+
+	bi = udc_get_buf_info(buf);
+	bi->ep = ep;
+	ctx->data_idx ^= 1;
+
+	return buf;
+}
+#endif
+
 static uint8_t msc_get_bulk_in(struct usbd_class_data *const c_data)
 {
 	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
@@ -171,6 +224,26 @@ static uint8_t msc_get_bulk_out(struct usbd_class_data *const c_data)
 	return desc->if0_out_ep.bEndpointAddress;
 }
 
+static struct net_buf *msc_bulk_out_buf_alloc(struct msc_bot_ctx *const ctx,
+					       const uint8_t ep)
+{
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	if (ctx->pipelined && ctx->state == MSC_BBB_PROCESS_WRITE) {
+		struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+		size_t len;
+
+		/* Receive no more than SCSI layer is going to process */
+		len = MIN(scsi_cmd_remaining_data_len(lun) - ctx->scsi_bytes,
+			  CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);
+		__ASSERT_NO_MSG(len > 0);
+
+		return msc_data_buf_alloc(ctx, ep, len);
+	}
+#endif
+
+	return msc_buf_alloc(ep);
+}
+
 static void msc_queue_bulk_out_ep(struct usbd_class_data *const c_data)
 {
 	struct msc_bot_ctx *ctx = usbd_class_get_private(c_data);
@@ -185,7 +258,7 @@ static void msc_queue_bulk_out_ep(struct usbd_class_data *const c_data)
 
 	LOG_DBG("Queuing OUT");
 	ep = msc_get_bulk_out(c_data);
-	buf = msc_buf_alloc(ep);
+	buf = msc_bulk_out_buf_alloc(ctx, ep);
 	/* The pool is large enough to support all allocations. Failing alloc
 	 * indicates either a memory leak or logic error.
 	 */
@@ -250,6 +323,51 @@ static bool is_cbw_meaningful(struct msc_bot_ctx *const ctx)
 	return true;
 }
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+static void msc_process_read_pipelined(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+		__ASSERT_NO_MSG(false);
+		LOG_ERR("IN already queued");
+		return;
+	}
+
+	/* Read the data now if it was not read ahead */
+	if (ctx->scsi_bytes == 0) {
+		ctx->scsi_bytes = scsi_read_data(lun, msc_next_data_buf(ctx));
+	}
+
+	ep = msc_get_bulk_in(ctx->class_node);
+	buf = msc_data_buf_alloc(ctx, ep, ctx->scsi_bytes);
+	/* The pool is large enough to support all allocations. Failing alloc
+	 * indicates either a memory leak or logic error.
+	 */
+	__ASSERT_NO_MSG(buf);
+
+	ctx->csw.dCSWDataResidue -= ctx->scsi_bytes;
+	ret = usbd_ep_enqueue(ctx->class_node, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+		return;
+	}
+
+	/* Read ahead next chunk while the current one is being sent. No data
+	 * read ahead means there is no more data to send.
+	 */
+	ctx->scsi_bytes = 0;
+	if (scsi_cmd_remaining_data_len(lun) > 0) {
+		ctx->scsi_bytes = scsi_read_data(lun, msc_next_data_buf(ctx));
+	}
+}
+#endif
+
 static void msc_process_read(struct msc_bot_ctx *ctx)
 {
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
@@ -259,6 +377,13 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 	size_t len;
 	int ret;
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	if (ctx->pipelined) {
+		msc_process_read_pipelined(ctx);
+		return;
+	}
+#endif
+
 	/* Fill SCSI Data IN buffer if there is no data available */
 	if (ctx->scsi_bytes == 0) {
 		ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
@@ -327,6 +452,11 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 	/* Write commands must not return any data to initiator (host) */
 	__ASSERT_NO_MSG(cmd_is_data_read || ctx->scsi_bytes == 0);
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	/* Disk data is produced and consumed by SCSI read/write callbacks */
+	ctx->pipelined = ctx->scsi_bytes == 0 && scsi_cmd_remaining_data_len(lun) > 0;
+#endif
+
 	if (ctx->cbw.dCBWDataTransferLength == 0) {
 		/* 6.7.1 Hn - Host expects no data transfers */
 		if (data_len == 0) {
@@ -391,12 +521,71 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 	}
 }
 
+static void msc_process_write_end(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	if ((ctx->transferred_data >= ctx->cbw.dCBWDataTransferLength) ||
+	    (scsi_cmd_remaining_data_len(lun) == 0)) {
+		if (ctx->transferred_data < ctx->cbw.dCBWDataTransferLength) {
+			/* Case (11) Ho > Do and the transfer is still in
+			 * progress. We do not intend to process more data so
+			 * stall the Bulk-Out pipe.
+			 */
+			msc_stall_bulk_out_ep(ctx->class_node);
+		}
+
+		if (scsi_cmd_get_status(lun) == GOOD) {
+			ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_PASSED;
+		} else {
+			ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_FAILED;
+		}
+
+		ctx->state = MSC_BBB_SEND_CSW;
+	}
+}
+
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+static void msc_process_write_pipelined(struct msc_bot_ctx *ctx,
+					uint8_t *buf, size_t len)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	size_t processed;
+
+	ctx->transferred_data += len;
+	ctx->scsi_bytes = len;
+
+	/* Receive next chunk while the current one is written to disk */
+	if (ctx->transferred_data < ctx->cbw.dCBWDataTransferLength &&
+	    scsi_cmd_remaining_data_len(lun) > len) {
+		msc_queue_bulk_out_ep(ctx->class_node);
+	}
+
+	processed = scsi_write_data(lun, buf, len);
+	if (processed == 0) {
+		LOG_WRN("SCSI handler didn't process %d bytes", len);
+	}
+
+	ctx->csw.dCSWDataResidue -= processed;
+	ctx->scsi_bytes = 0;
+
+	msc_process_write_end(ctx);
+}
+#endif
+
 static void msc_process_write(struct msc_bot_ctx *ctx,
 			      uint8_t *buf, size_t len)
 {
 	size_t tmp;
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+	if (ctx->pipelined) {
+		msc_process_write_pipelined(ctx, buf, len);
+		return;
+	}
+#endif
+
 	ctx->transferred_data += len;
 
 	while ((len > 0) && (scsi_cmd_remaining_data_len(lun) > 0)) {
@@ -441,24 +630,7 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 		}
 	}
 
-	if ((ctx->transferred_data >= ctx->cbw.dCBWDataTransferLength) ||
-	    (scsi_cmd_remaining_data_len(lun) == 0)) {
-		if (ctx->transferred_data < ctx->cbw.dCBWDataTransferLength) {
-			/* Case (11) Ho > Do and the transfer is still in
-			 * progress. We do not intend to process more data so
-			 * stall the Bulk-Out pipe.
-			 */
-			msc_stall_bulk_out_ep(ctx->class_node);
-		}
-
-		if (scsi_cmd_get_status(lun) == GOOD) {
-			ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_PASSED;
-		} else {
-			ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_FAILED;
-		}
-
-		ctx->state = MSC_BBB_SEND_CSW;
-	}
+	msc_process_write_end(ctx);
 }
 
 static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
@@ -572,6 +744,14 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	struct udc_buf_info *bi;
 
 	bi = udc_get_buf_info(buf);
+
+	/* Endpoint is free again, handlers may queue next transfer */
+	if (bi->ep == msc_get_bulk_out(c_data)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
+	} else if (bi->ep == msc_get_bulk_in(c_data)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+	}
+
 	if (err) {
 		if (err == -ECONNABORTED) {
 			LOG_WRN("request ep 0x%02x, len %u cancelled",
@@ -591,11 +771,6 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	}
 
 ep_request_error:
-	if (bi->ep == msc_get_bulk_out(c_data)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
-	} else if (bi->ep == msc_get_bulk_in(c_data)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
-	}
 	usbd_ep_buf_free(uds_ctx, buf);
 }
 
@@ -865,10 +1040,16 @@ struct usbd_class_api msc_bot_api = {
 };
 
 #define DEFINE_MSC_BOT_CLASS_DATA(x, _)					\
+	IF_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING, (			\
+	UDC_STATIC_BUF_DEFINE(msc_data_buf_##x, 2 * MSC_DATA_BUF_SIZE)	\
+	))								\
+									\
 	static struct msc_bot_ctx msc_bot_ctx_##x = {			\
 		.desc = &msc_bot_desc_##x,				\
 		.fs_desc = msc_bot_fs_desc_##x,				\
 		.hs_desc = msc_bot_hs_desc_##x,				\
+		IF_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING, (		\
+		.data_buf = msc_data_buf_##x,))				\
 	};								\
 									\
 	USBD_DEFINE_CLASS(msc_##x, &msc_bot_api, &msc_bot_ctx_##x,	\
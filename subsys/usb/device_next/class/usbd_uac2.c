@@ -16,6 +16,9 @@
 #include <zephyr/usb/usb_ch9.h>
 #include <zephyr/usb/class/usbd_uac2.h>
 #include <zephyr/drivers/usb/udc.h>
+#if defined(CONFIG_USBD_UAC2_I2S)
+#include <zephyr/drivers/i2s.h>
+#endif /* CONFIG_USBD_UAC2_I2S */
 
 #include "usbd_uac2_macros.h"
 
@@ -76,6 +79,16 @@ typedef enum {
 static size_t clock_frequencies(struct usbd_class_data *const c_data,
 				const uint8_t id, const uint32_t **frequencies);
 
+#if defined(CONFIG_USBD_UAC2_I2S)
+/* I2S device bound to AudioStreaming interface */
+struct uac2_i2s {
+	const struct device *i2s_dev;
+	/* Number of blocks queued to I2S TX before it was started */
+	uint8_t queued;
+	bool started;
+};
+#endif /* CONFIG_USBD_UAC2_I2S */
+
 /* UAC2 device runtime data */
 struct uac2_ctx {
 	const struct uac2_ops *ops;
@@ -103,12 +116,29 @@ struct uac2_cfg {
 	const uint16_t *ep_indexes;
 	/* Same as ep_indexes, but for explicit feedback endpoints. */
 	const uint16_t *fb_indexes;
+	/* Number of descriptors between data endpoint descriptors of
+	 * consecutive alternate settings. First AudioStreaming interface is at
+	 * alt_strides[0]. Indexes in ep_indexes and fb_indexes are valid for
+	 * alternate setting 1 and are offset by alt_strides for every
+	 * following alternate setting.
+	 */
+	const uint8_t *alt_strides;
+	/* Alternate setting selected by host, first interface is at
+	 * as_alternates[0].
+	 */
+	uint8_t *as_alternates;
 	/* First AudioStreaming interface Terminal ID is at as_terminals[0]. */
 	const uint8_t *as_terminals;
-	/* Number of interfaces (ep_indexes, fb_indexes and as_terminals size) */
+	/* Number of interfaces (ep_indexes, fb_indexes, alt_strides,
+	 * as_alternates and as_terminals size)
+	 */
 	uint8_t num_ifaces;
 	/* Number of entities (entity_type array size) */
 	uint8_t num_entities;
+#if defined(CONFIG_USBD_UAC2_I2S)
+	/* First AudioStreaming interface I2S binding is at i2s[0] */
+	struct uac2_i2s *i2s;
+#endif /* CONFIG_USBD_UAC2_I2S */
 };
 
 static entity_type_t id_type(struct usbd_class_data *const c_data, uint8_t id)
@@ -123,6 +153,29 @@ static entity_type_t id_type(struct usbd_class_data *const c_data, uint8_t id)
 	return ENTITY_TYPE_INVALID;
 }
 
+/* Universal Serial Bus Device Class Definition for Audio Data Formats
+ * Release 2.0, May 31, 2006. 2.3.1.6 Type I Format Type Descriptor
+ */
+struct format_type_i_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint8_t bDescriptorSubtype;
+	uint8_t bFormatType;
+	uint8_t bSubslotSize;
+	uint8_t bBitResolution;
+} __packed;
+
+/* Offset from alternate setting 1 descriptors to currently selected alternate
+ * setting descriptors. Descriptors of alternate setting 1 are used when the
+ * interface is idle.
+ */
+static uint16_t as_alternate_offset(const struct uac2_cfg *cfg, int as_idx)
+{
+	uint8_t alternate = MAX(cfg->as_alternates[as_idx], 1);
+
+	return (alternate - 1) * cfg->alt_strides[as_idx];
+}
+
 static const struct usb_ep_descriptor *
 get_as_data_ep(struct usbd_class_data *const c_data, int as_idx)
 {
@@ -139,7 +192,8 @@ get_as_data_ep(struct usbd_class_data *const c_data, int as_idx)
 
 	if ((as_idx >= 0) && (as_idx < cfg->num_ifaces) &&
 	    cfg->ep_indexes[as_idx] && descriptors) {
-		desc = descriptors[cfg->ep_indexes[as_idx]];
+		desc = descriptors[cfg->ep_indexes[as_idx] +
+				   as_alternate_offset(cfg, as_idx)];
 	}
 
 	return (const struct usb_ep_descriptor *)desc;
@@ -161,12 +215,41 @@ get_as_feedback_ep(struct usbd_class_data *const c_data, int as_idx)
 
 	if ((as_idx < cfg->num_ifaces) && cfg->fb_indexes[as_idx] &&
 	    descriptors) {
-		desc = descriptors[cfg->fb_indexes[as_idx]];
+		desc = descriptors[cfg->fb_indexes[as_idx] +
+				   as_alternate_offset(cfg, as_idx)];
 	}
 
 	return (const struct usb_ep_descriptor *)desc;
 }
 
+static const struct format_type_i_descriptor *
+get_as_format(struct usbd_class_data *const c_data, int as_idx)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	const struct uac2_cfg *cfg = dev->config;
+	const struct format_type_i_descriptor *desc = NULL;
+	const struct usb_desc_header **descriptors;
+
+	if (usbd_bus_speed(c_data->uds_ctx) == USBD_SPEED_FS) {
+		descriptors = cfg->fs_descriptors;
+	} else {
+		descriptors = cfg->hs_descriptors;
+	}
+
+	/* Format Type descriptor immediately precedes data endpoint */
+	if ((as_idx < cfg->num_ifaces) && cfg->ep_indexes[as_idx] &&
+	    descriptors) {
+		desc = (const void *)descriptors[cfg->ep_indexes[as_idx] +
+						 as_alternate_offset(cfg, as_idx) - 1];
+	}
+
+	if (desc && desc->bFormatType != FORMAT_TYPE_I) {
+		desc = NULL;
+	}
+
+	return desc;
+}
+
 static int ep_to_as_interface(const struct device *dev, uint8_t ep, bool *fb)
 {
 	const struct uac2_cfg *cfg = dev->config;
@@ -210,6 +293,230 @@ static int terminal_to_as_interface(const struct device *dev, uint8_t terminal)
 	return -ENOENT;
 }
 
+#if defined(CONFIG_USBD_UAC2_I2S)
+static struct k_mem_slab *i2s_slab(const struct device *i2s_dev,
+				   enum i2s_dir dir)
+{
+	const struct i2s_config *i2s_cfg = i2s_config_get(i2s_dev, dir);
+
+	if (i2s_cfg == NULL) {
+		return NULL;
+	}
+
+	return i2s_cfg->mem_slab;
+}
+
+static void *i2s_get_recv_buf(struct uac2_i2s *i2s, uint16_t size)
+{
+	const struct i2s_config *i2s_cfg = i2s_config_get(i2s->i2s_dev, I2S_DIR_TX);
+	void *block;
+
+	/* Packets are queued as received, i.e. every block passed to
+	 * i2s_write() holds at most block_size bytes but can be shorter.
+	 */
+	if (i2s_cfg == NULL || i2s_cfg->mem_slab == NULL ||
+	    i2s_cfg->block_size < size ||
+	    i2s_cfg->mem_slab->info.block_size < size) {
+		LOG_ERR("I2S TX block not suitable for %u bytes", size);
+		return NULL;
+	}
+
+	if (k_mem_slab_alloc(i2s_cfg->mem_slab, &block, K_NO_WAIT)) {
+		return NULL;
+	}
+
+	return block;
+}
+
+static void i2s_data_recv(struct uac2_i2s *i2s, void *buf, uint16_t size)
+{
+	struct k_mem_slab *slab = i2s_slab(i2s->i2s_dev, I2S_DIR_TX);
+	int ret;
+
+	if (size == 0) {
+		k_mem_slab_free(slab, buf);
+		return;
+	}
+
+	/* The block is handed over to I2S as it is, no copy involved */
+	ret = i2s_write(i2s->i2s_dev, buf, size);
+	if (ret) {
+		LOG_DBG("I2S write failed %d", ret);
+		k_mem_slab_free(slab, buf);
+
+		if (i2s->started) {
+			/* Most likely underrun, restart once queue is refilled */
+			(void)i2s_trigger(i2s->i2s_dev, I2S_DIR_TX,
+					  I2S_TRIGGER_PREPARE);
+			i2s->started = false;
+			i2s->queued = 0;
+		}
+
+		return;
+	}
+
+	if (!i2s->started &&
+	    ++i2s->queued >= CONFIG_USBD_UAC2_I2S_TX_PREFILL) {
+		ret = i2s_trigger(i2s->i2s_dev, I2S_DIR_TX, I2S_TRIGGER_START);
+		if (ret) {
+			LOG_ERR("Failed to start I2S TX %d", ret);
+		} else {
+			i2s->started = true;
+		}
+	}
+}
+
+static void i2s_block_free(struct uac2_i2s *i2s, void *buf)
+{
+	k_mem_slab_free(i2s_slab(i2s->i2s_dev, I2S_DIR_RX), buf);
+}
+
+static void i2s_terminal_update(struct uac2_i2s *i2s, bool out, bool enabled)
+{
+	enum i2s_dir dir = out ? I2S_DIR_TX : I2S_DIR_RX;
+	int ret;
+
+	if (!enabled) {
+		/* TX blocks queued while prefilling are dropped as well */
+		if (i2s->started || i2s->queued != 0) {
+			(void)i2s_trigger(i2s->i2s_dev, dir, I2S_TRIGGER_DROP);
+		}
+
+		i2s->started = false;
+		i2s->queued = 0;
+		return;
+	}
+
+	/* I2S TX is started once enough data is received from host */
+	if (out || i2s->started) {
+		return;
+	}
+
+	ret = i2s_trigger(i2s->i2s_dev, dir, I2S_TRIGGER_START);
+	if (ret) {
+		LOG_ERR("Failed to start I2S RX %d", ret);
+	} else {
+		i2s->started = true;
+	}
+}
+
+static void i2s_send(const struct device *dev, uint8_t terminal,
+		     struct uac2_i2s *i2s)
+{
+	void *block;
+	size_t size;
+	int ret;
+
+	if (!i2s->started) {
+		return;
+	}
+
+	/* Every I2S RX block is sent as single packet */
+	ret = i2s_read(i2s->i2s_dev, &block, &size);
+	if (ret == -EIO) {
+		/* Overrun, restart I2S RX */
+		(void)i2s_trigger(i2s->i2s_dev, I2S_DIR_RX, I2S_TRIGGER_PREPARE);
+		ret = i2s_trigger(i2s->i2s_dev, I2S_DIR_RX, I2S_TRIGGER_START);
+		i2s->started = (ret == 0);
+		return;
+	} else if (ret) {
+		/* No block available in time */
+		return;
+	}
+
+	if (usbd_uac2_send(dev, terminal, block, size)) {
+		i2s_block_free(i2s, block);
+	}
+}
+
+int usbd_uac2_i2s_bind(const struct device *dev, uint8_t terminal,
+		       const struct device *i2s_dev)
+{
+	const struct uac2_cfg *cfg = dev->config;
+	int as_idx = terminal_to_as_interface(dev, terminal);
+
+	if (as_idx < 0 || cfg->ep_indexes[as_idx] == 0U) {
+		LOG_ERR("No endpoint for terminal %d", terminal);
+		return -ENOENT;
+	}
+
+	cfg->i2s[as_idx].i2s_dev = i2s_dev;
+	cfg->i2s[as_idx].queued = 0;
+	cfg->i2s[as_idx].started = false;
+
+	return 0;
+}
+#endif /* CONFIG_USBD_UAC2_I2S */
+
+/* Returns I2S binding of AudioStreaming interface, or NULL if data is
+ * exchanged through application callbacks.
+ */
+static struct uac2_i2s *as_i2s(const struct device *dev, int as_idx)
+{
+#if defined(CONFIG_USBD_UAC2_I2S)
+	const struct uac2_cfg *cfg = dev->config;
+
+	if (cfg->i2s[as_idx].i2s_dev != NULL) {
+		return &cfg->i2s[as_idx];
+	}
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(as_idx);
+#endif /* CONFIG_USBD_UAC2_I2S */
+
+	return NULL;
+}
+
+static void *get_recv_buf(const struct device *dev, int as_idx,
+			  uint8_t terminal, uint16_t size)
+{
+	struct uac2_ctx *ctx = dev->data;
+
+#if defined(CONFIG_USBD_UAC2_I2S)
+	struct uac2_i2s *i2s = as_i2s(dev, as_idx);
+
+	if (i2s != NULL) {
+		return i2s_get_recv_buf(i2s, size);
+	}
+#endif /* CONFIG_USBD_UAC2_I2S */
+
+	return ctx->ops->get_recv_buf(dev, terminal, size, ctx->user_data);
+}
+
+static void data_recv(const struct device *dev, int as_idx,
+		      uint8_t terminal, void *buf, uint16_t size)
+{
+	struct uac2_ctx *ctx = dev->data;
+
+#if defined(CONFIG_USBD_UAC2_I2S)
+	struct uac2_i2s *i2s = as_i2s(dev, as_idx);
+
+	if (i2s != NULL) {
+		i2s_data_recv(i2s, buf, size);
+		return;
+	}
+#endif /* CONFIG_USBD_UAC2_I2S */
+
+	ctx->ops->data_recv_cb(dev, terminal, buf, size, ctx->user_data);
+}
+
+static void buf_release(const struct device *dev, int as_idx,
+			uint8_t terminal, void *buf)
+{
+	struct uac2_ctx *ctx = dev->data;
+
+#if defined(CONFIG_USBD_UAC2_I2S)
+	struct uac2_i2s *i2s = as_i2s(dev, as_idx);
+
+	if (i2s != NULL) {
+		i2s_block_free(i2s, buf);
+		return;
+	}
+#endif /* CONFIG_USBD_UAC2_I2S */
+
+	ctx->ops->buf_release_cb(dev, terminal, buf, ctx->user_data);
+}
+
 void usbd_uac2_set_ops(const struct device *dev,
 		       const struct uac2_ops *ops, void *user_data)
 {
@@ -226,7 +533,8 @@ void usbd_uac2_set_ops(const struct device *dev,
 			__ASSERT(ops->feedback_cb, "feedback_cb is mandatory");
 		}
 
-		if (ep_idx) {
+		/* Data of terminals bound to I2S does not involve application */
+		if (ep_idx && as_i2s(dev, i) == NULL) {
 			const struct usb_ep_descriptor *desc = NULL;
 
 			if (cfg->fs_descriptors != NULL) {
@@ -309,7 +617,7 @@ int usbd_uac2_send(const struct device *dev, uint8_t terminal,
 
 	if (!atomic_test_bit(&ctx->as_active, as_idx)) {
 		/* Host is not interested in the data */
-		ctx->ops->buf_release_cb(dev, terminal, data, ctx->user_data);
+		buf_release(dev, as_idx, terminal, data);
 		return 0;
 	}
 
@@ -370,7 +678,7 @@ static void schedule_iso_out_read(struct usbd_class_data *const c_data,
 	}
 
 	/* Prepare transfer to read audio OUT data from host */
-	data_buf = ctx->ops->get_recv_buf(dev, terminal, mps, ctx->user_data);
+	data_buf = get_recv_buf(dev, as_idx, terminal, mps);
 	if (!data_buf) {
 		LOG_ERR("No data buffer for terminal %d", terminal);
 		atomic_clear_bit(&ctx->as_queued, as_idx);
@@ -384,8 +692,7 @@ static void schedule_iso_out_read(struct usbd_class_data *const c_data,
 		 * we are out of netbuf, there's nothing better to do than to
 		 * pass the buffer back to application.
 		 */
-		ctx->ops->data_recv_cb(dev, terminal,
-				       data_buf, 0, ctx->user_data);
+		data_recv(dev, as_idx, terminal, data_buf, 0);
 		atomic_clear_bit(&ctx->as_queued, as_idx);
 		return;
 	}
@@ -448,6 +755,7 @@ void uac2_update(struct usbd_class_data *const c_data,
 	const struct usb_desc_header **descriptors;
 	const struct usb_association_descriptor *iad;
 	const struct usb_ep_descriptor *data_ep, *fb_ep;
+	const struct format_type_i_descriptor *format;
 	uint8_t as_idx;
 	bool microframes;
 
@@ -477,10 +785,33 @@ void uac2_update(struct usbd_class_data *const c_data,
 			(iface < iad->bFirstInterface + iad->bInterfaceCount));
 	as_idx = iface - iad->bFirstInterface - 1;
 
+	cfg->as_alternates[as_idx] = alternate;
+
+	/* Let application reconfigure audio path before the terminal is enabled
+	 * if host selected alternate setting with different format.
+	 */
+	format = get_as_format(c_data, as_idx);
+	if (alternate && format && ctx->ops->format_update_cb) {
+		ctx->ops->format_update_cb(dev, cfg->as_terminals[as_idx],
+					   format->bSubslotSize,
+					   format->bBitResolution,
+					   ctx->user_data);
+	}
+
 	/* Notify application about terminal state change */
 	ctx->ops->terminal_update_cb(dev, cfg->as_terminals[as_idx], alternate,
 				     microframes, ctx->user_data);
 
+	data_ep = get_as_data_ep(c_data, as_idx);
+
+#if defined(CONFIG_USBD_UAC2_I2S)
+	if (data_ep && as_i2s(dev, as_idx)) {
+		i2s_terminal_update(as_i2s(dev, as_idx),
+				    USB_EP_DIR_IS_OUT(data_ep->bEndpointAddress),
+				    alternate != 0);
+	}
+#endif /* CONFIG_USBD_UAC2_I2S */
+
 	if (alternate == 0) {
 		/* Mark interface as inactive, any pending endpoint transfers
 		 * were already cancelled by the USB stack.
@@ -491,7 +822,6 @@ void uac2_update(struct usbd_class_data *const c_data,
 
 	atomic_set_bit(&ctx->as_active, as_idx);
 
-	data_ep = get_as_data_ep(c_data, as_idx);
 	/* External interfaces (i.e. NULL data_ep) do not have alternate
 	 * configuration and therefore data_ep must be valid here.
 	 */
@@ -812,12 +1142,11 @@ static int uac2_request(struct usbd_class_data *const c_data, struct net_buf *bu
 	}
 
 	if (USB_EP_DIR_IS_OUT(ep)) {
-		ctx->ops->data_recv_cb(dev, terminal, buf->__buf, buf->len,
-				       ctx->user_data);
+		data_recv(dev, as_idx, terminal, buf->__buf, buf->len);
 	} else if (!is_feedback) {
-		ctx->ops->buf_release_cb(dev, terminal, buf->__buf, ctx->user_data);
+		buf_release(dev, as_idx, terminal, buf->__buf);
 		if (buf->frags) {
-			ctx->ops->buf_release_cb(dev, terminal, buf->frags->__buf, ctx->user_data);
+			buf_release(dev, as_idx, terminal, buf->frags->__buf);
 		}
 	}
 
@@ -859,6 +1188,16 @@ static void uac2_sof(struct usbd_class_data *const c_data)
 				cfg->as_terminals[as_idx]);
 		}
 
+#if defined(CONFIG_USBD_UAC2_I2S)
+		/* Send block captured by I2S bound to IN endpoint */
+		if (data_ep && USB_EP_DIR_IS_IN(data_ep->bEndpointAddress) &&
+		    as_i2s(dev, as_idx) &&
+		    atomic_test_bit(&ctx->as_active, as_idx)) {
+			i2s_send(dev, cfg->as_terminals[as_idx],
+				 as_i2s(dev, as_idx));
+		}
+#endif /* CONFIG_USBD_UAC2_I2S */
+
 		/* Skip interfaces without explicit feedback endpoint */
 		feedback_ep = get_as_feedback_ep(c_data, as_idx);
 		if (feedback_ep == NULL) {
@@ -947,6 +1286,11 @@ struct usbd_class_api uac2_api = {
 		COND_CODE_1(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node),		\
 			(UAC2_DESCRIPTOR_AS_FEEDBACK_EP_INDEX(node),), (0,))	\
 	))
+#define DEFINE_AS_ALT_STRIDES(node)						\
+	IF_ENABLED(DT_NODE_HAS_COMPAT(node, zephyr_uac2_audio_streaming), (	\
+		COND_CODE_1(AS_HAS_ISOCHRONOUS_DATA_ENDPOINT(node),		\
+			(AS_ALTERNATE_DESCRIPTORS_COUNT(node),), (0,))		\
+	))
 #define DEFINE_AS_TERMINALS(node)						\
 	IF_ENABLED(DT_NODE_HAS_COMPAT(node, zephyr_uac2_audio_streaming), (	\
 		ENTITY_ID(DT_PROP(node, linked_terminal)),			\
@@ -970,6 +1314,10 @@ struct usbd_class_api uac2_api = {
 	static const uint16_t fb_indexes_##i[] = {				\
 		DT_INST_FOREACH_CHILD_STATUS_OKAY(i, DEFINE_AS_FB_INDEXES)	\
 	};									\
+	static const uint8_t alt_strides_##i[] = {				\
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(i, DEFINE_AS_ALT_STRIDES)	\
+	};									\
+	static uint8_t as_alternates_##i[ARRAY_SIZE(ep_indexes_##i)];		\
 	static const uint8_t as_terminals_##i[] = {				\
 		DT_INST_FOREACH_CHILD_STATUS_OKAY(i, DEFINE_AS_TERMINALS)	\
 	};									\
@@ -990,6 +1338,10 @@ struct usbd_class_api uac2_api = {
 	USBD_DEFINE_CLASS(uac2_##inst, &uac2_api,				\
 			  (void *)DEVICE_DT_GET(DT_DRV_INST(inst)), NULL);	\
 	DEFINE_LOOKUP_TABLES(inst)						\
+	IF_ENABLED(CONFIG_USBD_UAC2_I2S, (					\
+		static struct uac2_i2s						\
+			uac2_i2s_##inst[ARRAY_SIZE(ep_indexes_##inst)];		\
+	))									\
 	static const struct uac2_cfg uac2_cfg_##inst = {			\
 		.c_data = &uac2_##inst,						\
 		COND_CODE_1(UAC2_ALLOWED_AT_FULL_SPEED(DT_DRV_INST(inst)),	\
@@ -1003,9 +1355,13 @@ struct usbd_class_api uac2_api = {
 		.entity_types = entity_types_##inst,				\
 		.ep_indexes = ep_indexes_##inst,				\
 		.fb_indexes = fb_indexes_##inst,				\
+		.alt_strides = alt_strides_##inst,				\
+		.as_alternates = as_alternates_##inst,				\
 		.as_terminals = as_terminals_##inst,				\
 		.num_ifaces = ARRAY_SIZE(ep_indexes_##inst),			\
 		.num_entities = ARRAY_SIZE(entity_types_##inst),		\
+		IF_ENABLED(CONFIG_USBD_UAC2_I2S,				\
+			(.i2s = uac2_i2s_##inst,))				\
 	};									\
 	BUILD_ASSERT(ARRAY_SIZE(ep_indexes_##inst) <= 32,			\
 		"UAC2 implementation supports up to 32 AS interfaces");		\
@@ -432,13 +432,17 @@
 /* Universal Serial Bus Device Class Definition for Audio Data Formats
  * Release 2.0, May 31, 2006. 2.3.1.6 Type I Format Type Descriptor
  */
-#define AUDIO_STREAMING_FORMAT_I_TYPE_DESCRIPTOR(node)				\
+#define FORMAT_I_TYPE_DESCRIPTOR(subslot, resolution)				\
 	0x06,						/* bLength */		\
 	CS_INTERFACE,					/* bDescriptorType */	\
 	AS_DESCRIPTOR_FORMAT_TYPE,			/* bDescriptorSubtype */\
 	FORMAT_TYPE_I,					/* bFormatType */	\
-	DT_PROP(node, subslot_size),			/* bSubslotSize */	\
-	DT_PROP(node, bit_resolution),			/* bBitResolution */
+	subslot,					/* bSubslotSize */	\
+	resolution,					/* bBitResolution */
+
+#define AUDIO_STREAMING_FORMAT_I_TYPE_DESCRIPTOR(node)				\
+	FORMAT_I_TYPE_DESCRIPTOR(DT_PROP(node, subslot_size),			\
+		DT_PROP(node, bit_resolution))
 
 /* Universal Serial Bus Device Class Definition for Audio Data Formats
  * Release 2.0, May 31, 2006. 2.3.4.1 Type IV Format Type Descriptor
@@ -704,8 +708,29 @@
 		(AS_NEXT_OUT_EP_ADDR(node)),					\
 		(AS_NEXT_IN_EP_ADDR(node)))
 
-#define AS_BYTES_PER_SAMPLE(node)						\
-	DT_PROP(node, subslot_size)
+/* Alternate setting 1 uses subslot-size and bit-resolution. Additional
+ * alternate settings (starting at alternate setting 2) use respective entries
+ * from additional-subslot-sizes and additional-bit-resolutions.
+ */
+#define AS_NUM_ADDITIONAL_ALTERNATES(node)					\
+	DT_PROP_LEN_OR(node, additional_subslot_sizes, 0)
+
+#define AS_ADDITIONAL_ALTERNATE(idx)						\
+	UTIL_INC(UTIL_INC(idx))
+
+#define AS_ADDITIONAL_SUBSLOT_SIZE(node, idx)					\
+	DT_PROP_BY_IDX(node, additional_subslot_sizes, idx)
+
+#define AS_ADDITIONAL_BIT_RESOLUTION(node, idx)					\
+	DT_PROP_BY_IDX(node, additional_bit_resolutions, idx)
+
+/* Subslot sizes are ascending (asserted at compile time), so the largest one
+ * is either the last additional subslot size or the only subslot size.
+ */
+#define AS_MAX_SUBSLOT_SIZE(node)						\
+	COND_CODE_1(DT_NODE_HAS_PROP(node, additional_subslot_sizes),		\
+		(DT_PROP_LAST(node, additional_subslot_sizes)),			\
+		(DT_PROP(node, subslot_size)))
 
 #define AS_FS_DATA_EP_BINTERVAL(node)						\
 	USB_FS_ISO_EP_INTERVAL(DT_PROP_OR(node, polling_period_us, 1000))
@@ -735,42 +760,44 @@
 	USB_EP_TYPE_ISO | AS_DATA_EP_SYNC_TYPE(node) |				\
 	AS_DATA_EP_USAGE_TYPE(node)
 
-#define AS_FS_DATA_EP_MAX_PACKET_SIZE(node)					\
+#define AS_FS_DATA_EP_MAX_PACKET_SIZE(node, subslot)				\
 	AUDIO_STREAMING_NUM_SPATIAL_LOCATIONS(node) *				\
-	AS_BYTES_PER_SAMPLE(node) * AS_SAMPLES_PER_FRAME(node)
+	(subslot) * AS_SAMPLES_PER_FRAME(node)
 
-#define AS_HS_DATA_EP_TPL(node)							\
+#define AS_HS_DATA_EP_TPL(node, subslot)					\
 	USB_TPL_ROUND_UP(AUDIO_STREAMING_NUM_SPATIAL_LOCATIONS(node) *		\
-		AS_BYTES_PER_SAMPLE(node) * AS_SAMPLES_PER_MICROFRAME(node))
+		(subslot) * AS_SAMPLES_PER_MICROFRAME(node))
 
-#define AS_HS_DATA_EP_MAX_PACKET_SIZE(node)					\
-	USB_TPL_TO_MPS(AS_HS_DATA_EP_TPL(node))
+#define AS_HS_DATA_EP_MAX_PACKET_SIZE(node, subslot)				\
+	USB_TPL_TO_MPS(AS_HS_DATA_EP_TPL(node, subslot))
 
 /* 4.10.1.1 Standard AS Isochronous Audio Data Endpoint Descriptor */
-#define STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTOR(node)		\
+#define STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTOR(node, subslot)	\
 	0x07,						/* bLength */		\
 	USB_DESC_ENDPOINT,				/* bDescriptorType */	\
 	AS_DATA_EP_ADDR(node),				/* bEndpointAddress */	\
 	AS_DATA_EP_ATTR(node),				/* bmAttributes */	\
-	U16_LE(AS_FS_DATA_EP_MAX_PACKET_SIZE(node)),	/* wMaxPacketSize */	\
+	U16_LE(AS_FS_DATA_EP_MAX_PACKET_SIZE(node, subslot)), /* wMaxPacketSize */\
 	AS_FS_DATA_EP_BINTERVAL(node),			/* bInterval */
 
 #define AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTORS_ARRAYS(node)		\
 	static uint8_t DESCRIPTOR_NAME(fs_std_data_ep, node)[] = {		\
-		STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTOR(node)	\
+		STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTOR(node,	\
+			DT_PROP(node, subslot_size))				\
 	};
 
-#define STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTOR(node)		\
+#define STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTOR(node, subslot)	\
 	0x07,						/* bLength */		\
 	USB_DESC_ENDPOINT,				/* bDescriptorType */	\
 	AS_DATA_EP_ADDR(node),				/* bEndpointAddress */	\
 	AS_DATA_EP_ATTR(node),				/* bmAttributes */	\
-	U16_LE(AS_HS_DATA_EP_MAX_PACKET_SIZE(node)),	/* wMaxPacketSize */	\
+	U16_LE(AS_HS_DATA_EP_MAX_PACKET_SIZE(node, subslot)), /* wMaxPacketSize */\
 	AS_HS_DATA_EP_BINTERVAL(node),			/* bInterval */
 
 #define AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTORS_ARRAYS(node)		\
 	static uint8_t DESCRIPTOR_NAME(hs_std_data_ep, node)[] = {		\
-		STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTOR(node)	\
+		STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTOR(node,	\
+			DT_PROP(node, subslot_size))				\
 	};
 
 #define LOCK_DELAY_UNITS(node)							\
@@ -848,6 +875,75 @@
 			AS_EXPLICIT_FEEDBACK_HS_DESCRIPTOR_ARRAY(node)))	\
 	))
 
+/* Additional alternate settings (alternate setting idx + 2) differ from the
+ * alternate setting 1 only in Format Type descriptor and data endpoint
+ * wMaxPacketSize. Class-Specific AS Interface and Class-Specific AS Isochronous
+ * Audio Data Endpoint descriptors are shared with alternate setting 1.
+ * Standard descriptors are not shared because the USB stack fixes up interface
+ * numbers and endpoint addresses at runtime.
+ */
+#define AS_ADDITIONAL_FS_DESCRIPTORS_ARRAYS(idx, node)				\
+	static uint8_t DESCRIPTOR_NAME(fs_as_if_add##idx, node)[] = {		\
+		AS_INTERFACE_DESCRIPTOR(node, AS_ADDITIONAL_ALTERNATE(idx),	\
+			AS_INTERFACE_NUM_ENDPOINTS(node))			\
+	};									\
+	static uint8_t DESCRIPTOR_NAME(fs_std_data_ep_add##idx, node)[] = {	\
+		STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTOR(node,	\
+			AS_ADDITIONAL_SUBSLOT_SIZE(node, idx))			\
+	};									\
+	IF_ENABLED(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node), (			\
+		static uint8_t DESCRIPTOR_NAME(fs_feedback_ep_add##idx, node)[] = { \
+			AS_EXPLICIT_FEEDBACK_ENDPOINT_FS_DESCRIPTOR(node)	\
+		};								\
+	))
+
+#define AS_ADDITIONAL_HS_DESCRIPTORS_ARRAYS(idx, node)				\
+	static uint8_t DESCRIPTOR_NAME(hs_as_if_add##idx, node)[] = {		\
+		AS_INTERFACE_DESCRIPTOR(node, AS_ADDITIONAL_ALTERNATE(idx),	\
+			AS_INTERFACE_NUM_ENDPOINTS(node))			\
+	};									\
+	static uint8_t DESCRIPTOR_NAME(hs_std_data_ep_add##idx, node)[] = {	\
+		STANDARD_AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTOR(node,	\
+			AS_ADDITIONAL_SUBSLOT_SIZE(node, idx))			\
+	};									\
+	IF_ENABLED(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node), (			\
+		static uint8_t DESCRIPTOR_NAME(hs_feedback_ep_add##idx, node)[] = { \
+			AS_EXPLICIT_FEEDBACK_ENDPOINT_HS_DESCRIPTOR(node)	\
+		};								\
+	))
+
+#define AS_ADDITIONAL_DESCRIPTORS_ARRAYS(idx, node)				\
+	static uint8_t DESCRIPTOR_NAME(as_format_desc_add##idx, node)[] = {	\
+		FORMAT_I_TYPE_DESCRIPTOR(AS_ADDITIONAL_SUBSLOT_SIZE(node, idx),	\
+			AS_ADDITIONAL_BIT_RESOLUTION(node, idx))		\
+	};									\
+	IF_ENABLED(UAC2_ALLOWED_AT_FULL_SPEED(DT_PARENT(node)), (		\
+		AS_ADDITIONAL_FS_DESCRIPTORS_ARRAYS(idx, node)))		\
+	IF_ENABLED(UAC2_ALLOWED_AT_HIGH_SPEED(DT_PARENT(node)), (		\
+		AS_ADDITIONAL_HS_DESCRIPTORS_ARRAYS(idx, node)))
+
+#define AS_ADDITIONAL_FS_DESCRIPTORS_PTRS(idx, node)				\
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(fs_as_if_add##idx, node),	\
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(as_general_desc, node),	\
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(as_format_desc_add##idx, node), \
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(fs_std_data_ep_add##idx, node), \
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(cs_data_ep, node),		\
+	IF_ENABLED(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node), (			\
+		(struct usb_desc_header *)					\
+			&DESCRIPTOR_NAME(fs_feedback_ep_add##idx, node),	\
+	))
+
+#define AS_ADDITIONAL_HS_DESCRIPTORS_PTRS(idx, node)				\
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(hs_as_if_add##idx, node),	\
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(as_general_desc, node),	\
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(as_format_desc_add##idx, node), \
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(hs_std_data_ep_add##idx, node), \
+	(struct usb_desc_header *) &DESCRIPTOR_NAME(cs_data_ep, node),		\
+	IF_ENABLED(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node), (			\
+		(struct usb_desc_header *)					\
+			&DESCRIPTOR_NAME(hs_feedback_ep_add##idx, node),	\
+	))
+
 #define AS_DESCRIPTORS_ARRAYS(node)						\
 	AS_INTERFACE_DESCRIPTOR_ARRAY(node, 0, 0)				\
 	IF_ENABLED(AS_HAS_ISOCHRONOUS_DATA_ENDPOINT(node), (			\
@@ -859,7 +955,9 @@
 	IF_ENABLED(UAC2_ALLOWED_AT_HIGH_SPEED(DT_PARENT(node)), (		\
 		AS_HS_DESCRIPTORS_ARRAYS(node)))				\
 	IF_ENABLED(AS_HAS_ISOCHRONOUS_DATA_ENDPOINT(node), (			\
-		AS_ISOCHRONOUS_DATA_ENDPOINT_CS_DESCRIPTORS_ARRAYS(node)))
+		AS_ISOCHRONOUS_DATA_ENDPOINT_CS_DESCRIPTORS_ARRAYS(node)	\
+		LISTIFY(AS_NUM_ADDITIONAL_ALTERNATES(node),			\
+			AS_ADDITIONAL_DESCRIPTORS_ARRAYS, (), node)))
 
 #define AS_FS_DESCRIPTORS_PTRS(node)						\
 	AS_INTERFACE_FS_DESCRIPTOR_PTR(node, 0)					\
@@ -870,6 +968,8 @@
 		AS_ISOCHRONOUS_DATA_ENDPOINT_FS_DESCRIPTORS_PTRS(node)		\
 		IF_ENABLED(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node), (		\
 			AS_EXPLICIT_FEEDBACK_ENDPOINT_FS_DESCRIPTOR_PTR(node)))	\
+		LISTIFY(AS_NUM_ADDITIONAL_ALTERNATES(node),			\
+			AS_ADDITIONAL_FS_DESCRIPTORS_PTRS, (), node)		\
 	))
 
 #define AS_HS_DESCRIPTORS_PTRS(node)						\
@@ -881,6 +981,8 @@
 		AS_ISOCHRONOUS_DATA_ENDPOINT_HS_DESCRIPTORS_PTRS(node)		\
 		IF_ENABLED(AS_HAS_EXPLICIT_FEEDBACK_ENDPOINT(node), (		\
 			AS_EXPLICIT_FEEDBACK_ENDPOINT_HS_DESCRIPTOR_PTR(node)))	\
+		LISTIFY(AS_NUM_ADDITIONAL_ALTERNATES(node),			\
+			AS_ADDITIONAL_HS_DESCRIPTORS_PTRS, (), node)		\
 	))
 
 #define AS_DESCRIPTORS_ARRAYS_IF_AUDIOSTREAMING(node)				\
@@ -978,6 +1080,20 @@
 		))								\
 	)), (0))
 
+/* Number of descriptors in every operational alternate setting, i.e. the
+ * distance between data endpoint descriptors of consecutive alternates.
+ * Standard AS Interface, Class-Specific AS Interface and Format Type
+ * descriptors are followed by the endpoint descriptors.
+ */
+#define AS_ALTERNATE_DESCRIPTORS_COUNT(node)					\
+	(3 + AS_ISOCHRONOUS_DATA_ENDPOINT_DESCRIPTORS_COUNT(node) +		\
+	 AS_EXPLICIT_FEEDBACK_ENDPOINT_DESCRIPTOR_COUNT(node))
+
+#define AS_ADDITIONAL_ALTERNATES_DESCRIPTORS_COUNT(node)			\
+	COND_CODE_1(DT_NODE_HAS_PROP(node, additional_subslot_sizes),		\
+		(AS_NUM_ADDITIONAL_ALTERNATES(node) *				\
+		 AS_ALTERNATE_DESCRIPTORS_COUNT(node)), (0))
+
 /* Return index inside UAC2_FS_DESCRIPTOR_PTRS(DT_PARENT(node)) and/or
  * UAC2_HS_DESCRIPTOR_PTRS(DT_PARENT(node)) pointing to data endpoint
  * descriptor belonging to given AudioStreaming interface node.
@@ -987,6 +1103,7 @@
  */
 #define UAC2_DESCRIPTOR_AS_DATA_EP_INDEX(node)					\
 	UAC2_DESCRIPTOR_AS_DESC_END_COUNT(node)					\
+	- AS_ADDITIONAL_ALTERNATES_DESCRIPTORS_COUNT(node)			\
 	- AS_EXPLICIT_FEEDBACK_ENDPOINT_DESCRIPTOR_COUNT(node)			\
 	- AS_ISOCHRONOUS_DATA_ENDPOINT_DESCRIPTORS_COUNT(node)
 
@@ -999,6 +1116,7 @@
  */
 #define UAC2_DESCRIPTOR_AS_FEEDBACK_EP_INDEX(node)				\
 	UAC2_DESCRIPTOR_AS_DESC_END_COUNT(node)					\
+	- AS_ADDITIONAL_ALTERNATES_DESCRIPTORS_COUNT(node)			\
 	- AS_EXPLICIT_FEEDBACK_ENDPOINT_DESCRIPTOR_COUNT(node)
 
 /* Helper macros to validate USB Audio Class 2 devicetree entries.
@@ -1062,6 +1180,41 @@
 #define VALIDATE_BIT_RESOLUTION(node)						\
 	(DT_PROP(node, bit_resolution) <= (DT_PROP(node, subslot_size) * 8))
 
+#define VALIDATE_ADDITIONAL_SUBSLOT_SIZE(node, idx)				\
+	(AS_ADDITIONAL_SUBSLOT_SIZE(node, idx) >= 1 &&				\
+	 AS_ADDITIONAL_SUBSLOT_SIZE(node, idx) <= 4)
+
+#define VALIDATE_ADDITIONAL_BIT_RESOLUTION(node, idx)				\
+	(AS_ADDITIONAL_BIT_RESOLUTION(node, idx) <=				\
+	 (AS_ADDITIONAL_SUBSLOT_SIZE(node, idx) * 8))
+
+/* USB stack requires endpoint characteristics to be ascending in alternate
+ * settings, i.e. wMaxPacketSize must not decrease with alternate number.
+ */
+#define AS_PREVIOUS_SUBSLOT_SIZE(node, idx)					\
+	COND_CODE_0(idx, (DT_PROP(node, subslot_size)),				\
+		(AS_ADDITIONAL_SUBSLOT_SIZE(node, UTIL_DEC(idx))))
+
+#define VALIDATE_ADDITIONAL_ALTERNATE(idx, node)				\
+	BUILD_ASSERT(VALIDATE_ADDITIONAL_SUBSLOT_SIZE(node, idx),		\
+		"Additional Subslot Size can only be 1, 2, 3 or 4");		\
+	BUILD_ASSERT(VALIDATE_ADDITIONAL_BIT_RESOLUTION(node, idx),		\
+		"Additional Bit Resolution must fit inside Subslot Size");	\
+	BUILD_ASSERT(AS_ADDITIONAL_SUBSLOT_SIZE(node, idx) >=			\
+		AS_PREVIOUS_SUBSLOT_SIZE(node, idx),				\
+		"Additional Subslot Sizes must be ascending");
+
+#define VALIDATE_ADDITIONAL_ALTERNATES(node)					\
+	BUILD_ASSERT(DT_PROP_LEN_OR(node, additional_bit_resolutions, 0) ==	\
+		AS_NUM_ADDITIONAL_ALTERNATES(node),				\
+		"Every additional Subslot Size needs Bit Resolution");		\
+	BUILD_ASSERT(AS_HAS_ISOCHRONOUS_DATA_ENDPOINT(node) ||			\
+		!AS_NUM_ADDITIONAL_ALTERNATES(node),				\
+		"External interface cannot have additional alternates");	\
+	IF_ENABLED(AS_HAS_ISOCHRONOUS_DATA_ENDPOINT(node), (			\
+		LISTIFY(AS_NUM_ADDITIONAL_ALTERNATES(node),			\
+			VALIDATE_ADDITIONAL_ALTERNATE, (), node)))
+
 #define VALIDATE_LINKED_TERMINAL(node)						\
 	UTIL_OR(DT_NODE_HAS_COMPAT(DT_PROP(node, linked_terminal),		\
 		zephyr_uac2_input_terminal),					\
@@ -1070,11 +1223,13 @@
 
 #define VALIDATE_AS_BANDWIDTH(node)						\
 	IF_ENABLED(UAC2_ALLOWED_AT_FULL_SPEED(DT_PARENT(node)),	(		\
-		BUILD_ASSERT(AS_FS_DATA_EP_MAX_PACKET_SIZE(node) <= 1023,	\
+		BUILD_ASSERT(AS_FS_DATA_EP_MAX_PACKET_SIZE(node,		\
+			AS_MAX_SUBSLOT_SIZE(node)) <= 1023,			\
 			"Full-Speed bandwidth exceeded");			\
 	))									\
 	IF_ENABLED(UAC2_ALLOWED_AT_HIGH_SPEED(DT_PARENT(node)), (		\
-		BUILD_ASSERT(USB_TPL_IS_VALID(AS_HS_DATA_EP_TPL(node)),		\
+		BUILD_ASSERT(USB_TPL_IS_VALID(AS_HS_DATA_EP_TPL(node,		\
+			AS_MAX_SUBSLOT_SIZE(node))),				\
 			"High-Speed bandwidth exceeded");			\
 	))
 
@@ -1117,6 +1272,7 @@
 			"Implicit feedback on SOF synchronized clock");		\
 		IF_ENABLED(AS_HAS_ISOCHRONOUS_DATA_ENDPOINT(node), (		\
 			VALIDATE_AS_BANDWIDTH(node)))				\
+		VALIDATE_ADDITIONAL_ALTERNATES(node)				\
 	))
 
 #define VALIDATE_INSTANCE(uac2)							\
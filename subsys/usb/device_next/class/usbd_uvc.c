@@ -52,6 +52,7 @@ enum uvc_class_status {
 	UVC_STATE_STREAM_READY,
 	UVC_STATE_STREAM_RESTART,
 	UVC_STATE_PAUSED,
+	UVC_STATE_PAYLOAD_STARTED,
 };
 
 enum uvc_unit_id {
@@ -1788,6 +1789,15 @@ static struct net_buf *uvc_initiate_transfer(const struct device *dev,
 	if (vbuf->bytesused <= net_buf_tailroom(buf)) {
 		/* Very short video buffer fitting in the first packet */
 		*next_vbuf_offset = vbuf->bytesused;
+	} else if (mps <= UINT8_MAX) {
+		/* The header can be padded to a full packet, sent as a separate fragment, so that
+		 * the entire video buffer is transmitted directly without copying any of it.
+		 */
+		size_t pad = net_buf_tailroom(buf);
+
+		((struct uvc_payload_header *)buf->data)->bHeaderLength = mps;
+		memset(net_buf_add(buf, pad), 0, pad);
+		*next_vbuf_offset = 0;
 	} else {
 		/* Pad the USB buffer until the next video buffer pointer is aligned for UDC */
 		while (!IS_UDC_ALIGNED((uintptr_t)&vbuf->buffer[net_buf_tailroom(buf)])) {
@@ -1874,6 +1884,7 @@ static int uvc_reset_transfer(const struct device *dev)
 	bi->udc.ep = uvc_get_bulk_in(dev);
 	bi->vbuf = NULL;
 	data->vbuf_offset = 0;
+	atomic_clear_bit(&data->state, UVC_STATE_PAYLOAD_STARTED);
 
 	ret = usbd_ep_enqueue(cfg->c_data, buf);
 	if (ret != 0) {
@@ -1912,7 +1923,7 @@ static int uvc_flush_vbuf(const struct device *dev, struct video_buffer *const v
 		return uvc_reset_transfer(dev);
 	}
 
-	if (data->vbuf_offset == 0) {
+	if (!atomic_test_bit(&data->state, UVC_STATE_PAYLOAD_STARTED)) {
 		buf = uvc_initiate_transfer(dev, vbuf, &next_line_offset, &next_vbuf_offset);
 	} else {
 		buf = uvc_continue_transfer(dev, vbuf, &next_line_offset, &next_vbuf_offset);
@@ -1945,9 +1956,12 @@ static int uvc_flush_vbuf(const struct device *dev, struct video_buffer *const v
 	/* End-of-Transfer condition */
 	if (next_vbuf_offset == vbuf->bytesused) {
 		data->vbuf_offset = 0;
+		atomic_clear_bit(&data->state, UVC_STATE_PAYLOAD_STARTED);
 		return UVC_VBUF_DONE;
 	}
 
+	atomic_set_bit(&data->state, UVC_STATE_PAYLOAD_STARTED);
+
 	return 0;
 }
 
@@ -20,6 +20,7 @@
 #include "usbd_ch9.h"
 #include "usbd_class.h"
 #include "usbd_class_api.h"
+#include "usbd_endpoint.h"
 #include "usbd_msg.h"
 
 #include <zephyr/logging/log.h>
@@ -31,11 +32,13 @@ static struct k_thread usbd_thread_data;
 K_MSGQ_DEFINE(usbd_msgq, sizeof(struct udc_event),
 	      CONFIG_USBD_MAX_UDC_MSG, sizeof(uint32_t));
 
-static int usbd_event_carrier(const struct device *dev,
-			      const struct udc_event *const event)
-{
-	return k_msgq_put(&usbd_msgq, event, K_NO_WAIT);
-}
+#if defined(CONFIG_USBD_ISO_EVENTS_THREAD)
+static K_KERNEL_STACK_DEFINE(usbd_iso_stack, CONFIG_USBD_ISO_THREAD_STACK_SIZE);
+static struct k_thread usbd_iso_thread_data;
+
+K_MSGQ_DEFINE(usbd_iso_msgq, sizeof(struct udc_event),
+	      CONFIG_USBD_MAX_UDC_ISO_MSG, sizeof(uint32_t));
+#endif
 
 static int event_handler_ep_request(struct usbd_context *const uds_ctx,
 				    const struct udc_event *const event)
@@ -183,6 +186,23 @@ static ALWAYS_INLINE void usbd_event_handler(struct usbd_context *const uds_ctx,
 	}
 }
 
+/*
+ * With isochronous events processed in another context, class callbacks can
+ * be called from two threads at once. Serialize them with the context lock.
+ */
+static void usbd_event_handler_locked(struct usbd_context *const uds_ctx,
+				      struct udc_event *const event)
+{
+	if (IS_ENABLED(CONFIG_USBD_ISO_EVENTS_STACK_THREAD)) {
+		usbd_event_handler(uds_ctx, event);
+		return;
+	}
+
+	usbd_device_lock(uds_ctx);
+	usbd_event_handler(uds_ctx, event);
+	usbd_device_unlock(uds_ctx);
+}
+
 static void usbd_thread(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
@@ -198,10 +218,75 @@ static void usbd_thread(void *p1, void *p2, void *p3)
 		uds_ctx = (void *)udc_get_event_ctx(event.dev);
 		__ASSERT(uds_ctx != NULL && usbd_is_initialized(uds_ctx),
 			 "USB device is not initialized");
-		usbd_event_handler(uds_ctx, &event);
+		usbd_event_handler_locked(uds_ctx, &event);
 	}
 }
 
+#if defined(CONFIG_USBD_ISO_EVENTS_THREAD)
+static void usbd_iso_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct usbd_context *uds_ctx;
+	struct udc_event event;
+
+	while (true) {
+		k_msgq_get(&usbd_iso_msgq, &event, K_FOREVER);
+
+		uds_ctx = (void *)udc_get_event_ctx(event.dev);
+		__ASSERT(uds_ctx != NULL && usbd_is_initialized(uds_ctx),
+			 "USB device is not initialized");
+		usbd_event_handler_locked(uds_ctx, &event);
+	}
+}
+#endif
+
+/*
+ * SOF events and transfers on isochronous endpoints can be processed outside
+ * of the USB device stack thread, so that control and bulk traffic does not
+ * delay them. Transfers on isochronous endpoints that are being disabled may
+ * still be passed to the USB device stack thread.
+ */
+static bool usbd_event_is_iso(const struct udc_event *const event)
+{
+	struct usbd_context *uds_ctx;
+	struct udc_buf_info *bi;
+
+	if (event->type == UDC_EVT_SOF) {
+		return true;
+	}
+
+	if (event->type != UDC_EVT_EP_REQUEST) {
+		return false;
+	}
+
+	uds_ctx = (void *)udc_get_event_ctx(event->dev);
+	bi = udc_get_buf_info(event->buf);
+
+	return usbd_ep_bm_is_set(&uds_ctx->iso_ep_bm, bi->ep);
+}
+
+static int usbd_event_carrier(const struct device *dev,
+			      const struct udc_event *const event)
+{
+	if (!IS_ENABLED(CONFIG_USBD_ISO_EVENTS_STACK_THREAD) &&
+	    usbd_event_is_iso(event)) {
+#if defined(CONFIG_USBD_ISO_EVENTS_THREAD)
+		return k_msgq_put(&usbd_iso_msgq, event, K_NO_WAIT);
+#else
+		struct udc_event iso_event = *event;
+
+		usbd_event_handler_locked((void *)udc_get_event_ctx(dev), &iso_event);
+
+		return 0;
+#endif
+	}
+
+	return k_msgq_put(&usbd_msgq, event, K_NO_WAIT);
+}
+
 int usbd_device_init_core(struct usbd_context *const uds_ctx)
 {
 	int ret;
@@ -268,6 +353,16 @@ static int usbd_pre_init(void)
 
 	k_thread_name_set(&usbd_thread_data, "usbd");
 
+#if defined(CONFIG_USBD_ISO_EVENTS_THREAD)
+	k_thread_create(&usbd_iso_thread_data, usbd_iso_stack,
+			K_KERNEL_STACK_SIZEOF(usbd_iso_stack),
+			usbd_iso_thread,
+			NULL, NULL, NULL,
+			K_PRIO_COOP(CONFIG_USBD_ISO_THREAD_PRIORITY), 0, K_NO_WAIT);
+
+	k_thread_name_set(&usbd_iso_thread_data, "usbd_iso");
+#endif
+
 	LOG_DBG("Available USB class iterators:");
 	STRUCT_SECTION_FOREACH_ALTERNATE(usbd_class_fs, usbd_class_node, c_nd) {
 		atomic_set(&c_nd->state, 0);
@@ -21,12 +21,16 @@ int usbd_ep_enable(const struct device *dev,
 		   const struct usb_ep_descriptor *const ed,
 		   uint32_t *const ep_bm)
 {
+	struct usbd_context *uds_ctx = (void *)udc_get_event_ctx(dev);
 	int ret;
 
 	ret = udc_ep_enable(dev, ed->bEndpointAddress, ed->bmAttributes,
 			    sys_le16_to_cpu(ed->wMaxPacketSize), ed->bInterval);
 	if (ret == 0) {
 		usbd_ep_bm_set(ep_bm, ed->bEndpointAddress);
+		if ((ed->bmAttributes & USB_EP_TRANSFER_TYPE_MASK) == USB_EP_TYPE_ISO) {
+			usbd_ep_bm_set(&uds_ctx->iso_ep_bm, ed->bEndpointAddress);
+		}
 	}
 
 	return ret;
@@ -36,6 +40,7 @@ int usbd_ep_disable(const struct device *dev,
 		    const uint8_t ep,
 		    uint32_t *const ep_bm)
 {
+	struct usbd_context *uds_ctx = (void *)udc_get_event_ctx(dev);
 	int ret;
 
 	ret = udc_ep_disable(dev, ep);
@@ -44,6 +49,7 @@ int usbd_ep_disable(const struct device *dev,
 	}
 
 	usbd_ep_bm_clear(ep_bm, ep);
+	usbd_ep_bm_clear(&uds_ctx->iso_ep_bm, ep);
 
 	ret = udc_ep_dequeue(dev, ep);
 	if (ret) {
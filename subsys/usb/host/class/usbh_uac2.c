@@ -0,0 +1,530 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/usb/usbh.h>
+#include <zephyr/usb/usb_ch9.h>
+#include <zephyr/usb/class/usbh_uac2.h>
+
+#include "usbh_device.h"
+#include "usbh_ch9.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(usbh_uac2, CONFIG_USBH_UAC2_LOG_LEVEL);
+
+/* Audio Interface Subclass and Protocol Codes */
+#define AUDIOCONTROL		0x01
+#define AUDIOSTREAMING		0x02
+#define IP_VERSION_02_00	0x20
+
+/* Audio Class-Specific AC and AS Interface Descriptor Subtypes */
+#define AC_CLOCK_SOURCE		0x0A
+#define AS_GENERAL		0x01
+#define AS_FORMAT_TYPE		0x02
+
+#define FORMAT_TYPE_I		0x01
+
+/* Audio Class-Specific Request Code and Clock Source Control Selector */
+#define CUR			0x01
+#define CS_SAM_FREQ_CONTROL	0x01
+
+#define UAC2_STATE_CONFIGURED	0
+#define UAC2_STATE_STREAMING	1
+
+struct uac2_clock_source_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint8_t bDescriptorSubtype;
+	uint8_t bClockID;
+	uint8_t bmAttributes;
+	uint8_t bmControls;
+	uint8_t bAssocTerminal;
+	uint8_t iClockSource;
+} __packed;
+
+struct uac2_as_general_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint8_t bDescriptorSubtype;
+	uint8_t bTerminalLink;
+	uint8_t bmControls;
+	uint8_t bFormatType;
+	uint32_t bmFormats;
+	uint8_t bNrChannels;
+	uint32_t bmChannelConfig;
+	uint8_t iChannelNames;
+} __packed;
+
+struct uac2_format_type_i_descriptor {
+	uint8_t bLength;
+	uint8_t bDescriptorType;
+	uint8_t bDescriptorSubtype;
+	uint8_t bFormatType;
+	uint8_t bSubslotSize;
+	uint8_t bBitResolution;
+} __packed;
+
+struct uac2_rx_block {
+	void *mem;
+	size_t size;
+};
+
+struct usbh_uac2_data {
+	/* Capture configuration set by the application */
+	struct usbh_uac2_cfg cfg;
+	/* Host controller the streaming device is connected to */
+	const struct device *uhc_dev;
+	/* Streaming device */
+	struct usb_device *udev;
+	/* Filled RX blocks waiting to be read by the application */
+	struct k_msgq rx_queue;
+	/* RX block currently being filled */
+	void *block;
+	size_t block_len;
+	/* Number of isochronous transfers owned by the controller */
+	atomic_t xfers;
+	/* Queued isochronous transfers, protected by lock */
+	struct uhc_transfer *xfer_list[CONFIG_USBH_UAC2_NUM_XFERS];
+	struct k_mutex lock;
+	atomic_t state;
+	atomic_t dropped;
+	/* Streaming interface, clock source and endpoint */
+	uint8_t ac_iface;
+	uint8_t clock_id;
+	uint8_t as_iface;
+	uint8_t as_alt;
+	uint8_t ep;
+	uint16_t tpl;
+	uint16_t interval;
+};
+
+static char __aligned(sizeof(void *))
+	uac2_rx_queue_buf[CONFIG_USBH_UAC2_RX_QUEUE_SIZE * sizeof(struct uac2_rx_block)];
+
+static struct usbh_uac2_data uac2_data = {
+	.lock = Z_MUTEX_INITIALIZER(uac2_data.lock),
+};
+
+static bool uac2_iface_is_audio(const struct usb_if_descriptor *const if_desc,
+				const uint8_t subclass)
+{
+	return if_desc != NULL &&
+	       if_desc->bInterfaceClass == USB_BCC_AUDIO &&
+	       if_desc->bInterfaceSubClass == subclass &&
+	       if_desc->bInterfaceProtocol == IP_VERSION_02_00;
+}
+
+static bool uac2_format_match(const struct usbh_uac2_cfg *const cfg,
+			      const struct uac2_as_general_descriptor *const gen,
+			      const struct uac2_format_type_i_descriptor *const fmt)
+{
+	if (gen->bFormatType != FORMAT_TYPE_I || fmt->bFormatType != FORMAT_TYPE_I) {
+		return false;
+	}
+
+	return (cfg->channels == 0 || cfg->channels == gen->bNrChannels) &&
+	       (cfg->subslot_size == 0 || cfg->subslot_size == fmt->bSubslotSize) &&
+	       (cfg->bit_resolution == 0 || cfg->bit_resolution == fmt->bBitResolution);
+}
+
+/*
+ * Find the clock source and the first AudioStreaming interface alternate
+ * with an isochronous IN endpoint and a format matching the configuration.
+ */
+static int uac2_parse_cfg_desc(struct usbh_uac2_data *const data,
+			       const struct usb_device *const udev)
+{
+	struct usb_cfg_descriptor *cfg_desc = udev->cfg_desc;
+	const struct uac2_as_general_descriptor *gen = NULL;
+	const struct uac2_format_type_i_descriptor *fmt = NULL;
+	const struct usb_if_descriptor *if_desc = NULL;
+	const struct usb_ep_descriptor *ep_desc;
+	struct usb_desc_header *dhp;
+	bool clock_found = false;
+	void *desc_end;
+
+	dhp = (void *)((uint8_t *)cfg_desc + cfg_desc->bLength);
+	desc_end = (void *)((uint8_t *)cfg_desc + cfg_desc->wTotalLength);
+
+	while ((void *)dhp < desc_end && dhp->bLength != 0) {
+		const uint8_t *const desc = (const uint8_t *)dhp;
+
+		switch (dhp->bDescriptorType) {
+		case USB_DESC_INTERFACE:
+			if_desc = (const struct usb_if_descriptor *)dhp;
+			gen = NULL;
+			fmt = NULL;
+			break;
+		case USB_DESC_CS_INTERFACE:
+			if (uac2_iface_is_audio(if_desc, AUDIOCONTROL) && !clock_found &&
+			    desc[2] == AC_CLOCK_SOURCE) {
+				data->ac_iface = if_desc->bInterfaceNumber;
+				data->clock_id =
+					((const struct uac2_clock_source_descriptor *)dhp)->bClockID;
+				clock_found = true;
+			}
+
+			if (uac2_iface_is_audio(if_desc, AUDIOSTREAMING)) {
+				if (desc[2] == AS_GENERAL &&
+				    dhp->bLength >= sizeof(struct uac2_as_general_descriptor)) {
+					gen = (const struct uac2_as_general_descriptor *)dhp;
+				}
+
+				if (desc[2] == AS_FORMAT_TYPE &&
+				    dhp->bLength >= sizeof(struct uac2_format_type_i_descriptor)) {
+					fmt = (const struct uac2_format_type_i_descriptor *)dhp;
+				}
+			}
+
+			break;
+		case USB_DESC_ENDPOINT:
+			ep_desc = (const struct usb_ep_descriptor *)dhp;
+
+			if (!uac2_iface_is_audio(if_desc, AUDIOSTREAMING) ||
+			    if_desc->bAlternateSetting == 0 ||
+			    gen == NULL || fmt == NULL ||
+			    !USB_EP_DIR_IS_IN(ep_desc->bEndpointAddress) ||
+			    (ep_desc->bmAttributes & USB_EP_TRANSFER_TYPE_MASK) != USB_EP_TYPE_ISO ||
+			    !uac2_format_match(&data->cfg, gen, fmt)) {
+				break;
+			}
+
+			data->as_iface = if_desc->bInterfaceNumber;
+			data->as_alt = if_desc->bAlternateSetting;
+			data->ep = ep_desc->bEndpointAddress;
+			/* wMaxPacketSize is already converted to CPU order */
+			data->tpl = USB_MPS_TO_TPL(ep_desc->wMaxPacketSize);
+			data->interval = BIT(CLAMP(ep_desc->bInterval, 1, 16) - 1);
+
+			LOG_INF("Interface %u alternate %u ep 0x%02x, %u channels, %u bits",
+				data->as_iface, data->as_alt, data->ep,
+				gen->bNrChannels, fmt->bBitResolution);
+
+			return clock_found ? 0 : -ENOENT;
+		default:
+			break;
+		}
+
+		dhp = (void *)((uint8_t *)dhp + dhp->bLength);
+	}
+
+	return -ENOTSUP;
+}
+
+static int uac2_set_sample_rate(struct usbh_uac2_data *const data)
+{
+	const uint8_t bmRequestType = USB_REQTYPE_DIR_TO_DEVICE << 7 |
+				      USB_REQTYPE_TYPE_CLASS << 5 |
+				      USB_REQTYPE_RECIPIENT_INTERFACE;
+	struct net_buf *buf;
+	int ret;
+
+	buf = usbh_xfer_buf_alloc(data->udev, sizeof(uint32_t));
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	net_buf_add_le32(buf, data->cfg.sample_rate);
+	ret = usbh_req_setup(data->udev, bmRequestType, CUR,
+			     CS_SAM_FREQ_CONTROL << 8,
+			     (data->clock_id << 8) | data->ac_iface,
+			     sizeof(uint32_t), buf);
+	usbh_xfer_buf_free(data->udev, buf);
+
+	return ret;
+}
+
+static void uac2_rx_data(struct usbh_uac2_data *const data,
+			 const uint8_t *src, size_t len)
+{
+	const size_t block_size = data->cfg.block_size;
+	struct uac2_rx_block rx;
+	size_t chunk;
+
+	while (len) {
+		if (data->block == NULL &&
+		    k_mem_slab_alloc(data->cfg.mem_slab, &data->block, K_NO_WAIT)) {
+			data->block = NULL;
+			atomic_add(&data->dropped, len);
+			return;
+		}
+
+		chunk = MIN(len, block_size - data->block_len);
+		memcpy((uint8_t *)data->block + data->block_len, src, chunk);
+		data->block_len += chunk;
+		src += chunk;
+		len -= chunk;
+
+		if (data->block_len < block_size) {
+			break;
+		}
+
+		rx.mem = data->block;
+		rx.size = data->block_len;
+		if (k_msgq_put(&data->rx_queue, &rx, K_NO_WAIT)) {
+			k_mem_slab_free(data->cfg.mem_slab, data->block);
+			atomic_add(&data->dropped, data->block_len);
+		}
+
+		data->block = NULL;
+		data->block_len = 0;
+	}
+}
+
+/* Must be called with the lock held */
+static void uac2_xfer_release(struct usbh_uac2_data *const data,
+			      struct uhc_transfer *const xfer)
+{
+	for (int i = 0; i < ARRAY_SIZE(data->xfer_list); i++) {
+		if (data->xfer_list[i] == xfer) {
+			data->xfer_list[i] = NULL;
+		}
+	}
+
+	if (xfer->buf != NULL) {
+		uhc_xfer_buf_free(data->uhc_dev, xfer->buf);
+	}
+
+	uhc_xfer_free(data->uhc_dev, xfer);
+
+	if (atomic_dec(&data->xfers) == 1 && data->block != NULL) {
+		k_mem_slab_free(data->cfg.mem_slab, data->block);
+		data->block = NULL;
+		data->block_len = 0;
+	}
+}
+
+/* Isochronous IN transfer completion, called in the USB host thread */
+static int uac2_iso_in_cb(struct usb_device *const udev,
+			  struct uhc_transfer *const xfer)
+{
+	struct usbh_uac2_data *const data = xfer->priv;
+	struct net_buf *const buf = xfer->buf;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	if (!atomic_test_bit(&data->state, UAC2_STATE_STREAMING) || udev != data->udev) {
+		uac2_xfer_release(data, xfer);
+		k_mutex_unlock(&data->lock);
+		return 0;
+	}
+
+	if (xfer->err == 0) {
+		uac2_rx_data(data, buf->data, buf->len);
+	} else {
+		LOG_DBG("Transfer error %d", xfer->err);
+	}
+
+	/* Requeue the transfer right away, other transfers keep the endpoint busy */
+	net_buf_reset(buf);
+	if (usbh_xfer_enqueue(udev, xfer)) {
+		LOG_ERR("Failed to requeue isochronous transfer");
+		uac2_xfer_release(data, xfer);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return 0;
+}
+
+static int uac2_start_streaming(struct usbh_uac2_data *const data)
+{
+	struct uhc_transfer *xfer;
+	struct net_buf *buf;
+	int ret = 0;
+
+	/* Completions wait until all transfers are tracked */
+	k_mutex_lock(&data->lock, K_FOREVER);
+	atomic_set_bit(&data->state, UAC2_STATE_STREAMING);
+
+	for (int i = 0; i < CONFIG_USBH_UAC2_NUM_XFERS; i++) {
+		xfer = usbh_xfer_alloc(data->udev, data->ep, uac2_iso_in_cb, data);
+		if (xfer == NULL) {
+			ret = -ENOMEM;
+			goto error;
+		}
+
+		xfer->interval = data->interval;
+		buf = usbh_xfer_buf_alloc(data->udev, data->tpl);
+		if (buf == NULL) {
+			usbh_xfer_free(data->udev, xfer);
+			ret = -ENOMEM;
+			goto error;
+		}
+
+		ret = usbh_xfer_buf_add(data->udev, xfer, buf);
+		if (ret == 0) {
+			ret = usbh_xfer_enqueue(data->udev, xfer);
+		}
+
+		if (ret) {
+			usbh_xfer_buf_free(data->udev, buf);
+			usbh_xfer_free(data->udev, xfer);
+			goto error;
+		}
+
+		data->xfer_list[i] = xfer;
+		atomic_inc(&data->xfers);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return 0;
+
+error:
+	LOG_ERR("Failed to queue isochronous transfer %d", ret);
+	if (atomic_get(&data->xfers) != 0) {
+		/* Keep streaming with the transfers that are already queued */
+		ret = 0;
+	} else {
+		atomic_clear_bit(&data->state, UAC2_STATE_STREAMING);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+
+static int uac2_connected(struct usbh_contex *const uhs_ctx)
+{
+	struct usbh_uac2_data *const data = &uac2_data;
+	struct usb_device *const udev = uhs_ctx->root;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, UAC2_STATE_CONFIGURED)) {
+		LOG_WRN("Audio capture is not configured");
+		return -EPERM;
+	}
+
+	if (data->udev != NULL || atomic_get(&data->xfers) != 0) {
+		LOG_WRN("Audio capture is already running");
+		return -EBUSY;
+	}
+
+	ret = uac2_parse_cfg_desc(data, udev);
+	if (ret) {
+		LOG_ERR("No suitable AudioStreaming interface %d", ret);
+		return ret;
+	}
+
+	data->uhc_dev = uhs_ctx->dev;
+	data->udev = udev;
+
+	ret = usbh_device_interface_set(udev, data->as_iface, data->as_alt, false);
+	if (ret) {
+		LOG_ERR("Failed to select streaming interface alternate");
+		goto error;
+	}
+
+	if (data->cfg.sample_rate != 0) {
+		ret = uac2_set_sample_rate(data);
+		if (ret) {
+			LOG_ERR("Failed to set sample rate %u", data->cfg.sample_rate);
+			goto error;
+		}
+	}
+
+	ret = uac2_start_streaming(data);
+	if (ret == 0) {
+		return 0;
+	}
+
+error:
+	data->udev = NULL;
+
+	return ret;
+}
+
+static int uac2_removed(struct usbh_contex *const uhs_ctx)
+{
+	struct usbh_uac2_data *const data = &uac2_data;
+
+	if (data->udev == NULL || data->uhc_dev != uhs_ctx->dev) {
+		return 0;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	/*
+	 * Cancel the transfers while the device is still there, they are
+	 * released when they complete and are never requeued.
+	 */
+	atomic_clear_bit(&data->state, UAC2_STATE_STREAMING);
+	for (int i = 0; i < ARRAY_SIZE(data->xfer_list); i++) {
+		if (data->xfer_list[i] != NULL) {
+			(void)usbh_xfer_dequeue(data->udev, data->xfer_list[i]);
+		}
+	}
+
+	data->udev = NULL;
+	k_mutex_unlock(&data->lock);
+
+	LOG_INF("Audio capture stopped, %ld bytes dropped", atomic_get(&data->dropped));
+
+	return 0;
+}
+
+USBH_DEFINE_CLASS(uac2_class) = {
+	.code = {
+		.dclass = USB_BCC_AUDIO,
+		.sub = AUDIOSTREAMING,
+		.proto = IP_VERSION_02_00,
+	},
+	.connected = uac2_connected,
+	.removed = uac2_removed,
+};
+
+int usbh_uac2_configure(const struct usbh_uac2_cfg *cfg)
+{
+	struct usbh_uac2_data *const data = &uac2_data;
+
+	if (cfg == NULL || cfg->mem_slab == NULL || cfg->block_size == 0 ||
+	    cfg->block_size > cfg->mem_slab->info.block_size) {
+		return -EINVAL;
+	}
+
+	if (data->udev != NULL || atomic_get(&data->xfers) != 0) {
+		return -EBUSY;
+	}
+
+	data->cfg = *cfg;
+	atomic_set(&data->dropped, 0);
+	k_msgq_init(&data->rx_queue, uac2_rx_queue_buf,
+		    sizeof(struct uac2_rx_block), CONFIG_USBH_UAC2_RX_QUEUE_SIZE);
+	atomic_set_bit(&data->state, UAC2_STATE_CONFIGURED);
+
+	return 0;
+}
+
+int usbh_uac2_read(void **mem_block, size_t *size, k_timeout_t timeout)
+{
+	struct usbh_uac2_data *const data = &uac2_data;
+	struct uac2_rx_block rx;
+
+	if (!atomic_test_bit(&data->state, UAC2_STATE_CONFIGURED)) {
+		return -EIO;
+	}
+
+	if (!atomic_test_bit(&data->state, UAC2_STATE_STREAMING) &&
+	    k_msgq_num_used_get(&data->rx_queue) == 0) {
+		return -EIO;
+	}
+
+	if (k_msgq_get(&data->rx_queue, &rx, timeout)) {
+		return -EAGAIN;
+	}
+
+	*mem_block = rx.mem;
+	*size = rx.size;
+
+	return 0;
+}
+
+uint32_t usbh_uac2_dropped(void)
+{
+	return atomic_get(&uac2_data.dropped);
+}
@@ -43,6 +43,56 @@ static int usbh_event_carrier(const struct device *dev,
 	return err;
 }
 
+/* Test if the device or one of its interfaces matches the class code triple */
+static bool usbh_class_match(const struct usb_device *const udev,
+			     const struct usbh_code_triple *const code)
+{
+	const struct usb_if_descriptor *if_desc;
+
+	if (udev->dev_desc.bDeviceClass == code->dclass &&
+	    udev->dev_desc.bDeviceSubClass == code->sub &&
+	    udev->dev_desc.bDeviceProtocol == code->proto) {
+		return true;
+	}
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(udev->ifaces); i++) {
+		if_desc = (void *)udev->ifaces[i].dhp;
+		if (if_desc == NULL) {
+			break;
+		}
+
+		if (if_desc->bInterfaceClass == code->dclass &&
+		    if_desc->bInterfaceSubClass == code->sub &&
+		    if_desc->bInterfaceProtocol == code->proto) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void usbh_class_connected(struct usbh_contex *const ctx)
+{
+	STRUCT_SECTION_FOREACH(usbh_class_data, cdata) {
+		if (cdata->connected == NULL || !usbh_class_match(ctx->root, &cdata->code)) {
+			continue;
+		}
+
+		if (cdata->connected(ctx)) {
+			LOG_WRN("Class %p failed to handle connected device", (void *)cdata);
+		}
+	}
+}
+
+static void usbh_class_removed(struct usbh_contex *const ctx)
+{
+	STRUCT_SECTION_FOREACH(usbh_class_data, cdata) {
+		if (cdata->removed != NULL) {
+			cdata->removed(ctx);
+		}
+	}
+}
+
 static void dev_connected_handler(struct usbh_contex *const ctx,
 				  const struct uhc_event *const event)
 {
@@ -50,6 +100,7 @@ static void dev_connected_handler(struct usbh_contex *const ctx,
 	LOG_DBG("Device connected event");
 	if (ctx->root != NULL) {
 		LOG_ERR("Device already connected");
+		usbh_class_removed(ctx);
 		usbh_device_free(ctx->root);
 		ctx->root = NULL;
 	}
@@ -70,12 +121,16 @@ static void dev_connected_handler(struct usbh_contex *const ctx,
 
 	if (usbh_device_init(ctx->root)) {
 		LOG_ERR("Failed to reset new USB device");
+		return;
 	}
+
+	usbh_class_connected(ctx);
 }
 
 static void dev_removed_handler(struct usbh_contex *const ctx)
 {
 	if (ctx->root != NULL) {
+		usbh_class_removed(ctx);
 		usbh_device_free(ctx->root);
 		ctx->root = NULL;
 		LOG_DBG("Device removed");
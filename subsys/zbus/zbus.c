@@ -8,6 +8,7 @@
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -142,6 +143,8 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 			return -ENOMEM;
 		}
 
+		memcpy(net_buf_user_data(cloned_buf), &chan, sizeof(struct zbus_channel *));
+
 		k_fifo_put(obs->message_fifo, cloned_buf);
 
 		break;
@@ -154,7 +157,8 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	return 0;
 }
 
-static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t end_time)
+static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t end_time,
+				  struct net_buf *msg_buf)
 {
 	int err = 0;
 	int last_error = 0;
@@ -165,18 +169,26 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	struct zbus_channel_observation_mask *observation_mask;
 
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
-	struct net_buf_pool *pool =
-		COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
-			    (chan->data->msg_subscriber_pool), (&_zbus_msg_subscribers_pool));
+	if (msg_buf != NULL) {
+		/* Buffer channels hand out references to the published buffer itself */
+		buf = net_buf_ref(msg_buf);
+	} else {
+		struct net_buf_pool *pool =
+			COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
+				    (chan->data->msg_subscriber_pool), (&_zbus_msg_subscribers_pool));
 
-	buf = _zbus_create_net_buf(pool, zbus_chan_msg_size(chan), sys_timepoint_timeout(end_time));
+		buf = _zbus_create_net_buf(pool, zbus_chan_msg_size(chan),
+					   sys_timepoint_timeout(end_time));
 
-	_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
-				  "unavailable or heap is full");
+		_ZBUS_ASSERT(buf != NULL, "net_buf zbus_msg_subscribers_pool is "
+					  "unavailable or heap is full");
 
-	memcpy(net_buf_user_data(buf), &chan, sizeof(struct zbus_channel *));
+		memcpy(net_buf_user_data(buf), &chan, sizeof(struct zbus_channel *));
 
-	net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+		net_buf_add_mem(buf, zbus_chan_msg(chan), zbus_chan_msg_size(chan));
+	}
+#else
+	ARG_UNUSED(msg_buf);
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 	LOG_DBG("Notifing %s's observers. Starting VDED:", _ZBUS_CHAN_NAME(chan));
@@ -407,7 +419,7 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	memcpy(chan->message, msg, chan->message_size);
 
-	err = _zbus_vded_exec(chan, end_time);
+	err = _zbus_vded_exec(chan, end_time, NULL);
 
 	chan_unlock(chan, context_priority);
 
@@ -437,6 +449,160 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	return 0;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+static inline bool chan_has_observers(const struct zbus_channel *chan)
+{
+	if (chan->data->observers_start_idx < chan->data->observers_end_idx) {
+		return true;
+	}
+
+#if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS)
+	return !sys_slist_is_empty(&chan->data->observers);
+#else
+	return false;
+#endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
+}
+
+int zbus_chan_seq_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
+		return -ENOMSG;
+	}
+
+	/* Single writer, the counter is odd only while the message is being written */
+	atomic_inc(&chan->data->seq);
+	memcpy(chan->message, msg, chan->message_size);
+	atomic_inc(&chan->data->seq);
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	if (!chan_has_observers(chan)) {
+		return 0;
+	}
+
+	return zbus_chan_notify(chan, timeout);
+}
+
+int zbus_chan_seq_read(const struct zbus_channel *chan, void *msg)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	for (int i = 0; i < CONFIG_ZBUS_CHANNEL_SEQLOCK_READ_RETRIES; ++i) {
+		atomic_val_t seq = atomic_get(&chan->data->seq);
+
+		if (seq & 1) {
+			continue;
+		}
+
+		memcpy(msg, chan->message, chan->message_size);
+
+		/* The copy must complete before the counter is checked again */
+		barrier_dmem_fence_full();
+
+		if (atomic_get(&chan->data->seq) == seq) {
+			return 0;
+		}
+	}
+
+	return -EAGAIN;
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
+#if defined(CONFIG_ZBUS_BUF_CHANNEL)
+
+int zbus_chan_pub_buf(const struct zbus_channel *chan, struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf *prev_buf;
+	int err;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+	_ZBUS_ASSERT(chan->message_size == sizeof(struct net_buf *), "chan must be a buffer channel");
+	_ZBUS_ASSERT(!IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER) ||
+			     buf->user_data_size >= sizeof(struct zbus_channel *),
+		     "buf user data must hold a channel reference");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	if (chan->validator != NULL && !chan->validator(buf->data, buf->len)) {
+		net_buf_unref(buf);
+		return -ENOMSG;
+	}
+
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+
+	err = chan_lock(chan, timeout, &context_priority);
+	if (err) {
+		net_buf_unref(buf);
+		return err;
+	}
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	/* The channel takes over the publisher's reference */
+	prev_buf = *(struct net_buf **)chan->message;
+	*(struct net_buf **)chan->message = buf;
+
+	err = _zbus_vded_exec(chan, end_time, buf);
+
+	chan_unlock(chan, context_priority);
+
+	if (prev_buf != NULL) {
+		net_buf_unref(prev_buf);
+	}
+
+	return err;
+}
+
+int zbus_chan_read_buf(const struct zbus_channel *chan, struct net_buf **buf, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+	_ZBUS_ASSERT(chan->message_size == sizeof(struct net_buf *), "chan must be a buffer channel");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	int err = k_sem_take(&chan->data->sem, timeout);
+	if (err) {
+		return err;
+	}
+
+	*buf = *(struct net_buf **)chan->message;
+	if (*buf != NULL) {
+		net_buf_ref(*buf);
+	}
+
+	k_sem_give(&chan->data->sem);
+
+	return (*buf != NULL) ? 0 : -ENODATA;
+}
+
+#endif /* CONFIG_ZBUS_BUF_CHANNEL */
+
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	int err;
@@ -458,7 +624,7 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
-	err = _zbus_vded_exec(chan, end_time);
+	err = _zbus_vded_exec(chan, end_time, NULL);
 
 	chan_unlock(chan, context_priority);
 
@@ -533,6 +699,28 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 	return 0;
 }
 
+int zbus_sub_wait_buf(const struct zbus_observer *sub, const struct zbus_channel **chan,
+		      struct net_buf **buf, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_sub_wait_buf cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(sub->type == ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+		     "sub must be a MSG_SUBSCRIBER");
+	_ZBUS_ASSERT(sub->message_fifo != NULL, "sub message_fifo is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
+
+	*buf = k_fifo_get(sub->message_fifo, timeout);
+
+	if (*buf == NULL) {
+		return -ENOMSG;
+	}
+
+	*chan = *((struct zbus_channel **)net_buf_user_data(*buf));
+
+	return 0;
+}
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 int zbus_obs_set_chan_notification_mask(const struct zbus_observer *obs,
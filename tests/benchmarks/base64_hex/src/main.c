@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Times base64_encode(), base64_decode(), bin2hex() and hex2bin() over payloads from a short
+ * token to a certificate chain, and reports the throughput in KiB/s.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/base64.h>
+#include <zephyr/sys/util.h>
+
+#define MAX_SIZE   4096
+#define ITERATIONS 16
+
+static const size_t sizes[] = {32, 256, MAX_SIZE};
+
+static uint8_t bin[MAX_SIZE];
+static uint8_t text[2 * MAX_SIZE + 1];
+static uint8_t out[MAX_SIZE];
+
+static void report(const char *name, size_t size, timing_t start, timing_t end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(&start, &end)) / ITERATIONS;
+
+	TC_PRINT("%-14s %5zu bytes: %8llu ns, %8llu KiB/s\n", name, size, ns,
+		 (ns == 0U) ? 0ULL : (uint64_t)size * NSEC_PER_SEC / 1024U / ns);
+}
+
+static void bench_base64(size_t size)
+{
+	timing_t start;
+	timing_t end;
+	size_t text_len;
+	size_t len;
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_ok(base64_encode(text, sizeof(text), &text_len, bin, size));
+	}
+	end = timing_counter_get();
+	report("base64_encode", size, start, end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_ok(base64_decode(out, sizeof(out), &len, text, text_len));
+	}
+	end = timing_counter_get();
+	report("base64_decode", size, start, end);
+
+	zassert_equal(len, size);
+	zassert_mem_equal(out, bin, size);
+}
+
+static void bench_hex(size_t size)
+{
+	timing_t start;
+	timing_t end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_equal(bin2hex(bin, size, (char *)text, sizeof(text)), 2 * size);
+	}
+	end = timing_counter_get();
+	report("bin2hex", size, start, end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_equal(hex2bin((const char *)text, 2 * size, out, sizeof(out)), size);
+	}
+	end = timing_counter_get();
+	report("hex2bin", size, start, end);
+
+	zassert_mem_equal(out, bin, size);
+}
+
+/**
+ * @brief Measure the throughput of the base64 and hex conversions
+ *
+ * Times are per conversion, the throughput is of binary data.
+ */
+ZTEST(base64_hex, test_throughput)
+{
+	for (size_t i = 0; i < sizeof(bin); i++) {
+		bin[i] = (uint8_t)(i * 131 + 7);
+	}
+
+	timing_init();
+	timing_start();
+
+	ARRAY_FOR_EACH(sizes, s) {
+		bench_base64(sizes[s]);
+		bench_hex(sizes[s]);
+	}
+
+	timing_stop();
+}
+
+ZTEST_SUITE(base64_hex, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/btree.h>
+#include <zephyr/sys/rb.h>
+#include <zephyr/timing/timing.h>
+
+struct container_node {
+	struct rbnode rb;
+	struct btree_node bt;
+	uint32_t key;
+};
+
+static struct container_node nodes[CONFIG_BENCHMARK_BTREE_MAX_NODES];
+
+static const size_t sizes[] = {1000, 10000, 100000};
+
+static bool rb_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return CONTAINER_OF(a, struct container_node, rb)->key <
+	       CONTAINER_OF(b, struct container_node, rb)->key;
+}
+
+static bool bt_lessthan(struct btree_node *a, struct btree_node *b)
+{
+	return CONTAINER_OF(a, struct container_node, bt)->key <
+	       CONTAINER_OF(b, struct container_node, bt)->key;
+}
+
+/* Scramble the insertion order, keys are unique as the red/black tree cannot remove duplicates */
+static void init_nodes(size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		nodes[i].key = (uint32_t)i * 2654435761U;
+	}
+}
+
+static uint64_t ns_per_op(timing_t start, timing_t end, size_t ops)
+{
+	uint64_t cycles = timing_cycles_get(&start, &end);
+
+	return timing_cycles_to_ns(cycles) / ops;
+}
+
+static void measure_rb(size_t n)
+{
+	struct rbtree tree = {.lessthan_fn = rb_lessthan};
+	struct container_node *c;
+	struct rbnode *node;
+	timing_t start;
+	timing_t end;
+	uint64_t insert_ns;
+	uint64_t iter_ns;
+	uint64_t pop_ns;
+	uint32_t prev = 0U;
+	size_t count = 0;
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < n; i++) {
+		rb_insert(&tree, &nodes[i].rb);
+	}
+	end = timing_counter_get();
+	insert_ns = ns_per_op(start, end, n);
+
+	start = timing_counter_get();
+	RB_FOR_EACH_CONTAINER(&tree, c, rb) {
+		zassert_true(c->key >= prev, "rb: iteration out of order");
+		prev = c->key;
+		count++;
+	}
+	end = timing_counter_get();
+	iter_ns = ns_per_op(start, end, n);
+	zassert_equal(count, n, "rb: iteration missed nodes");
+
+	start = timing_counter_get();
+	while ((node = rb_get_min(&tree)) != NULL) {
+		rb_remove(&tree, node);
+	}
+	end = timing_counter_get();
+	pop_ns = ns_per_op(start, end, n);
+
+	TC_PRINT("rb    %6zu nodes: insert %5llu ns, iterate %5llu ns, pop min %5llu ns\n",
+		 n, insert_ns, iter_ns, pop_ns);
+}
+
+static void measure_btree(size_t n)
+{
+	struct btree tree = {.lessthan_fn = bt_lessthan};
+	struct container_node *c;
+	struct btree_node *node;
+	timing_t start;
+	timing_t end;
+	uint64_t insert_ns;
+	uint64_t iter_ns;
+	uint64_t pop_ns;
+	uint32_t prev = 0U;
+	size_t count = 0;
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < n; i++) {
+		btree_insert(&tree, &nodes[i].bt);
+	}
+	end = timing_counter_get();
+	insert_ns = ns_per_op(start, end, n);
+
+	start = timing_counter_get();
+	BTREE_FOR_EACH_CONTAINER(&tree, c, bt) {
+		zassert_true(c->key >= prev, "btree: iteration out of order");
+		prev = c->key;
+		count++;
+	}
+	end = timing_counter_get();
+	iter_ns = ns_per_op(start, end, n);
+	zassert_equal(count, n, "btree: iteration missed nodes");
+
+	start = timing_counter_get();
+	while ((node = btree_get_min(&tree)) != NULL) {
+		btree_remove(&tree, node);
+	}
+	end = timing_counter_get();
+	pop_ns = ns_per_op(start, end, n);
+
+	TC_PRINT("btree %6zu nodes: insert %5llu ns, iterate %5llu ns, pop min %5llu ns\n",
+		 n, insert_ns, iter_ns, pop_ns);
+}
+
+/**
+ * @brief Compare the red/black tree and the B+tree as priority queues
+ *
+ * Times are per node, for trees of increasing size. Popping the lowest node is what the
+ * scalable scheduler and wait queues do.
+ */
+ZTEST(btree_perf, test_rb_vs_btree)
+{
+	timing_init();
+	timing_start();
+
+	ARRAY_FOR_EACH(sizes, s) {
+		if (sizes[s] > CONFIG_BENCHMARK_BTREE_MAX_NODES) {
+			break;
+		}
+
+		init_nodes(sizes[s]);
+		measure_rb(sizes[s]);
+		measure_btree(sizes[s]);
+	}
+
+	timing_stop();
+}
+
+ZTEST_SUITE(btree_perf, NULL, NULL, NULL, NULL, NULL);
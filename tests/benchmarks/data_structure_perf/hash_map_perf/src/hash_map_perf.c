@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_lp.h>
+#include <zephyr/sys/hash_map_sc.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/timing/timing.h>
+#ifdef CONFIG_SYS_HASH_MAP_CXX
+#include <zephyr/sys/hash_map_cxx.h>
+#endif
+
+SYS_HASHMAP_SC_DEFINE_STATIC(map_sc);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(map_oa_lp);
+SYS_HASHMAP_SWISS_DEFINE_STATIC(map_swiss);
+#ifdef CONFIG_SYS_HASH_MAP_CXX
+SYS_HASHMAP_CXX_DEFINE_STATIC(map_cxx);
+#endif
+
+static const struct {
+	const char *name;
+	struct sys_hashmap *map;
+} backends[] = {
+	{"sc", &map_sc},
+	{"oa_lp", &map_oa_lp},
+	{"swiss", &map_swiss},
+#ifdef CONFIG_SYS_HASH_MAP_CXX
+	{"cxx", &map_cxx},
+#endif
+};
+
+static const size_t sizes[] = {1000, 10000, 100000};
+
+/* Spread the keys so that they do not hash into consecutive buckets */
+static inline uint64_t key_of(size_t i)
+{
+	return (uint64_t)i * 0x9e3779b97f4a7c15ULL;
+}
+
+static uint64_t ns_per_op(timing_t start, timing_t end, size_t ops)
+{
+	uint64_t cycles = timing_cycles_get(&start, &end);
+
+	return timing_cycles_to_ns(cycles) / ops;
+}
+
+static void measure(const char *name, struct sys_hashmap *map, size_t n)
+{
+	struct sys_hashmap_iterator it;
+	timing_t start;
+	timing_t end;
+	uint64_t value;
+	uint64_t sum = 0;
+	uint64_t insert_ns;
+	uint64_t get_ns;
+	uint64_t iter_ns;
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < n; i++) {
+		zassert_equal(sys_hashmap_insert(map, key_of(i), i, NULL), 1,
+			      "%s: insert %zu failed", name, i);
+	}
+	end = timing_counter_get();
+	insert_ns = ns_per_op(start, end, n);
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < n; i++) {
+		zassert_true(sys_hashmap_get(map, key_of(i), &value));
+		sum += value;
+	}
+	end = timing_counter_get();
+	get_ns = ns_per_op(start, end, n);
+
+	start = timing_counter_get();
+	for (map->api->iter(map, &it); sys_hashmap_iterator_has_next(&it);) {
+		it.next(&it);
+		sum -= it.value;
+	}
+	end = timing_counter_get();
+	iter_ns = ns_per_op(start, end, n);
+
+	zassert_equal(sum, 0, "%s: iteration missed entries", name);
+
+	TC_PRINT("%-6s %6zu entries: insert %5llu ns, lookup %5llu ns, iterate %5llu ns\n",
+		 name, n, insert_ns, get_ns, iter_ns);
+
+	sys_hashmap_clear(map, NULL, NULL);
+}
+
+/**
+ * @brief Measure the insertion, lookup and iteration of each Hashmap backend
+ *
+ * Times are per entry, averaged over maps of increasing size.
+ */
+ZTEST(hash_map_perf, test_backends)
+{
+	timing_init();
+	timing_start();
+
+	ARRAY_FOR_EACH(sizes, s) {
+		if (sizes[s] > CONFIG_BENCHMARK_HASH_MAP_MAX_ENTRIES) {
+			break;
+		}
+
+		ARRAY_FOR_EACH(backends, b) {
+			measure(backends[b].name, backends[b].map, sizes[s]);
+		}
+	}
+
+	timing_stop();
+}
+
+ZTEST_SUITE(hash_map_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Times every zdsp kernel of the selected backend over a range of block sizes and reports the
+ * cost in cycles per sample. The filtering and support kernels are also timed through the
+ * portable implementations so backends can be compared against the fallback on the same SoC.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/dsp/dsp.h>
+#include <zdsp_portable.h>
+
+#if defined(CONFIG_DSP_BACKEND_CMSIS)
+#define BACKEND_NAME "cmsis"
+#elif defined(CONFIG_DSP_BACKEND_ARCMWDT)
+#define BACKEND_NAME "arcmwdt"
+#else
+#define BACKEND_NAME "custom"
+#endif
+
+#define MAX_BLOCK_SIZE 256
+#define ITERATIONS     16
+#define FIR_TAPS       32
+#define BIQUAD_STAGES  4
+#define CHANNELS       2
+
+static const uint32_t block_sizes[] = {16, 64, MAX_BLOCK_SIZE};
+
+/* Room for CHANNELS channels of MAX_BLOCK_SIZE 32-bit samples */
+static DSP_STATIC_DATA uint32_t int_a[CHANNELS * MAX_BLOCK_SIZE] __aligned(8);
+static DSP_STATIC_DATA uint32_t int_b[CHANNELS * MAX_BLOCK_SIZE] __aligned(8);
+static DSP_STATIC_DATA float32_t flt_a[CHANNELS * MAX_BLOCK_SIZE] __aligned(8);
+static DSP_STATIC_DATA float32_t flt_b[CHANNELS * MAX_BLOCK_SIZE] __aligned(8);
+static DSP_STATIC_DATA uint32_t dst[CHANNELS * MAX_BLOCK_SIZE] __aligned(8);
+static DSP_STATIC_DATA q63_t result;
+
+static DSP_STATIC_DATA q15_t fir_state_q15[FIR_TAPS + MAX_BLOCK_SIZE - 1];
+static DSP_STATIC_DATA q31_t fir_state_q31[FIR_TAPS + MAX_BLOCK_SIZE - 1];
+static DSP_STATIC_DATA float32_t fir_state_f32[FIR_TAPS + MAX_BLOCK_SIZE - 1];
+static DSP_STATIC_DATA q15_t fir_coeffs_q15[FIR_TAPS];
+static DSP_STATIC_DATA q31_t fir_coeffs_q31[FIR_TAPS];
+static DSP_STATIC_DATA float32_t fir_coeffs_f32[FIR_TAPS];
+
+static DSP_STATIC_DATA q15_t biquad_state_q15[4 * BIQUAD_STAGES];
+static DSP_STATIC_DATA q31_t biquad_state_q31[4 * BIQUAD_STAGES];
+static DSP_STATIC_DATA float32_t biquad_state_f32[4 * BIQUAD_STAGES];
+static DSP_STATIC_DATA q15_t biquad_coeffs_q15[6 * BIQUAD_STAGES];
+static DSP_STATIC_DATA q31_t biquad_coeffs_q31[5 * BIQUAD_STAGES];
+static DSP_STATIC_DATA float32_t biquad_coeffs_f32[5 * BIQUAD_STAGES];
+
+static struct zdsp_fir_q15 fir_q15;
+static struct zdsp_fir_q31 fir_q31;
+static struct zdsp_fir_f32 fir_f32;
+static struct zdsp_biquad_q15 biquad_q15;
+static struct zdsp_biquad_q31 biquad_q31;
+static struct zdsp_biquad_f32 biquad_f32;
+
+struct bench_kernel {
+	const char *name;
+	void (*run)(uint32_t block_size);
+};
+
+#define SRC_A(_type) ((const DSP_DATA _type *)int_a)
+#define SRC_B(_type) ((const DSP_DATA _type *)int_b)
+#define DST(_type)   ((DSP_DATA _type *)dst)
+
+#define BENCH_BINARY(_name, _type)                                                                 \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(SRC_A(_type), SRC_B(_type), DST(_type), n);                           \
+	}
+
+#define BENCH_BINARY_F32(_name)                                                                    \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(flt_a, flt_b, DST(float32_t), n);                                     \
+	}
+
+#define BENCH_UNARY(_name, _type)                                                                  \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(SRC_A(_type), DST(_type), n);                                         \
+	}
+
+#define BENCH_UNARY_F32(_name)                                                                     \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(flt_a, DST(float32_t), n);                                            \
+	}
+
+#define BENCH_SCALAR(_name, _type, _value)                                                         \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(SRC_A(_type), _value, DST(_type), n);                                 \
+	}
+
+#define BENCH_SCALAR_F32(_name, _value)                                                            \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(flt_a, _value, DST(float32_t), n);                                    \
+	}
+
+#define BENCH_SCALE(_name, _type, _fract)                                                          \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(SRC_A(_type), _fract, 1, DST(_type), n);                              \
+	}
+
+#define BENCH_DOT_PROD(_name, _type, _result_type)                                                 \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(SRC_A(_type), SRC_B(_type), n, (DSP_DATA _result_type *)&result);     \
+	}
+
+#define BENCH_CLIP(_name, _type, _low, _high)                                                      \
+	static void bench_##_name(uint32_t n)                                                      \
+	{                                                                                          \
+		zdsp_##_name(SRC_A(_type), DST(_type), _low, _high, n);                            \
+	}
+
+#define BENCH_FILTER(_prefix, _name, _inst, _type)                                                 \
+	static void bench_##_prefix##_name(uint32_t n)                                             \
+	{                                                                                          \
+		_prefix##_name(&_inst, SRC_A(_type), DST(_type), n);                               \
+	}
+
+#define BENCH_FILTER_F32(_prefix, _name, _inst)                                                    \
+	static void bench_##_prefix##_name(uint32_t n)                                             \
+	{                                                                                          \
+		_prefix##_name(&_inst, flt_a, DST(float32_t), n);                                  \
+	}
+
+#define BENCH_CONVERT(_prefix, _name, _src, _dst_type)                                             \
+	static void bench_##_prefix##_name(uint32_t n)                                             \
+	{                                                                                          \
+		_prefix##_name(_src, DST(_dst_type), n);                                           \
+	}
+
+#define BENCH_INTERLEAVE(_prefix, _type)                                                           \
+	static void bench_##_prefix##interleave_##_type(uint32_t n)                                \
+	{                                                                                          \
+		const DSP_DATA _type##_t *src[CHANNELS] = {                                        \
+			SRC_A(_type##_t), SRC_A(_type##_t) + MAX_BLOCK_SIZE};                      \
+                                                                                                   \
+		_prefix##interleave_##_type(src, CHANNELS, DST(_type##_t), n / CHANNELS);         \
+	}                                                                                          \
+	static void bench_##_prefix##deinterleave_##_type(uint32_t n)                              \
+	{                                                                                          \
+		DSP_DATA _type##_t *const out[CHANNELS] = {DST(_type##_t),                         \
+							   DST(_type##_t) + MAX_BLOCK_SIZE};       \
+                                                                                                   \
+		_prefix##deinterleave_##_type(SRC_A(_type##_t), CHANNELS, out, n / CHANNELS);     \
+	}
+
+#define KERNEL(_name) {.name = #_name, .run = bench_##_name}
+
+BENCH_BINARY(mult_q7, q7_t)
+BENCH_BINARY(mult_q15, q15_t)
+BENCH_BINARY(mult_q31, q31_t)
+BENCH_BINARY_F32(mult_f32)
+BENCH_BINARY(add_q7, q7_t)
+BENCH_BINARY(add_q15, q15_t)
+BENCH_BINARY(add_q31, q31_t)
+BENCH_BINARY_F32(add_f32)
+BENCH_BINARY(sub_q7, q7_t)
+BENCH_BINARY(sub_q15, q15_t)
+BENCH_BINARY(sub_q31, q31_t)
+BENCH_BINARY_F32(sub_f32)
+BENCH_SCALE(scale_q7, q7_t, 0x40)
+BENCH_SCALE(scale_q15, q15_t, 0x4000)
+BENCH_SCALE(scale_q31, q31_t, 0x40000000)
+BENCH_SCALAR_F32(scale_f32, 0.5f)
+BENCH_UNARY(abs_q7, q7_t)
+BENCH_UNARY(abs_q15, q15_t)
+BENCH_UNARY(abs_q31, q31_t)
+BENCH_UNARY_F32(abs_f32)
+BENCH_UNARY(negate_q7, q7_t)
+BENCH_UNARY(negate_q15, q15_t)
+BENCH_UNARY(negate_q31, q31_t)
+BENCH_UNARY_F32(negate_f32)
+BENCH_SCALAR(offset_q7, q7_t, 0x10)
+BENCH_SCALAR(offset_q15, q15_t, 0x1000)
+BENCH_SCALAR(offset_q31, q31_t, 0x10000000)
+BENCH_SCALAR_F32(offset_f32, 0.125f)
+BENCH_SCALAR(shift_q7, q7_t, 1)
+BENCH_SCALAR(shift_q15, q15_t, 1)
+BENCH_SCALAR(shift_q31, q31_t, 1)
+BENCH_DOT_PROD(dot_prod_q7, q7_t, q31_t)
+BENCH_DOT_PROD(dot_prod_q15, q15_t, q63_t)
+BENCH_DOT_PROD(dot_prod_q31, q31_t, q63_t)
+static void bench_dot_prod_f32(uint32_t n)
+{
+	zdsp_dot_prod_f32(flt_a, flt_b, n, (DSP_DATA float32_t *)&result);
+}
+BENCH_CLIP(clip_q7, q7_t, -0x40, 0x40)
+BENCH_CLIP(clip_q15, q15_t, -0x4000, 0x4000)
+BENCH_CLIP(clip_q31, q31_t, -0x40000000, 0x40000000)
+static void bench_clip_f32(uint32_t n)
+{
+	zdsp_clip_f32(flt_a, DST(float32_t), -0.25f, 0.25f, n);
+}
+BENCH_BINARY(and_u8, uint8_t)
+BENCH_BINARY(and_u16, uint16_t)
+BENCH_BINARY(and_u32, uint32_t)
+BENCH_BINARY(or_u8, uint8_t)
+BENCH_BINARY(or_u16, uint16_t)
+BENCH_BINARY(or_u32, uint32_t)
+BENCH_BINARY(xor_u8, uint8_t)
+BENCH_BINARY(xor_u16, uint16_t)
+BENCH_BINARY(xor_u32, uint32_t)
+BENCH_UNARY(not_u8, uint8_t)
+BENCH_UNARY(not_u16, uint16_t)
+BENCH_UNARY(not_u32, uint32_t)
+
+static const struct bench_kernel basicmath_kernels[] = {
+	KERNEL(mult_q7), KERNEL(mult_q15), KERNEL(mult_q31), KERNEL(mult_f32), KERNEL(add_q7),
+	KERNEL(add_q15), KERNEL(add_q31), KERNEL(add_f32), KERNEL(sub_q7), KERNEL(sub_q15),
+	KERNEL(sub_q31), KERNEL(sub_f32), KERNEL(scale_q7), KERNEL(scale_q15), KERNEL(scale_q31),
+	KERNEL(scale_f32), KERNEL(abs_q7), KERNEL(abs_q15), KERNEL(abs_q31), KERNEL(abs_f32),
+	KERNEL(negate_q7), KERNEL(negate_q15), KERNEL(negate_q31), KERNEL(negate_f32),
+	KERNEL(offset_q7), KERNEL(offset_q15), KERNEL(offset_q31), KERNEL(offset_f32),
+	KERNEL(shift_q7), KERNEL(shift_q15), KERNEL(shift_q31), KERNEL(dot_prod_q7),
+	KERNEL(dot_prod_q15), KERNEL(dot_prod_q31), KERNEL(dot_prod_f32), KERNEL(clip_q7),
+	KERNEL(clip_q15), KERNEL(clip_q31), KERNEL(clip_f32), KERNEL(and_u8), KERNEL(and_u16),
+	KERNEL(and_u32), KERNEL(or_u8), KERNEL(or_u16), KERNEL(or_u32), KERNEL(xor_u8),
+	KERNEL(xor_u16), KERNEL(xor_u32), KERNEL(not_u8), KERNEL(not_u16), KERNEL(not_u32),
+};
+
+/* Filtering and support kernels, through the backend and through the portable fallback */
+#define BENCH_FILTERING_SUPPORT(_prefix)                                                           \
+	BENCH_FILTER(_prefix, fir_q15, fir_q15, q15_t)                                             \
+	BENCH_FILTER(_prefix, fir_q31, fir_q31, q31_t)                                             \
+	BENCH_FILTER_F32(_prefix, fir_f32, fir_f32)                                                \
+	BENCH_FILTER(_prefix, biquad_q15, biquad_q15, q15_t)                                       \
+	BENCH_FILTER(_prefix, biquad_q31, biquad_q31, q31_t)                                       \
+	BENCH_FILTER_F32(_prefix, biquad_f32, biquad_f32)                                          \
+	BENCH_CONVERT(_prefix, q15_to_q31, SRC_A(q15_t), q31_t)                                    \
+	BENCH_CONVERT(_prefix, q31_to_q15, SRC_A(q31_t), q15_t)                                    \
+	BENCH_CONVERT(_prefix, q15_to_f32, SRC_A(q15_t), float32_t)                                \
+	BENCH_CONVERT(_prefix, f32_to_q15, flt_a, q15_t)                                           \
+	BENCH_CONVERT(_prefix, q31_to_f32, SRC_A(q31_t), float32_t)                                \
+	BENCH_CONVERT(_prefix, f32_to_q31, flt_a, q31_t)                                           \
+	BENCH_CONVERT(_prefix, s24_to_q31, SRC_A(uint8_t), q31_t)                                  \
+	BENCH_CONVERT(_prefix, q31_to_s24, SRC_A(q31_t), uint8_t)                                  \
+	BENCH_INTERLEAVE(_prefix, q15)                                                             \
+	BENCH_INTERLEAVE(_prefix, q31)
+
+#define FILTERING_SUPPORT_KERNELS(_prefix)                                                         \
+	KERNEL(_prefix##fir_q15), KERNEL(_prefix##fir_q31), KERNEL(_prefix##fir_f32),              \
+	KERNEL(_prefix##biquad_q15), KERNEL(_prefix##biquad_q31), KERNEL(_prefix##biquad_f32),     \
+	KERNEL(_prefix##q15_to_q31), KERNEL(_prefix##q31_to_q15), KERNEL(_prefix##q15_to_f32),     \
+	KERNEL(_prefix##f32_to_q15), KERNEL(_prefix##q31_to_f32), KERNEL(_prefix##f32_to_q31),     \
+	KERNEL(_prefix##s24_to_q31), KERNEL(_prefix##q31_to_s24),                                  \
+	KERNEL(_prefix##interleave_q15), KERNEL(_prefix##deinterleave_q15),                        \
+	KERNEL(_prefix##interleave_q31), KERNEL(_prefix##deinterleave_q31)
+
+BENCH_FILTERING_SUPPORT(zdsp_)
+BENCH_FILTERING_SUPPORT(zdsp_portable_)
+
+static const struct bench_kernel filtering_support_kernels[] = {
+	FILTERING_SUPPORT_KERNELS(zdsp_),
+	FILTERING_SUPPORT_KERNELS(zdsp_portable_),
+};
+
+static void bench_run(const struct bench_kernel *kernels, size_t num_kernels)
+{
+	for (size_t k = 0; k < num_kernels; k++) {
+		for (size_t i = 0; i < ARRAY_SIZE(block_sizes); i++) {
+			uint32_t block_size = block_sizes[i];
+			timing_t start, end;
+			uint64_t cycles;
+			uint32_t key;
+
+			/* Warm up the caches and branch predictors */
+			kernels[k].run(block_size);
+
+			key = irq_lock();
+			start = timing_counter_get();
+			for (int n = 0; n < ITERATIONS; n++) {
+				kernels[k].run(block_size);
+			}
+			end = timing_counter_get();
+			irq_unlock(key);
+
+			/* Cycles per sample, in hundredths */
+			cycles = timing_cycles_get(&start, &end) * 100U /
+				 ((uint64_t)ITERATIONS * block_size);
+
+			TC_PRINT("DSP: %s %s %u: %u.%02u cycles/sample\n", BACKEND_NAME,
+				 kernels[k].name, block_size, (uint32_t)(cycles / 100U),
+				 (uint32_t)(cycles % 100U));
+		}
+	}
+}
+
+ZTEST(dsp_benchmark, test_basicmath)
+{
+	bench_run(basicmath_kernels, ARRAY_SIZE(basicmath_kernels));
+}
+
+ZTEST(dsp_benchmark, test_filtering_support)
+{
+	bench_run(filtering_support_kernels, ARRAY_SIZE(filtering_support_kernels));
+}
+
+static void *dsp_benchmark_setup(void)
+{
+	uint32_t seed = 0x12345678U;
+
+	/* Full scale noise for the fixed-point kernels, [-0.5 0.5) for floating-point */
+	for (size_t i = 0; i < ARRAY_SIZE(int_a); i++) {
+		seed = seed * 1664525U + 1013904223U;
+		int_a[i] = seed;
+		flt_a[i] = (float32_t)(int32_t)seed / 4294967296.0f;
+		seed = seed * 1664525U + 1013904223U;
+		int_b[i] = seed;
+		flt_b[i] = (float32_t)(int32_t)seed / 4294967296.0f;
+	}
+
+	for (size_t i = 0; i < FIR_TAPS; i++) {
+		fir_coeffs_q15[i] = INT16_MAX / FIR_TAPS;
+		fir_coeffs_q31[i] = INT32_MAX / FIR_TAPS;
+		fir_coeffs_f32[i] = 1.0f / FIR_TAPS;
+	}
+
+	/* Stable second order sections, b = {0.2, 0.4, 0.2}, a = {0.5, -0.3} */
+	for (size_t s = 0; s < BIQUAD_STAGES; s++) {
+		q15_t *c15 = &biquad_coeffs_q15[6 * s];
+		q31_t *c31 = &biquad_coeffs_q31[5 * s];
+		float32_t *cf = &biquad_coeffs_f32[5 * s];
+
+		c15[0] = 0x1999;
+		c15[1] = 0;
+		c15[2] = 0x3333;
+		c15[3] = 0x1999;
+		c15[4] = 0x4000;
+		c15[5] = -0x2666;
+
+		c31[0] = 0x19999999;
+		c31[1] = 0x33333333;
+		c31[2] = 0x19999999;
+		c31[3] = 0x40000000;
+		c31[4] = -0x26666666;
+
+		cf[0] = 0.2f;
+		cf[1] = 0.4f;
+		cf[2] = 0.2f;
+		cf[3] = 0.5f;
+		cf[4] = -0.3f;
+	}
+
+	zdsp_fir_init_q15(&fir_q15, FIR_TAPS, fir_coeffs_q15, fir_state_q15, MAX_BLOCK_SIZE);
+	zdsp_fir_init_q31(&fir_q31, FIR_TAPS, fir_coeffs_q31, fir_state_q31, MAX_BLOCK_SIZE);
+	zdsp_fir_init_f32(&fir_f32, FIR_TAPS, fir_coeffs_f32, fir_state_f32, MAX_BLOCK_SIZE);
+	zdsp_biquad_init_q15(&biquad_q15, BIQUAD_STAGES, biquad_coeffs_q15, biquad_state_q15, 0);
+	zdsp_biquad_init_q31(&biquad_q31, BIQUAD_STAGES, biquad_coeffs_q31, biquad_state_q31, 0);
+	zdsp_biquad_init_f32(&biquad_f32, BIQUAD_STAGES, biquad_coeffs_f32, biquad_state_f32);
+
+	timing_init();
+	timing_start();
+
+	TC_PRINT("DSP backend: %s, %u iterations per measurement\n", BACKEND_NAME, ITERATIONS);
+
+	return NULL;
+}
+
+static void dsp_benchmark_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timing_stop();
+}
+
+ZTEST_SUITE(dsp_benchmark, NULL, dsp_benchmark_setup, NULL, NULL, dsp_benchmark_teardown);
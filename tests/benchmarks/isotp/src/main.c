@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measures the ISO-TP throughput with the CAN controller in loopback mode, for classic CAN and
+ * CAN FD frames. The receiver grants the whole transfer in one flow control frame (block size 0,
+ * STmin 0), so the throughput only depends on how fast the sender queues consecutive frames,
+ * which is set by CONFIG_ISOTP_TX_WINDOW.
+ */
+
+#include <zephyr/canbus/isotp.h>
+#include <zephyr/drivers/can.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#define LEN    CONFIG_BENCHMARK_ISOTP_LEN
+#define ROUNDS CONFIG_BENCHMARK_ISOTP_ROUNDS
+
+static const struct device *const can_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_canbus));
+
+static const struct isotp_fc_opts fc_opts = {
+	.bs = 0,
+	.stmin = 0,
+};
+
+static struct isotp_recv_ctx recv_ctx;
+static struct isotp_send_ctx send_ctx;
+static uint8_t tx_data[LEN];
+static uint8_t rx_data[LEN];
+
+static K_SEM_DEFINE(send_done, 0, 1);
+static int send_result;
+
+static void send_complete(int error_nr, void *arg)
+{
+	ARG_UNUSED(arg);
+
+	send_result = error_nr;
+	k_sem_give(&send_done);
+}
+
+static void bench_transfer(const char *name, uint8_t flags, uint8_t dl)
+{
+	const struct isotp_msg_id data_addr = {
+		.std_id = 0x10,
+		.dl = dl,
+		.flags = flags,
+	};
+	const struct isotp_msg_id fc_addr = {
+		.std_id = 0x11,
+		.dl = dl,
+		.flags = flags,
+	};
+	timing_t start;
+	timing_t end;
+	uint64_t ns = 0;
+	int ret;
+
+	ret = isotp_bind(&recv_ctx, can_dev, &data_addr, &fc_addr, &fc_opts, K_NO_WAIT);
+	zassert_equal(ret, ISOTP_N_OK, "bind failed (%d)", ret);
+
+	for (int i = 0; i < ROUNDS; i++) {
+		size_t received = 0;
+
+		memset(rx_data, 0, sizeof(rx_data));
+
+		start = timing_counter_get();
+
+		ret = isotp_send(&send_ctx, can_dev, tx_data, LEN, &data_addr, &fc_addr,
+				 send_complete, NULL);
+		zassert_equal(ret, ISOTP_N_OK, "send failed (%d)", ret);
+
+		while (received < LEN) {
+			ret = isotp_recv(&recv_ctx, &rx_data[received], LEN - received,
+					 K_MSEC(1000));
+			zassert_true(ret > 0, "recv failed (%d)", ret);
+			received += ret;
+		}
+
+		zassert_equal(k_sem_take(&send_done, K_MSEC(1000)), 0, "send not completed");
+		zassert_equal(send_result, ISOTP_N_OK, "send failed (%d)", send_result);
+
+		end = timing_counter_get();
+
+		ns += timing_cycles_to_ns(timing_cycles_get(&start, &end));
+		zassert_mem_equal(rx_data, tx_data, LEN, "received data differ");
+	}
+
+	isotp_unbind(&recv_ctx);
+
+	TC_PRINT("%-6s DL %2u, window %2d: %6llu us per %d bytes, %6llu kB/s\n", name, dl,
+		 CONFIG_ISOTP_TX_WINDOW, (unsigned long long)(ns / ROUNDS / NSEC_PER_USEC), LEN,
+		 (unsigned long long)((uint64_t)LEN * ROUNDS * NSEC_PER_MSEC / MAX(ns, 1)));
+}
+
+ZTEST(isotp_benchmark, test_classic)
+{
+	bench_transfer("CAN", 0, 8);
+}
+
+ZTEST(isotp_benchmark, test_fd)
+{
+	can_mode_t cap;
+
+	zassert_equal(can_get_capabilities(can_dev, &cap), 0);
+	if ((cap & CAN_MODE_FD) == 0) {
+		ztest_test_skip();
+	}
+
+	bench_transfer("CAN FD", ISOTP_MSG_FDF | ISOTP_MSG_BRS, 64);
+}
+
+static void *isotp_benchmark_setup(void)
+{
+	can_mode_t mode = CAN_MODE_LOOPBACK;
+	can_mode_t cap;
+	int ret;
+
+	zassert_true(device_is_ready(can_dev), "CAN device not ready");
+
+	for (size_t i = 0; i < sizeof(tx_data); i++) {
+		tx_data[i] = (uint8_t)(i * 7U + (i >> 8));
+	}
+
+	if (can_get_capabilities(can_dev, &cap) == 0 && (cap & CAN_MODE_FD) != 0) {
+		mode |= CAN_MODE_FD;
+	}
+
+	ret = can_set_mode(can_dev, mode);
+	zassert_equal(ret, 0, "Configuring loopback mode failed (%d)", ret);
+
+	ret = can_start(can_dev);
+	zassert_equal(ret, 0, "Failed to start CAN controller (%d)", ret);
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(isotp_benchmark, NULL, isotp_benchmark_setup, NULL, NULL, NULL);
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2012-2015 Wind River Systems, Inc.
  * Copyright (c) 2023,2024 Intel Corporation.
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -66,6 +67,18 @@ extern int condvar_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 extern int stack_ops(uint32_t num_iterations, uint32_t options);
 extern int stack_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			       uint32_t alt_options);
+extern int mutex_blocking_ops(uint32_t num_iterations, uint32_t start_options,
+			      uint32_t alt_options);
+extern int msgq_ops(uint32_t num_iterations, uint32_t options);
+extern int msgq_blocking_ops(uint32_t num_iterations, uint32_t start_options,
+			     uint32_t alt_options);
+extern int pipe_ops(uint32_t num_iterations, uint32_t options);
+extern int pipe_blocking_ops(uint32_t num_iterations, uint32_t start_options,
+			     uint32_t alt_options);
+extern int poll_ops(uint32_t num_iterations);
+extern int poll_blocking_ops(uint32_t num_iterations);
+extern int work_ops(uint32_t num_iterations);
+extern int timer_ops(uint32_t num_iterations, uint32_t options);
 extern void heap_malloc_free(void);
 
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
@@ -201,6 +214,47 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
 #endif
 
+	mutex_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, 0);
+#ifdef CONFIG_USERSPACE
+	mutex_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, K_USER);
+	mutex_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, 0);
+	mutex_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, K_USER);
+#endif
+
+	msgq_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
+#ifdef CONFIG_USERSPACE
+	msgq_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
+	msgq_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, 0);
+#ifdef CONFIG_USERSPACE
+	msgq_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, K_USER);
+	msgq_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, 0);
+	msgq_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, K_USER);
+#endif
+
+	pipe_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
+#ifdef CONFIG_USERSPACE
+	pipe_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
+	pipe_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, 0);
+#ifdef CONFIG_USERSPACE
+	pipe_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0, K_USER);
+	pipe_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, 0);
+	pipe_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, K_USER);
+#endif
+
+	poll_ops(CONFIG_BENCHMARK_NUM_ITERATIONS);
+	poll_blocking_ops(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	work_ops(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	timer_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
+#ifdef CONFIG_USERSPACE
+	timer_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
 	heap_malloc_free();
 
 	TC_END_REPORT(error_count);
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for various message queue operations
+ *
+ * This file contains the tests that measures the times for the following
+ * message queue operations from both kernel threads and user threads:
+ *  1. Immediately adding a message to a message queue
+ *  2. Immediately removing a message from a message queue
+ *  3. Blocking on removing a message from a message queue
+ *  4. Waking (and context switching to) a thread blocked on a message queue
+ *     via k_msgq_put().
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+K_MSGQ_DEFINE(bench_msgq, sizeof(uint32_t), 1, sizeof(uint32_t));
+
+BENCH_BMEM uint32_t msgq_data;
+
+static void msgq_put_get_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+	uint64_t put_sum = 0ULL;
+	uint64_t get_sum = 0ULL;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+
+		k_msgq_put(&bench_msgq, &msgq_data, K_NO_WAIT);
+
+		mid = timing_timestamp_get();
+
+		k_msgq_get(&bench_msgq, &msgq_data, K_NO_WAIT);
+
+		finish = timing_timestamp_get();
+
+		put_sum += timing_cycles_get(&start, &mid);
+		get_sum += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = put_sum;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = get_sum;
+}
+
+int msgq_ops(uint32_t num_iterations, uint32_t options)
+{
+	int      priority;
+	uint64_t cycles;
+	char     tag[50];
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			msgq_put_get_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &pause_sem, &bench_msgq);
+
+	k_thread_start(&start_thread);
+
+	snprintf(tag, sizeof(tag),
+		 "msgq.put.immediate.%s",
+		 options & K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Add data to message queue (no ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(options, options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag),
+		 "msgq.get.immediate.%s",
+		 options & K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Get data from message queue (no ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(options, options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
+
+static void alt_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  mid;
+	timing_t  finish;
+	uint64_t  sum[2] = {0ULL, 0ULL};
+	uint32_t  data;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 1. Block waiting for a message */
+
+		start = timing_timestamp_get();
+
+		k_msgq_get(&bench_msgq, &data, K_FOREVER);
+
+		/* 3. Message obtained */
+
+		finish = timing_timestamp_get();
+
+		mid = timestamp.sample;
+
+		sum[0] += timing_cycles_get(&start, &mid);
+		sum[1] += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = sum[0];
+	k_sem_take(&pause_sem, K_FOREVER);
+	timestamp.cycles = sum[1];
+}
+
+static void start_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_thread_start(&alt_thread);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 2. Add a message thereby waking alt thread */
+
+		timestamp.sample = timing_timestamp_get();
+
+		k_msgq_put(&bench_msgq, &msgq_data, K_FOREVER);
+	}
+
+	k_thread_join(&alt_thread, K_FOREVER);
+}
+
+int msgq_blocking_ops(uint32_t num_iterations, uint32_t start_options,
+		      uint32_t alt_options)
+{
+	int      priority;
+	uint64_t cycles;
+	char     tag[50];
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, start_options, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			alt_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 2, alt_options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &alt_thread, &pause_sem, &bench_msgq);
+	k_thread_access_grant(&alt_thread, &pause_sem, &bench_msgq);
+
+	k_thread_start(&start_thread);
+
+	snprintf(tag, sizeof(tag),
+		 "msgq.get.blocking.%s_to_%s",
+		 alt_options & K_USER ? "u" : "k",
+		 start_options & K_USER ? "u" : "k");
+	snprintf(description, sizeof(description),
+		 "%-40s - Get data from message queue (w/ ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(start_options, alt_options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag),
+		 "msgq.put.wake+ctx.%s_to_%s",
+		 start_options & K_USER ? "u" : "k",
+		 alt_options & K_USER ? "u" : "k");
+	snprintf(description, sizeof(description),
+		 "%-40s - Add data to message queue (w/ ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(start_options, alt_options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
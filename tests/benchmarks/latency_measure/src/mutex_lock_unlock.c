@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2012-2015 Wind River Systems, Inc.
  * Copyright (c) 2020,2023 Intel Corporation
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -8,8 +9,13 @@
 /*
  * @file measure time for mutex lock and unlock
  *
- * This file contains the test that measures mutex lock and unlock times
- * in the kernel. There is no contention on the mutex being tested.
+ * This file contains the tests that measure mutex lock and unlock times
+ * in the kernel:
+ *  1. Recursively locking and unlocking a mutex with no contention
+ *  2. Blocking on a mutex held by a lower priority thread, which inherits
+ *     the priority of the waiter
+ *  3. Unlocking a mutex, thereby restoring the priority of the owner and
+ *     waking (and context switching to) the waiter
  */
 
 #include <zephyr/kernel.h>
@@ -18,6 +24,7 @@
 #include "timing_sc.h"
 
 static K_MUTEX_DEFINE(test_mutex);
+static K_SEM_DEFINE(pi_sem, 0, 1);
 
 static void start_lock_unlock(void *p1, void *p2, void *p3)
 {
@@ -115,3 +122,149 @@ int mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
 	timing_stop();
 	return 0;
 }
+
+static void alt_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  mid;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 1. Own the mutex, and let <start_thread> block on it */
+
+		k_mutex_lock(&test_mutex, K_FOREVER);
+		k_sem_give(&pi_sem);
+
+		/*
+		 * 3. Running at the inherited priority, unlock the mutex and
+		 * switch back to <start_thread>.
+		 */
+
+		mid = timing_timestamp_get();
+		k_mutex_unlock(&test_mutex);
+
+		/* 5. Share the <mid> timestamp */
+
+		timestamp.sample = mid;
+		k_sem_give(&pi_sem);
+	}
+}
+
+static void start_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  mid;
+	timing_t  finish;
+	uint64_t  lock_sum = 0ULL;
+	uint64_t  unlock_sum = 0ULL;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_thread_start(&alt_thread);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		k_sem_take(&pi_sem, K_FOREVER);
+
+		/*
+		 * 2. Block on the mutex, raising the priority of
+		 * <alt_thread> and switching to it.
+		 */
+
+		start = timing_timestamp_get();
+		k_mutex_lock(&test_mutex, K_FOREVER);
+
+		/* 4. Mutex obtained */
+
+		finish = timing_timestamp_get();
+		k_mutex_unlock(&test_mutex);
+
+		k_sem_take(&pi_sem, K_FOREVER);
+		mid = timestamp.sample;
+
+		lock_sum += timing_cycles_get(&start, &mid);
+		unlock_sum += timing_cycles_get(&mid, &finish);
+	}
+
+	k_thread_join(&alt_thread, K_FOREVER);
+
+	timestamp.cycles = lock_sum;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = unlock_sum;
+}
+
+/**
+ *
+ * @brief Test for the mutex priority inheritance times
+ *
+ * A thread blocks on a mutex owned by a lower priority thread, which runs at
+ * the inherited priority until it unlocks the mutex.
+ *
+ * @return 0 on success
+ */
+int mutex_blocking_ops(uint32_t num_iterations, uint32_t start_options,
+		       uint32_t alt_options)
+{
+	char tag[50];
+	char description[120];
+	int  priority;
+	uint64_t  cycles;
+
+	timing_start();
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 2, start_options, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			alt_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, alt_options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &test_mutex, &pi_sem, &pause_sem,
+			      &alt_thread);
+	k_thread_access_grant(&alt_thread, &test_mutex, &pi_sem);
+
+	k_thread_start(&start_thread);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(start_options, alt_options);
+
+	snprintf(tag, sizeof(tag),
+		 "mutex.lock.blocking.pi.%c_to_%c",
+		 ((start_options & K_USER) == K_USER) ? 'u' : 'k',
+		 ((alt_options & K_USER) == K_USER) ? 'u' : 'k');
+	snprintf(description, sizeof(description),
+		 "%-40s - Lock a mutex (priority inheritance)", tag);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+
+	k_sem_give(&pause_sem);
+	k_thread_join(&start_thread, K_FOREVER);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(start_options, alt_options);
+
+	snprintf(tag, sizeof(tag),
+		 "mutex.unlock.wake+ctx.pi.%c_to_%c",
+		 ((alt_options & K_USER) == K_USER) ? 'u' : 'k',
+		 ((start_options & K_USER) == K_USER) ? 'u' : 'k');
+	snprintf(description, sizeof(description),
+		 "%-40s - Unlock a mutex (priority restored)", tag);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+
+	timing_stop();
+
+	return 0;
+}
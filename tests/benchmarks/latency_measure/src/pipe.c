@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for various pipe operations
+ *
+ * This file contains the tests that measures the times for the following
+ * pipe operations from both kernel threads and user threads:
+ *  1. Immediately writing data to a pipe
+ *  2. Immediately reading data from a pipe
+ *  3. Blocking on reading data from a pipe
+ *  4. Waking (and context switching to) a thread blocked on a pipe
+ *     via k_pipe_write().
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+K_PIPE_DEFINE(bench_pipe, sizeof(uint32_t), sizeof(uint32_t));
+
+BENCH_BMEM uint32_t pipe_data;
+
+static void pipe_write_read_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+	uint64_t write_sum = 0ULL;
+	uint64_t read_sum = 0ULL;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+
+		k_pipe_write(&bench_pipe, (const uint8_t *)&pipe_data, sizeof(pipe_data),
+			     K_NO_WAIT);
+
+		mid = timing_timestamp_get();
+
+		k_pipe_read(&bench_pipe, (uint8_t *)&pipe_data, sizeof(pipe_data), K_NO_WAIT);
+
+		finish = timing_timestamp_get();
+
+		write_sum += timing_cycles_get(&start, &mid);
+		read_sum += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = write_sum;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = read_sum;
+}
+
+int pipe_ops(uint32_t num_iterations, uint32_t options)
+{
+	int      priority;
+	uint64_t cycles;
+	char     tag[50];
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			pipe_write_read_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &pause_sem, &bench_pipe);
+
+	k_thread_start(&start_thread);
+
+	snprintf(tag, sizeof(tag),
+		 "pipe.write.immediate.%s",
+		 options & K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Write data to pipe (no ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(options, options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag),
+		 "pipe.read.immediate.%s",
+		 options & K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Read data from pipe (no ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(options, options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
+
+static void alt_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  mid;
+	timing_t  finish;
+	uint64_t  sum[2] = {0ULL, 0ULL};
+	uint32_t  data;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 1. Block waiting for data */
+
+		start = timing_timestamp_get();
+
+		k_pipe_read(&bench_pipe, (uint8_t *)&data, sizeof(data), K_FOREVER);
+
+		/* 3. Data obtained */
+
+		finish = timing_timestamp_get();
+
+		mid = timestamp.sample;
+
+		sum[0] += timing_cycles_get(&start, &mid);
+		sum[1] += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = sum[0];
+	k_sem_take(&pause_sem, K_FOREVER);
+	timestamp.cycles = sum[1];
+}
+
+static void start_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_thread_start(&alt_thread);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 2. Write data thereby waking alt thread */
+
+		timestamp.sample = timing_timestamp_get();
+
+		k_pipe_write(&bench_pipe, (const uint8_t *)&pipe_data, sizeof(pipe_data),
+			     K_FOREVER);
+	}
+
+	k_thread_join(&alt_thread, K_FOREVER);
+}
+
+int pipe_blocking_ops(uint32_t num_iterations, uint32_t start_options,
+		      uint32_t alt_options)
+{
+	int      priority;
+	uint64_t cycles;
+	char     tag[50];
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, start_options, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			alt_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 2, alt_options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &alt_thread, &pause_sem, &bench_pipe);
+	k_thread_access_grant(&alt_thread, &pause_sem, &bench_pipe);
+
+	k_thread_start(&start_thread);
+
+	snprintf(tag, sizeof(tag),
+		 "pipe.read.blocking.%s_to_%s",
+		 alt_options & K_USER ? "u" : "k",
+		 start_options & K_USER ? "u" : "k");
+	snprintf(description, sizeof(description),
+		 "%-40s - Read data from pipe (w/ ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(start_options, alt_options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag),
+		 "pipe.write.wake+ctx.%s_to_%s",
+		 start_options & K_USER ? "u" : "k",
+		 alt_options & K_USER ? "u" : "k");
+	snprintf(description, sizeof(description),
+		 "%-40s - Write data to pipe (w/ ctx switch)", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(start_options, alt_options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
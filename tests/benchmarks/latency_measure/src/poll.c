@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for various polling operations
+ *
+ * This file contains the tests that measures the times for the following
+ * k_poll() operations from kernel threads:
+ *  1. Raising a poll signal that no thread is polling
+ *  2. Polling an already raised signal
+ *  3. Blocking in k_poll() on a signal
+ *  4. Waking (and context switching to) a thread blocked in k_poll() via
+ *     k_poll_signal_raise().
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+static struct k_poll_signal poll_sig = K_POLL_SIGNAL_INITIALIZER(poll_sig);
+
+static struct k_poll_event poll_evt =
+	K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &poll_sig, 0);
+
+static void poll_rearm(void)
+{
+	k_poll_signal_reset(&poll_sig);
+	poll_evt.state = K_POLL_STATE_NOT_READY;
+}
+
+static void poll_raise_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+	uint64_t raise_sum = 0ULL;
+	uint64_t poll_sum = 0ULL;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		poll_rearm();
+
+		start = timing_timestamp_get();
+
+		k_poll_signal_raise(&poll_sig, 0);
+
+		mid = timing_timestamp_get();
+
+		k_poll(&poll_evt, 1, K_NO_WAIT);
+
+		finish = timing_timestamp_get();
+
+		raise_sum += timing_cycles_get(&start, &mid);
+		poll_sum += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = raise_sum;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = poll_sum;
+}
+
+int poll_ops(uint32_t num_iterations)
+{
+	int      priority;
+	uint64_t cycles;
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			poll_raise_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Raise a poll signal (no waiters)",
+		 "poll.signal.raise.immediate.kernel");
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(0, 0);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Poll a raised signal (no ctx switch)",
+		 "poll.signal.immediate.kernel");
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(0, 0);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
+
+static void alt_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  mid;
+	timing_t  finish;
+	uint64_t  sum[2] = {0ULL, 0ULL};
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		poll_rearm();
+
+		/* 1. Block waiting for the signal */
+
+		start = timing_timestamp_get();
+
+		k_poll(&poll_evt, 1, K_FOREVER);
+
+		/* 3. Signal received */
+
+		finish = timing_timestamp_get();
+
+		mid = timestamp.sample;
+
+		sum[0] += timing_cycles_get(&start, &mid);
+		sum[1] += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = sum[0];
+	k_sem_take(&pause_sem, K_FOREVER);
+	timestamp.cycles = sum[1];
+}
+
+static void start_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_thread_start(&alt_thread);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 2. Raise the signal thereby waking alt thread */
+
+		timestamp.sample = timing_timestamp_get();
+
+		k_poll_signal_raise(&poll_sig, 0);
+	}
+
+	k_thread_join(&alt_thread, K_FOREVER);
+}
+
+int poll_blocking_ops(uint32_t num_iterations)
+{
+	int      priority;
+	uint64_t cycles;
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, 0, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			alt_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 2, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Poll a signal (w/ ctx switch)",
+		 "poll.signal.blocking.k_to_k");
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(0, 0);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Raise a poll signal (w/ ctx switch)",
+		 "poll.signal.raise.wake+ctx.k_to_k");
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(0, 0);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
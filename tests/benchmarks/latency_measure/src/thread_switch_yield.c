@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2012-2014 Wind River Systems, Inc.
  * Copyright (c) 2023 Intel Corporation.
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -15,6 +16,9 @@
  *   2. User thread   -> User thread
  *   3. Kernel thread -> User thread
  *   4. User thread   -> Kernel thread
+ *
+ * When FPU sharing is enabled, the switch is also measured between kernel
+ * threads that both hold live floating point context.
  */
 
 #include <zephyr/kernel.h>
@@ -25,17 +29,33 @@
 #include "utils.h"
 #include "timing_sc.h"
 
+#ifdef CONFIG_FPU_SHARING
+static volatile float fp_value;
+
+/* Use the FPU so that the thread has floating point context to switch */
+#define FP_TOUCH(options)                                  \
+	do {                                               \
+		if (((options) & K_FP_REGS) == K_FP_REGS) { \
+			fp_value += 1.0f;                  \
+		}                                          \
+	} while (0)
+#else
+#define FP_TOUCH(options) ARG_UNUSED(options)
+#endif
+
 static void alt_thread_entry(void *p1, void *p2, void *p3)
 {
 	uint32_t  num_iterations;
+	uint32_t  options = (uint32_t)(uintptr_t)p2;
 
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
 	num_iterations = (uint32_t)(uintptr_t)p1;
 
 	for (uint32_t i = 0; i < num_iterations; i++) {
 
+		FP_TOUCH(options);
+
 		/* 3. Obtain the 'finish' timestamp */
 
 		timestamp.sample = timing_timestamp_get();
@@ -51,11 +71,11 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 {
 	uint64_t  sum = 0ull;
 	uint32_t  num_iterations;
+	uint32_t  options = (uint32_t)(uintptr_t)p2;
 	timing_t  start;
 	timing_t  finish;
 
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
 	num_iterations = (uint32_t)(uintptr_t)p1;
 
@@ -63,6 +83,8 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 
 	for (uint32_t i = 0; i < num_iterations; i++) {
 
+		FP_TOUCH(options);
+
 		/* 1. Get 'start' timestamp */
 
 		start = timing_timestamp_get();
@@ -104,13 +126,15 @@ static void thread_switch_yield_common(const char *description,
 	k_thread_create(&start_thread, start_stack,
 			K_THREAD_STACK_SIZEOF(start_stack),
 			start_thread_entry,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)start_options, NULL,
 			priority - 1, start_options, K_FOREVER);
 
 	k_thread_create(&alt_thread, alt_stack,
 			K_THREAD_STACK_SIZEOF(alt_stack),
 			alt_thread_entry,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)alt_options, NULL,
 			priority - 1, alt_options, K_FOREVER);
 
 	/* Grant access rights if necessary */
@@ -132,7 +156,8 @@ static void thread_switch_yield_common(const char *description,
 	sum -= timestamp_overhead_adjustment(start_options, alt_options);
 
 	snprintf(tag, sizeof(tag),
-		 "%s.%c_to_%c", description,
+		 "%s%s.%c_to_%c", description,
+		 (start_options & K_FP_REGS) == K_FP_REGS ? ".fp" : "",
 		 (start_options & K_USER) == K_USER ? 'u' : 'k',
 		 (alt_options & K_USER) == K_USER ? 'u' : 'k');
 	snprintf(summary, sizeof(summary),
@@ -170,4 +195,9 @@ void thread_switch_yield(uint32_t num_iterations, bool is_cooperative)
 	thread_switch_yield_common(description, num_iterations, K_USER, 0,
 				   priority);
 #endif
+#ifdef CONFIG_FPU_SHARING
+	/* Kernel -> Kernel, both with floating point context */
+	thread_switch_yield_common(description, num_iterations, K_FP_REGS,
+				   K_FP_REGS, priority);
+#endif
 }
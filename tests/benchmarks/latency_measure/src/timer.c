@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time to arm and cancel a timer
+ *
+ * This file contains the tests that measures the times for the following
+ * timer operations from both kernel threads and user threads:
+ *  1. Starting a timer that is not running
+ *  2. Stopping a running timer before it expires
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+/* Long enough for the timer never to expire during the test */
+#define TIMER_DURATION K_SECONDS(60)
+
+static K_TIMER_DEFINE(timer, NULL, NULL);
+
+static void timer_start_stop_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+	uint64_t start_sum = 0ULL;
+	uint64_t stop_sum = 0ULL;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+
+		k_timer_start(&timer, TIMER_DURATION, K_NO_WAIT);
+
+		mid = timing_timestamp_get();
+
+		k_timer_stop(&timer);
+
+		finish = timing_timestamp_get();
+
+		start_sum += timing_cycles_get(&start, &mid);
+		stop_sum += timing_cycles_get(&mid, &finish);
+	}
+
+	timestamp.cycles = start_sum;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = stop_sum;
+}
+
+int timer_ops(uint32_t num_iterations, uint32_t options)
+{
+	int      priority;
+	uint64_t cycles;
+	char     tag[50];
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			timer_start_stop_thread_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &pause_sem, &timer);
+
+	k_thread_start(&start_thread);
+
+	snprintf(tag, sizeof(tag),
+		 "timer.start.%s",
+		 options & K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Start a timer", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(options, options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag),
+		 "timer.stop.%s",
+		 options & K_USER ? "user" : "kernel");
+	snprintf(description, sizeof(description),
+		 "%-40s - Stop a running timer", tag);
+
+	cycles = timestamp.cycles;
+	cycles -= timestamp_overhead_adjustment(options, options);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	k_thread_join(&start_thread, K_FOREVER);
+
+	timing_stop();
+
+	return 0;
+}
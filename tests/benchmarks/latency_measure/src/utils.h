@@ -49,7 +49,7 @@ extern int error_count;
 
 #define TICK_OCCURRENCE_ERROR  "Error: Tick Occurred"
 
-#ifdef CSV_FORMAT_OUTPUT
+#if defined(CSV_FORMAT_OUTPUT) || defined(CONFIG_BENCHMARK_CSV_OUTPUT)
 #define FORMAT_STR   "%-94s,%s,%s,%s\n"
 #define CYCLE_FORMAT "%8u"
 #define NSEC_FORMAT  "%8u"
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for work queue submissions
+ *
+ * This file contains the tests that measures the times for the following
+ * work queue operations from kernel threads:
+ *  1. Submitting a work item to a lower priority work queue
+ *  2. Submitting a work item to a higher priority work queue, until the
+ *     handler runs (context switch to the work queue thread).
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+#define WORK_Q_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(work_q_stack, WORK_Q_STACK_SIZE);
+
+static struct k_work_q work_q;
+static K_SEM_DEFINE(work_done, 0, 1);
+
+static void work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	timestamp.sample = timing_timestamp_get();
+	k_sem_give(&work_done);
+}
+
+static K_WORK_DEFINE(work, work_handler);
+
+/* The submitting thread blocks for the handler, so it posts both results at the end */
+static uint64_t work_cycles[2];
+
+static void work_submit_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	int      priority = (int)(intptr_t)p2;
+	timing_t start;
+	timing_t finish;
+	uint64_t sum = 0ULL;
+
+	ARG_UNUSED(p3);
+
+	/* 1. The work queue runs only once the work item is submitted */
+
+	k_thread_priority_set(k_work_queue_thread_get(&work_q), priority + 1);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+
+		k_work_submit_to_queue(&work_q, &work);
+
+		finish = timing_timestamp_get();
+
+		sum += timing_cycles_get(&start, &finish);
+
+		k_sem_take(&work_done, K_FOREVER);
+	}
+
+	work_cycles[0] = sum;
+
+	/* 2. The work queue preempts this thread to run the handler */
+
+	k_thread_priority_set(k_work_queue_thread_get(&work_q), priority - 1);
+
+	sum = 0ULL;
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+
+		k_work_submit_to_queue(&work_q, &work);
+
+		finish = timestamp.sample;
+
+		sum += timing_cycles_get(&start, &finish);
+
+		k_sem_take(&work_done, K_FOREVER);
+	}
+
+	work_cycles[1] = sum;
+}
+
+int work_ops(uint32_t num_iterations)
+{
+	const struct k_work_queue_config cfg = {.name = "bench_work_q"};
+	int      priority;
+	uint64_t cycles;
+	char     description[120];
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_work_queue_start(&work_q, work_q_stack, K_THREAD_STACK_SIZEOF(work_q_stack),
+			   priority, &cfg);
+
+	timing_start();
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			work_submit_thread_entry,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(intptr_t)(priority - 1), NULL,
+			priority - 1, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+	k_thread_join(&start_thread, K_FOREVER);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Submit a work item (no ctx switch)",
+		 "work.submit.immediate.kernel");
+
+	cycles = work_cycles[0];
+	cycles -= timestamp_overhead_adjustment(0, 0);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Submit a work item until it runs (w/ ctx switch)",
+		 "work.submit.wake+ctx.k_to_k");
+
+	cycles = work_cycles[1];
+	cycles -= timestamp_overhead_adjustment(0, 0);
+	PRINT_STATS_AVG(description, (uint32_t)cycles,
+			num_iterations, false, "");
+
+	timing_stop();
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Times memcpy(), memmove() and memset() of the C library the test is built with, from a header
+ * to a page, with aligned and misaligned buffers, and reports the throughput in KiB/s. The
+ * variants of the test build it with each C library, for comparison.
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/util.h>
+
+#define MAX_SIZE   4096
+#define ITERATIONS 64
+
+static const size_t sizes[] = {16, 64, 256, MAX_SIZE};
+
+/* Source and destination offsets from word aligned buffers */
+static const struct {
+	size_t src;
+	size_t dst;
+} offsets[] = {{0, 0}, {1, 1}, {0, 3}};
+
+static uint8_t src_buf[MAX_SIZE + 8] __aligned(8);
+static uint8_t dst_buf[MAX_SIZE + 8] __aligned(8);
+
+/* Keep the compiler from turning the calls of constant size into inline code */
+static void *(*volatile memcpy_fn)(void *, const void *, size_t) = memcpy;
+static void *(*volatile memmove_fn)(void *, const void *, size_t) = memmove;
+static void *(*volatile memset_fn)(void *, int, size_t) = memset;
+
+static void report(const char *name, size_t size, size_t src, size_t dst, timing_t start,
+		   timing_t end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(&start, &end)) / ITERATIONS;
+
+	TC_PRINT("%-8s %5zu bytes +%zu/+%zu: %8llu ns, %8llu KiB/s\n", name, size, src, dst, ns,
+		 (ns == 0U) ? 0ULL : (uint64_t)size * NSEC_PER_SEC / 1024U / ns);
+}
+
+static void bench(size_t size, size_t src, size_t dst)
+{
+	timing_t start;
+	timing_t end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		memcpy_fn(&dst_buf[dst], &src_buf[src], size);
+	}
+	end = timing_counter_get();
+	report("memcpy", size, src, dst, start, end);
+	zassert_mem_equal(&dst_buf[dst], &src_buf[src], size);
+
+	/* Overlapping copy, forward then backward */
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS / 2; i++) {
+		memmove_fn(&dst_buf[dst], &dst_buf[dst + 4], size - 4);
+		memmove_fn(&dst_buf[dst + 4], &dst_buf[dst], size - 4);
+	}
+	end = timing_counter_get();
+	report("memmove", size - 4, src, dst, start, end);
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		memset_fn(&dst_buf[dst], i, size);
+	}
+	end = timing_counter_get();
+	report("memset", size, 0, dst, start, end);
+	zassert_equal(dst_buf[dst + size - 1], ITERATIONS - 1);
+}
+
+/**
+ * @brief Measure the throughput of the memory functions of the C library
+ *
+ * Times are per call.
+ */
+ZTEST(libc_string, test_throughput)
+{
+	for (size_t i = 0; i < sizeof(src_buf); i++) {
+		src_buf[i] = (uint8_t)(i * 131 + 7);
+	}
+
+	timing_init();
+	timing_start();
+
+	ARRAY_FOR_EACH(sizes, s) {
+		ARRAY_FOR_EACH(offsets, o) {
+			bench(sizes[s], offsets[o].src, offsets[o].dst);
+		}
+	}
+
+	timing_stop();
+}
+
+ZTEST_SUITE(libc_string, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * All CPUs but the one running main() take the same spinlock in a loop,
+ * with a short critical section. Each interval reports how many times every
+ * CPU got the lock: the total is the throughput of the lock under
+ * contention, the spread between CPUs its fairness.
+ */
+
+#include <limits.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/printk.h>
+
+#if CONFIG_MP_MAX_NUM_CPUS <= 2
+#error "Test requires a system with more than 2 CPUs"
+#endif
+
+#define INTERVAL_DURATION 10
+
+#define NUM_THREADS (CONFIG_MP_MAX_NUM_CPUS - 1)
+#define STACK_SIZE  1024
+
+#if defined(CONFIG_TICKET_SPINLOCKS)
+#define LOCK_TYPE "Ticket"
+#elif defined(CONFIG_MCS_SPINLOCKS)
+#define LOCK_TYPE "MCS"
+#else
+#define LOCK_TYPE "Plain"
+#endif
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static struct k_spinlock lock;
+static volatile unsigned long shared;
+static volatile unsigned long acquired[NUM_THREADS];
+
+static void work(unsigned int iterations)
+{
+	for (volatile unsigned int i = 0; i < iterations; i++) {
+	}
+}
+
+static void contend_entry(void *p1, void *p2, void *p3)
+{
+	unsigned int index = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		shared++;
+		work(CONFIG_BENCHMARK_SPINLOCK_HOLD);
+
+		k_spin_unlock(&lock, key);
+
+		acquired[index]++;
+		work(CONFIG_BENCHMARK_SPINLOCK_IDLE);
+	}
+}
+
+static void report(void)
+{
+	unsigned int elapsed_time = INTERVAL_DURATION;
+	unsigned long last[NUM_THREADS] = {};
+	unsigned long count[NUM_THREADS];
+	unsigned long total;
+	unsigned long min;
+	unsigned long max;
+
+	while (1) {
+		k_sleep(K_SECONDS(INTERVAL_DURATION));
+
+		total = 0;
+		min = ULONG_MAX;
+		max = 0;
+
+		for (unsigned int i = 0; i < NUM_THREADS; i++) {
+			count[i] = acquired[i] - last[i];
+			last[i] += count[i];
+			total += count[i];
+			min = MIN(min, count[i]);
+			max = MAX(max, count[i]);
+		}
+
+		printk("**** Spinlock %s Contention **** Elapsed Time: %u\n", LOCK_TYPE,
+		       elapsed_time);
+		printk("  Total Acquisitions: %lu\n", total);
+		for (unsigned int i = 0; i < NUM_THREADS; i++) {
+			printk("   - Thread #%u: %lu\n", i, count[i]);
+		}
+		printk("  Spread: %lu\n", max - min);
+
+		elapsed_time += INTERVAL_DURATION;
+	}
+}
+
+int main(void)
+{
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, contend_entry,
+				UINT_TO_POINTER(i), NULL, NULL, -1, 0, K_NO_WAIT);
+	}
+
+	report();
+
+	return 0;
+}
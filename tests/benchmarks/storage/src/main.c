@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Compares the settings storage backends (NVS, ZMS, FCB and file) selected by the scenario. All
+ * backends are driven through the settings API with the same keys and values, and the benchmark
+ * reports mount and load time, write and read latency percentiles, garbage collection pauses and
+ * write amplification. The last two need the flash simulator statistics, on real flash the longest
+ * write is reported instead.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+
+#if defined(CONFIG_SETTINGS_NVS)
+#include <zephyr/fs/nvs.h>
+#define BACKEND_NAME "nvs"
+#elif defined(CONFIG_SETTINGS_ZMS)
+#include <zephyr/fs/zms.h>
+#define BACKEND_NAME "zms"
+#elif defined(CONFIG_SETTINGS_FCB)
+#include <zephyr/fs/fcb.h>
+#define BACKEND_NAME "fcb"
+#elif defined(CONFIG_SETTINGS_FILE)
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/littlefs.h>
+#define BACKEND_NAME "file"
+#else
+#error "Unsupported settings backend"
+#endif
+
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+#include <zephyr/stats/stats.h>
+#endif
+
+#define STORAGE_PARTITION    storage_partition
+#define STORAGE_PARTITION_ID FIXED_PARTITION_ID(STORAGE_PARTITION)
+
+#define KEYS        CONFIG_BENCHMARK_STORAGE_KEYS
+#define VALUE_SIZE  CONFIG_BENCHMARK_STORAGE_VALUE_SIZE
+#define ROUNDS      CONFIG_BENCHMARK_STORAGE_ROUNDS
+#define READ_ROUNDS 4
+#define KEY_PREFIX  "bench"
+
+static uint32_t write_ns[KEYS * ROUNDS];
+static uint32_t read_ns[KEYS * READ_ROUNDS];
+static uint8_t value[VALUE_SIZE];
+static uint8_t read_value[VALUE_SIZE];
+
+#ifdef CONFIG_SETTINGS_FILE
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(lfs_data);
+static struct fs_mount_t lfs_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &lfs_data,
+	.storage_dev = (void *)STORAGE_PARTITION_ID,
+	.mnt_point = "/lfs",
+};
+#endif
+
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+static uint32_t *sim_bytes_written;
+static uint32_t *sim_erase_calls;
+
+static int sim_stats_find(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
+{
+	ARG_UNUSED(arg);
+
+	if (strcmp(name, "bytes_written") == 0) {
+		sim_bytes_written = (uint32_t *)((uint8_t *)hdr + off);
+	} else if (strcmp(name, "flash_erase_calls") == 0) {
+		sim_erase_calls = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+static uint32_t flash_bytes_written(void)
+{
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+	return (sim_bytes_written != NULL) ? *sim_bytes_written : 0U;
+#else
+	return 0U;
+#endif
+}
+
+static uint32_t flash_erase_calls(void)
+{
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+	return (sim_erase_calls != NULL) ? *sim_erase_calls : 0U;
+#else
+	return 0U;
+#endif
+}
+
+static bool flash_stats_available(void)
+{
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+	return (sim_bytes_written != NULL) && (sim_erase_calls != NULL);
+#else
+	return false;
+#endif
+}
+
+static uint32_t elapsed_ns(timing_t start, timing_t end)
+{
+	return (uint32_t)timing_cycles_to_ns(timing_cycles_get(&start, &end));
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void print_percentiles(const char *name, uint32_t *samples, size_t count)
+{
+	qsort(samples, count, sizeof(samples[0]), cmp_u32);
+
+	TC_PRINT("%s latency [us]: p50 %u, p90 %u, p99 %u, max %u\n", name,
+		 samples[count / 2] / 1000U, samples[(count * 9U) / 10U] / 1000U,
+		 samples[(count * 99U) / 100U] / 1000U, samples[count - 1] / 1000U);
+}
+
+static void key_name(char *name, size_t len, int key)
+{
+	snprintk(name, len, KEY_PREFIX "/%d", key);
+}
+
+static int read_cb(const char *key, size_t len, settings_read_cb read, void *cb_arg,
+		   void *param)
+{
+	ssize_t *rc = param;
+
+	/* Only the exact key, not keys it is a prefix of */
+	if (settings_name_next(key, NULL) != 0) {
+		return 0;
+	}
+
+	*rc = read(cb_arg, read_value, MIN(len, sizeof(read_value)));
+
+	return 1;
+}
+
+/* Mount the backend storage again, as done at boot */
+static int backend_remount(void)
+{
+	void *storage;
+	int rc;
+
+	rc = settings_storage_get(&storage);
+	if (rc != 0) {
+		return rc;
+	}
+
+#if defined(CONFIG_SETTINGS_NVS)
+	static struct nvs_fs nvs;
+	const struct nvs_fs *cur = storage;
+
+	memset(&nvs, 0, sizeof(nvs));
+	nvs.offset = cur->offset;
+	nvs.sector_size = cur->sector_size;
+	nvs.sector_count = cur->sector_count;
+	nvs.flash_device = cur->flash_device;
+
+	return nvs_mount(&nvs);
+#elif defined(CONFIG_SETTINGS_ZMS)
+	static struct zms_fs zms;
+	const struct zms_fs *cur = storage;
+
+	memset(&zms, 0, sizeof(zms));
+	zms.offset = cur->offset;
+	zms.sector_size = cur->sector_size;
+	zms.sector_count = cur->sector_count;
+	zms.flash_device = cur->flash_device;
+
+	return zms_mount(&zms);
+#elif defined(CONFIG_SETTINGS_FCB)
+	static struct fcb fcb;
+	const struct fcb *cur = storage;
+
+	memset(&fcb, 0, sizeof(fcb));
+	fcb.f_magic = cur->f_magic;
+	fcb.f_version = cur->f_version;
+	fcb.f_sector_cnt = cur->f_sector_cnt;
+	fcb.f_scratch_cnt = cur->f_scratch_cnt;
+	fcb.f_sectors = cur->f_sectors;
+
+	return fcb_init(STORAGE_PARTITION_ID, &fcb);
+#elif defined(CONFIG_SETTINGS_FILE)
+	ARG_UNUSED(storage);
+
+	rc = fs_unmount(&lfs_mnt);
+	if (rc != 0) {
+		return rc;
+	}
+
+	return fs_mount(&lfs_mnt);
+#endif
+}
+
+ZTEST(storage_benchmark, test_storage)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	uint32_t payload = 0U;
+	uint32_t flash_written;
+	uint32_t gc_max_ns = 0U;
+	uint32_t gc_count = 0U;
+	timing_t start, end;
+	size_t n = 0;
+	int rc;
+
+	/* Write rounds, with each value different from the previous one */
+	for (int round = 0; round < ROUNDS; round++) {
+		for (int key = 0; key < KEYS; key++) {
+			uint32_t erases = flash_erase_calls();
+
+			key_name(name, sizeof(name), key);
+			memset(value, round * KEYS + key, sizeof(value));
+
+			start = timing_counter_get();
+			rc = settings_save_one(name, value, sizeof(value));
+			end = timing_counter_get();
+			zassert_ok(rc, "Failed to write %s (%d)", name, rc);
+
+			write_ns[n] = elapsed_ns(start, end);
+			if (flash_erase_calls() != erases) {
+				gc_max_ns = MAX(gc_max_ns, write_ns[n]);
+				gc_count++;
+			}
+			payload += sizeof(value);
+			n++;
+		}
+	}
+
+	flash_written = flash_bytes_written();
+
+	/* Remount time with all the keys stored */
+	start = timing_counter_get();
+	rc = backend_remount();
+	end = timing_counter_get();
+	zassert_ok(rc, "Failed to remount (%d)", rc);
+	TC_PRINT("mount time [us]: %u\n", elapsed_ns(start, end) / 1000U);
+
+	start = timing_counter_get();
+	rc = settings_load();
+	end = timing_counter_get();
+	zassert_ok(rc, "Failed to load (%d)", rc);
+	TC_PRINT("load time [us]: %u\n", elapsed_ns(start, end) / 1000U);
+
+	n = 0;
+	for (int round = 0; round < READ_ROUNDS; round++) {
+		for (int key = 0; key < KEYS; key++) {
+			ssize_t len = -ENOENT;
+
+			key_name(name, sizeof(name), key);
+
+			start = timing_counter_get();
+			rc = settings_load_subtree_direct(name, read_cb, &len);
+			end = timing_counter_get();
+			zassert_ok(rc, "Failed to read %s (%d)", name, rc);
+			zassert_equal(len, sizeof(read_value), "Wrong length of %s (%d)", name,
+				      len);
+			zassert_equal(read_value[0], (uint8_t)((ROUNDS - 1) * KEYS + key),
+				      "Wrong value of %s", name);
+
+			read_ns[n++] = elapsed_ns(start, end);
+		}
+	}
+
+	print_percentiles("write", write_ns, ARRAY_SIZE(write_ns));
+	print_percentiles("read", read_ns, ARRAY_SIZE(read_ns));
+
+	if (flash_stats_available()) {
+		TC_PRINT("gc pauses: %u, longest [us]: %u\n", gc_count, gc_max_ns / 1000U);
+		TC_PRINT("write amplification: %u.%02u (%u bytes for %u bytes of values)\n",
+			 flash_written / payload, ((flash_written % payload) * 100U) / payload,
+			 flash_written, payload);
+	} else {
+		TC_PRINT("gc pauses: n/a, longest write [us]: %u\n",
+			 write_ns[ARRAY_SIZE(write_ns) - 1] / 1000U);
+		TC_PRINT("write amplification: n/a\n");
+	}
+}
+
+static void *storage_benchmark_setup(void)
+{
+	const struct flash_area *fa;
+	timing_t start, end;
+	int rc;
+
+	/* Start from empty storage */
+	rc = flash_area_open(STORAGE_PARTITION_ID, &fa);
+	zassert_ok(rc, "Failed to open storage partition (%d)", rc);
+	rc = flash_area_flatten(fa, 0, fa->fa_size);
+	zassert_ok(rc, "Failed to erase storage partition (%d)", rc);
+	flash_area_close(fa);
+
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+	struct stats_hdr *sim_stats = stats_group_find("flash_sim_stats");
+
+	if (sim_stats != NULL) {
+		stats_walk(sim_stats, sim_stats_find, NULL);
+	}
+#endif
+
+	timing_init();
+	timing_start();
+
+#ifdef CONFIG_SETTINGS_FILE
+	rc = fs_mount(&lfs_mnt);
+	zassert_ok(rc, "Failed to mount littlefs (%d)", rc);
+#endif
+
+	start = timing_counter_get();
+	rc = settings_subsys_init();
+	end = timing_counter_get();
+	zassert_ok(rc, "Failed to initialize settings (%d)", rc);
+
+	TC_PRINT("Storage backend: %s, %u keys, %u byte values, %u rounds\n", BACKEND_NAME,
+		 KEYS, VALUE_SIZE, ROUNDS);
+	TC_PRINT("first mount time [us]: %u\n", elapsed_ns(start, end) / 1000U);
+
+	/* Count flash writes of the benchmark only */
+	if (flash_stats_available()) {
+		*sim_bytes_written = 0U;
+		*sim_erase_calls = 0U;
+	}
+
+	return NULL;
+}
+
+static void storage_benchmark_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timing_stop();
+}
+
+ZTEST_SUITE(storage_benchmark, NULL, storage_benchmark_setup, NULL, NULL,
+	    storage_benchmark_teardown);
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Floating point context switching test
+ *
+ * Five threads of equal priority yield to each other like in the cooperative
+ * scheduling test. The first CONFIG_TM_FP_THREADS of them run a floating point
+ * multiply-accumulate between switches, so that their FP context is live, while
+ * the others only use integer registers. Comparing the totals for different
+ * numbers of FP threads and FPU configurations gives the cost of the FP context
+ * on thread switches.
+ */
+
+#include <stdint.h>
+
+#include "tm_api.h"
+
+#define TM_FP_SCHEDULING_THREADS 5
+
+unsigned long tm_fp_scheduling_counter[TM_FP_SCHEDULING_THREADS];
+
+/* Keep the accumulators in memory so the FP work is not optimized away */
+static volatile float tm_fp_scheduling_acc[TM_FP_SCHEDULING_THREADS];
+
+void tm_fp_scheduling_initialize(void);
+void tm_fp_scheduling_thread_report(void);
+
+int main(void)
+{
+	/* Initialize the test.  */
+	tm_initialize(tm_fp_scheduling_initialize);
+
+	return 0;
+}
+
+static void tm_fp_scheduling_thread_entry(void *p1, void *p2, void *p3)
+{
+	int id = (int)(intptr_t)p1;
+	float acc = 0.0f;
+	float x = 1.0f + (float)id;
+
+	(void)p2;
+	(void)p3;
+
+	while (1) {
+
+		/* Relinquish to all other threads at same priority.  */
+		tm_thread_relinquish();
+
+		if (id < CONFIG_TM_FP_THREADS) {
+			/* Live FP state across the next switch.  */
+			acc = acc * 0.5f + x;
+			tm_fp_scheduling_acc[id] = acc;
+		}
+
+		/* Increment this thread's counter.  */
+		tm_fp_scheduling_counter[id]++;
+	}
+}
+
+static void tm_fp_scheduling_thread_0_entry(void *p1, void *p2, void *p3)
+{
+	(void)p1;
+
+	tm_fp_scheduling_thread_entry((void *)0, p2, p3);
+}
+
+static void tm_fp_scheduling_thread_1_entry(void *p1, void *p2, void *p3)
+{
+	(void)p1;
+
+	tm_fp_scheduling_thread_entry((void *)1, p2, p3);
+}
+
+static void tm_fp_scheduling_thread_2_entry(void *p1, void *p2, void *p3)
+{
+	(void)p1;
+
+	tm_fp_scheduling_thread_entry((void *)2, p2, p3);
+}
+
+static void tm_fp_scheduling_thread_3_entry(void *p1, void *p2, void *p3)
+{
+	(void)p1;
+
+	tm_fp_scheduling_thread_entry((void *)3, p2, p3);
+}
+
+static void tm_fp_scheduling_thread_4_entry(void *p1, void *p2, void *p3)
+{
+	(void)p1;
+
+	tm_fp_scheduling_thread_entry((void *)4, p2, p3);
+}
+
+void tm_fp_scheduling_initialize(void)
+{
+	int prio = CONFIG_MAIN_THREAD_PRIORITY;
+
+	/* Create all 5 threads at the same priority as the main thread.  */
+	tm_thread_create(0, prio, tm_fp_scheduling_thread_0_entry);
+	tm_thread_create(1, prio, tm_fp_scheduling_thread_1_entry);
+	tm_thread_create(2, prio, tm_fp_scheduling_thread_2_entry);
+	tm_thread_create(3, prio, tm_fp_scheduling_thread_3_entry);
+	tm_thread_create(4, prio, tm_fp_scheduling_thread_4_entry);
+
+	/* Resume all 5 threads.  */
+	for (int i = 0; i < TM_FP_SCHEDULING_THREADS; i++) {
+		tm_thread_resume(i);
+	}
+
+	tm_fp_scheduling_thread_report();
+}
+
+void tm_fp_scheduling_thread_report(void)
+{
+	unsigned long total;
+	unsigned long relative_time = 0;
+	unsigned long last_total = 0;
+	unsigned long average;
+
+	while (1) {
+
+		/* Sleep to allow the test to run.  */
+		tm_thread_sleep(TM_TEST_DURATION);
+
+		/* Increment the relative time.  */
+		relative_time = relative_time + TM_TEST_DURATION;
+
+		/* Print results to the stdio window.  */
+		printf("**** Thread-Metric FP Scheduling Test (%d of %d FP threads) ****"
+		       " Relative Time: %lu\n",
+		       CONFIG_TM_FP_THREADS, TM_FP_SCHEDULING_THREADS, relative_time);
+
+		/* Calculate the total of all the counters.  */
+		total = 0;
+		for (int i = 0; i < TM_FP_SCHEDULING_THREADS; i++) {
+			printf("tm_fp_scheduling_counter[%d]: %lu\n", i,
+			       tm_fp_scheduling_counter[i]);
+			total += tm_fp_scheduling_counter[i];
+		}
+
+		/* Calculate the average of all the counters.  */
+		average = total / TM_FP_SCHEDULING_THREADS;
+
+		/* See if there are any errors.  */
+		for (int i = 0; i < TM_FP_SCHEDULING_THREADS; i++) {
+			if ((tm_fp_scheduling_counter[i] < (average - 1)) ||
+			    (tm_fp_scheduling_counter[i] > (average + 1))) {
+				printf("ERROR: Invalid counter value(s). FP scheduling counters "
+				       "should not be more that 1 different than the average!\n");
+				break;
+			}
+		}
+
+		/* Show the time period total.  */
+		printf("Time Period Total:  %lu\n\n", total - last_total);
+
+		/* Save the last total.  */
+		last_total = total;
+	}
+}
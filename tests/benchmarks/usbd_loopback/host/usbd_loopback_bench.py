@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Audio Inventions Ltd
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Host side of the USB device loopback benchmark.
+
+Measures bulk throughput, isochronous completion jitter and control transfer
+latency of a device running tests/benchmarks/usbd_loopback, and reads the
+transfer statistics collected by the loopback function in the USB device
+stack thread.
+"""
+
+import argparse
+import json
+import math
+import struct
+import sys
+import time
+
+import usb.core
+import usb.util
+
+LB_VENDOR_REQ_OUT = 0x5B
+LB_VENDOR_REQ_IN = 0x5C
+LB_VENDOR_REQ_STATS = 0x5D
+LB_VENDOR_REQ_STATS_RESET = 0x5E
+
+REQTYPE_VENDOR_OUT = usb.util.build_request_type(
+    usb.util.CTRL_OUT, usb.util.CTRL_TYPE_VENDOR, usb.util.CTRL_RECIPIENT_DEVICE
+)
+REQTYPE_VENDOR_IN = usb.util.build_request_type(
+    usb.util.CTRL_IN, usb.util.CTRL_TYPE_VENDOR, usb.util.CTRL_RECIPIENT_DEVICE
+)
+
+STATS_NAMES = ("bulk_out", "bulk_in", "iso_out", "iso_in", "control")
+STATS_HDR = struct.Struct("<II")
+STATS_ENTRY = struct.Struct("<IIQIIQQ")
+
+LB_IFACE_BULK = 0
+LB_IFACE_ISO = 2
+LB_ISO_ALT = 1
+
+
+def read_stats(dev):
+    length = STATS_HDR.size + len(STATS_NAMES) * STATS_ENTRY.size
+    data = bytes(dev.ctrl_transfer(REQTYPE_VENDOR_IN, LB_VENDOR_REQ_STATS, 0, 0, length))
+    cycles_per_sec, num = STATS_HDR.unpack_from(data)
+    result = {"cycles_per_sec": cycles_per_sec}
+
+    for i in range(min(num, len(STATS_NAMES))):
+        offset = STATS_HDR.size + i * STATS_ENTRY.size
+        count, errors, nbytes, cmin, cmax, csum, csum_sq = STATS_ENTRY.unpack_from(data, offset)
+        intervals = max(count - 1, 0)
+        mean = csum / intervals if intervals else 0.0
+        var = csum_sq / intervals - mean * mean if intervals else 0.0
+        result[STATS_NAMES[i]] = {
+            "count": count,
+            "errors": errors,
+            "bytes": nbytes,
+            "min_cycles": cmin,
+            "max_cycles": cmax,
+            "mean_cycles": mean,
+            "stddev_cycles": math.sqrt(max(var, 0.0)),
+        }
+
+    return result
+
+
+def reset_stats(dev):
+    dev.ctrl_transfer(REQTYPE_VENDOR_OUT, LB_VENDOR_REQ_STATS_RESET, 0, 0, None)
+
+
+def find_ep(dev, iface, alt, ep_type, direction):
+    intf = dev.get_active_configuration()[(iface, alt)]
+
+    def match(ep):
+        return (
+            usb.util.endpoint_type(ep.bmAttributes) == ep_type
+            and usb.util.endpoint_direction(ep.bEndpointAddress) == direction
+        )
+
+    return usb.util.find_descriptor(intf, custom_match=match)
+
+
+def bench_bulk(dev, ep, duration, size):
+    is_in = usb.util.endpoint_direction(ep.bEndpointAddress) == usb.util.ENDPOINT_IN
+    data = bytes(size)
+    total = 0
+    start = time.perf_counter()
+
+    while time.perf_counter() - start < duration:
+        if is_in:
+            total += len(ep.read(size, timeout=1000))
+        else:
+            total += ep.write(data, timeout=1000)
+
+    elapsed = time.perf_counter() - start
+
+    return {"bytes": total, "seconds": elapsed, "kib_per_sec": total / elapsed / 1024}
+
+
+def bench_iso(dev, ep_out, ep_in, duration):
+    dev.set_interface_altsetting(interface=LB_IFACE_ISO, alternate_setting=LB_ISO_ALT)
+    data = bytes(ep_out.wMaxPacketSize)
+    errors = 0
+    start = time.perf_counter()
+
+    while time.perf_counter() - start < duration:
+        try:
+            ep_out.write(data, timeout=100)
+            ep_in.read(ep_in.wMaxPacketSize, timeout=100)
+        except usb.core.USBError:
+            errors += 1
+
+    elapsed = time.perf_counter() - start
+    dev.set_interface_altsetting(interface=LB_IFACE_ISO, alternate_setting=0)
+
+    return {"seconds": elapsed, "host_errors": errors}
+
+
+def bench_control(dev, duration, size):
+    data = bytes(size)
+    samples = []
+    start = time.perf_counter()
+
+    while time.perf_counter() - start < duration:
+        t0 = time.perf_counter_ns()
+        dev.ctrl_transfer(REQTYPE_VENDOR_OUT, LB_VENDOR_REQ_OUT, 0, 0, data)
+        dev.ctrl_transfer(REQTYPE_VENDOR_IN, LB_VENDOR_REQ_IN, 0, 0, size)
+        samples.append((time.perf_counter_ns() - t0) / 2000)
+
+    samples.sort()
+
+    return {
+        "round_trips": len(samples),
+        "min_us": samples[0],
+        "median_us": samples[len(samples) // 2],
+        "max_us": samples[-1],
+    }
+
+
+def run_test(dev, func, *args):
+    reset_stats(dev)
+    host = func(dev, *args)
+    device = read_stats(dev)
+
+    return {"host": host, "device": device}
+
+
+def print_result(name, result):
+    cps = result["device"]["cycles_per_sec"]
+    print(f"{name}:")
+    for key, value in result["host"].items():
+        print(f"  host {key}: {value:.2f}" if isinstance(value, float) else
+              f"  host {key}: {value}")
+
+    for stats_name in STATS_NAMES:
+        st = result["device"][stats_name]
+        if st["count"] == 0 and st["errors"] == 0:
+            continue
+
+        mean_us = st["mean_cycles"] * 1e6 / cps
+        print(f"  device {stats_name}: count {st['count']} errors {st['errors']} "
+              f"bytes {st['bytes']} interval cycles min {st['min_cycles']} "
+              f"max {st['max_cycles']} mean {st['mean_cycles']:.1f} "
+              f"stddev {st['stddev_cycles']:.1f} ({mean_us:.1f} us)")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--vid", type=lambda x: int(x, 0), default=0x2FE3)
+    parser.add_argument("--pid", type=lambda x: int(x, 0), default=0x0009)
+    parser.add_argument("--duration", type=float, default=3.0,
+                        help="duration of each test in seconds")
+    parser.add_argument("--bulk-size", type=int, default=1024,
+                        help="size of a single bulk transfer")
+    parser.add_argument("--ctrl-size", type=int, default=64,
+                        help="data stage size of control transfers")
+    parser.add_argument("--json", action="store_true", help="print results as JSON")
+    args = parser.parse_args()
+
+    dev = usb.core.find(idVendor=args.vid, idProduct=args.pid)
+    if dev is None:
+        sys.exit(f"Device {args.vid:04x}:{args.pid:04x} not found")
+
+    for iface in (LB_IFACE_BULK, LB_IFACE_ISO):
+        if dev.is_kernel_driver_active(iface):
+            dev.detach_kernel_driver(iface)
+
+    bulk_out = find_ep(dev, LB_IFACE_BULK, 0, usb.util.ENDPOINT_TYPE_BULK, usb.util.ENDPOINT_OUT)
+    bulk_in = find_ep(dev, LB_IFACE_BULK, 0, usb.util.ENDPOINT_TYPE_BULK, usb.util.ENDPOINT_IN)
+    iso_out = find_ep(dev, LB_IFACE_ISO, LB_ISO_ALT, usb.util.ENDPOINT_TYPE_ISO,
+                      usb.util.ENDPOINT_OUT)
+    iso_in = find_ep(dev, LB_IFACE_ISO, LB_ISO_ALT, usb.util.ENDPOINT_TYPE_ISO,
+                     usb.util.ENDPOINT_IN)
+
+    results = {
+        "bulk_out": run_test(dev, bench_bulk, bulk_out, args.duration,
+                             args.bulk_size),
+        "bulk_in": run_test(dev, bench_bulk, bulk_in, args.duration,
+                            args.bulk_size),
+        "iso": run_test(dev, bench_iso, iso_out, iso_in, args.duration),
+        "control": run_test(dev, bench_control, args.duration, args.ctrl_size),
+    }
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+    else:
+        for name, result in results.items():
+            print_result(name, result)
+
+
+if __name__ == "__main__":
+    main()
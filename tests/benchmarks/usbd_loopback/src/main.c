@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sample_usbd.h>
+#include <zephyr/usb/usbd.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
+
+int main(void)
+{
+	struct usbd_context *sample_usbd;
+	int ret;
+
+	sample_usbd = sample_usbd_setup_device(NULL);
+	if (sample_usbd == NULL) {
+		LOG_ERR("Failed to setup USB device");
+		return -ENODEV;
+	}
+
+	ret = usbd_init(sample_usbd);
+	if (ret) {
+		LOG_ERR("Failed to initialize device support");
+		return ret;
+	}
+
+	ret = usbd_enable(sample_usbd);
+	if (ret) {
+		LOG_ERR("Failed to enable device support");
+		return ret;
+	}
+
+	LOG_INF("USB loopback benchmark ready, %u cycles per second",
+		sys_clock_hw_cycles_per_sec());
+
+	return 0;
+}
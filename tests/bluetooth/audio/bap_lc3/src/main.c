@@ -0,0 +1,284 @@
+/* main.c - Application main entry point */
+
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/audio/audio.h>
+#include <zephyr/bluetooth/audio/bap.h>
+#include <zephyr/bluetooth/audio/bap_lc3.h>
+#include <zephyr/bluetooth/audio/lc3.h>
+#include <zephyr/fff.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/util.h>
+
+#include <ztest_test.h>
+#include <ztest_assert.h>
+
+DEFINE_FFF_GLOBALS;
+
+#define TEST_STREAM_COUNT 2
+#define TEST_SDU_MAX      16
+
+/* SDU as passed to bt_bap_stream_send() */
+struct test_sdu {
+	struct bt_bap_stream *stream;
+	uint16_t seq_num;
+	uint16_t len;
+	/* Value of the PCM the SDU was encoded from, see lc3_encode() of the fake codec */
+	uint8_t pcm;
+};
+
+static struct test_sdu test_sdus[TEST_SDU_MAX];
+static size_t test_sdu_count;
+
+static uint8_t test_buf_data[BT_ISO_CHAN_SEND_RESERVE + 2 * BT_BAP_LC3_FRAME_OCTETS_MAX];
+static struct net_buf test_buf;
+static struct net_buf_pool test_pool;
+static bool test_buf_unavailable;
+
+/* Every SDU is copied out when sent, so the same buffer is handed out again */
+struct net_buf *net_buf_alloc_fixed(struct net_buf_pool *pool, k_timeout_t timeout)
+{
+	if (test_buf_unavailable) {
+		return NULL;
+	}
+
+	memset(&test_buf, 0, sizeof(test_buf));
+	test_buf.__buf = test_buf_data;
+	test_buf.data = test_buf_data;
+	test_buf.size = sizeof(test_buf_data);
+
+	return &test_buf;
+}
+
+int bt_bap_ep_get_info(const struct bt_bap_ep *ep, struct bt_bap_ep_info *info)
+{
+	memset(info, 0, sizeof(*info));
+	info->dir = BT_AUDIO_DIR_SOURCE;
+	info->can_send = true;
+
+	return 0;
+}
+
+void bt_bap_stream_cb_register(struct bt_bap_stream *stream, struct bt_bap_stream_ops *ops)
+{
+	stream->ops = ops;
+}
+
+int bt_bap_stream_send(struct bt_bap_stream *stream, struct net_buf *buf, uint16_t seq_num)
+{
+	struct test_sdu *sdu;
+
+	zassert_true(test_sdu_count < ARRAY_SIZE(test_sdus), "Too many SDUs sent");
+	zassert_true(buf->len > 0U, "Empty SDU sent");
+
+	sdu = &test_sdus[test_sdu_count++];
+	sdu->stream = stream;
+	sdu->seq_num = seq_num;
+	sdu->len = buf->len;
+	sdu->pcm = buf->data[0];
+
+	return 0;
+}
+
+static size_t test_stream_pcm_get_count;
+
+static int test_stream_pcm_get(struct bt_bap_lc3_stream *stream, int16_t *pcm, size_t samples)
+{
+	test_stream_pcm_get_count++;
+
+	return -ENODATA;
+}
+
+static const struct bt_bap_lc3_stream_ops test_lc3_ops = {
+	.pcm_get = test_stream_pcm_get,
+};
+
+static size_t test_group_pcm_get_count;
+
+/* PCM of every SDU interval holds the number of the interval */
+static int test_group_pcm_get(struct bt_bap_lc3_pcm_group *group, int16_t *pcm, size_t samples)
+{
+	test_group_pcm_get_count++;
+
+	for (size_t i = 0U; i < samples; i++) {
+		pcm[i] = (int16_t)test_group_pcm_get_count;
+	}
+
+	return 0;
+}
+
+/* Same PCM at two bitrates, like two subgroups of a broadcast source */
+static struct bt_audio_codec_cfg test_codec_cfg[TEST_STREAM_COUNT] = {
+	BT_AUDIO_CODEC_LC3_CONFIG(BT_AUDIO_CODEC_CFG_FREQ_16KHZ, BT_AUDIO_CODEC_CFG_DURATION_10,
+				  BT_AUDIO_LOCATION_FRONT_LEFT, 30U, 1U,
+				  BT_AUDIO_CONTEXT_TYPE_MEDIA),
+	BT_AUDIO_CODEC_LC3_CONFIG(BT_AUDIO_CODEC_CFG_FREQ_16KHZ, BT_AUDIO_CODEC_CFG_DURATION_10,
+				  BT_AUDIO_LOCATION_FRONT_LEFT, 40U, 1U,
+				  BT_AUDIO_CONTEXT_TYPE_MEDIA),
+};
+
+struct bap_lc3_test_suite_fixture {
+	struct bt_bap_lc3_stream streams[TEST_STREAM_COUNT];
+	struct bt_bap_lc3_pcm_group group;
+};
+
+static void *bap_lc3_test_suite_setup(void)
+{
+	struct bap_lc3_test_suite_fixture *fixture = malloc(sizeof(*fixture));
+
+	zassert_not_null(fixture);
+
+	return fixture;
+}
+
+static void bap_lc3_test_suite_before(void *f)
+{
+	struct bap_lc3_test_suite_fixture *fixture = f;
+	int err;
+
+	memset(fixture, 0, sizeof(*fixture));
+	memset(test_sdus, 0, sizeof(test_sdus));
+	test_sdu_count = 0U;
+	test_buf_unavailable = false;
+	test_stream_pcm_get_count = 0U;
+	test_group_pcm_get_count = 0U;
+
+	fixture->group.pcm_get = test_group_pcm_get;
+	err = bt_bap_lc3_pcm_group_init(&fixture->group, 16000U, 10000U, 1U);
+	zassert_equal(err, 0, "Unexpected return value %d", err);
+
+	for (size_t i = 0U; i < ARRAY_SIZE(fixture->streams); i++) {
+		struct bt_bap_lc3_stream *stream = &fixture->streams[i];
+
+		/* The endpoint is only passed to bt_bap_ep_get_info() */
+		stream->bap_stream.ep = (struct bt_bap_ep *)fixture;
+		stream->bap_stream.codec_cfg = &test_codec_cfg[i];
+
+		err = bt_bap_lc3_stream_init(stream, NULL, &test_lc3_ops, &test_pool);
+		zassert_equal(err, 0, "Unexpected return value %d", err);
+
+		err = bt_bap_lc3_stream_set_pcm_group(stream, &fixture->group);
+		zassert_equal(err, 0, "Unexpected return value %d", err);
+	}
+}
+
+static void bap_lc3_test_suite_teardown(void *f)
+{
+	free(f);
+}
+
+ZTEST_SUITE(bap_lc3_test_suite, NULL, bap_lc3_test_suite_setup, bap_lc3_test_suite_before, NULL,
+	    bap_lc3_test_suite_teardown);
+
+static void test_stream_started(struct bt_bap_lc3_stream *stream)
+{
+	stream->bap_stream.ops->started(&stream->bap_stream);
+}
+
+static void test_stream_sent(struct bt_bap_lc3_stream *stream)
+{
+	stream->bap_stream.ops->sent(&stream->bap_stream);
+}
+
+ZTEST_F(bap_lc3_test_suite, test_pcm_group_single_pcm_get_per_interval)
+{
+	struct bt_bap_lc3_stream *streams = fixture->streams;
+	const size_t intervals = 4U;
+
+	/* Every stream sends its first SDU when it starts */
+	test_stream_started(&streams[0]);
+	test_stream_started(&streams[1]);
+
+	zassert_equal(test_group_pcm_get_count, 1U, "pcm_get called %zu times",
+		      test_group_pcm_get_count);
+
+	for (size_t i = 1U; i < intervals; i++) {
+		test_stream_sent(&streams[0]);
+		test_stream_sent(&streams[1]);
+
+		zassert_equal(test_group_pcm_get_count, i + 1U,
+			      "pcm_get called %zu times in %zu intervals",
+			      test_group_pcm_get_count, i + 1U);
+	}
+
+	zassert_equal(test_sdu_count, intervals * TEST_STREAM_COUNT, "%zu SDUs sent",
+		      test_sdu_count);
+
+	/* Both streams encode the same PCM at their own bitrate */
+	for (size_t i = 0U; i < intervals; i++) {
+		for (size_t s = 0U; s < TEST_STREAM_COUNT; s++) {
+			const struct test_sdu *sdu = &test_sdus[i * TEST_STREAM_COUNT + s];
+
+			zassert_equal_ptr(sdu->stream, &streams[s].bap_stream,
+					  "SDU %zu sent on wrong stream", i);
+			zassert_equal(sdu->seq_num, i, "SDU seq_num %u instead of %zu",
+				      sdu->seq_num, i);
+			zassert_equal(sdu->pcm, i + 1U, "SDU encoded from PCM %u instead of %zu",
+				      sdu->pcm, i + 1U);
+		}
+
+		zassert_equal(test_sdus[i * TEST_STREAM_COUNT].len, 30U, "SDU of %u octets",
+			      test_sdus[i * TEST_STREAM_COUNT].len);
+		zassert_equal(test_sdus[i * TEST_STREAM_COUNT + 1].len, 40U, "SDU of %u octets",
+			      test_sdus[i * TEST_STREAM_COUNT + 1].len);
+	}
+
+	zassert_equal(test_stream_pcm_get_count, 0U, "Stream pcm_get called %zu times",
+		      test_stream_pcm_get_count);
+}
+
+ZTEST_F(bap_lc3_test_suite, test_pcm_group_stream_catches_up)
+{
+	struct bt_bap_lc3_stream *streams = fixture->streams;
+	const struct test_sdu *sdu;
+
+	test_stream_started(&streams[0]);
+	test_stream_started(&streams[1]);
+
+	/* Second stream has no buffer for its SDUs of the next two intervals */
+	for (int i = 0; i < 2; i++) {
+		test_stream_sent(&streams[0]);
+
+		test_buf_unavailable = true;
+		test_stream_sent(&streams[1]);
+		test_buf_unavailable = false;
+	}
+
+	zassert_equal(test_group_pcm_get_count, 3U, "pcm_get called %zu times",
+		      test_group_pcm_get_count);
+	zassert_equal(test_sdu_count, 4U, "%zu SDUs sent", test_sdu_count);
+
+	/* It then sends the PCM the group already has, instead of the PCM it missed */
+	test_stream_sent(&streams[1]);
+
+	zassert_equal(test_group_pcm_get_count, 3U, "pcm_get called %zu times",
+		      test_group_pcm_get_count);
+	zassert_equal(test_sdu_count, 5U, "%zu SDUs sent", test_sdu_count);
+
+	sdu = &test_sdus[4];
+	zassert_equal_ptr(sdu->stream, &streams[1].bap_stream, "SDU sent on wrong stream");
+	zassert_equal(sdu->seq_num, 2U, "SDU seq_num %u instead of 2", sdu->seq_num);
+	zassert_equal(sdu->pcm, 3U, "SDU encoded from PCM %u instead of 3", sdu->pcm);
+
+	/* From there on both streams share the PCM again */
+	test_stream_sent(&streams[0]);
+	test_stream_sent(&streams[1]);
+
+	zassert_equal(test_group_pcm_get_count, 4U, "pcm_get called %zu times",
+		      test_group_pcm_get_count);
+	zassert_equal(test_sdus[5].seq_num, test_sdus[6].seq_num, "Streams out of step");
+	zassert_equal(test_sdus[5].pcm, test_sdus[6].pcm, "Streams encoded different PCM");
+	zassert_equal(test_stream_pcm_get_count, 0U, "Stream pcm_get called %zu times",
+		      test_stream_pcm_get_count);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MOCKS_LC3_H_
+#define MOCKS_LC3_H_
+
+#include <stdint.h>
+
+/*
+ * Fake of the liblc3 API used by the BAP LC3 stream module. Every encoded
+ * frame is filled with the low byte of the first PCM sample, so that a test
+ * can tell which PCM an SDU was encoded from.
+ */
+
+enum lc3_pcm_format {
+	LC3_PCM_FORMAT_S16,
+};
+
+#define LC3_CHECK_DT_US(us) ((us) == 7500 || (us) == 10000)
+
+#define LC3_CHECK_SR_HZ(sr)                                                                        \
+	((sr) == 8000 || (sr) == 16000 || (sr) == 24000 || (sr) == 32000 || (sr) == 48000)
+
+struct lc3_encoder {
+	int dt_us;
+	int sr_hz;
+};
+
+struct lc3_decoder {
+	int dt_us;
+	int sr_hz;
+};
+
+typedef struct lc3_encoder *lc3_encoder_t;
+typedef struct lc3_decoder *lc3_decoder_t;
+
+typedef struct lc3_encoder lc3_encoder_mem_48k_t;
+typedef struct lc3_decoder lc3_decoder_mem_48k_t;
+
+int lc3_frame_samples(int dt_us, int sr_hz);
+
+lc3_encoder_t lc3_setup_encoder(int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
+lc3_decoder_t lc3_setup_decoder(int dt_us, int sr_hz, int sr_pcm_hz, void *mem);
+
+int lc3_encode(lc3_encoder_t encoder, enum lc3_pcm_format fmt, const void *pcm, int stride,
+	       int nbytes, void *out);
+int lc3_decode(lc3_decoder_t decoder, const void *in, int nbytes, enum lc3_pcm_format fmt,
+	       void *pcm, int stride);
+
+#endif /* MOCKS_LC3_H_ */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <lc3.h>
+
+int lc3_frame_samples(int dt_us, int sr_hz)
+{
+	return (int)(((int64_t)dt_us * sr_hz) / 1000000);
+}
+
+lc3_encoder_t lc3_setup_encoder(int dt_us, int sr_hz, int sr_pcm_hz, void *mem)
+{
+	struct lc3_encoder *encoder = mem;
+
+	encoder->dt_us = dt_us;
+	encoder->sr_hz = sr_hz;
+
+	return encoder;
+}
+
+lc3_decoder_t lc3_setup_decoder(int dt_us, int sr_hz, int sr_pcm_hz, void *mem)
+{
+	struct lc3_decoder *decoder = mem;
+
+	decoder->dt_us = dt_us;
+	decoder->sr_hz = sr_hz;
+
+	return decoder;
+}
+
+int lc3_encode(lc3_encoder_t encoder, enum lc3_pcm_format fmt, const void *pcm, int stride,
+	       int nbytes, void *out)
+{
+	memset(out, (uint8_t)*(const int16_t *)pcm, nbytes);
+
+	return 0;
+}
+
+int lc3_decode(lc3_decoder_t decoder, const void *in, int nbytes, enum lc3_pcm_format fmt,
+	       void *pcm, int stride)
+{
+	int16_t *samples = pcm;
+
+	for (int i = 0; i < lc3_frame_samples(decoder->dt_us, decoder->sr_hz); i++) {
+		samples[i * stride] = 0;
+	}
+
+	/* Like liblc3, report a concealed frame when there is no data */
+	return in == NULL ? 1 : 0;
+}
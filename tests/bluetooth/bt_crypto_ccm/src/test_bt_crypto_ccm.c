@@ -70,3 +70,69 @@ ZTEST(bt_crypto_ccm, test_result_rfc_test_vectors)
 		free(decrypted_data);
 	}
 }
+
+ZTEST(bt_crypto_ccm, test_batch_rfc_test_vectors)
+{
+	const struct test_data *first = input_packets[0];
+	struct bt_ccm_op ops[NUMBER_OF_TEST];
+	uint8_t encrypted[NUMBER_OF_TEST][64];
+	uint8_t decrypted[NUMBER_OF_TEST][64];
+	size_t count = 0;
+	int err;
+
+	/* The vectors sharing the key and MIC size of the first one */
+	for (int i = 0; i < NUMBER_OF_TEST; i++) {
+		const struct test_data *p = input_packets[i];
+
+		if (memcmp(p->key, first->key, sizeof(p->key)) != 0 ||
+		    p->mic_len != first->mic_len) {
+			continue;
+		}
+
+		zassert_true(p->input_len + p->mic_len <= sizeof(encrypted[0]));
+
+		ops[count] = (struct bt_ccm_op){
+			.nonce = p->nonce,
+			.in = &p->input[p->aad_len],
+			.len = p->input_len - p->aad_len,
+			.aad = p->input,
+			.aad_len = p->aad_len,
+			.out = encrypted[count],
+		};
+		count++;
+	}
+
+	zassert_true(count > 1, "no vectors to batch");
+
+	err = bt_ccm_encrypt_batch(first->key, ops, count, first->mic_len);
+	zassert_equal(err, 0, "CCM batch encrypt failed with error %d", err);
+
+	for (size_t n = 0, i = 0; n < count; i++) {
+		const struct test_data *p = input_packets[i];
+
+		if (ops[n].aad != p->input) {
+			continue;
+		}
+
+		zassert_equal(ops[n].err, 0);
+		zassert_mem_equal(encrypted[n], &p->expected_output[p->aad_len],
+				  ops[n].len + p->mic_len,
+				  "Encrypted data are not correct for packet vector %d", i + 1);
+
+		ops[n].in = encrypted[n];
+		ops[n].out = decrypted[n];
+		n++;
+	}
+
+	/* A corrupted MIC fails its own operation only */
+	encrypted[0][ops[0].len] ^= 0x01;
+
+	err = bt_ccm_decrypt_batch(first->key, ops, count, first->mic_len);
+	zassert_equal(err, -EBADMSG, "CCM batch decrypt returned %d", err);
+	zassert_equal(ops[0].err, -EBADMSG);
+
+	for (size_t n = 1; n < count; n++) {
+		zassert_equal(ops[n].err, 0, "CCM decrypt failed for operation %zu", n);
+		zassert_mem_equal(decrypted[n], ops[n].aad + ops[n].aad_len, ops[n].len);
+	}
+}
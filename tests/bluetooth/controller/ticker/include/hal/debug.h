@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+
+#define LL_ASSERT(cond) zassert_true(cond, "LL_ASSERT(%s)", #cond)
+
+/* Called when ticker_job starts (1) and ends (0), to measure it */
+void ticker_test_job_debug(int flag);
+
+#define DEBUG_TICKER_ISR(flag)
+#define DEBUG_TICKER_TASK(flag)
+#define DEBUG_TICKER_JOB(flag) ticker_test_job_debug(flag)
@@ -0,0 +1,9 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host build of the ticker, no SoC */
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs the controller ticker on the host, against a simulated counter. The
+ * counter only moves when nothing is pending, straight to the compare value,
+ * so every expiry is seen at its exact tick and the worker and job run in
+ * zero simulated time. Host time spent in ticker_job is measured around it.
+ */
+
+#include <time.h>
+#include <zephyr/ztest.h>
+
+#include "hal/cntr.h"
+#include "hal/ticker.h"
+#include "ticker/ticker.h"
+
+#define TICKER_NODES    240
+#define TICKER_USER_OPS 16
+#define TICKER_USER_ID  0
+
+static uint8_t ticker_nodes[TICKER_NODES][TICKER_NODE_T_SIZE] __aligned(sizeof(void *));
+static uint8_t ticker_users[1][TICKER_USER_T_SIZE] __aligned(sizeof(void *));
+static uint8_t ticker_user_ops[TICKER_USER_OPS][TICKER_USER_OP_T_SIZE] __aligned(sizeof(void *));
+
+static struct {
+	void *instance;
+	uint32_t cnt;
+	uint32_t cmp;
+	bool running;
+	bool cmp_set;
+	bool worker_pending;
+	bool job_pending;
+} sim;
+
+static struct {
+	uint32_t count[TICKER_NODES];
+	uint32_t ticks_last[TICKER_NODES];
+	uint32_t ticks_prev;
+	bool out_of_order;
+	bool lazy;
+} expiry;
+
+static struct {
+	struct timespec start;
+	uint64_t total_ns;
+	uint64_t max_ns;
+	uint32_t jobs;
+} job_time;
+
+uint32_t cntr_start(void)
+{
+	if (sim.running) {
+		return 1;
+	}
+
+	sim.running = true;
+
+	return 0;
+}
+
+uint32_t cntr_stop(void)
+{
+	if (!sim.running) {
+		return 1;
+	}
+
+	sim.running = false;
+
+	return 0;
+}
+
+uint32_t cntr_cnt_get(void)
+{
+	return sim.cnt;
+}
+
+void ticker_test_job_debug(int flag)
+{
+	struct timespec now;
+	uint64_t ns;
+
+	if (flag) {
+		clock_gettime(CLOCK_MONOTONIC, &job_time.start);
+		return;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ns = (now.tv_sec - job_time.start.tv_sec) * 1000000000ULL + now.tv_nsec -
+	     job_time.start.tv_nsec;
+
+	job_time.total_ns += ns;
+	job_time.max_ns = MAX(job_time.max_ns, ns);
+	job_time.jobs++;
+}
+
+static uint8_t caller_id_get(uint8_t user_id)
+{
+	return TICKER_CALL_ID_PROGRAM;
+}
+
+static void sched(uint8_t caller_id, uint8_t callee_id, uint8_t chain, void *instance)
+{
+	sim.instance = instance;
+
+	if (callee_id == TICKER_CALL_ID_WORKER) {
+		sim.worker_pending = true;
+	} else {
+		sim.job_pending = true;
+	}
+}
+
+static void trigger_set(uint32_t value)
+{
+	sim.cmp = value;
+	sim.cmp_set = true;
+}
+
+static void sim_pending_run(void)
+{
+	while (sim.worker_pending || sim.job_pending) {
+		if (sim.worker_pending) {
+			sim.worker_pending = false;
+			ticker_worker(sim.instance);
+		} else {
+			sim.job_pending = false;
+			ticker_job(sim.instance);
+		}
+	}
+}
+
+/* Run until the counter reaches end, or nothing is scheduled any more */
+static void sim_run(uint32_t end)
+{
+	sim_pending_run();
+
+	while (sim.running && sim.cmp_set && sim.cmp <= end) {
+		sim.cnt = sim.cmp;
+		sim.cmp_set = false;
+
+		ticker_trigger(0);
+		sim_pending_run();
+	}
+
+	sim.cnt = end;
+}
+
+static void timeout(uint32_t ticks_at_expire, uint32_t ticks_drift, uint32_t remainder,
+		    uint16_t lazy, uint8_t force, void *context)
+{
+	uint8_t id = POINTER_TO_UINT(context);
+
+	/* No ticker may expire before one that was due earlier */
+	if (expiry.ticks_prev > ticks_at_expire) {
+		expiry.out_of_order = true;
+	}
+
+	expiry.ticks_prev = ticks_at_expire;
+	expiry.ticks_last[id] = ticks_at_expire;
+	expiry.count[id]++;
+
+	if (lazy) {
+		expiry.lazy = true;
+	}
+}
+
+static void ticker_start_checked(uint8_t id, uint32_t ticks_first, uint32_t ticks_periodic)
+{
+	uint32_t ret;
+
+	ret = ticker_start(0, TICKER_USER_ID, id, 0U, ticks_first, ticks_periodic,
+			   TICKER_NULL_REMAINDER, TICKER_NULL_LAZY, TICKER_NULL_SLOT, timeout,
+			   UINT_TO_POINTER(id), NULL, NULL);
+	zassert_equal(ret, TICKER_STATUS_BUSY, "start %u failed", id);
+
+	/* Let the job process the start before the user op queue fills up */
+	sim_pending_run();
+}
+
+static void check_expiries(uint8_t count, uint32_t end, uint32_t (*first)(uint8_t),
+			   uint32_t (*periodic)(uint8_t))
+{
+	zassert_false(expiry.out_of_order);
+	zassert_false(expiry.lazy);
+
+	for (uint8_t id = 0U; id < count; id++) {
+		uint32_t n = (end - first(id)) / periodic(id) + 1U;
+
+		zassert_equal(expiry.count[id], n, "ticker %u expired %u times, not %u", id,
+			      expiry.count[id], n);
+		zassert_equal(expiry.ticks_last[id], first(id) + (n - 1U) * periodic(id),
+			      "ticker %u expired late", id);
+	}
+}
+
+static void ticker_setup(void)
+{
+	memset(&sim, 0, sizeof(sim));
+	memset(&expiry, 0, sizeof(expiry));
+	memset(ticker_nodes, 0, sizeof(ticker_nodes));
+	memset(ticker_users, 0, sizeof(ticker_users));
+
+	/* The first byte of a user is the size of its operation queue */
+	ticker_users[0][0] = TICKER_USER_OPS;
+	zassert_equal(ticker_init(0, TICKER_NODES, ticker_nodes, 1, ticker_users,
+				  TICKER_USER_OPS, ticker_user_ops, caller_id_get, sched,
+				  trigger_set),
+		      TICKER_STATUS_SUCCESS);
+}
+
+/* Distinct periods, so that tickers keep overtaking each other in the list */
+static uint32_t mixed_first(uint8_t id)
+{
+	return 10U + id * 3U;
+}
+
+static uint32_t mixed_periodic(uint8_t id)
+{
+	return 100U + (id * 37U) % 300U;
+}
+
+ZTEST(ticker, test_expire_order)
+{
+	const uint32_t end = 20000U;
+
+	for (uint8_t id = 0U; id < TICKER_NODES; id++) {
+		ticker_start_checked(id, mixed_first(id), mixed_periodic(id));
+	}
+
+	sim_run(end);
+
+	check_expiries(TICKER_NODES, end, mixed_first, mixed_periodic);
+}
+
+/* Same period in four phases, a quarter of the tickers expire together */
+static uint32_t grouped_first(uint8_t id)
+{
+	return 10U + (id % 4U) * 60U;
+}
+
+static uint32_t grouped_periodic(uint8_t id)
+{
+	return 240U;
+}
+
+ZTEST(ticker, test_job_time)
+{
+	static const uint8_t counts[] = {8U, 32U, 64U, 128U, TICKER_NODES};
+	const uint32_t end = 240U * 1000U;
+
+	for (size_t i = 0; i < ARRAY_SIZE(counts); i++) {
+		for (uint8_t id = 0U; id < counts[i]; id++) {
+			ticker_start_checked(id, grouped_first(id), grouped_periodic(id));
+		}
+
+		/* Only time the jobs once all tickers run */
+		memset(&job_time, 0, sizeof(job_time));
+		sim_run(end);
+
+		TC_PRINT("%3u tickers: %u jobs, %llu ns average, %llu ns max\n", counts[i],
+			 job_time.jobs,
+			 (unsigned long long)(job_time.total_ns / MAX(job_time.jobs, 1U)),
+			 (unsigned long long)job_time.max_ns);
+
+		check_expiries(counts[i], end, grouped_first, grouped_periodic);
+
+		for (uint8_t id = 0U; id < counts[i]; id++) {
+			zassert_equal(ticker_stop(0, TICKER_USER_ID, id, NULL, NULL),
+				      TICKER_STATUS_BUSY);
+			sim_pending_run();
+		}
+
+		zassert_false(sim.running, "counter still running");
+
+		/* Restart from zero for the next round */
+		zassert_ok(ticker_deinit(0));
+		ticker_setup();
+	}
+}
+
+static void ticker_before(void *fixture)
+{
+	ticker_setup();
+}
+
+ZTEST_SUITE(ticker, NULL, NULL, ticker_before, NULL, NULL);
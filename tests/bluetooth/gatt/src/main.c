@@ -421,6 +421,55 @@ ZTEST(test_gatt, test_gatt_foreach)
 	}
 }
 
+static uint8_t check_attr_handle(const struct bt_gatt_attr *attr, uint16_t handle,
+				 void *user_data)
+{
+	uint16_t *count = user_data;
+
+	zassert_equal(bt_gatt_attr_get_handle(attr), handle, "Handle of attribute %p don't match",
+		      attr);
+	(*count)++;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static uint8_t first_handle(const struct bt_gatt_attr *attr, uint16_t handle, void *user_data)
+{
+	uint16_t *first = user_data;
+
+	*first = handle;
+
+	return BT_GATT_ITER_STOP;
+}
+
+ZTEST(test_gatt, test_gatt_static_handles)
+{
+	uint16_t num = 0;
+	uint16_t first;
+
+	/* Only the first test service follows the static ones */
+	bt_gatt_service_unregister(&test_svc);
+	bt_gatt_service_unregister(&test1_svc);
+
+	zassert_false(bt_gatt_service_register(&test_svc),
+		      "Test service registration failed");
+
+	/* Every attribute is found back from its handle and has that handle */
+	bt_gatt_foreach_attr(0x0001, 0xffff, check_attr_handle, &num);
+	zassert_true(num > test_svc.attr_count, "No static attributes found");
+
+	/* Iteration starts at the requested handle, in any static service */
+	for (uint16_t handle = 0x0001; handle < test_attrs[0].handle; handle++) {
+		first = 0;
+		bt_gatt_foreach_attr(handle, 0xffff, first_handle, &first);
+		zassert_equal(first, handle, "Iteration from 0x%04x started at 0x%04x", handle,
+			      first);
+	}
+
+	zassert_false(bt_gatt_service_register(&test1_svc),
+		      "Test service1 registration failed");
+}
+
 ZTEST(test_gatt, test_gatt_read)
 {
 	const struct bt_gatt_attr *attr;
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/buf.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/drivers/bluetooth.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT zephyr_bt_hci_test
+
+/* No ISO connection has this handle, so its data is dropped */
+#define TEST_ISO_HANDLE 0x0001
+
+struct driver_data {
+	bt_hci_recv_t recv;
+	/* Hand ISO data to the host while it is being disabled */
+	bool iso_on_close;
+};
+
+/* Command handler structure for cmd_handle(). */
+struct cmd_handler {
+	uint16_t opcode; /* HCI command opcode */
+	uint8_t len; /* HCI command response length */
+	void (*handler)(struct net_buf *buf, struct net_buf **evt, uint8_t len, uint16_t opcode);
+};
+
+/* Add event to net_buf. */
+static void evt_create(struct net_buf *buf, uint8_t evt, uint8_t len)
+{
+	struct bt_hci_evt_hdr *hdr;
+
+	hdr = net_buf_add(buf, sizeof(*hdr));
+	hdr->evt = evt;
+	hdr->len = len;
+}
+
+/* Create a command complete event. */
+static void *cmd_complete(struct net_buf **buf, uint8_t plen, uint16_t opcode)
+{
+	struct bt_hci_evt_cmd_complete *cc;
+
+	*buf = bt_buf_get_evt(BT_HCI_EVT_CMD_COMPLETE, false, K_FOREVER);
+	evt_create(*buf, BT_HCI_EVT_CMD_COMPLETE, sizeof(*cc) + plen);
+	cc = net_buf_add(*buf, sizeof(*cc));
+	cc->ncmd = 1U;
+	cc->opcode = sys_cpu_to_le16(opcode);
+
+	return net_buf_add(*buf, plen);
+}
+
+/* Generic command complete with success status. */
+static void generic_success(struct net_buf *buf, struct net_buf **evt, uint8_t len, uint16_t opcode)
+{
+	struct bt_hci_evt_cc_status *ccst;
+
+	ccst = cmd_complete(evt, len, opcode);
+
+	/* Fill any event parameters with zero */
+	(void)memset(ccst, 0, len);
+
+	ccst->status = BT_HCI_ERR_SUCCESS;
+}
+
+/* Command complete with all the feature and command bits set */
+static void all_bits_set(struct net_buf *buf, struct net_buf **evt, uint8_t len, uint16_t opcode)
+{
+	uint8_t *rp;
+
+	rp = cmd_complete(evt, len, opcode);
+	(void)memset(rp, 0xFF, len);
+	rp[0] = BT_HCI_ERR_SUCCESS;
+}
+
+/* Setup handlers needed for bt_enable to function. No LE feature is set, so
+ * the host does not set up ISO in the controller, but still processes the
+ * ISO data it is handed.
+ */
+static const struct cmd_handler cmds[] = {
+	{ BT_HCI_OP_READ_LOCAL_VERSION_INFO, sizeof(struct bt_hci_rp_read_local_version_info),
+	  generic_success },
+	{ BT_HCI_OP_READ_SUPPORTED_COMMANDS, sizeof(struct bt_hci_rp_read_supported_commands),
+	  all_bits_set },
+	{ BT_HCI_OP_READ_LOCAL_FEATURES, sizeof(struct bt_hci_rp_read_local_features),
+	  all_bits_set },
+	{ BT_HCI_OP_READ_BD_ADDR, sizeof(struct bt_hci_rp_read_bd_addr), generic_success },
+	{ BT_HCI_OP_SET_EVENT_MASK, sizeof(struct bt_hci_evt_cc_status), generic_success },
+	{ BT_HCI_OP_LE_SET_EVENT_MASK, sizeof(struct bt_hci_evt_cc_status), generic_success },
+	{ BT_HCI_OP_LE_READ_LOCAL_FEATURES, sizeof(struct bt_hci_rp_le_read_local_features),
+	  generic_success },
+	{ BT_HCI_OP_LE_READ_SUPP_STATES, sizeof(struct bt_hci_rp_le_read_supp_states),
+	  all_bits_set },
+	{ BT_HCI_OP_LE_RAND, sizeof(struct bt_hci_rp_le_rand), generic_success },
+	{ BT_HCI_OP_LE_SET_RANDOM_ADDRESS, sizeof(struct bt_hci_cp_le_set_random_address),
+	  generic_success },
+	{ BT_HCI_OP_RESET, 0, generic_success },
+};
+
+/* Create an HCI ISO data packet with a complete SDU */
+static struct net_buf *iso_data_create(uint16_t seq_num)
+{
+	static const uint8_t sdu[] = { 0x01, 0x02, 0x03, 0x04 };
+	struct bt_hci_iso_sdu_hdr *sdu_hdr;
+	struct bt_hci_iso_hdr *hdr;
+	struct net_buf *buf;
+
+	buf = bt_buf_get_rx(BT_BUF_ISO_IN, K_NO_WAIT);
+	zassert_not_null(buf, "No ISO RX buffer");
+
+	hdr = net_buf_add(buf, sizeof(*hdr));
+	hdr->handle = sys_cpu_to_le16(bt_iso_handle_pack(TEST_ISO_HANDLE, BT_ISO_SINGLE, 0));
+	hdr->len = sys_cpu_to_le16(sizeof(*sdu_hdr) + sizeof(sdu));
+
+	sdu_hdr = net_buf_add(buf, sizeof(*sdu_hdr));
+	sdu_hdr->sn = sys_cpu_to_le16(seq_num);
+	sdu_hdr->slen = sys_cpu_to_le16(bt_iso_pkt_len_pack(sizeof(sdu), BT_ISO_DATA_VALID));
+	net_buf_add_mem(buf, sdu, sizeof(sdu));
+
+	return buf;
+}
+
+/* Hand ISO data to the host, as much as there are ISO RX buffers */
+static void iso_data_send(const struct device *dev)
+{
+	struct driver_data *drv = dev->data;
+
+	for (uint16_t i = 0U; i < CONFIG_BT_ISO_RX_BUF_COUNT; i++) {
+		drv->recv(dev, iso_data_create(i));
+	}
+}
+
+/* HCI driver open. */
+static int driver_open(const struct device *dev, bt_hci_recv_t recv)
+{
+	struct driver_data *drv = dev->data;
+
+	drv->recv = recv;
+
+	return 0;
+}
+
+/* HCI driver close, racing the host with ISO data if asked to. */
+static int driver_close(const struct device *dev)
+{
+	struct driver_data *drv = dev->data;
+
+	if (drv->iso_on_close) {
+		iso_data_send(dev);
+	}
+
+	return 0;
+}
+
+/* HCI driver send, answering the commands from the handler table. */
+static int driver_send(const struct device *dev, struct net_buf *buf)
+{
+	struct driver_data *drv = dev->data;
+	struct bt_hci_cmd_hdr *chdr;
+	struct net_buf *evt = NULL;
+	uint16_t opcode;
+	uint8_t type = net_buf_pull_u8(buf);
+
+	zassert_equal(type, BT_HCI_H4_CMD, "Unexpected command buffer, got %u", type);
+
+	chdr = net_buf_pull_mem(buf, sizeof(*chdr));
+	opcode = sys_le16_to_cpu(chdr->opcode);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cmds); i++) {
+		if (cmds[i].opcode == opcode) {
+			cmds[i].handler(buf, &evt, cmds[i].len, opcode);
+			break;
+		}
+	}
+
+	zassert_not_null(evt, "Unknown HCI command 0x%04x", opcode);
+
+	net_buf_unref(buf);
+	drv->recv(dev, evt);
+
+	return 0;
+}
+
+static DEVICE_API(bt_hci, driver_api) = {
+	.open = driver_open,
+	.close = driver_close,
+	.send = driver_send,
+};
+
+#define TEST_DEVICE_INIT(inst) \
+	static struct driver_data driver_data_##inst = { \
+	}; \
+	DEVICE_DT_INST_DEFINE(inst, NULL, NULL, &driver_data_##inst, NULL, \
+			      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &driver_api)
+
+DT_INST_FOREACH_STATUS_OKAY(TEST_DEVICE_INIT)
+
+/* Check that every ISO RX buffer is back in its pool */
+static void assert_iso_rx_bufs_free(void)
+{
+	struct net_buf *bufs[CONFIG_BT_ISO_RX_BUF_COUNT];
+
+	for (size_t i = 0U; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = bt_buf_get_rx(BT_BUF_ISO_IN, K_NO_WAIT);
+		zassert_not_null(bufs[i], "ISO RX buffer %zu not released", i);
+	}
+
+	for (size_t i = 0U; i < ARRAY_SIZE(bufs); i++) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
+static void *iso_rx_wq_setup(void)
+{
+	zassert_ok(bt_enable(NULL), "bt_enable failed");
+
+	return NULL;
+}
+
+ZTEST_SUITE(iso_rx_wq, NULL, iso_rx_wq_setup, NULL, NULL, NULL);
+
+/**
+ * @brief Test ISO data for a handle without a connected channel
+ *
+ * @details The data shall be processed in the ISO RX work queue and dropped,
+ * releasing its buffers.
+ */
+ZTEST(iso_rx_wq, test_data_not_connected)
+{
+	iso_data_send(DEVICE_DT_GET(DT_DRV_INST(0)));
+
+	/* Let the ISO RX work queue run */
+	k_sleep(K_MSEC(10));
+
+	assert_iso_rx_bufs_free();
+}
+
+/**
+ * @brief Test disabling the host with ISO data not processed yet
+ *
+ * @details The data handed to the host while it is being disabled shall be
+ * dropped with the ISO RX work queue, and the host shall be able to be
+ * enabled again.
+ */
+ZTEST(iso_rx_wq, test_disable_flush)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_DRV_INST(0));
+	struct driver_data *drv = dev->data;
+
+	/* The test thread is cooperative, so the ISO RX work queue does not run
+	 * between the driver close and its abort.
+	 */
+	drv->iso_on_close = true;
+	zassert_ok(bt_disable(), "bt_disable failed");
+	drv->iso_on_close = false;
+
+	assert_iso_rx_bufs_free();
+
+	zassert_ok(bt_enable(NULL), "bt_enable failed");
+
+	iso_data_send(dev);
+	k_sleep(K_MSEC(10));
+
+	assert_iso_rx_bufs_free();
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/buf.h>
+#include <zephyr/bluetooth/hci.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/drivers/bluetooth.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT zephyr_bt_hci_test
+
+#define DEDUP_TIMEOUT_MS 100
+
+struct driver_data {
+	bt_hci_recv_t recv;
+};
+
+/* Command handler structure for cmd_handle(). */
+struct cmd_handler {
+	uint16_t opcode; /* HCI command opcode */
+	uint8_t len; /* HCI command response length */
+	void (*handler)(struct net_buf *buf, struct net_buf **evt, uint8_t len, uint16_t opcode);
+};
+
+/* Add event to net_buf. */
+static void evt_create(struct net_buf *buf, uint8_t evt, uint8_t len)
+{
+	struct bt_hci_evt_hdr *hdr;
+
+	hdr = net_buf_add(buf, sizeof(*hdr));
+	hdr->evt = evt;
+	hdr->len = len;
+}
+
+/* Create a command complete event. */
+static void *cmd_complete(struct net_buf **buf, uint8_t plen, uint16_t opcode)
+{
+	struct bt_hci_evt_cmd_complete *cc;
+
+	*buf = bt_buf_get_evt(BT_HCI_EVT_CMD_COMPLETE, false, K_FOREVER);
+	evt_create(*buf, BT_HCI_EVT_CMD_COMPLETE, sizeof(*cc) + plen);
+	cc = net_buf_add(*buf, sizeof(*cc));
+	cc->ncmd = 1U;
+	cc->opcode = sys_cpu_to_le16(opcode);
+
+	return net_buf_add(*buf, plen);
+}
+
+/* Generic command complete with success status. */
+static void generic_success(struct net_buf *buf, struct net_buf **evt, uint8_t len, uint16_t opcode)
+{
+	struct bt_hci_evt_cc_status *ccst;
+
+	ccst = cmd_complete(evt, len, opcode);
+
+	/* Fill any event parameters with zero */
+	(void)memset(ccst, 0, len);
+
+	ccst->status = BT_HCI_ERR_SUCCESS;
+}
+
+/* Command complete with all the feature and command bits set */
+static void all_bits_set(struct net_buf *buf, struct net_buf **evt, uint8_t len, uint16_t opcode)
+{
+	uint8_t *rp;
+
+	rp = cmd_complete(evt, len, opcode);
+	(void)memset(rp, 0xFF, len);
+	rp[0] = BT_HCI_ERR_SUCCESS;
+}
+
+/* Setup handlers needed for bt_enable and scanning to function. */
+static const struct cmd_handler cmds[] = {
+	{ BT_HCI_OP_READ_LOCAL_VERSION_INFO, sizeof(struct bt_hci_rp_read_local_version_info),
+	  generic_success },
+	{ BT_HCI_OP_READ_SUPPORTED_COMMANDS, sizeof(struct bt_hci_rp_read_supported_commands),
+	  all_bits_set },
+	{ BT_HCI_OP_READ_LOCAL_FEATURES, sizeof(struct bt_hci_rp_read_local_features),
+	  all_bits_set },
+	{ BT_HCI_OP_READ_BD_ADDR, sizeof(struct bt_hci_rp_read_bd_addr), generic_success },
+	{ BT_HCI_OP_SET_EVENT_MASK, sizeof(struct bt_hci_evt_cc_status), generic_success },
+	{ BT_HCI_OP_LE_SET_EVENT_MASK, sizeof(struct bt_hci_evt_cc_status), generic_success },
+	{ BT_HCI_OP_LE_READ_LOCAL_FEATURES, sizeof(struct bt_hci_rp_le_read_local_features),
+	  all_bits_set },
+	{ BT_HCI_OP_LE_READ_SUPP_STATES, sizeof(struct bt_hci_rp_le_read_supp_states),
+	  all_bits_set },
+	{ BT_HCI_OP_LE_RAND, sizeof(struct bt_hci_rp_le_rand), generic_success },
+	{ BT_HCI_OP_LE_SET_RANDOM_ADDRESS, sizeof(struct bt_hci_cp_le_set_random_address),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_EXT_SCAN_PARAM, 0, generic_success },
+	{ BT_HCI_OP_LE_SET_EXT_SCAN_ENABLE, 0, generic_success },
+	{ BT_HCI_OP_RESET, 0, generic_success },
+};
+
+/* HCI driver open. */
+static int driver_open(const struct device *dev, bt_hci_recv_t recv)
+{
+	struct driver_data *drv = dev->data;
+
+	drv->recv = recv;
+
+	return 0;
+}
+
+/* HCI driver send, answering the commands from the handler table. */
+static int driver_send(const struct device *dev, struct net_buf *buf)
+{
+	struct driver_data *drv = dev->data;
+	struct bt_hci_cmd_hdr *chdr;
+	struct net_buf *evt = NULL;
+	uint16_t opcode;
+	uint8_t type = net_buf_pull_u8(buf);
+
+	zassert_equal(type, BT_HCI_H4_CMD, "Unexpected command buffer, got %u", type);
+
+	chdr = net_buf_pull_mem(buf, sizeof(*chdr));
+	opcode = sys_le16_to_cpu(chdr->opcode);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cmds); i++) {
+		if (cmds[i].opcode == opcode) {
+			cmds[i].handler(buf, &evt, cmds[i].len, opcode);
+			break;
+		}
+	}
+
+	zassert_not_null(evt, "Unknown HCI command 0x%04x", opcode);
+
+	net_buf_unref(buf);
+	drv->recv(dev, evt);
+
+	return 0;
+}
+
+static DEVICE_API(bt_hci, driver_api) = {
+	.open = driver_open,
+	.send = driver_send,
+};
+
+#define TEST_DEVICE_INIT(inst) \
+	static struct driver_data driver_data_##inst = { \
+	}; \
+	DEVICE_DT_INST_DEFINE(inst, NULL, NULL, &driver_data_##inst, NULL, \
+			      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &driver_api)
+
+DT_INST_FOREACH_STATUS_OKAY(TEST_DEVICE_INIT)
+
+static const uint8_t report_data[] = { 0x02, BT_DATA_FLAGS, BT_LE_AD_NO_BREDR };
+static bt_addr_le_t addr_a;
+static bt_addr_le_t addr_b;
+static unsigned int reports;
+
+/* Hand a legacy advertising report of addr to the host, from the system work queue */
+static struct net_buf *report_buf;
+static K_SEM_DEFINE(report_sem, 0, 1);
+
+static void report_work_handler(struct k_work *work)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_DRV_INST(0));
+	struct driver_data *drv = dev->data;
+
+	ARG_UNUSED(work);
+
+	drv->recv(dev, report_buf);
+	k_sem_give(&report_sem);
+}
+
+static K_WORK_DEFINE(report_work, report_work_handler);
+
+static void send_report(const bt_addr_le_t *addr)
+{
+	struct bt_hci_evt_le_ext_advertising_info *info;
+	struct bt_hci_evt_le_meta_event *meta;
+	struct net_buf *buf;
+
+	buf = bt_buf_get_rx(BT_BUF_EVT, K_FOREVER);
+	evt_create(buf, BT_HCI_EVT_LE_META_EVENT,
+		   sizeof(*meta) + 1 + sizeof(*info) + sizeof(report_data));
+	meta = net_buf_add(buf, sizeof(*meta));
+	meta->subevent = BT_HCI_EVT_LE_EXT_ADVERTISING_REPORT;
+	net_buf_add_u8(buf, 1); /* Number of reports */
+
+	info = net_buf_add(buf, sizeof(*info));
+	(void)memset(info, 0, sizeof(*info));
+	info->evt_type = sys_cpu_to_le16(BT_HCI_LE_ADV_EVT_TYPE_LEGACY |
+					 (BT_HCI_LE_ADV_EVT_TYPE_DATA_STATUS_COMPLETE << 5));
+	bt_addr_le_copy(&info->addr, addr);
+	bt_addr_le_copy(&info->direct_addr, BT_ADDR_LE_NONE);
+	info->length = sizeof(report_data);
+	net_buf_add_mem(buf, report_data, sizeof(report_data));
+
+	report_buf = buf;
+	k_work_submit(&report_work);
+	k_sem_take(&report_sem, K_FOREVER);
+}
+
+static void scan_recv_cb(const struct bt_le_scan_recv_info *info, struct net_buf_simple *buf)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(buf);
+
+	reports++;
+}
+
+static struct bt_le_scan_cb scan_callbacks = {
+	.recv = scan_recv_cb,
+};
+
+static void *scan_filter_setup(void)
+{
+	zassert_ok(bt_enable(NULL), "bt_enable failed");
+
+	bt_addr_le_create_static(&addr_a);
+	bt_addr_le_create_static(&addr_b);
+
+	bt_le_scan_cb_register(&scan_callbacks);
+	zassert_ok(bt_le_scan_start(BT_LE_SCAN_PASSIVE, NULL), "bt_le_scan_start failed");
+
+	return NULL;
+}
+
+static void scan_filter_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	reports = 0U;
+}
+
+ZTEST_SUITE(scan_filter, NULL, scan_filter_setup, scan_filter_before, NULL, NULL);
+
+/**
+ * @brief Test a report repeated faster than the duplicate timeout
+ *
+ * @details The duplicates dropped shall not extend the timeout, the report
+ * shall pass again once per timeout.
+ */
+ZTEST(scan_filter, test_dedup_repeated_report)
+{
+	const struct bt_le_scan_filter filter = {
+		.options = BT_LE_SCAN_FILTER_OPT_DEDUP,
+		.dedup_timeout = DEDUP_TIMEOUT_MS,
+	};
+
+	zassert_ok(bt_le_scan_filter_set(&filter));
+
+	send_report(&addr_a);
+	zassert_equal(reports, 1U);
+
+	k_sleep(K_MSEC(DEDUP_TIMEOUT_MS * 6 / 10));
+	send_report(&addr_a);
+	zassert_equal(reports, 1U, "Duplicate passed");
+
+	k_sleep(K_MSEC(DEDUP_TIMEOUT_MS * 6 / 10));
+	send_report(&addr_a);
+	zassert_equal(reports, 2U, "Report not passed after the timeout");
+
+	zassert_ok(bt_le_scan_filter_set(NULL));
+}
+
+/**
+ * @brief Test a report dropped by the rate limit
+ *
+ * @details A report dropped by the rate limit shall not count as a duplicate
+ * of a later report.
+ */
+ZTEST(scan_filter, test_dedup_rate_limited)
+{
+	const struct bt_le_scan_filter filter = {
+		.options = BT_LE_SCAN_FILTER_OPT_DEDUP,
+		.max_rate = 1U,
+	};
+
+	zassert_ok(bt_le_scan_filter_set(&filter));
+
+	send_report(&addr_a);
+	send_report(&addr_b);
+	zassert_equal(reports, 1U, "Rate limit not applied");
+
+	k_sleep(K_MSEC(MSEC_PER_SEC));
+	send_report(&addr_a);
+	send_report(&addr_b);
+	zassert_equal(reports, 2U, "Report dropped by the rate limit treated as a duplicate");
+
+	zassert_ok(bt_le_scan_filter_set(NULL));
+}
@@ -289,6 +289,58 @@ static void broadcast_sink_stopped_cb(struct bt_bap_broadcast_sink *sink, uint8_
 	}
 }
 
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+/* Number of complete BIG events to receive before the data counts as received */
+#define GROUPED_RECV_EVENTS 10U
+
+static size_t grouped_recv_cnt;
+
+static void broadcast_sink_grouped_recv_cb(struct bt_bap_broadcast_sink *sink,
+					   const struct bt_iso_recv_info *info,
+					   const struct bt_bap_broadcast_sink_sdu *sdus, size_t count)
+{
+	bool complete = true;
+
+	if (count != stream_sync_cnt) {
+		FAIL("Grouped SDUs of %zu streams instead of %zu\n", count, stream_sync_cnt);
+		return;
+	}
+
+	for (size_t i = 0U; i < count; i++) {
+		if (sdus[i].stream != streams[i]) {
+			FAIL("SDU %zu of stream %p instead of %p\n", i, sdus[i].stream,
+			     streams[i]);
+			return;
+		}
+
+		if (sdus[i].buf == NULL) {
+			complete = false;
+			continue;
+		}
+
+		if (sdus[i].info.seq_num != info->seq_num) {
+			FAIL("SDU %zu of sequence number %u grouped with %u\n", i,
+			     sdus[i].info.seq_num, info->seq_num);
+			return;
+		}
+	}
+
+	/* A missing SDU shall not be reported as valid */
+	if (!complete && (info->flags & BT_ISO_FLAGS_VALID) != 0) {
+		FAIL("Incomplete BIG event %u reported as valid\n", info->seq_num);
+		return;
+	}
+
+	if (complete && (info->flags & BT_ISO_FLAGS_VALID) != 0) {
+		grouped_recv_cnt++;
+		if (grouped_recv_cnt == GROUPED_RECV_EVENTS) {
+			printk("Received %zu complete BIG events\n", grouped_recv_cnt);
+			SET_FLAG(flag_audio_received);
+		}
+	}
+}
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
+
 static struct bt_bap_broadcast_sink_cb broadcast_sink_cbs = {
 	.base_recv = base_recv_cb,
 	.syncable = syncable_cb,
@@ -980,6 +1032,29 @@ static void test_main(void)
 	PASS("Broadcast sink passed\n");
 }
 
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+static void test_main_grouped_recv(void)
+{
+	/* Replaces the recv callback of the streams */
+	broadcast_sink_cbs.recv = broadcast_sink_grouped_recv_cb;
+
+	test_common();
+
+	backchannel_sync_send_all(); /* let the broadcast source know it can stop */
+
+	printk("Waiting for PA disconnected\n");
+	WAIT_FOR_FLAG(flag_pa_sync_lost);
+
+	printk("Waiting for %zu streams to be stopped\n", stream_sync_cnt);
+	for (size_t i = 0U; i < stream_sync_cnt; i++) {
+		k_sem_take(&sem_stream_stopped, K_FOREVER);
+	}
+	WAIT_FOR_UNSET_FLAG(flag_sink_started);
+
+	PASS("Broadcast sink grouped reception passed\n");
+}
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
+
 static void test_main_update(void)
 {
 	test_common();
@@ -1277,6 +1352,14 @@ static const struct bst_test_instance test_broadcast_sink[] = {
 		.test_tick_f = test_tick,
 		.test_main_f = broadcast_sink_with_assistant_incorrect_code,
 	},
+#if defined(CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV)
+	{
+		.test_id = "broadcast_sink_grouped_recv",
+		.test_pre_init_f = test_init,
+		.test_tick_f = test_tick,
+		.test_main_f = test_main_grouped_recv,
+	},
+#endif /* CONFIG_BT_BAP_BROADCAST_SINK_GROUPED_RECV */
 	BSTEST_END_MARKER,
 };
 
@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+#
+# Copyright (c) 2026 Audio Inventions Ltd
+#
+# SPDX-License-Identifier: Apache-2.0
+
+VERBOSITY_LEVEL=2
+EXECUTE_TIMEOUT=120
+
+source ${ZEPHYR_BASE}/tests/bsim/sh_common.source
+
+cd ${BSIM_OUT_PATH}/bin
+
+printf "\n\n======== Broadcaster grouped reception test =========\n\n"
+
+SIMULATION_ID="bap_broadcast_audio_grouped_recv"
+
+Execute ./bs_${BOARD_TS}_tests_bsim_bluetooth_audio_prj_conf \
+  -v=${VERBOSITY_LEVEL} -s=${SIMULATION_ID} -d=0 -testid=broadcast_source \
+  -RealEncryption=1 -rs=23 -D=2
+
+
+Execute ./bs_${BOARD_TS}_tests_bsim_bluetooth_audio_prj_conf \
+  -v=${VERBOSITY_LEVEL} -s=${SIMULATION_ID} -d=1 -testid=broadcast_sink_grouped_recv \
+  -RealEncryption=1 -rs=27 -D=2
+
+# Simulation time should be larger than the WAIT_TIME in common.h
+Execute ./bs_2G4_phy_v1 -v=${VERBOSITY_LEVEL} -s=${SIMULATION_ID} \
+  -D=2 -sim_length=60e6 $@
+
+wait_for_background_jobs
@@ -27,6 +27,9 @@
 #include "common.h"
 
 #define ENQUEUE_COUNT 2
+#define SCHED_COUNT   10
+/* SDU intervals between the last SDU sent directly and the first scheduled one */
+#define SCHED_LEAD    4
 
 extern enum bst_result_t bst_result;
 static struct bt_iso_chan iso_chans[CONFIG_BT_ISO_MAX_CHAN];
@@ -39,6 +42,15 @@ static uint32_t interval_us = 10U * USEC_PER_MSEC; /* 10 ms */
 NET_BUF_POOL_FIXED_DEFINE(tx_pool, ENQUEUE_COUNT, BT_ISO_SDU_BUF_SIZE(CONFIG_BT_ISO_TX_MTU),
 			  CONFIG_BT_CONN_TX_USER_DATA_SIZE, NULL);
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+NET_BUF_POOL_FIXED_DEFINE(sched_tx_pool, SCHED_COUNT, BT_ISO_SDU_BUF_SIZE(CONFIG_BT_ISO_TX_MTU),
+			  CONFIG_BT_CONN_TX_USER_DATA_SIZE, NULL);
+static bool sched_mode;
+static atomic_t sched_sent_cnt;
+
+DEFINE_FLAG_STATIC(flag_tx_underrun);
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 BUILD_ASSERT(CONFIG_BT_ISO_MAX_CHAN > 1, "CONFIG_BT_ISO_MAX_CHAN shall be at least 2");
 
 DEFINE_FLAG_STATIC(flag_iso_connected);
@@ -130,8 +142,15 @@ static void iso_connected(struct bt_iso_chan *chan)
 	enqueue_cnt = ENQUEUE_COUNT;
 
 	if (chan == default_chan) {
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+		/* The scheduled TX test sends its own SDUs */
+		if (!sched_mode) {
+			k_work_schedule(&iso_send_work, K_MSEC(0));
+		}
+#else
 		/* Start send timer */
 		k_work_schedule(&iso_send_work, K_MSEC(0));
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 
 		SET_FLAG(flag_iso_connected);
 	}
@@ -165,6 +184,13 @@ static void sdu_sent_cb(struct bt_iso_chan *chan)
 {
 	int err;
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	if (sched_mode) {
+		atomic_inc(&sched_sent_cnt);
+		return;
+	}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 	enqueue_cnt++;
 
 	if (!IS_FLAG_SET(flag_iso_connected)) {
@@ -178,12 +204,24 @@ static void sdu_sent_cb(struct bt_iso_chan *chan)
 	}
 }
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+static void tx_underrun_cb(struct bt_iso_chan *chan)
+{
+	printk("ISO Channel %p TX underrun\n", chan);
+
+	SET_FLAG(flag_tx_underrun);
+}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 static void init(void)
 {
 	static struct bt_iso_chan_ops iso_ops = {
 		.connected = iso_connected,
 		.disconnected = iso_disconnected,
 		.sent = sdu_sent_cb,
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+		.tx_underrun = tx_underrun_cb,
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 	};
 	static struct bt_iso_chan_io_qos iso_tx = {
 		.sdu = CONFIG_BT_ISO_TX_MTU,
@@ -509,6 +547,69 @@ static void test_main_disable(void)
 	TEST_PASS("Disable test passed");
 }
 
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+static struct net_buf *sched_buf_alloc(struct net_buf_pool *pool)
+{
+	static const uint8_t buf_data[CONFIG_BT_ISO_TX_MTU];
+	struct net_buf *buf;
+
+	buf = net_buf_alloc(pool, K_FOREVER);
+	net_buf_reserve(buf, BT_ISO_CHAN_SEND_RESERVE);
+	net_buf_add_mem(buf, buf_data, sizeof(buf_data));
+
+	return buf;
+}
+
+static void test_main_sched(void)
+{
+	struct bt_iso_tx_info tx_info;
+	struct net_buf *buf;
+	int err;
+
+	sched_mode = true;
+
+	init();
+	create_cig(1);
+	connect_acl();
+	connect_cis();
+
+	/* One SDU sent directly gives the timestamp and sequence number to start from */
+	buf = sched_buf_alloc(&tx_pool);
+	err = bt_iso_chan_send(default_chan, buf, 0U);
+	TEST_ASSERT(err == 0, "Failed to send ISO data (%d)", err);
+
+	while (atomic_get(&sched_sent_cnt) < 1) {
+		k_sleep(K_USEC(interval_us));
+	}
+
+	err = bt_iso_chan_get_tx_sync(default_chan, &tx_info);
+	TEST_ASSERT(err == 0, "Failed to read TX sync (%d)", err);
+
+	/* Queue all the SDUs ahead, more than the controller is handed at a time */
+	for (uint16_t i = SCHED_LEAD; i < SCHED_LEAD + SCHED_COUNT; i++) {
+		buf = sched_buf_alloc(&sched_tx_pool);
+		err = bt_iso_chan_send_sched(default_chan, buf, tx_info.seq_num + i,
+					     tx_info.ts + i * interval_us);
+		TEST_ASSERT(err == 0, "Failed to queue ISO data (%d)", err);
+	}
+
+	WAIT_FOR_FLAG(flag_tx_underrun);
+
+	TEST_ASSERT(atomic_get(&sched_sent_cnt) == 1 + SCHED_COUNT,
+		    "%ld SDUs sent instead of %u", atomic_get(&sched_sent_cnt),
+		    1 + SCHED_COUNT);
+	TEST_ASSERT(atomic_get(&sched_tx_pool.avail_count) == SCHED_COUNT,
+		    "sched_tx_pool has non returned buffers, should be %u but is %u",
+		    SCHED_COUNT, atomic_get(&sched_tx_pool.avail_count));
+
+	disconnect_cis();
+	disconnect_acl();
+	terminate_cig();
+
+	TEST_PASS("Scheduled TX test passed");
+}
+#endif /* CONFIG_BT_ISO_TX_SCHED */
+
 static const struct bst_test_instance test_def[] = {
 	{
 		.test_id = "central",
@@ -520,6 +621,13 @@ static const struct bst_test_instance test_def[] = {
 		.test_descr = "CIS central that tests bt_disable for ISO",
 		.test_main_f = test_main_disable,
 	},
+#if defined(CONFIG_BT_ISO_TX_SCHED)
+	{
+		.test_id = "central_sched",
+		.test_descr = "CIS central that queues SDUs ahead with bt_iso_chan_send_sched",
+		.test_main_f = test_main_sched,
+	},
+#endif /* CONFIG_BT_ISO_TX_SCHED */
 	BSTEST_END_MARKER,
 };
 
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/drivers/adc/adc_emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_ADC_STREAM
+#include <zephyr/rtio/rtio.h>
+
+#define ADC_DEVICE_NODE		DT_INST(0, zephyr_adc_emul)
+#define STREAM_CHANNELS		(BIT(0) | BIT(1))
+#define STREAM_RESOLUTION	12
+#define STREAM_FRAMES		8
+#define STREAM_INTERVAL_US	1000
+#define STREAM_BLOCK_SIZE	ADC_STREAM_BLOCK_SIZE(STREAM_CHANNELS, STREAM_FRAMES)
+#define STREAM_BLOCKS		4
+
+#define CH0_RAW			100
+#define CH1_RAW			200
+
+/* Paced by the emulator, natively */
+ADC_DT_IODEV_DEFINE(adc_stream_iodev, ADC_DEVICE_NODE, STREAM_CHANNELS,
+		    STREAM_RESOLUTION, STREAM_FRAMES, STREAM_INTERVAL_US, 0);
+/* Back to back, left to adc_read() by the emulator */
+ADC_DT_IODEV_DEFINE(adc_stream_fallback_iodev, ADC_DEVICE_NODE, STREAM_CHANNELS,
+		    STREAM_RESOLUTION, STREAM_FRAMES, 0, 0);
+
+RTIO_DEFINE_WITH_MEMPOOL(adc_stream_rtio, 4, 8, 2 * STREAM_BLOCKS, STREAM_BLOCK_SIZE, 4);
+
+static const struct device *const adc_dev = DEVICE_DT_GET(ADC_DEVICE_NODE);
+
+/* Checks a completed block and returns its header */
+static struct adc_stream_header check_block(struct rtio_cqe *cqe)
+{
+	struct adc_stream_header hdr;
+	int32_t values[STREAM_FRAMES];
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	zassert_equal(cqe->result, STREAM_BLOCK_SIZE, "read failed (%d)", cqe->result);
+	zassert_ok(rtio_cqe_get_mempool_buffer(&adc_stream_rtio, cqe, &buf, &buf_len));
+
+	memcpy(&hdr, buf, sizeof(hdr));
+	zassert_equal(hdr.channels, STREAM_CHANNELS);
+	zassert_equal(hdr.frames, STREAM_FRAMES);
+	zassert_equal(hdr.resolution, STREAM_RESOLUTION);
+
+	ret = adc_stream_decode(buf, cqe->result, 1, values, ARRAY_SIZE(values));
+	zassert_equal(ret, STREAM_FRAMES);
+	for (int i = 0; i < STREAM_FRAMES; i++) {
+		zassert_equal(values[i], CH1_RAW, "channel 1 frame %d: %d", i, values[i]);
+	}
+
+	ret = adc_stream_decode(buf, cqe->result, 0, values, 2);
+	zassert_equal(ret, 2);
+	zassert_equal(values[0], CH0_RAW);
+	zassert_equal(values[1], CH0_RAW);
+
+	/* Channel not in the stream */
+	zassert_equal(adc_stream_decode(buf, cqe->result, 2, values, 1), -EINVAL);
+
+	rtio_release_buffer(&adc_stream_rtio, buf, buf_len);
+	rtio_cqe_release(&adc_stream_rtio, cqe);
+
+	return hdr;
+}
+
+static void read_one(const struct rtio_iodev *iodev)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(&adc_stream_rtio);
+
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read_with_pool(sqe, iodev, RTIO_PRIO_NORM, NULL);
+	rtio_submit(&adc_stream_rtio, 0);
+}
+
+static void drain(void)
+{
+	struct rtio_cqe *cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	while ((cqe = rtio_cqe_consume(&adc_stream_rtio)) != NULL) {
+		if (rtio_cqe_get_mempool_buffer(&adc_stream_rtio, cqe, &buf, &buf_len) == 0) {
+			rtio_release_buffer(&adc_stream_rtio, buf, buf_len);
+		}
+		rtio_cqe_release(&adc_stream_rtio, cqe);
+	}
+}
+
+ZTEST(adc_emul_stream, test_stream_multishot)
+{
+	struct rtio_sqe sqe;
+	struct rtio_sqe *handle;
+	struct adc_stream_header hdr;
+	uint64_t timestamp = 0;
+	int16_t sample;
+	struct adc_sequence sequence = {
+		.channels = BIT(0),
+		.buffer = &sample,
+		.buffer_size = sizeof(sample),
+		.resolution = STREAM_RESOLUTION,
+	};
+
+	rtio_sqe_prep_read_multishot(&sqe, &adc_stream_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_sqe_copy_in_get_handles(&adc_stream_rtio, &sqe, &handle, 1));
+	rtio_submit(&adc_stream_rtio, 0);
+
+	for (int i = 0; i < STREAM_BLOCKS; i++) {
+		hdr = check_block(rtio_cqe_consume_block(&adc_stream_rtio));
+
+		/* Blocks follow each other, nothing dropped in between */
+		zassert_equal(hdr.dropped, 0, "block %d after %u dropped", i, hdr.dropped);
+		zassert_equal(hdr.interval_us, STREAM_INTERVAL_US);
+		zassert_true(hdr.timestamp > timestamp);
+		timestamp = hdr.timestamp;
+	}
+
+	zassert_ok(rtio_sqe_cancel(handle));
+	zassert_ok(adc_stream_stop(&adc_stream_iodev));
+	zassert_equal(adc_stream_stop(&adc_stream_iodev), -EALREADY);
+
+	k_msleep(2 * STREAM_FRAMES * STREAM_INTERVAL_US / USEC_PER_MSEC);
+	drain();
+
+	/* The device is released */
+	zassert_ok(adc_read(adc_dev, &sequence));
+	zassert_equal(sample, CH0_RAW);
+}
+
+ZTEST(adc_emul_stream, test_stream_dropped)
+{
+	struct adc_stream_header hdr;
+
+	read_one(&adc_stream_iodev);
+	hdr = check_block(rtio_cqe_consume_block(&adc_stream_rtio));
+	zassert_equal(hdr.dropped, 0);
+
+	/* The capture keeps running without a pending read */
+	k_msleep(3 * STREAM_FRAMES * STREAM_INTERVAL_US / USEC_PER_MSEC);
+
+	read_one(&adc_stream_iodev);
+	hdr = check_block(rtio_cqe_consume_block(&adc_stream_rtio));
+	zassert_true(hdr.dropped >= 2, "%u blocks dropped", hdr.dropped);
+
+	zassert_ok(adc_stream_stop(&adc_stream_iodev));
+}
+
+ZTEST(adc_emul_stream, test_stream_fallback)
+{
+	struct adc_stream_header hdr;
+
+	for (int i = 0; i < 2; i++) {
+		read_one(&adc_stream_fallback_iodev);
+		hdr = check_block(rtio_cqe_consume_block(&adc_stream_rtio));
+		zassert_equal(hdr.interval_us, 0);
+	}
+
+	/* Nothing runs between the reads */
+	zassert_equal(adc_stream_stop(&adc_stream_fallback_iodev), -EALREADY);
+}
+
+static void *adc_emul_stream_setup(void)
+{
+	struct adc_channel_cfg channel_cfg = {
+		.gain = ADC_GAIN_1,
+		.reference = ADC_REF_INTERNAL,
+		.acquisition_time = ADC_ACQ_TIME_DEFAULT,
+	};
+
+	zassert_true(device_is_ready(adc_dev), "ADC device is not ready");
+
+	for (uint8_t channel = 0; channel < 2; channel++) {
+		channel_cfg.channel_id = channel;
+		zassert_ok(adc_channel_setup(adc_dev, &channel_cfg));
+	}
+
+	return NULL;
+}
+
+static void adc_emul_stream_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(adc_emul_const_raw_value_set(adc_dev, 0, CH0_RAW));
+	zassert_ok(adc_emul_const_raw_value_set(adc_dev, 1, CH1_RAW));
+}
+
+static void adc_emul_stream_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Release the device if a test failed halfway */
+	(void)adc_stream_stop(&adc_stream_iodev);
+	drain();
+}
+
+ZTEST_SUITE(adc_emul_stream, NULL, adc_emul_stream_setup, adc_emul_stream_before,
+	    adc_emul_stream_after, NULL);
+
+#endif /* CONFIG_ADC_STREAM */
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/ztest.h>
+
+#include "codec_regcache.h"
+
+#define CODEC_NODE     DT_NODELABEL(codec)
+#define VOLATILE_REG   0x7f
+#define MAX_MSGS       16
+#define MAX_MSG_LEN    8
+
+/* Message seen by the emulated codec */
+struct logged_msg {
+	uint8_t xfer;
+	uint8_t flags;
+	uint8_t len;
+	uint8_t buf[MAX_MSG_LEN];
+};
+
+static uint8_t codec_regs[256];
+static struct logged_msg msg_log[MAX_MSGS];
+static size_t num_msgs;
+static uint8_t num_xfers;
+
+static const struct i2c_dt_spec codec_i2c = I2C_DT_SPEC_GET(CODEC_NODE);
+static struct codec_regcache_entry entries[8];
+static struct codec_regcache cache;
+
+/* Codec with 8-bit registers and address auto-increment */
+static int codec_emul_transfer(const struct emul *target, struct i2c_msg *msgs, int count,
+			       int addr)
+{
+	static uint8_t reg;
+
+	ARG_UNUSED(target);
+	ARG_UNUSED(addr);
+
+	for (int i = 0; i < count; i++) {
+		struct i2c_msg *msg = &msgs[i];
+		struct logged_msg *logged = &msg_log[num_msgs];
+
+		zassert_true(num_msgs < MAX_MSGS, "Too many messages");
+		zassert_true(msg->len <= MAX_MSG_LEN, "Message too long");
+
+		logged->xfer = num_xfers;
+		logged->flags = msg->flags;
+		logged->len = msg->len;
+		num_msgs++;
+
+		if (msg->flags & I2C_MSG_READ) {
+			for (uint32_t j = 0; j < msg->len; j++) {
+				msg->buf[j] = codec_regs[reg++];
+			}
+		} else {
+			memcpy(logged->buf, msg->buf, msg->len);
+			reg = msg->buf[0];
+			for (uint32_t j = 1; j < msg->len; j++) {
+				codec_regs[reg++] = msg->buf[j];
+			}
+		}
+	}
+
+	num_xfers++;
+
+	return 0;
+}
+
+static int codec_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(target);
+	ARG_UNUSED(parent);
+
+	return 0;
+}
+
+static const struct i2c_emul_api codec_emul_api = {
+	.transfer = codec_emul_transfer,
+};
+
+EMUL_DT_DEFINE(CODEC_NODE, codec_emul_init, NULL, NULL, &codec_emul_api, NULL);
+
+static bool codec_is_volatile(uint16_t reg)
+{
+	return reg == VOLATILE_REG;
+}
+
+static const struct codec_regcache_config codec_config = {
+	.reg_bytes = 1,
+	.val_bytes = 1,
+	.burst = true,
+	.is_volatile = codec_is_volatile,
+};
+
+static void assert_write(size_t i, const uint8_t *data, uint8_t len)
+{
+	zassert_true(i < num_msgs, "Message %zu not sent", i);
+	zassert_false(msg_log[i].flags & I2C_MSG_READ, "Message %zu is a read", i);
+	zassert_equal(msg_log[i].len, len, "Message %zu has %u bytes", i, msg_log[i].len);
+	zassert_mem_equal(msg_log[i].buf, data, len, "Message %zu has wrong data", i);
+}
+
+#define ASSERT_WRITE(i, ...)                                                                       \
+	do {                                                                                       \
+		const uint8_t data[] = {__VA_ARGS__};                                              \
+                                                                                                   \
+		assert_write(i, data, sizeof(data));                                               \
+	} while (0)
+
+/* Check how the messages written by a single sync were grouped into transfers */
+static void assert_flushed(size_t first, size_t count)
+{
+	for (size_t i = first; i < first + count; i++) {
+		const struct logged_msg *msg = &msg_log[i];
+		bool last = i == first + count - 1;
+
+		if (IS_ENABLED(CONFIG_AUDIO_CODEC_REGCACHE_COMBINED)) {
+			zassert_equal(msg->xfer, msg_log[first].xfer, "Message %zu not combined", i);
+			zassert_equal(!!(msg->flags & I2C_MSG_RESTART), i != first,
+				      "Message %zu has wrong restart flag", i);
+			zassert_equal(!!(msg->flags & I2C_MSG_STOP), last,
+				      "Message %zu has wrong stop flag", i);
+		} else {
+			zassert_equal(msg->xfer, msg_log[first].xfer + (i - first),
+				      "Message %zu not in its own transfer", i);
+			zassert_true(msg->flags & I2C_MSG_STOP, "Message %zu not stopped", i);
+		}
+	}
+}
+
+static void codec_regcache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_true(i2c_is_ready_dt(&codec_i2c), "I2C bus not ready");
+
+	memset(codec_regs, 0, sizeof(codec_regs));
+	memset(msg_log, 0, sizeof(msg_log));
+	num_msgs = 0;
+	num_xfers = 0;
+
+	codec_regcache_init(&cache, &codec_i2c, &codec_config, entries, ARRAY_SIZE(entries));
+}
+
+ZTEST_SUITE(codec_regcache, NULL, NULL, codec_regcache_before, NULL, NULL);
+
+/**
+ * @brief Test the register writes when they are not deferred
+ *
+ * @details Writes go to the bus at once, reads of cached registers and writes
+ * of an unchanged value do not access the bus.
+ */
+ZTEST(codec_regcache, test_write_through)
+{
+	uint16_t val;
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x05));
+	zassert_equal(num_msgs, 1);
+	ASSERT_WRITE(0, 0x10, 0x05);
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x05));
+	zassert_ok(codec_regcache_read(&cache, 0x10, &val));
+	zassert_equal(val, 0x05);
+	zassert_equal(num_msgs, 1, "Bus accessed for a cached register");
+
+	zassert_ok(codec_regcache_update(&cache, 0x10, 0x0f, 0x03));
+	zassert_equal(num_msgs, 2);
+	ASSERT_WRITE(1, 0x10, 0x03);
+	zassert_equal(codec_regs[0x10], 0x03);
+}
+
+/**
+ * @brief Test flushing the deferred writes in program order
+ */
+ZTEST(codec_regcache, test_deferred_order)
+{
+	codec_regcache_defer(&cache);
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x01));
+	zassert_ok(codec_regcache_write(&cache, 0x20, 0x02));
+	zassert_ok(codec_regcache_write(&cache, 0x11, 0x03));
+	zassert_equal(num_msgs, 0, "Deferred writes sent before the sync");
+
+	zassert_ok(codec_regcache_sync(&cache));
+	zassert_equal(num_msgs, 3);
+	ASSERT_WRITE(0, 0x10, 0x01);
+	ASSERT_WRITE(1, 0x20, 0x02);
+	ASSERT_WRITE(2, 0x11, 0x03);
+	assert_flushed(0, 3);
+
+	/* Nothing left to flush */
+	zassert_ok(codec_regcache_sync(&cache));
+	zassert_equal(num_msgs, 3);
+}
+
+/**
+ * @brief Test grouping consecutive registers written in order into bursts
+ */
+ZTEST(codec_regcache, test_deferred_burst)
+{
+	codec_regcache_defer(&cache);
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x01));
+	zassert_ok(codec_regcache_write(&cache, 0x11, 0x02));
+	zassert_ok(codec_regcache_write(&cache, 0x12, 0x03));
+	zassert_ok(codec_regcache_write(&cache, 0x30, 0x04));
+	zassert_ok(codec_regcache_sync(&cache));
+
+	zassert_equal(num_msgs, 2);
+	ASSERT_WRITE(0, 0x10, 0x01, 0x02, 0x03);
+	ASSERT_WRITE(1, 0x30, 0x04);
+	assert_flushed(0, 2);
+
+	zassert_equal(codec_regs[0x11], 0x02);
+	zassert_equal(codec_regs[0x12], 0x03);
+}
+
+/**
+ * @brief Test rewriting a register with deferred writes pending
+ *
+ * @details Rewriting the last written register only updates its value, while
+ * rewriting it after other registers first flushes the pending writes.
+ */
+ZTEST(codec_regcache, test_deferred_rewrite)
+{
+	codec_regcache_defer(&cache);
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x01));
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x02));
+	zassert_ok(codec_regcache_write(&cache, 0x20, 0x03));
+	zassert_equal(num_msgs, 0);
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x04));
+	zassert_equal(num_msgs, 2, "Pending writes not flushed before the rewrite");
+	ASSERT_WRITE(0, 0x10, 0x02);
+	ASSERT_WRITE(1, 0x20, 0x03);
+	assert_flushed(0, 2);
+
+	zassert_ok(codec_regcache_sync(&cache));
+	zassert_equal(num_msgs, 3);
+	ASSERT_WRITE(2, 0x10, 0x04);
+	zassert_true(msg_log[2].xfer > msg_log[1].xfer);
+	zassert_equal(codec_regs[0x10], 0x04);
+}
+
+/**
+ * @brief Test accessing a volatile register with deferred writes pending
+ *
+ * @details The pending writes are flushed before the volatile register is
+ * read, and the writes that follow are still deferred.
+ */
+ZTEST(codec_regcache, test_deferred_volatile)
+{
+	uint16_t val;
+
+	codec_regs[VOLATILE_REG] = 0x55;
+	codec_regcache_defer(&cache);
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x01));
+	zassert_ok(codec_regcache_read(&cache, VOLATILE_REG, &val));
+	zassert_equal(val, 0x55);
+
+	zassert_equal(num_msgs, 3);
+	ASSERT_WRITE(0, 0x10, 0x01);
+	ASSERT_WRITE(1, VOLATILE_REG);
+	zassert_true(msg_log[2].flags & I2C_MSG_READ);
+	zassert_true(msg_log[1].xfer > msg_log[0].xfer, "Read not after the pending writes");
+
+	zassert_ok(codec_regcache_write(&cache, 0x20, 0x02));
+	zassert_equal(num_msgs, 3, "Write no longer deferred");
+
+	zassert_ok(codec_regcache_sync(&cache));
+	zassert_equal(num_msgs, 4);
+	ASSERT_WRITE(3, 0x20, 0x02);
+}
+
+/**
+ * @brief Test dropping the cached values
+ *
+ * @details Registers are read from the codec again, and pending writes are
+ * discarded.
+ */
+ZTEST(codec_regcache, test_invalidate)
+{
+	uint16_t val;
+
+	zassert_ok(codec_regcache_write(&cache, 0x10, 0x05));
+
+	/* The codec is reset behind the back of the cache */
+	codec_regs[0x10] = 0x09;
+	zassert_ok(codec_regcache_read(&cache, 0x10, &val));
+	zassert_equal(val, 0x05);
+
+	codec_regcache_invalidate(&cache);
+	zassert_ok(codec_regcache_read(&cache, 0x10, &val));
+	zassert_equal(val, 0x09, "Cached value read after invalidation");
+	zassert_equal(num_msgs, 3);
+
+	codec_regcache_defer(&cache);
+	zassert_ok(codec_regcache_write(&cache, 0x20, 0x01));
+	codec_regcache_invalidate(&cache);
+	zassert_ok(codec_regcache_sync(&cache));
+	zassert_equal(num_msgs, 3, "Pending write not discarded");
+	zassert_equal(codec_regs[0x20], 0x00);
+}
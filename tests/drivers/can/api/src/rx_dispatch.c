@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/rx_dispatch.h>
+#include <zephyr/ztest.h>
+
+#include "common.h"
+
+/**
+ * @addtogroup t_driver_can
+ * @{
+ * @defgroup t_can_rx_dispatch test_can_rx_dispatch
+ * @}
+ */
+
+#define TEST_DISPATCH_BASE_ID 0x400
+
+static struct can_rx_dispatch dispatch;
+static atomic_t dispatch_counts[CONFIG_CAN_RX_DISPATCH_MAX_FILTERS];
+static K_SEM_DEFINE(dispatch_sem, 0, CONFIG_CAN_RX_DISPATCH_MAX_FILTERS);
+
+static void dispatch_callback(const struct device *dev, struct can_frame *frame,
+			      void *user_data)
+{
+	atomic_t *count = user_data;
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(frame);
+
+	atomic_inc(count);
+	k_sem_give(&dispatch_sem);
+}
+
+static void send_std_frame(uint32_t id)
+{
+	struct can_frame frame = {
+		.id = id,
+		.dlc = 1,
+		.data = {0xAA},
+	};
+	int err;
+
+	err = can_send(can_dev, &frame, TEST_SEND_TIMEOUT, NULL, NULL);
+	zassert_equal(err, 0, "failed to send frame (err %d)", err);
+}
+
+/**
+ * @brief Test delivering frames to more filters than the CAN controller supports.
+ */
+ZTEST(can_rx_dispatch, test_rx_dispatch_filters)
+{
+	int max_filters = can_get_max_filters(can_dev, false);
+	int filter_ids[CONFIG_CAN_RX_DISPATCH_MAX_FILTERS];
+	size_t count;
+	int ret;
+
+	zassert_true(max_filters > 0, "CAN controller has no standard filters");
+
+	count = MIN(max_filters + 4, CONFIG_CAN_RX_DISPATCH_MAX_FILTERS);
+
+	can_rx_dispatch_init(&dispatch, can_dev);
+
+	for (size_t i = 0; i < count; i++) {
+		struct can_filter filter = {
+			.id = TEST_DISPATCH_BASE_ID + i,
+			.mask = CAN_STD_ID_MASK,
+		};
+
+		atomic_clear(&dispatch_counts[i]);
+		filter_ids[i] = can_rx_dispatch_add(&dispatch, dispatch_callback,
+						    &dispatch_counts[i], &filter);
+		zassert_true(filter_ids[i] >= 0, "failed to add filter (err %d)", filter_ids[i]);
+	}
+
+	ret = can_rx_dispatch_apply(&dispatch);
+	zassert_true(ret > 0 && ret <= max_filters, "unexpected filter count %d", ret);
+
+	k_sem_reset(&dispatch_sem);
+
+	for (size_t i = 0; i < count; i++) {
+		send_std_frame(TEST_DISPATCH_BASE_ID + i);
+		zassert_equal(k_sem_take(&dispatch_sem, TEST_RECEIVE_TIMEOUT), 0,
+			      "frame 0x%x not received", TEST_DISPATCH_BASE_ID + i);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(atomic_get(&dispatch_counts[i]), 1, "filter %zu count", i);
+	}
+
+	send_std_frame(TEST_CAN_SOME_STD_ID);
+	zassert_equal(k_sem_take(&dispatch_sem, TEST_RECEIVE_TIMEOUT), -EAGAIN,
+		      "unmatched frame delivered");
+
+	for (size_t i = 0; i < count; i++) {
+		can_rx_dispatch_remove(&dispatch, filter_ids[i]);
+	}
+
+	ret = can_rx_dispatch_apply(&dispatch);
+	zassert_equal(ret, 0, "failed to release filters (err %d)", ret);
+}
+
+/**
+ * @brief Test delivering received frames in batches.
+ */
+ZTEST(can_rx_dispatch, test_rx_batch)
+{
+	static struct can_frame storage[8];
+	static struct can_frame frames[8];
+	static struct can_rx_batch batch;
+	int filter_id;
+	int ret;
+
+	can_rx_batch_init(&batch, storage, ARRAY_SIZE(storage), 4);
+	can_rx_dispatch_init(&dispatch, can_dev);
+
+	filter_id = can_rx_dispatch_add(&dispatch, can_rx_batch_put, &batch, &test_std_filter_1);
+	zassert_true(filter_id >= 0, "failed to add filter (err %d)", filter_id);
+
+	ret = can_rx_dispatch_apply(&dispatch);
+	zassert_equal(ret, 1, "unexpected filter count %d", ret);
+
+	ret = can_rx_batch_get(&batch, frames, ARRAY_SIZE(frames), K_NO_WAIT);
+	zassert_equal(ret, -EAGAIN, "unexpected frames (ret %d)", ret);
+
+	/* Below the watermark, frames are returned on timeout */
+	for (int i = 0; i < 3; i++) {
+		send_std_frame(TEST_CAN_STD_ID_1);
+	}
+
+	ret = can_rx_batch_get(&batch, frames, ARRAY_SIZE(frames), TEST_RECEIVE_TIMEOUT);
+	zassert_equal(ret, 3, "unexpected frame count %d", ret);
+
+	/* Reaching the watermark wakes up the reader */
+	for (int i = 0; i < 4; i++) {
+		send_std_frame(TEST_CAN_STD_ID_1);
+	}
+
+	ret = can_rx_batch_get(&batch, frames, ARRAY_SIZE(frames), K_FOREVER);
+	zassert_equal(ret, 4, "unexpected frame count %d", ret);
+
+	for (int i = 0; i < ret; i++) {
+		zassert_equal(frames[i].id, TEST_CAN_STD_ID_1);
+	}
+
+	zassert_equal(batch.overruns, 0U);
+
+	can_rx_dispatch_remove(&dispatch, filter_id);
+	ret = can_rx_dispatch_apply(&dispatch);
+	zassert_equal(ret, 0, "failed to release filters (err %d)", ret);
+}
+
+void *can_rx_dispatch_setup(void)
+{
+	can_common_test_setup(CAN_MODE_LOOPBACK);
+
+	return NULL;
+}
+
+ZTEST_SUITE(can_rx_dispatch, NULL, can_rx_dispatch_setup, NULL, NULL, NULL);
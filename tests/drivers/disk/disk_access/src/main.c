@@ -12,6 +12,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/ztest.h>
 #include <zephyr/storage/disk_access.h>
+#include <zephyr/storage/disk_cache.h>
 #include <zephyr/device.h>
 
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
@@ -275,6 +276,55 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#ifdef CONFIG_DISK_CACHE
+/* Test that cached writes are read back and reach the disk on sync
+ * WARNING: this test is destructive- it will overwrite data on the disk!
+ */
+ZTEST(disk_driver, test_cache)
+{
+	uint32_t sector = disk_sector_count / 2;
+	int rc, i;
+
+	for (i = 0; i < SECTOR_COUNT1 * disk_sector_size; i++) {
+		scratch_buf[0][i] = (uint8_t)(i + 3);
+	}
+
+	/* Single sector writes stay in the cache until sync */
+	for (i = 0; i < SECTOR_COUNT1; i++) {
+		rc = disk_cache_write(disk_pdrv, &scratch_buf[0][i * disk_sector_size],
+				      sector + i, 1);
+		zassert_equal(rc, 0, "Cached write failed");
+	}
+
+	/* Large reads bypass the cache, but must see the cached data */
+	memset(scratch_buf[1], 0, SECTOR_COUNT3 * disk_sector_size);
+	rc = disk_cache_read(disk_pdrv, scratch_buf[1], sector, SECTOR_COUNT3);
+	zassert_equal(rc, 0, "Cached read failed");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], SECTOR_COUNT1 * disk_sector_size,
+			  "Cached read did not return written data");
+
+	rc = disk_cache_sync(disk_pdrv);
+	zassert_equal(rc, 0, "Cache sync failed");
+
+	memset(scratch_buf[1], 0, SECTOR_COUNT1 * disk_sector_size);
+	rc = read_sector(scratch_buf[1], sector, SECTOR_COUNT1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], SECTOR_COUNT1 * disk_sector_size,
+			  "Synced data did not reach the disk");
+
+	/* Sectors loaded ahead are served from the cache */
+	rc = disk_cache_read_ahead(disk_pdrv, sector, SECTOR_COUNT1);
+	zassert_equal(rc, 0, "Read ahead failed");
+	memset(scratch_buf[1], 0, SECTOR_COUNT1 * disk_sector_size);
+	rc = disk_cache_read(disk_pdrv, scratch_buf[1], sector, 1);
+	zassert_equal(rc, 0, "Cached read failed");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], disk_sector_size,
+			  "Read ahead data mismatch");
+
+	disk_cache_invalidate(disk_pdrv);
+}
+#endif /* CONFIG_DISK_CACHE */
+
 static void *disk_driver_setup(void)
 {
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
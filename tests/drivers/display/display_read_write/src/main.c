@@ -276,4 +276,76 @@ ZTEST(display_read_write, test_read_does_not_clear_existing_buffer)
 	verify_background_color(0, height, display_width - width, display_height - height, 0);
 }
 
+/*
+ * Write the head and the tail of the buffer as two regions and check that
+ * both are written.
+ */
+ZTEST(display_read_write, test_write_regions)
+{
+	uint8_t data[4] = {0xFA, 0xAF, 0x9F, 0xFA};
+	uint16_t height = (is_vtiled ? 8 : 1);
+	uint16_t width = sizeof(data) / bpp * (is_htiled ? 8 : 1);
+	struct display_buffer_descriptor desc = {
+		.height = height,
+		.pitch = width,
+		.width = width,
+		.buf_size = width * bpp,
+	};
+	struct display_region regions[] = {
+		{.x = 0, .y = 0, .desc = desc, .buf = data},
+		{.x = display_width - width, .y = display_height - height, .desc = desc, .buf = data},
+	};
+
+	regions[0].desc.frame_incomplete = true;
+	zassert_ok(display_write_regions(dev, regions, ARRAY_SIZE(regions)));
+
+	verify_bytes_of_area(data, 0, 0, width, height);
+	verify_bytes_of_area(data, display_width - width, display_height - height, width, height);
+	verify_background_color(width, 0, display_width - width, display_height - height, 0);
+	verify_background_color(0, height, display_width - width, display_height - height, 0);
+}
+
+#ifdef CONFIG_DISPLAY_ASYNC
+static K_SEM_DEFINE(write_done, 0, 1);
+static int write_result;
+
+static void write_cb(const struct device *cb_dev, struct display_async_op *op, int result)
+{
+	zassert_equal_ptr(cb_dev, dev);
+	zassert_equal_ptr(op->user_data, &write_done);
+	write_result = result;
+	k_sem_give(&write_done);
+}
+
+/*
+ * Queue a write and check that it is performed before the callback.
+ */
+ZTEST(display_read_write, test_write_async)
+{
+	static struct display_async_op op = {
+		.user_data = &write_done,
+	};
+	uint8_t data[4] = {0xFA, 0xAF, 0x9F, 0xFA};
+	uint8_t height = (is_vtiled ? 8 : 1);
+	uint16_t width = sizeof(data) / bpp * (is_htiled ? 8 : 1);
+	struct display_buffer_descriptor desc = {
+		.height = height,
+		.pitch = width,
+		.width = width,
+		.buf_size = width * bpp,
+	};
+
+	k_sem_reset(&write_done);
+	write_result = -EINPROGRESS;
+
+	zassert_ok(display_write_async(dev, 0, 0, &desc, data, &op, write_cb));
+	zassert_ok(k_sem_take(&write_done, K_SECONDS(1)));
+	zassert_ok(write_result);
+
+	verify_bytes_of_area(data, 0, 0, width, height);
+	verify_background_color(0, height, display_width, display_height - height, 0);
+	verify_background_color(width, 0, display_width - width, display_height, 0);
+}
+#endif /* CONFIG_DISPLAY_ASYNC */
+
 ZTEST_SUITE(display_read_write, NULL, NULL, display_before, NULL, NULL);
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Verify the eDMA TCD pool shared by the scatter gather channels
+ * @details
+ * - Test Steps
+ *   -# Size the pool for a single scatter gather channel
+ *   -# Configure scatter gather on two channels
+ *   -# Release the first channel and configure the second one again
+ * - Expected Results
+ *   -# The second channel gets no TCDs while the first one holds them, and
+ *      gets them once the first channel is released.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/ztest.h>
+
+#if defined(CONFIG_DMA_MCUX_EDMA_TCD_POOL_CHANNELS) && (CONFIG_DMA_MCUX_EDMA_TCD_POOL_CHANNELS == 1)
+
+#define POOL_XFERS     2
+#define POOL_XFER_SIZE 64
+
+static __aligned(32) uint8_t pool_tx_data[POOL_XFER_SIZE];
+static __aligned(32) uint8_t pool_rx_data[POOL_XFERS][POOL_XFER_SIZE];
+
+static K_SEM_DEFINE(pool_xfer_sem, 0, 1);
+
+static struct dma_config pool_dma_cfg;
+static struct dma_block_config pool_block_cfgs[POOL_XFERS];
+
+static void dma_pool_callback(const struct device *dma_dev, void *user_data,
+			      uint32_t channel, int status)
+{
+	if (status >= 0) {
+		k_sem_give(&pool_xfer_sem);
+	}
+}
+
+static int pool_config(const struct device *dma, uint32_t channel)
+{
+	memset(&pool_dma_cfg, 0, sizeof(pool_dma_cfg));
+	memset(pool_block_cfgs, 0, sizeof(pool_block_cfgs));
+
+	pool_dma_cfg.channel_direction = MEMORY_TO_MEMORY;
+	pool_dma_cfg.source_data_size = 4U;
+	pool_dma_cfg.dest_data_size = 4U;
+	pool_dma_cfg.source_burst_length = 4U;
+	pool_dma_cfg.dest_burst_length = 4U;
+	pool_dma_cfg.dma_callback = dma_pool_callback;
+	pool_dma_cfg.block_count = POOL_XFERS;
+	pool_dma_cfg.head_block = pool_block_cfgs;
+
+#ifdef CONFIG_DMA_MCUX_TEST_SLOT_START
+	pool_dma_cfg.dma_slot = CONFIG_DMA_MCUX_TEST_SLOT_START;
+#endif
+
+	for (int i = 0; i < POOL_XFERS; i++) {
+		pool_block_cfgs[i].source_gather_en = 1U;
+		pool_block_cfgs[i].block_size = POOL_XFER_SIZE;
+		pool_block_cfgs[i].source_address = (uintptr_t)pool_tx_data;
+		pool_block_cfgs[i].dest_address = (uintptr_t)pool_rx_data[i];
+
+		if (i < POOL_XFERS - 1) {
+			pool_block_cfgs[i].next_block = &pool_block_cfgs[i + 1];
+		}
+	}
+
+	return dma_config(dma, channel, &pool_dma_cfg);
+}
+
+ZTEST(dma_m2m_sg, test_dma_m2m_sg_tcd_pool)
+{
+	const struct device *dma = DEVICE_DT_GET(DT_ALIAS(dma0));
+	int chan_a;
+	int chan_b;
+
+	zassert_true(device_is_ready(dma), "dma controller device is not ready");
+
+	for (int i = 0; i < POOL_XFER_SIZE; i++) {
+		pool_tx_data[i] = i;
+	}
+
+	memset(pool_rx_data, 0, sizeof(pool_rx_data));
+
+	chan_a = dma_request_channel(dma, NULL);
+	zassert_true(chan_a >= 0, "no channel available");
+	chan_b = dma_request_channel(dma, NULL);
+	zassert_true(chan_b >= 0, "no second channel available");
+
+	zassert_ok(pool_config(dma, chan_a), "first channel not configured");
+	zassert_equal(pool_config(dma, chan_b), -ENOMEM,
+		      "TCDs given to a second channel from a pool sized for one");
+
+	/* A channel keeps its TCDs when configured again */
+	zassert_ok(pool_config(dma, chan_a), "first channel not configured again");
+
+	dma_release_channel(dma, chan_a);
+
+	zassert_ok(pool_config(dma, chan_b), "TCDs of the released channel not reused");
+	zassert_ok(dma_start(dma, chan_b), "transfer not started");
+	zassert_ok(k_sem_take(&pool_xfer_sem, K_MSEC(1000)), "timed out waiting for xfers");
+
+	for (int i = 0; i < POOL_XFERS; i++) {
+		zassert_mem_equal(pool_tx_data, pool_rx_data[i], POOL_XFER_SIZE,
+				  "block %d not transferred", i);
+	}
+
+	dma_release_channel(dma, chan_b);
+}
+
+#endif /* CONFIG_DMA_MCUX_EDMA_TCD_POOL_CHANNELS == 1 */
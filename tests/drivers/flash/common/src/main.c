@@ -479,4 +479,96 @@ ZTEST(flash_driver, test_flash_copy)
 			      page_info.size - (page_info.size / 4), buf, sizeof(buf), -EINVAL);
 }
 
+#ifdef CONFIG_FLASH_ASYNC
+static K_SEM_DEFINE(async_done, 0, 1);
+static int async_result;
+
+static void flash_async_done(const struct device *dev, struct flash_async_op *op, int result)
+{
+	async_result = result;
+	k_sem_give(&async_done);
+}
+
+ZTEST(flash_driver, test_flash_async)
+{
+	static struct flash_async_op op;
+	uint8_t read_buf[EXPECTED_SIZE];
+	size_t erase_size =
+		page_info.size * ((EXPECTED_SIZE + page_info.size - 1) / page_info.size);
+	int rc;
+
+	if (ebw_required) {
+		rc = flash_erase_async(flash_dev, page_info.start_offset, erase_size, &op,
+				       flash_async_done);
+		zassert_equal(rc, 0, "Cannot queue erase");
+		zassert_equal(flash_erase_async(flash_dev, page_info.start_offset, erase_size,
+						&op, flash_async_done),
+			      -EBUSY, "Queued operation was resubmitted");
+
+		/* Reads are allowed while the erase is in progress */
+		rc = flash_read(flash_dev, page_info.start_offset + erase_size, read_buf,
+				sizeof(read_buf));
+		zassert_equal(rc, 0, "Cannot read flash during erase");
+
+		zassert_equal(k_sem_take(&async_done, K_SECONDS(30)), 0, "Erase not completed");
+		zassert_equal(async_result, 0, "Erase failed");
+	}
+
+	rc = flash_write_async(flash_dev, page_info.start_offset, expected, EXPECTED_SIZE, &op,
+			       flash_async_done);
+	zassert_equal(rc, 0, "Cannot queue write");
+	zassert_equal(k_sem_take(&async_done, K_SECONDS(5)), 0, "Write not completed");
+	zassert_equal(async_result, 0, "Write failed");
+
+	rc = flash_read(flash_dev, page_info.start_offset, read_buf, EXPECTED_SIZE);
+	zassert_equal(rc, 0, "Cannot read flash");
+	zassert_mem_equal(read_buf, expected, EXPECTED_SIZE, "Write operation failed");
+}
+
+static int async_resubmits;
+
+static void flash_async_resubmit(const struct device *dev, struct flash_async_op *op,
+				 int result)
+{
+	async_result = result;
+
+	if (result == 0 && async_resubmits > 0) {
+		async_resubmits--;
+		async_result = flash_erase_async(dev, page_info.start_offset, page_info.size,
+						 op, flash_async_resubmit);
+		if (async_result == 0) {
+			return;
+		}
+	}
+
+	k_sem_give(&async_done);
+}
+
+ZTEST(flash_driver, test_flash_async_resubmit)
+{
+	static struct flash_async_op op;
+	int rc;
+
+	if (!ebw_required) {
+		ztest_test_skip();
+	}
+
+	/* Queued again from its own callback */
+	async_resubmits = 2;
+	rc = flash_erase_async(flash_dev, page_info.start_offset, page_info.size, &op,
+			       flash_async_resubmit);
+	zassert_equal(rc, 0, "Cannot queue erase");
+	zassert_equal(k_sem_take(&async_done, K_SECONDS(30)), 0, "Erase not completed");
+	zassert_equal(async_result, 0, "Resubmit from the callback failed");
+	zassert_equal(async_resubmits, 0, "Erase not resubmitted");
+
+	/* Queued again by the thread the callback woke up, at once */
+	rc = flash_erase_async(flash_dev, page_info.start_offset, page_info.size, &op,
+			       flash_async_done);
+	zassert_equal(rc, 0, "Cannot queue erase after completion");
+	zassert_equal(k_sem_take(&async_done, K_SECONDS(30)), 0, "Erase not completed");
+	zassert_equal(async_result, 0, "Erase failed");
+}
+#endif /* CONFIG_FLASH_ASYNC */
+
 ZTEST_SUITE(flash_driver, NULL, NULL, flash_driver_before, NULL, NULL);
@@ -429,3 +429,309 @@ ZTEST_USER(i2s_loopback, test_i2s_transfer_tx_underrun)
 
 	k_sleep(K_MSEC(200));
 }
+
+/** @brief Zero-copy I2S transfer.
+ *
+ * - TX blocks claimed with i2s_buf_claim() are filled in place and queued
+ *   with i2s_buf_release().
+ * - RX blocks claimed with i2s_buf_claim() carry the transmitted data and
+ *   are returned to the RX slab with i2s_buf_release().
+ * - releasing a TX block with size 0 returns it to the slab unsent.
+ */
+ZTEST(i2s_loopback, test_i2s_transfer_claim_release)
+{
+	if (IS_ENABLED(CONFIG_I2S_TEST_USE_I2S_DIR_BOTH)) {
+		TC_PRINT("RX/TX transfer requires use of I2S_DIR_BOTH.\n");
+		ztest_test_skip();
+		return;
+	}
+
+	uint32_t used = k_mem_slab_num_used_get(&tx_mem_slab);
+	void *block;
+	size_t size;
+	int ret;
+
+	ret = i2s_buf_claim(dev_i2s_tx, I2S_DIR_BOTH, &block, &size);
+	zassert_equal(ret, -EINVAL, "I2S_DIR_BOTH claim not rejected");
+
+	/* Claim and discard a TX block */
+	ret = i2s_buf_claim(dev_i2s_tx, I2S_DIR_TX, &block, &size);
+	zassert_equal(ret, 0, "TX claim failed");
+	zassert_equal(size, BLOCK_SIZE);
+	ret = i2s_buf_release(dev_i2s_tx, I2S_DIR_TX, block, 0);
+	zassert_equal(ret, 0, "TX discard failed");
+	zassert_equal(k_mem_slab_num_used_get(&tx_mem_slab), used);
+
+	/* Prefill TX queue in place */
+	for (int n = 0; n < 2; n++) {
+		ret = i2s_buf_claim(dev_i2s_tx, I2S_DIR_TX, &block, &size);
+		zassert_equal(ret, 0, "TX claim failed");
+		fill_buf_const((int16_t *)block, 3, 4);
+		ret = i2s_buf_release(dev_i2s_tx, I2S_DIR_TX, block, size);
+		zassert_equal(ret, 0, "TX release failed");
+	}
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "RX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "TX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
+	zassert_equal(ret, 0, "TX DRAIN trigger failed");
+
+	ret = i2s_buf_claim(dev_i2s_rx, I2S_DIR_RX, &block, &size);
+	zassert_equal(ret, 0, "RX claim failed");
+	zassert_equal(size, BLOCK_SIZE);
+	ret = verify_buf_const((int16_t *)block, 3, 4);
+	zassert_equal(ret, TC_PASS);
+	ret = i2s_buf_release(dev_i2s_rx, I2S_DIR_RX, block, size);
+	zassert_equal(ret, 0, "RX release failed");
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_STOP);
+	zassert_equal(ret, 0, "RX STOP trigger failed");
+
+	ret = i2s_buf_claim(dev_i2s_rx, I2S_DIR_RX, &block, &size);
+	zassert_equal(ret, 0, "RX claim failed");
+	ret = verify_buf_const((int16_t *)block, 3, 4);
+	zassert_equal(ret, TC_PASS);
+	ret = i2s_buf_release(dev_i2s_rx, I2S_DIR_RX, block, size);
+	zassert_equal(ret, 0, "RX release failed");
+}
+
+/** @brief Planar reception.
+ *
+ * - RX stream configured with I2S_OPT_PLANAR receives each channel into its
+ *   own half of the memory block.
+ */
+ZTEST(i2s_loopback, test_i2s_transfer_planar)
+{
+	if (IS_ENABLED(CONFIG_I2S_TEST_USE_I2S_DIR_BOTH)) {
+		TC_PRINT("RX/TX transfer requires use of I2S_DIR_BOTH.\n");
+		ztest_test_skip();
+		return;
+	}
+
+	struct i2s_config i2s_cfg = *i2s_config_get(dev_i2s_rx, I2S_DIR_RX);
+	int16_t *samples;
+	void *block;
+	size_t size;
+	int ret;
+
+	i2s_cfg.options |= I2S_OPT_PLANAR;
+	ret = i2s_configure(dev_i2s_rx, I2S_DIR_RX, &i2s_cfg);
+	if (ret == -ENOTSUP) {
+		TC_PRINT("Planar mode not supported.\n");
+		ztest_test_skip();
+		return;
+	}
+	zassert_equal(ret, 0, "Failed to configure planar RX stream");
+
+	for (int n = 0; n < 2; n++) {
+		ret = i2s_buf_claim(dev_i2s_tx, I2S_DIR_TX, &block, &size);
+		zassert_equal(ret, 0, "TX claim failed");
+		fill_buf_const((int16_t *)block, 3, 4);
+		ret = i2s_buf_release(dev_i2s_tx, I2S_DIR_TX, block, size);
+		zassert_equal(ret, 0, "TX release failed");
+	}
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "RX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "TX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
+	zassert_equal(ret, 0, "TX DRAIN trigger failed");
+
+	ret = i2s_buf_claim(dev_i2s_rx, I2S_DIR_RX, &block, &size);
+	zassert_equal(ret, 0, "RX claim failed");
+
+	samples = block;
+	for (int i = 0; i < SAMPLE_NO; i++) {
+		zassert_equal(samples[i], 3, "left plane sample %d: %d", i, samples[i]);
+		zassert_equal(samples[SAMPLE_NO + i], 4, "right plane sample %d: %d", i,
+			      samples[SAMPLE_NO + i]);
+	}
+
+	ret = i2s_buf_release(dev_i2s_rx, I2S_DIR_RX, block, size);
+	zassert_equal(ret, 0, "RX release failed");
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_DROP);
+	zassert_equal(ret, 0, "RX DROP trigger failed");
+}
+
+/** @brief Stream position.
+ *
+ * - drivers without position support return -ENOSYS.
+ * - the position of a running stream does not go backwards.
+ * - once a block has been received the RX position covers it.
+ */
+ZTEST_USER(i2s_loopback, test_i2s_transfer_position)
+{
+	if (IS_ENABLED(CONFIG_I2S_TEST_USE_I2S_DIR_BOTH)) {
+		TC_PRINT("RX/TX transfer requires use of I2S_DIR_BOTH.\n");
+		ztest_test_skip();
+		return;
+	}
+
+	struct i2s_position pos, prev;
+	int ret;
+
+	ret = i2s_get_position(dev_i2s_rx, I2S_DIR_RX, &pos);
+	if (ret == -ENOSYS) {
+		TC_PRINT("Stream position not supported.\n");
+		ztest_test_skip();
+		return;
+	}
+	zassert_equal(ret, 0, "RX position failed");
+
+	ret = i2s_get_position(dev_i2s_rx, I2S_DIR_BOTH, &pos);
+	zassert_equal(ret, -EINVAL, "I2S_DIR_BOTH position not rejected");
+
+	/* Prefill TX queue */
+	ret = tx_block_write(dev_i2s_tx, 0, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = tx_block_write(dev_i2s_tx, 1, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "RX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "TX START trigger failed");
+
+	ret = i2s_get_position(dev_i2s_tx, I2S_DIR_TX, &prev);
+	zassert_equal(ret, 0, "TX position failed");
+
+	ret = rx_block_read(dev_i2s_rx, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_get_position(dev_i2s_rx, I2S_DIR_RX, &pos);
+	zassert_equal(ret, 0, "RX position failed");
+	zassert_true(pos.frames >= SAMPLE_NO, "RX position %llu", pos.frames);
+
+	ret = i2s_get_position(dev_i2s_tx, I2S_DIR_TX, &pos);
+	zassert_equal(ret, 0, "TX position failed");
+	zassert_true(pos.frames >= prev.frames, "TX position went backwards");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
+	zassert_equal(ret, 0, "TX DRAIN trigger failed");
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_STOP);
+	zassert_equal(ret, 0, "RX STOP trigger failed");
+
+	ret = rx_block_read(dev_i2s_rx, 1);
+	zassert_equal(ret, TC_PASS);
+}
+
+/** @brief Group I2S start.
+ *
+ * - RX and TX streams started together with i2s_trigger_group() transfer
+ *   data as if started one by one.
+ * - STOP and DRAIN can be sent to the group as well.
+ */
+ZTEST(i2s_loopback, test_i2s_transfer_group)
+{
+	if (IS_ENABLED(CONFIG_I2S_TEST_USE_I2S_DIR_BOTH)) {
+		TC_PRINT("RX/TX transfer requires use of I2S_DIR_BOTH.\n");
+		ztest_test_skip();
+		return;
+	}
+
+	const struct i2s_group_member group[] = {
+		{ .dev = dev_i2s_rx, .dir = I2S_DIR_RX },
+		{ .dev = dev_i2s_tx, .dir = I2S_DIR_TX },
+	};
+	int ret;
+
+	/* Prefill TX queue */
+	ret = tx_block_write(dev_i2s_tx, 0, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = tx_block_write(dev_i2s_tx, 1, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger_group(group, ARRAY_SIZE(group), I2S_TRIGGER_START);
+	if (ret == -ENOSYS) {
+		TC_PRINT("Group start not supported.\n");
+		(void)i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DROP);
+		ztest_test_skip();
+		return;
+	}
+	zassert_equal(ret, 0, "group START trigger failed");
+
+	ret = rx_block_read(dev_i2s_rx, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = tx_block_write(dev_i2s_tx, 2, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
+	zassert_equal(ret, 0, "TX DRAIN trigger failed");
+
+	ret = rx_block_read(dev_i2s_rx, 1);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger_group(group, 1, I2S_TRIGGER_STOP);
+	zassert_equal(ret, 0, "group STOP trigger failed");
+
+	ret = rx_block_read(dev_i2s_rx, 2);
+	zassert_equal(ret, TC_PASS);
+}
+
+/** @brief TX underrun recovery.
+ *
+ * - with I2S_OPT_XRUN_SILENCE the TX stream keeps running when its queue
+ *   runs empty, and accepts more data afterwards.
+ * - the underruns are counted in the stream statistics.
+ */
+ZTEST(i2s_loopback, test_i2s_transfer_xrun_silence)
+{
+	if (IS_ENABLED(CONFIG_I2S_TEST_USE_I2S_DIR_BOTH)) {
+		TC_PRINT("RX/TX transfer requires use of I2S_DIR_BOTH.\n");
+		ztest_test_skip();
+		return;
+	}
+
+	struct i2s_config cfg;
+	struct i2s_stats stats;
+	int ret;
+
+	ret = i2s_get_stats(dev_i2s_tx, I2S_DIR_TX, &stats);
+	if (ret == -ENOSYS) {
+		TC_PRINT("Stream statistics not supported.\n");
+		ztest_test_skip();
+		return;
+	}
+	zassert_equal(ret, 0, "TX statistics failed");
+	zassert_equal(stats.xruns, 0);
+	zassert_equal(stats.min_slack_frames, UINT32_MAX);
+
+	cfg = *i2s_config_get(dev_i2s_tx, I2S_DIR_TX);
+	cfg.options |= I2S_OPT_XRUN_SILENCE;
+	ret = i2s_configure(dev_i2s_tx, I2S_DIR_TX, &cfg);
+	zassert_equal(ret, 0, "TX configure failed");
+
+	ret = tx_block_write(dev_i2s_tx, 0, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "TX START trigger failed");
+
+	/* Let the queue run empty for a few blocks */
+	k_sleep(K_MSEC(5 * SAMPLE_NO * 1000 / FRAME_CLK_FREQ));
+
+	ret = i2s_get_stats(dev_i2s_tx, I2S_DIR_TX, &stats);
+	zassert_equal(ret, 0, "TX statistics failed");
+	zassert_true(stats.xruns > 0, "no underrun counted");
+	zassert_equal(stats.xruns_recovered, stats.xruns);
+
+	/* The stream is still running */
+	ret = tx_block_write(dev_i2s_tx, 1, 0);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DROP);
+	zassert_equal(ret, 0, "TX DROP trigger failed");
+}
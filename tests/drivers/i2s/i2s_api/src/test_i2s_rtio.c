@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/i2s.h>
+#include "i2s_api_test.h"
+
+#ifdef CONFIG_I2S_RTIO
+#include <zephyr/rtio/rtio.h>
+
+I2S_DT_IODEV_DEFINE(i2s_rx_iodev, I2S_DEV_NODE_RX, I2S_DIR_RX);
+I2S_DT_IODEV_DEFINE(i2s_tx_iodev, I2S_DEV_NODE_TX, I2S_DIR_TX);
+
+RTIO_DEFINE_WITH_MEMPOOL(i2s_rtio, 4, 4, NUM_RX_BLOCKS, BLOCK_SIZE, 4);
+
+static int16_t rtio_tx_block[BLOCK_SIZE / sizeof(int16_t)];
+static int16_t rtio_rx_block[BLOCK_SIZE / sizeof(int16_t)];
+
+static int rtio_tx_block_write(int16_t val_l, int16_t val_r)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(&i2s_rtio);
+	struct rtio_cqe *cqe;
+	int ret;
+
+	zassert_not_null(sqe);
+	fill_buf_const(rtio_tx_block, val_l, val_r);
+	rtio_sqe_prep_write(sqe, &i2s_tx_iodev, RTIO_PRIO_NORM, (uint8_t *)rtio_tx_block,
+			    sizeof(rtio_tx_block), NULL);
+
+	rtio_submit(&i2s_rtio, 1);
+	cqe = rtio_cqe_consume_block(&i2s_rtio);
+	ret = cqe->result;
+	rtio_cqe_release(&i2s_rtio, cqe);
+
+	return ret;
+}
+
+/** @brief I2S transfer through RTIO iodevs.
+ *
+ * - write SQEs on the TX iodev queue blocks for transmission.
+ * - read SQEs on the RX iodev complete with the received blocks.
+ */
+ZTEST(i2s_loopback, test_i2s_transfer_rtio)
+{
+	if (IS_ENABLED(CONFIG_I2S_TEST_USE_I2S_DIR_BOTH)) {
+		TC_PRINT("RX/TX transfer requires use of I2S_DIR_BOTH.\n");
+		ztest_test_skip();
+		return;
+	}
+
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int ret;
+
+	/* Prefill TX queue */
+	for (int n = 0; n < 2; n++) {
+		ret = rtio_tx_block_write(5, 6);
+		zassert_equal(ret, 0, "TX write failed (%d)", ret);
+	}
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "RX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_START);
+	zassert_equal(ret, 0, "TX START trigger failed");
+
+	ret = i2s_trigger(dev_i2s_tx, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
+	zassert_equal(ret, 0, "TX DRAIN trigger failed");
+
+	sqe = rtio_sqe_acquire(&i2s_rtio);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read(sqe, &i2s_rx_iodev, RTIO_PRIO_NORM, (uint8_t *)rtio_rx_block,
+			   sizeof(rtio_rx_block), NULL);
+	rtio_submit(&i2s_rtio, 1);
+
+	cqe = rtio_cqe_consume_block(&i2s_rtio);
+	zassert_equal(cqe->result, BLOCK_SIZE, "RX read failed (%d)", cqe->result);
+	rtio_cqe_release(&i2s_rtio, cqe);
+
+	ret = verify_buf_const(rtio_rx_block, 5, 6);
+	zassert_equal(ret, TC_PASS);
+
+	ret = i2s_trigger(dev_i2s_rx, I2S_DIR_RX, I2S_TRIGGER_STOP);
+	zassert_equal(ret, 0, "RX STOP trigger failed");
+
+	/* The last block through a mempool buffer */
+	sqe = rtio_sqe_acquire(&i2s_rtio);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_read_with_pool(sqe, &i2s_rx_iodev, RTIO_PRIO_NORM, NULL);
+	rtio_submit(&i2s_rtio, 1);
+
+	cqe = rtio_cqe_consume_block(&i2s_rtio);
+	zassert_equal(cqe->result, BLOCK_SIZE, "RX read failed (%d)", cqe->result);
+
+	uint8_t *buf;
+	uint32_t buf_len;
+
+	ret = rtio_cqe_get_mempool_buffer(&i2s_rtio, cqe, &buf, &buf_len);
+	zassert_equal(ret, 0, "No mempool buffer (%d)", ret);
+	rtio_cqe_release(&i2s_rtio, cqe);
+
+	ret = verify_buf_const((int16_t *)buf, 5, 6);
+	zassert_equal(ret, TC_PASS);
+	rtio_release_buffer(&i2s_rtio, buf, buf_len);
+}
+
+#endif /* CONFIG_I2S_RTIO */
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/sensor.h>
+
+#ifdef CONFIG_SENSOR_ASYNC_API
+
+#define FIFO_FRAMES  40
+#define FIFO_SHIFT   4
+#define FIFO_BASE_NS 1000000ULL
+#define FIFO_ODR_NS  1000U
+
+/* FIFO of three axis frames, axis a of frame n holds n * 16 + a in units of 2^-23 */
+static uint8_t fifo_buffer[1];
+
+static q31_t fifo_value(uint32_t frame, int axis)
+{
+	return (q31_t)((frame * 16U + axis) << 4);
+}
+
+static int fifo_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec channel,
+				uint16_t *frame_count)
+{
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(channel);
+
+	*frame_count = FIFO_FRAMES;
+	return 0;
+}
+
+static bool fifo_is_accel(struct sensor_chan_spec channel)
+{
+	return channel.chan_type == SENSOR_CHAN_ACCEL_X || channel.chan_type == SENSOR_CHAN_ACCEL_Y ||
+	       channel.chan_type == SENSOR_CHAN_ACCEL_Z || channel.chan_type == SENSOR_CHAN_ACCEL_XYZ;
+}
+
+/* Single accelerometer axes are decoded as three axis data too */
+static int fifo_get_size_info(struct sensor_chan_spec channel, size_t *base_size,
+			      size_t *frame_size)
+{
+	if (fifo_is_accel(channel)) {
+		*base_size = sizeof(struct sensor_three_axis_data);
+		*frame_size = sizeof(struct sensor_three_axis_sample_data);
+		return 0;
+	}
+
+	return sensor_natively_supported_channel_size_info(channel, base_size, frame_size);
+}
+
+static int fifo_decode(const uint8_t *buffer, struct sensor_chan_spec channel, uint32_t *fit,
+		       uint16_t max_count, void *data_out)
+{
+	uint16_t count = MIN(max_count, FIFO_FRAMES - *fit);
+
+	ARG_UNUSED(buffer);
+
+	if (fifo_is_accel(channel)) {
+		struct sensor_three_axis_data *out = data_out;
+
+		out->header.base_timestamp_ns = FIFO_BASE_NS + *fit * FIFO_ODR_NS;
+		out->header.reading_count = count;
+		out->shift = FIFO_SHIFT;
+		for (uint16_t i = 0; i < count; i++) {
+			out->readings[i].timestamp_delta = i * FIFO_ODR_NS;
+			for (int axis = 0; axis < 3; axis++) {
+				out->readings[i].v[axis] = fifo_value(*fit + i, axis);
+			}
+		}
+	} else if (channel.chan_type == SENSOR_CHAN_DIE_TEMP ||
+		   channel.chan_type == SENSOR_CHAN_GRAVITY_VECTOR) {
+		struct sensor_q31_data *out = data_out;
+
+		out->header.base_timestamp_ns = FIFO_BASE_NS + *fit * FIFO_ODR_NS;
+		out->header.reading_count = count;
+		out->shift = FIFO_SHIFT;
+		for (uint16_t i = 0; i < count; i++) {
+			out->readings[i].timestamp_delta = i * FIFO_ODR_NS;
+			out->readings[i].value = fifo_value(*fit + i, 0);
+		}
+	} else {
+		return -ENOTSUP;
+	}
+
+	*fit += count;
+	return count;
+}
+
+static const struct sensor_decoder_api fifo_decoder = {
+	.get_frame_count = fifo_get_frame_count,
+	.decode = fifo_decode,
+};
+
+static const struct sensor_decoder_api fifo_decoder_size_info = {
+	.get_frame_count = fifo_get_frame_count,
+	.get_size_info = fifo_get_size_info,
+	.decode = fifo_decode,
+};
+
+static q31_t x[FIFO_FRAMES], y[FIFO_FRAMES], z[FIFO_FRAMES];
+static uint64_t timestamps[FIFO_FRAMES];
+
+/**
+ * @brief Test decoding a whole FIFO of three axis frames into q31 arrays
+ *
+ * @ingroup driver_sensor_subsys_tests
+ */
+ZTEST(sensor_decode_soa, test_decode_q31_soa)
+{
+	struct sensor_chan_spec chan = {SENSOR_CHAN_ACCEL_XYZ, 0};
+	q31_t *const values[] = {x, y, z};
+	uint32_t fit = 0;
+	int rc;
+
+	/* More frames than held by a single chunk, converted to a larger shift */
+	rc = sensor_decode_q31_soa(&fifo_decoder, fifo_buffer, chan, &fit, FIFO_FRAMES,
+				   FIFO_SHIFT + 2, values, timestamps);
+	zassert_equal(rc, FIFO_FRAMES);
+	zassert_equal(fit, FIFO_FRAMES);
+
+	for (uint32_t i = 0; i < FIFO_FRAMES; i++) {
+		zassert_equal(x[i], fifo_value(i, 0) >> 2);
+		zassert_equal(y[i], fifo_value(i, 1) >> 2);
+		zassert_equal(z[i], fifo_value(i, 2) >> 2);
+		zassert_equal(timestamps[i], FIFO_BASE_NS + i * FIFO_ODR_NS);
+	}
+
+	/* Nothing left to decode */
+	rc = sensor_decode_q31_soa(&fifo_decoder, fifo_buffer, chan, &fit, FIFO_FRAMES,
+				   FIFO_SHIFT, values, NULL);
+	zassert_equal(rc, 0);
+}
+
+/**
+ * @brief Test saturation of values not fitting the requested shift
+ *
+ * @ingroup driver_sensor_subsys_tests
+ */
+ZTEST(sensor_decode_soa, test_decode_q31_soa_saturate)
+{
+	struct sensor_chan_spec chan = {SENSOR_CHAN_DIE_TEMP, 0};
+	q31_t *const values[] = {x};
+	uint32_t fit = 0;
+	int rc;
+
+	rc = sensor_decode_q31_soa(&fifo_decoder, fifo_buffer, chan, &fit, FIFO_FRAMES, -20,
+				   values, NULL);
+	zassert_equal(rc, FIFO_FRAMES);
+	zassert_equal(x[0], 0);
+	zassert_equal(x[1], INT32_MAX);
+}
+
+/**
+ * @brief Test decoding into float arrays, in part
+ *
+ * @ingroup driver_sensor_subsys_tests
+ */
+ZTEST(sensor_decode_soa, test_decode_float_soa)
+{
+	static float fx[FIFO_FRAMES], fy[FIFO_FRAMES], fz[FIFO_FRAMES];
+	struct sensor_chan_spec chan = {SENSOR_CHAN_ACCEL_XYZ, 0};
+	float *const values[] = {fx, fy, fz};
+	uint32_t fit = 0;
+	int rc;
+
+	rc = sensor_decode_float_soa(&fifo_decoder, fifo_buffer, chan, &fit, 3, values, NULL);
+	zassert_equal(rc, 3);
+	zassert_equal(fit, 3);
+
+	/* Frame 2, axis 1 is 33 * 2^-23 */
+	zassert_within(fy[2], 33.0f / (float)BIT(23), 1e-12f);
+	zassert_within(fz[0], 2.0f / (float)BIT(23), 1e-12f);
+}
+
+/**
+ * @brief Test decoding a single axis of three axis frames
+ *
+ * @ingroup driver_sensor_subsys_tests
+ */
+ZTEST(sensor_decode_soa, test_decode_q31_soa_single_axis)
+{
+	struct sensor_chan_spec chan = {SENSOR_CHAN_ACCEL_Y, 0};
+	q31_t *const values[] = {x};
+	uint32_t fit = 0;
+	int rc;
+
+	rc = sensor_decode_q31_soa(&fifo_decoder_size_info, fifo_buffer, chan, &fit, FIFO_FRAMES,
+				   FIFO_SHIFT, values, NULL);
+	zassert_equal(rc, FIFO_FRAMES);
+
+	for (uint32_t i = 0; i < FIFO_FRAMES; i++) {
+		zassert_equal(x[i], fifo_value(i, 1));
+	}
+}
+
+/**
+ * @brief Test channels natively decoded as q31 data have a single axis
+ *
+ * @ingroup driver_sensor_subsys_tests
+ */
+ZTEST(sensor_decode_soa, test_decode_q31_soa_gravity_vector)
+{
+	struct sensor_chan_spec chan = {SENSOR_CHAN_GRAVITY_VECTOR, 0};
+	q31_t *const values[] = {x};
+	uint32_t fit = 0;
+	int rc;
+
+	rc = sensor_decode_q31_soa(&fifo_decoder_size_info, fifo_buffer, chan, &fit, FIFO_FRAMES,
+				   FIFO_SHIFT, values, NULL);
+	zassert_equal(rc, FIFO_FRAMES);
+	zassert_equal(x[FIFO_FRAMES - 1], fifo_value(FIFO_FRAMES - 1, 0));
+}
+
+/**
+ * @brief Test channels which are not q31 or three axis data are rejected
+ *
+ * @ingroup driver_sensor_subsys_tests
+ */
+ZTEST(sensor_decode_soa, test_decode_soa_not_supported)
+{
+	struct sensor_chan_spec chan = {SENSOR_CHAN_PROX, 0};
+	q31_t *const values[] = {x};
+	uint32_t fit = 0;
+
+	zassert_equal(sensor_decode_q31_soa(&fifo_decoder, fifo_buffer, chan, &fit, 1, 0,
+					    values, NULL),
+		      -ENOTSUP);
+}
+
+ZTEST_SUITE(sensor_decode_soa, NULL, NULL, NULL, NULL, NULL);
+
+#endif /* CONFIG_SENSOR_ASYNC_API */
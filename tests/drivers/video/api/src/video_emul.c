@@ -196,4 +196,44 @@ ZTEST(video_common, test_video_vbuf)
 	video_buffer_release(vbuf);
 }
 
+ZTEST(video_common, test_video_vbuf_share)
+{
+	struct video_format fmt = {.type = VIDEO_BUF_TYPE_OUTPUT};
+	struct video_buffer *vbuf;
+	struct video_buffer *out;
+
+	zexpect_ok(video_get_format(rx_dev, &fmt));
+
+	vbuf = video_buffer_alloc(fmt.pitch * fmt.height, K_NO_WAIT);
+	zassert_not_null(vbuf);
+	vbuf->type = fmt.type;
+
+	zexpect_ok(video_stream_start(rx_dev, fmt.type));
+	zexpect_ok(video_enqueue(rx_dev, vbuf));
+	zexpect_ok(video_dequeue(rx_dev, &out, K_FOREVER));
+	zexpect_equal_ptr(out, vbuf);
+
+	/* Hand the frame to two consumers, a third one joins later */
+	zexpect_ok(video_buffer_share(rx_dev, vbuf, 2));
+	zexpect_equal(video_buffer_share(rx_dev, vbuf, 1), -EBUSY);
+	zexpect_ok(video_buffer_ref(vbuf));
+
+	zexpect_ok(video_buffer_unref(vbuf));
+	zexpect_ok(video_buffer_unref(vbuf));
+	zexpect_equal(video_dequeue(rx_dev, &out, K_MSEC(100)), -EAGAIN);
+
+	/* The last consumer gives the buffer back to the capture device */
+	zexpect_ok(video_buffer_unref(vbuf));
+	zexpect_equal(video_buffer_unref(vbuf), -EINVAL);
+	zexpect_ok(video_dequeue(rx_dev, &out, K_FOREVER));
+	zexpect_equal_ptr(out, vbuf);
+
+	zexpect_ok(video_stream_stop(rx_dev, fmt.type));
+
+	/* Without a device, the buffer returns to the pool */
+	zexpect_ok(video_buffer_share(NULL, vbuf, 1));
+	zexpect_ok(video_buffer_unref(vbuf));
+	zexpect_equal(video_buffer_ref(vbuf), -EINVAL);
+}
+
 ZTEST_SUITE(video_emul, NULL, NULL, NULL, NULL, NULL);
@@ -65,6 +65,41 @@ ZTEST(cache_api, test_data_cache_api)
 
 }
 
+ZTEST(cache_api, test_data_cache_ranges)
+{
+	struct sys_cache_range ranges[] = {
+		{&user_buffer[SIZE / 2], SIZE / 4},
+		{&user_buffer[1], 100},
+		{&user_buffer[SIZE / 2 + 8], 16},
+		{&user_buffer[SIZE - 1], 0},
+		{&user_buffer[101], SIZE / 8},
+	};
+	int ret;
+
+	for (size_t i = 0; i < SIZE; i++) {
+		user_buffer[i] = (uint8_t)i;
+	}
+
+	ret = sys_cache_data_flush_ranges(ranges, ARRAY_SIZE(ranges));
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	/* The ranges were merged in place, but still cover the same lines. They
+	 * were flushed first, so the data is still there.
+	 */
+	ret = sys_cache_data_invd_ranges(ranges, ARRAY_SIZE(ranges));
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	ret = sys_cache_data_flush_and_invd_ranges(ranges, ARRAY_SIZE(ranges));
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	ret = sys_cache_data_flush_ranges(ranges, 0);
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	for (size_t i = 0; i < SIZE; i++) {
+		zassert_equal(user_buffer[i], (uint8_t)i, "data lost at %zu", i);
+	}
+}
+
 ZTEST_USER(cache_api, test_data_cache_api_user)
 {
 	int ret;
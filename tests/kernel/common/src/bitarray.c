@@ -525,6 +525,54 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 	alloc_and_free_interval();
 }
 
+/**
+ * @brief Test allocation in a large, mostly allocated bitarray
+ *
+ * Allocations are first fit, across fully allocated bundles.
+ *
+ * @see sys_bitarray_alloc()
+ * @see sys_bitarray_free()
+ */
+ZTEST(bitarray, test_bitarray_alloc_large)
+{
+	SYS_BITARRAY_DEFINE_STATIC(ba, 4000);
+	size_t offset;
+	int ret;
+
+	/* Fill the array with 8-bit regions and 3 bits, leaving a 5-bit tail */
+	for (size_t i = 0; i < ba.num_bits / 8 - 1; i++) {
+		ret = sys_bitarray_alloc(&ba, 8, &offset);
+		zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+		zassert_equal(offset, i * 8, "offset expected %u, got %u", i * 8, offset);
+	}
+	zassert_ok(sys_bitarray_alloc(&ba, 3, &offset));
+	zassert_equal(offset, ba.num_bits - 8);
+
+	ret = sys_bitarray_alloc(&ba, 6, &offset);
+	zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc() should fail: %d", ret);
+
+	/* Free two adjacent regions far in the array, and one before them */
+	zassert_ok(sys_bitarray_free(&ba, 8, 3000));
+	zassert_ok(sys_bitarray_free(&ba, 8, 3008));
+	zassert_ok(sys_bitarray_free(&ba, 8, 1000));
+
+	ret = sys_bitarray_alloc(&ba, 12, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+	zassert_equal(offset, 3000, "offset expected %u, got %u", 3000, offset);
+
+	ret = sys_bitarray_alloc(&ba, 5, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+	zassert_equal(offset, 1000, "offset expected %u, got %u", 1000, offset);
+
+	ret = sys_bitarray_alloc(&ba, 5, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+	zassert_equal(offset, ba.num_bits - 5, "offset expected %u, got %u",
+		      ba.num_bits - 5, offset);
+
+	zassert_true(sys_bitarray_is_region_cleared(&ba, 3, 1005));
+	zassert_true(sys_bitarray_is_region_cleared(&ba, 4, 3012));
+}
+
 ZTEST(bitarray, test_bitarray_popcount_region)
 {
 	int ret;
@@ -510,6 +510,29 @@ ZTEST(device, test_device_get_by_dt_nodelabel)
 }
 #endif
 
+#ifdef CONFIG_INIT_PROFILE
+ZTEST(device, test_init_profile)
+{
+	const struct device *dev = device_get_binding(DUMMY_NOINIT);
+	const struct init_profile_record *records;
+	size_t count = init_profile_get(&records);
+	bool found = false;
+
+	zassert_not_equal(count, 0, "No init entry recorded");
+
+	for (size_t i = 0; i < count; i++) {
+		if (records[i].is_device && (records[i].entry->dev == dev)) {
+			/* POST_KERNEL */
+			zassert_equal(records[i].level, 3);
+			zassert_ok(records[i].result);
+			found = true;
+		}
+	}
+
+	zassert_true(found, "Device init entry not recorded");
+}
+#endif
+
 void *user_setup(void)
 {
 #ifdef CONFIG_USERSPACE
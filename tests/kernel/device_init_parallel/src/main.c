@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/init.h>
+
+#define TEST_I2C       DT_NODELABEL(test_i2c)
+#define TEST_DEV       DT_NODELABEL(test_dev)
+#define TEST_GPIO      DT_NODELABEL(test_gpio)
+#define TEST_GPIO_FAIL DT_NODELABEL(test_gpio_fail)
+
+#define SLOW_INIT_MS 50
+
+static int64_t boot_start;
+static int64_t boot_end;
+static bool dev_saw_bus;
+
+static int start_init(void)
+{
+	boot_start = k_uptime_get();
+
+	return 0;
+}
+
+static int end_init(void)
+{
+	boot_end = k_uptime_get();
+
+	return 0;
+}
+
+static int slow_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_msleep(SLOW_INIT_MS);
+
+	return 0;
+}
+
+static int dev_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	dev_saw_bus = device_is_ready(DEVICE_DT_GET(TEST_I2C));
+
+	return 0;
+}
+
+static int fail_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return -EIO;
+}
+
+SYS_INIT(start_init, POST_KERNEL, 0);
+/* The bus and the GPIO controller sleep in their init and are independent */
+DEVICE_DT_DEFINE(TEST_I2C, slow_init, NULL, NULL, NULL, POST_KERNEL, 10, NULL);
+DEVICE_DT_DEFINE(TEST_DEV, dev_init, NULL, NULL, NULL, POST_KERNEL, 20, NULL);
+DEVICE_DT_DEFINE(TEST_GPIO, slow_init, NULL, NULL, NULL, POST_KERNEL, 30, NULL);
+DEVICE_DT_DEFINE(TEST_GPIO_FAIL, fail_init, NULL, NULL, NULL, POST_KERNEL, 40, NULL);
+SYS_INIT(end_init, POST_KERNEL, 99);
+
+ZTEST(device_init_parallel, test_dependency_order)
+{
+	zassert_true(dev_saw_bus, "Device initialized before the bus it requires");
+	zassert_true(device_is_ready(DEVICE_DT_GET(TEST_DEV)));
+}
+
+ZTEST(device_init_parallel, test_overlap)
+{
+	zassert_true(device_is_ready(DEVICE_DT_GET(TEST_I2C)));
+	zassert_true(device_is_ready(DEVICE_DT_GET(TEST_GPIO)));
+	zassert_true(boot_end - boot_start < 2 * SLOW_INIT_MS,
+		     "Independent devices did not initialize concurrently (%lld ms)",
+		     boot_end - boot_start);
+}
+
+ZTEST(device_init_parallel, test_failure)
+{
+	const struct device *dev = DEVICE_DT_GET(TEST_GPIO_FAIL);
+
+	zassert_false(device_is_ready(dev));
+	zassert_equal(dev->state->init_res, EIO);
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
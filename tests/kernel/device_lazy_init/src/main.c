@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+
+#define TEST_ON_USE DEVICE_DT_GET(DT_NODELABEL(test_on_use))
+#define TEST_ASYNC  DEVICE_DT_GET(DT_NODELABEL(test_async))
+#define TEST_FAIL   DEVICE_DT_GET(DT_NODELABEL(test_fail))
+#define TEST_SYNC   DEVICE_DT_GET(DT_NODELABEL(test_sync))
+
+static atomic_t init_count;
+
+static int dev_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	atomic_inc(&init_count);
+
+	return 0;
+}
+
+static int fail_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return -EIO;
+}
+
+DEVICE_DT_DEFINE(DT_NODELABEL(test_on_use), dev_init, NULL, NULL, NULL, POST_KERNEL, 10, NULL);
+DEVICE_DT_DEFINE(DT_NODELABEL(test_async), dev_init, NULL, NULL, NULL, POST_KERNEL, 20, NULL);
+DEVICE_DT_DEFINE(DT_NODELABEL(test_fail), fail_init, NULL, NULL, NULL, POST_KERNEL, 30, NULL);
+DEVICE_DT_DEFINE(DT_NODELABEL(test_sync), dev_init, NULL, NULL, NULL, POST_KERNEL, 40, NULL);
+
+struct init_result {
+	struct k_sem sem;
+	const struct device *dev;
+	int result;
+};
+
+static void init_done(const struct device *dev, int result, void *user_data)
+{
+	struct init_result *res = user_data;
+
+	res->dev = dev;
+	res->result = result;
+	k_sem_give(&res->sem);
+}
+
+ZTEST(device_lazy_init, test_init_on_first_use)
+{
+	/* Not initialized at boot, the first check starts the initialization */
+	zassert_false(device_is_ready(TEST_ON_USE));
+	k_msleep(10);
+	zassert_true(device_is_ready(TEST_ON_USE));
+	zassert_equal(device_init(TEST_ON_USE), -EALREADY);
+}
+
+ZTEST(device_lazy_init, test_init_async)
+{
+	struct device_init_req req;
+	struct init_result res;
+	atomic_val_t count = atomic_get(&init_count);
+
+	k_sem_init(&res.sem, 0, 1);
+
+	zassert_ok(device_init_async(TEST_ASYNC, &req, init_done, &res));
+	zassert_ok(k_sem_take(&res.sem, K_MSEC(100)));
+	zassert_equal_ptr(res.dev, TEST_ASYNC);
+	zassert_ok(res.result);
+	zassert_true(device_is_ready(TEST_ASYNC));
+	zassert_equal(atomic_get(&init_count), count + 1);
+
+	zassert_equal(device_init_async(TEST_ASYNC, &req, init_done, &res), -EALREADY);
+}
+
+ZTEST(device_lazy_init, test_init_async_failure)
+{
+	struct device_init_req req;
+	struct init_result res;
+
+	k_sem_init(&res.sem, 0, 1);
+
+	zassert_ok(device_init_async(TEST_FAIL, &req, init_done, &res));
+	zassert_ok(k_sem_take(&res.sem, K_MSEC(100)));
+	zassert_equal(res.result, -EIO);
+	zassert_false(device_is_ready(TEST_FAIL));
+}
+
+ZTEST(device_lazy_init, test_init_async_and_sync)
+{
+	struct device_init_req req;
+	struct init_result res;
+	atomic_val_t count = atomic_get(&init_count);
+
+	k_sem_init(&res.sem, 0, 1);
+
+	/* Keep the request pending while the device is initialized directly */
+	k_sched_lock();
+	zassert_ok(device_init_async(TEST_SYNC, &req, init_done, &res));
+	zassert_ok(device_init(TEST_SYNC));
+	k_sched_unlock();
+
+	/* The request completes with the result of the direct initialization */
+	zassert_ok(k_sem_take(&res.sem, K_MSEC(100)));
+	zassert_equal_ptr(res.dev, TEST_SYNC);
+	zassert_ok(res.result);
+	zassert_true(device_is_ready(TEST_SYNC));
+	zassert_equal(atomic_get(&init_count), count + 1, "Device initialized twice");
+}
+
+ZTEST_SUITE(device_lazy_init, NULL, NULL, NULL, NULL, NULL);
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2021 Intel Corporation
+ * Copyright (c) 2026 Audio Inventions Ltd
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -21,6 +22,9 @@ static K_THREAD_STACK_DEFINE(sreceiver, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(sextra1, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(sextra2, STACK_SIZE);
 
+static struct k_thread twaiters[2];
+static K_THREAD_STACK_ARRAY_DEFINE(swaiters, ARRAY_SIZE(twaiters), STACK_SIZE);
+
 static K_EVENT_DEFINE(test_event);
 static K_EVENT_DEFINE(sync_event);
 
@@ -46,6 +50,22 @@ static void entry_extra2(void *p1, void *p2, void *p3)
 
 	k_event_post(&test_event, events);
 }
+static void entry_waiter(void *p1, void *p2, void *p3)
+{
+	struct k_event *event = p1;
+	uint32_t  desired = (uint32_t)(uintptr_t)p2;
+	bool      all = (bool)(uintptr_t)p3;
+	uint32_t  events;
+
+	if (all) {
+		events = k_event_wait_all(event, desired, false, LONG_TIMEOUT);
+	} else {
+		events = k_event_wait(event, desired, false, LONG_TIMEOUT);
+	}
+
+	k_event_post(&test_event, events);
+}
+
 /**
  * @ingroup kernel_event_tests
  * @{
@@ -67,13 +87,15 @@ ZTEST(events_api, test_k_event_init)
 	/*
 	 * The type of wait queue used by the event may vary depending upon
 	 * which kernel features have been enabled. As such, the most flexible
-	 * useful check is to verify that the waitq is empty.
+	 * useful check is to verify that the waitqs are empty.
 	 */
 
+	for (size_t i = 0; i < ARRAY_SIZE(event.wait_q); i++) {
+		thread = z_waitq_head(&event.wait_q[i]);
 
-	thread = z_waitq_head(&event.wait_q);
-
-	zassert_is_null(thread, NULL);
+		zassert_is_null(thread, NULL);
+		zassert_true(event.waiting[i] == 0);
+	}
 	zassert_true(event.events == 0);
 }
 
@@ -434,6 +456,54 @@ ZTEST(events_api, test_event_receive)
 
 	test_wake_multiple_threads();
 }
+/**
+ * Test that posting events only wakes the matching waiters.
+ *
+ * The waiters wait for events whose lowest one is in a different wait queue
+ * than the others, and are woken by events other than the lowest one.
+ */
+
+ZTEST(events_api, test_event_wait_q_partitions)
+{
+	static struct k_event  event;
+	uint32_t  events;
+
+	k_event_init(&event);
+	k_event_clear(&test_event, ~0);
+
+	(void) k_thread_create(&twaiters[0], swaiters[0], STACK_SIZE,
+			       entry_waiter, &event, (void *)0x80000011,
+			       (void *)true, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	(void) k_thread_create(&twaiters[1], swaiters[1], STACK_SIZE,
+			       entry_waiter, &event, (void *)0x0000F100,
+			       (void *)false, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_sleep(DELAY);
+
+	/* Events nobody waits for, and only part of the first mask */
+
+	k_event_post(&event, 0x00000E01);
+	events = k_event_wait(&test_event, ~0, false, DELAY);
+	zassert_equal(events, 0);
+
+	/* Completes the first mask, through its highest event */
+
+	k_event_post(&event, 0x80000010);
+	events = k_event_wait(&test_event, ~0, false, SHORT_TIMEOUT);
+	zassert_equal(events, 0x80000011);
+	k_event_clear(&test_event, ~0);
+
+	/* One of the events of the second mask, other than the lowest */
+
+	k_event_post(&event, 0x00004000);
+	events = k_event_wait(&test_event, ~0, false, SHORT_TIMEOUT);
+	zassert_equal(events, 0x00004000);
+
+	k_thread_join(&twaiters[0], K_FOREVER);
+	k_thread_join(&twaiters[1], K_FOREVER);
+}
+
 /**
  * @}
  */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_fifo.h"
+
+#define TIMEOUT K_MSEC(100)
+#define NUM_ITEMS 5
+
+static fdata_t items[NUM_ITEMS];
+
+/**
+ * @addtogroup kernel_fifo_tests
+ * @{
+ */
+
+/**
+ * @brief Test getting several FIFO items at once
+ * @details Put some data items into a FIFO and verify that
+ * k_fifo_get_n() returns them in order, never more than requested,
+ * and 0 once the FIFO is empty.
+ * @see k_fifo_put(), k_fifo_get_n()
+ */
+ZTEST(fifo_api, test_fifo_get_n)
+{
+	static struct k_fifo fifo;
+	void *out[NUM_ITEMS + 1];
+
+	k_fifo_init(&fifo);
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		items[i].data = i;
+		k_fifo_put(&fifo, &items[i]);
+	}
+
+	/**TESTPOINT: no more than max_items are taken */
+	zassert_equal(k_fifo_get_n(&fifo, out, 2, K_NO_WAIT), 2);
+	zassert_equal_ptr(out[0], &items[0]);
+	zassert_equal_ptr(out[1], &items[1]);
+
+	/**TESTPOINT: whatever is left is returned in order */
+	zassert_equal(k_fifo_get_n(&fifo, out, ARRAY_SIZE(out), K_NO_WAIT),
+		      NUM_ITEMS - 2);
+	for (int i = 0; i < NUM_ITEMS - 2; i++) {
+		zassert_equal_ptr(out[i], &items[i + 2]);
+	}
+
+	/**TESTPOINT: an empty FIFO yields nothing */
+	zassert_equal(k_fifo_get_n(&fifo, out, ARRAY_SIZE(out), K_NO_WAIT), 0);
+	zassert_equal(k_fifo_get_n(&fifo, out, ARRAY_SIZE(out), TIMEOUT), 0);
+	zassert_true(k_fifo_is_empty(&fifo));
+}
+/**
+ * @}
+ */
@@ -113,6 +113,9 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+	printk("* Read ahead (%s):\n", scope);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.pages);
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -328,6 +331,46 @@ ZTEST(demand_paging_api, test_k_mem_unpin)
 	test_k_mem_page_out();
 }
 
+#if CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0
+ZTEST(demand_paging_api, test_read_ahead)
+{
+	struct k_mem_paging_stats_t stats;
+	unsigned long faults, read_ahead;
+	int key, ret;
+
+	k_mem_paging_stats_get(&stats);
+	read_ahead = stats.read_ahead.pages;
+
+	/* Lock IRQs to prevent other pagefaults from happening while we
+	 * are measuring stuff
+	 */
+	key = irq_lock();
+
+	/* Evicting the pages frees the page frames they are read ahead into */
+	ret = k_mem_page_out(arena, HALF_BYTES);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	faults = k_mem_num_pagefaults_get();
+	/* Read the evicted region back sequentially */
+	for (size_t i = 0; i < HALF_BYTES; i++) {
+		zassert_equal(arena[i], nums[i % 10],
+			      "arena corrupted at index %d: got 0x%hhx", i, arena[i]);
+	}
+	faults = k_mem_num_pagefaults_get() - faults;
+	irq_unlock(key);
+
+	k_mem_paging_stats_get(&stats);
+	print_paging_stats(&stats, "kernel");
+	read_ahead = stats.read_ahead.pages - read_ahead;
+
+	zassert_true(faults < HALF_PAGES,
+		     "%lu page faults for %d pages, none read ahead", faults, HALF_PAGES);
+	zassert_true(read_ahead >= HALF_PAGES - faults,
+		     "%lu pages read ahead, %lu expected at least", read_ahead,
+		     (unsigned long)HALF_PAGES - faults);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES > 0 */
+
 /* Show that even if we map enough anonymous memory to fill the backing
  * store, we can still handle pagefaults.
  * This eats up memory so should be last in the suite.
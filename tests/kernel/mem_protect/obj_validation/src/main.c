@@ -183,6 +183,31 @@ ZTEST(object_validation, test_no_ref_dyn_kobj_release_mem)
 	zassert_true(ret == -EBADF, "Dynamic kernel object not released");
 }
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+/**
+ * @brief Test validated objects are cached until a permission is revoked
+ *
+ * @ingroup kernel_memprotect_tests
+ */
+ZTEST(object_validation, test_object_cache)
+{
+	static struct k_sem cached_sem;
+
+	k_object_access_grant(&cached_sem, k_current_get());
+	k_sem_init(&cached_sem, 0, 1);
+
+	zassert_ok(k_object_validation_check_ptr(&cached_sem, K_OBJ_SEM,
+						 _OBJ_INIT_TRUE));
+	zassert_true(k_object_cache_test(&cached_sem, K_OBJ_SEM));
+	zassert_false(k_object_cache_test(&cached_sem, K_OBJ_MUTEX));
+
+	k_object_access_revoke(&cached_sem, k_current_get());
+	zassert_false(k_object_cache_test(&cached_sem, K_OBJ_SEM));
+	zassert_equal(k_object_validate(k_object_find(&cached_sem), K_OBJ_SEM,
+					_OBJ_INIT_TRUE), -EPERM);
+}
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 void *object_validation_setup(void)
 {
 	k_thread_system_pool_assign(k_current_get());
@@ -378,6 +378,20 @@ ZTEST_USER(syscalls, test_arg64)
 	run_test_arg64();
 }
 
+/**
+ * @brief Test the uptime read by user threads without a system call
+ */
+ZTEST_USER(syscalls, test_uptime_ticks)
+{
+	int64_t start;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_USERSPACE_TIME_PAGE);
+
+	start = k_uptime_ticks();
+	k_sleep(K_TICKS(5));
+	zassert_true(k_uptime_ticks() >= start + 5, "uptime did not advance");
+}
+
 ZTEST_USER(syscalls, test_more_args)
 {
 	zassert_equal(more_args(1, 2, 3, 4, 5, 6, 7),
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 8
+
+extern struct k_msgq msgq;
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+
+static ZTEST_BMEM char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_DMEM uint32_t send_buf[BATCH_LEN + 2];
+static ZTEST_BMEM uint32_t rec_buf[BATCH_LEN + 2];
+static ZTEST_BMEM int rec_count;
+
+static void batch_put_get(struct k_msgq *q)
+{
+	uint32_t next = 0;
+	int ret;
+
+	for (int i = 0; i < ARRAY_SIZE(send_buf); i++) {
+		send_buf[i] = MSG0 + i;
+	}
+
+	/* move the read and write pointers so the batches wrap around */
+	ret = k_msgq_put_many(q, send_buf, 3, K_NO_WAIT);
+	zassert_equal(ret, 3);
+	ret = k_msgq_get_many(q, rec_buf, 2, K_NO_WAIT);
+	zassert_equal(ret, 2);
+	zassert_equal(rec_buf[0], MSG0);
+	zassert_equal(rec_buf[1], MSG0 + 1);
+	next = 2;
+
+	/**TESTPOINT: a partial batch is sent when the queue fills up */
+	ret = k_msgq_put_many(q, &send_buf[3], BATCH_LEN, K_NO_WAIT);
+	zassert_equal(ret, BATCH_LEN - 1);
+	zassert_equal(k_msgq_num_free_get(q), 0);
+	ret = k_msgq_put_many(q, send_buf, 1, TIMEOUT);
+	zassert_equal(ret, -EAGAIN);
+
+	/**TESTPOINT: the whole queue is received in FIFO order */
+	ret = k_msgq_get_many(q, rec_buf, ARRAY_SIZE(rec_buf), K_NO_WAIT);
+	zassert_equal(ret, BATCH_LEN);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rec_buf[i], MSG0 + next + i);
+	}
+
+	ret = k_msgq_get_many(q, rec_buf, ARRAY_SIZE(rec_buf), K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG);
+	zassert_equal(k_msgq_put_many(q, send_buf, 0, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_many(q, rec_buf, 0, K_NO_WAIT), 0);
+}
+
+static void batch_reader(void *p1, void *p2, void *p3)
+{
+	rec_count = k_msgq_get_many((struct k_msgq *)p1, rec_buf, ARRAY_SIZE(rec_buf),
+				    K_FOREVER);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving batches of messages
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_batch)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	batch_put_get(&msgq);
+}
+
+/**
+ * @brief Test a blocked batch receiver getting a whole batch
+ *
+ * @details A higher priority thread waits in k_msgq_get_many() on an
+ * empty queue. A single k_msgq_put_many() call must wake it once, and it
+ * must then receive the complete batch.
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch_pend)
+{
+	int ret;
+
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	for (int i = 0; i < ARRAY_SIZE(send_buf); i++) {
+		send_buf[i] = MSG1 + i;
+	}
+	rec_count = 0;
+
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE, batch_reader, &msgq, NULL,
+				  NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS);
+
+	ret = k_msgq_put_many(&msgq, send_buf, 4, K_NO_WAIT);
+	zassert_equal(ret, 4);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+
+	zassert_equal(rec_count, 4);
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(rec_buf[i], MSG1 + i);
+	}
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test batch send and receive from user mode
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_batch)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+	batch_put_get(q);
+}
+#endif /* CONFIG_USERSPACE */
+
+/**
+ * @}
+ */
@@ -469,6 +469,58 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&tmutex);
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+#define CONTENTION_LOOPS 20000
+
+static struct k_mutex spin_mutex;
+static volatile uint32_t spin_count;
+
+static void tThread_mutex_contend(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < CONTENTION_LOOPS; i++) {
+		zassert_ok(k_mutex_lock(&spin_mutex, K_FOREVER));
+		/* Short critical section, the other CPU spins on it */
+		spin_count++;
+		k_busy_wait(1);
+		zassert_ok(k_mutex_unlock(&spin_mutex));
+	}
+}
+
+/**
+ * @brief Test mutex contention between CPUs
+ *
+ * @details Threads on two CPUs lock the same mutex for short critical
+ * sections, so that most of the time the owner runs on the other CPU and
+ * the locking thread spins. No increment made under the mutex is lost.
+ */
+ZTEST(mutex_api, test_mutex_smp_contention)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	k_mutex_init(&spin_mutex);
+	spin_count = 0;
+
+	k_thread_create(&tdata, tstack, K_THREAD_STACK_SIZEOF(tstack), tThread_mutex_contend,
+			NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+	k_thread_create(&tdata2, tstack2, K_THREAD_STACK_SIZEOF(tstack2), tThread_mutex_contend,
+			NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+
+	zassert_ok(k_thread_join(&tdata, K_FOREVER));
+	zassert_ok(k_thread_join(&tdata2, K_FOREVER));
+
+	zassert_equal(spin_count, 2 * CONTENTION_LOOPS, "%u increments, not %u", spin_count,
+		      2 * CONTENTION_LOOPS);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
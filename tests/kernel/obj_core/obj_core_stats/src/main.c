@@ -11,6 +11,9 @@ SYS_MEM_BLOCKS_DEFINE(mem_block, 32, 4, 16);  /* Four 32 byte blocks */
 
 K_MEM_SLAB_DEFINE(mem_slab, 32, 4, 16);       /* Four 32 byte blocks */
 
+K_MUTEX_DEFINE(stats_mutex);
+K_SEM_DEFINE(stats_sem, 1, 1);
+
 #if !defined(CONFIG_ARCH_POSIX) && !defined(CONFIG_SPARC) && !defined(CONFIG_MIPS)
 static void test_thread_entry(void *, void *, void *);
 K_THREAD_DEFINE(test_thread, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE,
@@ -693,6 +696,65 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** MUTEX and SEMAPHORE ******************/
+
+ZTEST(obj_core_stats_lock, test_obj_core_stats_mutex)
+{
+	struct k_lock_stats raw;
+	int status;
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_mutex));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	/* Nested lock is not counted as an acquisition */
+
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_unlock(&stats_mutex);
+	k_mutex_unlock(&stats_mutex);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	k_mutex_unlock(&stats_mutex);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_mutex), &raw, sizeof(raw));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(raw.acquired, 2, "Expected 2 acquisitions, got %u\n", raw.acquired);
+	zassert_equal(raw.contended, 0, "Expected 0 contended, got %u\n", raw.contended);
+	zassert_equal(raw.total_wait, 0, "Expected no wait time\n");
+}
+
+ZTEST(obj_core_stats_lock, test_obj_core_stats_sem)
+{
+	struct k_lock_stats raw;
+	int status;
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_sem));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	/* 1st take succeeds, 2nd one waits and times out */
+
+	status = k_sem_take(&stats_sem, K_NO_WAIT);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	status = k_sem_take(&stats_sem, K_MSEC(10));
+	zassert_equal(status, -EAGAIN, "Expected -EAGAIN, got %d\n", status);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_sem), &raw, sizeof(raw));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(raw.acquired, 1, "Expected 1 acquisition, got %u\n", raw.acquired);
+	zassert_equal(raw.contended, 1, "Expected 1 contended, got %u\n", raw.contended);
+	zassert_true(raw.max_wait > 0, "Expected non-zero wait time\n");
+	zassert_equal(raw.total_wait, raw.max_wait, "Expected single wait\n");
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&stats_sem));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&stats_sem), &raw, sizeof(raw));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_equal(raw.acquired + raw.contended + raw.max_wait, 0,
+		      "Expected statistics to be reset\n");
+
+	k_sem_give(&stats_sem);
+}
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
@@ -704,3 +766,6 @@ ZTEST_SUITE(obj_core_stats_mem_block, NULL, NULL,
 
 ZTEST_SUITE(obj_core_stats_mem_slab, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+ZTEST_SUITE(obj_core_stats_lock, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
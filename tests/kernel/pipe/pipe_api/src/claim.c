@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/random/random.h>
+
+ZTEST_SUITE(k_pipe_claim, NULL, NULL, NULL, NULL, NULL);
+
+#define CLAIM_DATA_SIZE 12
+static struct k_thread thread;
+static K_THREAD_STACK_DEFINE(stack, 1024);
+static struct k_pipe pipe;
+
+static void thread_write(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t *input = arg2;
+
+	zassert_true(k_pipe_write((struct k_pipe *)arg1, input, 4, K_NO_WAIT) == 4,
+		"Failed to write to pipe");
+}
+
+ZTEST(k_pipe_claim, test_write_claim_commit)
+{
+	uint8_t buffer[CLAIM_DATA_SIZE];
+	uint8_t input[8];
+	uint8_t res[8];
+	uint8_t *area;
+
+	sys_rand_get(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_true(k_pipe_write_claim(&pipe, &area, sizeof(input), K_NO_WAIT) ==
+		sizeof(input), "Failed to claim space in pipe");
+	zassert_true(area == buffer, "Claimed area should be the start of the buffer");
+	zassert_true(k_pipe_write_claim(&pipe, &area, 1, K_NO_WAIT) == -EBUSY,
+		"Only one write claim may be outstanding");
+	zassert_true(k_pipe_write(&pipe, input, 1, K_NO_WAIT) == -EBUSY,
+		"Writing should fail while a write claim is outstanding");
+
+	memcpy(area, input, sizeof(input));
+	zassert_true(k_pipe_write_commit(&pipe, sizeof(input) + 1) == -EINVAL,
+		"Committing more than claimed should fail");
+	zassert_true(k_pipe_write_commit(&pipe, sizeof(input)) == 0, "Failed to commit");
+	zassert_true(k_pipe_write_commit(&pipe, 0) == -EINVAL,
+		"Committing without a claim should fail");
+
+	zassert_true(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT) == sizeof(res),
+		"Failed to read committed data from pipe");
+	zassert_true(memcmp(input, res, sizeof(input)) == 0,
+		"Unexpected data received from pipe");
+}
+
+ZTEST(k_pipe_claim, test_claim_wrap_around)
+{
+	uint8_t buffer[CLAIM_DATA_SIZE];
+	uint8_t input[8];
+	uint8_t *area;
+
+	sys_rand_get(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_true(k_pipe_write(&pipe, input, sizeof(input), K_NO_WAIT) == sizeof(input),
+		"Failed to write bytes to pipe");
+
+	/* only the contiguous space up to the end of the buffer is claimable */
+	zassert_true(k_pipe_write_claim(&pipe, &area, sizeof(input), K_NO_WAIT) ==
+		CLAIM_DATA_SIZE - sizeof(input), "Claim should stop at the buffer end");
+	zassert_true(k_pipe_write_commit(&pipe, 0) == 0, "Failed to release claim");
+
+	zassert_true(k_pipe_read_claim(&pipe, &area, 5, K_NO_WAIT) == 5,
+		"Failed to claim data in pipe");
+	zassert_true(memcmp(area, input, 5) == 0, "Unexpected data claimed from pipe");
+	zassert_true(k_pipe_read_claim(&pipe, &area, 1, K_NO_WAIT) == -EBUSY,
+		"Only one read claim may be outstanding");
+	zassert_true(k_pipe_read_finish(&pipe, 5) == 0, "Failed to finish read");
+
+	zassert_true(k_pipe_write(&pipe, input, sizeof(input), K_NO_WAIT) == sizeof(input),
+		"Failed to write bytes to pipe");
+
+	zassert_true(k_pipe_read_claim(&pipe, &area, CLAIM_DATA_SIZE, K_NO_WAIT) ==
+		CLAIM_DATA_SIZE - 5, "Claim should stop at the buffer end");
+	zassert_true(memcmp(area, &input[5], sizeof(input) - 5) == 0,
+		"Unexpected data claimed from pipe");
+	zassert_true(memcmp(&area[sizeof(input) - 5], input, CLAIM_DATA_SIZE - sizeof(input)) == 0,
+		"Unexpected data claimed from pipe");
+	zassert_true(k_pipe_read_finish(&pipe, CLAIM_DATA_SIZE - 5) == 0,
+		"Failed to finish read");
+
+	zassert_true(k_pipe_read_claim(&pipe, &area, CLAIM_DATA_SIZE, K_NO_WAIT) ==
+		sizeof(input) - (CLAIM_DATA_SIZE - sizeof(input)),
+		"Failed to claim wrapped data");
+	zassert_true(area == buffer, "Wrapped data should start at the buffer start");
+	zassert_true(k_pipe_read_finish(&pipe, 1) == 0, "Failed to finish partial read");
+	zassert_true(k_pipe_read_claim(&pipe, &area, 1, K_NO_WAIT) == 1,
+		"Unfinished data should remain in the pipe");
+	zassert_true(area == &buffer[1], "Unexpected claimed area");
+	zassert_true(k_pipe_read_finish(&pipe, 1) == 0, "Failed to finish read");
+}
+
+ZTEST(k_pipe_claim, test_read_claim_wait)
+{
+	k_tid_t tid;
+	uint8_t buffer[CLAIM_DATA_SIZE];
+	uint8_t input[4];
+	uint8_t *area;
+
+	sys_rand_get(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_true(k_pipe_read_claim(&pipe, &area, sizeof(input), K_MSEC(100)) == -EAGAIN,
+		"Should not be able to claim data from empty pipe");
+
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_write, &pipe, input, NULL, K_PRIO_COOP(0), 0, K_MSEC(100));
+	zassert_true(tid, "k_thread_create failed");
+
+	/* the writer must place the data in the buffer, not copy it to us */
+	zassert_true(k_pipe_read_claim(&pipe, &area, CLAIM_DATA_SIZE, K_MSEC(1000)) ==
+		sizeof(input), "Failed to claim data written while waiting");
+	zassert_true(memcmp(area, input, sizeof(input)) == 0,
+		"Unexpected data claimed from pipe");
+	zassert_true(k_pipe_read_finish(&pipe, sizeof(input)) == 0, "Failed to finish read");
+	k_thread_join(tid, K_FOREVER);
+}
+
+ZTEST(k_pipe_claim, test_claim_reset_close)
+{
+	uint8_t buffer[CLAIM_DATA_SIZE];
+	uint8_t data = 0x55;
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_true(k_pipe_write_claim(&pipe, &area, 1, K_NO_WAIT) == 1,
+		"Failed to claim space in pipe");
+	k_pipe_reset(&pipe);
+	zassert_true(k_pipe_write_commit(&pipe, 1) == -EINVAL,
+		"Reset should discard the write claim");
+
+	zassert_true(k_pipe_write(&pipe, &data, 1, K_NO_WAIT) == 1, "Failed to write to pipe");
+	zassert_true(k_pipe_read_claim(&pipe, &area, 1, K_NO_WAIT) == 1,
+		"Failed to claim data in pipe");
+	k_pipe_close(&pipe);
+	zassert_true(*area == data, "Unexpected data claimed from pipe");
+	zassert_true(k_pipe_read_finish(&pipe, 1) == 0,
+		"A read claim should survive closing the pipe");
+	zassert_true(k_pipe_read_claim(&pipe, &area, 1, K_NO_WAIT) == -EPIPE,
+		"Closed and empty pipe should return -EPIPE");
+	zassert_true(k_pipe_write_claim(&pipe, &area, 1, K_NO_WAIT) == -EPIPE,
+		"Closed pipe should return -EPIPE");
+}
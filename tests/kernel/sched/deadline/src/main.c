@@ -321,4 +321,61 @@ ZTEST(suite_deadline, test_thread_reschedule)
 }
 #endif /* CONFIG_MP_MAX_NUM_CPUS == 1 */
 
+#ifdef CONFIG_SCHED_DEADLINE_PERIODIC
+/**
+ * @brief Validate periodic release of a deadline thread
+ *
+ * @details Make the test thread periodic and check that it is released once
+ * per period, that a job running past its budget is counted as an overrun
+ * and that a job running past its deadline is reported.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_periodic)
+{
+	k_tid_t self = k_current_get();
+	int64_t start;
+	int64_t elapsed;
+
+	zassert_equal(k_thread_period_wait(), -EINVAL, "thread is not periodic");
+	zassert_equal(k_thread_period_set(self, MSEC_TO_CYCLES(20), 0, MSEC_TO_CYCLES(30)),
+		      -EINVAL, "deadline after the period accepted");
+	zassert_equal(k_thread_period_set(self, MSEC_TO_CYCLES(20), MSEC_TO_CYCLES(15),
+					  MSEC_TO_CYCLES(10)),
+		      -EINVAL, "budget after the deadline accepted");
+
+	zassert_ok(k_thread_period_set(self, MSEC_TO_CYCLES(20), MSEC_TO_CYCLES(5), 0));
+
+	start = k_uptime_get();
+	for (int i = 0; i < 5; i++) {
+		zassert_ok(k_thread_period_wait());
+	}
+	elapsed = k_uptime_get() - start;
+
+	zassert_true(elapsed >= 5 * 20 - 1, "released too early (%lld ms)", elapsed);
+	zassert_true(elapsed < 6 * 20, "released too late (%lld ms)", elapsed);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE
+	k_thread_runtime_stats_t stats;
+
+	zassert_ok(k_thread_runtime_stats_get(self, &stats));
+	zassert_equal(stats.budget_overruns, 0, "unexpected overrun");
+
+	/* Past the budget but within the deadline */
+	k_busy_wait(10 * USEC_PER_MSEC);
+	zassert_ok(k_thread_period_wait());
+
+	zassert_ok(k_thread_runtime_stats_get(self, &stats));
+	zassert_equal(stats.budget_overruns, 1, "overrun not counted");
+#endif /* CONFIG_SCHED_THREAD_USAGE */
+
+	/* Past the deadline */
+	k_busy_wait(30 * USEC_PER_MSEC);
+	zassert_equal(k_thread_period_wait(), -ETIMEDOUT, "deadline miss not reported");
+
+	zassert_ok(k_thread_period_set(self, 0, 0, 0));
+	zassert_equal(k_thread_period_wait(), -EINVAL, "thread is still periodic");
+}
+#endif /* CONFIG_SCHED_DEADLINE_PERIODIC */
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
@@ -852,6 +852,42 @@ ZTEST(smp, test_workq_on_smp)
 		"system workq run on the same core");
 }
 
+static bool in_sys_work_q;
+static K_SEM_DEFINE(sys_work_q_sem, 0, 1);
+
+static void sys_work_q_handler(struct k_work *work)
+{
+	in_sys_work_q = k_is_in_sys_work_q();
+	k_sem_give(&sys_work_q_sem);
+}
+
+/**
+ * @brief Test detecting the system workq threads
+ *
+ * @details Handlers run from the system workq, whichever CPU queue
+ * they were submitted to, shall be seen as running in it, and other
+ * threads shall not.
+ *
+ * @ingroup kernel_common_tests
+ */
+ZTEST(smp, test_workq_is_in_sys_work_q)
+{
+	static struct k_work work;
+
+	zassert_false(k_is_in_sys_work_q(), "test thread seen as system workq");
+
+	k_work_init(&work, sys_work_q_handler);
+
+	for (int i = 0; i < 2 * CONFIG_MP_MAX_NUM_CPUS; i++) {
+		in_sys_work_q = false;
+
+		/* The test thread may resume on another CPU, and submit to its queue */
+		k_work_submit(&work);
+		zassert_ok(k_sem_take(&sys_work_q_sem, K_MSEC(100)), "work not run");
+		zassert_true(in_sys_work_q, "handler not seen in system workq");
+	}
+}
+
 static void t1_mutex_lock(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p2);
@@ -228,6 +228,60 @@ ZTEST(spinlock, test_trylock)
 	zassert_true(trylock_successes > 0);
 }
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+static void bounce_stats_cb(const struct k_spinlock *l, const struct k_lock_stats *stats,
+			    void *user_data)
+{
+	if (l == &bounce_lock) {
+		*(struct k_lock_stats *)user_data = *stats;
+	}
+}
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+/**
+ * @brief Test spinlock statistics
+ *
+ * @details Bounce a spinlock between two CPUs and check that its
+ * contended acquisitions are counted and timed.
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_spin_lock_stats_foreach(), k_spin_lock_stats_reset()
+ */
+ZTEST(spinlock, test_spinlock_stats)
+{
+#ifdef CONFIG_SPIN_LOCK_STATS
+	struct k_lock_stats stats = {0};
+
+	k_spin_lock_stats_reset();
+
+	k_thread_create(&cpu1_thread, cpu1_stack, CPU1_STACK_SIZE,
+			cpu1_fn, NULL, NULL, NULL,
+			0, 0, K_NO_WAIT);
+
+	k_busy_wait(10);
+
+	for (int i = 0; i < 1000; i++) {
+		bounce_once(1234, false);
+	}
+
+	bounce_done = 1;
+
+	k_thread_join(&cpu1_thread, K_FOREVER);
+
+	k_spin_lock_stats_foreach(bounce_stats_cb, &stats);
+
+	zassert_true(stats.acquired >= 1000, "Acquisitions not counted");
+	zassert_true(stats.contended > 0, "Contention not counted");
+	zassert_true(stats.contended <= stats.acquired);
+	zassert_true(stats.spins >= stats.contended);
+	zassert_true(stats.total_wait >= stats.max_wait);
+	zassert_true(stats.max_hold > 0, "Hold time of contended acquisitions not measured");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SPIN_LOCK_STATS */
+}
+
 static void before(void *ctx)
 {
 	ARG_UNUSED(ctx);
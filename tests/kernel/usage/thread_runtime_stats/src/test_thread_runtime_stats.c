@@ -547,5 +547,90 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY
+static K_SEM_DEFINE(latency_sem, 0, 1);
+
+static void latency_helper(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		k_sem_take(&latency_sem, K_FOREVER);
+	}
+}
+
+static uint32_t latency_samples(k_tid_t tid)
+{
+	k_thread_runtime_stats_t  stats;
+	uint32_t  samples = 0;
+
+	zassert_ok(k_thread_runtime_stats_get(tid, &stats));
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_LATENCY_BUCKETS; i++) {
+		samples += stats.latency[i];
+	}
+
+	return samples;
+}
+
+/**
+ * @brief Test the scheduling latency histogram
+ *
+ * This routine wakes a higher priority thread a number of times and
+ * verifies that each wakeup is recorded in its latency histogram.
+ */
+ZTEST(usage_api, test_thread_stats_latency)
+{
+	k_tid_t  tid;
+	uint32_t  samples;
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      latency_helper, NULL, NULL, NULL,
+			      k_thread_priority_get(_current) - 1, 0, K_NO_WAIT);
+
+	samples = latency_samples(tid);
+	zassert_true(samples > 0, "thread start not recorded");
+
+	for (int i = 0; i < 10; i++) {
+		k_sem_give(&latency_sem);
+	}
+
+	zassert_equal(latency_samples(tid), samples + 10);
+
+	k_thread_abort(tid);
+}
+#endif /* CONFIG_SCHED_THREAD_LATENCY */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_WINDOWS
+/**
+ * @brief Test the sliding window utilization
+ *
+ * This routine busy waits for longer than the shortest window and verifies
+ * that both the thread and the CPU are reported as fully used over it. It
+ * then sleeps for longer than the shortest window and verifies that the
+ * utilization of the thread drops.
+ */
+ZTEST(usage_api, test_thread_stats_windows)
+{
+	k_thread_runtime_stats_t  stats;
+
+	k_busy_wait(CONFIG_SCHED_THREAD_USAGE_WINDOW_MS * 1500);
+
+	zassert_ok(k_thread_runtime_stats_get(_current, &stats));
+	zassert_true(stats.utilization[0] > 900, "thread utilization %u",
+		     stats.utilization[0]);
+
+	zassert_ok(k_thread_runtime_stats_cpu_get(0, &stats));
+	zassert_true(stats.utilization[0] > 900, "CPU utilization %u",
+		     stats.utilization[0]);
+
+	k_msleep(CONFIG_SCHED_THREAD_USAGE_WINDOW_MS * 5 / 2);
+
+	zassert_ok(k_thread_runtime_stats_get(_current, &stats));
+	zassert_true(stats.utilization[0] < 100, "thread utilization %u",
+		     stats.utilization[0]);
+	zassert_true(stats.utilization[2] > 0, "long window utilization not recorded");
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WINDOWS */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/arena.h>
+
+#define ARENA_SIZE 256
+
+/* Lives in the ztest partition so the user mode tests can reach it */
+SYS_ARENA_DEFINE_IN_PARTITION(arena, ARENA_SIZE, ztest_mem_partition);
+
+ZTEST_USER(arena, test_alloc_and_reset)
+{
+	uint8_t *a, *b;
+
+	a = sys_arena_alloc(&arena, 10);
+	zassert_not_null(a);
+	zassert_true(IS_ALIGNED(a, sizeof(void *)));
+	memset(a, 0xaa, 10);
+
+	b = sys_arena_alloc(&arena, 10);
+	zassert_not_null(b);
+	zassert_true(IS_ALIGNED(b, sizeof(void *)));
+	zassert_true(b >= a + 10);
+
+	sys_arena_reset(&arena);
+	zassert_equal(sys_arena_free_get(&arena), ARENA_SIZE);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 10), a);
+}
+
+ZTEST_USER(arena, test_aligned_alloc)
+{
+	void *p;
+
+	(void)sys_arena_aligned_alloc(&arena, 1, 1);
+	p = sys_arena_aligned_alloc(&arena, 64, 1);
+	zassert_not_null(p);
+	zassert_true(IS_ALIGNED(p, 64));
+}
+
+ZTEST_USER(arena, test_exhaustion)
+{
+	zassert_not_null(sys_arena_alloc(&arena, ARENA_SIZE));
+	zassert_equal(sys_arena_free_get(&arena), 0);
+	zassert_is_null(sys_arena_alloc(&arena, 1));
+
+	sys_arena_reset(&arena);
+	zassert_is_null(sys_arena_alloc(&arena, ARENA_SIZE + 1));
+	zassert_is_null(sys_arena_alloc(&arena, SIZE_MAX));
+	zassert_equal(sys_arena_free_get(&arena), ARENA_SIZE);
+}
+
+ZTEST_USER(arena, test_mark_release)
+{
+	size_t mark;
+	void *p;
+
+	zassert_not_null(sys_arena_alloc(&arena, 16));
+	mark = sys_arena_mark(&arena);
+
+	p = sys_arena_alloc(&arena, 32);
+	zassert_not_null(p);
+	zassert_not_null(sys_arena_alloc(&arena, 32));
+
+	sys_arena_release(&arena, mark);
+	zassert_equal(sys_arena_free_get(&arena), ARENA_SIZE - 16);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 32), p);
+}
+
+ZTEST(arena, test_runtime_init)
+{
+	static uint8_t __aligned(sizeof(void *)) buf[64];
+	struct sys_arena a;
+
+	sys_arena_init(&a, buf, sizeof(buf));
+	zassert_equal_ptr(sys_arena_alloc(&a, 8), buf);
+	zassert_equal(sys_arena_free_get(&a), sizeof(buf) - 8);
+}
+
+static void arena_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_arena_reset(&arena);
+}
+
+ZTEST_SUITE(arena, NULL, NULL, arena_before, NULL, NULL);
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/cpp/device.hpp>
+
+struct fake_calls {
+	const struct device *dev;
+	int count;
+	int arg;
+};
+
+static struct fake_calls calls;
+
+static void fake_call(const struct device *dev, int arg)
+{
+	calls.dev = dev;
+	calls.count++;
+	calls.arg = arg;
+}
+
+static int fake_i2s_configure(const struct device *dev, enum i2s_dir dir,
+			      const struct i2s_config *cfg)
+{
+	fake_call(dev, dir);
+	return 0;
+}
+
+static const struct i2s_config *fake_i2s_config_get(const struct device *dev, enum i2s_dir dir)
+{
+	fake_call(dev, dir);
+	return NULL;
+}
+
+static int fake_i2s_read(const struct device *dev, void **mem_block, size_t *size)
+{
+	fake_call(dev, 0);
+	*mem_block = NULL;
+	*size = 0;
+	return -EIO;
+}
+
+static int fake_i2s_write(const struct device *dev, void *mem_block, size_t size)
+{
+	fake_call(dev, size);
+	return 0;
+}
+
+static int fake_i2s_trigger(const struct device *dev, enum i2s_dir dir, enum i2s_trigger_cmd cmd)
+{
+	fake_call(dev, cmd);
+	return 0;
+}
+
+static DEVICE_API(i2s, fake_i2s_api) = {
+	.configure = fake_i2s_configure,
+	.config_get = fake_i2s_config_get,
+	.read = fake_i2s_read,
+	.write = fake_i2s_write,
+	.trigger = fake_i2s_trigger,
+};
+
+static int fake_dma_config(const struct device *dev, uint32_t channel, struct dma_config *config)
+{
+	fake_call(dev, channel);
+	return 0;
+}
+
+static int fake_dma_start(const struct device *dev, uint32_t channel)
+{
+	fake_call(dev, channel);
+	return 0;
+}
+
+static int fake_dma_stop(const struct device *dev, uint32_t channel)
+{
+	fake_call(dev, channel);
+	return 0;
+}
+
+static DEVICE_API(dma, fake_dma_api) = {
+	.config = fake_dma_config,
+	.start = fake_dma_start,
+	.stop = fake_dma_stop,
+};
+
+static int fake_sensor_sample_fetch(const struct device *dev, enum sensor_channel chan)
+{
+	fake_call(dev, chan);
+	return 0;
+}
+
+static int fake_sensor_channel_get(const struct device *dev, enum sensor_channel chan,
+				   struct sensor_value *val)
+{
+	fake_call(dev, chan);
+	val->val1 = 21;
+	val->val2 = 500000;
+	return 0;
+}
+
+static DEVICE_API(sensor, fake_sensor_api) = {
+	.sample_fetch = fake_sensor_sample_fetch,
+	.channel_get = fake_sensor_channel_get,
+};
+
+DEVICE_DEFINE(bound_i2s, "bound_i2s", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_i2s_api);
+DEVICE_DEFINE(runtime_i2s, "runtime_i2s", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_i2s_api);
+DEVICE_DEFINE(bound_dma, "bound_dma", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_dma_api);
+DEVICE_DEFINE(runtime_dma, "runtime_dma", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_dma_api);
+DEVICE_DEFINE(bound_sensor, "bound_sensor", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_sensor_api);
+DEVICE_DEFINE(runtime_sensor, "runtime_sensor", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_sensor_api);
+
+DEVICE_API_BIND(i2s, DEVICE_GET(bound_i2s), fake_i2s_api);
+DEVICE_API_BIND(dma, DEVICE_GET(bound_dma), fake_dma_api);
+DEVICE_API_BIND(sensor, DEVICE_GET(bound_sensor), fake_sensor_api);
+
+static_assert(zephyr::device_api<struct i2s_driver_api, DEVICE_GET(bound_i2s)>::bound);
+static_assert(zephyr::device_api<struct i2s_driver_api, DEVICE_GET(bound_i2s)>::get() ==
+	      &fake_i2s_api);
+static_assert(!zephyr::device_api<struct i2s_driver_api, DEVICE_GET(runtime_i2s)>::bound);
+static_assert(zephyr::i2s<DEVICE_GET(bound_i2s)>::get() == DEVICE_GET(bound_i2s));
+
+template <typename I2s> static void check_i2s()
+{
+	void *mem_block;
+	size_t size;
+
+	calls = {};
+	zassert_true(I2s::is_ready());
+	zassert_ok(I2s::configure(I2S_DIR_TX, NULL));
+	zassert_equal(calls.arg, I2S_DIR_TX);
+	zassert_is_null(I2s::config_get(I2S_DIR_RX));
+	zassert_equal(calls.arg, I2S_DIR_RX);
+	zassert_ok(I2s::write(NULL, 64));
+	zassert_equal(calls.arg, 64);
+	zassert_equal(I2s::read(&mem_block, &size), -EIO);
+	zassert_ok(I2s::trigger(I2S_DIR_TX, I2S_TRIGGER_START));
+	zassert_equal(calls.arg, I2S_TRIGGER_START);
+
+	zassert_equal(calls.count, 5);
+	zassert_equal_ptr(calls.dev, I2s::get());
+}
+
+ZTEST(cpp_device, test_i2s)
+{
+	check_i2s<zephyr::i2s<DEVICE_GET(bound_i2s)>>();
+	check_i2s<zephyr::i2s<DEVICE_GET(runtime_i2s)>>();
+}
+
+template <typename Dma> static void check_dma()
+{
+	struct dma_status stat;
+	uint32_t value;
+
+	calls = {};
+	zassert_ok(Dma::config(1, NULL));
+	zassert_ok(Dma::start(2));
+	zassert_equal(calls.arg, 2);
+	zassert_ok(Dma::stop(3));
+	zassert_equal(calls.arg, 3);
+	zassert_equal(calls.count, 3);
+	zassert_equal_ptr(calls.dev, Dma::get());
+
+	/* Optional functions the driver does not implement */
+	zassert_equal(Dma::reload(1, 0, 0, 0), -ENOSYS);
+	zassert_equal(Dma::suspend(1), -ENOSYS);
+	zassert_equal(Dma::resume(1), -ENOSYS);
+	zassert_equal(Dma::get_status(1, &stat), -ENOSYS);
+	zassert_equal(Dma::get_attribute(DMA_ATTR_BUFFER_SIZE_ALIGNMENT, &value), -ENOSYS);
+	zassert_equal(calls.count, 3);
+}
+
+ZTEST(cpp_device, test_dma)
+{
+	check_dma<zephyr::dma<DEVICE_GET(bound_dma)>>();
+	check_dma<zephyr::dma<DEVICE_GET(runtime_dma)>>();
+}
+
+template <typename Sensor> static void check_sensor()
+{
+	struct sensor_value val;
+
+	calls = {};
+	zassert_ok(Sensor::sample_fetch());
+	zassert_equal(calls.arg, SENSOR_CHAN_ALL);
+	zassert_ok(Sensor::sample_fetch(SENSOR_CHAN_AMBIENT_TEMP));
+	zassert_equal(calls.arg, SENSOR_CHAN_AMBIENT_TEMP);
+	zassert_ok(Sensor::channel_get(SENSOR_CHAN_AMBIENT_TEMP, &val));
+	zassert_equal(val.val1, 21);
+	zassert_equal(val.val2, 500000);
+	zassert_equal(calls.count, 3);
+	zassert_equal_ptr(calls.dev, Sensor::get());
+
+	zassert_equal(Sensor::attr_set(SENSOR_CHAN_ALL, SENSOR_ATTR_SAMPLING_FREQUENCY, &val),
+		      -ENOSYS);
+	zassert_equal(Sensor::attr_get(SENSOR_CHAN_ALL, SENSOR_ATTR_SAMPLING_FREQUENCY, &val),
+		      -ENOSYS);
+	zassert_equal(Sensor::trigger_set(NULL, NULL), -ENOSYS);
+}
+
+ZTEST(cpp_device, test_sensor)
+{
+	check_sensor<zephyr::sensor<DEVICE_GET(bound_sensor)>>();
+	check_sensor<zephyr::sensor<DEVICE_GET(runtime_sensor)>>();
+}
+
+ZTEST_SUITE(cpp_device, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory_resource>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cpp/memory_resource.hpp>
+
+#ifndef CONFIG_MINIMAL_LIBCPP
+#include <vector>
+#endif
+
+K_HEAP_DEFINE(test_heap, 2048);
+K_MEM_SLAB_DEFINE(test_slab, 32, 4, 8);
+SYS_MEM_BLOCKS_DEFINE(test_blocks, 16, 8, 16);
+
+/* Check an allocation failure, reported as the configuration does */
+#ifdef CONFIG_CPP_EXCEPTIONS
+#define zassert_alloc_fails(expr)                                                                  \
+	do {                                                                                       \
+		bool thrown = false;                                                               \
+		try {                                                                              \
+			(void)(expr);                                                              \
+		} catch (const std::bad_alloc &) {                                                 \
+			thrown = true;                                                             \
+		}                                                                                  \
+		zassert_true(thrown, "allocation did not fail");                                   \
+	} while (false)
+#else
+#define zassert_alloc_fails(expr) zassert_is_null(expr, "allocation did not fail")
+#endif
+
+ZTEST(cpp_memory_resource, test_heap)
+{
+	zephyr::pmr::heap_resource res(test_heap);
+	void *p = res.allocate(100, 64);
+
+	zassert_not_null(p);
+	zassert_equal((uintptr_t)p % 64, 0, "misaligned allocation");
+	zassert_alloc_fails(res.allocate(4096));
+	res.deallocate(p, 100, 64);
+
+	zassert_true(res == res);
+	zassert_false(res == zephyr::pmr::heap_resource(test_heap));
+}
+
+ZTEST(cpp_memory_resource, test_slab)
+{
+	zephyr::pmr::slab_resource res(test_slab);
+	void *p[4];
+
+	zassert_alloc_fails(res.allocate(33));
+	zassert_alloc_fails(res.allocate(8, 64));
+
+	for (auto &b : p) {
+		b = res.allocate(32, 8);
+		zassert_not_null(b);
+	}
+	zassert_alloc_fails(res.allocate(1));
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 4);
+
+	for (auto b : p) {
+		res.deallocate(b, 32, 8);
+	}
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+}
+
+ZTEST(cpp_memory_resource, test_mem_blocks)
+{
+	zephyr::pmr::mem_blocks_resource res(test_blocks);
+	void *a = res.allocate(40, 16);
+	void *b = res.allocate(0, 1);
+
+	/* 3 + 1 of the 8 blocks of 16 bytes */
+	zassert_not_null(a);
+	zassert_not_null(b);
+	zassert_alloc_fails(res.allocate(65));
+	zassert_alloc_fails(res.allocate(8, 32));
+
+	res.deallocate(a, 40, 16);
+	res.deallocate(b, 0, 1);
+	a = res.allocate(128);
+	zassert_not_null(a, "blocks not freed");
+	res.deallocate(a, 128);
+}
+
+ZTEST(cpp_memory_resource, test_monotonic)
+{
+	alignas(8) static uint8_t buffer[64];
+	zephyr::pmr::heap_resource upstream(test_heap);
+	zephyr::pmr::monotonic_resource res(buffer, sizeof(buffer), &upstream);
+	uint8_t *a = static_cast<uint8_t *>(res.allocate(10, 1));
+	uint8_t *b = static_cast<uint8_t *>(res.allocate(16, 8));
+
+	zassert_equal(a, buffer);
+	zassert_equal(b, buffer + 16, "allocations not contiguous");
+
+	/* Overflow into the upstream heap, twice */
+	for (int i = 0; i < 2; i++) {
+		uint8_t *c = static_cast<uint8_t *>(res.allocate(200, 16));
+
+		zassert_not_null(c);
+		zassert_true((c < buffer) || (c >= buffer + sizeof(buffer)));
+		memset(c, 0xaa, 200);
+	}
+	res.deallocate(a, 10, 1);
+
+	res.release();
+	zassert_equal(res.allocate(10, 1), buffer, "buffer not reused");
+
+	/* Without upstream, the buffer is all there is */
+	zephyr::pmr::monotonic_resource bounded(buffer, sizeof(buffer));
+
+	zassert_not_null(bounded.allocate(64, 1));
+	zassert_alloc_fails(bounded.allocate(1, 1));
+}
+
+ZTEST(cpp_memory_resource, test_polymorphic_allocator)
+{
+	zephyr::pmr::slab_resource res(test_slab);
+	std::pmr::polymorphic_allocator<uint32_t> alloc(&res);
+	uint32_t *p = alloc.allocate(8);
+
+	zassert_not_null(p);
+	zassert_equal(alloc.resource(), &res);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 1);
+	alloc.deallocate(p, 8);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+
+	zassert_not_null(std::pmr::get_default_resource());
+	zassert_equal(std::pmr::set_default_resource(&res), std::pmr::new_delete_resource());
+	zassert_equal(std::pmr::get_default_resource(), &res);
+	std::pmr::set_default_resource(nullptr);
+	zassert_equal(std::pmr::get_default_resource(), std::pmr::new_delete_resource());
+}
+
+#ifndef CONFIG_MINIMAL_LIBCPP
+ZTEST(cpp_memory_resource, test_vector)
+{
+	zephyr::pmr::heap_resource res(test_heap);
+	std::pmr::vector<int> v(&res);
+
+	for (int i = 0; i < 64; i++) {
+		v.push_back(i);
+	}
+	zassert_equal(v.size(), 64);
+	zassert_equal(v[63], 63);
+}
+#endif
+
+ZTEST_SUITE(cpp_memory_resource, NULL, NULL, NULL, NULL, NULL);
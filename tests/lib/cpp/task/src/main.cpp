@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/cpp/task.hpp>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/zvfs/eventfd.h>
+
+K_SEM_DEFINE(test_sem, 0, 16);
+K_MSGQ_DEFINE(test_msgq, sizeof(uint32_t), 4, 4);
+RTIO_DEFINE(test_rtio, 4, 4);
+
+static struct k_poll_signal test_signal;
+
+static zephyr::task<int> add(int a, int b)
+{
+	co_return a + b;
+}
+
+static zephyr::task<int> sum(int n)
+{
+	int s = 0;
+
+	for (int i = 0; i < n; i++) {
+		s = co_await add(s, i);
+	}
+
+	co_return s;
+}
+
+static zephyr::task<> store_sum(int n, int *out)
+{
+	*out = co_await sum(n);
+}
+
+ZTEST(cpp_task, test_await_chain)
+{
+	zephyr::executor ex;
+	int result = 0;
+
+	ex.spawn(store_sum(10, &result));
+	zassert_equal(ex.size(), 1);
+	ex.run();
+
+	zassert_equal(result, 45);
+	zassert_equal(ex.size(), 0);
+}
+
+static void give_sem(struct k_timer *timer)
+{
+	k_sem_give(&test_sem);
+}
+
+static zephyr::task<> take_sem(int *results)
+{
+	results[0] = co_await zephyr::sem_take(test_sem);
+	results[1] = co_await zephyr::sem_take(test_sem, K_NO_WAIT);
+	results[2] = co_await zephyr::sem_take(test_sem, K_MSEC(5));
+}
+
+ZTEST(cpp_task, test_sem)
+{
+	zephyr::executor ex;
+	struct k_timer timer;
+	int results[3] = {1, 1, 1};
+
+	k_sem_reset(&test_sem);
+	k_timer_init(&timer, give_sem, NULL);
+	k_timer_start(&timer, K_MSEC(10), K_NO_WAIT);
+
+	ex.spawn(take_sem(results));
+	ex.run();
+
+	zassert_equal(results[0], 0, "semaphore not taken");
+	zassert_equal(results[1], -EBUSY);
+	zassert_equal(results[2], -EAGAIN);
+}
+
+static zephyr::task<> count_sem(int *count)
+{
+	int ret = co_await zephyr::sem_take(test_sem);
+
+	if (ret == 0) {
+		(*count)++;
+	}
+}
+
+static zephyr::task<> give_sems(int n)
+{
+	for (int i = 0; i < n; i++) {
+		co_await zephyr::sleep(K_MSEC(1));
+		k_sem_give(&test_sem);
+	}
+}
+
+ZTEST(cpp_task, test_many_tasks)
+{
+	zephyr::executor ex;
+	int count = 0;
+
+	k_sem_reset(&test_sem);
+	for (int i = 0; i < 8; i++) {
+		ex.spawn(count_sem(&count));
+	}
+	ex.spawn(give_sems(8));
+	ex.run();
+
+	zassert_equal(count, 8);
+}
+
+static zephyr::task<> get_msgs(uint32_t *msgs, int n)
+{
+	for (int i = 0; i < n; i++) {
+		int ret = co_await zephyr::msgq_get(test_msgq, &msgs[i]);
+
+		zassert_ok(ret);
+	}
+}
+
+static zephyr::task<> put_msgs(uint32_t n)
+{
+	for (uint32_t i = 0; i < n; i++) {
+		co_await zephyr::yield();
+		zassert_ok(k_msgq_put(&test_msgq, &i, K_NO_WAIT));
+	}
+}
+
+ZTEST(cpp_task, test_msgq)
+{
+	zephyr::executor ex;
+	uint32_t msgs[3] = {};
+
+	k_msgq_purge(&test_msgq);
+	ex.spawn(get_msgs(msgs, ARRAY_SIZE(msgs)));
+	ex.spawn(put_msgs(ARRAY_SIZE(msgs)));
+	ex.run();
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(msgs[i], i);
+	}
+}
+
+static void raise_signal(struct k_timer *timer)
+{
+	k_poll_signal_raise(&test_signal, 42);
+}
+
+static zephyr::task<> wait_signal(int *ret, int *result)
+{
+	*ret = co_await zephyr::signal_wait(test_signal, result);
+}
+
+ZTEST(cpp_task, test_signal)
+{
+	zephyr::executor ex;
+	struct k_timer timer;
+	int ret = 1;
+	int result = 0;
+
+	k_poll_signal_init(&test_signal);
+	k_timer_init(&timer, raise_signal, NULL);
+	k_timer_start(&timer, K_MSEC(5), K_NO_WAIT);
+
+	ex.spawn(wait_signal(&ret, &result));
+	ex.run();
+
+	zassert_equal(ret, 0);
+	zassert_equal(result, 42);
+}
+
+static zephyr::task<> sleep_and_log(int id, int ms, int *log, int *pos)
+{
+	int ret = co_await zephyr::sleep(K_MSEC(ms));
+
+	zassert_ok(ret);
+	log[(*pos)++] = id;
+}
+
+ZTEST(cpp_task, test_sleep)
+{
+	zephyr::executor ex;
+	int log[3];
+	int pos = 0;
+
+	ex.spawn(sleep_and_log(0, 30, log, &pos));
+	ex.spawn(sleep_and_log(1, 10, log, &pos));
+	ex.spawn(sleep_and_log(2, 20, log, &pos));
+	ex.run();
+
+	zassert_equal(pos, 3);
+	zassert_equal(log[0], 1);
+	zassert_equal(log[1], 2);
+	zassert_equal(log[2], 0);
+}
+
+static zephyr::task<> get_cqe(void **userdata)
+{
+	struct rtio_cqe *cqe = co_await zephyr::rtio_cqe_get(test_rtio, K_MSEC(100));
+
+	zassert_not_null(cqe);
+	*userdata = cqe->userdata;
+	rtio_cqe_release(&test_rtio, cqe);
+}
+
+static zephyr::task<> submit_nop(void *userdata)
+{
+	struct rtio_sqe *sqe;
+
+	co_await zephyr::sleep(K_MSEC(5));
+
+	sqe = rtio_sqe_acquire(&test_rtio);
+	zassert_not_null(sqe);
+	rtio_sqe_prep_nop(sqe, NULL, userdata);
+	zassert_ok(rtio_submit(&test_rtio, 0));
+}
+
+ZTEST(cpp_task, test_rtio)
+{
+	zephyr::executor ex;
+	static int cookie;
+	void *userdata = NULL;
+
+	ex.spawn(get_cqe(&userdata));
+	ex.spawn(submit_nop(&cookie));
+	ex.run();
+
+	zassert_equal_ptr(userdata, &cookie);
+}
+
+static zephyr::task<> wait_fd(int fd, int *revents)
+{
+	*revents = co_await zephyr::fd_poll(fd, ZVFS_POLLIN);
+}
+
+static zephyr::task<> write_fd(int fd)
+{
+	co_await zephyr::sleep(K_MSEC(5));
+	zassert_ok(zvfs_eventfd_write(fd, 1));
+}
+
+ZTEST(cpp_task, test_fd)
+{
+	zephyr::executor ex;
+	int fd = zvfs_eventfd(0, 0);
+	int revents = 0;
+
+	zassert_true(fd >= 0);
+
+	ex.spawn(wait_fd(fd, &revents));
+	ex.spawn(write_fd(fd));
+	ex.run();
+
+	zassert_equal(revents, ZVFS_POLLIN);
+}
+
+#ifdef CONFIG_CPP_EXCEPTIONS
+static zephyr::task<int> fail()
+{
+	throw 7;
+	co_return 0;
+}
+
+static zephyr::task<> catch_failure(int *caught)
+{
+	try {
+		co_await fail();
+	} catch (int e) {
+		*caught = e;
+	}
+}
+
+ZTEST(cpp_task, test_exception)
+{
+	zephyr::executor ex;
+	int caught = 0;
+
+	ex.spawn(catch_failure(&caught));
+	ex.run();
+
+	zassert_equal(caught, 7);
+}
+#endif
+
+ZTEST_SUITE(cpp_task, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dma_memcpy.h>
+#include <zephyr/ztest.h>
+
+#define BUF_SIZE 4096
+
+static uint8_t src[BUF_SIZE] __aligned(64);
+static uint8_t dst[BUF_SIZE] __aligned(64);
+static const uint8_t rodata_src[CONFIG_SYS_DMA_MEMCPY_THRESHOLD] = { [0] = 0xa5, [1] = 0x5a };
+
+struct async_result {
+	struct k_sem sem;
+	int status;
+};
+
+static void async_done(void *user_data, int status)
+{
+	struct async_result *res = user_data;
+
+	res->status = status;
+	k_sem_give(&res->sem);
+}
+
+static void buffers_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 7U + 3U);
+	}
+
+	memset(dst, 0, sizeof(dst));
+}
+
+ZTEST(dma_memcpy, test_copy)
+{
+	sys_dma_memcpy(dst, src, BUF_SIZE, K_MSEC(100));
+	zassert_mem_equal(dst, src, BUF_SIZE);
+}
+
+ZTEST(dma_memcpy, test_copy_below_threshold)
+{
+	sys_dma_memcpy(dst, src, CONFIG_SYS_DMA_MEMCPY_THRESHOLD - 1, K_MSEC(100));
+	zassert_mem_equal(dst, src, CONFIG_SYS_DMA_MEMCPY_THRESHOLD - 1);
+	zassert_equal(dst[CONFIG_SYS_DMA_MEMCPY_THRESHOLD - 1], 0, "Copied past the end");
+}
+
+/* The transfer does not complete without waiting, so it is stopped and the CPU copies */
+ZTEST(dma_memcpy, test_copy_timeout)
+{
+	sys_dma_memcpy(dst, src, BUF_SIZE, K_NO_WAIT);
+	zassert_mem_equal(dst, src, BUF_SIZE);
+
+	/* The cancelled transfer released its channel */
+	memset(dst, 0, sizeof(dst));
+	sys_dma_memcpy(dst, src, BUF_SIZE, K_MSEC(100));
+	zassert_mem_equal(dst, src, BUF_SIZE);
+}
+
+ZTEST(dma_memcpy, test_copy_rodata)
+{
+	sys_dma_memcpy(dst, rodata_src, sizeof(rodata_src), K_MSEC(100));
+	zassert_mem_equal(dst, rodata_src, sizeof(rodata_src));
+}
+
+ZTEST(dma_memcpy, test_copy_async)
+{
+	struct sys_dma_memcpy_req req;
+	struct async_result res;
+
+	k_sem_init(&res.sem, 0, 1);
+	res.status = -EINPROGRESS;
+
+	sys_dma_memcpy_async(&req, dst, src, BUF_SIZE, async_done, &res);
+	zassert_ok(k_sem_take(&res.sem, K_MSEC(100)));
+	zassert_ok(res.status);
+	zassert_mem_equal(dst, src, BUF_SIZE);
+}
+
+/* Copies from an ISR are done by the CPU */
+static void copy_timer_handler(struct k_timer *timer)
+{
+	sys_dma_memcpy(dst, src, BUF_SIZE, K_MSEC(100));
+	k_sem_give(k_timer_user_data_get(timer));
+}
+
+ZTEST(dma_memcpy, test_copy_from_isr)
+{
+	struct k_timer timer;
+	struct k_sem sem;
+
+	k_sem_init(&sem, 0, 1);
+	k_timer_init(&timer, copy_timer_handler, NULL);
+	k_timer_user_data_set(&timer, &sem);
+	k_timer_start(&timer, K_MSEC(1), K_NO_WAIT);
+
+	zassert_ok(k_sem_take(&sem, K_MSEC(100)));
+	zassert_mem_equal(dst, src, BUF_SIZE);
+}
+
+ZTEST_SUITE(dma_memcpy, NULL, NULL, buffers_before, NULL, NULL);
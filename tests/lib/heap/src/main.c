@@ -485,4 +485,57 @@ ZTEST(lib_heap, test_heap_listeners)
 #endif /* CONFIG_SYS_HEAP_LISTENER */
 }
 
+ZTEST(lib_heap, test_frag_stats)
+{
+#ifdef CONFIG_SYS_HEAP_FRAG_STATS
+	static uint8_t __aligned(8) mem[2048];
+	struct sys_heap_frag_stats stats;
+	struct sys_heap heap;
+	void *blocks[8];
+	uint32_t calls = 0;
+
+	sys_heap_init(&heap, mem, sizeof(mem));
+
+	zassert_ok(sys_heap_frag_stats_get(&heap, &stats));
+	zassert_equal(stats.free_chunks, 1);
+	for (int i = 0; i < SYS_HEAP_LATENCY_BINS; i++) {
+		zassert_equal(stats.alloc_latency[i], 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = sys_heap_alloc(&heap, 64);
+		zassert_not_null(blocks[i]);
+	}
+
+	/* Freeing every other block leaves isolated holes */
+	for (int i = 0; i < ARRAY_SIZE(blocks); i += 2) {
+		sys_heap_free(&heap, blocks[i]);
+	}
+
+	zassert_ok(sys_heap_frag_stats_get(&heap, &stats));
+	zassert_equal(stats.free_chunks, ARRAY_SIZE(blocks) / 2 + 1);
+	zassert_true(stats.largest_free_bytes < sizeof(mem) - ARRAY_SIZE(blocks) * 64);
+	for (int i = 0; i < SYS_HEAP_LATENCY_BINS; i++) {
+		calls += stats.alloc_latency[i];
+	}
+	zassert_equal(calls, ARRAY_SIZE(blocks));
+
+	zassert_not_null(sys_heap_aligned_alloc(&heap, 32, 16));
+	zassert_ok(sys_heap_frag_stats_get(&heap, &stats));
+	calls = 0;
+	for (int i = 0; i < SYS_HEAP_LATENCY_BINS; i++) {
+		calls += stats.alloc_latency[i];
+	}
+	zassert_equal(calls, ARRAY_SIZE(blocks) + 1);
+
+	zassert_ok(sys_heap_frag_stats_reset(&heap));
+	zassert_ok(sys_heap_frag_stats_get(&heap, &stats));
+	for (int i = 0; i < SYS_HEAP_LATENCY_BINS; i++) {
+		zassert_equal(stats.alloc_latency[i], 0);
+	}
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_HEAP_FRAG_STATS */
+}
+
 ZTEST_SUITE(lib_heap, NULL, NULL, NULL, NULL, NULL);
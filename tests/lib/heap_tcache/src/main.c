@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/heap_listener.h>
+
+#define HEAP_SZ 0x1000
+
+static uint8_t __aligned(8) heapmem[HEAP_SZ];
+static struct sys_heap heap;
+
+static size_t listener_allocated;
+
+static void check_stats(void)
+{
+	struct sys_memory_stats stats;
+
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+	zassert_ok(sys_heap_runtime_stats_get(&heap, &stats));
+	zassert_equal(stats.allocated_bytes, listener_allocated,
+		      "listener and statistics disagree");
+}
+
+static void on_alloc(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	if (heap_id == HEAP_ID_FROM_POINTER(&heap)) {
+		listener_allocated += bytes;
+	}
+}
+
+static void on_free(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	if (heap_id == HEAP_ID_FROM_POINTER(&heap)) {
+		listener_allocated -= bytes;
+	}
+}
+
+HEAP_LISTENER_ALLOC_DEFINE(alloc_listener, HEAP_ID_FROM_POINTER(&heap), on_alloc);
+HEAP_LISTENER_FREE_DEFINE(free_listener, HEAP_ID_FROM_POINTER(&heap), on_free);
+
+static void *tcache_setup(void)
+{
+	heap_listener_register(&alloc_listener);
+	heap_listener_register(&free_listener);
+
+	return NULL;
+}
+
+static void tcache_before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sys_heap_init(&heap, heapmem, sizeof(heapmem));
+	listener_allocated = 0;
+}
+
+ZTEST_SUITE(lib_heap_tcache, NULL, tcache_setup, tcache_before, NULL, NULL);
+
+/* A freed small block is handed out again for the same size */
+ZTEST(lib_heap_tcache, test_reuse)
+{
+	void *p[3];
+	void *q;
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		p[i] = sys_heap_alloc(&heap, 64);
+		zassert_not_null(p[i]);
+	}
+	check_stats();
+
+	sys_heap_free(&heap, p[1]);
+	check_stats();
+
+	/* a different size class does not take the cached block */
+	q = sys_heap_alloc(&heap, 128);
+	zassert_not_null(q);
+	zassert_not_equal(q, p[1]);
+	sys_heap_free(&heap, q);
+
+	q = sys_heap_alloc(&heap, 64);
+	zassert_equal(q, p[1], "cached block was not reused");
+	check_stats();
+
+	sys_heap_free(&heap, q);
+	sys_heap_free(&heap, p[0]);
+	sys_heap_free(&heap, p[2]);
+	check_stats();
+	zassert_equal(listener_allocated, 0);
+}
+
+/* Large blocks and blocks beyond the cache depth go back to the heap */
+ZTEST(lib_heap_tcache, test_bypass)
+{
+	void *big;
+	void *p[CONFIG_SYS_HEAP_TCACHE_DEPTH + 2];
+
+	big = sys_heap_alloc(&heap, CONFIG_SYS_HEAP_TCACHE_MAX_BYTES * 2);
+	zassert_not_null(big);
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		p[i] = sys_heap_alloc(&heap, 32);
+		zassert_not_null(p[i]);
+	}
+
+	sys_heap_free(&heap, big);
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		sys_heap_free(&heap, p[i]);
+		check_stats();
+	}
+	zassert_equal(listener_allocated, 0);
+}
+
+/* Cached blocks are given back when the heap would otherwise be exhausted */
+ZTEST(lib_heap_tcache, test_flush_on_exhaustion)
+{
+	struct sys_memory_stats stats;
+	void *p[64];
+	void *big;
+	int n;
+
+	for (n = 0; n < ARRAY_SIZE(p); n++) {
+		p[n] = sys_heap_alloc(&heap, 48);
+		if (p[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 2 * CONFIG_SYS_HEAP_TCACHE_DEPTH, "heap too small for test");
+
+	for (int i = 0; i < n; i++) {
+		sys_heap_free(&heap, p[i]);
+	}
+	check_stats();
+
+	/* only a fully merged heap can satisfy this */
+	zassert_ok(sys_heap_runtime_stats_get(&heap, &stats));
+	big = sys_heap_alloc(&heap, stats.free_bytes - 8);
+	zassert_not_null(big, "cached blocks were not flushed");
+	check_stats();
+
+	sys_heap_free(&heap, big);
+	check_stats();
+	zassert_equal(listener_allocated, 0);
+}
@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <stdarg.h>
 #include <string.h>
 #include <float.h>
 #include <math.h>
@@ -10,6 +11,8 @@
 #include <stdbool.h>
 #include <zephyr/ztest.h>
 #include <zephyr/data/json.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/printk.h>
 
 struct test_nested {
 	int nested_int;
@@ -2178,4 +2181,260 @@ ZTEST(lib_json_test, test_json_enums)
 		     "Enums not decoded correctly");
 }
 
+struct sax_log {
+	char text[128];
+	size_t len;
+};
+
+static void sax_log_append(struct sax_log *log, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	log->len += vsnprintk(&log->text[log->len], sizeof(log->text) - log->len, fmt, ap);
+	va_end(ap);
+}
+
+static int sax_log_key(void *user_data, char *key, size_t len)
+{
+	sax_log_append(user_data, "%.*s:", (int)len, key);
+
+	return 0;
+}
+
+static int sax_log_value(void *user_data, enum json_tokens type, char *data, size_t len)
+{
+	if (data == NULL) {
+		sax_log_append(user_data, "%c", type);
+	} else {
+		sax_log_append(user_data, "%c%.*s,", type, (int)len, data);
+	}
+
+	return 0;
+}
+
+static const struct json_sax_callbacks sax_log_callbacks = {
+	.key = sax_log_key,
+	.value = sax_log_value,
+};
+
+static int sax_harness(const char *doc, size_t chunk, struct sax_log *log)
+{
+	struct json_sax sax;
+	char buf[16];
+	size_t len = strlen(doc);
+	int ret = 0;
+
+	memset(log, 0, sizeof(*log));
+	json_sax_init(&sax, &sax_log_callbacks, log, buf, sizeof(buf));
+
+	for (size_t i = 0; i < len && ret == 0; i += chunk) {
+		ret = json_sax_feed(&sax, &doc[i], MIN(chunk, len - i));
+	}
+
+	return json_sax_finish(&sax);
+}
+
+ZTEST(lib_json_test, test_json_sax)
+{
+	const char *doc = "{\"a\":[1, -2.5e3,true,false,null],\n"
+			  "\"b\":{\"c\":\"x\\\"y\\u00e9\"},\t\"d\":[]}";
+	const char *expected = "{a:[01,0-2.5e3,ttrue,ffalse,nnull,]b:{c:\"x\\\"y\\u00e9,}d:[]}";
+	struct sax_log log;
+
+	/* Every split of the document gives the same events */
+	for (size_t chunk = 1; chunk <= strlen(doc); chunk++) {
+		zassert_ok(sax_harness(doc, chunk, &log), "chunk %zu", chunk);
+		zassert_str_equal(log.text, expected, "chunk %zu", chunk);
+	}
+
+	/* A number may be the whole document */
+	zassert_ok(sax_harness(" -42", 3, &log));
+	zassert_str_equal(log.text, "0-42,");
+}
+
+ZTEST(lib_json_test, test_json_sax_invalid)
+{
+	struct encoding_test encoded[] = {
+		{ "{\"a\" 1}", -EINVAL },
+		{ "{\"a\":1,}", -EINVAL },
+		{ "{1:1}", -EINVAL },
+		{ "[1,]", -EINVAL },
+		{ "[1 2]", -EINVAL },
+		{ "[1}", -EINVAL },
+		{ "{}}", -EINVAL },
+		{ "{} {}", -EINVAL },
+		{ "[\"abc", -EINVAL },
+		{ "[\"\\x\"]", -EINVAL },
+		{ "[\"\\u12G4\"]", -EINVAL },
+		{ "[tru]", -EINVAL },
+		{ "[nul", -EINVAL },
+		{ "", -EINVAL },
+		{ "{\"longer_than_the_buffer\":1}", -ENOSPC },
+		{ "[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[", -ENOMEM },
+	};
+	struct sax_log log;
+
+	for (size_t i = 0; i < ARRAY_SIZE(encoded); i++) {
+		zassert_equal(sax_harness(encoded[i].str, 1, &log), encoded[i].result,
+			      "%s", encoded[i].str);
+	}
+}
+
+struct stream_elt {
+	int32_t id;
+	char name[8];
+};
+
+struct stream_struct {
+	char some_string_buf[10];
+	int some_int;
+	bool some_bool;
+	int64_t some_int64;
+	uint8_t some_uint8;
+	struct stream_elt some_nested;
+	int some_array[4];
+	size_t some_array_len;
+	struct stream_elt elts[3];
+	size_t elts_len;
+	bool another_bool;
+	int another_int;
+};
+
+static const struct json_obj_descr stream_elt_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct stream_elt, id, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct stream_elt, name, JSON_TOK_STRING_BUF),
+};
+
+static const struct json_obj_descr stream_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, some_string_buf, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, some_int, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, some_bool, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, some_int64, JSON_TOK_INT64),
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, some_uint8, JSON_TOK_UINT),
+	JSON_OBJ_DESCR_OBJECT(struct stream_struct, some_nested, stream_elt_descr),
+	JSON_OBJ_DESCR_ARRAY(struct stream_struct, some_array, 4, some_array_len,
+			     JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct stream_struct, elts, 3, elts_len, stream_elt_descr,
+				 ARRAY_SIZE(stream_elt_descr)),
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, another_bool, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct stream_struct, another_int, JSON_TOK_NUMBER),
+};
+
+static int64_t stream_harness(const char *doc, size_t chunk, const struct json_obj_descr *descr,
+			      size_t descr_len, void *val)
+{
+	struct json_obj_stream stream;
+	char buf[24];
+	size_t len = strlen(doc);
+	int ret = 0;
+
+	json_obj_stream_init(&stream, descr, descr_len, val, buf, sizeof(buf));
+
+	for (size_t i = 0; i < len && ret == 0; i += chunk) {
+		ret = json_obj_stream_feed(&stream, &doc[i], MIN(chunk, len - i));
+	}
+
+	return json_obj_stream_finish(&stream);
+}
+
+ZTEST(lib_json_test, test_json_obj_stream)
+{
+	const char *doc = "{\"another_int\":-7,\"some_string_buf\":\"z\\u00e9\","
+			  "\"extra\":{\"a\":[1,{\"b\":null}],\"c\":\"}]\"},"
+			  "\"some_int\":42,\"some_bool\":true,"
+			  "\"some_int64\":-4611686018427387904,\"some_uint8\":255,"
+			  "\"some_nested\":{\"name\":\"nested\",\"id\":1},"
+			  "\"some_array\":[11,22,33],"
+			  "\"elts\":[{\"id\":2,\"name\":\"two\"},{\"id\":3}],"
+			  "\"extra_array\":[[],[[]]],\"another_bool\":false}";
+	char copy[512];
+	struct stream_struct expected;
+	struct stream_struct ts;
+	int64_t expected_ret;
+
+	/* The reference is the parser of whole documents */
+	memset(&expected, 0, sizeof(expected));
+	strcpy(copy, doc);
+	expected_ret = json_obj_parse(copy, strlen(copy), stream_descr, ARRAY_SIZE(stream_descr),
+				      &expected);
+	zassert_equal(expected_ret, BIT64_MASK(ARRAY_SIZE(stream_descr)));
+	zassert_equal(expected.elts_len, 2);
+
+	for (size_t chunk = 1; chunk <= strlen(doc); chunk++) {
+		memset(&ts, 0, sizeof(ts));
+		zassert_equal(stream_harness(doc, chunk, stream_descr, ARRAY_SIZE(stream_descr),
+					     &ts),
+			      expected_ret, "chunk %zu", chunk);
+		zassert_mem_equal(&ts, &expected, sizeof(ts), "chunk %zu", chunk);
+	}
+}
+
+ZTEST(lib_json_test, test_json_obj_stream_invalid)
+{
+	struct stream_struct ts;
+	struct test_struct ts_ptr;
+
+	/* Wrong types */
+	zassert_equal(stream_harness("{\"some_int\":true}", 1, stream_descr,
+				     ARRAY_SIZE(stream_descr), &ts), -EINVAL);
+	zassert_equal(stream_harness("{\"some_bool\":null}", 1, stream_descr,
+				     ARRAY_SIZE(stream_descr), &ts), -EINVAL);
+	zassert_equal(stream_harness("[]", 1, stream_descr, ARRAY_SIZE(stream_descr), &ts),
+		      -EINVAL);
+
+	/* Too many elements */
+	zassert_equal(stream_harness("{\"some_array\":[1,2,3,4,5]}", 1, stream_descr,
+				     ARRAY_SIZE(stream_descr), &ts), -ENOSPC);
+
+	/* Strings referring to the document are not supported */
+	zassert_equal(stream_harness("{\"some_string\":\"abc\"}", 1, test_descr,
+				     ARRAY_SIZE(test_descr), &ts_ptr), -ENOTSUP);
+
+	/* Incomplete document */
+	zassert_equal(stream_harness("{\"some_int\":1", 1, stream_descr,
+				     ARRAY_SIZE(stream_descr), &ts), -EINVAL);
+}
+
+NET_BUF_POOL_FIXED_DEFINE(json_net_buf_pool, 64, 16, 0, NULL);
+
+ZTEST(lib_json_test, test_json_obj_encode_net_buf)
+{
+	struct test_int_limits limits = {
+		.int_min = INT_MIN,
+		.int64_max = INT64_MAX,
+		.int64_min = INT64_MIN,
+		.uint64_max = UINT64_MAX,
+		.uint32_max = UINT32_MAX,
+		.int16_min = INT16_MIN,
+		.uint8_max = UINT8_MAX,
+	};
+	char expected[1024];
+	char encoded[1024];
+	struct net_buf *buf;
+	size_t len;
+
+	zassert_ok(json_obj_encode_buf(obj_limits_descr, ARRAY_SIZE(obj_limits_descr), &limits,
+				       expected, sizeof(expected)));
+	len = strlen(expected);
+
+	/* Appended after the existing data, across many fragments */
+	buf = net_buf_alloc(&json_net_buf_pool, K_NO_WAIT);
+	zassert_not_null(buf);
+	net_buf_add_mem(buf, "POST ", 5);
+
+	zassert_ok(json_obj_encode_net_buf(obj_limits_descr, ARRAY_SIZE(obj_limits_descr),
+					   &limits, buf, K_NO_WAIT));
+	zassert_equal(net_buf_frags_len(buf), 5 + len);
+	zassert_equal(net_buf_linearize(encoded, sizeof(encoded), buf, 0, 5 + len), 5 + len);
+	zassert_mem_equal(encoded, "POST ", 5);
+	zassert_mem_equal(&encoded[5], expected, len);
+
+	/* Running out of fragments */
+	zassert_equal(json_obj_encode_net_buf(obj_limits_descr, ARRAY_SIZE(obj_limits_descr),
+					      &limits, buf, K_NO_WAIT), -ENOMEM);
+
+	net_buf_unref(buf);
+}
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
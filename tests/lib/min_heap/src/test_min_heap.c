@@ -191,4 +191,96 @@ ZTEST(min_heap_api, test_find_and_remove)
 	zassert_true(min_heap_is_empty(&my_heap), "Empty check fail");
 }
 
+ZTEST(min_heap_api, test_build)
+{
+	struct data sorted[ARRAY_SIZE(elements)];
+	struct data temp;
+
+	zassert_equal(min_heap_build(&my_heap, elements, HEAP_CAPACITY + 1), -ENOMEM,
+		      "build beyond capacity should return -ENOMEM");
+	zassert_ok(min_heap_build(&my_heap, elements, ARRAY_SIZE(elements)),
+		   "min_heap_build failed");
+	zassert_equal(my_heap.size, ARRAY_SIZE(elements), "wrong heap size");
+	validate_heap_order_ls(&my_heap);
+
+	/* Build in place from elements written to the storage */
+	memcpy(my_heap.storage, elements, sizeof(elements));
+	zassert_ok(min_heap_build(&my_heap, my_heap.storage, ARRAY_SIZE(elements)),
+		   "min_heap_build failed");
+	for (int i = 0; i < ARRAY_SIZE(sorted); i++) {
+		zassert_true(min_heap_pop(&my_heap, &temp), "pop failure");
+		sorted[i] = temp;
+	}
+	for (int i = 1; i < ARRAY_SIZE(sorted); i++) {
+		zassert_true(sorted[i].key >= sorted[i - 1].key, "Heap order violated");
+	}
+}
+
+/* Elements are pointers to timers, which keep their index as a handle */
+struct timer {
+	int deadline;
+	size_t index;
+};
+
+static int compare_timer(const void *a, const void *b)
+{
+	const struct timer *ta = *(struct timer *const *)a;
+	const struct timer *tb = *(struct timer *const *)b;
+
+	return ta->deadline - tb->deadline;
+}
+
+static void track_timer(void *node, size_t index)
+{
+	(*(struct timer **)node)->index = index;
+}
+
+ZTEST(min_heap_api, test_handles)
+{
+	struct timer timers[HEAP_CAPACITY];
+	struct timer *storage[HEAP_CAPACITY];
+	struct timer *removed;
+	struct min_heap heap;
+
+	min_heap_init(&heap, storage, HEAP_CAPACITY, sizeof(storage[0]), compare_timer);
+	min_heap_set_index_cb(&heap, track_timer);
+
+	for (int i = 0; i < ARRAY_SIZE(timers); i++) {
+		struct timer *t = &timers[i];
+
+		t->deadline = elements[i].key;
+		zassert_ok(min_heap_push(&heap, &t), "min_heap_push failed");
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(timers); i++) {
+		zassert_equal_ptr(storage[timers[i].index], &timers[i], "stale index");
+	}
+
+	/* Decrease a key to the front, increase the front to the back */
+	timers[2].deadline = 1;
+	zassert_ok(min_heap_update(&heap, timers[2].index), "min_heap_update failed");
+	zassert_equal_ptr(storage[0], &timers[2], "decreased key not at the root");
+
+	timers[2].deadline = 100;
+	zassert_ok(min_heap_update(&heap, timers[2].index), "min_heap_update failed");
+	zassert_equal(storage[0]->deadline, LOWEST_PRIORITY_LS, "wrong root");
+	zassert_equal(min_heap_update(&heap, HEAP_CAPACITY), -EINVAL,
+		      "update with invalid index should fail");
+
+	/* Cancel a timer by its handle */
+	zassert_true(min_heap_remove(&heap, timers[1].index, &removed), "remove failed");
+	zassert_equal_ptr(removed, &timers[1], "removed the wrong timer");
+	zassert_equal(timers[1].index, MIN_HEAP_NO_INDEX, "index not cleared on removal");
+
+	for (int i = 0; i < heap.size; i++) {
+		zassert_equal(storage[i]->index, i, "stale index");
+	}
+
+	for (int prev = 0; min_heap_pop(&heap, &removed);) {
+		zassert_true(removed->deadline >= prev, "Heap order violated");
+		zassert_equal(removed->index, MIN_HEAP_NO_INDEX, "index not cleared");
+		prev = removed->deadline;
+	}
+}
+
 ZTEST_SUITE(min_heap_api, NULL, NULL, NULL, NULL, NULL);
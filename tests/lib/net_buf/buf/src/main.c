@@ -71,6 +71,7 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE(bulk_pool, 8, FIXED_BUFFER_SIZE, USER_DATA_FIXED, NULL);
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -529,6 +530,63 @@ ZTEST(net_buf_tests, test_net_buf_var_pool)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_bulk)
+{
+	struct net_buf *bufs[bulk_pool.buf_count + 1];
+	struct net_buf_pool_cache_stats stats;
+	struct net_buf *held, *extra;
+	sys_slist_t list;
+	int n;
+
+	for (int round = 0; round < 3; round++) {
+		n = net_buf_alloc_bulk(&bulk_pool, 20, bufs, 3, K_NO_WAIT);
+		zassert_equal(n, 3, "Failed to get buffers");
+		n = net_buf_alloc_bulk(&bulk_pool, 20, &bufs[3], ARRAY_SIZE(bufs) - 3,
+				       K_NO_WAIT);
+		zassert_equal(n, bulk_pool.buf_count - 3, "Failed to get buffers");
+		zassert_is_null(net_buf_alloc_len(&bulk_pool, 20, K_NO_WAIT),
+				"Pool should be empty");
+		zassert_equal(net_buf_alloc_bulk(&bulk_pool, 20, &extra, 1, K_NO_WAIT), 0,
+			      "Pool should be empty");
+
+		for (int i = 0; i < bulk_pool.buf_count; i++) {
+			zassert_equal(bufs[i]->ref, 1, "Invalid reference count");
+			zassert_equal(bufs[i]->size, FIXED_BUFFER_SIZE, "Invalid size");
+			zassert_equal(bufs[i]->len, 0, "Invalid length");
+			for (int j = 0; j < i; j++) {
+				zassert_not_equal(bufs[i], bufs[j], "Buffer allocated twice");
+			}
+		}
+
+		/* Free a chain, a referenced buffer and the others at once */
+		net_buf_frag_add(bufs[0], bufs[1]);
+		held = net_buf_ref(bufs[2]);
+
+		sys_slist_init(&list);
+		net_buf_slist_put(&list, bufs[0]);
+		for (int i = 2; i < bulk_pool.buf_count; i++) {
+			net_buf_slist_put(&list, bufs[i]);
+		}
+		net_buf_unref_list(&list);
+		zassert_true(sys_slist_is_empty(&list), "List not emptied");
+
+		zassert_equal(net_buf_alloc_bulk(&bulk_pool, 20, bufs, ARRAY_SIZE(bufs),
+						 K_NO_WAIT),
+			      bulk_pool.buf_count - 1, "Buffers not returned to the pool");
+		net_buf_unref(held);
+		for (int i = 0; i < bulk_pool.buf_count - 1; i++) {
+			net_buf_unref(bufs[i]);
+		}
+	}
+
+	net_buf_pool_cache_stats_get(&bulk_pool, &stats);
+	if (IS_ENABLED(CONFIG_NET_BUF_POOL_CPU_CACHE)) {
+		zassert_true(stats.hits > 0, "No cache hits");
+	} else {
+		zassert_equal(stats.hits + stats.misses, 0, "Unexpected cache statistics");
+	}
+}
+
 ZTEST(net_buf_tests, test_net_buf_byte_order)
 {
 	struct net_buf *buf;
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/smf.h>
+
+/*
+ * Hierarchical Deep State Test Transition:
+ *
+ * Two branches of ten states each hang below a chain of four common
+ * ancestors, so that entering a leaf goes through more than eight
+ * ancestors:
+ *
+ *	P0 --> P1 --> P2 --> P3 --> A1 --> ... --> A10
+ *	                      |
+ *	                      |---> B1 --> ... --> B10
+ *
+ *	P0_ENTRY --> ... --> P3_ENTRY --> A1_ENTRY --> ... --> A10_ENTRY ---|
+ *	                                                                    |
+ *	|-------------------------------------------------------------------|
+ *	|
+ *	|--> A10_RUN --> A10_EXIT --> ... --> A1_EXIT ----------------------|
+ *	                                                                    |
+ *	|-------------------------------------------------------------------|
+ *	|
+ *	|--> B1_ENTRY --> ... --> B10_ENTRY --> B10_RUN
+ *
+ * The A10 to B10 transition is between cousins whose least common ancestor
+ * is P3, so neither P3 nor any of its ancestors is exited or entered again.
+ */
+
+#define TEST_OBJECT(o) ((struct test_object *)o)
+
+#define SMF_RUN 2
+
+/* List of all states */
+enum test_state {
+	P0, P1, P2, P3,
+	A1, A2, A3, A4, A5, A6, A7, A8, A9, A10,
+	B1, B2, B3, B4, B5, B6, B7, B8, B9, B10,
+};
+
+enum test_action {
+	ENTRY,
+	RUN,
+	EXIT,
+};
+
+struct test_step {
+	enum test_state state;
+	enum test_action action;
+};
+
+static const struct test_step test_steps[] = {
+	{ P0, ENTRY }, { P1, ENTRY }, { P2, ENTRY }, { P3, ENTRY },
+	{ A1, ENTRY }, { A2, ENTRY }, { A3, ENTRY }, { A4, ENTRY }, { A5, ENTRY },
+	{ A6, ENTRY }, { A7, ENTRY }, { A8, ENTRY }, { A9, ENTRY }, { A10, ENTRY },
+	{ A10, RUN },
+	{ A10, EXIT }, { A9, EXIT }, { A8, EXIT }, { A7, EXIT }, { A6, EXIT },
+	{ A5, EXIT }, { A4, EXIT }, { A3, EXIT }, { A2, EXIT }, { A1, EXIT },
+	{ B1, ENTRY }, { B2, ENTRY }, { B3, ENTRY }, { B4, ENTRY }, { B5, ENTRY },
+	{ B6, ENTRY }, { B7, ENTRY }, { B8, ENTRY }, { B9, ENTRY }, { B10, ENTRY },
+	{ B10, RUN },
+};
+
+/* Forward declaration of test_states */
+static const struct smf_state test_states[];
+
+static struct test_object {
+	struct smf_ctx ctx;
+	uint32_t step_idx;
+} test_obj;
+
+static void test_step(void *obj, enum test_state state, enum test_action action)
+{
+	struct test_object *o = TEST_OBJECT(obj);
+
+	zassert_true(o->step_idx < ARRAY_SIZE(test_steps), "Unexpected action %d of state %d",
+		     action, state);
+	zassert_equal(test_steps[o->step_idx].state, state,
+		      "Step %u: state %d instead of %d", o->step_idx, state,
+		      test_steps[o->step_idx].state);
+	zassert_equal(test_steps[o->step_idx].action, action,
+		      "Step %u: action %d instead of %d", o->step_idx, action,
+		      test_steps[o->step_idx].action);
+
+	o->step_idx++;
+}
+
+#define TEST_STATE_ACTIONS(_name, _state)				\
+	static void _name##_entry(void *obj)				\
+	{								\
+		test_step(obj, _state, ENTRY);				\
+	}								\
+									\
+	static void _name##_exit(void *obj)				\
+	{								\
+		test_step(obj, _state, EXIT);				\
+	}
+
+TEST_STATE_ACTIONS(p0, P0)
+TEST_STATE_ACTIONS(p1, P1)
+TEST_STATE_ACTIONS(p2, P2)
+TEST_STATE_ACTIONS(p3, P3)
+TEST_STATE_ACTIONS(a1, A1)
+TEST_STATE_ACTIONS(a2, A2)
+TEST_STATE_ACTIONS(a3, A3)
+TEST_STATE_ACTIONS(a4, A4)
+TEST_STATE_ACTIONS(a5, A5)
+TEST_STATE_ACTIONS(a6, A6)
+TEST_STATE_ACTIONS(a7, A7)
+TEST_STATE_ACTIONS(a8, A8)
+TEST_STATE_ACTIONS(a9, A9)
+TEST_STATE_ACTIONS(a10, A10)
+TEST_STATE_ACTIONS(b1, B1)
+TEST_STATE_ACTIONS(b2, B2)
+TEST_STATE_ACTIONS(b3, B3)
+TEST_STATE_ACTIONS(b4, B4)
+TEST_STATE_ACTIONS(b5, B5)
+TEST_STATE_ACTIONS(b6, B6)
+TEST_STATE_ACTIONS(b7, B7)
+TEST_STATE_ACTIONS(b8, B8)
+TEST_STATE_ACTIONS(b9, B9)
+TEST_STATE_ACTIONS(b10, B10)
+
+static enum smf_state_result a10_run(void *obj)
+{
+	test_step(obj, A10, RUN);
+
+	smf_set_state(SMF_CTX(obj), &test_states[B10]);
+	return SMF_EVENT_HANDLED;
+}
+
+static enum smf_state_result b10_run(void *obj)
+{
+	test_step(obj, B10, RUN);
+
+	return SMF_EVENT_HANDLED;
+}
+
+#define TEST_STATE(_name, _parent)					\
+	SMF_CREATE_STATE(_name##_entry, NULL, _name##_exit, _parent, NULL)
+
+static const struct smf_state test_states[] = {
+	[P0] = TEST_STATE(p0, NULL),
+	[P1] = TEST_STATE(p1, &test_states[P0]),
+	[P2] = TEST_STATE(p2, &test_states[P1]),
+	[P3] = TEST_STATE(p3, &test_states[P2]),
+	[A1] = TEST_STATE(a1, &test_states[P3]),
+	[A2] = TEST_STATE(a2, &test_states[A1]),
+	[A3] = TEST_STATE(a3, &test_states[A2]),
+	[A4] = TEST_STATE(a4, &test_states[A3]),
+	[A5] = TEST_STATE(a5, &test_states[A4]),
+	[A6] = TEST_STATE(a6, &test_states[A5]),
+	[A7] = TEST_STATE(a7, &test_states[A6]),
+	[A8] = TEST_STATE(a8, &test_states[A7]),
+	[A9] = TEST_STATE(a9, &test_states[A8]),
+	[A10] = SMF_CREATE_STATE(a10_entry, a10_run, a10_exit, &test_states[A9], NULL),
+	[B1] = TEST_STATE(b1, &test_states[P3]),
+	[B2] = TEST_STATE(b2, &test_states[B1]),
+	[B3] = TEST_STATE(b3, &test_states[B2]),
+	[B4] = TEST_STATE(b4, &test_states[B3]),
+	[B5] = TEST_STATE(b5, &test_states[B4]),
+	[B6] = TEST_STATE(b6, &test_states[B5]),
+	[B7] = TEST_STATE(b7, &test_states[B6]),
+	[B8] = TEST_STATE(b8, &test_states[B7]),
+	[B9] = TEST_STATE(b9, &test_states[B8]),
+	[B10] = SMF_CREATE_STATE(b10_entry, b10_run, b10_exit, &test_states[B9], NULL),
+};
+
+ZTEST(smf_tests, test_smf_hierarchical_deep)
+{
+	test_obj.step_idx = 0;
+	smf_set_initial((struct smf_ctx *)&test_obj, &test_states[A10]);
+
+	for (int i = 0; i < SMF_RUN; i++) {
+		if (smf_run_state((struct smf_ctx *)&test_obj) < 0) {
+			break;
+		}
+	}
+
+	zassert_equal(test_obj.step_idx, ARRAY_SIZE(test_steps), "Incorrect test step index");
+	zassert_equal_ptr(test_obj.ctx.current, &test_states[B10], "Final state not reached");
+}
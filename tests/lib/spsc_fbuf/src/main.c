@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/spsc_fbuf.h>
+#include <zephyr/random/random.h>
+
+#define FRAME_SIZE 8
+#define STRESS_TIMEOUT_MS ((CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) ? 1000 : 15000)
+
+static uint8_t memory_area[512] __aligned(MAX(Z_SPSC_PBUF_DCACHE_LINE, 4));
+
+static bool use_cache(uint32_t flags)
+{
+	return IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
+		(IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_FBUF_CACHE));
+}
+
+static uint8_t *get_data(struct spsc_fbuf *fb, uint32_t flags)
+{
+	return use_cache(flags) ? fb->ext.cache.data : fb->ext.nocache.data;
+}
+
+static void fill_frames(uint8_t *buf, uint32_t first, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames * FRAME_SIZE; i++) {
+		buf[i] = (uint8_t)(first + i / FRAME_SIZE);
+	}
+}
+
+static void check_frames(const uint8_t *buf, uint32_t first, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames * FRAME_SIZE; i++) {
+		zassert_equal(buf[i], (uint8_t)(first + i / FRAME_SIZE), "frame %u",
+			      first + i / FRAME_SIZE);
+	}
+}
+
+static void test_spsc_fbuf_flags(uint32_t flags)
+{
+	static uint8_t wbuf[64 * FRAME_SIZE];
+	static uint8_t rbuf[64 * FRAME_SIZE];
+	struct spsc_fbuf *fb;
+	size_t offset = use_cache(flags) ? offsetof(struct spsc_fbuf, ext.cache.data) :
+					   offsetof(struct spsc_fbuf, ext.nocache.data);
+	uint32_t capacity;
+	uint32_t len;
+
+	memset(memory_area, 0, sizeof(memory_area));
+	fb = spsc_fbuf_init(memory_area, sizeof(memory_area), FRAME_SIZE, flags);
+	zassert_equal_ptr(fb, memory_area);
+
+	/* Capacity is the largest power of two which fits. */
+	capacity = spsc_fbuf_capacity(fb);
+	zassert_true(IS_POWER_OF_TWO(capacity));
+	zassert_true(capacity * FRAME_SIZE <= sizeof(memory_area) - offset);
+	zassert_true(2 * capacity * FRAME_SIZE > sizeof(memory_area) - offset);
+	zassert_true(capacity >= 16);
+
+	/* Read empty buffer. */
+	zassert_equal(spsc_fbuf_read(fb, rbuf, 1, NULL), 0);
+	zassert_equal(spsc_fbuf_used(fb), 0);
+
+	/* Whole capacity can be used, there is no reserved frame. */
+	fill_frames(wbuf, 0, capacity);
+	len = spsc_fbuf_write(fb, wbuf, capacity, NULL);
+	zassert_equal(len, capacity);
+	zassert_equal(spsc_fbuf_used(fb), capacity);
+	zassert_equal(spsc_fbuf_write(fb, wbuf, 1, NULL), 0);
+
+	len = spsc_fbuf_read(fb, rbuf, capacity, NULL);
+	zassert_equal(len, capacity);
+	check_frames(rbuf, 0, capacity);
+
+	/* Copy across the wrap. */
+	for (uint32_t first = 0; first < 4 * capacity; first += 5) {
+		fill_frames(wbuf, first, 5);
+		zassert_equal(spsc_fbuf_write(fb, wbuf, 5, NULL), 5);
+		zassert_equal(spsc_fbuf_read(fb, rbuf, 5, NULL), 5);
+		check_frames(rbuf, first, 5);
+	}
+}
+
+ZTEST(test_spsc_fbuf, test_spsc_fbuf_ut)
+{
+	test_spsc_fbuf_flags(0);
+}
+
+ZTEST(test_spsc_fbuf, test_spsc_fbuf_ut_cache)
+{
+	test_spsc_fbuf_flags(SPSC_FBUF_CACHE);
+}
+
+ZTEST(test_spsc_fbuf, test_invalid)
+{
+	zassert_is_null(spsc_fbuf_init(memory_area, sizeof(memory_area), 0, 0));
+	zassert_is_null(spsc_fbuf_init(memory_area, sizeof(struct spsc_fbuf), FRAME_SIZE, 0));
+}
+
+ZTEST(test_spsc_fbuf, test_0cpy_wrap)
+{
+	struct spsc_fbuf *fb;
+	uint32_t capacity;
+	uint32_t len;
+	void *buf;
+
+	fb = spsc_fbuf_init(memory_area, sizeof(memory_area), FRAME_SIZE, 0);
+	capacity = spsc_fbuf_capacity(fb);
+
+	/* Move the indices to 3 frames before the end. */
+	len = spsc_fbuf_alloc(fb, capacity - 3, &buf);
+	zassert_equal(len, capacity - 3);
+	zassert_equal_ptr(buf, get_data(fb, 0));
+	spsc_fbuf_commit(fb, len, NULL);
+	len = spsc_fbuf_claim(fb, capacity, &buf);
+	zassert_equal(len, capacity - 3);
+	spsc_fbuf_free(fb, len, NULL);
+
+	/* Span ends at the end of the buffer, the rest follows from the start. */
+	len = spsc_fbuf_alloc(fb, 8, &buf);
+	zassert_equal(len, 3);
+	zassert_equal_ptr(buf, &get_data(fb, 0)[(capacity - 3) * FRAME_SIZE]);
+	fill_frames(buf, 0, len);
+	spsc_fbuf_commit(fb, len, NULL);
+
+	len = spsc_fbuf_alloc(fb, 5, &buf);
+	zassert_equal(len, 5);
+	zassert_equal_ptr(buf, get_data(fb, 0));
+	fill_frames(buf, 3, len);
+	spsc_fbuf_commit(fb, len, NULL);
+
+	zassert_equal(spsc_fbuf_used(fb), 8);
+
+	len = spsc_fbuf_claim(fb, 8, &buf);
+	zassert_equal(len, 3);
+	check_frames(buf, 0, len);
+	spsc_fbuf_free(fb, len, NULL);
+
+	len = spsc_fbuf_claim(fb, 8, &buf);
+	zassert_equal(len, 5);
+	check_frames(buf, 3, len);
+
+	/* Partial free keeps the remaining frames claimable. */
+	spsc_fbuf_free(fb, 2, NULL);
+	len = spsc_fbuf_claim(fb, 8, &buf);
+	zassert_equal(len, 3);
+	check_frames(buf, 5, len);
+	spsc_fbuf_free(fb, len, NULL);
+
+	zassert_equal(spsc_fbuf_used(fb), 0);
+}
+
+struct wm_data {
+	uint32_t cnt;
+	uint32_t used;
+};
+
+static void wm_cb(struct spsc_fbuf *fb, uint32_t used, void *user_data)
+{
+	struct wm_data *data = user_data;
+
+	data->cnt++;
+	data->used = used;
+}
+
+ZTEST(test_spsc_fbuf, test_watermark)
+{
+	static uint8_t frames[16 * FRAME_SIZE];
+	struct wm_data high_data = {};
+	struct wm_data low_data = {};
+	const struct spsc_fbuf_watermark high = {
+		.level = 8,
+		.cb = wm_cb,
+		.user_data = &high_data,
+	};
+	const struct spsc_fbuf_watermark low = {
+		.level = 2,
+		.cb = wm_cb,
+		.user_data = &low_data,
+	};
+	struct spsc_fbuf *fb;
+
+	fb = spsc_fbuf_init(memory_area, sizeof(memory_area), FRAME_SIZE, 0);
+
+	/* Rising below the level does not notify. */
+	spsc_fbuf_write(fb, frames, 6, &high);
+	zassert_equal(high_data.cnt, 0);
+
+	/* Reaching the level notifies once. */
+	spsc_fbuf_write(fb, frames, 4, &high);
+	zassert_equal(high_data.cnt, 1);
+	zassert_equal(high_data.used, 10);
+	spsc_fbuf_write(fb, frames, 1, &high);
+	zassert_equal(high_data.cnt, 1);
+
+	/* Draining notifies once the level is reached. */
+	spsc_fbuf_read(fb, frames, 8, &low);
+	zassert_equal(low_data.cnt, 0);
+	spsc_fbuf_read(fb, frames, 1, &low);
+	zassert_equal(low_data.cnt, 1);
+	zassert_equal(low_data.used, 2);
+	spsc_fbuf_read(fb, frames, 2, &low);
+	zassert_equal(low_data.cnt, 1);
+}
+
+struct stress_data {
+	struct spsc_fbuf *fbuf;
+	uint32_t capacity;
+	uint32_t write_cnt;
+	uint32_t read_cnt;
+};
+
+bool stress_claim_free(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	struct stress_data *ctx = user_data;
+	uint32_t len;
+	void *buf;
+
+	do {
+		len = spsc_fbuf_claim(ctx->fbuf, 1 + (sys_rand8_get() % ctx->capacity), &buf);
+		check_frames(buf, ctx->read_cnt, len);
+		spsc_fbuf_free(ctx->fbuf, len, NULL);
+		ctx->read_cnt += len;
+	} while (len > 0 && last);
+
+	return true;
+}
+
+bool stress_alloc_commit(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	struct stress_data *ctx = user_data;
+	uint32_t len;
+	void *buf;
+
+	len = spsc_fbuf_alloc(ctx->fbuf, 1 + (sys_rand8_get() % ctx->capacity), &buf);
+	fill_frames(buf, ctx->write_cnt, len);
+	spsc_fbuf_commit(ctx->fbuf, len, NULL);
+	ctx->write_cnt += len;
+
+	return true;
+}
+
+ZTEST(test_spsc_fbuf, test_stress_0cpy)
+{
+	static uint8_t buffer[256] __aligned(MAX(Z_SPSC_PBUF_DCACHE_LINE, 4));
+	static struct stress_data ctx;
+	uint32_t repeat = 0;
+
+	ctx.write_cnt = 0;
+	ctx.read_cnt = 0;
+	ctx.fbuf = spsc_fbuf_init(buffer, sizeof(buffer), FRAME_SIZE, 0);
+	ctx.capacity = spsc_fbuf_capacity(ctx.fbuf);
+
+	ztress_set_timeout(K_MSEC(STRESS_TIMEOUT_MS));
+	TC_PRINT("Reading from an interrupt, writing from a thread\n");
+	ZTRESS_EXECUTE(ZTRESS_TIMER(stress_claim_free, &ctx, repeat, Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_alloc_commit, &ctx, repeat, 2000, Z_TIMEOUT_TICKS(4)));
+
+	TC_PRINT("Writing from an interrupt, reading from a thread\n");
+	ZTRESS_EXECUTE(ZTRESS_TIMER(stress_alloc_commit, &ctx, repeat, Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_claim_free, &ctx, repeat, 1000, Z_TIMEOUT_TICKS(4)));
+
+	TC_PRINT("Frames: %u\n", ctx.read_cnt);
+	zassert_true(ctx.read_cnt > 0);
+}
+
+ZTEST_SUITE(test_spsc_fbuf, NULL, NULL, NULL, NULL, NULL);
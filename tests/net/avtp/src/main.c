@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_AVTP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/avtp.h>
+#include <zephyr/net/aes67.h>
+
+#define STREAM_ID 0x00005e005301000aULL
+#define TRANSIT_TIME 2000000U
+#define WAIT_TIME K_MSEC(500)
+
+struct eth_fake_context {
+	struct net_if *iface;
+	uint8_t mac_address[6];
+};
+
+static struct eth_fake_context eth_fake_data = {
+	.mac_address = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 },
+};
+
+static const struct avtp_stream_config stream_cfg = {
+	.stream_id = STREAM_ID,
+	.dst = { { 0x91, 0xe0, 0xf0, 0x00, 0xfe, 0x01 } },
+	.priority = NET_PRIORITY_CA,
+	.max_transit_time = TRANSIT_TIME,
+	.format = AVTP_AAF_FORMAT_INT_16BIT,
+	.nsr = AVTP_AAF_NSR_48KHZ,
+	.channels = 2,
+	.bit_depth = 16,
+};
+
+static uint8_t tx_frame[NET_ETH_MTU + sizeof(struct net_eth_hdr)];
+static size_t tx_frame_len;
+
+static struct avtp_stream_info rx_info;
+static uint8_t rx_data[64];
+static K_SEM_DEFINE(rx_sem, 0, 1);
+
+static int eth_fake_send(const struct device *dev, struct net_pkt *pkt)
+{
+	struct net_pkt *recv_pkt;
+
+	ARG_UNUSED(dev);
+
+	tx_frame_len = MIN(net_pkt_get_len(pkt), sizeof(tx_frame));
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_pkt_read(pkt, tx_frame, tx_frame_len));
+
+	/* Loop the stream back to the listeners */
+	recv_pkt = net_pkt_rx_clone(pkt, K_NO_WAIT);
+	zassert_not_null(recv_pkt);
+
+	net_pkt_set_iface(recv_pkt, eth_fake_data.iface);
+	zassert_ok(net_recv_data(eth_fake_data.iface, recv_pkt));
+
+	return 0;
+}
+
+static void eth_fake_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_fake_context *ctx = dev->data;
+
+	ctx->iface = iface;
+
+	net_if_set_link_addr(iface, ctx->mac_address, sizeof(ctx->mac_address),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static struct ethernet_api eth_fake_api_funcs = {
+	.iface_api.init = eth_fake_iface_init,
+	.send = eth_fake_send,
+};
+
+ETH_NET_DEVICE_INIT(eth_fake, "eth_fake", NULL, NULL, &eth_fake_data, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &eth_fake_api_funcs, NET_ETH_MTU);
+
+static void listener_cb(struct avtp_listener *listener, struct net_pkt *pkt,
+			const struct avtp_stream_info *info)
+{
+	ARG_UNUSED(listener);
+
+	rx_info = *info;
+	zassert_true(info->len <= sizeof(rx_data));
+	zassert_ok(net_pkt_read(pkt, rx_data, info->len));
+
+	k_sem_give(&rx_sem);
+}
+
+static struct avtp_listener listener = {
+	.stream_id = STREAM_ID,
+	.cb = listener_cb,
+};
+
+ZTEST(avtp, test_aaf_hdr)
+{
+	struct avtp_stream_info info;
+	struct avtp_aaf_hdr hdr;
+	const uint8_t *raw = (const uint8_t *)&hdr;
+	struct avtp_stream_config cfg = stream_cfg;
+
+	cfg.channels = 0x123;
+	avtp_aaf_hdr_pack(&hdr, &cfg, 7, 0x11223344, 96);
+
+	zassert_equal(raw[0], AVTP_SUBTYPE_AAF);
+	zassert_equal(raw[1], 0x81, "sv and tv must be set");
+	zassert_equal(raw[2], 7);
+	zassert_equal(sys_get_be64(&raw[4]), STREAM_ID);
+	zassert_equal(sys_get_be32(&raw[12]), 0x11223344);
+	zassert_equal(raw[16], AVTP_AAF_FORMAT_INT_16BIT);
+	zassert_equal(raw[17], (AVTP_AAF_NSR_48KHZ << 4) | 0x01);
+	zassert_equal(raw[18], 0x23);
+	zassert_equal(raw[19], 16);
+	zassert_equal(sys_get_be16(&raw[20]), 96);
+
+	zassert_ok(avtp_aaf_hdr_parse(&hdr, &info));
+	zassert_true(info.tv);
+	zassert_equal(info.presentation_time, 0x11223344);
+	zassert_equal(info.len, 96);
+	zassert_equal(info.aaf.format, AVTP_AAF_FORMAT_INT_16BIT);
+	zassert_equal(info.aaf.nsr, AVTP_AAF_NSR_48KHZ);
+	zassert_equal(info.aaf.channels, 0x123);
+	zassert_equal(info.aaf.bit_depth, 16);
+	zassert_equal(avtp_aaf_nsr_to_rate(info.aaf.nsr), 48000);
+
+	hdr.flags &= ~AVTP_FLAG_SV;
+	zassert_equal(avtp_aaf_hdr_parse(&hdr, &info), -EINVAL);
+}
+
+ZTEST(avtp, test_crf_hdr)
+{
+	struct avtp_stream_info info;
+	struct avtp_crf_hdr hdr;
+	const uint8_t *raw = (const uint8_t *)&hdr;
+
+	avtp_crf_hdr_pack(&hdr, STREAM_ID, 3, AVTP_CRF_TYPE_AUDIO_SAMPLE, 48000, 160, 6);
+
+	zassert_equal(raw[0], AVTP_SUBTYPE_CRF);
+	zassert_equal(raw[3], AVTP_CRF_TYPE_AUDIO_SAMPLE);
+	zassert_equal(sys_get_be32(&raw[12]), 48000);
+	zassert_equal(sys_get_be16(&raw[16]), 6 * sizeof(uint64_t));
+	zassert_equal(sys_get_be16(&raw[18]), 160);
+
+	zassert_ok(avtp_crf_hdr_parse(&hdr, &info));
+	zassert_true(info.tv);
+	zassert_equal(info.crf.type, AVTP_CRF_TYPE_AUDIO_SAMPLE);
+	zassert_equal(info.crf.base_freq, 48000);
+	zassert_equal(info.crf.interval, 160);
+	zassert_equal(info.len, 6 * sizeof(uint64_t));
+}
+
+ZTEST(avtp, test_presentation_delta)
+{
+	zassert_equal(avtp_presentation_delta(1000, 500), 500);
+	zassert_equal(avtp_presentation_delta(500, 1000), -500);
+
+	/* Presentation time after the 32-bit timestamp wrapped */
+	zassert_equal(avtp_presentation_delta(100, 0x1fffffff0ULL), 0x110);
+	zassert_equal(avtp_presentation_delta(0xfffffff0U, 0x100000010ULL), -0x20);
+}
+
+ZTEST(avtp, test_bandwidth)
+{
+	/* 48 kHz stereo 16-bit class A stream, 6 frames every 125 us */
+	zassert_equal(avtp_stream_bandwidth(AVTP_AAF_HDR_LEN, 24, 8000),
+		      (42 + 24 + 24) * 8 * 8000);
+}
+
+ZTEST(avtp, test_aaf_loopback)
+{
+	static const uint8_t samples[24] = { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc };
+	const uint64_t capture_time = 0x100000000ULL + 5000;
+	struct avtp_talker talker;
+	const struct net_eth_hdr *eth = (const struct net_eth_hdr *)tx_frame;
+
+	zassert_ok(avtp_talker_init(&talker, eth_fake_data.iface, &stream_cfg));
+	zassert_ok(avtp_listener_register(&listener));
+	zassert_equal(avtp_listener_register(&listener), -EALREADY);
+
+	zassert_ok(avtp_aaf_send(&talker, samples, sizeof(samples), capture_time));
+	zassert_ok(k_sem_take(&rx_sem, WAIT_TIME));
+
+	zassert_equal(ntohs(eth->type), NET_ETH_PTYPE_TSN);
+	zassert_mem_equal(eth->dst.addr, stream_cfg.dst.addr, sizeof(eth->dst));
+	zassert_equal(tx_frame_len, sizeof(*eth) + AVTP_AAF_HDR_LEN + sizeof(samples));
+
+	zassert_equal(rx_info.subtype, AVTP_SUBTYPE_AAF);
+	zassert_equal(rx_info.presentation_time, (uint32_t)(capture_time + TRANSIT_TIME));
+	zassert_equal(rx_info.lost, 0);
+	zassert_equal(rx_info.len, sizeof(samples));
+	zassert_mem_equal(rx_data, samples, sizeof(samples));
+
+	/* Skip two sequence numbers */
+	talker.seq_num += 2U;
+	zassert_ok(avtp_aaf_send(&talker, samples, sizeof(samples), capture_time));
+	zassert_ok(k_sem_take(&rx_sem, WAIT_TIME));
+	zassert_equal(rx_info.lost, 2);
+
+	zassert_ok(avtp_listener_unregister(&listener));
+	zassert_equal(avtp_listener_unregister(&listener), -ENOENT);
+
+	zassert_ok(avtp_aaf_send(&talker, samples, sizeof(samples), capture_time));
+	zassert_equal(k_sem_take(&rx_sem, K_MSEC(100)), -EAGAIN);
+}
+
+ZTEST(avtp, test_crf_loopback)
+{
+	static const uint64_t timestamps[] = { 1000000, 1003333, 1006666 };
+	struct avtp_talker talker;
+
+	zassert_ok(avtp_talker_init(&talker, eth_fake_data.iface, &stream_cfg));
+	zassert_ok(avtp_listener_register(&listener));
+
+	zassert_ok(avtp_crf_send(&talker, AVTP_CRF_TYPE_AUDIO_SAMPLE, 48000, 160,
+				 timestamps, ARRAY_SIZE(timestamps)));
+	zassert_ok(k_sem_take(&rx_sem, WAIT_TIME));
+
+	zassert_equal(rx_info.subtype, AVTP_SUBTYPE_CRF);
+	zassert_equal(rx_info.crf.base_freq, 48000);
+	zassert_equal(rx_info.len, sizeof(timestamps));
+
+	for (size_t i = 0; i < ARRAY_SIZE(timestamps); i++) {
+		zassert_equal(sys_get_be64(&rx_data[i * sizeof(uint64_t)]), timestamps[i]);
+	}
+
+	zassert_ok(avtp_listener_unregister(&listener));
+}
+
+ZTEST(avtp, test_reserve_without_qav)
+{
+	struct avtp_talker talker;
+
+	zassert_ok(avtp_talker_init(&talker, eth_fake_data.iface, &stream_cfg));
+	zassert_equal(avtp_talker_reserve(&talker, 1, 24, 8000), -ENOTSUP);
+}
+
+ZTEST(avtp, test_aes67_rtp)
+{
+	static const int32_t samples[] = { 0x123456, -2, 0x7fffff, -0x800000 };
+	uint8_t buf[AES67_RTP_HDR_LEN + ARRAY_SIZE(samples) * 3];
+	int32_t out[ARRAY_SIZE(samples)];
+	struct aes67_rtp_hdr hdr;
+
+	zassert_equal(aes67_frames_per_packet(48000, AES67_PTIME_DEFAULT_US), 48);
+	zassert_equal(aes67_rtp_timestamp(NSEC_PER_SEC + NSEC_PER_MSEC, 48000, 0), 48048);
+	zassert_equal(aes67_rtp_timestamp(0, 48000, 10), 10);
+
+	/* 2^32 samples at 48 kHz wrap after about 24.9 hours */
+	zassert_equal(aes67_rtp_timestamp(89478ULL * NSEC_PER_SEC, 48000, 0),
+		      (uint32_t)(89478ULL * 48000));
+
+	aes67_rtp_hdr_pack((struct aes67_rtp_hdr *)buf, AES67_PT_L24, 0xfffe, 48048, 0xdeadbeef);
+	aes67_l24_pack(&buf[AES67_RTP_HDR_LEN], samples, ARRAY_SIZE(samples));
+
+	zassert_equal(aes67_rtp_hdr_parse(buf, sizeof(buf), &hdr), AES67_RTP_HDR_LEN);
+	zassert_equal(hdr.mpt, AES67_PT_L24);
+	zassert_equal(hdr.seq, 0xfffe);
+	zassert_equal(hdr.timestamp, 48048);
+	zassert_equal(hdr.ssrc, 0xdeadbeef);
+
+	aes67_l24_unpack(out, &buf[AES67_RTP_HDR_LEN], ARRAY_SIZE(out));
+	zassert_mem_equal(out, samples, sizeof(samples));
+
+	buf[0] = 0x40;
+	zassert_equal(aes67_rtp_hdr_parse(buf, sizeof(buf), &hdr), -EINVAL);
+}
+
+ZTEST_SUITE(avtp, NULL, NULL, NULL, NULL, NULL);
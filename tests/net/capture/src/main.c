@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/capture.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/ztest.h>
+
+#define SNAPLEN 64
+
+#define PCAPNG_SHB_TYPE 0x0A0D0D0AU
+#define PCAPNG_IDB_TYPE 0x00000001U
+#define PCAPNG_EPB_TYPE 0x00000006U
+#define PCAPNG_MAGIC    0x1A2B3C4DU
+
+#define SHB_LEN 28
+#define IDB_LEN 32
+#define EPB_HDR_LEN 28
+
+#define LINKTYPE_ETHERNET 1
+
+/* The whole ring and the file headers */
+#define FILE_SIZE (CONFIG_NET_CAPTURE_LOCAL_RING_SIZE + SHB_LEN + IDB_LEN)
+
+static struct net_if *eth_if;
+
+static uint8_t file[FILE_SIZE];
+
+static void fake_dev_iface_init(struct net_if *iface)
+{
+	static uint8_t mac_addr[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+
+	eth_if = iface;
+}
+
+static int fake_dev_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static const struct ethernet_api fake_dev_api = {
+	.iface_api.init = fake_dev_iface_init,
+	.send = fake_dev_send,
+};
+
+ETH_NET_DEVICE_INIT(fake_dev, "fake_dev", NULL, NULL, NULL, NULL,
+		    CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &fake_dev_api, NET_ETH_MTU);
+
+static uint8_t payload_byte(uint8_t seq, size_t i)
+{
+	/* The first byte is the packet sequence number */
+	return i == 0 ? seq : (uint8_t)(seq + i * 3);
+}
+
+/* Capture a packet of len bytes, split in two fragments */
+static void capture(uint8_t seq, size_t len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_on_iface(eth_if, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate a packet");
+
+	for (size_t part = 0; part < 2; part++) {
+		size_t start = part == 0 ? 0 : len / 2;
+		size_t end = part == 0 ? len / 2 : len;
+		struct net_buf *frag;
+
+		frag = net_pkt_get_frag(pkt, end - start, K_NO_WAIT);
+		zassert_not_null(frag, "Cannot allocate a fragment");
+
+		for (size_t i = start; i < end; i++) {
+			net_buf_add_u8(frag, payload_byte(seq, i));
+		}
+
+		net_pkt_frag_add(pkt, frag);
+	}
+
+	net_capture_pkt(eth_if, pkt);
+
+	net_pkt_unref(pkt);
+}
+
+/* Length of the packet with a sequence number, some above the snap length */
+static size_t pkt_len(uint8_t seq)
+{
+	return 16 + (seq * 23) % 96;
+}
+
+static uint32_t get32(const uint8_t *data)
+{
+	uint32_t value;
+
+	memcpy(&value, data, sizeof(value));
+
+	return value;
+}
+
+static uint16_t get16(const uint8_t *data)
+{
+	uint16_t value;
+
+	memcpy(&value, data, sizeof(value));
+
+	return value;
+}
+
+struct export_state {
+	size_t len;
+	size_t chunks;
+};
+
+static int export_cb(const void *data, size_t len, void *user_data)
+{
+	struct export_state *state = user_data;
+
+	zassert_true(state->len + len <= sizeof(file), "Export larger than the ring");
+
+	memcpy(&file[state->len], data, len);
+	state->len += len;
+	state->chunks++;
+
+	return 0;
+}
+
+static size_t export(size_t *chunks)
+{
+	struct export_state state = { 0 };
+
+	zassert_ok(net_capture_local_export(export_cb, &state), "Export failed");
+
+	if (chunks != NULL) {
+		*chunks = state.chunks;
+	}
+
+	return state.len;
+}
+
+/*
+ * Check the exported pcapng file and return the number of packets in it,
+ * which shall have consecutive sequence numbers ending with last_seq.
+ */
+static size_t check_file(size_t len, uint8_t last_seq)
+{
+	const uint8_t *idb = &file[SHB_LEN];
+	uint64_t prev_ts = 0;
+	size_t offset;
+	size_t count = 0;
+	uint8_t first_seq = 0;
+
+	zassert_true(len >= SHB_LEN + IDB_LEN, "File too short");
+
+	zassert_equal(get32(&file[0]), PCAPNG_SHB_TYPE, "Not a section header");
+	zassert_equal(get32(&file[4]), SHB_LEN, "Bad section header length");
+	zassert_equal(get32(&file[8]), PCAPNG_MAGIC, "Bad byte order magic");
+	zassert_equal(get32(&file[SHB_LEN - 4]), SHB_LEN, "Bad section header trailer");
+
+	zassert_equal(get32(&idb[0]), PCAPNG_IDB_TYPE, "Not an interface description");
+	zassert_equal(get32(&idb[4]), IDB_LEN, "Bad interface description length");
+	zassert_equal(get16(&idb[8]), LINKTYPE_ETHERNET, "Bad link type");
+	zassert_equal(get32(&idb[12]), SNAPLEN, "Bad snap length");
+	zassert_equal(get32(&idb[IDB_LEN - 4]), IDB_LEN, "Bad interface description trailer");
+
+	for (offset = SHB_LEN + IDB_LEN; offset < len; count++) {
+		const uint8_t *epb = &file[offset];
+		uint32_t block_len = get32(&epb[4]);
+		uint32_t cap_len = get32(&epb[20]);
+		uint32_t orig_len = get32(&epb[24]);
+		uint64_t ts = ((uint64_t)get32(&epb[12]) << 32) | get32(&epb[16]);
+		uint8_t seq = epb[EPB_HDR_LEN];
+
+		zassert_equal(get32(&epb[0]), PCAPNG_EPB_TYPE, "Not a packet block at %zu", offset);
+		zassert_equal(block_len % 4, 0, "Block length not aligned");
+		zassert_true(offset + block_len <= len, "Block past the end of the file");
+		zassert_equal(get32(&epb[block_len - 4]), block_len, "Bad packet block trailer");
+		zassert_equal(block_len, EPB_HDR_LEN + ROUND_UP(cap_len, 4) + 4,
+			      "Block length does not match the captured length");
+
+		if (count == 0) {
+			first_seq = seq;
+		}
+
+		zassert_equal(seq, (uint8_t)(first_seq + count), "Packet out of order");
+		zassert_equal(orig_len, pkt_len(seq), "Bad original length");
+		zassert_equal(cap_len, MIN(orig_len, SNAPLEN), "Bad captured length");
+		zassert_true(ts >= prev_ts, "Timestamp going backwards");
+
+		for (size_t i = 0; i < cap_len; i++) {
+			zassert_equal(epb[EPB_HDR_LEN + i], payload_byte(seq, i),
+				      "Bad data in packet %u", seq);
+		}
+
+		for (size_t i = EPB_HDR_LEN + cap_len; i < block_len - 4; i++) {
+			zassert_equal(epb[i], 0, "Padding not cleared");
+		}
+
+		prev_ts = ts;
+		offset += block_len;
+	}
+
+	zassert_equal(offset, len, "Partial block at the end of the file");
+	zassert_true(count > 0, "No packet in the file");
+	zassert_equal((uint8_t)(first_seq + count - 1), last_seq, "Last packet missing");
+
+	return count;
+}
+
+static void capture_run(size_t count)
+{
+	zassert_ok(net_capture_local_enable(eth_if, SNAPLEN), "Cannot enable the capture");
+
+	for (size_t i = 0; i < count; i++) {
+		capture(i, pkt_len(i));
+	}
+
+	zassert_ok(net_capture_local_disable(), "Cannot disable the capture");
+}
+
+static void capture_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)net_capture_local_disable();
+}
+
+ZTEST_SUITE(net_capture_local, NULL, NULL, NULL, capture_after, NULL);
+
+/**
+ * @brief Test enabling and disabling the local capture
+ */
+ZTEST(net_capture_local, test_enable)
+{
+	zassert_equal(net_capture_local_enable(NULL, 0), -EINVAL, "No interface accepted");
+	zassert_equal(net_capture_local_enable(eth_if, CONFIG_NET_CAPTURE_LOCAL_RING_SIZE),
+		      -EINVAL, "Snap length larger than the ring accepted");
+
+	zassert_ok(net_capture_local_enable(eth_if, SNAPLEN));
+	zassert_equal(net_capture_local_enable(eth_if, SNAPLEN), -EALREADY,
+		      "Capture enabled twice");
+	zassert_equal(net_capture_local_export(export_cb, NULL), -EBUSY,
+		      "Capture exported while running");
+
+	zassert_ok(net_capture_local_disable());
+	zassert_equal(net_capture_local_disable(), -EALREADY, "Capture disabled twice");
+}
+
+/**
+ * @brief Test the export of a capture that did not fill the ring
+ *
+ * @details The file shall hold every packet, truncated to the snap length,
+ * in one chunk after the headers.
+ */
+ZTEST(net_capture_local, test_export)
+{
+	struct net_capture_local_stats stats;
+	size_t chunks;
+	size_t len;
+
+	capture_run(5);
+
+	len = export(&chunks);
+	zassert_equal(chunks, 3, "Ring exported in %zu chunks", chunks - 2);
+	zassert_equal(check_file(len, 4), 5, "Packets missing");
+
+	net_capture_local_stats_get(&stats);
+	zassert_false(stats.enabled);
+	zassert_equal(stats.packets, 5);
+	zassert_equal(stats.overwritten, 0);
+	zassert_equal(stats.size, len, "Size %zu, exported %zu", stats.size, len);
+}
+
+/**
+ * @brief Test the ring wrapping around
+ *
+ * @details The oldest packets shall be overwritten, including the skipped
+ * space at the end of the ring, and the file shall be exported in two
+ * chunks holding the most recent packets in order.
+ */
+ZTEST(net_capture_local, test_wrap)
+{
+	struct net_capture_local_stats stats;
+	size_t count;
+	size_t chunks;
+	size_t len;
+
+	capture_run(60);
+
+	len = export(&chunks);
+	zassert_equal(chunks, 4, "Ring exported in %zu chunks", chunks - 2);
+
+	count = check_file(len, 59);
+
+	net_capture_local_stats_get(&stats);
+	zassert_equal(stats.packets, 60);
+	zassert_equal(stats.overwritten + count, 60, "%u overwritten, %zu in the file",
+		      stats.overwritten, count);
+	zassert_equal(stats.size, len, "Size %zu, exported %zu", stats.size, len);
+}
+
+/**
+ * @brief Test reading the file at an offset
+ *
+ * @details Reads of any size at any offset shall return the same data as
+ * the export, across the chunks, and nothing past the end of the file.
+ */
+ZTEST(net_capture_local, test_read)
+{
+	static const size_t sizes[] = { 1, 7, 28, 100, 333 };
+	static uint8_t data[FILE_SIZE];
+	size_t len;
+	ssize_t ret;
+
+	capture_run(60);
+
+	len = export(NULL);
+
+	ARRAY_FOR_EACH(sizes, i) {
+		size_t offset = 0;
+
+		while (offset < len) {
+			ret = net_capture_local_read(offset, data, sizes[i]);
+			zassert_equal(ret, MIN(sizes[i], len - offset),
+				      "Read %zd at %zu", ret, offset);
+			zassert_mem_equal(data, &file[offset], ret,
+					  "Bad data at %zu", offset);
+			offset += ret;
+		}
+	}
+
+	ret = net_capture_local_read(0, data, sizeof(data));
+	zassert_equal(ret, len, "Whole file read in %zd bytes", ret);
+
+	zassert_equal(net_capture_local_read(len, data, sizeof(data)), 0,
+		      "Read at the end of the file");
+	zassert_equal(net_capture_local_read(len + 1, data, sizeof(data)), 0,
+		      "Read past the end of the file");
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/ethernet_mgmt.h>
+
+#define FRAME_LEN 1000
+#define FRAME_COUNT 5
+/* 1000 bytes, Ethernet header and wire overhead take 8.3 ms at 1 Mbit/s */
+#define IDLE_SLOPE 1000000U
+#define CYCLE_TIME_NS (100 * NSEC_PER_MSEC)
+
+struct eth_fake_context {
+	struct net_if *iface;
+	uint8_t mac_address[6];
+};
+
+static struct eth_fake_context eth_fake_data = {
+	.mac_address = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x02 },
+};
+
+static uint64_t tx_time[FRAME_COUNT];
+static int tx_count;
+static K_SEM_DEFINE(tx_sem, 0, FRAME_COUNT);
+
+static uint64_t now_ns(void)
+{
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
+}
+
+static int eth_fake_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	if (tx_count < FRAME_COUNT) {
+		tx_time[tx_count++] = now_ns();
+	}
+
+	k_sem_give(&tx_sem);
+
+	return 0;
+}
+
+static void eth_fake_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_fake_context *ctx = dev->data;
+
+	ctx->iface = iface;
+
+	net_if_set_link_addr(iface, ctx->mac_address, sizeof(ctx->mac_address),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static struct ethernet_api eth_fake_api_funcs = {
+	.iface_api.init = eth_fake_iface_init,
+	.send = eth_fake_send,
+};
+
+ETH_NET_DEVICE_INIT(eth_fake, "eth_fake", NULL, NULL, &eth_fake_data, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &eth_fake_api_funcs, NET_ETH_MTU);
+
+static void send_frame(void)
+{
+	struct net_if *iface = eth_fake_data.iface;
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, FRAME_LEN, AF_UNSPEC, 0, K_FOREVER);
+	zassert_not_null(pkt);
+
+	/* IEEE 802 local experimental ethertype */
+	net_pkt_set_ll_proto_type(pkt, 0x88b5);
+	zassert_ok(net_pkt_memset(pkt, 0, FRAME_LEN));
+
+	(void)net_linkaddr_copy(net_pkt_lladdr_src(pkt), net_if_get_link_addr(iface));
+	(void)net_linkaddr_set(net_pkt_lladdr_dst(pkt), net_eth_broadcast_addr()->addr,
+			       sizeof(struct net_eth_addr));
+
+	zassert_equal(net_if_try_send_data(iface, pkt, K_FOREVER), NET_OK);
+}
+
+static int set_qav(enum ethernet_qav_param_type type, unsigned int value)
+{
+	struct ethernet_req_params params = { 0 };
+
+	params.qav_param.queue_id = 0;
+	params.qav_param.type = type;
+
+	if (type == ETHERNET_QAV_PARAM_TYPE_STATUS) {
+		params.qav_param.enabled = value != 0U;
+	} else {
+		params.qav_param.idle_slope = value;
+	}
+
+	return net_mgmt(NET_REQUEST_ETHERNET_SET_QAV_PARAM, eth_fake_data.iface, &params,
+			sizeof(params));
+}
+
+static int set_qbv(struct ethernet_qbv_param *param)
+{
+	struct ethernet_req_params params = { 0 };
+
+	params.qbv_param = *param;
+
+	return net_mgmt(NET_REQUEST_ETHERNET_SET_QBV_PARAM, eth_fake_data.iface, &params,
+			sizeof(params));
+}
+
+/* A schedule of two rows, with the only traffic class open in one of them */
+static void set_gates(uint32_t open_ns, bool open_first)
+{
+	struct ethernet_qbv_param param = { 0 };
+
+	param.type = ETHERNET_QBV_PARAM_TYPE_GATE_CONTROL_LIST_LEN;
+	param.gate_control_list_len = 2;
+	zassert_ok(set_qbv(&param));
+
+	param.type = ETHERNET_QBV_PARAM_TYPE_GATE_CONTROL_LIST;
+	param.gate_control.operation = ETHERNET_SET_GATE_STATE;
+	param.gate_control.row = 0;
+	param.gate_control.gate_status[0] = open_first;
+	param.gate_control.time_interval = open_first ? open_ns : CYCLE_TIME_NS - open_ns;
+	zassert_ok(set_qbv(&param));
+
+	param.gate_control.row = 1;
+	param.gate_control.gate_status[0] = !open_first;
+	param.gate_control.time_interval = open_first ? CYCLE_TIME_NS - open_ns : open_ns;
+	zassert_ok(set_qbv(&param));
+
+	memset(&param, 0, sizeof(param));
+	param.type = ETHERNET_QBV_PARAM_TYPE_TIME;
+	param.cycle_time.nanosecond = CYCLE_TIME_NS;
+	zassert_ok(set_qbv(&param));
+
+	param.type = ETHERNET_QBV_PARAM_TYPE_STATUS;
+	param.enabled = true;
+	zassert_ok(set_qbv(&param));
+}
+
+ZTEST(ethernet_shaper, test_qav_invalid)
+{
+	zassert_equal(set_qav(ETHERNET_QAV_PARAM_TYPE_IDLE_SLOPE, 0), -EINVAL);
+	zassert_equal(set_qav(ETHERNET_QAV_PARAM_TYPE_IDLE_SLOPE, 100000000U), -EINVAL,
+		      "Idle slope at the port rate accepted");
+}
+
+ZTEST(ethernet_shaper, test_qav_pacing)
+{
+	zassert_ok(set_qav(ETHERNET_QAV_PARAM_TYPE_IDLE_SLOPE, IDLE_SLOPE));
+	zassert_ok(set_qav(ETHERNET_QAV_PARAM_TYPE_STATUS, 1));
+
+	for (int i = 0; i < FRAME_COUNT; i++) {
+		send_frame();
+	}
+
+	for (int i = 0; i < FRAME_COUNT; i++) {
+		zassert_ok(k_sem_take(&tx_sem, K_SECONDS(1)));
+	}
+
+	for (int i = 1; i < FRAME_COUNT; i++) {
+		zassert_true(tx_time[i] - tx_time[i - 1] >= 8 * NSEC_PER_MSEC,
+			     "Frame %d sent %llu ns after the previous one", i,
+			     tx_time[i] - tx_time[i - 1]);
+	}
+
+	zassert_ok(set_qav(ETHERNET_QAV_PARAM_TYPE_STATUS, 0));
+}
+
+ZTEST(ethernet_shaper, test_qbv_gate_closed)
+{
+	set_gates(CYCLE_TIME_NS / 2, false);
+
+	send_frame();
+	zassert_ok(k_sem_take(&tx_sem, K_SECONDS(1)));
+
+	zassert_true(tx_time[0] % CYCLE_TIME_NS >= CYCLE_TIME_NS / 2,
+		     "Frame sent while the gate was closed");
+}
+
+ZTEST(ethernet_shaper, test_qbv_window_too_short)
+{
+	/* 1000 bytes take 83 us at 100 Mbit/s, longer than the window */
+	set_gates(NSEC_PER_USEC, true);
+
+	send_frame();
+	zassert_equal(k_sem_take(&tx_sem, K_MSEC(300)), -EAGAIN, "Frame overran its window");
+}
+
+static void shaper_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	tx_count = 0;
+	k_sem_reset(&tx_sem);
+}
+
+static void shaper_after(void *fixture)
+{
+	struct ethernet_qbv_param param = { 0 };
+
+	ARG_UNUSED(fixture);
+
+	param.type = ETHERNET_QBV_PARAM_TYPE_STATUS;
+	param.enabled = false;
+	(void)set_qbv(&param);
+}
+
+ZTEST_SUITE(ethernet_shaper, NULL, NULL, shaper_before, shaper_after, NULL);
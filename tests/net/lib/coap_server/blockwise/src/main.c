@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/net/coap.h>
+#include <zephyr/net/coap_service.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/ztest.h>
+
+#define CONTENT_SIZE 300
+#define RECV_SIZE    256
+
+#define BLOCK_VALUE(num, more, szx) (((num) << 4) | ((more) ? BIT(3) : 0U) | (szx))
+
+static const uint16_t block_port = 5683;
+COAP_SERVICE_DEFINE(block_service, NULL, &block_port, 0);
+
+static uint8_t content[CONTENT_SIZE];
+
+static uint8_t received[RECV_SIZE];
+static size_t received_len;
+static bool received_last;
+
+static int content_read(size_t offset, uint8_t *buf, size_t len, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (offset + len > sizeof(content)) {
+		return -EINVAL;
+	}
+
+	memcpy(buf, &content[offset], len);
+
+	return 0;
+}
+
+static int block_get(struct coap_resource *resource, struct coap_packet *request,
+		     struct sockaddr *addr, socklen_t addr_len)
+{
+	const struct coap_resource_content res_content = {
+		.size = sizeof(content),
+		.format = COAP_CONTENT_FORMAT_APP_OCTET_STREAM,
+		.read = content_read,
+	};
+
+	return coap_resource_send_block2(resource, request, addr, addr_len, &res_content);
+}
+
+static int block_write(size_t offset, const uint8_t *buf, size_t len, bool last, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (offset + len > sizeof(received)) {
+		return -ENOSPC;
+	}
+
+	memcpy(&received[offset], buf, len);
+	received_len = MAX(received_len, offset + len);
+	received_last = last;
+
+	return 0;
+}
+
+static int block_put(struct coap_resource *resource, struct coap_packet *request,
+		     struct sockaddr *addr, socklen_t addr_len)
+{
+	return coap_resource_recv_block1(resource, request, addr, addr_len, block_write, NULL);
+}
+
+static const char * const block_path[] = { "block", NULL };
+COAP_RESOURCE_DEFINE(block_resource, block_service, {
+	.get = block_get,
+	.put = block_put,
+	.path = block_path,
+});
+
+static int client_sock = -1;
+static uint8_t request_buf[CONFIG_COAP_SERVER_MESSAGE_SIZE];
+static uint8_t response_buf[CONFIG_COAP_SERVER_MESSAGE_SIZE];
+static struct coap_packet response;
+
+/* Send a confirmable request and parse the piggybacked response */
+static void request_send(uint8_t method, uint16_t block_opt, int block_value,
+			 const uint8_t *payload, uint16_t payload_len)
+{
+	const struct sockaddr_in6 server_addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(block_port),
+		.sin6_addr = IN6ADDR_LOOPBACK_INIT,
+	};
+	struct coap_packet request;
+	uint8_t token[] = { 0x12, 0x34 };
+	ssize_t len;
+
+	zassert_ok(coap_packet_init(&request, request_buf, sizeof(request_buf), COAP_VERSION_1,
+				    COAP_TYPE_CON, sizeof(token), token, method,
+				    coap_next_id()));
+	zassert_ok(coap_packet_append_option(&request, COAP_OPTION_URI_PATH, "block",
+					     strlen("block")));
+
+	if (block_value >= 0) {
+		zassert_ok(coap_append_option_int(&request, block_opt, block_value));
+	}
+
+	if (payload_len > 0) {
+		zassert_ok(coap_packet_append_payload_marker(&request));
+		zassert_ok(coap_packet_append_payload(&request, payload, payload_len));
+	}
+
+	len = zsock_sendto(client_sock, request.data, request.offset, 0,
+			   (const struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(len, request.offset, "Failed to send the request (%d)", errno);
+
+	len = zsock_recv(client_sock, response_buf, sizeof(response_buf), 0);
+	zassert_true(len > 0, "No response (%d)", errno);
+
+	zassert_ok(coap_packet_parse(&response, response_buf, len, NULL, 0));
+	zassert_equal(coap_header_get_type(&response), COAP_TYPE_ACK, "Not a piggybacked response");
+	zassert_equal(coap_header_get_id(&response), coap_header_get_id(&request),
+		      "Response to another request");
+}
+
+/* Check the Block2 response to a GET request */
+static void block2_check(uint32_t num, bool more, size_t size)
+{
+	size_t offset = num * size;
+	size_t len = MIN(size, CONTENT_SIZE - offset);
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint32_t resp_num;
+	bool resp_more;
+	int ret;
+
+	zassert_equal(coap_header_get_code(&response), COAP_RESPONSE_CODE_CONTENT,
+		      "Unexpected response code 0x%02x", coap_header_get_code(&response));
+
+	ret = coap_get_block2_option(&response, &resp_more, &resp_num);
+	zassert_equal(ret, size, "Block size %d, expected %zu", ret, size);
+	zassert_equal(resp_num, num, "Block %u, expected %u", resp_num, num);
+	zassert_equal(resp_more, more, "Unexpected more flag");
+
+	if (num == 0U) {
+		zassert_equal(coap_get_option_int(&response, COAP_OPTION_SIZE2), CONTENT_SIZE,
+			      "Size2 missing from the first block");
+	} else {
+		zassert_equal(coap_get_option_int(&response, COAP_OPTION_SIZE2), -ENOENT,
+			      "Size2 sent with a later block");
+	}
+
+	payload = coap_packet_get_payload(&response, &payload_len);
+	zassert_not_null(payload, "No payload");
+	zassert_equal(payload_len, len, "Payload of %u bytes, expected %zu", payload_len, len);
+	zassert_mem_equal(payload, &content[offset], len, "Bad payload in block %u", num);
+}
+
+/* Check the response to one block of a PUT request */
+static void block1_check(uint8_t code, uint32_t num, bool more, size_t size)
+{
+	uint32_t resp_num;
+	bool resp_more;
+	int ret;
+
+	zassert_equal(coap_header_get_code(&response), code,
+		      "Unexpected response code 0x%02x", coap_header_get_code(&response));
+
+	ret = coap_get_block1_option(&response, &resp_more, &resp_num);
+	zassert_equal(ret, size, "Block size %d, expected %zu", ret, size);
+	zassert_equal(resp_num, num, "Block %u, expected %u", resp_num, num);
+	zassert_equal(resp_more, more, "Unexpected more flag");
+}
+
+static void *blockwise_setup(void)
+{
+	struct timeval timeout = {
+		.tv_sec = 1,
+	};
+
+	for (size_t i = 0; i < sizeof(content); i++) {
+		content[i] = (uint8_t)(i * 7U);
+	}
+
+	zassert_ok(coap_service_start(&block_service), "Cannot start the service");
+
+	client_sock = zsock_socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(client_sock >= 0, "Cannot create the client socket (%d)", errno);
+	zassert_ok(zsock_setsockopt(client_sock, SOL_SOCKET, SO_RCVTIMEO, &timeout,
+				    sizeof(timeout)));
+
+	return NULL;
+}
+
+static void blockwise_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(received, 0, sizeof(received));
+	received_len = 0;
+	received_last = false;
+}
+
+ZTEST_SUITE(coap_blockwise, NULL, blockwise_setup, blockwise_before, NULL, NULL);
+
+/**
+ * @brief Test a GET request without Block2 option
+ *
+ * @details The first block shall be sent with the server block size and the
+ * size of the whole content.
+ */
+ZTEST(coap_blockwise, test_block2_first)
+{
+	request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2, -1, NULL, 0);
+	block2_check(0, true, 64);
+}
+
+/**
+ * @brief Test reading a content block by block
+ *
+ * @details Every block shall hold its part of the content, and only the last
+ * one shall be sent without the more flag.
+ */
+ZTEST(coap_blockwise, test_block2_all)
+{
+	for (uint32_t num = 0U; num * 64U < CONTENT_SIZE; num++) {
+		request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2,
+			     BLOCK_VALUE(num, false, COAP_BLOCK_64), NULL, 0);
+		block2_check(num, (num + 1U) * 64U < CONTENT_SIZE, 64);
+	}
+}
+
+/**
+ * @brief Test a client switching to a smaller block size during a transfer
+ *
+ * @details The block at the offset given by the smaller size shall be sent
+ * with the smaller size.
+ */
+ZTEST(coap_blockwise, test_block2_late_negotiation)
+{
+	request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2, BLOCK_VALUE(0, false, COAP_BLOCK_64),
+		     NULL, 0);
+	block2_check(0, true, 64);
+
+	/* Part of the second 64 bytes block */
+	request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2, BLOCK_VALUE(6, false, COAP_BLOCK_16),
+		     NULL, 0);
+	block2_check(6, true, 16);
+
+	request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2, BLOCK_VALUE(4, false, COAP_BLOCK_32),
+		     NULL, 0);
+	block2_check(4, true, 32);
+}
+
+/**
+ * @brief Test a client asking for blocks larger than the server block size
+ *
+ * @details The block at the offset asked for shall be sent with the server
+ * block size, and the block number scaled accordingly.
+ */
+ZTEST(coap_blockwise, test_block2_larger)
+{
+	request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2, BLOCK_VALUE(1, false, COAP_BLOCK_256),
+		     NULL, 0);
+	block2_check(4, false, 64);
+}
+
+/**
+ * @brief Test a GET request for a block past the end of the content
+ */
+ZTEST(coap_blockwise, test_block2_past_end)
+{
+	request_send(COAP_METHOD_GET, COAP_OPTION_BLOCK2, BLOCK_VALUE(5, false, COAP_BLOCK_64),
+		     NULL, 0);
+	zassert_equal(coap_header_get_code(&response), COAP_RESPONSE_CODE_BAD_OPTION,
+		      "Unexpected response code 0x%02x", coap_header_get_code(&response));
+}
+
+/**
+ * @brief Test a PUT request without Block1 option
+ *
+ * @details The payload shall be written as the whole content.
+ */
+ZTEST(coap_blockwise, test_block1_single)
+{
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, -1, content, 40);
+
+	zassert_equal(coap_header_get_code(&response), COAP_RESPONSE_CODE_CHANGED,
+		      "Unexpected response code 0x%02x", coap_header_get_code(&response));
+	zassert_equal(received_len, 40);
+	zassert_true(received_last);
+	zassert_mem_equal(received, content, 40);
+}
+
+/**
+ * @brief Test writing a content block by block
+ *
+ * @details Intermediate blocks shall be answered with 2.31 Continue and the
+ * last one with 2.04 Changed, each echoing the Block1 option.
+ */
+ZTEST(coap_blockwise, test_block1_all)
+{
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(0, true, COAP_BLOCK_64),
+		     &content[0], 64);
+	block1_check(COAP_RESPONSE_CODE_CONTINUE, 0, true, 64);
+	zassert_false(received_last);
+
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(1, true, COAP_BLOCK_64),
+		     &content[64], 64);
+	block1_check(COAP_RESPONSE_CODE_CONTINUE, 1, true, 64);
+
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(2, false, COAP_BLOCK_64),
+		     &content[128], 22);
+	block1_check(COAP_RESPONSE_CODE_CHANGED, 2, false, 64);
+
+	zassert_true(received_last);
+	zassert_equal(received_len, 150);
+	zassert_mem_equal(received, content, 150);
+}
+
+/**
+ * @brief Test a client switching to a smaller block size during a transfer
+ *
+ * @details The blocks after the switch shall be written at the offset given
+ * by the smaller size.
+ */
+ZTEST(coap_blockwise, test_block1_late_negotiation)
+{
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(0, true, COAP_BLOCK_64),
+		     &content[0], 64);
+	block1_check(COAP_RESPONSE_CODE_CONTINUE, 0, true, 64);
+
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(2, true, COAP_BLOCK_32),
+		     &content[64], 32);
+	block1_check(COAP_RESPONSE_CODE_CONTINUE, 2, true, 32);
+
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(3, false, COAP_BLOCK_32),
+		     &content[96], 10);
+	block1_check(COAP_RESPONSE_CODE_CHANGED, 3, false, 32);
+
+	zassert_true(received_last);
+	zassert_equal(received_len, 106);
+	zassert_mem_equal(received, content, 106);
+}
+
+/**
+ * @brief Test an intermediate block shorter than the block size
+ */
+ZTEST(coap_blockwise, test_block1_incomplete)
+{
+	request_send(COAP_METHOD_PUT, COAP_OPTION_BLOCK1, BLOCK_VALUE(0, true, COAP_BLOCK_64),
+		     &content[0], 40);
+
+	zassert_equal(coap_header_get_code(&response), COAP_RESPONSE_CODE_INCOMPLETE,
+		      "Unexpected response code 0x%02x", coap_header_get_code(&response));
+	zassert_equal(received_len, 0, "Incomplete block written");
+}
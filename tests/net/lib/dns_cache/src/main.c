@@ -267,3 +267,96 @@ ZTEST(net_dns_cache_test, test_remove_null_parameters)
 	zassert_equal(-EINVAL, dns_cache_remove(&test_dns_cache, NULL),
 		      "NULL query should return error.");
 }
+
+ZTEST(net_dns_cache_test, test_remove_type)
+{
+	struct dns_addrinfo info_write_a = {.ai_family = AF_INET};
+	struct dns_addrinfo info_write_aaaa = {.ai_family = AF_INET6};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write_a,
+				 TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write_aaaa,
+				 TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_ok(dns_cache_remove_type(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+	zassert_equal(0, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(1,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+	zassert_equal(AF_INET6, info_read.ai_family);
+}
+
+ZTEST(net_dns_cache_test, test_negative_entry)
+{
+	struct dns_addrinfo info_read = {0};
+	const char *query = "nonexistent.example.com";
+
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, query, DNS_QUERY_TYPE_A,
+					  TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_equal(-ENOENT,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(0, info_read.ai_family);
+
+	/* Only the queried type is known not to exist */
+	zassert_equal(0,
+		      dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_AAAA, &info_read, 1));
+	zassert_false(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 + 1));
+	zassert_equal(0, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+}
+
+ZTEST(net_dns_cache_test, test_prefetch)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_false(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+
+	k_sleep(K_MSEC(TEST_DNS_CACHE_DEFAULT_TTL * 1000 *
+		       (100 - CONFIG_DNS_RESOLVER_CACHE_PREFETCH_PERCENT) / 100 + 1));
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_true(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+
+	/* Only one refresh per cached answer */
+	zassert_false(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+
+	/* The refreshed answer can be prefetched again */
+	zassert_ok(dns_cache_remove_type(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write, TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_false(dns_cache_prefetch_due(&test_dns_cache, query, DNS_QUERY_TYPE_A));
+}
+
+ZTEST(net_dns_cache_test, test_stats)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	struct dns_resolve_cache_stats before;
+	struct dns_resolve_cache_stats after;
+
+	dns_cache_stats_get(&test_dns_cache, &before);
+
+	zassert_ok(dns_cache_add(&test_dns_cache, "example.com", &info_write,
+				 TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_ok(dns_cache_add_negative(&test_dns_cache, "nonexistent.example.com",
+					  DNS_QUERY_TYPE_A, TEST_DNS_CACHE_DEFAULT_TTL));
+	zassert_equal(1, dns_cache_find(&test_dns_cache, "example.com", DNS_QUERY_TYPE_A,
+					&info_read, 1));
+	zassert_equal(-ENOENT, dns_cache_find(&test_dns_cache, "nonexistent.example.com",
+					      DNS_QUERY_TYPE_A, &info_read, 1));
+	zassert_equal(0, dns_cache_find(&test_dns_cache, "example2.com", DNS_QUERY_TYPE_A,
+					&info_read, 1));
+
+	for (size_t i = 0; i < TEST_DNS_CACHE_SIZE; i++) {
+		zassert_ok(dns_cache_add(&test_dns_cache, "example3.com", &info_write,
+					 TEST_DNS_CACHE_DEFAULT_TTL));
+	}
+
+	dns_cache_stats_get(&test_dns_cache, &after);
+	zassert_equal(after.hits - before.hits, 1);
+	zassert_equal(after.negative_hits - before.negative_hits, 1);
+	zassert_equal(after.misses - before.misses, 1);
+	zassert_equal(after.evictions - before.evictions, 2);
+}
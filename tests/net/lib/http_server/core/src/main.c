@@ -250,6 +250,31 @@ struct http_resource_detail_static static_resource_detail = {
 HTTP_RESOURCE_DEFINE(static_resource, test_http_service, "/",
 		     &static_resource_detail);
 
+#define TEST_STATIC_GZIP_PAYLOAD "gzipped"
+
+static const char static_gzip_payload[] = TEST_STATIC_GZIP_PAYLOAD;
+static const struct http_resource_static_variant static_variants[] = {
+	{
+		.compression = HTTP_GZIP,
+		.static_data = static_gzip_payload,
+		.static_data_len = sizeof(static_gzip_payload) - 1,
+	},
+};
+struct http_resource_detail_static static_variant_resource_detail = {
+	.common = {
+			.type = HTTP_RESOURCE_TYPE_STATIC,
+			.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		},
+	.static_data = static_resource_payload,
+	.static_data_len = sizeof(static_resource_payload) - 1,
+	.variants = static_variants,
+	.num_variants = ARRAY_SIZE(static_variants),
+	.etag = "v1",
+};
+
+HTTP_RESOURCE_DEFINE(static_variant_resource, test_http_service, "/variant",
+		     &static_variant_resource_detail);
+
 static uint8_t dynamic_payload[32];
 static size_t dynamic_payload_len = sizeof(dynamic_payload);
 static bool dynamic_error;
@@ -742,13 +767,52 @@ ZTEST(server_function_tests, test_http2_get_concurrent_streams)
 	/* Settings frame is expected twice (server settings + settings ACK) */
 	expect_http2_settings_frame(&offset, false);
 	expect_http2_settings_frame(&offset, true);
+	/* The static content is queued, and sent once all the received
+	 * frames are processed.
+	 */
 	expect_http2_headers_frame(&offset, TEST_STREAM_ID_1, HTTP2_FLAG_END_HEADERS, NULL, 0);
-	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD,
-				strlen(TEST_STATIC_PAYLOAD),
-				HTTP2_FLAG_END_STREAM);
 	expect_http2_headers_frame(&offset, TEST_STREAM_ID_2, HTTP2_FLAG_END_HEADERS, NULL, 0);
 	expect_http2_data_frame(&offset, TEST_STREAM_ID_2, NULL, 0,
 				HTTP2_FLAG_END_STREAM);
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD,
+				strlen(TEST_STATIC_PAYLOAD),
+				HTTP2_FLAG_END_STREAM);
+}
+
+ZTEST(server_function_tests, test_http2_static_get_flow_control)
+{
+	static const uint8_t request_get_static_small_window[] = {
+		TEST_HTTP2_MAGIC,
+		/* SETTINGS_INITIAL_WINDOW_SIZE of 5 bytes */
+		0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+		TEST_HTTP2_SETTINGS_ACK,
+		TEST_HTTP2_HEADERS_GET_ROOT_STREAM_1,
+	};
+	static const uint8_t window_update[] = {
+		0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, TEST_STREAM_ID_1,
+		0x00, 0x00, 0x00, 0x64,
+	};
+	size_t offset = 0;
+	int ret;
+
+	ret = zsock_send(client_fd, request_get_static_small_window,
+			 sizeof(request_get_static_small_window), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	expect_http2_settings_frame(&offset, false);
+	expect_http2_settings_frame(&offset, true);
+	expect_http2_headers_frame(&offset, TEST_STREAM_ID_1, HTTP2_FLAG_END_HEADERS, NULL, 0);
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD, 5, 0);
+
+	/* The rest is only sent once the window is extended */
+	ret = zsock_send(client_fd, window_update, sizeof(window_update), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	expect_http2_data_frame(&offset, TEST_STREAM_ID_1, TEST_STATIC_PAYLOAD + 5,
+				strlen(TEST_STATIC_PAYLOAD) - 5, HTTP2_FLAG_END_STREAM);
 }
 
 ZTEST(server_function_tests, test_http2_static_get)
@@ -835,6 +899,118 @@ ZTEST(server_function_tests, test_http1_static_get)
 			  "Received data doesn't match expected response");
 }
 
+static void test_http1_static_variant_common(const char *request, const char *expected_response)
+{
+	size_t offset = 0;
+	int ret;
+
+	ret = zsock_send(client_fd, request, strlen(request), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	test_read_data(&offset, strlen(expected_response));
+	zassert_mem_equal(buf, expected_response, strlen(expected_response),
+			  "Received data doesn't match expected response");
+}
+
+ZTEST(server_function_tests, test_http1_static_variant_get)
+{
+	static const char http1_request[] =
+		"GET /variant HTTP/1.1\r\n"
+		"Host: 127.0.0.1:8080\r\n"
+		"Accept-Encoding: deflate, gzip\r\n"
+		"\r\n";
+	static const char expected_response[] =
+		"HTTP/1.1 200 OK\r\n"
+		"Content-Type: text/html\r\n"
+		"Content-Length: 7\r\n"
+		"Content-Encoding: gzip\r\n"
+		"Vary: Accept-Encoding\r\n"
+		"ETag: \"v1-gzip\"\r\n"
+		"\r\n"
+		TEST_STATIC_GZIP_PAYLOAD;
+
+	test_http1_static_variant_common(http1_request, expected_response);
+}
+
+ZTEST(server_function_tests, test_http1_static_variant_identity_get)
+{
+	static const char http1_request[] =
+		"GET /variant HTTP/1.1\r\n"
+		"Host: 127.0.0.1:8080\r\n"
+		"Accept-Encoding: br\r\n"
+		"If-None-Match: \"v1-gzip\"\r\n"
+		"\r\n";
+	static const char expected_response[] =
+		"HTTP/1.1 200 OK\r\n"
+		"Content-Type: text/html\r\n"
+		"Content-Length: 13\r\n"
+		"Vary: Accept-Encoding\r\n"
+		"ETag: \"v1\"\r\n"
+		"\r\n"
+		TEST_STATIC_PAYLOAD;
+
+	test_http1_static_variant_common(http1_request, expected_response);
+}
+
+ZTEST(server_function_tests, test_http1_static_not_modified)
+{
+	static const char http1_request[] =
+		"GET /variant HTTP/1.1\r\n"
+		"Host: 127.0.0.1:8080\r\n"
+		"Accept-Encoding: gzip\r\n"
+		"If-None-Match: \"v0\", W/\"v1-gzip\"\r\n"
+		"\r\n";
+	static const char expected_response[] =
+		"HTTP/1.1 304 Not Modified\r\n"
+		"Vary: Accept-Encoding\r\n"
+		"ETag: \"v1-gzip\"\r\n"
+		"\r\n";
+
+	test_http1_static_variant_common(http1_request, expected_response);
+}
+
+#if defined(CONFIG_HTTP_SERVER_WORKER_POOL)
+ZTEST(server_function_tests, test_http1_worker_stats)
+{
+	static const char http1_request[] =
+		"GET /variant HTTP/1.1\r\n"
+		"Host: 127.0.0.1:8080\r\n"
+		"\r\n";
+	static const char expected_response[] =
+		"HTTP/1.1 200 OK\r\n"
+		"Content-Type: text/html\r\n"
+		"Content-Length: 13\r\n"
+		"Vary: Accept-Encoding\r\n"
+		"ETag: \"v1\"\r\n"
+		"\r\n"
+		TEST_STATIC_PAYLOAD;
+	struct http_server_worker_stats before = {0};
+	struct http_server_worker_stats after;
+	uint32_t dispatched = 0;
+
+	for (int i = 0; i < CONFIG_HTTP_SERVER_WORKER_COUNT; i++) {
+		zassert_ok(http_server_worker_stats_get(i, &after));
+		before.dispatched += after.dispatched;
+	}
+
+	test_http1_static_variant_common(http1_request, expected_response);
+
+	for (int i = 0; i < CONFIG_HTTP_SERVER_WORKER_COUNT; i++) {
+		zassert_ok(http_server_worker_stats_get(i, &after));
+		zassert_equal(after.queued, 0, "Worker %d has queued clients", i);
+		zassert_true(after.max_queued >= 1 || after.dispatched == 0,
+			     "Worker %d max queue depth not recorded", i);
+		dispatched += after.dispatched;
+	}
+
+	zassert_true(dispatched > before.dispatched, "Request not handled by a worker");
+	zassert_equal(http_server_worker_stats_get(CONFIG_HTTP_SERVER_WORKER_COUNT, &after),
+		      -EINVAL);
+}
+#endif
+
 /* Common code to verify POST/PUT/PATCH */
 static void common_verify_http2_dynamic_post_request(const uint8_t *request,
 						     size_t request_len)
@@ -497,6 +497,26 @@ ZTEST(lwm2m_registry, test_next_engine_obj_inst)
 	zassert_is_null(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)));
 }
 
+ZTEST(lwm2m_registry, test_next_engine_obj_inst_unordered)
+{
+	/* Instances created out of order are still walked in ID order */
+	zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, 2)), 0);
+	zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, 0)), 0);
+	zassert_equal(lwm2m_create_object_inst(&LWM2M_OBJ(3303, 1)), 0);
+
+	zassert_equal(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 1)),
+		      next_engine_obj_inst(3303, 0));
+	zassert_equal(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 2)),
+		      next_engine_obj_inst(3303, 1));
+	zassert_is_null(next_engine_obj_inst(3303, 2));
+	zassert_equal(lwm2m_engine_get_obj_inst(&LWM2M_OBJ(3303, 0)),
+		      next_engine_obj_inst(3303, -1));
+
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 0)), 0);
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 1)), 0);
+	zassert_equal(lwm2m_delete_object_inst(&LWM2M_OBJ(3303, 2)), 0);
+}
+
 ZTEST(lwm2m_registry, test_null_strings)
 {
 	int ret;
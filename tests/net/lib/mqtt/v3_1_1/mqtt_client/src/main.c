@@ -757,6 +757,47 @@ ZTEST(mqtt_client, test_mqtt_publish_qos1)
 	test_disconnect();
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_BATCH)
+ZTEST(mqtt_client, test_mqtt_publish_batch)
+{
+	int ret;
+	struct mqtt_publish_param param = { 0 };
+	struct zsock_pollfd fds[1];
+
+	test_ctx.payload = payload_short;
+
+	test_connect();
+
+	param.message.topic.qos = MQTT_QOS_0_AT_MOST_ONCE;
+	param.message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
+	param.message.topic.topic.size =
+			strlen(param.message.topic.topic.utf8);
+	param.message.payload.data = (uint8_t *)test_ctx.payload;
+	param.message.payload.len = strlen(test_ctx.payload);
+
+	for (int i = 0; i < 2; i++) {
+		ret = mqtt_publish_queue(&client_ctx, &param);
+		zassert_ok(ret, "MQTT client failed to queue publish (%d)", ret);
+	}
+
+	/* Nothing is sent before the batch is flushed. */
+	fds[0].fd = c_sock;
+	fds[0].events = ZSOCK_POLLIN;
+	zassert_equal(zsock_poll(fds, ARRAY_SIZE(fds), 10), 0,
+		      "Queued messages sent early");
+	zassert_true(mqtt_keepalive_time_left(&client_ctx) <=
+		     CONFIG_MQTT_PUBLISH_BATCH_FLUSH_TIMEOUT,
+		     "Flush timeout not accounted for");
+
+	ret = mqtt_flush(&client_ctx);
+	zassert_ok(ret, "MQTT client failed to flush (%d)", ret);
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+	broker_process(MQTT_PKT_TYPE_PUBLISH);
+
+	test_disconnect();
+}
+#endif
+
 ZTEST(mqtt_client, test_mqtt_publish_qos2)
 {
 	test_ctx.payload = payload_short;
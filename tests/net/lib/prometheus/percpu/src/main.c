@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/stats/stats.h>
+
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/net/prometheus/formatter.h>
+#include <zephyr/net/prometheus/percpu.h>
+#include <zephyr/net/prometheus/stats.h>
+
+#define MAX_BUFFER_SIZE 1024
+
+static const uint32_t test_bounds[] = { 10, 100 };
+
+PROMETHEUS_PERCPU_COUNTER_DEFINE(test_percpu_counter, "Test per-CPU counter",
+				 ({ .key = "test", .value = "counter" }), NULL);
+PROMETHEUS_PERCPU_HISTOGRAM_DEFINE(test_percpu_histogram, "Test per-CPU histogram",
+				   ({ .key = "test", .value = "histogram" }), NULL, test_bounds);
+
+STATS_SECT_START(test_stats)
+STATS_SECT_ENTRY32(events)
+STATS_SECT_END;
+
+STATS_NAME_START(test_stats)
+STATS_NAME(test_stats, events)
+STATS_NAME_END(test_stats);
+
+static STATS_SECT_DECL(test_stats) test_stats;
+
+PROMETHEUS_COLLECTOR_DEFINE(test_collector, prometheus_stats_scrape);
+
+PROMETHEUS_STATS_COUNTER_DEFINE(test_stats_counter, "Test stats counter",
+				({ .key = "test", .value = "stats" }), &test_collector,
+				"test_stats", "events");
+PROMETHEUS_STATS_COUNTER_DEFINE(test_stats_missing, "Test missing stats counter",
+				({ .key = "test", .value = "stats" }), &test_collector,
+				"test_stats", "missing");
+
+static char formatted[MAX_BUFFER_SIZE];
+
+static void scrape(void)
+{
+	memset(formatted, 0, sizeof(formatted));
+	zassert_ok(prometheus_format_exposition(&test_collector, formatted, sizeof(formatted)),
+		   "Error formatting exposition data");
+}
+
+/**
+ * @brief Test the per-CPU counter
+ *
+ * @details The counter value shall only be updated when it is scraped, and
+ * keep the increments made before each scrape.
+ */
+ZTEST(test_percpu, test_percpu_counter)
+{
+	char exposed[64];
+	uint64_t value;
+
+	scrape();
+	value = test_percpu_counter.counter.value;
+
+	prometheus_percpu_counter_add(&test_percpu_counter, 3);
+	prometheus_percpu_counter_inc(&test_percpu_counter);
+
+	zassert_equal(test_percpu_counter.counter.value, value, "Counter updated before a scrape");
+
+	scrape();
+	zassert_equal(test_percpu_counter.counter.value, value + 4, "Increments lost");
+
+	snprintf(exposed, sizeof(exposed), "test_percpu_counter{test=\"counter\"} %llu\n",
+		 (unsigned long long)(value + 4));
+	zassert_not_null(strstr(formatted, exposed), "Counter not exposed:\n%s", formatted);
+
+	prometheus_percpu_counter_inc(&test_percpu_counter);
+
+	scrape();
+	zassert_equal(test_percpu_counter.counter.value, value + 5, "Increment lost");
+}
+
+/**
+ * @brief Test the per-CPU counter wrapping around
+ *
+ * @details A slot wrapping around between two scrapes shall still add its
+ * increments to the counter.
+ */
+ZTEST(test_percpu, test_percpu_counter_wrap)
+{
+	uint64_t value;
+
+	scrape();
+	value = test_percpu_counter.counter.value;
+
+	prometheus_percpu_counter_add(&test_percpu_counter, ULONG_MAX - 1);
+	scrape();
+	prometheus_percpu_counter_add(&test_percpu_counter, 3);
+	scrape();
+
+	zassert_equal(test_percpu_counter.counter.value - value, (uint64_t)ULONG_MAX + 2,
+		      "Increments lost on wrap around");
+}
+
+/**
+ * @brief Test the per-CPU histogram
+ *
+ * @details The bucket counts shall be cumulative once scraped, and values
+ * above the last bound shall only be in the count and the sum.
+ */
+ZTEST(test_percpu, test_percpu_histogram)
+{
+	const struct prometheus_histogram *histogram = &test_percpu_histogram.histogram;
+
+	prometheus_percpu_histogram_observe(&test_percpu_histogram, 5);
+	prometheus_percpu_histogram_observe(&test_percpu_histogram, 10);
+	prometheus_percpu_histogram_observe(&test_percpu_histogram, 50);
+	prometheus_percpu_histogram_observe(&test_percpu_histogram, 500);
+
+	zassert_equal(histogram->count, 0, "Histogram updated before a scrape");
+
+	scrape();
+
+	zassert_equal(histogram->buckets[0].upper_bound, 10.0);
+	zassert_equal(histogram->buckets[0].count, 2, "Bucket 10 is not 2");
+	zassert_equal(histogram->buckets[1].upper_bound, 100.0);
+	zassert_equal(histogram->buckets[1].count, 3, "Bucket 100 is not 3");
+	zassert_equal(histogram->count, 4, "Histogram count is not 4");
+	zassert_equal(histogram->sum, 565.0, "Histogram sum is not 565");
+}
+
+/**
+ * @brief Test the statistics export
+ *
+ * @details A counter shall follow its statistics entry when scraped, and a
+ * counter for an entry that does not exist shall be skipped.
+ */
+ZTEST(test_percpu, test_stats_counter)
+{
+	STATS_INCN(test_stats, events, 7);
+
+	scrape();
+	zassert_equal(test_stats_counter.value, 7, "Counter value is not 7");
+	zassert_not_null(strstr(formatted, "test_stats_counter{test=\"stats\"} 7\n"),
+			 "Counter not exposed:\n%s", formatted);
+	zassert_is_null(strstr(formatted, "test_stats_missing"),
+			"Missing entry exposed:\n%s", formatted);
+
+	STATS_INC(test_stats, events);
+
+	scrape();
+	zassert_equal(test_stats_counter.value, 8, "Counter value is not 8");
+}
+
+static void *test_percpu_setup(void)
+{
+	zassert_ok(STATS_INIT_AND_REG(test_stats, STATS_SIZE_32, "test_stats"));
+
+	prometheus_collector_register_metric(&test_collector, &test_percpu_counter.counter.base);
+	prometheus_collector_register_metric(&test_collector,
+					     &test_percpu_histogram.histogram.base);
+	prometheus_collector_register_metric(&test_collector, &test_stats_counter.base);
+	prometheus_collector_register_metric(&test_collector, &test_stats_missing.base);
+
+	return NULL;
+}
+
+ZTEST_SUITE(test_percpu, NULL, test_percpu_setup, NULL, NULL, NULL);
@@ -1291,4 +1291,47 @@ ZTEST(net_pkt_test_suite, test_net_pkt_shallow_clone_append_buf_2)
 	test_net_pkt_shallow_clone_append_buf(2);
 }
 
+ZTEST(net_pkt_test_suite, test_net_pkt_iface_quota)
+{
+#if defined(CONFIG_NET_PKT_IFACE_QUOTA)
+	struct net_pkt *pkts[3];
+	struct net_pkt *pkt;
+
+	zassert_equal(net_if_pkt_quota_set(eth_if, CONFIG_NET_PKT_RX_COUNT + 1, 0),
+		      -EINVAL, "Quota over the pool size accepted");
+	zassert_ok(net_if_pkt_quota_set(eth_if, ARRAY_SIZE(pkts), 1));
+
+	for (int i = 0; i < ARRAY_SIZE(pkts); i++) {
+		pkts[i] = net_pkt_rx_alloc_on_iface(eth_if, K_NO_WAIT);
+		zassert_not_null(pkts[i], "RX packet %d within the quota refused", i);
+	}
+
+	zassert_is_null(net_pkt_rx_alloc_on_iface(eth_if, K_FOREVER),
+			"RX packet over the quota allocated");
+
+	/* The quota is per pool, RX packets do not take from the TX one */
+	pkt = net_pkt_alloc_on_iface(eth_if, K_NO_WAIT);
+	zassert_not_null(pkt, "TX packet within the quota refused");
+	zassert_is_null(net_pkt_alloc_on_iface(eth_if, K_NO_WAIT),
+			"TX packet over the quota allocated");
+	net_pkt_unref(pkt);
+
+	/* Freeing a packet gives its slot back to the interface */
+	net_pkt_unref(pkts[0]);
+	pkts[0] = net_pkt_rx_alloc_on_iface(eth_if, K_NO_WAIT);
+	zassert_not_null(pkts[0], "Freed RX slot not given back");
+
+	for (int i = 0; i < ARRAY_SIZE(pkts); i++) {
+		net_pkt_unref(pkts[i]);
+	}
+
+	zassert_equal(atomic_get(&eth_if->rx_pkts), 0, "RX packets still charged");
+	zassert_equal(atomic_get(&eth_if->tx_pkts), 0, "TX packets still charged");
+
+	zassert_ok(net_if_pkt_quota_set(eth_if, 0, 0));
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(net_pkt_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -544,6 +544,52 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct in6_addr other_addr = dest_addr;
+	struct net_route_entry *wide, *narrow, *host, *entry;
+
+	/* Outside of the /64 prefix of dest_addr, inside its /32 one */
+	other_addr.s6_addr[7] = 0x1;
+
+	wide = net_route_add(my_iface, &dest_addr, 32, &peer_addr,
+			     NET_IPV6_ND_INFINITE_LIFETIME,
+			     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(wide, "Route /32 add failed");
+
+	narrow = net_route_add(my_iface, &dest_addr, 64, &peer_addr_alt,
+			       NET_IPV6_ND_INFINITE_LIFETIME,
+			       NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(narrow, "Route /64 add failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(entry, narrow, "Longest prefix not selected");
+
+	entry = net_route_lookup(my_iface, &other_addr);
+	zassert_equal_ptr(entry, wide, "Shorter prefix not selected");
+
+	host = net_route_add(my_iface, &dest_addr, 128, &peer_addr,
+			     NET_IPV6_ND_INFINITE_LIFETIME,
+			     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(host, "Route /128 add failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(entry, host, "Host route not selected");
+
+	entry = net_route_lookup(NULL, &other_addr);
+	zassert_equal_ptr(entry, wide, "Lookup on any interface failed");
+
+	zassert_ok(net_route_del(host), "Route /128 del failed");
+	zassert_ok(net_route_del(narrow), "Route /64 del failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(entry, wide, "Deleted route still selected");
+
+	zassert_ok(net_route_del(wide), "Route /32 del failed");
+
+	entry = net_route_lookup(my_iface, &dest_addr);
+	zassert_is_null(entry, "Route lookup succeeded after delete");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +612,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
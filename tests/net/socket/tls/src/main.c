@@ -1305,6 +1305,51 @@ ZTEST(net_socket_tls, test_send_block)
 	k_sleep(TCP_TEARDOWN_TIMEOUT);
 }
 
+ZTEST(net_socket_tls, test_send_cork)
+{
+	int ret;
+	int optval;
+	socklen_t optlen = sizeof(optval);
+	uint8_t rx_buf[2 * (sizeof(TEST_STR_SMALL) - 1)] = { 0 };
+
+	test_prepare_tls_connection(AF_INET6);
+
+	optval = 1;
+	ret = zsock_setsockopt(c_sock, SOL_TLS, TLS_CORK, &optval, sizeof(optval));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	ret = zsock_getsockopt(c_sock, SOL_TLS, TLS_CORK, &optval, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optval, 1, "Socket should be corked");
+
+	ret = zsock_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "send() failed");
+	ret = zsock_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "send() failed");
+
+	/* Nothing is sent while corked */
+	k_sleep(K_MSEC(10));
+	ret = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(ret, -1, "recv() should've failed");
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	/* Uncorking flushes both writes in a single record */
+	optval = 0;
+	ret = zsock_setsockopt(c_sock, SOL_TLS, TLS_CORK, &optval, sizeof(optval));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	ret = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_WAITALL);
+	zassert_equal(ret, sizeof(rx_buf), "recv() failed");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL),
+			  "Invalid data received");
+	zassert_mem_equal(rx_buf + strlen(TEST_STR_SMALL), TEST_STR_SMALL,
+			  strlen(TEST_STR_SMALL), "Invalid data received");
+
+	test_sockets_close();
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
 ZTEST(net_socket_tls, test_send_on_close)
 {
 	uint8_t rx_buf[sizeof(TEST_STR_SMALL) - 1] = { 0 };
@@ -3112,6 +3112,158 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+static void zerocopy_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(zerocopy_pool, 2, 0, 0, zerocopy_destroy);
+
+static K_SEM_DEFINE(zerocopy_done, 0, 2);
+
+static void zerocopy_destroy(struct net_buf *buf)
+{
+	net_buf_destroy(buf);
+	k_sem_give(&zerocopy_done);
+}
+#endif
+
+ZTEST(net_socket_udp, test_41_v4_sendmsg_zerocopy)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	static char part1[] = TEST_STR_SMALL;
+	static char part2[] = TEST_STR2;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct net_buf *head, *frag;
+	struct iovec io_vector[1];
+	struct msghdr msg = { 0 };
+	int client_sock;
+	int server_sock;
+	ssize_t ret;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	zassert_ok(zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			      sizeof(server_addr)), "bind failed");
+
+	head = net_buf_alloc_with_data(&zerocopy_pool, part1, STRLEN(part1), K_NO_WAIT);
+	zassert_not_null(head);
+	frag = net_buf_alloc_with_data(&zerocopy_pool, part2, STRLEN(part2), K_NO_WAIT);
+	zassert_not_null(frag);
+	net_buf_frag_add(head, frag);
+
+	io_vector[0].iov_base = head;
+	io_vector[0].iov_len = net_buf_frags_len(head);
+
+	msg.msg_name = &server_addr;
+	msg.msg_namelen = sizeof(server_addr);
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 1;
+
+	ret = zsock_sendmsg(client_sock, &msg, ZSOCK_MSG_ZEROCOPY);
+	zassert_equal(ret, STRLEN(part1) + STRLEN(part2), "sendmsg failed (%d)", -errno);
+
+	/* The data went out of the application buffers */
+	clear_buf(rx_buf);
+	ret = zsock_recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(ret, STRLEN(part1) + STRLEN(part2), "recv failed");
+	zassert_mem_equal(rx_buf, part1, STRLEN(part1), "wrong data");
+	zassert_mem_equal(rx_buf + STRLEN(part1), part2, STRLEN(part2), "wrong data");
+
+	/* Both fragments go back to the pool once the stack is done too */
+	net_buf_unref(head);
+	zassert_ok(k_sem_take(&zerocopy_done, K_MSEC(100)));
+	zassert_ok(k_sem_take(&zerocopy_done, K_MSEC(100)));
+
+	/* A chain shorter than the iovec claims is rejected */
+	head = net_buf_alloc_with_data(&zerocopy_pool, part1, STRLEN(part1), K_NO_WAIT);
+	zassert_not_null(head);
+	io_vector[0].iov_base = head;
+	io_vector[0].iov_len = STRLEN(part1) + 1;
+
+	ret = zsock_sendmsg(client_sock, &msg, ZSOCK_MSG_ZEROCOPY);
+	zassert_equal(ret, -1);
+	zassert_equal(errno, EINVAL);
+
+	net_buf_unref(head);
+	zassert_ok(k_sem_take(&zerocopy_done, K_MSEC(100)));
+
+	(void)zsock_close(client_sock);
+	(void)zsock_close(server_sock);
+#else
+	ztest_test_skip();
+#endif
+}
+
+#define MMSG_COUNT 3
+
+ZTEST_USER(net_socket_udp, test_42_v4_sendmmsg_recvmmsg)
+{
+	static const char * const payloads[MMSG_COUNT] = { "one", "two", "three" };
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct mmsghdr msgs[MMSG_COUNT + 1];
+	struct iovec io_vector[MMSG_COUNT + 1];
+	char bufs[MMSG_COUNT + 1][8];
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		io_vector[i].iov_base = (void *)payloads[i];
+		io_vector[i].iov_len = strlen(payloads[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", -errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(payloads[i]), "wrong length sent");
+	}
+
+	k_msleep(100);
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < MMSG_COUNT + 1; i++) {
+		io_vector[i].iov_base = bufs[i];
+		io_vector[i].iov_len = sizeof(bufs[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/* Asking for one more than was sent returns what is queued */
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT + 1, ZSOCK_MSG_WAITFORONE);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", -errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(payloads[i]), "wrong length received");
+		zassert_mem_equal(bufs[i], payloads[i], strlen(payloads[i]), "wrong data");
+	}
+
+	/* Nothing queued, so the first message fails */
+	rv = zsock_recvmmsg(server_sock, msgs, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg should fail");
+	zassert_equal(errno, EAGAIN, "unexpected errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
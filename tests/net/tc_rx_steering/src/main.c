@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define FLOWS         8
+#define PKTS_PER_FLOW 4
+#define FLOW_PORT     1000
+#define TEST_PORT     4242
+
+static struct in6_addr my_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				       0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+static struct in6_addr peer_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					 0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static uint8_t my_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+static uint8_t peer_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+static struct net_if *eth_iface;
+static struct net_context *udp_ctx;
+
+static K_SEM_DEFINE(recv_sem, 0, FLOWS * PKTS_PER_FLOW);
+static struct k_spinlock recv_lock;
+static k_tid_t flow_thread[FLOWS];
+static uint8_t flow_next_seq[FLOWS];
+static unsigned int wrong_thread;
+static unsigned int out_of_order;
+
+static void fake_dev_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, my_mac, sizeof(my_mac), NET_LINK_ETHERNET);
+
+	eth_iface = iface;
+}
+
+static enum ethernet_hw_caps fake_dev_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	/* The test frames carry no checksums */
+	return ETHERNET_HW_RX_CHKSUM_OFFLOAD;
+}
+
+static int fake_dev_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static const struct ethernet_api fake_dev_api = {
+	.iface_api.init = fake_dev_iface_init,
+	.get_capabilities = fake_dev_get_capabilities,
+	.send = fake_dev_send,
+};
+
+ETH_NET_DEVICE_INIT(fake_dev, "fake_dev", NULL, NULL, NULL, NULL,
+		    CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &fake_dev_api, NET_ETH_MTU);
+
+/* Hand an Ethernet frame of a UDP flow to the stack, as a driver would */
+static void frame_recv(uint8_t flow, uint8_t seq)
+{
+	struct {
+		struct net_eth_hdr eth;
+		struct net_ipv6_hdr ip;
+		struct net_udp_hdr udp;
+		uint8_t payload[2];
+	} __packed frame = { 0 };
+	struct net_pkt *pkt;
+
+	memcpy(frame.eth.dst.addr, my_mac, sizeof(my_mac));
+	memcpy(frame.eth.src.addr, peer_mac, sizeof(peer_mac));
+	frame.eth.type = htons(NET_ETH_PTYPE_IPV6);
+
+	frame.ip.vtc = 0x60;
+	frame.ip.len = htons(sizeof(frame.udp) + sizeof(frame.payload));
+	frame.ip.nexthdr = IPPROTO_UDP;
+	frame.ip.hop_limit = 64;
+	net_ipv6_addr_copy_raw(frame.ip.src, (uint8_t *)&peer_addr);
+	net_ipv6_addr_copy_raw(frame.ip.dst, (uint8_t *)&my_addr);
+
+	frame.udp.src_port = htons(FLOW_PORT + flow);
+	frame.udp.dst_port = htons(TEST_PORT);
+	frame.udp.len = htons(sizeof(frame.udp) + sizeof(frame.payload));
+
+	frame.payload[0] = flow;
+	frame.payload[1] = seq;
+
+	pkt = net_pkt_rx_alloc_with_buffer(eth_iface, sizeof(frame), AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate a packet");
+	zassert_ok(net_pkt_write(pkt, &frame, sizeof(frame)));
+
+	zassert_ok(net_recv_data(eth_iface, pkt), "Frame not queued");
+}
+
+static void recv_cb(struct net_context *context, struct net_pkt *pkt,
+		    union net_ip_header *ip_hdr, union net_proto_header *proto_hdr,
+		    int status, void *user_data)
+{
+	k_spinlock_key_t key;
+	uint8_t flow = 0;
+	uint8_t seq = 0;
+
+	ARG_UNUSED(context);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(status);
+	ARG_UNUSED(user_data);
+
+	net_pkt_cursor_init(pkt);
+	(void)net_pkt_skip(pkt, sizeof(struct net_ipv6_hdr) + sizeof(struct net_udp_hdr));
+	(void)net_pkt_read_u8(pkt, &flow);
+	(void)net_pkt_read_u8(pkt, &seq);
+
+	key = k_spin_lock(&recv_lock);
+
+	if (flow < FLOWS) {
+		if (flow_thread[flow] == NULL) {
+			flow_thread[flow] = k_current_get();
+		} else if (flow_thread[flow] != k_current_get()) {
+			wrong_thread++;
+		}
+
+		if (seq != flow_next_seq[flow]) {
+			out_of_order++;
+		}
+
+		flow_next_seq[flow] = seq + 1;
+	}
+
+	k_spin_unlock(&recv_lock, key);
+
+	net_pkt_unref(pkt);
+	k_sem_give(&recv_sem);
+}
+
+static void *steering_setup(void)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(TEST_PORT),
+	};
+	struct net_if_addr *ifaddr;
+
+	zassert_not_null(eth_iface, "No Ethernet interface");
+
+	ifaddr = net_if_ipv6_addr_add(eth_iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add the IPv6 address");
+	ifaddr->addr_state = NET_ADDR_PREFERRED;
+
+	zassert_ok(net_context_get(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, &udp_ctx));
+	zassert_ok(net_context_bind(udp_ctx, (struct sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(net_context_recv(udp_ctx, recv_cb, K_NO_WAIT, NULL));
+
+	return NULL;
+}
+
+ZTEST_SUITE(tc_rx_steering, NULL, steering_setup, NULL, NULL, NULL);
+
+/**
+ * @brief Test steering the flows received by an Ethernet interface
+ *
+ * @details The packets of a flow shall all be handled by the same RX thread
+ * and in order, and the flows shall be spread over more than one thread.
+ */
+ZTEST(tc_rx_steering, test_flows_steered)
+{
+	k_tid_t threads[FLOWS];
+	size_t thread_count = 0;
+
+	for (uint8_t seq = 0; seq < PKTS_PER_FLOW; seq++) {
+		for (uint8_t flow = 0; flow < FLOWS; flow++) {
+			frame_recv(flow, seq);
+		}
+	}
+
+	for (int i = 0; i < FLOWS * PKTS_PER_FLOW; i++) {
+		zassert_ok(k_sem_take(&recv_sem, K_SECONDS(1)), "Only %d packets received", i);
+	}
+
+	zassert_equal(wrong_thread, 0, "%u packets handled by another thread than their flow",
+		      wrong_thread);
+	zassert_equal(out_of_order, 0, "%u packets out of order", out_of_order);
+
+	for (int flow = 0; flow < FLOWS; flow++) {
+		size_t i;
+
+		zassert_equal(flow_next_seq[flow], PKTS_PER_FLOW, "Flow %d incomplete", flow);
+		zassert_not_equal(flow_thread[flow], k_current_get(), "Flow %d not queued", flow);
+
+		for (i = 0; i < thread_count; i++) {
+			if (threads[i] == flow_thread[flow]) {
+				break;
+			}
+		}
+
+		if (i == thread_count) {
+			threads[thread_count++] = flow_thread[flow];
+		}
+	}
+
+	zassert_true(thread_count > 1, "All %d flows steered to one RX thread", FLOWS);
+}
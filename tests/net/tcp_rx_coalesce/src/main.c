@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define TEST_PORT 4242
+#define PEER_PORT 5555
+#define PEER_ISN  1000
+#define SEG_LEN   100
+#define MAX_SEGS  8
+
+#define TCP_PSH 0x08
+#define TCP_ACK 0x10
+#define TCP_SYN 0x02
+
+static struct in6_addr my_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				       0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+static struct in6_addr peer_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					 0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static uint8_t my_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+static uint8_t peer_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+static struct net_if *eth_iface;
+static struct net_context *listen_ctx;
+static struct net_context *accepted_ctx;
+
+/* Sequence number of the next segment sent by the peer and by us */
+static uint32_t peer_seq = PEER_ISN;
+static uint32_t my_seq;
+
+static K_SEM_DEFINE(accept_sem, 0, 1);
+static K_SEM_DEFINE(recv_sem, 0, MAX_SEGS);
+static K_SEM_DEFINE(sent_sem, 0, K_SEM_MAX_LIMIT);
+
+static struct k_spinlock lock;
+
+/* Last segment sent by the stack */
+static uint8_t sent_flags;
+static uint32_t sent_seq;
+static uint32_t sent_ack;
+
+/* Length of the data handed to each receive callback */
+static size_t recv_len[MAX_SEGS];
+static size_t recv_count;
+static uint32_t recv_offset;
+static unsigned int bad_data;
+
+static void fake_dev_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, my_mac, sizeof(my_mac), NET_LINK_ETHERNET);
+
+	eth_iface = iface;
+}
+
+static enum ethernet_hw_caps fake_dev_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	/* The test frames carry no checksums */
+	return ETHERNET_HW_RX_CHKSUM_OFFLOAD;
+}
+
+/* Record the TCP header of the segments sent by the stack */
+static int fake_dev_send(const struct device *dev, struct net_pkt *pkt)
+{
+	struct net_eth_hdr eth;
+	struct net_ipv6_hdr ip;
+	struct net_tcp_hdr tcp;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(dev);
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_read(pkt, &eth, sizeof(eth)) != 0 ||
+	    eth.type != htons(NET_ETH_PTYPE_IPV6) ||
+	    net_pkt_read(pkt, &ip, sizeof(ip)) != 0 || ip.nexthdr != IPPROTO_TCP ||
+	    net_pkt_read(pkt, &tcp, sizeof(tcp)) != 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	sent_flags = tcp.flags;
+	sent_seq = sys_get_be32(tcp.seq);
+	sent_ack = sys_get_be32(tcp.ack);
+	k_spin_unlock(&lock, key);
+
+	k_sem_give(&sent_sem);
+
+	return 0;
+}
+
+static const struct ethernet_api fake_dev_api = {
+	.iface_api.init = fake_dev_iface_init,
+	.get_capabilities = fake_dev_get_capabilities,
+	.send = fake_dev_send,
+};
+
+ETH_NET_DEVICE_INIT(fake_dev, "fake_dev", NULL, NULL, NULL, NULL,
+		    CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &fake_dev_api, NET_ETH_MTU);
+
+/* Hand an Ethernet frame with a TCP segment of the peer to the stack */
+static void frame_recv(uint8_t flags, size_t len)
+{
+	struct {
+		struct net_eth_hdr eth;
+		struct net_ipv6_hdr ip;
+		struct net_tcp_hdr tcp;
+		uint8_t payload[SEG_LEN];
+	} __packed frame = { 0 };
+	size_t frame_len = sizeof(frame) - sizeof(frame.payload) + len;
+	struct net_pkt *pkt;
+
+	zassert_true(len <= sizeof(frame.payload), "Segment too long");
+
+	memcpy(frame.eth.dst.addr, my_mac, sizeof(my_mac));
+	memcpy(frame.eth.src.addr, peer_mac, sizeof(peer_mac));
+	frame.eth.type = htons(NET_ETH_PTYPE_IPV6);
+
+	frame.ip.vtc = 0x60;
+	frame.ip.len = htons(sizeof(frame.tcp) + len);
+	frame.ip.nexthdr = IPPROTO_TCP;
+	frame.ip.hop_limit = 64;
+	net_ipv6_addr_copy_raw(frame.ip.src, (uint8_t *)&peer_addr);
+	net_ipv6_addr_copy_raw(frame.ip.dst, (uint8_t *)&my_addr);
+
+	frame.tcp.src_port = htons(PEER_PORT);
+	frame.tcp.dst_port = htons(TEST_PORT);
+	sys_put_be32(peer_seq, frame.tcp.seq);
+	sys_put_be32((flags & TCP_ACK) != 0 ? my_seq : 0, frame.tcp.ack);
+	frame.tcp.offset = (sizeof(frame.tcp) / 4) << 4;
+	frame.tcp.flags = flags;
+	sys_put_be16(8192, frame.tcp.wnd);
+
+	/* The stream byte at offset n is n modulo 256 */
+	for (size_t i = 0; i < len; i++) {
+		frame.payload[i] = peer_seq - (PEER_ISN + 1) + i;
+	}
+
+	peer_seq += (flags & TCP_SYN) != 0 ? 1 : len;
+
+	pkt = net_pkt_rx_alloc_with_buffer(eth_iface, frame_len, AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate a packet");
+	zassert_ok(net_pkt_write(pkt, &frame, frame_len));
+
+	zassert_ok(net_recv_data(eth_iface, pkt), "Frame not queued");
+}
+
+/* Wait for the stack to send a segment with the given flags and ack */
+static void wait_sent(uint8_t flags, uint32_t ack)
+{
+	k_spinlock_key_t key;
+	bool found;
+
+	do {
+		zassert_ok(k_sem_take(&sent_sem, K_SECONDS(1)),
+			   "No segment with flags 0x%02x ack %u sent", flags, ack);
+
+		key = k_spin_lock(&lock);
+		found = sent_flags == flags && sent_ack == ack;
+		k_spin_unlock(&lock, key);
+	} while (!found);
+}
+
+static void recv_cb(struct net_context *context, struct net_pkt *pkt,
+		    union net_ip_header *ip_hdr, union net_proto_header *proto_hdr,
+		    int status, void *user_data)
+{
+	k_spinlock_key_t key;
+	size_t len;
+
+	ARG_UNUSED(context);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(status);
+	ARG_UNUSED(user_data);
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	len = net_pkt_remaining_data(pkt);
+
+	key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < len; i++) {
+		uint8_t byte = 0;
+
+		(void)net_pkt_read_u8(pkt, &byte);
+		if (byte != (uint8_t)(recv_offset + i)) {
+			bad_data++;
+		}
+	}
+
+	recv_offset += len;
+
+	if (recv_count < ARRAY_SIZE(recv_len)) {
+		recv_len[recv_count] = len;
+	}
+
+	recv_count++;
+
+	k_spin_unlock(&lock, key);
+
+	net_pkt_unref(pkt);
+	k_sem_give(&recv_sem);
+}
+
+static void accept_cb(struct net_context *ctx, struct sockaddr *addr, socklen_t addrlen,
+		      int status, void *user_data)
+{
+	ARG_UNUSED(addr);
+	ARG_UNUSED(addrlen);
+	ARG_UNUSED(user_data);
+
+	zassert_ok(status, "Connection not accepted");
+
+	/* Ref the context on the test behalf */
+	net_context_ref(ctx);
+	accepted_ctx = ctx;
+
+	k_sem_give(&accept_sem);
+}
+
+static void *coalesce_setup(void)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(TEST_PORT),
+	};
+	struct net_if_addr *ifaddr;
+	k_spinlock_key_t key;
+
+	zassert_not_null(eth_iface, "No Ethernet interface");
+
+	ifaddr = net_if_ipv6_addr_add(eth_iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add the IPv6 address");
+	ifaddr->addr_state = NET_ADDR_PREFERRED;
+
+	zassert_ok(net_context_get(AF_INET6, SOCK_STREAM, IPPROTO_TCP, &listen_ctx));
+	zassert_ok(net_context_bind(listen_ctx, (struct sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(net_context_listen(listen_ctx, 1));
+	zassert_ok(net_context_accept(listen_ctx, accept_cb, K_NO_WAIT, NULL));
+
+	frame_recv(TCP_SYN, 0);
+	wait_sent(TCP_SYN | TCP_ACK, peer_seq);
+
+	key = k_spin_lock(&lock);
+	my_seq = sent_seq + 1;
+	k_spin_unlock(&lock, key);
+
+	frame_recv(TCP_ACK, 0);
+	zassert_ok(k_sem_take(&accept_sem, K_SECONDS(1)), "Connection not established");
+
+	zassert_ok(net_context_recv(accepted_ctx, recv_cb, K_NO_WAIT, NULL));
+
+	return NULL;
+}
+
+static void coalesce_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	recv_count = 0;
+	bad_data = 0;
+	k_sem_reset(&recv_sem);
+}
+
+ZTEST_SUITE(tcp_rx_coalesce, NULL, coalesce_setup, coalesce_before, NULL, NULL);
+
+/*
+ * Queue segments of the peer before the RX thread gets to run, the last one
+ * with the PSH flag, and check the data and the ACK they get.
+ */
+static void segments_recv(size_t segs, bool coalesce, size_t expected_count)
+{
+	if (coalesce) {
+		net_if_flag_set(eth_iface, NET_IF_TCP_RX_COALESCE);
+	} else {
+		net_if_flag_clear(eth_iface, NET_IF_TCP_RX_COALESCE);
+	}
+
+	/* The test thread is cooperative, so the frames are all queued
+	 * before the RX thread processes the first one.
+	 */
+	for (size_t i = 0; i < segs; i++) {
+		frame_recv(TCP_ACK | (i == segs - 1 ? TCP_PSH : 0), SEG_LEN);
+	}
+
+	for (size_t i = 0; i < expected_count; i++) {
+		zassert_ok(k_sem_take(&recv_sem, K_SECONDS(1)), "Only %zu batches received", i);
+	}
+
+	wait_sent(TCP_ACK, peer_seq);
+
+	zassert_equal(recv_count, expected_count, "Data received in %zu batches, expected %zu",
+		      recv_count, expected_count);
+	zassert_equal(bad_data, 0, "%u bytes of bad data received", bad_data);
+}
+
+/**
+ * @brief Test in-order segments of a flow handed to TCP as one packet
+ */
+ZTEST(tcp_rx_coalesce, test_coalesced)
+{
+	segments_recv(CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS, true, 1);
+
+	zassert_equal(recv_len[0], CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS * SEG_LEN,
+		      "Batch of %zu bytes", recv_len[0]);
+}
+
+/**
+ * @brief Test a batch closed when it reaches the segment limit
+ *
+ * @details The segments past the limit shall start a new batch.
+ */
+ZTEST(tcp_rx_coalesce, test_max_segs)
+{
+	segments_recv(CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS + 2, true, 2);
+
+	zassert_equal(recv_len[0], CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS * SEG_LEN,
+		      "First batch of %zu bytes", recv_len[0]);
+	zassert_equal(recv_len[1], 2 * SEG_LEN, "Second batch of %zu bytes", recv_len[1]);
+}
+
+/**
+ * @brief Test segments received on an interface without coalescing
+ */
+ZTEST(tcp_rx_coalesce, test_not_coalesced)
+{
+	segments_recv(CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS, false,
+		      CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS);
+
+	for (size_t i = 0; i < CONFIG_NET_TCP_RX_COALESCE_MAX_SEGS; i++) {
+		zassert_equal(recv_len[i], SEG_LEN, "Segment %zu of %zu bytes", i, recv_len[i]);
+	}
+}
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#define TEST_PORT 4242
+#define PEER_PORT 5555
+#define PEER_ISN  1000
+#define PEER_MSS  500
+#define PEER_WND  65535
+#define DATA_LEN  (8 * PEER_MSS)
+#define MAX_PKTS  16
+
+#define TCP_ACK 0x10
+#define TCP_SYN 0x02
+
+#define TCP_MSS_OPT 2
+
+#define HDRS_LEN (sizeof(struct net_eth_hdr) + sizeof(struct net_ipv6_hdr))
+
+static struct in6_addr my_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				       0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+static struct in6_addr peer_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					 0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static uint8_t my_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+static uint8_t peer_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+static struct net_if *eth_iface;
+static struct net_context *listen_ctx;
+static struct net_context *accepted_ctx;
+
+/* Sequence number of the next segment sent by the peer and by us */
+static uint32_t peer_seq = PEER_ISN;
+static uint32_t my_seq;
+
+static bool tso_supported;
+
+static K_SEM_DEFINE(accept_sem, 0, 1);
+static K_SEM_DEFINE(sent_sem, 0, K_SEM_MAX_LIMIT);
+
+static struct k_spinlock lock;
+
+/* Last segment sent by the stack */
+static uint8_t sent_flags;
+static uint32_t sent_seq;
+static uint32_t sent_ack;
+
+/* Data packets passed to the driver */
+static size_t data_len[MAX_PKTS];
+static uint16_t data_mss[MAX_PKTS];
+static size_t data_count;
+static size_t data_total;
+static unsigned int bad_data;
+static unsigned int bad_len;
+
+static uint8_t data[DATA_LEN];
+
+static void fake_dev_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, my_mac, sizeof(my_mac), NET_LINK_ETHERNET);
+
+	eth_iface = iface;
+}
+
+static enum ethernet_hw_caps fake_dev_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	/* The test frames carry no checksums */
+	return ETHERNET_HW_RX_CHKSUM_OFFLOAD | ETHERNET_HW_TX_CHKSUM_OFFLOAD |
+	       (tso_supported ? ETHERNET_HW_TSO : 0);
+}
+
+/* Record the data passed by the stack, before any hardware segmentation */
+static void data_record(struct net_pkt *pkt, const struct net_ipv6_hdr *ip,
+			const struct net_tcp_hdr *tcp)
+{
+	size_t tcp_len = (tcp->offset >> 4) * 4U;
+	size_t len = net_pkt_get_len(pkt) - HDRS_LEN - tcp_len;
+	size_t offset = sys_get_be32(tcp->seq) - my_seq;
+
+	if (ntohs(ip->len) != net_pkt_get_len(pkt) - HDRS_LEN) {
+		bad_len++;
+	}
+
+	(void)net_pkt_skip(pkt, tcp_len - sizeof(*tcp));
+
+	for (size_t i = 0; i < len; i++) {
+		uint8_t byte = 0;
+
+		(void)net_pkt_read_u8(pkt, &byte);
+		if (offset + i >= sizeof(data) || byte != data[offset + i]) {
+			bad_data++;
+		}
+	}
+
+	if (data_count < ARRAY_SIZE(data_len)) {
+		data_len[data_count] = len;
+		data_mss[data_count] = net_pkt_tso_mss(pkt);
+	}
+
+	data_count++;
+	data_total += len;
+}
+
+static int fake_dev_send(const struct device *dev, struct net_pkt *pkt)
+{
+	struct net_eth_hdr eth;
+	struct net_ipv6_hdr ip;
+	struct net_tcp_hdr tcp;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(dev);
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_read(pkt, &eth, sizeof(eth)) != 0 ||
+	    eth.type != htons(NET_ETH_PTYPE_IPV6) ||
+	    net_pkt_read(pkt, &ip, sizeof(ip)) != 0 || ip.nexthdr != IPPROTO_TCP ||
+	    net_pkt_read(pkt, &tcp, sizeof(tcp)) != 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	sent_flags = tcp.flags;
+	sent_seq = sys_get_be32(tcp.seq);
+	sent_ack = sys_get_be32(tcp.ack);
+
+	if (net_pkt_get_len(pkt) > HDRS_LEN + (tcp.offset >> 4) * 4U) {
+		data_record(pkt, &ip, &tcp);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	k_sem_give(&sent_sem);
+
+	return 0;
+}
+
+static const struct ethernet_api fake_dev_api = {
+	.iface_api.init = fake_dev_iface_init,
+	.get_capabilities = fake_dev_get_capabilities,
+	.send = fake_dev_send,
+};
+
+ETH_NET_DEVICE_INIT(fake_dev, "fake_dev", NULL, NULL, NULL, NULL,
+		    CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &fake_dev_api, NET_ETH_MTU);
+
+/* Hand an Ethernet frame with a TCP segment of the peer to the stack */
+static void frame_recv(uint8_t flags)
+{
+	struct {
+		struct net_eth_hdr eth;
+		struct net_ipv6_hdr ip;
+		struct net_tcp_hdr tcp;
+		uint8_t mss_opt[4];
+	} __packed frame = { 0 };
+	size_t tcp_len = sizeof(frame.tcp);
+	struct net_pkt *pkt;
+
+	/* The peer announces its segment size in its SYN */
+	if ((flags & TCP_SYN) != 0) {
+		frame.mss_opt[0] = TCP_MSS_OPT;
+		frame.mss_opt[1] = sizeof(frame.mss_opt);
+		sys_put_be16(PEER_MSS, &frame.mss_opt[2]);
+		tcp_len += sizeof(frame.mss_opt);
+	}
+
+	memcpy(frame.eth.dst.addr, my_mac, sizeof(my_mac));
+	memcpy(frame.eth.src.addr, peer_mac, sizeof(peer_mac));
+	frame.eth.type = htons(NET_ETH_PTYPE_IPV6);
+
+	frame.ip.vtc = 0x60;
+	frame.ip.len = htons(tcp_len);
+	frame.ip.nexthdr = IPPROTO_TCP;
+	frame.ip.hop_limit = 64;
+	net_ipv6_addr_copy_raw(frame.ip.src, (uint8_t *)&peer_addr);
+	net_ipv6_addr_copy_raw(frame.ip.dst, (uint8_t *)&my_addr);
+
+	frame.tcp.src_port = htons(PEER_PORT);
+	frame.tcp.dst_port = htons(TEST_PORT);
+	sys_put_be32(peer_seq, frame.tcp.seq);
+	sys_put_be32((flags & TCP_ACK) != 0 ? my_seq + data_total : 0, frame.tcp.ack);
+	frame.tcp.offset = (tcp_len / 4) << 4;
+	frame.tcp.flags = flags;
+	sys_put_be16(PEER_WND, frame.tcp.wnd);
+
+	if ((flags & TCP_SYN) != 0) {
+		peer_seq++;
+	}
+
+	pkt = net_pkt_rx_alloc_with_buffer(eth_iface, HDRS_LEN + tcp_len, AF_UNSPEC, 0,
+					   K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate a packet");
+	zassert_ok(net_pkt_write(pkt, &frame, HDRS_LEN + tcp_len));
+
+	zassert_ok(net_recv_data(eth_iface, pkt), "Frame not queued");
+}
+
+static void accept_cb(struct net_context *ctx, struct sockaddr *addr, socklen_t addrlen,
+		      int status, void *user_data)
+{
+	ARG_UNUSED(addr);
+	ARG_UNUSED(addrlen);
+	ARG_UNUSED(user_data);
+
+	zassert_ok(status, "Connection not accepted");
+
+	/* Ref the context on the test behalf */
+	net_context_ref(ctx);
+	accepted_ctx = ctx;
+
+	k_sem_give(&accept_sem);
+}
+
+static void *tso_setup(void)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(TEST_PORT),
+	};
+	struct net_if_addr *ifaddr;
+	k_spinlock_key_t key;
+	bool found;
+
+	zassert_not_null(eth_iface, "No Ethernet interface");
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i * 7;
+	}
+
+	ifaddr = net_if_ipv6_addr_add(eth_iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add the IPv6 address");
+	ifaddr->addr_state = NET_ADDR_PREFERRED;
+
+	zassert_ok(net_context_get(AF_INET6, SOCK_STREAM, IPPROTO_TCP, &listen_ctx));
+	zassert_ok(net_context_bind(listen_ctx, (struct sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(net_context_listen(listen_ctx, 1));
+	zassert_ok(net_context_accept(listen_ctx, accept_cb, K_NO_WAIT, NULL));
+
+	frame_recv(TCP_SYN);
+
+	do {
+		zassert_ok(k_sem_take(&sent_sem, K_SECONDS(1)), "No SYN-ACK sent");
+
+		key = k_spin_lock(&lock);
+		found = sent_flags == (TCP_SYN | TCP_ACK) && sent_ack == peer_seq;
+		my_seq = sent_seq + 1;
+		k_spin_unlock(&lock, key);
+	} while (!found);
+
+	frame_recv(TCP_ACK);
+	zassert_ok(k_sem_take(&accept_sem, K_SECONDS(1)), "Connection not established");
+
+	return NULL;
+}
+
+static void tso_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	data_count = 0;
+	data_total = 0;
+	bad_data = 0;
+	bad_len = 0;
+}
+
+static void tso_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Acknowledge the data sent, so the next test starts afresh */
+	frame_recv(TCP_ACK);
+	k_msleep(10);
+
+	my_seq += data_total;
+}
+
+ZTEST_SUITE(tcp_tso, NULL, tso_setup, tso_before, tso_after, NULL);
+
+/* Send the test data and wait for the driver to get all of it */
+static void data_send(bool tso)
+{
+	k_spinlock_key_t key;
+	size_t total;
+
+	tso_supported = tso;
+
+	zassert_equal(net_context_send(accepted_ctx, data, sizeof(data), NULL, K_NO_WAIT, NULL),
+		      sizeof(data), "Data not queued");
+
+	do {
+		zassert_ok(k_sem_take(&sent_sem, K_SECONDS(1)), "Data not sent");
+
+		key = k_spin_lock(&lock);
+		total = data_total;
+		k_spin_unlock(&lock, key);
+	} while (total < sizeof(data));
+
+	zassert_equal(total, sizeof(data), "%zu bytes sent", total);
+	zassert_equal(bad_data, 0, "%u bytes of bad data sent", bad_data);
+	zassert_equal(bad_len, 0, "%u packets with a bad IPv6 length", bad_len);
+}
+
+/**
+ * @brief Test data passed in one packet to a driver segmenting it
+ *
+ * @details The packet shall exceed the segment size announced by the peer,
+ * which is the size the driver is asked to segment it into.
+ */
+ZTEST(tcp_tso, test_tso)
+{
+	data_send(true);
+
+	zassert_equal(data_count, 1, "Data sent in %zu packets", data_count);
+	zassert_equal(data_len[0], DATA_LEN, "Packet of %zu bytes", data_len[0]);
+	zassert_equal(data_mss[0], PEER_MSS, "Segment size %u", data_mss[0]);
+}
+
+/**
+ * @brief Test data segmented in software for a driver without TSO
+ */
+ZTEST(tcp_tso, test_no_tso)
+{
+	data_send(false);
+
+	zassert_equal(data_count, DATA_LEN / PEER_MSS, "Data sent in %zu packets", data_count);
+
+	for (size_t i = 0; i < DATA_LEN / PEER_MSS; i++) {
+		zassert_equal(data_len[i], PEER_MSS, "Packet %zu of %zu bytes", i, data_len[i]);
+		zassert_equal(data_mss[i], 0, "Packet %zu to be segmented", i);
+	}
+}
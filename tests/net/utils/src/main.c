@@ -1365,6 +1365,41 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+ZTEST(test_utils_fn, test_ip_checksum_update)
+{
+	uint8_t hdr[20];
+	uint16_t chksum;
+	uint16_t old16, new16;
+	uint32_t old32, new32;
+
+	for (int i = 0; i < sizeof(hdr); i++) {
+		hdr[i] = (uint8_t)(i * 37 + 5);
+	}
+
+	for (int i = 0; i < 256; i++) {
+		chksum = ~calc_chksum(0, hdr, sizeof(hdr));
+
+		/* Rewrite a 16-bit field, like the TTL and protocol */
+		old16 = sys_get_be16(&hdr[8]);
+		new16 = old16 + i * 251;
+		sys_put_be16(new16, &hdr[8]);
+
+		zassert_equal(net_chksum_update_16(chksum, old16, new16),
+			      (uint16_t)~calc_chksum(0, hdr, sizeof(hdr)),
+			      "16-bit update mismatch at %d", i);
+
+		/* Rewrite a 32-bit field, like an address */
+		chksum = ~calc_chksum(0, hdr, sizeof(hdr));
+		old32 = sys_get_be32(&hdr[12]);
+		new32 = old32 * 2654435761U + i;
+		sys_put_be32(new32, &hdr[12]);
+
+		zassert_equal(net_chksum_update_32(chksum, old32, new32),
+			      (uint16_t)~calc_chksum(0, hdr, sizeof(hdr)),
+			      "32-bit update mismatch at %d", i);
+	}
+}
+
 /* Verify that the net_pkt pointer to the received link layer address
  * is correct.
  */
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <aio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define AIO_WORKERS CONFIG_POSIX_AIO_WORKERS
+
+static K_SEM_DEFINE(notified, 0, AIO_LISTIO_MAX + 1);
+
+static int evfd = -1;
+
+static void prep(struct aiocb *cb, int op, eventfd_t *val)
+{
+	*cb = (struct aiocb){
+		.aio_fildes = evfd,
+		.aio_buf = val,
+		.aio_nbytes = sizeof(*val),
+		.aio_lio_opcode = op,
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+}
+
+static ssize_t wait_for(struct aiocb *cb)
+{
+	const struct aiocb *list[] = {cb};
+
+	while (aio_error(cb) == EINPROGRESS) {
+		zassert_ok(aio_suspend(list, 1, NULL));
+	}
+
+	return aio_return(cb);
+}
+
+static void notify(union sigval val)
+{
+	zassert_equal_ptr(val.sival_ptr, &notified);
+	k_sem_give(&notified);
+}
+
+ZTEST(posix_aio, test_aio_read_write)
+{
+	eventfd_t in = 0;
+	eventfd_t out = 5;
+	struct aiocb rd;
+	struct aiocb wr;
+
+	prep(&rd, LIO_READ, &in);
+	zassert_ok(aio_read(&rd));
+	k_msleep(10);
+	zassert_equal(aio_error(&rd), EINPROGRESS, "read completed without data");
+
+	prep(&wr, LIO_WRITE, &out);
+	zassert_ok(aio_write(&wr));
+	zassert_equal(wait_for(&wr), sizeof(out));
+	zassert_equal(wait_for(&rd), sizeof(in));
+	zassert_ok(aio_error(&rd));
+	zassert_equal(in, 5);
+}
+
+ZTEST(posix_aio, test_aio_notify)
+{
+	eventfd_t val = 1;
+	struct aiocb wr;
+
+	k_sem_reset(&notified);
+	prep(&wr, LIO_WRITE, &val);
+	wr.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	wr.aio_sigevent.sigev_notify_function = notify;
+	wr.aio_sigevent.sigev_value.sival_ptr = &notified;
+
+	zassert_ok(aio_write(&wr));
+	zassert_ok(k_sem_take(&notified, K_MSEC(100)));
+	zassert_ok(aio_error(&wr));
+	zassert_equal(aio_return(&wr), sizeof(val));
+}
+
+ZTEST(posix_aio, test_aio_suspend_timeout)
+{
+	const struct timespec timeout = {.tv_nsec = 10 * NSEC_PER_MSEC};
+	struct aiocb rd;
+	const struct aiocb *list[] = {NULL, &rd};
+	eventfd_t val;
+
+	prep(&rd, LIO_READ, &val);
+	zassert_ok(aio_read(&rd));
+	zassert_equal(aio_suspend(list, ARRAY_SIZE(list), &timeout), -1);
+	zassert_equal(errno, EAGAIN);
+
+	/* A worker is blocked on the read, it cannot be cancelled anymore */
+	zassert_equal(aio_cancel(evfd, &rd), AIO_NOTCANCELED);
+
+	zassert_ok(eventfd_write(evfd, 1));
+	zassert_equal(wait_for(&rd), sizeof(val));
+	zassert_equal(aio_cancel(evfd, &rd), AIO_ALLDONE);
+}
+
+ZTEST(posix_aio, test_aio_cancel)
+{
+	struct aiocb rd[CONFIG_POSIX_AIO_MAX];
+	eventfd_t vals[ARRAY_SIZE(rd)];
+	const struct aiocb *running[AIO_WORKERS];
+	struct aiocb extra;
+	struct aiocb *lio_list[] = {&extra};
+
+	BUILD_ASSERT(ARRAY_SIZE(rd) > AIO_WORKERS);
+
+	for (size_t i = 0; i < ARRAY_SIZE(rd); i++) {
+		prep(&rd[i], LIO_READ, &vals[i]);
+		zassert_ok(aio_read(&rd[i]));
+	}
+	k_msleep(10);
+
+	/* All the requests are outstanding */
+	prep(&extra, LIO_WRITE, &vals[0]);
+	zassert_equal(aio_write(&extra), -1);
+	zassert_equal(errno, EAGAIN);
+	zassert_equal(lio_listio(LIO_NOWAIT, lio_list, ARRAY_SIZE(lio_list), NULL), -1);
+	zassert_equal(errno, EAGAIN);
+
+	/* The workers are blocked on the first reads, the others are still queued */
+	zassert_equal(aio_cancel(evfd, NULL), AIO_NOTCANCELED);
+	for (size_t i = AIO_WORKERS; i < ARRAY_SIZE(rd); i++) {
+		zassert_equal(aio_error(&rd[i]), ECANCELED);
+		zassert_equal(aio_return(&rd[i]), -1);
+		zassert_equal(errno, ECANCELED);
+	}
+
+	for (size_t i = 0; i < AIO_WORKERS; i++) {
+		zassert_equal(aio_error(&rd[i]), EINPROGRESS);
+		running[i] = &rd[i];
+	}
+
+	/* Release the blocked readers one at a time */
+	for (size_t i = 0; i < AIO_WORKERS; i++) {
+		zassert_ok(eventfd_write(evfd, 1));
+		zassert_ok(aio_suspend(running, AIO_WORKERS, NULL));
+		for (size_t j = 0; j < AIO_WORKERS; j++) {
+			if (running[j] != NULL && aio_error(running[j]) != EINPROGRESS) {
+				zassert_equal(aio_return(&rd[j]), sizeof(vals[j]));
+				running[j] = NULL;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < AIO_WORKERS; i++) {
+		zassert_is_null(running[i], "read %zu did not complete", i);
+	}
+}
+
+ZTEST(posix_aio, test_lio_listio_wait)
+{
+	eventfd_t vals[] = {1, 2, 0};
+	struct aiocb cbs[ARRAY_SIZE(vals)];
+	struct aiocb *list[ARRAY_SIZE(cbs) + 1];
+	eventfd_t val;
+
+	prep(&cbs[0], LIO_WRITE, &vals[0]);
+	prep(&cbs[1], LIO_WRITE, &vals[1]);
+	prep(&cbs[2], LIO_NOP, &vals[2]);
+	for (size_t i = 0; i < ARRAY_SIZE(cbs); i++) {
+		list[i] = &cbs[i];
+	}
+	list[ARRAY_SIZE(cbs)] = NULL;
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL));
+	zassert_ok(aio_error(&cbs[0]));
+	zassert_ok(aio_error(&cbs[1]));
+
+	zassert_ok(eventfd_read(evfd, &val));
+	zassert_equal(val, 3);
+}
+
+ZTEST(posix_aio, test_lio_listio_nowait)
+{
+	eventfd_t vals[] = {3, 4};
+	struct aiocb cbs[ARRAY_SIZE(vals)];
+	struct aiocb *list[ARRAY_SIZE(cbs)];
+	struct sigevent sig = {
+		.sigev_notify = SIGEV_THREAD,
+		.sigev_notify_function = notify,
+		.sigev_value.sival_ptr = &notified,
+	};
+	eventfd_t val;
+
+	k_sem_reset(&notified);
+	for (size_t i = 0; i < ARRAY_SIZE(cbs); i++) {
+		prep(&cbs[i], LIO_WRITE, &vals[i]);
+		cbs[i].aio_sigevent = sig;
+		list[i] = &cbs[i];
+	}
+
+	zassert_ok(lio_listio(LIO_NOWAIT, list, ARRAY_SIZE(list), &sig));
+
+	/* Once for each request, and once for the list */
+	for (size_t i = 0; i < ARRAY_SIZE(cbs) + 1; i++) {
+		zassert_ok(k_sem_take(&notified, K_MSEC(100)));
+	}
+	for (size_t i = 0; i < ARRAY_SIZE(cbs); i++) {
+		zassert_equal(aio_return(&cbs[i]), sizeof(vals[i]));
+	}
+
+	zassert_ok(eventfd_read(evfd, &val));
+	zassert_equal(val, 7);
+}
+
+ZTEST(posix_aio, test_aio_invalid)
+{
+	struct aiocb cb;
+	struct aiocb *list[] = {&cb};
+	eventfd_t val;
+
+	zassert_equal(aio_read(NULL), -1);
+	zassert_equal(errno, EINVAL);
+
+	prep(&cb, LIO_READ, &val);
+	cb.aio_sigevent.sigev_notify = SIGEV_SIGNAL;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	prep(&cb, LIO_READ, &val);
+	cb.aio_fildes = -1;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EBADF);
+
+	prep(&cb, LIO_READ, &val);
+	zassert_equal(aio_fsync(O_RDWR, &cb), -1);
+	zassert_equal(errno, EINVAL);
+	zassert_equal(aio_cancel(evfd + 1, &cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(lio_listio(-1, list, ARRAY_SIZE(list), NULL), -1);
+	zassert_equal(errno, EINVAL);
+	zassert_equal(lio_listio(LIO_WAIT, list, AIO_LISTIO_MAX + 1, NULL), -1);
+	zassert_equal(errno, EINVAL);
+	cb.aio_lio_opcode = -1;
+	zassert_equal(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	evfd = eventfd(0, 0);
+	zassert_true(evfd >= 0, "eventfd() failed: %d", errno);
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	zassert_ok(close(evfd));
+	evfd = -1;
+}
+
+ZTEST_SUITE(posix_aio, NULL, NULL, before, after, NULL);
@@ -409,6 +409,62 @@ ZTEST(pthread_attr, test_pthread_attr_large_stacksize)
 	zassert_equal(actual_size, expect_size);
 }
 
+ZTEST(pthread_attr, test_pthread_attr_stack_cache)
+{
+#if defined(CONFIG_POSIX_THREAD_STACK_CACHE_SIZE) && (CONFIG_POSIX_THREAD_STACK_CACHE_SIZE > 0)
+	pthread_attr_t attrs[CONFIG_POSIX_THREAD_STACK_CACHE_SIZE];
+	void *stack, *cached;
+	size_t size;
+
+	/* fill the cache with stacks in use */
+	ARRAY_FOR_EACH(attrs, i) {
+		zassert_ok(pthread_attr_init(&attrs[i]));
+	}
+	zassert_ok(pthread_attr_getstack(&attrs[0], &stack, &size));
+	zassert_not_null(stack);
+	zassert_ok(pthread_attr_destroy(&attrs[0]));
+
+	/* the released stack is handed out again */
+	zassert_ok(pthread_attr_init(&attrs[0]));
+	zassert_ok(pthread_attr_getstack(&attrs[0], &cached, &size));
+	zassert_equal_ptr(cached, stack);
+	can_create_thread(&attrs[0]);
+	create_thread_common(&attrs[0], true, false);
+
+	/* but not for a stack over twice as large */
+	if (pthread_attr_setstacksize(&attrs[0], 4 * size) == 0) {
+		zassert_ok(pthread_attr_getstack(&attrs[0], &stack, &size));
+		zassert_not_equal(stack, cached);
+	}
+
+	ARRAY_FOR_EACH(attrs, i) {
+		zassert_ok(pthread_attr_destroy(&attrs[i]));
+	}
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(pthread_attr, test_pthread_attr_stackprefault_np)
+{
+	int prefault = -1;
+
+	zassert_equal(pthread_attr_getstackprefault_np(&uninit_attr, &prefault), EINVAL);
+	zassert_equal(pthread_attr_getstackprefault_np(&attr, NULL), EINVAL);
+
+	zassert_ok(pthread_attr_getstackprefault_np(&attr, &prefault));
+	zassert_equal(prefault, 0);
+
+	zassert_ok(pthread_attr_setstackprefault_np(&attr, 1));
+	zassert_ok(pthread_attr_getstackprefault_np(&attr, &prefault));
+	zassert_equal(prefault, 1);
+	can_create_thread(&attr);
+
+	zassert_ok(pthread_attr_setstackprefault_np(&attr, 0));
+	zassert_ok(pthread_attr_getstackprefault_np(&attr, &prefault));
+	zassert_equal(prefault, 0);
+}
+
 ZTEST(pthread_attr, test_pthread_attr_getdetachstate)
 {
 	int detachstate;
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/audio/asrc.h>
+
+#define FRAMES 64
+
+static struct audio_asrc asrc;
+static int16_t in[FRAMES * 2];
+static int16_t out[(FRAMES + 8) * 2];
+
+static void fill_dc(int16_t left, int16_t right)
+{
+	for (int i = 0; i < FRAMES; i++) {
+		in[2 * i] = left;
+		in[2 * i + 1] = right;
+	}
+}
+
+ZTEST(audio_asrc, test_init)
+{
+	zassert_equal(audio_asrc_init(&asrc, 0), -EINVAL);
+	zassert_equal(audio_asrc_init(&asrc, CONFIG_AUDIO_PIPELINE_ASRC_MAX_CHANNELS + 1),
+		      -EINVAL);
+	zassert_ok(audio_asrc_init(&asrc, 2));
+	zassert_equal(audio_asrc_get_ratio(&asrc), AUDIO_ASRC_RATIO_ONE);
+}
+
+ZTEST(audio_asrc, test_unity_ratio)
+{
+	int n;
+
+	zassert_ok(audio_asrc_init(&asrc, 2));
+	fill_dc(1000, -1000);
+
+	n = audio_asrc_process(&asrc, in, FRAMES, out, ARRAY_SIZE(out) / 2);
+	zassert_equal(n, FRAMES);
+
+	/* Past the filter delay the DC level must be preserved */
+	for (int i = AUDIO_ASRC_TAPS; i < n; i++) {
+		zassert_within(out[2 * i], 1000, 2, "left %d at %d", out[2 * i], i);
+		zassert_within(out[2 * i + 1], -1000, 2, "right %d at %d", out[2 * i + 1], i);
+	}
+}
+
+ZTEST(audio_asrc, test_ratio)
+{
+	int total = 0;
+	int n;
+
+	zassert_ok(audio_asrc_init(&asrc, 2));
+	fill_dc(1000, 1000);
+
+	/* Consume 1% more input than output frames are produced */
+	audio_asrc_set_ratio(&asrc, AUDIO_ASRC_RATIO_ONE + AUDIO_ASRC_RATIO_ONE / 100);
+
+	for (int k = 0; k < 100; k++) {
+		n = audio_asrc_process(&asrc, in, FRAMES, out, ARRAY_SIZE(out) / 2);
+		zassert_true(n > 0);
+		total += n;
+	}
+
+	zassert_within(total, 100 * FRAMES * 100 / 101, 2);
+}
+
+ZTEST(audio_asrc, test_output_too_small)
+{
+	zassert_ok(audio_asrc_init(&asrc, 2));
+	fill_dc(0, 0);
+
+	zassert_equal(audio_asrc_process(&asrc, in, FRAMES, out, FRAMES - 1), -ENOMEM);
+}
+
+ZTEST(audio_asrc, test_drift_update)
+{
+	uint32_t expected = ((uint64_t)48 << 24) / 47;
+	uint32_t ratio;
+
+	zassert_ok(audio_asrc_init(&asrc, 1));
+
+	for (int k = 0; k < 10000; k++) {
+		audio_asrc_drift_update(&asrc, 48, 47);
+	}
+
+	ratio = audio_asrc_get_ratio(&asrc);
+	zassert_within(ratio, expected, AUDIO_ASRC_RATIO_ONE / 10000, "ratio 0x%x", ratio);
+}
+
+ZTEST_SUITE(audio_asrc, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/audio/mixer.h>
+
+#define FRAMES 32
+
+RING_BUF_DECLARE(ring_a, 256);
+RING_BUF_DECLARE(ring_b, 256);
+
+static struct audio_mixer mixer;
+static struct audio_mixer_input inputs[2];
+static int16_t in16[FRAMES * 2];
+static int32_t in32[FRAMES * 2];
+static int16_t out16[FRAMES * 2];
+
+static void fill16(int16_t left, int16_t right)
+{
+	for (int i = 0; i < FRAMES; i++) {
+		in16[2 * i] = left;
+		in16[2 * i + 1] = right;
+	}
+}
+
+static void fill32(int32_t left, int32_t right)
+{
+	for (int i = 0; i < FRAMES; i++) {
+		in32[2 * i] = left;
+		in32[2 * i + 1] = right;
+	}
+}
+
+static void mixer_setup(enum audio_mixer_format fmt_a, enum audio_mixer_format fmt_b,
+			enum audio_mixer_format fmt_out)
+{
+	ring_buf_reset(&ring_a);
+	ring_buf_reset(&ring_b);
+	audio_mixer_input_init(&inputs[0], &ring_a, fmt_a);
+	audio_mixer_input_init(&inputs[1], &ring_b, fmt_b);
+	zassert_ok(audio_mixer_init(&mixer, inputs, ARRAY_SIZE(inputs), 2, fmt_out));
+}
+
+ZTEST(audio_mixer, test_init)
+{
+	zassert_equal(audio_mixer_init(&mixer, inputs, 2, 0, AUDIO_MIXER_FMT_S16), -EINVAL);
+	zassert_equal(audio_mixer_init(&mixer, inputs, 2,
+				       CONFIG_AUDIO_PIPELINE_MIXER_CHUNK_SAMPLES + 1,
+				       AUDIO_MIXER_FMT_S16),
+		      -EINVAL);
+	zassert_ok(audio_mixer_init(&mixer, inputs, 2, 2, AUDIO_MIXER_FMT_S16));
+}
+
+ZTEST(audio_mixer, test_write_whole_frames)
+{
+	mixer_setup(AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16);
+
+	/* A partial frame is not written */
+	zassert_equal(audio_mixer_input_write(&mixer, &inputs[0], in16, 6), 4);
+	zassert_equal(ring_buf_size_get(&ring_a), 4);
+}
+
+ZTEST(audio_mixer, test_sum_formats)
+{
+	mixer_setup(AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S32, AUDIO_MIXER_FMT_S16);
+	fill16(1000, -1000);
+	fill32(200 << 16, 300 << 16);
+
+	zassert_equal(audio_mixer_input_write(&mixer, &inputs[0], in16, sizeof(in16)),
+		      sizeof(in16));
+	zassert_equal(audio_mixer_input_write(&mixer, &inputs[1], in32, sizeof(in32)),
+		      sizeof(in32));
+
+	audio_mixer_process(&mixer, out16, FRAMES);
+
+	for (int i = 0; i < FRAMES; i++) {
+		zassert_within(out16[2 * i], 1200, 1, "left %d at %d", out16[2 * i], i);
+		zassert_within(out16[2 * i + 1], -700, 1, "right %d at %d", out16[2 * i + 1], i);
+	}
+
+	zassert_equal(ring_buf_size_get(&ring_a), 0);
+	zassert_equal(ring_buf_size_get(&ring_b), 0);
+}
+
+ZTEST(audio_mixer, test_s24_output)
+{
+	uint8_t out24[FRAMES * 2 * 3];
+	int32_t v;
+
+	mixer_setup(AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S24);
+	fill16(-2, 0);
+	audio_mixer_input_write(&mixer, &inputs[0], in16, sizeof(in16));
+
+	audio_mixer_process(&mixer, out24, FRAMES);
+
+	/* -2 in 16 bits is -512 in 24 bits */
+	v = (int32_t)(out24[0] | out24[1] << 8 | out24[2] << 16 | 0xff000000);
+	zassert_equal(v, -512);
+}
+
+ZTEST(audio_mixer, test_saturation)
+{
+	mixer_setup(AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16);
+	fill16(30000, -30000);
+
+	audio_mixer_input_write(&mixer, &inputs[0], in16, sizeof(in16));
+	audio_mixer_input_write(&mixer, &inputs[1], in16, sizeof(in16));
+
+	audio_mixer_process(&mixer, out16, FRAMES);
+
+	for (int i = 0; i < FRAMES; i++) {
+		zassert_equal(out16[2 * i], INT16_MAX);
+		zassert_equal(out16[2 * i + 1], INT16_MIN);
+	}
+}
+
+ZTEST(audio_mixer, test_gain_ramp)
+{
+	mixer_setup(AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16);
+	fill16(16000, 16000);
+
+	audio_mixer_set_gain(&inputs[0], 0, FRAMES);
+	audio_mixer_input_write(&mixer, &inputs[0], in16, sizeof(in16));
+	audio_mixer_process(&mixer, out16, FRAMES);
+
+	/* Decreasing, without jumping straight to silence */
+	zassert_true(out16[0] > 8000, "first %d", out16[0]);
+	for (int i = 1; i < FRAMES; i++) {
+		zassert_true(out16[2 * i] <= out16[2 * (i - 1)], "rising at %d", i);
+	}
+	zassert_equal(out16[2 * (FRAMES - 1)], 0);
+
+	/* Immediate gain change */
+	audio_mixer_set_gain(&inputs[0], AUDIO_MIXER_GAIN_UNITY / 2, 0);
+	audio_mixer_input_write(&mixer, &inputs[0], in16, sizeof(in16));
+	audio_mixer_process(&mixer, out16, FRAMES);
+
+	for (int i = 0; i < FRAMES; i++) {
+		zassert_within(out16[2 * i], 8000, 1, "%d at %d", out16[2 * i], i);
+	}
+}
+
+ZTEST(audio_mixer, test_underrun)
+{
+	mixer_setup(AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16, AUDIO_MIXER_FMT_S16);
+	fill16(1000, 1000);
+
+	/* Idle inputs do not underrun */
+	audio_mixer_process(&mixer, out16, FRAMES);
+	zassert_equal(audio_mixer_input_underruns(&inputs[0]), 0);
+	zassert_equal(out16[0], 0);
+
+	audio_mixer_input_write(&mixer, &inputs[0], in16, sizeof(in16) / 2);
+	audio_mixer_process(&mixer, out16, FRAMES);
+
+	zassert_equal(out16[0], 1000);
+	zassert_equal(out16[FRAMES - 1], 1000);
+	zassert_equal(out16[FRAMES], 0);
+	zassert_equal(audio_mixer_input_underruns(&inputs[0]), 1);
+	zassert_equal(audio_mixer_input_underruns(&inputs[1]), 0);
+
+	audio_mixer_process(&mixer, out16, FRAMES);
+	zassert_equal(audio_mixer_input_underruns(&inputs[0]), 1);
+}
+
+ZTEST_SUITE(audio_mixer, NULL, NULL, NULL, NULL, NULL);
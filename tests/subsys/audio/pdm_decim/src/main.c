@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/audio/pdm_decim.h>
+
+#define DECIMATION 64
+#define CHANNELS   2
+#define FRAMES     64
+
+/* Skip the output until the filters have settled */
+#define SETTLE 24
+
+static struct audio_pdm_decim decim;
+static uint8_t pdm[AUDIO_PDM_DECIM_RAW_SIZE(FRAMES, CHANNELS, DECIMATION)];
+static int16_t pcm[FRAMES * CHANNELS];
+
+static void fill(uint8_t left, uint8_t right)
+{
+	for (int i = 0; i < ARRAY_SIZE(pdm); i += CHANNELS) {
+		pdm[i] = left;
+		pdm[i + 1] = right;
+	}
+}
+
+ZTEST(audio_pdm_decim, test_init)
+{
+	zassert_equal(audio_pdm_decim_init(&decim, 0, DECIMATION), -EINVAL);
+	zassert_equal(audio_pdm_decim_init(&decim, CONFIG_AUDIO_PDM_DECIM_MAX_CHANNELS + 1,
+					   DECIMATION),
+		      -EINVAL);
+	zassert_equal(audio_pdm_decim_init(&decim, CHANNELS, 48), -EINVAL);
+	zassert_ok(audio_pdm_decim_init(&decim, CHANNELS, 32));
+	zassert_ok(audio_pdm_decim_init(&decim, CHANNELS, 128));
+}
+
+ZTEST(audio_pdm_decim, test_density)
+{
+	int n;
+
+	zassert_ok(audio_pdm_decim_init(&decim, CHANNELS, DECIMATION));
+
+	/* Full scale on the left, 75% density (half scale) on the right */
+	fill(0xff, 0xee);
+
+	n = audio_pdm_decim_process(&decim, pdm, sizeof(pdm), pcm, FRAMES);
+	zassert_equal(n, FRAMES);
+
+	for (int i = SETTLE; i < n; i++) {
+		zassert_within(pcm[CHANNELS * i], INT16_MAX, 1, "left %d at %d",
+			       pcm[CHANNELS * i], i);
+		zassert_within(pcm[CHANNELS * i + 1], 16384, 2, "right %d at %d",
+			       pcm[CHANNELS * i + 1], i);
+	}
+}
+
+ZTEST(audio_pdm_decim, test_idle_pattern)
+{
+	int n;
+
+	zassert_ok(audio_pdm_decim_init(&decim, CHANNELS, DECIMATION));
+
+	/* Alternating bits are the PDM encoding of silence */
+	fill(0xaa, 0x55);
+
+	n = audio_pdm_decim_process(&decim, pdm, sizeof(pdm), pcm, FRAMES);
+	zassert_equal(n, FRAMES);
+
+	for (int i = SETTLE; i < n; i++) {
+		zassert_within(pcm[CHANNELS * i], 0, 2);
+		zassert_within(pcm[CHANNELS * i + 1], 0, 2);
+	}
+}
+
+ZTEST(audio_pdm_decim, test_split_blocks)
+{
+	static int16_t ref[FRAMES * CHANNELS];
+	size_t half = sizeof(pdm) / 2 + CHANNELS;
+	int n;
+
+	for (int i = 0; i < ARRAY_SIZE(pdm); i++) {
+		pdm[i] = (i * 37) & 0xff;
+	}
+
+	zassert_ok(audio_pdm_decim_init(&decim, CHANNELS, DECIMATION));
+	zassert_equal(audio_pdm_decim_process(&decim, pdm, sizeof(pdm), ref, FRAMES), FRAMES);
+
+	/* Blocks not aligned on output frames must give the same result */
+	audio_pdm_decim_reset(&decim);
+	n = audio_pdm_decim_process(&decim, pdm, half, pcm, FRAMES);
+	zassert_true(n > 0);
+	zassert_equal(audio_pdm_decim_process(&decim, &pdm[half], sizeof(pdm) - half,
+					      &pcm[n * CHANNELS], FRAMES - n),
+		      FRAMES - n);
+	zassert_mem_equal(pcm, ref, sizeof(ref));
+}
+
+ZTEST(audio_pdm_decim, test_errors)
+{
+	zassert_ok(audio_pdm_decim_init(&decim, CHANNELS, DECIMATION));
+	fill(0xaa, 0xaa);
+
+	zassert_equal(audio_pdm_decim_process(&decim, pdm, sizeof(pdm) - 1, pcm, FRAMES),
+		      -EINVAL);
+	zassert_equal(audio_pdm_decim_process(&decim, pdm, sizeof(pdm), pcm, FRAMES - 1),
+		      -ENOMEM);
+}
+
+ZTEST_SUITE(audio_pdm_decim, NULL, NULL, NULL, NULL, NULL);
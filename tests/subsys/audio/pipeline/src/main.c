@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/audio/pipeline.h>
+
+#define BLOCK_SAMPLES 16
+#define BLOCK_SIZE    (BLOCK_SAMPLES * sizeof(int16_t))
+#define NUM_BLOCKS    4
+#define TEST_BLOCKS   32
+
+K_MEM_SLAB_DEFINE_STATIC(test_slab, BLOCK_SIZE, NUM_BLOCKS, 4);
+K_SEM_DEFINE(test_done, 0, 1);
+
+static int16_t next_value;
+static int16_t expected_value;
+static int sink_errors;
+
+static int test_source_pull(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	int16_t *samples;
+	int ret;
+
+	/* Pace the source like a stream clock would */
+	k_msleep(1);
+
+	ret = k_mem_slab_alloc(&test_slab, &block->data, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+
+	samples = block->data;
+	for (int i = 0; i < BLOCK_SAMPLES; i++) {
+		samples[i] = next_value++;
+	}
+
+	block->size = BLOCK_SIZE;
+	block->slab = &test_slab;
+
+	return 0;
+}
+
+static int test_negate_process(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	int16_t *samples = block->data;
+
+	for (int i = 0; i < block->size / sizeof(int16_t); i++) {
+		samples[i] = -samples[i];
+	}
+
+	return 0;
+}
+
+static int test_sink_push(const struct audio_pipeline_node *node, struct audio_block *block)
+{
+	int16_t *samples = block->data;
+	struct audio_pipeline *pipeline = node->data;
+
+	for (int i = 0; i < block->size / sizeof(int16_t); i++) {
+		if (samples[i] != -expected_value++) {
+			sink_errors++;
+		}
+	}
+
+	audio_block_free(block);
+
+	if (pipeline != NULL && pipeline->stats.blocks + 1 == TEST_BLOCKS) {
+		k_sem_give(&test_done);
+	}
+
+	return 0;
+}
+
+static const struct audio_pipeline_node_api test_source_api = {
+	.pull = test_source_pull,
+};
+
+static const struct audio_pipeline_node_api test_negate_api = {
+	.process = test_negate_process,
+};
+
+static const struct audio_pipeline_node_api test_sink_api = {
+	.push = test_sink_push,
+};
+
+extern struct audio_pipeline test_pipeline;
+
+AUDIO_PIPELINE_NODE_DEFINE(test_source, &test_source_api, NULL, NULL);
+AUDIO_PIPELINE_NODE_DEFINE(test_negate, &test_negate_api, NULL, NULL);
+AUDIO_PIPELINE_NODE_DEFINE(test_sink, &test_sink_api, NULL, &test_pipeline);
+AUDIO_PIPELINE_DEFINE(test_pipeline, test_source, test_negate, test_sink);
+
+AUDIO_PIPELINE_QUEUE_SOURCE_DEFINE(test_queue, NUM_BLOCKS, K_FOREVER);
+AUDIO_PIPELINE_NODE_DEFINE(test_queue_sink, &test_sink_api, NULL, NULL);
+AUDIO_PIPELINE_DEFINE(test_queue_pipeline, test_queue, test_negate, test_queue_sink);
+
+AUDIO_PIPELINE_DOMAIN_DEFINE(test_domain, 1024, K_PRIO_PREEMPT(0), test_pipeline);
+AUDIO_PIPELINE_DOMAIN_DEFINE(test_queue_domain, 1024, K_PRIO_PREEMPT(0), test_queue_pipeline);
+
+static void pipeline_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	next_value = 0;
+	expected_value = 0;
+	sink_errors = 0;
+	test_pipeline.stats = (struct audio_pipeline_stats){0};
+	test_queue_pipeline.stats = (struct audio_pipeline_stats){0};
+	k_sem_reset(&test_done);
+}
+
+ZTEST(audio_pipeline, test_run_once)
+{
+	zassert_ok(audio_pipeline_run_once(&test_pipeline));
+	zassert_ok(audio_pipeline_run_once(&test_pipeline));
+
+	zassert_equal(test_pipeline.stats.blocks, 2);
+	zassert_equal(test_pipeline.stats.errors, 0);
+	zassert_equal(sink_errors, 0);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+}
+
+ZTEST(audio_pipeline, test_domain)
+{
+	zassert_ok(audio_pipeline_domain_start(&test_domain));
+	zassert_equal(audio_pipeline_domain_start(&test_domain), -EALREADY);
+
+	zassert_ok(k_sem_take(&test_done, K_SECONDS(1)));
+
+	zassert_ok(audio_pipeline_domain_stop(&test_domain, K_SECONDS(1)));
+	zassert_equal(audio_pipeline_domain_stop(&test_domain, K_NO_WAIT), -EALREADY);
+
+	zassert_true(test_pipeline.stats.blocks >= TEST_BLOCKS);
+	zassert_equal(sink_errors, 0);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+}
+
+ZTEST(audio_pipeline, test_queue_source)
+{
+	struct audio_block block;
+
+	zassert_ok(audio_pipeline_domain_start(&test_queue_domain));
+
+	for (int n = 0; n < NUM_BLOCKS; n++) {
+		zassert_ok(test_source_pull(NULL, &block));
+		zassert_ok(audio_pipeline_queue_put(&test_queue, &block, K_FOREVER));
+	}
+
+	/* Let the domain thread drain the queue */
+	k_sleep(K_MSEC(10));
+
+	zassert_ok(audio_pipeline_domain_stop(&test_queue_domain, K_SECONDS(1)));
+
+	zassert_equal(test_queue_pipeline.stats.blocks, NUM_BLOCKS);
+	zassert_equal(sink_errors, 0);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+
+	/* No wake up marker is left behind */
+	zassert_equal(k_msgq_num_used_get(&test_queue_msgq), 0);
+}
+
+ZTEST(audio_pipeline, test_queue_source_restart)
+{
+	struct audio_block blocks[NUM_BLOCKS];
+	struct audio_block block;
+
+	for (int n = 0; n < NUM_BLOCKS; n++) {
+		zassert_ok(test_source_pull(NULL, &blocks[n]));
+	}
+
+	zassert_ok(audio_pipeline_domain_start(&test_queue_domain));
+
+	/* Blocks still queued when the domain stops are freed */
+	for (int n = 0; n < NUM_BLOCKS; n++) {
+		zassert_ok(audio_pipeline_queue_put(&test_queue, &blocks[n], K_NO_WAIT));
+	}
+
+	zassert_ok(audio_pipeline_domain_stop(&test_queue_domain, K_SECONDS(1)));
+	zassert_equal(k_msgq_num_used_get(&test_queue_msgq), 0);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+
+	/* The restarted domain only sees the blocks queued after the restart */
+	test_queue_pipeline.stats = (struct audio_pipeline_stats){0};
+	expected_value = next_value;
+	zassert_ok(audio_pipeline_domain_start(&test_queue_domain));
+
+	zassert_ok(test_source_pull(NULL, &block));
+	zassert_ok(audio_pipeline_queue_put(&test_queue, &block, K_FOREVER));
+	k_sleep(K_MSEC(10));
+
+	zassert_ok(audio_pipeline_domain_stop(&test_queue_domain, K_SECONDS(1)));
+	zassert_equal(test_queue_pipeline.stats.blocks, 1);
+	zassert_equal(test_queue_pipeline.stats.errors, 0);
+	zassert_equal(sink_errors, 0);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+}
+
+ZTEST_SUITE(audio_pipeline, NULL, NULL, pipeline_before, NULL, NULL);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/irq_latency.h>
+#include <zephyr/ztest.h>
+
+/* Line reported by hand, not used by the counter */
+#define TEST_IRQ 1000
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(recorder_stack, STACK_SIZE);
+static struct k_thread recorder_thread;
+
+static void samples_cb(unsigned int irq, void *user_data)
+{
+	struct irq_latency_hist hist;
+	uint32_t *samples = user_data;
+
+	if (irq != TEST_IRQ && irq_latency_get(irq, IRQ_LATENCY_ENTRY, &hist, NULL) == 0) {
+		*samples += hist.samples;
+	}
+}
+
+ZTEST(irq_latency, test_counter_samples)
+{
+	uint32_t samples = 0;
+
+	/* Several periods of the alarm */
+	k_msleep(10 * CONFIG_IRQ_LATENCY_PERIOD_US / USEC_PER_MSEC + 10);
+
+	irq_latency_foreach(samples_cb, &samples);
+	zassert_true(samples > 0, "No latency measured on the counter line");
+}
+
+static void recorder(void *p1, void *p2, void *p3)
+{
+	uint32_t ns = POINTER_TO_UINT(p1);
+
+	irq_latency_record(TEST_IRQ, IRQ_LATENCY_WAKEUP, ns);
+}
+
+ZTEST(irq_latency, test_max_thread_name)
+{
+	struct irq_latency_hist hist;
+	char name[CONFIG_THREAD_MAX_NAME_LEN];
+	k_tid_t thread;
+	k_tid_t tid;
+
+	zassert_ok(irq_latency_line_add(TEST_IRQ));
+
+	irq_latency_record(TEST_IRQ, IRQ_LATENCY_WAKEUP, 100);
+
+	tid = k_thread_create(&recorder_thread, recorder_stack, STACK_SIZE, recorder,
+			      UINT_TO_POINTER(5000), NULL, NULL, K_PRIO_PREEMPT(0), 0, K_FOREVER);
+	k_thread_name_set(tid, "lat_recorder");
+	k_thread_start(tid);
+	zassert_ok(k_thread_join(tid, K_FOREVER));
+
+	zassert_ok(irq_latency_get(TEST_IRQ, IRQ_LATENCY_WAKEUP, &hist, &thread));
+	zassert_equal(hist.samples, 2);
+	zassert_equal(hist.max_ns, 5000);
+	zassert_equal(thread, tid);
+
+	/* The thread exited, the name copied when recorded is still there */
+	memset(&recorder_thread, 0, sizeof(recorder_thread));
+	zassert_ok(irq_latency_max_thread_name_get(TEST_IRQ, IRQ_LATENCY_WAKEUP, name,
+						   sizeof(name)));
+	zassert_str_equal(name, "lat_recorder");
+
+	irq_latency_reset();
+	zassert_ok(irq_latency_max_thread_name_get(TEST_IRQ, IRQ_LATENCY_WAKEUP, name,
+						   sizeof(name)));
+	zassert_str_equal(name, "");
+
+	zassert_equal(irq_latency_max_thread_name_get(TEST_IRQ + 1, IRQ_LATENCY_WAKEUP, name,
+						      sizeof(name)), -ENOENT);
+}
+
+ZTEST_SUITE(irq_latency, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/display/blit.h>
+#include <zephyr/ztest.h>
+
+/* 2x3 image, pixel values are their index */
+static uint32_t src_buf[6];
+static uint32_t dst_buf[16];
+
+static const struct blit_surface src = {
+	.buf = src_buf,
+	.width = 2,
+	.height = 3,
+	.pitch = 2,
+	.format = PIXEL_FORMAT_ARGB_8888,
+};
+
+static void blit_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < ARRAY_SIZE(src_buf); i++) {
+		src_buf[i] = i;
+	}
+	memset(dst_buf, 0, sizeof(dst_buf));
+}
+
+ZTEST(blit, test_rotate)
+{
+	struct blit_surface dst = {
+		.buf = dst_buf,
+		.width = 3,
+		.height = 2,
+		.pitch = 3,
+		.format = PIXEL_FORMAT_ARGB_8888,
+	};
+	const uint32_t rotated_90[] = {4, 2, 0, 5, 3, 1};
+	const uint32_t rotated_270[] = {1, 3, 5, 0, 2, 4};
+
+	zassert_ok(blit_rotate(&dst, &src, DISPLAY_ORIENTATION_ROTATED_90));
+	zassert_mem_equal(dst_buf, rotated_90, sizeof(rotated_90));
+
+	zassert_ok(blit_rotate(&dst, &src, DISPLAY_ORIENTATION_ROTATED_270));
+	zassert_mem_equal(dst_buf, rotated_270, sizeof(rotated_270));
+
+	/* The size must match the rotation */
+	zassert_equal(blit_rotate(&dst, &src, DISPLAY_ORIENTATION_ROTATED_180), -EINVAL);
+}
+
+ZTEST(blit, test_convert)
+{
+	uint8_t rgb565[4];
+	struct blit_surface s565 = {
+		.buf = rgb565,
+		.width = 2,
+		.height = 1,
+		.pitch = 2,
+		.format = PIXEL_FORMAT_RGB_565,
+	};
+	struct blit_surface argb = {
+		.buf = src_buf,
+		.width = 2,
+		.height = 1,
+		.pitch = 2,
+		.format = PIXEL_FORMAT_ARGB_8888,
+	};
+	uint8_t l8;
+	struct blit_surface gray = {
+		.buf = &l8,
+		.width = 1,
+		.height = 1,
+		.pitch = 1,
+		.format = PIXEL_FORMAT_L_8,
+	};
+
+	src_buf[0] = 0xFFFF0000;
+	src_buf[1] = 0xFF0000FF;
+
+	/* RGB_565 is stored big endian */
+	zassert_ok(blit_convert(&s565, &argb));
+	zassert_equal(rgb565[0], 0xF8);
+	zassert_equal(rgb565[1], 0x00);
+	zassert_equal(rgb565[2], 0x00);
+	zassert_equal(rgb565[3], 0x1F);
+
+	argb.buf = dst_buf;
+	zassert_ok(blit_convert(&argb, &s565));
+	zassert_equal(dst_buf[0], 0xFFFF0000);
+	zassert_equal(dst_buf[1], 0xFF0000FF);
+
+	src_buf[0] = 0xFFFFFFFF;
+	argb.buf = src_buf;
+	argb.width = 1;
+	zassert_ok(blit_convert(&gray, &argb));
+	zassert_equal(l8, 0xFF);
+
+	gray.format = PIXEL_FORMAT_MONO01;
+	zassert_equal(blit_convert(&gray, &argb), -ENOTSUP);
+}
+
+ZTEST(blit, test_fill_blend)
+{
+	struct blit_surface dst = {
+		.buf = dst_buf,
+		.width = 2,
+		.height = 3,
+		.pitch = 2,
+		.format = PIXEL_FORMAT_ARGB_8888,
+	};
+
+	zassert_ok(blit_fill(&dst, 0xFF000000));
+	for (size_t i = 0; i < 6; i++) {
+		zassert_equal(dst_buf[i], 0xFF000000, "@%zu", i);
+	}
+
+	/* Half transparent white over black gives mid gray */
+	for (size_t i = 0; i < ARRAY_SIZE(src_buf); i++) {
+		src_buf[i] = 0x80FFFFFF;
+	}
+	zassert_ok(blit_blend(&dst, &src, 255));
+	zassert_equal(dst_buf[0], 0xFF808080);
+
+	/* A transparent source leaves the destination untouched */
+	zassert_ok(blit_blend(&dst, &src, 0));
+	zassert_equal(dst_buf[5], 0xFF808080);
+}
+
+ZTEST(blit, test_scale)
+{
+	static uint32_t big[24];
+	struct blit_surface dst = {
+		.buf = big,
+		.width = 4,
+		.height = 6,
+		.pitch = 4,
+		.format = PIXEL_FORMAT_ARGB_8888,
+	};
+	const uint32_t row0[] = {0, 0, 1, 1};
+
+	zassert_ok(blit_scale(&dst, &src));
+	zassert_mem_equal(&big[0], row0, sizeof(row0));
+	zassert_mem_equal(&big[4], row0, sizeof(row0));
+	zassert_equal(big[23], 5);
+}
+
+ZTEST_SUITE(blit, NULL, NULL, blit_before, NULL, NULL);
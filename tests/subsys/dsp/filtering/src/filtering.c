@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/dsp.h>
+
+#define BLOCK_SIZE 8
+#define NUM_TAPS   4
+
+ZTEST(zdsp_filtering, test_fir_q15_impulse)
+{
+	/* Time reversed, so the impulse response is 4000, 3000, 2000, 1000 */
+	static const q15_t coeffs[NUM_TAPS] = {1000, 2000, 3000, 4000};
+	static const q15_t expected[BLOCK_SIZE] = {3999, 2999, 1999, 999, 0, 0, 0, 0};
+	q15_t state[NUM_TAPS + BLOCK_SIZE / 2 - 1];
+	q15_t in[BLOCK_SIZE] = {INT16_MAX};
+	q15_t out[BLOCK_SIZE];
+	struct zdsp_fir_q15 fir;
+
+	zdsp_fir_init_q15(&fir, NUM_TAPS, coeffs, state, BLOCK_SIZE / 2);
+
+	/* Two calls, so that the state carries over between blocks */
+	zdsp_fir_q15(&fir, &in[0], &out[0], BLOCK_SIZE / 2);
+	zdsp_fir_q15(&fir, &in[BLOCK_SIZE / 2], &out[BLOCK_SIZE / 2], BLOCK_SIZE / 2);
+
+	for (size_t i = 0; i < BLOCK_SIZE; i++) {
+		zassert_within(out[i], expected[i], 1, "sample %zu: %d", i, out[i]);
+	}
+}
+
+ZTEST(zdsp_filtering, test_fir_f32_moving_average)
+{
+	static const float32_t coeffs[NUM_TAPS] = {0.25f, 0.25f, 0.25f, 0.25f};
+	float32_t state[NUM_TAPS + BLOCK_SIZE - 1];
+	float32_t in[BLOCK_SIZE] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+	float32_t out[BLOCK_SIZE];
+	struct zdsp_fir_f32 fir;
+
+	zdsp_fir_init_f32(&fir, NUM_TAPS, coeffs, state, BLOCK_SIZE);
+	zdsp_fir_f32(&fir, in, out, BLOCK_SIZE);
+
+	for (size_t i = 0; i < BLOCK_SIZE; i++) {
+		float32_t expected = 0.25f * MIN(i + 1, NUM_TAPS);
+
+		zassert_within(out[i], expected, 1e-6f, "sample %zu: %f", i, (double)out[i]);
+	}
+}
+
+ZTEST(zdsp_filtering, test_biquad_q15_one_pole)
+{
+	/* y[n] = x[n] + 0.5 * y[n-1], coefficients stored halved with a post shift of 1 */
+	static const q15_t coeffs[6] = {16384, 0, 0, 0, 8192, 0};
+	static const q15_t expected[4] = {16384, 8192, 4096, 2048};
+	q15_t state[4];
+	q15_t in[4] = {16384};
+	q15_t out[4];
+	struct zdsp_biquad_q15 biquad;
+
+	zdsp_biquad_init_q15(&biquad, 1, coeffs, state, 1);
+	zdsp_biquad_q15(&biquad, in, out, ARRAY_SIZE(in));
+
+	for (size_t i = 0; i < ARRAY_SIZE(out); i++) {
+		zassert_within(out[i], expected[i], 1, "sample %zu: %d", i, out[i]);
+	}
+}
+
+ZTEST(zdsp_filtering, test_biquad_f32_cascade)
+{
+	/* Two identical one pole stages give (n + 1) * 0.5^n */
+	static const float32_t coeffs[10] = {
+		1.0f, 0.0f, 0.0f, 0.5f, 0.0f,
+		1.0f, 0.0f, 0.0f, 0.5f, 0.0f,
+	};
+	static const float32_t expected[4] = {1.0f, 1.0f, 0.75f, 0.5f};
+	float32_t state[8];
+	float32_t in[4] = {1.0f};
+	float32_t out[4];
+	struct zdsp_biquad_f32 biquad;
+
+	zdsp_biquad_init_f32(&biquad, 2, coeffs, state);
+	zdsp_biquad_f32(&biquad, in, out, ARRAY_SIZE(in));
+
+	for (size_t i = 0; i < ARRAY_SIZE(out); i++) {
+		zassert_within(out[i], expected[i], 1e-6f, "sample %zu: %f", i, (double)out[i]);
+	}
+}
+
+ZTEST_SUITE(zdsp_filtering, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/dsp.h>
+
+ZTEST(zdsp_support, test_f32_to_q15_saturation)
+{
+	static const float32_t in[4] = {1.5f, -2.0f, 0.5f, -0.25f};
+	static const q15_t expected[4] = {INT16_MAX, INT16_MIN, 16384, -8192};
+	q15_t out[4];
+
+	zdsp_f32_to_q15(in, out, ARRAY_SIZE(in));
+
+	zassert_mem_equal(out, expected, sizeof(expected));
+}
+
+ZTEST(zdsp_support, test_f32_to_q31_saturation)
+{
+	static const float32_t in[4] = {1.5f, -2.0f, 0.5f, -0.25f};
+	static const q31_t expected[4] = {INT32_MAX, INT32_MIN, 1073741824, -536870912};
+	q31_t out[4];
+
+	zdsp_f32_to_q31(in, out, ARRAY_SIZE(in));
+
+	zassert_mem_equal(out, expected, sizeof(expected));
+}
+
+ZTEST(zdsp_support, test_q15_q31_round_trip)
+{
+	static const q15_t in[4] = {INT16_MIN, -1, 0, INT16_MAX};
+	q31_t wide[4];
+	q15_t out[4];
+
+	zdsp_q15_to_q31(in, wide, ARRAY_SIZE(in));
+	zassert_equal(wide[0], INT32_MIN);
+	zassert_equal(wide[3], (q31_t)0x7fff0000);
+
+	zdsp_q31_to_q15(wide, out, ARRAY_SIZE(wide));
+	zassert_mem_equal(out, in, sizeof(in));
+}
+
+ZTEST(zdsp_support, test_s24_round_trip)
+{
+	static const q31_t in[2] = {0x12345678, -256};
+	static const uint8_t packed[6] = {0x56, 0x34, 0x12, 0xff, 0xff, 0xff};
+	uint8_t bytes[6];
+	q31_t out[2];
+
+	zdsp_q31_to_s24(in, bytes, ARRAY_SIZE(in));
+	zassert_mem_equal(bytes, packed, sizeof(packed));
+
+	zdsp_s24_to_q31(bytes, out, ARRAY_SIZE(out));
+	zassert_equal(out[0], 0x12345600);
+	zassert_equal(out[1], -256);
+}
+
+ZTEST(zdsp_support, test_interleave_q15)
+{
+	static const q15_t left[3] = {1, 2, 3};
+	static const q15_t right[3] = {4, 5, 6};
+	static const q15_t expected[6] = {1, 4, 2, 5, 3, 6};
+	const q15_t *src[2] = {left, right};
+	q15_t out_left[3], out_right[3];
+	q15_t *dst[2] = {out_left, out_right};
+	q15_t frames[6];
+
+	zdsp_interleave_q15(src, 2, frames, ARRAY_SIZE(left));
+	zassert_mem_equal(frames, expected, sizeof(expected));
+
+	zdsp_deinterleave_q15(frames, 2, dst, ARRAY_SIZE(left));
+	zassert_mem_equal(out_left, left, sizeof(left));
+	zassert_mem_equal(out_right, right, sizeof(right));
+}
+
+ZTEST(zdsp_support, test_interleave_q31)
+{
+	static const q31_t ch[3][2] = {{1, 2}, {3, 4}, {5, 6}};
+	static const q31_t expected[6] = {1, 3, 5, 2, 4, 6};
+	const q31_t *src[3] = {ch[0], ch[1], ch[2]};
+	q31_t out[3][2];
+	q31_t *dst[3] = {out[0], out[1], out[2]};
+	q31_t frames[6];
+
+	zdsp_interleave_q31(src, 3, frames, 2);
+	zassert_mem_equal(frames, expected, sizeof(expected));
+
+	zdsp_deinterleave_q31(frames, 3, dst, 2);
+	zassert_mem_equal(out, ch, sizeof(ch));
+}
+
+ZTEST_SUITE(zdsp_support, NULL, NULL, NULL, NULL, NULL);
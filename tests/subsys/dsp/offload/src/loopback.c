@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Backend delivering the messages sent by one of its two endpoints to the other one, in the
+ * context of the sender, standing for the host and the remote cores.
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service_backend.h>
+
+#define DT_DRV_COMPAT vnd_ipc_loopback
+
+struct loopback_data {
+	const struct ipc_ept_cfg *cfg[2];
+};
+
+static int send(const struct device *instance, void *token, const void *data, size_t len)
+{
+	struct loopback_data *lb = instance->data;
+	const struct ipc_ept_cfg *peer = lb->cfg[1 - (uintptr_t)token];
+
+	if (peer == NULL) {
+		return -ENOTCONN;
+	}
+
+	peer->cb.received(data, len, peer->priv);
+
+	return len;
+}
+
+static int register_ept(const struct device *instance, void **token,
+			const struct ipc_ept_cfg *cfg)
+{
+	struct loopback_data *lb = instance->data;
+	uintptr_t idx = (lb->cfg[0] == NULL) ? 0 : 1;
+
+	if (lb->cfg[idx] != NULL) {
+		return -ENOMEM;
+	}
+
+	lb->cfg[idx] = cfg;
+	*token = (void *)idx;
+
+	if (idx == 1) {
+		for (int i = 0; i < 2; i++) {
+			if (lb->cfg[i]->cb.bound != NULL) {
+				lb->cfg[i]->cb.bound(lb->cfg[i]->priv);
+			}
+		}
+	}
+
+	return 0;
+}
+
+static const struct ipc_service_backend loopback_ops = {
+	.send = send,
+	.register_endpoint = register_ept,
+};
+
+static struct loopback_data loopback_data_0;
+
+DEVICE_DT_INST_DEFINE(0, NULL, NULL, &loopback_data_0, NULL, POST_KERNEL,
+		      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &loopback_ops);
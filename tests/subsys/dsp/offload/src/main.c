@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/dsp/offload.h>
+
+#define BLOCK    16
+#define NUM_TAPS 4
+#define TIMEOUT  K_SECONDS(1)
+
+static const q15_t fir_coeffs[NUM_TAPS] = {0x0800, 0x1000, 0x2000, 0x4000};
+static q15_t fir_state[NUM_TAPS + BLOCK];
+static q15_t ref_state[NUM_TAPS + BLOCK];
+static struct zdsp_offload_fir fir_ctx;
+
+static const q31_t biquad_coeffs[5] = {0x20000000, 0x10000000, 0, 0x08000000, 0};
+static q31_t biquad_state[4];
+static q31_t ref_biquad_state[4];
+static struct zdsp_offload_biquad biquad_ctx;
+
+static q15_t src_q15[BLOCK];
+static q15_t dst_q15[BLOCK];
+static q15_t ref_q15[BLOCK];
+static q31_t src_q31[BLOCK];
+static q31_t dst_q31[BLOCK];
+static q31_t ref_q31[BLOCK];
+
+static int user_run(const struct zdsp_offload_req *req)
+{
+	const uint8_t *src = req->src;
+	uint8_t *dst = req->dst;
+
+	if (req->dst_len < req->src_len) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < req->src_len; i++) {
+		dst[i] = src[i] + req->arg;
+	}
+
+	return req->src_len;
+}
+
+ZDSP_OFFLOAD_HANDLER_DEFINE(test_user_handler, ZDSP_OFFLOAD_OP_USER, user_run);
+
+static void *offload_setup(void)
+{
+	/* The endpoints are registered at the APPLICATION level */
+	zassert_equal(zdsp_offload_addr(NULL), UINT32_MAX);
+
+	return NULL;
+}
+
+/**
+ * @brief Test an offloaded FIR filter matches the local kernel across blocks
+ */
+ZTEST(zdsp_offload, test_fir_q15)
+{
+	struct zdsp_fir_q15 ref;
+	struct zdsp_offload_job job = {
+		.op = ZDSP_OFFLOAD_OP_FIR_Q15,
+		.src = src_q15,
+		.src_len = sizeof(src_q15),
+		.dst = dst_q15,
+		.dst_len = sizeof(dst_q15),
+		.ctx = &fir_ctx,
+		.ctx_len = sizeof(fir_ctx),
+		.arg = BLOCK,
+	};
+
+	memset(fir_state, 0, sizeof(fir_state));
+	fir_ctx.coeffs = zdsp_offload_addr(fir_coeffs);
+	fir_ctx.state = zdsp_offload_addr(fir_state);
+	fir_ctx.num_taps = NUM_TAPS;
+	zdsp_fir_init_q15(&ref, NUM_TAPS, fir_coeffs, ref_state, BLOCK);
+
+	/* The state carries over to the second block */
+	for (int block = 0; block < 2; block++) {
+		for (int i = 0; i < BLOCK; i++) {
+			src_q15[i] = (q15_t)((block * BLOCK + i) * 512 - 0x2000);
+		}
+
+		zassert_equal(zdsp_offload_run(&job, TIMEOUT), sizeof(dst_q15));
+		zdsp_fir_q15(&ref, src_q15, ref_q15, BLOCK);
+		zassert_mem_equal(dst_q15, ref_q15, sizeof(ref_q15));
+	}
+}
+
+/**
+ * @brief Test an offloaded biquad cascade matches the local kernel
+ */
+ZTEST(zdsp_offload, test_biquad_q31)
+{
+	struct zdsp_biquad_q31 ref = {
+		.coeffs = biquad_coeffs,
+		.state = ref_biquad_state,
+		.num_stages = 1,
+		.post_shift = 1,
+	};
+	struct zdsp_offload_job job = {
+		.op = ZDSP_OFFLOAD_OP_BIQUAD_Q31,
+		.src = src_q31,
+		.src_len = sizeof(src_q31),
+		.dst = dst_q31,
+		.dst_len = sizeof(dst_q31),
+		.ctx = &biquad_ctx,
+		.ctx_len = sizeof(biquad_ctx),
+		.arg = BLOCK,
+	};
+
+	biquad_ctx.coeffs = zdsp_offload_addr(biquad_coeffs);
+	biquad_ctx.state = zdsp_offload_addr(biquad_state);
+	biquad_ctx.num_stages = 1;
+	biquad_ctx.post_shift = 1;
+
+	for (int i = 0; i < BLOCK; i++) {
+		src_q31[i] = (i & 1) ? 0x10000000 : -0x08000000;
+	}
+
+	zassert_equal(zdsp_offload_run(&job, TIMEOUT), sizeof(dst_q31));
+	zdsp_biquad_q31(&ref, src_q31, ref_q31, BLOCK);
+	zassert_mem_equal(dst_q31, ref_q31, sizeof(ref_q31));
+}
+
+static K_SEM_DEFINE(user_done, 0, 1);
+
+static void user_complete(struct zdsp_offload_job *job)
+{
+	zassert_equal_ptr(job->user_data, &user_done);
+	k_sem_give(job->user_data);
+}
+
+/**
+ * @brief Test an asynchronous job run by an application handler
+ */
+ZTEST(zdsp_offload, test_user_handler)
+{
+	static uint8_t src[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	static uint8_t dst[8];
+	struct zdsp_offload_job job = {
+		.op = ZDSP_OFFLOAD_OP_USER,
+		.src = src,
+		.src_len = sizeof(src),
+		.dst = dst,
+		.dst_len = sizeof(dst),
+		.arg = 10,
+		.cb = user_complete,
+		.user_data = &user_done,
+	};
+
+	zassert_ok(zdsp_offload_submit(&job));
+	zassert_ok(k_sem_take(&user_done, TIMEOUT));
+	zassert_equal(job.result, sizeof(dst));
+	for (int i = 0; i < ARRAY_SIZE(dst); i++) {
+		zassert_equal(dst[i], src[i] + 10);
+	}
+}
+
+/**
+ * @brief Test the errors of jobs reported by the remote
+ */
+ZTEST(zdsp_offload, test_errors)
+{
+	struct zdsp_offload_job job = {
+		.op = ZDSP_OFFLOAD_OP_LC3_ENCODE,
+		.src = src_q15,
+		.src_len = sizeof(src_q15),
+		.dst = dst_q15,
+		.dst_len = sizeof(dst_q15),
+	};
+
+	/* No LC3 handler provided by this application */
+	zassert_equal(zdsp_offload_run(&job, TIMEOUT), -ENOTSUP);
+
+	/* FIR without context */
+	job.op = ZDSP_OFFLOAD_OP_FIR_Q15;
+	job.arg = BLOCK;
+	zassert_equal(zdsp_offload_run(&job, TIMEOUT), -EINVAL);
+
+	/* Output too small for the block */
+	job.ctx = &fir_ctx;
+	job.ctx_len = sizeof(fir_ctx);
+	job.dst_len = sizeof(dst_q15) / 2;
+	zassert_equal(zdsp_offload_run(&job, TIMEOUT), -EINVAL);
+}
+
+ZTEST_SUITE(zdsp_offload, NULL, offload_setup, NULL, NULL, NULL);
@@ -269,6 +269,95 @@ static int test_file_delete(void)
 	return res;
 }
 
+#ifdef CONFIG_FS_FATFS_PREALLOCATE
+static int test_file_preallocate(void)
+{
+	int res;
+	ssize_t brw;
+	struct fs_dirent entry;
+	uint8_t buff[100];
+	const off_t length = 16 * 512;
+	const int chunks = 50;
+
+	TC_PRINT("\nPreallocate tests:\n");
+
+	res = fs_open(&filep, TEST_FILE, FS_O_CREATE | FS_O_RDWR);
+	if (res) {
+		TC_PRINT("Failed opening file [%d]\n", res);
+		return res;
+	}
+
+	/* Verify fs_preallocate() */
+	res = fs_preallocate(&filep, length);
+	if (res) {
+		TC_PRINT("Failed preallocating file [%d]\n", res);
+		fs_close(&filep);
+		return res;
+	}
+
+	/* Only an empty file can be preallocated */
+	res = fs_preallocate(&filep, length);
+	if (res != -EACCES) {
+		TC_PRINT("Preallocating a non empty file returned [%d]\n", res);
+		fs_close(&filep);
+		return TC_FAIL;
+	}
+
+	/* Write in small chunks */
+	for (int i = 0; i < chunks; i++) {
+		memset(buff, i, sizeof(buff));
+		brw = fs_write(&filep, buff, sizeof(buff));
+		if (brw != sizeof(buff)) {
+			TC_PRINT("Failed writing to file [%zd]\n", brw);
+			fs_close(&filep);
+			return TC_FAIL;
+		}
+	}
+
+	if (fs_tell(&filep) != (chunks * sizeof(buff))) {
+		TC_PRINT("Wrong position after writes\n");
+		fs_close(&filep);
+		return TC_FAIL;
+	}
+
+	res = fs_truncate(&filep, fs_tell(&filep));
+	if (res) {
+		TC_PRINT("Failed truncating file [%d]\n", res);
+		fs_close(&filep);
+		return res;
+	}
+
+	res = fs_close(&filep);
+	if (res) {
+		TC_PRINT("Error closing file [%d]\n", res);
+		return res;
+	}
+
+	res = fs_stat(TEST_FILE, &entry);
+	if (res || (entry.size != (chunks * sizeof(buff)))) {
+		TC_PRINT("Wrong file size after truncation\n");
+		return TC_FAIL;
+	}
+
+	res = fs_open(&filep, TEST_FILE, FS_O_READ);
+	if (res) {
+		TC_PRINT("Failed opening file [%d]\n", res);
+		return res;
+	}
+
+	for (int i = 0; i < chunks; i++) {
+		brw = fs_read(&filep, buff, sizeof(buff));
+		if ((brw != sizeof(buff)) || (buff[0] != i) || (buff[sizeof(buff) - 1] != i)) {
+			TC_PRINT("Data read does not match data written\n");
+			fs_close(&filep);
+			return TC_FAIL;
+		}
+	}
+
+	return fs_close(&filep);
+}
+#endif /* CONFIG_FS_FATFS_PREALLOCATE */
+
 void test_fat_file(void)
 {
 	zassert_true(test_file_open() == TC_PASS);
@@ -278,4 +367,8 @@ void test_fat_file(void)
 	zassert_true(test_file_truncate() == TC_PASS);
 	zassert_true(test_file_close() == TC_PASS);
 	zassert_true(test_file_delete() == TC_PASS);
+#ifdef CONFIG_FS_FATFS_PREALLOCATE
+	zassert_true(test_file_preallocate() == TC_PASS);
+	zassert_true(test_file_delete() == TC_PASS);
+#endif
 }
@@ -9,4 +9,13 @@
 #include "testfs_tests.h"
 #include "testfs_lfs.h"
 
-ZTEST_SUITE(littlefs, NULL, NULL, NULL, NULL, NULL);
+static void *littlefs_setup(void)
+{
+	if (IS_ENABLED(CONFIG_FS_LITTLEFS_FMP_XIP_READ) && IS_ENABLED(CONFIG_FLASH_SIMULATOR)) {
+		testfs_lfs_xip_setup();
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(littlefs, NULL, littlefs_setup, NULL, NULL, NULL);
@@ -7,6 +7,9 @@
 #include <zephyr/ztest.h>
 #include <zephyr/fs/littlefs.h>
 #include <zephyr/storage/flash_map.h>
+#ifdef CONFIG_FLASH_SIMULATOR
+#include <zephyr/drivers/flash/flash_simulator.h>
+#endif
 #include "testfs_lfs.h"
 
 #define SMALL_PARTITION		small_partition
@@ -27,8 +30,16 @@ struct fs_mount_t testfs_small_mnt = {
 };
 
 #if CONFIG_APP_TEST_CUSTOM
+#if CONFIG_FS_LITTLEFS_HEAP_BUFFERS
+/* Two caches, the lookahead buffer and a cache per open file */
+static K_HEAP_DEFINE(medium_heap, (2 + CONFIG_FS_LITTLEFS_NUM_FILES) * (MEDIUM_CACHE_SIZE + 32) +
+				  MEDIUM_LOOKAHEAD_SIZE + 32);
+FS_LITTLEFS_DECLARE_HEAP_CONFIG(medium, &medium_heap, MEDIUM_IO_SIZE, MEDIUM_IO_SIZE,
+				MEDIUM_CACHE_SIZE, MEDIUM_LOOKAHEAD_SIZE);
+#else
 FS_LITTLEFS_DECLARE_CUSTOM_CONFIG(medium, 4, MEDIUM_IO_SIZE, MEDIUM_IO_SIZE,
 				  MEDIUM_CACHE_SIZE, MEDIUM_LOOKAHEAD_SIZE);
+#endif /* CONFIG_FS_LITTLEFS_HEAP_BUFFERS */
 struct fs_mount_t testfs_medium_mnt = {
 	.type = FS_LITTLEFS,
 	.fs_data = &medium,
@@ -59,6 +70,22 @@ struct fs_mount_t testfs_large_mnt = {
 
 #endif /* CONFIG_APP_TEST_CUSTOM */
 
+#if defined(CONFIG_FS_LITTLEFS_FMP_XIP_READ) && defined(CONFIG_FLASH_SIMULATOR)
+void testfs_lfs_xip_setup(void)
+{
+	const struct flash_area *pfa;
+	size_t size;
+	uint8_t *mem;
+
+	zassert_ok(flash_area_open(SMALL_PARTITION_ID, &pfa));
+	/* Simulated flash memory stands in for the memory mapped window */
+	mem = flash_simulator_get_memory(flash_area_get_device(pfa), &size);
+	zassert_not_null(mem);
+	small.xip_base = mem + pfa->fa_off;
+	flash_area_close(pfa);
+}
+#endif /* CONFIG_FS_LITTLEFS_FMP_XIP_READ && CONFIG_FLASH_SIMULATOR */
+
 int testfs_lfs_wipe_partition(const struct fs_mount_t *mp)
 {
 	unsigned int id = (uintptr_t)mp->storage_dev;
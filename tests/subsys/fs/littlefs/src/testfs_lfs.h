@@ -38,4 +38,9 @@ extern struct fs_mount_t testfs_large_mnt;
  */
 int testfs_lfs_wipe_partition(const struct fs_mount_t *mp);
 
+/** Serve reads of the small partition from the simulated flash memory,
+ * standing in for a memory mapped flash.
+ */
+void testfs_lfs_xip_setup(void);
+
 #endif /* _ZEPHYR_TESTS_SUBSYS_FS_LITTLEFS_TESTFS_LFS_H_ */
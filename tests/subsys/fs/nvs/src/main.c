@@ -904,6 +904,49 @@ ZTEST_F(nvs, test_nvs_cache_gc)
 #endif
 }
 
+/*
+ * Test that the garbage collection runs in the background once a write leaves
+ * less free space than the threshold in the active sector.
+ */
+ZTEST_F(nvs, test_nvs_background_gc)
+{
+#ifdef CONFIG_NVS_BACKGROUND_GC
+	int err;
+	uint16_t data = 0;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* Write until the free space of the first sector drops below the threshold */
+
+	while ((fixture->fs.ate_wra - fixture->fs.data_wra) >=
+	       CONFIG_NVS_BACKGROUND_GC_THRESHOLD) {
+		++data;
+		err = nvs_write(&fixture->fs, 1, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0,
+		      "sector switched by a write");
+
+	/* Let the work queue collect the garbage */
+
+	k_msleep(100);
+
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1,
+		      "sector not switched in the background");
+	zassert_true((fixture->fs.ate_wra - fixture->fs.data_wra) >=
+		     CONFIG_NVS_BACKGROUND_GC_THRESHOLD,
+		     "no free space after background gc");
+
+	uint16_t rd_data;
+
+	err = nvs_read(&fixture->fs, 1, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "nvs_read call failure: %d", err);
+	zassert_equal(rd_data, data, "incorrect data read");
+#endif
+}
+
 /*
  * Test NVS lookup cache hash quality.
  */
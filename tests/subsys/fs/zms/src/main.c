@@ -832,6 +832,93 @@ ZTEST_F(zms, test_zms_cache_gc)
 #endif
 }
 
+/*
+ * Test that the garbage collection runs in the background once a write leaves
+ * less free space than the threshold in the active sector.
+ */
+ZTEST_F(zms, test_zms_background_gc)
+{
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	int err;
+	uint16_t data = 0;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	/* Write until the free space of the first sector drops below the threshold */
+
+	while ((fixture->fs.ate_wra - fixture->fs.data_wra) >=
+	       CONFIG_ZMS_BACKGROUND_GC_THRESHOLD) {
+		++data;
+		err = zms_write(&fixture->fs, 1, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0,
+		      "sector switched by a write");
+
+	/* Let the work queue collect the garbage */
+
+	k_msleep(100);
+
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1,
+		      "sector not switched in the background");
+	zassert_true((fixture->fs.ate_wra - fixture->fs.data_wra) >=
+		     CONFIG_ZMS_BACKGROUND_GC_THRESHOLD,
+		     "no free space after background gc");
+
+	uint16_t rd_data;
+
+	err = zms_read(&fixture->fs, 1, &rd_data, sizeof(rd_data));
+	zassert_equal(err, sizeof(rd_data), "zms_read call failure: %d", err);
+	zassert_equal(rd_data, data, "incorrect data read");
+#endif
+}
+
+/*
+ * Test that the lookup cache loaded from its checkpoint at mount matches the
+ * lookup cache before the remount.
+ */
+ZTEST_F(zms, test_zms_cache_checkpoint)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_CHECKPOINT
+	int err;
+	uint32_t data;
+	static uint64_t cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	/* Write until the garbage collection ran at least twice */
+
+	for (data = 0; (fixture->fs.ate_wra >> ADDR_SECT_SHIFT) < 3; data++) {
+		err = zms_write(&fixture->fs, data % (2 * CONFIG_ZMS_LOOKUP_CACHE_SIZE), &data,
+				sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	/* A few more entries to replay after the checkpoint */
+
+	for (uint32_t i = 0; i < 4; i++, data++) {
+		err = zms_write(&fixture->fs, data % (2 * CONFIG_ZMS_LOOKUP_CACHE_SIZE), &data,
+				sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	err = zms_write(&fixture->fs, ZMS_LOOKUP_CACHE_CKPT_ID, &data, sizeof(data));
+	zassert_equal(err, -EINVAL, "zms_write with reserved ID succeeded: %d", err);
+
+	memcpy(cache, fixture->fs.lookup_cache, sizeof(cache));
+	memset(fixture->fs.lookup_cache, 0xAA, sizeof(fixture->fs.lookup_cache));
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	zassert_mem_equal(cache, fixture->fs.lookup_cache, sizeof(cache),
+			  "lookup cache differs after mount");
+#endif
+}
+
 /*
  * Test ZMS lookup cache hash quality.
  */
@@ -84,6 +84,67 @@ ZTEST(input_api, test_sequence_thread)
 	zassert_equal(message_count_unfiltered, CONFIG_INPUT_QUEUE_MAX_MSGS + 1);
 }
 
+#ifdef CONFIG_INPUT_BATCH_CALLBACK
+
+#define BATCH_SIZE 4
+
+static const struct device batch_dev;
+static K_SEM_DEFINE(batch_done, 0, 2);
+static struct input_event batch_events[BATCH_SIZE];
+static size_t batch_count;
+
+static void input_cb_batch(const struct input_event *evts, size_t count, void *user_data)
+{
+	TC_PRINT("%s: %zu\n", __func__, count);
+
+	memcpy(batch_events, evts, count * sizeof(*evts));
+	batch_count = count;
+
+	k_sem_give(&batch_done);
+}
+INPUT_BATCH_CALLBACK_DEFINE(&batch_dev, input_cb_batch, NULL, BATCH_SIZE);
+
+ZTEST(input_api, test_batch_thread)
+{
+	/* relative values are added up */
+	input_report_rel(&batch_dev, INPUT_REL_X, 3, false, K_FOREVER);
+	input_report_rel(&batch_dev, INPUT_REL_X, 4, false, K_FOREVER);
+	input_report_rel(&batch_dev, INPUT_REL_Y, 1, true, K_FOREVER);
+
+	zassert_ok(k_sem_take(&batch_done, K_SECONDS(1)));
+	zassert_equal(batch_count, 2);
+	zassert_equal(batch_events[0].code, INPUT_REL_X);
+	zassert_equal(batch_events[0].value, 7);
+	zassert_false(batch_events[0].sync);
+	zassert_equal(batch_events[1].code, INPUT_REL_Y);
+	zassert_equal(batch_events[1].value, 1);
+	zassert_true(batch_events[1].sync);
+
+	/* absolute values are replaced, including the sync bit */
+	input_report_abs(&batch_dev, INPUT_ABS_X, 10, false, K_FOREVER);
+	input_report_abs(&batch_dev, INPUT_ABS_X, 20, true, K_FOREVER);
+
+	zassert_ok(k_sem_take(&batch_done, K_SECONDS(1)));
+	zassert_equal(batch_count, 1);
+	zassert_equal(batch_events[0].type, INPUT_EV_ABS);
+	zassert_equal(batch_events[0].value, 20);
+	zassert_true(batch_events[0].sync);
+
+	/* a full buffer is delivered before the sync */
+	for (int i = 0; i < BATCH_SIZE; i++) {
+		input_report_key(&batch_dev, i, 1, false, K_FOREVER);
+	}
+	input_report_key(&batch_dev, BATCH_SIZE, 1, true, K_FOREVER);
+
+	zassert_ok(k_sem_take(&batch_done, K_SECONDS(1)));
+	zassert_ok(k_sem_take(&batch_done, K_SECONDS(1)));
+	zassert_equal(batch_count, 1);
+	zassert_equal(batch_events[0].code, BATCH_SIZE);
+	zassert_true(batch_events[0].sync);
+}
+
+#endif /* CONFIG_INPUT_BATCH_CALLBACK */
+
 #else /* CONFIG_INPUT_MODE_THREAD */
 
 static void input_cb_filtered(struct input_event *evt, void *user_data)
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/mbox.h>
+#include <zephyr/ipc/icmsg.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/*
+ * Two icmsg instances connected back to back on the same CPU: the local one
+ * sends, the remote one receives. An emulated MBOX forwards the notifications.
+ * With CONFIG_TEST_ICMSG_RX_POLL, the remote instance is polled instead.
+ */
+
+#define SHM_SIZE     256
+#define MBOX_CHANNELS 2
+#define TO_REMOTE    0
+#define TO_LOCAL     1
+
+static uint8_t shm_to_remote[SHM_SIZE] __aligned(8);
+static uint8_t shm_to_local[SHM_SIZE] __aligned(8);
+
+static PBUF_MAYBE_CONST struct pbuf_cfg local_tx_cfg =
+	PBUF_CFG_INIT(shm_to_remote, SHM_SIZE, 0, 1);
+static PBUF_MAYBE_CONST struct pbuf_cfg local_rx_cfg =
+	PBUF_CFG_INIT(shm_to_local, SHM_SIZE, 0, 1);
+static PBUF_MAYBE_CONST struct pbuf_cfg remote_tx_cfg =
+	PBUF_CFG_INIT(shm_to_local, SHM_SIZE, 0, 1);
+static PBUF_MAYBE_CONST struct pbuf_cfg remote_rx_cfg =
+	PBUF_CFG_INIT(shm_to_remote, SHM_SIZE, 0, 1);
+
+static struct pbuf local_tx_pb = { .cfg = &local_tx_cfg };
+static struct pbuf local_rx_pb = { .cfg = &local_rx_cfg };
+static struct pbuf remote_tx_pb = { .cfg = &remote_tx_cfg };
+static struct pbuf remote_rx_pb = { .cfg = &remote_rx_cfg };
+
+/* Emulated MBOX, a message sent on a channel calls the callback of that channel */
+struct fake_mbox_channel {
+	mbox_callback_t cb;
+	void *user_data;
+	bool enabled;
+};
+
+static struct fake_mbox_channel fake_mbox_channels[MBOX_CHANNELS];
+
+static int fake_mbox_send(const struct device *dev, mbox_channel_id_t channel_id,
+			  const struct mbox_msg *msg)
+{
+	struct fake_mbox_channel *channel = &fake_mbox_channels[channel_id];
+
+	if (msg != NULL) {
+		return -EMSGSIZE;
+	}
+
+	if (channel->enabled && channel->cb != NULL) {
+		channel->cb(dev, channel_id, channel->user_data, NULL);
+	}
+
+	return 0;
+}
+
+static int fake_mbox_register_callback(const struct device *dev, mbox_channel_id_t channel_id,
+				       mbox_callback_t cb, void *user_data)
+{
+	ARG_UNUSED(dev);
+
+	fake_mbox_channels[channel_id].cb = cb;
+	fake_mbox_channels[channel_id].user_data = user_data;
+
+	return 0;
+}
+
+static int fake_mbox_mtu_get(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static uint32_t fake_mbox_max_channels_get(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return MBOX_CHANNELS;
+}
+
+static int fake_mbox_set_enabled(const struct device *dev, mbox_channel_id_t channel_id,
+				 bool enabled)
+{
+	ARG_UNUSED(dev);
+
+	fake_mbox_channels[channel_id].enabled = enabled;
+
+	return 0;
+}
+
+static DEVICE_API(mbox, fake_mbox_api) = {
+	.send = fake_mbox_send,
+	.register_callback = fake_mbox_register_callback,
+	.mtu_get = fake_mbox_mtu_get,
+	.max_channels_get = fake_mbox_max_channels_get,
+	.set_enabled = fake_mbox_set_enabled,
+};
+
+DEVICE_DEFINE(fake_mbox, "fake_mbox", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_mbox_api);
+
+static const struct icmsg_config_t local_conf = {
+	.mbox_tx = { .dev = DEVICE_GET(fake_mbox), .channel_id = TO_REMOTE },
+	.mbox_rx = { .dev = DEVICE_GET(fake_mbox), .channel_id = TO_LOCAL },
+	.unbound_mode = ICMSG_UNBOUND_MODE_ENABLE,
+};
+
+static const struct icmsg_config_t remote_conf = {
+	.mbox_tx = { .dev = DEVICE_GET(fake_mbox), .channel_id = TO_LOCAL },
+	.mbox_rx = { .dev = DEVICE_GET(fake_mbox), .channel_id = TO_REMOTE },
+	.unbound_mode = ICMSG_UNBOUND_MODE_ENABLE,
+	.rx_poll = IS_ENABLED(CONFIG_TEST_ICMSG_RX_POLL),
+};
+
+static struct icmsg_data_t local_data = { .tx_pb = &local_tx_pb, .rx_pb = &local_rx_pb };
+static struct icmsg_data_t remote_data = { .tx_pb = &remote_tx_pb, .rx_pb = &remote_rx_pb };
+
+static K_SEM_DEFINE(local_bound_sem, 0, 1);
+static K_SEM_DEFINE(remote_bound_sem, 0, 1);
+static K_SEM_DEFINE(recv_sem, 0, 8);
+
+/* Last message received by the remote instance */
+static const void *recv_data;
+static size_t recv_len;
+static char recv_copy[32];
+static bool recv_in_place;
+static bool hold_next;
+static int hold_ret;
+
+static bool in_shared_memory(const void *data)
+{
+	return (const uint8_t *)data >= shm_to_remote &&
+	       (const uint8_t *)data < shm_to_remote + SHM_SIZE;
+}
+
+static void local_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&local_bound_sem);
+}
+
+static void remote_bound(void *priv)
+{
+	ARG_UNUSED(priv);
+
+	k_sem_give(&remote_bound_sem);
+}
+
+static void remote_received(const void *data, size_t len, void *priv)
+{
+	ARG_UNUSED(priv);
+
+	recv_data = data;
+	recv_in_place = in_shared_memory(data);
+	recv_len = MIN(len, sizeof(recv_copy));
+	memcpy(recv_copy, data, recv_len);
+
+	if (hold_next) {
+		hold_next = false;
+		hold_ret = icmsg_hold_rx_buffer(&remote_conf, &remote_data, data);
+	}
+
+	k_sem_give(&recv_sem);
+}
+
+static const struct ipc_service_cb local_cb = {
+	.bound = local_bound,
+};
+
+static const struct ipc_service_cb remote_cb = {
+	.bound = remote_bound,
+	.received = remote_received,
+};
+
+/* Wait for a callback of the remote instance, polling it if needed */
+static int remote_wait(struct k_sem *sem)
+{
+	if (!remote_conf.rx_poll) {
+		return k_sem_take(sem, K_MSEC(100));
+	}
+
+	for (int i = 0; i < 10; i++) {
+		zassert_ok(icmsg_poll(&remote_conf, &remote_data));
+
+		if (k_sem_take(sem, K_MSEC(10)) == 0) {
+			return 0;
+		}
+	}
+
+	return -EAGAIN;
+}
+
+static void send_str(const char *str)
+{
+	zassert_equal(icmsg_send(&local_conf, &local_data, str, strlen(str)), strlen(str),
+		      "Message not sent");
+}
+
+static void recv_str(const char *str)
+{
+	zassert_ok(remote_wait(&recv_sem), "Message not received");
+	zassert_equal(recv_len, strlen(str), "Wrong length");
+	zassert_mem_equal(recv_copy, str, recv_len, "Wrong message");
+}
+
+static void *icmsg_setup(void)
+{
+	zassert_ok(icmsg_open(&remote_conf, &remote_data, &remote_cb, NULL));
+	zassert_ok(icmsg_open(&local_conf, &local_data, &local_cb, NULL));
+
+	zassert_ok(remote_wait(&remote_bound_sem), "Remote instance not bound");
+	zassert_ok(k_sem_take(&local_bound_sem, K_MSEC(100)), "Local instance not bound");
+
+	return NULL;
+}
+
+static void icmsg_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&recv_sem);
+	hold_next = false;
+	hold_ret = -EINVAL;
+}
+
+ZTEST_SUITE(icmsg, NULL, icmsg_setup, icmsg_before, NULL, NULL);
+
+/**
+ * @brief Test receiving messages in place, in the shared memory
+ */
+ZTEST(icmsg, test_rx_in_place)
+{
+	send_str("in place");
+	recv_str("in place");
+	zassert_true(recv_in_place, "Message copied out of the shared memory");
+}
+
+/**
+ * @brief Test holding and releasing a received message
+ *
+ * @details No further message is delivered while a message is held, and the
+ * held message stays valid until it is released.
+ */
+ZTEST(icmsg, test_rx_hold_release)
+{
+	const void *held;
+
+	hold_next = true;
+	send_str("first");
+	send_str("second");
+
+	recv_str("first");
+	zassert_ok(hold_ret, "Message not held");
+	held = recv_data;
+
+	zassert_equal(remote_wait(&recv_sem), -EAGAIN,
+		      "Message delivered while another one is held");
+	zassert_mem_equal(held, "first", strlen("first"), "Held message overwritten");
+	zassert_equal(icmsg_hold_rx_buffer(&remote_conf, &remote_data, held), -EALREADY);
+
+	zassert_ok(icmsg_release_rx_buffer(&remote_conf, &remote_data, held));
+	recv_str("second");
+
+	zassert_equal(icmsg_release_rx_buffer(&remote_conf, &remote_data, held), -EALREADY,
+		      "Message released twice");
+}
+
+/**
+ * @brief Test receiving messages wrapping around the end of the RX region
+ *
+ * @details Such messages are copied and cannot be held. Messages are consumed
+ * once released, so that many more messages than fit in the RX region at once
+ * can be sent.
+ */
+ZTEST(icmsg, test_rx_wrap)
+{
+	char msg[] = "message 0";
+	int copied = 0;
+
+	for (int i = 0; i < 3 * SHM_SIZE / sizeof(msg); i++) {
+		msg[sizeof(msg) - 2] = '0' + i % 10;
+		hold_next = true;
+		send_str(msg);
+		recv_str(msg);
+
+		if (recv_in_place) {
+			zassert_ok(hold_ret, "Message %d not held", i);
+			zassert_ok(icmsg_release_rx_buffer(&remote_conf, &remote_data, recv_data));
+		} else {
+			zassert_equal(hold_ret, -ENOTSUP, "Copied message %d held", i);
+			copied++;
+		}
+	}
+
+	zassert_true(copied > 0, "No message wrapped around the end of the RX region");
+}
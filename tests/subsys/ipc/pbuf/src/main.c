@@ -106,6 +106,106 @@ ZTEST(test_pbuf, test_rw)
 	zassert_mem_equal(write_buf, read_buf, MPS);
 }
 
+/* Nocopy write and read tests. */
+ZTEST(test_pbuf, test_nocopy)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	volatile char *rbuf;
+	char *wbuf;
+	uint16_t len;
+	int ret;
+
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+
+	/* Packet written with a copy is read in place. */
+	ret = pbuf_write(&pb, write_buf, MSGA_SZ);
+	zassert_equal(ret, MSGA_SZ);
+	ret = pbuf_read_nocopy(&pb, &rbuf);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_mem_equal((char *)rbuf, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_read_done(&pb), 0);
+	zassert_equal(pbuf_read_nocopy(&pb, &rbuf), 0);
+
+	/* Packet bigger than the buffer can hold. */
+	len = MPS + 1;
+	zassert_equal(pbuf_tx_reserve(&pb, &len, &wbuf), -ENOMEM);
+
+	/* Packet written in place is read in place. */
+	len = MSGB_SZ;
+	zassert_equal(pbuf_tx_reserve(&pb, &len, &wbuf), 0);
+	memcpy(wbuf, write_buf, MSGB_SZ);
+	zassert_equal(pbuf_tx_commit(&pb, wbuf, MSGB_SZ), MSGB_SZ);
+	ret = pbuf_read_nocopy(&pb, &rbuf);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_equal((char *)rbuf, wbuf);
+	zassert_equal(pbuf_read_done(&pb), 0);
+
+	/* Not enough space before wrapping nor at the beginning of the buffer. */
+	len = MPS;
+	zassert_equal(pbuf_tx_reserve(&pb, &len, &wbuf), -ENOBUFS);
+	zassert_true(len < MPS);
+
+	/* Move indexes close to the end of the buffer. */
+	ret = pbuf_write(&pb, write_buf, 180);
+	zassert_equal(ret, 180);
+	zassert_equal(pbuf_read(&pb, read_buf, sizeof(read_buf)), 180);
+
+	/* Wrapping packet is reserved at the beginning of the buffer. */
+	len = 2 * MSGB_SZ;
+	zassert_equal(pbuf_tx_reserve(&pb, &len, &wbuf), 0);
+	zassert_equal(wbuf, (char *)cfg.data_loc);
+	memcpy(wbuf, write_buf, 2 * MSGB_SZ);
+	zassert_equal(pbuf_tx_commit(&pb, wbuf, 2 * MSGB_SZ), 2 * MSGB_SZ);
+
+	/* Wrapping packet can only be read with a copy. */
+	zassert_equal(pbuf_read_nocopy(&pb, &rbuf), -EFBIG);
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, 2 * MSGB_SZ);
+	zassert_mem_equal(read_buf, write_buf, 2 * MSGB_SZ);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+}
+
+/* Unread bytes seen by the writer. */
+ZTEST(test_pbuf, test_tx_pending)
+{
+	uint8_t read_buf[MEM_AREA_SZ];
+	uint8_t write_buf[MSGB_SZ] = {0};
+
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+	zassert_equal(pbuf_tx_pending(&pb), 0);
+
+	/* Headers and padding are counted. */
+	zassert_equal(pbuf_write(&pb, write_buf, MSGA_SZ), MSGA_SZ);
+	zassert_equal(pbuf_tx_pending(&pb), PBUF_PACKET_LEN_SZ + ROUND_UP(MSGA_SZ, 4));
+
+	zassert_equal(pbuf_write(&pb, write_buf, MSGB_SZ), MSGB_SZ);
+	zassert_equal(pbuf_tx_pending(&pb), 2 * PBUF_PACKET_LEN_SZ + ROUND_UP(MSGA_SZ, 4) +
+					    ROUND_UP(MSGB_SZ, 4));
+
+	zassert_equal(pbuf_read(&pb, read_buf, sizeof(read_buf)), MSGA_SZ);
+	zassert_equal(pbuf_tx_pending(&pb), PBUF_PACKET_LEN_SZ + ROUND_UP(MSGB_SZ, 4));
+
+	zassert_equal(pbuf_read(&pb, read_buf, sizeof(read_buf)), MSGB_SZ);
+	zassert_equal(pbuf_tx_pending(&pb), 0);
+}
+
 /* API ret codes tests. */
 ZTEST(test_pbuf, test_retcodes)
 {
@@ -477,6 +477,62 @@ ZTEST(llext, test_pre_located)
 }
 #endif
 
+/*
+ * Executing in place needs persistent storage and excludes pre-located
+ * extensions; both are checked before anything is read from the loader.
+ */
+ZTEST(llext, test_xip_param)
+{
+	static const uint8_t empty[4];
+	struct llext_buf_loader temp_loader = LLEXT_TEMPORARY_BUF_LOADER(empty, sizeof(empty));
+	struct llext_buf_loader persist_loader =
+		LLEXT_PERSISTENT_BUF_LOADER(empty, sizeof(empty));
+	struct llext_load_param ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	struct llext *ext = NULL;
+
+	ldr_parm.xip = true;
+	zassert_equal(llext_load(&temp_loader.loader, "xip", &ext, &ldr_parm), -EINVAL,
+		      "temporary storage cannot execute in place");
+	zassert_is_null(ext);
+
+	ldr_parm.pre_located = true;
+	zassert_equal(llext_load(&persist_loader.loader, "xip", &ext, &ldr_parm), -EINVAL,
+		      "pre-located extensions cannot execute in place");
+	zassert_is_null(ext);
+}
+
+#if !defined(CONFIG_MPU) && !defined(CONFIG_MMU) && !defined(CONFIG_RISCV_PMP)
+static LLEXT_CONST uint8_t xip_ext[] ELF_ALIGN = {
+	#include "xip.inc"
+};
+
+/*
+ * An extension executed in place shall run its text from the ELF buffer,
+ * which is why memory protection, leaving the buffer non-executable, is
+ * excluded.
+ */
+ZTEST(llext, test_xip)
+{
+	struct llext_buf_loader buf_loader = LLEXT_PERSISTENT_BUF_LOADER(xip_ext, sizeof(xip_ext));
+	struct llext_load_param ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	struct llext *ext = NULL;
+	int (*test_xip_fn)(int a, int b);
+
+	ldr_parm.xip = true;
+	zassert_ok(llext_load(&buf_loader.loader, "xip", &ext, &ldr_parm), "load should succeed");
+
+	test_xip_fn = llext_find_sym(&ext->exp_tab, "test_xip");
+	zassert_not_null(test_xip_fn, "test_xip should be an exported symbol");
+	zassert_true((uintptr_t)test_xip_fn >= (uintptr_t)xip_ext &&
+		     (uintptr_t)test_xip_fn < (uintptr_t)xip_ext + sizeof(xip_ext),
+		     "test_xip should be in the ELF buffer");
+	zassert_false(ext->mem_on_heap[LLEXT_MEM_TEXT], "text should not be on the heap");
+	zassert_equal(test_xip_fn(40, 2), 42, "test_xip should run in place");
+
+	llext_unload(&ext);
+}
+#endif
+
 #if defined(CONFIG_LLEXT_STORAGE_WRITABLE)
 static LLEXT_CONST uint8_t find_section_ext[] ELF_ALIGN = {
 	#include "find_section.inc"
@@ -643,6 +699,10 @@ ZTEST(llext, test_printk_exported)
 	const void * const printk_fn = LLEXT_FIND_BUILTIN_SYM(printk);
 
 	zassert_equal(printk_fn, printk, "printk should be an exported symbol");
+
+	/* Served from the symbol cache when enabled */
+	zassert_equal(LLEXT_FIND_BUILTIN_SYM(printk), printk,
+		      "printk should be found again");
 }
 
 /*
@@ -656,6 +716,10 @@ ZTEST(llext, test_ext_syscall_fail)
 	const void * const esf_fn = LLEXT_FIND_BUILTIN_SYM(z_impl_ext_syscall_fail);
 
 	zassert_is_null(esf_fn, "est_fn should be NULL");
+
+	/* A symbol not found shall not be cached as another */
+	zassert_is_null(LLEXT_FIND_BUILTIN_SYM(z_impl_ext_syscall_fail),
+			"est_fn should still be NULL");
 }
 
 #ifdef CONFIG_LLEXT_HEAP_DYNAMIC
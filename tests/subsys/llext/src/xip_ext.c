@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Test executing an extension in place: the text calls nothing and refers
+ * to no data, so it needs no relocations and runs from the ELF buffer.
+ */
+
+#include <zephyr/llext/symbol.h>
+
+int test_xip(int a, int b)
+{
+	return a + b;
+}
+EXPORT_SYMBOL(test_xip);
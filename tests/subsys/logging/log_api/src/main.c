@@ -10,6 +10,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_trace_evt.h>
 #include <zephyr/sys/cbprintf.h>
 
 #ifndef CONFIG_LOG_BUFFER_SIZE
@@ -855,6 +856,44 @@ ZTEST(test_log_api, test_log_override_level)
 	process_and_validate(false, false);
 }
 
+ZTEST(test_log_api, test_log_trace_evt)
+{
+#ifdef CONFIG_LOG_TRACE_EVT
+	log_timestamp_t exp_timestamp = TIMESTAMP_INIT_VAL;
+	uint32_t a = 0x12345678;
+	int32_t b = -5;
+
+	log_setup(false);
+
+	/* Trace events are converted into regular messages, in the order
+	 * they were written and with the timestamp of the event.
+	 */
+	mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+				Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_ERR,
+				exp_timestamp++, "trace err");
+	mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+				Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_WRN,
+				exp_timestamp++, "trace wrn 12345678");
+	mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+				Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_INF,
+				exp_timestamp++, "trace inf -5 3 4 5");
+	if (dbg_enabled()) {
+		mock_log_backend_record(&backend1, LOG_CURRENT_MODULE_ID(),
+					Z_LOG_LOCAL_DOMAIN_ID, LOG_LEVEL_DBG,
+					exp_timestamp++, "trace dbg 1 2");
+	}
+
+	LOG_TRACE_EVT_ERR("trace err");
+	LOG_TRACE_EVT_WRN("trace wrn %x", a);
+	LOG_TRACE_EVT_INF("trace inf %d %d %d %d", b, 3, 4, 5);
+	LOG_TRACE_EVT_DBG("trace dbg %u %u", 1, 2);
+
+	process_and_validate(false, false);
+#else
+	ztest_test_skip();
+#endif
+}
+
 /* Disable backends because same suite may be executed again but compiled by C++ */
 static void log_api_suite_teardown(void *data)
 {
@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/ztest.h>
+#include <zephyr/cache.h>
 #include <zephyr/mem_mgmt/mem_attr_heap.h>
 #include <zephyr/dt-bindings/memory-attr/memory-attr-sw.h>
 
@@ -142,4 +143,64 @@ ZTEST(mem_attr_heap, test_mem_attr_heap)
 	zassert_true(((uintptr_t) block % 64 == 0), "");
 }
 
+ZTEST(mem_attr_heap, test_mem_attr_heap_dma)
+{
+	struct mem_attr_heap_dma_spec spec = {
+		.attr = DT_MEM_SW_ALLOC_DMA,
+	};
+	size_t line = MAX(sys_cache_data_line_size_get(), sizeof(void *));
+	const struct mem_attr_region_t *region;
+	void *block, *old_block;
+
+	(void)mem_attr_heap_pool_init();
+
+	/*
+	 * Blocks are aligned to and padded to whole cache lines.
+	 */
+	block = mem_attr_heap_dma_alloc(&spec, 1);
+	zassert_not_null(block, "Failed to allocate memory");
+	zassert_equal((uintptr_t)block % line, 0, "DMA block not aligned");
+
+	old_block = mem_attr_heap_dma_alloc(&spec, 1);
+	zassert_not_null(old_block, "Failed to allocate memory");
+	zassert_true((uint8_t *)old_block >= (uint8_t *)block + line ||
+		     (uint8_t *)block >= (uint8_t *)old_block + line,
+		     "DMA blocks share a cache line");
+
+	/*
+	 * A freed block is reused for the next block of the same size class.
+	 */
+	mem_attr_heap_dma_free(old_block);
+	block = mem_attr_heap_dma_alloc(&spec, line);
+	zassert_equal_ptr(old_block, block, "Freed DMA block not reused");
+	mem_attr_heap_dma_free(block);
+
+	/*
+	 * Restricted to a region.
+	 */
+	spec.region = ADDR_MEM_CACHE_DMA_SW;
+	block = mem_attr_heap_dma_alloc(&spec, 0x100);
+	zassert_not_null(block, "Failed to allocate memory");
+	region = mem_attr_heap_get_region(block);
+	zassert_equal(region->dt_addr, ADDR_MEM_CACHE_DMA_SW,
+		      "Memory allocated from the wrong region");
+	mem_attr_heap_dma_free(block);
+
+	/*
+	 * No region below the address limit.
+	 */
+	spec.region = 0;
+	spec.addr_max = ADDR_MEM_DMA_SW;
+	block = mem_attr_heap_dma_alloc(&spec, 0x100);
+	zassert_is_null(block, "Memory allocated above the address limit");
+
+	spec.addr_max = ADDR_MEM_DMA_SW + 0xfff;
+	block = mem_attr_heap_dma_alloc(&spec, 0x100);
+	zassert_not_null(block, "Failed to allocate memory");
+	region = mem_attr_heap_get_region(block);
+	zassert_equal(region->dt_addr, ADDR_MEM_DMA_SW,
+		      "Memory allocated from the wrong region");
+	mem_attr_heap_dma_free(block);
+}
+
 ZTEST_SUITE(mem_attr_heap, NULL, NULL, NULL, NULL, NULL);
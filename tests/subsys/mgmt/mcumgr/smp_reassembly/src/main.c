@@ -203,4 +203,28 @@ ZTEST(smp_reassembly, test_ud)
 	smp_reassembly_drop(&smpt);
 }
 
+ZTEST(smp_reassembly, test_rsp_reserved)
+{
+	struct smp_hdr *mh = (struct smp_hdr *)buff;
+	struct net_buf *rsp;
+	int ret;
+
+	/* Queue a request, it takes the only shared buffer */
+	mh->nh_len = sys_cpu_to_be16(TEST_FRAME_SIZE - sizeof(struct smp_hdr));
+	ret = smp_reassembly_collect(&smpt, buff, TEST_FRAME_SIZE);
+	zassert_equal(0, ret, "Expected complete packet, got %d", ret);
+	ret = smp_reassembly_complete(&smpt, false);
+	zassert_equal(0, ret, "Expected completion, got %d", ret);
+
+	zassert_is_null(smp_packet_alloc(), "Expected no shared buffer left");
+
+	/* The response comes from the reserved buffer */
+	rsp = smp_alloc_rsp(backup, &smpt);
+	zassert_not_null(rsp, "Expected a reserved response buffer");
+	zassert_is_null(smp_alloc_rsp(backup, &smpt), "Expected one reserved buffer");
+
+	smp_free_buf(rsp, &smpt);
+	smp_packet_free(backup);
+}
+
 ZTEST_SUITE(smp_reassembly, NULL, NULL, NULL, NULL, NULL);
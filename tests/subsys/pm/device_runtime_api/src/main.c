@@ -314,6 +314,54 @@ ZTEST(device_runtime_api, test_pm_device_runtime_auto)
 	zassert_equal(pm_device_runtime_put(dev), 0, "");
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC
+static K_SEM_DEFINE(batch_done, 0, 1);
+static int batch_result;
+
+static void batch_cb(struct pm_device_runtime_batch *batch, int result)
+{
+	ARG_UNUSED(batch);
+
+	batch_result = result;
+	k_sem_give(&batch_done);
+}
+
+ZTEST(device_runtime_api, test_get_async)
+{
+	static struct pm_device_runtime_batch batch;
+	const struct device *const devs[] = {
+		test_dev,
+		DEVICE_DT_GET(DT_NODELABEL(test_dev)),
+	};
+	enum pm_device_state state;
+	int ret;
+
+	ret = pm_device_runtime_get_async(&batch, devs, ARRAY_SIZE(devs), batch_cb);
+	zassert_equal(ret, 0);
+
+	zassert_equal(k_sem_take(&batch_done, K_MSEC(100)), 0);
+	zassert_equal(batch_result, 0);
+
+	ARRAY_FOR_EACH(devs, i) {
+		(void)pm_device_state_get(devs[i], &state);
+		zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+		zassert_equal(pm_device_runtime_usage(devs[i]), 1);
+	}
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	struct pm_device_runtime_stats stats;
+
+	zassert_equal(pm_device_runtime_stats_get(test_dev, &stats), 0);
+	zassert_true(stats.resume_count > 0);
+	zassert_true(stats.resume_max_us >= stats.resume_last_us);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
+	ARRAY_FOR_EACH(devs, i) {
+		zassert_equal(pm_device_runtime_put(devs[i]), 0);
+	}
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC */
+
 void *device_runtime_api_setup(void)
 {
 	test_dev = device_get_binding("test_driver");
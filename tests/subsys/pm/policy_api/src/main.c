@@ -336,4 +336,31 @@ ZTEST(policy_api, test_pm_policy_events)
 	pm_policy_event_unregister(&evt2);
 }
 
+ZTEST(policy_api, test_pm_policy_stream)
+{
+	struct pm_policy_stream stream;
+	int32_t deadline_ticks = k_us_to_ticks_floor32(100000);
+
+	zassert_equal(pm_policy_next_event_ticks(), -1);
+
+	/* tolerate a latency between the ones of PM_STATE_RUNTIME_IDLE and
+	 * PM_STATE_SUSPEND_TO_RAM
+	 */
+	pm_policy_stream_add(&stream, 100000, 50000);
+	zassert_within(pm_policy_next_event_ticks(), deadline_ticks, 50);
+
+	if (IS_ENABLED(CONFIG_PM_POLICY_DEFAULT)) {
+		const struct pm_state_info *next;
+
+		next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1100000));
+		zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+	}
+
+	pm_policy_stream_update(&stream, 200000);
+	zassert_within(pm_policy_next_event_ticks(), 2 * deadline_ticks, 50);
+
+	pm_policy_stream_remove(&stream);
+	zassert_equal(pm_policy_next_event_ticks(), -1);
+}
+
 ZTEST_SUITE(policy_api, NULL, NULL, NULL, NULL, NULL);
@@ -121,4 +121,32 @@ ZTEST(rng_common, test_rand32)
 #endif /* CONFIG_CSPRNG_ENABLED */
 }
 
+#if defined(CONFIG_CSPRNG_ENABLED)
+ZTEST(rng_common, test_csrand_small_draws)
+{
+	uint32_t prev = 0;
+	uint32_t gen;
+	int equal_count = 0;
+	int err;
+
+	/* Enough short draws to go through several buffered blocks */
+	for (int i = 0; i < 256; i++) {
+		err = sys_csrand_get(&gen, sizeof(gen));
+		zassert_equal(err, 0, "sys_csrand_get returned an error");
+
+		if (gen == prev) {
+			equal_count++;
+		}
+		prev = gen;
+
+		if (i % 16 == 0) {
+			/* Let the refill run */
+			k_yield();
+		}
+	}
+
+	zassert_true(equal_count < 2, "repeated random values");
+}
+#endif /* CONFIG_CSPRNG_ENABLED */
+
 ZTEST_SUITE(rng_common, NULL, NULL, NULL, NULL, NULL);
@@ -743,6 +743,55 @@ ZTEST(rtio_api, test_rtio_throughput)
 	_test_rtio_throughput(&r_throughput);
 }
 
+#ifdef CONFIG_RTIO_CONSUME_WATERMARK
+#define RTIO_WATERMARK_NUM_ELEMS 4
+
+RTIO_DEFINE(r_watermark, RTIO_WATERMARK_NUM_ELEMS, RTIO_WATERMARK_NUM_ELEMS);
+
+/**
+ * @brief Test completions are consumed in batches once the watermark is reached
+ */
+ZTEST(rtio_api, test_rtio_consume_batch)
+{
+	struct rtio *r = &r_watermark;
+	struct rtio_cqe *cqes[RTIO_WATERMARK_NUM_ELEMS];
+	struct rtio_sqe *sqe;
+	int count;
+
+	rtio_cqe_watermark_set(r, 3);
+
+	for (size_t i = 0; i < 3; i++) {
+		sqe = rtio_sqe_acquire(r);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_delay(sqe, K_MSEC(10 * (i + 1)), (void *)i);
+	}
+	zassert_ok(rtio_submit(r, 0));
+
+	/* Woken once all three delays have expired */
+	count = rtio_cqe_consume_batch(r, cqes, ARRAY_SIZE(cqes), K_FOREVER);
+	zassert_equal(count, 3, "Expected a batch of three, got %d", count);
+	for (int i = 0; i < count; i++) {
+		zassert_equal((uintptr_t)cqes[i]->userdata, i);
+		rtio_cqe_release(r, cqes[i]);
+	}
+
+	/* Below the watermark, what is ready is consumed when the timeout expires */
+	sqe = rtio_sqe_acquire(r);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_nop(sqe, NULL, NULL);
+	zassert_ok(rtio_submit(r, 0));
+
+	count = rtio_cqe_consume_batch(r, cqes, ARRAY_SIZE(cqes), K_MSEC(10));
+	zassert_equal(count, 1, "Expected a single completion, got %d", count);
+	rtio_cqe_release(r, cqes[0]);
+
+	count = rtio_cqe_consume_batch(r, cqes, ARRAY_SIZE(cqes), K_NO_WAIT);
+	zassert_equal(count, 0, "Expected no completion, got %d", count);
+
+	rtio_cqe_watermark_set(r, 1);
+}
+#endif /* CONFIG_RTIO_CONSUME_WATERMARK */
+
 RTIO_DEFINE(r_callback_chaining, SQE_POOL_SIZE, CQE_POOL_SIZE);
 RTIO_IODEV_TEST_DEFINE(iodev_test_callback_chaining0);
 static bool cb_no_cqe_run;
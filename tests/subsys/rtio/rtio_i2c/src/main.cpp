@@ -216,6 +216,70 @@ ZTEST(rtio_i2c, test_fallback_transaction)
 	rtio_cqe_release(&test_rtio_ctx, cqe);
 }
 
+ZTEST(rtio_i2c, test_fallback_burst_reads)
+{
+	uint8_t buffer[2][3] = {0};
+	struct i2c_rtio_burst bursts[] = {
+		{.iodev = &blocking_emul_iodev, .start_addr = 0x10, .buf = buffer[0], .num_bytes = 3},
+		{.iodev = &blocking_emul_iodev, .start_addr = 0x20, .buf = buffer[1], .num_bytes = 3},
+	};
+
+	blocking_emul_i2c_transfer_fake.custom_fake =
+		[](const struct emul *, struct i2c_msg *msgs, int msg_count, int) {
+			zassert_equal(2, msg_count);
+			zassert_equal(1, msgs[0].len);
+			zassert_equal(I2C_MSG_WRITE, msgs[0].flags);
+			zassert_equal(I2C_MSG_READ | I2C_MSG_RESTART | I2C_MSG_STOP, msgs[1].flags);
+			memset(msgs[1].buf, msgs[0].buf[0], msgs[1].len);
+			return 0;
+		};
+
+	struct rtio_sqe *sqe =
+		i2c_rtio_copy_reg_burst_reads(&test_rtio_ctx, bursts, ARRAY_SIZE(bursts), bursts);
+
+	zassert_not_null(sqe);
+	zassert_ok(rtio_submit(&test_rtio_ctx, 1));
+	zassert_equal(2, blocking_emul_i2c_transfer_fake.call_count);
+
+	/* A single completion for the whole chain */
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&test_rtio_ctx);
+
+	zassert_ok(cqe->result);
+	zassert_equal_ptr(bursts, cqe->userdata);
+	rtio_cqe_release(&test_rtio_ctx, cqe);
+	zassert_is_null(rtio_cqe_consume(&test_rtio_ctx));
+
+	zassert_equal(0x10, buffer[0][2]);
+	zassert_equal(0x20, buffer[1][2]);
+}
+
+ZTEST(rtio_i2c, test_fallback_burst_reads_error)
+{
+	uint8_t buffer[2][3];
+	struct i2c_rtio_burst bursts[] = {
+		{.iodev = &blocking_emul_iodev, .start_addr = 0x10, .buf = buffer[0], .num_bytes = 3},
+		{.iodev = &blocking_emul_iodev, .start_addr = 0x20, .buf = buffer[1], .num_bytes = 3},
+	};
+	int results[] = {-EIO, 0};
+
+	SET_RETURN_SEQ(blocking_emul_i2c_transfer, results, ARRAY_SIZE(results));
+
+	zassert_not_null(
+		i2c_rtio_copy_reg_burst_reads(&test_rtio_ctx, bursts, ARRAY_SIZE(bursts), NULL));
+	zassert_ok(rtio_submit(&test_rtio_ctx, 2));
+	zassert_equal(2, blocking_emul_i2c_transfer_fake.call_count);
+
+	/* The failed burst reports its error, followed by the end of the chain */
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&test_rtio_ctx);
+
+	zassert_equal(-EIO, cqe->result);
+	rtio_cqe_release(&test_rtio_ctx, cqe);
+
+	cqe = rtio_cqe_consume_block(&test_rtio_ctx);
+	zassert_ok(cqe->result);
+	rtio_cqe_release(&test_rtio_ctx, cqe);
+}
+
 ZTEST(rtio_i2c, test_work_queue_overflow)
 {
 	BUILD_ASSERT(CONFIG_RTIO_WORKQ_POOL_ITEMS == 2);
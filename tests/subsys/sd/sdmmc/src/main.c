@@ -178,6 +178,30 @@ ZTEST(sd_stack, test_rw)
 	}
 }
 
+/* Test single block writes to adjacent blocks, which may be merged */
+ZTEST(sd_stack, test_sequential_write)
+{
+	int ret;
+	int block_addr = (sector_count / 2);
+
+	for (int i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i + 7);
+	}
+	for (int i = 0; i < SECTOR_COUNT; i++) {
+		ret = sdmmc_write_blocks(&card, buf + (i * sector_size),
+			block_addr + i, 1);
+		zassert_equal(ret, 0, "Write to card failed");
+	}
+	ret = sdmmc_ioctl(&card, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(ret, 0, "Card sync failed");
+
+	memset(check_buf, 0, BUF_SIZE);
+	ret = sdmmc_read_blocks(&card, check_buf, block_addr, SECTOR_COUNT);
+	zassert_equal(ret, 0, "Read from card failed");
+	zassert_mem_equal(buf, check_buf, BUF_SIZE,
+		"Read of sequentially written area was not correct");
+}
+
 /* Simply dump the card configuration. */
 ZTEST(sd_stack, test_card_config)
 {
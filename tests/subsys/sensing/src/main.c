@@ -6,6 +6,7 @@
 
 #include <zephyr/device.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
 #include <zephyr/ztest.h>
 #include <zephyr/sensing/sensing.h>
 #include <zephyr/sensing/sensing_sensor.h>
@@ -89,4 +90,85 @@ ZTEST(sensing_tests, test_sensing_get_sensors)
 	}
 }
 
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+#define CLIENT_INTERVAL_US	(10 * USEC_PER_MSEC)
+#define CLIENT_EVENTS		5
+
+static K_THREAD_STACK_DEFINE(client_wq_stack, 1024);
+static struct k_work_q client_wq;
+static atomic_t client_events;
+static atomic_t client_foreign_events;
+
+static void client_data_event(sensing_sensor_handle_t handle, const void *buf, void *context)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(context);
+
+	if (k_current_get() != k_work_queue_thread_get(&client_wq)) {
+		atomic_inc(&client_foreign_events);
+	}
+
+	/* keep events queued behind this one while the client is closed */
+	k_msleep(CLIENT_INTERVAL_US / USEC_PER_MSEC * 2);
+	atomic_inc(&client_events);
+}
+
+static struct sensing_callback_list client_cb_list = {
+	.on_data_event = client_data_event,
+	.work_q = &client_wq,
+};
+#endif
+
+/**
+ * @brief Test Client Work Queue
+ *
+ * This test verifies that the data events of a client with a work queue are
+ * delivered on it, and that closing the client waits for the queued events.
+ */
+ZTEST(sensing_tests, test_sensing_client_work_q)
+{
+#ifdef CONFIG_SENSING_CLIENT_DISPATCH
+	const struct sensing_sensor_info *info, *accel = NULL;
+	struct sensing_sensor_config config = {
+		.attri = SENSING_SENSOR_ATTRIBUTE_INTERVAL,
+		.interval = CLIENT_INTERVAL_US,
+	};
+	sensing_sensor_handle_t handle;
+	int num, events;
+
+	zassert_ok(sensing_get_sensors(&num, &info));
+
+	for (int i = 0; i < num; ++i) {
+		if (info[i].type == SENSING_SENSOR_TYPE_MOTION_ACCELEROMETER_3D) {
+			accel = &info[i];
+			break;
+		}
+	}
+	zassert_not_null(accel, "No accelerometer found");
+
+	k_work_queue_start(&client_wq, client_wq_stack, K_THREAD_STACK_SIZEOF(client_wq_stack),
+			   K_PRIO_PREEMPT(1), NULL);
+
+	zassert_ok(sensing_open_sensor(accel, &client_cb_list, &handle));
+	zassert_ok(sensing_set_config(handle, &config, 1));
+
+	for (int i = 0; i < 100 && atomic_get(&client_events) < CLIENT_EVENTS; i++) {
+		k_msleep(CLIENT_INTERVAL_US / USEC_PER_MSEC);
+	}
+	zassert_true(atomic_get(&client_events) >= CLIENT_EVENTS, "Only %ld data events",
+		     atomic_get(&client_events));
+
+	zassert_ok(sensing_close_sensor(&handle));
+	events = atomic_get(&client_events);
+
+	k_msleep(CLIENT_INTERVAL_US / USEC_PER_MSEC * 10);
+	zassert_equal(atomic_get(&client_events), events, "Data event after the client closed");
+	zassert_equal(atomic_get(&client_foreign_events), 0,
+		      "Data event not delivered on the client work queue");
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(sensing_tests, NULL, NULL, NULL, NULL, NULL);
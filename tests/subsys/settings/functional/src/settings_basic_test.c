@@ -657,3 +657,54 @@ ZTEST(settings_functional, test_direct_loading_filter)
 	}
 	settings_deregister(&filtered_loader_settings);
 }
+
+#if defined(CONFIG_SETTINGS_BATCH)
+ZTEST(settings_functional, test_batch)
+{
+	uint8_t val;
+	int rc;
+
+	settings_subsys_init();
+	val = 1;
+	settings_save_one("batch/1", &val, sizeof(val));
+
+	zassert_equal(0, settings_batch_begin());
+	zassert_equal(-EALREADY, settings_batch_begin());
+
+	/* Not written until the commit, the last value wins */
+	val = 2;
+	zassert_equal(0, settings_save_one("batch/1", &val, sizeof(val)));
+	val = 3;
+	zassert_equal(0, settings_save_one("batch/2", &val, sizeof(val)));
+	val = 4;
+	zassert_equal(0, settings_save_one("batch/1", &val, sizeof(val)));
+
+	rc = settings_load_one("batch/1", &val, sizeof(val));
+	zassert_equal(sizeof(val), rc);
+	zassert_equal(1, val);
+	zassert_equal(0, settings_get_val_len("batch/2"));
+
+	zassert_equal(0, settings_batch_commit());
+	zassert_equal(-EINVAL, settings_batch_commit());
+
+	rc = settings_load_one("batch/1", &val, sizeof(val));
+	zassert_equal(sizeof(val), rc);
+	zassert_equal(4, val);
+	rc = settings_load_one("batch/2", &val, sizeof(val));
+	zassert_equal(sizeof(val), rc);
+	zassert_equal(3, val);
+
+	/* Aborted batches are discarded */
+	zassert_equal(0, settings_batch_begin());
+	zassert_equal(0, settings_delete("batch/1"));
+	zassert_equal(0, settings_batch_abort());
+	zassert_equal(sizeof(val), settings_get_val_len("batch/1"));
+
+	zassert_equal(0, settings_batch_begin());
+	zassert_equal(0, settings_delete("batch/1"));
+	zassert_equal(0, settings_delete("batch/2"));
+	zassert_equal(0, settings_batch_commit());
+	zassert_equal(0, settings_get_val_len("batch/1"));
+	zassert_equal(0, settings_get_val_len("batch/2"));
+}
+#endif /* CONFIG_SETTINGS_BATCH */
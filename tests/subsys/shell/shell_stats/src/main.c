@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Interactive shell test suite for 'stats' command
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/ztest.h>
+
+STATS_SECT_START(test_small)
+STATS_SECT_ENTRY16(s0)
+STATS_SECT_ENTRY16(s1)
+STATS_SECT_END;
+
+STATS_NAME_START(test_small)
+STATS_NAME(test_small, s0)
+STATS_NAME(test_small, s1)
+STATS_NAME_END(test_small);
+
+static STATS_SECT_DECL(test_small) test_small;
+
+/* Larger than a single base64 chunk of the dump */
+STATS_SECT_START(test_large)
+STATS_SECT_ENTRY32(s0)
+STATS_SECT_ENTRY32(s1)
+STATS_SECT_ENTRY32(s2)
+STATS_SECT_ENTRY32(s3)
+STATS_SECT_ENTRY32(s4)
+STATS_SECT_ENTRY32(s5)
+STATS_SECT_ENTRY32(s6)
+STATS_SECT_ENTRY32(s7)
+STATS_SECT_ENTRY32(s8)
+STATS_SECT_ENTRY32(s9)
+STATS_SECT_ENTRY32(s10)
+STATS_SECT_ENTRY32(s11)
+STATS_SECT_ENTRY32(s12)
+STATS_SECT_END;
+
+STATS_NAME_START(test_large)
+STATS_NAME(test_large, s0)
+STATS_NAME(test_large, s1)
+STATS_NAME(test_large, s2)
+STATS_NAME(test_large, s3)
+STATS_NAME(test_large, s4)
+STATS_NAME(test_large, s5)
+STATS_NAME(test_large, s6)
+STATS_NAME(test_large, s7)
+STATS_NAME(test_large, s8)
+STATS_NAME(test_large, s9)
+STATS_NAME(test_large, s10)
+STATS_NAME(test_large, s11)
+STATS_NAME(test_large, s12)
+STATS_NAME_END(test_large);
+
+static STATS_SECT_DECL(test_large) test_large;
+
+#define TEST_SMALL_DUMP "test_small 2 2 BwA0Eg=="
+#define TEST_LARGE_DUMP "test_large 4 13 "						\
+	"AQAAAAIAAAADAAAABAAAAAUAAAAGAAAABwAAAAgAAAAJAAAACgAAAAsAAAAMAAAADQAAAA=="
+
+static const char *dump_output(const char *cmd)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	size_t size;
+	int ret;
+
+	shell_backend_dummy_clear_output(sh);
+
+	ret = shell_execute_cmd(sh, cmd);
+	zassert_ok(ret, "%s failed: %d", cmd, ret);
+
+	return shell_backend_dummy_get_output(sh, &size);
+}
+
+/* Test dumping a single group */
+ZTEST(shell_stats, test_dump_group)
+{
+	const char *buf;
+
+	buf = dump_output("stats dump test_small");
+	zassert_not_null(strstr(buf, TEST_SMALL_DUMP), "Unexpected dump: %s", buf);
+	zassert_is_null(strstr(buf, "test_large"), "Other group dumped: %s", buf);
+
+	buf = dump_output("stats dump test_large");
+	zassert_not_null(strstr(buf, TEST_LARGE_DUMP), "Unexpected dump: %s", buf);
+}
+
+/* Test dumping all groups, one per line */
+ZTEST(shell_stats, test_dump_all)
+{
+	const char *buf = dump_output("stats dump");
+
+	zassert_not_null(strstr(buf, TEST_SMALL_DUMP), "Small group missing: %s", buf);
+	zassert_not_null(strstr(buf, TEST_LARGE_DUMP), "Large group missing: %s", buf);
+}
+
+/* Test dumping a group which is not registered */
+ZTEST(shell_stats, test_dump_unknown)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	const char *buf;
+	size_t size;
+
+	shell_backend_dummy_clear_output(sh);
+
+	zassert_equal(shell_execute_cmd(sh, "stats dump test_none"), -ENOENT);
+
+	buf = shell_backend_dummy_get_output(sh, &size);
+	zassert_not_null(strstr(buf, "Stats group test_none not found"), "Unexpected output: %s",
+			 buf);
+}
+
+static void *shell_setup(void)
+{
+	zassert_ok(STATS_INIT_AND_REG(test_small, STATS_SIZE_16, "test_small"));
+	zassert_ok(STATS_INIT_AND_REG(test_large, STATS_SIZE_32, "test_large"));
+
+	STATS_SET(test_small, s0, 7);
+	STATS_SET(test_small, s1, 0x1234);
+
+	STATS_SET(test_large, s0, 1);
+	STATS_SET(test_large, s1, 2);
+	STATS_SET(test_large, s2, 3);
+	STATS_SET(test_large, s3, 4);
+	STATS_SET(test_large, s4, 5);
+	STATS_SET(test_large, s5, 6);
+	STATS_SET(test_large, s6, 7);
+	STATS_SET(test_large, s7, 8);
+	STATS_SET(test_large, s8, 9);
+	STATS_SET(test_large, s9, 10);
+	STATS_SET(test_large, s10, 11);
+	STATS_SET(test_large, s11, 12);
+	STATS_SET(test_large, s12, 13);
+
+	/* Let the shell backend initialize. */
+	k_usleep(10);
+
+	return NULL;
+}
+
+ZTEST_SUITE(shell_stats, NULL, shell_setup, NULL, NULL, NULL);
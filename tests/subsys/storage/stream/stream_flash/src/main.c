@@ -426,6 +426,38 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 }
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+static uint8_t pipe_buf[BUF_LEN];
+
+ZTEST(lib_stream_flash, test_stream_flash_pipeline)
+{
+	int rc;
+	int num_pages = MAX_NUM_PAGES - 1;
+
+	init_target();
+
+	rc = stream_flash_pipeline_enable(&ctx, pipe_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Filling the second buffer waits for the first one */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN * 2 + 128, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_true(stream_flash_bytes_written(&ctx) >= BUF_LEN, "first buffer not written");
+	zassert_equal(stream_flash_bytes_written(&ctx) + stream_flash_bytes_buffered(&ctx),
+		      BUF_LEN * 2 + 128, "bytes lost");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf,
+					 page_size * num_pages - BUF_LEN * 2 - 128, true);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Flush completes the background writes */
+	zassert_equal(stream_flash_bytes_written(&ctx), page_size * num_pages,
+		      "not all bytes written");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 0, "bytes still buffered");
+	VERIFY_WRITTEN(0, page_size * num_pages);
+}
+#endif
+
 static size_t write_and_save_progress(size_t bytes, const char *save_key)
 {
 	int rc;
@@ -643,4 +643,89 @@ ZTEST(uac2_desc, test_hs_only_headset)
 	zassert_equal(*ptr, NULL);
 }
 
+/* 384 kHz stereo headphones with 16, 24 and 32-bit alternate settings */
+VALIDATE_INSTANCE(DT_NODELABEL(hs_uac2_multiformat))
+
+UAC2_DESCRIPTOR_ARRAYS(DT_NODELABEL(hs_uac2_multiformat))
+
+const static struct usb_desc_header *hs_multiformat_descriptor_set[] =
+	UAC2_HS_DESCRIPTOR_PTRS_ARRAY(DT_NODELABEL(hs_uac2_multiformat));
+
+ZTEST(uac2_desc, test_hs_multiformat_alternates)
+{
+	const struct usb_desc_header **ptr = hs_multiformat_descriptor_set;
+	const uint8_t subslot_sizes[] = {2, 3, 4};
+	const uint8_t bit_resolutions[] = {16, 24, 32};
+	/* 384 kHz needs 48 samples per microframe plus 1 extra sample because
+	 * the endpoint is asynchronous.
+	 */
+	const uint16_t max_packet_sizes[] = {196, 294, 392};
+	const struct usb_if_descriptor *iface;
+	const struct usb_ep_descriptor *ep;
+	const uint8_t *cs;
+
+	zassert_equal(AS_ALTERNATE_DESCRIPTORS_COUNT(DT_NODELABEL(mf_as_iso_out)),
+		6);
+
+	/* Skip to alternate setting 1 interface descriptor */
+	ptr += UAC2_DESCRIPTOR_AS_DATA_EP_INDEX(DT_NODELABEL(mf_as_iso_out)) - 3;
+
+	for (int i = 0; i < ARRAY_SIZE(subslot_sizes); i++) {
+		iface = (const struct usb_if_descriptor *)*ptr;
+		zassert_not_null(iface);
+		zassert_equal(iface->bDescriptorType, USB_DESC_INTERFACE);
+		zassert_equal(iface->bInterfaceNumber, FIRST_INTERFACE_NUMBER + 1);
+		zassert_equal(iface->bAlternateSetting, i + 1);
+		zassert_equal(iface->bNumEndpoints, 2);
+		zassert_equal(iface->bInterfaceSubClass, AUDIOSTREAMING);
+		ptr++;
+
+		/* Class-Specific AS Interface Descriptor */
+		cs = (const uint8_t *)*ptr;
+		zassert_equal(cs[1], CS_INTERFACE);
+		zassert_equal(cs[2], AS_DESCRIPTOR_GENERAL);
+		ptr++;
+
+		/* Type I Format Type Descriptor */
+		cs = (const uint8_t *)*ptr;
+		zassert_equal(cs[0], 6);
+		zassert_equal(cs[1], CS_INTERFACE);
+		zassert_equal(cs[2], AS_DESCRIPTOR_FORMAT_TYPE);
+		zassert_equal(cs[3], FORMAT_TYPE_I);
+		zassert_equal(cs[4], subslot_sizes[i]);
+		zassert_equal(cs[5], bit_resolutions[i]);
+		ptr++;
+
+		/* Isochronous OUT endpoint descriptor */
+		ep = (const struct usb_ep_descriptor *)*ptr;
+		zassert_equal(ep->bDescriptorType, USB_DESC_ENDPOINT);
+		zassert_equal(ep->bEndpointAddress, FIRST_OUT_EP_ADDR);
+		zassert_equal(ptr - hs_multiformat_descriptor_set,
+			UAC2_DESCRIPTOR_AS_DATA_EP_INDEX(DT_NODELABEL(mf_as_iso_out)) +
+			i * AS_ALTERNATE_DESCRIPTORS_COUNT(DT_NODELABEL(mf_as_iso_out)));
+		zassert_equal(ep->Attributes.synch, 1 /* Asynchronous */);
+		zassert_equal(sys_le16_to_cpu(ep->wMaxPacketSize),
+			max_packet_sizes[i]);
+		ptr++;
+
+		/* AudioStreaming OUT endpoint descriptor */
+		zassert_mem_equal(reference_as_ep_descriptor, *ptr,
+			ARRAY_SIZE(reference_as_ep_descriptor));
+		ptr++;
+
+		/* Isochronous IN explicit feedback endpoint descriptor */
+		ep = (const struct usb_ep_descriptor *)*ptr;
+		zassert_equal(ep->bDescriptorType, USB_DESC_ENDPOINT);
+		zassert_equal(ep->bEndpointAddress, FIRST_IN_EP_ADDR);
+		zassert_equal(ptr - hs_multiformat_descriptor_set,
+			UAC2_DESCRIPTOR_AS_FEEDBACK_EP_INDEX(DT_NODELABEL(mf_as_iso_out)) +
+			i * AS_ALTERNATE_DESCRIPTORS_COUNT(DT_NODELABEL(mf_as_iso_out)));
+		zassert_equal(ep->Attributes.usage, 1 /* Explicit Feedback-Endpoint */);
+		ptr++;
+	}
+
+	/* Confirm there is no trailing data */
+	zassert_equal(*ptr, NULL);
+}
+
 ZTEST_SUITE(uac2_desc, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/i2s.h>
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/usbh.h>
+#include <zephyr/usb/class/usbd_uac2.h>
+
+#include "usbh_device.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(uac2_i2s_test, LOG_LEVEL_INF);
+
+#define TEST_AS_OUT_INTERFACE	1
+#define TEST_AS_IN_INTERFACE	2
+#define TEST_ISO_OUT_EP		0x01
+#define TEST_ISO_IN_EP		0x81
+
+#define TEST_OUT_TERMINAL_ID	UAC2_ENTITY_ID(DT_NODELABEL(out_terminal))
+#define TEST_IN_TERMINAL_ID	UAC2_ENTITY_ID(DT_NODELABEL(in_terminal))
+
+/* 48 kHz stereo, 16-bit samples, room for one extra frame per packet */
+#define TEST_TX_BLOCK_SIZE	(49 * 2 * 2)
+#define TEST_TX_NUM_BLOCKS	(CONFIG_USBD_UAC2_I2S_TX_PREFILL + 2)
+/* 48 kHz mono, 16-bit samples, the amount sent on every SOF */
+#define TEST_RX_BLOCK_SIZE	(48 * 2)
+#define TEST_RX_NUM_BLOCKS	3
+
+USBD_CONFIGURATION_DEFINE(test_fs_config, USB_SCD_SELF_POWERED, 200, NULL);
+
+USBD_DESC_LANG_DEFINE(test_lang);
+USBD_DESC_STRING_DEFINE(test_mfg, "ZEPHYR", 1);
+USBD_DESC_STRING_DEFINE(test_product, "Zephyr UAC2 I2S Test", 2);
+
+USBD_DEVICE_DEFINE(test_usbd,
+		   DEVICE_DT_GET(DT_NODELABEL(zephyr_udc0)),
+		   0x2fe3, 0xffff);
+
+USBH_CONTROLLER_DEFINE(uhs_ctx, DEVICE_DT_GET(DT_NODELABEL(zephyr_uhc0)));
+
+static const struct device *const uac2_dev = DEVICE_DT_GET(DT_NODELABEL(uac2_headset));
+
+K_MEM_SLAB_DEFINE_STATIC(test_tx_slab, ROUND_UP(TEST_TX_BLOCK_SIZE, UDC_BUF_GRANULARITY),
+			 TEST_TX_NUM_BLOCKS, UDC_BUF_ALIGN);
+K_MEM_SLAB_DEFINE_STATIC(test_rx_slab, ROUND_UP(TEST_RX_BLOCK_SIZE, UDC_BUF_GRANULARITY),
+			 TEST_RX_NUM_BLOCKS, UDC_BUF_ALIGN);
+
+struct test_i2s_block {
+	void *block;
+	size_t size;
+};
+
+struct test_i2s_trigger {
+	enum i2s_dir dir;
+	enum i2s_trigger_cmd cmd;
+};
+
+/* Blocks passed to i2s_write() and the blocks to return from i2s_read() */
+K_MSGQ_DEFINE(test_i2s_writes, sizeof(struct test_i2s_block), TEST_TX_NUM_BLOCKS, 4);
+K_MSGQ_DEFINE(test_i2s_reads, sizeof(struct test_i2s_block), TEST_RX_NUM_BLOCKS, 4);
+K_MSGQ_DEFINE(test_i2s_triggers, sizeof(struct test_i2s_trigger), 4, 4);
+
+static struct i2s_config test_i2s_tx_cfg;
+static struct i2s_config test_i2s_rx_cfg;
+
+/*
+ * I2S device, that hands the written blocks over to the test and returns the
+ * blocks queued by the test on read.
+ */
+static int test_i2s_configure(const struct device *dev, enum i2s_dir dir,
+			      const struct i2s_config *cfg)
+{
+	if (dir == I2S_DIR_TX) {
+		test_i2s_tx_cfg = *cfg;
+	} else if (dir == I2S_DIR_RX) {
+		test_i2s_rx_cfg = *cfg;
+	} else {
+		return -ENOSYS;
+	}
+
+	return 0;
+}
+
+static const struct i2s_config *test_i2s_config_get(const struct device *dev,
+						    enum i2s_dir dir)
+{
+	if (dir == I2S_DIR_TX && test_i2s_tx_cfg.mem_slab != NULL) {
+		return &test_i2s_tx_cfg;
+	}
+
+	if (dir == I2S_DIR_RX && test_i2s_rx_cfg.mem_slab != NULL) {
+		return &test_i2s_rx_cfg;
+	}
+
+	return NULL;
+}
+
+static int test_i2s_read(const struct device *dev, void **mem_block, size_t *size)
+{
+	struct test_i2s_block blk;
+
+	if (k_msgq_get(&test_i2s_reads, &blk, K_NO_WAIT)) {
+		return -EAGAIN;
+	}
+
+	*mem_block = blk.block;
+	*size = blk.size;
+
+	return 0;
+}
+
+static int test_i2s_write(const struct device *dev, void *mem_block, size_t size)
+{
+	struct test_i2s_block blk = {
+		.block = mem_block,
+		.size = size,
+	};
+
+	return k_msgq_put(&test_i2s_writes, &blk, K_NO_WAIT) ? -EIO : 0;
+}
+
+static int test_i2s_trigger(const struct device *dev, enum i2s_dir dir,
+			    enum i2s_trigger_cmd cmd)
+{
+	struct test_i2s_trigger trig = {
+		.dir = dir,
+		.cmd = cmd,
+	};
+	struct test_i2s_block blk;
+
+	if (cmd == I2S_TRIGGER_DROP && dir == I2S_DIR_RX) {
+		/* Captured blocks not read yet are discarded */
+		while (k_msgq_get(&test_i2s_reads, &blk, K_NO_WAIT) == 0) {
+			k_mem_slab_free(&test_rx_slab, blk.block);
+		}
+	}
+
+	return k_msgq_put(&test_i2s_triggers, &trig, K_NO_WAIT);
+}
+
+static DEVICE_API(i2s, test_i2s_api) = {
+	.configure = test_i2s_configure,
+	.config_get = test_i2s_config_get,
+	.read = test_i2s_read,
+	.write = test_i2s_write,
+	.trigger = test_i2s_trigger,
+};
+
+DEVICE_DEFINE(test_i2s, "test_i2s", NULL, NULL, NULL, NULL,
+	      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &test_i2s_api);
+
+static void test_terminal_update_cb(const struct device *dev, uint8_t terminal,
+				    bool enabled, bool microframes, void *user_data)
+{
+	LOG_INF("Terminal %u %s", terminal, enabled ? "enabled" : "disabled");
+}
+
+static void test_sof_cb(const struct device *dev, void *user_data)
+{
+}
+
+static const struct uac2_ops test_uac2_ops = {
+	.sof_cb = test_sof_cb,
+	.terminal_update_cb = test_terminal_update_cb,
+};
+
+static K_SEM_DEFINE(test_xfer_sem, 0, 1);
+static uint8_t test_xfer_data[TEST_TX_BLOCK_SIZE];
+static size_t test_xfer_len;
+static int test_xfer_err;
+
+static int test_xfer_cb(struct usb_device *const udev, struct uhc_transfer *const xfer)
+{
+	test_xfer_err = xfer->err;
+	test_xfer_len = xfer->buf->len;
+	if (USB_EP_DIR_IS_IN(xfer->ep)) {
+		memcpy(test_xfer_data, xfer->buf->data,
+		       MIN(xfer->buf->len, sizeof(test_xfer_data)));
+	}
+
+	usbh_xfer_buf_free(udev, xfer->buf);
+	usbh_xfer_free(udev, xfer);
+	k_sem_give(&test_xfer_sem);
+
+	return 0;
+}
+
+/* Run single isochronous transfer, data is sent to or received from the device */
+static size_t test_iso_xfer(struct usb_device *const udev, const uint8_t ep,
+			    const uint8_t *const data, const size_t len)
+{
+	struct uhc_transfer *xfer;
+	struct net_buf *buf;
+	int err;
+
+	xfer = usbh_xfer_alloc(udev, ep, test_xfer_cb, NULL);
+	zassert_not_null(xfer, "Failed to allocate transfer");
+
+	buf = usbh_xfer_buf_alloc(udev, len);
+	zassert_not_null(buf, "Failed to allocate buffer");
+
+	if (USB_EP_DIR_IS_OUT(ep)) {
+		net_buf_add_mem(buf, data, len);
+	}
+
+	err = usbh_xfer_buf_add(udev, xfer, buf);
+	zassert_equal(err, 0, "Failed to add buffer (%d)", err);
+
+	err = usbh_xfer_enqueue(udev, xfer);
+	zassert_equal(err, 0, "Failed to enqueue transfer (%d)", err);
+
+	err = k_sem_take(&test_xfer_sem, K_MSEC(1000));
+	zassert_equal(err, 0, "Transfer timeout");
+	zassert_equal(test_xfer_err, 0, "Transfer status is an error (%d)", test_xfer_err);
+
+	return test_xfer_len;
+}
+
+static void test_expect_trigger(const enum i2s_dir dir, const enum i2s_trigger_cmd cmd)
+{
+	struct test_i2s_trigger trig;
+	int err;
+
+	err = k_msgq_get(&test_i2s_triggers, &trig, K_MSEC(100));
+	zassert_equal(err, 0, "No I2S trigger %d", cmd);
+	zassert_equal(trig.dir, dir, "I2S trigger %d in direction %d", trig.cmd, trig.dir);
+	zassert_equal(trig.cmd, cmd, "I2S trigger %d instead of %d", trig.cmd, cmd);
+}
+
+static void test_set_alt(struct usb_device *const udev, const uint8_t iface,
+			 const uint8_t alt)
+{
+	int err;
+
+	err = usbh_device_interface_set(udev, iface, alt, false);
+	zassert_equal(err, 0, "Failed to set interface %u alternate %u (%d)",
+		      iface, alt, err);
+}
+
+/*
+ * Packets from host go to I2S in the blocks they were received to, with the
+ * number of bytes received. I2S TX starts once the prefill is queued and is
+ * dropped when host disables the terminal.
+ */
+ZTEST(uac2_i2s, test_out_prefill_and_drop)
+{
+	/* 48 and 47 frames, the packet size differs from the block size */
+	const size_t sizes[] = {TEST_TX_BLOCK_SIZE - 4, TEST_TX_BLOCK_SIZE - 8};
+	uint8_t data[TEST_TX_BLOCK_SIZE];
+	struct test_i2s_block blk;
+	struct usb_device *udev;
+	size_t len;
+	int err;
+
+	udev = usbh_device_get_any(&uhs_ctx);
+	zassert_not_null(udev, "No USB device available");
+
+	test_set_alt(udev, TEST_AS_OUT_INTERFACE, 1);
+
+	for (int i = 0; i < CONFIG_USBD_UAC2_I2S_TX_PREFILL; i++) {
+		len = sizes[i % ARRAY_SIZE(sizes)];
+		for (size_t n = 0; n < len; n++) {
+			data[n] = (uint8_t)(n + i);
+		}
+
+		zassert_equal(k_msgq_num_used_get(&test_i2s_triggers), 0,
+			      "I2S TX started after %d blocks", i);
+
+		test_iso_xfer(udev, TEST_ISO_OUT_EP, data, len);
+
+		err = k_msgq_get(&test_i2s_writes, &blk, K_MSEC(100));
+		zassert_equal(err, 0, "Packet %d not written to I2S", i);
+		zassert_equal(blk.size, len, "Block %d of %zu bytes instead of %zu",
+			      i, blk.size, len);
+		zassert_mem_equal(blk.block, data, len, "Block %d data mismatch", i);
+
+		/* I2S is done with the block */
+		k_mem_slab_free(&test_tx_slab, blk.block);
+	}
+
+	test_expect_trigger(I2S_DIR_TX, I2S_TRIGGER_START);
+
+	test_set_alt(udev, TEST_AS_OUT_INTERFACE, 0);
+	test_expect_trigger(I2S_DIR_TX, I2S_TRIGGER_DROP);
+
+	/* Block queued for the next packet is returned to the slab */
+	k_msleep(10);
+	zassert_equal(k_mem_slab_num_used_get(&test_tx_slab), 0,
+		      "%u I2S TX blocks not freed", k_mem_slab_num_used_get(&test_tx_slab));
+}
+
+/*
+ * I2S RX starts when host enables the terminal, every captured block is sent
+ * as a single packet and freed once sent, and I2S RX is dropped when host
+ * disables the terminal.
+ */
+ZTEST(uac2_i2s, test_in_send_and_drop)
+{
+	struct test_i2s_block blk;
+	struct usb_device *udev;
+	uint16_t mps;
+	size_t len;
+	int err;
+
+	udev = usbh_device_get_any(&uhs_ctx);
+	zassert_not_null(udev, "No USB device available");
+
+	for (int i = 0; i < TEST_RX_NUM_BLOCKS; i++) {
+		err = k_mem_slab_alloc(&test_rx_slab, &blk.block, K_NO_WAIT);
+		zassert_equal(err, 0, "Failed to allocate I2S RX block");
+
+		memset(blk.block, i + 1, TEST_RX_BLOCK_SIZE);
+		blk.size = TEST_RX_BLOCK_SIZE;
+
+		err = k_msgq_put(&test_i2s_reads, &blk, K_NO_WAIT);
+		zassert_equal(err, 0, "Failed to queue I2S RX block");
+	}
+
+	test_set_alt(udev, TEST_AS_IN_INTERFACE, 1);
+	test_expect_trigger(I2S_DIR_RX, I2S_TRIGGER_START);
+
+	/* Read exactly one packet per transfer */
+	mps = sys_le16_to_cpu(udev->ep_in[USB_EP_GET_IDX(TEST_ISO_IN_EP)].desc->wMaxPacketSize);
+	zassert_true(mps >= TEST_RX_BLOCK_SIZE, "IN endpoint MPS %u too small", mps);
+
+	for (int i = 0; i < TEST_RX_NUM_BLOCKS; i++) {
+		len = test_iso_xfer(udev, TEST_ISO_IN_EP, NULL, mps);
+		zassert_equal(len, TEST_RX_BLOCK_SIZE, "Packet %d of %zu bytes", i, len);
+
+		for (size_t n = 0; n < len; n++) {
+			zassert_equal(test_xfer_data[n], i + 1,
+				      "Packet %d byte %zu mismatch", i, n);
+		}
+	}
+
+	/* Blocks are freed back to the I2S RX slab once sent */
+	k_msleep(10);
+	zassert_equal(k_mem_slab_num_used_get(&test_rx_slab), 0,
+		      "%u I2S RX blocks not freed", k_mem_slab_num_used_get(&test_rx_slab));
+
+	test_set_alt(udev, TEST_AS_IN_INTERFACE, 0);
+	test_expect_trigger(I2S_DIR_RX, I2S_TRIGGER_DROP);
+}
+
+static void *uac2_i2s_test_enable(void)
+{
+	const struct device *i2s_dev = DEVICE_GET(test_i2s);
+	struct i2s_config i2s_cfg = {
+		.word_size = 16,
+		.format = I2S_FMT_DATA_FORMAT_I2S,
+		.options = I2S_OPT_BIT_CLK_MASTER | I2S_OPT_FRAME_CLK_MASTER,
+		.frame_clk_freq = 48000,
+	};
+	int err;
+
+	i2s_cfg.channels = 2;
+	i2s_cfg.mem_slab = &test_tx_slab;
+	i2s_cfg.block_size = TEST_TX_BLOCK_SIZE;
+	err = i2s_configure(i2s_dev, I2S_DIR_TX, &i2s_cfg);
+	zassert_equal(err, 0, "Failed to configure I2S TX");
+
+	i2s_cfg.channels = 1;
+	i2s_cfg.mem_slab = &test_rx_slab;
+	i2s_cfg.block_size = TEST_RX_BLOCK_SIZE;
+	err = i2s_configure(i2s_dev, I2S_DIR_RX, &i2s_cfg);
+	zassert_equal(err, 0, "Failed to configure I2S RX");
+
+	err = usbd_uac2_i2s_bind(uac2_dev, TEST_OUT_TERMINAL_ID, i2s_dev);
+	zassert_equal(err, 0, "Failed to bind OUT terminal (%d)", err);
+
+	err = usbd_uac2_i2s_bind(uac2_dev, TEST_IN_TERMINAL_ID, i2s_dev);
+	zassert_equal(err, 0, "Failed to bind IN terminal (%d)", err);
+
+	usbd_uac2_set_ops(uac2_dev, &test_uac2_ops, NULL);
+
+	err = usbh_init(&uhs_ctx);
+	zassert_equal(err, 0, "Failed to initialize USB host");
+
+	err = usbh_enable(&uhs_ctx);
+	zassert_equal(err, 0, "Failed to enable USB host");
+
+	err = uhc_bus_reset(uhs_ctx.dev);
+	zassert_equal(err, 0, "Failed to signal bus reset");
+
+	err = uhc_bus_resume(uhs_ctx.dev);
+	zassert_equal(err, 0, "Failed to signal bus resume");
+
+	err = uhc_sof_enable(uhs_ctx.dev);
+	zassert_equal(err, 0, "Failed to enable SoF generator");
+
+	err = usbd_add_descriptor(&test_usbd, &test_lang);
+	zassert_equal(err, 0, "Failed to initialize descriptor (%d)", err);
+
+	err = usbd_add_descriptor(&test_usbd, &test_mfg);
+	zassert_equal(err, 0, "Failed to initialize descriptor (%d)", err);
+
+	err = usbd_add_descriptor(&test_usbd, &test_product);
+	zassert_equal(err, 0, "Failed to initialize descriptor (%d)", err);
+
+	err = usbd_add_configuration(&test_usbd, USBD_SPEED_FS, &test_fs_config);
+	zassert_equal(err, 0, "Failed to add configuration (%d)", err);
+
+	err = usbd_register_all_classes(&test_usbd, USBD_SPEED_FS, 1, NULL);
+	zassert_equal(err, 0, "Failed to register all instances(%d)", err);
+
+	usbd_device_set_code_triple(&test_usbd, USBD_SPEED_FS, USB_BCC_MISCELLANEOUS, 0x02, 0x01);
+
+	err = usbd_init(&test_usbd);
+	zassert_equal(err, 0, "Failed to initialize device support");
+
+	err = usbd_enable(&test_usbd);
+	zassert_equal(err, 0, "Failed to enable device support");
+
+	LOG_INF("Device support enabled");
+
+	/* Allow the host time to reset the device. */
+	k_msleep(200);
+
+	return NULL;
+}
+
+static void uac2_i2s_test_shutdown(void *f)
+{
+	int err;
+
+	err = usbd_disable(&test_usbd);
+	zassert_equal(err, 0, "Failed to disable device support");
+
+	err = usbd_shutdown(&test_usbd);
+	zassert_equal(err, 0, "Failed to shutdown device support");
+
+	err = usbh_disable(&uhs_ctx);
+	zassert_equal(err, 0, "Failed to disable USB host");
+}
+
+ZTEST_SUITE(uac2_i2s, NULL, uac2_i2s_test_enable, NULL, NULL, uac2_i2s_test_shutdown);
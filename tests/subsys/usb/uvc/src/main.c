@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/video.h>
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/usbh.h>
+#include <zephyr/usb/class/usbd_uvc.h>
+
+#include "usbh_ch9.h"
+#include "usbh_device.h"
+#include "usbd_uvc.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(uvc_test, LOG_LEVEL_INF);
+
+#define TEST_VS_INTERFACE	1
+#define TEST_BULK_IN_EP		0x81
+#define TEST_FS_BULK_MPS	64
+#define TEST_NUM_FRAMES		3
+
+USBD_CONFIGURATION_DEFINE(test_fs_config, USB_SCD_SELF_POWERED, 200, NULL);
+
+USBD_DESC_LANG_DEFINE(test_lang);
+USBD_DESC_STRING_DEFINE(test_mfg, "ZEPHYR", 1);
+USBD_DESC_STRING_DEFINE(test_product, "Zephyr UVC Test", 2);
+
+USBD_DEVICE_DEFINE(test_usbd,
+		   DEVICE_DT_GET(DT_NODELABEL(zephyr_udc0)),
+		   0x2fe3, 0xffff);
+
+USBH_CONTROLLER_DEFINE(uhs_ctx, DEVICE_DT_GET(DT_NODELABEL(zephyr_uhc0)));
+
+static const struct device *const uvc_dev = DEVICE_DT_GET(DT_NODELABEL(uvc));
+static const struct device *const video_dev = DEVICE_DT_GET(DT_NODELABEL(video_sw_generator));
+
+static K_SEM_DEFINE(test_xfer_sem, 0, 1);
+static uint8_t test_xfer_data[8192];
+static size_t test_xfer_len;
+static int test_xfer_err;
+
+static int test_xfer_cb(struct usb_device *const udev, struct uhc_transfer *const xfer)
+{
+	test_xfer_err = xfer->err;
+	test_xfer_len = xfer->buf->len;
+	memcpy(test_xfer_data, xfer->buf->data, MIN(xfer->buf->len, sizeof(test_xfer_data)));
+
+	usbh_xfer_buf_free(udev, xfer->buf);
+	usbh_xfer_free(udev, xfer);
+	k_sem_give(&test_xfer_sem);
+
+	return 0;
+}
+
+/* Read one bulk IN transfer, which ends with a short packet or when len bytes are received */
+static size_t test_bulk_in(struct usb_device *const udev, const size_t len)
+{
+	struct uhc_transfer *xfer;
+	struct net_buf *buf;
+	int err;
+
+	zassert_true(len <= sizeof(test_xfer_data), "Transfer of %zu bytes too large", len);
+
+	xfer = usbh_xfer_alloc(udev, TEST_BULK_IN_EP, test_xfer_cb, NULL);
+	zassert_not_null(xfer, "Failed to allocate transfer");
+
+	buf = usbh_xfer_buf_alloc(udev, len);
+	zassert_not_null(buf, "Failed to allocate buffer");
+
+	err = usbh_xfer_buf_add(udev, xfer, buf);
+	zassert_equal(err, 0, "Failed to add buffer (%d)", err);
+
+	err = usbh_xfer_enqueue(udev, xfer);
+	zassert_equal(err, 0, "Failed to enqueue transfer (%d)", err);
+
+	err = k_sem_take(&test_xfer_sem, K_MSEC(1000));
+	zassert_equal(err, 0, "Transfer timeout");
+	zassert_equal(test_xfer_err, 0, "Transfer status is an error (%d)", test_xfer_err);
+
+	return test_xfer_len;
+}
+
+static void test_commit_format(struct usb_device *const udev)
+{
+	const uint8_t req_in = (USB_REQTYPE_DIR_TO_HOST << 7) |
+			       (USB_REQTYPE_TYPE_CLASS << 5) | USB_REQTYPE_RECIPIENT_INTERFACE;
+	const uint8_t req_out = (USB_REQTYPE_DIR_TO_DEVICE << 7) |
+				(USB_REQTYPE_TYPE_CLASS << 5) | USB_REQTYPE_RECIPIENT_INTERFACE;
+	const uint16_t wLength = sizeof(struct uvc_probe);
+	struct net_buf *buf;
+	int err;
+
+	buf = usbh_xfer_buf_alloc(udev, wLength);
+	zassert_not_null(buf, "Failed to allocate buffer");
+
+	err = k_mutex_lock(&udev->mutex, K_MSEC(200));
+	zassert_equal(err, 0, "Failed to lock device");
+
+	/* Accept the current probe settings as they are */
+	err = usbh_req_setup(udev, req_in, UVC_GET_CUR, UVC_VS_PROBE_CONTROL << 8,
+			     TEST_VS_INTERFACE, wLength, buf);
+	zassert_equal(err, 0, "Probe GET_CUR failed (%d)", err);
+	zassert_equal(buf->len, wLength, "Short probe of %u bytes", buf->len);
+
+	err = usbh_req_setup(udev, req_out, UVC_SET_CUR, UVC_VS_COMMIT_CONTROL << 8,
+			     TEST_VS_INTERFACE, wLength, buf);
+	zassert_equal(err, 0, "Commit SET_CUR failed (%d)", err);
+
+	k_mutex_unlock(&udev->mutex);
+	usbh_xfer_buf_free(udev, buf);
+}
+
+/*
+ * At full speed, the payload header fits in a packet of its own, padded up to the bulk
+ * endpoint max packet size, and the video data follows without any padding.
+ */
+ZTEST(uvc, test_payload_header_fs)
+{
+	struct video_format fmt = {.type = VIDEO_BUF_TYPE_INPUT};
+	struct usb_device *udev;
+	struct video_buffer *vbuf;
+	uint8_t last_fid = 0;
+	size_t len;
+	int err;
+
+	udev = usbh_device_get_any(&uhs_ctx);
+	zassert_not_null(udev, "No USB device available");
+
+	test_commit_format(udev);
+
+	err = video_get_format(uvc_dev, &fmt);
+	zassert_equal(err, 0, "Format not selected (%d)", err);
+	zassert_true(fmt.pitch > TEST_FS_BULK_MPS, "Line of %u bytes too short", fmt.pitch);
+
+	for (int i = 0; i < TEST_NUM_FRAMES; i++) {
+		vbuf = video_buffer_alloc(fmt.pitch, K_NO_WAIT);
+		zassert_not_null(vbuf, "Failed to allocate video buffer");
+
+		for (size_t n = 0; n < fmt.pitch; n++) {
+			vbuf->buffer[n] = (uint8_t)(n + i);
+		}
+
+		/* Last line of the frame, so that the payload ends it */
+		vbuf->type = VIDEO_BUF_TYPE_INPUT;
+		vbuf->bytesused = fmt.pitch;
+		vbuf->line_offset = fmt.height - 1;
+
+		err = video_enqueue(uvc_dev, vbuf);
+		zassert_equal(err, 0, "Failed to enqueue video buffer (%d)", err);
+
+		/* Header-only first packet */
+		len = test_bulk_in(udev, TEST_FS_BULK_MPS);
+		zassert_equal(len, TEST_FS_BULK_MPS, "Header packet of %zu bytes", len);
+		zassert_equal(test_xfer_data[0], TEST_FS_BULK_MPS,
+			      "bHeaderLength %u is not the packet size", test_xfer_data[0]);
+		zassert_true(test_xfer_data[1] & UVC_BMHEADERINFO_END_OF_FRAME,
+			     "EOF bit not set on frame %d", i);
+
+		if (i > 0) {
+			zassert_not_equal(test_xfer_data[1] & UVC_BMHEADERINFO_FRAMEID, last_fid,
+					  "FID not toggled on frame %d", i);
+		}
+
+		last_fid = test_xfer_data[1] & UVC_BMHEADERINFO_FRAMEID;
+
+		for (size_t n = 2; n < TEST_FS_BULK_MPS; n++) {
+			zassert_equal(test_xfer_data[n], 0, "Header padding byte %zu not zero", n);
+		}
+
+		/* Video data, exactly as enqueued */
+		len = test_bulk_in(udev, fmt.pitch);
+		zassert_equal(len, fmt.pitch, "Received %zu bytes of data instead of %u",
+			      len, fmt.pitch);
+		zassert_mem_equal(test_xfer_data, vbuf->buffer, fmt.pitch,
+				  "Video data mismatch on frame %d", i);
+
+		if (fmt.pitch % TEST_FS_BULK_MPS == 0) {
+			len = test_bulk_in(udev, TEST_FS_BULK_MPS);
+			zassert_equal(len, 0, "Expected a ZLP, got %zu bytes", len);
+		}
+
+		err = video_dequeue(uvc_dev, &vbuf, K_MSEC(1000));
+		zassert_equal(err, 0, "Video buffer not returned (%d)", err);
+
+		video_buffer_release(vbuf);
+	}
+}
+
+static void *uvc_test_enable(void)
+{
+	int err;
+
+	zassert_true(device_is_ready(video_dev), "Video source not ready");
+	uvc_set_video_dev(uvc_dev, video_dev);
+
+	err = usbh_init(&uhs_ctx);
+	zassert_equal(err, 0, "Failed to initialize USB host");
+
+	err = usbh_enable(&uhs_ctx);
+	zassert_equal(err, 0, "Failed to enable USB host");
+
+	err = uhc_bus_reset(uhs_ctx.dev);
+	zassert_equal(err, 0, "Failed to signal bus reset");
+
+	err = uhc_bus_resume(uhs_ctx.dev);
+	zassert_equal(err, 0, "Failed to signal bus resume");
+
+	err = uhc_sof_enable(uhs_ctx.dev);
+	zassert_equal(err, 0, "Failed to enable SoF generator");
+
+	err = usbd_add_descriptor(&test_usbd, &test_lang);
+	zassert_equal(err, 0, "Failed to initialize descriptor (%d)", err);
+
+	err = usbd_add_descriptor(&test_usbd, &test_mfg);
+	zassert_equal(err, 0, "Failed to initialize descriptor (%d)", err);
+
+	err = usbd_add_descriptor(&test_usbd, &test_product);
+	zassert_equal(err, 0, "Failed to initialize descriptor (%d)", err);
+
+	err = usbd_add_configuration(&test_usbd, USBD_SPEED_FS, &test_fs_config);
+	zassert_equal(err, 0, "Failed to add configuration (%d)", err);
+
+	err = usbd_register_all_classes(&test_usbd, USBD_SPEED_FS, 1, NULL);
+	zassert_equal(err, 0, "Failed to register all instances(%d)", err);
+
+	usbd_device_set_code_triple(&test_usbd, USBD_SPEED_FS, USB_BCC_MISCELLANEOUS, 0x02, 0x01);
+
+	err = usbd_init(&test_usbd);
+	zassert_equal(err, 0, "Failed to initialize device support");
+
+	err = usbd_enable(&test_usbd);
+	zassert_equal(err, 0, "Failed to enable device support");
+
+	LOG_INF("Device support enabled");
+
+	/* Allow the host time to reset the device. */
+	k_msleep(200);
+
+	return NULL;
+}
+
+static void uvc_test_shutdown(void *f)
+{
+	int err;
+
+	err = usbd_disable(&test_usbd);
+	zassert_equal(err, 0, "Failed to disable device support");
+
+	err = usbd_shutdown(&test_usbd);
+	zassert_equal(err, 0, "Failed to shutdown device support");
+
+	err = usbh_disable(&uhs_ctx);
+	zassert_equal(err, 0, "Failed to disable USB host");
+}
+
+ZTEST_SUITE(uvc, NULL, uvc_test_enable, NULL, NULL, uvc_test_shutdown);
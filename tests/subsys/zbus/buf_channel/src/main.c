@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net_buf.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#define MSG_SIZE 2048
+
+NET_BUF_POOL_HEAP_DEFINE(msg_pool, 6, sizeof(struct zbus_channel *), NULL);
+
+static struct net_buf *listener_buf;
+static size_t listener_len;
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	listener_buf = zbus_chan_buf(chan);
+	listener_len = listener_buf->len;
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+ZBUS_MSG_SUBSCRIBER_DEFINE(msub);
+
+static bool validator(const void *msg, size_t msg_size)
+{
+	ARG_UNUSED(msg);
+
+	return msg_size > 0;
+}
+
+ZBUS_BUF_CHAN_DEFINE(buf_chan, validator, NULL, ZBUS_OBSERVERS(lis, msub));
+
+static struct net_buf *msg_alloc(uint8_t fill)
+{
+	struct net_buf *buf = net_buf_alloc_len(&msg_pool, MSG_SIZE, K_NO_WAIT);
+
+	zassert_not_null(buf);
+	memset(net_buf_add(buf, MSG_SIZE), fill, MSG_SIZE);
+
+	return buf;
+}
+
+ZTEST(buf_channel, test_pub_buf)
+{
+	const struct zbus_channel *chan;
+	struct net_buf *buf, *rbuf, *sbuf;
+
+	zassert_equal(-ENODATA, zbus_chan_read_buf(&buf_chan, &rbuf, K_NO_WAIT));
+
+	buf = msg_alloc(0xa5);
+	zassert_equal(0, zbus_chan_pub_buf(&buf_chan, buf, K_NO_WAIT));
+
+	/* The listener sees the published buffer itself */
+	zassert_equal_ptr(listener_buf, buf);
+	zassert_equal(listener_len, MSG_SIZE);
+
+	/* Readers get a reference to the buffer kept by the channel */
+	zassert_equal(0, zbus_chan_read_buf(&buf_chan, &rbuf, K_NO_WAIT));
+	zassert_equal_ptr(rbuf, buf);
+	net_buf_unref(rbuf);
+
+	/* The message subscriber's clone shares the data of the published buffer */
+	zassert_equal(0, zbus_sub_wait_buf(&msub, &chan, &sbuf, K_NO_WAIT));
+	zassert_equal_ptr(chan, &buf_chan);
+	zassert_equal_ptr(sbuf->data, buf->data);
+	zassert_equal(sbuf->len, MSG_SIZE);
+	zassert_equal(sbuf->data[MSG_SIZE - 1], 0xa5);
+	net_buf_unref(sbuf);
+
+	/* Publishing again releases the previous buffer */
+	buf = msg_alloc(0x5a);
+	zassert_equal(0, zbus_chan_pub_buf(&buf_chan, buf, K_NO_WAIT));
+	zassert_equal(0, zbus_sub_wait_buf(&msub, &chan, &sbuf, K_NO_WAIT));
+	zassert_equal(sbuf->data[0], 0x5a);
+	net_buf_unref(sbuf);
+	zassert_equal(atomic_get(&msg_pool.avail_count), msg_pool.buf_count - 1);
+}
+
+ZTEST(buf_channel, test_pub_buf_invalid)
+{
+	struct net_buf *buf = net_buf_alloc_len(&msg_pool, MSG_SIZE, K_NO_WAIT);
+	atomic_val_t avail;
+
+	zassert_not_null(buf);
+	avail = atomic_get(&msg_pool.avail_count);
+
+	/* Invalid messages are rejected and their reference released */
+	zassert_equal(-ENOMSG, zbus_chan_pub_buf(&buf_chan, buf, K_NO_WAIT));
+	zassert_equal(atomic_get(&msg_pool.avail_count), avail + 1);
+}
+
+ZTEST_SUITE(buf_channel, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct state_msg {
+	uint32_t a;
+	uint32_t b;
+};
+
+static bool validator(const void *msg, size_t msg_size)
+{
+	const struct state_msg *state = msg;
+
+	ARG_UNUSED(msg_size);
+
+	return state->a == state->b;
+}
+
+static int listener_count;
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	const struct state_msg *state = zbus_chan_const_msg(chan);
+
+	zassert_equal(state->a, state->b);
+	listener_count++;
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+
+ZBUS_CHAN_DEFINE(state_chan, struct state_msg, validator, NULL, ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(observed_chan, struct state_msg, NULL, NULL, ZBUS_OBSERVERS(lis),
+		 ZBUS_MSG_INIT(0));
+
+ZTEST(seqlock_channel, test_pub_read)
+{
+	struct state_msg state = {.a = 7, .b = 7};
+
+	zassert_equal(0, zbus_chan_seq_read(&state_chan, &state));
+	zassert_equal(state.a, 0);
+
+	state.a = state.b = 42;
+	zassert_equal(0, zbus_chan_seq_pub(&state_chan, &state, K_NO_WAIT));
+	zassert_equal(1, zbus_chan_pub_stats_count(&state_chan));
+
+	state.a = state.b = 0;
+	zassert_equal(0, zbus_chan_seq_read(&state_chan, &state));
+	zassert_equal(state.a, 42);
+	zassert_equal(state.b, 42);
+
+	/* Invalid messages are not written */
+	state.a = 1;
+	zassert_equal(-ENOMSG, zbus_chan_seq_pub(&state_chan, &state, K_NO_WAIT));
+	zassert_equal(0, zbus_chan_seq_read(&state_chan, &state));
+	zassert_equal(state.a, 42);
+}
+
+ZTEST(seqlock_channel, test_notify_observers)
+{
+	struct state_msg state = {.a = 3, .b = 3};
+
+	listener_count = 0;
+	zassert_equal(0, zbus_chan_seq_pub(&observed_chan, &state, K_NO_WAIT));
+	zassert_equal(1, listener_count);
+}
+
+ZTEST(seqlock_channel, test_read_during_write)
+{
+	struct state_msg state;
+	atomic_val_t seq = atomic_get(&state_chan.data->seq);
+
+	/* A write in progress makes readers give up instead of blocking */
+	atomic_set(&state_chan.data->seq, seq + 1);
+	zassert_equal(-EAGAIN, zbus_chan_seq_read(&state_chan, &state));
+
+	atomic_set(&state_chan.data->seq, seq + 2);
+	zassert_equal(0, zbus_chan_seq_read(&state_chan, &state));
+}
+
+ZTEST_SUITE(seqlock_channel, NULL, NULL, NULL, NULL, NULL);
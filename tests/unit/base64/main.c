@@ -129,4 +129,60 @@ ZTEST(lib_base64, test_base64_codec)
 	zassert_equal(rc, -ENOMEM, "Error: dst NULL: decode test return value");
 }
 
+/* Long enough for the word and vector paths, at every alignment of the tail */
+ZTEST(lib_base64, test_base64_long)
+{
+	static unsigned char src[200];
+	static unsigned char enc[300];
+	static unsigned char lines[310];
+	static unsigned char dec[200];
+	size_t enc_len;
+	size_t len;
+	size_t n;
+	int rc;
+
+	for (size_t i = 0; i < sizeof(src); i++) {
+		src[i] = (unsigned char)(i * 37 + 11);
+	}
+
+	for (size_t slen = 0; slen <= sizeof(src); slen++) {
+		rc = base64_encode(enc, sizeof(enc), &enc_len, src, slen);
+		zassert_equal(rc, 0, "Encode return value, length %zu", slen);
+		zassert_equal(enc_len, (slen + 2) / 3 * 4, "Encoded length %zu", slen);
+
+		for (size_t i = 0; i < enc_len; i++) {
+			zassert_true(memchr(base64_enc_map, enc[i], sizeof(base64_enc_map)) != NULL ||
+				     (enc[i] == '=' && i >= enc_len - 2), "Character %zu", i);
+		}
+
+		rc = base64_decode(dec, sizeof(dec), &len, enc, enc_len);
+		zassert_equal(rc, 0, "Decode return value, length %zu", slen);
+		zassert_equal(len, slen, "Decoded length %zu", slen);
+		zassert_mem_equal(dec, src, slen, "Decode comparison, length %zu", slen);
+	}
+
+	/* Line breaks every 64 characters, as in PEM */
+	rc = base64_encode(enc, sizeof(enc), &enc_len, src, sizeof(src));
+	zassert_equal(rc, 0, "Encode return value");
+
+	len = 0;
+	for (size_t i = 0; i < enc_len; i += 64) {
+		n = MIN(64, enc_len - i);
+		memcpy(&lines[len], &enc[i], n);
+		len += n;
+		lines[len++] = '\r';
+		lines[len++] = '\n';
+	}
+
+	rc = base64_decode(dec, sizeof(dec), &n, lines, len);
+	zassert_equal(rc, 0, "Lines: decode return value");
+	zassert_equal(n, sizeof(src), "Lines: decoded length");
+	zassert_mem_equal(dec, src, sizeof(src), "Lines: decode comparison");
+
+	/* A character outside of the alphabet in the middle of a long run */
+	enc[100] = '-';
+	rc = base64_decode(dec, sizeof(dec), &len, enc, enc_len);
+	zassert_equal(rc, -EINVAL, "Invalid: decode return value");
+}
+
 ZTEST_SUITE(lib_base64, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 Audio Inventions Ltd
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/btree.h>
+
+#include "../../../lib/utils/btree.c"
+
+#define MAX_NODES 512
+
+struct item {
+	struct btree_node node;
+	int key;
+};
+
+static struct btree tree;
+static struct item items[MAX_NODES];
+static bool in_tree[MAX_NODES];
+
+/* Node currently being inserted, for testing lessthan() argument order */
+static struct btree_node *current_insertee;
+
+static bool item_lessthan(struct btree_node *a, struct btree_node *b)
+{
+	if (current_insertee != NULL) {
+		zassert_equal_ptr(a, current_insertee);
+		zassert_not_equal(b, current_insertee);
+	}
+
+	return CONTAINER_OF(a, struct item, node)->key < CONTAINER_OF(b, struct item, node)->key;
+}
+
+/* Simple LCRNG, repeatable across platforms */
+static unsigned int next_rand_mod(unsigned int mod)
+{
+	static unsigned long long state = 123456789;
+
+	state = state * 2862933555777941757ul + 3037000493ul;
+
+	return ((unsigned int)(state >> 32)) % mod;
+}
+
+/* Checks a block and its subtree, returns its height and counts its blocks */
+static int check_block(struct btree_block *b, struct btree_block *parent, int *blocks)
+{
+	int height = 0;
+
+	*blocks += 1;
+	zassert_equal_ptr(b->parent, parent);
+	zassert_false(b->is_free);
+	zassert_true(b->count <= BTREE_ORDER);
+	zassert_true(b->count >= ((parent == NULL) ? (b->is_leaf ? 1 : 2) : BTREE_MIN));
+
+	for (int i = 0; i < b->count; i++) {
+		if (i > 0) {
+			zassert_false(item_lessthan(b->keys[i], b->keys[i - 1]));
+		}
+
+		if (b->is_leaf) {
+			zassert_equal_ptr(b->keys[i]->leaf, b);
+		} else {
+			struct btree_block *c = b->children[i];
+			int h = check_block(c, b, blocks);
+
+			zassert_true(i == 0 || h == height, "Leaves at different depths");
+			height = h;
+
+			while (!c->is_leaf) {
+				c = c->children[0];
+			}
+			zassert_equal_ptr(b->keys[i], c->keys[0], "Key is not the lowest node");
+		}
+	}
+
+	return height + 1;
+}
+
+static void check_tree(void)
+{
+	struct btree_node *n;
+	struct btree_node *last = NULL;
+	struct btree_block *b;
+	int count = 0;
+	int blocks = 0;
+	int free_blocks = 0;
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		count += in_tree[i] ? 1 : 0;
+		zassert_equal(btree_contains(&tree, &items[i].node), in_tree[i], "Node %d", i);
+	}
+
+	if (tree.root != NULL) {
+		check_block(tree.root, NULL, &blocks);
+	}
+
+	/* Every node lends a block, the tree uses some and keeps the others */
+	for (b = tree.free; b != NULL; b = b->parent) {
+		zassert_true(b->is_free);
+		free_blocks++;
+	}
+	zassert_equal(blocks + free_blocks, count);
+	zassert_true(count <= 1 || blocks < count);
+
+	/* The leaf chain holds all nodes in order */
+	BTREE_FOR_EACH(&tree, n) {
+		zassert_true(in_tree[CONTAINER_OF(n, struct item, node) - items]);
+		if (last != NULL) {
+			zassert_false(item_lessthan(n, last));
+		}
+		last = n;
+		count--;
+	}
+	zassert_equal(count, 0);
+	zassert_equal_ptr(btree_get_max(&tree), last);
+
+	for (b = tree.last; (b != NULL) && (b->next == NULL); b = b->prev) {
+		if (b->prev == NULL) {
+			zassert_equal_ptr(b, tree.first);
+			break;
+		}
+		zassert_equal_ptr(b->prev->next, b);
+	}
+}
+
+static void checked_insert(int i)
+{
+	current_insertee = &items[i].node;
+	btree_insert(&tree, &items[i].node);
+	current_insertee = NULL;
+	in_tree[i] = true;
+}
+
+static void checked_remove(int i)
+{
+	btree_remove(&tree, &items[i].node);
+	in_tree[i] = false;
+}
+
+static void test_tree(int size, int keys)
+{
+	/* Small trees get checked after every op, big trees less often */
+	bool small_tree = size <= 64;
+
+	memset(&tree, 0, sizeof(tree));
+	tree.lessthan_fn = item_lessthan;
+	memset(in_tree, 0, sizeof(in_tree));
+
+	for (int i = 0; i < size; i++) {
+		items[i].key = next_rand_mod(keys);
+	}
+
+	for (int j = 0; j < 10; j++) {
+		for (int k = 0; k < size; k++) {
+			int i = next_rand_mod(size);
+
+			if (!in_tree[i]) {
+				checked_insert(i);
+			} else {
+				checked_remove(i);
+			}
+
+			if (small_tree) {
+				check_tree();
+			}
+		}
+
+		if (!small_tree) {
+			check_tree();
+		}
+	}
+
+	for (int i = 0; i < size; i++) {
+		if (in_tree[i]) {
+			checked_remove(i);
+		}
+	}
+	check_tree();
+	zassert_is_null(tree.root);
+	zassert_is_null(tree.free);
+}
+
+ZTEST(btree_api, test_btree_spam)
+{
+	for (int size = 1; size < MAX_NODES; size = size * 2 + 1) {
+		/* Distinct keys, then many equal ones */
+		test_tree(size, INT_MAX);
+		test_tree(size, 3);
+	}
+}
+
+ZTEST(btree_api, test_btree_minmax)
+{
+	memset(&tree, 0, sizeof(tree));
+	tree.lessthan_fn = item_lessthan;
+	memset(in_tree, 0, sizeof(in_tree));
+
+	zassert_is_null(btree_get_min(&tree));
+	zassert_is_null(btree_get_max(&tree));
+
+	/* Descending keys, so that every insertion changes the minimum */
+	for (int i = 0; i < MAX_NODES; i++) {
+		items[i].key = MAX_NODES - i;
+		checked_insert(i);
+		zassert_equal_ptr(btree_get_min(&tree), &items[i].node);
+		zassert_equal_ptr(btree_get_max(&tree), &items[0].node);
+	}
+	check_tree();
+
+	/* Removing the minimum repeatedly, as a priority queue does */
+	for (int i = MAX_NODES - 1; i >= 0; i--) {
+		zassert_equal_ptr(btree_get_min(&tree), &items[i].node);
+		checked_remove(i);
+	}
+	check_tree();
+}
+
+ZTEST(btree_api, test_btree_fifo)
+{
+	struct item *it;
+	int last = -1;
+
+	memset(&tree, 0, sizeof(tree));
+	tree.lessthan_fn = item_lessthan;
+	memset(in_tree, 0, sizeof(in_tree));
+
+	/* Nodes which compare as equal are kept in insertion order */
+	for (int i = 0; i < 100; i++) {
+		items[i].key = i % 2;
+		checked_insert(i);
+	}
+
+	BTREE_FOR_EACH_CONTAINER(&tree, it, node) {
+		int i = it - items;
+
+		zassert_true((last < 0) || (items[last].key < it->key) || (last < i));
+		last = i;
+	}
+}
+
+ZTEST_SUITE(btree_api, NULL, NULL, NULL, NULL, NULL);
@@ -74,6 +74,42 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Bit at a time reference of the reflected CRCs, without any inversion */
+static uint32_t crc_reflected_ref(uint32_t poly, uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		for (int j = 0; j < 8; j++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+		}
+	}
+
+	return crc;
+}
+
+/* Covers the tails and unaligned starts of the sliced and CPU variants */
+ZTEST(crc, test_crc_long_buffers)
+{
+	static uint8_t buf[80];
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 37U + 11U);
+	}
+
+	for (size_t offset = 0; offset < 8; offset++) {
+		for (size_t len = 0; len <= sizeof(buf) - offset; len++) {
+			const uint8_t *data = buf + offset;
+
+			zassert_equal(crc32_ieee_update(0x12345678, data, len),
+				      ~crc_reflected_ref(0xEDB88320, ~0x12345678U, data, len));
+			zassert_equal(crc32_c(0, data, len, true, true),
+				      ~crc_reflected_ref(0x82F63B78, 0xFFFFFFFF, data, len));
+			zassert_equal(crc16_ccitt(0xFFFF, data, len),
+				      crc_reflected_ref(0x8408, 0xFFFF, data, len));
+		}
+	}
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <ctype.h>
 #include <zephyr/ztest.h>
 #include <zephyr/sys/util.h>
 
@@ -120,4 +121,48 @@ ZTEST(hex, test_hex2bin_buf_too_small)
 	zassert_equal(hex2bin(hexstr, strlen(hexstr), buf, sizeof(buf)), 0);
 }
 
+/* Long enough for the word and vector paths, at every alignment of the tail */
+ZTEST(hex, test_long)
+{
+	static uint8_t buf[256];
+	static uint8_t dec[256];
+	static char hexstr[2 * sizeof(buf) + 1];
+	char c;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+
+	for (size_t len = 0; len <= sizeof(buf); len += 7) {
+		zassert_equal(bin2hex(buf, len, hexstr, sizeof(hexstr)), 2 * len);
+		zassert_equal(hexstr[2 * len], '\0');
+
+		for (size_t i = 0; i < len; i++) {
+			zassert_ok(hex2char(buf[i] >> 4, &c));
+			zassert_equal(hexstr[2 * i], c, "High nibble of byte %zu", i);
+			zassert_ok(hex2char(buf[i] & 0xf, &c));
+			zassert_equal(hexstr[2 * i + 1], c, "Low nibble of byte %zu", i);
+		}
+
+		/* Mixed case */
+		for (size_t i = 0; i < 2 * len; i += 3) {
+			hexstr[i] = toupper((unsigned char)hexstr[i]);
+		}
+
+		memset(dec, 0, sizeof(dec));
+		zassert_equal(hex2bin(hexstr, 2 * len, dec, sizeof(dec)), len);
+		zassert_mem_equal(dec, buf, len);
+	}
+
+	/* Invalid characters at every position, below and above the digits and letters */
+	bin2hex(buf, sizeof(buf), hexstr, sizeof(hexstr));
+	for (size_t i = 0; i < 2 * sizeof(buf); i++) {
+		c = hexstr[i];
+		hexstr[i] = "/:@G`g\x80"[i % 7];
+		zassert_equal(hex2bin(hexstr, 2 * sizeof(buf), dec, sizeof(dec)), 0,
+			      "Invalid character at %zu", i);
+		hexstr[i] = c;
+	}
+}
+
 ZTEST_SUITE(hex, NULL, NULL, NULL, NULL, NULL);